@@ -56,6 +56,11 @@ endif()
 set(HAVE_CLOSESOCKET 0)
 set(HAVE_DECL_FSEEKO 1)
 set(HAVE_DIRENT_H 1)
+if(CMAKE_SYSTEM_NAME STREQUAL "Linux")
+  set(HAVE_EPOLL_CREATE1 1)
+else()
+  set(HAVE_EPOLL_CREATE1 0)
+endif()
 if(APPLE OR
    CYGWIN OR
    CMAKE_SYSTEM_NAME STREQUAL "OpenBSD")
@@ -260,6 +265,11 @@ set(HAVE_STRUCT_TIMEVAL 1)
 if(ANDROID OR CMAKE_SYSTEM_NAME STREQUAL "iOS")
   set(HAVE_SUSECONDS_T 1)
 endif()
+if(CMAKE_SYSTEM_NAME STREQUAL "Linux")
+  set(HAVE_SYS_EPOLL_H 1)
+else()
+  set(HAVE_SYS_EPOLL_H 0)
+endif()
 if(APPLE OR
    CYGWIN OR
    CMAKE_SYSTEM_NAME STREQUAL "OpenBSD")
@@ -88,6 +88,7 @@ set(HAVE_ALARM 0)
 set(HAVE_ARC4RANDOM 0)
 set(HAVE_ARPA_INET_H 0)
 set(HAVE_CLOSESOCKET 1)
+set(HAVE_EPOLL_CREATE1 0)
 set(HAVE_EVENTFD 0)
 set(HAVE_FCNTL 0)
 set(HAVE_FCNTL_H 1)
@@ -162,6 +163,7 @@ set(HAVE_STRERROR_R 0)
 set(HAVE_STROPTS_H 0)
 set(HAVE_STRUCT_SOCKADDR_STORAGE 1)
 set(HAVE_STRUCT_TIMEVAL 1)
+set(HAVE_SYS_EPOLL_H 0)
 set(HAVE_SYS_EVENTFD_H 0)
 set(HAVE_SYS_FILIO_H 0)
 set(HAVE_SYS_IOCTL_H 0)
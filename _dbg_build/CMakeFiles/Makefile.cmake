@@ -0,0 +1,308 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMake/CurlSymbolHiding.cmake"
+  "/root/repo/CMake/FindBrotli.cmake"
+  "/root/repo/CMake/FindLibidn2.cmake"
+  "/root/repo/CMake/FindNGHTTP2.cmake"
+  "/root/repo/CMake/FindZstd.cmake"
+  "/root/repo/CMake/Macros.cmake"
+  "/root/repo/CMake/OtherTests.cmake"
+  "/root/repo/CMake/PickyWarnings.cmake"
+  "/root/repo/CMake/Utilities.cmake"
+  "/root/repo/CMake/cmake_uninstall.cmake.in"
+  "/root/repo/CMake/curl-config.cmake.in"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "docs/cmdline-opts/Makefile.inc.cmake"
+  "docs/examples/Makefile.inc.cmake"
+  "docs/libcurl/Makefile.inc.cmake"
+  "docs/libcurl/opts/Makefile.inc.cmake"
+  "lib/Makefile.inc.cmake"
+  "src/Makefile.inc.cmake"
+  "tests/certs/Makefile.inc.cmake"
+  "tests/libtest/Makefile.inc.cmake"
+  "tests/server/Makefile.inc.cmake"
+  "tests/tunit/Makefile.inc.cmake"
+  "tests/unit/Makefile.inc.cmake"
+  "/root/repo/curl-config.in"
+  "/root/repo/docs/CMakeLists.txt"
+  "/root/repo/docs/cmdline-opts/CMakeLists.txt"
+  "/root/repo/docs/cmdline-opts/Makefile.inc"
+  "/root/repo/docs/examples/CMakeLists.txt"
+  "/root/repo/docs/examples/Makefile.inc"
+  "/root/repo/docs/libcurl/CMakeLists.txt"
+  "/root/repo/docs/libcurl/Makefile.inc"
+  "/root/repo/docs/libcurl/opts/CMakeLists.txt"
+  "/root/repo/docs/libcurl/opts/Makefile.inc"
+  "/root/repo/lib/CMakeLists.txt"
+  "/root/repo/lib/Makefile.inc"
+  "/root/repo/lib/curl_config.h.cmake"
+  "/root/repo/libcurl.pc.in"
+  "/root/repo/scripts/CMakeLists.txt"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/Makefile.inc"
+  "/root/repo/tests/CMakeLists.txt"
+  "/root/repo/tests/certs/CMakeLists.txt"
+  "/root/repo/tests/certs/Makefile.inc"
+  "/root/repo/tests/config.in"
+  "/root/repo/tests/configurehelp.pm.in"
+  "/root/repo/tests/http/CMakeLists.txt"
+  "/root/repo/tests/http/config.ini.in"
+  "/root/repo/tests/libtest/CMakeLists.txt"
+  "/root/repo/tests/libtest/Makefile.inc"
+  "/root/repo/tests/server/CMakeLists.txt"
+  "/root/repo/tests/server/Makefile.inc"
+  "/root/repo/tests/tunit/CMakeLists.txt"
+  "/root/repo/tests/tunit/Makefile.inc"
+  "/root/repo/tests/unit/CMakeLists.txt"
+  "/root/repo/tests/unit/Makefile.inc"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-SameMajorVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePushCheckState.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckStructHasMember.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindCygwin.cmake"
+  "/usr/share/cmake-3.25/Modules/FindMsys.cmake"
+  "/usr/share/cmake-3.25/Modules/FindOpenSSL.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPerl.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/FindZLIB.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "curl-config"
+  "libcurl.pc"
+  "generated/CURLConfigVersion.cmake"
+  "generated/CURLConfig.cmake"
+  "CMake/cmake_uninstall.cmake"
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "docs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "docs/libcurl/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "docs/libcurl/opts/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "docs/cmdline-opts/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "scripts/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lib/curl_config.h"
+  "lib/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "docs/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/config"
+  "tests/configurehelp.pm"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/http/config.ini"
+  "tests/http/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/server/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/libtest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/tunit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/certs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/curl-ca-bundle.dir/DependInfo.cmake"
+  "CMakeFiles/curl-ca-firefox.dir/DependInfo.cmake"
+  "CMakeFiles/curl_uninstall.dir/DependInfo.cmake"
+  "docs/CMakeFiles/curl-generate-curl-config.1.dir/DependInfo.cmake"
+  "docs/CMakeFiles/curl-generate-mk-ca-bundle.1.dir/DependInfo.cmake"
+  "docs/CMakeFiles/curl-generate-wcurl.1.dir/DependInfo.cmake"
+  "docs/CMakeFiles/curl-generate-runtests.1.dir/DependInfo.cmake"
+  "docs/CMakeFiles/curl-generate-testcurl.1.dir/DependInfo.cmake"
+  "docs/libcurl/CMakeFiles/curl-man.dir/DependInfo.cmake"
+  "docs/libcurl/opts/CMakeFiles/curl-opts-man.dir/DependInfo.cmake"
+  "docs/cmdline-opts/CMakeFiles/generate-curl.1.dir/DependInfo.cmake"
+  "lib/CMakeFiles/curlu.dir/DependInfo.cmake"
+  "lib/CMakeFiles/curlu-unitprotos.dir/DependInfo.cmake"
+  "lib/CMakeFiles/libcurl_static.dir/DependInfo.cmake"
+  "src/CMakeFiles/curl.dir/DependInfo.cmake"
+  "src/CMakeFiles/curlinfo.dir/DependInfo.cmake"
+  "src/CMakeFiles/curltool.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-examples.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-10-at-a-time.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-address-scope.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-altsvc.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-anyauthput.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-block_ip.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-certinfo.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-chkspeed.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-connect-to.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-cookie_interface.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-debug.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-default-scheme.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-externalsocket.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-fileupload.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-ftp-delete.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-ftp-wildcard.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-ftpget.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-ftpgetinfo.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-ftpgetresp.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-ftpsget.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-ftpupload.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-ftpuploadfrommem.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-ftpuploadresume.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-getinfo.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-getinmemory.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-getredirect.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-getreferrer.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-headerapi.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-hsts-preload.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-http-options.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-http-post.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-http2-download.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-http2-pushinmemory.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-http2-serverpush.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-http2-upload.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-http3.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-http3-present.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-httpcustomheader.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-httpput.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-httpput-postfields.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-https.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-imap-append.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-imap-authzid.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-imap-copy.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-imap-create.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-imap-delete.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-imap-examine.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-imap-fetch.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-imap-list.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-imap-lsub.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-imap-multi.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-imap-noop.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-imap-search.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-imap-ssl.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-imap-store.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-imap-tls.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-interface.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-ipv6.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-keepalive.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-localport.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-maxconnects.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-multi-app.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-multi-debugcallback.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-multi-double.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-multi-formadd.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-multi-legacy.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-multi-post.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-multi-single.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-netrc.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-parseurl.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-persistent.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-pop3-authzid.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-pop3-dele.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-pop3-list.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-pop3-multi.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-pop3-noop.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-pop3-retr.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-pop3-ssl.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-pop3-stat.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-pop3-tls.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-pop3-top.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-pop3-uidl.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-post-callback.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-postinmemory.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-postit2.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-postit2-formadd.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-progressfunc.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-protofeats.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-range.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-resolve.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-rtsp-options.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-sendrecv.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-sepheaders.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-sftpget.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-sftpuploadresume.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-shared-connection-cache.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-simple.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-simplepost.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-simplessl.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-smtp-authzid.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-smtp-expn.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-smtp-mail.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-smtp-mime.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-smtp-multi.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-smtp-ssl.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-smtp-tls.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-smtp-vrfy.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-sslbackend.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-unixsocket.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-url2file.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-urlapi.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-websocket.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-websocket-cb.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-websocket-updown.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-example-all.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/curl-examples-build.dir/DependInfo.cmake"
+  "tests/CMakeFiles/testdeps.dir/DependInfo.cmake"
+  "tests/CMakeFiles/tests.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test-quiet.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test-am.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test-full.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test-nonflaky.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test-ci.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test-torture.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test-event.dir/DependInfo.cmake"
+  "tests/CMakeFiles/curl-pytest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/curl-pytest-ci.dir/DependInfo.cmake"
+  "tests/server/CMakeFiles/servers.dir/DependInfo.cmake"
+  "tests/libtest/CMakeFiles/libtests.dir/DependInfo.cmake"
+  "tests/tunit/CMakeFiles/tunits.dir/DependInfo.cmake"
+  "tests/unit/CMakeFiles/units.dir/DependInfo.cmake"
+  "tests/certs/CMakeFiles/build-certs.dir/DependInfo.cmake"
+  "tests/certs/CMakeFiles/clean-certs.dir/DependInfo.cmake"
+  )
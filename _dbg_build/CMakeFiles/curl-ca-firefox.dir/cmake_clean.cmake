@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-ca-firefox"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/curl-ca-firefox.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
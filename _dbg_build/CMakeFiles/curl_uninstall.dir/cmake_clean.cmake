@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl_uninstall"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/curl_uninstall.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
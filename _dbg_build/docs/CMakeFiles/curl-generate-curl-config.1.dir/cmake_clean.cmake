@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-generate-curl-config.1"
+  "curl-config.1"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/curl-generate-curl-config.1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
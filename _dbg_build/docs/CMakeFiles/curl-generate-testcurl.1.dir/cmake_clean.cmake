@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-generate-testcurl.1"
+  "testcurl.1"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/curl-generate-testcurl.1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/generate-curl.1"
+  "curl.1"
+  "curl.txt"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/generate-curl.1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "10-at-a-time"
+  "10-at-a-time.pdb"
+  "CMakeFiles/curl-example-10-at-a-time.dir/10-at-a-time.c.o"
+  "CMakeFiles/curl-example-10-at-a-time.dir/10-at-a-time.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-10-at-a-time.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-address-scope.dir/address-scope.c.o"
+  "CMakeFiles/curl-example-address-scope.dir/address-scope.c.o.d"
+  "address-scope"
+  "address-scope.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-address-scope.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
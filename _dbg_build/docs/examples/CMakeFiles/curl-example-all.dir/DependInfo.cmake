@@ -0,0 +1,131 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/docs/examples/10-at-a-time.c" "docs/examples/CMakeFiles/curl-example-all.dir/10-at-a-time.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/10-at-a-time.c.o.d"
+  "/root/repo/docs/examples/address-scope.c" "docs/examples/CMakeFiles/curl-example-all.dir/address-scope.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/address-scope.c.o.d"
+  "/root/repo/docs/examples/altsvc.c" "docs/examples/CMakeFiles/curl-example-all.dir/altsvc.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/altsvc.c.o.d"
+  "/root/repo/docs/examples/anyauthput.c" "docs/examples/CMakeFiles/curl-example-all.dir/anyauthput.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/anyauthput.c.o.d"
+  "/root/repo/docs/examples/block_ip.c" "docs/examples/CMakeFiles/curl-example-all.dir/block_ip.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/block_ip.c.o.d"
+  "/root/repo/docs/examples/certinfo.c" "docs/examples/CMakeFiles/curl-example-all.dir/certinfo.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/certinfo.c.o.d"
+  "/root/repo/docs/examples/chkspeed.c" "docs/examples/CMakeFiles/curl-example-all.dir/chkspeed.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/chkspeed.c.o.d"
+  "/root/repo/docs/examples/connect-to.c" "docs/examples/CMakeFiles/curl-example-all.dir/connect-to.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/connect-to.c.o.d"
+  "/root/repo/docs/examples/cookie_interface.c" "docs/examples/CMakeFiles/curl-example-all.dir/cookie_interface.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/cookie_interface.c.o.d"
+  "/root/repo/docs/examples/debug.c" "docs/examples/CMakeFiles/curl-example-all.dir/debug.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/debug.c.o.d"
+  "/root/repo/docs/examples/default-scheme.c" "docs/examples/CMakeFiles/curl-example-all.dir/default-scheme.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/default-scheme.c.o.d"
+  "/root/repo/docs/examples/externalsocket.c" "docs/examples/CMakeFiles/curl-example-all.dir/externalsocket.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/externalsocket.c.o.d"
+  "/root/repo/docs/examples/fileupload.c" "docs/examples/CMakeFiles/curl-example-all.dir/fileupload.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/fileupload.c.o.d"
+  "/root/repo/docs/examples/ftp-delete.c" "docs/examples/CMakeFiles/curl-example-all.dir/ftp-delete.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/ftp-delete.c.o.d"
+  "/root/repo/docs/examples/ftp-wildcard.c" "docs/examples/CMakeFiles/curl-example-all.dir/ftp-wildcard.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/ftp-wildcard.c.o.d"
+  "/root/repo/docs/examples/ftpget.c" "docs/examples/CMakeFiles/curl-example-all.dir/ftpget.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/ftpget.c.o.d"
+  "/root/repo/docs/examples/ftpgetinfo.c" "docs/examples/CMakeFiles/curl-example-all.dir/ftpgetinfo.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/ftpgetinfo.c.o.d"
+  "/root/repo/docs/examples/ftpgetresp.c" "docs/examples/CMakeFiles/curl-example-all.dir/ftpgetresp.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/ftpgetresp.c.o.d"
+  "/root/repo/docs/examples/ftpsget.c" "docs/examples/CMakeFiles/curl-example-all.dir/ftpsget.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/ftpsget.c.o.d"
+  "/root/repo/docs/examples/ftpupload.c" "docs/examples/CMakeFiles/curl-example-all.dir/ftpupload.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/ftpupload.c.o.d"
+  "/root/repo/docs/examples/ftpuploadfrommem.c" "docs/examples/CMakeFiles/curl-example-all.dir/ftpuploadfrommem.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/ftpuploadfrommem.c.o.d"
+  "/root/repo/docs/examples/ftpuploadresume.c" "docs/examples/CMakeFiles/curl-example-all.dir/ftpuploadresume.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/ftpuploadresume.c.o.d"
+  "/root/repo/docs/examples/getinfo.c" "docs/examples/CMakeFiles/curl-example-all.dir/getinfo.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/getinfo.c.o.d"
+  "/root/repo/docs/examples/getinmemory.c" "docs/examples/CMakeFiles/curl-example-all.dir/getinmemory.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/getinmemory.c.o.d"
+  "/root/repo/docs/examples/getredirect.c" "docs/examples/CMakeFiles/curl-example-all.dir/getredirect.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/getredirect.c.o.d"
+  "/root/repo/docs/examples/getreferrer.c" "docs/examples/CMakeFiles/curl-example-all.dir/getreferrer.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/getreferrer.c.o.d"
+  "/root/repo/docs/examples/headerapi.c" "docs/examples/CMakeFiles/curl-example-all.dir/headerapi.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/headerapi.c.o.d"
+  "/root/repo/docs/examples/hsts-preload.c" "docs/examples/CMakeFiles/curl-example-all.dir/hsts-preload.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/hsts-preload.c.o.d"
+  "/root/repo/docs/examples/http-options.c" "docs/examples/CMakeFiles/curl-example-all.dir/http-options.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/http-options.c.o.d"
+  "/root/repo/docs/examples/http-post.c" "docs/examples/CMakeFiles/curl-example-all.dir/http-post.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/http-post.c.o.d"
+  "/root/repo/docs/examples/http2-download.c" "docs/examples/CMakeFiles/curl-example-all.dir/http2-download.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/http2-download.c.o.d"
+  "/root/repo/docs/examples/http2-pushinmemory.c" "docs/examples/CMakeFiles/curl-example-all.dir/http2-pushinmemory.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/http2-pushinmemory.c.o.d"
+  "/root/repo/docs/examples/http2-serverpush.c" "docs/examples/CMakeFiles/curl-example-all.dir/http2-serverpush.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/http2-serverpush.c.o.d"
+  "/root/repo/docs/examples/http2-upload.c" "docs/examples/CMakeFiles/curl-example-all.dir/http2-upload.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/http2-upload.c.o.d"
+  "/root/repo/docs/examples/http3-present.c" "docs/examples/CMakeFiles/curl-example-all.dir/http3-present.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/http3-present.c.o.d"
+  "/root/repo/docs/examples/http3.c" "docs/examples/CMakeFiles/curl-example-all.dir/http3.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/http3.c.o.d"
+  "/root/repo/docs/examples/httpcustomheader.c" "docs/examples/CMakeFiles/curl-example-all.dir/httpcustomheader.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/httpcustomheader.c.o.d"
+  "/root/repo/docs/examples/httpput-postfields.c" "docs/examples/CMakeFiles/curl-example-all.dir/httpput-postfields.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/httpput-postfields.c.o.d"
+  "/root/repo/docs/examples/httpput.c" "docs/examples/CMakeFiles/curl-example-all.dir/httpput.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/httpput.c.o.d"
+  "/root/repo/docs/examples/https.c" "docs/examples/CMakeFiles/curl-example-all.dir/https.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/https.c.o.d"
+  "/root/repo/docs/examples/imap-append.c" "docs/examples/CMakeFiles/curl-example-all.dir/imap-append.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/imap-append.c.o.d"
+  "/root/repo/docs/examples/imap-authzid.c" "docs/examples/CMakeFiles/curl-example-all.dir/imap-authzid.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/imap-authzid.c.o.d"
+  "/root/repo/docs/examples/imap-copy.c" "docs/examples/CMakeFiles/curl-example-all.dir/imap-copy.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/imap-copy.c.o.d"
+  "/root/repo/docs/examples/imap-create.c" "docs/examples/CMakeFiles/curl-example-all.dir/imap-create.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/imap-create.c.o.d"
+  "/root/repo/docs/examples/imap-delete.c" "docs/examples/CMakeFiles/curl-example-all.dir/imap-delete.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/imap-delete.c.o.d"
+  "/root/repo/docs/examples/imap-examine.c" "docs/examples/CMakeFiles/curl-example-all.dir/imap-examine.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/imap-examine.c.o.d"
+  "/root/repo/docs/examples/imap-fetch.c" "docs/examples/CMakeFiles/curl-example-all.dir/imap-fetch.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/imap-fetch.c.o.d"
+  "/root/repo/docs/examples/imap-list.c" "docs/examples/CMakeFiles/curl-example-all.dir/imap-list.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/imap-list.c.o.d"
+  "/root/repo/docs/examples/imap-lsub.c" "docs/examples/CMakeFiles/curl-example-all.dir/imap-lsub.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/imap-lsub.c.o.d"
+  "/root/repo/docs/examples/imap-multi.c" "docs/examples/CMakeFiles/curl-example-all.dir/imap-multi.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/imap-multi.c.o.d"
+  "/root/repo/docs/examples/imap-noop.c" "docs/examples/CMakeFiles/curl-example-all.dir/imap-noop.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/imap-noop.c.o.d"
+  "/root/repo/docs/examples/imap-search.c" "docs/examples/CMakeFiles/curl-example-all.dir/imap-search.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/imap-search.c.o.d"
+  "/root/repo/docs/examples/imap-ssl.c" "docs/examples/CMakeFiles/curl-example-all.dir/imap-ssl.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/imap-ssl.c.o.d"
+  "/root/repo/docs/examples/imap-store.c" "docs/examples/CMakeFiles/curl-example-all.dir/imap-store.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/imap-store.c.o.d"
+  "/root/repo/docs/examples/imap-tls.c" "docs/examples/CMakeFiles/curl-example-all.dir/imap-tls.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/imap-tls.c.o.d"
+  "/root/repo/docs/examples/interface.c" "docs/examples/CMakeFiles/curl-example-all.dir/interface.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/interface.c.o.d"
+  "/root/repo/docs/examples/ipv6.c" "docs/examples/CMakeFiles/curl-example-all.dir/ipv6.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/ipv6.c.o.d"
+  "/root/repo/docs/examples/keepalive.c" "docs/examples/CMakeFiles/curl-example-all.dir/keepalive.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/keepalive.c.o.d"
+  "/root/repo/docs/examples/localport.c" "docs/examples/CMakeFiles/curl-example-all.dir/localport.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/localport.c.o.d"
+  "/root/repo/docs/examples/maxconnects.c" "docs/examples/CMakeFiles/curl-example-all.dir/maxconnects.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/maxconnects.c.o.d"
+  "/root/repo/docs/examples/multi-app.c" "docs/examples/CMakeFiles/curl-example-all.dir/multi-app.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/multi-app.c.o.d"
+  "/root/repo/docs/examples/multi-debugcallback.c" "docs/examples/CMakeFiles/curl-example-all.dir/multi-debugcallback.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/multi-debugcallback.c.o.d"
+  "/root/repo/docs/examples/multi-double.c" "docs/examples/CMakeFiles/curl-example-all.dir/multi-double.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/multi-double.c.o.d"
+  "/root/repo/docs/examples/multi-formadd.c" "docs/examples/CMakeFiles/curl-example-all.dir/multi-formadd.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/multi-formadd.c.o.d"
+  "/root/repo/docs/examples/multi-legacy.c" "docs/examples/CMakeFiles/curl-example-all.dir/multi-legacy.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/multi-legacy.c.o.d"
+  "/root/repo/docs/examples/multi-post.c" "docs/examples/CMakeFiles/curl-example-all.dir/multi-post.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/multi-post.c.o.d"
+  "/root/repo/docs/examples/multi-single.c" "docs/examples/CMakeFiles/curl-example-all.dir/multi-single.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/multi-single.c.o.d"
+  "/root/repo/docs/examples/netrc.c" "docs/examples/CMakeFiles/curl-example-all.dir/netrc.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/netrc.c.o.d"
+  "/root/repo/docs/examples/parseurl.c" "docs/examples/CMakeFiles/curl-example-all.dir/parseurl.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/parseurl.c.o.d"
+  "/root/repo/docs/examples/persistent.c" "docs/examples/CMakeFiles/curl-example-all.dir/persistent.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/persistent.c.o.d"
+  "/root/repo/docs/examples/pop3-authzid.c" "docs/examples/CMakeFiles/curl-example-all.dir/pop3-authzid.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/pop3-authzid.c.o.d"
+  "/root/repo/docs/examples/pop3-dele.c" "docs/examples/CMakeFiles/curl-example-all.dir/pop3-dele.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/pop3-dele.c.o.d"
+  "/root/repo/docs/examples/pop3-list.c" "docs/examples/CMakeFiles/curl-example-all.dir/pop3-list.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/pop3-list.c.o.d"
+  "/root/repo/docs/examples/pop3-multi.c" "docs/examples/CMakeFiles/curl-example-all.dir/pop3-multi.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/pop3-multi.c.o.d"
+  "/root/repo/docs/examples/pop3-noop.c" "docs/examples/CMakeFiles/curl-example-all.dir/pop3-noop.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/pop3-noop.c.o.d"
+  "/root/repo/docs/examples/pop3-retr.c" "docs/examples/CMakeFiles/curl-example-all.dir/pop3-retr.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/pop3-retr.c.o.d"
+  "/root/repo/docs/examples/pop3-ssl.c" "docs/examples/CMakeFiles/curl-example-all.dir/pop3-ssl.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/pop3-ssl.c.o.d"
+  "/root/repo/docs/examples/pop3-stat.c" "docs/examples/CMakeFiles/curl-example-all.dir/pop3-stat.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/pop3-stat.c.o.d"
+  "/root/repo/docs/examples/pop3-tls.c" "docs/examples/CMakeFiles/curl-example-all.dir/pop3-tls.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/pop3-tls.c.o.d"
+  "/root/repo/docs/examples/pop3-top.c" "docs/examples/CMakeFiles/curl-example-all.dir/pop3-top.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/pop3-top.c.o.d"
+  "/root/repo/docs/examples/pop3-uidl.c" "docs/examples/CMakeFiles/curl-example-all.dir/pop3-uidl.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/pop3-uidl.c.o.d"
+  "/root/repo/docs/examples/post-callback.c" "docs/examples/CMakeFiles/curl-example-all.dir/post-callback.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/post-callback.c.o.d"
+  "/root/repo/docs/examples/postinmemory.c" "docs/examples/CMakeFiles/curl-example-all.dir/postinmemory.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/postinmemory.c.o.d"
+  "/root/repo/docs/examples/postit2-formadd.c" "docs/examples/CMakeFiles/curl-example-all.dir/postit2-formadd.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/postit2-formadd.c.o.d"
+  "/root/repo/docs/examples/postit2.c" "docs/examples/CMakeFiles/curl-example-all.dir/postit2.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/postit2.c.o.d"
+  "/root/repo/docs/examples/progressfunc.c" "docs/examples/CMakeFiles/curl-example-all.dir/progressfunc.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/progressfunc.c.o.d"
+  "/root/repo/docs/examples/protofeats.c" "docs/examples/CMakeFiles/curl-example-all.dir/protofeats.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/protofeats.c.o.d"
+  "/root/repo/docs/examples/range.c" "docs/examples/CMakeFiles/curl-example-all.dir/range.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/range.c.o.d"
+  "/root/repo/docs/examples/resolve.c" "docs/examples/CMakeFiles/curl-example-all.dir/resolve.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/resolve.c.o.d"
+  "/root/repo/docs/examples/rtsp-options.c" "docs/examples/CMakeFiles/curl-example-all.dir/rtsp-options.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/rtsp-options.c.o.d"
+  "/root/repo/docs/examples/sendrecv.c" "docs/examples/CMakeFiles/curl-example-all.dir/sendrecv.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/sendrecv.c.o.d"
+  "/root/repo/docs/examples/sepheaders.c" "docs/examples/CMakeFiles/curl-example-all.dir/sepheaders.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/sepheaders.c.o.d"
+  "/root/repo/docs/examples/sftpget.c" "docs/examples/CMakeFiles/curl-example-all.dir/sftpget.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/sftpget.c.o.d"
+  "/root/repo/docs/examples/sftpuploadresume.c" "docs/examples/CMakeFiles/curl-example-all.dir/sftpuploadresume.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/sftpuploadresume.c.o.d"
+  "/root/repo/docs/examples/shared-connection-cache.c" "docs/examples/CMakeFiles/curl-example-all.dir/shared-connection-cache.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/shared-connection-cache.c.o.d"
+  "/root/repo/docs/examples/simple.c" "docs/examples/CMakeFiles/curl-example-all.dir/simple.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/simple.c.o.d"
+  "/root/repo/docs/examples/simplepost.c" "docs/examples/CMakeFiles/curl-example-all.dir/simplepost.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/simplepost.c.o.d"
+  "/root/repo/docs/examples/simplessl.c" "docs/examples/CMakeFiles/curl-example-all.dir/simplessl.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/simplessl.c.o.d"
+  "/root/repo/docs/examples/smtp-authzid.c" "docs/examples/CMakeFiles/curl-example-all.dir/smtp-authzid.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/smtp-authzid.c.o.d"
+  "/root/repo/docs/examples/smtp-expn.c" "docs/examples/CMakeFiles/curl-example-all.dir/smtp-expn.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/smtp-expn.c.o.d"
+  "/root/repo/docs/examples/smtp-mail.c" "docs/examples/CMakeFiles/curl-example-all.dir/smtp-mail.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/smtp-mail.c.o.d"
+  "/root/repo/docs/examples/smtp-mime.c" "docs/examples/CMakeFiles/curl-example-all.dir/smtp-mime.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/smtp-mime.c.o.d"
+  "/root/repo/docs/examples/smtp-multi.c" "docs/examples/CMakeFiles/curl-example-all.dir/smtp-multi.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/smtp-multi.c.o.d"
+  "/root/repo/docs/examples/smtp-ssl.c" "docs/examples/CMakeFiles/curl-example-all.dir/smtp-ssl.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/smtp-ssl.c.o.d"
+  "/root/repo/docs/examples/smtp-tls.c" "docs/examples/CMakeFiles/curl-example-all.dir/smtp-tls.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/smtp-tls.c.o.d"
+  "/root/repo/docs/examples/smtp-vrfy.c" "docs/examples/CMakeFiles/curl-example-all.dir/smtp-vrfy.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/smtp-vrfy.c.o.d"
+  "/root/repo/docs/examples/sslbackend.c" "docs/examples/CMakeFiles/curl-example-all.dir/sslbackend.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/sslbackend.c.o.d"
+  "/root/repo/docs/examples/unixsocket.c" "docs/examples/CMakeFiles/curl-example-all.dir/unixsocket.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/unixsocket.c.o.d"
+  "/root/repo/docs/examples/url2file.c" "docs/examples/CMakeFiles/curl-example-all.dir/url2file.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/url2file.c.o.d"
+  "/root/repo/docs/examples/urlapi.c" "docs/examples/CMakeFiles/curl-example-all.dir/urlapi.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/urlapi.c.o.d"
+  "/root/repo/docs/examples/websocket-cb.c" "docs/examples/CMakeFiles/curl-example-all.dir/websocket-cb.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/websocket-cb.c.o.d"
+  "/root/repo/docs/examples/websocket-updown.c" "docs/examples/CMakeFiles/curl-example-all.dir/websocket-updown.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/websocket-updown.c.o.d"
+  "/root/repo/docs/examples/websocket.c" "docs/examples/CMakeFiles/curl-example-all.dir/websocket.c.o" "gcc" "docs/examples/CMakeFiles/curl-example-all.dir/websocket.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
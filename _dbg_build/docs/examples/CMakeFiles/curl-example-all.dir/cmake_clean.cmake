@@ -0,0 +1,233 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-all.dir/10-at-a-time.c.o"
+  "CMakeFiles/curl-example-all.dir/10-at-a-time.c.o.d"
+  "CMakeFiles/curl-example-all.dir/address-scope.c.o"
+  "CMakeFiles/curl-example-all.dir/address-scope.c.o.d"
+  "CMakeFiles/curl-example-all.dir/altsvc.c.o"
+  "CMakeFiles/curl-example-all.dir/altsvc.c.o.d"
+  "CMakeFiles/curl-example-all.dir/anyauthput.c.o"
+  "CMakeFiles/curl-example-all.dir/anyauthput.c.o.d"
+  "CMakeFiles/curl-example-all.dir/block_ip.c.o"
+  "CMakeFiles/curl-example-all.dir/block_ip.c.o.d"
+  "CMakeFiles/curl-example-all.dir/certinfo.c.o"
+  "CMakeFiles/curl-example-all.dir/certinfo.c.o.d"
+  "CMakeFiles/curl-example-all.dir/chkspeed.c.o"
+  "CMakeFiles/curl-example-all.dir/chkspeed.c.o.d"
+  "CMakeFiles/curl-example-all.dir/connect-to.c.o"
+  "CMakeFiles/curl-example-all.dir/connect-to.c.o.d"
+  "CMakeFiles/curl-example-all.dir/cookie_interface.c.o"
+  "CMakeFiles/curl-example-all.dir/cookie_interface.c.o.d"
+  "CMakeFiles/curl-example-all.dir/debug.c.o"
+  "CMakeFiles/curl-example-all.dir/debug.c.o.d"
+  "CMakeFiles/curl-example-all.dir/default-scheme.c.o"
+  "CMakeFiles/curl-example-all.dir/default-scheme.c.o.d"
+  "CMakeFiles/curl-example-all.dir/externalsocket.c.o"
+  "CMakeFiles/curl-example-all.dir/externalsocket.c.o.d"
+  "CMakeFiles/curl-example-all.dir/fileupload.c.o"
+  "CMakeFiles/curl-example-all.dir/fileupload.c.o.d"
+  "CMakeFiles/curl-example-all.dir/ftp-delete.c.o"
+  "CMakeFiles/curl-example-all.dir/ftp-delete.c.o.d"
+  "CMakeFiles/curl-example-all.dir/ftp-wildcard.c.o"
+  "CMakeFiles/curl-example-all.dir/ftp-wildcard.c.o.d"
+  "CMakeFiles/curl-example-all.dir/ftpget.c.o"
+  "CMakeFiles/curl-example-all.dir/ftpget.c.o.d"
+  "CMakeFiles/curl-example-all.dir/ftpgetinfo.c.o"
+  "CMakeFiles/curl-example-all.dir/ftpgetinfo.c.o.d"
+  "CMakeFiles/curl-example-all.dir/ftpgetresp.c.o"
+  "CMakeFiles/curl-example-all.dir/ftpgetresp.c.o.d"
+  "CMakeFiles/curl-example-all.dir/ftpsget.c.o"
+  "CMakeFiles/curl-example-all.dir/ftpsget.c.o.d"
+  "CMakeFiles/curl-example-all.dir/ftpupload.c.o"
+  "CMakeFiles/curl-example-all.dir/ftpupload.c.o.d"
+  "CMakeFiles/curl-example-all.dir/ftpuploadfrommem.c.o"
+  "CMakeFiles/curl-example-all.dir/ftpuploadfrommem.c.o.d"
+  "CMakeFiles/curl-example-all.dir/ftpuploadresume.c.o"
+  "CMakeFiles/curl-example-all.dir/ftpuploadresume.c.o.d"
+  "CMakeFiles/curl-example-all.dir/getinfo.c.o"
+  "CMakeFiles/curl-example-all.dir/getinfo.c.o.d"
+  "CMakeFiles/curl-example-all.dir/getinmemory.c.o"
+  "CMakeFiles/curl-example-all.dir/getinmemory.c.o.d"
+  "CMakeFiles/curl-example-all.dir/getredirect.c.o"
+  "CMakeFiles/curl-example-all.dir/getredirect.c.o.d"
+  "CMakeFiles/curl-example-all.dir/getreferrer.c.o"
+  "CMakeFiles/curl-example-all.dir/getreferrer.c.o.d"
+  "CMakeFiles/curl-example-all.dir/headerapi.c.o"
+  "CMakeFiles/curl-example-all.dir/headerapi.c.o.d"
+  "CMakeFiles/curl-example-all.dir/hsts-preload.c.o"
+  "CMakeFiles/curl-example-all.dir/hsts-preload.c.o.d"
+  "CMakeFiles/curl-example-all.dir/http-options.c.o"
+  "CMakeFiles/curl-example-all.dir/http-options.c.o.d"
+  "CMakeFiles/curl-example-all.dir/http-post.c.o"
+  "CMakeFiles/curl-example-all.dir/http-post.c.o.d"
+  "CMakeFiles/curl-example-all.dir/http2-download.c.o"
+  "CMakeFiles/curl-example-all.dir/http2-download.c.o.d"
+  "CMakeFiles/curl-example-all.dir/http2-pushinmemory.c.o"
+  "CMakeFiles/curl-example-all.dir/http2-pushinmemory.c.o.d"
+  "CMakeFiles/curl-example-all.dir/http2-serverpush.c.o"
+  "CMakeFiles/curl-example-all.dir/http2-serverpush.c.o.d"
+  "CMakeFiles/curl-example-all.dir/http2-upload.c.o"
+  "CMakeFiles/curl-example-all.dir/http2-upload.c.o.d"
+  "CMakeFiles/curl-example-all.dir/http3-present.c.o"
+  "CMakeFiles/curl-example-all.dir/http3-present.c.o.d"
+  "CMakeFiles/curl-example-all.dir/http3.c.o"
+  "CMakeFiles/curl-example-all.dir/http3.c.o.d"
+  "CMakeFiles/curl-example-all.dir/httpcustomheader.c.o"
+  "CMakeFiles/curl-example-all.dir/httpcustomheader.c.o.d"
+  "CMakeFiles/curl-example-all.dir/httpput-postfields.c.o"
+  "CMakeFiles/curl-example-all.dir/httpput-postfields.c.o.d"
+  "CMakeFiles/curl-example-all.dir/httpput.c.o"
+  "CMakeFiles/curl-example-all.dir/httpput.c.o.d"
+  "CMakeFiles/curl-example-all.dir/https.c.o"
+  "CMakeFiles/curl-example-all.dir/https.c.o.d"
+  "CMakeFiles/curl-example-all.dir/imap-append.c.o"
+  "CMakeFiles/curl-example-all.dir/imap-append.c.o.d"
+  "CMakeFiles/curl-example-all.dir/imap-authzid.c.o"
+  "CMakeFiles/curl-example-all.dir/imap-authzid.c.o.d"
+  "CMakeFiles/curl-example-all.dir/imap-copy.c.o"
+  "CMakeFiles/curl-example-all.dir/imap-copy.c.o.d"
+  "CMakeFiles/curl-example-all.dir/imap-create.c.o"
+  "CMakeFiles/curl-example-all.dir/imap-create.c.o.d"
+  "CMakeFiles/curl-example-all.dir/imap-delete.c.o"
+  "CMakeFiles/curl-example-all.dir/imap-delete.c.o.d"
+  "CMakeFiles/curl-example-all.dir/imap-examine.c.o"
+  "CMakeFiles/curl-example-all.dir/imap-examine.c.o.d"
+  "CMakeFiles/curl-example-all.dir/imap-fetch.c.o"
+  "CMakeFiles/curl-example-all.dir/imap-fetch.c.o.d"
+  "CMakeFiles/curl-example-all.dir/imap-list.c.o"
+  "CMakeFiles/curl-example-all.dir/imap-list.c.o.d"
+  "CMakeFiles/curl-example-all.dir/imap-lsub.c.o"
+  "CMakeFiles/curl-example-all.dir/imap-lsub.c.o.d"
+  "CMakeFiles/curl-example-all.dir/imap-multi.c.o"
+  "CMakeFiles/curl-example-all.dir/imap-multi.c.o.d"
+  "CMakeFiles/curl-example-all.dir/imap-noop.c.o"
+  "CMakeFiles/curl-example-all.dir/imap-noop.c.o.d"
+  "CMakeFiles/curl-example-all.dir/imap-search.c.o"
+  "CMakeFiles/curl-example-all.dir/imap-search.c.o.d"
+  "CMakeFiles/curl-example-all.dir/imap-ssl.c.o"
+  "CMakeFiles/curl-example-all.dir/imap-ssl.c.o.d"
+  "CMakeFiles/curl-example-all.dir/imap-store.c.o"
+  "CMakeFiles/curl-example-all.dir/imap-store.c.o.d"
+  "CMakeFiles/curl-example-all.dir/imap-tls.c.o"
+  "CMakeFiles/curl-example-all.dir/imap-tls.c.o.d"
+  "CMakeFiles/curl-example-all.dir/interface.c.o"
+  "CMakeFiles/curl-example-all.dir/interface.c.o.d"
+  "CMakeFiles/curl-example-all.dir/ipv6.c.o"
+  "CMakeFiles/curl-example-all.dir/ipv6.c.o.d"
+  "CMakeFiles/curl-example-all.dir/keepalive.c.o"
+  "CMakeFiles/curl-example-all.dir/keepalive.c.o.d"
+  "CMakeFiles/curl-example-all.dir/localport.c.o"
+  "CMakeFiles/curl-example-all.dir/localport.c.o.d"
+  "CMakeFiles/curl-example-all.dir/maxconnects.c.o"
+  "CMakeFiles/curl-example-all.dir/maxconnects.c.o.d"
+  "CMakeFiles/curl-example-all.dir/multi-app.c.o"
+  "CMakeFiles/curl-example-all.dir/multi-app.c.o.d"
+  "CMakeFiles/curl-example-all.dir/multi-debugcallback.c.o"
+  "CMakeFiles/curl-example-all.dir/multi-debugcallback.c.o.d"
+  "CMakeFiles/curl-example-all.dir/multi-double.c.o"
+  "CMakeFiles/curl-example-all.dir/multi-double.c.o.d"
+  "CMakeFiles/curl-example-all.dir/multi-formadd.c.o"
+  "CMakeFiles/curl-example-all.dir/multi-formadd.c.o.d"
+  "CMakeFiles/curl-example-all.dir/multi-legacy.c.o"
+  "CMakeFiles/curl-example-all.dir/multi-legacy.c.o.d"
+  "CMakeFiles/curl-example-all.dir/multi-post.c.o"
+  "CMakeFiles/curl-example-all.dir/multi-post.c.o.d"
+  "CMakeFiles/curl-example-all.dir/multi-single.c.o"
+  "CMakeFiles/curl-example-all.dir/multi-single.c.o.d"
+  "CMakeFiles/curl-example-all.dir/netrc.c.o"
+  "CMakeFiles/curl-example-all.dir/netrc.c.o.d"
+  "CMakeFiles/curl-example-all.dir/parseurl.c.o"
+  "CMakeFiles/curl-example-all.dir/parseurl.c.o.d"
+  "CMakeFiles/curl-example-all.dir/persistent.c.o"
+  "CMakeFiles/curl-example-all.dir/persistent.c.o.d"
+  "CMakeFiles/curl-example-all.dir/pop3-authzid.c.o"
+  "CMakeFiles/curl-example-all.dir/pop3-authzid.c.o.d"
+  "CMakeFiles/curl-example-all.dir/pop3-dele.c.o"
+  "CMakeFiles/curl-example-all.dir/pop3-dele.c.o.d"
+  "CMakeFiles/curl-example-all.dir/pop3-list.c.o"
+  "CMakeFiles/curl-example-all.dir/pop3-list.c.o.d"
+  "CMakeFiles/curl-example-all.dir/pop3-multi.c.o"
+  "CMakeFiles/curl-example-all.dir/pop3-multi.c.o.d"
+  "CMakeFiles/curl-example-all.dir/pop3-noop.c.o"
+  "CMakeFiles/curl-example-all.dir/pop3-noop.c.o.d"
+  "CMakeFiles/curl-example-all.dir/pop3-retr.c.o"
+  "CMakeFiles/curl-example-all.dir/pop3-retr.c.o.d"
+  "CMakeFiles/curl-example-all.dir/pop3-ssl.c.o"
+  "CMakeFiles/curl-example-all.dir/pop3-ssl.c.o.d"
+  "CMakeFiles/curl-example-all.dir/pop3-stat.c.o"
+  "CMakeFiles/curl-example-all.dir/pop3-stat.c.o.d"
+  "CMakeFiles/curl-example-all.dir/pop3-tls.c.o"
+  "CMakeFiles/curl-example-all.dir/pop3-tls.c.o.d"
+  "CMakeFiles/curl-example-all.dir/pop3-top.c.o"
+  "CMakeFiles/curl-example-all.dir/pop3-top.c.o.d"
+  "CMakeFiles/curl-example-all.dir/pop3-uidl.c.o"
+  "CMakeFiles/curl-example-all.dir/pop3-uidl.c.o.d"
+  "CMakeFiles/curl-example-all.dir/post-callback.c.o"
+  "CMakeFiles/curl-example-all.dir/post-callback.c.o.d"
+  "CMakeFiles/curl-example-all.dir/postinmemory.c.o"
+  "CMakeFiles/curl-example-all.dir/postinmemory.c.o.d"
+  "CMakeFiles/curl-example-all.dir/postit2-formadd.c.o"
+  "CMakeFiles/curl-example-all.dir/postit2-formadd.c.o.d"
+  "CMakeFiles/curl-example-all.dir/postit2.c.o"
+  "CMakeFiles/curl-example-all.dir/postit2.c.o.d"
+  "CMakeFiles/curl-example-all.dir/progressfunc.c.o"
+  "CMakeFiles/curl-example-all.dir/progressfunc.c.o.d"
+  "CMakeFiles/curl-example-all.dir/protofeats.c.o"
+  "CMakeFiles/curl-example-all.dir/protofeats.c.o.d"
+  "CMakeFiles/curl-example-all.dir/range.c.o"
+  "CMakeFiles/curl-example-all.dir/range.c.o.d"
+  "CMakeFiles/curl-example-all.dir/resolve.c.o"
+  "CMakeFiles/curl-example-all.dir/resolve.c.o.d"
+  "CMakeFiles/curl-example-all.dir/rtsp-options.c.o"
+  "CMakeFiles/curl-example-all.dir/rtsp-options.c.o.d"
+  "CMakeFiles/curl-example-all.dir/sendrecv.c.o"
+  "CMakeFiles/curl-example-all.dir/sendrecv.c.o.d"
+  "CMakeFiles/curl-example-all.dir/sepheaders.c.o"
+  "CMakeFiles/curl-example-all.dir/sepheaders.c.o.d"
+  "CMakeFiles/curl-example-all.dir/sftpget.c.o"
+  "CMakeFiles/curl-example-all.dir/sftpget.c.o.d"
+  "CMakeFiles/curl-example-all.dir/sftpuploadresume.c.o"
+  "CMakeFiles/curl-example-all.dir/sftpuploadresume.c.o.d"
+  "CMakeFiles/curl-example-all.dir/shared-connection-cache.c.o"
+  "CMakeFiles/curl-example-all.dir/shared-connection-cache.c.o.d"
+  "CMakeFiles/curl-example-all.dir/simple.c.o"
+  "CMakeFiles/curl-example-all.dir/simple.c.o.d"
+  "CMakeFiles/curl-example-all.dir/simplepost.c.o"
+  "CMakeFiles/curl-example-all.dir/simplepost.c.o.d"
+  "CMakeFiles/curl-example-all.dir/simplessl.c.o"
+  "CMakeFiles/curl-example-all.dir/simplessl.c.o.d"
+  "CMakeFiles/curl-example-all.dir/smtp-authzid.c.o"
+  "CMakeFiles/curl-example-all.dir/smtp-authzid.c.o.d"
+  "CMakeFiles/curl-example-all.dir/smtp-expn.c.o"
+  "CMakeFiles/curl-example-all.dir/smtp-expn.c.o.d"
+  "CMakeFiles/curl-example-all.dir/smtp-mail.c.o"
+  "CMakeFiles/curl-example-all.dir/smtp-mail.c.o.d"
+  "CMakeFiles/curl-example-all.dir/smtp-mime.c.o"
+  "CMakeFiles/curl-example-all.dir/smtp-mime.c.o.d"
+  "CMakeFiles/curl-example-all.dir/smtp-multi.c.o"
+  "CMakeFiles/curl-example-all.dir/smtp-multi.c.o.d"
+  "CMakeFiles/curl-example-all.dir/smtp-ssl.c.o"
+  "CMakeFiles/curl-example-all.dir/smtp-ssl.c.o.d"
+  "CMakeFiles/curl-example-all.dir/smtp-tls.c.o"
+  "CMakeFiles/curl-example-all.dir/smtp-tls.c.o.d"
+  "CMakeFiles/curl-example-all.dir/smtp-vrfy.c.o"
+  "CMakeFiles/curl-example-all.dir/smtp-vrfy.c.o.d"
+  "CMakeFiles/curl-example-all.dir/sslbackend.c.o"
+  "CMakeFiles/curl-example-all.dir/sslbackend.c.o.d"
+  "CMakeFiles/curl-example-all.dir/unixsocket.c.o"
+  "CMakeFiles/curl-example-all.dir/unixsocket.c.o.d"
+  "CMakeFiles/curl-example-all.dir/url2file.c.o"
+  "CMakeFiles/curl-example-all.dir/url2file.c.o.d"
+  "CMakeFiles/curl-example-all.dir/urlapi.c.o"
+  "CMakeFiles/curl-example-all.dir/urlapi.c.o.d"
+  "CMakeFiles/curl-example-all.dir/websocket-cb.c.o"
+  "CMakeFiles/curl-example-all.dir/websocket-cb.c.o.d"
+  "CMakeFiles/curl-example-all.dir/websocket-updown.c.o"
+  "CMakeFiles/curl-example-all.dir/websocket-updown.c.o.d"
+  "CMakeFiles/curl-example-all.dir/websocket.c.o"
+  "CMakeFiles/curl-example-all.dir/websocket.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-all.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
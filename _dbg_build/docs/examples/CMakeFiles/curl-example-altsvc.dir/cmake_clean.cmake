@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-altsvc.dir/altsvc.c.o"
+  "CMakeFiles/curl-example-altsvc.dir/altsvc.c.o.d"
+  "altsvc"
+  "altsvc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-altsvc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-anyauthput.dir/anyauthput.c.o"
+  "CMakeFiles/curl-example-anyauthput.dir/anyauthput.c.o.d"
+  "anyauthput"
+  "anyauthput.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-anyauthput.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
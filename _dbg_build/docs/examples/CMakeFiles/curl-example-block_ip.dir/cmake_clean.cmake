@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-block_ip.dir/block_ip.c.o"
+  "CMakeFiles/curl-example-block_ip.dir/block_ip.c.o.d"
+  "block_ip"
+  "block_ip.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-block_ip.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-certinfo.dir/certinfo.c.o"
+  "CMakeFiles/curl-example-certinfo.dir/certinfo.c.o.d"
+  "certinfo"
+  "certinfo.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-certinfo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-chkspeed.dir/chkspeed.c.o"
+  "CMakeFiles/curl-example-chkspeed.dir/chkspeed.c.o.d"
+  "chkspeed"
+  "chkspeed.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-chkspeed.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
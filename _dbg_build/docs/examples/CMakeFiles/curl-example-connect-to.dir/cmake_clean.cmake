@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-connect-to.dir/connect-to.c.o"
+  "CMakeFiles/curl-example-connect-to.dir/connect-to.c.o.d"
+  "connect-to"
+  "connect-to.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-connect-to.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
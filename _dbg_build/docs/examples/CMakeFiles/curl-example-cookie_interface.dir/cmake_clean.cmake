@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-cookie_interface.dir/cookie_interface.c.o"
+  "CMakeFiles/curl-example-cookie_interface.dir/cookie_interface.c.o.d"
+  "cookie_interface"
+  "cookie_interface.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-cookie_interface.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-debug.dir/debug.c.o"
+  "CMakeFiles/curl-example-debug.dir/debug.c.o.d"
+  "debug"
+  "debug.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-debug.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-default-scheme.dir/default-scheme.c.o"
+  "CMakeFiles/curl-example-default-scheme.dir/default-scheme.c.o.d"
+  "default-scheme"
+  "default-scheme.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-default-scheme.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-externalsocket.dir/externalsocket.c.o"
+  "CMakeFiles/curl-example-externalsocket.dir/externalsocket.c.o.d"
+  "externalsocket"
+  "externalsocket.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-externalsocket.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-fileupload.dir/fileupload.c.o"
+  "CMakeFiles/curl-example-fileupload.dir/fileupload.c.o.d"
+  "fileupload"
+  "fileupload.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-fileupload.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
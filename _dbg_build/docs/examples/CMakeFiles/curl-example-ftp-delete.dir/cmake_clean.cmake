@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-ftp-delete.dir/ftp-delete.c.o"
+  "CMakeFiles/curl-example-ftp-delete.dir/ftp-delete.c.o.d"
+  "ftp-delete"
+  "ftp-delete.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-ftp-delete.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
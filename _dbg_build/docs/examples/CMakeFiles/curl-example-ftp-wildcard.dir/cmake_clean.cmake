@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-ftp-wildcard.dir/ftp-wildcard.c.o"
+  "CMakeFiles/curl-example-ftp-wildcard.dir/ftp-wildcard.c.o.d"
+  "ftp-wildcard"
+  "ftp-wildcard.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-ftp-wildcard.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
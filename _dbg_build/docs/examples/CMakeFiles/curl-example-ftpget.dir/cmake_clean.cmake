@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-ftpget.dir/ftpget.c.o"
+  "CMakeFiles/curl-example-ftpget.dir/ftpget.c.o.d"
+  "ftpget"
+  "ftpget.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-ftpget.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
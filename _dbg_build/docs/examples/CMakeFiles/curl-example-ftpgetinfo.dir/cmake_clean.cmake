@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-ftpgetinfo.dir/ftpgetinfo.c.o"
+  "CMakeFiles/curl-example-ftpgetinfo.dir/ftpgetinfo.c.o.d"
+  "ftpgetinfo"
+  "ftpgetinfo.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-ftpgetinfo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-ftpgetresp.dir/ftpgetresp.c.o"
+  "CMakeFiles/curl-example-ftpgetresp.dir/ftpgetresp.c.o.d"
+  "ftpgetresp"
+  "ftpgetresp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-ftpgetresp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-ftpsget.dir/ftpsget.c.o"
+  "CMakeFiles/curl-example-ftpsget.dir/ftpsget.c.o.d"
+  "ftpsget"
+  "ftpsget.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-ftpsget.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
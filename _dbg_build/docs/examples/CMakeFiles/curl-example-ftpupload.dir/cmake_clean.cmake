@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-ftpupload.dir/ftpupload.c.o"
+  "CMakeFiles/curl-example-ftpupload.dir/ftpupload.c.o.d"
+  "ftpupload"
+  "ftpupload.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-ftpupload.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
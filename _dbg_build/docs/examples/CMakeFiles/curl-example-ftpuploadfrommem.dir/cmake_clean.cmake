@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-ftpuploadfrommem.dir/ftpuploadfrommem.c.o"
+  "CMakeFiles/curl-example-ftpuploadfrommem.dir/ftpuploadfrommem.c.o.d"
+  "ftpuploadfrommem"
+  "ftpuploadfrommem.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-ftpuploadfrommem.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-ftpuploadresume.dir/ftpuploadresume.c.o"
+  "CMakeFiles/curl-example-ftpuploadresume.dir/ftpuploadresume.c.o.d"
+  "ftpuploadresume"
+  "ftpuploadresume.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-ftpuploadresume.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
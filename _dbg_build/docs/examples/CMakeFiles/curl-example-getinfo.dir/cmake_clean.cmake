@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-getinfo.dir/getinfo.c.o"
+  "CMakeFiles/curl-example-getinfo.dir/getinfo.c.o.d"
+  "getinfo"
+  "getinfo.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-getinfo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-getinmemory.dir/getinmemory.c.o"
+  "CMakeFiles/curl-example-getinmemory.dir/getinmemory.c.o.d"
+  "getinmemory"
+  "getinmemory.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-getinmemory.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
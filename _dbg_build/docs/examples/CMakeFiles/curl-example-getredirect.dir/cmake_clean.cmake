@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-getredirect.dir/getredirect.c.o"
+  "CMakeFiles/curl-example-getredirect.dir/getredirect.c.o.d"
+  "getredirect"
+  "getredirect.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-getredirect.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
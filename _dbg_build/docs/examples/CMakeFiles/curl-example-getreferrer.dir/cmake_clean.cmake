@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-getreferrer.dir/getreferrer.c.o"
+  "CMakeFiles/curl-example-getreferrer.dir/getreferrer.c.o.d"
+  "getreferrer"
+  "getreferrer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-getreferrer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-headerapi.dir/headerapi.c.o"
+  "CMakeFiles/curl-example-headerapi.dir/headerapi.c.o.d"
+  "headerapi"
+  "headerapi.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-headerapi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
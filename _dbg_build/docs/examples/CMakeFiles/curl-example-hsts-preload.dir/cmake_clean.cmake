@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-hsts-preload.dir/hsts-preload.c.o"
+  "CMakeFiles/curl-example-hsts-preload.dir/hsts-preload.c.o.d"
+  "hsts-preload"
+  "hsts-preload.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-hsts-preload.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
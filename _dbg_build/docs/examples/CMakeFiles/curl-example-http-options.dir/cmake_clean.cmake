@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-http-options.dir/http-options.c.o"
+  "CMakeFiles/curl-example-http-options.dir/http-options.c.o.d"
+  "http-options"
+  "http-options.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-http-options.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-http-post.dir/http-post.c.o"
+  "CMakeFiles/curl-example-http-post.dir/http-post.c.o.d"
+  "http-post"
+  "http-post.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-http-post.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-http2-download.dir/http2-download.c.o"
+  "CMakeFiles/curl-example-http2-download.dir/http2-download.c.o.d"
+  "http2-download"
+  "http2-download.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-http2-download.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
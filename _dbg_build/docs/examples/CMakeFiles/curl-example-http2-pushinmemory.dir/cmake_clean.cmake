@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-http2-pushinmemory.dir/http2-pushinmemory.c.o"
+  "CMakeFiles/curl-example-http2-pushinmemory.dir/http2-pushinmemory.c.o.d"
+  "http2-pushinmemory"
+  "http2-pushinmemory.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-http2-pushinmemory.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-http2-serverpush.dir/http2-serverpush.c.o"
+  "CMakeFiles/curl-example-http2-serverpush.dir/http2-serverpush.c.o.d"
+  "http2-serverpush"
+  "http2-serverpush.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-http2-serverpush.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
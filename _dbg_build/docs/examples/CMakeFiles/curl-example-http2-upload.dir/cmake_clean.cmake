@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-http2-upload.dir/http2-upload.c.o"
+  "CMakeFiles/curl-example-http2-upload.dir/http2-upload.c.o.d"
+  "http2-upload"
+  "http2-upload.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-http2-upload.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
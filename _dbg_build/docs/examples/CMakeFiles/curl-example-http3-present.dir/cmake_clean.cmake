@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-http3-present.dir/http3-present.c.o"
+  "CMakeFiles/curl-example-http3-present.dir/http3-present.c.o.d"
+  "http3-present"
+  "http3-present.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-http3-present.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
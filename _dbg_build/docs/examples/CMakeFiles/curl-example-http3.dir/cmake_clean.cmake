@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-http3.dir/http3.c.o"
+  "CMakeFiles/curl-example-http3.dir/http3.c.o.d"
+  "http3"
+  "http3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-http3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-httpcustomheader.dir/httpcustomheader.c.o"
+  "CMakeFiles/curl-example-httpcustomheader.dir/httpcustomheader.c.o.d"
+  "httpcustomheader"
+  "httpcustomheader.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-httpcustomheader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
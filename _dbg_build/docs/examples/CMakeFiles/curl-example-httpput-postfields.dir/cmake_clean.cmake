@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-httpput-postfields.dir/httpput-postfields.c.o"
+  "CMakeFiles/curl-example-httpput-postfields.dir/httpput-postfields.c.o.d"
+  "httpput-postfields"
+  "httpput-postfields.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-httpput-postfields.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-httpput.dir/httpput.c.o"
+  "CMakeFiles/curl-example-httpput.dir/httpput.c.o.d"
+  "httpput"
+  "httpput.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-httpput.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
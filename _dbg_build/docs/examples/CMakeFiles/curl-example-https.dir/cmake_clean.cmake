@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-https.dir/https.c.o"
+  "CMakeFiles/curl-example-https.dir/https.c.o.d"
+  "https"
+  "https.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-https.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
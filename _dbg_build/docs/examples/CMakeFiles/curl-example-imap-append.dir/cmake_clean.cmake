@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-imap-append.dir/imap-append.c.o"
+  "CMakeFiles/curl-example-imap-append.dir/imap-append.c.o.d"
+  "imap-append"
+  "imap-append.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-imap-append.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-imap-authzid.dir/imap-authzid.c.o"
+  "CMakeFiles/curl-example-imap-authzid.dir/imap-authzid.c.o.d"
+  "imap-authzid"
+  "imap-authzid.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-imap-authzid.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-imap-copy.dir/imap-copy.c.o"
+  "CMakeFiles/curl-example-imap-copy.dir/imap-copy.c.o.d"
+  "imap-copy"
+  "imap-copy.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-imap-copy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
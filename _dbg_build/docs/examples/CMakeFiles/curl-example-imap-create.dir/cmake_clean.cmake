@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-imap-create.dir/imap-create.c.o"
+  "CMakeFiles/curl-example-imap-create.dir/imap-create.c.o.d"
+  "imap-create"
+  "imap-create.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-imap-create.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-imap-delete.dir/imap-delete.c.o"
+  "CMakeFiles/curl-example-imap-delete.dir/imap-delete.c.o.d"
+  "imap-delete"
+  "imap-delete.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-imap-delete.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
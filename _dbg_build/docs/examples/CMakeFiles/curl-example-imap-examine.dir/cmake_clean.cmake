@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-imap-examine.dir/imap-examine.c.o"
+  "CMakeFiles/curl-example-imap-examine.dir/imap-examine.c.o.d"
+  "imap-examine"
+  "imap-examine.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-imap-examine.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-imap-fetch.dir/imap-fetch.c.o"
+  "CMakeFiles/curl-example-imap-fetch.dir/imap-fetch.c.o.d"
+  "imap-fetch"
+  "imap-fetch.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-imap-fetch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-imap-list.dir/imap-list.c.o"
+  "CMakeFiles/curl-example-imap-list.dir/imap-list.c.o.d"
+  "imap-list"
+  "imap-list.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-imap-list.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
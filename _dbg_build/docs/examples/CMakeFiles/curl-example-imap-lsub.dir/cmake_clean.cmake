@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-imap-lsub.dir/imap-lsub.c.o"
+  "CMakeFiles/curl-example-imap-lsub.dir/imap-lsub.c.o.d"
+  "imap-lsub"
+  "imap-lsub.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-imap-lsub.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
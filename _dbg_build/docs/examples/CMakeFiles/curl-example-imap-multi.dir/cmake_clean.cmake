@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-imap-multi.dir/imap-multi.c.o"
+  "CMakeFiles/curl-example-imap-multi.dir/imap-multi.c.o.d"
+  "imap-multi"
+  "imap-multi.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-imap-multi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
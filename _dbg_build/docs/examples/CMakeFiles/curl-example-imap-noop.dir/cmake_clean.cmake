@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-imap-noop.dir/imap-noop.c.o"
+  "CMakeFiles/curl-example-imap-noop.dir/imap-noop.c.o.d"
+  "imap-noop"
+  "imap-noop.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-imap-noop.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
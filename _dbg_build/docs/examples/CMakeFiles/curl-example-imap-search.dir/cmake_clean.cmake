@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-imap-search.dir/imap-search.c.o"
+  "CMakeFiles/curl-example-imap-search.dir/imap-search.c.o.d"
+  "imap-search"
+  "imap-search.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-imap-search.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
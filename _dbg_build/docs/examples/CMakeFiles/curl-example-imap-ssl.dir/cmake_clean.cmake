@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-imap-ssl.dir/imap-ssl.c.o"
+  "CMakeFiles/curl-example-imap-ssl.dir/imap-ssl.c.o.d"
+  "imap-ssl"
+  "imap-ssl.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-imap-ssl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
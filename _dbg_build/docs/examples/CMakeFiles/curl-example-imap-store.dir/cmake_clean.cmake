@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-imap-store.dir/imap-store.c.o"
+  "CMakeFiles/curl-example-imap-store.dir/imap-store.c.o.d"
+  "imap-store"
+  "imap-store.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-imap-store.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
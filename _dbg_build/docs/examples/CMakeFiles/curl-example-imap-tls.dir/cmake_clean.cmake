@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-imap-tls.dir/imap-tls.c.o"
+  "CMakeFiles/curl-example-imap-tls.dir/imap-tls.c.o.d"
+  "imap-tls"
+  "imap-tls.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-imap-tls.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
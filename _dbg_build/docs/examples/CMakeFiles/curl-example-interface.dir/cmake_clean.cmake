@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-interface.dir/interface.c.o"
+  "CMakeFiles/curl-example-interface.dir/interface.c.o.d"
+  "interface"
+  "interface.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-interface.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-ipv6.dir/ipv6.c.o"
+  "CMakeFiles/curl-example-ipv6.dir/ipv6.c.o.d"
+  "ipv6"
+  "ipv6.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-ipv6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-keepalive.dir/keepalive.c.o"
+  "CMakeFiles/curl-example-keepalive.dir/keepalive.c.o.d"
+  "keepalive"
+  "keepalive.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-keepalive.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-localport.dir/localport.c.o"
+  "CMakeFiles/curl-example-localport.dir/localport.c.o.d"
+  "localport"
+  "localport.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-localport.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-maxconnects.dir/maxconnects.c.o"
+  "CMakeFiles/curl-example-maxconnects.dir/maxconnects.c.o.d"
+  "maxconnects"
+  "maxconnects.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-maxconnects.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-multi-app.dir/multi-app.c.o"
+  "CMakeFiles/curl-example-multi-app.dir/multi-app.c.o.d"
+  "multi-app"
+  "multi-app.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-multi-app.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
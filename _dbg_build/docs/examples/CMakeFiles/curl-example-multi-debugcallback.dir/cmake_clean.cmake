@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-multi-debugcallback.dir/multi-debugcallback.c.o"
+  "CMakeFiles/curl-example-multi-debugcallback.dir/multi-debugcallback.c.o.d"
+  "multi-debugcallback"
+  "multi-debugcallback.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-multi-debugcallback.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
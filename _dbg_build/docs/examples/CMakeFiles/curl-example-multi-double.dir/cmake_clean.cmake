@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-multi-double.dir/multi-double.c.o"
+  "CMakeFiles/curl-example-multi-double.dir/multi-double.c.o.d"
+  "multi-double"
+  "multi-double.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-multi-double.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-multi-formadd.dir/multi-formadd.c.o"
+  "CMakeFiles/curl-example-multi-formadd.dir/multi-formadd.c.o.d"
+  "multi-formadd"
+  "multi-formadd.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-multi-formadd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
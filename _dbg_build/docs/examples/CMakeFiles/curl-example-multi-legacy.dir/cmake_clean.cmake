@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-multi-legacy.dir/multi-legacy.c.o"
+  "CMakeFiles/curl-example-multi-legacy.dir/multi-legacy.c.o.d"
+  "multi-legacy"
+  "multi-legacy.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-multi-legacy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-multi-post.dir/multi-post.c.o"
+  "CMakeFiles/curl-example-multi-post.dir/multi-post.c.o.d"
+  "multi-post"
+  "multi-post.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-multi-post.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-multi-single.dir/multi-single.c.o"
+  "CMakeFiles/curl-example-multi-single.dir/multi-single.c.o.d"
+  "multi-single"
+  "multi-single.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-multi-single.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-netrc.dir/netrc.c.o"
+  "CMakeFiles/curl-example-netrc.dir/netrc.c.o.d"
+  "netrc"
+  "netrc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-netrc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
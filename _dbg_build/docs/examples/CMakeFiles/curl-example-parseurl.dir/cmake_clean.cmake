@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-parseurl.dir/parseurl.c.o"
+  "CMakeFiles/curl-example-parseurl.dir/parseurl.c.o.d"
+  "parseurl"
+  "parseurl.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-parseurl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-persistent.dir/persistent.c.o"
+  "CMakeFiles/curl-example-persistent.dir/persistent.c.o.d"
+  "persistent"
+  "persistent.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-persistent.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-pop3-authzid.dir/pop3-authzid.c.o"
+  "CMakeFiles/curl-example-pop3-authzid.dir/pop3-authzid.c.o.d"
+  "pop3-authzid"
+  "pop3-authzid.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-pop3-authzid.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-pop3-dele.dir/pop3-dele.c.o"
+  "CMakeFiles/curl-example-pop3-dele.dir/pop3-dele.c.o.d"
+  "pop3-dele"
+  "pop3-dele.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-pop3-dele.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
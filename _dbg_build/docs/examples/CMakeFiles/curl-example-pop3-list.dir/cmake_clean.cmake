@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-pop3-list.dir/pop3-list.c.o"
+  "CMakeFiles/curl-example-pop3-list.dir/pop3-list.c.o.d"
+  "pop3-list"
+  "pop3-list.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-pop3-list.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-pop3-multi.dir/pop3-multi.c.o"
+  "CMakeFiles/curl-example-pop3-multi.dir/pop3-multi.c.o.d"
+  "pop3-multi"
+  "pop3-multi.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-pop3-multi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
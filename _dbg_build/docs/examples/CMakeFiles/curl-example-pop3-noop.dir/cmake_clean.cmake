@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-pop3-noop.dir/pop3-noop.c.o"
+  "CMakeFiles/curl-example-pop3-noop.dir/pop3-noop.c.o.d"
+  "pop3-noop"
+  "pop3-noop.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-pop3-noop.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
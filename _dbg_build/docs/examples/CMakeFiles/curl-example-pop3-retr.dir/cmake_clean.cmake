@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-pop3-retr.dir/pop3-retr.c.o"
+  "CMakeFiles/curl-example-pop3-retr.dir/pop3-retr.c.o.d"
+  "pop3-retr"
+  "pop3-retr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-pop3-retr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-pop3-ssl.dir/pop3-ssl.c.o"
+  "CMakeFiles/curl-example-pop3-ssl.dir/pop3-ssl.c.o.d"
+  "pop3-ssl"
+  "pop3-ssl.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-pop3-ssl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
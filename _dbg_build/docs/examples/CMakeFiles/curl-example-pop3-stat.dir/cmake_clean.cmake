@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-pop3-stat.dir/pop3-stat.c.o"
+  "CMakeFiles/curl-example-pop3-stat.dir/pop3-stat.c.o.d"
+  "pop3-stat"
+  "pop3-stat.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-pop3-stat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-pop3-tls.dir/pop3-tls.c.o"
+  "CMakeFiles/curl-example-pop3-tls.dir/pop3-tls.c.o.d"
+  "pop3-tls"
+  "pop3-tls.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-pop3-tls.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
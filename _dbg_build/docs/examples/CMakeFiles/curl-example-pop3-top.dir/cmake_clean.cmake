@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-pop3-top.dir/pop3-top.c.o"
+  "CMakeFiles/curl-example-pop3-top.dir/pop3-top.c.o.d"
+  "pop3-top"
+  "pop3-top.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-pop3-top.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
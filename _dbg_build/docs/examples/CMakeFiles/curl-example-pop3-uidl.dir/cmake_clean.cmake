@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-pop3-uidl.dir/pop3-uidl.c.o"
+  "CMakeFiles/curl-example-pop3-uidl.dir/pop3-uidl.c.o.d"
+  "pop3-uidl"
+  "pop3-uidl.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-pop3-uidl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
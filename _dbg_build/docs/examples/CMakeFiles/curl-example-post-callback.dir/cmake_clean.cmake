@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-post-callback.dir/post-callback.c.o"
+  "CMakeFiles/curl-example-post-callback.dir/post-callback.c.o.d"
+  "post-callback"
+  "post-callback.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-post-callback.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-postinmemory.dir/postinmemory.c.o"
+  "CMakeFiles/curl-example-postinmemory.dir/postinmemory.c.o.d"
+  "postinmemory"
+  "postinmemory.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-postinmemory.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
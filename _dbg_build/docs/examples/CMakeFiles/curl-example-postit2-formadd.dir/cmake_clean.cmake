@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-postit2-formadd.dir/postit2-formadd.c.o"
+  "CMakeFiles/curl-example-postit2-formadd.dir/postit2-formadd.c.o.d"
+  "postit2-formadd"
+  "postit2-formadd.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-postit2-formadd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
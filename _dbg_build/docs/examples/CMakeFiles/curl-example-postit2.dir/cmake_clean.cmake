@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-postit2.dir/postit2.c.o"
+  "CMakeFiles/curl-example-postit2.dir/postit2.c.o.d"
+  "postit2"
+  "postit2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-postit2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
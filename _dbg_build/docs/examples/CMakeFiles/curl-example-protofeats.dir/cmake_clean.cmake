@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-protofeats.dir/protofeats.c.o"
+  "CMakeFiles/curl-example-protofeats.dir/protofeats.c.o.d"
+  "protofeats"
+  "protofeats.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-protofeats.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-range.dir/range.c.o"
+  "CMakeFiles/curl-example-range.dir/range.c.o.d"
+  "range"
+  "range.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-range.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
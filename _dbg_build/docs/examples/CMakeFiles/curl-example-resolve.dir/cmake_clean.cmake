@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-resolve.dir/resolve.c.o"
+  "CMakeFiles/curl-example-resolve.dir/resolve.c.o.d"
+  "resolve"
+  "resolve.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-resolve.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-rtsp-options.dir/rtsp-options.c.o"
+  "CMakeFiles/curl-example-rtsp-options.dir/rtsp-options.c.o.d"
+  "rtsp-options"
+  "rtsp-options.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-rtsp-options.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
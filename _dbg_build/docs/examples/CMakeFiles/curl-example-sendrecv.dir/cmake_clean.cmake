@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-sendrecv.dir/sendrecv.c.o"
+  "CMakeFiles/curl-example-sendrecv.dir/sendrecv.c.o.d"
+  "sendrecv"
+  "sendrecv.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-sendrecv.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
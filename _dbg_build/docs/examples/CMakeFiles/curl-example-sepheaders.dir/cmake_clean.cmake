@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-sepheaders.dir/sepheaders.c.o"
+  "CMakeFiles/curl-example-sepheaders.dir/sepheaders.c.o.d"
+  "sepheaders"
+  "sepheaders.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-sepheaders.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
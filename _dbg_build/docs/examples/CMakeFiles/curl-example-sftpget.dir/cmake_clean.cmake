@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-sftpget.dir/sftpget.c.o"
+  "CMakeFiles/curl-example-sftpget.dir/sftpget.c.o.d"
+  "sftpget"
+  "sftpget.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-sftpget.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
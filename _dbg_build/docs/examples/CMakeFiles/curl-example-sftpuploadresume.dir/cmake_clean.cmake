@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-sftpuploadresume.dir/sftpuploadresume.c.o"
+  "CMakeFiles/curl-example-sftpuploadresume.dir/sftpuploadresume.c.o.d"
+  "sftpuploadresume"
+  "sftpuploadresume.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-sftpuploadresume.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
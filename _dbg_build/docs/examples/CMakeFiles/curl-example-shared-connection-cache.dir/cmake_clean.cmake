@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-shared-connection-cache.dir/shared-connection-cache.c.o"
+  "CMakeFiles/curl-example-shared-connection-cache.dir/shared-connection-cache.c.o.d"
+  "shared-connection-cache"
+  "shared-connection-cache.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-shared-connection-cache.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-simplepost.dir/simplepost.c.o"
+  "CMakeFiles/curl-example-simplepost.dir/simplepost.c.o.d"
+  "simplepost"
+  "simplepost.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-simplepost.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-simplessl.dir/simplessl.c.o"
+  "CMakeFiles/curl-example-simplessl.dir/simplessl.c.o.d"
+  "simplessl"
+  "simplessl.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-simplessl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
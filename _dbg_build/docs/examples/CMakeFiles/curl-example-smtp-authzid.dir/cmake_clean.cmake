@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-smtp-authzid.dir/smtp-authzid.c.o"
+  "CMakeFiles/curl-example-smtp-authzid.dir/smtp-authzid.c.o.d"
+  "smtp-authzid"
+  "smtp-authzid.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-smtp-authzid.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-smtp-expn.dir/smtp-expn.c.o"
+  "CMakeFiles/curl-example-smtp-expn.dir/smtp-expn.c.o.d"
+  "smtp-expn"
+  "smtp-expn.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-smtp-expn.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-smtp-mail.dir/smtp-mail.c.o"
+  "CMakeFiles/curl-example-smtp-mail.dir/smtp-mail.c.o.d"
+  "smtp-mail"
+  "smtp-mail.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-smtp-mail.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
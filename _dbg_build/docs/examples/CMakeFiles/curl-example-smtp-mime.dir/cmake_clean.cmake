@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-smtp-mime.dir/smtp-mime.c.o"
+  "CMakeFiles/curl-example-smtp-mime.dir/smtp-mime.c.o.d"
+  "smtp-mime"
+  "smtp-mime.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-smtp-mime.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
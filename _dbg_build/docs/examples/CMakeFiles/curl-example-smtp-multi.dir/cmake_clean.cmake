@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-smtp-multi.dir/smtp-multi.c.o"
+  "CMakeFiles/curl-example-smtp-multi.dir/smtp-multi.c.o.d"
+  "smtp-multi"
+  "smtp-multi.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-smtp-multi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
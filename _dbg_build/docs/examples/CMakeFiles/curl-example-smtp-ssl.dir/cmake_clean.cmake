@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-smtp-ssl.dir/smtp-ssl.c.o"
+  "CMakeFiles/curl-example-smtp-ssl.dir/smtp-ssl.c.o.d"
+  "smtp-ssl"
+  "smtp-ssl.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-smtp-ssl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-smtp-tls.dir/smtp-tls.c.o"
+  "CMakeFiles/curl-example-smtp-tls.dir/smtp-tls.c.o.d"
+  "smtp-tls"
+  "smtp-tls.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-smtp-tls.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
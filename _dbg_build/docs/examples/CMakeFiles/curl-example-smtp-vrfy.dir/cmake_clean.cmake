@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-smtp-vrfy.dir/smtp-vrfy.c.o"
+  "CMakeFiles/curl-example-smtp-vrfy.dir/smtp-vrfy.c.o.d"
+  "smtp-vrfy"
+  "smtp-vrfy.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-smtp-vrfy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
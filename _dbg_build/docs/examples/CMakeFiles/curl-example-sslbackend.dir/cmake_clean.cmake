@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-sslbackend.dir/sslbackend.c.o"
+  "CMakeFiles/curl-example-sslbackend.dir/sslbackend.c.o.d"
+  "sslbackend"
+  "sslbackend.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-sslbackend.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-unixsocket.dir/unixsocket.c.o"
+  "CMakeFiles/curl-example-unixsocket.dir/unixsocket.c.o.d"
+  "unixsocket"
+  "unixsocket.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-unixsocket.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-url2file.dir/url2file.c.o"
+  "CMakeFiles/curl-example-url2file.dir/url2file.c.o.d"
+  "url2file"
+  "url2file.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-url2file.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-urlapi.dir/urlapi.c.o"
+  "CMakeFiles/curl-example-urlapi.dir/urlapi.c.o.d"
+  "urlapi"
+  "urlapi.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-urlapi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-websocket-cb.dir/websocket-cb.c.o"
+  "CMakeFiles/curl-example-websocket-cb.dir/websocket-cb.c.o.d"
+  "websocket-cb"
+  "websocket-cb.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-websocket-cb.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-websocket-updown.dir/websocket-updown.c.o"
+  "CMakeFiles/curl-example-websocket-updown.dir/websocket-updown.c.o.d"
+  "websocket-updown"
+  "websocket-updown.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-websocket-updown.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
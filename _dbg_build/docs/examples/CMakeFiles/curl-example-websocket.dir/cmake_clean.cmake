@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-example-websocket.dir/websocket.c.o"
+  "CMakeFiles/curl-example-websocket.dir/websocket.c.o.d"
+  "websocket"
+  "websocket.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl-example-websocket.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,127 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_dbg_build/docs/libcurl/curl_easy_duphandle.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_easy_escape.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_easy_getinfo.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_easy_header.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_easy_init.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_easy_nextheader.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_easy_option_by_id.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_easy_option_by_name.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_easy_option_next.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_easy_pause.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_easy_perform.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_easy_recv.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_easy_reset.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_easy_send.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_easy_setopt.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_easy_ssls_export.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_easy_ssls_import.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_easy_strerror.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_easy_unescape.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_easy_upkeep.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_escape.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_formadd.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_formfree.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_formget.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_free.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_getdate.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_getenv.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_global_cleanup.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_global_init.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_global_init_mem.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_global_sslset.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_global_trace.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_mime_addpart.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_mime_data.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_mime_data_cb.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_mime_encoder.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_mime_filedata.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_mime_filename.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_mime_free.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_mime_headers.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_mime_init.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_mime_name.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_mime_subparts.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_mime_type.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_mprintf.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_multi_add_handle.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_multi_assign.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_multi_cleanup.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_multi_fdset.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_multi_get_handles.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_multi_get_offt.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_multi_info_read.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_multi_init.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_multi_perform.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_multi_poll.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_multi_prewarm.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_multi_remove_handle.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_multi_setopt.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_multi_socket.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_multi_socket_action.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_multi_socket_all.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_multi_strerror.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_multi_timeout.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_multi_wait.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_multi_waitfds.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_multi_wakeup.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_pushheader_byname.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_pushheader_bynum.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_share_cleanup.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_share_init.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_share_setopt.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_share_ssls_export.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_share_ssls_import.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_share_strerror.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_slist_append.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_slist_free_all.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_strequal.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_strnequal.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_unescape.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_url.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_url_cleanup.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_url_dup.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_url_get.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_url_set.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_url_strerror.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_version.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_version_info.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_ws_meta.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_ws_recv.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_ws_send.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/curl_ws_start_frame.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/libcurl-easy.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/libcurl-env-dbg.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/libcurl-env.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/libcurl-errors.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/libcurl-multi.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/libcurl-security.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/libcurl-share.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/libcurl-symbols.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/libcurl-thread.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/libcurl-tutorial.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/libcurl-url.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/libcurl-ws.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  "/root/repo/_dbg_build/docs/libcurl/libcurl.3" "/root/repo/_dbg_build/docs/libcurl/curl_easy_cleanup.3"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curlu-unitprotos"
+  "unitprotos.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/curlu-unitprotos.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,200 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/altsvc.c" "lib/CMakeFiles/curlu.dir/altsvc.c.o" "gcc" "lib/CMakeFiles/curlu.dir/altsvc.c.o.d"
+  "/root/repo/lib/amigaos.c" "lib/CMakeFiles/curlu.dir/amigaos.c.o" "gcc" "lib/CMakeFiles/curlu.dir/amigaos.c.o.d"
+  "/root/repo/lib/asyn-ares.c" "lib/CMakeFiles/curlu.dir/asyn-ares.c.o" "gcc" "lib/CMakeFiles/curlu.dir/asyn-ares.c.o.d"
+  "/root/repo/lib/asyn-base.c" "lib/CMakeFiles/curlu.dir/asyn-base.c.o" "gcc" "lib/CMakeFiles/curlu.dir/asyn-base.c.o.d"
+  "/root/repo/lib/asyn-thrdd.c" "lib/CMakeFiles/curlu.dir/asyn-thrdd.c.o" "gcc" "lib/CMakeFiles/curlu.dir/asyn-thrdd.c.o.d"
+  "/root/repo/lib/bufq.c" "lib/CMakeFiles/curlu.dir/bufq.c.o" "gcc" "lib/CMakeFiles/curlu.dir/bufq.c.o.d"
+  "/root/repo/lib/bufref.c" "lib/CMakeFiles/curlu.dir/bufref.c.o" "gcc" "lib/CMakeFiles/curlu.dir/bufref.c.o.d"
+  "/root/repo/lib/cf-h1-proxy.c" "lib/CMakeFiles/curlu.dir/cf-h1-proxy.c.o" "gcc" "lib/CMakeFiles/curlu.dir/cf-h1-proxy.c.o.d"
+  "/root/repo/lib/cf-h2-proxy.c" "lib/CMakeFiles/curlu.dir/cf-h2-proxy.c.o" "gcc" "lib/CMakeFiles/curlu.dir/cf-h2-proxy.c.o.d"
+  "/root/repo/lib/cf-haproxy.c" "lib/CMakeFiles/curlu.dir/cf-haproxy.c.o" "gcc" "lib/CMakeFiles/curlu.dir/cf-haproxy.c.o.d"
+  "/root/repo/lib/cf-https-connect.c" "lib/CMakeFiles/curlu.dir/cf-https-connect.c.o" "gcc" "lib/CMakeFiles/curlu.dir/cf-https-connect.c.o.d"
+  "/root/repo/lib/cf-ip-happy.c" "lib/CMakeFiles/curlu.dir/cf-ip-happy.c.o" "gcc" "lib/CMakeFiles/curlu.dir/cf-ip-happy.c.o.d"
+  "/root/repo/lib/cf-socket.c" "lib/CMakeFiles/curlu.dir/cf-socket.c.o" "gcc" "lib/CMakeFiles/curlu.dir/cf-socket.c.o.d"
+  "/root/repo/lib/cfilters.c" "lib/CMakeFiles/curlu.dir/cfilters.c.o" "gcc" "lib/CMakeFiles/curlu.dir/cfilters.c.o.d"
+  "/root/repo/lib/conncache.c" "lib/CMakeFiles/curlu.dir/conncache.c.o" "gcc" "lib/CMakeFiles/curlu.dir/conncache.c.o.d"
+  "/root/repo/lib/connect.c" "lib/CMakeFiles/curlu.dir/connect.c.o" "gcc" "lib/CMakeFiles/curlu.dir/connect.c.o.d"
+  "/root/repo/lib/content_encoding.c" "lib/CMakeFiles/curlu.dir/content_encoding.c.o" "gcc" "lib/CMakeFiles/curlu.dir/content_encoding.c.o.d"
+  "/root/repo/lib/cookie.c" "lib/CMakeFiles/curlu.dir/cookie.c.o" "gcc" "lib/CMakeFiles/curlu.dir/cookie.c.o.d"
+  "/root/repo/lib/cshutdn.c" "lib/CMakeFiles/curlu.dir/cshutdn.c.o" "gcc" "lib/CMakeFiles/curlu.dir/cshutdn.c.o.d"
+  "/root/repo/lib/curl_addrinfo.c" "lib/CMakeFiles/curlu.dir/curl_addrinfo.c.o" "gcc" "lib/CMakeFiles/curlu.dir/curl_addrinfo.c.o.d"
+  "/root/repo/lib/curl_des.c" "lib/CMakeFiles/curlu.dir/curl_des.c.o" "gcc" "lib/CMakeFiles/curlu.dir/curl_des.c.o.d"
+  "/root/repo/lib/curl_endian.c" "lib/CMakeFiles/curlu.dir/curl_endian.c.o" "gcc" "lib/CMakeFiles/curlu.dir/curl_endian.c.o.d"
+  "/root/repo/lib/curl_fnmatch.c" "lib/CMakeFiles/curlu.dir/curl_fnmatch.c.o" "gcc" "lib/CMakeFiles/curlu.dir/curl_fnmatch.c.o.d"
+  "/root/repo/lib/curl_get_line.c" "lib/CMakeFiles/curlu.dir/curl_get_line.c.o" "gcc" "lib/CMakeFiles/curlu.dir/curl_get_line.c.o.d"
+  "/root/repo/lib/curl_gethostname.c" "lib/CMakeFiles/curlu.dir/curl_gethostname.c.o" "gcc" "lib/CMakeFiles/curlu.dir/curl_gethostname.c.o.d"
+  "/root/repo/lib/curl_gssapi.c" "lib/CMakeFiles/curlu.dir/curl_gssapi.c.o" "gcc" "lib/CMakeFiles/curlu.dir/curl_gssapi.c.o.d"
+  "/root/repo/lib/curl_memrchr.c" "lib/CMakeFiles/curlu.dir/curl_memrchr.c.o" "gcc" "lib/CMakeFiles/curlu.dir/curl_memrchr.c.o.d"
+  "/root/repo/lib/curl_ntlm_core.c" "lib/CMakeFiles/curlu.dir/curl_ntlm_core.c.o" "gcc" "lib/CMakeFiles/curlu.dir/curl_ntlm_core.c.o.d"
+  "/root/repo/lib/curl_range.c" "lib/CMakeFiles/curlu.dir/curl_range.c.o" "gcc" "lib/CMakeFiles/curlu.dir/curl_range.c.o.d"
+  "/root/repo/lib/curl_rtmp.c" "lib/CMakeFiles/curlu.dir/curl_rtmp.c.o" "gcc" "lib/CMakeFiles/curlu.dir/curl_rtmp.c.o.d"
+  "/root/repo/lib/curl_sasl.c" "lib/CMakeFiles/curlu.dir/curl_sasl.c.o" "gcc" "lib/CMakeFiles/curlu.dir/curl_sasl.c.o.d"
+  "/root/repo/lib/curl_sha512_256.c" "lib/CMakeFiles/curlu.dir/curl_sha512_256.c.o" "gcc" "lib/CMakeFiles/curlu.dir/curl_sha512_256.c.o.d"
+  "/root/repo/lib/curl_sspi.c" "lib/CMakeFiles/curlu.dir/curl_sspi.c.o" "gcc" "lib/CMakeFiles/curlu.dir/curl_sspi.c.o.d"
+  "/root/repo/lib/curl_threads.c" "lib/CMakeFiles/curlu.dir/curl_threads.c.o" "gcc" "lib/CMakeFiles/curlu.dir/curl_threads.c.o.d"
+  "/root/repo/lib/curl_trc.c" "lib/CMakeFiles/curlu.dir/curl_trc.c.o" "gcc" "lib/CMakeFiles/curlu.dir/curl_trc.c.o.d"
+  "/root/repo/lib/curlx/base64.c" "lib/CMakeFiles/curlu.dir/curlx/base64.c.o" "gcc" "lib/CMakeFiles/curlu.dir/curlx/base64.c.o.d"
+  "/root/repo/lib/curlx/dynbuf.c" "lib/CMakeFiles/curlu.dir/curlx/dynbuf.c.o" "gcc" "lib/CMakeFiles/curlu.dir/curlx/dynbuf.c.o.d"
+  "/root/repo/lib/curlx/inet_ntop.c" "lib/CMakeFiles/curlu.dir/curlx/inet_ntop.c.o" "gcc" "lib/CMakeFiles/curlu.dir/curlx/inet_ntop.c.o.d"
+  "/root/repo/lib/curlx/inet_pton.c" "lib/CMakeFiles/curlu.dir/curlx/inet_pton.c.o" "gcc" "lib/CMakeFiles/curlu.dir/curlx/inet_pton.c.o.d"
+  "/root/repo/lib/curlx/multibyte.c" "lib/CMakeFiles/curlu.dir/curlx/multibyte.c.o" "gcc" "lib/CMakeFiles/curlu.dir/curlx/multibyte.c.o.d"
+  "/root/repo/lib/curlx/nonblock.c" "lib/CMakeFiles/curlu.dir/curlx/nonblock.c.o" "gcc" "lib/CMakeFiles/curlu.dir/curlx/nonblock.c.o.d"
+  "/root/repo/lib/curlx/strparse.c" "lib/CMakeFiles/curlu.dir/curlx/strparse.c.o" "gcc" "lib/CMakeFiles/curlu.dir/curlx/strparse.c.o.d"
+  "/root/repo/lib/curlx/timediff.c" "lib/CMakeFiles/curlu.dir/curlx/timediff.c.o" "gcc" "lib/CMakeFiles/curlu.dir/curlx/timediff.c.o.d"
+  "/root/repo/lib/curlx/timeval.c" "lib/CMakeFiles/curlu.dir/curlx/timeval.c.o" "gcc" "lib/CMakeFiles/curlu.dir/curlx/timeval.c.o.d"
+  "/root/repo/lib/curlx/version_win32.c" "lib/CMakeFiles/curlu.dir/curlx/version_win32.c.o" "gcc" "lib/CMakeFiles/curlu.dir/curlx/version_win32.c.o.d"
+  "/root/repo/lib/curlx/wait.c" "lib/CMakeFiles/curlu.dir/curlx/wait.c.o" "gcc" "lib/CMakeFiles/curlu.dir/curlx/wait.c.o.d"
+  "/root/repo/lib/curlx/warnless.c" "lib/CMakeFiles/curlu.dir/curlx/warnless.c.o" "gcc" "lib/CMakeFiles/curlu.dir/curlx/warnless.c.o.d"
+  "/root/repo/lib/curlx/winapi.c" "lib/CMakeFiles/curlu.dir/curlx/winapi.c.o" "gcc" "lib/CMakeFiles/curlu.dir/curlx/winapi.c.o.d"
+  "/root/repo/lib/cw-out.c" "lib/CMakeFiles/curlu.dir/cw-out.c.o" "gcc" "lib/CMakeFiles/curlu.dir/cw-out.c.o.d"
+  "/root/repo/lib/cw-pause.c" "lib/CMakeFiles/curlu.dir/cw-pause.c.o" "gcc" "lib/CMakeFiles/curlu.dir/cw-pause.c.o.d"
+  "/root/repo/lib/dict.c" "lib/CMakeFiles/curlu.dir/dict.c.o" "gcc" "lib/CMakeFiles/curlu.dir/dict.c.o.d"
+  "/root/repo/lib/doh.c" "lib/CMakeFiles/curlu.dir/doh.c.o" "gcc" "lib/CMakeFiles/curlu.dir/doh.c.o.d"
+  "/root/repo/lib/dynhds.c" "lib/CMakeFiles/curlu.dir/dynhds.c.o" "gcc" "lib/CMakeFiles/curlu.dir/dynhds.c.o.d"
+  "/root/repo/lib/easy.c" "lib/CMakeFiles/curlu.dir/easy.c.o" "gcc" "lib/CMakeFiles/curlu.dir/easy.c.o.d"
+  "/root/repo/lib/easygetopt.c" "lib/CMakeFiles/curlu.dir/easygetopt.c.o" "gcc" "lib/CMakeFiles/curlu.dir/easygetopt.c.o.d"
+  "/root/repo/lib/easyoptions.c" "lib/CMakeFiles/curlu.dir/easyoptions.c.o" "gcc" "lib/CMakeFiles/curlu.dir/easyoptions.c.o.d"
+  "/root/repo/lib/escape.c" "lib/CMakeFiles/curlu.dir/escape.c.o" "gcc" "lib/CMakeFiles/curlu.dir/escape.c.o.d"
+  "/root/repo/lib/fake_addrinfo.c" "lib/CMakeFiles/curlu.dir/fake_addrinfo.c.o" "gcc" "lib/CMakeFiles/curlu.dir/fake_addrinfo.c.o.d"
+  "/root/repo/lib/file.c" "lib/CMakeFiles/curlu.dir/file.c.o" "gcc" "lib/CMakeFiles/curlu.dir/file.c.o.d"
+  "/root/repo/lib/fileinfo.c" "lib/CMakeFiles/curlu.dir/fileinfo.c.o" "gcc" "lib/CMakeFiles/curlu.dir/fileinfo.c.o.d"
+  "/root/repo/lib/fopen.c" "lib/CMakeFiles/curlu.dir/fopen.c.o" "gcc" "lib/CMakeFiles/curlu.dir/fopen.c.o.d"
+  "/root/repo/lib/formdata.c" "lib/CMakeFiles/curlu.dir/formdata.c.o" "gcc" "lib/CMakeFiles/curlu.dir/formdata.c.o.d"
+  "/root/repo/lib/ftp.c" "lib/CMakeFiles/curlu.dir/ftp.c.o" "gcc" "lib/CMakeFiles/curlu.dir/ftp.c.o.d"
+  "/root/repo/lib/ftplistparser.c" "lib/CMakeFiles/curlu.dir/ftplistparser.c.o" "gcc" "lib/CMakeFiles/curlu.dir/ftplistparser.c.o.d"
+  "/root/repo/lib/getenv.c" "lib/CMakeFiles/curlu.dir/getenv.c.o" "gcc" "lib/CMakeFiles/curlu.dir/getenv.c.o.d"
+  "/root/repo/lib/getinfo.c" "lib/CMakeFiles/curlu.dir/getinfo.c.o" "gcc" "lib/CMakeFiles/curlu.dir/getinfo.c.o.d"
+  "/root/repo/lib/gopher.c" "lib/CMakeFiles/curlu.dir/gopher.c.o" "gcc" "lib/CMakeFiles/curlu.dir/gopher.c.o.d"
+  "/root/repo/lib/hash.c" "lib/CMakeFiles/curlu.dir/hash.c.o" "gcc" "lib/CMakeFiles/curlu.dir/hash.c.o.d"
+  "/root/repo/lib/headers.c" "lib/CMakeFiles/curlu.dir/headers.c.o" "gcc" "lib/CMakeFiles/curlu.dir/headers.c.o.d"
+  "/root/repo/lib/hmac.c" "lib/CMakeFiles/curlu.dir/hmac.c.o" "gcc" "lib/CMakeFiles/curlu.dir/hmac.c.o.d"
+  "/root/repo/lib/hostip.c" "lib/CMakeFiles/curlu.dir/hostip.c.o" "gcc" "lib/CMakeFiles/curlu.dir/hostip.c.o.d"
+  "/root/repo/lib/hostip4.c" "lib/CMakeFiles/curlu.dir/hostip4.c.o" "gcc" "lib/CMakeFiles/curlu.dir/hostip4.c.o.d"
+  "/root/repo/lib/hostip6.c" "lib/CMakeFiles/curlu.dir/hostip6.c.o" "gcc" "lib/CMakeFiles/curlu.dir/hostip6.c.o.d"
+  "/root/repo/lib/hsts.c" "lib/CMakeFiles/curlu.dir/hsts.c.o" "gcc" "lib/CMakeFiles/curlu.dir/hsts.c.o.d"
+  "/root/repo/lib/http.c" "lib/CMakeFiles/curlu.dir/http.c.o" "gcc" "lib/CMakeFiles/curlu.dir/http.c.o.d"
+  "/root/repo/lib/http1.c" "lib/CMakeFiles/curlu.dir/http1.c.o" "gcc" "lib/CMakeFiles/curlu.dir/http1.c.o.d"
+  "/root/repo/lib/http2.c" "lib/CMakeFiles/curlu.dir/http2.c.o" "gcc" "lib/CMakeFiles/curlu.dir/http2.c.o.d"
+  "/root/repo/lib/http_aws_sigv4.c" "lib/CMakeFiles/curlu.dir/http_aws_sigv4.c.o" "gcc" "lib/CMakeFiles/curlu.dir/http_aws_sigv4.c.o.d"
+  "/root/repo/lib/http_chunks.c" "lib/CMakeFiles/curlu.dir/http_chunks.c.o" "gcc" "lib/CMakeFiles/curlu.dir/http_chunks.c.o.d"
+  "/root/repo/lib/http_digest.c" "lib/CMakeFiles/curlu.dir/http_digest.c.o" "gcc" "lib/CMakeFiles/curlu.dir/http_digest.c.o.d"
+  "/root/repo/lib/http_negotiate.c" "lib/CMakeFiles/curlu.dir/http_negotiate.c.o" "gcc" "lib/CMakeFiles/curlu.dir/http_negotiate.c.o.d"
+  "/root/repo/lib/http_ntlm.c" "lib/CMakeFiles/curlu.dir/http_ntlm.c.o" "gcc" "lib/CMakeFiles/curlu.dir/http_ntlm.c.o.d"
+  "/root/repo/lib/http_prio.c" "lib/CMakeFiles/curlu.dir/http_prio.c.o" "gcc" "lib/CMakeFiles/curlu.dir/http_prio.c.o.d"
+  "/root/repo/lib/http_proxy.c" "lib/CMakeFiles/curlu.dir/http_proxy.c.o" "gcc" "lib/CMakeFiles/curlu.dir/http_proxy.c.o.d"
+  "/root/repo/lib/httpsrr.c" "lib/CMakeFiles/curlu.dir/httpsrr.c.o" "gcc" "lib/CMakeFiles/curlu.dir/httpsrr.c.o.d"
+  "/root/repo/lib/idn.c" "lib/CMakeFiles/curlu.dir/idn.c.o" "gcc" "lib/CMakeFiles/curlu.dir/idn.c.o.d"
+  "/root/repo/lib/if2ip.c" "lib/CMakeFiles/curlu.dir/if2ip.c.o" "gcc" "lib/CMakeFiles/curlu.dir/if2ip.c.o.d"
+  "/root/repo/lib/imap.c" "lib/CMakeFiles/curlu.dir/imap.c.o" "gcc" "lib/CMakeFiles/curlu.dir/imap.c.o.d"
+  "/root/repo/lib/krb5.c" "lib/CMakeFiles/curlu.dir/krb5.c.o" "gcc" "lib/CMakeFiles/curlu.dir/krb5.c.o.d"
+  "/root/repo/lib/ldap.c" "lib/CMakeFiles/curlu.dir/ldap.c.o" "gcc" "lib/CMakeFiles/curlu.dir/ldap.c.o.d"
+  "/root/repo/lib/llist.c" "lib/CMakeFiles/curlu.dir/llist.c.o" "gcc" "lib/CMakeFiles/curlu.dir/llist.c.o.d"
+  "/root/repo/lib/macos.c" "lib/CMakeFiles/curlu.dir/macos.c.o" "gcc" "lib/CMakeFiles/curlu.dir/macos.c.o.d"
+  "/root/repo/lib/md4.c" "lib/CMakeFiles/curlu.dir/md4.c.o" "gcc" "lib/CMakeFiles/curlu.dir/md4.c.o.d"
+  "/root/repo/lib/md5.c" "lib/CMakeFiles/curlu.dir/md5.c.o" "gcc" "lib/CMakeFiles/curlu.dir/md5.c.o.d"
+  "/root/repo/lib/memdebug.c" "lib/CMakeFiles/curlu.dir/memdebug.c.o" "gcc" "lib/CMakeFiles/curlu.dir/memdebug.c.o.d"
+  "/root/repo/lib/mime.c" "lib/CMakeFiles/curlu.dir/mime.c.o" "gcc" "lib/CMakeFiles/curlu.dir/mime.c.o.d"
+  "/root/repo/lib/mprintf.c" "lib/CMakeFiles/curlu.dir/mprintf.c.o" "gcc" "lib/CMakeFiles/curlu.dir/mprintf.c.o.d"
+  "/root/repo/lib/mqtt.c" "lib/CMakeFiles/curlu.dir/mqtt.c.o" "gcc" "lib/CMakeFiles/curlu.dir/mqtt.c.o.d"
+  "/root/repo/lib/multi.c" "lib/CMakeFiles/curlu.dir/multi.c.o" "gcc" "lib/CMakeFiles/curlu.dir/multi.c.o.d"
+  "/root/repo/lib/multi_ev.c" "lib/CMakeFiles/curlu.dir/multi_ev.c.o" "gcc" "lib/CMakeFiles/curlu.dir/multi_ev.c.o.d"
+  "/root/repo/lib/netrc.c" "lib/CMakeFiles/curlu.dir/netrc.c.o" "gcc" "lib/CMakeFiles/curlu.dir/netrc.c.o.d"
+  "/root/repo/lib/noproxy.c" "lib/CMakeFiles/curlu.dir/noproxy.c.o" "gcc" "lib/CMakeFiles/curlu.dir/noproxy.c.o.d"
+  "/root/repo/lib/openldap.c" "lib/CMakeFiles/curlu.dir/openldap.c.o" "gcc" "lib/CMakeFiles/curlu.dir/openldap.c.o.d"
+  "/root/repo/lib/parsedate.c" "lib/CMakeFiles/curlu.dir/parsedate.c.o" "gcc" "lib/CMakeFiles/curlu.dir/parsedate.c.o.d"
+  "/root/repo/lib/pingpong.c" "lib/CMakeFiles/curlu.dir/pingpong.c.o" "gcc" "lib/CMakeFiles/curlu.dir/pingpong.c.o.d"
+  "/root/repo/lib/pop3.c" "lib/CMakeFiles/curlu.dir/pop3.c.o" "gcc" "lib/CMakeFiles/curlu.dir/pop3.c.o.d"
+  "/root/repo/lib/progress.c" "lib/CMakeFiles/curlu.dir/progress.c.o" "gcc" "lib/CMakeFiles/curlu.dir/progress.c.o.d"
+  "/root/repo/lib/psl.c" "lib/CMakeFiles/curlu.dir/psl.c.o" "gcc" "lib/CMakeFiles/curlu.dir/psl.c.o.d"
+  "/root/repo/lib/rand.c" "lib/CMakeFiles/curlu.dir/rand.c.o" "gcc" "lib/CMakeFiles/curlu.dir/rand.c.o.d"
+  "/root/repo/lib/rename.c" "lib/CMakeFiles/curlu.dir/rename.c.o" "gcc" "lib/CMakeFiles/curlu.dir/rename.c.o.d"
+  "/root/repo/lib/request.c" "lib/CMakeFiles/curlu.dir/request.c.o" "gcc" "lib/CMakeFiles/curlu.dir/request.c.o.d"
+  "/root/repo/lib/rtsp.c" "lib/CMakeFiles/curlu.dir/rtsp.c.o" "gcc" "lib/CMakeFiles/curlu.dir/rtsp.c.o.d"
+  "/root/repo/lib/select.c" "lib/CMakeFiles/curlu.dir/select.c.o" "gcc" "lib/CMakeFiles/curlu.dir/select.c.o.d"
+  "/root/repo/lib/sendf.c" "lib/CMakeFiles/curlu.dir/sendf.c.o" "gcc" "lib/CMakeFiles/curlu.dir/sendf.c.o.d"
+  "/root/repo/lib/setopt.c" "lib/CMakeFiles/curlu.dir/setopt.c.o" "gcc" "lib/CMakeFiles/curlu.dir/setopt.c.o.d"
+  "/root/repo/lib/sha256.c" "lib/CMakeFiles/curlu.dir/sha256.c.o" "gcc" "lib/CMakeFiles/curlu.dir/sha256.c.o.d"
+  "/root/repo/lib/share.c" "lib/CMakeFiles/curlu.dir/share.c.o" "gcc" "lib/CMakeFiles/curlu.dir/share.c.o.d"
+  "/root/repo/lib/slist.c" "lib/CMakeFiles/curlu.dir/slist.c.o" "gcc" "lib/CMakeFiles/curlu.dir/slist.c.o.d"
+  "/root/repo/lib/smb.c" "lib/CMakeFiles/curlu.dir/smb.c.o" "gcc" "lib/CMakeFiles/curlu.dir/smb.c.o.d"
+  "/root/repo/lib/smtp.c" "lib/CMakeFiles/curlu.dir/smtp.c.o" "gcc" "lib/CMakeFiles/curlu.dir/smtp.c.o.d"
+  "/root/repo/lib/socketpair.c" "lib/CMakeFiles/curlu.dir/socketpair.c.o" "gcc" "lib/CMakeFiles/curlu.dir/socketpair.c.o.d"
+  "/root/repo/lib/socks.c" "lib/CMakeFiles/curlu.dir/socks.c.o" "gcc" "lib/CMakeFiles/curlu.dir/socks.c.o.d"
+  "/root/repo/lib/socks_gssapi.c" "lib/CMakeFiles/curlu.dir/socks_gssapi.c.o" "gcc" "lib/CMakeFiles/curlu.dir/socks_gssapi.c.o.d"
+  "/root/repo/lib/socks_sspi.c" "lib/CMakeFiles/curlu.dir/socks_sspi.c.o" "gcc" "lib/CMakeFiles/curlu.dir/socks_sspi.c.o.d"
+  "/root/repo/lib/speedcheck.c" "lib/CMakeFiles/curlu.dir/speedcheck.c.o" "gcc" "lib/CMakeFiles/curlu.dir/speedcheck.c.o.d"
+  "/root/repo/lib/splay.c" "lib/CMakeFiles/curlu.dir/splay.c.o" "gcc" "lib/CMakeFiles/curlu.dir/splay.c.o.d"
+  "/root/repo/lib/strcase.c" "lib/CMakeFiles/curlu.dir/strcase.c.o" "gcc" "lib/CMakeFiles/curlu.dir/strcase.c.o.d"
+  "/root/repo/lib/strdup.c" "lib/CMakeFiles/curlu.dir/strdup.c.o" "gcc" "lib/CMakeFiles/curlu.dir/strdup.c.o.d"
+  "/root/repo/lib/strequal.c" "lib/CMakeFiles/curlu.dir/strequal.c.o" "gcc" "lib/CMakeFiles/curlu.dir/strequal.c.o.d"
+  "/root/repo/lib/strerror.c" "lib/CMakeFiles/curlu.dir/strerror.c.o" "gcc" "lib/CMakeFiles/curlu.dir/strerror.c.o.d"
+  "/root/repo/lib/system_win32.c" "lib/CMakeFiles/curlu.dir/system_win32.c.o" "gcc" "lib/CMakeFiles/curlu.dir/system_win32.c.o.d"
+  "/root/repo/lib/telnet.c" "lib/CMakeFiles/curlu.dir/telnet.c.o" "gcc" "lib/CMakeFiles/curlu.dir/telnet.c.o.d"
+  "/root/repo/lib/tftp.c" "lib/CMakeFiles/curlu.dir/tftp.c.o" "gcc" "lib/CMakeFiles/curlu.dir/tftp.c.o.d"
+  "/root/repo/lib/thrdpool.c" "lib/CMakeFiles/curlu.dir/thrdpool.c.o" "gcc" "lib/CMakeFiles/curlu.dir/thrdpool.c.o.d"
+  "/root/repo/lib/timewheel.c" "lib/CMakeFiles/curlu.dir/timewheel.c.o" "gcc" "lib/CMakeFiles/curlu.dir/timewheel.c.o.d"
+  "/root/repo/lib/transfer.c" "lib/CMakeFiles/curlu.dir/transfer.c.o" "gcc" "lib/CMakeFiles/curlu.dir/transfer.c.o.d"
+  "/root/repo/lib/uint-bset.c" "lib/CMakeFiles/curlu.dir/uint-bset.c.o" "gcc" "lib/CMakeFiles/curlu.dir/uint-bset.c.o.d"
+  "/root/repo/lib/uint-hash.c" "lib/CMakeFiles/curlu.dir/uint-hash.c.o" "gcc" "lib/CMakeFiles/curlu.dir/uint-hash.c.o.d"
+  "/root/repo/lib/uint-spbset.c" "lib/CMakeFiles/curlu.dir/uint-spbset.c.o" "gcc" "lib/CMakeFiles/curlu.dir/uint-spbset.c.o.d"
+  "/root/repo/lib/uint-table.c" "lib/CMakeFiles/curlu.dir/uint-table.c.o" "gcc" "lib/CMakeFiles/curlu.dir/uint-table.c.o.d"
+  "/root/repo/lib/uring.c" "lib/CMakeFiles/curlu.dir/uring.c.o" "gcc" "lib/CMakeFiles/curlu.dir/uring.c.o.d"
+  "/root/repo/lib/url.c" "lib/CMakeFiles/curlu.dir/url.c.o" "gcc" "lib/CMakeFiles/curlu.dir/url.c.o.d"
+  "/root/repo/lib/urlapi.c" "lib/CMakeFiles/curlu.dir/urlapi.c.o" "gcc" "lib/CMakeFiles/curlu.dir/urlapi.c.o.d"
+  "/root/repo/lib/vauth/cleartext.c" "lib/CMakeFiles/curlu.dir/vauth/cleartext.c.o" "gcc" "lib/CMakeFiles/curlu.dir/vauth/cleartext.c.o.d"
+  "/root/repo/lib/vauth/cram.c" "lib/CMakeFiles/curlu.dir/vauth/cram.c.o" "gcc" "lib/CMakeFiles/curlu.dir/vauth/cram.c.o.d"
+  "/root/repo/lib/vauth/digest.c" "lib/CMakeFiles/curlu.dir/vauth/digest.c.o" "gcc" "lib/CMakeFiles/curlu.dir/vauth/digest.c.o.d"
+  "/root/repo/lib/vauth/digest_sspi.c" "lib/CMakeFiles/curlu.dir/vauth/digest_sspi.c.o" "gcc" "lib/CMakeFiles/curlu.dir/vauth/digest_sspi.c.o.d"
+  "/root/repo/lib/vauth/gsasl.c" "lib/CMakeFiles/curlu.dir/vauth/gsasl.c.o" "gcc" "lib/CMakeFiles/curlu.dir/vauth/gsasl.c.o.d"
+  "/root/repo/lib/vauth/krb5_gssapi.c" "lib/CMakeFiles/curlu.dir/vauth/krb5_gssapi.c.o" "gcc" "lib/CMakeFiles/curlu.dir/vauth/krb5_gssapi.c.o.d"
+  "/root/repo/lib/vauth/krb5_sspi.c" "lib/CMakeFiles/curlu.dir/vauth/krb5_sspi.c.o" "gcc" "lib/CMakeFiles/curlu.dir/vauth/krb5_sspi.c.o.d"
+  "/root/repo/lib/vauth/ntlm.c" "lib/CMakeFiles/curlu.dir/vauth/ntlm.c.o" "gcc" "lib/CMakeFiles/curlu.dir/vauth/ntlm.c.o.d"
+  "/root/repo/lib/vauth/ntlm_sspi.c" "lib/CMakeFiles/curlu.dir/vauth/ntlm_sspi.c.o" "gcc" "lib/CMakeFiles/curlu.dir/vauth/ntlm_sspi.c.o.d"
+  "/root/repo/lib/vauth/oauth2.c" "lib/CMakeFiles/curlu.dir/vauth/oauth2.c.o" "gcc" "lib/CMakeFiles/curlu.dir/vauth/oauth2.c.o.d"
+  "/root/repo/lib/vauth/spnego_gssapi.c" "lib/CMakeFiles/curlu.dir/vauth/spnego_gssapi.c.o" "gcc" "lib/CMakeFiles/curlu.dir/vauth/spnego_gssapi.c.o.d"
+  "/root/repo/lib/vauth/spnego_sspi.c" "lib/CMakeFiles/curlu.dir/vauth/spnego_sspi.c.o" "gcc" "lib/CMakeFiles/curlu.dir/vauth/spnego_sspi.c.o.d"
+  "/root/repo/lib/vauth/vauth.c" "lib/CMakeFiles/curlu.dir/vauth/vauth.c.o" "gcc" "lib/CMakeFiles/curlu.dir/vauth/vauth.c.o.d"
+  "/root/repo/lib/version.c" "lib/CMakeFiles/curlu.dir/version.c.o" "gcc" "lib/CMakeFiles/curlu.dir/version.c.o.d"
+  "/root/repo/lib/vquic/curl_ngtcp2.c" "lib/CMakeFiles/curlu.dir/vquic/curl_ngtcp2.c.o" "gcc" "lib/CMakeFiles/curlu.dir/vquic/curl_ngtcp2.c.o.d"
+  "/root/repo/lib/vquic/curl_osslq.c" "lib/CMakeFiles/curlu.dir/vquic/curl_osslq.c.o" "gcc" "lib/CMakeFiles/curlu.dir/vquic/curl_osslq.c.o.d"
+  "/root/repo/lib/vquic/curl_quiche.c" "lib/CMakeFiles/curlu.dir/vquic/curl_quiche.c.o" "gcc" "lib/CMakeFiles/curlu.dir/vquic/curl_quiche.c.o.d"
+  "/root/repo/lib/vquic/vquic-tls.c" "lib/CMakeFiles/curlu.dir/vquic/vquic-tls.c.o" "gcc" "lib/CMakeFiles/curlu.dir/vquic/vquic-tls.c.o.d"
+  "/root/repo/lib/vquic/vquic.c" "lib/CMakeFiles/curlu.dir/vquic/vquic.c.o" "gcc" "lib/CMakeFiles/curlu.dir/vquic/vquic.c.o.d"
+  "/root/repo/lib/vssh/curl_path.c" "lib/CMakeFiles/curlu.dir/vssh/curl_path.c.o" "gcc" "lib/CMakeFiles/curlu.dir/vssh/curl_path.c.o.d"
+  "/root/repo/lib/vssh/libssh.c" "lib/CMakeFiles/curlu.dir/vssh/libssh.c.o" "gcc" "lib/CMakeFiles/curlu.dir/vssh/libssh.c.o.d"
+  "/root/repo/lib/vssh/libssh2.c" "lib/CMakeFiles/curlu.dir/vssh/libssh2.c.o" "gcc" "lib/CMakeFiles/curlu.dir/vssh/libssh2.c.o.d"
+  "/root/repo/lib/vssh/wolfssh.c" "lib/CMakeFiles/curlu.dir/vssh/wolfssh.c.o" "gcc" "lib/CMakeFiles/curlu.dir/vssh/wolfssh.c.o.d"
+  "/root/repo/lib/vtls/cipher_suite.c" "lib/CMakeFiles/curlu.dir/vtls/cipher_suite.c.o" "gcc" "lib/CMakeFiles/curlu.dir/vtls/cipher_suite.c.o.d"
+  "/root/repo/lib/vtls/gtls.c" "lib/CMakeFiles/curlu.dir/vtls/gtls.c.o" "gcc" "lib/CMakeFiles/curlu.dir/vtls/gtls.c.o.d"
+  "/root/repo/lib/vtls/hostcheck.c" "lib/CMakeFiles/curlu.dir/vtls/hostcheck.c.o" "gcc" "lib/CMakeFiles/curlu.dir/vtls/hostcheck.c.o.d"
+  "/root/repo/lib/vtls/keylog.c" "lib/CMakeFiles/curlu.dir/vtls/keylog.c.o" "gcc" "lib/CMakeFiles/curlu.dir/vtls/keylog.c.o.d"
+  "/root/repo/lib/vtls/mbedtls.c" "lib/CMakeFiles/curlu.dir/vtls/mbedtls.c.o" "gcc" "lib/CMakeFiles/curlu.dir/vtls/mbedtls.c.o.d"
+  "/root/repo/lib/vtls/mbedtls_threadlock.c" "lib/CMakeFiles/curlu.dir/vtls/mbedtls_threadlock.c.o" "gcc" "lib/CMakeFiles/curlu.dir/vtls/mbedtls_threadlock.c.o.d"
+  "/root/repo/lib/vtls/openssl.c" "lib/CMakeFiles/curlu.dir/vtls/openssl.c.o" "gcc" "lib/CMakeFiles/curlu.dir/vtls/openssl.c.o.d"
+  "/root/repo/lib/vtls/rustls.c" "lib/CMakeFiles/curlu.dir/vtls/rustls.c.o" "gcc" "lib/CMakeFiles/curlu.dir/vtls/rustls.c.o.d"
+  "/root/repo/lib/vtls/schannel.c" "lib/CMakeFiles/curlu.dir/vtls/schannel.c.o" "gcc" "lib/CMakeFiles/curlu.dir/vtls/schannel.c.o.d"
+  "/root/repo/lib/vtls/schannel_verify.c" "lib/CMakeFiles/curlu.dir/vtls/schannel_verify.c.o" "gcc" "lib/CMakeFiles/curlu.dir/vtls/schannel_verify.c.o.d"
+  "/root/repo/lib/vtls/vtls.c" "lib/CMakeFiles/curlu.dir/vtls/vtls.c.o" "gcc" "lib/CMakeFiles/curlu.dir/vtls/vtls.c.o.d"
+  "/root/repo/lib/vtls/vtls_scache.c" "lib/CMakeFiles/curlu.dir/vtls/vtls_scache.c.o" "gcc" "lib/CMakeFiles/curlu.dir/vtls/vtls_scache.c.o.d"
+  "/root/repo/lib/vtls/vtls_spack.c" "lib/CMakeFiles/curlu.dir/vtls/vtls_spack.c.o" "gcc" "lib/CMakeFiles/curlu.dir/vtls/vtls_spack.c.o.d"
+  "/root/repo/lib/vtls/wolfssl.c" "lib/CMakeFiles/curlu.dir/vtls/wolfssl.c.o" "gcc" "lib/CMakeFiles/curlu.dir/vtls/wolfssl.c.o.d"
+  "/root/repo/lib/vtls/x509asn1.c" "lib/CMakeFiles/curlu.dir/vtls/x509asn1.c.o" "gcc" "lib/CMakeFiles/curlu.dir/vtls/x509asn1.c.o.d"
+  "/root/repo/lib/ws.c" "lib/CMakeFiles/curlu.dir/ws.c.o" "gcc" "lib/CMakeFiles/curlu.dir/ws.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,373 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curlu.dir/altsvc.c.o"
+  "CMakeFiles/curlu.dir/altsvc.c.o.d"
+  "CMakeFiles/curlu.dir/amigaos.c.o"
+  "CMakeFiles/curlu.dir/amigaos.c.o.d"
+  "CMakeFiles/curlu.dir/asyn-ares.c.o"
+  "CMakeFiles/curlu.dir/asyn-ares.c.o.d"
+  "CMakeFiles/curlu.dir/asyn-base.c.o"
+  "CMakeFiles/curlu.dir/asyn-base.c.o.d"
+  "CMakeFiles/curlu.dir/asyn-thrdd.c.o"
+  "CMakeFiles/curlu.dir/asyn-thrdd.c.o.d"
+  "CMakeFiles/curlu.dir/bufq.c.o"
+  "CMakeFiles/curlu.dir/bufq.c.o.d"
+  "CMakeFiles/curlu.dir/bufref.c.o"
+  "CMakeFiles/curlu.dir/bufref.c.o.d"
+  "CMakeFiles/curlu.dir/cf-h1-proxy.c.o"
+  "CMakeFiles/curlu.dir/cf-h1-proxy.c.o.d"
+  "CMakeFiles/curlu.dir/cf-h2-proxy.c.o"
+  "CMakeFiles/curlu.dir/cf-h2-proxy.c.o.d"
+  "CMakeFiles/curlu.dir/cf-haproxy.c.o"
+  "CMakeFiles/curlu.dir/cf-haproxy.c.o.d"
+  "CMakeFiles/curlu.dir/cf-https-connect.c.o"
+  "CMakeFiles/curlu.dir/cf-https-connect.c.o.d"
+  "CMakeFiles/curlu.dir/cf-ip-happy.c.o"
+  "CMakeFiles/curlu.dir/cf-ip-happy.c.o.d"
+  "CMakeFiles/curlu.dir/cf-socket.c.o"
+  "CMakeFiles/curlu.dir/cf-socket.c.o.d"
+  "CMakeFiles/curlu.dir/cfilters.c.o"
+  "CMakeFiles/curlu.dir/cfilters.c.o.d"
+  "CMakeFiles/curlu.dir/conncache.c.o"
+  "CMakeFiles/curlu.dir/conncache.c.o.d"
+  "CMakeFiles/curlu.dir/connect.c.o"
+  "CMakeFiles/curlu.dir/connect.c.o.d"
+  "CMakeFiles/curlu.dir/content_encoding.c.o"
+  "CMakeFiles/curlu.dir/content_encoding.c.o.d"
+  "CMakeFiles/curlu.dir/cookie.c.o"
+  "CMakeFiles/curlu.dir/cookie.c.o.d"
+  "CMakeFiles/curlu.dir/cshutdn.c.o"
+  "CMakeFiles/curlu.dir/cshutdn.c.o.d"
+  "CMakeFiles/curlu.dir/curl_addrinfo.c.o"
+  "CMakeFiles/curlu.dir/curl_addrinfo.c.o.d"
+  "CMakeFiles/curlu.dir/curl_des.c.o"
+  "CMakeFiles/curlu.dir/curl_des.c.o.d"
+  "CMakeFiles/curlu.dir/curl_endian.c.o"
+  "CMakeFiles/curlu.dir/curl_endian.c.o.d"
+  "CMakeFiles/curlu.dir/curl_fnmatch.c.o"
+  "CMakeFiles/curlu.dir/curl_fnmatch.c.o.d"
+  "CMakeFiles/curlu.dir/curl_get_line.c.o"
+  "CMakeFiles/curlu.dir/curl_get_line.c.o.d"
+  "CMakeFiles/curlu.dir/curl_gethostname.c.o"
+  "CMakeFiles/curlu.dir/curl_gethostname.c.o.d"
+  "CMakeFiles/curlu.dir/curl_gssapi.c.o"
+  "CMakeFiles/curlu.dir/curl_gssapi.c.o.d"
+  "CMakeFiles/curlu.dir/curl_memrchr.c.o"
+  "CMakeFiles/curlu.dir/curl_memrchr.c.o.d"
+  "CMakeFiles/curlu.dir/curl_ntlm_core.c.o"
+  "CMakeFiles/curlu.dir/curl_ntlm_core.c.o.d"
+  "CMakeFiles/curlu.dir/curl_range.c.o"
+  "CMakeFiles/curlu.dir/curl_range.c.o.d"
+  "CMakeFiles/curlu.dir/curl_rtmp.c.o"
+  "CMakeFiles/curlu.dir/curl_rtmp.c.o.d"
+  "CMakeFiles/curlu.dir/curl_sasl.c.o"
+  "CMakeFiles/curlu.dir/curl_sasl.c.o.d"
+  "CMakeFiles/curlu.dir/curl_sha512_256.c.o"
+  "CMakeFiles/curlu.dir/curl_sha512_256.c.o.d"
+  "CMakeFiles/curlu.dir/curl_sspi.c.o"
+  "CMakeFiles/curlu.dir/curl_sspi.c.o.d"
+  "CMakeFiles/curlu.dir/curl_threads.c.o"
+  "CMakeFiles/curlu.dir/curl_threads.c.o.d"
+  "CMakeFiles/curlu.dir/curl_trc.c.o"
+  "CMakeFiles/curlu.dir/curl_trc.c.o.d"
+  "CMakeFiles/curlu.dir/curlx/base64.c.o"
+  "CMakeFiles/curlu.dir/curlx/base64.c.o.d"
+  "CMakeFiles/curlu.dir/curlx/dynbuf.c.o"
+  "CMakeFiles/curlu.dir/curlx/dynbuf.c.o.d"
+  "CMakeFiles/curlu.dir/curlx/inet_ntop.c.o"
+  "CMakeFiles/curlu.dir/curlx/inet_ntop.c.o.d"
+  "CMakeFiles/curlu.dir/curlx/inet_pton.c.o"
+  "CMakeFiles/curlu.dir/curlx/inet_pton.c.o.d"
+  "CMakeFiles/curlu.dir/curlx/multibyte.c.o"
+  "CMakeFiles/curlu.dir/curlx/multibyte.c.o.d"
+  "CMakeFiles/curlu.dir/curlx/nonblock.c.o"
+  "CMakeFiles/curlu.dir/curlx/nonblock.c.o.d"
+  "CMakeFiles/curlu.dir/curlx/strparse.c.o"
+  "CMakeFiles/curlu.dir/curlx/strparse.c.o.d"
+  "CMakeFiles/curlu.dir/curlx/timediff.c.o"
+  "CMakeFiles/curlu.dir/curlx/timediff.c.o.d"
+  "CMakeFiles/curlu.dir/curlx/timeval.c.o"
+  "CMakeFiles/curlu.dir/curlx/timeval.c.o.d"
+  "CMakeFiles/curlu.dir/curlx/version_win32.c.o"
+  "CMakeFiles/curlu.dir/curlx/version_win32.c.o.d"
+  "CMakeFiles/curlu.dir/curlx/wait.c.o"
+  "CMakeFiles/curlu.dir/curlx/wait.c.o.d"
+  "CMakeFiles/curlu.dir/curlx/warnless.c.o"
+  "CMakeFiles/curlu.dir/curlx/warnless.c.o.d"
+  "CMakeFiles/curlu.dir/curlx/winapi.c.o"
+  "CMakeFiles/curlu.dir/curlx/winapi.c.o.d"
+  "CMakeFiles/curlu.dir/cw-out.c.o"
+  "CMakeFiles/curlu.dir/cw-out.c.o.d"
+  "CMakeFiles/curlu.dir/cw-pause.c.o"
+  "CMakeFiles/curlu.dir/cw-pause.c.o.d"
+  "CMakeFiles/curlu.dir/dict.c.o"
+  "CMakeFiles/curlu.dir/dict.c.o.d"
+  "CMakeFiles/curlu.dir/doh.c.o"
+  "CMakeFiles/curlu.dir/doh.c.o.d"
+  "CMakeFiles/curlu.dir/dynhds.c.o"
+  "CMakeFiles/curlu.dir/dynhds.c.o.d"
+  "CMakeFiles/curlu.dir/easy.c.o"
+  "CMakeFiles/curlu.dir/easy.c.o.d"
+  "CMakeFiles/curlu.dir/easygetopt.c.o"
+  "CMakeFiles/curlu.dir/easygetopt.c.o.d"
+  "CMakeFiles/curlu.dir/easyoptions.c.o"
+  "CMakeFiles/curlu.dir/easyoptions.c.o.d"
+  "CMakeFiles/curlu.dir/escape.c.o"
+  "CMakeFiles/curlu.dir/escape.c.o.d"
+  "CMakeFiles/curlu.dir/fake_addrinfo.c.o"
+  "CMakeFiles/curlu.dir/fake_addrinfo.c.o.d"
+  "CMakeFiles/curlu.dir/file.c.o"
+  "CMakeFiles/curlu.dir/file.c.o.d"
+  "CMakeFiles/curlu.dir/fileinfo.c.o"
+  "CMakeFiles/curlu.dir/fileinfo.c.o.d"
+  "CMakeFiles/curlu.dir/fopen.c.o"
+  "CMakeFiles/curlu.dir/fopen.c.o.d"
+  "CMakeFiles/curlu.dir/formdata.c.o"
+  "CMakeFiles/curlu.dir/formdata.c.o.d"
+  "CMakeFiles/curlu.dir/ftp.c.o"
+  "CMakeFiles/curlu.dir/ftp.c.o.d"
+  "CMakeFiles/curlu.dir/ftplistparser.c.o"
+  "CMakeFiles/curlu.dir/ftplistparser.c.o.d"
+  "CMakeFiles/curlu.dir/getenv.c.o"
+  "CMakeFiles/curlu.dir/getenv.c.o.d"
+  "CMakeFiles/curlu.dir/getinfo.c.o"
+  "CMakeFiles/curlu.dir/getinfo.c.o.d"
+  "CMakeFiles/curlu.dir/gopher.c.o"
+  "CMakeFiles/curlu.dir/gopher.c.o.d"
+  "CMakeFiles/curlu.dir/hash.c.o"
+  "CMakeFiles/curlu.dir/hash.c.o.d"
+  "CMakeFiles/curlu.dir/headers.c.o"
+  "CMakeFiles/curlu.dir/headers.c.o.d"
+  "CMakeFiles/curlu.dir/hmac.c.o"
+  "CMakeFiles/curlu.dir/hmac.c.o.d"
+  "CMakeFiles/curlu.dir/hostip.c.o"
+  "CMakeFiles/curlu.dir/hostip.c.o.d"
+  "CMakeFiles/curlu.dir/hostip4.c.o"
+  "CMakeFiles/curlu.dir/hostip4.c.o.d"
+  "CMakeFiles/curlu.dir/hostip6.c.o"
+  "CMakeFiles/curlu.dir/hostip6.c.o.d"
+  "CMakeFiles/curlu.dir/hsts.c.o"
+  "CMakeFiles/curlu.dir/hsts.c.o.d"
+  "CMakeFiles/curlu.dir/http.c.o"
+  "CMakeFiles/curlu.dir/http.c.o.d"
+  "CMakeFiles/curlu.dir/http1.c.o"
+  "CMakeFiles/curlu.dir/http1.c.o.d"
+  "CMakeFiles/curlu.dir/http2.c.o"
+  "CMakeFiles/curlu.dir/http2.c.o.d"
+  "CMakeFiles/curlu.dir/http_aws_sigv4.c.o"
+  "CMakeFiles/curlu.dir/http_aws_sigv4.c.o.d"
+  "CMakeFiles/curlu.dir/http_chunks.c.o"
+  "CMakeFiles/curlu.dir/http_chunks.c.o.d"
+  "CMakeFiles/curlu.dir/http_digest.c.o"
+  "CMakeFiles/curlu.dir/http_digest.c.o.d"
+  "CMakeFiles/curlu.dir/http_negotiate.c.o"
+  "CMakeFiles/curlu.dir/http_negotiate.c.o.d"
+  "CMakeFiles/curlu.dir/http_ntlm.c.o"
+  "CMakeFiles/curlu.dir/http_ntlm.c.o.d"
+  "CMakeFiles/curlu.dir/http_prio.c.o"
+  "CMakeFiles/curlu.dir/http_prio.c.o.d"
+  "CMakeFiles/curlu.dir/http_proxy.c.o"
+  "CMakeFiles/curlu.dir/http_proxy.c.o.d"
+  "CMakeFiles/curlu.dir/httpsrr.c.o"
+  "CMakeFiles/curlu.dir/httpsrr.c.o.d"
+  "CMakeFiles/curlu.dir/idn.c.o"
+  "CMakeFiles/curlu.dir/idn.c.o.d"
+  "CMakeFiles/curlu.dir/if2ip.c.o"
+  "CMakeFiles/curlu.dir/if2ip.c.o.d"
+  "CMakeFiles/curlu.dir/imap.c.o"
+  "CMakeFiles/curlu.dir/imap.c.o.d"
+  "CMakeFiles/curlu.dir/krb5.c.o"
+  "CMakeFiles/curlu.dir/krb5.c.o.d"
+  "CMakeFiles/curlu.dir/ldap.c.o"
+  "CMakeFiles/curlu.dir/ldap.c.o.d"
+  "CMakeFiles/curlu.dir/llist.c.o"
+  "CMakeFiles/curlu.dir/llist.c.o.d"
+  "CMakeFiles/curlu.dir/macos.c.o"
+  "CMakeFiles/curlu.dir/macos.c.o.d"
+  "CMakeFiles/curlu.dir/md4.c.o"
+  "CMakeFiles/curlu.dir/md4.c.o.d"
+  "CMakeFiles/curlu.dir/md5.c.o"
+  "CMakeFiles/curlu.dir/md5.c.o.d"
+  "CMakeFiles/curlu.dir/memdebug.c.o"
+  "CMakeFiles/curlu.dir/memdebug.c.o.d"
+  "CMakeFiles/curlu.dir/mime.c.o"
+  "CMakeFiles/curlu.dir/mime.c.o.d"
+  "CMakeFiles/curlu.dir/mprintf.c.o"
+  "CMakeFiles/curlu.dir/mprintf.c.o.d"
+  "CMakeFiles/curlu.dir/mqtt.c.o"
+  "CMakeFiles/curlu.dir/mqtt.c.o.d"
+  "CMakeFiles/curlu.dir/multi.c.o"
+  "CMakeFiles/curlu.dir/multi.c.o.d"
+  "CMakeFiles/curlu.dir/multi_ev.c.o"
+  "CMakeFiles/curlu.dir/multi_ev.c.o.d"
+  "CMakeFiles/curlu.dir/netrc.c.o"
+  "CMakeFiles/curlu.dir/netrc.c.o.d"
+  "CMakeFiles/curlu.dir/noproxy.c.o"
+  "CMakeFiles/curlu.dir/noproxy.c.o.d"
+  "CMakeFiles/curlu.dir/openldap.c.o"
+  "CMakeFiles/curlu.dir/openldap.c.o.d"
+  "CMakeFiles/curlu.dir/parsedate.c.o"
+  "CMakeFiles/curlu.dir/parsedate.c.o.d"
+  "CMakeFiles/curlu.dir/pingpong.c.o"
+  "CMakeFiles/curlu.dir/pingpong.c.o.d"
+  "CMakeFiles/curlu.dir/pop3.c.o"
+  "CMakeFiles/curlu.dir/pop3.c.o.d"
+  "CMakeFiles/curlu.dir/progress.c.o"
+  "CMakeFiles/curlu.dir/progress.c.o.d"
+  "CMakeFiles/curlu.dir/psl.c.o"
+  "CMakeFiles/curlu.dir/psl.c.o.d"
+  "CMakeFiles/curlu.dir/rand.c.o"
+  "CMakeFiles/curlu.dir/rand.c.o.d"
+  "CMakeFiles/curlu.dir/rename.c.o"
+  "CMakeFiles/curlu.dir/rename.c.o.d"
+  "CMakeFiles/curlu.dir/request.c.o"
+  "CMakeFiles/curlu.dir/request.c.o.d"
+  "CMakeFiles/curlu.dir/rtsp.c.o"
+  "CMakeFiles/curlu.dir/rtsp.c.o.d"
+  "CMakeFiles/curlu.dir/select.c.o"
+  "CMakeFiles/curlu.dir/select.c.o.d"
+  "CMakeFiles/curlu.dir/sendf.c.o"
+  "CMakeFiles/curlu.dir/sendf.c.o.d"
+  "CMakeFiles/curlu.dir/setopt.c.o"
+  "CMakeFiles/curlu.dir/setopt.c.o.d"
+  "CMakeFiles/curlu.dir/sha256.c.o"
+  "CMakeFiles/curlu.dir/sha256.c.o.d"
+  "CMakeFiles/curlu.dir/share.c.o"
+  "CMakeFiles/curlu.dir/share.c.o.d"
+  "CMakeFiles/curlu.dir/slist.c.o"
+  "CMakeFiles/curlu.dir/slist.c.o.d"
+  "CMakeFiles/curlu.dir/smb.c.o"
+  "CMakeFiles/curlu.dir/smb.c.o.d"
+  "CMakeFiles/curlu.dir/smtp.c.o"
+  "CMakeFiles/curlu.dir/smtp.c.o.d"
+  "CMakeFiles/curlu.dir/socketpair.c.o"
+  "CMakeFiles/curlu.dir/socketpair.c.o.d"
+  "CMakeFiles/curlu.dir/socks.c.o"
+  "CMakeFiles/curlu.dir/socks.c.o.d"
+  "CMakeFiles/curlu.dir/socks_gssapi.c.o"
+  "CMakeFiles/curlu.dir/socks_gssapi.c.o.d"
+  "CMakeFiles/curlu.dir/socks_sspi.c.o"
+  "CMakeFiles/curlu.dir/socks_sspi.c.o.d"
+  "CMakeFiles/curlu.dir/speedcheck.c.o"
+  "CMakeFiles/curlu.dir/speedcheck.c.o.d"
+  "CMakeFiles/curlu.dir/splay.c.o"
+  "CMakeFiles/curlu.dir/splay.c.o.d"
+  "CMakeFiles/curlu.dir/strcase.c.o"
+  "CMakeFiles/curlu.dir/strcase.c.o.d"
+  "CMakeFiles/curlu.dir/strdup.c.o"
+  "CMakeFiles/curlu.dir/strdup.c.o.d"
+  "CMakeFiles/curlu.dir/strequal.c.o"
+  "CMakeFiles/curlu.dir/strequal.c.o.d"
+  "CMakeFiles/curlu.dir/strerror.c.o"
+  "CMakeFiles/curlu.dir/strerror.c.o.d"
+  "CMakeFiles/curlu.dir/system_win32.c.o"
+  "CMakeFiles/curlu.dir/system_win32.c.o.d"
+  "CMakeFiles/curlu.dir/telnet.c.o"
+  "CMakeFiles/curlu.dir/telnet.c.o.d"
+  "CMakeFiles/curlu.dir/tftp.c.o"
+  "CMakeFiles/curlu.dir/tftp.c.o.d"
+  "CMakeFiles/curlu.dir/thrdpool.c.o"
+  "CMakeFiles/curlu.dir/thrdpool.c.o.d"
+  "CMakeFiles/curlu.dir/timewheel.c.o"
+  "CMakeFiles/curlu.dir/timewheel.c.o.d"
+  "CMakeFiles/curlu.dir/transfer.c.o"
+  "CMakeFiles/curlu.dir/transfer.c.o.d"
+  "CMakeFiles/curlu.dir/uint-bset.c.o"
+  "CMakeFiles/curlu.dir/uint-bset.c.o.d"
+  "CMakeFiles/curlu.dir/uint-hash.c.o"
+  "CMakeFiles/curlu.dir/uint-hash.c.o.d"
+  "CMakeFiles/curlu.dir/uint-spbset.c.o"
+  "CMakeFiles/curlu.dir/uint-spbset.c.o.d"
+  "CMakeFiles/curlu.dir/uint-table.c.o"
+  "CMakeFiles/curlu.dir/uint-table.c.o.d"
+  "CMakeFiles/curlu.dir/uring.c.o"
+  "CMakeFiles/curlu.dir/uring.c.o.d"
+  "CMakeFiles/curlu.dir/url.c.o"
+  "CMakeFiles/curlu.dir/url.c.o.d"
+  "CMakeFiles/curlu.dir/urlapi.c.o"
+  "CMakeFiles/curlu.dir/urlapi.c.o.d"
+  "CMakeFiles/curlu.dir/vauth/cleartext.c.o"
+  "CMakeFiles/curlu.dir/vauth/cleartext.c.o.d"
+  "CMakeFiles/curlu.dir/vauth/cram.c.o"
+  "CMakeFiles/curlu.dir/vauth/cram.c.o.d"
+  "CMakeFiles/curlu.dir/vauth/digest.c.o"
+  "CMakeFiles/curlu.dir/vauth/digest.c.o.d"
+  "CMakeFiles/curlu.dir/vauth/digest_sspi.c.o"
+  "CMakeFiles/curlu.dir/vauth/digest_sspi.c.o.d"
+  "CMakeFiles/curlu.dir/vauth/gsasl.c.o"
+  "CMakeFiles/curlu.dir/vauth/gsasl.c.o.d"
+  "CMakeFiles/curlu.dir/vauth/krb5_gssapi.c.o"
+  "CMakeFiles/curlu.dir/vauth/krb5_gssapi.c.o.d"
+  "CMakeFiles/curlu.dir/vauth/krb5_sspi.c.o"
+  "CMakeFiles/curlu.dir/vauth/krb5_sspi.c.o.d"
+  "CMakeFiles/curlu.dir/vauth/ntlm.c.o"
+  "CMakeFiles/curlu.dir/vauth/ntlm.c.o.d"
+  "CMakeFiles/curlu.dir/vauth/ntlm_sspi.c.o"
+  "CMakeFiles/curlu.dir/vauth/ntlm_sspi.c.o.d"
+  "CMakeFiles/curlu.dir/vauth/oauth2.c.o"
+  "CMakeFiles/curlu.dir/vauth/oauth2.c.o.d"
+  "CMakeFiles/curlu.dir/vauth/spnego_gssapi.c.o"
+  "CMakeFiles/curlu.dir/vauth/spnego_gssapi.c.o.d"
+  "CMakeFiles/curlu.dir/vauth/spnego_sspi.c.o"
+  "CMakeFiles/curlu.dir/vauth/spnego_sspi.c.o.d"
+  "CMakeFiles/curlu.dir/vauth/vauth.c.o"
+  "CMakeFiles/curlu.dir/vauth/vauth.c.o.d"
+  "CMakeFiles/curlu.dir/version.c.o"
+  "CMakeFiles/curlu.dir/version.c.o.d"
+  "CMakeFiles/curlu.dir/vquic/curl_ngtcp2.c.o"
+  "CMakeFiles/curlu.dir/vquic/curl_ngtcp2.c.o.d"
+  "CMakeFiles/curlu.dir/vquic/curl_osslq.c.o"
+  "CMakeFiles/curlu.dir/vquic/curl_osslq.c.o.d"
+  "CMakeFiles/curlu.dir/vquic/curl_quiche.c.o"
+  "CMakeFiles/curlu.dir/vquic/curl_quiche.c.o.d"
+  "CMakeFiles/curlu.dir/vquic/vquic-tls.c.o"
+  "CMakeFiles/curlu.dir/vquic/vquic-tls.c.o.d"
+  "CMakeFiles/curlu.dir/vquic/vquic.c.o"
+  "CMakeFiles/curlu.dir/vquic/vquic.c.o.d"
+  "CMakeFiles/curlu.dir/vssh/curl_path.c.o"
+  "CMakeFiles/curlu.dir/vssh/curl_path.c.o.d"
+  "CMakeFiles/curlu.dir/vssh/libssh.c.o"
+  "CMakeFiles/curlu.dir/vssh/libssh.c.o.d"
+  "CMakeFiles/curlu.dir/vssh/libssh2.c.o"
+  "CMakeFiles/curlu.dir/vssh/libssh2.c.o.d"
+  "CMakeFiles/curlu.dir/vssh/wolfssh.c.o"
+  "CMakeFiles/curlu.dir/vssh/wolfssh.c.o.d"
+  "CMakeFiles/curlu.dir/vtls/cipher_suite.c.o"
+  "CMakeFiles/curlu.dir/vtls/cipher_suite.c.o.d"
+  "CMakeFiles/curlu.dir/vtls/gtls.c.o"
+  "CMakeFiles/curlu.dir/vtls/gtls.c.o.d"
+  "CMakeFiles/curlu.dir/vtls/hostcheck.c.o"
+  "CMakeFiles/curlu.dir/vtls/hostcheck.c.o.d"
+  "CMakeFiles/curlu.dir/vtls/keylog.c.o"
+  "CMakeFiles/curlu.dir/vtls/keylog.c.o.d"
+  "CMakeFiles/curlu.dir/vtls/mbedtls.c.o"
+  "CMakeFiles/curlu.dir/vtls/mbedtls.c.o.d"
+  "CMakeFiles/curlu.dir/vtls/mbedtls_threadlock.c.o"
+  "CMakeFiles/curlu.dir/vtls/mbedtls_threadlock.c.o.d"
+  "CMakeFiles/curlu.dir/vtls/openssl.c.o"
+  "CMakeFiles/curlu.dir/vtls/openssl.c.o.d"
+  "CMakeFiles/curlu.dir/vtls/rustls.c.o"
+  "CMakeFiles/curlu.dir/vtls/rustls.c.o.d"
+  "CMakeFiles/curlu.dir/vtls/schannel.c.o"
+  "CMakeFiles/curlu.dir/vtls/schannel.c.o.d"
+  "CMakeFiles/curlu.dir/vtls/schannel_verify.c.o"
+  "CMakeFiles/curlu.dir/vtls/schannel_verify.c.o.d"
+  "CMakeFiles/curlu.dir/vtls/vtls.c.o"
+  "CMakeFiles/curlu.dir/vtls/vtls.c.o.d"
+  "CMakeFiles/curlu.dir/vtls/vtls_scache.c.o"
+  "CMakeFiles/curlu.dir/vtls/vtls_scache.c.o.d"
+  "CMakeFiles/curlu.dir/vtls/vtls_spack.c.o"
+  "CMakeFiles/curlu.dir/vtls/vtls_spack.c.o.d"
+  "CMakeFiles/curlu.dir/vtls/wolfssl.c.o"
+  "CMakeFiles/curlu.dir/vtls/wolfssl.c.o.d"
+  "CMakeFiles/curlu.dir/vtls/x509asn1.c.o"
+  "CMakeFiles/curlu.dir/vtls/x509asn1.c.o.d"
+  "CMakeFiles/curlu.dir/ws.c.o"
+  "CMakeFiles/curlu.dir/ws.c.o.d"
+  "libcurlu.a"
+  "libcurlu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curlu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
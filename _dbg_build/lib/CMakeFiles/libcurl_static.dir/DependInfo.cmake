@@ -0,0 +1,200 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/altsvc.c" "lib/CMakeFiles/libcurl_static.dir/altsvc.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/altsvc.c.o.d"
+  "/root/repo/lib/amigaos.c" "lib/CMakeFiles/libcurl_static.dir/amigaos.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/amigaos.c.o.d"
+  "/root/repo/lib/asyn-ares.c" "lib/CMakeFiles/libcurl_static.dir/asyn-ares.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/asyn-ares.c.o.d"
+  "/root/repo/lib/asyn-base.c" "lib/CMakeFiles/libcurl_static.dir/asyn-base.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/asyn-base.c.o.d"
+  "/root/repo/lib/asyn-thrdd.c" "lib/CMakeFiles/libcurl_static.dir/asyn-thrdd.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/asyn-thrdd.c.o.d"
+  "/root/repo/lib/bufq.c" "lib/CMakeFiles/libcurl_static.dir/bufq.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/bufq.c.o.d"
+  "/root/repo/lib/bufref.c" "lib/CMakeFiles/libcurl_static.dir/bufref.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/bufref.c.o.d"
+  "/root/repo/lib/cf-h1-proxy.c" "lib/CMakeFiles/libcurl_static.dir/cf-h1-proxy.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/cf-h1-proxy.c.o.d"
+  "/root/repo/lib/cf-h2-proxy.c" "lib/CMakeFiles/libcurl_static.dir/cf-h2-proxy.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/cf-h2-proxy.c.o.d"
+  "/root/repo/lib/cf-haproxy.c" "lib/CMakeFiles/libcurl_static.dir/cf-haproxy.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/cf-haproxy.c.o.d"
+  "/root/repo/lib/cf-https-connect.c" "lib/CMakeFiles/libcurl_static.dir/cf-https-connect.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/cf-https-connect.c.o.d"
+  "/root/repo/lib/cf-ip-happy.c" "lib/CMakeFiles/libcurl_static.dir/cf-ip-happy.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/cf-ip-happy.c.o.d"
+  "/root/repo/lib/cf-socket.c" "lib/CMakeFiles/libcurl_static.dir/cf-socket.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/cf-socket.c.o.d"
+  "/root/repo/lib/cfilters.c" "lib/CMakeFiles/libcurl_static.dir/cfilters.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/cfilters.c.o.d"
+  "/root/repo/lib/conncache.c" "lib/CMakeFiles/libcurl_static.dir/conncache.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/conncache.c.o.d"
+  "/root/repo/lib/connect.c" "lib/CMakeFiles/libcurl_static.dir/connect.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/connect.c.o.d"
+  "/root/repo/lib/content_encoding.c" "lib/CMakeFiles/libcurl_static.dir/content_encoding.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/content_encoding.c.o.d"
+  "/root/repo/lib/cookie.c" "lib/CMakeFiles/libcurl_static.dir/cookie.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/cookie.c.o.d"
+  "/root/repo/lib/cshutdn.c" "lib/CMakeFiles/libcurl_static.dir/cshutdn.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/cshutdn.c.o.d"
+  "/root/repo/lib/curl_addrinfo.c" "lib/CMakeFiles/libcurl_static.dir/curl_addrinfo.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/curl_addrinfo.c.o.d"
+  "/root/repo/lib/curl_des.c" "lib/CMakeFiles/libcurl_static.dir/curl_des.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/curl_des.c.o.d"
+  "/root/repo/lib/curl_endian.c" "lib/CMakeFiles/libcurl_static.dir/curl_endian.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/curl_endian.c.o.d"
+  "/root/repo/lib/curl_fnmatch.c" "lib/CMakeFiles/libcurl_static.dir/curl_fnmatch.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/curl_fnmatch.c.o.d"
+  "/root/repo/lib/curl_get_line.c" "lib/CMakeFiles/libcurl_static.dir/curl_get_line.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/curl_get_line.c.o.d"
+  "/root/repo/lib/curl_gethostname.c" "lib/CMakeFiles/libcurl_static.dir/curl_gethostname.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/curl_gethostname.c.o.d"
+  "/root/repo/lib/curl_gssapi.c" "lib/CMakeFiles/libcurl_static.dir/curl_gssapi.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/curl_gssapi.c.o.d"
+  "/root/repo/lib/curl_memrchr.c" "lib/CMakeFiles/libcurl_static.dir/curl_memrchr.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/curl_memrchr.c.o.d"
+  "/root/repo/lib/curl_ntlm_core.c" "lib/CMakeFiles/libcurl_static.dir/curl_ntlm_core.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/curl_ntlm_core.c.o.d"
+  "/root/repo/lib/curl_range.c" "lib/CMakeFiles/libcurl_static.dir/curl_range.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/curl_range.c.o.d"
+  "/root/repo/lib/curl_rtmp.c" "lib/CMakeFiles/libcurl_static.dir/curl_rtmp.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/curl_rtmp.c.o.d"
+  "/root/repo/lib/curl_sasl.c" "lib/CMakeFiles/libcurl_static.dir/curl_sasl.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/curl_sasl.c.o.d"
+  "/root/repo/lib/curl_sha512_256.c" "lib/CMakeFiles/libcurl_static.dir/curl_sha512_256.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/curl_sha512_256.c.o.d"
+  "/root/repo/lib/curl_sspi.c" "lib/CMakeFiles/libcurl_static.dir/curl_sspi.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/curl_sspi.c.o.d"
+  "/root/repo/lib/curl_threads.c" "lib/CMakeFiles/libcurl_static.dir/curl_threads.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/curl_threads.c.o.d"
+  "/root/repo/lib/curl_trc.c" "lib/CMakeFiles/libcurl_static.dir/curl_trc.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/curl_trc.c.o.d"
+  "/root/repo/lib/curlx/base64.c" "lib/CMakeFiles/libcurl_static.dir/curlx/base64.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/curlx/base64.c.o.d"
+  "/root/repo/lib/curlx/dynbuf.c" "lib/CMakeFiles/libcurl_static.dir/curlx/dynbuf.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/curlx/dynbuf.c.o.d"
+  "/root/repo/lib/curlx/inet_ntop.c" "lib/CMakeFiles/libcurl_static.dir/curlx/inet_ntop.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/curlx/inet_ntop.c.o.d"
+  "/root/repo/lib/curlx/inet_pton.c" "lib/CMakeFiles/libcurl_static.dir/curlx/inet_pton.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/curlx/inet_pton.c.o.d"
+  "/root/repo/lib/curlx/multibyte.c" "lib/CMakeFiles/libcurl_static.dir/curlx/multibyte.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/curlx/multibyte.c.o.d"
+  "/root/repo/lib/curlx/nonblock.c" "lib/CMakeFiles/libcurl_static.dir/curlx/nonblock.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/curlx/nonblock.c.o.d"
+  "/root/repo/lib/curlx/strparse.c" "lib/CMakeFiles/libcurl_static.dir/curlx/strparse.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/curlx/strparse.c.o.d"
+  "/root/repo/lib/curlx/timediff.c" "lib/CMakeFiles/libcurl_static.dir/curlx/timediff.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/curlx/timediff.c.o.d"
+  "/root/repo/lib/curlx/timeval.c" "lib/CMakeFiles/libcurl_static.dir/curlx/timeval.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/curlx/timeval.c.o.d"
+  "/root/repo/lib/curlx/version_win32.c" "lib/CMakeFiles/libcurl_static.dir/curlx/version_win32.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/curlx/version_win32.c.o.d"
+  "/root/repo/lib/curlx/wait.c" "lib/CMakeFiles/libcurl_static.dir/curlx/wait.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/curlx/wait.c.o.d"
+  "/root/repo/lib/curlx/warnless.c" "lib/CMakeFiles/libcurl_static.dir/curlx/warnless.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/curlx/warnless.c.o.d"
+  "/root/repo/lib/curlx/winapi.c" "lib/CMakeFiles/libcurl_static.dir/curlx/winapi.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/curlx/winapi.c.o.d"
+  "/root/repo/lib/cw-out.c" "lib/CMakeFiles/libcurl_static.dir/cw-out.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/cw-out.c.o.d"
+  "/root/repo/lib/cw-pause.c" "lib/CMakeFiles/libcurl_static.dir/cw-pause.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/cw-pause.c.o.d"
+  "/root/repo/lib/dict.c" "lib/CMakeFiles/libcurl_static.dir/dict.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/dict.c.o.d"
+  "/root/repo/lib/doh.c" "lib/CMakeFiles/libcurl_static.dir/doh.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/doh.c.o.d"
+  "/root/repo/lib/dynhds.c" "lib/CMakeFiles/libcurl_static.dir/dynhds.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/dynhds.c.o.d"
+  "/root/repo/lib/easy.c" "lib/CMakeFiles/libcurl_static.dir/easy.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/easy.c.o.d"
+  "/root/repo/lib/easygetopt.c" "lib/CMakeFiles/libcurl_static.dir/easygetopt.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/easygetopt.c.o.d"
+  "/root/repo/lib/easyoptions.c" "lib/CMakeFiles/libcurl_static.dir/easyoptions.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/easyoptions.c.o.d"
+  "/root/repo/lib/escape.c" "lib/CMakeFiles/libcurl_static.dir/escape.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/escape.c.o.d"
+  "/root/repo/lib/fake_addrinfo.c" "lib/CMakeFiles/libcurl_static.dir/fake_addrinfo.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/fake_addrinfo.c.o.d"
+  "/root/repo/lib/file.c" "lib/CMakeFiles/libcurl_static.dir/file.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/file.c.o.d"
+  "/root/repo/lib/fileinfo.c" "lib/CMakeFiles/libcurl_static.dir/fileinfo.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/fileinfo.c.o.d"
+  "/root/repo/lib/fopen.c" "lib/CMakeFiles/libcurl_static.dir/fopen.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/fopen.c.o.d"
+  "/root/repo/lib/formdata.c" "lib/CMakeFiles/libcurl_static.dir/formdata.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/formdata.c.o.d"
+  "/root/repo/lib/ftp.c" "lib/CMakeFiles/libcurl_static.dir/ftp.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/ftp.c.o.d"
+  "/root/repo/lib/ftplistparser.c" "lib/CMakeFiles/libcurl_static.dir/ftplistparser.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/ftplistparser.c.o.d"
+  "/root/repo/lib/getenv.c" "lib/CMakeFiles/libcurl_static.dir/getenv.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/getenv.c.o.d"
+  "/root/repo/lib/getinfo.c" "lib/CMakeFiles/libcurl_static.dir/getinfo.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/getinfo.c.o.d"
+  "/root/repo/lib/gopher.c" "lib/CMakeFiles/libcurl_static.dir/gopher.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/gopher.c.o.d"
+  "/root/repo/lib/hash.c" "lib/CMakeFiles/libcurl_static.dir/hash.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/hash.c.o.d"
+  "/root/repo/lib/headers.c" "lib/CMakeFiles/libcurl_static.dir/headers.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/headers.c.o.d"
+  "/root/repo/lib/hmac.c" "lib/CMakeFiles/libcurl_static.dir/hmac.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/hmac.c.o.d"
+  "/root/repo/lib/hostip.c" "lib/CMakeFiles/libcurl_static.dir/hostip.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/hostip.c.o.d"
+  "/root/repo/lib/hostip4.c" "lib/CMakeFiles/libcurl_static.dir/hostip4.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/hostip4.c.o.d"
+  "/root/repo/lib/hostip6.c" "lib/CMakeFiles/libcurl_static.dir/hostip6.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/hostip6.c.o.d"
+  "/root/repo/lib/hsts.c" "lib/CMakeFiles/libcurl_static.dir/hsts.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/hsts.c.o.d"
+  "/root/repo/lib/http.c" "lib/CMakeFiles/libcurl_static.dir/http.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/http.c.o.d"
+  "/root/repo/lib/http1.c" "lib/CMakeFiles/libcurl_static.dir/http1.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/http1.c.o.d"
+  "/root/repo/lib/http2.c" "lib/CMakeFiles/libcurl_static.dir/http2.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/http2.c.o.d"
+  "/root/repo/lib/http_aws_sigv4.c" "lib/CMakeFiles/libcurl_static.dir/http_aws_sigv4.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/http_aws_sigv4.c.o.d"
+  "/root/repo/lib/http_chunks.c" "lib/CMakeFiles/libcurl_static.dir/http_chunks.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/http_chunks.c.o.d"
+  "/root/repo/lib/http_digest.c" "lib/CMakeFiles/libcurl_static.dir/http_digest.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/http_digest.c.o.d"
+  "/root/repo/lib/http_negotiate.c" "lib/CMakeFiles/libcurl_static.dir/http_negotiate.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/http_negotiate.c.o.d"
+  "/root/repo/lib/http_ntlm.c" "lib/CMakeFiles/libcurl_static.dir/http_ntlm.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/http_ntlm.c.o.d"
+  "/root/repo/lib/http_prio.c" "lib/CMakeFiles/libcurl_static.dir/http_prio.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/http_prio.c.o.d"
+  "/root/repo/lib/http_proxy.c" "lib/CMakeFiles/libcurl_static.dir/http_proxy.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/http_proxy.c.o.d"
+  "/root/repo/lib/httpsrr.c" "lib/CMakeFiles/libcurl_static.dir/httpsrr.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/httpsrr.c.o.d"
+  "/root/repo/lib/idn.c" "lib/CMakeFiles/libcurl_static.dir/idn.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/idn.c.o.d"
+  "/root/repo/lib/if2ip.c" "lib/CMakeFiles/libcurl_static.dir/if2ip.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/if2ip.c.o.d"
+  "/root/repo/lib/imap.c" "lib/CMakeFiles/libcurl_static.dir/imap.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/imap.c.o.d"
+  "/root/repo/lib/krb5.c" "lib/CMakeFiles/libcurl_static.dir/krb5.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/krb5.c.o.d"
+  "/root/repo/lib/ldap.c" "lib/CMakeFiles/libcurl_static.dir/ldap.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/ldap.c.o.d"
+  "/root/repo/lib/llist.c" "lib/CMakeFiles/libcurl_static.dir/llist.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/llist.c.o.d"
+  "/root/repo/lib/macos.c" "lib/CMakeFiles/libcurl_static.dir/macos.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/macos.c.o.d"
+  "/root/repo/lib/md4.c" "lib/CMakeFiles/libcurl_static.dir/md4.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/md4.c.o.d"
+  "/root/repo/lib/md5.c" "lib/CMakeFiles/libcurl_static.dir/md5.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/md5.c.o.d"
+  "/root/repo/lib/memdebug.c" "lib/CMakeFiles/libcurl_static.dir/memdebug.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/memdebug.c.o.d"
+  "/root/repo/lib/mime.c" "lib/CMakeFiles/libcurl_static.dir/mime.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/mime.c.o.d"
+  "/root/repo/lib/mprintf.c" "lib/CMakeFiles/libcurl_static.dir/mprintf.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/mprintf.c.o.d"
+  "/root/repo/lib/mqtt.c" "lib/CMakeFiles/libcurl_static.dir/mqtt.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/mqtt.c.o.d"
+  "/root/repo/lib/multi.c" "lib/CMakeFiles/libcurl_static.dir/multi.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/multi.c.o.d"
+  "/root/repo/lib/multi_ev.c" "lib/CMakeFiles/libcurl_static.dir/multi_ev.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/multi_ev.c.o.d"
+  "/root/repo/lib/netrc.c" "lib/CMakeFiles/libcurl_static.dir/netrc.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/netrc.c.o.d"
+  "/root/repo/lib/noproxy.c" "lib/CMakeFiles/libcurl_static.dir/noproxy.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/noproxy.c.o.d"
+  "/root/repo/lib/openldap.c" "lib/CMakeFiles/libcurl_static.dir/openldap.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/openldap.c.o.d"
+  "/root/repo/lib/parsedate.c" "lib/CMakeFiles/libcurl_static.dir/parsedate.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/parsedate.c.o.d"
+  "/root/repo/lib/pingpong.c" "lib/CMakeFiles/libcurl_static.dir/pingpong.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/pingpong.c.o.d"
+  "/root/repo/lib/pop3.c" "lib/CMakeFiles/libcurl_static.dir/pop3.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/pop3.c.o.d"
+  "/root/repo/lib/progress.c" "lib/CMakeFiles/libcurl_static.dir/progress.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/progress.c.o.d"
+  "/root/repo/lib/psl.c" "lib/CMakeFiles/libcurl_static.dir/psl.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/psl.c.o.d"
+  "/root/repo/lib/rand.c" "lib/CMakeFiles/libcurl_static.dir/rand.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/rand.c.o.d"
+  "/root/repo/lib/rename.c" "lib/CMakeFiles/libcurl_static.dir/rename.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/rename.c.o.d"
+  "/root/repo/lib/request.c" "lib/CMakeFiles/libcurl_static.dir/request.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/request.c.o.d"
+  "/root/repo/lib/rtsp.c" "lib/CMakeFiles/libcurl_static.dir/rtsp.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/rtsp.c.o.d"
+  "/root/repo/lib/select.c" "lib/CMakeFiles/libcurl_static.dir/select.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/select.c.o.d"
+  "/root/repo/lib/sendf.c" "lib/CMakeFiles/libcurl_static.dir/sendf.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/sendf.c.o.d"
+  "/root/repo/lib/setopt.c" "lib/CMakeFiles/libcurl_static.dir/setopt.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/setopt.c.o.d"
+  "/root/repo/lib/sha256.c" "lib/CMakeFiles/libcurl_static.dir/sha256.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/sha256.c.o.d"
+  "/root/repo/lib/share.c" "lib/CMakeFiles/libcurl_static.dir/share.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/share.c.o.d"
+  "/root/repo/lib/slist.c" "lib/CMakeFiles/libcurl_static.dir/slist.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/slist.c.o.d"
+  "/root/repo/lib/smb.c" "lib/CMakeFiles/libcurl_static.dir/smb.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/smb.c.o.d"
+  "/root/repo/lib/smtp.c" "lib/CMakeFiles/libcurl_static.dir/smtp.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/smtp.c.o.d"
+  "/root/repo/lib/socketpair.c" "lib/CMakeFiles/libcurl_static.dir/socketpair.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/socketpair.c.o.d"
+  "/root/repo/lib/socks.c" "lib/CMakeFiles/libcurl_static.dir/socks.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/socks.c.o.d"
+  "/root/repo/lib/socks_gssapi.c" "lib/CMakeFiles/libcurl_static.dir/socks_gssapi.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/socks_gssapi.c.o.d"
+  "/root/repo/lib/socks_sspi.c" "lib/CMakeFiles/libcurl_static.dir/socks_sspi.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/socks_sspi.c.o.d"
+  "/root/repo/lib/speedcheck.c" "lib/CMakeFiles/libcurl_static.dir/speedcheck.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/speedcheck.c.o.d"
+  "/root/repo/lib/splay.c" "lib/CMakeFiles/libcurl_static.dir/splay.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/splay.c.o.d"
+  "/root/repo/lib/strcase.c" "lib/CMakeFiles/libcurl_static.dir/strcase.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/strcase.c.o.d"
+  "/root/repo/lib/strdup.c" "lib/CMakeFiles/libcurl_static.dir/strdup.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/strdup.c.o.d"
+  "/root/repo/lib/strequal.c" "lib/CMakeFiles/libcurl_static.dir/strequal.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/strequal.c.o.d"
+  "/root/repo/lib/strerror.c" "lib/CMakeFiles/libcurl_static.dir/strerror.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/strerror.c.o.d"
+  "/root/repo/lib/system_win32.c" "lib/CMakeFiles/libcurl_static.dir/system_win32.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/system_win32.c.o.d"
+  "/root/repo/lib/telnet.c" "lib/CMakeFiles/libcurl_static.dir/telnet.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/telnet.c.o.d"
+  "/root/repo/lib/tftp.c" "lib/CMakeFiles/libcurl_static.dir/tftp.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/tftp.c.o.d"
+  "/root/repo/lib/thrdpool.c" "lib/CMakeFiles/libcurl_static.dir/thrdpool.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/thrdpool.c.o.d"
+  "/root/repo/lib/timewheel.c" "lib/CMakeFiles/libcurl_static.dir/timewheel.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/timewheel.c.o.d"
+  "/root/repo/lib/transfer.c" "lib/CMakeFiles/libcurl_static.dir/transfer.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/transfer.c.o.d"
+  "/root/repo/lib/uint-bset.c" "lib/CMakeFiles/libcurl_static.dir/uint-bset.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/uint-bset.c.o.d"
+  "/root/repo/lib/uint-hash.c" "lib/CMakeFiles/libcurl_static.dir/uint-hash.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/uint-hash.c.o.d"
+  "/root/repo/lib/uint-spbset.c" "lib/CMakeFiles/libcurl_static.dir/uint-spbset.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/uint-spbset.c.o.d"
+  "/root/repo/lib/uint-table.c" "lib/CMakeFiles/libcurl_static.dir/uint-table.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/uint-table.c.o.d"
+  "/root/repo/lib/uring.c" "lib/CMakeFiles/libcurl_static.dir/uring.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/uring.c.o.d"
+  "/root/repo/lib/url.c" "lib/CMakeFiles/libcurl_static.dir/url.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/url.c.o.d"
+  "/root/repo/lib/urlapi.c" "lib/CMakeFiles/libcurl_static.dir/urlapi.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/urlapi.c.o.d"
+  "/root/repo/lib/vauth/cleartext.c" "lib/CMakeFiles/libcurl_static.dir/vauth/cleartext.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/vauth/cleartext.c.o.d"
+  "/root/repo/lib/vauth/cram.c" "lib/CMakeFiles/libcurl_static.dir/vauth/cram.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/vauth/cram.c.o.d"
+  "/root/repo/lib/vauth/digest.c" "lib/CMakeFiles/libcurl_static.dir/vauth/digest.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/vauth/digest.c.o.d"
+  "/root/repo/lib/vauth/digest_sspi.c" "lib/CMakeFiles/libcurl_static.dir/vauth/digest_sspi.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/vauth/digest_sspi.c.o.d"
+  "/root/repo/lib/vauth/gsasl.c" "lib/CMakeFiles/libcurl_static.dir/vauth/gsasl.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/vauth/gsasl.c.o.d"
+  "/root/repo/lib/vauth/krb5_gssapi.c" "lib/CMakeFiles/libcurl_static.dir/vauth/krb5_gssapi.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/vauth/krb5_gssapi.c.o.d"
+  "/root/repo/lib/vauth/krb5_sspi.c" "lib/CMakeFiles/libcurl_static.dir/vauth/krb5_sspi.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/vauth/krb5_sspi.c.o.d"
+  "/root/repo/lib/vauth/ntlm.c" "lib/CMakeFiles/libcurl_static.dir/vauth/ntlm.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/vauth/ntlm.c.o.d"
+  "/root/repo/lib/vauth/ntlm_sspi.c" "lib/CMakeFiles/libcurl_static.dir/vauth/ntlm_sspi.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/vauth/ntlm_sspi.c.o.d"
+  "/root/repo/lib/vauth/oauth2.c" "lib/CMakeFiles/libcurl_static.dir/vauth/oauth2.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/vauth/oauth2.c.o.d"
+  "/root/repo/lib/vauth/spnego_gssapi.c" "lib/CMakeFiles/libcurl_static.dir/vauth/spnego_gssapi.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/vauth/spnego_gssapi.c.o.d"
+  "/root/repo/lib/vauth/spnego_sspi.c" "lib/CMakeFiles/libcurl_static.dir/vauth/spnego_sspi.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/vauth/spnego_sspi.c.o.d"
+  "/root/repo/lib/vauth/vauth.c" "lib/CMakeFiles/libcurl_static.dir/vauth/vauth.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/vauth/vauth.c.o.d"
+  "/root/repo/lib/version.c" "lib/CMakeFiles/libcurl_static.dir/version.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/version.c.o.d"
+  "/root/repo/lib/vquic/curl_ngtcp2.c" "lib/CMakeFiles/libcurl_static.dir/vquic/curl_ngtcp2.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/vquic/curl_ngtcp2.c.o.d"
+  "/root/repo/lib/vquic/curl_osslq.c" "lib/CMakeFiles/libcurl_static.dir/vquic/curl_osslq.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/vquic/curl_osslq.c.o.d"
+  "/root/repo/lib/vquic/curl_quiche.c" "lib/CMakeFiles/libcurl_static.dir/vquic/curl_quiche.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/vquic/curl_quiche.c.o.d"
+  "/root/repo/lib/vquic/vquic-tls.c" "lib/CMakeFiles/libcurl_static.dir/vquic/vquic-tls.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/vquic/vquic-tls.c.o.d"
+  "/root/repo/lib/vquic/vquic.c" "lib/CMakeFiles/libcurl_static.dir/vquic/vquic.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/vquic/vquic.c.o.d"
+  "/root/repo/lib/vssh/curl_path.c" "lib/CMakeFiles/libcurl_static.dir/vssh/curl_path.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/vssh/curl_path.c.o.d"
+  "/root/repo/lib/vssh/libssh.c" "lib/CMakeFiles/libcurl_static.dir/vssh/libssh.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/vssh/libssh.c.o.d"
+  "/root/repo/lib/vssh/libssh2.c" "lib/CMakeFiles/libcurl_static.dir/vssh/libssh2.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/vssh/libssh2.c.o.d"
+  "/root/repo/lib/vssh/wolfssh.c" "lib/CMakeFiles/libcurl_static.dir/vssh/wolfssh.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/vssh/wolfssh.c.o.d"
+  "/root/repo/lib/vtls/cipher_suite.c" "lib/CMakeFiles/libcurl_static.dir/vtls/cipher_suite.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/vtls/cipher_suite.c.o.d"
+  "/root/repo/lib/vtls/gtls.c" "lib/CMakeFiles/libcurl_static.dir/vtls/gtls.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/vtls/gtls.c.o.d"
+  "/root/repo/lib/vtls/hostcheck.c" "lib/CMakeFiles/libcurl_static.dir/vtls/hostcheck.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/vtls/hostcheck.c.o.d"
+  "/root/repo/lib/vtls/keylog.c" "lib/CMakeFiles/libcurl_static.dir/vtls/keylog.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/vtls/keylog.c.o.d"
+  "/root/repo/lib/vtls/mbedtls.c" "lib/CMakeFiles/libcurl_static.dir/vtls/mbedtls.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/vtls/mbedtls.c.o.d"
+  "/root/repo/lib/vtls/mbedtls_threadlock.c" "lib/CMakeFiles/libcurl_static.dir/vtls/mbedtls_threadlock.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/vtls/mbedtls_threadlock.c.o.d"
+  "/root/repo/lib/vtls/openssl.c" "lib/CMakeFiles/libcurl_static.dir/vtls/openssl.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/vtls/openssl.c.o.d"
+  "/root/repo/lib/vtls/rustls.c" "lib/CMakeFiles/libcurl_static.dir/vtls/rustls.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/vtls/rustls.c.o.d"
+  "/root/repo/lib/vtls/schannel.c" "lib/CMakeFiles/libcurl_static.dir/vtls/schannel.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/vtls/schannel.c.o.d"
+  "/root/repo/lib/vtls/schannel_verify.c" "lib/CMakeFiles/libcurl_static.dir/vtls/schannel_verify.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/vtls/schannel_verify.c.o.d"
+  "/root/repo/lib/vtls/vtls.c" "lib/CMakeFiles/libcurl_static.dir/vtls/vtls.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/vtls/vtls.c.o.d"
+  "/root/repo/lib/vtls/vtls_scache.c" "lib/CMakeFiles/libcurl_static.dir/vtls/vtls_scache.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/vtls/vtls_scache.c.o.d"
+  "/root/repo/lib/vtls/vtls_spack.c" "lib/CMakeFiles/libcurl_static.dir/vtls/vtls_spack.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/vtls/vtls_spack.c.o.d"
+  "/root/repo/lib/vtls/wolfssl.c" "lib/CMakeFiles/libcurl_static.dir/vtls/wolfssl.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/vtls/wolfssl.c.o.d"
+  "/root/repo/lib/vtls/x509asn1.c" "lib/CMakeFiles/libcurl_static.dir/vtls/x509asn1.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/vtls/x509asn1.c.o.d"
+  "/root/repo/lib/ws.c" "lib/CMakeFiles/libcurl_static.dir/ws.c.o" "gcc" "lib/CMakeFiles/libcurl_static.dir/ws.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,373 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libcurl_static.dir/altsvc.c.o"
+  "CMakeFiles/libcurl_static.dir/altsvc.c.o.d"
+  "CMakeFiles/libcurl_static.dir/amigaos.c.o"
+  "CMakeFiles/libcurl_static.dir/amigaos.c.o.d"
+  "CMakeFiles/libcurl_static.dir/asyn-ares.c.o"
+  "CMakeFiles/libcurl_static.dir/asyn-ares.c.o.d"
+  "CMakeFiles/libcurl_static.dir/asyn-base.c.o"
+  "CMakeFiles/libcurl_static.dir/asyn-base.c.o.d"
+  "CMakeFiles/libcurl_static.dir/asyn-thrdd.c.o"
+  "CMakeFiles/libcurl_static.dir/asyn-thrdd.c.o.d"
+  "CMakeFiles/libcurl_static.dir/bufq.c.o"
+  "CMakeFiles/libcurl_static.dir/bufq.c.o.d"
+  "CMakeFiles/libcurl_static.dir/bufref.c.o"
+  "CMakeFiles/libcurl_static.dir/bufref.c.o.d"
+  "CMakeFiles/libcurl_static.dir/cf-h1-proxy.c.o"
+  "CMakeFiles/libcurl_static.dir/cf-h1-proxy.c.o.d"
+  "CMakeFiles/libcurl_static.dir/cf-h2-proxy.c.o"
+  "CMakeFiles/libcurl_static.dir/cf-h2-proxy.c.o.d"
+  "CMakeFiles/libcurl_static.dir/cf-haproxy.c.o"
+  "CMakeFiles/libcurl_static.dir/cf-haproxy.c.o.d"
+  "CMakeFiles/libcurl_static.dir/cf-https-connect.c.o"
+  "CMakeFiles/libcurl_static.dir/cf-https-connect.c.o.d"
+  "CMakeFiles/libcurl_static.dir/cf-ip-happy.c.o"
+  "CMakeFiles/libcurl_static.dir/cf-ip-happy.c.o.d"
+  "CMakeFiles/libcurl_static.dir/cf-socket.c.o"
+  "CMakeFiles/libcurl_static.dir/cf-socket.c.o.d"
+  "CMakeFiles/libcurl_static.dir/cfilters.c.o"
+  "CMakeFiles/libcurl_static.dir/cfilters.c.o.d"
+  "CMakeFiles/libcurl_static.dir/conncache.c.o"
+  "CMakeFiles/libcurl_static.dir/conncache.c.o.d"
+  "CMakeFiles/libcurl_static.dir/connect.c.o"
+  "CMakeFiles/libcurl_static.dir/connect.c.o.d"
+  "CMakeFiles/libcurl_static.dir/content_encoding.c.o"
+  "CMakeFiles/libcurl_static.dir/content_encoding.c.o.d"
+  "CMakeFiles/libcurl_static.dir/cookie.c.o"
+  "CMakeFiles/libcurl_static.dir/cookie.c.o.d"
+  "CMakeFiles/libcurl_static.dir/cshutdn.c.o"
+  "CMakeFiles/libcurl_static.dir/cshutdn.c.o.d"
+  "CMakeFiles/libcurl_static.dir/curl_addrinfo.c.o"
+  "CMakeFiles/libcurl_static.dir/curl_addrinfo.c.o.d"
+  "CMakeFiles/libcurl_static.dir/curl_des.c.o"
+  "CMakeFiles/libcurl_static.dir/curl_des.c.o.d"
+  "CMakeFiles/libcurl_static.dir/curl_endian.c.o"
+  "CMakeFiles/libcurl_static.dir/curl_endian.c.o.d"
+  "CMakeFiles/libcurl_static.dir/curl_fnmatch.c.o"
+  "CMakeFiles/libcurl_static.dir/curl_fnmatch.c.o.d"
+  "CMakeFiles/libcurl_static.dir/curl_get_line.c.o"
+  "CMakeFiles/libcurl_static.dir/curl_get_line.c.o.d"
+  "CMakeFiles/libcurl_static.dir/curl_gethostname.c.o"
+  "CMakeFiles/libcurl_static.dir/curl_gethostname.c.o.d"
+  "CMakeFiles/libcurl_static.dir/curl_gssapi.c.o"
+  "CMakeFiles/libcurl_static.dir/curl_gssapi.c.o.d"
+  "CMakeFiles/libcurl_static.dir/curl_memrchr.c.o"
+  "CMakeFiles/libcurl_static.dir/curl_memrchr.c.o.d"
+  "CMakeFiles/libcurl_static.dir/curl_ntlm_core.c.o"
+  "CMakeFiles/libcurl_static.dir/curl_ntlm_core.c.o.d"
+  "CMakeFiles/libcurl_static.dir/curl_range.c.o"
+  "CMakeFiles/libcurl_static.dir/curl_range.c.o.d"
+  "CMakeFiles/libcurl_static.dir/curl_rtmp.c.o"
+  "CMakeFiles/libcurl_static.dir/curl_rtmp.c.o.d"
+  "CMakeFiles/libcurl_static.dir/curl_sasl.c.o"
+  "CMakeFiles/libcurl_static.dir/curl_sasl.c.o.d"
+  "CMakeFiles/libcurl_static.dir/curl_sha512_256.c.o"
+  "CMakeFiles/libcurl_static.dir/curl_sha512_256.c.o.d"
+  "CMakeFiles/libcurl_static.dir/curl_sspi.c.o"
+  "CMakeFiles/libcurl_static.dir/curl_sspi.c.o.d"
+  "CMakeFiles/libcurl_static.dir/curl_threads.c.o"
+  "CMakeFiles/libcurl_static.dir/curl_threads.c.o.d"
+  "CMakeFiles/libcurl_static.dir/curl_trc.c.o"
+  "CMakeFiles/libcurl_static.dir/curl_trc.c.o.d"
+  "CMakeFiles/libcurl_static.dir/curlx/base64.c.o"
+  "CMakeFiles/libcurl_static.dir/curlx/base64.c.o.d"
+  "CMakeFiles/libcurl_static.dir/curlx/dynbuf.c.o"
+  "CMakeFiles/libcurl_static.dir/curlx/dynbuf.c.o.d"
+  "CMakeFiles/libcurl_static.dir/curlx/inet_ntop.c.o"
+  "CMakeFiles/libcurl_static.dir/curlx/inet_ntop.c.o.d"
+  "CMakeFiles/libcurl_static.dir/curlx/inet_pton.c.o"
+  "CMakeFiles/libcurl_static.dir/curlx/inet_pton.c.o.d"
+  "CMakeFiles/libcurl_static.dir/curlx/multibyte.c.o"
+  "CMakeFiles/libcurl_static.dir/curlx/multibyte.c.o.d"
+  "CMakeFiles/libcurl_static.dir/curlx/nonblock.c.o"
+  "CMakeFiles/libcurl_static.dir/curlx/nonblock.c.o.d"
+  "CMakeFiles/libcurl_static.dir/curlx/strparse.c.o"
+  "CMakeFiles/libcurl_static.dir/curlx/strparse.c.o.d"
+  "CMakeFiles/libcurl_static.dir/curlx/timediff.c.o"
+  "CMakeFiles/libcurl_static.dir/curlx/timediff.c.o.d"
+  "CMakeFiles/libcurl_static.dir/curlx/timeval.c.o"
+  "CMakeFiles/libcurl_static.dir/curlx/timeval.c.o.d"
+  "CMakeFiles/libcurl_static.dir/curlx/version_win32.c.o"
+  "CMakeFiles/libcurl_static.dir/curlx/version_win32.c.o.d"
+  "CMakeFiles/libcurl_static.dir/curlx/wait.c.o"
+  "CMakeFiles/libcurl_static.dir/curlx/wait.c.o.d"
+  "CMakeFiles/libcurl_static.dir/curlx/warnless.c.o"
+  "CMakeFiles/libcurl_static.dir/curlx/warnless.c.o.d"
+  "CMakeFiles/libcurl_static.dir/curlx/winapi.c.o"
+  "CMakeFiles/libcurl_static.dir/curlx/winapi.c.o.d"
+  "CMakeFiles/libcurl_static.dir/cw-out.c.o"
+  "CMakeFiles/libcurl_static.dir/cw-out.c.o.d"
+  "CMakeFiles/libcurl_static.dir/cw-pause.c.o"
+  "CMakeFiles/libcurl_static.dir/cw-pause.c.o.d"
+  "CMakeFiles/libcurl_static.dir/dict.c.o"
+  "CMakeFiles/libcurl_static.dir/dict.c.o.d"
+  "CMakeFiles/libcurl_static.dir/doh.c.o"
+  "CMakeFiles/libcurl_static.dir/doh.c.o.d"
+  "CMakeFiles/libcurl_static.dir/dynhds.c.o"
+  "CMakeFiles/libcurl_static.dir/dynhds.c.o.d"
+  "CMakeFiles/libcurl_static.dir/easy.c.o"
+  "CMakeFiles/libcurl_static.dir/easy.c.o.d"
+  "CMakeFiles/libcurl_static.dir/easygetopt.c.o"
+  "CMakeFiles/libcurl_static.dir/easygetopt.c.o.d"
+  "CMakeFiles/libcurl_static.dir/easyoptions.c.o"
+  "CMakeFiles/libcurl_static.dir/easyoptions.c.o.d"
+  "CMakeFiles/libcurl_static.dir/escape.c.o"
+  "CMakeFiles/libcurl_static.dir/escape.c.o.d"
+  "CMakeFiles/libcurl_static.dir/fake_addrinfo.c.o"
+  "CMakeFiles/libcurl_static.dir/fake_addrinfo.c.o.d"
+  "CMakeFiles/libcurl_static.dir/file.c.o"
+  "CMakeFiles/libcurl_static.dir/file.c.o.d"
+  "CMakeFiles/libcurl_static.dir/fileinfo.c.o"
+  "CMakeFiles/libcurl_static.dir/fileinfo.c.o.d"
+  "CMakeFiles/libcurl_static.dir/fopen.c.o"
+  "CMakeFiles/libcurl_static.dir/fopen.c.o.d"
+  "CMakeFiles/libcurl_static.dir/formdata.c.o"
+  "CMakeFiles/libcurl_static.dir/formdata.c.o.d"
+  "CMakeFiles/libcurl_static.dir/ftp.c.o"
+  "CMakeFiles/libcurl_static.dir/ftp.c.o.d"
+  "CMakeFiles/libcurl_static.dir/ftplistparser.c.o"
+  "CMakeFiles/libcurl_static.dir/ftplistparser.c.o.d"
+  "CMakeFiles/libcurl_static.dir/getenv.c.o"
+  "CMakeFiles/libcurl_static.dir/getenv.c.o.d"
+  "CMakeFiles/libcurl_static.dir/getinfo.c.o"
+  "CMakeFiles/libcurl_static.dir/getinfo.c.o.d"
+  "CMakeFiles/libcurl_static.dir/gopher.c.o"
+  "CMakeFiles/libcurl_static.dir/gopher.c.o.d"
+  "CMakeFiles/libcurl_static.dir/hash.c.o"
+  "CMakeFiles/libcurl_static.dir/hash.c.o.d"
+  "CMakeFiles/libcurl_static.dir/headers.c.o"
+  "CMakeFiles/libcurl_static.dir/headers.c.o.d"
+  "CMakeFiles/libcurl_static.dir/hmac.c.o"
+  "CMakeFiles/libcurl_static.dir/hmac.c.o.d"
+  "CMakeFiles/libcurl_static.dir/hostip.c.o"
+  "CMakeFiles/libcurl_static.dir/hostip.c.o.d"
+  "CMakeFiles/libcurl_static.dir/hostip4.c.o"
+  "CMakeFiles/libcurl_static.dir/hostip4.c.o.d"
+  "CMakeFiles/libcurl_static.dir/hostip6.c.o"
+  "CMakeFiles/libcurl_static.dir/hostip6.c.o.d"
+  "CMakeFiles/libcurl_static.dir/hsts.c.o"
+  "CMakeFiles/libcurl_static.dir/hsts.c.o.d"
+  "CMakeFiles/libcurl_static.dir/http.c.o"
+  "CMakeFiles/libcurl_static.dir/http.c.o.d"
+  "CMakeFiles/libcurl_static.dir/http1.c.o"
+  "CMakeFiles/libcurl_static.dir/http1.c.o.d"
+  "CMakeFiles/libcurl_static.dir/http2.c.o"
+  "CMakeFiles/libcurl_static.dir/http2.c.o.d"
+  "CMakeFiles/libcurl_static.dir/http_aws_sigv4.c.o"
+  "CMakeFiles/libcurl_static.dir/http_aws_sigv4.c.o.d"
+  "CMakeFiles/libcurl_static.dir/http_chunks.c.o"
+  "CMakeFiles/libcurl_static.dir/http_chunks.c.o.d"
+  "CMakeFiles/libcurl_static.dir/http_digest.c.o"
+  "CMakeFiles/libcurl_static.dir/http_digest.c.o.d"
+  "CMakeFiles/libcurl_static.dir/http_negotiate.c.o"
+  "CMakeFiles/libcurl_static.dir/http_negotiate.c.o.d"
+  "CMakeFiles/libcurl_static.dir/http_ntlm.c.o"
+  "CMakeFiles/libcurl_static.dir/http_ntlm.c.o.d"
+  "CMakeFiles/libcurl_static.dir/http_prio.c.o"
+  "CMakeFiles/libcurl_static.dir/http_prio.c.o.d"
+  "CMakeFiles/libcurl_static.dir/http_proxy.c.o"
+  "CMakeFiles/libcurl_static.dir/http_proxy.c.o.d"
+  "CMakeFiles/libcurl_static.dir/httpsrr.c.o"
+  "CMakeFiles/libcurl_static.dir/httpsrr.c.o.d"
+  "CMakeFiles/libcurl_static.dir/idn.c.o"
+  "CMakeFiles/libcurl_static.dir/idn.c.o.d"
+  "CMakeFiles/libcurl_static.dir/if2ip.c.o"
+  "CMakeFiles/libcurl_static.dir/if2ip.c.o.d"
+  "CMakeFiles/libcurl_static.dir/imap.c.o"
+  "CMakeFiles/libcurl_static.dir/imap.c.o.d"
+  "CMakeFiles/libcurl_static.dir/krb5.c.o"
+  "CMakeFiles/libcurl_static.dir/krb5.c.o.d"
+  "CMakeFiles/libcurl_static.dir/ldap.c.o"
+  "CMakeFiles/libcurl_static.dir/ldap.c.o.d"
+  "CMakeFiles/libcurl_static.dir/llist.c.o"
+  "CMakeFiles/libcurl_static.dir/llist.c.o.d"
+  "CMakeFiles/libcurl_static.dir/macos.c.o"
+  "CMakeFiles/libcurl_static.dir/macos.c.o.d"
+  "CMakeFiles/libcurl_static.dir/md4.c.o"
+  "CMakeFiles/libcurl_static.dir/md4.c.o.d"
+  "CMakeFiles/libcurl_static.dir/md5.c.o"
+  "CMakeFiles/libcurl_static.dir/md5.c.o.d"
+  "CMakeFiles/libcurl_static.dir/memdebug.c.o"
+  "CMakeFiles/libcurl_static.dir/memdebug.c.o.d"
+  "CMakeFiles/libcurl_static.dir/mime.c.o"
+  "CMakeFiles/libcurl_static.dir/mime.c.o.d"
+  "CMakeFiles/libcurl_static.dir/mprintf.c.o"
+  "CMakeFiles/libcurl_static.dir/mprintf.c.o.d"
+  "CMakeFiles/libcurl_static.dir/mqtt.c.o"
+  "CMakeFiles/libcurl_static.dir/mqtt.c.o.d"
+  "CMakeFiles/libcurl_static.dir/multi.c.o"
+  "CMakeFiles/libcurl_static.dir/multi.c.o.d"
+  "CMakeFiles/libcurl_static.dir/multi_ev.c.o"
+  "CMakeFiles/libcurl_static.dir/multi_ev.c.o.d"
+  "CMakeFiles/libcurl_static.dir/netrc.c.o"
+  "CMakeFiles/libcurl_static.dir/netrc.c.o.d"
+  "CMakeFiles/libcurl_static.dir/noproxy.c.o"
+  "CMakeFiles/libcurl_static.dir/noproxy.c.o.d"
+  "CMakeFiles/libcurl_static.dir/openldap.c.o"
+  "CMakeFiles/libcurl_static.dir/openldap.c.o.d"
+  "CMakeFiles/libcurl_static.dir/parsedate.c.o"
+  "CMakeFiles/libcurl_static.dir/parsedate.c.o.d"
+  "CMakeFiles/libcurl_static.dir/pingpong.c.o"
+  "CMakeFiles/libcurl_static.dir/pingpong.c.o.d"
+  "CMakeFiles/libcurl_static.dir/pop3.c.o"
+  "CMakeFiles/libcurl_static.dir/pop3.c.o.d"
+  "CMakeFiles/libcurl_static.dir/progress.c.o"
+  "CMakeFiles/libcurl_static.dir/progress.c.o.d"
+  "CMakeFiles/libcurl_static.dir/psl.c.o"
+  "CMakeFiles/libcurl_static.dir/psl.c.o.d"
+  "CMakeFiles/libcurl_static.dir/rand.c.o"
+  "CMakeFiles/libcurl_static.dir/rand.c.o.d"
+  "CMakeFiles/libcurl_static.dir/rename.c.o"
+  "CMakeFiles/libcurl_static.dir/rename.c.o.d"
+  "CMakeFiles/libcurl_static.dir/request.c.o"
+  "CMakeFiles/libcurl_static.dir/request.c.o.d"
+  "CMakeFiles/libcurl_static.dir/rtsp.c.o"
+  "CMakeFiles/libcurl_static.dir/rtsp.c.o.d"
+  "CMakeFiles/libcurl_static.dir/select.c.o"
+  "CMakeFiles/libcurl_static.dir/select.c.o.d"
+  "CMakeFiles/libcurl_static.dir/sendf.c.o"
+  "CMakeFiles/libcurl_static.dir/sendf.c.o.d"
+  "CMakeFiles/libcurl_static.dir/setopt.c.o"
+  "CMakeFiles/libcurl_static.dir/setopt.c.o.d"
+  "CMakeFiles/libcurl_static.dir/sha256.c.o"
+  "CMakeFiles/libcurl_static.dir/sha256.c.o.d"
+  "CMakeFiles/libcurl_static.dir/share.c.o"
+  "CMakeFiles/libcurl_static.dir/share.c.o.d"
+  "CMakeFiles/libcurl_static.dir/slist.c.o"
+  "CMakeFiles/libcurl_static.dir/slist.c.o.d"
+  "CMakeFiles/libcurl_static.dir/smb.c.o"
+  "CMakeFiles/libcurl_static.dir/smb.c.o.d"
+  "CMakeFiles/libcurl_static.dir/smtp.c.o"
+  "CMakeFiles/libcurl_static.dir/smtp.c.o.d"
+  "CMakeFiles/libcurl_static.dir/socketpair.c.o"
+  "CMakeFiles/libcurl_static.dir/socketpair.c.o.d"
+  "CMakeFiles/libcurl_static.dir/socks.c.o"
+  "CMakeFiles/libcurl_static.dir/socks.c.o.d"
+  "CMakeFiles/libcurl_static.dir/socks_gssapi.c.o"
+  "CMakeFiles/libcurl_static.dir/socks_gssapi.c.o.d"
+  "CMakeFiles/libcurl_static.dir/socks_sspi.c.o"
+  "CMakeFiles/libcurl_static.dir/socks_sspi.c.o.d"
+  "CMakeFiles/libcurl_static.dir/speedcheck.c.o"
+  "CMakeFiles/libcurl_static.dir/speedcheck.c.o.d"
+  "CMakeFiles/libcurl_static.dir/splay.c.o"
+  "CMakeFiles/libcurl_static.dir/splay.c.o.d"
+  "CMakeFiles/libcurl_static.dir/strcase.c.o"
+  "CMakeFiles/libcurl_static.dir/strcase.c.o.d"
+  "CMakeFiles/libcurl_static.dir/strdup.c.o"
+  "CMakeFiles/libcurl_static.dir/strdup.c.o.d"
+  "CMakeFiles/libcurl_static.dir/strequal.c.o"
+  "CMakeFiles/libcurl_static.dir/strequal.c.o.d"
+  "CMakeFiles/libcurl_static.dir/strerror.c.o"
+  "CMakeFiles/libcurl_static.dir/strerror.c.o.d"
+  "CMakeFiles/libcurl_static.dir/system_win32.c.o"
+  "CMakeFiles/libcurl_static.dir/system_win32.c.o.d"
+  "CMakeFiles/libcurl_static.dir/telnet.c.o"
+  "CMakeFiles/libcurl_static.dir/telnet.c.o.d"
+  "CMakeFiles/libcurl_static.dir/tftp.c.o"
+  "CMakeFiles/libcurl_static.dir/tftp.c.o.d"
+  "CMakeFiles/libcurl_static.dir/thrdpool.c.o"
+  "CMakeFiles/libcurl_static.dir/thrdpool.c.o.d"
+  "CMakeFiles/libcurl_static.dir/timewheel.c.o"
+  "CMakeFiles/libcurl_static.dir/timewheel.c.o.d"
+  "CMakeFiles/libcurl_static.dir/transfer.c.o"
+  "CMakeFiles/libcurl_static.dir/transfer.c.o.d"
+  "CMakeFiles/libcurl_static.dir/uint-bset.c.o"
+  "CMakeFiles/libcurl_static.dir/uint-bset.c.o.d"
+  "CMakeFiles/libcurl_static.dir/uint-hash.c.o"
+  "CMakeFiles/libcurl_static.dir/uint-hash.c.o.d"
+  "CMakeFiles/libcurl_static.dir/uint-spbset.c.o"
+  "CMakeFiles/libcurl_static.dir/uint-spbset.c.o.d"
+  "CMakeFiles/libcurl_static.dir/uint-table.c.o"
+  "CMakeFiles/libcurl_static.dir/uint-table.c.o.d"
+  "CMakeFiles/libcurl_static.dir/uring.c.o"
+  "CMakeFiles/libcurl_static.dir/uring.c.o.d"
+  "CMakeFiles/libcurl_static.dir/url.c.o"
+  "CMakeFiles/libcurl_static.dir/url.c.o.d"
+  "CMakeFiles/libcurl_static.dir/urlapi.c.o"
+  "CMakeFiles/libcurl_static.dir/urlapi.c.o.d"
+  "CMakeFiles/libcurl_static.dir/vauth/cleartext.c.o"
+  "CMakeFiles/libcurl_static.dir/vauth/cleartext.c.o.d"
+  "CMakeFiles/libcurl_static.dir/vauth/cram.c.o"
+  "CMakeFiles/libcurl_static.dir/vauth/cram.c.o.d"
+  "CMakeFiles/libcurl_static.dir/vauth/digest.c.o"
+  "CMakeFiles/libcurl_static.dir/vauth/digest.c.o.d"
+  "CMakeFiles/libcurl_static.dir/vauth/digest_sspi.c.o"
+  "CMakeFiles/libcurl_static.dir/vauth/digest_sspi.c.o.d"
+  "CMakeFiles/libcurl_static.dir/vauth/gsasl.c.o"
+  "CMakeFiles/libcurl_static.dir/vauth/gsasl.c.o.d"
+  "CMakeFiles/libcurl_static.dir/vauth/krb5_gssapi.c.o"
+  "CMakeFiles/libcurl_static.dir/vauth/krb5_gssapi.c.o.d"
+  "CMakeFiles/libcurl_static.dir/vauth/krb5_sspi.c.o"
+  "CMakeFiles/libcurl_static.dir/vauth/krb5_sspi.c.o.d"
+  "CMakeFiles/libcurl_static.dir/vauth/ntlm.c.o"
+  "CMakeFiles/libcurl_static.dir/vauth/ntlm.c.o.d"
+  "CMakeFiles/libcurl_static.dir/vauth/ntlm_sspi.c.o"
+  "CMakeFiles/libcurl_static.dir/vauth/ntlm_sspi.c.o.d"
+  "CMakeFiles/libcurl_static.dir/vauth/oauth2.c.o"
+  "CMakeFiles/libcurl_static.dir/vauth/oauth2.c.o.d"
+  "CMakeFiles/libcurl_static.dir/vauth/spnego_gssapi.c.o"
+  "CMakeFiles/libcurl_static.dir/vauth/spnego_gssapi.c.o.d"
+  "CMakeFiles/libcurl_static.dir/vauth/spnego_sspi.c.o"
+  "CMakeFiles/libcurl_static.dir/vauth/spnego_sspi.c.o.d"
+  "CMakeFiles/libcurl_static.dir/vauth/vauth.c.o"
+  "CMakeFiles/libcurl_static.dir/vauth/vauth.c.o.d"
+  "CMakeFiles/libcurl_static.dir/version.c.o"
+  "CMakeFiles/libcurl_static.dir/version.c.o.d"
+  "CMakeFiles/libcurl_static.dir/vquic/curl_ngtcp2.c.o"
+  "CMakeFiles/libcurl_static.dir/vquic/curl_ngtcp2.c.o.d"
+  "CMakeFiles/libcurl_static.dir/vquic/curl_osslq.c.o"
+  "CMakeFiles/libcurl_static.dir/vquic/curl_osslq.c.o.d"
+  "CMakeFiles/libcurl_static.dir/vquic/curl_quiche.c.o"
+  "CMakeFiles/libcurl_static.dir/vquic/curl_quiche.c.o.d"
+  "CMakeFiles/libcurl_static.dir/vquic/vquic-tls.c.o"
+  "CMakeFiles/libcurl_static.dir/vquic/vquic-tls.c.o.d"
+  "CMakeFiles/libcurl_static.dir/vquic/vquic.c.o"
+  "CMakeFiles/libcurl_static.dir/vquic/vquic.c.o.d"
+  "CMakeFiles/libcurl_static.dir/vssh/curl_path.c.o"
+  "CMakeFiles/libcurl_static.dir/vssh/curl_path.c.o.d"
+  "CMakeFiles/libcurl_static.dir/vssh/libssh.c.o"
+  "CMakeFiles/libcurl_static.dir/vssh/libssh.c.o.d"
+  "CMakeFiles/libcurl_static.dir/vssh/libssh2.c.o"
+  "CMakeFiles/libcurl_static.dir/vssh/libssh2.c.o.d"
+  "CMakeFiles/libcurl_static.dir/vssh/wolfssh.c.o"
+  "CMakeFiles/libcurl_static.dir/vssh/wolfssh.c.o.d"
+  "CMakeFiles/libcurl_static.dir/vtls/cipher_suite.c.o"
+  "CMakeFiles/libcurl_static.dir/vtls/cipher_suite.c.o.d"
+  "CMakeFiles/libcurl_static.dir/vtls/gtls.c.o"
+  "CMakeFiles/libcurl_static.dir/vtls/gtls.c.o.d"
+  "CMakeFiles/libcurl_static.dir/vtls/hostcheck.c.o"
+  "CMakeFiles/libcurl_static.dir/vtls/hostcheck.c.o.d"
+  "CMakeFiles/libcurl_static.dir/vtls/keylog.c.o"
+  "CMakeFiles/libcurl_static.dir/vtls/keylog.c.o.d"
+  "CMakeFiles/libcurl_static.dir/vtls/mbedtls.c.o"
+  "CMakeFiles/libcurl_static.dir/vtls/mbedtls.c.o.d"
+  "CMakeFiles/libcurl_static.dir/vtls/mbedtls_threadlock.c.o"
+  "CMakeFiles/libcurl_static.dir/vtls/mbedtls_threadlock.c.o.d"
+  "CMakeFiles/libcurl_static.dir/vtls/openssl.c.o"
+  "CMakeFiles/libcurl_static.dir/vtls/openssl.c.o.d"
+  "CMakeFiles/libcurl_static.dir/vtls/rustls.c.o"
+  "CMakeFiles/libcurl_static.dir/vtls/rustls.c.o.d"
+  "CMakeFiles/libcurl_static.dir/vtls/schannel.c.o"
+  "CMakeFiles/libcurl_static.dir/vtls/schannel.c.o.d"
+  "CMakeFiles/libcurl_static.dir/vtls/schannel_verify.c.o"
+  "CMakeFiles/libcurl_static.dir/vtls/schannel_verify.c.o.d"
+  "CMakeFiles/libcurl_static.dir/vtls/vtls.c.o"
+  "CMakeFiles/libcurl_static.dir/vtls/vtls.c.o.d"
+  "CMakeFiles/libcurl_static.dir/vtls/vtls_scache.c.o"
+  "CMakeFiles/libcurl_static.dir/vtls/vtls_scache.c.o.d"
+  "CMakeFiles/libcurl_static.dir/vtls/vtls_spack.c.o"
+  "CMakeFiles/libcurl_static.dir/vtls/vtls_spack.c.o.d"
+  "CMakeFiles/libcurl_static.dir/vtls/wolfssl.c.o"
+  "CMakeFiles/libcurl_static.dir/vtls/wolfssl.c.o.d"
+  "CMakeFiles/libcurl_static.dir/vtls/x509asn1.c.o"
+  "CMakeFiles/libcurl_static.dir/vtls/x509asn1.c.o.d"
+  "CMakeFiles/libcurl_static.dir/ws.c.o"
+  "CMakeFiles/libcurl_static.dir/ws.c.o.d"
+  "libcurl.a"
+  "libcurl.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libcurl_static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,98 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl.dir/config2setopts.c.o"
+  "CMakeFiles/curl.dir/config2setopts.c.o.d"
+  "CMakeFiles/curl.dir/slist_wc.c.o"
+  "CMakeFiles/curl.dir/slist_wc.c.o.d"
+  "CMakeFiles/curl.dir/terminal.c.o"
+  "CMakeFiles/curl.dir/terminal.c.o.d"
+  "CMakeFiles/curl.dir/tool_bname.c.o"
+  "CMakeFiles/curl.dir/tool_bname.c.o.d"
+  "CMakeFiles/curl.dir/tool_cb_dbg.c.o"
+  "CMakeFiles/curl.dir/tool_cb_dbg.c.o.d"
+  "CMakeFiles/curl.dir/tool_cb_hdr.c.o"
+  "CMakeFiles/curl.dir/tool_cb_hdr.c.o.d"
+  "CMakeFiles/curl.dir/tool_cb_prg.c.o"
+  "CMakeFiles/curl.dir/tool_cb_prg.c.o.d"
+  "CMakeFiles/curl.dir/tool_cb_rea.c.o"
+  "CMakeFiles/curl.dir/tool_cb_rea.c.o.d"
+  "CMakeFiles/curl.dir/tool_cb_see.c.o"
+  "CMakeFiles/curl.dir/tool_cb_see.c.o.d"
+  "CMakeFiles/curl.dir/tool_cb_soc.c.o"
+  "CMakeFiles/curl.dir/tool_cb_soc.c.o.d"
+  "CMakeFiles/curl.dir/tool_cb_wrt.c.o"
+  "CMakeFiles/curl.dir/tool_cb_wrt.c.o.d"
+  "CMakeFiles/curl.dir/tool_cfgable.c.o"
+  "CMakeFiles/curl.dir/tool_cfgable.c.o.d"
+  "CMakeFiles/curl.dir/tool_dirhie.c.o"
+  "CMakeFiles/curl.dir/tool_dirhie.c.o.d"
+  "CMakeFiles/curl.dir/tool_doswin.c.o"
+  "CMakeFiles/curl.dir/tool_doswin.c.o.d"
+  "CMakeFiles/curl.dir/tool_easysrc.c.o"
+  "CMakeFiles/curl.dir/tool_easysrc.c.o.d"
+  "CMakeFiles/curl.dir/tool_filetime.c.o"
+  "CMakeFiles/curl.dir/tool_filetime.c.o.d"
+  "CMakeFiles/curl.dir/tool_findfile.c.o"
+  "CMakeFiles/curl.dir/tool_findfile.c.o.d"
+  "CMakeFiles/curl.dir/tool_formparse.c.o"
+  "CMakeFiles/curl.dir/tool_formparse.c.o.d"
+  "CMakeFiles/curl.dir/tool_getparam.c.o"
+  "CMakeFiles/curl.dir/tool_getparam.c.o.d"
+  "CMakeFiles/curl.dir/tool_getpass.c.o"
+  "CMakeFiles/curl.dir/tool_getpass.c.o.d"
+  "CMakeFiles/curl.dir/tool_help.c.o"
+  "CMakeFiles/curl.dir/tool_help.c.o.d"
+  "CMakeFiles/curl.dir/tool_helpers.c.o"
+  "CMakeFiles/curl.dir/tool_helpers.c.o.d"
+  "CMakeFiles/curl.dir/tool_hugehelp.c.o"
+  "CMakeFiles/curl.dir/tool_hugehelp.c.o.d"
+  "CMakeFiles/curl.dir/tool_ipfs.c.o"
+  "CMakeFiles/curl.dir/tool_ipfs.c.o.d"
+  "CMakeFiles/curl.dir/tool_libinfo.c.o"
+  "CMakeFiles/curl.dir/tool_libinfo.c.o.d"
+  "CMakeFiles/curl.dir/tool_listhelp.c.o"
+  "CMakeFiles/curl.dir/tool_listhelp.c.o.d"
+  "CMakeFiles/curl.dir/tool_main.c.o"
+  "CMakeFiles/curl.dir/tool_main.c.o.d"
+  "CMakeFiles/curl.dir/tool_msgs.c.o"
+  "CMakeFiles/curl.dir/tool_msgs.c.o.d"
+  "CMakeFiles/curl.dir/tool_operate.c.o"
+  "CMakeFiles/curl.dir/tool_operate.c.o.d"
+  "CMakeFiles/curl.dir/tool_operhlp.c.o"
+  "CMakeFiles/curl.dir/tool_operhlp.c.o.d"
+  "CMakeFiles/curl.dir/tool_paramhlp.c.o"
+  "CMakeFiles/curl.dir/tool_paramhlp.c.o.d"
+  "CMakeFiles/curl.dir/tool_parsecfg.c.o"
+  "CMakeFiles/curl.dir/tool_parsecfg.c.o.d"
+  "CMakeFiles/curl.dir/tool_progress.c.o"
+  "CMakeFiles/curl.dir/tool_progress.c.o.d"
+  "CMakeFiles/curl.dir/tool_setopt.c.o"
+  "CMakeFiles/curl.dir/tool_setopt.c.o.d"
+  "CMakeFiles/curl.dir/tool_ssls.c.o"
+  "CMakeFiles/curl.dir/tool_ssls.c.o.d"
+  "CMakeFiles/curl.dir/tool_stderr.c.o"
+  "CMakeFiles/curl.dir/tool_stderr.c.o.d"
+  "CMakeFiles/curl.dir/tool_strdup.c.o"
+  "CMakeFiles/curl.dir/tool_strdup.c.o.d"
+  "CMakeFiles/curl.dir/tool_urlglob.c.o"
+  "CMakeFiles/curl.dir/tool_urlglob.c.o.d"
+  "CMakeFiles/curl.dir/tool_util.c.o"
+  "CMakeFiles/curl.dir/tool_util.c.o.d"
+  "CMakeFiles/curl.dir/tool_vms.c.o"
+  "CMakeFiles/curl.dir/tool_vms.c.o.d"
+  "CMakeFiles/curl.dir/tool_writeout.c.o"
+  "CMakeFiles/curl.dir/tool_writeout.c.o.d"
+  "CMakeFiles/curl.dir/tool_writeout_json.c.o"
+  "CMakeFiles/curl.dir/tool_writeout_json.c.o.d"
+  "CMakeFiles/curl.dir/tool_xattr.c.o"
+  "CMakeFiles/curl.dir/tool_xattr.c.o.d"
+  "CMakeFiles/curl.dir/var.c.o"
+  "CMakeFiles/curl.dir/var.c.o.d"
+  "curl"
+  "curl.pdb"
+  "tool_hugehelp.c"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
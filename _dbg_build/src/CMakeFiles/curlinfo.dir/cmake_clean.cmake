@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curlinfo.dir/curlinfo.c.o"
+  "CMakeFiles/curlinfo.dir/curlinfo.c.o.d"
+  "curlinfo"
+  "curlinfo.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curlinfo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
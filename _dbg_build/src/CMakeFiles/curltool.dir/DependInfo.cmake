@@ -0,0 +1,61 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/config2setopts.c" "src/CMakeFiles/curltool.dir/config2setopts.c.o" "gcc" "src/CMakeFiles/curltool.dir/config2setopts.c.o.d"
+  "/root/repo/src/slist_wc.c" "src/CMakeFiles/curltool.dir/slist_wc.c.o" "gcc" "src/CMakeFiles/curltool.dir/slist_wc.c.o.d"
+  "/root/repo/src/terminal.c" "src/CMakeFiles/curltool.dir/terminal.c.o" "gcc" "src/CMakeFiles/curltool.dir/terminal.c.o.d"
+  "/root/repo/src/tool_bname.c" "src/CMakeFiles/curltool.dir/tool_bname.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_bname.c.o.d"
+  "/root/repo/src/tool_cb_dbg.c" "src/CMakeFiles/curltool.dir/tool_cb_dbg.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_cb_dbg.c.o.d"
+  "/root/repo/src/tool_cb_hdr.c" "src/CMakeFiles/curltool.dir/tool_cb_hdr.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_cb_hdr.c.o.d"
+  "/root/repo/src/tool_cb_prg.c" "src/CMakeFiles/curltool.dir/tool_cb_prg.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_cb_prg.c.o.d"
+  "/root/repo/src/tool_cb_rea.c" "src/CMakeFiles/curltool.dir/tool_cb_rea.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_cb_rea.c.o.d"
+  "/root/repo/src/tool_cb_see.c" "src/CMakeFiles/curltool.dir/tool_cb_see.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_cb_see.c.o.d"
+  "/root/repo/src/tool_cb_soc.c" "src/CMakeFiles/curltool.dir/tool_cb_soc.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_cb_soc.c.o.d"
+  "/root/repo/src/tool_cb_wrt.c" "src/CMakeFiles/curltool.dir/tool_cb_wrt.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_cb_wrt.c.o.d"
+  "/root/repo/src/tool_cfgable.c" "src/CMakeFiles/curltool.dir/tool_cfgable.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_cfgable.c.o.d"
+  "/root/repo/src/tool_dirhie.c" "src/CMakeFiles/curltool.dir/tool_dirhie.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_dirhie.c.o.d"
+  "/root/repo/src/tool_doswin.c" "src/CMakeFiles/curltool.dir/tool_doswin.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_doswin.c.o.d"
+  "/root/repo/src/tool_easysrc.c" "src/CMakeFiles/curltool.dir/tool_easysrc.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_easysrc.c.o.d"
+  "/root/repo/src/tool_filetime.c" "src/CMakeFiles/curltool.dir/tool_filetime.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_filetime.c.o.d"
+  "/root/repo/src/tool_findfile.c" "src/CMakeFiles/curltool.dir/tool_findfile.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_findfile.c.o.d"
+  "/root/repo/src/tool_formparse.c" "src/CMakeFiles/curltool.dir/tool_formparse.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_formparse.c.o.d"
+  "/root/repo/src/tool_getparam.c" "src/CMakeFiles/curltool.dir/tool_getparam.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_getparam.c.o.d"
+  "/root/repo/src/tool_getpass.c" "src/CMakeFiles/curltool.dir/tool_getpass.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_getpass.c.o.d"
+  "/root/repo/src/tool_help.c" "src/CMakeFiles/curltool.dir/tool_help.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_help.c.o.d"
+  "/root/repo/src/tool_helpers.c" "src/CMakeFiles/curltool.dir/tool_helpers.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_helpers.c.o.d"
+  "/root/repo/src/tool_ipfs.c" "src/CMakeFiles/curltool.dir/tool_ipfs.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_ipfs.c.o.d"
+  "/root/repo/src/tool_libinfo.c" "src/CMakeFiles/curltool.dir/tool_libinfo.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_libinfo.c.o.d"
+  "/root/repo/src/tool_listhelp.c" "src/CMakeFiles/curltool.dir/tool_listhelp.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_listhelp.c.o.d"
+  "/root/repo/src/tool_main.c" "src/CMakeFiles/curltool.dir/tool_main.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_main.c.o.d"
+  "/root/repo/src/tool_msgs.c" "src/CMakeFiles/curltool.dir/tool_msgs.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_msgs.c.o.d"
+  "/root/repo/src/tool_operate.c" "src/CMakeFiles/curltool.dir/tool_operate.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_operate.c.o.d"
+  "/root/repo/src/tool_operhlp.c" "src/CMakeFiles/curltool.dir/tool_operhlp.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_operhlp.c.o.d"
+  "/root/repo/src/tool_paramhlp.c" "src/CMakeFiles/curltool.dir/tool_paramhlp.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_paramhlp.c.o.d"
+  "/root/repo/src/tool_parsecfg.c" "src/CMakeFiles/curltool.dir/tool_parsecfg.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_parsecfg.c.o.d"
+  "/root/repo/src/tool_progress.c" "src/CMakeFiles/curltool.dir/tool_progress.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_progress.c.o.d"
+  "/root/repo/src/tool_setopt.c" "src/CMakeFiles/curltool.dir/tool_setopt.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_setopt.c.o.d"
+  "/root/repo/src/tool_ssls.c" "src/CMakeFiles/curltool.dir/tool_ssls.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_ssls.c.o.d"
+  "/root/repo/src/tool_stderr.c" "src/CMakeFiles/curltool.dir/tool_stderr.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_stderr.c.o.d"
+  "/root/repo/src/tool_strdup.c" "src/CMakeFiles/curltool.dir/tool_strdup.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_strdup.c.o.d"
+  "/root/repo/src/tool_urlglob.c" "src/CMakeFiles/curltool.dir/tool_urlglob.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_urlglob.c.o.d"
+  "/root/repo/src/tool_util.c" "src/CMakeFiles/curltool.dir/tool_util.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_util.c.o.d"
+  "/root/repo/src/tool_vms.c" "src/CMakeFiles/curltool.dir/tool_vms.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_vms.c.o.d"
+  "/root/repo/src/tool_writeout.c" "src/CMakeFiles/curltool.dir/tool_writeout.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_writeout.c.o.d"
+  "/root/repo/src/tool_writeout_json.c" "src/CMakeFiles/curltool.dir/tool_writeout_json.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_writeout_json.c.o.d"
+  "/root/repo/src/tool_xattr.c" "src/CMakeFiles/curltool.dir/tool_xattr.c.o" "gcc" "src/CMakeFiles/curltool.dir/tool_xattr.c.o.d"
+  "/root/repo/src/var.c" "src/CMakeFiles/curltool.dir/var.c.o" "gcc" "src/CMakeFiles/curltool.dir/var.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,95 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curltool.dir/config2setopts.c.o"
+  "CMakeFiles/curltool.dir/config2setopts.c.o.d"
+  "CMakeFiles/curltool.dir/slist_wc.c.o"
+  "CMakeFiles/curltool.dir/slist_wc.c.o.d"
+  "CMakeFiles/curltool.dir/terminal.c.o"
+  "CMakeFiles/curltool.dir/terminal.c.o.d"
+  "CMakeFiles/curltool.dir/tool_bname.c.o"
+  "CMakeFiles/curltool.dir/tool_bname.c.o.d"
+  "CMakeFiles/curltool.dir/tool_cb_dbg.c.o"
+  "CMakeFiles/curltool.dir/tool_cb_dbg.c.o.d"
+  "CMakeFiles/curltool.dir/tool_cb_hdr.c.o"
+  "CMakeFiles/curltool.dir/tool_cb_hdr.c.o.d"
+  "CMakeFiles/curltool.dir/tool_cb_prg.c.o"
+  "CMakeFiles/curltool.dir/tool_cb_prg.c.o.d"
+  "CMakeFiles/curltool.dir/tool_cb_rea.c.o"
+  "CMakeFiles/curltool.dir/tool_cb_rea.c.o.d"
+  "CMakeFiles/curltool.dir/tool_cb_see.c.o"
+  "CMakeFiles/curltool.dir/tool_cb_see.c.o.d"
+  "CMakeFiles/curltool.dir/tool_cb_soc.c.o"
+  "CMakeFiles/curltool.dir/tool_cb_soc.c.o.d"
+  "CMakeFiles/curltool.dir/tool_cb_wrt.c.o"
+  "CMakeFiles/curltool.dir/tool_cb_wrt.c.o.d"
+  "CMakeFiles/curltool.dir/tool_cfgable.c.o"
+  "CMakeFiles/curltool.dir/tool_cfgable.c.o.d"
+  "CMakeFiles/curltool.dir/tool_dirhie.c.o"
+  "CMakeFiles/curltool.dir/tool_dirhie.c.o.d"
+  "CMakeFiles/curltool.dir/tool_doswin.c.o"
+  "CMakeFiles/curltool.dir/tool_doswin.c.o.d"
+  "CMakeFiles/curltool.dir/tool_easysrc.c.o"
+  "CMakeFiles/curltool.dir/tool_easysrc.c.o.d"
+  "CMakeFiles/curltool.dir/tool_filetime.c.o"
+  "CMakeFiles/curltool.dir/tool_filetime.c.o.d"
+  "CMakeFiles/curltool.dir/tool_findfile.c.o"
+  "CMakeFiles/curltool.dir/tool_findfile.c.o.d"
+  "CMakeFiles/curltool.dir/tool_formparse.c.o"
+  "CMakeFiles/curltool.dir/tool_formparse.c.o.d"
+  "CMakeFiles/curltool.dir/tool_getparam.c.o"
+  "CMakeFiles/curltool.dir/tool_getparam.c.o.d"
+  "CMakeFiles/curltool.dir/tool_getpass.c.o"
+  "CMakeFiles/curltool.dir/tool_getpass.c.o.d"
+  "CMakeFiles/curltool.dir/tool_help.c.o"
+  "CMakeFiles/curltool.dir/tool_help.c.o.d"
+  "CMakeFiles/curltool.dir/tool_helpers.c.o"
+  "CMakeFiles/curltool.dir/tool_helpers.c.o.d"
+  "CMakeFiles/curltool.dir/tool_ipfs.c.o"
+  "CMakeFiles/curltool.dir/tool_ipfs.c.o.d"
+  "CMakeFiles/curltool.dir/tool_libinfo.c.o"
+  "CMakeFiles/curltool.dir/tool_libinfo.c.o.d"
+  "CMakeFiles/curltool.dir/tool_listhelp.c.o"
+  "CMakeFiles/curltool.dir/tool_listhelp.c.o.d"
+  "CMakeFiles/curltool.dir/tool_main.c.o"
+  "CMakeFiles/curltool.dir/tool_main.c.o.d"
+  "CMakeFiles/curltool.dir/tool_msgs.c.o"
+  "CMakeFiles/curltool.dir/tool_msgs.c.o.d"
+  "CMakeFiles/curltool.dir/tool_operate.c.o"
+  "CMakeFiles/curltool.dir/tool_operate.c.o.d"
+  "CMakeFiles/curltool.dir/tool_operhlp.c.o"
+  "CMakeFiles/curltool.dir/tool_operhlp.c.o.d"
+  "CMakeFiles/curltool.dir/tool_paramhlp.c.o"
+  "CMakeFiles/curltool.dir/tool_paramhlp.c.o.d"
+  "CMakeFiles/curltool.dir/tool_parsecfg.c.o"
+  "CMakeFiles/curltool.dir/tool_parsecfg.c.o.d"
+  "CMakeFiles/curltool.dir/tool_progress.c.o"
+  "CMakeFiles/curltool.dir/tool_progress.c.o.d"
+  "CMakeFiles/curltool.dir/tool_setopt.c.o"
+  "CMakeFiles/curltool.dir/tool_setopt.c.o.d"
+  "CMakeFiles/curltool.dir/tool_ssls.c.o"
+  "CMakeFiles/curltool.dir/tool_ssls.c.o.d"
+  "CMakeFiles/curltool.dir/tool_stderr.c.o"
+  "CMakeFiles/curltool.dir/tool_stderr.c.o.d"
+  "CMakeFiles/curltool.dir/tool_strdup.c.o"
+  "CMakeFiles/curltool.dir/tool_strdup.c.o.d"
+  "CMakeFiles/curltool.dir/tool_urlglob.c.o"
+  "CMakeFiles/curltool.dir/tool_urlglob.c.o.d"
+  "CMakeFiles/curltool.dir/tool_util.c.o"
+  "CMakeFiles/curltool.dir/tool_util.c.o.d"
+  "CMakeFiles/curltool.dir/tool_vms.c.o"
+  "CMakeFiles/curltool.dir/tool_vms.c.o.d"
+  "CMakeFiles/curltool.dir/tool_writeout.c.o"
+  "CMakeFiles/curltool.dir/tool_writeout.c.o.d"
+  "CMakeFiles/curltool.dir/tool_writeout_json.c.o"
+  "CMakeFiles/curltool.dir/tool_writeout_json.c.o.d"
+  "CMakeFiles/curltool.dir/tool_xattr.c.o"
+  "CMakeFiles/curltool.dir/tool_xattr.c.o.d"
+  "CMakeFiles/curltool.dir/var.c.o"
+  "CMakeFiles/curltool.dir/var.c.o.d"
+  "libcurltool.a"
+  "libcurltool.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/curltool.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12241 @@
+#include "tool_setup.h"
+/* !checksrc! disable COPYRIGHT all */
+/* !checksrc! disable INCLUDEDUP all */
+/* !checksrc! disable LONGLINE all */
+#ifndef HAVE_LIBZ
+/*
+ * NEVER EVER edit this manually, fix the mkhelp.pl script instead!
+ */
+#include "tool_hugehelp.h"
+#ifdef USE_MANUAL
+#include "tool_help.h"
+
+static const char * const curlman[] = {
+  "\t  _   _ ____  _",
+  "      ___| | | |  _ \\| |",
+  "     / __| | | | |_) | |",
+  "    | (__| |_| |  _ <| |___",
+  "     \\___|\\___/|_| \\_\\_____|",
+  "NAME",
+  "\n    curl - transfer a URL",
+  "\nSYNOPSIS",
+  "\n    curl [options / URLs]",
+  "\nDESCRIPTION",
+  "\n    curl is a tool  for transferring data  from or to a  server using URLs.  It",
+  "    supports these protocols:  DICT, FILE,  FTP, FTPS,  GOPHER, GOPHERS,  HTTP,",
+  "    HTTPS, IMAP,  IMAPS, LDAP,  LDAPS, MQTT,  POP3, POP3S,  RTMP, RTMPS,  RTSP,",
+  "    SCP, SFTP, SMB, SMBS, SMTP, SMTPS, TELNET, TFTP, WS and WSS.",
+  "\n    curl  is  powered  by  libcurl  for  all  transfer-related  features.   See",
+  "    libcurl(3) for details.",
+  "\nURL",
+  "\n    The URL syntax is  protocol-dependent. You find  a detailed description  in",
+  "    RFC 3986.",
+  "\n    If you provide  a URL without  a leading  protocol:// scheme, curl  guesses",
+  "    what protocol you want. It then  defaults to HTTP but assumes others  based",
+  "    on often-used hostname prefixes. For  example, for hostnames starting  with",
+  "    \"ftp.\" curl assumes you want FTP.",
+  "\n    You can specify any  amount of URLs on the  command line. They are  fetched",
+  "    in a sequential manner  in the specified  order unless you use  --parallel.",
+  "    You can specify  command line options and  URLs mixed and  in any order  on",
+  "    the command line.",
+  "\n    curl attempts to reuse connections  when doing multiple transfers, so  that",
+  "    getting many files from  the same server do  not use multiple connects  and",
+  "    setup handshakes. This improves  speed. Connection reuse  can only be  done",
+  "    for URLs  specified for  a single  command line  invocation  and cannot  be",
+  "    performed between separate curl runs.",
+  "\n    Provide an IPv6 zone  id in the URL with  an escaped percentage sign.  Like",
+  "    in",
+  "\n\t\"http://[fe80::3%25eth0]/\"",
+  "\n    Everything provided on the command line  that is not a command line  option",
+  "    or its argument, curl assumes is a URL and treats it as such.",
+  "\nGLOBBING",
+  "\n    You can specify  multiple URLs  or parts  of URLs by  writing lists  within",
+  "    braces or ranges within brackets. We call this \"globbing\".",
+  "\n    Provide a list with three different names like this:",
+  "\n\t\"http://site.{one,two,three}.com\"",
+  "\n    Do sequences of alphanumeric series by using [] as in:",
+  "\n\t\"ftp://ftp.example.com/file[1-100].txt\"",
+  "\n    With leading zeroes:",
+  "\n\t\"ftp://ftp.example.com/file[001-100].txt\"",
+  "\n    With letters through the alphabet:",
+  "\n\t\"ftp://ftp.example.com/file[a-z].txt\"",
+  "\n    Nested sequences are not  supported, but you can  use several ones next  to",
+  "    each other:",
+  "\n\t\"http://example.com/archive[1996-1999]/vol[1-4]/part{a,b,c}.html\"",
+  "\n    You can specify a step  counter for the ranges  to get every Nth number  or",
+  "    letter:",
+  "\n\t\"http://example.com/file[1-100:10].txt\"",
+  "\n\t\"http://example.com/file[a-z:2].txt\"",
+  "\n    When using [] or {} sequences when invoked from a command line  prompt, you",
+  "    probably have to put the full  URL within double quotes to avoid the  shell",
+  "    from interfering  with it.  This  also goes  for other  characters  treated",
+  "    special, like for example '&', '?' and '*'.",
+  "\n    Switch off globbing with --globoff.",
+  "\nVARIABLES",
+  "\n    curl supports command line variables  (added in 8.3.0). Set variables  with",
+  "    --variable name=content or --variable name@file (where \"file\" can be  stdin",
+  "    if set to a single dash (-)).",
+  "\n    Variable contents can be expanded in option parameters using \"{{name}}\"  if",
+  "    the option name  is prefixed with  \"--expand-\". This  gets the contents  of",
+  "    the variable \"name\" inserted, or  a blank if the  name does not exist as  a",
+  "    variable. Insert  \"{{\"  verbatim  in the  string  by prefixing  it  with  a",
+  "    backslash, like \"\\{{\".",
+  "\n    You access and expand  environment variables by  first importing them.  You",
+  "    select to either  require the  environment variable  to be set  or you  can",
+  "    provide a default value  in case it is  not already set. Plain  \"--variable",
+  "    %name\" imports the variable called \"name\"  but exits with an error if  that",
+  "    environment variable is not already set.  To provide a default value if  it",
+  "    is not set, use \"--variable %name=content\" or \"--variable %name@content\".",
+  "\n    Example. Get the USER  environment variable into the  URL, fail if USER  is",
+  "    not set:",
+  "\n\t--variable '%USER'",
+  "\t--expand-url = \"https://example.com/api/{{USER}}/method\"",
+  "\n    When expanding variables, curl  supports a set  of functions that can  make",
+  "    the variable  contents more  convenient to  use. It  can  trim leading  and",
+  "    trailing white space  with \"trim\",  it can  output the contents  as a  JSON",
+  "    quoted string with \"json\", URL encode the string with \"url\",  base64 encode",
+  "    it with \"b64\" and  base64 decode it with \"64dec\".  To apply functions to  a",
+  "    variable expansion,  add them  colon separated  to the  right  side of  the",
+  "    variable. Variable content  holding null  bytes that are  not encoded  when",
+  "    expanded causes an error.",
+  "\n    Example: get the contents  of a file  called $HOME/.secret into a  variable",
+  "    called \"fix\". Make  sure that  the content is  trimmed and  percent-encoded",
+  "    when sent as POST data:",
+  "\n\t--variable %HOME",
+  "\t--expand-variable fix@{{HOME}}/.secret",
+  "\t--expand-data \"{{fix:trim:url}}\"",
+  "\thttps://example.com/",
+  "\n    Command line variables and expansions were added in 8.3.0.",
+  "\nOUTPUT",
+  "\n    If not told otherwise, curl writes  the received data to stdout. It can  be",
+  "    instructed to instead save that data into a local file, using  the --output",
+  "    or --remote-name options.  If curl is  given multiple  URLs to transfer  on",
+  "    the command line,  it similarly needs  multiple options  for where to  save",
+  "    them.",
+  "\n    curl does  not  parse or  otherwise \"understand\"  the  content it  gets  or",
+  "    writes as output. It does no encoding or decoding, unless  explicitly asked",
+  "    to with dedicated command line options.",
+  "\nPROTOCOLS",
+  "\n    curl supports  numerous  protocols, or  put  in URL  terms:  schemes.  Your",
+  "    particular build may not support them all.",
+  "\n    DICT",
+  "\n\tLets you lookup words using online dictionaries.",
+  "\n    FILE",
+  "\n\tRead or write local files. curl does not support accessing  file:// URL",
+  "\tremotely, but when running  on Microsoft Windows  using the native  UNC",
+  "\tapproach works. Only absolute paths.",
+  "\n    FTP(S)",
+  "\n\tcurl supports  the File  Transfer Protocol  with a  lot  of tweaks  and",
+  "\tlevers. With or without using TLS.",
+  "\n    GOPHER(S)",
+  "\n\tRetrieve files.",
+  "\n    HTTP(S)",
+  "\n\tcurl supports HTTP with numerous  options and variations. It can  speak",
+  "\tHTTP version 0.9, 1.0, 1.1, 2 and 3 depending on build options  and the",
+  "\tcorrect command line options.",
+  "\n    IMAP(S)",
+  "\n\tUsing the  mail reading  protocol, curl  can download  emails for  you.",
+  "\tWith or without using TLS.",
+  "\n    LDAP(S)",
+  "\n\tcurl can do directory lookups for you, with or without TLS.",
+  "\n    MQTT",
+  "\n\tcurl supports MQTT version 3. Downloading over MQTT equals  subscribing",
+  "\tto a topic while uploading/posting  equals publishing on a topic.  MQTT",
+  "\tover TLS is not supported (yet).",
+  "\n    POP3(S)",
+  "\n\tDownloading from a pop3 server means getting an email. With  or without",
+  "\tusing TLS.",
+  "\n    RTMP(S)",
+  "\n\tThe Realtime Messaging  Protocol is primarily  used to serve  streaming",
+  "\tmedia and curl can download it.",
+  "\n    RTSP",
+  "\n\tcurl supports RTSP 1.0 downloads.",
+  "\n    SCP",
+  "\n\tcurl supports SSH version 2 scp transfers.",
+  "\n    SFTP",
+  "\n\tcurl supports SFTP (draft 5) done over SSH version 2.",
+  "\n    SMB(S)",
+  "\n\tcurl supports SMB version 1 for upload and download.",
+  "\n    SMTP(S)",
+  "\n\tUploading contents to an  SMTP server means  sending an email. With  or",
+  "\twithout TLS.",
+  "\n    TELNET",
+  "\n\tFetching a  telnet URL  starts an  interactive session  where it  sends",
+  "\twhat it reads on stdin and outputs what the server sends it.",
+  "\n    TFTP",
+  "\n\tcurl can do TFTP downloads and uploads.",
+  "\n    WS(S)",
+  "\n\tWebSocket done over HTTP/1. WSS implies that it works over HTTPS.",
+  "\nPROGRESS METER",
+  "\n    curl normally displays a progress  meter during operations, indicating  the",
+  "    amount of transferred data, transfer  speeds and estimated time left,  etc.",
+  "    The progress  meter displays the  transfer rate  in bytes  per second.  The",
+  "    suffixes (k, M, G, T, P) are  1024 based. For example 1k is 1024 bytes.  1M",
+  "    is 1048576 bytes.",
+  "\n    curl displays this data to the  terminal by default, so if you invoke  curl",
+  "    to do  an operation  and it  is about  to write  data to  the terminal,  it",
+  "    disables the  progress  meter as  otherwise it  would  mess up  the  output",
+  "    mixing progress meter and response data.",
+  "\n    If you want a  progress meter for  HTTP POST or PUT  requests, you need  to",
+  "    redirect the response output to a file, using shell redirect  (>), --output",
+  "    or similar.",
+  "\n    This does not apply to FTP upload  as that operation does not spit out  any",
+  "    response data to the terminal.",
+  "\n    If you prefer a progress  bar instead of the regular meter,  --progress-bar",
+  "    is your friend.  You can also  disable the  progress meter completely  with",
+  "    the --silent option.",
+  "\nVERSION",
+  "\n    This man page describes  curl 8.16.0. If you  use a later version,  chances",
+  "    are this  man page  does  not fully  document  it. If  you use  an  earlier",
+  "    version, this document  tries to  include version  information about  which",
+  "    specific version that introduced changes.",
+  "\n    You can always learn which the latest curl version is by running",
+  "\n\tcurl https://curl.se/info",
+  "\n    The  online  version  of  this  man  page  is  always  showing  the  latest",
+  "    incarnation: https://curl.se/docs/manpage.html",
+  "\nOPTIONS",
+  "\n    Options start  with one  or  two dashes.  Many of  the options  require  an",
+  "    additional value  next to  them. If  provided text  does not  start with  a",
+  "    dash, it is presumed to be and treated as a URL.",
+  "\n    The short \"single-dash\" form  of the options, -d  for example, may be  used",
+  "    with or without a  space between it  and its value, although  a space is  a",
+  "    recommended separator.  The  long  double-dash form,  --data  for  example,",
+  "    requires a space between it and its value.",
+  "\n    Short version options that  do not need any  additional values can be  used",
+  "    immediately next to each  other, like for example  you can specify all  the",
+  "    options -O, -L and -v at once as -OLv.",
+  "\n    In general, all  boolean options are  enabled with  --option and yet  again",
+  "    disabled with  --no-option.  That is,  you use  the  same option  name  but",
+  "    prefix it with \"no-\".  However, in this list we  mostly only list and  show",
+  "    the --option version of them.",
+  "\n    When --next is used, it resets the parser state and you start again  with a",
+  "    clean option state, except for the options that are global.  Global options",
+  "    retain their values and meaning even after --next.",
+  "\n    If the long  option name ends with  an equals sign  (\"=\"), the argument  is",
+  "    the text following on its right side. (Added in 8.16.0)",
+  "\n    The first argument  that is  exactly two  dashes (\"--\"), marks  the end  of",
+  "    options; any argument  after the  end of  options is interpreted  as a  URL",
+  "    argument even if it starts with a dash.",
+  "\n    curl does  little  to  no verification  of  the contents  of  command  line",
+  "    arguments.  Passing  in  \"creative  octets\"  like  newlines  might  trigger",
+  "    unexpected results.",
+  "\n    The   following    options    are    global:    --fail-early,    --libcurl,",
+  "    --parallel-immediate,  --parallel-max-host,   --parallel-max,   --parallel,",
+  "    --progress-bar,   --rate,    --show-error,    --stderr,    --styled-output,",
+  "    --trace-ascii,  --trace-config,  --trace-ids,  --trace-time,  --trace   and",
+  "    --verbose.",
+  "\nALL OPTIONS",
+  "\n    --abstract-unix-socket <path>",
+  "\t    (HTTP) Connect through an abstract  Unix domain socket, instead  of",
+  "\t    using the  network. Note:  netstat shows  the path  of an  abstract",
+  "\t    socket prefixed with  \"@\", however the  <path> argument should  not",
+  "\t    have this leading character. If --abstract-unix-socket is  provided",
+  "\t    several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --abstract-unix-socket socketpath https://example.com",
+  "\n\t    See also --unix-socket.",
+  "\n    --alt-svc <filename>",
+  "\t    (HTTPS) Enable the  alt-svc parser.  If the filename  points to  an",
+  "\t    existing alt-svc  cache file,  that gets  used. After  a  completed",
+  "\t    transfer, the cache is saved to  the filename again if it has  been",
+  "\t    modified.",
+  "\n\t    Specify a \"\"  filename (zero  length) to  avoid loading/saving  and",
+  "\t    make curl just handle the cache in memory.",
+  "\n\t    If this option is used several times, curl loads contents  from all",
+  "\t    the files but  the last one  is used for  saving. --alt-svc can  be",
+  "\t    used several times in a command line",
+  "\n\t    Example:",
+  "\t     curl --alt-svc svc.txt https://example.com",
+  "\n\t    Added in 7.64.1. See also --resolve and --connect-to.",
+  "\n    --anyauth",
+  "\t    (HTTP) Figure out authentication method automatically, and use  the",
+  "\t    most secure one the remote site claims to support. This is  done by",
+  "\t    first doing  a  request  and checking  the  response-headers,  thus",
+  "\t    possibly inducing an extra network round-trip. This option is  used",
+  "\t    instead of setting a specific authentication method, which you  can",
+  "\t    do with --basic, --digest, --ntlm, and --negotiate.",
+  "\n\t    Using --anyauth is not  recommended if you  do uploads from  stdin,",
+  "\t    since it may  require data  to be  sent twice and  then the  client",
+  "\t    must be able  to rewind. If  the need  should arise when  uploading",
+  "\t    from stdin, the upload operation fails.",
+  "\n\t    Used together with --user.",
+  "\n\t    Example:",
+  "\t     curl --anyauth --user me:pwd https://example.com",
+  "\n\t    See also --proxy-anyauth, --basic and --digest.",
+  "\n    -a, --append",
+  "\t    (FTP SFTP) When used  in an upload,  this option makes curl  append",
+  "\t    to the target file  instead of overwriting  it. If the remote  file",
+  "\t    does not exist, it  is created. Note that  this flag is ignored  by",
+  "\t    some SFTP servers (including OpenSSH). Providing --append  multiple",
+  "\t    times has no extra effect. Disable it again with --no-append.",
+  "\n\t    Example:",
+  "\t     curl --upload-file local --append ftp://example.com/",
+  "\n\t    See also --range and --continue-at.",
+  "\n    --aws-sigv4 <provider1[:prvdr2[:reg[:srv]]]>",
+  "\t    (HTTP) Use AWS V4 signature authentication in the transfer.",
+  "\n\t    The provider argument  is a string  that is  used by the  algorithm",
+  "\t    when creating outgoing authentication headers.",
+  "\n\t    The region argument is  a string that  points to a geographic  area",
+  "\t    of a resources  collection (region-code)  when the  region name  is",
+  "\t    omitted from the endpoint.",
+  "\n\t    The  service argument  is  a  string  that  points  to  a  function",
+  "\t    provided by  a  cloud  (service-code)  when  the  service  name  is",
+  "\t    omitted from  the  endpoint.  If --aws-sigv4  is  provided  several",
+  "\t    times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --aws-sigv4 \"aws:amz:us-east-2:es\" --user \"key:secret\" \\",
+  "\t\t  https://example.com",
+  "\n\t    Added in 7.75.0. See also --basic and --user.",
+  "\n    --basic",
+  "\t    (HTTP) Use HTTP  Basic authentication  with the  remote host.  This",
+  "\t    method is the default and this option is usually pointless,  unless",
+  "\t    you use  it  to  override  a  previously set  option  that  sets  a",
+  "\t    different authentication  method  (such  as  --ntlm,  --digest,  or",
+  "\t    --negotiate).",
+  "\n\t    Used together with --user. Providing --basic multiple times has  no",
+  "\t    extra effect. Disable it again with --no-basic.",
+  "\n\t    Example:",
+  "\t     curl -u name:password --basic https://example.com",
+  "\n\t    See also --proxy-basic.",
+  "\n    --ca-native",
+  "\t    (TLS) Use the  operating system's native  CA store for  certificate",
+  "\t    verification.",
+  "\n\t    This option is  independent of other  CA certificate locations  set",
+  "\t    at  run time  or  build  time.  Those  locations  are  searched  in",
+  "\t    addition to the native CA store.",
+  "\n\t    This option works with OpenSSL and its forks (LibreSSL,  BoringSSL,",
+  "\t    etc) on Windows. (Added in 7.71.0)",
+  "\n\t    This option works with wolfSSL  on Windows, Linux (Debian,  Ubuntu,",
+  "\t    Gentoo, Fedora, RHEL), macOS, Android and iOS. (Added in 8.3.0)",
+  "\n\t    This option works with GnuTLS. (Added in 8.5.0)",
+  "\n\t    This option works with rustls  on Windows, macOS, Android and  iOS.",
+  "\t    On Linux  it is  equivalent  to using  the Mozilla  CA  certificate",
+  "\t    bundle. When  used  with  rustls  _only_ the  native  CA  store  is",
+  "\t    consulted, not  other locations  set  at run  time or  build  time.",
+  "\t    (Added in 8.13.0)",
+  "\n\t    This option  currently has  no  effect for  Schannel. This  is  the",
+  "\t    native TLS library from Microsoft, that by default uses the  native",
+  "\t    CA store for  verification unless  overridden by  a CA  certificate",
+  "\t    location setting.  Providing  --ca-native  multiple  times  has  no",
+  "\t    extra effect. Disable it again with --no-ca-native.",
+  "\n\t    Example:",
+  "\t     curl --ca-native https://example.com",
+  "\n\t    Added in  8.2.0.  See  also  --cacert,  --capath,  --dump-ca-embed,",
+  "\t    --insecure and --proxy-ca-native.",
+  "\n    --cacert <file>",
+  "\t    (TLS) Use the specified  certificate file to  verify the peer.  The",
+  "\t    file may contain multiple CA certificates. The certificate(s)  must",
+  "\t    be in PEM format. Normally curl is built to use a default  file for",
+  "\t    this, so this option is typically used to alter that default file.",
+  "\n\t    curl recognizes the environment variable named 'CURL_CA_BUNDLE'  if",
+  "\t    it is set and the TLS  backend is not Schannel, and uses the  given",
+  "\t    path as a  path to  a CA  cert bundle. This  option overrides  that",
+  "\t    variable.",
+  "\n\t    (Windows) curl  automatically  looks  for a  CA  certs  file  named",
+  "\t    'curl-ca-bundle.crt', either in the same directory as curl.exe,  or",
+  "\t    in the  Current Working  Directory,  or in  any folder  along  your",
+  "\t    PATH.",
+  "\n\t    curl 8.11.0  added  a  build-time option  to  disable  this  search",
+  "\t    behavior,  and   another  option   to   restrict  search   to   the",
+  "\t    application's directory.",
+  "\n\t    (Schannel) This option is  supported for Schannel  in Windows 7  or",
+  "\t    later (added  in 7.60.0).  This option  is supported  for  backward",
+  "\t    compatibility with other SSL engines; instead it is recommended  to",
+  "\t    use  Windows'  store   of  root  certificates   (the  default   for",
+  "\t    Schannel). If  --cacert is  provided several  times, the  last  set",
+  "\t    value is used.",
+  "\n\t    Example:",
+  "\t     curl --cacert CA-file.txt https://example.com",
+  "\n\t    See also --capath, --dump-ca-embed and --insecure.",
+  "\n    --capath <dir>",
+  "\t    (TLS) Use the specified certificate  directory to verify the  peer.",
+  "\t    If curl is built  against OpenSSL, multiple  paths can be  provided",
+  "\t    by  separating   them   with  the   appropriate   platform-specific",
+  "\t    separator (e.g.  \"path1:path2:path3\"  on Unix-style  platforms  for",
+  "\t    \"path1;path2;path3\" on Windows).",
+  "\n\t    The certificates  must  be in  PEM format,  and  if curl  is  built",
+  "\t    against OpenSSL, the directory must  have been processed using  the",
+  "\t    c_rehash utility supplied  with OpenSSL. Using  --capath can  allow",
+  "\t    OpenSSL-powered curl to make SSL-connections much more  efficiently",
+  "\t    than  using  --cacert  if  the  --cacert  file  contains  many   CA",
+  "\t    certificates.",
+  "\n\t    If this  option is set,  the default  capath value  is ignored.  If",
+  "\t    --capath is provided several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --capath /local/directory https://example.com",
+  "\n\t    See also --cacert, --dump-ca-embed and --insecure.",
+  "\n    -E, --cert <certificate[:password]>",
+  "\t    (TLS) Use  the specified  client certificate  file when  getting  a",
+  "\t    file  with  HTTPS,   FTPS  or  another   SSL-based  protocol.   The",
+  "\t    certificate must be  PEM format.  If the optional  password is  not",
+  "\t    specified, it  is  queried for  on  the terminal.  Note  that  this",
+  "\t    option assumes a certificate file  that is the private key and  the",
+  "\t    client certificate concatenated.  See --cert and  --key to  specify",
+  "\t    them independently.",
+  "\n\t    In the <certificate> portion of  the argument, you must escape  the",
+  "\t    character \":\" as \"\\:\" so that it is not recognized as  the password",
+  "\t    delimiter. Similarly, you  must escape the  double quote  character",
+  "\t    as \\\" so that it is not recognized as an escape character.",
+  "\n\t    If curl is built against  OpenSSL, and the engine pkcs11 or  pkcs11",
+  "\t    provider is available, then  a PKCS#11 URI  (RFC 7512) can be  used",
+  "\t    to specify  a certificate  located in  a PKCS#11  device. A  string",
+  "\t    beginning with  \"pkcs11:\" is  interpreted as  a PKCS#11  URI. If  a",
+  "\t    PKCS#11 URI  is  provided,  then  the --engine  option  is  set  as",
+  "\t    \"pkcs11\" if none was provided and the --cert-type option is  set as",
+  "\t    \"ENG\"  or  \"PROV\"  if  none  was  provided  (depending  on  OpenSSL",
+  "\t    version).",
+  "\n\t    If curl  is built  against GnuTLS,  a PKCS#11  URI can  be used  to",
+  "\t    specify a  certificate  located  in  a  PKCS#11  device.  A  string",
+  "\t    beginning with \"pkcs11:\" is interpreted as a PKCS#11 URI.",
+  "\n\t    (Schannel)  Client  certificates  must  be  specified  by  a   path",
+  "\t    expression to a certificate store.  (Loading PFX is not  supported;",
+  "\t    you  can  import  it  to  a  store  first).  You  can  use  \"<store",
+  "\t    location>\\<store name>\\<thumbprint>\" to refer  to a certificate  in",
+  "\t    the     system      certificates      store,      for      example,",
+  "\t    \"CurrentUser\\MY\\934a7ac6f8a5d579285a74fa61e19f23ddfe8d7a\".",
+  "\t    Thumbprint is  usually a  SHA-1 hex  string which  you  can see  in",
+  "\t    certificate  details.  Following  store  locations  are  supported:",
+  "\t    CurrentUser,      LocalMachine,      CurrentService,      Services,",
+  "\t    CurrentUserGroupPolicy,\t LocalMachineGroupPolicy\t and",
+  "\t    LocalMachineEnterprise. If --cert  is provided  several times,  the",
+  "\t    last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --cert certfile --key keyfile https://example.com",
+  "\n\t    See also --cert-type, --key and --key-type.",
+  "\n    --cert-status",
+  "\t    (TLS) Verify  the status  of the  server certificate  by using  the",
+  "\t    Certificate Status Request (aka. OCSP stapling) TLS extension.",
+  "\n\t    If this option  is enabled and  the server  sends an invalid  (e.g.",
+  "\t    expired)  response,  if  the  response  suggests  that  the  server",
+  "\t    certificate has been revoked,  or no response  at all is  received,",
+  "\t    the verification fails.",
+  "\n\t    This support  is  currently only  implemented  in the  OpenSSL  and",
+  "\t    GnuTLS backends.  Providing  --cert-status multiple  times  has  no",
+  "\t    extra effect. Disable it again with --no-cert-status.",
+  "\n\t    Example:",
+  "\t     curl --cert-status https://example.com",
+  "\n\t    See also --pinnedpubkey.",
+  "\n    --cert-type <type>",
+  "\t    (TLS) Set type of the  provided client certificate. PEM, DER,  ENG,",
+  "\t    PROV and P12 are recognized types.",
+  "\n\t    The default type  depends on the  TLS backend  and is usually  PEM.",
+  "\t    For Schannel it  is P12.  If --cert is  a pkcs11: URI  then ENG  or",
+  "\t    PROV is  the  default  type  (depending  on  OpenSSL  version).  If",
+  "\t    --cert-type is provided several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --cert-type PEM --cert file https://example.com",
+  "\n\t    See also --cert, --key and --key-type.",
+  "\n    --ciphers <list>",
+  "\t    (TLS) Specify which cipher  suites to use  in the connection if  it",
+  "\t    negotiates TLS  1.2 (1.1,  1.0). The  list of  ciphers suites  must",
+  "\t    specify valid  ciphers. Read  up on  cipher suite  details on  this",
+  "\t    URL:",
+  "\n\t    https://curl.se/docs/ssl-ciphers.html  If  --ciphers  is   provided",
+  "\t    several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --ciphers ECDHE-ECDSA-AES128-GCM-SHA256:\\",
+  "\t\t  ECDHE-RSA-AES128-GCM-SHA256 https://example.com",
+  "\n\t    See also --tls13-ciphers, --proxy-ciphers and --curves.",
+  "\n    --compressed",
+  "\t    (HTTP) Request a  compressed response using  one of the  algorithms",
+  "\t    curl supports, and automatically decompress the content.",
+  "\n\t    Response headers  are  not modified  when  saved, so  if  they  are",
+  "\t    \"interpreted\" separately again at a  later point they might  appear",
+  "\t    to be saying that the content is (still) compressed; while  in fact",
+  "\t    it has already been decompressed.",
+  "\n\t    If  this option  is  used  and  the  server  sends  an  unsupported",
+  "\t    encoding, curl reports an error.  This is a request, not an  order;",
+  "\t    the server  may  or  may not  deliver  data  compressed.  Providing",
+  "\t    --compressed multiple times has no  extra effect. Disable it  again",
+  "\t    with --no-compressed.",
+  "\n\t    Example:",
+  "\t     curl --compressed https://example.com",
+  "\n\t    See also --compressed-ssh.",
+  "\n    --compressed-ssh",
+  "\t    (SCP SFTP)  Enable  SSH compression.  This  is a  request,  not  an",
+  "\t    order; the server may or may not do it. Providing  --compressed-ssh",
+  "\t    multiple  times  has  no  extra  effect.  Disable  it  again   with",
+  "\t    --no-compressed-ssh.",
+  "\n\t    Example:",
+  "\t     curl --compressed-ssh sftp://example.com/",
+  "\n\t    See also --compressed.",
+  "\n    -K, --config <file>",
+  "\t    Specify a text file to  read curl arguments from. The command  line",
+  "\t    arguments found in the text file are used as if they  were provided",
+  "\t    on the command line.",
+  "\n\t    Options and their parameters must be specified on the same  line in",
+  "\t    the file, separated by whitespace, colon, or the equals sign.  Long",
+  "\t    option names can  optionally be  given in the  config file  without",
+  "\t    the  initial  double  dashes  and  if  so,  the  colon   or  equals",
+  "\t    characters can be used  as separators. If  the option is  specified",
+  "\t    with one or two dashes, there  can be no colon or equals  character",
+  "\t    between the option and its parameter.",
+  "\n\t    If the parameter contains whitespace or starts with a colon  (:) or",
+  "\t    equals sign  (=),  it  must be  specified  enclosed  within  double",
+  "\t    quotes (\"like  this\"). Within  double quotes  the following  escape",
+  "\t    sequences are available:  \\\\, \\\", \\t,  \\n, \\r  and \\v. A  backslash",
+  "\t    preceding any other letter is ignored.",
+  "\n\t    If the first non-blank column of a config line is a  '#' character,",
+  "\t    that line is treated as a comment.",
+  "\n\t    Only write  one option  per physical  line in  the  config file.  A",
+  "\t    single line  is required to  be no  more than  10 megabytes  (since",
+  "\t    8.2.0).",
+  "\n\t    Specify the filename  to --config as  minus \"-\"  to make curl  read",
+  "\t    the file from stdin.",
+  "\n\t    Note that to be able to specify a URL in the config file,  you need",
+  "\t    to specify it  using the --url  option, and  not by simply  writing",
+  "\t    the URL on its own line. So, it could look similar to this:",
+  "\n\t\turl = \"https://curl.se/docs/\"",
+  "\n\t\t# --- Example file ---",
+  "\t\t# this is a comment",
+  "\t\turl = \"example.com\"",
+  "\t\toutput = \"curlhere.html\"",
+  "\t\tuser-agent = \"superagent/1.0\"",
+  "\n\t\t# and fetch another URL too",
+  "\t\turl = \"example.com/docs/manpage.html\"",
+  "\t\t-O",
+  "\t\treferer = \"http://nowhereatall.example.com/\"",
+  "\t\t# --- End of example file ---",
+  "\n\t    When curl is invoked,  it (unless --disable  is used) checks for  a",
+  "\t    default config file  and uses it  if found,  even when --config  is",
+  "\t    used. The  default config  file  is checked  for in  the  following",
+  "\t    places in this order:",
+  "\n\t    1) \"$CURL_HOME/.curlrc\"",
+  "\n\t    2) \"$XDG_CONFIG_HOME/curlrc\" (Added in 7.73.0)",
+  "\n\t    3) \"$HOME/.curlrc\"",
+  "\n\t    4) Windows: \"%USERPROFILE%\\.curlrc\"",
+  "\n\t    5) Windows: \"%APPDATA%\\.curlrc\"",
+  "\n\t    6) Windows: \"%USERPROFILE%\\Application Data\\.curlrc\"",
+  "\n\t    7) Non-Windows: use getpwuid to find the home directory",
+  "\n\t    8) On  Windows,  if  it  finds  no .curlrc  file  in  the  sequence",
+  "\t    described above, it checks for  one in the same directory the  curl",
+  "\t    executable is placed.",
+  "\n\t    On Windows  two filenames  are checked  per location:  .curlrc  and",
+  "\t    _curlrc, preferring the former.  Older versions on Windows  checked",
+  "\t    for _curlrc only. --config can  be used several times in a  command",
+  "\t    line",
+  "\n\t    Example:",
+  "\t     curl --config file.txt https://example.com",
+  "\n\t    See also --disable.",
+  "\n    --connect-timeout <seconds>",
+  "\t    Maximum time in seconds that  you allow curl's connection to  take.",
+  "\t    This only limits the connection  phase, so if curl connects  within",
+  "\t    the given period it continues - if not it exits.",
+  "\n\t    This option accepts decimal values.  The decimal value needs to  be",
+  "\t    provided using  a dot  (.) as  decimal separator  -  not the  local",
+  "\t    version even if it might be using another separator.",
+  "\n\t    The connection phase  is considered  complete when  the DNS  lookup",
+  "\t    and  requested  TCP,   TLS  or   QUIC  handshakes   are  done.   If",
+  "\t    --connect-timeout is provided several times, the last set value  is",
+  "\t    used.",
+  "\n\t    Examples:",
+  "\t     curl --connect-timeout 20 https://example.com",
+  "\t     curl --connect-timeout 3.14 https://example.com",
+  "\n\t    See also --max-time.",
+  "\n    --connect-to <HOST1:PORT1:HOST2:PORT2>",
+  "\t    For a  request  intended for  the  \"HOST1:PORT1\" pair,  connect  to",
+  "\t    \"HOST2:PORT2\" instead. This  option is only  used to establish  the",
+  "\t    network connection.  It does  NOT affect  the hostname/port  number",
+  "\t    that is used  for TLS/SSL (e.g.  SNI, certificate verification)  or",
+  "\t    for the application protocols.",
+  "\n\t    \"HOST1\" and \"PORT1\" may be  empty strings, meaning any host or  any",
+  "\t    port number.  \"HOST2\"  and  \"PORT2\"  may  also  be  empty  strings,",
+  "\t    meaning use the request's original hostname and port number.",
+  "\n\t    A hostname specified to this option is compared as a string,  so it",
+  "\t    needs to match the name used  in the request URL. It can be  either",
+  "\t    numerical such  as  \"127.0.0.1\"  or  the full  host  name  such  as",
+  "\t    \"example.org\".",
+  "\n\t    Example:  redirect  connects  from  the  example.com  hostname   to",
+  "\t    127.0.0.1 independently of port number:",
+  "\n\t\tcurl --connect-to example.com::127.0.0.1: https://example.com/",
+  "\n\t    Example:  redirect  connects  from   all  hostnames  to   127.0.0.1",
+  "\t    independently of port number:",
+  "\n\t\tcurl --connect-to ::127.0.0.1: http://example.com/",
+  "\n\t    --connect-to can be used several times in a command line",
+  "\n\t    Example:",
+  "\t     curl --connect-to example.com:443:example.net:8443 \\",
+  "\t\t  https://example.com",
+  "\n\t    See also --resolve and --header.",
+  "\n    -C, --continue-at <offset>",
+  "\t    Resume a previous transfer  from the given  byte offset. The  given",
+  "\t    offset is  the exact  number of  bytes that  are skipped,  counting",
+  "\t    from the beginning of the  source file before it is transferred  to",
+  "\t    the destination. If used with uploads, the FTP server command  SIZE",
+  "\t    is not used by curl.",
+  "\n\t    Use \"-C -\" to instruct curl to automatically find out  where/how to",
+  "\t    resume the transfer. It then  uses the given output/input files  to",
+  "\t    figure that out.",
+  "\n\t    When  using this  option  for  HTTP  uploads  using  POST  or  PUT,",
+  "\t    functionality is not guaranteed. The HTTP protocol has no  standard",
+  "\t    interoperable resume  upload and  curl uses  a set  of headers  for",
+  "\t    this purpose that  once proved  working for some  servers and  have",
+  "\t    been left for those who find that useful.",
+  "\n\t    This command line  option is mutually  exclusive with --range:  you",
+  "\t    can only use one of them for a single transfer.",
+  "\n\t    The --no-clobber  and  --remove-on-error  options  cannot  be  used",
+  "\t    together with --continue-at. If  --continue-at is provided  several",
+  "\t    times, the last set value is used.",
+  "\n\t    Examples:",
+  "\t     curl -C - https://example.com",
+  "\t     curl -C 400 https://example.com",
+  "\n\t    See also --range.",
+  "\n    -b, --cookie <data|filename>",
+  "\t    (HTTP)  This  option  has  two  slightly  separate  cookie  sending",
+  "\t    functions.",
+  "\n\t    Either: pass  the exact  data to  send to  the HTTP  server in  the",
+  "\t    Cookie header. It is supposedly  data previously received from  the",
+  "\t    server in a \"Set-Cookie:\"  line. The data  should be in the  format",
+  "\t    \"NAME1=VALUE1;  NAME2=VALUE2\".  When  given   a  set  of   specific",
+  "\t    cookies,  curl  populates  its  cookie  header  with  this  content",
+  "\t    explicitly in  all outgoing  request(s). If  multiple requests  are",
+  "\t    done due  to authentication,  followed redirects  or similar,  they",
+  "\t    all get this cookie header passed on.",
+  "\n\t    Or: If  no  \"=\" symbol  is  used in  the  argument, it  is  instead",
+  "\t    treated as a filename to  read previously stored cookie from.  This",
+  "\t    option also activates  the cookie  engine which  makes curl  record",
+  "\t    incoming cookies,  which may  be handy  if you  are  using this  in",
+  "\t    combination  with  the  --location   option  or  do  multiple   URL",
+  "\t    transfers on the same invoke.",
+  "\n\t    If the filename is  a single minus  (\"-\"), curl reads the  contents",
+  "\t    from stdin. If  the filename  is an  empty string (\"\")  and is  the",
+  "\t    only cookie input,  curl activates  the cookie  engine without  any",
+  "\t    cookies.",
+  "\n\t    The file format of  the file to read  cookies from should be  plain",
+  "\t    HTTP headers  (Set-Cookie  style) or  the  Netscape/Mozilla  cookie",
+  "\t    file format.",
+  "\n\t    The file specified with --cookie is only used as input.  No cookies",
+  "\t    are written to that  file. To store  cookies, use the  --cookie-jar",
+  "\t    option.",
+  "\n\t    If you use the Set-Cookie file  format and do not specify a  domain",
+  "\t    then the  cookie is not  sent since  the domain  never matches.  To",
+  "\t    address this, set a domain in Set-Cookie line (doing that  includes",
+  "\t    subdomains) or preferably: use the Netscape format.",
+  "\n\t    Users often  want  to  both read  cookies  from a  file  and  write",
+  "\t    updated  cookies back  to  a  file,  so  using  both  --cookie  and",
+  "\t    --cookie-jar in the same command line is common.",
+  "\n\t    If curl is built with PSL (Public Suffix List) support,  it detects",
+  "\t    and discards cookies  that are  specified for  such suffix  domains",
+  "\t    that should not be  allowed to have cookies.  If curl is not  built",
+  "\t    with  PSL support,  it  has  no  ability  to  stop  super  cookies.",
+  "\t    --cookie can be used several times in a command line",
+  "\n\t    Examples:",
+  "\t     curl -b \"\" https://example.com",
+  "\t     curl -b cookiefile https://example.com",
+  "\t     curl -b cookiefile -c cookiefile https://example.com",
+  "\t     curl -b name=Jane https://example.com",
+  "\n\t    See also --cookie-jar and --junk-session-cookies.",
+  "\n    -c, --cookie-jar <filename>",
+  "\t    (HTTP) Specify to  which file you  want curl  to write all  cookies",
+  "\t    after a  completed  operation. curl  writes  all cookies  from  its",
+  "\t    in-memory  cookie  storage  to  the  given  file  at  the   end  of",
+  "\t    operations. Even  if no cookies  are known,  a file  is created  so",
+  "\t    that it removes any  formerly existing cookies  from the file.  The",
+  "\t    file uses the Netscape cookie file format. If you set  the filename",
+  "\t    to a single minus, \"-\", the cookies are written to stdout.",
+  "\n\t    The file specified with  --cookie-jar is only  used for output.  No",
+  "\t    cookies are read from the  file. To read cookies, use the  --cookie",
+  "\t    option. Both options can specify the same file.",
+  "\n\t    This command line  option activates  the cookie  engine that  makes",
+  "\t    curl record and  use cookies.  The --cookie  option also  activates",
+  "\t    it.",
+  "\n\t    If the cookie jar cannot be  created or written to, the whole  curl",
+  "\t    operation does  not fail  or even  report an  error clearly.  Using",
+  "\t    --verbose gets a warning  displayed, but that  is the only  visible",
+  "\t    feedback  you  get  about   this  possibly  lethal  situation.   If",
+  "\t    --cookie-jar is  provided  several times,  the  last set  value  is",
+  "\t    used.",
+  "\n\t    Examples:",
+  "\t     curl -c store-here.txt https://example.com",
+  "\t     curl -c store-here.txt -b read-these https://example.com",
+  "\n\t    See also --cookie and --junk-session-cookies.",
+  "\n    --create-dirs",
+  "\t    When used in  conjunction with  the --output  option, curl  creates",
+  "\t    the necessary  local directory  hierarchy  as needed.  This  option",
+  "\t    creates  the  directories  mentioned   with  the  --output   option",
+  "\t    combined with  the  path possibly  set  with --output-dir.  If  the",
+  "\t    combined output filename uses no  directory, or if the  directories",
+  "\t    it mentions already exist, no directories are created.",
+  "\n\t    Created directories  are made  with mode  0750 on  Unix-style  file",
+  "\t    systems.",
+  "\n\t    To  create  remote  directories  when   using  FTP  or  SFTP,   try",
+  "\t    --ftp-create-dirs. Providing  --create-dirs multiple  times has  no",
+  "\t    extra effect. Disable it again with --no-create-dirs.",
+  "\n\t    Example:",
+  "\t     curl --create-dirs --output local/dir/file https://example.com",
+  "\n\t    See also --ftp-create-dirs and --output-dir.",
+  "\n    --create-file-mode <mode>",
+  "\t    (SFTP SCP FILE) When  curl is used  to create files remotely  using",
+  "\t    one of the supported protocols, this option allows the user  to set",
+  "\t    which 'mode' to set  on the file at  creation time, instead of  the",
+  "\t    default 0644.",
+  "\n\t    This   option   takes   an    octal   number   as   argument.    If",
+  "\t    --create-file-mode is provided  several times, the  last set  value",
+  "\t    is used.",
+  "\n\t    Example:",
+  "\t     curl --create-file-mode 0777 -T localfile sftp://example.com/new",
+  "\n\t    Added in 7.75.0. See also --ftp-create-dirs.",
+  "\n    --crlf",
+  "\t    (FTP SMTP) Convert line  feeds to carriage  return plus line  feeds",
+  "\t    in upload.  Useful  for  MVS (OS/390).  Providing  --crlf  multiple",
+  "\t    times has no extra effect. Disable it again with --no-crlf.",
+  "\n\t    Example:",
+  "\t     curl --crlf -T file ftp://example.com/",
+  "\n\t    See also --use-ascii.",
+  "\n    --crlfile <file>",
+  "\t    (TLS)  Provide  a  file  using   PEM  format  with  a   Certificate",
+  "\t    Revocation List that may specify  peer certificates that are to  be",
+  "\t    considered revoked.  If --crlfile  is provided  several times,  the",
+  "\t    last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --crlfile rejects.txt https://example.com",
+  "\n\t    See also --cacert and --capath.",
+  "\n    --curves <list>",
+  "\t    (TLS) Set specific curves to  use during SSL session  establishment",
+  "\t    according to RFC 8422, 5.1. Multiple algorithms can be provided  by",
+  "\t    separating them with  \":\" (e.g. \"X25519:P-521\").  The parameter  is",
+  "\t    available identically  in  the OpenSSL  \"s_client\"  and  \"s_server\"",
+  "\t    utilities.",
+  "\n\t    --curves allows  a OpenSSL  powered  curl to  make  SSL-connections",
+  "\t    with exactly  the  (EC) curve  requested  by the  client,  avoiding",
+  "\t    nontransparent client/server negotiations.",
+  "\n\t    If this option is set,  the default curves list built into  OpenSSL",
+  "\t    are ignored. If --curves  is provided several  times, the last  set",
+  "\t    value is used.",
+  "\n\t    Example:",
+  "\t     curl --curves X25519 https://example.com",
+  "\n\t    Added in 7.73.0. See also --ciphers.",
+  "\n    -d, --data <data>",
+  "\t    (HTTP MQTT) Send the specified data  in a POST request to the  HTTP",
+  "\t    server, in the same way that a browser does when a user  has filled",
+  "\t    in an HTML form  and presses the  submit button. This option  makes",
+  "\t    curl  pass  the   data  to  the   server  using  the   content-type",
+  "\t    application/x-www-form-urlencoded. Compared to --form.",
+  "\n\t    --data-raw  is  almost  the  same  but  does  not  have  a  special",
+  "\t    interpretation of the @ character. To post data purely binary,  you",
+  "\t    should instead  use the  --data-binary  option. To  URL-encode  the",
+  "\t    value of a form field you may use --data-urlencode.",
+  "\n\t    If any of these options is used more than once on the  same command",
+  "\t    line, the  data  pieces  specified are  merged  with  a  separating",
+  "\t    &-symbol.  Thus,  using  '-d  name=daniel  -d  skill=lousy'   would",
+  "\t    generate a post chunk that looks like 'name=daniel&skill=lousy'.",
+  "\n\t    If you  start the data  with the  letter @,  the rest  should be  a",
+  "\t    filename to read the data from, or  - if you want curl to read  the",
+  "\t    data from  stdin. Posting  data from  a file  named 'foobar'  would",
+  "\t    thus be done with --data @foobar. When --data is told to  read from",
+  "\t    a file like  that, carriage  returns, newlines and  null bytes  are",
+  "\t    stripped out. If you do not want the @ character to have  a special",
+  "\t    interpretation use --data-raw instead.",
+  "\n\t    The data for  this option  is passed  on to the  server exactly  as",
+  "\t    provided on  the command  line. curl  does not  convert, change  or",
+  "\t    improve it.  It is  up  to the  user  to provide  the data  in  the",
+  "\t    correct form. --data can be used several times in a command line",
+  "\n\t    Examples:",
+  "\t     curl -d \"name=curl\" https://example.com",
+  "\t     curl -d \"name=curl\" -d \"tool=cmdline\" https://example.com",
+  "\t     curl -d @filename https://example.com",
+  "\n\t    This  option  is  mutually   exclusive  with  --form,  --head   and",
+  "\t    --upload-file.  See   also  --data-binary,   --data-urlencode   and",
+  "\t    --data-raw.",
+  "\n    --data-ascii <data>",
+  "\t    (HTTP) This option is  just an alias  for --data. --data-ascii  can",
+  "\t    be used several times in a command line",
+  "\n\t    Example:",
+  "\t     curl --data-ascii @file https://example.com",
+  "\n\t    See also --data-binary, --data-raw and --data-urlencode.",
+  "\n    --data-binary <data>",
+  "\t    (HTTP) Post  data exactly  as specified  with no  extra  processing",
+  "\t    whatsoever.",
+  "\n\t    If you  start the data  with the  letter @,  the rest  should be  a",
+  "\t    filename. \"@-\" makes curl read the data from stdin. Data  is posted",
+  "\t    in a  similar  manner as  --data  does, except  that  newlines  and",
+  "\t    carriage returns are preserved and conversions are never done.",
+  "\n\t    Like  --data  the  default  content-type  sent  to  the  server  is",
+  "\t    application/x-www-form-urlencoded. If  you  want  the  data  to  be",
+  "\t    treated as  arbitrary  binary  data  by the  server  then  set  the",
+  "\t    content-type      to      octet-stream:      -H      \"Content-Type:",
+  "\t    application/octet-stream\".",
+  "\n\t    If this option is used several times, the ones following  the first",
+  "\t    append data  as  described in  --data.  --data-binary can  be  used",
+  "\t    several times in a command line",
+  "\n\t    Example:",
+  "\t     curl --data-binary @filename https://example.com",
+  "\n\t    See also --data-ascii.",
+  "\n    --data-raw <data>",
+  "\t    (HTTP) Post  data  similarly  to --data  but  without  the  special",
+  "\t    interpretation of the @ character.  --data-raw can be used  several",
+  "\t    times in a command line",
+  "\n\t    Examples:",
+  "\t     curl --data-raw \"hello\" https://example.com",
+  "\t     curl --data-raw \"@at@at@\" https://example.com",
+  "\n\t    See also --data.",
+  "\n    --data-urlencode <data>",
+  "\t    (HTTP) Post  data, similar  to the  other --data  options with  the",
+  "\t    exception that this performs URL-encoding.",
+  "\n\t    To be  CGI-compliant, the  <data>  part should  begin with  a  name",
+  "\t    followed by a  separator and  a content  specification. The  <data>",
+  "\t    part can be passed to curl using one of the following syntaxes:",
+  "\n\t    content",
+  "\n\t\tURL-encode the content  and pass  that on. Just  be careful  so",
+  "\t\tthat the content does  not contain any  \"=\" or \"@\" symbols,  as",
+  "\t\tthat makes the syntax match one of the other cases below.",
+  "\n\t    =content",
+  "\n\t\tURL-encode the  content and  pass that  on. The  preceding  \"=\"",
+  "\t\tsymbol is not included in the data.",
+  "\n\t    name=content",
+  "\n\t\tURL-encode the content  part and  pass that on.  Note that  the",
+  "\t\tname part is expected to be URL-encoded already.",
+  "\n\t    @filename",
+  "\n\t\tload  data  from  the  given  file  (including  any  newlines),",
+  "\t\tURL-encode that data  and pass it  on in  the POST. Using  \"@-\"",
+  "\t\tmakes curl read the data from stdin.",
+  "\n\t    name@filename",
+  "\n\t\tload  data  from  the  given  file  (including  any  newlines),",
+  "\t\tURL-encode that data and pass it on in the POST. The  name part",
+  "\t\tgets    an     equal     sign    appended,     resulting     in",
+  "\t\tname=urlencoded-file-content. Note  that the  name is  expected",
+  "\t\tto be URL-encoded already.",
+  "\n\t    --data-urlencode can be used several times in a command line",
+  "\n\t    Examples:",
+  "\t     curl --data-urlencode name=val https://example.com",
+  "\t     curl --data-urlencode =encodethis https://example.com",
+  "\t     curl --data-urlencode name@file https://example.com",
+  "\t     curl --data-urlencode @fileonly https://example.com",
+  "\n\t    See also --data and --data-raw.",
+  "\n    --delegation <LEVEL>",
+  "\t    (GSS/kerberos) Set LEVEL what curl  is allowed to delegate when  it",
+  "\t    comes to user credentials.",
+  "\n\t    none",
+  "\n\t\tDo not allow any delegation.",
+  "\n\t    policy",
+  "\n\t\tDelegates if and only if the OK-AS-DELEGATE flag is set  in the",
+  "\t\tKerberos service ticket, which is a matter of realm policy.",
+  "\n\t    always",
+  "\n\t\tUnconditionally allow the server to delegate.",
+  "\n\t    If --delegation is provided  several times, the  last set value  is",
+  "\t    used.",
+  "\n\t    Example:",
+  "\t     curl --delegation \"none\" https://example.com",
+  "\n\t    See also --insecure and --ssl.",
+  "\n    --digest",
+  "\t    (HTTP)  Enable  HTTP  Digest  authentication.  This  authentication",
+  "\t    scheme avoids sending  the password  over the wire  in clear  text.",
+  "\t    Use this  in  combination with  the  normal --user  option  to  set",
+  "\t    username and  password. Providing  --digest multiple  times has  no",
+  "\t    extra effect. Disable it again with --no-digest.",
+  "\n\t    Example:",
+  "\t     curl -u name:password --digest https://example.com",
+  "\n\t    See also --user, --proxy-digest and --anyauth.",
+  "\n    -q, --disable",
+  "\t    If used  as the first  parameter on  the command  line, the  curlrc",
+  "\t    config file is not  read or used. See  the --config for details  on",
+  "\t    the default config file  search path. Providing --disable  multiple",
+  "\t    times has no extra effect. Disable it again with --no-disable.",
+  "\n\t    Example:",
+  "\t     curl -q https://example.com",
+  "\n\t    See also --config.",
+  "\n    --disable-eprt",
+  "\t    (FTP) Disable  the use of  the EPRT  and LPRT  commands when  doing",
+  "\t    active FTP  transfers. curl  normally first  attempts to  use  EPRT",
+  "\t    before using PORT, but with  this option, it uses PORT right  away.",
+  "\t    EPRT is an  extension to the  original FTP  protocol, and does  not",
+  "\t    work on all  servers, but  enables more functionality  in a  better",
+  "\t    way than the traditional PORT command.",
+  "\n\t    --eprt can be used  to explicitly enable  EPRT again and  --no-eprt",
+  "\t    is an alias for --disable-eprt.",
+  "\n\t    If the server is accessed using IPv6, this option has no  effect as",
+  "\t    EPRT is necessary then.",
+  "\n\t    Disabling EPRT only  changes the  active behavior. If  you want  to",
+  "\t    switch to passive mode you need  to not use --ftp-port or force  it",
+  "\t    with --ftp-pasv.  Providing --disable-eprt  multiple times  has  no",
+  "\t    extra effect. Disable it again with --no-disable-eprt.",
+  "\n\t    Example:",
+  "\t     curl --disable-eprt ftp://example.com/",
+  "\n\t    See also --disable-epsv and --ftp-port.",
+  "\n    --disable-epsv",
+  "\t    (FTP) Disable the use  of the EPSV  command when doing passive  FTP",
+  "\t    transfers. curl normally  first attempts to  use EPSV before  PASV,",
+  "\t    but with this option, it does not try EPSV.",
+  "\n\t    --epsv can be used  to explicitly enable  EPSV again and  --no-epsv",
+  "\t    is an alias for --disable-epsv.",
+  "\n\t    If the server is  an IPv6 host, this option  has no effect as  EPSV",
+  "\t    is necessary then.",
+  "\n\t    Disabling EPSV only changes  the passive behavior.  If you want  to",
+  "\t    switch to  active  mode  you  need  to  use  --ftp-port.  Providing",
+  "\t    --disable-epsv multiple  times  has  no extra  effect.  Disable  it",
+  "\t    again with --no-disable-epsv.",
+  "\n\t    Example:",
+  "\t     curl --disable-epsv ftp://example.com/",
+  "\n\t    See also --disable-eprt and --ftp-port.",
+  "\n    --disallow-username-in-url",
+  "\t    Exit with error  if passed  a URL containing  a username.  Probably",
+  "\t    most useful when the URL  is being provided at runtime or  similar.",
+  "\t    Providing --disallow-username-in-url  multiple times  has no  extra",
+  "\t    effect. Disable it again with --no-disallow-username-in-url.",
+  "\n\t    Example:",
+  "\t     curl --disallow-username-in-url https://example.com",
+  "\n\t    Added in 7.61.0. See also --proto.",
+  "\n    --dns-interface <interface>",
+  "\t    (DNS) Send outgoing DNS requests through the given interface.  This",
+  "\t    option is  a  counterpart to  --interface  (which does  not  affect",
+  "\t    DNS). The  supplied  string  must  be an  interface  name  (not  an",
+  "\t    address). If --dns-interface  is provided several  times, the  last",
+  "\t    set value is used.",
+  "\n\t    Example:",
+  "\t     curl --dns-interface eth0 https://example.com",
+  "\n\t    --dns-interface requires that libcurl  is built to support  c-ares.",
+  "\t    See also --dns-ipv4-addr and --dns-ipv6-addr.",
+  "\n    --dns-ipv4-addr <address>",
+  "\t    (DNS) Bind to a specific IP address when making IPv4  DNS requests,",
+  "\t    so that the DNS requests originate from this address. The  argument",
+  "\t    should be a  single IPv4  address. If  --dns-ipv4-addr is  provided",
+  "\t    several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --dns-ipv4-addr 10.1.2.3 https://example.com",
+  "\n\t    --dns-ipv4-addr requires that libcurl  is built to support  c-ares.",
+  "\t    See also --dns-interface and --dns-ipv6-addr.",
+  "\n    --dns-ipv6-addr <address>",
+  "\t    (DNS) Bind to a specific IP address when making IPv6  DNS requests,",
+  "\t    so that the DNS requests originate from this address. The  argument",
+  "\t    should be a  single IPv6  address. If  --dns-ipv6-addr is  provided",
+  "\t    several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --dns-ipv6-addr 2a04:4e42::561 https://example.com",
+  "\n\t    --dns-ipv6-addr requires that libcurl  is built to support  c-ares.",
+  "\t    See also --dns-interface and --dns-ipv4-addr.",
+  "\n    --dns-servers <addresses>",
+  "\t    (DNS) Set the list of DNS servers to be used instead of  the system",
+  "\t    default. The list of IP addresses should be separated with  commas.",
+  "\t    Port numbers  may also  optionally  be given,  appended to  the  IP",
+  "\t    address separated  with  a  colon.  If  --dns-servers  is  provided",
+  "\t    several times, the last set value is used.",
+  "\n\t    Examples:",
+  "\t     curl --dns-servers 192.168.0.1,192.168.0.2 https://example.com",
+  "\t     curl --dns-servers 10.0.0.1:53 https://example.com",
+  "\n\t    --dns-servers requires  that libcurl  is built  to support  c-ares.",
+  "\t    See also --dns-interface and --dns-ipv4-addr.",
+  "\n    --doh-cert-status",
+  "\t    Same as --cert-status but used for DoH (DNS-over-HTTPS).",
+  "\n\t    Verify the  status of  the DoH  servers' certificate  by using  the",
+  "\t    Certificate Status Request (aka. OCSP stapling) TLS extension.",
+  "\n\t    If this  option is  enabled and  the DoH  server  sends an  invalid",
+  "\t    (e.g. expired) response, if the  response suggests that the  server",
+  "\t    certificate has been revoked,  or no response  at all is  received,",
+  "\t    the verification fails.",
+  "\n\t    This support  is  currently only  implemented  in the  OpenSSL  and",
+  "\t    GnuTLS backends. Providing --doh-cert-status multiple times has  no",
+  "\t    extra effect. Disable it again with --no-doh-cert-status.",
+  "\n\t    Example:",
+  "\t     curl --doh-cert-status --doh-url https://doh.example \\",
+  "\t\t  https://example.com",
+  "\n\t    Added in 7.76.0. See also --doh-insecure.",
+  "\n    --doh-insecure",
+  "\t    By  default, every  connection  curl  makes  to  a  DoH  server  is",
+  "\t    verified to be secure before the transfer takes place. This  option",
+  "\t    tells curl  to  skip  the verification  step  and  proceed  without",
+  "\t    checking.",
+  "\n\t    WARNING:  using  this  option  makes  the  DoH  transfer  and  name",
+  "\t    resolution insecure.",
+  "\n\t    This option is  equivalent to --insecure  and --proxy-insecure  but",
+  "\t    used  for  DoH  (DNS-over-HTTPS)  only.  Providing   --doh-insecure",
+  "\t    multiple  times  has  no  extra  effect.  Disable  it  again   with",
+  "\t    --no-doh-insecure.",
+  "\n\t    Example:",
+  "\t     curl --doh-insecure --doh-url https://doh.example \\",
+  "\t\t  https://example.com",
+  "\n\t    Added   in   7.76.0.   See    also   --doh-url,   --insecure    and",
+  "\t    --proxy-insecure.",
+  "\n    --doh-url <URL>",
+  "\t    Specify  which  DNS-over-HTTPS  (DoH)  server  to  use  to  resolve",
+  "\t    hostnames, instead of  using the default  name resolver  mechanism.",
+  "\t    The URL must be HTTPS.",
+  "\n\t    Some SSL options that you set  for your transfer also apply to  DoH",
+  "\t    since  the  name  lookups  take   place  over  SSL.  However,   the",
+  "\t    certificate  verification  settings  are  not  inherited  but   are",
+  "\t    controlled separately via --doh-insecure and --doh-cert-status.",
+  "\n\t    By default, DoH is bypassed  when initially looking up DNS  records",
+  "\t    of the DoH server.  You can specify the  IP address(es) of the  DoH",
+  "\t    server with --resolve to avoid this.",
+  "\n\t    This option is  unset if  an empty string  \"\" is used  as the  URL.",
+  "\t    (Added in 7.85.0) If --doh-url is provided several times, the  last",
+  "\t    set value is used.",
+  "\n\t    Examples:",
+  "\t     curl --doh-url https://doh.example https://example.com",
+  "\t     curl --doh-url https://doh.example --resolve \\",
+  "\t\t  doh.example:443:192.0.2.1 https://example.com",
+  "\n\t    Added in 7.62.0. See also --doh-insecure.",
+  "\n    --dump-ca-embed",
+  "\t    (TLS) Write  the CA  bundle embedded  in curl  to standard  output,",
+  "\t    then quit.",
+  "\n\t    If curl  was  not built  with a  default  CA bundle  embedded,  the",
+  "\t    output is empty.  Providing --dump-ca-embed multiple  times has  no",
+  "\t    extra effect. Disable it again with --no-dump-ca-embed.",
+  "\n\t    Example:",
+  "\t     curl --dump-ca-embed",
+  "\n\t    Added  in  8.10.0.  See   also  --ca-native,  --cacert,   --capath,",
+  "\t    --proxy-ca-native, --proxy-cacert and --proxy-capath.",
+  "\n    -D, --dump-header <filename>",
+  "\t    (HTTP FTP) Write  the received  protocol headers  to the  specified",
+  "\t    file. If no headers  are received, the  use of this option  creates",
+  "\t    an empty file. Specify \"-\" as filename (a single minus) to  have it",
+  "\t    written to stdout.",
+  "\n\t    Starting in curl  8.10.0, specify  \"%\" (a single  percent sign)  as",
+  "\t    filename writes the output to stderr.",
+  "\n\t    When used  in FTP,  the FTP  server response  lines are  considered",
+  "\t    being \"headers\" and thus are saved there.",
+  "\n\t    Starting in curl  8.11.0, using the  --create-dirs option can  also",
+  "\t    create missing  directory  components  for  the  path  provided  in",
+  "\t    --dump-header.",
+  "\n\t    Having multiple transfers in one  set of operations (i.e. the  URLs",
+  "\t    in one --next clause), appends them to the same file,  separated by",
+  "\t    a blank line. If --dump-header is provided several times, the  last",
+  "\t    set value is used.",
+  "\n\t    Examples:",
+  "\t     curl --dump-header store.txt https://example.com",
+  "\t     curl --dump-header - https://example.com -o save",
+  "\n\t    See also --output.",
+  "\n    --ech <config>",
+  "\t    (HTTPS) Specify how to do ECH (Encrypted Client Hello).",
+  "\n\t    The values allowed for <config> can be:",
+  "\n\t    false",
+  "\n\t\tDo not attempt ECH. The is the default.",
+  "\n\t    grease",
+  "\n\t\tSend a GREASE ECH extension",
+  "\n\t    true",
+  "\n\t\tAttempt ECH  if  possible,  but  do  not fail  if  ECH  is  not",
+  "\t\tattempted. (The  connection  fails  if  ECH  is  attempted  but",
+  "\t\tfails.)",
+  "\n\t    hard",
+  "\n\t\tAttempt ECH and fail  if that is  not possible. ECH only  works",
+  "\t\twith TLS  1.3  and also  requires  using DoH  or  providing  an",
+  "\t\tECHConfigList on the command line.",
+  "\n\t    ecl:<b64val>",
+  "\n\t\tA base64 encoded ECHConfigList that is used for ECH.",
+  "\n\t    pn:<name>",
+  "\n\t\tA name  to  use to  over-ride  the \"public_name\"  field  of  an",
+  "\t\tECHConfigList (only available with OpenSSL TLS support)",
+  "\n\t    Most ECH related  errors cause error  CURLE_ECH_REQUIRED (101).  If",
+  "\t    --ech is provided several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --ech true https://example.com",
+  "\n\t    Added in 8.8.0. See also --doh-url.",
+  "\n    --egd-file <file>",
+  "\t    (TLS) Deprecated option (added  in 7.84.0). Prior  to that it  only",
+  "\t    had an effect on curl if built to use old versions of OpenSSL.",
+  "\n\t    Specify the path name to  the Entropy Gathering Daemon socket.  The",
+  "\t    socket is used to  seed the random  engine for SSL connections.  If",
+  "\t    --egd-file is provided several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --egd-file /random/here https://example.com",
+  "\n\t    See also --random-file.",
+  "\n    --engine <name>",
+  "\t    (TLS)  Select  the  OpenSSL  crypto   engine  to  use  for   cipher",
+  "\t    operations. Use  --engine  list  to  print  a  list  of  build-time",
+  "\t    supported engines. Note  that not  all (and possibly  none) of  the",
+  "\t    engines may  be  available  at runtime.  If  --engine  is  provided",
+  "\t    several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --engine flavor https://example.com",
+  "\n\t    See also --ciphers and --curves.",
+  "\n    --etag-compare <file>",
+  "\t    (HTTP) Make a conditional HTTP  request for the specific ETag  read",
+  "\t    from the given file by sending a custom If-None-Match header  using",
+  "\t    the stored ETag.",
+  "\n\t    For correct results,  make sure  that the  specified file  contains",
+  "\t    only a single line with  the desired ETag. A non-existing or  empty",
+  "\t    file is treated as an empty ETag.",
+  "\n\t    Use the option --etag-save to first save the ETag from  a response,",
+  "\t    and then use  this option to  compare against the  saved ETag in  a",
+  "\t    subsequent request.",
+  "\n\t    Use this  option  with a  single  URL only.  If  --etag-compare  is",
+  "\t    provided several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --etag-compare etag.txt https://example.com",
+  "\n\t    Added in 7.68.0. See also --etag-save and --time-cond.",
+  "\n    --etag-save <file>",
+  "\t    (HTTP) Save  an HTTP  ETag  to the  specified file.  An ETag  is  a",
+  "\t    caching related header,  usually returned in  a response. Use  this",
+  "\t    option with a single URL only.",
+  "\n\t    If no ETag is sent by the server, an empty file is created.",
+  "\n\t    In many situations you want to use an existing etag in  the request",
+  "\t    to avoid downloading the same resource again but also save  the new",
+  "\t    etag  if  it  has  indeed  changed,  by  using  both  etag  options",
+  "\t    --etag-save and --etag-compare with the same filename, in the  same",
+  "\t    command line.",
+  "\n\t    Starting in curl  8.12.0, using the  --create-dirs option can  also",
+  "\t    create missing  directory  components  for  the  path  provided  in",
+  "\t    --etag-save. If  --etag-save is  provided several  times, the  last",
+  "\t    set value is used.",
+  "\n\t    Example:",
+  "\t     curl --etag-save storetag.txt https://example.com",
+  "\n\t    Added in 7.68.0. See also --etag-compare.",
+  "\n    --expect100-timeout <seconds>",
+  "\t    (HTTP) Maximum time in  seconds that you allow  curl to wait for  a",
+  "\t    100-continue response  when  curl emits  an  Expects:  100-continue",
+  "\t    header in  its request.  By  default curl  waits one  second.  This",
+  "\t    option  accepts  decimal  values.  When  curl  stops  waiting,   it",
+  "\t    continues as if a response was received.",
+  "\n\t    The decimal  value  needs  to be  provided  using a  dot  (\".\")  as",
+  "\t    decimal separator  - not  the local  version even  if  it might  be",
+  "\t    using  another  separator.   If  --expect100-timeout  is   provided",
+  "\t    several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --expect100-timeout 2.5 -T file https://example.com",
+  "\n\t    See also --connect-timeout.",
+  "\n    -f, --fail",
+  "\t    (HTTP) Fail with error code 22 and with no response body  output at",
+  "\t    all for  HTTP transfers  returning HTTP  response codes  at 400  or",
+  "\t    greater.",
+  "\n\t    In normal cases when  an HTTP server  fails to deliver a  document,",
+  "\t    it returns a body  of text stating  so (which often also  describes",
+  "\t    why and  more) and  a 4xx  HTTP response  code.  This command  line",
+  "\t    option prevents curl from outputting that data and instead  returns",
+  "\t    error 22 early. By  default, curl does  not consider HTTP  response",
+  "\t    codes to indicate failure.",
+  "\n\t    To  get both  the  error  code  and  also  save  the  content,  use",
+  "\t    --fail-with-body instead.",
+  "\n\t    This  method  is  not  fail-safe  and  there  are  occasions  where",
+  "\t    non-successful  response  codes   slip  through,  especially   when",
+  "\t    authentication is involved (response codes 401 and 407).  Providing",
+  "\t    --fail multiple times has  no extra effect.  Disable it again  with",
+  "\t    --no-fail.",
+  "\n\t    Example:",
+  "\t     curl --fail https://example.com",
+  "\n\t    This option is mutually  exclusive with --fail-with-body. See  also",
+  "\t    --fail-with-body and --fail-early.",
+  "\n    --fail-early",
+  "\t    Fail and exit on the first detected transfer error.",
+  "\n\t    When curl is used to do multiple transfers on the command  line, it",
+  "\t    attempts to operate on each given  URL, one by one. By default,  it",
+  "\t    ignores errors  if there are  more URLs  given and  the last  URL's",
+  "\t    success determines the error code curl returns. Early failures  are",
+  "\t    \"hidden\" by subsequent successful transfers.",
+  "\n\t    Using this  option, curl  instead  returns an  error on  the  first",
+  "\t    transfer that fails,  independent of  the amount of  URLs that  are",
+  "\t    given on  the  command line.  This  way, no  transfer  failures  go",
+  "\t    undetected by scripts and similar.",
+  "\n\t    This option does not imply  --fail, which causes transfers to  fail",
+  "\t    due to  the server's  HTTP status  code. You  can  combine the  two",
+  "\t    options, however  note  --fail  is  not  global  and  is  therefore",
+  "\t    contained by --next.",
+  "\n\t    This option is global  and does not need  to be specified for  each",
+  "\t    use of --next. Providing --fail-early  multiple times has no  extra",
+  "\t    effect. Disable it again with --no-fail-early.",
+  "\n\t    Example:",
+  "\t     curl --fail-early https://example.com https://two.example",
+  "\n\t    See also --fail and --fail-with-body.",
+  "\n    --fail-with-body",
+  "\t    (HTTP) Return an  error on  server errors where  the HTTP  response",
+  "\t    code is 400 or greater). In normal cases when an HTTP  server fails",
+  "\t    to deliver  a document,  it  returns an  HTML document  stating  so",
+  "\t    (which often also describes why and more). This option allows  curl",
+  "\t    to output and save that content but also to return error 22.",
+  "\n\t    This is an alternative option  to --fail which makes curl fail  for",
+  "\t    the same circumstances  but without saving  the content.  Providing",
+  "\t    --fail-with-body multiple  times has  no extra  effect. Disable  it",
+  "\t    again with --no-fail-with-body.",
+  "\n\t    Example:",
+  "\t     curl --fail-with-body https://example.com",
+  "\n\t    This option is  mutually exclusive  with --fail.  Added in  7.76.0.",
+  "\t    See also --fail and --fail-early.",
+  "\n    --false-start",
+  "\t    (TLS) No TLS backend currently supports this feature.",
+  "\n\t    Use false start  during the TLS  handshake. False  start is a  mode",
+  "\t    where  a  TLS  client   starts  sending  application  data   before",
+  "\t    verifying the server's Finished message,  thus saving a round  trip",
+  "\t    when performing a full handshake. Providing --false-start  multiple",
+  "\t    times has no extra effect. Disable it again with --no-false-start.",
+  "\n\t    Example:",
+  "\t     curl --false-start https://example.com",
+  "\n\t    See also --tcp-fastopen.",
+  "\n    --follow",
+  "\t    Instructs curl  to  follow HTTP  redirects  and to  do  the  custom",
+  "\t    request method set with --request  when following redirects as  the",
+  "\t    HTTP specification says.",
+  "\n\t    The  method  string  set  with  --request  is  used  in  subsequent",
+  "\t    requests for the status codes 307  or 308, but may be reset to  GET",
+  "\t    for 301, 302 and 303.",
+  "\n\t    This is subtly  different than  --location, as  that option  always",
+  "\t    set the custom  method in  all subsequent  requests independent  of",
+  "\t    response code.  Providing  --follow  multiple times  has  no  extra",
+  "\t    effect. Disable it again with --no-follow.",
+  "\n\t    Example:",
+  "\t     curl -X POST --follow https://example.com",
+  "\n\t    Added in 8.16.0. See also --request and --location.",
+  "\n    -F, --form <name=content>",
+  "\t    (HTTP SMTP IMAP) For the HTTP protocol family, emulate a  filled-in",
+  "\t    form in  which a user  has pressed  the submit  button. This  makes",
+  "\t    curl  POST   data   using  the   Content-Type   multipart/form-data",
+  "\t    according to RFC 2388.",
+  "\n\t    For SMTP  and  IMAP  protocols,  this  composes  a  multipart  mail",
+  "\t    message to transmit.",
+  "\n\t    This enables uploading of binary files etc. To force the  'content'",
+  "\t    part to be a file, prefix the filename with an @ sign. To  just get",
+  "\t    the content part from a  file, prefix the filename with the  symbol",
+  "\t    <. The difference between @ and <  is then that @ makes a file  get",
+  "\t    attached in the  post as a file  upload, while the  < makes a  text",
+  "\t    field and just gets the contents for that text field from a file.",
+  "\n\t    Read content from stdin instead of a file by using a single  \"-\" as",
+  "\t    filename. This  goes for both  @ and  < constructs.  When stdin  is",
+  "\t    used,  the  contents  is  buffered  in  memory  first  by  curl  to",
+  "\t    determine its size and allow  a possible resend. Defining a  part's",
+  "\t    data from  a  named  non-regular file  (such  as a  named  pipe  or",
+  "\t    similar) is  not  subject  to  buffering and  is  instead  read  at",
+  "\t    transmission time;  since  the  full size  is  unknown  before  the",
+  "\t    transfer starts, such data is  sent as chunks by HTTP and  rejected",
+  "\t    by IMAP.",
+  "\n\t    Example: send an image  to an HTTP  server, where 'profile' is  the",
+  "\t    name of  the  form-field to  which  the file  portrait.jpg  is  the",
+  "\t    input:",
+  "\n\t\tcurl -F profile=@portrait.jpg https://example.com/upload.cgi",
+  "\n\t    Example: send your  name and shoe  size in two  text fields to  the",
+  "\t    server:",
+  "\n\t\tcurl -F name=John -F shoesize=11 https://example.com/",
+  "\n\t    Example: send your essay in a text field to the server. Send  it as",
+  "\t    a plain text field, but get the contents for it from a local file:",
+  "\n\t\tcurl -F \"story=<hugefile.txt\" https://example.com/",
+  "\n\t    You can  also  instruct curl  what  Content-Type to  use  by  using",
+  "\t    \"type=\", in a manner similar to:",
+  "\n\t\tcurl -F \"web=@index.html;type=text/html\" example.com",
+  "\n\t    or",
+  "\n\t\tcurl -F \"name=daniel;type=text/foo\" example.com",
+  "\n\t    You can  also explicitly change  the name  field of  a file  upload",
+  "\t    part by setting filename=, like this:",
+  "\n\t\tcurl -F \"file=@localfile;filename=nameinpost\" example.com",
+  "\n\t    If  filename/path contains  ','  or  ';',  it  must  be  quoted  by",
+  "\t    double-quotes like:",
+  "\n\t\tcurl -F \"file=@\\\"local,file\\\";filename=\\\"name;in;post\\\"\" \\",
+  "\t\t    https://example.com",
+  "\n\t    or",
+  "\n\t\tcurl -F 'file=@\"local,file\";filename=\"name;in;post\"' \\",
+  "\t\t    https://example.com",
+  "\n\t    Note that  if  a  filename/path is  quoted  by  double-quotes,  any",
+  "\t    double-quote or backslash  within the filename  must be escaped  by",
+  "\t    backslash.",
+  "\n\t    Quoting must  also  be applied  to  non-file data  if  it  contains",
+  "\t    semicolons, leading/trailing spaces or leading double quotes:",
+  "\n\t\tcurl -F 'colors=\"red; green; blue\";type=text/x-myapp' \\",
+  "\t\t   https://example.com",
+  "\n\t    You can add custom headers to the field by setting headers=, like",
+  "\n\t\tcurl -F \"submit=OK;headers=\\\"X-submit-type: OK\\\"\" example.com",
+  "\n\t    or",
+  "\n\t\tcurl -F \"submit=OK;headers=@headerfile\" example.com",
+  "\n\t    The headers=  keyword may  appear more  than once  and above  notes",
+  "\t    about quoting  apply. When  headers  are read  from a  file,  empty",
+  "\t    lines and lines starting with  '#' are ignored; each header can  be",
+  "\t    folded  by   splitting  between   two   words  and   starting   the",
+  "\t    continuation line  with  a  space;  embedded  carriage-returns  and",
+  "\t    trailing spaces are stripped. Here  is an example of a header  file",
+  "\t    contents:",
+  "\n\t\t# This file contains two headers.",
+  "\t\tX-header-1: this is a header",
+  "\n\t\t# The following header is folded.",
+  "\t\tX-header-2: this is",
+  "\t\t another header",
+  "\n\t    To support sending multipart mail messages, the syntax is  extended",
+  "\t    as follows:",
+  "\n\t    - name can  be omitted: the  equal sign is  the first character  of",
+  "\t    the argument,",
+  "\n\t    - if data starts with '(',  this signals to start a new  multipart:",
+  "\t    it can be followed by a content type specification.",
+  "\n\t    - a multipart can be terminated with a '=)' argument.",
+  "\n\t    Example: the following command sends an SMTP mime email  consisting",
+  "\t    in an inline part in two alternative formats: plain text  and HTML.",
+  "\t    It attaches a text file:",
+  "\n\t\tcurl -F '=(;type=multipart/alternative' \\",
+  "\t\t     -F '=plain text message' \\",
+  "\t\t     -F '= <body>HTML message</body>;type=text/html' \\",
+  "\t\t     -F '=)' -F '=@textfile.txt' ...  smtp://example.com",
+  "\n\t    Data  can  be  encoded  for  transfer  using  encoder=.   Available",
+  "\t    encodings are binary and 8bit that do nothing else than  adding the",
+  "\t    corresponding  Content-Transfer-Encoding  header,  7bit  that  only",
+  "\t    rejects 8-bit characters  with a  transfer error,  quoted-printable",
+  "\t    and  base64  that  encodes  data  according  to  the  corresponding",
+  "\t    schemes, limiting lines length to 76 characters.",
+  "\n\t    Example: send multipart mail  with a quoted-printable text  message",
+  "\t    and a base64 attached file:",
+  "\n\t\tcurl -F '=text message;encoder=quoted-printable' \\",
+  "\t\t     -F '=@localfile;encoder=base64' ... smtp://example.com",
+  "\n\t    See further examples and details in the MANUAL. --form can  be used",
+  "\t    several times in a command line",
+  "\n\t    Example:",
+  "\t     curl --form \"name=curl\" --form \"file=@loadthis\" \\",
+  "\t\t  https://example.com",
+  "\n\t    This  option  is  mutually   exclusive  with  --data,  --head   and",
+  "\t    --upload-file. See also --data, --form-string and --form-escape.",
+  "\n    --form-escape",
+  "\t    (HTTP imap smtp) Pass on  names of multipart form fields and  files",
+  "\t    using   backslash-escaping   instead   of   percent-encoding.    If",
+  "\t    --form-escape is  provided several  times, the  last set  value  is",
+  "\t    used.",
+  "\n\t    Example:",
+  "\t     curl --form-escape -F 'field\\name=curl' -F 'file=@load\"this' \\",
+  "\t\t  https://example.com",
+  "\n\t    Added in 7.81.0. See also --form.",
+  "\n    --form-string <name=string>",
+  "\t    (HTTP SMTP IMAP)  Similar to  --form except that  the value  string",
+  "\t    for  the named  parameter  is  used  literally.  Leading  @  and  <",
+  "\t    characters, and the \";type=\"  string in the  value have no  special",
+  "\t    meaning.  Use  this  in  preference  to  --form  if  there  is  any",
+  "\t    possibility that the  string value may  accidentally trigger the  @",
+  "\t    or < features of  --form. --form-string can  be used several  times",
+  "\t    in a command line",
+  "\n\t    Example:",
+  "\t     curl --form-string \"name=data\" https://example.com",
+  "\n\t    See also --form.",
+  "\n    --ftp-account <data>",
+  "\t    (FTP) When an  FTP server  asks for \"account  data\" after  username",
+  "\t    and password has  been provided, this  data is  sent off using  the",
+  "\t    ACCT command. If --ftp-account is provided several times, the  last",
+  "\t    set value is used.",
+  "\n\t    Example:",
+  "\t     curl --ftp-account \"mr.robot\" ftp://example.com/",
+  "\n\t    See also --user.",
+  "\n    --ftp-alternative-to-user <command>",
+  "\t    (FTP) If  authenticating with  the USER  and PASS  commands  fails,",
+  "\t    send  this  command.   When  connecting   to  Tumbleweed's   Secure",
+  "\t    Transport server over FTPS using a client certificate, using  \"SITE",
+  "\t    AUTH\"  tells  the  server  to   retrieve  the  username  from   the",
+  "\t    certificate.  If  --ftp-alternative-to-user  is  provided   several",
+  "\t    times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --ftp-alternative-to-user \"U53r\" ftp://example.com",
+  "\n\t    See also --ftp-account and --user.",
+  "\n    --ftp-create-dirs",
+  "\t    (FTP SFTP) When an FTP or SFTP URL/operation uses a path  that does",
+  "\t    not currently exist on  the server, the  standard behavior of  curl",
+  "\t    is to  fail. Using  this option,  curl instead  attempts to  create",
+  "\t    missing directories.  Providing  --ftp-create-dirs  multiple  times",
+  "\t    has no extra effect. Disable it again with --no-ftp-create-dirs.",
+  "\n\t    Example:",
+  "\t     curl --ftp-create-dirs -T file ftp://example.com/remote/path/file",
+  "\n\t    See also --create-dirs.",
+  "\n    --ftp-method <method>",
+  "\t    (FTP) Control what  method curl should  use to reach  a file on  an",
+  "\t    FTP(S) server. The method argument  should be one of the  following",
+  "\t    alternatives:",
+  "\n\t    multicwd",
+  "\n\t\tDo a single CWD operation for each path part in the  given URL.",
+  "\t\tFor deep hierarchies this means many commands. This is how  RFC",
+  "\t\t1738 says  it  should be  done. This  is  the default  but  the",
+  "\t\tslowest behavior.",
+  "\n\t    nocwd",
+  "\n\t\tDo no CWD at all. curl does SIZE, RETR, STOR etc and  gives the",
+  "\t\tfull path to  the server for  each of  these commands. This  is",
+  "\t\tthe fastest behavior.",
+  "\n\t    singlecwd",
+  "\n\t\tDo one CWD with the  full target directory and then operate  on",
+  "\t\tthe file  \"normally\"  (like  in the  multicwd  case).  This  is",
+  "\t\tsomewhat more standards compliant than \"nocwd\" but without  the",
+  "\t\tfull penalty of \"multicwd\".",
+  "\n\t    If --ftp-method is provided  several times, the  last set value  is",
+  "\t    used.",
+  "\n\t    Examples:",
+  "\t     curl --ftp-method multicwd ftp://example.com/dir1/dir2/file",
+  "\t     curl --ftp-method nocwd ftp://example.com/dir1/dir2/file",
+  "\t     curl --ftp-method singlecwd ftp://example.com/dir1/dir2/file",
+  "\n\t    See also --list-only.",
+  "\n    --ftp-pasv",
+  "\t    (FTP) Use  passive mode  for the  data connection.  Passive is  the",
+  "\t    internal default behavior,  but using  this option can  be used  to",
+  "\t    override a previous --ftp-port option.",
+  "\n\t    Reversing an enforced  passive really  is not doable  but you  must",
+  "\t    then instead enforce the correct --ftp-port again.",
+  "\n\t    Passive mode means that curl tries the EPSV command first  and then",
+  "\t    PASV, unless --disable-epsv is used. Providing --ftp-pasv  multiple",
+  "\t    times has no extra effect.",
+  "\n\t    Example:",
+  "\t     curl --ftp-pasv ftp://example.com/",
+  "\n\t    This  option  is  mutually  exclusive  with  --ftp-port.  See  also",
+  "\t    --disable-epsv.",
+  "\n    -P, --ftp-port <address>",
+  "\t    (FTP) Reverse the default initiator/listener roles when  connecting",
+  "\t    with FTP.  This  option  makes  curl use  active  mode.  curl  then",
+  "\t    commands the  server  to connect  back  to the  client's  specified",
+  "\t    address and port, while  passive mode asks  the server to setup  an",
+  "\t    IP address and port for it  to connect to. <address> should be  one",
+  "\t    of:",
+  "\n\t    interface",
+  "\n\t\te.g. eth0 to specify which  interface's IP address you want  to",
+  "\t\tuse (Unix only)",
+  "\n\t    IP address",
+  "\n\t\te.g. 192.168.10.1 to specify the exact IP address",
+  "\n\t    hostname",
+  "\n\t\te.g. my.host.domain to specify the machine",
+  "\n\t    -",
+  "\n\t\tmake curl pick  the same IP  address that  is already used  for",
+  "\t\tthe control connection. This is the recommended choice.",
+  "\n\t    Disable the use  of PORT  with --ftp-pasv. Disable  the attempt  to",
+  "\t    use the EPRT command instead of PORT by using --disable-eprt.  EPRT",
+  "\t    is really PORT++.",
+  "\n\t    You can also append \":[start]-[end]\"  to the right of the  address,",
+  "\t    to tell curl what TCP port  range to use. That means you specify  a",
+  "\t    port range, from a lower to a higher number. A single  number works",
+  "\t    as well, but do  note that it increases  the risk of failure  since",
+  "\t    the port may not  be available. If  --ftp-port is provided  several",
+  "\t    times, the last set value is used.",
+  "\n\t    Examples:",
+  "\t     curl -P - ftp:/example.com",
+  "\t     curl -P eth0 ftp:/example.com",
+  "\t     curl -P 192.168.0.2 ftp:/example.com",
+  "\n\t    See also --ftp-pasv and --disable-eprt.",
+  "\n    --ftp-pret",
+  "\t    (FTP) Send  a PRET  command  before PASV  (and EPSV).  Certain  FTP",
+  "\t    servers, mainly  drftpd,  require  this  non-standard  command  for",
+  "\t    directory listings  as  well as  up  and downloads  in  PASV  mode.",
+  "\t    Providing --ftp-pret multiple  times has no  extra effect.  Disable",
+  "\t    it again with --no-ftp-pret.",
+  "\n\t    Example:",
+  "\t     curl --ftp-pret ftp://example.com/",
+  "\n\t    See also --ftp-port and --ftp-pasv.",
+  "\n    --ftp-skip-pasv-ip",
+  "\t    (FTP) Do  not  use  the  IP  address the  server  suggests  in  its",
+  "\t    response to  curl's  PASV  command  when  curl  connects  the  data",
+  "\t    connection. Instead  curl reuses  the same  IP address  it  already",
+  "\t    uses for the control connection.",
+  "\n\t    This option is enabled by default (added in 7.74.0).",
+  "\n\t    This option has no effect if PORT, EPRT or EPSV is used  instead of",
+  "\t    PASV. Providing  --ftp-skip-pasv-ip  multiple times  has  no  extra",
+  "\t    effect. Disable it again with --no-ftp-skip-pasv-ip.",
+  "\n\t    Example:",
+  "\t     curl --ftp-skip-pasv-ip ftp://example.com/",
+  "\n\t    See also --ftp-pasv.",
+  "\n    --ftp-ssl-ccc",
+  "\t    (FTP) Use CCC (Clear Command Channel) Shuts down the SSL/TLS  layer",
+  "\t    after   authenticating.   The   rest   of   the   control   channel",
+  "\t    communication is  unencrypted. This  allows NAT  routers to  follow",
+  "\t    the  FTP  transaction.  The  default  mode  is  passive.  Providing",
+  "\t    --ftp-ssl-ccc multiple times has no extra effect. Disable it  again",
+  "\t    with --no-ftp-ssl-ccc.",
+  "\n\t    Example:",
+  "\t     curl --ftp-ssl-ccc ftps://example.com/",
+  "\n\t    See also --ssl and --ftp-ssl-ccc-mode.",
+  "\n    --ftp-ssl-ccc-mode <active/passive>",
+  "\t    (FTP) Set  the CCC mode.  The passive  mode does  not initiate  the",
+  "\t    shutdown, but instead waits for the  server to do it, and does  not",
+  "\t    reply to the shutdown  from the server.  The active mode  initiates",
+  "\t    the shutdown  and waits  for  a reply  from the  server.  Providing",
+  "\t    --ftp-ssl-ccc-mode multiple times has  no extra effect. Disable  it",
+  "\t    again with --no-ftp-ssl-ccc-mode.",
+  "\n\t    Example:",
+  "\t     curl --ftp-ssl-ccc-mode active --ftp-ssl-ccc ftps://example.com/",
+  "\n\t    See also --ftp-ssl-ccc.",
+  "\n    --ftp-ssl-control",
+  "\t    (FTP) Require  SSL/TLS  for  the FTP  login,  clear  for  transfer.",
+  "\t    Allows secure authentication, but non-encrypted data transfers  for",
+  "\t    efficiency. Fails  the  transfer if  the  server does  not  support",
+  "\t    SSL/TLS. Providing --ftp-ssl-control  multiple times  has no  extra",
+  "\t    effect. Disable it again with --no-ftp-ssl-control.",
+  "\n\t    Example:",
+  "\t     curl --ftp-ssl-control ftp://example.com",
+  "\n\t    See also --ssl.",
+  "\n    -G, --get",
+  "\t    (HTTP) When  used,  this  option  makes  all  data  specified  with",
+  "\t    --data, --data-binary or  --data-urlencode to  be used  in an  HTTP",
+  "\t    GET request instead  of the  POST request that  otherwise would  be",
+  "\t    used. curl appends the provided data to the URL as a query string.",
+  "\n\t    If used  in  combination with  --head,  the POST  data  is  instead",
+  "\t    appended to the URL with  a HEAD request. Providing --get  multiple",
+  "\t    times has no extra effect. Disable it again with --no-get.",
+  "\n\t    Examples:",
+  "\t     curl --get https://example.com",
+  "\t     curl --get -d \"tool=curl\" -d \"age=old\" https://example.com",
+  "\t     curl --get -I -d \"tool=curl\" https://example.com",
+  "\n\t    See also --data and --request.",
+  "\n    -g, --globoff",
+  "\t    Switch off the  URL globbing  function. When you  set this  option,",
+  "\t    you can specify URLs that  contain the letters {}[] without  having",
+  "\t    curl itself interpret them. Note that these letters are not  normal",
+  "\t    legal URL contents but they should be encoded according to  the URI",
+  "\t    standard. Providing --globoff multiple  times has no extra  effect.",
+  "\t    Disable it again with --no-globoff.",
+  "\n\t    Example:",
+  "\t     curl -g \"https://example.com/{[]}}}}\"",
+  "\n\t    See also --config and --disable.",
+  "\n    --happy-eyeballs-timeout-ms <ms>",
+  "\t    Set the timeout for Happy Eyeballs.",
+  "\n\t    Happy Eyeballs is  an algorithm  that attempts to  connect to  both",
+  "\t    IPv4 and  IPv6  addresses  for  dual-stack  hosts,  giving  IPv6  a",
+  "\t    head-start of the  specified number  of milliseconds.  If the  IPv6",
+  "\t    address cannot be connected to within that time, then a  connection",
+  "\t    attempt  is made  to  the  IPv4  address  in  parallel.  The  first",
+  "\t    connection to be established is the one that is used.",
+  "\n\t    The range of  suggested useful  values is  limited. Happy  Eyeballs",
+  "\t    RFC 6555 says \"It is RECOMMENDED that connection attempts be  paced",
+  "\t    150-250 ms apart  to balance human  factors against network  load.\"",
+  "\t    libcurl currently defaults to 200 ms. Firefox and Chrome  currently",
+  "\t    default to  300  ms.  If  --happy-eyeballs-timeout-ms  is  provided",
+  "\t    several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --happy-eyeballs-timeout-ms 500 https://example.com",
+  "\n\t    See also --max-time and --connect-timeout.",
+  "\n    --haproxy-clientip <ip>",
+  "\t    (HTTP) Set a client IP in  HAProxy PROXY protocol v1 header at  the",
+  "\t    beginning of the connection.",
+  "\n\t    For valid requests, IPv4  addresses must be  indicated as a  series",
+  "\t    of exactly 4 integers  in the range  [0..255] inclusive written  in",
+  "\t    decimal representation separated  by exactly one  dot between  each",
+  "\t    other. Heading  zeroes are  not permitted  in front  of numbers  in",
+  "\t    order to  avoid any  possible confusion  with octal  numbers.  IPv6",
+  "\t    addresses must  be  indicated as  series  of 4  hexadecimal  digits",
+  "\t    (upper or lower case) delimited by colons between each other,  with",
+  "\t    the acceptance of one double colon sequence to replace the  largest",
+  "\t    acceptable  range  of  consecutive  zeroes.  The  total  number  of",
+  "\t    decoded bits must be exactly 128.",
+  "\n\t    Otherwise, any string  can be accepted  for the  client IP and  get",
+  "\t    sent.",
+  "\n\t    It replaces  --haproxy-protocol if  used, it  is not  necessary  to",
+  "\t    specify both  flags.  If  --haproxy-clientip  is  provided  several",
+  "\t    times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --haproxy-clientip $IP",
+  "\n\t    Added in 8.2.0. See also --proxy.",
+  "\n    --haproxy-protocol",
+  "\t    (HTTP) Send a HAProxy PROXY protocol v1 header at the  beginning of",
+  "\t    the connection. This  is used  by some load  balancers and  reverse",
+  "\t    proxies to indicate the client's true IP address and port.",
+  "\n\t    This option is  primarily useful  when sending test  requests to  a",
+  "\t    service that  expects  this  header.  Providing  --haproxy-protocol",
+  "\t    multiple  times  has  no  extra  effect.  Disable  it  again   with",
+  "\t    --no-haproxy-protocol.",
+  "\n\t    Example:",
+  "\t     curl --haproxy-protocol https://example.com",
+  "\n\t    Added in 7.60.0. See also --proxy.",
+  "\n    -I, --head",
+  "\t    (HTTP FTP FILE)  Fetch the headers  only. HTTP-servers feature  the",
+  "\t    command HEAD which  this uses to  get nothing but  the header of  a",
+  "\t    document. When used on an FTP  or FILE URL, curl displays the  file",
+  "\t    size and  last modification  time only.  Providing --head  multiple",
+  "\t    times has no extra effect. Disable it again with --no-head.",
+  "\n\t    Example:",
+  "\t     curl -I https://example.com",
+  "\n\t    See also --get, --verbose and --trace-ascii.",
+  "\n    -H, --header <header/@file>",
+  "\t    (HTTP IMAP SMTP) Extra header to include in information sent.  When",
+  "\t    used within an  HTTP request, it  is added  to the regular  request",
+  "\t    headers.",
+  "\n\t    For an IMAP or SMTP  MIME uploaded mail built with --form  options,",
+  "\t    it  is  prepended  to  the  resulting  MIME  document,  effectively",
+  "\t    including it  at the  mail global  level. It  does  not affect  raw",
+  "\t    uploaded mails.",
+  "\n\t    You may  specify any  number of  extra headers.  Note  that if  you",
+  "\t    should add a  custom header that has  the same name  as one of  the",
+  "\t    internal ones curl would  use, your externally  set header is  used",
+  "\t    instead of the internal one. This allows you to make  even trickier",
+  "\t    stuff  than  curl  would  normally  do.  You  should  not   replace",
+  "\t    internally set headers without knowing perfectly well what you  are",
+  "\t    doing. Remove an  internal header by  giving a replacement  without",
+  "\t    content on the right side of  the colon, as in: -H \"Host:\". If  you",
+  "\t    send the  custom  header with  no-value  then its  header  must  be",
+  "\t    terminated with a semicolon, such as -H \"X-Custom-Header;\" to  send",
+  "\t    \"X-Custom-Header:\".",
+  "\n\t    curl makes sure that each  header you add/replace is sent with  the",
+  "\t    proper end-of-line marker, you should  thus not add that as a  part",
+  "\t    of the header  content: do  not add newlines  or carriage  returns,",
+  "\t    they only  mess things  up for  you. curl  passes  on the  verbatim",
+  "\t    string you give it  without any filter  or other safe guards.  That",
+  "\t    includes white space and control characters.",
+  "\n\t    This option can  take an  argument in @filename  style, which  then",
+  "\t    adds a header for each line in the input file. Using @-  makes curl",
+  "\t    read the header file from stdin.",
+  "\n\t    Please note that  most anti-spam utilities  check the presence  and",
+  "\t    value of  several  MIME mail  headers:  these are  \"From:\",  \"To:\",",
+  "\t    \"Date:\" and \"Subject:\" among others  and should be added with  this",
+  "\t    option.",
+  "\n\t    You need  --proxy-header to  send custom  headers intended  for  an",
+  "\t    HTTP proxy.",
+  "\n\t    Passing on  a \"Transfer-Encoding:  chunked\"  header when  doing  an",
+  "\t    HTTP request with a  request body, makes  curl send the data  using",
+  "\t    chunked encoding.",
+  "\n\t    WARNING: headers set with this option are set in all  HTTP requests",
+  "\t    -  even  after  redirects  are   followed,  like  when  told   with",
+  "\t    --location. This can lead to  the header being sent to other  hosts",
+  "\t    than the original host,  so sensitive headers  should be used  with",
+  "\t    caution combined with following redirects.",
+  "\n\t    \"Authorization:\" and \"Cookie:\"  headers are  explicitly not  passed",
+  "\t    on in  HTTP requests  when following  redirects to  other  origins,",
+  "\t    unless --location-trusted  is used.  --header can  be used  several",
+  "\t    times in a command line",
+  "\n\t    Examples:",
+  "\t     curl -H \"X-First-Name: Joe\" https://example.com",
+  "\t     curl -H \"User-Agent: yes-please/2000\" https://example.com",
+  "\t     curl -H \"Host:\" https://example.com",
+  "\t     curl -H @headers.txt https://example.com",
+  "\n\t    See also --user-agent and --referer.",
+  "\n    -h, --help <subject>",
+  "\t    Usage help.  Provide help  for  the subject  given as  an  optional",
+  "\t    argument.",
+  "\n\t    If no  argument  is  provided, curl  displays  the  most  important",
+  "\t    command line arguments.",
+  "\n\t    The argument can  either be a  category or  a command line  option.",
+  "\t    When a category is  provided, curl shows  all command line  options",
+  "\t    within the  given  category. Specify  category  \"all\" to  list  all",
+  "\t    available options.",
+  "\n\t    If \"category\"  is  specified,  curl  displays  all  available  help",
+  "\t    categories.",
+  "\n\t    If the  provided  subject  is  instead  an  existing  command  line",
+  "\t    option, specified either in its  short form with a single dash  and",
+  "\t    a single letter, or in the  long form with two dashes and a  longer",
+  "\t    name, curl displays a help text for that option in the terminal.",
+  "\n\t    The help output is extensive for some options.",
+  "\n\t    If the provided command line option is not known, curl says so.",
+  "\n\t    Examples:",
+  "\t     curl --help all",
+  "\t     curl --help --insecure",
+  "\t     curl --help -f",
+  "\n\t    See also --verbose.",
+  "\n    --hostpubmd5 <md5>",
+  "\t    (SFTP SCP)  Pass a  string containing  32 hexadecimal  digits.  The",
+  "\t    string should  be the 128  bit MD5  checksum of  the remote  host's",
+  "\t    public key, curl refuses  the connection with  the host unless  the",
+  "\t    checksums match.  If --hostpubmd5  is provided  several times,  the",
+  "\t    last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --hostpubmd5 e5c1c49020640a5ab0f2034854c321a8 \\",
+  "\t\t  sftp://example.com/",
+  "\n\t    See also --hostpubsha256.",
+  "\n    --hostpubsha256 <sha256>",
+  "\t    (SFTP SCP) Pass  a string containing  a Base64-encoded SHA256  hash",
+  "\t    of the remote host's public  key. curl refuses the connection  with",
+  "\t    the host unless the hashes match.",
+  "\n\t    This feature requires  libcurl to  be built with  libssh2 and  does",
+  "\t    not work with  other SSH backends.  If --hostpubsha256 is  provided",
+  "\t    several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --hostpubsha256 NDVkMTQxMGQ1ODdmMjQ3MjczYjAyOTY5MmRkMjVmNDQ=\\",
+  "\t\t   sftp://example.com/",
+  "\n\t    Added in 7.80.0. See also --hostpubmd5.",
+  "\n    --hsts <filename>",
+  "\t    (HTTPS) Enable HSTS for the transfer. If the filename points  to an",
+  "\t    existing  HSTS  cache  file,  that  is  used.  After  a   completed",
+  "\t    transfer, the cache is saved to  the filename again if it has  been",
+  "\t    modified.",
+  "\n\t    If curl is told to use HTTP:// for a transfer involving  a hostname",
+  "\t    that exists  in the HSTS  cache, it  upgrades the  transfer to  use",
+  "\t    HTTPS. Each  HSTS  cache entry  has  an individual  lifetime  after",
+  "\t    which the upgrade is no longer performed.",
+  "\n\t    Specify a \"\"  filename (zero  length) to  avoid loading/saving  and",
+  "\t    make curl just handle HSTS in memory.",
+  "\n\t    If this option is used several times, curl loads contents  from all",
+  "\t    the files but the last one  is used for saving. --hsts can be  used",
+  "\t    several times in a command line",
+  "\n\t    Example:",
+  "\t     curl --hsts cache.txt https://example.com",
+  "\n\t    Added in 7.74.0. See also --proto.",
+  "\n    --http0.9",
+  "\t    (HTTP) Accept an HTTP version 0.9 response.",
+  "\n\t    HTTP/0.9 is a response without  headers and therefore you can  also",
+  "\t    connect with  this to  non-HTTP servers  and still  get a  response",
+  "\t    since curl simply transparently downgrades - if allowed.",
+  "\n\t    HTTP/0.9  is  disabled  by  default  (added  in  7.66.0)  Providing",
+  "\t    --http0.9 multiple  times has  no extra  effect. Disable  it  again",
+  "\t    with --no-http0.9.",
+  "\n\t    Example:",
+  "\t     curl --http0.9 https://example.com",
+  "\n\t    Added in 7.64.0. See also --http1.1, --http2 and --http3.",
+  "\n    -0, --http1.0",
+  "\t    (HTTP) Use  HTTP  version  1.0  instead  of  using  its  internally",
+  "\t    preferred HTTP version. Providing  --http1.0 multiple times has  no",
+  "\t    extra effect.",
+  "\n\t    Example:",
+  "\t     curl --http1.0 https://example.com",
+  "\n\t    This  option  is  mutually   exclusive  with  --http1.1,   --http2,",
+  "\t    --http2-prior-knowledge  and  --http3.   See  also  --http0.9   and",
+  "\t    --http1.1.",
+  "\n    --http1.1",
+  "\t    (HTTP) Use  HTTP version  1.1.  This is  the default  with  HTTP://",
+  "\t    URLs. Providing --http1.1 multiple times has no extra effect.",
+  "\n\t    Example:",
+  "\t     curl --http1.1 https://example.com",
+  "\n\t    This  option  is  mutually   exclusive  with  --http1.0,   --http2,",
+  "\t    --http2-prior-knowledge  and  --http3.   See  also  --http1.0   and",
+  "\t    --http0.9.",
+  "\n    --http2",
+  "\t    (HTTP) Use HTTP/2.",
+  "\n\t    For HTTPS, this means curl negotiates HTTP/2 in the TLS  handshake.",
+  "\t    curl does this by default.",
+  "\n\t    For HTTP,  this  means curl  attempts  to upgrade  the  request  to",
+  "\t    HTTP/2 using the Upgrade: request header.",
+  "\n\t    When curl uses HTTP/2 over HTTPS, it does not itself insist  on TLS",
+  "\t    1.2 or higher even though that is required by the  specification. A",
+  "\t    user can  add this  version requirement  with --tlsv1.2.  Providing",
+  "\t    --http2 multiple times has no extra effect.",
+  "\n\t    Example:",
+  "\t     curl --http2 https://example.com",
+  "\n\t    --http2 requires  that libcurl  is built  to support  HTTP/2.  This",
+  "\t    option   is   mutually   exclusive   with   --http1.1,   --http1.0,",
+  "\t    --http2-prior-knowledge and  --http3. See  also --http1.1,  --http3",
+  "\t    and --no-alpn.",
+  "\n    --http2-prior-knowledge",
+  "\t    (HTTP) Issue a non-TLS HTTP  request using HTTP/2 directly  without",
+  "\t    HTTP/1.1 Upgrade.  It  requires  prior knowledge  that  the  server",
+  "\t    supports HTTP/2 straight away. HTTPS  requests still do HTTP/2  the",
+  "\t    standard  way  with  negotiated   protocol  versions  in  the   TLS",
+  "\t    handshake.",
+  "\n\t    Since 8.10.0 if this  option is set for  an HTTPS request then  the",
+  "\t    application layer protocol version (ALPN) offered to the server  is",
+  "\t    only HTTP/2. Prior to that  both HTTP/1.1 and HTTP/2 were  offered.",
+  "\t    Providing  --http2-prior-knowledge  multiple  times  has  no  extra",
+  "\t    effect. Disable it again with --no-http2-prior-knowledge.",
+  "\n\t    Example:",
+  "\t     curl --http2-prior-knowledge https://example.com",
+  "\n\t    --http2-prior-knowledge requires that libcurl  is built to  support",
+  "\t    HTTP/2.  This  option   is  mutually   exclusive  with   --http1.1,",
+  "\t    --http1.0, --http2 and --http3. See also --http2 and --http3.",
+  "\n    --http3",
+  "\t    (HTTP) Attempt  HTTP/3 to  the host  in the  URL,  but fallback  to",
+  "\t    earlier HTTP versions if the HTTP/3 connection establishment  fails",
+  "\t    or is slow.  HTTP/3 is only  available for HTTPS  and not for  HTTP",
+  "\t    URLs.",
+  "\n\t    This option  allows a user  to avoid  using the  Alt-Svc method  of",
+  "\t    upgrading to  HTTP/3  when you  know  or suspect  that  the  target",
+  "\t    speaks HTTP/3 on the given host and port.",
+  "\n\t    When asked to  use HTTP/3, curl  issues a  separate attempt to  use",
+  "\t    older HTTP versions with a slight delay, so if the  HTTP/3 transfer",
+  "\t    fails or is slow,  curl still tries to  proceed with an older  HTTP",
+  "\t    version. The  fallback  performs the  regular  negotiation  between",
+  "\t    HTTP/1 and HTTP/2.",
+  "\n\t    Use --http3-only  for  similar functionality  without  a  fallback.",
+  "\t    Providing --http3 multiple times has no extra effect.",
+  "\n\t    Example:",
+  "\t     curl --http3 https://example.com",
+  "\n\t    --http3 requires  that libcurl  is built  to support  HTTP/3.  This",
+  "\t    option is mutually  exclusive with  --http1.1, --http1.0,  --http2,",
+  "\t    --http2-prior-knowledge and  --http3-only.  Added  in  7.66.0.  See",
+  "\t    also --http1.1 and --http2.",
+  "\n    --http3-only",
+  "\t    (HTTP) Instruct curl to use HTTP/3 to the host in the URL,  with no",
+  "\t    fallback to  earlier HTTP  versions. HTTP/3  can only  be used  for",
+  "\t    HTTPS and  not for HTTP  URLs. For  HTTP, this  option triggers  an",
+  "\t    error.",
+  "\n\t    This option  allows a user  to avoid  using the  Alt-Svc method  of",
+  "\t    upgrading to HTTP/3 when you know that the target speaks  HTTP/3 on",
+  "\t    the given host and port.",
+  "\n\t    This  option makes  curl  fail  if  a  QUIC  connection  cannot  be",
+  "\t    established, it does  not attempt  any other HTTP  versions on  its",
+  "\t    own.  Use  --http3  for  similar  functionality  with  a  fallback.",
+  "\t    Providing --http3-only multiple times has no extra effect.",
+  "\n\t    Example:",
+  "\t     curl --http3-only https://example.com",
+  "\n\t    --http3-only requires  that libcurl  is  built to  support  HTTP/3.",
+  "\t    This  option  is  mutually  exclusive  with  --http1.1,  --http1.0,",
+  "\t    --http2, --http2-prior-knowledge and --http3. Added in 7.88.0.  See",
+  "\t    also --http1.1, --http2 and --http3.",
+  "\n    --ignore-content-length",
+  "\t    (FTP HTTP)  For HTTP,  ignore the  Content-Length header.  This  is",
+  "\t    particularly useful for servers  running Apache 1.x, which  reports",
+  "\t    incorrect Content-Length for files larger than 2 gigabytes.",
+  "\n\t    For FTP, this makes  curl skip the SIZE  command to figure out  the",
+  "\t    size before downloading  a file. Providing  --ignore-content-length",
+  "\t    multiple  times  has  no  extra  effect.  Disable  it  again   with",
+  "\t    --no-ignore-content-length.",
+  "\n\t    Example:",
+  "\t     curl --ignore-content-length https://example.com",
+  "\n\t    See also --ftp-skip-pasv-ip.",
+  "\n    -k, --insecure",
+  "\t    (TLS SFTP SCP) By  default, every secure  connection curl makes  is",
+  "\t    verified to be secure before the transfer takes place. This  option",
+  "\t    makes  curl  skip  the   verification  step  and  proceed   without",
+  "\t    checking.",
+  "\n\t    When  this option  is  not  used  for  protocols  using  TLS,  curl",
+  "\t    verifies the  server's TLS  certificate before  it continues:  that",
+  "\t    the certificate contains the right name which matches the  hostname",
+  "\t    used in the URL  and that the certificate has  been signed by a  CA",
+  "\t    certificate present in  the cert  store. See  this online  resource",
+  "\t    for further details: https://curl.se/docs/sslcerts.html",
+  "\n\t    For SFTP  and SCP,  this  option makes  curl skip  the  known_hosts",
+  "\t    verification. known_hosts is a file  normally stored in the  user's",
+  "\t    home  directory  in   the  \".ssh\"   subdirectory,  which   contains",
+  "\t    hostnames and their public keys.",
+  "\n\t    WARNING: using this option makes the transfer insecure.",
+  "\n\t    When curl uses secure protocols it trusts responses and allows  for",
+  "\t    example  HSTS  and  Alt-Svc  information  to  be  stored  and  used",
+  "\t    subsequently. Using --insecure  can make  curl trust  and use  such",
+  "\t    information from malicious  servers. Providing --insecure  multiple",
+  "\t    times has no extra effect. Disable it again with --no-insecure.",
+  "\n\t    Example:",
+  "\t     curl --insecure https://example.com",
+  "\n\t    See also --proxy-insecure, --cacert and --capath.",
+  "\n    --interface <name>",
+  "\t    Perform the operation  using a specified  interface. You can  enter",
+  "\t    interface name,  IP  address  or  hostname. If  you  prefer  to  be",
+  "\t    specific, you can use the following special syntax:",
+  "\n\t    if!<name>",
+  "\n\t\tInterface  name.  If  the  provided  name  does  not  match  an",
+  "\t\texisting interface, curl returns with error 45.",
+  "\n\t    host!<name>",
+  "\n\t\tIP address or hostname.",
+  "\n\t    ifhost!<interface>!<host>",
+  "\n\t\tInterface  name  and  IP  address  or  hostname.  This   syntax",
+  "\t\trequires libcurl 8.9.0 or later.",
+  "\n\t\tIf the  provided name  does not  match an  existing  interface,",
+  "\t\tcurl returns with error 45.",
+  "\n\t    curl does  not  support  using network  interface  names  for  this",
+  "\t    option on Windows.",
+  "\n\t    That name resolve operation if a hostname is provided does  not use",
+  "\t    DNS-over-HTTPS even if --doh-url is set.",
+  "\n\t    On Linux this option can be used to specify a VRF  (Virtual Routing",
+  "\t    and Forwarding) device, but  the binary then  needs to either  have",
+  "\t    the  CAP_NET_RAW  capability  set  or   to  be  run  as  root.   If",
+  "\t    --interface is provided several times, the last set value is used.",
+  "\n\t    Examples:",
+  "\t     curl --interface eth0 https://example.com",
+  "\t     curl --interface \"host!10.0.0.1\" https://example.com",
+  "\t     curl --interface \"if!enp3s0\" https://example.com",
+  "\n\t    See also --dns-interface.",
+  "\n    --ip-tos <string>",
+  "\t    (All) Set  Type of  Service (TOS)  for IPv4  or  Traffic Class  for",
+  "\t    IPv6.",
+  "\n\t    The values allowed for  <string> can be  a numeric value between  1",
+  "\t    and 255 or one of the following:",
+  "\n\t    CS0, CS1, CS2,  CS3, CS4, CS5,  CS6, CS7,  AF11, AF12, AF13,  AF21,",
+  "\t    AF22, AF23, AF31,  AF32, AF33, AF41,  AF42, AF43, EF,  VOICE-ADMIT,",
+  "\t    ECT1, ECT0,  CE, LE,  LOWCOST, LOWDELAY,  THROUGHPUT,  RELIABILITY,",
+  "\t    MINCOST If --ip-tos is provided  several times, the last set  value",
+  "\t    is used.",
+  "\n\t    Example:",
+  "\t     curl --ip-tos CS5 https://example.com",
+  "\n\t    Added in 8.9.0. See also --tcp-nodelay and --vlan-priority.",
+  "\n    --ipfs-gateway <URL>",
+  "\t    (IPFS) Specify which  gateway to use  for IPFS  and IPNS URLs.  Not",
+  "\t    specifying this  instead  makes  curl  check  if  the  IPFS_GATEWAY",
+  "\t    environment  variable  is  set,  or  if  a  \"~/.ipfs/gateway\"  file",
+  "\t    holding the gateway URL exists.",
+  "\n\t    If you run a local IPFS node, this gateway is by  default available",
+  "\t    under \"http://localhost:8080\". A full example URL would look like:",
+  "\n\t\tcurl --ipfs-gateway http://localhost:8080 \\",
+  "\t\t   ipfs://bafybeigagd5nmnn2iys2f3",
+  "\n\t    There  are   many   public   IPFS  gateways.   See   for   example:",
+  "\t    https://ipfs.github.io/public-gateway-checker/",
+  "\n\t    If you opt to  go for a  remote gateway you need  to be aware  that",
+  "\t    you completely  trust the  gateway.  This might  be fine  in  local",
+  "\t    gateways that you host yourself.  With remote gateways there  could",
+  "\t    potentially be malicious  actors returning you  data that does  not",
+  "\t    match the  request you  made, inspect  or even  interfere with  the",
+  "\t    request. You  may not  notice this  when using  curl. A  mitigation",
+  "\t    could be to go  for a \"trustless\"  gateway. This means you  locally",
+  "\t    verify the data.  Consult the  docs page on  trusted vs  trustless:",
+  "\t    https://docs.ipfs.tech/reference/http/gateway/#trusted-vs-trustless",
+  "\t    If --ipfs-gateway is provided several times, the last set value  is",
+  "\t    used.",
+  "\n\t    Example:",
+  "\t     curl --ipfs-gateway https://example.com ipfs://",
+  "\n\t    Added in 8.4.0. See also --help and --manual.",
+  "\n    -4, --ipv4",
+  "\t    Use IPv4  addresses  only when  resolving  hostnames, and  not  for",
+  "\t    example try  IPv6. Providing  --ipv4 multiple  times has  no  extra",
+  "\t    effect.",
+  "\n\t    Example:",
+  "\t     curl --ipv4 https://example.com",
+  "\n\t    This option is mutually exclusive  with --ipv6. See also  --http1.1",
+  "\t    and --http2.",
+  "\n    -6, --ipv6",
+  "\t    Use IPv6  addresses  only when  resolving  hostnames, and  not  for",
+  "\t    example try IPv4.",
+  "\n\t    Your resolver  may  respond  to an  IPv6-only  resolve  request  by",
+  "\t    returning IPv6 addresses that  contain \"mapped\" IPv4 addresses  for",
+  "\t    compatibility purposes.  macOS  is  known  to  do  this.  Providing",
+  "\t    --ipv6 multiple times has no extra effect.",
+  "\n\t    Example:",
+  "\t     curl --ipv6 https://example.com",
+  "\n\t    This option is mutually exclusive  with --ipv4. See also  --http1.1",
+  "\t    and --http2.",
+  "\n    --json <data>",
+  "\t    (HTTP) Send the specified JSON data  in a POST request to the  HTTP",
+  "\t    server. --json  works as  a  shortcut for  passing on  these  three",
+  "\t    options:",
+  "\n\t\t--data-binary [arg]",
+  "\t\t--header \"Content-Type: application/json\"",
+  "\t\t--header \"Accept: application/json\"",
+  "\n\t    There is no verification that the passed in data is actual  JSON or",
+  "\t    that the syntax is correct.",
+  "\n\t    If you  start the data  with the  letter @,  the rest  should be  a",
+  "\t    filename to read the  data from, or a single  dash (-) if you  want",
+  "\t    curl to read the  data from stdin. Posting  data from a file  named",
+  "\t    'foobar' would  thus be  done with  --json @foobar  and to  instead",
+  "\t    read the data from stdin, use --json @-.",
+  "\n\t    If this option  is used more  than once on  the same command  line,",
+  "\t    the additional data pieces are concatenated to the previous  before",
+  "\t    sending.",
+  "\n\t    The headers this  option sets  can be overridden  with --header  as",
+  "\t    usual. --json can be used several times in a command line",
+  "\n\t    Examples:",
+  "\t     curl --json '{ \"drink\": \"coffee\" }' https://example.com",
+  "\t     curl --json '{ \"drink\":' --json ' \"coffee\" }' https://example.com",
+  "\t     curl --json @prepared https://example.com",
+  "\t     curl --json @- https://example.com < json.txt",
+  "\n\t    This  option  is  mutually   exclusive  with  --form,  --head   and",
+  "\t    --upload-file.  Added  in  7.82.0.   See  also  --data-binary   and",
+  "\t    --data-raw.",
+  "\n    -j, --junk-session-cookies",
+  "\t    (HTTP) When curl is  told to read cookies  from a given file,  this",
+  "\t    option makes it discard  all \"session cookies\".  This has the  same",
+  "\t    effect as if  a new  session is started.  Typical browsers  discard",
+  "\t    session   cookies   when   they   are   closed   down.    Providing",
+  "\t    --junk-session-cookies multiple times has no extra effect.  Disable",
+  "\t    it again with --no-junk-session-cookies.",
+  "\n\t    Example:",
+  "\t     curl --junk-session-cookies -b cookies.txt https://example.com",
+  "\n\t    See also --cookie and --cookie-jar.",
+  "\n    --keepalive-cnt <integer>",
+  "\t    Set the maximum number of keepalive probes TCP should send  but get",
+  "\t    no response before dropping the connection. This option is  usually",
+  "\t    used in conjunction with --keepalive-time.",
+  "\n\t    This  option   is   supported   on   Linux,   *BSD/macOS,   Windows",
+  "\t    >=10.0.16299, Solaris 11.4,  and recent AIX,  HP-UX and more.  This",
+  "\t    option has no effect if --no-keepalive is used.",
+  "\n\t    If unspecified, the  option defaults  to 9.  If --keepalive-cnt  is",
+  "\t    provided several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --keepalive-cnt 3 https://example.com",
+  "\n\t    Added in 8.9.0. See also --keepalive-time and --no-keepalive.",
+  "\n    --keepalive-time <seconds>",
+  "\t    Set the  time a  connection  needs to  remain idle  before  sending",
+  "\t    keepalive probes and the time between individual keepalive  probes.",
+  "\t    It  is  currently  effective  on  operating  systems  offering  the",
+  "\t    \"TCP_KEEPIDLE\" and \"TCP_KEEPINTVL\"  socket options (meaning  Linux,",
+  "\t    *BSD/macOS, Windows,  Solaris, and  recent  AIX, HP-UX  and  more).",
+  "\t    Keepalive is used  by the TCP  stack to  detect broken networks  on",
+  "\t    idle connections.  The number  of  missed keepalive  probes  before",
+  "\t    declaring the connection  down is  OS dependent and  is commonly  8",
+  "\t    (*BSD/macOS/AIX), 9 (Linux/AIX) or 5/10 (Windows), and this  number",
+  "\t    can be changed by specifying the curl option \"keepalive-cnt\".  Note",
+  "\t    that this option has no effect if --no-keepalive is used.",
+  "\n\t    If  unspecified,   the   option   defaults  to   60   seconds.   If",
+  "\t    --keepalive-time is provided several times,  the last set value  is",
+  "\t    used.",
+  "\n\t    Example:",
+  "\t     curl --keepalive-time 20 https://example.com",
+  "\n\t    See also --no-keepalive, --keepalive-cnt and --max-time.",
+  "\n    --key <key>",
+  "\t    (TLS SSH) Private key filename. Allows you to provide your  private",
+  "\t    key in this separate  file. For SSH,  if not specified, curl  tries",
+  "\t    the    following    candidates    in    order:     \"~/.ssh/id_rsa\",",
+  "\t    \"~/.ssh/id_dsa\", \"./id_rsa\", \"./id_dsa\".",
+  "\n\t    If curl is built against OpenSSL library, and the engine  pkcs11 or",
+  "\t    pkcs11 provider is available, then a PKCS#11 URI (RFC 7512)  can be",
+  "\t    used to  specify  a private  key located  in  a PKCS#11  device.  A",
+  "\t    string beginning with  \"pkcs11:\" is interpreted  as a PKCS#11  URI.",
+  "\t    If a PKCS#11 URI  is provided, then the  --engine option is set  as",
+  "\t    \"pkcs11\" if none was provided  and the --key-type option is set  as",
+  "\t    \"ENG\"  or  \"PROV\"  if  none  was  provided  (depending  on  OpenSSL",
+  "\t    version).",
+  "\n\t    If curl is built against  Schannel then this option is ignored  for",
+  "\t    TLS protocols (HTTPS,  etc). That backend  expects the private  key",
+  "\t    to be already present  in the keychain  or PKCS#12 file  containing",
+  "\t    the certificate. If --key is  provided several times, the last  set",
+  "\t    value is used.",
+  "\n\t    Example:",
+  "\t     curl --cert certificate --key here https://example.com",
+  "\n\t    See also --key-type and --cert.",
+  "\n    --key-type <type>",
+  "\t    (TLS)  Private  key  file  type.  Specify  which  type  your  --key",
+  "\t    provided private key is.  DER, PEM, and  ENG are supported. If  not",
+  "\t    specified, PEM  is  assumed.  If  --key-type  is  provided  several",
+  "\t    times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --key-type DER --key here https://example.com",
+  "\n\t    See also --key.",
+  "\n    --krb <level>",
+  "\t    (FTP) Enable Kerberos  authentication and  use. The  level must  be",
+  "\t    entered and should  be one of  'clear', 'safe', 'confidential',  or",
+  "\t    'private'. Should  you  use  a level  that  is not  one  of  these,",
+  "\t    'private' is used.  If --krb  is provided several  times, the  last",
+  "\t    set value is used.",
+  "\n\t    Example:",
+  "\t     curl --krb clear ftp://example.com/",
+  "\n\t    --krb requires that libcurl is built to support Kerberos. See  also",
+  "\t    --delegation and --ssl.",
+  "\n    --libcurl <file>",
+  "\t    Append this option to any  ordinary curl command line, and you  get",
+  "\t    libcurl-using C  source code  written  to the  file that  does  the",
+  "\t    equivalent of what your command-line operation does.",
+  "\n\t    This option is global  and does not need  to be specified for  each",
+  "\t    use of --next.  If --libcurl  is provided several  times, the  last",
+  "\t    set value is used.",
+  "\n\t    Example:",
+  "\t     curl --libcurl client.c https://example.com",
+  "\n\t    See also --verbose.",
+  "\n    --limit-rate <speed>",
+  "\t    Specify the maximum transfer rate you  want curl to use - for  both",
+  "\t    downloads and  uploads.  This  feature  is useful  if  you  have  a",
+  "\t    limited pipe  and you  would like  your transfer  not  to use  your",
+  "\t    entire bandwidth. To make it slower than it otherwise would be.",
+  "\n\t    The given speed  is measured  in bytes/second, unless  a suffix  is",
+  "\t    appended. Appending 'k' or 'K' counts the number as kilobytes,  'm'",
+  "\t    or 'M' makes  it megabytes, while  'g' or  'G' makes it  gigabytes.",
+  "\t    The suffixes (k,  M, G,  T, P) are  1024 based. For  example 1k  is",
+  "\t    1024. Examples: 200K, 3m and 1G.",
+  "\n\t    The rate limiting logic  works on averaging  the transfer speed  to",
+  "\t    no more than the set threshold over a period of multiple seconds.",
+  "\n\t    If you  also  use  the  --speed-limit  option,  that  option  takes",
+  "\t    precedence and might  cripple the rate-limiting  slightly, to  help",
+  "\t    keep the  speed-limit logic  working. If  --limit-rate is  provided",
+  "\t    several times, the last set value is used.",
+  "\n\t    Examples:",
+  "\t     curl --limit-rate 100K https://example.com",
+  "\t     curl --limit-rate 1000 https://example.com",
+  "\t     curl --limit-rate 10M https://example.com",
+  "\n\t    See also --rate, --speed-limit and --speed-time.",
+  "\n    -l, --list-only",
+  "\t    (FTP POP3  SFTP  FILE)  When  listing an  FTP  directory,  force  a",
+  "\t    name-only view.  Maybe particularly  useful if  the user  wants  to",
+  "\t    machine-parse the contents  of an  FTP directory  since the  normal",
+  "\t    directory view does not  use a standard  look or format. When  used",
+  "\t    like this, the  option causes  an NLST  command to be  sent to  the",
+  "\t    server instead of LIST.",
+  "\n\t    Note: Some FTP servers list  only files in their response to  NLST;",
+  "\t    they do not include sub-directories and symbolic links.",
+  "\n\t    When listing  an SFTP  directory, this  switch forces  a  name-only",
+  "\t    view, one per line. This is especially useful if the user  wants to",
+  "\t    machine-parse the contents  of an SFTP  directory since the  normal",
+  "\t    directory view provides more information than just filenames.",
+  "\n\t    When retrieving a specific  email from POP3,  this switch forces  a",
+  "\t    LIST command to be performed instead of RETR. This is  particularly",
+  "\t    useful if the user wants to see if a specific message-id  exists on",
+  "\t    the server and what size it is.",
+  "\n\t    For FILE, this option has  no effect yet as directories are  always",
+  "\t    listed in this mode.",
+  "\n\t    Note: When  combined with  --request, this  option can  be used  to",
+  "\t    send a  UIDL  command instead,  so the  user  may use  the  email's",
+  "\t    unique identifier rather than its  message-id to make the  request.",
+  "\t    Providing --list-only multiple times  has no extra effect.  Disable",
+  "\t    it again with --no-list-only.",
+  "\n\t    Example:",
+  "\t     curl --list-only ftp://example.com/dir/",
+  "\n\t    See also --quote and --request.",
+  "\n    --local-port <range>",
+  "\t    Set a  preferred single  number or  range (FROM-TO)  of local  port",
+  "\t    numbers to use  for the  connection(s). Note that  port numbers  by",
+  "\t    nature are a  scarce resource  so setting this  range to  something",
+  "\t    too narrow might  cause unnecessary connection  setup failures.  If",
+  "\t    --local-port is  provided  several times,  the  last set  value  is",
+  "\t    used.",
+  "\n\t    Example:",
+  "\t     curl --local-port 1000-3000 https://example.com",
+  "\n\t    See also --globoff.",
+  "\n    -L, --location",
+  "\t    (HTTP) If the server reports  that the requested page has moved  to",
+  "\t    a different location (indicated with  a Location: header and a  3XX",
+  "\t    response code), this option makes curl redo the request to  the new",
+  "\t    place. If  used together  with  --show-headers or  --head,  headers",
+  "\t    from all requested pages are shown.",
+  "\n\t    When authentication  is used,  or when  sending a  cookie with  \"-H",
+  "\t    Cookie:\", curl only sends its  credentials to the initial host.  If",
+  "\t    a redirect takes  curl to  a different  host, it does  not get  the",
+  "\t    credentials passed  on. See  --location-trusted  on how  to  change",
+  "\t    this.",
+  "\n\t    Limit the amount of redirects  to follow by using the  --max-redirs",
+  "\t    option.",
+  "\n\t    When curl  follows a  redirect and  if the  request is  a POST,  it",
+  "\t    sends the following  request with a  GET if  the HTTP response  was",
+  "\t    301, 302, or  303. If  the response  code was any  other 3xx  code,",
+  "\t    curl resends  the  following  request  using  the  same  unmodified",
+  "\t    method.",
+  "\n\t    You can tell curl  to not change POST requests  to GET after a  30x",
+  "\t    response by  using  the  dedicated  options  for  that:  --post301,",
+  "\t    --post302 and --post303.",
+  "\n\t    The method  set  with --request  overrides  the method  curl  would",
+  "\t    otherwise select to  use. Providing --location  multiple times  has",
+  "\t    no extra effect. Disable it again with --no-location.",
+  "\n\t    Example:",
+  "\t     curl -L https://example.com",
+  "\n\t    See also --resolve, --alt-svc and --follow.",
+  "\n    --location-trusted",
+  "\t    (HTTP) Instruct curl to follow HTTP redirects like --location,  but",
+  "\t    permit curl to send  credentials and other  secrets along to  other",
+  "\t    hosts than the initial one.",
+  "\n\t    This may  or  may  not introduce  a  security breach  if  the  site",
+  "\t    redirects you to a site to  which you send this sensitive data  to.",
+  "\t    Another host means that  one or more  of hostname, protocol  scheme",
+  "\t    or port number changed.",
+  "\n\t    This option also allows  curl to pass  long cookies set  explicitly",
+  "\t    with --header. Providing --location-trusted  multiple times has  no",
+  "\t    extra effect. Disable it again with --no-location-trusted.",
+  "\n\t    Examples:",
+  "\t     curl --location-trusted -u user:password https://example.com",
+  "\t     curl --location-trusted -H \"Cookie: session=abc\" \\",
+  "\t\t  https://example.com",
+  "\n\t    See also --user and --follow.",
+  "\n    --login-options <options>",
+  "\t    (IMAP LDAP  POP3 SMTP)  Specify  the login  options to  use  during",
+  "\t    server authentication.",
+  "\n\t    You can  use login  options to  specify protocol  specific  options",
+  "\t    that may be used during authentication. At present only IMAP,  POP3",
+  "\t    and SMTP support  login options. For  more information about  login",
+  "\t    options  please  see  RFC  2384,  RFC  5092  and  the   IETF  draft",
+  "\t    https://datatracker.ietf.org/doc/html/draft-earhart-url-smtp-00",
+  "\n\t    Since 8.2.0,  IMAP supports  the login  option \"AUTH=+LOGIN\".  With",
+  "\t    this option, curl uses  the plain (not  SASL) \"LOGIN IMAP\"  command",
+  "\t    even if the server advertises  SASL authentication. Care should  be",
+  "\t    taken in  using this option,  as it  sends your  password over  the",
+  "\t    network in  plain  text. This  does not  work  if the  IMAP  server",
+  "\t    disables the plain \"LOGIN\" (e.g. to prevent password snooping).  If",
+  "\t    --login-options is provided  several times, the  last set value  is",
+  "\t    used.",
+  "\n\t    Example:",
+  "\t     curl --login-options 'AUTH=*' imap://example.com",
+  "\n\t    See also --user.",
+  "\n    --mail-auth <address>",
+  "\t    (SMTP) Specify  a  single address.  This  is used  to  specify  the",
+  "\t    authentication address (identity)  of a submitted  message that  is",
+  "\t    being  relayed  to  another  server.  If  --mail-auth  is  provided",
+  "\t    several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --mail-auth user@example.com -T mail smtp://example.com/",
+  "\n\t    See also --mail-rcpt and --mail-from.",
+  "\n    --mail-from <address>",
+  "\t    (SMTP) Specify  a single  address that  the given  mail should  get",
+  "\t    sent from. If --mail-from is  provided several times, the last  set",
+  "\t    value is used.",
+  "\n\t    Example:",
+  "\t     curl --mail-from user@example.com -T mail smtp://example.com/",
+  "\n\t    See also --mail-rcpt and --mail-auth.",
+  "\n    --mail-rcpt <address>",
+  "\t    (SMTP) Specify a  single email  address, username  or mailing  list",
+  "\t    name.  Repeat  this  option  several  times  to  send  to  multiple",
+  "\t    recipients.",
+  "\n\t    When  performing  an  address  verification  (VRFY  command),   the",
+  "\t    recipient should  be  specified as  the  username or  username  and",
+  "\t    domain (as per Section 3.5 of RFC 5321).",
+  "\n\t    When  performing  a  mailing   list  expand  (EXPN  command),   the",
+  "\t    recipient should be specified using the mailing list name, such  as",
+  "\t    \"Friends\" or  \"London-Office\".  --mail-rcpt  can  be  used  several",
+  "\t    times in a command line",
+  "\n\t    Example:",
+  "\t     curl --mail-rcpt user@example.net smtp://example.com",
+  "\n\t    See also --mail-rcpt-allowfails.",
+  "\n    --mail-rcpt-allowfails",
+  "\t    (SMTP) When sending  data to multiple  recipients, by default  curl",
+  "\t    aborts SMTP conversation if at  least one of the recipients  causes",
+  "\t    RCPT TO command to return an error.",
+  "\n\t    The    default    behavior    can    be    changed    by    passing",
+  "\t    --mail-rcpt-allowfails command-line option which makes curl  ignore",
+  "\t    errors and proceed with the remaining valid recipients.",
+  "\n\t    If all  recipients  trigger  RCPT  TO failures  and  this  flag  is",
+  "\t    specified, curl still aborts the SMTP conversation and returns  the",
+  "\t    error  received  from  to  the  last  RCPT  TO  command.  Providing",
+  "\t    --mail-rcpt-allowfails multiple times has no extra effect.  Disable",
+  "\t    it again with --no-mail-rcpt-allowfails.",
+  "\n\t    Example:",
+  "\t     curl --mail-rcpt-allowfails --mail-rcpt dest@example.com \\",
+  "\t\t  smtp://example.com",
+  "\n\t    Added in 7.69.0. See also --mail-rcpt.",
+  "\n    -M, --manual",
+  "\t    Manual. Display the huge help text.",
+  "\n\t    Example:",
+  "\t     curl --manual",
+  "\n\t    See also --verbose, --libcurl and --trace.",
+  "\n    --max-filesize <bytes>",
+  "\t    (FTP HTTP  MQTT) When set  to a  non-zero value,  it specifies  the",
+  "\t    maximum size  (in  bytes)  of  a  file to  download.  If  the  file",
+  "\t    requested is larger than  this value, the  transfer does not  start",
+  "\t    and curl returns with exit code 63.",
+  "\n\t    Setting the maximum value to zero disables the limit.",
+  "\n\t    A size  modifier may be  used. For  example, Appending  'k' or  'K'",
+  "\t    counts the  number as  kilobytes, 'm'  or 'M'  makes it  megabytes,",
+  "\t    while 'g' or 'G' makes it gigabytes. Examples: 200K, 3m and 1G.",
+  "\n\t    NOTE: before curl 8.4.0, when the  file size is not known prior  to",
+  "\t    download, for  such files this  option has  no effect  even if  the",
+  "\t    file transfer ends up being larger than this given limit.",
+  "\n\t    Starting with curl  8.4.0, this  option aborts the  transfer if  it",
+  "\t    reaches  the  threshold  during  transfer.  If  --max-filesize   is",
+  "\t    provided several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --max-filesize 100K https://example.com",
+  "\n\t    See also --limit-rate.",
+  "\n    --max-redirs <num>",
+  "\t    (HTTP) Set  the  maximum number  of  redirections to  follow.  When",
+  "\t    --location is  used,  to  prevent  curl  from  following  too  many",
+  "\t    redirects, by default, the limit  is set to 50 redirects. Set  this",
+  "\t    option to  -1 to  make it  unlimited. If  --max-redirs is  provided",
+  "\t    several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --max-redirs 3 --location https://example.com",
+  "\n\t    See also --location.",
+  "\n    -m, --max-time <seconds>",
+  "\t    Set the maximum  time in seconds  that you  allow each transfer  to",
+  "\t    take. Prevents your batch jobs  from hanging for hours due to  slow",
+  "\t    networks or links going down. This option accepts decimal values.",
+  "\n\t    If you  enable retrying  the transfer  (--retry) then  the  maximum",
+  "\t    time counter is reset  each time the  transfer is retried. You  can",
+  "\t    use --retry-max-time to limit the retry time.",
+  "\n\t    The decimal value needs to be  provided using a dot (.) as  decimal",
+  "\t    separator -  not  the  local version  even  if it  might  be  using",
+  "\t    another separator.  If --max-time  is provided  several times,  the",
+  "\t    last set value is used.",
+  "\n\t    Examples:",
+  "\t     curl --max-time 10 https://example.com",
+  "\t     curl --max-time 2.92 https://example.com",
+  "\n\t    See also --connect-timeout and --retry-max-time.",
+  "\n    --metalink",
+  "\t    This option was  previously used  to specify  a Metalink  resource.",
+  "\t    Metalink support is  disabled in curl  for security reasons  (added",
+  "\t    in 7.78.0). If --metalink is  provided several times, the last  set",
+  "\t    value is used.",
+  "\n\t    Example:",
+  "\t     curl --metalink file https://example.com",
+  "\n\t    See also --parallel.",
+  "\n    --mptcp",
+  "\t    Enable the use of Multipath  TCP (MPTCP) for connections. MPTCP  is",
+  "\t    an extension to the standard  TCP that allows multiple TCP  streams",
+  "\t    over  different  network   paths  between  the   same  source   and",
+  "\t    destination. This can enhance bandwidth and improve reliability  by",
+  "\t    using multiple paths simultaneously.",
+  "\n\t    MPTCP is beneficial in networks where multiple paths exist  between",
+  "\t    clients and servers,  such as  mobile networks where  a device  may",
+  "\t    switch between WiFi  and cellular  data or in  wired networks  with",
+  "\t    multiple Internet Service Providers.",
+  "\n\t    This option  is currently  only supported  on Linux  starting  from",
+  "\t    kernel 5.6. Only  TCP connections are  modified, hence this  option",
+  "\t    does not affect HTTP/3 (QUIC) or UDP connections.",
+  "\n\t    The server curl connects  to must also  support MPTCP. If not,  the",
+  "\t    connection  seamlessly  falls  back   to  TCP.  Providing   --mptcp",
+  "\t    multiple  times  has  no  extra  effect.  Disable  it  again   with",
+  "\t    --no-mptcp.",
+  "\n\t    Example:",
+  "\t     curl --mptcp https://example.com",
+  "\n\t    Added in 8.9.0. See also --tcp-fastopen.",
+  "\n    --negotiate",
+  "\t    (HTTP) Enable Negotiate (SPNEGO) authentication.",
+  "\n\t    This option requires a library built with GSS-API or SSPI  support.",
+  "\t    Use --version to see if your curl supports GSS-API/SSPI or SPNEGO.",
+  "\n\t    When using this option, you must also provide a fake  --user option",
+  "\t    to activate the authentication code  properly. Sending a '-u :'  is",
+  "\t    enough as the username and password from the --user option  are not",
+  "\t    actually used. Providing  --negotiate multiple times  has no  extra",
+  "\t    effect. Disable it again with --no-negotiate.",
+  "\n\t    Example:",
+  "\t     curl --negotiate -u : https://example.com",
+  "\n\t    See also --basic, --ntlm, --anyauth and --proxy-negotiate.",
+  "\n    -n, --netrc",
+  "\t    Make curl scan  the .netrc file  in the  user's home directory  for",
+  "\t    login name and password.  This is typically  used for FTP on  Unix.",
+  "\t    If used with HTTP, curl  enables user authentication. See  netrc(5)",
+  "\t    and ftp(1) for details on  the file format. curl does not  complain",
+  "\t    if that  file does not  have the  right permissions  (it should  be",
+  "\t    neither  world-  nor  group-readable).  The  environment   variable",
+  "\t    \"HOME\"  is  used  to  find  the  home  directory.  If  the  \"NETRC\"",
+  "\t    environment variable is  set, that  filename is used  as the  netrc",
+  "\t    file. (Added in 8.16.0)",
+  "\n\t    If --netrc-file is used,  that overrides all  other ways to  figure",
+  "\t    out the file.",
+  "\n\t    The netrc file provides credentials  for a hostname independent  of",
+  "\t    which protocol and port number that are used.",
+  "\n\t    On Windows two filenames in the home directory are checked:  .netrc",
+  "\t    and _netrc,  preferring  the  former.  Older  versions  on  Windows",
+  "\t    checked for _netrc only.",
+  "\n\t    A quick and simple example of  how to setup a .netrc to allow  curl",
+  "\t    to FTP to the machine  host.example.com with username 'myself'  and",
+  "\t    password 'secret' could look similar to:",
+  "\n\t\tmachine host.example.com",
+  "\t\tlogin myself",
+  "\t\tpassword secret",
+  "\n\t    Providing --netrc multiple  times has no  extra effect. Disable  it",
+  "\t    again with --no-netrc.",
+  "\n\t    Example:",
+  "\t     curl --netrc https://example.com",
+  "\n\t    This  option   is   mutually  exclusive   with   --netrc-file   and",
+  "\t    --netrc-optional. See also --netrc-file, --config and --user.",
+  "\n    --netrc-file <filename>",
+  "\t    Set the  netrc file to  use. Similar  to --netrc,  except that  you",
+  "\t    also provide the path (absolute or relative).",
+  "\n\t    It abides  by --netrc-optional  if  specified. If  --netrc-file  is",
+  "\t    provided several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --netrc-file netrc https://example.com",
+  "\n\t    This option is mutually exclusive  with --netrc. See also  --netrc,",
+  "\t    --user and --config.",
+  "\n    --netrc-optional",
+  "\t    Similar  to  --netrc,  but  this  option  makes  the  .netrc  usage",
+  "\t    optional and not  mandatory as the  --netrc option does.  Providing",
+  "\t    --netrc-optional multiple  times has  no extra  effect. Disable  it",
+  "\t    again with --no-netrc-optional.",
+  "\n\t    Example:",
+  "\t     curl --netrc-optional https://example.com",
+  "\n\t    This  option  is   mutually  exclusive  with   --netrc.  See   also",
+  "\t    --netrc-file.",
+  "\n    -:, --next",
+  "\t    Use a  separate  operation for  the  following URL  and  associated",
+  "\t    options. This allows you  to send several  URL requests, each  with",
+  "\t    their  own  specific  options,  for  example,  such  as   different",
+  "\t    usernames or custom requests for each.",
+  "\n\t    --next resets all  local options  and only global  ones have  their",
+  "\t    values  survive  over  to   the  operation  following  the   --next",
+  "\t    instruction.   Global   options    include   --verbose,    --trace,",
+  "\t    --trace-ascii and --fail-early.",
+  "\n\t    For example, you can do both a  GET and a POST in a single  command",
+  "\t    line:",
+  "\n\t\tcurl www1.example.com --next -d postthis www2.example.com",
+  "\n\t    --next can be used several times in a command line",
+  "\n\t    Examples:",
+  "\t     curl https://example.com --next -d postthis www2.example.com",
+  "\t     curl -I https://example.com --next https://example.net/",
+  "\n\t    See also --parallel and --config.",
+  "\n    --no-alpn",
+  "\t    (HTTPS) Disable the ALPN TLS extension. ALPN is enabled by  default",
+  "\t    if libcurl was built with  an SSL library that supports ALPN.  ALPN",
+  "\t    is used  by a  libcurl  that supports  HTTP/2 to  negotiate  HTTP/2",
+  "\t    support with the server during https sessions.",
+  "\n\t    Note that this is the  negated option name documented. You can  use",
+  "\t    --alpn to enable  ALPN. Providing --no-alpn  multiple times has  no",
+  "\t    extra effect. Disable it again with --alpn.",
+  "\n\t    Example:",
+  "\t     curl --no-alpn https://example.com",
+  "\n\t    --no-alpn requires that libcurl is  built to support TLS. See  also",
+  "\t    --no-npn and --http2.",
+  "\n    -N, --no-buffer",
+  "\t    Disable  the  buffering  of  the  output  stream.  In  normal  work",
+  "\t    situations, curl uses  a standard buffered  output stream that  has",
+  "\t    the effect  that it  outputs the  data in  chunks, not  necessarily",
+  "\t    exactly when  the data  arrives. Using  this option  disables  that",
+  "\t    buffering.",
+  "\n\t    Note that this is the  negated option name documented. You can  use",
+  "\t    --buffer to enable buffering again. Providing --no-buffer  multiple",
+  "\t    times has no extra effect. Disable it again with --buffer.",
+  "\n\t    Example:",
+  "\t     curl --no-buffer https://example.com",
+  "\n\t    See also --progress-bar.",
+  "\n    --no-clobber",
+  "\t    When used in conjunction  with the --output,  --remote-header-name,",
+  "\t    --remote-name,   or   --remote-name-all   options,   curl    avoids",
+  "\t    overwriting files that already exist.  Instead, a dot and a  number",
+  "\t    gets appended to the name of the file that would be created,  up to",
+  "\t    filename.100 after which it does not create any file.",
+  "\n\t    Note that this is the negated option name documented. You  can thus",
+  "\t    use   --clobber    to    enforce   the    clobbering,    even    if",
+  "\t    --remote-header-name is specified.",
+  "\n\t    The   --continue-at   option   cannot   be   used   together   with",
+  "\t    --no-clobber. Providing --no-clobber  multiple times  has no  extra",
+  "\t    effect. Disable it again with --clobber.",
+  "\n\t    Example:",
+  "\t     curl --no-clobber --output local/dir/file https://example.com",
+  "\n\t    Added in 7.83.0. See also --output and --remote-name.",
+  "\n    --no-keepalive",
+  "\t    Disable the use of keepalive  messages on the TCP connection.  curl",
+  "\t    otherwise enables them by default.",
+  "\n\t    Note that this is the negated option name documented. You  can thus",
+  "\t    use --keepalive  to  enforce  keepalive.  Providing  --no-keepalive",
+  "\t    multiple  times  has  no  extra  effect.  Disable  it  again   with",
+  "\t    --keepalive.",
+  "\n\t    Example:",
+  "\t     curl --no-keepalive https://example.com",
+  "\n\t    See also --keepalive-time and --keepalive-cnt.",
+  "\n    --no-npn",
+  "\t    (HTTPS) curl never uses  NPN, this option  has no effect (added  in",
+  "\t    7.86.0).",
+  "\n\t    Disable the  NPN  TLS  extension.  NPN is  enabled  by  default  if",
+  "\t    libcurl was built  with an SSL  library that  supports NPN. NPN  is",
+  "\t    used by a libcurl that supports HTTP/2 to negotiate HTTP/2  support",
+  "\t    with the server during https sessions. Providing --no-npn  multiple",
+  "\t    times has no extra effect. Disable it again with --npn.",
+  "\n\t    Example:",
+  "\t     curl --no-npn https://example.com",
+  "\n\t    --no-npn requires that libcurl  is built to  support TLS. See  also",
+  "\t    --no-alpn and --http2.",
+  "\n    --no-progress-meter",
+  "\t    Option to switch off  the progress meter  output without muting  or",
+  "\t    otherwise  affecting  warning   and  informational  messages   like",
+  "\t    --silent does.",
+  "\n\t    Note that this is the negated option name documented. You  can thus",
+  "\t    use --progress-meter to enable the progress meter again.  Providing",
+  "\t    --no-progress-meter multiple times has no extra effect. Disable  it",
+  "\t    again with --progress-meter.",
+  "\n\t    Example:",
+  "\t     curl --no-progress-meter -o store https://example.com",
+  "\n\t    Added in 7.67.0. See also --verbose and --silent.",
+  "\n    --no-sessionid",
+  "\t    (TLS) Disable curl's use of SSL session-ID caching. By default  all",
+  "\t    transfers are done using the cache. Note that while nothing  should",
+  "\t    ever get hurt by  attempting to reuse  SSL session-IDs, there  seem",
+  "\t    to be broken SSL implementations  in the wild that may require  you",
+  "\t    to disable this in order for you to succeed.",
+  "\n\t    Note that this is the negated option name documented. You  can thus",
+  "\t    use  --sessionid   to   enforce   session-ID   caching.   Providing",
+  "\t    --no-sessionid multiple  times  has  no extra  effect.  Disable  it",
+  "\t    again with --sessionid.",
+  "\n\t    Example:",
+  "\t     curl --no-sessionid https://example.com",
+  "\n\t    See also --insecure.",
+  "\n    --noproxy <no-proxy-list>",
+  "\t    Comma-separated list of hosts for which not to use a proxy,  if one",
+  "\t    is specified. The only  wildcard is a  single \"*\" character,  which",
+  "\t    matches all hosts,  and effectively disables  the proxy. Each  name",
+  "\t    in this  list is  matched as  either a  domain  which contains  the",
+  "\t    hostname, or the  hostname itself. For  example, \"local.com\"  would",
+  "\t    match \"local.com\",  \"local.com:80\",  and \"www.local.com\",  but  not",
+  "\t    \"www.notlocal.com\".",
+  "\n\t    This option overrides  the environment variables  that disable  the",
+  "\t    proxy (\"no_proxy\"  and  \"NO_PROXY\").  If there  is  an  environment",
+  "\t    variable disabling a proxy, you can set the no proxy list to  \"\" to",
+  "\t    override it.",
+  "\n\t    IP addresses specified to  this option can  be provided using  CIDR",
+  "\t    notation (added in 7.86.0): an appended slash and number  specifies",
+  "\t    the number  of  network bits  out  of the  address  to use  in  the",
+  "\t    comparison. For example \"192.168.0.0/16\" would match all  addresses",
+  "\t    starting with \"192.168\".  If --noproxy is  provided several  times,",
+  "\t    the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --noproxy \"www.example\" https://example.com",
+  "\n\t    See also --proxy.",
+  "\n    --ntlm",
+  "\t    (HTTP) Use NTLM authentication. The NTLM authentication method  was",
+  "\t    designed by  Microsoft and  is used  by IIS  web servers.  It is  a",
+  "\t    proprietary  protocol,  reverse-engineered  by  clever  people  and",
+  "\t    implemented in curl based on  their efforts. This kind of  behavior",
+  "\t    should not  be endorsed,  you should  encourage everyone  who  uses",
+  "\t    NTLM to switch  to a  public and  documented authentication  method",
+  "\t    instead, such as Digest.",
+  "\n\t    If you want to enable NTLM for your proxy authentication,  then use",
+  "\t    --proxy-ntlm. Providing --ntlm multiple times has no extra  effect.",
+  "\t    Disable it again with --no-ntlm.",
+  "\n\t    Example:",
+  "\t     curl --ntlm -u user:password https://example.com",
+  "\n\t    --ntlm requires  that libcurl  is built  to support  TLS. See  also",
+  "\t    --proxy-ntlm.",
+  "\n    --ntlm-wb",
+  "\t    (HTTP) Deprecated option (added in 8.8.0).",
+  "\n\t    Enabled NTLM much  in the style  --ntlm does,  but handed over  the",
+  "\t    authentication to  a separate  executable  that was  executed  when",
+  "\t    needed. Providing --ntlm-wb multiple times has no extra effect.",
+  "\n\t    Example:",
+  "\t     curl --ntlm-wb -u user:password https://example.com",
+  "\n\t    See also --ntlm and --proxy-ntlm.",
+  "\n    --oauth2-bearer <token>",
+  "\t    (IMAP LDAP POP3 SMTP HTTP)  Specify the Bearer Token for OAUTH  2.0",
+  "\t    server authentication.  The Bearer  Token  is used  in  conjunction",
+  "\t    with the username which  can be specified as  part of the --url  or",
+  "\t    --user options.",
+  "\n\t    The Bearer Token and username are formatted according to RFC  6750.",
+  "\t    If --oauth2-bearer is  provided several times,  the last set  value",
+  "\t    is used.",
+  "\n\t    Example:",
+  "\t     curl --oauth2-bearer \"mF_9.B5f-4.1JqM\" https://example.com",
+  "\n\t    See also --basic, --ntlm and --digest.",
+  "\n    --out-null",
+  "\t    Discard all response  output of  a transfer silently.  This is  the",
+  "\t    more efficient and portable version of",
+  "\n\t\tcurl https://host.example -o /dev/null",
+  "\n\t    The transfer is  done in full,  all data  is received and  checked,",
+  "\t    but the bytes  are not written  anywhere. --out-null is  associated",
+  "\t    with a single URL.  Use it once per URL  when you use several  URLs",
+  "\t    in a command line.",
+  "\n\t    Example:",
+  "\t     curl \"https://example.com\" --out-null",
+  "\n\t    Added   in    8.16.0.    See    also    --output,    --remote-name,",
+  "\t    --remote-name-all and --remote-header-name.",
+  "\n    -o, --output <file>",
+  "\t    Write output to the given file instead of stdout. If you  are using",
+  "\t    globbing to fetch multiple documents, you should quote the URL  and",
+  "\t    you can  use  \"#\"  followed  by  a number  in  the  filename.  That",
+  "\t    variable is  then replaced  with  the current  string for  the  URL",
+  "\t    being fetched. Like in:",
+  "\n\t\tcurl \"http://{one,two}.example.com\" -o \"file_#1.txt\"",
+  "\n\t    or use several variables like:",
+  "\n\t\tcurl \"http://{site,host}.host[1-5].example\" -o \"#1_#2\"",
+  "\n\t    You may use  this option as many  times as the  number of URLs  you",
+  "\t    have. For  example, if you  specify two  URLs on  the same  command",
+  "\t    line, you can use it like this:",
+  "\n\t\tcurl -o aa example.com -o bb example.net",
+  "\n\t    and the order of the -o options and the URLs does not  matter, just",
+  "\t    that the first  -o is for  the first URL  and so  on, so the  above",
+  "\t    command line can also be written as",
+  "\n\t\tcurl example.com example.net -o aa -o bb",
+  "\n\t    See also the --create-dirs option  to create the local  directories",
+  "\t    dynamically. Specifying the  output as '-'  (a single dash)  passes",
+  "\t    the output to stdout.",
+  "\n\t    To suppress response bodies, you can redirect output to /dev/null:",
+  "\n\t\tcurl example.com -o /dev/null",
+  "\n\t    Or for Windows:",
+  "\n\t\tcurl example.com -o nul",
+  "\n\t    Or, even more efficient and portable, use",
+  "\n\t\tcurl example.com --out-null",
+  "\n\t    Specify the  filename  as  single  minus to  force  the  output  to",
+  "\t    stdout, to  override  curl's  internal binary  output  in  terminal",
+  "\t    prevention:",
+  "\n\t\tcurl https://example.com/jpeg -o -",
+  "\n\t    --output is associated with a single URL. Use it once per  URL when",
+  "\t    you use several URLs in a command line.",
+  "\n\t    Examples:",
+  "\t     curl -o file https://example.com",
+  "\t     curl \"http://{one,two}.example.com\" -o \"file_#1.txt\"",
+  "\t     curl \"http://{site,host}.host[1-5].example\" -o \"#1_#2\"",
+  "\t     curl -o file https://example.com -o file2 https://example.net",
+  "\n\t    See   also   --out-null,   --remote-name,   --remote-name-all   and",
+  "\t    --remote-header-name.",
+  "\n    --output-dir <dir>",
+  "\t    Specify the  directory  in  which  files  should  be  stored,  when",
+  "\t    --remote-name or --output are used.",
+  "\n\t    The given output directory is used for all URLs and  output options",
+  "\t    on the command line, up until the first --next.",
+  "\n\t    If the specified  target directory  does not  exist, the  operation",
+  "\t    fails  unless  --create-dirs  is  also  used.  If  --output-dir  is",
+  "\t    provided several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --output-dir \"tmp\" -O https://example.com",
+  "\n\t    Added in 7.73.0. See also --remote-name and --remote-header-name.",
+  "\n    -Z, --parallel",
+  "\t    Make curl  perform all  transfers in  parallel as  compared to  the",
+  "\t    regular serial manner.  Parallel transfer means  that curl runs  up",
+  "\t    to N  concurrent transfers  simultaneously and  if there  are  more",
+  "\t    than N  transfers  to  handle,  it starts  new  ones  when  earlier",
+  "\t    transfers finish.",
+  "\n\t    With parallel  transfers, the  progress meter  output is  different",
+  "\t    from when doing serial transfers, as it then displays the  transfer",
+  "\t    status for multiple transfers in a single line.",
+  "\n\t    The  maximum   amount  of   concurrent   transfers  is   set   with",
+  "\t    --parallel-max and it defaults to 50.",
+  "\n\t    This option is global  and does not need  to be specified for  each",
+  "\t    use of --next.  Providing --parallel  multiple times  has no  extra",
+  "\t    effect. Disable it again with --no-parallel.",
+  "\n\t    Example:",
+  "\t     curl --parallel https://example.com -o file1 https://example.com \\",
+  "\t\t  -o file2",
+  "\n\t    Added in  7.66.0. See  also --next,  --verbose, --parallel-max  and",
+  "\t    --parallel-immediate.",
+  "\n    --parallel-immediate",
+  "\t    When doing  parallel  transfers,  this  option  instructs  curl  to",
+  "\t    prefer opening up more connections in parallel at once rather  than",
+  "\t    waiting to  see  if  new  transfers can  be  added  as  multiplexed",
+  "\t    streams on another connection.",
+  "\n\t    By default, without this option set, curl prefers to wait  a little",
+  "\t    and multiplex  new transfers  over existing  connections. It  keeps",
+  "\t    the number of connections low at the expense of risking  a slightly",
+  "\t    slower transfer startup.",
+  "\n\t    This option is global  and does not need  to be specified for  each",
+  "\t    use of --next.  Providing --parallel-immediate  multiple times  has",
+  "\t    no extra effect. Disable it again with --no-parallel-immediate.",
+  "\n\t    Example:",
+  "\t     curl --parallel-immediate -Z https://example.com -o file1 \\",
+  "\t\t  https://example.com -o file2",
+  "\n\t    Added in 7.68.0. See also --parallel and --parallel-max.",
+  "\n    --parallel-max <num>",
+  "\t    When asked to do parallel transfers, using --parallel, this  option",
+  "\t    controls the maximum amount of transfers to do simultaneously.",
+  "\n\t    The default is 50. 65535 is the largest supported value.",
+  "\n\t    This option is global  and does not need  to be specified for  each",
+  "\t    use of --next.  If --parallel-max  is provided  several times,  the",
+  "\t    last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --parallel-max 100 -Z https://example.com ftp://example.com/",
+  "\n\t    Added in 7.66.0. See also --parallel and --parallel-max-host.",
+  "\n    --parallel-max-host <num>",
+  "\t    When asked to do parallel transfers, using --parallel, this  option",
+  "\t    controls the  maximum  amount  of concurrent  connections  curl  is",
+  "\t    allowed to  do  to  the same  protocol  + hostname  +  port  number",
+  "\t    target.",
+  "\n\t    The limit is  enforced by  libcurl and  queued \"internally\",  which",
+  "\t    means that transfers that are  waiting for an available  connection",
+  "\t    still look like started transfers in the progress meter.",
+  "\n\t    The default  is  0  (unlimited). 65535  is  the  largest  supported",
+  "\t    value.",
+  "\n\t    This option is global  and does not need  to be specified for  each",
+  "\t    use of --next.  If --parallel-max-host is  provided several  times,",
+  "\t    the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --parallel-max-host 5 -Z https://example.com \\",
+  "\t\t  ftp://example.com/",
+  "\n\t    Added in 8.16.0. See also --parallel and --parallel-max.",
+  "\n    --pass <phrase>",
+  "\t    (SSH TLS) Passphrase for  the private key used  for SSH or TLS.  If",
+  "\t    --pass is provided several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --pass secret --key file https://example.com",
+  "\n\t    See also --key and --user.",
+  "\n    --path-as-is",
+  "\t    Do not  handle sequences  of /../  or /./  in the  given URL  path.",
+  "\t    Normally curl squashes  or merges them  according to standards  but",
+  "\t    with this  option  set  you  tell  it not  to  do  that.  Providing",
+  "\t    --path-as-is multiple times has no  extra effect. Disable it  again",
+  "\t    with --no-path-as-is.",
+  "\n\t    Example:",
+  "\t     curl --path-as-is https://example.com/../../etc/passwd",
+  "\n\t    See also --request-target.",
+  "\n    --pinnedpubkey <hashes>",
+  "\t    (TLS) Use the specified public  key file (or hashes) to verify  the",
+  "\t    peer. This can be a path  to a file which contains a single  public",
+  "\t    key in PEM or  DER format, or any  number of base64 encoded  sha256",
+  "\t    hashes preceded by 'sha256//' and separated by ';'.",
+  "\n\t    When negotiating  a  TLS or  SSL  connection, the  server  sends  a",
+  "\t    certificate indicating  its identity.  A  public key  is  extracted",
+  "\t    from this certificate and if  it does not exactly match the  public",
+  "\t    key provided  to this  option, curl  aborts the  connection  before",
+  "\t    sending or receiving any data.",
+  "\n\t    This option is independent  of option --insecure.  If you use  both",
+  "\t    options together then the peer is still verified by public key.",
+  "\n\t    PEM/DER support:",
+  "\n\t    OpenSSL and GnuTLS, wolfSSL, mbedTLS, Schannel",
+  "\n\t    sha256 support:",
+  "\n\t    OpenSSL, GnuTLS and wolfSSL, mbedTLS, Schannel",
+  "\n\t    Other SSL  backends not  supported. If  --pinnedpubkey is  provided",
+  "\t    several times, the last set value is used.",
+  "\n\t    Examples:",
+  "\t     curl --pinnedpubkey keyfile https://example.com",
+  "\t     curl --pinnedpubkey 'sha256//ce118b51897f4452dc' \\",
+  "\t\t  https://example.com",
+  "\n\t    See also --hostpubsha256.",
+  "\n    --post301",
+  "\t    (HTTP) Respect  RFC 7231/6.4.2  and do  not convert  POST  requests",
+  "\t    into GET  requests  when  following a  301  redirect.  The  non-RFC",
+  "\t    behavior  is  ubiquitous  in  web   browsers,  so  curl  does   the",
+  "\t    conversion by default  to maintain consistency.  However, a  server",
+  "\t    may require a POST to remain a POST after such a  redirection. This",
+  "\t    option  is  meaningful  only   when  using  --location.   Providing",
+  "\t    --post301 multiple  times has  no extra  effect. Disable  it  again",
+  "\t    with --no-post301.",
+  "\n\t    Example:",
+  "\t     curl --post301 --location -d \"data\" https://example.com",
+  "\n\t    See also --post302, --post303 and --location.",
+  "\n    --post302",
+  "\t    (HTTP) Respect  RFC 7231/6.4.3  and do  not convert  POST  requests",
+  "\t    into GET  requests  when  following a  302  redirect.  The  non-RFC",
+  "\t    behavior  is  ubiquitous  in  web   browsers,  so  curl  does   the",
+  "\t    conversion by default  to maintain consistency.  However, a  server",
+  "\t    may require a POST to remain a POST after such a  redirection. This",
+  "\t    option  is  meaningful  only   when  using  --location.   Providing",
+  "\t    --post302 multiple  times has  no extra  effect. Disable  it  again",
+  "\t    with --no-post302.",
+  "\n\t    Example:",
+  "\t     curl --post302 --location -d \"data\" https://example.com",
+  "\n\t    See also --post301, --post303 and --location.",
+  "\n    --post303",
+  "\t    (HTTP) Violate  RFC 7231/6.4.4  and do  not convert  POST  requests",
+  "\t    into GET  requests  when  following  303  redirect.  A  server  may",
+  "\t    require a  POST to  remain a  POST after  a  303 redirection.  This",
+  "\t    option  is  meaningful  only   when  using  --location.   Providing",
+  "\t    --post303 multiple  times has  no extra  effect. Disable  it  again",
+  "\t    with --no-post303.",
+  "\n\t    Example:",
+  "\t     curl --post303 --location -d \"data\" https://example.com",
+  "\n\t    See also --post302, --post301 and --location.",
+  "\n    --preproxy <[protocol://]host[:port]>",
+  "\t    Use the  specified SOCKS  proxy  before connecting  to an  HTTP  or",
+  "\t    HTTPS --proxy.  In such a  case curl  first connects  to the  SOCKS",
+  "\t    proxy and  then  connects (through  SOCKS)  to the  HTTP  or  HTTPS",
+  "\t    proxy. Hence pre proxy.",
+  "\n\t    The pre proxy string should be specified with a protocol://  prefix",
+  "\t    to specify alternative proxy protocols. Use socks4://,  socks4a://,",
+  "\t    socks5:// or socks5h://  to request the  specific SOCKS version  to",
+  "\t    be used. No protocol specified makes curl default to SOCKS4.",
+  "\n\t    If the port  number is  not specified  in the proxy  string, it  is",
+  "\t    assumed to be 1080.",
+  "\n\t    User and password that  might be provided  in the proxy string  are",
+  "\t    URL decoded by curl. This allows you to pass in  special characters",
+  "\t    such as @ by using %40 or  pass in a colon with %3a. If  --preproxy",
+  "\t    is provided several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --preproxy socks5://proxy.example -x http://http.example \\",
+  "\t\t  https://example.com",
+  "\n\t    See also --proxy and --socks5.",
+  "\n    -#, --progress-bar",
+  "\t    Make curl  display  transfer  progress as  a  simple  progress  bar",
+  "\t    instead of the standard, more informational, meter.",
+  "\n\t    This progress bar draws a single line of '#' characters  across the",
+  "\t    screen and shows a  percentage if the  transfer size is known.  For",
+  "\t    transfers without a known size, there is a space ship  (-=o=-) that",
+  "\t    moves back  and forth  but only  while data  is being  transferred,",
+  "\t    with a set of flying hash sign symbols on top.",
+  "\n\t    This option is global  and does not need  to be specified for  each",
+  "\t    use of  --next.  Providing  --progress-bar multiple  times  has  no",
+  "\t    extra effect. Disable it again with --no-progress-bar.",
+  "\n\t    Example:",
+  "\t     curl -# -O https://example.com",
+  "\n\t    See also --styled-output.",
+  "\n    --proto <protocols>",
+  "\t    Limit  what  protocols  to  allow  for  transfers.  Protocols   are",
+  "\t    evaluated left  to  right, are  comma  separated, and  are  each  a",
+  "\t    protocol name  or  'all',  optionally  prefixed  by  zero  or  more",
+  "\t    modifiers. Available modifiers are:",
+  "\n\t    +",
+  "\n\t\tPermit  this  protocol   in  addition   to  protocols   already",
+  "\t\tpermitted (this is the default if no modifier is used).",
+  "\n\t    -",
+  "\n\t\tDeny this  protocol, removing  it from  the list  of  protocols",
+  "\t\talready permitted.",
+  "\n\t    =",
+  "\n\t\tPermit  only   this  protocol   (ignoring  the   list   already",
+  "\t\tpermitted), though subject to later modification by  subsequent",
+  "\t\tentries in the comma separated list.",
+  "\n\t    For  example:  --proto  -ftps  uses  the  default  protocols,   but",
+  "\t    disables ftps",
+  "\n\t    --proto -all,https,+http only enables http and https",
+  "\n\t    --proto =http,https also only enables http and https",
+  "\n\t    Unknown and  disabled  protocols  produce a  warning.  This  allows",
+  "\t    scripts to  safely  rely  on  being  able  to  disable  potentially",
+  "\t    dangerous  protocols,  without  relying   upon  support  for   that",
+  "\t    protocol being built into curl to avoid an error.",
+  "\n\t    This option can be  used multiple times,  in which case the  effect",
+  "\t    is the same  as concatenating  the protocols into  one instance  of",
+  "\t    the option.  If --proto  is provided  several times,  the last  set",
+  "\t    value is used.",
+  "\n\t    Example:",
+  "\t     curl --proto =http,https,sftp https://example.com",
+  "\n\t    See also --proto-redir and --proto-default.",
+  "\n    --proto-default <protocol>",
+  "\t    Use protocol for any provided URL missing a scheme.",
+  "\n\t    An    unknown    or     unsupported    protocol    causes     error",
+  "\t    CURLE_UNSUPPORTED_PROTOCOL.",
+  "\n\t    This option does not change the default proxy protocol (http).",
+  "\n\t    Without this  option  set,  curl  guesses  protocol  based  on  the",
+  "\t    hostname, see  --url for  details. If  --proto-default is  provided",
+  "\t    several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --proto-default https ftp.example.com",
+  "\n\t    See also --proto and --proto-redir.",
+  "\n    --proto-redir <protocols>",
+  "\t    Limit what protocols  to allow  on redirects.  Protocols denied  by",
+  "\t    --proto are  not overridden  by this  option. See  --proto for  how",
+  "\t    protocols are represented.",
+  "\n\t    Example, allow only HTTP and HTTPS on redirect:",
+  "\n\t\tcurl --proto-redir -all,http,https http://example.com",
+  "\n\t    By default curl only allows HTTP, HTTPS, FTP and FTPS  on redirects",
+  "\t    (added in 7.65.2). Specifying all or +all enables all protocols  on",
+  "\t    redirects, which  is not  good for  security. If  --proto-redir  is",
+  "\t    provided several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --proto-redir =http,https https://example.com",
+  "\n\t    See also --proto.",
+  "\n    -x, --proxy <[protocol://]host[:port]>",
+  "\t    Use the specified proxy.",
+  "\n\t    The proxy string  can be  specified with a  protocol:// prefix.  No",
+  "\t    protocol specified or http:// it  is treated as an HTTP proxy.  Use",
+  "\t    socks4://,  socks4a://,  socks5://  or  socks5h://  to  request   a",
+  "\t    specific SOCKS version to be used.",
+  "\n\t    Unix domain sockets  are supported for  socks proxy. Set  localhost",
+  "\t    for the host part. e.g. socks5h://localhost/path/to/socket.sock",
+  "\n\t    HTTPS proxy support  works with  the https://  protocol prefix  for",
+  "\t    OpenSSL and GnuTLS.  It also  works for  mbedTLS, Rustls,  Schannel",
+  "\t    and wolfSSL (added in 7.87.0).",
+  "\n\t    Unrecognized  and  unsupported  proxy  protocols  cause  an  error.",
+  "\t    Ancient curl  versions ignored  unknown  schemes and  used  http://",
+  "\t    instead.",
+  "\n\t    If the port  number is  not specified  in the proxy  string, it  is",
+  "\t    assumed to be 1080.",
+  "\n\t    This option overrides existing  environment variables that set  the",
+  "\t    proxy to use. If there is an environment variable setting  a proxy,",
+  "\t    you can set proxy to \"\" to override it.",
+  "\n\t    All  operations  that  are  performed   over  an  HTTP  proxy   are",
+  "\t    transparently converted  to HTTP.  It means  that certain  protocol",
+  "\t    specific operations might not  be available. This  is not the  case",
+  "\t    if you can tunnel through the proxy, as one with  the --proxytunnel",
+  "\t    option.",
+  "\n\t    User and password that  might be provided  in the proxy string  are",
+  "\t    URL decoded by curl. This allows you to pass in  special characters",
+  "\t    such as @ by using %40 or pass in a colon with %3a.",
+  "\n\t    The  proxy host  can  be  specified  the  same  way  as  the  proxy",
+  "\t    environment variables, including the protocol prefix (http://)  and",
+  "\t    the embedded user + password.",
+  "\n\t    When a proxy is used, the  active FTP mode as set with  --ftp-port,",
+  "\t    cannot be used.",
+  "\n\t    Doing FTP over an  HTTP proxy without  --proxytunnel makes curl  do",
+  "\t    HTTP with an  FTP URL over  the proxy.  For such transfers,  common",
+  "\t    FTP  specific  options  do  not  work,  including  --ssl-reqd   and",
+  "\t    --ftp-ssl-control. If --proxy is  provided several times, the  last",
+  "\t    set value is used.",
+  "\n\t    Example:",
+  "\t     curl --proxy http://proxy.example https://example.com",
+  "\n\t    See also --socks5 and --proxy-basic.",
+  "\n    --proxy-anyauth",
+  "\t    Automatically  pick   a   suitable   authentication   method   when",
+  "\t    communicating with the given HTTP proxy. This might cause an  extra",
+  "\t    request/response round-trip.",
+  "\n\t    Example:",
+  "\t     curl --proxy-anyauth --proxy-user user:passwd -x proxy \\",
+  "\t\t  https://example.com",
+  "\n\t    See also --proxy, --proxy-basic and --proxy-digest.",
+  "\n    --proxy-basic",
+  "\t    Use HTTP  Basic authentication  when communicating  with the  given",
+  "\t    proxy. Use  --basic for  enabling HTTP  Basic with  a remote  host.",
+  "\t    Basic is the default authentication method curl uses with  proxies.",
+  "\t    Providing  --proxy-basic  multiple  times  has  no  extra   effect.",
+  "\t    Disable it again with --no-proxy-basic.",
+  "\n\t    Example:",
+  "\t     curl --proxy-basic --proxy-user user:passwd -x proxy \\",
+  "\t\t  https://example.com",
+  "\n\t    See also --proxy, --proxy-anyauth and --proxy-digest.",
+  "\n    --proxy-ca-native",
+  "\t    (TLS) Use the  operating system's native  CA store for  certificate",
+  "\t    verification of the HTTPS proxy.",
+  "\n\t    This option  is independent  of other  HTTPS proxy  CA  certificate",
+  "\t    locations set  at  run time  or  build time.  Those  locations  are",
+  "\t    searched in addition to the native CA store.",
+  "\n\t    Equivalent to --ca-native  but used in  HTTPS proxy context.  Refer",
+  "\t    to   --ca-native   for    TLS   backend   limitations.    Providing",
+  "\t    --proxy-ca-native multiple times  has no extra  effect. Disable  it",
+  "\t    again with --no-proxy-ca-native.",
+  "\n\t    Example:",
+  "\t     curl --proxy-ca-native https://example.com",
+  "\n\t    Added  in  8.2.0.   See  also   --ca-native,  --cacert,   --capath,",
+  "\t    --dump-ca-embed and --insecure.",
+  "\n    --proxy-cacert <file>",
+  "\t    Use the specified certificate file  to verify the HTTPS proxy.  The",
+  "\t    file may contain multiple CA certificates. The certificate(s)  must",
+  "\t    be in PEM format.",
+  "\n\t    This allows you to use a different trust for the proxy  compared to",
+  "\t    the remote server connected to via the proxy.",
+  "\n\t    Equivalent  to  --cacert  but  used  in  HTTPS  proxy  context.  If",
+  "\t    --proxy-cacert is provided  several times,  the last  set value  is",
+  "\t    used.",
+  "\n\t    Example:",
+  "\t     curl --proxy-cacert CA-file.txt -x https://proxy \\",
+  "\t\t  https://example.com",
+  "\n\t    See also  --proxy-capath, --cacert,  --capath, --dump-ca-embed  and",
+  "\t    --proxy.",
+  "\n    --proxy-capath <dir>",
+  "\t    Same as --capath but used in HTTPS proxy context.",
+  "\n\t    Use the  specified  certificate  directory  to  verify  the  proxy.",
+  "\t    Multiple paths can be provided by separating them with colon  (\":\")",
+  "\t    (e.g.  \"path1:path2:path3\").  The  certificates  must  be  in   PEM",
+  "\t    format, and if curl  is built against  OpenSSL, the directory  must",
+  "\t    have been  processed  using  the  c_rehash  utility  supplied  with",
+  "\t    OpenSSL. Using  --proxy-capath can  allow OpenSSL-powered  curl  to",
+  "\t    make   SSL-connections   much    more   efficiently   than    using",
+  "\t    --proxy-cacert  if  the  --proxy-cacert   file  contains  many   CA",
+  "\t    certificates.",
+  "\n\t    If this  option is set,  the default  capath value  is ignored.  If",
+  "\t    --proxy-capath is provided  several times,  the last  set value  is",
+  "\t    used.",
+  "\n\t    Example:",
+  "\t     curl --proxy-capath /local/directory -x https://proxy \\",
+  "\t\t  https://example.com",
+  "\n\t    See also --proxy-cacert, --proxy, --capath and --dump-ca-embed.",
+  "\n    --proxy-cert <cert[:passwd]>",
+  "\t    Use the specified client  certificate file when communicating  with",
+  "\t    an  HTTPS proxy.  The  certificate  must  be  PEM  format.  If  the",
+  "\t    optional password  is  not specified,  it  is queried  for  on  the",
+  "\t    terminal. Use --proxy-key to provide the private key.",
+  "\n\t    This option is  the equivalent to  --cert but  used in HTTPS  proxy",
+  "\t    context. If --proxy-cert  is provided several  times, the last  set",
+  "\t    value is used.",
+  "\n\t    Example:",
+  "\t     curl --proxy-cert file -x https://proxy https://example.com",
+  "\n\t    See also --proxy, --proxy-key and --proxy-cert-type.",
+  "\n    --proxy-cert-type <type>",
+  "\t    Set type  of  the  provided client  certificate  when  using  HTTPS",
+  "\t    proxy. PEM, DER, ENG, PROV and P12 are recognized types.",
+  "\n\t    The default type  depends on the  TLS backend  and is usually  PEM.",
+  "\t    For Schannel it is P12. If  --proxy-cert is a pkcs11: URI then  ENG",
+  "\t    or PROV is the default type (depending on OpenSSL version).",
+  "\n\t    Equivalent to  --cert-type  but used  in  HTTPS proxy  context.  If",
+  "\t    --proxy-cert-type is provided several times, the last set value  is",
+  "\t    used.",
+  "\n\t    Example:",
+  "\t     curl --proxy-cert-type PEM --proxy-cert file -x https://proxy \\",
+  "\t\t  https://example.com",
+  "\n\t    See also --proxy-cert and --proxy-key.",
+  "\n    --proxy-ciphers <list>",
+  "\t    (TLS) Same as --ciphers but used in HTTPS proxy context.",
+  "\n\t    Specify which cipher suites to use in the connection to  your HTTPS",
+  "\t    proxy when it negotiates  TLS 1.2 (1.1,  1.0). The list of  ciphers",
+  "\t    suites must specify valid ciphers. Read up on cipher suite  details",
+  "\t    on this URL:",
+  "\n\t    https://curl.se/docs/ssl-ciphers.html   If    --proxy-ciphers    is",
+  "\t    provided several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --proxy-ciphers ECDHE-ECDSA-AES128-GCM-SHA256:\\",
+  "\t\t  ECDHE-RSA-AES128-GCM-SHA256 -x https://proxy \\",
+  "\t\t  https://example.com",
+  "\n\t    See also --proxy-tls13-ciphers, --ciphers and --proxy.",
+  "\n    --proxy-crlfile <file>",
+  "\t    Provide filename  for  a  PEM formatted  file  with  a  Certificate",
+  "\t    Revocation  List  that   specifies  peer   certificates  that   are",
+  "\t    considered revoked when communicating with an HTTPS proxy.",
+  "\n\t    Equivalent to --crlfile but  only used in  HTTPS proxy context.  If",
+  "\t    --proxy-crlfile is provided  several times, the  last set value  is",
+  "\t    used.",
+  "\n\t    Example:",
+  "\t     curl --proxy-crlfile rejects.txt -x https://proxy \\",
+  "\t\t  https://example.com",
+  "\n\t    See also --crlfile and --proxy.",
+  "\n    --proxy-digest",
+  "\t    Use HTTP Digest  authentication when communicating  with the  given",
+  "\t    proxy. Use --digest for  enabling HTTP Digest  with a remote  host.",
+  "\t    Providing  --proxy-digest  multiple  times  has  no  extra  effect.",
+  "\t    Disable it again with --no-proxy-digest.",
+  "\n\t    Example:",
+  "\t     curl --proxy-digest --proxy-user user:passwd -x proxy \\",
+  "\t\t  https://example.com",
+  "\n\t    See also --proxy, --proxy-anyauth and --proxy-basic.",
+  "\n    --proxy-header <header/@file>",
+  "\t    (HTTP) Extra header to include in the request when sending  HTTP to",
+  "\t    a proxy. You may specify any  number of extra headers. This is  the",
+  "\t    equivalent option to --header but  is for proxy communication  only",
+  "\t    like in CONNECT requests  when you want  a separate header sent  to",
+  "\t    the proxy to what is sent to the actual remote host.",
+  "\n\t    curl makes sure that each  header you add/replace is sent with  the",
+  "\t    proper end-of-line marker, you should  thus not add that as a  part",
+  "\t    of the header  content: do  not add newlines  or carriage  returns,",
+  "\t    they only mess things up for you.",
+  "\n\t    Headers specified with  this option  are not  included in  requests",
+  "\t    that curl knows are not to be sent to a proxy.",
+  "\n\t    This option can  take an  argument in @filename  style, which  then",
+  "\t    adds a header for each line in the input file. Using @-  makes curl",
+  "\t    read the headers from stdin.",
+  "\n\t    This option  can  be  used  multiple  times  to  add/replace/remove",
+  "\t    multiple headers. --proxy-header  can be  used several  times in  a",
+  "\t    command line",
+  "\n\t    Examples:",
+  "\t     curl --proxy-header \"X-First-Name: Joe\" -x http://proxy \\",
+  "\t\t  https://example.com",
+  "\t     curl --proxy-header \"User-Agent: surprise\" -x http://proxy \\",
+  "\t\t  https://example.com",
+  "\t     curl --proxy-header \"Host:\" -x http://proxy https://example.com",
+  "\n\t    See also --proxy.",
+  "\n    --proxy-http2",
+  "\t    (HTTP) Negotiate HTTP/2 with an HTTPS proxy. The proxy might  still",
+  "\t    only offer HTTP/1 and then curl sticks to using that version.",
+  "\n\t    This has  no  effect for  any  other kinds  of  proxies.  Providing",
+  "\t    --proxy-http2 multiple times has no extra effect. Disable it  again",
+  "\t    with --no-proxy-http2.",
+  "\n\t    Example:",
+  "\t     curl --proxy-http2 -x proxy https://example.com",
+  "\n\t    --proxy-http2 requires  that libcurl  is built  to support  HTTP/2.",
+  "\t    Added in 8.1.0. See also --proxy.",
+  "\n    --proxy-insecure",
+  "\t    Same as --insecure but used in HTTPS proxy context.",
+  "\n\t    Every secure connection curl makes is verified to be secure  before",
+  "\t    the  transfer  takes  place.  This  option  makes  curl  skip   the",
+  "\t    verification step with a proxy and proceed without checking.",
+  "\n\t    When this  option  is  not  used  for a  proxy  using  HTTPS,  curl",
+  "\t    verifies the proxy's TLS certificate before it continues: that  the",
+  "\t    certificate contains the right name which matches the hostname  and",
+  "\t    that the certificate has  been signed by  a CA certificate  present",
+  "\t    in the cert store.  See this online  resource for further  details:",
+  "\t    https://curl.se/docs/sslcerts.html",
+  "\n\t    WARNING:  using  this  option  makes  the  transfer  to  the  proxy",
+  "\t    insecure. Providing --proxy-insecure  multiple times  has no  extra",
+  "\t    effect. Disable it again with --no-proxy-insecure.",
+  "\n\t    Example:",
+  "\t     curl --proxy-insecure -x https://proxy https://example.com",
+  "\n\t    See also --proxy and --insecure.",
+  "\n    --proxy-key <key>",
+  "\t    Specify the  filename  for  your  private  key  when  using  client",
+  "\t    certificates with your HTTPS proxy.  This option is the  equivalent",
+  "\t    to --key  but  used  in  HTTPS proxy  context.  If  --proxy-key  is",
+  "\t    provided several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --proxy-key here -x https://proxy https://example.com",
+  "\n\t    See also --proxy-key-type and --proxy.",
+  "\n    --proxy-key-type <type>",
+  "\t    Specify  the  private  key  file  type  your  --proxy-key  provided",
+  "\t    private  key  uses.  DER,  PEM,  and  ENG  are  supported.  If  not",
+  "\t    specified, PEM is assumed.",
+  "\n\t    Equivalent to  --key-type  but  used in  HTTPS  proxy  context.  If",
+  "\t    --proxy-key-type is provided several times,  the last set value  is",
+  "\t    used.",
+  "\n\t    Example:",
+  "\t     curl --proxy-key-type DER --proxy-key here -x https://proxy \\",
+  "\t\t  https://example.com",
+  "\n\t    See also --proxy-key and --proxy.",
+  "\n    --proxy-negotiate",
+  "\t    Use HTTP Negotiate (SPNEGO) authentication when communicating  with",
+  "\t    the given  proxy.  Use  --negotiate  for  enabling  HTTP  Negotiate",
+  "\t    (SPNEGO) with a remote  host. Providing --proxy-negotiate  multiple",
+  "\t    times has no extra effect.",
+  "\n\t    Example:",
+  "\t     curl --proxy-negotiate --proxy-user user:passwd -x proxy \\",
+  "\t\t  https://example.com",
+  "\n\t    See also --proxy-anyauth, --proxy-basic and --proxy-service-name.",
+  "\n    --proxy-ntlm",
+  "\t    Use HTTP  NTLM authentication  when  communicating with  the  given",
+  "\t    proxy. Use --ntlm for enabling  NTLM with a remote host.  Providing",
+  "\t    --proxy-ntlm multiple times has no  extra effect. Disable it  again",
+  "\t    with --no-proxy-ntlm.",
+  "\n\t    Example:",
+  "\t     curl --proxy-ntlm --proxy-user user:passwd -x http://proxy \\",
+  "\t\t  https://example.com",
+  "\n\t    See also --proxy-negotiate, --proxy-anyauth and --proxy-user.",
+  "\n    --proxy-pass <phrase>",
+  "\t    Passphrase for the private key for HTTPS proxy client certificate.",
+  "\n\t    Equivalent  to  --pass  but  used   in  HTTPS  proxy  context.   If",
+  "\t    --proxy-pass is  provided  several times,  the  last set  value  is",
+  "\t    used.",
+  "\n\t    Example:",
+  "\t     curl --proxy-pass secret --proxy-key here -x https://proxy \\",
+  "\t\t  https://example.com",
+  "\n\t    See also --proxy and --proxy-key.",
+  "\n    --proxy-pinnedpubkey <hashes>",
+  "\t    (TLS) Use the specified public  key file (or hashes) to verify  the",
+  "\t    proxy. This can be a path to a file which contains a  single public",
+  "\t    key in PEM or  DER format, or any  number of base64 encoded  sha256",
+  "\t    hashes preceded by 'sha256//' and separated by ';'.",
+  "\n\t    When negotiating  a  TLS or  SSL  connection, the  server  sends  a",
+  "\t    certificate indicating  its identity.  A  public key  is  extracted",
+  "\t    from this certificate and if  it does not exactly match the  public",
+  "\t    key provided  to this  option, curl  aborts the  connection  before",
+  "\t    sending or receiving any data.",
+  "\n\t    Before curl  8.10.0 this  option  did not  work due  to a  bug.  If",
+  "\t    --proxy-pinnedpubkey is provided several times, the last set  value",
+  "\t    is used.",
+  "\n\t    Examples:",
+  "\t     curl --proxy-pinnedpubkey keyfile https://example.com",
+  "\t     curl --proxy-pinnedpubkey 'sha256//ce118b51897f4452dc' \\",
+  "\t\t  https://example.com",
+  "\n\t    See also --pinnedpubkey and --proxy.",
+  "\n    --proxy-service-name <name>",
+  "\t    Set the service  name for SPNEGO  when doing proxy  authentication.",
+  "\t    If --proxy-service-name  is provided  several times,  the last  set",
+  "\t    value is used.",
+  "\n\t    Example:",
+  "\t     curl --proxy-service-name \"shrubbery\" -x proxy \\",
+  "\t\t  https://example.com",
+  "\n\t    See also --service-name, --proxy and --proxy-negotiate.",
+  "\n    --proxy-ssl-allow-beast",
+  "\t    Do not work around a security flaw in the TLS1.0 protocol  known as",
+  "\t    BEAST when communicating to an  HTTPS proxy. If this option is  not",
+  "\t    used,  the  TLS   layer  may   use  workarounds   known  to   cause",
+  "\t    interoperability problems with some older server implementations.",
+  "\n\t    This option only changes how curl does TLS 1.0 with an  HTTPS proxy",
+  "\t    and has no effect on later TLS versions.",
+  "\n\t    WARNING: this option loosens  the TLS security,  and by using  this",
+  "\t    flag you ask for exactly that.",
+  "\n\t    Equivalent to --ssl-allow-beast  but used in  HTTPS proxy  context.",
+  "\t    Providing  --proxy-ssl-allow-beast  multiple  times  has  no  extra",
+  "\t    effect. Disable it again with --no-proxy-ssl-allow-beast.",
+  "\n\t    Example:",
+  "\t     curl --proxy-ssl-allow-beast -x https://proxy https://example.com",
+  "\n\t    See also --ssl-allow-beast and --proxy.",
+  "\n    --proxy-ssl-auto-client-cert",
+  "\t    Same as --ssl-auto-client-cert but used in HTTPS proxy context.",
+  "\n\t    This    is     only     supported    by     Schannel.     Providing",
+  "\t    --proxy-ssl-auto-client-cert multiple  times has  no extra  effect.",
+  "\t    Disable it again with --no-proxy-ssl-auto-client-cert.",
+  "\n\t    Example:",
+  "\t     curl --proxy-ssl-auto-client-cert -x https://proxy \\",
+  "\t\t  https://example.com",
+  "\n\t    Added in 7.77.0. See also --ssl-auto-client-cert and --proxy.",
+  "\n    --proxy-tls13-ciphers <list>",
+  "\t    (TLS) Same as --tls13-ciphers but used in HTTPS proxy context.",
+  "\n\t    Specify which cipher suites to use in the connection to  your HTTPS",
+  "\t    proxy when it negotiates TLS  1.3. The list of ciphers suites  must",
+  "\t    specify valid ciphers. Read up  on TLS 1.3 cipher suite details  on",
+  "\t    this URL:",
+  "\n\t    https://curl.se/docs/ssl-ciphers.html",
+  "\n\t    This option is  used when  curl is  built to use  OpenSSL 1.1.1  or",
+  "\t    later, Schannel, wolfSSL, or mbedTLS 3.6.0 or later.",
+  "\n\t    Before curl 8.10.0 with mbedTLS  or wolfSSL, TLS 1.3 cipher  suites",
+  "\t    were   set    by    using   the    --proxy-ciphers    option.    If",
+  "\t    --proxy-tls13-ciphers is  provided  several  times,  the  last  set",
+  "\t    value is used.",
+  "\n\t    Example:",
+  "\t     curl --proxy-tls13-ciphers TLS_AES_128_GCM_SHA256 -x proxy \\",
+  "\t\t  https://example.com",
+  "\n\t    Added in  7.61.0.  See also  --proxy-ciphers,  --tls13-ciphers  and",
+  "\t    --proxy.",
+  "\n    --proxy-tlsauthtype <type>",
+  "\t    Set TLS authentication  type with HTTPS  proxy. The only  supported",
+  "\t    option is \"SRP\", for TLS-SRP (RFC 5054). This option works  only if",
+  "\t    the underlying libcurl is built with TLS-SRP support.",
+  "\n\t    Equivalent to --tlsauthtype  but used  in HTTPS  proxy context.  If",
+  "\t    --proxy-tlsauthtype is provided several  times, the last set  value",
+  "\t    is used.",
+  "\n\t    Example:",
+  "\t     curl --proxy-tlsauthtype SRP -x https://proxy https://example.com",
+  "\n\t    See also --proxy, --proxy-tlsuser and --proxy-tlspassword.",
+  "\n    --proxy-tlspassword <string>",
+  "\t    Set password to  use with the  TLS authentication method  specified",
+  "\t    with --proxy-tlsauthtype  when  using HTTPS  proxy.  Requires  that",
+  "\t    --proxy-tlsuser is set.",
+  "\n\t    This option does not work with TLS 1.3.",
+  "\n\t    Equivalent to --tlspassword  but used  in HTTPS  proxy context.  If",
+  "\t    --proxy-tlspassword is provided several  times, the last set  value",
+  "\t    is used.",
+  "\n\t    Example:",
+  "\t     curl --proxy-tlspassword passwd -x https://proxy \\",
+  "\t\t  https://example.com",
+  "\n\t    See also --proxy and --proxy-tlsuser.",
+  "\n    --proxy-tlsuser <name>",
+  "\t    Set username for use  for HTTPS proxy  with the TLS  authentication",
+  "\t    method   specified   with   --proxy-tlsauthtype.   Requires    that",
+  "\t    --proxy-tlspassword also is set.",
+  "\n\t    This option  does not  work  with TLS  1.3. If  --proxy-tlsuser  is",
+  "\t    provided several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --proxy-tlsuser smith -x https://proxy https://example.com",
+  "\n\t    See also --proxy and --proxy-tlspassword.",
+  "\n    --proxy-tlsv1",
+  "\t    Use at least TLS version 1.x when negotiating with an  HTTPS proxy.",
+  "\t    That means TLS version 1.0 or higher",
+  "\n\t    Equivalent to --tlsv1  but for  an HTTPS  proxy context.  Providing",
+  "\t    --proxy-tlsv1 multiple times has no extra effect.",
+  "\n\t    Example:",
+  "\t     curl --proxy-tlsv1 -x https://proxy https://example.com",
+  "\n\t    See also --proxy.",
+  "\n    -U, --proxy-user <user:password>",
+  "\t    Specify the username and password to use for proxy authentication.",
+  "\n\t    If you  use  a  Windows  SSPI-enabled curl  binary  and  do  either",
+  "\t    Negotiate or NTLM authentication then  you can tell curl to  select",
+  "\t    the username and  password from  your environment  by specifying  a",
+  "\t    single colon with this option: \"-U :\".",
+  "\n\t    On systems where  it works,  curl hides the  given option  argument",
+  "\t    from process listings.  This is not  enough to protect  credentials",
+  "\t    from possibly getting  seen by other  users on  the same system  as",
+  "\t    they still  are visible  for a  moment before  being cleared.  Such",
+  "\t    sensitive data should be retrieved  from a file instead or  similar",
+  "\t    and never used in clear text in a command line. If  --proxy-user is",
+  "\t    provided several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --proxy-user smith:secret -x proxy https://example.com",
+  "\n\t    See also --proxy-pass.",
+  "\n    --proxy1.0 <host[:port]>",
+  "\t    Use the  specified  HTTP  1.0 proxy.  If  the port  number  is  not",
+  "\t    specified, it is assumed at port 1080.",
+  "\n\t    The  only  difference  between  this  and  the  HTTP  proxy  option",
+  "\t    --proxy,  is  that  attempts  to  use  CONNECT  through  the  proxy",
+  "\t    specifies an HTTP  1.0 protocol  instead of the  default HTTP  1.1.",
+  "\t    Providing --proxy1.0 multiple times has no extra effect.",
+  "\n\t    Example:",
+  "\t     curl --proxy1.0 http://proxy https://example.com",
+  "\n\t    See also --proxy, --socks5 and --preproxy.",
+  "\n    -p, --proxytunnel",
+  "\t    When an HTTP proxy is  used --proxy, this option makes curl  tunnel",
+  "\t    the traffic through  the proxy.  The tunnel approach  is made  with",
+  "\t    the HTTP proxy CONNECT request  and requires that the proxy  allows",
+  "\t    direct connection to the  remote port number  curl wants to  tunnel",
+  "\t    through to.",
+  "\n\t    To suppress  proxy CONNECT  response headers  when curl  is set  to",
+  "\t    output   headers    use    --suppress-connect-headers.    Providing",
+  "\t    --proxytunnel multiple times has no extra effect. Disable it  again",
+  "\t    with --no-proxytunnel.",
+  "\n\t    Example:",
+  "\t     curl --proxytunnel -x http://proxy https://example.com",
+  "\n\t    See also --proxy.",
+  "\n    --pubkey <key>",
+  "\t    (SFTP SCP) Public key filename.  Allows you to provide your  public",
+  "\t    key in this separate file.",
+  "\n\t    curl attempts  to automatically  extract the  public key  from  the",
+  "\t    private  key  file,  so  passing  this  option  is  generally   not",
+  "\t    required. Note that this public key extraction requires libcurl  to",
+  "\t    be linked against a copy of libssh2 1.2.8 or higher that  is itself",
+  "\t    linked against OpenSSL. If --pubkey is provided several times,  the",
+  "\t    last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --pubkey file.pub sftp://example.com/",
+  "\n\t    See also --pass.",
+  "\n    -Q, --quote <command>",
+  "\t    (FTP SFTP)  Send an arbitrary  command to  the remote  FTP or  SFTP",
+  "\t    server. Quote commands  are sent  BEFORE the  transfer takes  place",
+  "\t    (just after  the initial  PWD command  in an  FTP  transfer, to  be",
+  "\t    exact). To make  commands take place  after a successful  transfer,",
+  "\t    prefix them with a dash '-'.",
+  "\n\t    (FTP only)  To make commands  be sent  after curl  has changed  the",
+  "\t    working  directory,  just  before  the  file  transfer  command(s),",
+  "\t    prefix the command with a '+'.",
+  "\n\t    You may specify any number of commands.",
+  "\n\t    By default curl stops at first failure. To make curl  continue even",
+  "\t    if the  command fails,  prefix the  command with  an asterisk  (*).",
+  "\t    Otherwise, if the server returns  failure for one of the  commands,",
+  "\t    the entire operation is aborted.",
+  "\n\t    You must  send  syntactically  correct  FTP  commands  as  RFC  959",
+  "\t    defines to  FTP servers, or  one of  the commands  listed below  to",
+  "\t    SFTP servers.",
+  "\n\t    SFTP is a  binary protocol.  Unlike for FTP,  curl interprets  SFTP",
+  "\t    quote commands itself before sending them to the server.  Filenames",
+  "\t    may be quoted  shell-style to embed  spaces or special  characters.",
+  "\t    Following is the list of all supported SFTP quote commands:",
+  "\n\t    atime date file",
+  "\n\t\tThe atime command sets the  last access time of the file  named",
+  "\t\tby the file operand.  The date expression  can be all sorts  of",
+  "\t\tdate  strings,  see  the  curl_getdate(3)  man  page  for  date",
+  "\t\texpression details. (Added in 7.73.0)",
+  "\n\t    chgrp group file",
+  "\n\t\tThe chgrp command sets  the group ID of  the file named by  the",
+  "\t\tfile operand to the  group ID specified  by the group  operand.",
+  "\t\tThe group operand is a decimal integer group ID.",
+  "\n\t    chmod mode file",
+  "\n\t\tThe chmod command modifies the file mode bits of the  specified",
+  "\t\tfile. The mode operand is an octal integer mode number.",
+  "\n\t    chown user file",
+  "\n\t\tThe chown command sets the owner of the file named by  the file",
+  "\t\toperand to the user ID specified by the user operand.  The user",
+  "\t\toperand is a decimal integer user ID.",
+  "\n\t    ln source_file target_file",
+  "\n\t\tThe ln  and symlink  commands  create a  symbolic link  at  the",
+  "\t\ttarget_file location pointing to the source_file location.",
+  "\n\t    mkdir directory_name",
+  "\n\t\tThe  mkdir  command   creates  the  directory   named  by   the",
+  "\t\tdirectory_name operand.",
+  "\n\t    mtime date file",
+  "\n\t\tThe mtime command sets the  last modification time of the  file",
+  "\t\tnamed by  the file  operand.  The date  expression can  be  all",
+  "\t\tsorts of date  strings, see  the curl_getdate(3)  man page  for",
+  "\t\tdate expression details. (Added in 7.73.0)",
+  "\n\t    pwd",
+  "\n\t\tThe pwd command returns the  absolute path name of the  current",
+  "\t\tworking directory.",
+  "\n\t    rename source target",
+  "\n\t\tThe rename command renames the  file or directory named by  the",
+  "\t\tsource operand  to the  destination path  named by  the  target",
+  "\t\toperand.",
+  "\n\t    rm file",
+  "\n\t\tThe rm command removes the file specified by the file operand.",
+  "\n\t    rmdir directory",
+  "\n\t\tThe rmdir command removes the directory entry specified by  the",
+  "\t\tdirectory operand, provided it is empty.",
+  "\n\t    symlink source_file target_file",
+  "\n\t\tSee ln.",
+  "\n\t    --quote can be used several times in a command line",
+  "\n\t    Example:",
+  "\t     curl --quote \"DELE file\" ftp://example.com/foo",
+  "\n\t    See also --request.",
+  "\n    --random-file <file>",
+  "\t    Deprecated option. This option is ignored (added in 7.84.0).  Prior",
+  "\t    to that it only had an effect on curl if built to use  old versions",
+  "\t    of OpenSSL.",
+  "\n\t    Specify the path name to file containing random data. The  data may",
+  "\t    be  used  to  seed  the  random  engine  for  SSL  connections.  If",
+  "\t    --random-file is  provided several  times, the  last set  value  is",
+  "\t    used.",
+  "\n\t    Example:",
+  "\t     curl --random-file rubbish https://example.com",
+  "\n\t    See also --egd-file.",
+  "\n    -r, --range <range>",
+  "\t    (HTTP  FTP SFTP  FILE)  Retrieve  a  byte  range  (i.e.  a  partial",
+  "\t    document) from an  HTTP/1.1, FTP or  SFTP server  or a local  FILE.",
+  "\t    Ranges can be specified in a number of ways.",
+  "\n\t    0-499",
+  "\n\t\tspecifies the first 500 bytes",
+  "\n\t    500-999",
+  "\n\t\tspecifies the second 500 bytes",
+  "\n\t    -500",
+  "\n\t\tspecifies the last 500 bytes",
+  "\n\t    9500-",
+  "\n\t\tspecifies the bytes from offset 9500 and forward",
+  "\n\t    0-0,-1",
+  "\n\t\tspecifies the first and last byte only(*)(HTTP)",
+  "\n\t    100-199,500-599",
+  "\n\t\tspecifies two separate 100-byte ranges(*) (HTTP)",
+  "\n\t    (*) =  NOTE  that if  specifying  multiple ranges  and  the  server",
+  "\t    supports it  then it  replies with  a multiple  part response  that",
+  "\t    curl returns as-is.  It contains  meta information  in addition  to",
+  "\t    the  requested  bytes.  Parsing  or  otherwise  transforming   this",
+  "\t    response is the responsibility of the caller.",
+  "\n\t    Only digit characters  (0-9) are  valid in the  'start' and  'stop'",
+  "\t    fields of the 'start-stop' range  syntax. If a non-digit  character",
+  "\t    is given  in  the  range, the  server's  response  is  unspecified,",
+  "\t    depending on the server's configuration.",
+  "\n\t    Many HTTP/1.1 servers  do not  have this feature  enabled, so  that",
+  "\t    when you  attempt  to get  a range,  curl  instead gets  the  whole",
+  "\t    document.",
+  "\n\t    FTP and SFTP range downloads  only support the simple  'start-stop'",
+  "\t    syntax (optionally  with  one  of the  numbers  omitted).  FTP  use",
+  "\t    depends on the extended FTP command SIZE.",
+  "\n\t    When  using this  option  for  HTTP  uploads  using  POST  or  PUT,",
+  "\t    functionality is not guaranteed. The HTTP protocol has no  standard",
+  "\t    interoperable resume  upload and  curl uses  a set  of headers  for",
+  "\t    this purpose that  once proved  working for some  servers and  have",
+  "\t    been left for those who find that useful.",
+  "\n\t    This command line option is mutually exclusive with  --continue-at:",
+  "\t    you can only use one of  them for a single transfer. If --range  is",
+  "\t    provided several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --range 22-44 https://example.com",
+  "\n\t    See also --continue-at and --append.",
+  "\n    --rate <max request rate>",
+  "\t    Specify the maximum transfer frequency  you allow curl to use -  in",
+  "\t    number of transfer starts per  time unit (sometimes called  request",
+  "\t    rate). Without this option, curl  starts the next transfer as  fast",
+  "\t    as possible.",
+  "\n\t    If given  several URLs  and a  transfer completes  faster than  the",
+  "\t    allowed rate,  curl waits  until the  next transfer  is started  to",
+  "\t    maintain the  requested  rate.  This  option  has  no  effect  when",
+  "\t    --parallel is used.",
+  "\n\t    The request rate is provided as \"N/U\" where N is an  integer number",
+  "\t    and U  is  a  time unit.  Supported  units are  's'  (second),  'm'",
+  "\t    (minute), 'h' (hour)  and 'd'  /(day, as  in a 24  hour unit).  The",
+  "\t    default time unit, if no  \"/U\" is provided, is number of  transfers",
+  "\t    per hour.",
+  "\n\t    If curl is told to allow 10 requests per minute, it does  not start",
+  "\t    the next request until  6 seconds have  elapsed since the  previous",
+  "\t    transfer was started.",
+  "\n\t    This  function  uses   millisecond  resolution.   If  the   allowed",
+  "\t    frequency is  set  more  than  1000 per  second,  it  instead  runs",
+  "\t    unrestricted.",
+  "\n\t    When retrying transfers, enabled  with --retry, the separate  retry",
+  "\t    delay logic is used and not this setting.",
+  "\n\t    Starting in  version 8.10.0,  you can  specify the  number of  time",
+  "\t    units  in the  rate  expression.  Make  curl  do  no  more  than  5",
+  "\t    transfers per 15 seconds  with \"5/15s\" or  limit it to 3  transfers",
+  "\t    per 4 hours with \"3/4h\". No spaces allowed.",
+  "\n\t    This option is global  and does not need  to be specified for  each",
+  "\t    use of --next. If  --rate is provided  several times, the last  set",
+  "\t    value is used.",
+  "\n\t    Examples:",
+  "\t     curl --rate 2/s https://example.com ...",
+  "\t     curl --rate 3/h https://example.com ...",
+  "\t     curl --rate 14/m https://example.com ...",
+  "\n\t    Added in 7.84.0. See also --limit-rate and --retry-delay.",
+  "\n    --raw",
+  "\t    (HTTP) When  used,  it  disables  all  internal  HTTP  decoding  of",
+  "\t    content or  transfer encodings  and instead  makes them  passed  on",
+  "\t    unaltered,  raw.  Providing  --raw  multiple  times  has  no  extra",
+  "\t    effect. Disable it again with --no-raw.",
+  "\n\t    Example:",
+  "\t     curl --raw https://example.com",
+  "\n\t    See also --tr-encoding.",
+  "\n    -e, --referer <URL>",
+  "\t    (HTTP) Set the referrer URL in  the HTTP request. This can also  be",
+  "\t    set with the  --header flag  of course. When  used with  --location",
+  "\t    you  can  append  \";auto\"\"  to  the  --referer  URL  to  make  curl",
+  "\t    automatically set  the previous  URL when  it follows  a  Location:",
+  "\t    header. The \";auto\" string  can be used alone,  even if you do  not",
+  "\t    set an initial --referer. If  --referer is provided several  times,",
+  "\t    the last set value is used.",
+  "\n\t    Examples:",
+  "\t     curl --referer \"https://fake.example\" https://example.com",
+  "\t     curl --referer \"https://fake.example;auto\" -L https://example.com",
+  "\t     curl --referer \";auto\" -L https://example.com",
+  "\n\t    See also --user-agent and --header.",
+  "\n    -J, --remote-header-name",
+  "\t    (HTTP) Tell the  --remote-name option to  use the  server-specified",
+  "\t    Content-Disposition filename instead of extracting a filename  from",
+  "\t    the URL. If the server-provided  filename contains a path, that  is",
+  "\t    stripped off before the filename is used.",
+  "\n\t    The file is  saved in the  current directory,  or in the  directory",
+  "\t    specified with --output-dir.",
+  "\n\t    If the  server  specifies a  filename and  a  file with  that  name",
+  "\t    already exists in the destination directory, it is not  overwritten",
+  "\t    and an error occurs  - unless you allow  it by using the  --clobber",
+  "\t    option. If the server does not specify a filename then  this option",
+  "\t    has no effect.",
+  "\n\t    There is no  attempt to  decode %-sequences (yet)  in the  provided",
+  "\t    filename, so this  option may  provide you  with rather  unexpected",
+  "\t    filenames.",
+  "\n\t    This feature uses the name  from the \"filename\" field, it does  not",
+  "\t    yet  support  the  \"filename*\"   field  (filenames  with   explicit",
+  "\t    character sets).",
+  "\n\t    WARNING: Exercise  judicious  use  of this  option,  especially  on",
+  "\t    Windows. A rogue server could send  you the name of a DLL or  other",
+  "\t    file that could be  loaded automatically by  Windows or some  third",
+  "\t    party software. Providing  --remote-header-name multiple times  has",
+  "\t    no extra effect. Disable it again with --no-remote-header-name.",
+  "\n\t    Example:",
+  "\t     curl -OJ https://example.com/file",
+  "\n\t    See also --remote-name.",
+  "\n    -O, --remote-name",
+  "\t    Write output to  a local file  named like the  remote file we  get.",
+  "\t    (Only the file  part of the remote  file is used,  the path is  cut",
+  "\t    off.)",
+  "\n\t    The file is  saved in the  current working  directory. If you  want",
+  "\t    the file saved in a  different directory, make sure you change  the",
+  "\t    current working directory before invoking curl with this option  or",
+  "\t    use --output-dir.",
+  "\n\t    The remote filename to use  for saving is extracted from the  given",
+  "\t    URL, nothing else, and if  it already exists it is overwritten.  If",
+  "\t    you want the  server to  be able  to choose the  filename refer  to",
+  "\t    --remote-header-name which can be used in addition to this  option.",
+  "\t    If the server chooses  a filename and  that name already exists  it",
+  "\t    is not overwritten.",
+  "\n\t    There is no  URL decoding done on  the filename. If  it has %20  or",
+  "\t    other  URL encoded  parts  of  the  name,  they  end  up  as-is  as",
+  "\t    filename.",
+  "\n\t    You may use  this option as many  times as the  number of URLs  you",
+  "\t    have.",
+  "\n\t    Before curl 8.10.0, curl returned an error if the URL ended  with a",
+  "\t    slash, which  means that  there is  no filename  part  in the  URL.",
+  "\t    Starting in 8.10.0, curl  sets the filename  to the last  directory",
+  "\t    part of  the URL  or if  that also  is  missing to  \"curl_response\"",
+  "\t    (without  extension)   for   this   situation.   --remote-name   is",
+  "\t    associated with a  single URL.  Use it  once per URL  when you  use",
+  "\t    several URLs in a command line.",
+  "\n\t    Examples:",
+  "\t     curl -O https://example.com/filename",
+  "\t     curl -O https://example.com/filename -O https://example.com/file2",
+  "\n\t    See also --remote-name-all, --output-dir and --remote-header-name.",
+  "\n    --remote-name-all",
+  "\t    Change the default action  for all given URLs  to be dealt with  as",
+  "\t    if --remote-name were  used for each  one. If  you want to  disable",
+  "\t    that for a specific URL after --remote-name-all has been used,  you",
+  "\t    must use \"-o  -\" or  --no-remote-name. Providing  --remote-name-all",
+  "\t    multiple  times  has  no  extra  effect.  Disable  it  again   with",
+  "\t    --no-remote-name-all.",
+  "\n\t    Example:",
+  "\t     curl --remote-name-all ftp://example.com/file1 \\",
+  "\t\t  ftp://example.com/file2",
+  "\n\t    See also --remote-name.",
+  "\n    -R, --remote-time",
+  "\t    Make curl attempt to  figure out the  timestamp of the remote  file",
+  "\t    that is  getting downloaded,  and  if that  is available  make  the",
+  "\t    local  file  get  that  same  timestamp.  Providing   --remote-time",
+  "\t    multiple  times  has  no  extra  effect.  Disable  it  again   with",
+  "\t    --no-remote-time.",
+  "\n\t    Example:",
+  "\t     curl --remote-time -o foo https://example.com",
+  "\n\t    See also --remote-name and --time-cond.",
+  "\n    --remove-on-error",
+  "\t    Remove the  output file  if an  error occurs.  If  curl returns  an",
+  "\t    error when told to save output in a local file. This  prevents curl",
+  "\t    from leaving  a  partial  file  in  the case  of  an  error  during",
+  "\t    transfer.",
+  "\n\t    If the output is not a regular file, this option has no effect.",
+  "\n\t    The   --continue-at   option   cannot   be   used   together   with",
+  "\t    --remove-on-error. Providing --remove-on-error  multiple times  has",
+  "\t    no extra effect. Disable it again with --no-remove-on-error.",
+  "\n\t    Example:",
+  "\t     curl --remove-on-error -o output https://example.com",
+  "\n\t    Added in 7.83.0. See also --fail.",
+  "\n    -X, --request <method>",
+  "\t    Change the method to use when starting the transfer.",
+  "\n\t    curl passes  on the  verbatim string  you give  it  in the  request",
+  "\t    without any filter or other safe guards. That includes white  space",
+  "\t    and control characters.",
+  "\n\t    HTTP",
+  "\n\t\tSpecifies a  custom request  method to  use when  communicating",
+  "\t\twith the  HTTP server.  The specified  request method  is  used",
+  "\t\tinstead of the method otherwise  used (which defaults to  GET).",
+  "\t\tRead the HTTP 1.1  specification for details and  explanations.",
+  "\t\tCommon additional HTTP requests  include PUT and DELETE,  while",
+  "\t\trelated technologies like  WebDAV offers  PROPFIND, COPY,  MOVE",
+  "\t\tand more.",
+  "\n\t\tNormally you do not need  this option. All sorts of GET,  HEAD,",
+  "\t\tPOST and PUT  requests are  rather invoked  by using  dedicated",
+  "\t\tcommand line options.",
+  "\n\t\tThis option  only changes  the  actual word  used in  the  HTTP",
+  "\t\trequest, it does not  alter the way  curl behaves. For  example",
+  "\t\tif you want to make a  proper HEAD request, using -X HEAD  does",
+  "\t\tnot suffice. You need to use the --head option.",
+  "\n\t\tThe method  string  you set  with  --request is  used  for  all",
+  "\t\trequests, which if  you for  example use  --location may  cause",
+  "\t\tunintended side-effects  when  curl  does  not  change  request",
+  "\t\tmethod according to the HTTP 30x response codes - and similar.",
+  "\n\t    FTP",
+  "\n\t\tSpecifies a  custom FTP  command to  use instead  of LIST  when",
+  "\t\tdoing file lists with FTP.",
+  "\n\t    POP3",
+  "\n\t\tSpecifies a  custom POP3  command  to use  instead of  LIST  or",
+  "\t\tRETR.",
+  "\n\t    IMAP",
+  "\n\t\tSpecifies a custom IMAP command to use instead of LIST.",
+  "\n\t    SMTP",
+  "\n\t\tSpecifies a  custom SMTP  command  to use  instead of  HELP  or",
+  "\t\tVRFY.",
+  "\n\t    If --request  is provided  several  times, the  last set  value  is",
+  "\t    used.",
+  "\n\t    Examples:",
+  "\t     curl -X \"DELETE\" https://example.com",
+  "\t     curl -X NLST ftp://example.com/",
+  "\n\t    See also --request-target.",
+  "\n    --request-target <path>",
+  "\t    (HTTP) Use an alternative target  (path) instead of using the  path",
+  "\t    as provided in the URL.  Particularly useful when wanting to  issue",
+  "\t    HTTP requests without  leading slash  or other data  that does  not",
+  "\t    follow the regular URL pattern, like \"OPTIONS *\".",
+  "\n\t    curl passes  on the  verbatim string  you give  it  in the  request",
+  "\t    without any filter or other safe guards. That includes white  space",
+  "\t    and control  characters. If  --request-target is  provided  several",
+  "\t    times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --request-target \"*\" -X OPTIONS https://example.com",
+  "\n\t    See also --request.",
+  "\n    --resolve <[+]host:port:addr[,addr]...>",
+  "\t    Provide a custom address for  a specific host and port pair.  Using",
+  "\t    this, you can  make the  curl requests(s) use  a specified  address",
+  "\t    and prevent the  otherwise normally  resolved address  to be  used.",
+  "\t    Consider it  a  sort  of /etc/hosts  alternative  provided  on  the",
+  "\t    command line. The  port number should  be the  number used for  the",
+  "\t    specific protocol the host is  used for. It means you need  several",
+  "\t    entries if  you want to  provide addresses  for the  same host  but",
+  "\t    different ports.",
+  "\n\t    By specifying \"*\"  as host you  can tell curl  to resolve any  host",
+  "\t    and specific  port  pair  to the  specified  address.  Wildcard  is",
+  "\t    resolved last so  any --resolve with  a specific  host and port  is",
+  "\t    used first.",
+  "\n\t    The provided address set by this  option is used even if --ipv4  or",
+  "\t    --ipv6 is set to make curl use another IP version.",
+  "\n\t    By prefixing the host  with a '+' you can  make the entry time  out",
+  "\t    after curl's default timeout (1 minute). Note that this only  makes",
+  "\t    sense for long running parallel  transfers with a lot of files.  In",
+  "\t    such cases, if this option is  used curl tries to resolve the  host",
+  "\t    as it normally would once the timeout has expired.",
+  "\n\t    Provide IPv6 addresses within [brackets].",
+  "\n\t    To redirect  connects from  a specific  hostname or  any  hostname,",
+  "\t    independently of port number, consider the --connect-to option.",
+  "\n\t    Support for resolving with wildcard was added in 7.64.0.",
+  "\n\t    Support for the '+' prefix was added in 7.75.0.",
+  "\n\t    Support for specifying the  host component as  an IPv6 address  was",
+  "\t    added in 8.13.0. --resolve can  be used several times in a  command",
+  "\t    line",
+  "\n\t    Examples:",
+  "\t     curl --resolve example.com:443:127.0.0.1 https://example.com",
+  "\t     curl --resolve example.com:443:[2001:db8::252f:efd6] \\",
+  "\t\t  https://example.com",
+  "\n\t    See also --connect-to and --alt-svc.",
+  "\n    --retry <num>",
+  "\t    If a  transient error  is returned  when curl  tries  to perform  a",
+  "\t    transfer, it  retries  this  number  of  times  before  giving  up.",
+  "\t    Setting the number  to 0  makes curl  do no retries  (which is  the",
+  "\t    default). Transient  error  means either:  a  timeout, an  FTP  4xx",
+  "\t    response code or an  HTTP 408, 429, 500,  502, 503 or 504  response",
+  "\t    code.",
+  "\n\t    When curl is about to retry  a transfer, it first waits one  second",
+  "\t    and then for all  forthcoming retries it  doubles the waiting  time",
+  "\t    until it  reaches 10  minutes,  which then  remains the  set  fixed",
+  "\t    delay time between the rest of the retries. By using  --retry-delay",
+  "\t    you  disable   this  exponential   backoff  algorithm.   See   also",
+  "\t    --retry-max-time to limit the total time allowed for retries.",
+  "\n\t    curl complies  with the  Retry-After: response  header if  one  was",
+  "\t    present to know when to issue the next retry (added in  7.66.0). If",
+  "\t    --retry is provided several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --retry 7 https://example.com",
+  "\n\t    See also --retry-max-time.",
+  "\n    --retry-all-errors",
+  "\t    Retry on any error. This option is used together with --retry.",
+  "\n\t    This option  is the  \"sledgehammer\" of  retrying. Do  not use  this",
+  "\t    option by  default  (for example  in  your curlrc),  there  may  be",
+  "\t    unintended consequences  such  as sending  or  receiving  duplicate",
+  "\t    data. Do  not use with  redirected input  or output.  You might  be",
+  "\t    better off handling your unique problems in a shell script.  Please",
+  "\t    read the example below.",
+  "\n\t    WARNING: For  server compatibility  curl attempts  to retry  failed",
+  "\t    flaky transfers as close as possible to how they were  started, but",
+  "\t    this is not possible with redirected input or output. For  example,",
+  "\t    before retrying  it  removes  output data  from  a  failed  partial",
+  "\t    transfer that was written  to an output  file. However this is  not",
+  "\t    true of  data redirected  to a  | pipe  or >  file,  which are  not",
+  "\t    reset. We strongly suggest  you do not  parse or record output  via",
+  "\t    redirect in combination  with this  option, since  you may  receive",
+  "\t    duplicate data.",
+  "\n\t    By default  curl does not  return an  error for  transfers with  an",
+  "\t    HTTP response code that  indicates an HTTP  error, if the  transfer",
+  "\t    was successful. For example, if a server replies 404 Not  Found and",
+  "\t    the reply  is  fully  received then  that  is not  an  error.  When",
+  "\t    --retry is used then curl retries on some HTTP response  codes that",
+  "\t    indicate transient HTTP errors, but that does not include most  4xx",
+  "\t    response codes such as  404. If you want  to retry on all  response",
+  "\t    codes that indicate  HTTP errors  (4xx and 5xx)  then combine  with",
+  "\t    --fail. Providing --retry-all-errors  multiple times  has no  extra",
+  "\t    effect. Disable it again with --no-retry-all-errors.",
+  "\n\t    Example:",
+  "\t     curl --retry 5 --retry-all-errors https://example.com",
+  "\n\t    Added in 7.71.0. See also --retry.",
+  "\n    --retry-connrefused",
+  "\t    In addition to  the other  conditions, consider  ECONNREFUSED as  a",
+  "\t    transient error too for --retry. This option is used together  with",
+  "\t    --retry. Providing --retry-connrefused multiple times has no  extra",
+  "\t    effect. Disable it again with --no-retry-connrefused.",
+  "\n\t    Example:",
+  "\t     curl --retry-connrefused --retry 7 https://example.com",
+  "\n\t    See also --retry and --retry-all-errors.",
+  "\n    --retry-delay <seconds>",
+  "\t    Make curl  sleep  this amount  of time  before  each retry  when  a",
+  "\t    transfer has failed with a transient error (it changes the  default",
+  "\t    backoff time  algorithm  between  retries).  This  option  is  only",
+  "\t    interesting if --retry  is also  used. Setting this  delay to  zero",
+  "\t    makes curl use the default backoff time.",
+  "\n\t    By default, curl uses  an exponentially increasing timeout  between",
+  "\t    retries.",
+  "\n\t    Starting in  curl 8.16.0,  this option  accepts a  time as  decimal",
+  "\t    number  for parts  of  seconds.  The  decimal  value  needs  to  be",
+  "\t    provided using  a dot  (.) as  decimal separator  -  not the  local",
+  "\t    version  even  if   it  might  be   using  another  separator.   If",
+  "\t    --retry-delay is  provided several  times, the  last set  value  is",
+  "\t    used.",
+  "\n\t    Example:",
+  "\t     curl --retry-delay 5 --retry 7 https://example.com",
+  "\n\t    See also --retry and --retry-max-time.",
+  "\n    --retry-max-time <seconds>",
+  "\t    The retry  timer  is  reset  before  the  first  transfer  attempt.",
+  "\t    Retries are done as  usual (see --retry) as  long as the timer  has",
+  "\t    not reached  this given limit.  Notice that  if the  timer has  not",
+  "\t    reached the limit,  the request  is made and  while performing,  it",
+  "\t    may take  longer than this  given time  period. To  limit a  single",
+  "\t    request's maximum time, use --max-time. Set this option to zero  to",
+  "\t    not timeout retries.",
+  "\n\t    Starting in  curl 8.16.0,  this option  accepts a  time as  decimal",
+  "\t    number  for parts  of  seconds.  The  decimal  value  needs  to  be",
+  "\t    provided using  a dot  (.) as  decimal separator  -  not the  local",
+  "\t    version  even  if   it  might  be   using  another  separator.   If",
+  "\t    --retry-max-time is provided several times,  the last set value  is",
+  "\t    used.",
+  "\n\t    Example:",
+  "\t     curl --retry-max-time 30 --retry 10 https://example.com",
+  "\n\t    See also --retry and --retry-delay.",
+  "\n    --sasl-authzid <identity>",
+  "\t    Use  this  authorization  identity  (authzid),  during  SASL  PLAIN",
+  "\t    authentication,  in   addition  to   the  authentication   identity",
+  "\t    (authcid) as specified by --user.",
+  "\n\t    If the  option is  not specified,  the server  derives the  authzid",
+  "\t    from the authcid,  but if  specified, and depending  on the  server",
+  "\t    implementation, it  may be  used to  access another  user's  inbox,",
+  "\t    that the user has been granted  access to, or a shared mailbox  for",
+  "\t    example. If --sasl-authzid is provided several times, the last  set",
+  "\t    value is used.",
+  "\n\t    Example:",
+  "\t     curl --sasl-authzid zid imap://example.com/",
+  "\n\t    Added in 7.66.0. See also --login-options.",
+  "\n    --sasl-ir",
+  "\t    Enable  initial   response   in  SASL   authentication.   Providing",
+  "\t    --sasl-ir multiple  times has  no extra  effect. Disable  it  again",
+  "\t    with --no-sasl-ir.",
+  "\n\t    Example:",
+  "\t     curl --sasl-ir imap://example.com/",
+  "\n\t    See also --sasl-authzid.",
+  "\n    --service-name <name>",
+  "\t    Set the  service name  for SPNEGO.  If --service-name  is  provided",
+  "\t    several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --service-name sockd/server https://example.com",
+  "\n\t    See also --negotiate and --proxy-service-name.",
+  "\n    -S, --show-error",
+  "\t    When used with --silent, it makes curl show an error message  if it",
+  "\t    fails.",
+  "\n\t    This option is global  and does not need  to be specified for  each",
+  "\t    use of --next. Providing --show-error  multiple times has no  extra",
+  "\t    effect. Disable it again with --no-show-error.",
+  "\n\t    Example:",
+  "\t     curl --show-error --silent https://example.com",
+  "\n\t    See also --no-progress-meter.",
+  "\n    -i, --show-headers",
+  "\t    (HTTP FTP)  Show  response headers  in  the output.  HTTP  response",
+  "\t    headers can include things like  server name, cookies, date of  the",
+  "\t    document, HTTP  version  and  more. With  non-HTTP  protocols,  the",
+  "\t    \"headers\" are other server communication.",
+  "\n\t    This option  makes  the response  headers  get saved  in  the  same",
+  "\t    stream/output as the data. --dump-header exists to save headers  in",
+  "\t    a separate stream.",
+  "\n\t    To view the request headers, consider the --verbose option.",
+  "\n\t    Prior to 7.75.0 curl did not  print the headers if --fail was  used",
+  "\t    in combination with this option and there was an error  reported by",
+  "\t    the server.",
+  "\n\t    This option was called --include  before 8.10.0. The previous  name",
+  "\t    remains functional. Providing --show-headers multiple times has  no",
+  "\t    extra effect. Disable it again with --no-show-headers.",
+  "\n\t    Example:",
+  "\t     curl -i https://example.com",
+  "\n\t    See also --verbose and --dump-header.",
+  "\n    --sigalgs <list>",
+  "\t    (TLS) Set specific signature algorithms  to use during SSL  session",
+  "\t    establishment according to RFC 5246, 7.4.1.4.1.",
+  "\n\t    An algorithm  can  use either  a  signature algorithm  and  a  hash",
+  "\t    algorithm pair separated  by a  \"+\" (e.g.  \"ECDSA+SHA224\"), or  its",
+  "\t    TLS 1.3 signature scheme name (e.g. \"ed25519\").",
+  "\n\t    Multiple algorithms can  be provided  by separating  them with  \":\"",
+  "\t    (e.g. \"DSA+SHA256:rsa_pss_pss_sha256\"). The parameter is  available",
+  "\t    as \"-sigalgs\" in the OpenSSL \"s_client\" and \"s_server\" utilities.",
+  "\n\t    \"--sigalgs\" allows a OpenSSL  powered curl to make  SSL-connections",
+  "\t    with exactly  the signature  algorithms  requested by  the  client,",
+  "\t    avoiding nontransparent client/server negotiations.",
+  "\n\t    If this option is set,  the default signature algorithm list  built",
+  "\t    into OpenSSL are ignored. If  --sigalgs is provided several  times,",
+  "\t    the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --sigalgs ecdsa_secp256r1_sha256 https://example.com",
+  "\n\t    Added in 8.14.0. See also --ciphers.",
+  "\n    -s, --silent",
+  "\t    Silent  or  quiet  mode.  Do  not  show  progress  meter  or  error",
+  "\t    messages. Makes curl mute. It  still outputs the data you ask  for,",
+  "\t    potentially even to the terminal/stdout unless you redirect it.",
+  "\n\t    Use --show-error in  addition to  this option  to disable  progress",
+  "\t    meter but still  show error messages.  Providing --silent  multiple",
+  "\t    times has no extra effect. Disable it again with --no-silent.",
+  "\n\t    Example:",
+  "\t     curl -s https://example.com",
+  "\n\t    See also --verbose, --stderr and --no-progress-meter.",
+  "\n    --skip-existing",
+  "\t    If there is a local file present when a download is  requested, the",
+  "\t    operation is skipped. Note that curl cannot know if the  local file",
+  "\t    was previously  downloaded fine,  or if  it is  incomplete etc,  it",
+  "\t    just knows if  there is a  filename present in  the file system  or",
+  "\t    not and it skips the  transfer if it is. Providing  --skip-existing",
+  "\t    multiple  times  has  no  extra  effect.  Disable  it  again   with",
+  "\t    --no-skip-existing.",
+  "\n\t    Example:",
+  "\t     curl --skip-existing --output local/dir/file https://example.com",
+  "\n\t    Added   in   8.10.0.   See   also   --output,   --remote-name   and",
+  "\t    --no-clobber.",
+  "\n    --socks4 <host[:port]>",
+  "\t    Use  the  specified  SOCKS4  proxy.  If  the  port  number  is  not",
+  "\t    specified, it  is assumed  at  port 1080.  Using this  socket  type",
+  "\t    makes curl  resolve the hostname  and pass  the address  on to  the",
+  "\t    proxy.",
+  "\n\t    To specify proxy on a  Unix domain socket, use localhost for  host,",
+  "\t    e.g. \"socks4://localhost/path/to/socket.sock\"",
+  "\n\t    This option  overrides any  previous use  of --proxy,  as they  are",
+  "\t    mutually exclusive.",
+  "\n\t    This option is  superfluous since  you can specify  a socks4  proxy",
+  "\t    with --proxy using a socks4:// protocol prefix.",
+  "\n\t    --preproxy can be used  to specify a SOCKS  proxy at the same  time",
+  "\t    proxy is used with an HTTP/HTTPS proxy. In such a case,  curl first",
+  "\t    connects to the SOCKS  proxy and then  connects (through SOCKS)  to",
+  "\t    the HTTP or  HTTPS proxy.  If --socks4 is  provided several  times,",
+  "\t    the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --socks4 hostname:4096 https://example.com",
+  "\n\t    See also --socks4a, --socks5 and --socks5-hostname.",
+  "\n    --socks4a <host[:port]>",
+  "\t    Use  the specified  SOCKS4a  proxy.  If  the  port  number  is  not",
+  "\t    specified, it  is assumed  at port  1080. This  asks  the proxy  to",
+  "\t    resolve the hostname.",
+  "\n\t    To specify proxy on a  Unix domain socket, use localhost for  host,",
+  "\t    e.g. \"socks4a://localhost/path/to/socket.sock\"",
+  "\n\t    This option  overrides any  previous use  of --proxy,  as they  are",
+  "\t    mutually exclusive.",
+  "\n\t    This option is superfluous  since you can  specify a socks4a  proxy",
+  "\t    with --proxy using a socks4a:// protocol prefix.",
+  "\n\t    --preproxy can be used  to specify a SOCKS  proxy at the same  time",
+  "\t    --proxy is  used with an  HTTP/HTTPS proxy.  In such  a case,  curl",
+  "\t    first connects  to  the  SOCKS proxy  and  then  connects  (through",
+  "\t    SOCKS) to  the  HTTP  or  HTTPS proxy.  If  --socks4a  is  provided",
+  "\t    several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --socks4a hostname:4096 https://example.com",
+  "\n\t    See also --socks4, --socks5 and --socks5-hostname.",
+  "\n    --socks5 <host[:port]>",
+  "\t    Use the specified SOCKS5 proxy - but resolve the hostname  locally.",
+  "\t    If the port number is not specified, it is assumed at port 1080.",
+  "\n\t    To specify proxy on a  Unix domain socket, use localhost for  host,",
+  "\t    e.g. \"socks5://localhost/path/to/socket.sock\"",
+  "\n\t    This option  overrides any  previous use  of --proxy,  as they  are",
+  "\t    mutually exclusive.",
+  "\n\t    This option is  superfluous since  you can specify  a socks5  proxy",
+  "\t    with --proxy using a socks5:// protocol prefix.",
+  "\n\t    --preproxy can be used  to specify a SOCKS  proxy at the same  time",
+  "\t    --proxy is  used with an  HTTP/HTTPS proxy.  In such  a case,  curl",
+  "\t    first connects  to  the  SOCKS proxy  and  then  connects  (through",
+  "\t    SOCKS) to the HTTP or HTTPS proxy.",
+  "\n\t    This option  does  not  work with  FTPS  or LDAP.  If  --socks5  is",
+  "\t    provided several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --socks5 proxy.example:7000 https://example.com",
+  "\n\t    See also --socks5-hostname and --socks4a.",
+  "\n    --socks5-basic",
+  "\t    Use username/password authentication  when connecting  to a  SOCKS5",
+  "\t    proxy. The username/password authentication is enabled by  default.",
+  "\t    Use --socks5-gssapi  to  force  GSS-API  authentication  to  SOCKS5",
+  "\t    proxies. Providing  --socks5-basic  multiple  times  has  no  extra",
+  "\t    effect.",
+  "\n\t    Example:",
+  "\t     curl --socks5-basic --socks5 hostname:4096 https://example.com",
+  "\n\t    See also --socks5.",
+  "\n    --socks5-gssapi",
+  "\t    Use GSS-API authentication when connecting  to a SOCKS5 proxy.  The",
+  "\t    GSS-API authentication is enabled by  default (if curl is  compiled",
+  "\t    with   GSS-API    support).    Use    --socks5-basic    to    force",
+  "\t    username/password  authentication  to  SOCKS5  proxies.   Providing",
+  "\t    --socks5-gssapi multiple  times has  no  extra effect.  Disable  it",
+  "\t    again with --no-socks5-gssapi.",
+  "\n\t    Example:",
+  "\t     curl --socks5-gssapi --socks5 hostname:4096 https://example.com",
+  "\n\t    See also --socks5.",
+  "\n    --socks5-gssapi-nec",
+  "\t    As  part  of   the  GSS-API  negotiation   a  protection  mode   is",
+  "\t    negotiated.  RFC  1961  says  in  section  4.3/4.4  it  should   be",
+  "\t    protected, but  the  NEC  reference implementation  does  not.  The",
+  "\t    option --socks5-gssapi-nec allows the  unprotected exchange of  the",
+  "\t    protection   mode   negotiation.   Providing    --socks5-gssapi-nec",
+  "\t    multiple  times  has  no  extra  effect.  Disable  it  again   with",
+  "\t    --no-socks5-gssapi-nec.",
+  "\n\t    Example:",
+  "\t     curl --socks5-gssapi-nec --socks5 hostname:4096 \\",
+  "\t\t  https://example.com",
+  "\n\t    See also --socks5.",
+  "\n    --socks5-gssapi-service <name>",
+  "\t    Set  the   service   name   for  a   socks   server.   Default   is",
+  "\t    rcmd/server-fqdn. If  --socks5-gssapi-service is  provided  several",
+  "\t    times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --socks5-gssapi-service sockd --socks5 hostname:4096 \\",
+  "\t\t  https://example.com",
+  "\n\t    See also --socks5.",
+  "\n    --socks5-hostname <host[:port]>",
+  "\t    Use the  specified SOCKS5  proxy  (and let  the proxy  resolve  the",
+  "\t    hostname). If the port  number is not  specified, it is assumed  at",
+  "\t    port 1080.",
+  "\n\t    To specify proxy on a  Unix domain socket, use localhost for  host,",
+  "\t    e.g. \"socks5h://localhost/path/to/socket.sock\"",
+  "\n\t    This option  overrides any  previous use  of --proxy,  as they  are",
+  "\t    mutually exclusive.",
+  "\n\t    This option is superfluous since you can specify a socks5  hostname",
+  "\t    proxy with --proxy using a socks5h:// protocol prefix.",
+  "\n\t    --preproxy can be used  to specify a SOCKS  proxy at the same  time",
+  "\t    --proxy is  used with an  HTTP/HTTPS proxy.  In such  a case,  curl",
+  "\t    first connects  to  the  SOCKS proxy  and  then  connects  (through",
+  "\t    SOCKS)  to  the  HTTP  or  HTTPS  proxy.  If  --socks5-hostname  is",
+  "\t    provided several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --socks5-hostname proxy.example:7000 https://example.com",
+  "\n\t    See also --socks5 and --socks4a.",
+  "\n    -Y, --speed-limit <speed>",
+  "\t    If a transfer is slower than  this set speed (in bytes per  second)",
+  "\t    for a given number of seconds, it gets aborted. The time  period is",
+  "\t    set  with  --speed-time   and  is   30  seconds   by  default.   If",
+  "\t    --speed-limit is  provided several  times, the  last set  value  is",
+  "\t    used.",
+  "\n\t    Example:",
+  "\t     curl --speed-limit 300 --speed-time 10 https://example.com",
+  "\n\t    See also --speed-time, --limit-rate and --max-time.",
+  "\n    -y, --speed-time <seconds>",
+  "\t    If a transfer runs slower than speed-limit bytes per second  during",
+  "\t    a speed-time  period, the  transfer is  aborted. If  speed-time  is",
+  "\t    used, the default speed-limit is 1 unless set with --speed-limit.",
+  "\n\t    This option controls  transfers (in both  directions) but does  not",
+  "\t    affect slow connects  etc. If this  is a concern  for you, try  the",
+  "\t    --connect-timeout  option.  If  --speed-time  is  provided  several",
+  "\t    times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --speed-limit 300 --speed-time 10 https://example.com",
+  "\n\t    See also --speed-limit and --limit-rate.",
+  "\n    --ssl",
+  "\t    (FTP IMAP POP3 SMTP LDAP)  Warning: this is considered an  insecure",
+  "\t    option. Consider using --ssl-reqd instead to be sure curl  upgrades",
+  "\t    to a secure connection.",
+  "\n\t    Try to  use  SSL/TLS for  the connection  -  often referred  to  as",
+  "\t    STARTTLS or STLS  because of  the involved commands.  Reverts to  a",
+  "\t    non-secure connection if the server  does not support SSL/TLS.  See",
+  "\t    also --ftp-ssl-control  and  --ssl-reqd  for  different  levels  of",
+  "\t    encryption required.",
+  "\n\t    This option  is handled  in LDAP  (added in  7.81.0).  It is  fully",
+  "\t    supported by the OpenLDAP backend  and ignored by the generic  ldap",
+  "\t    backend.",
+  "\n\t    Please  note  that  a  server  may  close  the  connection  if  the",
+  "\t    negotiation does not succeed.",
+  "\n\t    This option was formerly known  as --ftp-ssl. That option name  can",
+  "\t    still be used but might  be removed in a future version.  Providing",
+  "\t    --ssl multiple times  has no  extra effect. Disable  it again  with",
+  "\t    --no-ssl.",
+  "\n\t    Example:",
+  "\t     curl --ssl pop3://example.com/",
+  "\n\t    See also --ssl-reqd, --insecure and --ciphers.",
+  "\n    --ssl-allow-beast",
+  "\t    (TLS) Do not  work around a  security flaw  in the TLS1.0  protocol",
+  "\t    known as BEAST. If this option  is not used, the TLS layer may  use",
+  "\t    workarounds known  to  cause interoperability  problems  with  some",
+  "\t    older server implementations.",
+  "\n\t    This option only changes  how curl does TLS  1.0 and has no  effect",
+  "\t    on later TLS versions.",
+  "\n\t    WARNING: this option loosens  the TLS security,  and by using  this",
+  "\t    flag  you  ask  for   exactly  that.  Providing   --ssl-allow-beast",
+  "\t    multiple  times  has  no  extra  effect.  Disable  it  again   with",
+  "\t    --no-ssl-allow-beast.",
+  "\n\t    Example:",
+  "\t     curl --ssl-allow-beast https://example.com",
+  "\n\t    See also --proxy-ssl-allow-beast and --insecure.",
+  "\n    --ssl-auto-client-cert",
+  "\t    (TLS) (Schannel) Automatically locate and use a client  certificate",
+  "\t    for authentication, when requested by the server. Since the  server",
+  "\t    can request any certificate that supports client authentication  in",
+  "\t    the OS  certificate  store it  could  be a  privacy  violation  and",
+  "\t    unexpected. Providing --ssl-auto-client-cert multiple times has  no",
+  "\t    extra effect. Disable it again with --no-ssl-auto-client-cert.",
+  "\n\t    Example:",
+  "\t     curl --ssl-auto-client-cert https://example.com",
+  "\n\t    Added in 7.77.0. See also --proxy-ssl-auto-client-cert.",
+  "\n    --ssl-no-revoke",
+  "\t    (TLS) (Schannel)  Disable certificate  revocation checks.  WARNING:",
+  "\t    this option loosens the  SSL security, and  by using this flag  you",
+  "\t    ask for exactly that. Providing --ssl-no-revoke multiple times  has",
+  "\t    no extra effect. Disable it again with --no-ssl-no-revoke.",
+  "\n\t    Example:",
+  "\t     curl --ssl-no-revoke https://example.com",
+  "\n\t    See also --crlfile.",
+  "\n    --ssl-reqd",
+  "\t    (FTP IMAP  POP3 SMTP  LDAP) Require  SSL/TLS for  the connection  -",
+  "\t    often referred  to as  STARTTLS  or STLS  because of  the  involved",
+  "\t    commands. Terminates  the  connection  if the  transfer  cannot  be",
+  "\t    upgraded to use SSL/TLS.",
+  "\n\t    This option  is handled  in LDAP  (added in  7.81.0).  It is  fully",
+  "\t    supported by the OpenLDAP backend and rejected by the generic  ldap",
+  "\t    backend if explicit TLS is required.",
+  "\n\t    This option is unnecessary if you  use a URL scheme that in  itself",
+  "\t    implies immediate and implicit  use of TLS,  like for FTPS,  IMAPS,",
+  "\t    POP3S, SMTPS and  LDAPS. Such a  transfer always  fails if the  TLS",
+  "\t    handshake does not work.",
+  "\n\t    This  option  was  formerly  known  as  --ftp-ssl-reqd.   Providing",
+  "\t    --ssl-reqd multiple times  has no  extra effect.  Disable it  again",
+  "\t    with --no-ssl-reqd.",
+  "\n\t    Example:",
+  "\t     curl --ssl-reqd ftp://example.com",
+  "\n\t    See also --ssl and --insecure.",
+  "\n    --ssl-revoke-best-effort",
+  "\t    (TLS) (Schannel)  Ignore certificate  revocation checks  when  they",
+  "\t    failed  due  to   missing/offline  distribution   points  for   the",
+  "\t    revocation   check   lists.   Providing    --ssl-revoke-best-effort",
+  "\t    multiple  times  has  no  extra  effect.  Disable  it  again   with",
+  "\t    --no-ssl-revoke-best-effort.",
+  "\n\t    Example:",
+  "\t     curl --ssl-revoke-best-effort https://example.com",
+  "\n\t    Added in 7.70.0. See also --crlfile and --insecure.",
+  "\n    --ssl-sessions <filename>",
+  "\t    (TLS) Use the given  file to load  SSL session tickets into  curl's",
+  "\t    cache before starting  any transfers.  At the end  of a  successful",
+  "\t    curl run, the cached  SSL sessions tickets  are saved to the  file,",
+  "\t    replacing any previous content.",
+  "\n\t    The file does not  have to exist, but curl  reports an error if  it",
+  "\t    is unable  to create  it. Unused  loaded tickets  are saved  again,",
+  "\t    unless they  get  replaced  or  purged from  the  cache  for  space",
+  "\t    reasons.",
+  "\n\t    Using a session  file allows  \"--tls-earlydata\" to  send the  first",
+  "\t    request in \"0-RTT\" mode, should an SSL session with the  feature be",
+  "\t    found. Note that  a server may  not support  early data. Also  note",
+  "\t    that early data does  not provide forward  secrecy, e.g. is not  as",
+  "\t    secure.",
+  "\n\t    The SSL session  tickets are  stored as base64  encoded text,  each",
+  "\t    ticket on its own line. The hostnames are cryptographically  salted",
+  "\t    and hashed.  While this  prevents someone  from easily  seeing  the",
+  "\t    hosts you contacted, they could still check if a specific  hostname",
+  "\t    matches one of the values.",
+  "\n\t    This feature requires  that the underlying  libcurl was built  with",
+  "\t    the experimental  SSL session  import/export feature  (SSLS-EXPORT)",
+  "\t    enabled. If --ssl-sessions is provided several times, the last  set",
+  "\t    value is used.",
+  "\n\t    Example:",
+  "\t     curl --ssl-sessions sessions.txt https://example.com",
+  "\n\t    Added in 8.12.0. See also --tls-earlydata.",
+  "\n    -2, --sslv2",
+  "\t    (SSL) This option previously  asked curl to  use SSLv2, but is  now",
+  "\t    ignored (added  in 7.77.0).  SSLv2  is widely  considered  insecure",
+  "\t    (see RFC  6176).  Providing --sslv2  multiple  times has  no  extra",
+  "\t    effect.",
+  "\n\t    Example:",
+  "\t     curl --sslv2 https://example.com",
+  "\n\t    --sslv2 requires that libcurl is built to support TLS. This  option",
+  "\t    is  mutually  exclusive  with   --sslv3,  --tlsv1,  --tlsv1.1   and",
+  "\t    --tlsv1.2. See also --http1.1 and --http2.",
+  "\n    -3, --sslv3",
+  "\t    (SSL) This option previously  asked curl to  use SSLv3, but is  now",
+  "\t    ignored (added  in 7.77.0).  SSLv3  is widely  considered  insecure",
+  "\t    (see RFC  7568).  Providing --sslv3  multiple  times has  no  extra",
+  "\t    effect.",
+  "\n\t    Example:",
+  "\t     curl --sslv3 https://example.com",
+  "\n\t    --sslv3 requires that libcurl is built to support TLS. This  option",
+  "\t    is  mutually  exclusive  with   --sslv2,  --tlsv1,  --tlsv1.1   and",
+  "\t    --tlsv1.2. See also --http1.1 and --http2.",
+  "\n    --stderr <file>",
+  "\t    Redirect all writes  to stderr  to the specified  file instead.  If",
+  "\t    the filename is a plain '-', it is instead written to stdout.",
+  "\n\t    This option is global  and does not need  to be specified for  each",
+  "\t    use of --next. If --stderr is provided several times, the  last set",
+  "\t    value is used.",
+  "\n\t    Example:",
+  "\t     curl --stderr output.txt https://example.com",
+  "\n\t    See also --verbose and --silent.",
+  "\n    --styled-output",
+  "\t    Enable automatic use of bold font styles when writing HTTP  headers",
+  "\t    to the terminal. Use --no-styled-output to switch them off.",
+  "\n\t    Styled output requires  a terminal that  supports bold fonts.  This",
+  "\t    feature is not  present on  curl for  Windows due to  lack of  this",
+  "\t    capability.",
+  "\n\t    This option is global  and does not need  to be specified for  each",
+  "\t    use of  --next. Providing  --styled-output  multiple times  has  no",
+  "\t    extra effect. Disable it again with --no-styled-output.",
+  "\n\t    Example:",
+  "\t     curl --styled-output -I https://example.com",
+  "\n\t    Added in 7.61.0. See also --head and --verbose.",
+  "\n    --suppress-connect-headers",
+  "\t    When --proxytunnel is used  and a CONNECT  request is made, do  not",
+  "\t    output proxy CONNECT response headers.  This option is meant to  be",
+  "\t    used with --dump-header  or --show-headers which  are used to  show",
+  "\t    protocol headers in the output.  It has no effect on debug  options",
+  "\t    such  as  --verbose  or  --trace,  or  any  statistics.   Providing",
+  "\t    --suppress-connect-headers multiple  times  has  no  extra  effect.",
+  "\t    Disable it again with --no-suppress-connect-headers.",
+  "\n\t    Example:",
+  "\t     curl --suppress-connect-headers --show-headers -x proxy \\",
+  "\t\t  https://example.com",
+  "\n\t    See also --dump-header, --show-headers and --proxytunnel.",
+  "\n    --tcp-fastopen",
+  "\t    Enable use of  TCP Fast  Open (RFC 7413).  TCP Fast Open  is a  TCP",
+  "\t    extension that allows data to  be sent earlier over the  connection",
+  "\t    (before the  final handshake  ACK) if  the client  and server  have",
+  "\t    been connected previously. Providing --tcp-fastopen multiple  times",
+  "\t    has no extra effect. Disable it again with --no-tcp-fastopen.",
+  "\n\t    Example:",
+  "\t     curl --tcp-fastopen https://example.com",
+  "\n\t    See also --false-start.",
+  "\n    --tcp-nodelay",
+  "\t    Turn on  the TCP_NODELAY  option. See  the curl_easy_setopt(3)  man",
+  "\t    page for details about this option.",
+  "\n\t    curl sets this option by default and you need to  explicitly switch",
+  "\t    it off if you do  not want it on. Providing --tcp-nodelay  multiple",
+  "\t    times has no extra effect. Disable it again with --no-tcp-nodelay.",
+  "\n\t    Example:",
+  "\t     curl --tcp-nodelay https://example.com",
+  "\n\t    See also --no-buffer.",
+  "\n    -t, --telnet-option <opt=val>",
+  "\t    Pass options to the telnet protocol. Supported options are:",
+  "\n\t    TTYPE=<term>",
+  "\n\t\tSets the terminal type.",
+  "\n\t    XDISPLOC=<X display>",
+  "\n\t\tSets the X display location.",
+  "\n\t    NEW_ENV=<var,val>",
+  "\n\t\tSets an environment variable.",
+  "\n\t    --telnet-option can be used several times in a command line",
+  "\n\t    Example:",
+  "\t     curl -t TTYPE=vt100 telnet://example.com/",
+  "\n\t    See also --config.",
+  "\n    --tftp-blksize <value>",
+  "\t    (TFTP) Set the TFTP  BLKSIZE option (must  be 512 or larger).  This",
+  "\t    is the block size that curl tries to use when transferring  data to",
+  "\t    or  from  a  TFTP  server.  By  default  512  bytes  are  used.  If",
+  "\t    --tftp-blksize is provided  several times,  the last  set value  is",
+  "\t    used.",
+  "\n\t    Example:",
+  "\t     curl --tftp-blksize 1024 tftp://example.com/file",
+  "\n\t    See also --tftp-no-options.",
+  "\n    --tftp-no-options",
+  "\t    (TFTP) Do not  send TFTP  options requests.  This improves  interop",
+  "\t    with some  legacy  servers  that do  not  acknowledge  or  properly",
+  "\t    implement TFTP options. When this option is used --tftp-blksize  is",
+  "\t    ignored. Providing --tftp-no-options  multiple times  has no  extra",
+  "\t    effect. Disable it again with --no-tftp-no-options.",
+  "\n\t    Example:",
+  "\t     curl --tftp-no-options tftp://192.168.0.1/",
+  "\n\t    See also --tftp-blksize.",
+  "\n    -z, --time-cond <time>",
+  "\t    (HTTP FTP) Request  a file that  has been  modified later than  the",
+  "\t    given time  and date, or  one that  has been  modified before  that",
+  "\t    time. The date expression  can be all sorts  of date strings or  if",
+  "\t    it does not match  any internal ones, it  is treated as a  filename",
+  "\t    and curl tries to get the modification date (mtime) from  that file",
+  "\t    instead. See  the curl_getdate(3)  man  pages for  date  expression",
+  "\t    details.",
+  "\n\t    Start the date expression with a dash (-) to make it request  for a",
+  "\t    document that  is older  than  the given  date/time, default  is  a",
+  "\t    document that is newer than the specified date/time.",
+  "\n\t    If provided a non-existing file, curl outputs a warning about  that",
+  "\t    fact and proceeds to do  the transfer without a time condition.  If",
+  "\t    --time-cond is provided several times, the last set value is used.",
+  "\n\t    Examples:",
+  "\t     curl -z \"Wed 01 Sep 2021 12:18:00\" https://example.com",
+  "\t     curl -z \"-Wed 01 Sep 2021 12:18:00\" https://example.com",
+  "\t     curl -z file https://example.com",
+  "\n\t    See also --etag-compare and --remote-time.",
+  "\n    --tls-earlydata",
+  "\t    (TLS) Enable the use  of TLSv1.3 early  data, also known as  '0RTT'",
+  "\t    where possible.  This has  security implications  for the  requests",
+  "\t    sent that way.",
+  "\n\t    This option can be used when curl is built to use  GnuTLS, wolfSSL,",
+  "\t    quictls and OpenSSL as a  TLS provider (but not BoringSSL,  AWS-LC,",
+  "\t    or rustls).",
+  "\n\t    If a server supports this  TLSv1.3 feature, and to what extent,  is",
+  "\t    announced as part  of the TLS  \"session\" sent  back to curl.  Until",
+  "\t    curl has  seen such a  session in  a previous  request, early  data",
+  "\t    cannot be used.",
+  "\n\t    When a new connection  is initiated with  a known TLSv1.3  session,",
+  "\t    and that session  announced early data  support, the first  request",
+  "\t    on this connection is  sent before the  TLS handshake is  complete.",
+  "\t    While the  early  data  is  also encrypted,  it  is  not  protected",
+  "\t    against replays.  An  attacker can  send  your early  data  to  the",
+  "\t    server again and the server would accept it.",
+  "\n\t    If your  request contacts  a  public server  and only  retrieves  a",
+  "\t    file, there may be no harm  in that. If the first request orders  a",
+  "\t    refrigerator for you, it is probably  not a good idea to use  early",
+  "\t    data for it. curl cannot  deduce what the security implications  of",
+  "\t    your requests actually are and make this decision for you.",
+  "\n\t    The amount  of  early  data sent  can  be inspected  by  using  the",
+  "\t    \"--write-out\" variable \"tls_earlydata\".",
+  "\n\t    WARNING: this option has security implications. See above for  more",
+  "\t    details. Providing  --tls-earlydata  multiple times  has  no  extra",
+  "\t    effect. Disable it again with --no-tls-earlydata.",
+  "\n\t    Example:",
+  "\t     curl --tls-earlydata https://example.com",
+  "\n\t    Added in 8.11.0. See also --tlsv1.3, --tls-max and --ssl-sessions.",
+  "\n    --tls-max <VERSION>",
+  "\t    (TLS) Set the maximum allowed  TLS version. The minimum  acceptable",
+  "\t    version is set by tlsv1.0, tlsv1.1, tlsv1.2 or tlsv1.3.",
+  "\n\t    If the connection is done  without TLS, this option has no  effect.",
+  "\t    This includes QUIC-using (HTTP/3) transfers.",
+  "\n\t    default",
+  "\n\t\tUse up to the recommended TLS version.",
+  "\n\t    1.0",
+  "\n\t\tUse up to TLSv1.0.",
+  "\n\t    1.1",
+  "\n\t\tUse up to TLSv1.1.",
+  "\n\t    1.2",
+  "\n\t\tUse up to TLSv1.2.",
+  "\n\t    1.3",
+  "\n\t\tUse up to TLSv1.3.",
+  "\n\t    If --tls-max  is provided  several  times, the  last set  value  is",
+  "\t    used.",
+  "\n\t    Examples:",
+  "\t     curl --tls-max 1.2 https://example.com",
+  "\t     curl --tls-max 1.3 --tlsv1.2 https://example.com",
+  "\n\t    --tls-max requires that libcurl is  built to support TLS. See  also",
+  "\t    --tlsv1.0, --tlsv1.1, --tlsv1.2 and --tlsv1.3.",
+  "\n    --tls13-ciphers <list>",
+  "\t    (TLS) Set  which  cipher suites  to use  in  the connection  if  it",
+  "\t    negotiates TLS 1.3. The list  of ciphers suites must specify  valid",
+  "\t    ciphers. Read up on TLS 1.3 cipher suite details on this URL:",
+  "\n\t    https://curl.se/docs/ssl-ciphers.html",
+  "\n\t    This option is  used when  curl is  built to use  OpenSSL 1.1.1  or",
+  "\t    later, wolfSSL, or mbedTLS 3.6.0 or later.",
+  "\n\t    Before curl 8.10.0 with mbedTLS  or wolfSSL, TLS 1.3 cipher  suites",
+  "\t    were set  by  using the  --ciphers  option. If  --tls13-ciphers  is",
+  "\t    provided several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --tls13-ciphers TLS_AES_128_GCM_SHA256 https://example.com",
+  "\n\t    Added in  7.61.0.  See also  --ciphers,  --proxy-tls13-ciphers  and",
+  "\t    --curves.",
+  "\n    --tlsauthtype <type>",
+  "\t    (TLS) Set TLS  authentication type. Currently,  the only  supported",
+  "\t    option  is  \"SRP\",  for  TLS-SRP  (RFC  5054).  If  --tlsuser   and",
+  "\t    --tlspassword are  specified but  --tlsauthtype is  not, then  this",
+  "\t    option defaults to \"SRP\". This option works only if the  underlying",
+  "\t    libcurl is built  with TLS-SRP support,  which requires OpenSSL  or",
+  "\t    GnuTLS with TLS-SRP support.  If --tlsauthtype is provided  several",
+  "\t    times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --tlsauthtype SRP https://example.com",
+  "\n\t    See also --tlsuser.",
+  "\n    --tlspassword <string>",
+  "\t    (TLS) Set  password  to  use with  the  TLS  authentication  method",
+  "\t    specified with --tlsauthtype. Requires that --tlsuser is set.",
+  "\n\t    This option  does  not  work  with TLS  1.3.  If  --tlspassword  is",
+  "\t    provided several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --tlspassword pwd --tlsuser user https://example.com",
+  "\n\t    See also --tlsuser.",
+  "\n    --tlsuser <name>",
+  "\t    (TLS) Set  username  for use  with  the TLS  authentication  method",
+  "\t    specified with --tlsauthtype. Requires  that --tlspassword also  is",
+  "\t    set.",
+  "\n\t    This option does not  work with TLS  1.3. If --tlsuser is  provided",
+  "\t    several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --tlspassword pwd --tlsuser user https://example.com",
+  "\n\t    See also --tlspassword.",
+  "\n    -1, --tlsv1",
+  "\t    (TLS) Use at least TLS  version 1.x when negotiating with a  remote",
+  "\t    TLS server. That means TLS version 1.0 or higher Providing  --tlsv1",
+  "\t    multiple times has no extra effect.",
+  "\n\t    Example:",
+  "\t     curl --tlsv1 https://example.com",
+  "\n\t    --tlsv1 requires that libcurl is built to support TLS. This  option",
+  "\t    is mutually exclusive with --tlsv1.1, --tlsv1.2 and --tlsv1.3.  See",
+  "\t    also --http1.1 and --http2.",
+  "\n    --tlsv1.0",
+  "\t    (TLS) Force curl to  use TLS version  1.0 or later when  connecting",
+  "\t    to a remote TLS server.",
+  "\n\t    In old versions of curl this option was documented to  allow _only_",
+  "\t    TLS 1.0.  That  behavior  was inconsistent  depending  on  the  TLS",
+  "\t    library. Use --tls-max if  you want to  set a maximum TLS  version.",
+  "\t    Providing --tlsv1.0 multiple times has no extra effect.",
+  "\n\t    Example:",
+  "\t     curl --tlsv1.0 https://example.com",
+  "\n\t    See also --tlsv1.3.",
+  "\n    --tlsv1.1",
+  "\t    (TLS) Force curl to  use TLS version  1.1 or later when  connecting",
+  "\t    to a remote TLS server.",
+  "\n\t    In old versions of curl this option was documented to  allow _only_",
+  "\t    TLS 1.1.  That  behavior  was inconsistent  depending  on  the  TLS",
+  "\t    library. Use --tls-max if  you want to  set a maximum TLS  version.",
+  "\t    Providing --tlsv1.1 multiple times has no extra effect.",
+  "\n\t    Example:",
+  "\t     curl --tlsv1.1 https://example.com",
+  "\n\t    See also --tlsv1.3 and --tls-max.",
+  "\n    --tlsv1.2",
+  "\t    (TLS) Force curl to  use TLS version  1.2 or later when  connecting",
+  "\t    to a remote TLS server.",
+  "\n\t    In old versions of curl this option was documented to  allow _only_",
+  "\t    TLS 1.2.  That  behavior  was inconsistent  depending  on  the  TLS",
+  "\t    library. Use --tls-max if  you want to  set a maximum TLS  version.",
+  "\t    Providing --tlsv1.2 multiple times has no extra effect.",
+  "\n\t    Example:",
+  "\t     curl --tlsv1.2 https://example.com",
+  "\n\t    See also --tlsv1.3 and --tls-max.",
+  "\n    --tlsv1.3",
+  "\t    (TLS) Force curl to  use TLS version  1.3 or later when  connecting",
+  "\t    to a remote TLS server.",
+  "\n\t    If the connection is done  without TLS, this option has no  effect.",
+  "\t    This includes QUIC-using (HTTP/3) transfers.",
+  "\n\t    Note that TLS 1.3 is  not supported by all TLS backends.  Providing",
+  "\t    --tlsv1.3 multiple times has no extra effect.",
+  "\n\t    Example:",
+  "\t     curl --tlsv1.3 https://example.com",
+  "\n\t    See also --tlsv1.2 and --tls-max.",
+  "\n    --tr-encoding",
+  "\t    (HTTP) Request a  compressed Transfer-Encoding  response using  one",
+  "\t    of the  algorithms curl  supports, and  uncompress the  data  while",
+  "\t    receiving it. Providing --tr-encoding  multiple times has no  extra",
+  "\t    effect. Disable it again with --no-tr-encoding.",
+  "\n\t    Example:",
+  "\t     curl --tr-encoding https://example.com",
+  "\n\t    See also --compressed.",
+  "\n    --trace <file>",
+  "\t    Save  a  full  trace  dump  of  all  incoming  and  outgoing  data,",
+  "\t    including descriptive information,  in the given  output file.  Use",
+  "\t    \"-\" as  filename to  have the  output sent  to stdout.  Use \"%\"  as",
+  "\t    filename to have the output sent to stderr.",
+  "\n\t    Note that verbose  output of  curl activities  and network  traffic",
+  "\t    might contain sensitive data,  including usernames, credentials  or",
+  "\t    secret data content.  Be aware  and be careful  when sharing  trace",
+  "\t    logs with others.",
+  "\n\t    This option is global  and does not need  to be specified for  each",
+  "\t    use of --next. If --trace  is provided several times, the last  set",
+  "\t    value is used.",
+  "\n\t    Example:",
+  "\t     curl --trace log.txt https://example.com",
+  "\n\t    This   option   is   mutually   exclusive   with   --verbose    and",
+  "\t    --trace-ascii. See also --trace-ascii, --trace-config,  --trace-ids",
+  "\t    and --trace-time.",
+  "\n    --trace-ascii <file>",
+  "\t    Save  a  full  trace  dump  of  all  incoming  and  outgoing  data,",
+  "\t    including descriptive information,  in the given  output file.  Use",
+  "\t    \"-\" as  filename to  have the  output sent  to stdout.  Use \"%\"  as",
+  "\t    filename to send the output to stderr.",
+  "\n\t    This is similar to  --trace, but leaves out  the hex part and  only",
+  "\t    shows the  ASCII part of  the dump.  It makes  smaller output  that",
+  "\t    might be easier to read for untrained humans.",
+  "\n\t    Note that verbose  output of  curl activities  and network  traffic",
+  "\t    might contain sensitive data,  including usernames, credentials  or",
+  "\t    secret data content.  Be aware  and be careful  when sharing  trace",
+  "\t    logs with others.",
+  "\n\t    This option is global  and does not need  to be specified for  each",
+  "\t    use of  --next. If  --trace-ascii is  provided several  times,  the",
+  "\t    last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --trace-ascii log.txt https://example.com",
+  "\n\t    This option is mutually exclusive  with --trace and --verbose.  See",
+  "\t    also --verbose and --trace.",
+  "\n    --trace-config <string>",
+  "\t    Set configuration  for  trace  output. A  comma-separated  list  of",
+  "\t    components where detailed output can be made available from.  Names",
+  "\t    are  case-insensitive.   Specify   'all'  to   enable   all   trace",
+  "\t    components.",
+  "\n\t    In addition to trace component  names, specify \"ids\" and \"time\"  to",
+  "\t    avoid extra --trace-ids or --trace-time parameters.",
+  "\n\t    See the curl_global_trace(3) man page for more details.",
+  "\n\t    This option is global  and does not need  to be specified for  each",
+  "\t    use of  --next.  --trace-config can  be  used several  times  in  a",
+  "\t    command line",
+  "\n\t    Example:",
+  "\t     curl --trace-config ids,http/2 https://example.com",
+  "\n\t    Added in 8.3.0. See also --verbose and --trace.",
+  "\n    --trace-ids",
+  "\t    Prepend the transfer  and connection identifiers  to each trace  or",
+  "\t    verbose line that curl displays.",
+  "\n\t    This option is global  and does not need  to be specified for  each",
+  "\t    use of --next.  Providing --trace-ids multiple  times has no  extra",
+  "\t    effect. Disable it again with --no-trace-ids.",
+  "\n\t    Example:",
+  "\t     curl --trace-ids --trace-ascii output https://example.com",
+  "\n\t    Added in 8.2.0. See also --trace and --verbose.",
+  "\n    --trace-time",
+  "\t    Prepend a  time  stamp to  each trace  or  verbose line  that  curl",
+  "\t    displays.",
+  "\n\t    This option is global  and does not need  to be specified for  each",
+  "\t    use of --next. Providing --trace-time  multiple times has no  extra",
+  "\t    effect. Disable it again with --no-trace-time.",
+  "\n\t    Example:",
+  "\t     curl --trace-time --trace-ascii output https://example.com",
+  "\n\t    See also --trace and --verbose.",
+  "\n    --unix-socket <path>",
+  "\t    (HTTP) Connect through  this Unix domain  socket, instead of  using",
+  "\t    the network. If --unix-socket is  provided several times, the  last",
+  "\t    set value is used.",
+  "\n\t    Example:",
+  "\t     curl --unix-socket socket-path https://example.com",
+  "\n\t    See also --abstract-unix-socket.",
+  "\n    -T, --upload-file <file>",
+  "\t    Upload the specified local file to the remote URL.",
+  "\n\t    If there is  no file part  in the specified  URL, curl appends  the",
+  "\t    local file name to the end of the URL before the  operation starts.",
+  "\t    You must use a  trailing slash (/) on  the last directory to  prove",
+  "\t    to curl that  there is no  filename or curl  thinks that your  last",
+  "\t    directory name is the remote filename to use.",
+  "\n\t    When putting  the  local  filename at  the  end of  the  URL,  curl",
+  "\t    ignores what is  on the  left side  of any slash  (/) or  backslash",
+  "\t    (\\\\) used in  the filename and  only appends what  is on the  right",
+  "\t    side of the rightmost such character.",
+  "\n\t    Use the filename  \"-\" (a  single dash)  to use stdin  instead of  a",
+  "\t    given file. Alternately, the filename \".\" (a single period) may  be",
+  "\t    specified instead  of \"-\"  to  use stdin  in non-blocking  mode  to",
+  "\t    allow reading server output while stdin is being uploaded.",
+  "\n\t    If this  option is  used with  an HTTP(S)  URL, the  PUT method  is",
+  "\t    used.",
+  "\n\t    You can  specify one  --upload-file  for each  URL on  the  command",
+  "\t    line. Each --upload-file +  URL pair specifies  what to upload  and",
+  "\t    to  where.  curl  also  supports  globbing  of  the   --upload-file",
+  "\t    argument, meaning that you  can upload multiple  files to a  single",
+  "\t    URL by using the same URL globbing style supported in the URL.",
+  "\n\t    When uploading to an SMTP  server: the uploaded data is assumed  to",
+  "\t    be RFC  5322 formatted.  It has  to feature  the  necessary set  of",
+  "\t    headers and mail body formatted correctly by the user as  curl does",
+  "\t    not transcode nor encode  it further in  any way. --upload-file  is",
+  "\t    associated with a  single URL.  Use it  once per URL  when you  use",
+  "\t    several URLs in a command line.",
+  "\n\t    Examples:",
+  "\t     curl -T file https://example.com",
+  "\t     curl -T \"img[1-1000].png\" ftp://ftp.example.com/",
+  "\t     curl --upload-file \"{file1,file2}\" https://example.com",
+  "\t     curl -T file -T file2 https://example.com https://example.com",
+  "\n\t    See also --get, --head, --request and --data.",
+  "\n    --upload-flags <flags>",
+  "\t    Specify additional behavior to apply  to uploaded files. Flags  are",
+  "\t    specified as either a single  flag value or a comma-separated  list",
+  "\t    of flag values. These values are case-sensitive and may be  negated",
+  "\t    by prepending them  with a '-'  character. Currently the  following",
+  "\t    flag values are  accepted: answered, deleted,  draft, flagged,  and",
+  "\t    seen. The currently-accepted flag values  are used to set flags  on",
+  "\t    IMAP uploads.  If --upload-flags  is  provided several  times,  the",
+  "\t    last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --upload-flags Flagged,!Seen --upload-file local/dir/file \\",
+  "\t\t  https://example.com",
+  "\n\t    Added in 8.13.0. See also --upload-file.",
+  "\n    --url <url/file>",
+  "\t    Specify a URL to fetch or send data to.",
+  "\n\t    If the  given  URL  is  missing  a scheme  (such  as  \"http://\"  or",
+  "\t    \"ftp://\" etc)  curl  guesses  which  scheme to  use  based  on  the",
+  "\t    hostname. If the outermost subdomain name matches DICT, FTP,  IMAP,",
+  "\t    LDAP, POP3 or SMTP case insensitively, then that protocol is  used,",
+  "\t    otherwise it  assumes  HTTP.  Scheme guessing  can  be  avoided  by",
+  "\t    providing a full URL including  the scheme, or disabled by  setting",
+  "\t    a default protocol, see --proto-default for details.",
+  "\n\t    To control  where  the  contents  of a  retrieved  URL  is  written",
+  "\t    instead  of  the   default  stdout,   use  the   --output  or   the",
+  "\t    --remote-name options. When  retrieving multiple URLs  in a  single",
+  "\t    invoke, each  provided  URL  needs its  own  dedicated  destination",
+  "\t    option unless --remote-name-all is used.",
+  "\n\t    On  Windows,  \"file://\"  accesses  can  be  converted  to   network",
+  "\t    accesses by the operating system.",
+  "\n\t    Starting  in curl  8.13.0,  curl  can  be  told  to  download  URLs",
+  "\t    provided in a text file, one  URL per line. It is done with  \"--url",
+  "\t    @filename\": so instead of  a URL, you  specify a filename  prefixed",
+  "\t    with the \"@\" symbol. It can be  told to load the list of URLs  from",
+  "\t    stdin by providing an argument like \"@-\".",
+  "\n\t    When  downloading  URLs   given  in  a   file,  it  implies   using",
+  "\t    --remote-name for each provided  URL. The URLs  are full, there  is",
+  "\t    no  globbing  applied   or  done   on  these.   Features  such   as",
+  "\t    --skip-existing work fine in combination with this.",
+  "\n\t    Lines in the URL file that  start with \"#\" are treated as  comments",
+  "\t    and are skipped. --url can be used several times in a command line",
+  "\n\t    Examples:",
+  "\t     curl --url https://example.com",
+  "\t     curl --url @file",
+  "\n\t    See     also      --next,      --config,      --path-as-is      and",
+  "\t    --disallow-username-in-url.",
+  "\n    --url-query <data>",
+  "\t    (all) Add a piece of data, usually a name + value pair, to  the end",
+  "\t    of the URL  query part. The  syntax is identical  to that used  for",
+  "\t    --data-urlencode with one extension:",
+  "\n\t    If the argument starts  with a '+' (plus),  the rest of the  string",
+  "\t    is provided as-is unencoded.",
+  "\n\t    The query part of a URL  is the one following the question mark  on",
+  "\t    the right end. --url-query can  be used several times in a  command",
+  "\t    line",
+  "\n\t    Examples:",
+  "\t     curl --url-query name=val https://example.com",
+  "\t     curl --url-query =encodethis http://example.net/foo",
+  "\t     curl --url-query name@file https://example.com",
+  "\t     curl --url-query @fileonly https://example.com",
+  "\t     curl --url-query \"+name=%20foo\" https://example.com",
+  "\n\t    Added in 7.87.0. See also --data-urlencode and --get.",
+  "\n    -B, --use-ascii",
+  "\t    (FTP LDAP) Enable ASCII  transfer mode. For  FTP, this can also  be",
+  "\t    enforced by  using a  URL  that ends  with \";type=A\".  This  option",
+  "\t    causes data sent to  stdout to be in  text mode for Win32  systems.",
+  "\t    Providing --use-ascii multiple times  has no extra effect.  Disable",
+  "\t    it again with --no-use-ascii.",
+  "\n\t    Example:",
+  "\t     curl -B ftp://example.com/README",
+  "\n\t    See also --crlf and --data-ascii.",
+  "\n    -u, --user <user:password>",
+  "\t    Specify   the   username   and   password   to   use   for   server",
+  "\t    authentication. Overrides --netrc and --netrc-optional.",
+  "\n\t    If you simply specify the username, curl prompts for a password.",
+  "\n\t    The username and passwords are  split up on the first colon,  which",
+  "\t    makes it  impossible  to use  a colon  in  the username  with  this",
+  "\t    option. The password can, still.",
+  "\n\t    On systems where  it works,  curl hides the  given option  argument",
+  "\t    from process listings.  This is not  enough to protect  credentials",
+  "\t    from possibly getting  seen by other  users on  the same system  as",
+  "\t    they still  are visible  for a  moment before  being cleared.  Such",
+  "\t    sensitive data should be retrieved  from a file instead or  similar",
+  "\t    and never used in clear text in a command line.",
+  "\n\t    When using  Kerberos V5  with  a Windows  based server  you  should",
+  "\t    include the Windows domain name  in the username, in order for  the",
+  "\t    server to successfully  obtain a  Kerberos Ticket. If  you do  not,",
+  "\t    then the initial authentication handshake may fail.",
+  "\n\t    When using  NTLM,  the username  can  be specified  simply  as  the",
+  "\t    username, without  the domain,  if  there is  a single  domain  and",
+  "\t    forest in your setup for example.",
+  "\n\t    To specify the domain name use either Down-Level Logon Name  or UPN",
+  "\t    (User  Principal  Name)  formats.  For  example,  EXAMPLE\\user  and",
+  "\t    user@example.com respectively.",
+  "\n\t    If you use a Windows SSPI-enabled curl binary and perform  Kerberos",
+  "\t    V5, Negotiate,  NTLM or  Digest authentication  then you  can  tell",
+  "\t    curl to select the username  and password from your environment  by",
+  "\t    specifying a single colon  with this option:  \"-u :\". If --user  is",
+  "\t    provided several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl -u user:secret https://example.com",
+  "\n\t    See also --netrc and --config.",
+  "\n    -A, --user-agent <name>",
+  "\t    (HTTP) Specify the User-Agent  string to send  to the HTTP  server.",
+  "\t    To encode blanks  in the  string, surround the  string with  single",
+  "\t    quote marks. This header can also  be set with the --header or  the",
+  "\t    --proxy-header options.",
+  "\n\t    If you give an empty argument to --user-agent (\"\"), it  removes the",
+  "\t    header completely from the request.  If you prefer a blank  header,",
+  "\t    you can set it to a single space (\" \").",
+  "\n\t    By  default,   curl   uses  curl/VERSION,   such   as   User-Agent:",
+  "\t    curl/8.16.0. If --user-agent  is provided several  times, the  last",
+  "\t    set value is used.",
+  "\n\t    Example:",
+  "\t     curl -A \"Agent 007\" https://example.com",
+  "\n\t    See also --header and --proxy-header.",
+  "\n    --variable <[%]name=text/@file>",
+  "\t    Set a  variable with  \"name=content\" or  \"name@file\" (where  \"file\"",
+  "\t    can be stdin if  set to a  single dash (\"-\")). The  name is a  case",
+  "\t    sensitive identifier that  must consist  of no  other letters  than",
+  "\t    a-z,  A-Z,  0-9  or  underscore.  The  specified  content  is  then",
+  "\t    associated with this identifier.",
+  "\n\t    Setting the same  variable name again  overwrites the old  contents",
+  "\t    with the new.",
+  "\n\t    The contents of  a variable can  be referenced  in a later  command",
+  "\t    line option when  that option  name is  prefixed with  \"--expand-\",",
+  "\t    and the name is used as \"{{name}}\".",
+  "\n\t    --variable can import  environment variables into  the name  space.",
+  "\t    Opt to  either  require  the  environment variable  to  be  set  or",
+  "\t    provide a default value for the variable in case it is  not already",
+  "\t    set.",
+  "\n\t    --variable %name imports the variable called \"name\" but exits  with",
+  "\t    an error  if  that environment  variable  is not  already  set.  To",
+  "\t    provide a default  value if  the environment variable  is not  set,",
+  "\t    use --variable  %name=content  or  --variable  %name@content.  Note",
+  "\t    that on  some systems -  but not  all -  environment variables  are",
+  "\t    case insensitive.",
+  "\n\t    Added in curl 8.12.0: you can  get a byte range from the source  by",
+  "\t    appending \"[start-end]\" to the variable  name, where start and  end",
+  "\t    are byte offsets to include from the contents. For example,  asking",
+  "\t    for offset  \"2-10\"  means  offset two  to  offset  ten,  inclusive,",
+  "\t    resulting in 9 bytes in total. \"2-2\" means a single byte  at offset",
+  "\t    2. Not providing a  second number implies to  the end of data.  The",
+  "\t    start offset cannot  be larger than  the end  offset. Asking for  a",
+  "\t    range that is outside of the file size makes the  variable contents",
+  "\t    empty. For  example, getting  the first  one hundred  bytes from  a",
+  "\t    given file:",
+  "\n\t\tcurl --variable \"fraction[0-99]@filename\"",
+  "\n\t    Given a byte  range that has  no data results  in an empty  string.",
+  "\t    Asking for a range that is  larger than the content makes curl  use",
+  "\t    the piece of the data that exists.",
+  "\n\t    To assign  a variable  using contents  from another  variable,  use",
+  "\t    --expand-variable. Like for example assigning a new variable  using",
+  "\t    contents from two other:",
+  "\n\t\tcurl --expand-variable \"user={{firstname}} {{lastname}}\"",
+  "\n\t    When expanding variables,  curl supports  a set  of functions  that",
+  "\t    can make the variable contents more convenient to use. You  apply a",
+  "\t    function to a variable  expansion by adding  a colon and then  list",
+  "\t    the desired functions in a  comma-separated list that is  evaluated",
+  "\t    in a left-to-right order. Variable content holding null bytes  that",
+  "\t    are not encoded when expanded causes an error.",
+  "\n\t    Available functions:",
+  "\n\t    trim",
+  "\n\t\tremoves all leading and trailing white space.",
+  "\n\t\tExample:",
+  "\n\t\t    curl --expand-url https://example.com/{{var:trim}}",
+  "\n\t    json",
+  "\n\t\toutputs the content using JSON string quoting rules.",
+  "\n\t\tExample:",
+  "\n\t\t    curl --expand-data {{data:json}} https://example.com",
+  "\n\t    url",
+  "\n\t\tshows the content URL (percent) encoded.",
+  "\n\t\tExample:",
+  "\n\t\t    curl --expand-url https://example.com/{{path:url}}",
+  "\n\t    b64",
+  "\n\t\texpands the variable base64 encoded",
+  "\n\t\tExample:",
+  "\n\t\t    curl --expand-url https://example.com/{{var:b64}}",
+  "\n\t    64dec",
+  "\n\t\tdecodes a base64  encoded character sequence.  If the  sequence",
+  "\t\tis not possible to decode, it instead outputs \"[64dec-fail]\"",
+  "\n\t\tExample:",
+  "\n\t\t    curl --expand-url https://example.com/{{var:64dec}}",
+  "\n\t\t(Added in 8.13.0)",
+  "\n\t    --variable can be used several times in a command line",
+  "\n\t    Example:",
+  "\t     curl --variable name=smith --expand-url \"https:\\",
+  "\t\t  //example.com/{{name}}\"",
+  "\n\t    Added in 8.3.0. See also --config.",
+  "\n    -v, --verbose",
+  "\t    Make curl output verbose  information during the operation.  Useful",
+  "\t    for debugging and  seeing what's going  on under  the hood. A  line",
+  "\t    starting with  > means header  data sent  by curl,  < means  header",
+  "\t    data received by curl  that is hidden in  normal cases, and a  line",
+  "\t    starting with * means additional info provided by curl.",
+  "\n\t    If you  only want  HTTP headers  in the  output, --show-headers  or",
+  "\t    --dump-header might be more suitable options.",
+  "\n\t    Since curl 8.10, mentioning this  option several times in the  same",
+  "\t    argument increases  the  level of  the  trace output.  However,  as",
+  "\t    before, a single  --verbose or --no-verbose  reverts any  additions",
+  "\t    by previous \"-vv\" again. This means that \"-vv -v\" is  equivalent to",
+  "\t    a single  -v. This  avoids unwanted  verbosity when  the option  is",
+  "\t    mentioned in the command line and curl config files.",
+  "\n\t    Using  it  twice,  e.g.  \"-vv\",  outputs  time  (--trace-time)  and",
+  "\t    transfer ids (--trace-ids),  as well  as enabling  tracing for  all",
+  "\t    protocols (--trace-config protocol).",
+  "\n\t    Adding a third verbose  outputs transfer content (--trace-ascii  %)",
+  "\t    and   enables   tracing   of   more   components    (--trace-config",
+  "\t    read,write,ssl).",
+  "\n\t    A  fourth   time   adds   tracing  of   all   network   components.",
+  "\t    (--trace-config network).",
+  "\n\t    Any addition of the verbose option after that has no effect.",
+  "\n\t    If you  think this  option does  not give  you  the right  details,",
+  "\t    consider using --trace  or --trace-ascii  instead. Or  use it  only",
+  "\t    once and use  --trace-config to trace  the specific components  you",
+  "\t    wish to see.",
+  "\n\t    Note that verbose  output of  curl activities  and network  traffic",
+  "\t    might contain sensitive data,  including usernames, credentials  or",
+  "\t    secret data content.  Be aware  and be careful  when sharing  trace",
+  "\t    logs with others.",
+  "\n\t    When the  output  contains  protocol  headers,  those  lines  might",
+  "\t    include  carriage  return  (ASCII  code  13)  characters,  even  on",
+  "\t    platforms that  otherwise normally  only  use linefeed  to  signify",
+  "\t    line separations - as curl  shows the exact contents arriving  from",
+  "\t    the server.",
+  "\n\t    This option is global  and does not need  to be specified for  each",
+  "\t    use of  --next. Providing  --verbose multiple  times has  no  extra",
+  "\t    effect. Disable it again with --no-verbose.",
+  "\n\t    Example:",
+  "\t     curl --verbose https://example.com",
+  "\n\t    This option is mutually  exclusive with --trace and  --trace-ascii.",
+  "\t    See also --show-headers, --silent, --trace and --trace-ascii.",
+  "\n    -V, --version",
+  "\t    Display information about curl and the libcurl version it uses.",
+  "\n\t    The first  line includes  the  full version  of curl,  libcurl  and",
+  "\t    other 3rd party libraries linked with the executable.",
+  "\n\t    This line may contain one or more TLS libraries. curl can  be built",
+  "\t    to support more  than one TLS  library which then  makes curl -  at",
+  "\t    start-up  -  select  which  particular  backend  to  use  for  this",
+  "\t    invocation.",
+  "\n\t    If curl  supports more than  one TLS  library like  this, the  ones",
+  "\t    that are not  selected by  default are  listed within  parentheses.",
+  "\t    Thus, if  you  do  not  specify  which backend  to  use  (with  the",
+  "\t    \"CURL_SSL_BACKEND\" environment  variable)  the one  listed  without",
+  "\t    parentheses is  used. Such  builds also  have \"MultiSSL\"  set as  a",
+  "\t    feature.",
+  "\n\t    The second  line (starts  with \"Release-Date:\")  shows the  release",
+  "\t    date.",
+  "\n\t    The third line (starts with \"Protocols:\") shows all protocols  that",
+  "\t    libcurl reports to support.",
+  "\n\t    The fourth line (starts  with \"Features:\") shows specific  features",
+  "\t    libcurl reports to offer. Available features include:",
+  "\n\t    alt-svc",
+  "\n\t\tSupport for the Alt-Svc: header is provided.",
+  "\n\t    AsynchDNS",
+  "\n\t\tThis curl uses  asynchronous name  resolves. Asynchronous  name",
+  "\t\tresolves can be done  using either the  c-ares or the  threaded",
+  "\t\tresolver backends.",
+  "\n\t    brotli",
+  "\n\t\tSupport for automatic brotli compression over HTTP(S).",
+  "\n\t    CharConv",
+  "\n\t\tcurl was  built  with  support for  character  set  conversions",
+  "\t\t(like EBCDIC)",
+  "\n\t    Debug",
+  "\n\t\tThis curl uses a  libcurl built with  Debug. This enables  more",
+  "\t\terror-tracking and  memory debugging  etc. For  curl-developers",
+  "\t\tonly.",
+  "\n\t    ECH",
+  "\n\t\tECH support is present.",
+  "\n\t    gsasl",
+  "\n\t\tThe  built-in  SASL   authentication  includes  extensions   to",
+  "\t\tsupport SCRAM because libcurl was built with libgsasl.",
+  "\n\t    GSS-API",
+  "\n\t\tGSS-API is supported.",
+  "\n\t    HSTS",
+  "\n\t\tHSTS support is present.",
+  "\n\t    HTTP2",
+  "\n\t\tHTTP/2 support has been built-in.",
+  "\n\t    HTTP3",
+  "\n\t\tHTTP/3 support has been built-in.",
+  "\n\t    HTTPS-proxy",
+  "\n\t\tThis curl is built to support HTTPS proxy.",
+  "\n\t    IDN",
+  "\n\t\tThis curl supports IDN - international domain names.",
+  "\n\t    IPv6",
+  "\n\t\tYou can use IPv6 with this.",
+  "\n\t    Kerberos",
+  "\n\t\tKerberos V5 authentication is supported.",
+  "\n\t    Largefile",
+  "\n\t\tThis curl supports transfers of large files, files larger  than",
+  "\t\t2GB.",
+  "\n\t    libz",
+  "\n\t\tAutomatic  decompression  (via  gzip,  deflate)  of  compressed",
+  "\t\tfiles over HTTP is supported.",
+  "\n\t    MultiSSL",
+  "\n\t\tThis curl supports multiple TLS backends.",
+  "\n\t    NTLM",
+  "\n\t\tNTLM authentication is supported.",
+  "\n\t    NTLM_WB",
+  "\n\t\tNTLM delegation to  winbind helper is  supported. This  feature",
+  "\t\twas removed from curl in 8.8.0.",
+  "\n\t    PSL",
+  "\n\t\tPSL is short for  Public Suffix List  and means that this  curl",
+  "\t\thas been built with knowledge about \"public suffixes\".",
+  "\n\t    SPNEGO",
+  "\n\t\tSPNEGO authentication is supported.",
+  "\n\t    SSL",
+  "\n\t\tSSL versions  of  various  protocols  are  supported,  such  as",
+  "\t\tHTTPS, FTPS, POP3S and so on.",
+  "\n\t    SSLS-EXPORT",
+  "\n\t\tThis build supports  TLS session export/import,  like with  the",
+  "\t\t--ssl-sessions.",
+  "\n\t    SSPI",
+  "\n\t\tSSPI is supported.",
+  "\n\t    TLS-SRP",
+  "\n\t\tSRP (Secure Remote  Password) authentication  is supported  for",
+  "\t\tTLS.",
+  "\n\t    TrackMemory",
+  "\n\t\tDebug memory tracking is supported.",
+  "\n\t    Unicode",
+  "\n\t\tUnicode support on Windows.",
+  "\n\t    UnixSockets",
+  "\n\t\tUnix sockets support is provided.",
+  "\n\t    zstd",
+  "\n\t\tAutomatic decompression  (via zstd)  of compressed  files  over",
+  "\t\tHTTP is supported.",
+  "\n\t    Example:",
+  "\t     curl --version",
+  "\n\t    See also --help and --manual.",
+  "\n    --vlan-priority <priority>",
+  "\t    (All) Set VLAN priority as defined in IEEE 802.1Q.",
+  "\n\t    This field is set on Ethernet level, and only works within  a local",
+  "\t    network.",
+  "\n\t    The valid range  for <priority> is  0 to  7. If --vlan-priority  is",
+  "\t    provided several times, the last set value is used.",
+  "\n\t    Example:",
+  "\t     curl --vlan-priority 4 https://example.com",
+  "\n\t    Added in 8.9.0. See also --ip-tos.",
+  "\n    -w, --write-out <format>",
+  "\t    Make  curl  display  information   on  stdout  after  a   completed",
+  "\t    transfer. The format is a string that may contain plain  text mixed",
+  "\t    with any  number of variables.  The format  can be  specified as  a",
+  "\t    literal \"string\", or you can have curl read the format from  a file",
+  "\t    with \"@filename\" and  to tell curl  to read  the format from  stdin",
+  "\t    you write \"@-\".",
+  "\n\t    The variables present in the  output format are substituted by  the",
+  "\t    value or  text  that  curl  thinks fit,  as  described  below.  All",
+  "\t    variables are specified as %{variable_name} and to output a  normal",
+  "\t    % you just write them as %%. You can output a newline by  using \\n,",
+  "\t    a carriage return with \\r and a tab space with \\t.",
+  "\n\t    The output is  by default written  to standard  output, but can  be",
+  "\t    changed with %{stderr} and %output{}.",
+  "\n\t    Output HTTP header  values from the  transfer's most recent  server",
+  "\t    response by using %header{name} where name is the case  insensitive",
+  "\t    name of  the  header  (without  the  trailing  colon).  The  header",
+  "\t    contents are  exactly  as  delivered  over  the  network  but  with",
+  "\t    leading and trailing  whitespace and newlines  stripped off  (added",
+  "\t    in 7.84.0).",
+  "\n\t    Select a specific target destination  file to write the output  to,",
+  "\t    by using  %output{name} (added  in curl  8.3.0) where  name is  the",
+  "\t    full filename.  The  output  following  that  instruction  is  then",
+  "\t    written to that file.  More than one  %output{} instruction can  be",
+  "\t    specified in the  same write-out argument.  If the filename  cannot",
+  "\t    be created,  curl leaves  the output  destination to  the one  used",
+  "\t    prior to the %output{}  instruction. Use %output{>>name} to  append",
+  "\t    data to an existing file.",
+  "\n\t    This output  is done  independently  of if  the file  transfer  was",
+  "\t    successful or not.",
+  "\n\t    If the specified action or output specified with this option  fails",
+  "\t    in any way, it does not make curl return a (different) error.",
+  "\n\t    NOTE: On Windows, the %-symbol  is a special symbol used to  expand",
+  "\t    environment variables. In  batch files, all  occurrences of %  must",
+  "\t    be doubled  when using  this  option to  properly escape.  If  this",
+  "\t    option is used at the command  prompt then the % cannot be  escaped",
+  "\t    and unintended expansion is possible.",
+  "\n\t    The variables available are:",
+  "\n\t    certs",
+  "\n\t\tOutput the certificate  chain with details.  Supported only  by",
+  "\t\tthe OpenSSL, GnuTLS,  Schannel and Rustls  backends. (Added  in",
+  "\t\t7.88.0)",
+  "\n\t    conn_id",
+  "\n\t\tThe connection  identifier  last  used  by  the  transfer.  The",
+  "\t\tconnection id is unique number among all connections using  the",
+  "\t\tsame connection cache. (Added in 8.2.0)",
+  "\n\t    content_type",
+  "\n\t\tThe Content-Type of the requested document, if there was any.",
+  "\n\t    errormsg",
+  "\n\t\tThe error message. (Added in 7.75.0)",
+  "\n\t    exitcode",
+  "\n\t\tThe numerical exit code of the transfer. (Added in 7.75.0)",
+  "\n\t    filename_effective",
+  "\n\t\tThe ultimate filename  that curl  writes out to.  This is  only",
+  "\t\tmeaningful if  curl  is  told  to  write to  a  file  with  the",
+  "\t\t--remote-name  or  --output  option.  It  is  most  useful   in",
+  "\t\tcombination with the --remote-header-name option.",
+  "\n\t    ftp_entry_path",
+  "\n\t\tThe initial  path  curl ended  up in  when  logging on  to  the",
+  "\t\tremote FTP server.",
+  "\n\t    header{name}",
+  "\n\t\tThe value  of header  \"name\" from  the transfer's  most  recent",
+  "\t\tserver response.  Unlike  other variables,  the  variable  name",
+  "\t\t\"header\" is not in  braces. For example \"%header{date}\".  Refer",
+  "\t\tto --write-out remarks. (Added in 7.84.0)",
+  "\n\t    header_json",
+  "\n\t\tA JSON object with  all HTTP response  headers from the  recent",
+  "\t\ttransfer. Values are provided as  arrays, since in the case  of",
+  "\t\tmultiple headers  there  can  be  multiple  values.  (Added  in",
+  "\t\t7.83.0)",
+  "\n\t\tThe header  names provided  in lowercase,  listed in  order  of",
+  "\t\tappearance over the wire.  Except for duplicated headers.  They",
+  "\t\tare grouped on the first occurrence of that header, each  value",
+  "\t\tis presented in the JSON array.",
+  "\n\t    http_code",
+  "\n\t\tThe  numerical  response  code  that  was  found  in  the  last",
+  "\t\tretrieved HTTP(S) or FTP(s) transfer.",
+  "\n\t    http_connect",
+  "\n\t\tThe numerical code that was found in the last response  (from a",
+  "\t\tproxy) to a curl CONNECT request.",
+  "\n\t    http_version",
+  "\n\t\tThe http version that was effectively used.",
+  "\n\t    json",
+  "\n\t\tA JSON  object with  all available  keys except  \"header_json\".",
+  "\t\t(Added in 7.70.0)",
+  "\n\t    local_ip",
+  "\n\t\tThe IP  address of  the local  end of  the  most recently  done",
+  "\t\tconnection - can be either IPv4 or IPv6.",
+  "\n\t    local_port",
+  "\n\t\tThe local port number of the most recently done connection.",
+  "\n\t    method",
+  "\n\t\tThe http method used  in the most  recent HTTP request.  (Added",
+  "\t\tin 7.72.0)",
+  "\n\t    num_certs",
+  "\n\t\tNumber of server  certificates received in  the TLS  handshake.",
+  "\t\tSupported only  by the  OpenSSL,  GnuTLS, Schannel  and  Rustls",
+  "\t\tbackends. (Added in 7.88.0)",
+  "\n\t    num_connects",
+  "\n\t\tNumber of new connects made in the recent transfer.",
+  "\n\t    num_headers",
+  "\n\t\tThe number  of  response headers  in  the most  recent  request",
+  "\t\t(restarted at each redirect). Note that the status line IS  NOT",
+  "\t\ta header. (Added in 7.73.0)",
+  "\n\t    num_redirects",
+  "\n\t\tNumber of redirects that were followed in the request.",
+  "\n\t    num_retries",
+  "\n\t\tNumber of retries  actually performed when  \"--retry\" has  been",
+  "\t\tused. (Added in 8.9.0)",
+  "\n\t    onerror",
+  "\n\t\tThe rest of the output  is only shown if the transfer  returned",
+  "\t\ta non-zero error. (Added in 7.75.0)",
+  "\n\t    output{filename}",
+  "\n\t\tFrom this point on,  the --write-out output  is written to  the",
+  "\t\tfilename specified  in braces.  The  filename can  be  prefixed",
+  "\t\twith \">>\" to append  to the file.  Unlike other variables,  the",
+  "\t\tvariable  name  \"output\"   is  not  in   braces.  For   example",
+  "\t\t\"%output{>>stats.txt}\". Refer  to --write-out  remarks.  (Added",
+  "\t\tin 8.3.0)",
+  "\n\t    proxy_ssl_verify_result",
+  "\n\t\tThe  result  of   the  HTTPS  proxy's   SSL  peer   certificate",
+  "\t\tverification that was requested.  0 means the verification  was",
+  "\t\tsuccessful.",
+  "\n\t    proxy_used",
+  "\n\t\tReturns 1 if the previous  transfer used a proxy, otherwise  0.",
+  "\t\tUseful to for example determine if a \"NOPROXY\" pattern  matched",
+  "\t\tthe hostname or not. (Added in 8.7.0)",
+  "\n\t    redirect_url",
+  "\n\t\tWhen an  HTTP request  was made  without --location  to  follow",
+  "\t\tredirects (or when  --max-redirs is met),  this variable  shows",
+  "\t\tthe actual URL a redirect would have gone to.",
+  "\n\t    referer",
+  "\n\t\tThe Referer: header, if there was any. (Added in 7.76.0)",
+  "\n\t    remote_ip",
+  "\n\t\tThe remote IP address  of the most  recently done connection  -",
+  "\t\tcan be either IPv4 or IPv6.",
+  "\n\t    remote_port",
+  "\n\t\tThe remote port number of the most recently done connection.",
+  "\n\t    response_code",
+  "\n\t\tThe  numerical  response  code  that  was  found  in  the  last",
+  "\t\ttransfer (formerly known as \"http_code\").",
+  "\n\t    scheme",
+  "\n\t\tThe  URL   scheme   (sometimes  called   protocol)   that   was",
+  "\t\teffectively used.",
+  "\n\t    size_download",
+  "\n\t\tThe total amount  of bytes  that were downloaded.  This is  the",
+  "\t\tsize of the body/data that was transferred, excluding headers.",
+  "\n\t    size_header",
+  "\n\t\tThe total amount of bytes of the downloaded headers.",
+  "\n\t    size_request",
+  "\n\t\tThe total amount of bytes that were sent in the HTTP request.",
+  "\n\t    size_upload",
+  "\n\t\tThe total amount of bytes that were uploaded. This is  the size",
+  "\t\tof the body/data that was transferred, excluding headers.",
+  "\n\t    speed_download",
+  "\n\t\tThe average download speed that curl measured for the  complete",
+  "\t\tdownload. Bytes per second.",
+  "\n\t    speed_upload",
+  "\n\t\tThe average upload  speed that curl  measured for the  complete",
+  "\t\tupload. Bytes per second.",
+  "\n\t    ssl_verify_result",
+  "\n\t\tThe result of  the SSL peer  certificate verification that  was",
+  "\t\trequested. 0 means the verification was successful.",
+  "\n\t    stderr",
+  "\n\t\tFrom this  point  on,  the --write-out  output  is  written  to",
+  "\t\tstandard error. (Added in 7.63.0)",
+  "\n\t    stdout",
+  "\n\t\tFrom this  point  on,  the --write-out  output  is  written  to",
+  "\t\tstandard output.  This  is the  default,  but can  be  used  to",
+  "\t\tswitch back after switching to stderr. (Added in 7.63.0)",
+  "\n\t    time{format}",
+  "\n\t\tOutput the  current UTC  time  using \"strftime()\"  format.  See",
+  "\t\tTIME OUTPUT FORMAT below for details. (Added in 8.16.0)",
+  "\n\t    time_appconnect",
+  "\n\t\tThe  time, in  seconds,  it  took  from  the  start  until  the",
+  "\t\tSSL/SSH/etc  connect/handshake   to   the   remote   host   was",
+  "\t\tcompleted.",
+  "\n\t    time_connect",
+  "\n\t\tThe time,  in seconds, it  took from  the start  until the  TCP",
+  "\t\tconnect to the remote host (or proxy) was completed.",
+  "\n\t    time_namelookup",
+  "\n\t\tThe time, in  seconds, it took  from the  start until the  name",
+  "\t\tresolving was completed.",
+  "\n\t    time_posttransfer",
+  "\n\t\tThe time it took from the start until the last byte is  sent by",
+  "\t\tlibcurl. In microseconds. (Added in 8.10.0)",
+  "\n\t    time_pretransfer",
+  "\n\t\tThe time, in  seconds, it took  from the  start until the  file",
+  "\t\ttransfer  was   just  about   to  begin.   This  includes   all",
+  "\t\tpre-transfer commands  and negotiations  that are  specific  to",
+  "\t\tthe particular protocol(s) involved.",
+  "\n\t    time_queue",
+  "\n\t\tThe time, in seconds, the  transfer was queued during its  run.",
+  "\t\tThis adds the queue time  for each redirect step that may  have",
+  "\t\thappened. Transfers may  be queued for  significant amounts  of",
+  "\t\ttime when connection  or parallel limits  are in place.  (Added",
+  "\t\tin 8.12.0)",
+  "\n\t    time_redirect",
+  "\n\t\tThe time,  in  seconds,  it  took  for  all  redirection  steps",
+  "\t\tincluding  name  lookup,  connect,  pretransfer  and   transfer",
+  "\t\tbefore  the  final  transaction  was  started.  \"time_redirect\"",
+  "\t\tshows the complete execution time for multiple redirections.",
+  "\n\t    time_starttransfer",
+  "\n\t\tThe time, in seconds,  it took from  the start until the  first",
+  "\t\tbyte was received. This includes time_pretransfer and also  the",
+  "\t\ttime the server needed to calculate the result.",
+  "\n\t    time_total",
+  "\n\t\tThe total time, in seconds, that the full operation lasted.",
+  "\n\t    tls_earlydata",
+  "\n\t\tThe amount of bytes that were sent as TLSv1.3 early  data. This",
+  "\t\tis 0 if this TLS feature was not used and negative if  the data",
+  "\t\tsent had been rejected by the server. The use of early  data is",
+  "\t\tenabled via the command  line option \"--tls-earlydata\".  (Added",
+  "\t\tin 8.12.0)",
+  "\n\t    url",
+  "\n\t\tThe URL that was fetched. (Added in 7.75.0)",
+  "\n\t    url.scheme",
+  "\n\t\tThe scheme part of the URL that was fetched. (Added in 8.1.0)",
+  "\n\t    url.user",
+  "\n\t\tThe user part of the URL that was fetched. (Added in 8.1.0)",
+  "\n\t    url.password",
+  "\n\t\tThe password  part  of the  URL  that was  fetched.  (Added  in",
+  "\t\t8.1.0)",
+  "\n\t    url.options",
+  "\n\t\tThe options part of the URL that was fetched. (Added in 8.1.0)",
+  "\n\t    url.host",
+  "\n\t\tThe host part of the URL that was fetched. (Added in 8.1.0)",
+  "\n\t    url.port",
+  "\n\t\tThe port number of the URL that was fetched. If no  port number",
+  "\t\twas specified  and  the  URL scheme  is  known,  that  scheme's",
+  "\t\tdefault port number is shown. (Added in 8.1.0)",
+  "\n\t    url.path",
+  "\n\t\tThe path part of the URL that was fetched. (Added in 8.1.0)",
+  "\n\t    url.query",
+  "\n\t\tThe query part of the URL that was fetched. (Added in 8.1.0)",
+  "\n\t    url.fragment",
+  "\n\t\tThe fragment  part  of the  URL  that was  fetched.  (Added  in",
+  "\t\t8.1.0)",
+  "\n\t    url.zoneid",
+  "\n\t\tThe zone id part of the URL that was fetched. (Added in 8.1.0)",
+  "\n\t    urle.scheme",
+  "\n\t\tThe scheme part of the  effective (last) URL that was  fetched.",
+  "\t\t(Added in 8.1.0)",
+  "\n\t    urle.user",
+  "\n\t\tThe user part  of the  effective (last) URL  that was  fetched.",
+  "\t\t(Added in 8.1.0)",
+  "\n\t    urle.password",
+  "\n\t\tThe  password  part  of  the  effective  (last)  URL  that  was",
+  "\t\tfetched. (Added in 8.1.0)",
+  "\n\t    urle.options",
+  "\n\t\tThe options part of the effective (last) URL that was  fetched.",
+  "\t\t(Added in 8.1.0)",
+  "\n\t    urle.host",
+  "\n\t\tThe host part  of the  effective (last) URL  that was  fetched.",
+  "\t\t(Added in 8.1.0)",
+  "\n\t    urle.port",
+  "\n\t\tThe port number of the  effective (last) URL that was  fetched.",
+  "\t\tIf no port number was  specified, but the URL scheme is  known,",
+  "\t\tthat scheme's default port number is shown. (Added in 8.1.0)",
+  "\n\t    urle.path",
+  "\n\t\tThe path part  of the  effective (last) URL  that was  fetched.",
+  "\t\t(Added in 8.1.0)",
+  "\n\t    urle.query",
+  "\n\t\tThe query part of  the effective (last)  URL that was  fetched.",
+  "\t\t(Added in 8.1.0)",
+  "\n\t    urle.fragment",
+  "\n\t\tThe  fragment  part  of  the  effective  (last)  URL  that  was",
+  "\t\tfetched. (Added in 8.1.0)",
+  "\n\t    urle.zoneid",
+  "\n\t\tThe zone id part of the effective (last) URL that  was fetched.",
+  "\t\t(Added in 8.1.0)",
+  "\n\t    urlnum",
+  "\n\t\tThe URL  index number  of this  transfer, 0-indexed.  Unglobbed",
+  "\t\tURLs share the  same index  number as the  origin globbed  URL.",
+  "\t\t(Added in 7.75.0)",
+  "\n\t    url_effective",
+  "\n\t\tThe URL that was fetched  last. This is most meaningful if  you",
+  "\t\thave told curl to follow location: headers.",
+  "\n\t    xfer_id",
+  "\n\t\tThe numerical identifier of  the last transfer  done. -1 if  no",
+  "\t\ttransfer has been started yet  for the handle. The transfer  id",
+  "\t\tis  unique  among  all  transfers  performed  using  the   same",
+  "\t\tconnection cache. (Added in 8.2.0)",
+  "\n\t    TIME OUTPUT FORMAT",
+  "\n\t    To show time with  \"%time{}\" the characters  within \"{}\" creates  a",
+  "\t    special format string that may contain special character  sequences",
+  "\t    called conversion  specifications.  Each  conversion  specification",
+  "\t    starts with \"%\" and is followed by a character that  instructs curl",
+  "\t    to output a particular time  detail. All other characters used  are",
+  "\t    displayed as-is and-",
+  "\n\t    The following conversion specification are available:",
+  "\n\t    %a",
+  "\n\t\tThe abbreviated name of  the day of  the week according to  the",
+  "\t\tcurrent locale.",
+  "\n\t    %A",
+  "\n\t\tThe full name of the day  of the week according to the  current",
+  "\t\tlocale.",
+  "\n\t    %b",
+  "\n\t\tThe abbreviated month name according to the current locale.",
+  "\n\t    %B",
+  "\n\t\tThe full month name according to the current locale.",
+  "\n\t    %c",
+  "\n\t\tThe preferred  date and  time  representation for  the  current",
+  "\t\tlocale. (In the POSIX  locale this is  equivalent to \"%a %b  %e",
+  "\t\t%H:%M:%S %Y\".)",
+  "\n\t    %C",
+  "\n\t\tThe century number (year/100) as a 2-digit integer.",
+  "\n\t    %d",
+  "\n\t\tThe day of the month as a decimal number (range 01 to 31).",
+  "\n\t    %D",
+  "\n\t\tEquivalent  to  \"%m/%d/%y\".  In  international  contexts,  this",
+  "\t\tformat is ambiguous and should be avoided.)",
+  "\n\t    %e",
+  "\n\t\tLike \"%d\", the  day of  the month  as a decimal  number, but  a",
+  "\t\tleading zero is replaced by a space.",
+  "\n\t    %f",
+  "\n\t\tThe number  of  microseconds  elapsed of  the  current  second.",
+  "\t\t(This a curl special code and not a standard one.)",
+  "\n\t    %F",
+  "\n\t\tEquivalent to \"%Y-%m-%d\" (the ISO 8601 date format).",
+  "\n\t    %G",
+  "\n\t\tThe ISO 8601 week-based year with century as a decimal  number.",
+  "\t\tThe 4-digit  year corresponding  to the  ISO week  number  (see",
+  "\t\t\"%V\"). This has the same format and value as \"%Y\",  except that",
+  "\t\tif the ISO week  number belongs to  the previous or next  year,",
+  "\t\tthat year is used instead.",
+  "\n\t    %g",
+  "\n\t\tLike \"%G\", but without  century, that is,  with a 2-digit  year",
+  "\t\t(00-99).",
+  "\n\t    %h",
+  "\n\t\tEquivalent to \"%b\".",
+  "\n\t    %H",
+  "\n\t\tThe hour as a  decimal number using  a 24-hour clock (range  00",
+  "\t\tto 23).",
+  "\n\t    %I",
+  "\n\t\tThe hour as a  decimal number using  a 12-hour clock (range  01",
+  "\t\tto 12).",
+  "\n\t    %j",
+  "\n\t\tThe day of the year as a decimal number (range 001 to 366).",
+  "\n\t    %k",
+  "\n\t\tThe hour (24-hour clock) as  a decimal number (range 0 to  23);",
+  "\t\tsingle digits are preceded by a blank.",
+  "\n\t    %l",
+  "\n\t\tThe hour (12-hour clock) as  a decimal number (range 1 to  12);",
+  "\t\tsingle digits are preceded by a blank.",
+  "\n\t    %m",
+  "\n\t\tThe month as a decimal number (range 01 to 12).",
+  "\n\t    %M",
+  "\n\t\tThe minute as a decimal number (range 00 to 59).",
+  "\n\t    %p",
+  "\n\t\tEither \"AM\" or \"PM\" according  to the given time value, or  the",
+  "\t\tcorresponding strings for the  current locale. Noon is  treated",
+  "\t\tas \"PM\" and midnight as \"AM\".",
+  "\n\t    %P",
+  "\n\t\tLike \"%p\" but  in lowercase:  \"am\" or \"pm\"  or a  corresponding",
+  "\t\tstring for the current locale.",
+  "\n\t    %r",
+  "\n\t\tThe time in am or pm notation.",
+  "\n\t    %R",
+  "\n\t\tThe  time  in  24-hour   notation  (\"%H:%M\").  For  a   version",
+  "\t\tincluding the seconds, see \"%T\" below.",
+  "\n\t    %s",
+  "\n\t\tThe number  of seconds  since  the Epoch,  1970-01-01  00:00:00",
+  "\t\t+0000 (UTC).",
+  "\n\t    %S",
+  "\n\t\tThe second as a decimal number (range 00 to 60). (The  range is",
+  "\t\tup to 60 to  allow for occasional  leap seconds.) See \"%f\"  for",
+  "\t\tmicroseconds.",
+  "\n\t    %T",
+  "\n\t\tThe time in 24-hour notation (\"%H:%M:%S\").",
+  "\n\t    %u",
+  "\n\t\tThe day of the  week as a decimal, range  1 to 7, Monday  being",
+  "\t\t1.",
+  "\n\t    %U",
+  "\n\t\tThe week number of the current year as a decimal  number, range",
+  "\t\t00 to 53, starting  with the first Sunday  as the first day  of",
+  "\t\tweek 01. See also \"%V\" and \"%W\".",
+  "\n\t    %V",
+  "\n\t\tThe ISO 8601 week number (see  NOTES) of the current year as  a",
+  "\t\tdecimal number, range 01 to 53, where week 1 is the  first week",
+  "\t\tthat has at  least 4 days in  the new year.  See also \"%U\"  and",
+  "\t\t\"%W\".",
+  "\n\t    %w",
+  "\n\t\tThe day of the  week as a decimal, range  0 to 6, Sunday  being",
+  "\t\t0. See also \"%u\".",
+  "\n\t    %W",
+  "\n\t\tThe week number of the current year as a decimal  number, range",
+  "\t\t00 to 53, starting  with the first Monday  as the first day  of",
+  "\t\tweek 01.",
+  "\n\t    %x",
+  "\n\t\tThe  preferred  date  representation  for  the  current  locale",
+  "\t\twithout the time.",
+  "\n\t    %X",
+  "\n\t\tThe  preferred  time  representation  for  the  current  locale",
+  "\t\twithout the date.",
+  "\n\t    %y",
+  "\n\t\tThe year as  a decimal number  without a  century (range 00  to",
+  "\t\t99).",
+  "\n\t    %Y",
+  "\n\t\tThe year as a decimal number including the century.",
+  "\n\t    %z",
+  "\n\t\tThe \"+hhmm\" or \"-hhmm\" numeric timezone (that is, the hour  and",
+  "\t\tminute offset from UTC).  As time is  always UTC, this  outputs",
+  "\t\t\"+0000\".",
+  "\n\t    %Z",
+  "\n\t\tThe timezone name. For some reason \"GMT\".",
+  "\n\t    %%",
+  "\n\t\tA literal \"%\" character.",
+  "\n\t    If --write-out is  provided several  times, the last  set value  is",
+  "\t    used.",
+  "\n\t    Example:",
+  "\t     curl -w '%{response_code}\\n' https://example.com",
+  "\n\t    See also --verbose and --head.",
+  "\n    --xattr",
+  "\t    Store metadata in the extended file attributes.",
+  "\n\t    When saving output to a file,  tell curl to store file metadata  in",
+  "\t    extended file  attributes.  Currently,  \"curl\"  is  stored  in  the",
+  "\t    \"creator\" attribute,  the URL  is  stored in  the  \"xdg.origin.url\"",
+  "\t    attribute  and, for  HTTP,  the  content  type  is  stored  in  the",
+  "\t    \"mime_type\"  attribute.  If  the  file  system  does  not   support",
+  "\t    extended  attributes,  a  warning  is  issued.  Providing   --xattr",
+  "\t    multiple  times  has  no  extra  effect.  Disable  it  again   with",
+  "\t    --no-xattr.",
+  "\n\t    Example:",
+  "\t     curl --xattr -o storage https://example.com",
+  "\n\t    See also --remote-time, --write-out and --verbose.",
+  "\nFILES",
+  "\n    ~/.curlrc",
+  "\n    Default config file, see --config for details.",
+  "\nENVIRONMENT",
+  "\n    The environment variables  can be specified  in lower  case or upper  case.",
+  "    The lower case version has  precedence. \"http_proxy\" is an exception as  it",
+  "    is only available in lower case.",
+  "\n    Using an  environment variable  to set  the proxy  has the  same effect  as",
+  "    using the --proxy option.",
+  "\n    http_proxy [protocol://]<host>[:port]",
+  "\n\tSets the proxy server to use for HTTP.",
+  "\n    HTTPS_PROXY [protocol://]<host>[:port]",
+  "\n\tSets the proxy server to use for HTTPS.",
+  "\n    [url-protocol]_PROXY [protocol://]<host>[:port]",
+  "\n\tSets the proxy server to use for [url-protocol], where the  protocol is",
+  "\ta protocol that  curl supports and  as specified in  a URL. FTP,  FTPS,",
+  "\tPOP3, IMAP, SMTP, LDAP, etc.",
+  "\n    ALL_PROXY [protocol://]<host>[:port]",
+  "\n\tSets the proxy server to use if no protocol-specific proxy is set.",
+  "\n    NO_PROXY <comma-separated list of hosts/domains>",
+  "\n\tlist of hostnames that  should not go through any  proxy. If set to  an",
+  "\tasterisk '*' only,  it matches  all hosts.  Each name in  this list  is",
+  "\tmatched as either  a domain name  which contains  the hostname, or  the",
+  "\thostname itself.",
+  "\n\tThis  environment  variable  disables  use  of  the  proxy  even   when",
+  "\tspecified with the --proxy option. That is",
+  "\n\t    NO_PROXY=direct.example.com curl -x http://proxy.example.com",
+  "\t    http://direct.example.com",
+  "\n\taccesses the target URL directly, and",
+  "\n\t    NO_PROXY=direct.example.com curl -x http://proxy.example.com",
+  "\t    http://somewhere.example.com",
+  "\n\taccesses the target URL through the proxy.",
+  "\n\tThe list  of hostnames  can also  include numerical  IP addresses,  and",
+  "\tIPv6 versions should then be given without enclosing brackets.",
+  "\n\tIP addresses can be  specified using CIDR  notation: an appended  slash",
+  "\tand number specifies the  number of \"network  bits\" out of the  address",
+  "\tto  use   in   the   comparison  (added   in   7.86.0).   For   example",
+  "\t\"192.168.0.0/16\" would match all addresses starting with \"192.168\".",
+  "\n    APPDATA <directory>",
+  "\n\tOn Windows,  this  variable  is  used  when trying  to  find  the  home",
+  "\tdirectory. If the primary home variables are all unset.",
+  "\n    COLUMNS <terminal width>",
+  "\n\tIf set,  the specified number  of characters  is used  as the  terminal",
+  "\twidth when  the alternative  progress-bar is  shown. If  not set,  curl",
+  "\ttries to figure it out using other ways.",
+  "\n    CURL_CA_BUNDLE <file>",
+  "\n\tIf set, it is used as the --cacert value. This environment  variable is",
+  "\tignored if Schannel is used as the TLS backend.",
+  "\n    CURL_HOME <directory>",
+  "\n\tIf set, is the first variable curl checks when trying to find  its home",
+  "\tdirectory. If not set, it continues to check XDG_CONFIG_HOME",
+  "\n    CURL_SSL_BACKEND <TLS backend>",
+  "\n\tIf curl  was built with  support for  \"MultiSSL\", meaning  that it  has",
+  "\tbuilt-in support  for  more  than one  TLS  backend,  this  environment",
+  "\tvariable can  be set to  the case  insensitive name  of the  particular",
+  "\tbackend to  use when curl  is invoked.  Setting a  name that  is not  a",
+  "\tbuilt-in alternative makes curl stay with the default.",
+  "\n\tSSL  backend  names   (case-insensitive):  gnutls,  mbedtls,   openssl,",
+  "\trustls, schannel, wolfssl",
+  "\n    HOME <directory>",
+  "\n\tIf set, this is  used to find the home  directory when that is  needed.",
+  "\tLike  when   looking   for   the   default   .curlrc.   CURL_HOME   and",
+  "\tXDG_CONFIG_HOME have preference.",
+  "\n    NETRC <path>",
+  "\n\tIf set, this is used to find the \".netrc\" file. It overrides  all other",
+  "\tnetrc file  location mechanisms  and should  be set  to  the full  file",
+  "\tpath. (Added in curl 8.16.0)",
+  "\n    QLOGDIR <directory>",
+  "\n\tIf curl  was  built  with  HTTP/3  support,  setting  this  environment",
+  "\tvariable  to a  local  directory  makes  curl  produce  qlogs  in  that",
+  "\tdirectory, using file names named  after the destination connection  id",
+  "\t(in hex). Do note that these files can become rather large.  Works with",
+  "\tthe ngtcp2 and quiche QUIC backends.",
+  "\n    SHELL",
+  "\n\tUsed on VMS when trying to detect if using a DCL or a Unix shell.",
+  "\n    SSL_CERT_DIR <directory>",
+  "\n\tIf set, it is used as the --capath value. This environment  variable is",
+  "\tignored if Schannel is used as the TLS backend.",
+  "\n    SSL_CERT_FILE <path>",
+  "\n\tIf set, it is used as the --cacert value. This environment  variable is",
+  "\tignored if Schannel is used as the TLS backend.",
+  "\n    SSLKEYLOGFILE <path>",
+  "\n\tIf you set  this environment variable  to a  filename, curl stores  TLS",
+  "\tsecrets from its connections  in that file  when invoked to enable  you",
+  "\tto analyze the TLS traffic  in real time using network analyzing  tools",
+  "\tsuch  as  Wireshark.  This  works  with  the  following  TLS  backends:",
+  "\tOpenSSL,  LibreSSL  (TLS  1.2  max),  BoringSSL,  GnuTLS,  wolfSSL  and",
+  "\tRustls.",
+  "\n    USERPROFILE <directory>",
+  "\n\tOn Windows,  this  variable  is  used  when trying  to  find  the  home",
+  "\tdirectory. If  the other,  primary, variables  are all  unset. If  set,",
+  "\tcurl uses the path \"$USERPROFILE\\Application Data\".",
+  "\n    XDG_CONFIG_HOME <directory>",
+  "\n\tIf CURL_HOME is not  set, this variable is  checked when looking for  a",
+  "\tdefault .curlrc file.",
+  "\nPROXY PROTOCOL PREFIXES",
+  "\n    The proxy  string may be  specified with  a protocol://  prefix to  specify",
+  "    alternative proxy protocols.",
+  "\n    If no protocol is specified in the  proxy string or if the string does  not",
+  "    match a supported one, the proxy is treated as an HTTP proxy.",
+  "\n    The supported proxy protocol prefixes are as follows:",
+  "\n    http://",
+  "\n\tMakes it use it as  an HTTP proxy. The  default if no scheme prefix  is",
+  "\tused.",
+  "\n    https://",
+  "\n\tMakes it treated as an HTTPS proxy.",
+  "\n    socks4://",
+  "\n\tMakes it the equivalent of --socks4",
+  "\n    socks4a://",
+  "\n\tMakes it the equivalent of --socks4a",
+  "\n    socks5://",
+  "\n\tMakes it the equivalent of --socks5",
+  "\n    socks5h://",
+  "\n\tMakes it the equivalent of --socks5-hostname",
+  "\nEXIT CODES",
+  "\n    There are a bunch  of different error  codes and their corresponding  error",
+  "    messages that  may  appear under  error conditions.  At  the time  of  this",
+  "    writing, the exit codes are:",
+  "\n    0",
+  "\n\tSuccess.  The  operation  completed   successfully  according  to   the",
+  "\tinstructions.",
+  "\n    1",
+  "\n\tUnsupported protocol.  This  build of  curl  has no  support  for  this",
+  "\tprotocol.",
+  "\n    2",
+  "\n\tFailed to initialize.",
+  "\n    3",
+  "\n\tURL malformed. The syntax was not correct.",
+  "\n    4",
+  "\n\tA feature or option that was needed to perform the desired  request was",
+  "\tnot enabled  or was  explicitly disabled  at build-time.  To make  curl",
+  "\table to do this, you probably need another build of libcurl.",
+  "\n    5",
+  "\n\tCould not resolve proxy. The given proxy host could not be resolved.",
+  "\n    6",
+  "\n\tCould not resolve host. The given remote host could not be resolved.",
+  "\n    7",
+  "\n\tFailed to connect to host.",
+  "\n    8",
+  "\n\tWeird server reply. The server sent data curl could not parse.",
+  "\n    9",
+  "\n\tFTP access  denied. The server  denied login  or denied  access to  the",
+  "\tparticular resource or directory  you wanted to  reach. Most often  you",
+  "\ttried to change to a directory that does not exist on the server.",
+  "\n    10",
+  "\n\tFTP accept failed. While  waiting for the  server to connect back  when",
+  "\tan active FTP session is used, an error code was sent over  the control",
+  "\tconnection or similar.",
+  "\n    11",
+  "\n\tFTP weird PASS reply. curl could  not parse the reply sent to the  PASS",
+  "\trequest.",
+  "\n    12",
+  "\n\tDuring an active FTP  session while waiting  for the server to  connect",
+  "\tback to curl, the timeout expired.",
+  "\n    13",
+  "\n\tFTP weird PASV reply, curl could  not parse the reply sent to the  PASV",
+  "\trequest.",
+  "\n    14",
+  "\n\tFTP weird  227 format. curl  could not  parse the  227-line the  server",
+  "\tsent.",
+  "\n    15",
+  "\n\tFTP cannot  use host.  Could not  resolve the  host IP  we  got in  the",
+  "\t227-line.",
+  "\n    16",
+  "\n\tHTTP/2 error. A problem was  detected in the HTTP2 framing layer.  This",
+  "\tis somewhat generic  and can be  one out of  several problems, see  the",
+  "\terror message for details.",
+  "\n    17",
+  "\n\tFTP could not set binary. Could not change transfer method to binary.",
+  "\n    18",
+  "\n\tPartial file. Only a part of the file was transferred.",
+  "\n    19",
+  "\n\tFTP could not  download/access the  given file, the  RETR (or  similar)",
+  "\tcommand failed.",
+  "\n    21",
+  "\n\tFTP quote error. A quote command returned error from the server.",
+  "\n    22",
+  "\n\tHTTP page not retrieved.  The requested URL  was not found or  returned",
+  "\tanother error with the HTTP error code being 400 or above.  This return",
+  "\tcode only appears if --fail is used.",
+  "\n    23",
+  "\n\tWrite error.  curl could  not  write data  to a  local file  system  or",
+  "\tsimilar.",
+  "\n    25",
+  "\n\tFailed starting the upload.  For FTP, the  server typically denied  the",
+  "\tSTOR command.",
+  "\n    26",
+  "\n\tRead error. Various reading problems.",
+  "\n    27",
+  "\n\tOut of memory. A memory allocation request failed.",
+  "\n    28",
+  "\n\tOperation timeout. The specified time-out period was reached  according",
+  "\tto the conditions.",
+  "\n    30",
+  "\n\tFTP PORT failed. The PORT  command failed. Not all FTP servers  support",
+  "\tthe PORT command, try doing a transfer using PASV instead.",
+  "\n    31",
+  "\n\tFTP could not use REST. The  REST command failed. This command is  used",
+  "\tfor resumed FTP transfers.",
+  "\n    33",
+  "\n\tHTTP range error. The range \"command\" did not work.",
+  "\n    34",
+  "\n\tHTTP post error. Internal post-request generation error.",
+  "\n    35",
+  "\n\tSSL connect error. The SSL handshaking failed.",
+  "\n    36",
+  "\n\tBad download resume. Could not continue an earlier aborted download.",
+  "\n    37",
+  "\n\tFILE could not read file. Failed to open the file. Permissions?",
+  "\n    38",
+  "\n\tLDAP cannot bind. LDAP bind operation failed.",
+  "\n    39",
+  "\n\tLDAP search failed.",
+  "\n    41",
+  "\n\tFunction not found. A required LDAP function was not found.",
+  "\n    42",
+  "\n\tAborted by callback. An application told curl to abort the operation.",
+  "\n    43",
+  "\n\tInternal error. A function was called with a bad parameter.",
+  "\n    45",
+  "\n\tInterface error. A specified outgoing interface could not be used.",
+  "\n    47",
+  "\n\tToo many  redirects. When  following redirects,  curl hit  the  maximum",
+  "\tamount.",
+  "\n    48",
+  "\n\tUnknown option specified to libcurl.  This indicates that you passed  a",
+  "\tweird option to curl that was  passed on to libcurl and rejected.  Read",
+  "\tup in the manual.",
+  "\n    49",
+  "\n\tMalformed telnet option.",
+  "\n    52",
+  "\n\tThe server did not reply anything, which here is considered an error.",
+  "\n    53",
+  "\n\tSSL crypto engine not found.",
+  "\n    54",
+  "\n\tCannot set SSL crypto engine as default.",
+  "\n    55",
+  "\n\tFailed sending network data.",
+  "\n    56",
+  "\n\tFailure in receiving network data.",
+  "\n    58",
+  "\n\tProblem with the local certificate.",
+  "\n    59",
+  "\n\tCould not use specified SSL cipher.",
+  "\n    60",
+  "\n\tPeer certificate cannot be authenticated with known CA certificates.",
+  "\n    61",
+  "\n\tUnrecognized transfer encoding.",
+  "\n    63",
+  "\n\tMaximum file size exceeded.",
+  "\n    64",
+  "\n\tRequested FTP SSL level failed.",
+  "\n    65",
+  "\n\tSending the data requires a rewind that failed.",
+  "\n    66",
+  "\n\tFailed to initialize SSL Engine.",
+  "\n    67",
+  "\n\tThe username, password, or similar was not accepted and curl  failed to",
+  "\tlog in.",
+  "\n    68",
+  "\n\tFile not found on TFTP server.",
+  "\n    69",
+  "\n\tPermission problem on TFTP server.",
+  "\n    70",
+  "\n\tOut of disk space on TFTP server.",
+  "\n    71",
+  "\n\tIllegal TFTP operation.",
+  "\n    72",
+  "\n\tUnknown TFTP transfer ID.",
+  "\n    73",
+  "\n\tFile already exists (TFTP).",
+  "\n    74",
+  "\n\tNo such user (TFTP).",
+  "\n    77",
+  "\n\tProblem reading the SSL CA cert (path? access rights?).",
+  "\n    78",
+  "\n\tThe resource referenced in the URL does not exist.",
+  "\n    79",
+  "\n\tAn unspecified error occurred during the SSH session.",
+  "\n    80",
+  "\n\tFailed to shut down the SSL connection.",
+  "\n    82",
+  "\n\tCould not load CRL file, missing or wrong format.",
+  "\n    83",
+  "\n\tIssuer check failed.",
+  "\n    84",
+  "\n\tThe FTP PRET command failed.",
+  "\n    85",
+  "\n\tMismatch of RTSP CSeq numbers.",
+  "\n    86",
+  "\n\tMismatch of RTSP Session Identifiers.",
+  "\n    87",
+  "\n\tUnable to parse FTP file list.",
+  "\n    88",
+  "\n\tFTP chunk callback reported error.",
+  "\n    89",
+  "\n\tNo connection available, the session is queued.",
+  "\n    90",
+  "\n\tSSL public key does not match pinned public key.",
+  "\n    91",
+  "\n\tInvalid SSL certificate status.",
+  "\n    92",
+  "\n\tStream error in HTTP/2 framing layer.",
+  "\n    93",
+  "\n\tAn API function was called from inside a callback.",
+  "\n    94",
+  "\n\tAn authentication function returned an error.",
+  "\n    95",
+  "\n\tA problem was detected  in the HTTP/3  layer. This is somewhat  generic",
+  "\tand can  be one  out of  several problems,  see the  error message  for",
+  "\tdetails.",
+  "\n    96",
+  "\n\tQUIC connection  error. This  error may  be caused  by  an SSL  library",
+  "\terror. QUIC is the protocol used for HTTP/3 transfers.",
+  "\n    97",
+  "\n\tProxy handshake error.",
+  "\n    98",
+  "\n\tA client-side certificate is required to complete the TLS handshake.",
+  "\n    99",
+  "\n\tPoll or select returned fatal error.",
+  "\n    100",
+  "\n\tA value or data field grew larger than allowed.",
+  "\n    XX",
+  "\n\tMore error codes  might appear  here in future  releases. The  existing",
+  "\tones are meant to never change.",
+  "\nBUGS",
+  "\n    If you experience any problems with curl, submit an issue in  the project's",
+  "    bug tracker on GitHub: https://github.com/curl/curl/issues",
+  "\nAUTHORS",
+  "\n    Daniel Stenberg is the main author,  but the whole list of contributors  is",
+  "    found in the separate THANKS file.",
+  "\nWWW",
+  "\n    https://curl.se",
+  "\nSEE ALSO",
+  "\n    ftp(1), wget(1)",
+  NULL
+};
+void hugehelp(void)
+{
+  int i = 0;
+  while(curlman[i])
+    puts(curlman[i++]);
+}
+
+/* Show the help text for the 'arg' curl argument on stdout */
+void showhelp(const char *trigger, const char *arg, const char *endarg)
+{
+  int i = 0;
+  struct scan_ctx ctx;
+  inithelpscan(&ctx, trigger, arg, endarg);
+  while(curlman[i]) {
+    size_t len = strlen(curlman[i]);
+    if(!helpscan((const unsigned char *)curlman[i], len, &ctx) ||
+       !helpscan((const unsigned char *)"\n", 1, &ctx))
+      break;
+    i++;
+  }
+}
+#endif /* USE_MANUAL */
+#else
+/*
+ * NEVER EVER edit this manually, fix the mkhelp.pl script instead!
+ */
+#include "tool_hugehelp.h"
+#ifdef USE_MANUAL
+#include "tool_help.h"
+
+#include <zlib.h>
+#include <memdebug.h> /* keep this as LAST include */
+static const unsigned char hugehelpgz[] = {
+  /* This mumbo-jumbo is the huge help text compressed with gzip.
+     Thanks to this operation, the size of this data shrank from 278032
+     to 80924 bytes. You can disable the use of compressed help
+     texts by NOT passing -c to the mkhelp.pl tool. */
+  0x1f, 0x8b, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xec, 0xfd,
+  0x7b, 0x7b, 0x1b, 0xd7, 0xb1, 0x27, 0x0a, 0xff, 0x2d, 0x7f, 0x8a, 0x3e,
+  0xc8, 0xec, 0x21, 0xb9, 0x03, 0x80, 0x37, 0x51, 0x96, 0x69, 0xd9, 0xc7,
+  0x34, 0x45, 0x49, 0xdc, 0x91, 0x44, 0x86, 0xa4, 0xec, 0x64, 0x62, 0x3f,
+  0x7a, 0x1a, 0x40, 0x83, 0x6c, 0x0b, 0x40, 0x23, 0xe8, 0x06, 0x29, 0x26,
+  0x93, 0xf7, 0xb3, 0xbf, 0x75, 0x5f, 0xb5, 0x1a, 0x0d, 0x12, 0x92, 0xa9,
+  0xcc, 0x99, 0x39, 0x67, 0x67, 0x9b, 0x22, 0x81, 0xee, 0x75, 0xad, 0x55,
+  0xab, 0xae, 0xbf, 0x4a, 0x12, 0xfd, 0xbf, 0xf7, 0xf4, 0xdf, 0x7b, 0xf8,
+  0x3f, 0xf8, 0xf7, 0x2b, 0xf9, 0xec, 0xfd, 0xfb, 0xff, 0x99, 0xf0, 0xff,
+  0xe0, 0xbb, 0x5f, 0xe0, 0x5f, 0xfe, 0x62, 0x33, 0x09, 0x5f, 0xfc, 0xcf,
+  0xf7, 0x1b, 0x89, 0x7e, 0xf1, 0x3f, 0x93, 0x75, 0xfa, 0xe2, 0xbd, 0xbc,
+  0xf1, 0x0c, 0x7f, 0x7f, 0x2f, 0xad, 0xfd, 0x82, 0xad, 0xe1, 0x8f, 0x4d,
+  0xfc, 0xfe, 0x97, 0xf7, 0xf8, 0x2b, 0x7c, 0xf2, 0xd5, 0xdb, 0x83, 0x37,
+  0x47, 0x5f, 0xd1, 0x23, 0xfd, 0xf9, 0x6c, 0x94, 0x74, 0x92, 0x6a, 0x96,
+  0x4e, 0xca, 0x61, 0x36, 0x4b, 0xd2, 0xe4, 0xdd, 0xd9, 0xeb, 0xaf, 0xbe,
+  0x3a, 0xff, 0xeb, 0xdb, 0x93, 0xd3, 0xf3, 0xe3, 0x73, 0xf7, 0xd0, 0xdf,
+  0x8a, 0x69, 0x95, 0x17, 0x93, 0x12, 0x46, 0x02, 0x8f, 0x94, 0xbf, 0x7e,
+  0xf5, 0xd5, 0xf3, 0xa3, 0xf3, 0xc3, 0xb3, 0xe3, 0xd3, 0x8b, 0xe3, 0x93,
+  0xb7, 0xee, 0xb9, 0xbc, 0x84, 0x46, 0xaa, 0xa2, 0x18, 0x25, 0xc9, 0xb0,
+  0x98, 0x59, 0xcb, 0xb3, 0x7c, 0x72, 0x99, 0x0c, 0xd2, 0x2a, 0x85, 0x8f,
+  0x67, 0xc5, 0x38, 0xc1, 0xaf, 0x0a, 0x78, 0x32, 0x29, 0xb3, 0xd9, 0x35,
+  0x74, 0x3c, 0x2f, 0xf1, 0x01, 0x6c, 0xb9, 0x9b, 0x24, 0xc7, 0x15, 0xb5,
+  0x57, 0xce, 0xa7, 0xd3, 0x62, 0x56, 0x95, 0x49, 0x75, 0x95, 0x95, 0x59,
+  0x32, 0x9d, 0x15, 0x55, 0xd1, 0x2f, 0x46, 0xe5, 0x7e, 0x92, 0x3c, 0x3f,
+  0x3e, 0xbc, 0x68, 0x27, 0x2f, 0x8e, 0x5f, 0x1f, 0xb5, 0x93, 0xe4, 0xc5,
+  0xc5, 0x69, 0x1b, 0x7f, 0x9c, 0xc3, 0xef, 0x2f, 0x4f, 0x4e, 0x5f, 0x1d,
+  0x9d, 0xb5, 0xe5, 0x5f, 0xfc, 0xe4, 0xd5, 0x05, 0x7c, 0x4d, 0xed, 0xe1,
+  0x6f, 0xf0, 0xc9, 0xf1, 0x9b, 0x03, 0x78, 0x9e, 0xfe, 0x81, 0xbf, 0x5e,
+  0x3f, 0xa7, 0xbf, 0xf0, 0x1f, 0xf8, 0xeb, 0xcd, 0x9f, 0x2f, 0xa0, 0xdd,
+  0xe4, 0xf4, 0xe4, 0x74, 0xb7, 0x4d, 0x3f, 0xb1, 0x85, 0xb3, 0x8b, 0x37,
+  0xf0, 0x08, 0xfe, 0xe4, 0xbf, 0xce, 0xa5, 0xbd, 0xf3, 0x43, 0xf8, 0xf8,
+  0x9c, 0x7a, 0x3f, 0x7f, 0xf3, 0x23, 0xfd, 0x38, 0xc7, 0x9f, 0xfc, 0x01,
+  0xf5, 0x75, 0x71, 0xf4, 0xfa, 0xed, 0x11, 0xb4, 0x78, 0x41, 0x4f, 0xfd,
+  0x7c, 0x9e, 0xa4, 0x93, 0x01, 0xfc, 0x73, 0xde, 0x75, 0x2b, 0x86, 0x4b,
+  0x96, 0x4c, 0x8b, 0x9b, 0x6c, 0x96, 0x0d, 0x92, 0xa4, 0x77, 0x9b, 0x24,
+  0xa3, 0xbc, 0xc7, 0xdf, 0xe0, 0x0a, 0x26, 0xe9, 0x08, 0x7e, 0xd3, 0x75,
+  0xec, 0xcc, 0xb2, 0x51, 0x5a, 0xe1, 0x83, 0xc3, 0x2c, 0xad, 0xe6, 0xb3,
+  0x0c, 0xd7, 0x2b, 0x39, 0xcf, 0x32, 0x6a, 0x4f, 0x5e, 0x5c, 0xdf, 0xdd,
+  0xa0, 0x57, 0x07, 0x59, 0x95, 0xe6, 0xa3, 0x12, 0x3a, 0xa3, 0x5d, 0xc5,
+  0x27, 0x2e, 0xae, 0x32, 0x5c, 0xe5, 0xa4, 0xbc, 0x9d, 0x54, 0xe9, 0x47,
+  0xee, 0x5a, 0xd6, 0xb5, 0x33, 0xc8, 0xa6, 0xd9, 0x64, 0x90, 0x4d, 0xaa,
+  0x6e, 0xf2, 0xd7, 0x62, 0x9e, 0x0c, 0x73, 0x18, 0x2b, 0x6c, 0x11, 0xb7,
+  0x02, 0x5d, 0x0e, 0xb2, 0xb2, 0x3f, 0xcb, 0x89, 0x0c, 0x60, 0xd0, 0x13,
+  0x6a, 0xef, 0xec, 0xc5, 0x61, 0xb2, 0xfb, 0xcd, 0xd3, 0x27, 0x32, 0xa1,
+  0xe3, 0x61, 0x72, 0x0b, 0xaf, 0x42, 0x93, 0xd7, 0xf9, 0x20, 0x4b, 0x98,
+  0x9e, 0x92, 0x9b, 0xbc, 0xba, 0x2a, 0xe6, 0x15, 0xfe, 0x39, 0xca, 0xd2,
+  0x01, 0xee, 0xb4, 0xf5, 0xba, 0xbf, 0xb9, 0x99, 0x94, 0xfd, 0xab, 0x6c,
+  0x9c, 0xb5, 0x65, 0x39, 0x2e, 0xe7, 0x59, 0x59, 0x66, 0x25, 0xb5, 0x77,
+  0x73, 0x95, 0x56, 0xf6, 0x28, 0x35, 0x7d, 0x93, 0xe2, 0xf8, 0x8e, 0x2b,
+  0x24, 0x0a, 0x18, 0xc6, 0x20, 0x1b, 0xa6, 0xf3, 0x11, 0xd2, 0x48, 0x41,
+  0xfb, 0x9b, 0xf4, 0xa0, 0x9f, 0xb4, 0x2c, 0xe7, 0xe3, 0xac, 0x4c, 0x0a,
+  0x78, 0x66, 0x06, 0x33, 0xec, 0xa5, 0x65, 0x36, 0xa0, 0xf6, 0x60, 0xe4,
+  0xc5, 0xb0, 0xca, 0x26, 0x9d, 0x39, 0x7c, 0x92, 0x5c, 0x15, 0x65, 0x35,
+  0x49, 0xc7, 0x48, 0x5a, 0xd9, 0x30, 0xff, 0x88, 0x6b, 0xf9, 0x02, 0x57,
+  0x3c, 0xfb, 0x98, 0x8e, 0xa7, 0x23, 0x18, 0x10, 0x2e, 0xa2, 0x3e, 0x54,
+  0x26, 0x65, 0x95, 0xce, 0x2a, 0x1a, 0x3c, 0x4e, 0x88, 0xda, 0x6b, 0x0d,
+  0xab, 0x69, 0xb7, 0xc5, 0x03, 0xd7, 0x5e, 0x75, 0x94, 0x48, 0x92, 0xb2,
+  0x2c, 0xb8, 0x9c, 0xfd, 0x74, 0x92, 0x94, 0xd3, 0xac, 0x9f, 0x0f, 0x6f,
+  0x81, 0x0a, 0x60, 0x97, 0xd3, 0x71, 0x31, 0x87, 0xa7, 0x8a, 0x21, 0x91,
+  0x3d, 0x0e, 0x0d, 0x86, 0x0b, 0x34, 0x51, 0x8c, 0xc7, 0x48, 0x25, 0xa3,
+  0x7c, 0x92, 0x75, 0x71, 0xbf, 0xe0, 0xf1, 0x59, 0x86, 0xfb, 0x5d, 0xc1,
+  0x32, 0xf1, 0x34, 0xf2, 0x09, 0x2c, 0x65, 0x99, 0xfd, 0x7d, 0x0e, 0x9b,
+  0x95, 0xa7, 0xa3, 0x04, 0x5e, 0x98, 0xc0, 0x21, 0xc2, 0xcf, 0xb1, 0x0d,
+  0xee, 0x26, 0x47, 0x2a, 0x29, 0x66, 0x03, 0x3c, 0x5d, 0x93, 0x11, 0xac,
+  0x29, 0x8d, 0x0c, 0x26, 0x9e, 0x24, 0x9d, 0xce, 0x34, 0x9d, 0x01, 0x5d,
+  0x65, 0xa3, 0x6e, 0xe3, 0xf8, 0xa2, 0x41, 0x24, 0x7a, 0xf2, 0xf1, 0x03,
+  0x1e, 0xeb, 0x18, 0x16, 0x6b, 0xc0, 0x7f, 0xe3, 0x50, 0x60, 0x36, 0xdc,
+  0x0f, 0x4c, 0x82, 0xda, 0xc3, 0x41, 0x44, 0xf3, 0x70, 0xe4, 0x9e, 0x56,
+  0x55, 0x36, 0x9e, 0xf2, 0x8e, 0xcd, 0x32, 0x1c, 0x4e, 0xbf, 0x80, 0xd1,
+  0xf7, 0xb9, 0x0f, 0xd8, 0x71, 0xd8, 0xd6, 0x41, 0x81, 0xcb, 0x3c, 0x86,
+  0x8d, 0xcd, 0x61, 0x1f, 0x8c, 0xf8, 0xcb, 0x76, 0x52, 0x16, 0xd8, 0x7a,
+  0xca, 0x0c, 0xe2, 0x32, 0xab, 0x68, 0x3f, 0xc6, 0x38, 0x82, 0x21, 0xd0,
+  0x68, 0xc9, 0xcc, 0x85, 0x17, 0x01, 0x37, 0x56, 0xb8, 0xcb, 0x00, 0xde,
+  0x9a, 0x14, 0x15, 0x4d, 0xde, 0x5a, 0x95, 0x6e, 0xa1, 0x4f, 0x18, 0x26,
+  0x33, 0x9c, 0xac, 0x9a, 0x4f, 0x93, 0x2b, 0xf8, 0xb3, 0xbc, 0x4a, 0x3f,
+  0x20, 0x39, 0x5c, 0x5c, 0xc1, 0x09, 0xc9, 0xc7, 0x48, 0xcf, 0xd0, 0x38,
+  0xae, 0x4f, 0x36, 0xe8, 0x26, 0x87, 0x36, 0x60, 0x99, 0x01, 0x2d, 0x5e,
+  0x31, 0x19, 0xdd, 0x26, 0x3d, 0xf8, 0x63, 0x50, 0x4c, 0xf8, 0x38, 0x22,
+  0xf9, 0xd0, 0x7a, 0xb9, 0x1d, 0xe1, 0x23, 0x9d, 0x20, 0xbb, 0x1b, 0xd5,
+  0x76, 0x1b, 0x17, 0xf3, 0xba, 0xe8, 0xa7, 0x7c, 0xc0, 0xf0, 0x53, 0x68,
+  0x16, 0x87, 0x0d, 0xad, 0x52, 0x7b, 0xd3, 0x6c, 0x06, 0xaf, 0x8f, 0xa1,
+  0x95, 0x5e, 0x56, 0xdd, 0x64, 0xb0, 0x50, 0x65, 0x86, 0x1b, 0x59, 0x65,
+  0xbc, 0xb4, 0xb3, 0xf9, 0xa4, 0x94, 0xa5, 0x3e, 0x95, 0x13, 0x08, 0xe3,
+  0x3a, 0x3e, 0xbd, 0x7e, 0x92, 0xfc, 0xa3, 0xa0, 0xf6, 0x07, 0x4a, 0x22,
+  0x7a, 0x2c, 0xb1, 0x9f, 0x04, 0xce, 0x75, 0x3a, 0x85, 0x56, 0xa1, 0xfd,
+  0x3e, 0x50, 0x54, 0x7a, 0x09, 0x0b, 0x97, 0x5f, 0x4e, 0x80, 0xb3, 0xbc,
+  0xce, 0x3f, 0x64, 0x42, 0x71, 0x5f, 0x7d, 0xf5, 0xa8, 0x75, 0x55, 0x55,
+  0x53, 0x38, 0xb0, 0x7f, 0x1b, 0x66, 0x4f, 0xb7, 0xf6, 0xf7, 0x77, 0xff,
+  0x63, 0x67, 0x2f, 0xab, 0xae, 0xb6, 0x7e, 0xdd, 0x6c, 0x71, 0xa7, 0x47,
+  0xb0, 0xd6, 0xb7, 0xd5, 0x15, 0x6e, 0x89, 0x70, 0x80, 0x81, 0x92, 0x75,
+  0x3c, 0x4f, 0xdc, 0x41, 0xe4, 0x3d, 0x38, 0xb9, 0xb4, 0xf6, 0x1d, 0x53,
+  0x1b, 0x9f, 0xd6, 0x59, 0x92, 0xc3, 0xfe, 0xa4, 0xb3, 0x4b, 0x38, 0x58,
+  0x93, 0xaa, 0x1d, 0x9f, 0x33, 0xba, 0x69, 0x70, 0x1e, 0xf8, 0x6e, 0x35,
+  0x03, 0x76, 0x08, 0x9f, 0xe1, 0xe1, 0x87, 0x8b, 0xa3, 0x7f, 0x05, 0xeb,
+  0xf0, 0xf2, 0xf5, 0xc9, 0x8f, 0x3f, 0x1e, 0xbf, 0x7d, 0xd9, 0x7c, 0x06,
+  0x03, 0x21, 0xf0, 0x16, 0x41, 0x67, 0xb0, 0x96, 0x48, 0x0e, 0x7a, 0x22,
+  0x91, 0x15, 0xdf, 0xcc, 0x72, 0x22, 0xb1, 0x51, 0x5e, 0xe2, 0x57, 0xb8,
+  0x64, 0xc2, 0xf9, 0x7a, 0xb3, 0xb4, 0x8f, 0x3c, 0x66, 0x96, 0x00, 0x75,
+  0x5e, 0xc2, 0x6f, 0xfc, 0x1d, 0x7d, 0xfe, 0x21, 0xab, 0x80, 0x78, 0x7e,
+  0x86, 0x69, 0x23, 0xf3, 0xae, 0x90, 0x88, 0x5a, 0x97, 0xa3, 0xa2, 0xd7,
+  0x83, 0xa6, 0x5a, 0xf5, 0x1d, 0xa2, 0xb6, 0x79, 0x33, 0xaa, 0xab, 0x59,
+  0x96, 0x25, 0x83, 0x7c, 0x08, 0xc4, 0x0e, 0x13, 0x4e, 0x98, 0xef, 0x8c,
+  0x60, 0x13, 0xa8, 0x91, 0x7d, 0xb7, 0x07, 0x65, 0x5e, 0x65, 0xdd, 0x7f,
+  0xc2, 0xae, 0xb6, 0xab, 0x9b, 0xa2, 0x4d, 0x2f, 0xfe, 0xab, 0x0b, 0x2b,
+  0x29, 0x5b, 0xf1, 0xbc, 0x10, 0xfe, 0x40, 0x63, 0x1c, 0xc2, 0x25, 0x32,
+  0x05, 0xba, 0x86, 0x75, 0x9b, 0xe5, 0x7d, 0x3c, 0x15, 0x79, 0x46, 0xf3,
+  0xe3, 0x6b, 0xf7, 0x6f, 0xbf, 0xe2, 0xaa, 0xe5, 0x13, 0x6a, 0x7f, 0x48,
+  0xcd, 0x23, 0x5f, 0x13, 0x36, 0x88, 0xad, 0x6e, 0xe2, 0xe9, 0xfa, 0xdb,
+  0x76, 0x67, 0x7b, 0x6b, 0xeb, 0xd7, 0x6e, 0xf5, 0xb1, 0x92, 0x5e, 0x7e,
+  0xc6, 0x41, 0x2b, 0x4b, 0xff, 0x47, 0x36, 0x2b, 0xb2, 0xf2, 0xbe, 0x36,
+  0xb6, 0xb6, 0x96, 0xb5, 0x02, 0x7c, 0x61, 0x86, 0x77, 0xfd, 0xac, 0x98,
+  0x5f, 0x5e, 0x11, 0xd1, 0xd0, 0xa0, 0x81, 0xd4, 0xef, 0x6b, 0x33, 0xed,
+  0xfc, 0xc3, 0xb7, 0xf7, 0x36, 0x2b, 0xf1, 0x86, 0x0c, 0xf3, 0x47, 0xfe,
+  0x49, 0xe7, 0x48, 0x24, 0x8a, 0x6c, 0xd0, 0xa6, 0x7b, 0xe2, 0x56, 0x48,
+  0x82, 0xf8, 0x42, 0x99, 0x01, 0xf5, 0x02, 0x2f, 0x85, 0x25, 0x05, 0xc2,
+  0xcc, 0x3e, 0xc2, 0xe3, 0x55, 0x41, 0xed, 0x65, 0x69, 0xff, 0x8a, 0xef,
+  0x12, 0xbf, 0x01, 0x7e, 0x14, 0xe9, 0xac, 0x7f, 0x95, 0x5f, 0xc3, 0x02,
+  0x7d, 0xf3, 0xcd, 0x93, 0x0e, 0xfc, 0xf8, 0xe6, 0xd7, 0xcd, 0xeb, 0x62,
+  0x04, 0xeb, 0xf5, 0xf8, 0xd7, 0x4d, 0x24, 0xaa, 0x7f, 0xa6, 0xed, 0x5e,
+  0xbb, 0xff, 0xaf, 0xee, 0x55, 0x35, 0x1e, 0xb5, 0x96, 0x5c, 0x09, 0x70,
+  0xbd, 0x64, 0x53, 0x64, 0x08, 0x70, 0x29, 0x00, 0xcb, 0x22, 0xe1, 0x09,
+  0xd6, 0x40, 0x88, 0x0b, 0xb9, 0x25, 0xb0, 0xbb, 0x04, 0x07, 0x79, 0x9b,
+  0xbc, 0x85, 0x05, 0x83, 0xcd, 0xec, 0x11, 0xcb, 0x9d, 0xf1, 0xd5, 0x4f,
+  0xeb, 0xb7, 0x6c, 0x80, 0x61, 0xfb, 0xf6, 0xb7, 0x6d, 0xed, 0x97, 0x3f,
+  0x09, 0x0b, 0xba, 0xbf, 0x13, 0x6d, 0x11, 0x72, 0x65, 0x23, 0x16, 0x18,
+  0xda, 0x3f, 0xff, 0xe5, 0xd6, 0x97, 0x78, 0x36, 0xf2, 0xae, 0x0f, 0xc8,
+  0xe0, 0x90, 0x03, 0xd7, 0x0f, 0x35, 0xb0, 0x03, 0xe0, 0xf9, 0x6d, 0x5c,
+  0x71, 0xe6, 0x64, 0xb3, 0xa2, 0x97, 0xf6, 0x80, 0x5f, 0x5e, 0xa5, 0xd7,
+  0x19, 0xce, 0x6d, 0x3a, 0xa7, 0x1b, 0x3d, 0x19, 0xce, 0x51, 0xda, 0x51,
+  0xee, 0x94, 0xe3, 0x55, 0x30, 0xef, 0xc1, 0x19, 0xfd, 0xfb, 0xbc, 0xa8,
+  0x32, 0xba, 0x33, 0xd2, 0xeb, 0x02, 0xd8, 0x18, 0x5d, 0x95, 0xe5, 0x55,
+  0x36, 0x1a, 0x31, 0xa7, 0xc5, 0x4e, 0x73, 0x5c, 0x38, 0x38, 0x39, 0x76,
+  0x45, 0x03, 0x3b, 0xe8, 0x26, 0xcc, 0xc3, 0x81, 0x96, 0xe0, 0xea, 0xb8,
+  0x2c, 0x70, 0x29, 0x71, 0x69, 0x69, 0x3b, 0x61, 0xb5, 0xaf, 0x80, 0x7d,
+  0xf6, 0x89, 0xf0, 0x98, 0x85, 0xc8, 0x05, 0x4b, 0xbb, 0x92, 0x8e, 0xda,
+  0x7c, 0xf6, 0xf0, 0x05, 0x59, 0xa3, 0x64, 0xed, 0xbf, 0xaf, 0xb5, 0x93,
+  0xb5, 0xff, 0x7b, 0x8d, 0xb8, 0xce, 0xda, 0x7f, 0xae, 0xc9, 0x69, 0x3e,
+  0x87, 0xfe, 0x90, 0x4a, 0x86, 0xc3, 0x44, 0x0f, 0x3a, 0x0f, 0xa1, 0xd3,
+  0xc1, 0xbf, 0xe1, 0x73, 0x78, 0xf0, 0xa7, 0x83, 0xb3, 0xe3, 0x83, 0x1f,
+  0x5f, 0x1f, 0x79, 0xb9, 0xda, 0x84, 0xdc, 0x68, 0xc1, 0xae, 0xd3, 0x59,
+  0x0e, 0xeb, 0x83, 0xa3, 0x5d, 0x4f, 0x07, 0xc8, 0x47, 0x61, 0x29, 0x9e,
+  0x76, 0x77, 0xbb, 0x5b, 0x1b, 0x5d, 0x90, 0xf6, 0x2a, 0xff, 0x80, 0x09,
+  0x23, 0x9d, 0x8e, 0x7e, 0x4a, 0x8c, 0xe3, 0x3b, 0xb8, 0xe0, 0x2a, 0xe4,
+  0x22, 0x30, 0xfa, 0xda, 0x57, 0x3f, 0xe0, 0x2e, 0x27, 0xeb, 0xb0, 0x6f,
+  0x70, 0x32, 0x5a, 0xf8, 0x47, 0x8b, 0x88, 0x11, 0x6f, 0xaf, 0xb2, 0x1a,
+  0x08, 0x87, 0xcb, 0x87, 0x78, 0x23, 0xb2, 0x9c, 0x2e, 0xf7, 0xd5, 0x20,
+  0x2d, 0xaf, 0x92, 0xf5, 0xce, 0xc6, 0x86, 0x4c, 0xfb, 0x27, 0x6d, 0x55,
+  0xfa, 0x2a, 0xb5, 0x99, 0xec, 0xe3, 0x14, 0x26, 0xc3, 0xe3, 0x66, 0x8e,
+  0x8e, 0xdc, 0x15, 0xba, 0xa6, 0xb5, 0x66, 0x4a, 0x6a, 0xfd, 0xf3, 0x9f,
+  0x38, 0x98, 0x7f, 0xfd, 0xab, 0x85, 0x7d, 0x99, 0xe0, 0x20, 0x8f, 0x93,
+  0x60, 0x86, 0x4c, 0x5e, 0x84, 0xb3, 0x81, 0xdc, 0x57, 0xad, 0x4e, 0x87,
+  0x1b, 0xef, 0xb4, 0xe4, 0x7e, 0xc6, 0x83, 0x51, 0xca, 0x2d, 0x23, 0xa3,
+  0x80, 0x8d, 0xb0, 0xf6, 0x6c, 0xe6, 0x2d, 0x6c, 0xb2, 0x05, 0x23, 0x02,
+  0xfe, 0x47, 0x3c, 0x80, 0xaf, 0xe2, 0xde, 0x28, 0x9d, 0x7c, 0xc0, 0xc9,
+  0x12, 0x4d, 0x51, 0xb7, 0x03, 0xa4, 0x13, 0xe4, 0x18, 0xd9, 0x47, 0xe4,
+  0xcd, 0x29, 0xd2, 0x0f, 0xb5, 0xa7, 0x6d, 0x81, 0x04, 0x4a, 0xad, 0x24,
+  0x38, 0x09, 0x18, 0x3e, 0x9c, 0xca, 0x1e, 0xdc, 0xdb, 0x63, 0x13, 0xc1,
+  0x60, 0x19, 0x99, 0x0e, 0x81, 0xc9, 0xf2, 0x04, 0xe8, 0x2f, 0xb8, 0x9f,
+  0xf4, 0xda, 0xe5, 0x4b, 0x04, 0xee, 0x8a, 0x72, 0x04, 0x8b, 0x2a, 0x94,
+  0xd6, 0xfa, 0x05, 0x9a, 0x73, 0x42, 0x63, 0xda, 0xef, 0xa3, 0xe0, 0x86,
+  0x74, 0xc1, 0x93, 0x06, 0x6e, 0x34, 0xb9, 0xce, 0x67, 0xc5, 0x04, 0x2f,
+  0x44, 0x47, 0x05, 0x78, 0x57, 0x0d, 0xf3, 0x19, 0x0c, 0x16, 0xa4, 0x95,
+  0x82, 0xc5, 0x54, 0x18, 0xc7, 0xb8, 0x4b, 0xed, 0x88, 0x74, 0x33, 0x02,
+  0xa1, 0x05, 0xb7, 0x33, 0xcb, 0x99, 0xfa, 0x67, 0x70, 0x82, 0xf3, 0x59,
+  0xc6, 0x03, 0x6e, 0x6a, 0x97, 0xd8, 0x4e, 0x2f, 0x23, 0x32, 0xc0, 0xd5,
+  0x42, 0x86, 0x89, 0x3b, 0xac, 0x67, 0x58, 0x2e, 0x30, 0x11, 0xc2, 0xe1,
+  0xb5, 0xd1, 0x9c, 0xa4, 0x18, 0x78, 0x06, 0x38, 0x6a, 0x4e, 0x77, 0x3c,
+  0x5f, 0xf2, 0x23, 0x38, 0x5c, 0x83, 0x5b, 0x6c, 0xa8, 0x9b, 0x9c, 0x8e,
+  0x52, 0x78, 0x04, 0x37, 0x52, 0xfb, 0xa1, 0xf6, 0xfe, 0x43, 0xb6, 0x67,
+  0x6c, 0x4a, 0x5f, 0x18, 0x07, 0xde, 0xa3, 0x40, 0x01, 0xb2, 0x83, 0xc4,
+  0xbc, 0x61, 0x6b, 0x2a, 0xbe, 0x74, 0x49, 0x84, 0x99, 0xcd, 0x50, 0x5a,
+  0x18, 0x3a, 0xe9, 0xb0, 0x71, 0x42, 0x2a, 0x74, 0xf8, 0xf1, 0x24, 0x17,
+  0xc5, 0xd2, 0xc9, 0x60, 0x8b, 0x39, 0xb7, 0x27, 0xaf, 0xc2, 0x2b, 0x6d,
+  0xba, 0x30, 0xdc, 0xf8, 0x79, 0xec, 0x7a, 0xe0, 0x5a, 0xb8, 0x54, 0x0b,
+  0xdf, 0xfe, 0xa0, 0xdf, 0xca, 0xf6, 0x1e, 0x09, 0xd3, 0x4d, 0x5e, 0x66,
+  0xcc, 0xfa, 0xde, 0x9d, 0x1f, 0x9d, 0x2d, 0x1b, 0xf5, 0x04, 0xf6, 0x81,
+  0x76, 0x09, 0x38, 0x23, 0xa8, 0x25, 0xa0, 0x8f, 0xe1, 0xc8, 0xf8, 0x8d,
+  0x9c, 0x55, 0x25, 0x19, 0x1b, 0xde, 0x00, 0xae, 0xeb, 0xb5, 0xff, 0xc0,
+  0x87, 0xd6, 0xf0, 0x33, 0x39, 0x35, 0xc8, 0x74, 0xbe, 0x4b, 0x88, 0xf5,
+  0x97, 0xf5, 0x6b, 0x6c, 0x9a, 0x6f, 0xfe, 0xf3, 0x9f, 0xf8, 0xc2, 0xbf,
+  0xfe, 0xb5, 0x09, 0x47, 0xf5, 0xaa, 0x18, 0x78, 0xfe, 0xcf, 0x0d, 0x20,
+  0x65, 0x19, 0xdd, 0xa9, 0xce, 0x66, 0x5c, 0x2c, 0x15, 0x5a, 0x19, 0x02,
+  0x27, 0x9f, 0x88, 0x4c, 0x4f, 0xd2, 0x1e, 0xdd, 0xb3, 0xe3, 0x54, 0xc4,
+  0xc9, 0x68, 0x73, 0xc3, 0xb1, 0x1d, 0x17, 0x33, 0xfe, 0xf3, 0x3a, 0x9b,
+  0xe4, 0xb8, 0x02, 0x30, 0x6d, 0x5c, 0x6b, 0x52, 0xf8, 0xb8, 0x09, 0x38,
+  0x56, 0xe3, 0xa0, 0x45, 0xaa, 0xe4, 0x0e, 0x1a, 0x42, 0x3e, 0x22, 0x9e,
+  0x7b, 0x05, 0x72, 0x11, 0xb0, 0x6f, 0x90, 0xcd, 0xe4, 0xa4, 0xb5, 0xf0,
+  0x8d, 0x56, 0x9b, 0xce, 0x1e, 0xb5, 0x00, 0x9a, 0xa8, 0xde, 0x36, 0x81,
+  0x5f, 0xa4, 0x38, 0xf4, 0xe4, 0xbf, 0xce, 0x4f, 0xde, 0x52, 0x7b, 0x74,
+  0xdd, 0x0c, 0xf4, 0x10, 0x73, 0x3b, 0xbf, 0x95, 0xc5, 0x04, 0xda, 0xc1,
+  0xbb, 0x09, 0xae, 0xbd, 0x62, 0xc0, 0xe7, 0x26, 0x7a, 0x04, 0xd6, 0x02,
+  0x7b, 0x42, 0x7d, 0xf3, 0xc9, 0x63, 0x79, 0x8a, 0x69, 0x47, 0x04, 0xbc,
+  0x56, 0xef, 0xc9, 0xe3, 0x16, 0x2b, 0x4e, 0xf2, 0xd0, 0x20, 0xa3, 0xa6,
+  0xec, 0x81, 0x27, 0x8f, 0xe1, 0x93, 0x16, 0x13, 0x65, 0x3a, 0x9d, 0xc2,
+  0x15, 0xe9, 0x16, 0xb2, 0xa8, 0xf3, 0x21, 0xde, 0x93, 0x12, 0xbe, 0x85,
+  0x6e, 0xe1, 0xa2, 0xa0, 0x33, 0x8f, 0x2b, 0x38, 0x2a, 0x82, 0x72, 0x30,
+  0xa0, 0x63, 0x4c, 0xe4, 0x33, 0xcb, 0x2f, 0xaf, 0x50, 0x0e, 0x42, 0x52,
+  0x2f, 0xe8, 0xb0, 0x64, 0x35, 0xbe, 0x56, 0xe7, 0xe8, 0x09, 0x28, 0xc0,
+  0x23, 0x5a, 0xec, 0x09, 0x5d, 0xcd, 0xbd, 0x5b, 0xba, 0x87, 0x71, 0x4b,
+  0x49, 0x2d, 0x25, 0x2e, 0x49, 0x13, 0x1d, 0xb0, 0xf2, 0xc6, 0x67, 0x4f,
+  0xd9, 0x7f, 0x3f, 0x85, 0xed, 0x2b, 0xed, 0x84, 0xc6, 0xb4, 0xbf, 0x4f,
+  0x22, 0x4d, 0x9d, 0x71, 0xc3, 0x46, 0xd0, 0xf5, 0xa4, 0x87, 0xfe, 0xbf,
+  0xbd, 0x3a, 0x79, 0x73, 0xb4, 0xd9, 0x2d, 0xb3, 0xfe, 0x0c, 0x9e, 0xa6,
+  0xa3, 0x90, 0x86, 0x11, 0xf3, 0x4d, 0x2a, 0xec, 0x01, 0xd8, 0x2c, 0x2c,
+  0xdd, 0x1b, 0xa0, 0x32, 0x24, 0x49, 0xe2, 0x6c, 0x69, 0x95, 0xf8, 0x1e,
+  0x88, 0x23, 0x21, 0x45, 0x8c, 0x55, 0x81, 0x15, 0xa5, 0xa7, 0x23, 0x93,
+  0x10, 0xb3, 0x03, 0xe9, 0x56, 0x13, 0x62, 0xfd, 0xa7, 0x27, 0xe7, 0x17,
+  0x64, 0xba, 0xaa, 0x1d, 0xad, 0xff, 0xc0, 0x71, 0xb9, 0x83, 0x65, 0x5f,
+  0xc0, 0x28, 0x7e, 0xf8, 0xe7, 0x3f, 0xf1, 0x5b, 0x38, 0x46, 0x32, 0x6e,
+  0xf7, 0x1c, 0x59, 0xc1, 0xe0, 0xda, 0x80, 0xc7, 0xf6, 0x71, 0x24, 0xfb,
+  0x40, 0x35, 0x70, 0x07, 0x7e, 0xf5, 0xa8, 0xe9, 0x48, 0xf2, 0x7a, 0x1d,
+  0x36, 0xcb, 0x06, 0x76, 0x2d, 0x94, 0x44, 0x1e, 0x68, 0x41, 0x4a, 0x62,
+  0x69, 0x01, 0xd6, 0xfb, 0xe4, 0xdd, 0xc5, 0xe9, 0xbb, 0x0b, 0x33, 0xcf,
+  0xe0, 0x7e, 0x55, 0xb0, 0xa3, 0x2c, 0x01, 0xdd, 0xe4, 0xa5, 0xda, 0x5d,
+  0x50, 0xd3, 0x21, 0x41, 0x13, 0x85, 0xce, 0xac, 0x9f, 0x81, 0x3c, 0x3b,
+  0x60, 0x8b, 0x1d, 0x2c, 0x38, 0x08, 0x05, 0x70, 0x6c, 0xe8, 0x18, 0xd2,
+  0x19, 0xea, 0xa9, 0x56, 0x08, 0xe4, 0x3f, 0xef, 0x23, 0x89, 0xc1, 0x43,
+  0xf8, 0x17, 0x1c, 0x4c, 0xd0, 0xbc, 0xaf, 0x65, 0xe5, 0xe9, 0x75, 0xd9,
+  0xb1, 0x11, 0x68, 0xb6, 0x23, 0xda, 0xd9, 0xb6, 0xdc, 0xff, 0xd4, 0x55,
+  0xa7, 0xc3, 0xe7, 0x51, 0x15, 0xbe, 0x4e, 0x67, 0x96, 0x8d, 0xe1, 0xf0,
+  0x75, 0xe8, 0x22, 0x16, 0xd3, 0x43, 0x97, 0x86, 0xae, 0xf6, 0xc5, 0xe4,
+  0x12, 0xc6, 0x36, 0x09, 0xfa, 0x1b, 0x6b, 0x6b, 0x48, 0xe2, 0x6a, 0xc6,
+  0x5c, 0x66, 0x87, 0x60, 0x2e, 0x50, 0xe6, 0xe3, 0x7c, 0x94, 0xce, 0xe0,
+  0x68, 0x4d, 0x40, 0x9d, 0x2f, 0x9d, 0x26, 0xa8, 0x96, 0x0e, 0x92, 0xf8,
+  0x58, 0x3a, 0xc2, 0x33, 0x87, 0x13, 0xd2, 0xf6, 0xc6, 0xde, 0x96, 0x41,
+  0x72, 0x02, 0xab, 0x16, 0x70, 0xd4, 0xe0, 0x4e, 0x40, 0x89, 0xc2, 0x16,
+  0x16, 0xf8, 0x01, 0x9c, 0x01, 0xb8, 0x93, 0xa1, 0xfb, 0x56, 0xa2, 0xd6,
+  0x1d, 0x21, 0xc3, 0x4a, 0xc4, 0x16, 0x95, 0xdf, 0x65, 0xf9, 0x81, 0xde,
+  0x78, 0x3d, 0x68, 0xad, 0x45, 0x0e, 0xe1, 0x03, 0x86, 0x4b, 0x46, 0x46,
+  0x3d, 0xfe, 0xbd, 0xad, 0x56, 0x1d, 0x24, 0x81, 0x51, 0xde, 0xcf, 0x2b,
+  0x98, 0x50, 0x5a, 0x7e, 0x10, 0x12, 0x86, 0x71, 0x13, 0x43, 0x01, 0x6a,
+  0xc8, 0xfb, 0xc4, 0x04, 0x9a, 0x6c, 0x3a, 0x30, 0x99, 0xd3, 0xb3, 0x93,
+  0x8b, 0x93, 0xc3, 0x93, 0xd7, 0x8d, 0x42, 0x69, 0x42, 0x2a, 0x63, 0x31,
+  0x77, 0x66, 0xc2, 0x92, 0xe5, 0x26, 0x64, 0xa1, 0x48, 0x66, 0xc8, 0x0e,
+  0x13, 0x10, 0xea, 0xc6, 0x68, 0x96, 0x65, 0x43, 0x5e, 0xc9, 0x42, 0x07,
+  0xcf, 0x0b, 0xd5, 0x9f, 0xbc, 0x3f, 0x87, 0xf5, 0x86, 0x5b, 0x3b, 0x07,
+  0xba, 0x1b, 0xa7, 0xb7, 0x7c, 0x57, 0x71, 0x1f, 0xcc, 0xb1, 0xe0, 0xfc,
+  0xca, 0xba, 0xa2, 0x65, 0x17, 0xce, 0xd9, 0x6b, 0x5c, 0x1b, 0x14, 0x37,
+  0x46, 0x45, 0xf1, 0x61, 0x3e, 0x4d, 0x6e, 0x8a, 0xd9, 0x40, 0xe5, 0xc6,
+  0x62, 0x42, 0x53, 0x80, 0x79, 0xe1, 0x1c, 0x52, 0xd4, 0x65, 0xe5, 0x65,
+  0x34, 0x08, 0xc3, 0xcb, 0x67, 0x48, 0x85, 0xb8, 0x83, 0xb8, 0xa6, 0x8e,
+  0xf0, 0x60, 0x60, 0x61, 0xdb, 0xfc, 0x18, 0x58, 0xcc, 0x22, 0x9a, 0xc4,
+  0xe7, 0xd0, 0x26, 0x89, 0x16, 0xd3, 0x47, 0x4c, 0x8a, 0xa3, 0x5b, 0x56,
+  0x17, 0x89, 0x2b, 0xcc, 0xe6, 0x93, 0x09, 0x3d, 0x08, 0x0c, 0xf6, 0x4d,
+  0xde, 0x9f, 0x15, 0x65, 0x31, 0xac, 0x40, 0x85, 0x9d, 0x0c, 0x8a, 0x9b,
+  0x32, 0x91, 0x11, 0xe2, 0x56, 0x4f, 0x40, 0x1e, 0xbc, 0x46, 0xe2, 0x7c,
+  0x7b, 0xf8, 0xd5, 0x23, 0xe0, 0xe4, 0xb3, 0x02, 0xd5, 0x48, 0x98, 0xc7,
+  0x07, 0x18, 0xc6, 0x09, 0xda, 0x8a, 0xd2, 0x5e, 0x59, 0x8c, 0xe6, 0x30,
+  0xc2, 0x69, 0x5a, 0x5d, 0xd9, 0x14, 0x2e, 0x4e, 0xd7, 0xcf, 0x37, 0x60,
+  0x12, 0xb5, 0x8d, 0xc0, 0x26, 0x5f, 0x10, 0x5b, 0xbc, 0x50, 0x2a, 0x3f,
+  0x55, 0xbb, 0xa8, 0x48, 0x41, 0xa0, 0x04, 0x16, 0x7c, 0xf7, 0x56, 0x37,
+  0x59, 0xfa, 0x41, 0x0c, 0x5b, 0x8f, 0x46, 0xa8, 0x33, 0xa2, 0x39, 0x02,
+  0x1f, 0xc2, 0x55, 0x11, 0x6b, 0x2c, 0x0f, 0xf5, 0xe2, 0xb5, 0x1a, 0xa3,
+  0xd9, 0x64, 0xce, 0x9d, 0x9f, 0x65, 0xc0, 0x99, 0xe0, 0x3d, 0x59, 0xb6,
+  0xaf, 0xcc, 0x7e, 0xde, 0x34, 0x36, 0xb2, 0xbb, 0xd2, 0x10, 0x02, 0xb5,
+  0x78, 0x9b, 0x21, 0x31, 0x2c, 0x39, 0xc7, 0xca, 0x40, 0x40, 0xc1, 0x4a,
+  0x3f, 0x7c, 0xf5, 0x88, 0x5e, 0xc5, 0xe1, 0xa1, 0xc4, 0xbf, 0xd5, 0xfd,
+  0xa6, 0x9d, 0x6c, 0x77, 0xb7, 0xf0, 0xc7, 0x76, 0x3b, 0xd9, 0xa1, 0x97,
+  0x77, 0x13, 0x36, 0x4b, 0xf3, 0xc6, 0x0b, 0x0d, 0xd9, 0x39, 0x25, 0xd3,
+  0x0f, 0xdc, 0x61, 0x8f, 0xfa, 0xc5, 0x6c, 0x86, 0xd2, 0xed, 0x12, 0x22,
+  0x27, 0xe6, 0xf7, 0xe6, 0x40, 0x86, 0xff, 0xce, 0x36, 0x09, 0xa8, 0x11,
+  0x44, 0xa9, 0x59, 0xdd, 0x28, 0xad, 0x62, 0x0d, 0x0e, 0x15, 0xf6, 0x75,
+  0x32, 0x2a, 0x52, 0x94, 0xbc, 0xf1, 0xe1, 0x92, 0x2d, 0x78, 0x40, 0x9a,
+  0xdd, 0xaf, 0x1e, 0xdd, 0xb7, 0xa4, 0xe8, 0x55, 0x70, 0x2b, 0xc6, 0xcd,
+  0x01, 0xe1, 0xe2, 0x50, 0x0b, 0xd0, 0xe3, 0x99, 0xb8, 0xb9, 0x49, 0x68,
+  0xb1, 0xcd, 0xab, 0xe8, 0x1a, 0x0c, 0x4d, 0xa1, 0x67, 0x62, 0x61, 0xe5,
+  0xf1, 0x43, 0x5b, 0xbe, 0xdd, 0x6e, 0xf2, 0x5c, 0xc6, 0x4a, 0x8b, 0x85,
+  0x86, 0x4f, 0x7a, 0x00, 0xa4, 0x7c, 0xd0, 0x7e, 0xf1, 0x46, 0xec, 0xa1,
+  0x01, 0x1f, 0x75, 0xd3, 0xaf, 0x1e, 0x11, 0x4f, 0xae, 0x8a, 0x69, 0xde,
+  0x47, 0x99, 0x09, 0xe8, 0x6a, 0x3e, 0x95, 0x37, 0x37, 0xa7, 0x45, 0xc9,
+  0x66, 0x6e, 0x79, 0x71, 0x0a, 0x1a, 0x78, 0x5e, 0x5e, 0xc9, 0x0e, 0xc8,
+  0x5b, 0x5d, 0x19, 0xd2, 0x23, 0xea, 0x07, 0xc6, 0x69, 0xf2, 0xb1, 0xda,
+  0x58, 0x92, 0xf5, 0xdb, 0xac, 0x52, 0x45, 0x11, 0x7d, 0x29, 0xbc, 0x12,
+  0x7e, 0x8c, 0x62, 0x2b, 0x98, 0x16, 0xd3, 0x5d, 0x35, 0xd5, 0x8e, 0x33,
+  0xa0, 0x6e, 0xb3, 0xec, 0xa2, 0xdc, 0x80, 0xab, 0x2e, 0xd4, 0xeb, 0x96,
+  0xe6, 0xab, 0x47, 0xf5, 0xc5, 0x46, 0x07, 0x0d, 0x77, 0x81, 0x4e, 0x0e,
+  0xe0, 0x01, 0xc0, 0xd4, 0xe1, 0x0a, 0x79, 0x03, 0x27, 0x3b, 0xbd, 0xa4,
+  0xf9, 0xd8, 0x81, 0x21, 0xad, 0x32, 0x1f, 0x03, 0x5d, 0xc2, 0x31, 0x4c,
+  0xc8, 0x17, 0x80, 0x97, 0x1c, 0x8e, 0x80, 0x34, 0xb7, 0x2c, 0x1d, 0xd3,
+  0x22, 0x81, 0x90, 0x90, 0xa7, 0x6c, 0x89, 0x0d, 0xfb, 0x27, 0xe4, 0x90,
+  0x57, 0xd6, 0xef, 0xf9, 0xe9, 0xc2, 0xce, 0xe0, 0x87, 0x48, 0xcb, 0xf6,
+  0xbc, 0x52, 0xe1, 0xf9, 0xe1, 0xe2, 0xc3, 0xe7, 0xe7, 0xaf, 0x6c, 0x17,
+  0x77, 0x80, 0x89, 0x4e, 0x83, 0xc5, 0x5b, 0xdf, 0x02, 0xb6, 0xb0, 0xf8,
+  0x1a, 0x7c, 0x98, 0xac, 0x0f, 0x66, 0x29, 0x30, 0xa0, 0xbd, 0x0d, 0x32,
+  0x3b, 0xf3, 0xae, 0x47, 0xed, 0x69, 0x0b, 0x6f, 0x7e, 0x6c, 0x3a, 0xbb,
+  0xf0, 0xb1, 0x3d, 0xba, 0x4d, 0x74, 0xc8, 0x74, 0x40, 0x93, 0xd6, 0xb1,
+  0x5b, 0x13, 0x7a, 0xfe, 0xdf, 0x29, 0xad, 0x04, 0xc1, 0x0d, 0xe9, 0x69,
+  0xc2, 0xcf, 0xc4, 0x5b, 0x89, 0x72, 0xd4, 0xa0, 0x79, 0x2f, 0xbf, 0x7a,
+  0xb4, 0x48, 0xe7, 0xec, 0x31, 0x83, 0x3e, 0x5e, 0xa0, 0xbf, 0x83, 0xde,
+  0xc3, 0xfb, 0x65, 0x34, 0x01, 0xd9, 0x8f, 0xee, 0x1a, 0xf2, 0xc2, 0x90,
+  0x44, 0xc9, 0x06, 0x9f, 0xb4, 0x4f, 0x7c, 0xb6, 0x44, 0x06, 0x8e, 0x76,
+  0x73, 0xbe, 0xb6, 0xf1, 0x7e, 0xc5, 0x8e, 0x4b, 0xe8, 0x83, 0x8c, 0xcd,
+  0x15, 0x9d, 0x72, 0x72, 0xb3, 0x90, 0x85, 0x83, 0x26, 0xc8, 0x57, 0x6d,
+  0xc9, 0x6e, 0x26, 0x92, 0xe6, 0x79, 0xe4, 0xf4, 0x66, 0xd8, 0xe1, 0x0b,
+  0xb7, 0xfa, 0x72, 0x86, 0xf1, 0xa3, 0xb0, 0xb7, 0xd4, 0x18, 0x2f, 0x9c,
+  0xee, 0xd8, 0xcf, 0xe7, 0xbc, 0x54, 0x3f, 0x67, 0xbd, 0xf3, 0x02, 0x0d,
+  0xc2, 0x6e, 0x7f, 0x90, 0xeb, 0x6d, 0x6e, 0x77, 0xd1, 0x11, 0x88, 0xea,
+  0xee, 0x28, 0x57, 0x89, 0x1a, 0xb5, 0x00, 0xbc, 0x20, 0xc2, 0x63, 0xe7,
+  0x7c, 0x43, 0xbf, 0x3c, 0x3b, 0x82, 0x67, 0xdf, 0x1c, 0x5d, 0x1c, 0x9d,
+  0xb9, 0x6b, 0x7a, 0x52, 0xcc, 0xc6, 0x70, 0x73, 0xde, 0x02, 0x47, 0x29,
+  0xa7, 0xa3, 0xf4, 0x16, 0x75, 0x18, 0x60, 0x61, 0x97, 0x33, 0x12, 0x0b,
+  0xc8, 0xd6, 0x92, 0x0c, 0xe6, 0xa4, 0x9f, 0x14, 0x20, 0xe6, 0x32, 0x0f,
+  0x6e, 0xc3, 0xb2, 0x91, 0x48, 0xa0, 0x22, 0x18, 0xb5, 0x17, 0x9c, 0x51,
+  0xe6, 0xb1, 0x15, 0xf1, 0xaf, 0xed, 0xc4, 0x2a, 0xf2, 0x7f, 0x88, 0xdc,
+  0x09, 0x3c, 0x62, 0x4c, 0x72, 0x05, 0x9d, 0xb2, 0x51, 0x36, 0x04, 0xb5,
+  0x38, 0x81, 0x3d, 0xeb, 0x9a, 0x9f, 0x71, 0x61, 0x28, 0x3a, 0x4a, 0xe2,
+  0xbc, 0xd6, 0x2a, 0xf9, 0x2f, 0x50, 0x94, 0x60, 0xd5, 0x02, 0x05, 0x72,
+  0xd8, 0x00, 0x20, 0xac, 0x01, 0x19, 0xef, 0x32, 0xf1, 0x05, 0x0f, 0xc9,
+  0x43, 0x97, 0xac, 0x7f, 0x68, 0x27, 0x6f, 0xda, 0xc9, 0xcb, 0x76, 0x72,
+  0xd1, 0x4e, 0x4e, 0x37, 0x58, 0x09, 0xd9, 0xde, 0xda, 0x79, 0xcc, 0x5e,
+  0x3e, 0xf6, 0xe0, 0xa9, 0xb1, 0x6e, 0xfb, 0x03, 0x1e, 0x75, 0xfe, 0x16,
+  0x1b, 0x87, 0x06, 0xb7, 0xdf, 0xa8, 0x32, 0xbf, 0xbd, 0xf5, 0xf8, 0xe9,
+  0xde, 0xd7, 0x4f, 0xe4, 0x1b, 0x2f, 0xd5, 0x85, 0x71, 0xc2, 0x63, 0x2a,
+  0x02, 0xf3, 0xa0, 0x41, 0xd0, 0xc9, 0x27, 0x20, 0x4e, 0xf4, 0x6e, 0xd5,
+  0x50, 0x40, 0x3e, 0xa9, 0x9c, 0xfd, 0x9e, 0x6c, 0x03, 0xe5, 0x66, 0x54,
+  0x0a, 0x43, 0xdf, 0x13, 0x7a, 0x87, 0x74, 0x03, 0xf8, 0xd2, 0x42, 0xfa,
+  0x44, 0x07, 0x46, 0x8f, 0xfc, 0xa2, 0x28, 0xac, 0x91, 0xac, 0x62, 0xbd,
+  0x51, 0x77, 0xda, 0x5b, 0xdb, 0x6c, 0x10, 0x30, 0x34, 0x16, 0xfd, 0x69,
+  0x34, 0xf5, 0x05, 0x46, 0x3b, 0x55, 0x90, 0x3e, 0xc9, 0xd6, 0x54, 0xcc,
+  0xe1, 0xba, 0x84, 0xaf, 0xe1, 0x21, 0x90, 0xa2, 0xf8, 0x35, 0x27, 0x70,
+  0x8f, 0xd9, 0x2e, 0x65, 0x0d, 0x49, 0x3b, 0x30, 0x40, 0xf8, 0x73, 0x0a,
+  0xd4, 0x92, 0xd1, 0x88, 0x62, 0xef, 0x2e, 0x39, 0x37, 0xd3, 0xa4, 0xfe,
+  0x16, 0xdd, 0x8b, 0x74, 0xa1, 0x93, 0xc6, 0x04, 0x7f, 0x81, 0xde, 0xc1,
+  0x46, 0x26, 0x20, 0x96, 0x92, 0x8c, 0xbf, 0x24, 0x71, 0x9b, 0x61, 0x1d,
+  0x48, 0x8c, 0xae, 0x42, 0xd1, 0x39, 0xa4, 0x43, 0xd5, 0xcf, 0x0b, 0x51,
+  0x04, 0x55, 0x5d, 0x20, 0x6b, 0x6f, 0x78, 0x27, 0x59, 0xff, 0x7e, 0xa3,
+  0xbd, 0xa0, 0x3e, 0x88, 0x6c, 0xaf, 0x07, 0x97, 0x36, 0x50, 0xa5, 0x3d,
+  0x56, 0xa7, 0xa1, 0x5d, 0x3c, 0xbb, 0xc2, 0xe6, 0x70, 0xcd, 0xe8, 0xe8,
+  0x85, 0xfd, 0x09, 0xd2, 0xe1, 0x14, 0x96, 0x90, 0xfd, 0xd6, 0x93, 0x5b,
+  0x19, 0xb0, 0x5b, 0x14, 0x25, 0x0a, 0xdd, 0xa5, 0xba, 0x0b, 0x3c, 0xe3,
+  0x80, 0x8a, 0xb0, 0x49, 0x3d, 0x90, 0x81, 0x55, 0x47, 0x2a, 0x86, 0x32,
+  0xe9, 0x4b, 0x12, 0x8d, 0x69, 0x05, 0xdb, 0xe4, 0x98, 0x95, 0xc7, 0x3b,
+  0xf0, 0xb4, 0x52, 0x2a, 0xb4, 0x07, 0xcb, 0x0b, 0x02, 0x19, 0x1d, 0x09,
+  0xf5, 0x1c, 0x90, 0x45, 0x5b, 0x29, 0xa2, 0x46, 0x10, 0xbc, 0x23, 0x20,
+  0x0c, 0xc1, 0x29, 0x40, 0x01, 0xd6, 0x59, 0x89, 0x59, 0xe9, 0x2a, 0x61,
+  0x61, 0xf1, 0xbc, 0x93, 0x84, 0x84, 0xa6, 0xe9, 0xa3, 0xb3, 0x73, 0x0b,
+  0xe4, 0xa0, 0x65, 0x03, 0x31, 0x0a, 0x04, 0xd3, 0xcb, 0x4c, 0xdc, 0xfe,
+  0x3d, 0x3c, 0x9a, 0x74, 0x3c, 0x9e, 0x76, 0xb7, 0x9f, 0x80, 0x66, 0xa9,
+  0x13, 0x25, 0x5b, 0x18, 0xa8, 0x77, 0x29, 0xf6, 0x28, 0x57, 0x49, 0x9b,
+  0x2c, 0xeb, 0xe8, 0x1b, 0x60, 0xe6, 0x32, 0x63, 0xff, 0x55, 0x12, 0x1a,
+  0x75, 0xaa, 0x13, 0x9a, 0xfc, 0x6f, 0xf1, 0x83, 0x3e, 0x79, 0xf9, 0x12,
+  0xb2, 0xda, 0x43, 0xe3, 0xc1, 0x5d, 0x8d, 0xbc, 0x3e, 0x03, 0x85, 0x2d,
+  0xcf, 0x78, 0x49, 0xac, 0x17, 0x3e, 0xa0, 0xf6, 0x62, 0x45, 0x6e, 0x2d,
+  0x3c, 0x3d, 0xf9, 0xa4, 0x3f, 0x9a, 0x0f, 0x32, 0xbb, 0xda, 0xe0, 0x03,
+  0xf4, 0x9c, 0xf2, 0x06, 0xcb, 0xa1, 0x03, 0xb1, 0xa7, 0x7f, 0x15, 0xac,
+  0xfd, 0x43, 0x90, 0x84, 0xf4, 0x71, 0x66, 0xc6, 0x93, 0x6a, 0x56, 0x0c,
+  0xe6, 0x7d, 0x54, 0x9d, 0xae, 0xc8, 0x0b, 0x53, 0xf3, 0xe6, 0xa7, 0xa3,
+  0x1b, 0xe4, 0x12, 0x23, 0x18, 0xda, 0x84, 0x5b, 0xa3, 0xc5, 0xc5, 0x95,
+  0x28, 0x2b, 0x5e, 0x2b, 0x6d, 0x30, 0x27, 0x0b, 0xad, 0xe8, 0x0e, 0x7a,
+  0x95, 0xa8, 0xbe, 0x8f, 0x7f, 0x74, 0xcb, 0x6c, 0x13, 0xc7, 0x18, 0xa2,
+  0x34, 0x54, 0xcd, 0x09, 0x73, 0x60, 0x83, 0x8d, 0x2e, 0xa3, 0xac, 0x23,
+  0xfb, 0x36, 0x68, 0x20, 0x70, 0x42, 0x8a, 0x1b, 0x53, 0xac, 0x65, 0x1c,
+  0xa2, 0xa7, 0xf7, 0x61, 0x8c, 0x34, 0xfb, 0xfd, 0x85, 0x6e, 0x61, 0xfd,
+  0xca, 0x4d, 0x68, 0x11, 0xdb, 0x23, 0x0f, 0xd5, 0x57, 0x5f, 0x9d, 0x50,
+  0x54, 0x8f, 0x68, 0x84, 0x27, 0x22, 0x6c, 0xd3, 0xc5, 0x2b, 0xba, 0x06,
+  0x79, 0x93, 0xf1, 0xbc, 0x57, 0x37, 0x05, 0x39, 0x05, 0x88, 0xb7, 0xbe,
+  0xa1, 0x48, 0x80, 0xa1, 0x37, 0xe3, 0x97, 0xc1, 0xca, 0x9c, 0x88, 0xdd,
+  0x38, 0x1d, 0x0c, 0x72, 0x52, 0xdc, 0x46, 0x6a, 0x30, 0x26, 0x6f, 0x9b,
+  0x30, 0xbd, 0x31, 0xef, 0xbd, 0xf9, 0x8f, 0x2b, 0xf2, 0xc4, 0xd9, 0x99,
+  0x94, 0x51, 0x78, 0x1b, 0xfa, 0x80, 0xcc, 0xe7, 0x6c, 0x6c, 0x86, 0x53,
+  0x87, 0xce, 0xe1, 0x81, 0xd8, 0xad, 0xcd, 0x33, 0x8c, 0xc6, 0x1e, 0x71,
+  0x17, 0x77, 0xc3, 0x12, 0xc3, 0x7a, 0x41, 0x5b, 0x2d, 0xf6, 0x6d, 0x74,
+  0xb0, 0x9d, 0x16, 0x72, 0xb1, 0x71, 0xa2, 0xc7, 0x53, 0xe6, 0x00, 0x6c,
+  0x66, 0x90, 0x78, 0x2f, 0x50, 0x9b, 0xb4, 0x58, 0xf4, 0x96, 0xcc, 0x35,
+  0xb2, 0xa4, 0x2e, 0xb9, 0x63, 0x68, 0x13, 0x59, 0x21, 0xd5, 0x55, 0x9f,
+  0x57, 0xca, 0xf9, 0x4b, 0x9e, 0x77, 0x1b, 0xf6, 0x0d, 0x9f, 0xbd, 0xbc,
+  0xa2, 0x80, 0x00, 0x7a, 0x38, 0x37, 0x4f, 0x03, 0xf0, 0x38, 0x50, 0x65,
+  0x32, 0x32, 0xa2, 0x89, 0x21, 0xaf, 0x98, 0x75, 0x85, 0x34, 0x46, 0x05,
+  0xee, 0x32, 0xbb, 0xc6, 0x68, 0xdc, 0x34, 0x6c, 0xe2, 0x1f, 0x12, 0x63,
+  0xe5, 0xc3, 0x58, 0xa4, 0x3d, 0xda, 0x85, 0xd2, 0xba, 0x72, 0xe3, 0x8a,
+  0x86, 0xa5, 0xc2, 0x1e, 0xad, 0x8d, 0xd2, 0x9e, 0x6e, 0x26, 0xdb, 0xd3,
+  0xe0, 0x4a, 0xc3, 0xbd, 0x20, 0x5e, 0xce, 0xa1, 0x2c, 0xb5, 0x2d, 0x35,
+  0x37, 0x50, 0x58, 0x1f, 0xb2, 0xb8, 0x81, 0x1a, 0x98, 0x91, 0xd9, 0x85,
+  0xf7, 0x9b, 0x1c, 0xab, 0x7c, 0x63, 0x35, 0x78, 0xda, 0xcc, 0x3d, 0x6b,
+  0x2e, 0x52, 0x0a, 0x84, 0x12, 0x81, 0x40, 0x47, 0xd4, 0x39, 0x81, 0xdd,
+  0xe1, 0x18, 0x80, 0xce, 0x75, 0x82, 0x8c, 0x1c, 0xd8, 0x0e, 0x6e, 0x76,
+  0xe7, 0xe4, 0xf5, 0xb5, 0xb2, 0xe4, 0x09, 0x28, 0x14, 0x13, 0xf4, 0xee,
+  0xb6, 0xb9, 0x91, 0x5e, 0x51, 0xc0, 0xa9, 0x0d, 0xd3, 0x22, 0x21, 0x22,
+  0x9b, 0x20, 0x23, 0x55, 0x37, 0x13, 0x5c, 0x2c, 0xec, 0x87, 0xc2, 0x96,
+  0x6f, 0xd1, 0xa6, 0x9d, 0x5e, 0xa6, 0xe2, 0x18, 0x13, 0x9e, 0x1b, 0x1e,
+  0x9d, 0x14, 0xf2, 0x34, 0x6d, 0x10, 0xc5, 0x36, 0xb4, 0x1d, 0xff, 0x62,
+  0x87, 0x50, 0xb0, 0x67, 0x89, 0x97, 0x09, 0x8d, 0x0a, 0xe2, 0x49, 0x41,
+  0x07, 0x51, 0xb0, 0x01, 0x43, 0x73, 0x68, 0x01, 0x7e, 0x55, 0xdc, 0xa0,
+  0xea, 0xde, 0x66, 0x9f, 0x52, 0x5e, 0x4a, 0xa0, 0x00, 0x6a, 0xad, 0xa0,
+  0xa1, 0xc1, 0x3a, 0x52, 0xc4, 0x09, 0x7d, 0x48, 0x96, 0x4c, 0x3c, 0xfe,
+  0x8e, 0xc5, 0x4b, 0x5f, 0xb6, 0x85, 0x43, 0x6f, 0xbe, 0x22, 0x83, 0x3e,
+  0x0c, 0x1c, 0x77, 0x22, 0x2f, 0x69, 0x9b, 0xda, 0x2c, 0x24, 0x97, 0xea,
+  0x4c, 0x23, 0x8b, 0xd6, 0x0c, 0x0f, 0x5c, 0xc5, 0x27, 0x09, 0xe7, 0xc3,
+  0xc7, 0x8f, 0x96, 0x42, 0xcd, 0x0e, 0x2c, 0x38, 0xb9, 0xf5, 0xe4, 0x57,
+  0xda, 0xb0, 0x91, 0xfd, 0x6c, 0x5a, 0x99, 0x27, 0x3b, 0xa2, 0x21, 0x5c,
+  0x71, 0x74, 0x8c, 0xc2, 0xb5, 0x99, 0x24, 0x2f, 0xe9, 0x17, 0x7d, 0x40,
+  0xc8, 0xb5, 0x4a, 0xd9, 0x95, 0x96, 0xcf, 0x94, 0xa6, 0x70, 0x0c, 0xa8,
+  0x53, 0x20, 0x8b, 0xcb, 0xd0, 0x02, 0x08, 0x8a, 0x4f, 0x36, 0x93, 0x59,
+  0x84, 0xdb, 0x97, 0x78, 0x30, 0x1d, 0x10, 0xef, 0x49, 0x24, 0x89, 0x3e,
+  0x44, 0xbc, 0xb0, 0x66, 0x8b, 0x51, 0x2e, 0x20, 0x48, 0xb4, 0xbe, 0x6b,
+  0x6d, 0xb4, 0x39, 0xe2, 0x40, 0x42, 0x4d, 0xcc, 0xab, 0xc2, 0x17, 0xfc,
+  0x47, 0x9c, 0xc5, 0x68, 0xc4, 0xdc, 0x15, 0xd9, 0x39, 0x2c, 0x11, 0x9b,
+  0xd2, 0xd1, 0x92, 0xde, 0x4d, 0xd6, 0x0f, 0x82, 0xd5, 0x15, 0x2f, 0xc7,
+  0x8d, 0xc0, 0x63, 0xd8, 0x29, 0x17, 0xda, 0xd5, 0xd0, 0x17, 0x24, 0xf3,
+  0x3e, 0x6e, 0x22, 0x72, 0x50, 0x61, 0xa1, 0x30, 0x92, 0x4e, 0x07, 0x87,
+  0x02, 0x9a, 0xe9, 0x07, 0xb1, 0xf9, 0x64, 0xb8, 0xb3, 0xe2, 0xcd, 0x94,
+  0x05, 0xfa, 0x96, 0x0e, 0x5d, 0x68, 0x92, 0x97, 0x41, 0x9c, 0x78, 0x24,
+  0x5a, 0xd8, 0x5a, 0x63, 0xf4, 0x12, 0x2a, 0x49, 0x40, 0x61, 0xe4, 0x07,
+  0x60, 0x37, 0x07, 0xda, 0xb6, 0xf8, 0x5e, 0x96, 0x26, 0x68, 0x35, 0x41,
+  0x86, 0x45, 0xe3, 0x28, 0xab, 0x57, 0x62, 0x51, 0xc2, 0x71, 0x2d, 0x1a,
+  0x3c, 0x47, 0x79, 0x55, 0x89, 0x73, 0x10, 0xad, 0x93, 0x40, 0x61, 0x78,
+  0x7b, 0x8a, 0x74, 0xab, 0xfc, 0x3f, 0x32, 0xe9, 0x9b, 0x5d, 0x86, 0x0c,
+  0x33, 0x51, 0xe7, 0x78, 0x71, 0x9c, 0xa6, 0x62, 0x7d, 0x23, 0xbf, 0x60,
+  0x1f, 0x39, 0x36, 0xd9, 0xce, 0x8a, 0x7e, 0x05, 0xd4, 0xd8, 0x4a, 0x98,
+  0x39, 0x00, 0xdf, 0xb8, 0xc1, 0xd7, 0xf1, 0x02, 0x64, 0x3f, 0x06, 0x5c,
+  0xf8, 0x97, 0x97, 0x22, 0x14, 0xcc, 0x81, 0x0a, 0x80, 0x51, 0xe0, 0x34,
+  0xf1, 0x12, 0x18, 0x55, 0xa5, 0xe3, 0xf4, 0x89, 0xdb, 0x3f, 0xc7, 0x3c,
+  0x44, 0x36, 0xc1, 0x50, 0x32, 0x22, 0xc1, 0x7d, 0x76, 0xa3, 0xa3, 0x7f,
+  0xad, 0x83, 0x02, 0xc7, 0x6d, 0x9b, 0x3f, 0x90, 0xb8, 0xca, 0xb6, 0xb8,
+  0xd9, 0x35, 0x78, 0xae, 0x63, 0x4c, 0xad, 0x1d, 0x7d, 0x3c, 0x4e, 0x3f,
+  0x76, 0x30, 0x6c, 0xb0, 0x9d, 0xd4, 0x3f, 0x8e, 0x3f, 0xb1, 0xf6, 0x9c,
+  0xcc, 0xc7, 0x4f, 0xcc, 0xb8, 0x4d, 0xfc, 0x15, 0x4f, 0x75, 0x87, 0x9c,
+  0x27, 0xfa, 0x41, 0x35, 0x80, 0x3f, 0xed, 0x8f, 0x5b, 0x60, 0x44, 0x22,
+  0x04, 0x6b, 0x7b, 0x15, 0x86, 0x26, 0x75, 0xd2, 0xb2, 0x9f, 0xe7, 0xed,
+  0xf0, 0x37, 0x6c, 0xc8, 0x30, 0xbf, 0x74, 0x1f, 0xe4, 0x83, 0xd2, 0xfd,
+  0x85, 0x6a, 0x5c, 0xf8, 0x33, 0x09, 0xbe, 0xb5, 0x4e, 0x07, 0xbd, 0xdb,
+  0x45, 0x89, 0x37, 0xc3, 0xc1, 0xeb, 0xd7, 0x49, 0x24, 0x1c, 0x74, 0x3a,
+  0x69, 0xaf, 0xc4, 0x37, 0xaa, 0xce, 0x7c, 0x92, 0x7f, 0xec, 0x94, 0xac,
+  0xeb, 0x3e, 0x43, 0x93, 0xe6, 0xf7, 0x5f, 0x3d, 0xc2, 0x47, 0xd6, 0x51,
+  0x27, 0xd8, 0xd0, 0xa0, 0x39, 0x0b, 0xf0, 0x41, 0x01, 0x4a, 0x5e, 0x05,
+  0x8a, 0x84, 0x77, 0x81, 0xb8, 0xc6, 0x78, 0xe6, 0xb9, 0x89, 0xb6, 0x89,
+  0xca, 0x48, 0xfd, 0xd4, 0x50, 0xb0, 0xad, 0x02, 0x25, 0x54, 0xa8, 0x28,
+  0x77, 0x93, 0xb7, 0x45, 0x95, 0xed, 0xd3, 0xdf, 0xc8, 0x74, 0x88, 0x05,
+  0xca, 0xc1, 0xc1, 0x11, 0xb0, 0x3b, 0x09, 0x55, 0x2e, 0xe9, 0x89, 0x1b,
+  0x92, 0x41, 0xd6, 0x03, 0x0b, 0x7e, 0x68, 0xb5, 0x93, 0x2b, 0xe6, 0xb9,
+  0xdc, 0x0b, 0xcf, 0x22, 0x1c, 0x13, 0x68, 0x9d, 0xd4, 0x29, 0xb8, 0xfc,
+  0xb8, 0x21, 0x8e, 0x5e, 0x21, 0xd6, 0x2c, 0x26, 0x44, 0x0b, 0x28, 0x21,
+  0x31, 0x66, 0xc9, 0xea, 0x48, 0xd4, 0x2d, 0x09, 0x38, 0x32, 0x22, 0x09,
+  0x3e, 0xc2, 0x4d, 0x28, 0xdb, 0x22, 0x46, 0x96, 0xe4, 0xd0, 0x55, 0x47,
+  0x34, 0x33, 0x69, 0xd8, 0x83, 0x47, 0xde, 0x83, 0xc6, 0x7f, 0x49, 0x1c,
+  0x77, 0x73, 0x6f, 0xfc, 0x0f, 0x2d, 0x47, 0x83, 0x87, 0x49, 0xda, 0x3b,
+  0xcf, 0x32, 0x56, 0x28, 0x3a, 0xfe, 0xdd, 0xae, 0x6d, 0xf2, 0xa8, 0xea,
+  0x94, 0xd7, 0xfd, 0xe4, 0x19, 0x2a, 0x64, 0xc8, 0x4f, 0xfd, 0xde, 0x9e,
+  0x6f, 0x24, 0x47, 0x93, 0xa0, 0x84, 0xe8, 0xb3, 0x7c, 0x7f, 0x74, 0x8d,
+  0x27, 0xeb, 0xab, 0x18, 0xec, 0x9c, 0x8b, 0xc9, 0x08, 0x65, 0xc2, 0x47,
+  0xec, 0x30, 0xcc, 0xd9, 0xe8, 0xa8, 0x6f, 0xc3, 0xcd, 0xdf, 0x97, 0x97,
+  0xda, 0xc2, 0x35, 0xd9, 0x5f, 0x42, 0xab, 0x90, 0x1c, 0x10, 0xcf, 0x43,
+  0x66, 0xa6, 0x4a, 0x8e, 0xac, 0xa4, 0x9a, 0x15, 0x78, 0x11, 0xb9, 0x11,
+  0x58, 0x3b, 0x74, 0xe1, 0x0c, 0x4c, 0xb1, 0xb6, 0xa1, 0xf0, 0x45, 0xc6,
+  0x9c, 0xef, 0x0a, 0xd5, 0xe7, 0x1e, 0x88, 0x44, 0xdc, 0xd0, 0xb8, 0x18,
+  0x50, 0xc4, 0xa6, 0xae, 0xf8, 0xb9, 0x05, 0x6a, 0xb5, 0x5a, 0x49, 0x68,
+  0x61, 0x1d, 0xc3, 0xde, 0x30, 0xfc, 0x6a, 0x72, 0x59, 0x5d, 0x6d, 0xf0,
+  0x9c, 0x28, 0x42, 0x49, 0xad, 0xa9, 0xd0, 0xb3, 0xb9, 0xaa, 0xb9, 0x61,
+  0x74, 0x4f, 0xd2, 0x86, 0xfd, 0x36, 0x2f, 0x2b, 0x0a, 0x37, 0x95, 0xa5,
+  0x93, 0xd1, 0x4e, 0xe0, 0x96, 0x1b, 0x17, 0xb3, 0x5b, 0xed, 0x99, 0xd6,
+  0x0f, 0xe6, 0x20, 0xd7, 0x99, 0x50, 0x42, 0x9d, 0x66, 0xa8, 0x45, 0xb6,
+  0x46, 0x05, 0xd6, 0xcb, 0x06, 0xd6, 0xd1, 0x48, 0xd6, 0x46, 0xa6, 0x5e,
+  0x92, 0x3b, 0x23, 0x50, 0x19, 0xc7, 0x86, 0x4a, 0xb3, 0x24, 0x3a, 0xf2,
+  0xa0, 0xbb, 0x6e, 0xe7, 0xd5, 0xed, 0x27, 0x27, 0xb1, 0xde, 0x3f, 0x87,
+  0x24, 0x7b, 0xeb, 0xfb, 0xdd, 0x84, 0x2a, 0xad, 0xc2, 0x7f, 0x18, 0x65,
+  0x76, 0x07, 0x61, 0xda, 0xcd, 0xfa, 0x75, 0xf7, 0xc9, 0xe3, 0xee, 0x76,
+  0xd7, 0x53, 0x2a, 0xf0, 0xcc, 0x62, 0x74, 0xcd, 0xc2, 0x49, 0xa7, 0x23,
+  0xf1, 0xbc, 0x9d, 0xaa, 0x08, 0x64, 0x3b, 0xb9, 0x4d, 0xe7, 0xa0, 0xf7,
+  0x7a, 0x3e, 0xf4, 0x22, 0xbf, 0x44, 0xcf, 0x30, 0xc9, 0xe8, 0x73, 0x0c,
+  0x22, 0xaf, 0xf4, 0xea, 0xe2, 0x88, 0x07, 0xfc, 0xb4, 0x40, 0x4d, 0x11,
+  0x9d, 0xca, 0x70, 0x01, 0x90, 0x69, 0x4f, 0xa4, 0x38, 0xa5, 0x0c, 0x3a,
+  0x99, 0x7d, 0x6a, 0x66, 0x92, 0x89, 0x22, 0x8f, 0x9e, 0xa2, 0x04, 0xa3,
+  0x32, 0x41, 0x16, 0x4a, 0xf3, 0x31, 0x91, 0xb7, 0x98, 0x59, 0x35, 0x8e,
+  0xb8, 0xe4, 0xd8, 0x60, 0x50, 0x05, 0xb9, 0x21, 0x96, 0x0d, 0x38, 0xd8,
+  0x19, 0x49, 0x59, 0x4c, 0x25, 0x12, 0xfb, 0x7b, 0x95, 0xf5, 0x3f, 0x04,
+  0x6d, 0x4e, 0x4d, 0x0f, 0x9d, 0x2b, 0xe0, 0x34, 0x14, 0x0a, 0x0d, 0x9f,
+  0xcf, 0x4b, 0x6e, 0x68, 0x5a, 0xc0, 0xfd, 0x89, 0xe1, 0x74, 0xf9, 0x04,
+  0x14, 0x56, 0x35, 0xb6, 0x7e, 0x84, 0xb3, 0xa0, 0x9c, 0x32, 0x01, 0xa6,
+  0x3b, 0x19, 0x00, 0x6f, 0xcf, 0xa7, 0x32, 0x9a, 0x40, 0x4d, 0x2c, 0xa4,
+  0x3f, 0x52, 0x87, 0xae, 0x98, 0x27, 0x4a, 0x35, 0xc1, 0x07, 0xf5, 0xb8,
+  0x71, 0xbd, 0xda, 0xa2, 0xfa, 0x5a, 0x6c, 0x10, 0x35, 0x34, 0x28, 0x34,
+  0xfc, 0xad, 0x97, 0x96, 0x79, 0x1f, 0x0d, 0x35, 0x83, 0x1c, 0x54, 0xe8,
+  0x0a, 0x7f, 0x9b, 0x54, 0xa3, 0x71, 0x5b, 0x76, 0x6d, 0x92, 0x5d, 0x16,
+  0x15, 0x5e, 0xa1, 0x4a, 0xed, 0xec, 0x9c, 0xb1, 0xbd, 0x53, 0xb7, 0x42,
+  0xa4, 0x10, 0x89, 0xb9, 0x0d, 0x7b, 0x11, 0xab, 0xab, 0x04, 0x7e, 0x93,
+  0x69, 0xb7, 0x2d, 0x3c, 0x35, 0x47, 0x4d, 0x00, 0x0e, 0x36, 0xea, 0x6a,
+  0xa6, 0x85, 0xb2, 0x7e, 0xc4, 0xea, 0x21, 0xbb, 0xf8, 0xab, 0x9b, 0xbc,
+  0xcf, 0x34, 0xc4, 0x39, 0x05, 0xec, 0xa7, 0x1d, 0x61, 0xfc, 0x89, 0xec,
+  0x37, 0x1e, 0x53, 0xd4, 0x26, 0x35, 0x22, 0x6a, 0x96, 0x81, 0x20, 0x31,
+  0x60, 0x45, 0x95, 0x5c, 0x7d, 0x64, 0xd4, 0x92, 0xdb, 0x21, 0x9d, 0xa1,
+  0xf1, 0x8d, 0x7c, 0x85, 0xc1, 0xa7, 0x22, 0xfb, 0x8d, 0x63, 0xe4, 0x21,
+  0xd2, 0x7b, 0x62, 0x83, 0x0a, 0xa6, 0xa7, 0xa1, 0xa4, 0x6b, 0xc8, 0x42,
+  0x10, 0xc7, 0x02, 0xae, 0x87, 0xc1, 0x5a, 0xb2, 0x9a, 0x73, 0x64, 0xa9,
+  0x77, 0x1f, 0x2d, 0x59, 0x37, 0x7e, 0x16, 0x36, 0x69, 0x7f, 0x7a, 0x33,
+  0x58, 0x8d, 0xf3, 0xc3, 0x9d, 0xf4, 0xf1, 0x56, 0x1b, 0x68, 0xeb, 0xde,
+  0xc9, 0x46, 0xf1, 0xf6, 0xe9, 0xd1, 0x4a, 0xf1, 0xeb, 0x74, 0x8a, 0x9e,
+  0x39, 0x39, 0x5d, 0x68, 0x54, 0x43, 0x8f, 0xc4, 0x86, 0x06, 0x8b, 0x66,
+  0x9a, 0x1d, 0x20, 0xf3, 0x6c, 0x27, 0x11, 0x1b, 0x43, 0x36, 0x58, 0x8a,
+  0x9f, 0xcd, 0x37, 0xa4, 0x56, 0x35, 0xb8, 0x75, 0xe1, 0xf2, 0xe2, 0x48,
+  0x10, 0x47, 0x96, 0x68, 0x19, 0xd7, 0xa0, 0x6c, 0xb5, 0x14, 0xb9, 0x03,
+  0x48, 0x2f, 0x28, 0x09, 0xfa, 0x20, 0xbe, 0xb6, 0x9a, 0x5c, 0xfb, 0x6c,
+  0x0f, 0x60, 0xd1, 0xc1, 0x02, 0x44, 0xe0, 0x8b, 0xe1, 0x28, 0xbd, 0x24,
+  0x81, 0xf9, 0x72, 0x52, 0x48, 0x2a, 0x8e, 0x8a, 0x0b, 0xc0, 0xe7, 0xc9,
+  0xd9, 0xc2, 0xee, 0x01, 0x90, 0xd3, 0xd9, 0xbe, 0x84, 0x63, 0x38, 0x81,
+  0x91, 0x9f, 0x9f, 0xbf, 0xda, 0xe8, 0x4a, 0x40, 0xb7, 0x10, 0x2f, 0x4d,
+  0x28, 0x44, 0x16, 0xc8, 0xd4, 0x88, 0x53, 0xe2, 0x3d, 0x83, 0x3e, 0x7d,
+  0x3a, 0x9e, 0xd9, 0x70, 0x08, 0x3c, 0xab, 0x9b, 0x3c, 0x17, 0x33, 0x5e,
+  0xae, 0xca, 0x95, 0xec, 0x37, 0xa8, 0x82, 0xdc, 0xd6, 0xdd, 0x9b, 0xce,
+  0x2b, 0xdc, 0xa1, 0xd5, 0x62, 0x7f, 0xb7, 0x8d, 0x61, 0xb8, 0x10, 0xe2,
+  0xbb, 0xb8, 0xf1, 0x14, 0x64, 0x1c, 0xd8, 0x28, 0x2c, 0xee, 0x1c, 0xe4,
+  0x47, 0x77, 0xfd, 0xdf, 0x94, 0x1d, 0xd0, 0x95, 0xae, 0x1f, 0x83, 0x48,
+  0xc4, 0x72, 0xcb, 0x6c, 0xfb, 0x6f, 0xfb, 0xd3, 0xd9, 0xf5, 0x60, 0xb6,
+  0xf3, 0xb7, 0xfd, 0x59, 0x76, 0xf9, 0xb7, 0xfd, 0x72, 0x76, 0xfd, 0xeb,
+  0xaf, 0xbf, 0xc6, 0x22, 0x1f, 0x50, 0x70, 0x72, 0xf0, 0xf3, 0x79, 0xf2,
+  0xd3, 0x63, 0xd2, 0xb4, 0x28, 0x5f, 0xa9, 0xce, 0x44, 0x24, 0x5e, 0x52,
+  0xaf, 0x6d, 0x9d, 0xa6, 0xf8, 0x0f, 0xa8, 0xab, 0x48, 0x2b, 0xa3, 0x40,
+  0xe9, 0x99, 0xf0, 0x45, 0x51, 0xa5, 0x88, 0xd6, 0x7a, 0xb7, 0x2a, 0x7e,
+  0x5c, 0x16, 0x40, 0x1f, 0x57, 0x63, 0x6e, 0x88, 0x0e, 0x22, 0x6b, 0x14,
+  0xa8, 0xbb, 0xcd, 0xab, 0x4b, 0x62, 0xb7, 0xb5, 0x51, 0x08, 0x53, 0xf5,
+  0xbd, 0xc3, 0xac, 0x48, 0xfd, 0xd7, 0xbe, 0xc9, 0x34, 0xa3, 0x7d, 0x33,
+  0xd9, 0x04, 0x39, 0x26, 0x05, 0xe1, 0x04, 0x64, 0xf8, 0x74, 0x0a, 0xac,
+  0x90, 0x74, 0x8a, 0x94, 0x1b, 0xa2, 0x68, 0x26, 0xbc, 0xa6, 0xe6, 0xb3,
+  0x3e, 0x19, 0x50, 0x41, 0x0b, 0x91, 0xcc, 0x91, 0x75, 0xee, 0xa0, 0x83,
+  0x51, 0x47, 0x1b, 0x32, 0x4e, 0xe1, 0xf4, 0x97, 0x3e, 0xfe, 0x55, 0x1a,
+  0x1a, 0x83, 0xce, 0xa5, 0xd1, 0xd5, 0xa2, 0x17, 0x52, 0xf7, 0x7e, 0xc8,
+  0x44, 0x9f, 0xc4, 0xcc, 0xfc, 0x82, 0x91, 0x29, 0xca, 0x2f, 0x99, 0x8e,
+  0x9b, 0x85, 0x95, 0xc4, 0x02, 0xcc, 0xe4, 0x2e, 0x51, 0xcb, 0x1b, 0x86,
+  0x94, 0xa2, 0x7c, 0x35, 0x2a, 0xe6, 0x40, 0xc9, 0xeb, 0xd2, 0x76, 0x34,
+  0x5e, 0xb1, 0x6c, 0x48, 0xaf, 0x77, 0x0d, 0xd9, 0xd4, 0x53, 0x1e, 0x74,
+  0x22, 0xd2, 0xb1, 0xd1, 0x55, 0x24, 0x13, 0x9b, 0x3c, 0xec, 0x8e, 0xcd,
+  0xef, 0x10, 0x8a, 0xad, 0x93, 0x16, 0xfc, 0xba, 0x9f, 0x8e, 0xff, 0xb1,
+  0x3f, 0x2f, 0x41, 0xbd, 0x2b, 0xab, 0xce, 0xce, 0x7e, 0x06, 0xda, 0xa5,
+  0x70, 0xca, 0xd6, 0x87, 0xec, 0x76, 0x9f, 0xa3, 0xb5, 0x5a, 0xc9, 0x2f,
+  0x5f, 0x3d, 0x82, 0x46, 0x56, 0x12, 0x4b, 0xbe, 0xde, 0x43, 0x6b, 0xb8,
+  0x3b, 0x4d, 0x9e, 0x6b, 0x0a, 0xbf, 0xe6, 0x63, 0x44, 0x5f, 0x2c, 0x9c,
+  0x10, 0x72, 0x99, 0x24, 0x3f, 0xf2, 0x4b, 0x31, 0x59, 0x6a, 0x56, 0x08,
+  0x51, 0x05, 0xf1, 0x37, 0x54, 0x2b, 0x25, 0xa6, 0x5d, 0x2e, 0x27, 0x16,
+  0x5a, 0x72, 0xb6, 0xd9, 0x68, 0xf0, 0x2a, 0xc7, 0x45, 0xd4, 0x64, 0xc6,
+  0x39, 0xf9, 0x0a, 0x69, 0x03, 0x30, 0x70, 0xa8, 0x9d, 0x48, 0x04, 0x11,
+  0x37, 0x64, 0xd6, 0xaa, 0x9c, 0x1d, 0x52, 0xc4, 0x69, 0x67, 0x92, 0xc5,
+  0x87, 0xba, 0xd2, 0x75, 0x5e, 0xcc, 0xcb, 0xd1, 0xad, 0x04, 0x78, 0x8a,
+  0x21, 0x8b, 0x09, 0x8a, 0x6c, 0x46, 0x89, 0xd0, 0x7c, 0x48, 0x5f, 0xa9,
+  0xcf, 0x46, 0xc6, 0x0a, 0xb4, 0x34, 0x47, 0xc3, 0x1f, 0xca, 0xdb, 0x2a,
+  0x0c, 0x38, 0xf9, 0x80, 0x1c, 0xc3, 0xbc, 0x60, 0x26, 0x1c, 0x6c, 0xdc,
+  0x7f, 0x29, 0x46, 0xfc, 0x97, 0xb7, 0x20, 0x24, 0x90, 0x19, 0xe3, 0x05,
+  0xce, 0xab, 0x0a, 0xc7, 0x8a, 0xec, 0x97, 0x9a, 0xba, 0x93, 0xc2, 0xe6,
+  0x44, 0xf8, 0xfb, 0xd3, 0xb4, 0x2c, 0x31, 0x4c, 0xc9, 0xba, 0xff, 0x84,
+  0x3b, 0x57, 0x3b, 0xe1, 0x69, 0xf7, 0xd3, 0x0e, 0x47, 0x0f, 0x09, 0xad,
+  0x5c, 0xbc, 0x3e, 0x67, 0x52, 0x61, 0xf7, 0x1d, 0x8b, 0x0b, 0xe8, 0x11,
+  0xbb, 0x85, 0x6b, 0x71, 0xbc, 0x56, 0x5a, 0xac, 0xd1, 0xe1, 0x01, 0x9c,
+  0x74, 0x8c, 0xa1, 0x25, 0x21, 0xbe, 0x9f, 0xcd, 0x2a, 0x36, 0xcc, 0x48,
+  0x43, 0xde, 0x50, 0x13, 0xf8, 0x46, 0x2c, 0x0b, 0x82, 0x60, 0xa3, 0x69,
+  0xa0, 0x74, 0xdd, 0x72, 0xa4, 0x38, 0x34, 0xec, 0x5a, 0xa3, 0x2b, 0x46,
+  0x2c, 0x28, 0x65, 0x26, 0x52, 0x12, 0xd2, 0xc1, 0x6c, 0x3e, 0x61, 0x77,
+  0x30, 0xf9, 0x06, 0x38, 0x56, 0x87, 0x3e, 0x20, 0x92, 0x2d, 0x4a, 0x32,
+  0x5d, 0xdb, 0xab, 0x64, 0x7a, 0x29, 0x33, 0x4c, 0x9e, 0x61, 0x59, 0x41,
+  0x1a, 0x12, 0x63, 0xb2, 0x4a, 0x02, 0x32, 0x39, 0x9d, 0x5b, 0xd3, 0xc0,
+  0xd9, 0x69, 0x4e, 0x7b, 0xc6, 0xf7, 0xf1, 0x6b, 0xb3, 0x69, 0x0f, 0xe9,
+  0xab, 0xf5, 0xd7, 0x79, 0x6f, 0x96, 0xc1, 0xe7, 0x40, 0x5e, 0x3f, 0x16,
+  0xc8, 0x0b, 0xf1, 0x77, 0xa1, 0x84, 0xaa, 0xbf, 0x81, 0x46, 0x3d, 0x89,
+  0xe1, 0xf2, 0xd6, 0x3c, 0x38, 0xdc, 0xdb, 0x64, 0xcd, 0xbb, 0xab, 0xc7,
+  0x9b, 0x62, 0x34, 0xc4, 0x1e, 0x5d, 0x1b, 0xed, 0xe4, 0x35, 0x5c, 0xa1,
+  0x1f, 0x93, 0xf5, 0xe7, 0x59, 0x2f, 0x4f, 0xd1, 0x1d, 0xf6, 0xae, 0x37,
+  0x9f, 0x54, 0x73, 0xe9, 0xf1, 0x25, 0x2c, 0x6e, 0x51, 0xb4, 0x93, 0x17,
+  0xd9, 0xa0, 0x98, 0x81, 0x24, 0x75, 0xf6, 0xea, 0xe8, 0x35, 0x59, 0xfd,
+  0xfa, 0x27, 0xe7, 0xed, 0xe4, 0x60, 0x32, 0x98, 0xa1, 0x02, 0x49, 0x33,
+  0x38, 0x39, 0x8f, 0xad, 0x8b, 0xbb, 0xf7, 0x0e, 0xe7, 0xe5, 0x64, 0x8e,
+  0xd1, 0x14, 0xd1, 0x5b, 0x7b, 0xf7, 0xbe, 0x35, 0x03, 0x19, 0x17, 0x63,
+  0x84, 0xfc, 0x1c, 0x1a, 0xc6, 0x43, 0x03, 0xe2, 0x86, 0x4e, 0x26, 0x32,
+  0x49, 0x8d, 0xf3, 0x47, 0x01, 0x1b, 0xd8, 0x32, 0x5b, 0x39, 0x0b, 0x1f,
+  0xe3, 0xf9, 0xa6, 0xf8, 0x47, 0x3e, 0x1a, 0xa5, 0x44, 0x46, 0x8b, 0x54,
+  0x09, 0x2b, 0x33, 0xc0, 0xc8, 0xe3, 0x9f, 0x59, 0x64, 0x26, 0xb9, 0x91,
+  0x2d, 0x32, 0x3a, 0xa8, 0xf7, 0x68, 0xe8, 0x7e, 0xaf, 0xf9, 0x19, 0x46,
+  0xea, 0x42, 0xeb, 0x76, 0xe1, 0x80, 0xe4, 0x82, 0x76, 0x3f, 0xb4, 0x64,
+  0x93, 0xc6, 0xc0, 0xb4, 0x1b, 0xd3, 0x2a, 0xd1, 0x29, 0x92, 0x29, 0xd3,
+  0x69, 0x9d, 0x4c, 0xe5, 0xc0, 0x79, 0x73, 0xee, 0x92, 0x15, 0xc7, 0xb3,
+  0x8f, 0x4c, 0x8e, 0x72, 0x98, 0x88, 0xaf, 0x24, 0xc2, 0x4d, 0xf8, 0xf0,
+  0x9d, 0xa3, 0xcf, 0x70, 0x92, 0x8d, 0x34, 0x47, 0x25, 0x2f, 0x9d, 0x06,
+  0x29, 0x93, 0xc0, 0xa8, 0xa9, 0x11, 0x10, 0x66, 0x3a, 0xbb, 0xe5, 0x5b,
+  0xd2, 0x02, 0x0a, 0xdb, 0xcc, 0x58, 0x43, 0x94, 0x41, 0x42, 0x61, 0xd4,
+  0x6e, 0x05, 0xb8, 0xa1, 0xf8, 0xc0, 0x47, 0x86, 0x58, 0x8d, 0x0e, 0x15,
+  0x36, 0x0e, 0x07, 0x5a, 0x6e, 0xf4, 0xc6, 0x4d, 0xd0, 0x55, 0x52, 0xb5,
+  0xaf, 0x9b, 0x38, 0x7e, 0xea, 0x59, 0x92, 0x8b, 0x96, 0x15, 0xb6, 0xfa,
+  0x99, 0x7c, 0xd5, 0x5a, 0xbc, 0xfb, 0xf6, 0x0e, 0x1d, 0xaf, 0x70, 0x19,
+  0xc3, 0x7e, 0xed, 0xe0, 0x65, 0x4c, 0x0c, 0x56, 0x1c, 0xe4, 0xd8, 0x04,
+  0x4e, 0xb7, 0xcd, 0xbf, 0xa2, 0x1d, 0x8c, 0xaf, 0x9b, 0xf9, 0x78, 0x8a,
+  0xad, 0x67, 0xe3, 0x1e, 0x50, 0x8c, 0xde, 0x38, 0x98, 0x1c, 0x44, 0x8a,
+  0x3d, 0x5f, 0xdf, 0xcc, 0x9d, 0xfd, 0x50, 0x95, 0x43, 0x63, 0x93, 0x6c,
+  0x0e, 0xfb, 0xbe, 0x89, 0x4b, 0xbb, 0x14, 0x6c, 0xcf, 0x38, 0x49, 0x40,
+  0xc7, 0xcb, 0x95, 0xb6, 0x8a, 0x25, 0xd6, 0x69, 0x96, 0x89, 0x63, 0x4f,
+  0xad, 0x02, 0xf0, 0x0c, 0xea, 0xac, 0x28, 0x89, 0xe3, 0x9a, 0xd9, 0x82,
+  0xc7, 0x5c, 0x98, 0xd2, 0x93, 0x33, 0xff, 0xc9, 0x7a, 0xb9, 0xc1, 0xda,
+  0xaa, 0x1c, 0x2c, 0xb2, 0x25, 0x9d, 0x1e, 0xbd, 0x49, 0xd8, 0xf7, 0x8d,
+  0x2a, 0x8f, 0x04, 0x0c, 0x69, 0x28, 0x35, 0xd2, 0x7e, 0xc5, 0xa7, 0xd5,
+  0xe7, 0xbe, 0xf0, 0x18, 0x86, 0x7a, 0x11, 0xa3, 0x24, 0x41, 0x61, 0x2e,
+  0x35, 0x91, 0xa2, 0xba, 0x9d, 0xb2, 0x95, 0xc4, 0x42, 0xe8, 0xd2, 0x11,
+  0xbb, 0x22, 0x30, 0xf6, 0x5b, 0xda, 0xc2, 0xa6, 0x74, 0x8b, 0x39, 0x4b,
+  0x19, 0x14, 0xf9, 0xcb, 0x49, 0xfe, 0x0f, 0xa1, 0xe7, 0xc6, 0x84, 0x17,
+  0xbc, 0x50, 0x07, 0xc9, 0xda, 0xe1, 0xbb, 0xb3, 0xd7, 0xef, 0x0f, 0x0f,
+  0xde, 0xff, 0xf8, 0xee, 0xed, 0xf3, 0xd7, 0x47, 0x6b, 0x94, 0x26, 0xf6,
+  0x48, 0xf2, 0x29, 0xd0, 0xa8, 0x97, 0xa9, 0xa4, 0xc3, 0x67, 0x89, 0xd2,
+  0xa9, 0x50, 0xe7, 0x11, 0x9b, 0x81, 0x9e, 0x41, 0x33, 0xe2, 0xc8, 0x09,
+  0xa2, 0xf8, 0x71, 0x91, 0x76, 0xd1, 0x2c, 0xca, 0x5e, 0x11, 0xfa, 0x95,
+  0x45, 0x62, 0x3d, 0x22, 0xc6, 0x9b, 0xf8, 0x0c, 0xcb, 0xcc, 0x55, 0x30,
+  0x2a, 0x25, 0xd9, 0xe8, 0x51, 0x94, 0x41, 0x21, 0x53, 0x5d, 0x17, 0x36,
+  0xba, 0xa1, 0x2a, 0xae, 0xb7, 0x2a, 0x25, 0x14, 0xf9, 0x29, 0x71, 0xe6,
+  0x8e, 0x2f, 0x96, 0xb2, 0xf2, 0x3c, 0x7f, 0x6e, 0x68, 0x0d, 0xdf, 0x47,
+  0x12, 0x94, 0xb1, 0xf4, 0x67, 0xd5, 0x5a, 0x5b, 0x53, 0xb8, 0x34, 0xe1,
+  0x9f, 0x92, 0xd6, 0x2c, 0xac, 0x34, 0x65, 0xbd, 0xba, 0x9b, 0x7d, 0xcc,
+  0x9c, 0x38, 0xa5, 0x99, 0x69, 0x87, 0xcc, 0xb8, 0x92, 0x9f, 0x81, 0xfb,
+  0xd3, 0xe9, 0x7e, 0xae, 0x2f, 0xb6, 0x39, 0xe5, 0x9a, 0x42, 0x94, 0x6e,
+  0xd1, 0x63, 0x42, 0x39, 0xfd, 0x29, 0x3b, 0xd3, 0x30, 0x08, 0x85, 0x1b,
+  0x3a, 0x3d, 0xb8, 0x78, 0x15, 0xed, 0x28, 0x70, 0x49, 0x0c, 0x75, 0x94,
+  0xdc, 0x03, 0x9c, 0x10, 0xf1, 0xd4, 0x0e, 0xb3, 0x58, 0x95, 0x14, 0x5d,
+  0xb0, 0x8a, 0x84, 0x31, 0xf0, 0xdd, 0xaf, 0xc4, 0x7a, 0x95, 0x82, 0x84,
+  0x89, 0x7e, 0x0d, 0xba, 0x68, 0xe0, 0xa7, 0xc8, 0x1e, 0xda, 0x00, 0xb5,
+  0x80, 0xca, 0x14, 0xe8, 0x32, 0xfd, 0x4a, 0xdf, 0xd6, 0xcf, 0x8d, 0xb7,
+  0x62, 0x94, 0x8f, 0xf0, 0x40, 0x90, 0x8c, 0x6c, 0x51, 0x6c, 0x5f, 0x94,
+  0x28, 0x36, 0x16, 0x44, 0x9f, 0x10, 0xb9, 0x8a, 0xdb, 0xa2, 0xcf, 0xd1,
+  0xc2, 0x69, 0x7c, 0xf7, 0xd7, 0x61, 0x39, 0x39, 0xe0, 0x45, 0xb2, 0x33,
+  0xc5, 0x40, 0xb9, 0x45, 0xf9, 0x99, 0xf1, 0x3d, 0x81, 0x74, 0x6a, 0x0d,
+  0x33, 0x9f, 0x46, 0x32, 0xbd, 0x49, 0x67, 0x03, 0xbd, 0xb6, 0xc6, 0x40,
+  0x7a, 0x79, 0x2f, 0x1f, 0xe5, 0xd5, 0xad, 0xc4, 0x11, 0xd0, 0xcc, 0x51,
+  0xa8, 0xc8, 0x26, 0x97, 0xe8, 0xf1, 0xfa, 0xd6, 0x4c, 0x20, 0x4c, 0xf9,
+  0xde, 0x18, 0x86, 0xd1, 0x54, 0x6a, 0x95, 0x4d, 0x74, 0xa4, 0x6b, 0x76,
+  0x3b, 0x92, 0xfb, 0x6d, 0x56, 0xe0, 0x85, 0xe8, 0x99, 0x07, 0x2e, 0x05,
+  0x91, 0x83, 0x9d, 0xf9, 0x70, 0xde, 0x6d, 0x89, 0xd8, 0xc4, 0x65, 0xec,
+  0x2e, 0xd2, 0xd1, 0xd4, 0xfc, 0xeb, 0xd5, 0x33, 0xd6, 0xcf, 0x82, 0x4c,
+  0xf8, 0x09, 0x5a, 0x9a, 0x74, 0x71, 0x78, 0x40, 0x46, 0x8c, 0x7b, 0x8c,
+  0xc2, 0x4e, 0x7e, 0x56, 0x8e, 0x5e, 0x63, 0xe8, 0xc2, 0xbf, 0x95, 0x9d,
+  0x3b, 0xc6, 0x4d, 0xc7, 0xfc, 0x19, 0xd0, 0xc5, 0x3d, 0x7c, 0xdb, 0xb3,
+  0x6d, 0x77, 0xb6, 0xaa, 0xc2, 0xf3, 0x6e, 0x66, 0xde, 0x66, 0xa6, 0x8f,
+  0xd9, 0x2a, 0x5f, 0x79, 0xb0, 0x20, 0x22, 0x93, 0xb6, 0xdd, 0xd5, 0x49,
+  0x21, 0xff, 0x16, 0x25, 0x11, 0x3b, 0x83, 0xf0, 0x9a, 0x96, 0x90, 0x0f,
+  0xf6, 0x57, 0x72, 0x52, 0x97, 0x08, 0x45, 0xd4, 0x6d, 0x42, 0x09, 0x05,
+  0x53, 0x8c, 0xab, 0xc7, 0xbf, 0xa6, 0x40, 0x8c, 0xc8, 0xe3, 0x3b, 0x6a,
+  0xaa, 0x55, 0xaf, 0x92, 0xc4, 0x8d, 0x24, 0xeb, 0x59, 0x17, 0xaf, 0xf4,
+  0x16, 0x76, 0xbb, 0xbd, 0x8f, 0x3f, 0x77, 0xe8, 0xe7, 0x6e, 0x8b, 0x44,
+  0xbe, 0x77, 0xe4, 0xf2, 0x41, 0x57, 0x62, 0x68, 0xab, 0x74, 0x04, 0xc1,
+  0xef, 0x7d, 0x4b, 0xef, 0x7d, 0x2b, 0xef, 0x05, 0x49, 0x71, 0xc3, 0xdb,
+  0x20, 0x62, 0x1a, 0x23, 0xd3, 0xa9, 0x5c, 0x44, 0xee, 0x26, 0xd2, 0x43,
+  0x9e, 0x0f, 0x1d, 0x04, 0x0e, 0x2d, 0x9a, 0x9c, 0xe1, 0xfa, 0xc2, 0x91,
+  0x6e, 0x6b, 0x7b, 0xc0, 0xad, 0x92, 0xf3, 0x0d, 0xfd, 0x35, 0xb8, 0x7c,
+  0x98, 0xbf, 0x91, 0x0d, 0x9c, 0xd0, 0x29, 0x67, 0xeb, 0xfd, 0x0c, 0xf8,
+  0x4a, 0x79, 0x95, 0xcc, 0x2b, 0x3e, 0x5e, 0x78, 0x14, 0x47, 0xb9, 0x89,
+  0x98, 0xd2, 0x41, 0x57, 0xac, 0xce, 0x81, 0x40, 0xc8, 0xdd, 0x91, 0xa2,
+  0xcb, 0x58, 0xa4, 0x5d, 0x7e, 0xb0, 0xa3, 0x38, 0x3d, 0x34, 0x6c, 0xa0,
+  0x05, 0x72, 0xe6, 0xe0, 0x17, 0x1e, 0xc4, 0x64, 0x8c, 0xea, 0x2d, 0xe7,
+  0x32, 0x82, 0x20, 0x94, 0xf7, 0x73, 0x92, 0x13, 0xf5, 0x2e, 0x65, 0xc0,
+  0x01, 0xeb, 0x8e, 0xc8, 0x5e, 0x32, 0x57, 0x33, 0xff, 0x91, 0x24, 0xc1,
+  0xb1, 0x10, 0xc0, 0x41, 0x5f, 0xb7, 0x24, 0xf2, 0xc9, 0xd4, 0xbc, 0x24,
+  0x50, 0xf3, 0x14, 0x39, 0xae, 0x46, 0xe9, 0xaa, 0x91, 0x6d, 0x20, 0x91,
+  0x29, 0x6a, 0xb6, 0xae, 0x59, 0x3c, 0xc9, 0x2a, 0xa3, 0x82, 0x90, 0x3c,
+  0x44, 0x31, 0x55, 0xb5, 0x13, 0xff, 0x3b, 0xed, 0x31, 0xd2, 0xf2, 0x26,
+  0xd9, 0x29, 0x37, 0xc3, 0xae, 0xae, 0x78, 0xdc, 0x59, 0x96, 0x5b, 0xed,
+  0xb8, 0x1f, 0xe1, 0x83, 0x2c, 0xa9, 0xb9, 0xe5, 0xfa, 0x9b, 0xa9, 0xea,
+  0xbf, 0x2e, 0xf0, 0x80, 0x05, 0xe1, 0x8d, 0xfc, 0x00, 0x31, 0x33, 0xa0,
+  0x8d, 0x61, 0xfb, 0x97, 0xe6, 0x29, 0xa8, 0xed, 0x83, 0xf7, 0x8c, 0x0f,
+  0xaa, 0xc0, 0x4d, 0x51, 0x4a, 0xcf, 0x39, 0x6b, 0xc4, 0x76, 0xa7, 0x11,
+  0xc9, 0x50, 0xc0, 0x72, 0x48, 0x3a, 0xe9, 0x26, 0x4e, 0x08, 0xf4, 0x1d,
+  0xaa, 0xff, 0x21, 0x12, 0xe5, 0xd4, 0xee, 0xcd, 0x3b, 0x8d, 0x7c, 0xd8,
+  0xec, 0x0f, 0x92, 0x74, 0x2d, 0x3c, 0x40, 0xe7, 0x62, 0x06, 0xf0, 0xe4,
+  0xef, 0x73, 0xc4, 0xff, 0x10, 0x4f, 0x5f, 0x31, 0x89, 0x63, 0x8d, 0xa1,
+  0x65, 0x32, 0x8c, 0x3b, 0xcb, 0xb8, 0x98, 0xf3, 0x24, 0x1c, 0x4a, 0xd0,
+  0x57, 0xd2, 0x45, 0xb9, 0xd6, 0x0c, 0xb2, 0x24, 0xd5, 0xce, 0x40, 0x19,
+  0x84, 0x6f, 0x3e, 0x20, 0x7e, 0x91, 0xf8, 0x56, 0x64, 0x6a, 0x8b, 0x4b,
+  0x0a, 0x44, 0x8e, 0xff, 0x4e, 0xd8, 0x30, 0x4f, 0xfb, 0x2d, 0xfb, 0x46,
+  0xaf, 0x76, 0x3a, 0xd8, 0x0a, 0x65, 0xe2, 0xb1, 0x13, 0xd6, 0xdc, 0x99,
+  0x63, 0x6f, 0xaf, 0x18, 0x05, 0x8f, 0x29, 0x8b, 0x3a, 0x7e, 0xd3, 0xbf,
+  0x4f, 0x28, 0x2d, 0x9e, 0x03, 0xa1, 0xa2, 0x58, 0x1f, 0x0e, 0x4c, 0xa6,
+  0x45, 0x66, 0x20, 0x1c, 0x3f, 0x56, 0x75, 0xe7, 0x27, 0xad, 0xfd, 0x16,
+  0xca, 0x55, 0xad, 0x5f, 0xe0, 0x5f, 0x92, 0x84, 0x39, 0x5c, 0x5f, 0x24,
+  0x4d, 0x93, 0x69, 0x29, 0xce, 0x50, 0xe2, 0x0f, 0x78, 0x3b, 0xc4, 0x28,
+  0x96, 0x8d, 0xf2, 0x71, 0x4e, 0x71, 0x01, 0xe7, 0x9a, 0x7e, 0xc8, 0x1d,
+  0x47, 0x3d, 0xf3, 0x8d, 0xec, 0x20, 0x2f, 0xdc, 0x10, 0x84, 0x35, 0x96,
+  0xc9, 0x2f, 0xf7, 0x8f, 0xc0, 0x40, 0x7d, 0x5c, 0x40, 0xc2, 0x57, 0x4b,
+  0xae, 0x29, 0x65, 0xb6, 0x81, 0xdb, 0xaa, 0x4c, 0xcd, 0xc2, 0x47, 0x32,
+  0xfd, 0xd0, 0x2f, 0xb7, 0xb7, 0x39, 0xeb, 0x8f, 0x7e, 0x8d, 0x0c, 0xc5,
+  0x33, 0x32, 0xca, 0x5f, 0xa7, 0x30, 0xa7, 0x1e, 0xfa, 0xea, 0x19, 0x97,
+  0x2b, 0x4d, 0x4e, 0xff, 0x74, 0x78, 0xfe, 0x07, 0x78, 0xed, 0xdd, 0xd9,
+  0x31, 0x1c, 0x30, 0xc4, 0x09, 0xfb, 0x7a, 0x6f, 0x7b, 0x67, 0x23, 0x8e,
+  0x0c, 0x54, 0x8f, 0x8f, 0x81, 0xf2, 0xc4, 0x64, 0xc5, 0x6a, 0xa9, 0xe8,
+  0x76, 0xa1, 0x49, 0x58, 0x4d, 0x34, 0x38, 0x77, 0x93, 0x03, 0xb5, 0x6c,
+  0xab, 0x0c, 0x09, 0xe3, 0x9d, 0x58, 0x3a, 0x36, 0x5c, 0x5b, 0x34, 0x5c,
+  0xd8, 0x31, 0xb6, 0x6c, 0x85, 0x40, 0x28, 0x42, 0x74, 0x08, 0xed, 0xc1,
+  0x18, 0x59, 0xd4, 0x91, 0x63, 0x1c, 0x8d, 0xdd, 0x4b, 0x3d, 0x6d, 0xf1,
+  0x11, 0x4a, 0x88, 0x9d, 0x2c, 0x90, 0x97, 0xf5, 0xc4, 0xc8, 0x50, 0xea,
+  0xc5, 0x49, 0x23, 0x68, 0x21, 0x7f, 0x9f, 0xa0, 0xeb, 0xf7, 0x26, 0x75,
+  0x0c, 0x55, 0xd7, 0x99, 0x69, 0xbd, 0x03, 0xea, 0x54, 0x16, 0xc9, 0xa3,
+  0xa8, 0xde, 0x68, 0x43, 0x47, 0x6f, 0x5f, 0xb6, 0x98, 0x89, 0xb4, 0x4e,
+  0xcf, 0x4e, 0x7e, 0x6a, 0xf1, 0x95, 0x41, 0x6d, 0x52, 0xa3, 0xce, 0x78,
+  0xbe, 0x1e, 0x32, 0xe6, 0xe8, 0x78, 0xcb, 0xbe, 0x9a, 0x0d, 0x10, 0xc3,
+  0x01, 0x37, 0xea, 0xe4, 0xd0, 0x20, 0xb6, 0xb0, 0x25, 0xa9, 0x5d, 0x5f,
+  0x29, 0x0d, 0x05, 0x10, 0x53, 0x8d, 0x4a, 0x9f, 0x01, 0xc8, 0xa6, 0x79,
+  0x0b, 0x65, 0x0f, 0x17, 0x37, 0xf1, 0x9e, 0x5d, 0x8c, 0x36, 0xb1, 0xb6,
+  0x87, 0x11, 0x95, 0x35, 0x48, 0xf8, 0xc9, 0x21, 0xf3, 0x9a, 0x65, 0x52,
+  0x89, 0xe7, 0xf4, 0xe2, 0xee, 0x20, 0xc9, 0x4c, 0x4d, 0x19, 0x18, 0x4e,
+  0x5c, 0x8a, 0x29, 0x32, 0xa6, 0x4c, 0x36, 0x45, 0x42, 0x67, 0xaf, 0x25,
+  0x11, 0xea, 0xf4, 0xc5, 0x5f, 0xcc, 0x55, 0x6d, 0xf2, 0xfe, 0xb7, 0xc1,
+  0xb4, 0xce, 0xab, 0xc6, 0xe0, 0x16, 0xc1, 0xc6, 0x9e, 0x9a, 0x98, 0x4e,
+  0xb1, 0x00, 0x1b, 0x12, 0xde, 0x1f, 0x50, 0x89, 0x92, 0xd6, 0x33, 0x7a,
+  0x20, 0xb6, 0xd2, 0x7c, 0xff, 0x0b, 0x7f, 0x4a, 0x7a, 0x22, 0xfc, 0x51,
+  0x5d, 0xcd, 0xc7, 0x3d, 0xe0, 0xb8, 0x93, 0xea, 0xfb, 0x16, 0x3b, 0xa8,
+  0x29, 0x5d, 0x67, 0x61, 0xd4, 0x66, 0x63, 0x65, 0x21, 0x32, 0x11, 0x0b,
+  0x32, 0x43, 0x4f, 0xd6, 0xb4, 0x83, 0x44, 0x86, 0xd6, 0xe6, 0xdf, 0xe9,
+  0xb2, 0xe0, 0x55, 0x91, 0xa8, 0x62, 0xa6, 0x4b, 0xd1, 0x26, 0xe1, 0xee,
+  0x9c, 0xfd, 0xf2, 0xe6, 0xaf, 0xbf, 0x7c, 0xb3, 0xfb, 0x38, 0xfd, 0x3a,
+  0xed, 0x3f, 0x19, 0x3e, 0x4d, 0xf7, 0x06, 0x7b, 0x5f, 0x7f, 0xb3, 0xf3,
+  0x74, 0x2f, 0xfd, 0xfa, 0xf1, 0x30, 0x7d, 0xb2, 0x9d, 0x6d, 0x7f, 0x33,
+  0xdc, 0xd9, 0x1d, 0x0c, 0x86, 0xd9, 0xd3, 0xc1, 0xd7, 0x69, 0xab, 0xab,
+  0x22, 0xa3, 0x8e, 0x5c, 0x3c, 0x79, 0xec, 0xa4, 0x80, 0x75, 0x39, 0x7f,
+  0x75, 0xd0, 0xd9, 0x4e, 0xae, 0xb2, 0x8f, 0xe6, 0xbd, 0xe2, 0x38, 0x83,
+  0xb0, 0x9a, 0x65, 0xe6, 0x66, 0x14, 0x8b, 0xeb, 0x02, 0x7c, 0x08, 0x77,
+  0x6f, 0x08, 0xfb, 0x93, 0x85, 0x5e, 0x30, 0x40, 0xeb, 0x66, 0x89, 0x98,
+  0xe2, 0x26, 0x24, 0x53, 0x7f, 0x8d, 0x82, 0xca, 0x9b, 0x14, 0xb3, 0xd1,
+  0x74, 0x35, 0xe4, 0xa1, 0x73, 0xf6, 0x7c, 0xc9, 0x87, 0xf2, 0x57, 0xd9,
+  0x5e, 0x68, 0xe8, 0xe5, 0xac, 0x98, 0x4f, 0x4f, 0x0b, 0xd0, 0x4b, 0x6f,
+  0xdb, 0x06, 0xff, 0xe9, 0x9b, 0x75, 0x0f, 0xd8, 0xf7, 0x16, 0x30, 0xe4,
+  0x1f, 0x3c, 0xe2, 0x03, 0x90, 0x13, 0x26, 0xc6, 0x50, 0x6f, 0xc9, 0x48,
+  0x4c, 0xab, 0xcb, 0x69, 0xe1, 0x36, 0xfb, 0x2c, 0x69, 0x0d, 0xdb, 0xc7,
+  0x1f, 0x74, 0xc5, 0xf3, 0x4d, 0x0c, 0xff, 0xd1, 0x5f, 0xab, 0x49, 0x6c,
+  0xca, 0xda, 0xda, 0xf2, 0x36, 0x8b, 0x6a, 0xf0, 0x1b, 0x7d, 0x1a, 0x34,
+  0x33, 0x7c, 0x0e, 0x83, 0xf8, 0x34, 0xa8, 0x85, 0x85, 0xb2, 0x9f, 0x58,
+  0xd9, 0x12, 0xac, 0x0d, 0xfc, 0xd6, 0xa2, 0xf3, 0x35, 0x5b, 0x2f, 0xda,
+  0x7a, 0x03, 0x35, 0x0b, 0xd3, 0x3e, 0x74, 0xdf, 0x9f, 0x73, 0x13, 0x67,
+  0x12, 0x69, 0xb3, 0x9e, 0x7e, 0x48, 0xbb, 0xc9, 0xc9, 0xe1, 0xf9, 0x29,
+  0x36, 0x3e, 0x45, 0x08, 0x91, 0x0d, 0x32, 0x25, 0x65, 0x1f, 0x41, 0x1c,
+  0x29, 0x9d, 0x9f, 0xa4, 0x16, 0x84, 0x85, 0x8b, 0xa7, 0x01, 0xe3, 0x2a,
+  0xde, 0xe8, 0x78, 0x24, 0x7d, 0x30, 0x25, 0x4c, 0xac, 0x74, 0x94, 0x23,
+  0x4b, 0x46, 0xfd, 0xcb, 0xb8, 0x0a, 0x88, 0xbc, 0x83, 0x8d, 0x10, 0xd2,
+  0xd3, 0x76, 0xe2, 0xbf, 0x65, 0x18, 0x01, 0x5d, 0x5e, 0xa2, 0x3f, 0xac,
+  0x4c, 0x1c, 0x88, 0x85, 0xf4, 0xb0, 0x48, 0xf1, 0x68, 0x82, 0x25, 0x55,
+  0x68, 0x96, 0x11, 0x0a, 0x17, 0x5b, 0x72, 0x26, 0x85, 0x6b, 0x0f, 0x83,
+  0xae, 0x47, 0x8c, 0x9f, 0xa0, 0xf0, 0x0e, 0xed, 0xc0, 0x0c, 0x22, 0xd3,
+  0x71, 0x14, 0x86, 0x42, 0xc6, 0x0c, 0x4d, 0x94, 0xa7, 0xd7, 0x83, 0xe5,
+  0x9b, 0x02, 0xd0, 0x29, 0x85, 0x31, 0x43, 0x49, 0x4a, 0xb8, 0x3c, 0x8d,
+  0x54, 0xfd, 0x30, 0x81, 0x8c, 0xf9, 0x3a, 0x51, 0x1b, 0x5d, 0xb9, 0x60,
+  0x61, 0x0e, 0xfb, 0xff, 0x60, 0x26, 0xe6, 0xd0, 0xe4, 0xfd, 0x44, 0xae,
+  0x7d, 0xaf, 0xe6, 0xb5, 0x83, 0x1b, 0x2a, 0x1b, 0x4c, 0xe7, 0x3d, 0x20,
+  0xe3, 0x98, 0x82, 0xe9, 0x12, 0x7f, 0x86, 0x3f, 0x23, 0xdd, 0x02, 0x31,
+  0xbb, 0xf8, 0x7e, 0x1f, 0x5a, 0xaa, 0x16, 0x1f, 0xd7, 0x45, 0x71, 0xb8,
+  0x8b, 0x82, 0x7e, 0x3b, 0x79, 0x8e, 0x38, 0xb6, 0x09, 0xdc, 0xfb, 0xb2,
+  0x4d, 0x78, 0xed, 0x13, 0xad, 0x9d, 0x6e, 0xef, 0x10, 0xeb, 0x72, 0x22,
+  0x1f, 0x36, 0x1d, 0x45, 0x2f, 0xa8, 0xb2, 0x47, 0x7d, 0x4a, 0x0a, 0x7d,
+  0xc0, 0x18, 0x75, 0xfb, 0x20, 0x49, 0x29, 0xc1, 0x3f, 0x8c, 0x9d, 0x0b,
+  0xa9, 0xbe, 0xf0, 0x66, 0x30, 0xd1, 0x1e, 0xa0, 0x73, 0xf5, 0xde, 0x9b,
+  0x4d, 0x28, 0x15, 0xb9, 0x70, 0x9f, 0x05, 0x26, 0x92, 0x90, 0x60, 0xdc,
+  0xc1, 0x56, 0x46, 0x43, 0x17, 0x0f, 0x88, 0xb3, 0x38, 0xf1, 0xe0, 0x96,
+  0x88, 0x2b, 0x4e, 0x54, 0x89, 0xf4, 0x52, 0x5b, 0xe4, 0x2f, 0xa1, 0x9a,
+  0x5a, 0xe3, 0xa8, 0x6a, 0xc9, 0x0c, 0x3f, 0x8d, 0xd5, 0xdd, 0xc7, 0xe5,
+  0xf2, 0x29, 0x61, 0xd2, 0x3e, 0xc3, 0xb4, 0x8d, 0x98, 0x42, 0x44, 0x7e,
+  0xe2, 0x5b, 0x8e, 0x9f, 0x43, 0x2e, 0x90, 0x0b, 0xee, 0x1d, 0xfb, 0xe6,
+  0x15, 0x4d, 0xd3, 0x00, 0x48, 0x05, 0xa0, 0x8a, 0xdd, 0x4a, 0xea, 0x2e,
+  0x2f, 0xd9, 0x1c, 0xbe, 0xdd, 0xdd, 0x49, 0xd6, 0x09, 0x4b, 0x01, 0x53,
+  0xd1, 0x37, 0xba, 0x92, 0x3c, 0x84, 0x09, 0x23, 0x14, 0x93, 0x2f, 0x63,
+  0x91, 0x3e, 0x9c, 0xe7, 0x40, 0x65, 0x39, 0xe1, 0x5e, 0xf2, 0x60, 0x37,
+  0x21, 0x60, 0x0d, 0x4c, 0x24, 0x25, 0x07, 0x18, 0x0f, 0x91, 0xde, 0xb6,
+  0x2b, 0x57, 0xf4, 0x49, 0x55, 0x1a, 0xdf, 0x9d, 0xbd, 0xde, 0x97, 0x75,
+  0x6a, 0x4c, 0x3b, 0x2b, 0xcb, 0x91, 0x2e, 0x09, 0xa5, 0x9e, 0x25, 0x6a,
+  0x70, 0x94, 0xa1, 0x11, 0xd1, 0x7c, 0x99, 0x58, 0x69, 0xed, 0xe2, 0xe8,
+  0xf0, 0xf9, 0xab, 0xa3, 0x0e, 0xfc, 0x3c, 0x3f, 0xe8, 0x1c, 0x1c, 0x9d,
+  0x6f, 0xef, 0x3c, 0xed, 0xbc, 0x3c, 0x7c, 0xd3, 0x01, 0xf1, 0x63, 0x67,
+  0xef, 0xc9, 0x3e, 0xc7, 0x81, 0xf0, 0x33, 0x67, 0x4d, 0x4f, 0xac, 0x46,
+  0x19, 0xd5, 0xa8, 0xdc, 0xde, 0xd5, 0x2e, 0xdb, 0xc1, 0xb1, 0x24, 0x63,
+  0x90, 0xc8, 0xab, 0x39, 0x30, 0xf7, 0x32, 0x90, 0x4a, 0x31, 0x26, 0xf9,
+  0x53, 0xe7, 0x2d, 0x21, 0x23, 0x7a, 0x75, 0x49, 0xe8, 0x33, 0x3f, 0x11,
+  0xf8, 0xbc, 0x5c, 0x7e, 0x94, 0x6b, 0x3e, 0xac, 0x45, 0x44, 0x95, 0xce,
+  0x66, 0xaf, 0x08, 0x00, 0xac, 0xed, 0xc5, 0xde, 0x09, 0x84, 0x98, 0xe1,
+  0x96, 0x7d, 0x26, 0x87, 0x2e, 0xe7, 0x99, 0x76, 0x25, 0x41, 0x53, 0x49,
+  0x00, 0x82, 0xd2, 0x98, 0x69, 0x0d, 0x0f, 0xa2, 0xa8, 0x6b, 0x06, 0xed,
+  0x95, 0x1b, 0xee, 0x96, 0x9e, 0x16, 0xd9, 0xd1, 0x49, 0xf3, 0x2d, 0x43,
+  0xab, 0x42, 0xe9, 0x8f, 0xf8, 0x78, 0x4a, 0x73, 0x64, 0x33, 0x3b, 0x05,
+  0xad, 0xf0, 0xfb, 0x92, 0xfa, 0x81, 0xd1, 0x6d, 0xe9, 0xcc, 0x14, 0x48,
+  0x04, 0xa9, 0x4b, 0x6f, 0x2d, 0x34, 0xab, 0x86, 0xf8, 0xb4, 0x5e, 0x56,
+  0xf9, 0x08, 0xf4, 0x81, 0xb0, 0x60, 0xdf, 0x0a, 0xea, 0x05, 0x9e, 0xa8,
+  0xa1, 0x25, 0x06, 0x48, 0x14, 0xb8, 0xa2, 0xc3, 0xd1, 0x8d, 0x1a, 0x16,
+  0x23, 0x50, 0xd4, 0xf1, 0x30, 0x59, 0x90, 0x06, 0x44, 0x1d, 0x32, 0x61,
+  0xa0, 0x26, 0x0d, 0x50, 0x1a, 0xc2, 0x7c, 0x62, 0xd2, 0xa6, 0x5c, 0x65,
+  0x13, 0x05, 0xf3, 0x11, 0xd7, 0x98, 0xa0, 0xa8, 0x29, 0x5c, 0x56, 0x62,
+  0x91, 0xc3, 0xa9, 0x46, 0x07, 0xb3, 0x73, 0x9b, 0x80, 0xcc, 0x10, 0x73,
+  0xf9, 0xdb, 0x70, 0x87, 0x6b, 0x87, 0x14, 0xef, 0x5a, 0xc8, 0x2f, 0xa4,
+  0x90, 0xa0, 0xf5, 0x81, 0xbe, 0xe2, 0xe8, 0x57, 0x37, 0x21, 0x77, 0x09,
+  0x1b, 0x87, 0x0d, 0x54, 0xd5, 0x10, 0x40, 0x43, 0x7e, 0xee, 0x65, 0x17,
+  0xb0, 0xe4, 0xc8, 0x3d, 0xb2, 0x84, 0x48, 0xbe, 0x86, 0x17, 0xd6, 0x6f,
+  0xc9, 0x89, 0x0c, 0x1d, 0xaf, 0xc6, 0x6e, 0xed, 0xf9, 0x4e, 0x69, 0x69,
+  0x4a, 0xf5, 0x8f, 0x55, 0x27, 0x3c, 0xd4, 0xe8, 0x54, 0xcd, 0x55, 0x20,
+  0x94, 0x0c, 0x7d, 0x56, 0x53, 0xf7, 0xc4, 0x53, 0x1f, 0x62, 0xb1, 0xdb,
+  0x02, 0xef, 0xa4, 0x71, 0xcd, 0xbc, 0xe6, 0x7e, 0xb9, 0x71, 0x91, 0x8b,
+  0x99, 0xad, 0xf5, 0xa0, 0xa0, 0xa8, 0xd4, 0x58, 0xb4, 0x69, 0x18, 0xd1,
+  0x32, 0x11, 0x47, 0x57, 0xd7, 0x96, 0xd7, 0xd6, 0x37, 0x2c, 0xb0, 0xac,
+  0xae, 0x45, 0x49, 0x15, 0x8b, 0x4b, 0xb1, 0xd2, 0x32, 0xe3, 0xb3, 0x49,
+  0xb9, 0x4a, 0x80, 0x68, 0xb4, 0x85, 0xd4, 0xeb, 0x9f, 0xda, 0x1c, 0x2b,
+  0x3a, 0xcc, 0x2f, 0x23, 0x37, 0x78, 0x48, 0x93, 0xe0, 0xb4, 0x39, 0x75,
+  0x78, 0xe3, 0x89, 0x12, 0xfc, 0x66, 0x4d, 0xfc, 0xa2, 0x98, 0x07, 0x71,
+  0x62, 0x47, 0xe9, 0x61, 0x8f, 0xa2, 0xfc, 0x30, 0x50, 0x3d, 0xe7, 0x13,
+  0x03, 0xae, 0x0e, 0xad, 0x22, 0xd7, 0xa1, 0x33, 0x87, 0xd8, 0xc5, 0x43,
+  0x61, 0x2e, 0x84, 0x81, 0x16, 0xdf, 0x17, 0x0d, 0x08, 0xd4, 0xba, 0x40,
+  0x27, 0x0e, 0xa5, 0x88, 0x53, 0x0d, 0x1d, 0x48, 0xa9, 0x9a, 0x5d, 0x83,
+  0x8d, 0xa0, 0x70, 0xde, 0x56, 0x46, 0x18, 0xf2, 0xfa, 0x34, 0xa7, 0xaa,
+  0x04, 0xd0, 0xbd, 0xde, 0x2d, 0xa3, 0x11, 0x52, 0xba, 0x6d, 0x9b, 0x31,
+  0xf9, 0x08, 0x3b, 0x8b, 0x4c, 0x6b, 0x21, 0x01, 0x11, 0x61, 0xb6, 0x0b,
+  0x3d, 0x7e, 0x2e, 0x65, 0xb1, 0x14, 0xb8, 0x42, 0x31, 0xf0, 0x0a, 0xb8,
+  0x38, 0x63, 0x9f, 0xe5, 0x06, 0x16, 0x4f, 0x1b, 0x10, 0xcc, 0xce, 0x84,
+  0x8c, 0x63, 0x1a, 0x7e, 0x3e, 0xc9, 0x09, 0x1f, 0x5e, 0x4d, 0x8a, 0x9a,
+  0x67, 0x68, 0xde, 0x17, 0x60, 0xcd, 0x6d, 0x43, 0x26, 0x1b, 0x91, 0x97,
+  0x95, 0x32, 0x87, 0x69, 0x74, 0x35, 0x13, 0xa8, 0xb9, 0xab, 0x84, 0xd1,
+  0x95, 0xc1, 0xbf, 0x54, 0x86, 0x58, 0x78, 0x6f, 0xbf, 0xd2, 0x85, 0x73,
+  0x0c, 0x81, 0xee, 0xa5, 0x99, 0x4b, 0x1b, 0xa7, 0x0b, 0x7c, 0x26, 0x10,
+  0xea, 0x3d, 0xc4, 0x69, 0x96, 0x91, 0x60, 0x26, 0xb0, 0x00, 0x17, 0xd5,
+  0x4c, 0xa0, 0x9a, 0xb9, 0xec, 0xba, 0xd3, 0x68, 0x2f, 0xdb, 0xbe, 0x48,
+  0x6d, 0xcb, 0xc2, 0xe7, 0xc1, 0x9f, 0x12, 0xf6, 0x86, 0x70, 0x23, 0xa2,
+  0xb4, 0x47, 0x59, 0x8b, 0xf5, 0xfd, 0x0d, 0x13, 0x61, 0xe3, 0x8c, 0xd1,
+  0xef, 0x36, 0x18, 0x4a, 0x2e, 0xd8, 0xe6, 0x9d, 0x25, 0x09, 0x98, 0xfa,
+  0xa8, 0xb0, 0x30, 0x26, 0x3c, 0xae, 0xbc, 0xfc, 0xdc, 0x90, 0x20, 0x19,
+  0xaf, 0xb7, 0x38, 0xa7, 0x11, 0xaf, 0x91, 0xd6, 0x06, 0x63, 0xe2, 0x84,
+  0x47, 0xf5, 0x29, 0x26, 0xac, 0x60, 0xc3, 0x60, 0xa3, 0xae, 0xca, 0x41,
+  0x1e, 0xdf, 0xda, 0x2c, 0xb0, 0xfb, 0x49, 0xf2, 0xcb, 0x2f, 0xed, 0xe4,
+  0x97, 0x16, 0xfc, 0x87, 0xec, 0xeb, 0x17, 0x20, 0xba, 0x5f, 0x66, 0xbc,
+  0xe5, 0xbf, 0x5c, 0x93, 0xcd, 0xd4, 0x50, 0x67, 0xd5, 0x90, 0x0b, 0xfa,
+  0xa0, 0x40, 0xf4, 0xdc, 0x6a, 0xd4, 0x14, 0xc1, 0x49, 0x7b, 0xe7, 0x50,
+  0xbc, 0xa0, 0x9c, 0xba, 0x32, 0x29, 0x26, 0x1d, 0x86, 0xcf, 0x85, 0x15,
+  0x9b, 0x8f, 0x27, 0x1c, 0xef, 0x2c, 0x44, 0xc9, 0x07, 0x84, 0x98, 0xe9,
+  0xda, 0x1f, 0xd6, 0xc2, 0x26, 0x9a, 0xd6, 0x09, 0xf7, 0xb4, 0x3e, 0x13,
+  0x25, 0xe9, 0xb3, 0x6b, 0xdb, 0xe4, 0x0d, 0xc2, 0x4a, 0x13, 0x78, 0x94,
+  0x62, 0x12, 0x02, 0x0a, 0x10, 0x27, 0x66, 0x7a, 0x75, 0x5b, 0xa2, 0xd0,
+  0x62, 0xc7, 0x31, 0x59, 0x38, 0x17, 0x68, 0x60, 0xb4, 0x84, 0x10, 0xc4,
+  0x30, 0x16, 0xa8, 0xfd, 0x52, 0x53, 0x42, 0x38, 0x2d, 0x8c, 0x49, 0x8f,
+  0xbd, 0x76, 0xec, 0xa3, 0xdb, 0xde, 0x4a, 0xc6, 0xd9, 0x65, 0x2a, 0xa8,
+  0x34, 0xeb, 0x94, 0x4e, 0xc2, 0x0d, 0x51, 0x94, 0xd1, 0x46, 0x3d, 0x31,
+  0x2c, 0xce, 0x71, 0xab, 0x8a, 0xc0, 0x1f, 0x53, 0xca, 0x58, 0x9d, 0x80,
+  0x72, 0xd9, 0xea, 0xb4, 0x12, 0x73, 0x1b, 0xb2, 0xdd, 0x15, 0x19, 0x63,
+  0xcc, 0x44, 0x5c, 0x9e, 0x88, 0xf6, 0x11, 0x72, 0x15, 0x04, 0xd8, 0xa0,
+  0xc7, 0x6c, 0x35, 0x18, 0x5d, 0x11, 0x1b, 0x29, 0x68, 0x07, 0x3a, 0x79,
+  0xc9, 0x42, 0xc7, 0x04, 0x95, 0x05, 0x5b, 0x3b, 0x92, 0x6f, 0x48, 0xa9,
+  0xec, 0x10, 0x30, 0xac, 0x2c, 0x2e, 0x0b, 0x85, 0x74, 0x9f, 0x01, 0x17,
+  0x2b, 0x51, 0xc1, 0x0f, 0x58, 0xf8, 0x61, 0xb0, 0xd8, 0xa7, 0x64, 0x43,
+  0x17, 0x37, 0x13, 0xa9, 0x58, 0x71, 0x5e, 0x90, 0xa7, 0xa9, 0x4f, 0xc9,
+  0x30, 0x18, 0xe6, 0xa2, 0x98, 0x2c, 0x1c, 0xcf, 0xc9, 0x28, 0xf6, 0x8f,
+  0x6a, 0x28, 0xb4, 0x91, 0x52, 0x80, 0xd0, 0xe4, 0x8f, 0xfe, 0x00, 0x23,
+  0xea, 0xe8, 0x0d, 0x96, 0x88, 0xf1, 0xa9, 0x43, 0x5f, 0x54, 0x26, 0x12,
+  0x09, 0xa5, 0x84, 0xf6, 0xdc, 0x2d, 0xd6, 0x82, 0x4f, 0x05, 0x4a, 0x06,
+  0xbe, 0xc0, 0x0e, 0x90, 0xcf, 0x08, 0x04, 0x3b, 0xbc, 0x00, 0xd7, 0x77,
+  0x27, 0xbd, 0x44, 0x01, 0x11, 0xbe, 0x06, 0xb1, 0x0c, 0x74, 0x0a, 0xfc,
+  0x6b, 0x13, 0x34, 0x25, 0x19, 0x00, 0xae, 0x01, 0x55, 0xdd, 0x30, 0xbf,
+  0x1d, 0x4e, 0xb8, 0x2a, 0x8a, 0xc6, 0xfe, 0x16, 0x71, 0x34, 0xb0, 0x9b,
+  0xce, 0x09, 0xfc, 0x20, 0x73, 0x2c, 0xbc, 0x2e, 0x13, 0x86, 0xf9, 0x4e,
+  0x0a, 0x82, 0xa9, 0x02, 0x69, 0x6c, 0x34, 0x8a, 0xf0, 0xec, 0x5b, 0x61,
+  0xea, 0x9c, 0xca, 0x9d, 0xd5, 0x57, 0x80, 0x97, 0x9f, 0x82, 0x25, 0xd5,
+  0x8f, 0x23, 0xd0, 0xeb, 0xcc, 0x92, 0xd6, 0x25, 0xf0, 0x0f, 0x03, 0xaa,
+  0x55, 0x70, 0x60, 0x7d, 0x68, 0x83, 0x73, 0xca, 0x04, 0xc1, 0x4e, 0xa3,
+  0xb5, 0x45, 0x19, 0x8f, 0x6e, 0x12, 0x0b, 0x97, 0xca, 0xd9, 0x35, 0x4d,
+  0x37, 0x30, 0xc2, 0x3b, 0xe1, 0xdd, 0x73, 0xc3, 0xd0, 0x01, 0xf2, 0x82,
+  0x45, 0x5f, 0x72, 0x5e, 0xe6, 0x85, 0x57, 0xf0, 0xf5, 0x11, 0x49, 0xe2,
+  0x29, 0xb9, 0x7f, 0x0d, 0x83, 0xb1, 0xc3, 0x6a, 0xfc, 0x4d, 0xd8, 0xd1,
+  0x88, 0x0a, 0x2b, 0x28, 0xe8, 0x01, 0x49, 0x5c, 0xaa, 0x44, 0x6e, 0x6f,
+  0x24, 0xad, 0xff, 0x46, 0x51, 0x61, 0x0c, 0x0a, 0x8b, 0x2b, 0x30, 0xeb,
+  0xb7, 0xe4, 0xdb, 0x1d, 0xfc, 0xf6, 0x2f, 0xcf, 0x5f, 0xbe, 0x3f, 0x3c,
+  0x79, 0xfb, 0xe2, 0xf8, 0x25, 0x3f, 0x23, 0x8f, 0xc4, 0x51, 0xbd, 0x2e,
+  0xa8, 0x73, 0x17, 0x5f, 0x6a, 0x6a, 0xed, 0xf1, 0x86, 0x06, 0x38, 0xec,
+  0x27, 0x2d, 0x82, 0x51, 0x3e, 0x3d, 0x3b, 0x41, 0x84, 0xc9, 0xff, 0xf8,
+  0xa5, 0xf6, 0xe4, 0x5e, 0xf4, 0xe4, 0xc1, 0xe9, 0xe9, 0xf3, 0x83, 0x8b,
+  0x83, 0x85, 0xa7, 0x9e, 0x2c, 0x6f, 0xef, 0x20, 0xc4, 0x2c, 0x25, 0xcf,
+  0x81, 0x28, 0xea, 0xaf, 0x7e, 0xbd, 0x01, 0x1c, 0x60, 0xd2, 0xb1, 0xd7,
+  0xd1, 0x16, 0x70, 0x99, 0x55, 0xd3, 0x9b, 0x79, 0x4e, 0xdc, 0x8b, 0x4a,
+  0xf5, 0xe0, 0x5a, 0x5e, 0x15, 0x3e, 0x10, 0x4c, 0xde, 0x7e, 0xba, 0x81,
+  0xc1, 0xba, 0x21, 0xae, 0x57, 0x6c, 0x06, 0x09, 0xbd, 0xc6, 0x42, 0xa7,
+  0xf4, 0x67, 0x5b, 0x15, 0x52, 0x3b, 0xf8, 0x8e, 0x51, 0x5a, 0x61, 0x24,
+  0xa0, 0x01, 0x42, 0xe8, 0x5c, 0x67, 0x7c, 0xce, 0x1d, 0x49, 0x15, 0xcc,
+  0x82, 0x1b, 0x22, 0xd2, 0x98, 0x29, 0x23, 0x2a, 0x96, 0x58, 0xf0, 0xb2,
+  0xfe, 0xbc, 0x52, 0x40, 0x6e, 0xda, 0xf0, 0x41, 0x60, 0xf7, 0x01, 0x4d,
+  0x13, 0xc5, 0x04, 0x65, 0xa9, 0xa2, 0x67, 0x1a, 0x09, 0x4d, 0x5d, 0x6c,
+  0x2f, 0xdc, 0x79, 0x36, 0x03, 0xb3, 0x37, 0xbe, 0xe7, 0x4f, 0xda, 0x02,
+  0xc5, 0x34, 0x53, 0x4e, 0x47, 0x25, 0x54, 0x50, 0xb5, 0x3a, 0xa1, 0xf8,
+  0x36, 0xb1, 0x32, 0x95, 0x2e, 0xa0, 0x25, 0xd1, 0x5e, 0xc4, 0xa9, 0x0f,
+  0x73, 0x93, 0xc6, 0xc8, 0xe2, 0xd9, 0x0d, 0xd4, 0x1f, 0xb9, 0xc2, 0x1a,
+  0x12, 0x62, 0x55, 0xea, 0x14, 0xfb, 0xfb, 0x7d, 0x69, 0xb1, 0xfe, 0xda,
+  0x5a, 0x39, 0x02, 0x4a, 0x8e, 0xb9, 0xd3, 0x7f, 0x24, 0x0f, 0x16, 0x86,
+  0x81, 0x59, 0xae, 0xcf, 0x18, 0x4c, 0xad, 0x14, 0x01, 0xfd, 0x4d, 0xfa,
+  0x31, 0x1f, 0xcf, 0xc7, 0x1c, 0xff, 0x8c, 0xe9, 0xf6, 0xfc, 0xad, 0x58,
+  0x99, 0xf1, 0xb6, 0xa0, 0xb0, 0x17, 0x1a, 0xd2, 0x5a, 0xe9, 0x4d, 0x4d,
+  0x94, 0x3d, 0x0d, 0x17, 0x57, 0xd7, 0x47, 0x43, 0x33, 0x04, 0xc9, 0x38,
+  0x0f, 0x08, 0xfc, 0xfa, 0x38, 0x5c, 0xce, 0x29, 0x1a, 0xb7, 0x19, 0x1e,
+  0x8d, 0xc1, 0xf3, 0xac, 0xe4, 0x8e, 0x14, 0x52, 0xb1, 0xab, 0x84, 0xc5,
+  0x5a, 0xd8, 0xd3, 0xbc, 0x18, 0xf0, 0xf5, 0xc1, 0x59, 0x68, 0xc0, 0xc7,
+  0xd8, 0x77, 0x4a, 0xbe, 0x6e, 0xc2, 0x7c, 0x6f, 0x4a, 0x00, 0x40, 0x00,
+  0x57, 0xac, 0x29, 0x04, 0xca, 0x7a, 0x3e, 0x36, 0x14, 0x9a, 0xae, 0xda,
+  0x42, 0xdd, 0x87, 0x82, 0xf9, 0xcb, 0x57, 0x7e, 0x2d, 0xe3, 0x49, 0x6c,
+  0x27, 0x29, 0x08, 0x61, 0x88, 0x2f, 0xd6, 0xdd, 0xa0, 0x9b, 0x5b, 0x5f,
+  0x0f, 0xd1, 0x54, 0x30, 0x26, 0xc6, 0x51, 0xbe, 0x12, 0x7f, 0xd2, 0x28,
+  0xf2, 0xad, 0x7a, 0x38, 0x0d, 0xb6, 0x56, 0xf4, 0xd4, 0x2e, 0xa3, 0x17,
+  0x49, 0x40, 0xf4, 0xf1, 0xa1, 0x53, 0x61, 0xed, 0x68, 0xe9, 0x98, 0x65,
+  0x02, 0x69, 0xa2, 0x97, 0x9d, 0x82, 0x51, 0x24, 0xd5, 0xdd, 0x25, 0x5f,
+  0x3d, 0x7f, 0x7b, 0x9e, 0x08, 0x8c, 0xa8, 0xa8, 0x4d, 0x78, 0x71, 0x8b,
+  0xf2, 0x8a, 0xef, 0x5c, 0x60, 0x91, 0x32, 0xb6, 0xf8, 0x92, 0x68, 0x9f,
+  0xfc, 0xf9, 0xdd, 0xf1, 0x61, 0xe2, 0x8a, 0x1c, 0x29, 0x06, 0x06, 0x66,
+  0x26, 0x77, 0x93, 0xc8, 0xd4, 0x5a, 0x23, 0xa4, 0x4f, 0x33, 0xb8, 0xc6,
+  0x17, 0x43, 0x4c, 0xf6, 0xe5, 0x22, 0xdd, 0x47, 0x3d, 0xed, 0x6c, 0x35,
+  0x92, 0xfe, 0x9d, 0xef, 0xec, 0x76, 0xb7, 0x1f, 0xaf, 0x76, 0x60, 0x10,
+  0x9e, 0x83, 0xa3, 0xfd, 0xeb, 0x27, 0xa6, 0x48, 0x9e, 0xbd, 0x3a, 0x39,
+  0xbf, 0xd8, 0xde, 0x3f, 0x3d, 0x39, 0x83, 0x9f, 0xf8, 0xfb, 0x0e, 0xfd,
+  0xbe, 0xf3, 0x7d, 0xb0, 0x88, 0xfb, 0x44, 0x6d, 0xb4, 0x60, 0x51, 0x10,
+  0x26, 0xf1, 0x3f, 0xa2, 0x87, 0x96, 0x6b, 0xa1, 0x05, 0x8a, 0x47, 0x8e,
+  0x6e, 0x44, 0xe9, 0x21, 0x78, 0xcb, 0x5b, 0xae, 0xed, 0x96, 0x06, 0x77,
+  0xd6, 0xe2, 0x8c, 0xf5, 0x78, 0x59, 0x74, 0x35, 0x74, 0x99, 0x12, 0x14,
+  0xab, 0x4f, 0x25, 0x90, 0xfc, 0xee, 0x40, 0x3c, 0x54, 0x40, 0x4f, 0x90,
+  0x5a, 0xde, 0x9e, 0x5c, 0x24, 0x29, 0x67, 0x25, 0xc8, 0xfd, 0xc0, 0xc5,
+  0xcc, 0x36, 0xd9, 0x9b, 0xc3, 0x35, 0x64, 0x9c, 0x3c, 0xae, 0x20, 0x00,
+  0x34, 0x1f, 0xa0, 0x99, 0x4d, 0x34, 0xc4, 0x4b, 0xf0, 0xe0, 0xf9, 0xdb,
+  0xe3, 0x76, 0xe4, 0x74, 0xf2, 0x3e, 0xa3, 0x8d, 0x60, 0xec, 0x57, 0xbc,
+  0x1f, 0x17, 0x88, 0x1b, 0xc0, 0xa3, 0x95, 0x10, 0x78, 0x95, 0x18, 0x0a,
+  0xbf, 0x25, 0x6b, 0xa5, 0x98, 0x5a, 0x58, 0x1e, 0xec, 0x56, 0x9c, 0xbe,
+  0x98, 0x86, 0x22, 0x90, 0x3f, 0xa8, 0x9c, 0xe0, 0xf8, 0x25, 0x92, 0xea,
+  0x56, 0x53, 0xdf, 0x61, 0x22, 0x3c, 0x8f, 0xae, 0x2e, 0x6b, 0x4b, 0x8e,
+  0x41, 0x4b, 0x96, 0x97, 0x2d, 0x62, 0x9c, 0x0e, 0x10, 0x3a, 0xb0, 0x1e,
+  0x34, 0x91, 0x8e, 0xbb, 0x99, 0x97, 0x9a, 0xd1, 0x4f, 0x7b, 0xbc, 0x86,
+  0x12, 0x48, 0x7e, 0x49, 0xa0, 0x8f, 0x56, 0x2f, 0x0e, 0x5b, 0xf7, 0x1d,
+  0x6b, 0x1e, 0x42, 0x78, 0x22, 0xa8, 0x83, 0xd5, 0x42, 0xd8, 0x3c, 0x05,
+  0xfc, 0xce, 0x54, 0xdb, 0xe1, 0x51, 0xb4, 0x13, 0xe2, 0x93, 0x66, 0xc8,
+  0x17, 0x1e, 0x35, 0x4e, 0x2b, 0x41, 0x95, 0xa3, 0x56, 0x2d, 0xa9, 0xda,
+  0x0d, 0x90, 0x30, 0xcd, 0x14, 0x57, 0x99, 0x66, 0x47, 0xa1, 0xe1, 0xd2,
+  0x10, 0x57, 0x7c, 0x42, 0xee, 0x65, 0x29, 0x77, 0xad, 0xed, 0x9d, 0xaf,
+  0xbb, 0x5b, 0xf0, 0xbf, 0x6d, 0x09, 0x28, 0x09, 0x75, 0x77, 0x68, 0x79,
+  0x25, 0x8d, 0x53, 0x5f, 0x90, 0xfd, 0xd2, 0x13, 0x55, 0xcc, 0xa8, 0x82,
+  0x55, 0x74, 0x89, 0x39, 0x24, 0x47, 0xc7, 0xe2, 0x7d, 0xde, 0x67, 0x38,
+  0x8e, 0x49, 0x58, 0xa3, 0x70, 0x1a, 0x6c, 0x44, 0x71, 0x38, 0x17, 0xca,
+  0xbf, 0x6e, 0x99, 0x49, 0x71, 0xa8, 0x9f, 0xfe, 0xc2, 0x37, 0xbe, 0xbf,
+  0x6f, 0x2d, 0xed, 0x27, 0xcd, 0x70, 0xfa, 0x2b, 0x0f, 0x9c, 0x91, 0xc2,
+  0x42, 0xf5, 0x3f, 0x0e, 0x33, 0xb7, 0xf6, 0x35, 0xa6, 0xfe, 0x93, 0x87,
+  0xbb, 0x30, 0xc6, 0xe6, 0x21, 0x46, 0xef, 0x78, 0xc3, 0xcb, 0xef, 0x81,
+  0xdd, 0x58, 0xb2, 0x6a, 0x8f, 0x1f, 0xef, 0xee, 0xeb, 0xdf, 0xc0, 0x4f,
+  0xf6, 0x9f, 0xc2, 0x07, 0xf7, 0x66, 0xc0, 0x2e, 0xc5, 0xe1, 0x60, 0xb7,
+  0x80, 0x32, 0xd7, 0xc3, 0x76, 0x9c, 0x53, 0x9e, 0x3c, 0x2b, 0x86, 0x43,
+  0xb8, 0x25, 0xbe, 0x37, 0x67, 0xc2, 0x1c, 0x0f, 0x94, 0x25, 0x98, 0x3a,
+  0xb4, 0x59, 0xcb, 0x75, 0x66, 0xe1, 0x80, 0x80, 0x5a, 0x13, 0x7e, 0x5b,
+  0x14, 0x0d, 0x97, 0xc8, 0xc1, 0x9f, 0x9b, 0x93, 0x91, 0xd0, 0xb5, 0x94,
+  0xc1, 0x91, 0xb7, 0xcb, 0x15, 0xae, 0xa0, 0x0b, 0xaf, 0xfc, 0x90, 0x4f,
+  0xa7, 0xa4, 0x34, 0x51, 0xc9, 0xad, 0x18, 0xa4, 0x01, 0x9b, 0x08, 0x71,
+  0x48, 0x16, 0x6f, 0x40, 0x69, 0xdc, 0x2c, 0x23, 0xf7, 0xb2, 0x61, 0x31,
+  0xd3, 0x1a, 0x37, 0x1e, 0x33, 0xd7, 0x88, 0x9a, 0x63, 0x6e, 0x11, 0xd5,
+  0x86, 0x13, 0x2e, 0xd1, 0x74, 0x42, 0x3b, 0x48, 0x46, 0x26, 0xc1, 0xad,
+  0xe0, 0xab, 0x33, 0x60, 0x0b, 0x04, 0x4b, 0xe8, 0xf9, 0xf1, 0xff, 0x38,
+  0x12, 0x22, 0x2b, 0xb5, 0x78, 0x21, 0x19, 0x15, 0x49, 0x57, 0x0e, 0xe9,
+  0xb0, 0x49, 0xab, 0x73, 0x98, 0x74, 0x5a, 0x5a, 0x80, 0x01, 0xcb, 0x31,
+  0x58, 0x74, 0x72, 0xec, 0xd6, 0x21, 0x2d, 0x41, 0xa0, 0x2f, 0x41, 0xa0,
+  0xd8, 0xbc, 0x02, 0x29, 0x4f, 0x07, 0xcb, 0xb8, 0x89, 0x71, 0x2a, 0x7e,
+  0xa8, 0xb2, 0x69, 0xa9, 0x33, 0xbc, 0x13, 0xac, 0x56, 0x6f, 0xe6, 0x13,
+  0x54, 0xae, 0x19, 0x50, 0xc6, 0x1a, 0x1a, 0x32, 0xbc, 0x0a, 0x63, 0xaa,
+  0xce, 0xcd, 0x88, 0xa3, 0xc9, 0x7d, 0x2c, 0x84, 0xbb, 0x4b, 0xce, 0xc1,
+  0xc6, 0x1a, 0x96, 0x87, 0x0a, 0x62, 0x84, 0x23, 0x4b, 0x2c, 0xea, 0xf4,
+  0xdd, 0x85, 0xb0, 0x69, 0x4d, 0x56, 0x4f, 0x29, 0x9c, 0x5b, 0x96, 0xe6,
+  0x72, 0x0e, 0xd2, 0x14, 0x5c, 0xc5, 0xaa, 0x81, 0x52, 0x73, 0x56, 0x36,
+  0x54, 0xdd, 0x16, 0x54, 0x88, 0xc1, 0xd2, 0x2e, 0xc8, 0xf9, 0x44, 0xb9,
+  0xb4, 0xa8, 0x86, 0xc8, 0xfc, 0x3d, 0xfa, 0x35, 0xaf, 0x22, 0x4d, 0xdd,
+  0x95, 0xb5, 0x31, 0xa7, 0x57, 0x94, 0x1d, 0x95, 0x4c, 0xe7, 0xb3, 0x69,
+  0x51, 0x2a, 0x9e, 0x04, 0x61, 0x10, 0x52, 0xd1, 0x48, 0x34, 0x02, 0x4a,
+  0x9e, 0x0d, 0x4e, 0x94, 0xa0, 0x24, 0x0c, 0x46, 0x82, 0x7a, 0xc1, 0x30,
+  0x76, 0xb5, 0x6b, 0xc2, 0x1a, 0x21, 0x90, 0xb2, 0x5c, 0xa1, 0x05, 0xe1,
+  0x88, 0x98, 0x76, 0x97, 0x12, 0x09, 0x00, 0xa3, 0x8e, 0x04, 0xe0, 0xa6,
+  0xe2, 0x89, 0xb8, 0x2c, 0xe3, 0x79, 0x25, 0xfe, 0xfc, 0xec, 0x63, 0x7f,
+  0x04, 0x0b, 0x0a, 0xe7, 0x53, 0x5c, 0x32, 0x84, 0xf6, 0xb0, 0x4f, 0xb2,
+  0xbe, 0x98, 0x78, 0xb5, 0x7a, 0x25, 0xde, 0x7d, 0xc1, 0x73, 0x38, 0x96,
+  0xf4, 0x24, 0xb1, 0x9b, 0x35, 0x41, 0x34, 0xb0, 0xf3, 0x01, 0x0b, 0x9e,
+  0x65, 0x62, 0x62, 0x94, 0x02, 0x1e, 0xd7, 0x59, 0x07, 0x14, 0x56, 0xae,
+  0xca, 0x14, 0xe0, 0xd6, 0x42, 0x3d, 0xcb, 0x38, 0xfe, 0x33, 0x4e, 0xe7,
+  0xf6, 0x08, 0x14, 0xea, 0x0f, 0x76, 0x0c, 0xa4, 0x29, 0xd6, 0xe9, 0xf3,
+  0x80, 0x02, 0x6a, 0x62, 0x28, 0x1c, 0xa3, 0x7b, 0xc5, 0xce, 0xc3, 0xe4,
+  0xf1, 0xd6, 0xd6, 0x8a, 0x5c, 0x11, 0x97, 0x59, 0xd9, 0x60, 0x8f, 0xd9,
+  0x60, 0xf1, 0x21, 0xcf, 0x92, 0x67, 0xe8, 0x85, 0xfb, 0x9f, 0x4d, 0x48,
+  0x5a, 0x1b, 0x49, 0x2c, 0x01, 0xb2, 0x53, 0x88, 0x10, 0x02, 0xcb, 0x11,
+  0x6a, 0x12, 0xa3, 0x90, 0x1a, 0x42, 0x56, 0x4e, 0x6a, 0x4f, 0x11, 0xd6,
+  0xe3, 0x03, 0x12, 0x42, 0x5e, 0x48, 0x1e, 0xd8, 0xa7, 0x80, 0xe4, 0x88,
+  0x39, 0x1a, 0xd6, 0x34, 0xbe, 0x6f, 0xd8, 0x58, 0x7c, 0x14, 0x85, 0x1b,
+  0x89, 0x21, 0x40, 0xe2, 0xa8, 0xb8, 0x3b, 0xe1, 0xef, 0xc8, 0x1d, 0x34,
+  0x32, 0x08, 0x96, 0x96, 0x20, 0x7c, 0xb1, 0x41, 0x87, 0x14, 0x60, 0x65,
+  0x64, 0x4c, 0x14, 0x50, 0xcb, 0xb5, 0x36, 0x9e, 0x26, 0xad, 0xf3, 0xac,
+  0xea, 0x70, 0xcb, 0xfb, 0xad, 0x24, 0x54, 0xbd, 0x15, 0x57, 0xa5, 0x80,
+  0xea, 0xf4, 0xcc, 0xb0, 0x20, 0x01, 0xf0, 0x22, 0x95, 0x60, 0x25, 0xeb,
+  0xed, 0xef, 0x7e, 0x3a, 0x78, 0xfd, 0xee, 0x68, 0xfb, 0x5b, 0x10, 0x77,
+  0xe1, 0xcf, 0x1d, 0xfe, 0x73, 0x07, 0x11, 0x34, 0x99, 0xeb, 0xc8, 0xf5,
+  0xc1, 0xd5, 0xa6, 0xf9, 0x14, 0x07, 0xcc, 0x5f, 0xcd, 0xc1, 0xc2, 0x01,
+  0xa0, 0x6d, 0x84, 0x8d, 0xb2, 0xd3, 0x62, 0x3a, 0x1f, 0x71, 0x20, 0x24,
+  0x6a, 0xb6, 0xb6, 0xd2, 0x3c, 0xf7, 0x90, 0x8a, 0x43, 0xe1, 0x50, 0xec,
+  0x67, 0xb6, 0xe8, 0x2e, 0xad, 0xc5, 0x92, 0x73, 0x06, 0x49, 0xc0, 0x1c,
+  0x51, 0x89, 0x6d, 0xbd, 0x94, 0xc4, 0x2a, 0xf3, 0x01, 0x2a, 0x46, 0xb6,
+  0x73, 0x8e, 0x13, 0x50, 0xd4, 0x60, 0xce, 0x96, 0xe4, 0x18, 0x48, 0xa1,
+  0xad, 0x26, 0x33, 0xf2, 0xfb, 0xb3, 0xfc, 0x52, 0x7a, 0xf4, 0x6b, 0x76,
+  0xe9, 0x88, 0x80, 0x8c, 0x43, 0xe0, 0x32, 0x4b, 0xc4, 0x2d, 0xdc, 0x16,
+  0x12, 0x45, 0x90, 0x5b, 0xcb, 0x6c, 0x2f, 0x40, 0x26, 0xc7, 0x43, 0x76,
+  0x43, 0xb6, 0xbe, 0x6b, 0x25, 0xe5, 0xed, 0xb8, 0x57, 0x8c, 0x9c, 0x7b,
+  0xdb, 0x0c, 0x43, 0x21, 0x78, 0x5e, 0xb3, 0x0a, 0x44, 0x87, 0x51, 0x14,
+  0x36, 0x67, 0xcf, 0x37, 0xa3, 0xb8, 0xf9, 0x01, 0x3d, 0x9a, 0x44, 0x45,
+  0x60, 0x3b, 0x32, 0x30, 0xf6, 0x08, 0x3a, 0x78, 0x0b, 0xd5, 0xef, 0xf1,
+  0x48, 0x11, 0xd2, 0x7f, 0x6a, 0x6e, 0x11, 0xdd, 0x13, 0x09, 0xc2, 0x96,
+  0xe8, 0x50, 0x0f, 0x2b, 0x84, 0x01, 0x52, 0x81, 0xdd, 0xc3, 0x21, 0xe5,
+  0x8a, 0x05, 0xba, 0xd5, 0xfc, 0x06, 0xe9, 0x06, 0xbd, 0x8c, 0x34, 0xe2,
+  0xdb, 0xc4, 0xa0, 0xa5, 0x48, 0x27, 0xf6, 0xf7, 0x95, 0x05, 0x9a, 0x16,
+  0xe3, 0x9e, 0x5c, 0xe9, 0x51, 0x4a, 0x56, 0xa7, 0x63, 0x39, 0xd4, 0xe1,
+  0xfc, 0x22, 0xf7, 0x43, 0x00, 0xf8, 0xe0, 0xed, 0xe5, 0xc2, 0x32, 0x1e,
+  0xa9, 0xae, 0x8c, 0xfc, 0x8a, 0x6c, 0xcb, 0x5d, 0xf0, 0xb6, 0xc8, 0x0a,
+  0x0a, 0x08, 0x0d, 0x33, 0x64, 0x76, 0x29, 0x20, 0x68, 0x28, 0x62, 0x86,
+  0x4a, 0x00, 0x41, 0x3a, 0x28, 0xa3, 0x4a, 0x43, 0x65, 0x1d, 0x7a, 0x2a,
+  0xb8, 0xea, 0x82, 0xb3, 0x22, 0xe7, 0x7a, 0x0a, 0x5e, 0xf1, 0x82, 0x66,
+  0x5b, 0x1b, 0x16, 0x1c, 0x16, 0xce, 0x2e, 0xdd, 0x13, 0xb2, 0xf4, 0x24,
+  0x00, 0xe8, 0x99, 0xb9, 0x67, 0x77, 0xac, 0x04, 0xb8, 0x2a, 0x6e, 0xb2,
+  0x0f, 0xfe, 0x36, 0xd1, 0xac, 0xe3, 0x71, 0x5a, 0x59, 0x96, 0x86, 0x3a,
+  0x90, 0x89, 0x6e, 0xf4, 0x25, 0x99, 0x8e, 0xf1, 0x06, 0x34, 0x21, 0xea,
+  0xfe, 0x10, 0xff, 0xb2, 0x5b, 0x7a, 0x3d, 0xb0, 0x17, 0x14, 0x00, 0x6e,
+  0x47, 0xd9, 0x86, 0xe9, 0x3c, 0xc9, 0xdb, 0xac, 0x22, 0x7f, 0xda, 0xa6,
+  0x01, 0x14, 0x70, 0xfb, 0x2e, 0x97, 0x47, 0xd2, 0x6d, 0xea, 0x83, 0x0c,
+  0xea, 0x9d, 0xdd, 0x59, 0xbc, 0x22, 0xa5, 0x5d, 0xa4, 0xec, 0x97, 0x9e,
+  0x50, 0x29, 0xa7, 0xe4, 0x6d, 0xa1, 0x43, 0x57, 0xe7, 0x76, 0x46, 0xee,
+  0x94, 0x2a, 0x13, 0x98, 0x8b, 0x54, 0x12, 0xbe, 0xba, 0x58, 0xf7, 0x4d,
+  0x22, 0x95, 0x8d, 0x52, 0x55, 0x25, 0xb5, 0x7e, 0x3a, 0xbf, 0x69, 0xe8,
+  0x8b, 0x01, 0xb8, 0x3f, 0x72, 0xd8, 0xf3, 0xfa, 0xbc, 0x9b, 0x3b, 0xdb,
+  0x75, 0x65, 0x6d, 0xb9, 0xb6, 0x87, 0x60, 0xdc, 0x5b, 0xd4, 0x3e, 0xc3,
+  0x6f, 0x9a, 0xec, 0x6a, 0x1e, 0x66, 0x9d, 0x18, 0x87, 0xb6, 0x13, 0x0e,
+  0x26, 0x21, 0xab, 0xb1, 0x80, 0xcb, 0x98, 0x9d, 0xa0, 0xb1, 0x72, 0x2c,
+  0x04, 0xd6, 0x28, 0x27, 0xbb, 0x5b, 0x61, 0x60, 0x1e, 0x12, 0x47, 0x44,
+  0x29, 0xe4, 0x98, 0xd1, 0xa0, 0xef, 0xc0, 0xff, 0xbb, 0x01, 0x92, 0xfc,
+  0xb2, 0xce, 0x58, 0x78, 0xbc, 0x1c, 0x82, 0xe1, 0x2e, 0x2b, 0x56, 0xce,
+  0x7b, 0xfc, 0x5e, 0x49, 0x1b, 0xc8, 0x36, 0x5d, 0x2c, 0x21, 0xbb, 0x6f,
+  0xd3, 0xd5, 0xed, 0xac, 0x6d, 0x1a, 0x06, 0x60, 0x97, 0x5c, 0xf6, 0x3d,
+  0xe1, 0xda, 0x05, 0x6c, 0xfd, 0x2b, 0x10, 0xf6, 0x22, 0xa2, 0x2a, 0xad,
+  0x47, 0xe3, 0xbc, 0x20, 0xec, 0x78, 0x14, 0x43, 0xd6, 0x74, 0xc0, 0x99,
+  0x0c, 0xfa, 0x3c, 0xfa, 0x51, 0x03, 0x8a, 0x12, 0xbb, 0xdb, 0xca, 0xc2,
+  0xc4, 0x57, 0xea, 0x21, 0xd0, 0x46, 0xb0, 0x4c, 0xfb, 0x6d, 0x8c, 0x0c,
+  0xe6, 0x91, 0x30, 0x27, 0xc2, 0x5d, 0xb4, 0xbb, 0x71, 0xe6, 0x0e, 0xd1,
+  0xde, 0x29, 0x5a, 0x68, 0x4e, 0xb1, 0x44, 0x4f, 0x3f, 0x39, 0xa7, 0x2a,
+  0x19, 0xc9, 0xeb, 0xbc, 0xac, 0x36, 0x34, 0xc2, 0x8b, 0xbd, 0x42, 0x83,
+  0xac, 0xc2, 0x5b, 0x22, 0xd8, 0x08, 0x07, 0x39, 0xac, 0xd5, 0x6c, 0x50,
+  0x86, 0xc9, 0x87, 0x9a, 0x7e, 0xb5, 0x6a, 0xe5, 0x64, 0x09, 0xe0, 0x02,
+  0x1c, 0x4a, 0x25, 0xa5, 0xb3, 0x19, 0xc9, 0x31, 0x24, 0x67, 0x61, 0x26,
+  0x49, 0x93, 0x6c, 0xf7, 0xa0, 0x0c, 0x4d, 0x3d, 0xe7, 0xd1, 0xf8, 0x59,
+  0x0a, 0x0c, 0x09, 0x9f, 0xcc, 0x47, 0x71, 0x2a, 0xd1, 0xa8, 0x43, 0x50,
+  0x4c, 0x2a, 0xe9, 0xd1, 0x2c, 0xaf, 0x54, 0xc5, 0x94, 0x02, 0xf7, 0xa9,
+  0x84, 0xaf, 0xf2, 0x91, 0x68, 0x69, 0x3f, 0x5f, 0x65, 0xae, 0x09, 0x85,
+  0x3d, 0x84, 0xfb, 0xbc, 0x4f, 0x2a, 0xec, 0xc9, 0x28, 0x96, 0x86, 0x8a,
+  0x2e, 0x7d, 0xb8, 0xd3, 0xff, 0xb4, 0x57, 0xa9, 0xce, 0xe8, 0x7f, 0xa5,
+  0x93, 0x55, 0x23, 0x52, 0x03, 0x9d, 0xb1, 0x72, 0xfe, 0xdb, 0x7c, 0xf2,
+  0xa1, 0x23, 0xb5, 0x72, 0x3a, 0x81, 0x05, 0xd3, 0xd2, 0xf5, 0xdb, 0xf1,
+  0x1b, 0xcf, 0x9a, 0x45, 0x54, 0xf3, 0x77, 0x17, 0x7a, 0x85, 0xd2, 0xd8,
+  0xe9, 0xd6, 0xa4, 0xe3, 0xc5, 0x97, 0xaf, 0xd5, 0x34, 0x21, 0x3b, 0x4a,
+  0xcc, 0xfd, 0x08, 0xbc, 0xd5, 0x63, 0xb7, 0x26, 0x01, 0x04, 0x51, 0x6a,
+  0xb4, 0x59, 0x3d, 0x42, 0x7c, 0x3d, 0x3e, 0xa0, 0x28, 0x92, 0xe9, 0xa5,
+  0xde, 0x61, 0xa8, 0x54, 0x27, 0x0b, 0x03, 0xef, 0xa4, 0xc2, 0x08, 0x2a,
+  0xcf, 0xaa, 0xf8, 0x27, 0x67, 0x5a, 0x23, 0xe9, 0x0d, 0x58, 0x5b, 0xd8,
+  0xa8, 0x96, 0xc7, 0xe9, 0x62, 0x15, 0xfb, 0x49, 0xc2, 0x4e, 0x87, 0xd0,
+  0x31, 0x9e, 0x8b, 0x0f, 0x93, 0xe2, 0x86, 0xea, 0x6c, 0x3a, 0x87, 0xa6,
+  0xc8, 0x39, 0x70, 0xec, 0xbd, 0x15, 0xb5, 0x4a, 0x58, 0x07, 0x2a, 0x19,
+  0x1e, 0x9f, 0x3d, 0x4e, 0x70, 0x2d, 0x18, 0xca, 0x6d, 0x3c, 0x21, 0xbd,
+  0xe7, 0x16, 0x50, 0x40, 0x4c, 0xef, 0x36, 0xd6, 0xd6, 0x77, 0xec, 0x5c,
+  0x53, 0x41, 0x85, 0xeb, 0x93, 0x6c, 0xeb, 0xef, 0x75, 0xf3, 0xf8, 0xc7,
+  0x12, 0x43, 0x1b, 0xa3, 0x10, 0xda, 0xee, 0x92, 0x2e, 0xeb, 0xd7, 0x91,
+  0x54, 0x7b, 0xbc, 0xe7, 0xd2, 0xab, 0xb1, 0xb1, 0xc8, 0x58, 0x4d, 0x25,
+  0xb6, 0xa5, 0x8e, 0x21, 0x5c, 0x7e, 0xd1, 0x8d, 0x2f, 0xb1, 0xeb, 0xa9,
+  0x03, 0xb3, 0x0b, 0x57, 0x1f, 0x87, 0x89, 0x2d, 0xbd, 0xf8, 0xa2, 0x4b,
+  0x2f, 0xf9, 0x11, 0x19, 0xac, 0x2a, 0x97, 0xbe, 0x52, 0x80, 0x31, 0x54,
+  0x0f, 0x3e, 0xb2, 0x5c, 0x5d, 0xbe, 0x5b, 0x74, 0xe1, 0xdb, 0x88, 0xe4,
+  0xca, 0x1a, 0x8a, 0xc9, 0x4c, 0x0c, 0x05, 0x38, 0xcc, 0xc0, 0xe6, 0x58,
+  0x2f, 0xd6, 0x46, 0xbc, 0x00, 0x1b, 0x3a, 0xd2, 0x70, 0xd3, 0x9a, 0x9c,
+  0x27, 0x2f, 0xe1, 0x7a, 0x8a, 0xaa, 0x8c, 0x1c, 0x55, 0x89, 0x4c, 0x2a,
+  0x1a, 0xf2, 0x26, 0xf1, 0x06, 0xde, 0x5c, 0x15, 0xa3, 0xc8, 0xb3, 0x5a,
+  0x2b, 0x63, 0xc3, 0x05, 0x56, 0xb0, 0xc6, 0x1d, 0xc5, 0x53, 0x11, 0x65,
+  0x73, 0x90, 0x29, 0x0b, 0x7c, 0xa4, 0x9f, 0x23, 0x76, 0xff, 0x0c, 0xdd,
+  0x9a, 0x9c, 0x05, 0xaf, 0x8c, 0x54, 0x50, 0xbf, 0x19, 0x76, 0x39, 0x85,
+  0xa3, 0x3d, 0xe3, 0xc2, 0x87, 0x52, 0x1e, 0x09, 0x4d, 0x67, 0x3d, 0xaa,
+  0xa3, 0x9b, 0xb2, 0x06, 0x40, 0xe1, 0x58, 0x44, 0x02, 0xd7, 0x39, 0xa2,
+  0xd1, 0x2a, 0x21, 0x67, 0xd9, 0x80, 0x2f, 0x4a, 0xe2, 0x10, 0x97, 0x94,
+  0x1e, 0xc9, 0x15, 0x58, 0x44, 0xb2, 0x36, 0xf4, 0x5a, 0x8c, 0x3a, 0xba,
+  0xc2, 0x60, 0x9e, 0x32, 0xaf, 0xe6, 0xc2, 0x0c, 0x62, 0x87, 0x94, 0x27,
+  0xb7, 0xbb, 0x33, 0x9e, 0x5c, 0xb6, 0xd3, 0xa7, 0x3b, 0xa4, 0xfa, 0x2c,
+  0x82, 0x75, 0x28, 0x62, 0x64, 0x99, 0x23, 0xf6, 0xce, 0x17, 0x80, 0x55,
+  0x23, 0x29, 0x77, 0x60, 0x24, 0xe5, 0x27, 0xf1, 0xea, 0x15, 0xf8, 0x74,
+  0x87, 0x09, 0xa2, 0x03, 0x9a, 0x5f, 0xe9, 0xac, 0x6b, 0xa6, 0xa0, 0x81,
+  0xe4, 0xff, 0x9b, 0x18, 0x01, 0x9c, 0x82, 0xa2, 0x95, 0x92, 0x42, 0x8c,
+  0x8f, 0xd4, 0x38, 0xa4, 0xc6, 0xca, 0x60, 0xb3, 0x9c, 0x64, 0x08, 0xa6,
+  0x80, 0x98, 0x54, 0x02, 0x25, 0x1a, 0xdc, 0xf8, 0xc9, 0x55, 0x0e, 0xeb,
+  0x3c, 0xeb, 0x5f, 0xdd, 0x92, 0x2b, 0x01, 0xdd, 0x14, 0xd9, 0xa0, 0x1b,
+  0x1b, 0x2d, 0xe4, 0x8c, 0x70, 0xab, 0x9a, 0xf1, 0x21, 0x2d, 0x10, 0xcb,
+  0x43, 0xb5, 0x11, 0x9e, 0xc3, 0x7d, 0x8b, 0xf5, 0x27, 0x1d, 0x5f, 0xdc,
+  0x10, 0xa9, 0x5b, 0xc6, 0x73, 0x38, 0x77, 0x06, 0xf1, 0x03, 0x02, 0xd5,
+  0xd0, 0x1e, 0x8b, 0x1c, 0xce, 0x6d, 0xe0, 0xd2, 0x74, 0x35, 0x4c, 0x3b,
+  0xab, 0x35, 0x24, 0xdd, 0x98, 0xf6, 0x43, 0x4c, 0x76, 0x52, 0x38, 0x90,
+  0x0f, 0x8a, 0xd2, 0xd4, 0x82, 0xf0, 0x6e, 0xec, 0x16, 0x24, 0x2e, 0x53,
+  0x08, 0x91, 0xe2, 0x02, 0x31, 0x3b, 0x29, 0xa2, 0xa9, 0x52, 0xbc, 0x82,
+  0xc0, 0xcd, 0xca, 0x7e, 0x1f, 0xca, 0x59, 0x8e, 0x56, 0x04, 0x9f, 0x1b,
+  0xa7, 0x03, 0x45, 0x0e, 0x18, 0x63, 0x41, 0xe8, 0x64, 0xeb, 0xeb, 0xbd,
+  0x2d, 0xca, 0xa6, 0xf0, 0xe0, 0x1c, 0x01, 0xdd, 0x96, 0x33, 0x37, 0x83,
+  0xfa, 0x54, 0xe8, 0x9a, 0x1b, 0x54, 0x64, 0xdc, 0x07, 0xbb, 0x8c, 0x55,
+  0x34, 0x45, 0x83, 0x33, 0xe9, 0x41, 0x18, 0x13, 0xdd, 0x26, 0x65, 0xf4,
+  0x56, 0x4f, 0xd9, 0xb0, 0x9a, 0x7a, 0x0a, 0xab, 0xc7, 0x32, 0x87, 0x6f,
+  0x16, 0x62, 0x98, 0x3f, 0x33, 0x4b, 0xcb, 0xf5, 0x75, 0xb7, 0xf7, 0xc2,
+  0x75, 0x6d, 0xd4, 0x62, 0x28, 0x12, 0x9b, 0xab, 0xe7, 0xe9, 0xd4, 0x66,
+  0x28, 0x47, 0xce, 0x91, 0x4e, 0xed, 0xa0, 0x61, 0xcb, 0x1d, 0xda, 0x95,
+  0x67, 0xf8, 0x53, 0xc5, 0x21, 0x82, 0x04, 0xc6, 0xc0, 0x72, 0x0c, 0xe2,
+  0x11, 0xd8, 0x63, 0x93, 0x70, 0x35, 0x39, 0x5a, 0x77, 0x85, 0xcd, 0xe4,
+  0x5a, 0x50, 0x56, 0x36, 0x42, 0x55, 0x6a, 0xcb, 0xd5, 0x08, 0x48, 0x41,
+  0xae, 0xdc, 0xae, 0x77, 0x1f, 0x92, 0x74, 0xcd, 0xbc, 0x96, 0x40, 0x4b,
+  0xb9, 0x6e, 0xa5, 0x4a, 0xd1, 0x24, 0x8d, 0xad, 0xe1, 0x18, 0xd7, 0xe4,
+  0x0b, 0x0b, 0x7f, 0xe6, 0x90, 0xe9, 0x4a, 0xa8, 0x84, 0xc2, 0x39, 0xa8,
+  0xe0, 0x83, 0x83, 0x56, 0x0e, 0x67, 0x45, 0x03, 0xb8, 0xb6, 0x9e, 0x3c,
+  0x7e, 0x1c, 0x5d, 0x9f, 0x1e, 0x8d, 0x49, 0x83, 0x07, 0x26, 0x34, 0x87,
+  0x7e, 0x85, 0x8c, 0x5b, 0x1d, 0x2e, 0xec, 0x69, 0x34, 0x2b, 0x51, 0x37,
+  0x89, 0xf9, 0x78, 0x7d, 0x59, 0xef, 0x4a, 0x5f, 0x6d, 0xe2, 0xe5, 0xe6,
+  0x17, 0x59, 0x21, 0xcd, 0xa7, 0xde, 0xd7, 0xd6, 0xd7, 0x5f, 0x7f, 0x9d,
+  0x74, 0x2e, 0x98, 0x70, 0x58, 0xae, 0x59, 0x8c, 0x80, 0x9f, 0x64, 0x37,
+  0x2b, 0x00, 0xbd, 0xd6, 0x4f, 0x4a, 0x20, 0x9b, 0xd1, 0xd0, 0xa3, 0x62,
+  0xbf, 0x91, 0xfa, 0x17, 0xd7, 0x98, 0x4e, 0xc6, 0x92, 0xc7, 0x50, 0x3d,
+  0xbc, 0xa0, 0x84, 0xcd, 0x72, 0x12, 0x58, 0x67, 0x59, 0x35, 0x9f, 0x4d,
+  0x92, 0xe9, 0x68, 0x5e, 0xfa, 0x87, 0x0c, 0xbc, 0x8b, 0x5d, 0x13, 0x74,
+  0x4b, 0xa3, 0x17, 0x40, 0x3c, 0x27, 0x6f, 0x7e, 0x3a, 0x4f, 0xd6, 0x4f,
+  0xce, 0x37, 0x77, 0xbf, 0x21, 0xe8, 0xa9, 0xda, 0x59, 0x1d, 0x0d, 0x1f,
+  0x06, 0x83, 0x1a, 0x5b, 0xba, 0x6f, 0x9d, 0xa1, 0x2f, 0x58, 0x56, 0x96,
+  0x4c, 0x57, 0x48, 0x29, 0x80, 0xad, 0xe3, 0x12, 0x25, 0xd1, 0xb2, 0xe1,
+  0xdb, 0x8b, 0xa8, 0x7a, 0x32, 0xad, 0x2c, 0x09, 0xca, 0xb9, 0x30, 0x32,
+  0x4a, 0xd4, 0x53, 0xbb, 0x86, 0xd6, 0xf7, 0x89, 0x73, 0x7e, 0xd5, 0xd1,
+  0x78, 0xad, 0xe6, 0x39, 0x54, 0x8f, 0x59, 0x6c, 0x41, 0xdb, 0x9f, 0x41,
+  0x4f, 0x20, 0x94, 0x53, 0x9c, 0x04, 0x6f, 0x1a, 0xb1, 0x8f, 0x16, 0x72,
+  0x01, 0x39, 0x92, 0x6c, 0x6b, 0xf9, 0x90, 0x32, 0xfe, 0x2f, 0x99, 0x8d,
+  0x2d, 0x5d, 0xcc, 0xb2, 0xdf, 0x50, 0x9d, 0xff, 0x14, 0x98, 0x2c, 0x83,
+  0x53, 0x51, 0x04, 0x9e, 0xb0, 0xee, 0x94, 0x77, 0xd6, 0x94, 0x92, 0x98,
+  0x55, 0x01, 0xfc, 0x5f, 0x9e, 0xaa, 0x0a, 0x96, 0x77, 0xa5, 0xae, 0x28,
+  0xc6, 0x87, 0x58, 0xe9, 0x55, 0x8b, 0x4f, 0x19, 0x9b, 0x3d, 0x3c, 0xed,
+  0xa3, 0x98, 0x4c, 0x46, 0x9d, 0x22, 0x41, 0x10, 0x90, 0xa7, 0x8f, 0x77,
+  0x76, 0xda, 0xc9, 0x1e, 0x56, 0x72, 0x78, 0xa3, 0xd7, 0x47, 0x48, 0x50,
+  0x53, 0xb5, 0x3d, 0x2c, 0x9f, 0x81, 0xb0, 0x07, 0x40, 0x2c, 0x72, 0x4d,
+  0x09, 0xc2, 0xc7, 0x7e, 0x4b, 0xc2, 0x53, 0x5a, 0x7f, 0xd9, 0xd9, 0xdb,
+  0xdb, 0xfe, 0x66, 0xff, 0xb4, 0xb3, 0xb7, 0xb3, 0xdd, 0xda, 0x10, 0x39,
+  0x3c, 0xc4, 0xfd, 0x9b, 0xf4, 0x67, 0x81, 0xf2, 0x49, 0x3e, 0x60, 0x9b,
+  0x3a, 0x79, 0xc9, 0xd4, 0xb2, 0x6d, 0xd9, 0xa7, 0xad, 0xf2, 0x3d, 0xa7,
+  0xe6, 0x5a, 0x34, 0x49, 0xf9, 0x9e, 0x1d, 0x17, 0x2d, 0x11, 0x23, 0x09,
+  0x52, 0xca, 0x99, 0x30, 0x6d, 0x25, 0x85, 0x49, 0x03, 0x21, 0x5a, 0x6b,
+  0x8a, 0x1b, 0x65, 0xae, 0x59, 0x0e, 0x01, 0xaf, 0x43, 0x47, 0x39, 0x6b,
+  0x88, 0xd6, 0x87, 0x62, 0x06, 0xb8, 0x7e, 0x74, 0xb8, 0xc1, 0x5b, 0x10,
+  0x45, 0x77, 0x29, 0xe8, 0x39, 0x8f, 0xb4, 0x2d, 0xb5, 0x47, 0xec, 0x66,
+  0x99, 0x14, 0x13, 0xb2, 0x32, 0x63, 0xb8, 0x09, 0x2a, 0xe6, 0xf4, 0xd4,
+  0xa6, 0xb8, 0x5f, 0x34, 0x5b, 0xd4, 0xfb, 0x8a, 0x16, 0x4b, 0x8d, 0x2c,
+  0xe2, 0x47, 0xc9, 0x24, 0x29, 0x8d, 0x94, 0xed, 0x50, 0xf9, 0x04, 0x27,
+  0x14, 0xc1, 0x8c, 0xe0, 0xa9, 0x31, 0x58, 0x29, 0x3e, 0x1d, 0xfc, 0x5a,
+  0x63, 0x14, 0xd9, 0x82, 0xe7, 0xee, 0xf3, 0x20, 0xe4, 0xb8, 0x07, 0x26,
+  0x84, 0x15, 0xb1, 0xbb, 0x77, 0x6b, 0x2c, 0x5d, 0x93, 0x51, 0xe5, 0x6c,
+  0x0c, 0xda, 0x5a, 0x52, 0x8f, 0x9c, 0x76, 0xde, 0x10, 0x42, 0xe5, 0xaf,
+  0xf1, 0x8c, 0x48, 0xe8, 0x6d, 0xd0, 0x8e, 0xd9, 0x73, 0x45, 0x66, 0x26,
+  0xf2, 0x60, 0x6b, 0xa0, 0x8e, 0x16, 0x91, 0xc5, 0xb7, 0xbd, 0x23, 0xac,
+  0x1d, 0xd9, 0x00, 0x6f, 0xd2, 0x5b, 0x61, 0x3c, 0x49, 0x6f, 0x06, 0x64,
+  0x84, 0x85, 0x73, 0x51, 0x95, 0x23, 0x01, 0x2e, 0x95, 0x5b, 0x1f, 0xf9,
+  0x37, 0x30, 0x82, 0x51, 0xa8, 0xdb, 0x81, 0xf7, 0xf0, 0xab, 0x8b, 0x37,
+  0xaf, 0xa5, 0x80, 0x21, 0x45, 0x28, 0x51, 0xc6, 0x96, 0xb8, 0x03, 0xca,
+  0x79, 0x6f, 0x9c, 0xe3, 0x86, 0x55, 0x15, 0xaa, 0x55, 0x11, 0x44, 0x61,
+  0x5d, 0xb7, 0x75, 0xae, 0xc2, 0x24, 0x14, 0xcc, 0x90, 0xbf, 0x35, 0xcb,
+  0xd0, 0xe1, 0xfb, 0x9a, 0xb3, 0x81, 0x72, 0x9d, 0x17, 0x60, 0x18, 0x37,
+  0x3f, 0x76, 0x6e, 0x6e, 0x6e, 0x3a, 0x04, 0x50, 0x07, 0xcd, 0x53, 0xce,
+  0x23, 0x92, 0xc5, 0xa1, 0xc6, 0x41, 0x51, 0xae, 0x04, 0x7e, 0x1d, 0x4e,
+  0x12, 0xf6, 0xda, 0x99, 0xa5, 0x37, 0x5a, 0xe0, 0x92, 0x6a, 0xae, 0xb8,
+  0x42, 0x7a, 0x5c, 0xc1, 0x26, 0xe8, 0xb8, 0x6c, 0x6b, 0xe4, 0xaa, 0x8b,
+  0xb0, 0x0f, 0xea, 0x11, 0xb6, 0x0c, 0xd3, 0xb4, 0x0a, 0x35, 0xf0, 0x92,
+  0x1f, 0x7c, 0x99, 0x26, 0x90, 0x9c, 0xb1, 0xe0, 0xb9, 0x38, 0x2f, 0xe7,
+  0x33, 0x94, 0xce, 0xd0, 0xc1, 0x43, 0x70, 0x98, 0xe6, 0x22, 0x17, 0x23,
+  0xa7, 0xd5, 0xa4, 0x72, 0x96, 0x09, 0x1a, 0x2a, 0xbf, 0x11, 0x4c, 0x13,
+  0x28, 0x8f, 0xbf, 0x3b, 0x7b, 0xdd, 0xe1, 0xc9, 0x3a, 0xae, 0xcf, 0xf4,
+  0x4c, 0x79, 0x32, 0xb4, 0x53, 0x40, 0x31, 0x23, 0x2e, 0xad, 0x87, 0x97,
+  0x11, 0x36, 0x2b, 0x2d, 0xda, 0x4a, 0xb9, 0xb3, 0x29, 0xf5, 0x35, 0x59,
+  0xa9, 0x74, 0x35, 0xde, 0x48, 0xd8, 0x0c, 0xa9, 0x2b, 0x14, 0x7e, 0xa0,
+  0xb9, 0xfe, 0xde, 0xb0, 0x1c, 0xc2, 0x90, 0x45, 0xae, 0xe2, 0xcd, 0x9d,
+  0xe6, 0x19, 0x55, 0x27, 0x08, 0x24, 0x4c, 0x66, 0xe0, 0x71, 0x36, 0xbb,
+  0x0c, 0x60, 0xcc, 0xa9, 0xe7, 0xc1, 0xdc, 0xd0, 0x7f, 0xef, 0xb0, 0x83,
+  0x90, 0x98, 0xed, 0x9c, 0x00, 0xe5, 0x99, 0x28, 0xd6, 0xb0, 0x5e, 0x26,
+  0x99, 0x2a, 0x07, 0xe9, 0x24, 0x47, 0x0c, 0x4d, 0xfc, 0xa0, 0xfc, 0x00,
+  0x14, 0xfb, 0xdd, 0xa8, 0x98, 0x97, 0xb7, 0x6b, 0x89, 0xd4, 0x26, 0xe6,
+  0x86, 0xb8, 0x3a, 0x63, 0x45, 0x71, 0x40, 0xb8, 0x17, 0xfd, 0x2b, 0x50,
+  0x7f, 0x25, 0x43, 0x88, 0x80, 0x52, 0x29, 0x57, 0x6a, 0xcd, 0xb5, 0xf8,
+  0xdf, 0x7d, 0x63, 0x35, 0xf7, 0x87, 0x14, 0x29, 0xac, 0xcc, 0x89, 0x1c,
+  0x50, 0xf4, 0x25, 0xad, 0xe9, 0x07, 0x61, 0x69, 0x33, 0x0a, 0xe2, 0x74,
+  0x7e, 0x24, 0x07, 0xe3, 0xa6, 0x1e, 0x4b, 0xb2, 0x48, 0x59, 0x5b, 0x68,
+  0xb2, 0x22, 0xf5, 0x90, 0xe3, 0x92, 0xad, 0x1c, 0xb2, 0xb2, 0x75, 0x76,
+  0x28, 0x04, 0x41, 0x5a, 0xdf, 0x49, 0xd4, 0xf9, 0x76, 0x5a, 0xb0, 0x05,
+  0xd0, 0x7f, 0x95, 0x7a, 0xd4, 0xd7, 0x64, 0x6d, 0x58, 0x14, 0xbd, 0x74,
+  0xb6, 0x16, 0xad, 0x10, 0xd6, 0xfa, 0xc1, 0x11, 0x92, 0x5b, 0x58, 0xe4,
+  0x32, 0x6a, 0xe1, 0x07, 0x7e, 0xba, 0xab, 0x15, 0x1d, 0xe9, 0x43, 0xb4,
+  0xc6, 0x14, 0xa3, 0x41, 0x70, 0xb8, 0x62, 0x3f, 0x72, 0x2e, 0xb9, 0x2f,
+  0x4d, 0x3e, 0x43, 0x2c, 0xc6, 0xba, 0x08, 0x0a, 0x1b, 0x69, 0x95, 0xf6,
+  0x38, 0x0f, 0x08, 0x83, 0x03, 0x25, 0x0f, 0xca, 0x1c, 0xd4, 0xe8, 0x26,
+  0xc4, 0x00, 0x2a, 0x8a, 0xf2, 0xd1, 0xa5, 0x17, 0xaf, 0x12, 0x2d, 0x49,
+  0xed, 0xa4, 0x99, 0x43, 0x40, 0x2b, 0x0a, 0x2d, 0x39, 0xa3, 0xee, 0x08,
+  0xe0, 0xf9, 0xd7, 0xd0, 0x58, 0x8f, 0x6d, 0x41, 0x2b, 0xc7, 0x5e, 0xbc,
+  0x38, 0x07, 0x5b, 0x1c, 0xda, 0x49, 0x00, 0x8f, 0x57, 0x76, 0x65, 0xb7,
+  0xa9, 0x06, 0x34, 0xda, 0x1d, 0xa4, 0x00, 0x78, 0x51, 0x0a, 0xaa, 0x1a,
+  0xa1, 0x43, 0xdd, 0xd9, 0x3e, 0x8b, 0xef, 0x6d, 0xa9, 0x05, 0xec, 0x60,
+  0x75, 0xc7, 0x14, 0xe8, 0x43, 0x59, 0xbf, 0x12, 0x13, 0xc1, 0xa5, 0xb6,
+  0x65, 0x00, 0xa6, 0xa6, 0x4d, 0x55, 0x86, 0x0d, 0x84, 0x19, 0x85, 0x57,
+  0x80, 0xa0, 0x34, 0x13, 0xf8, 0xf0, 0x71, 0x57, 0x77, 0xf2, 0xa1, 0xdc,
+  0x18, 0x83, 0xa4, 0x45, 0xa7, 0x07, 0xff, 0xba, 0xdf, 0x9f, 0x11, 0x3f,
+  0x8d, 0x7f, 0x56, 0x45, 0x31, 0xfa, 0xae, 0x3f, 0x1e, 0x60, 0x47, 0xab,
+  0xbc, 0xff, 0x83, 0x1d, 0xa1, 0xe5, 0xf7, 0x70, 0x1c, 0xea, 0x42, 0x75,
+  0x8d, 0x2d, 0x68, 0xc9, 0x45, 0x2d, 0x99, 0xb5, 0xd9, 0x6a, 0xdc, 0x5e,
+  0xd1, 0x21, 0xf3, 0xfe, 0x34, 0x57, 0xff, 0x46, 0xd1, 0xbf, 0x0d, 0xfe,
+  0xdb, 0xf1, 0xe7, 0x76, 0xb8, 0x5b, 0x8c, 0xbd, 0xc6, 0x0d, 0x29, 0xdd,
+  0x99, 0x70, 0x4c, 0x1f, 0x90, 0x9e, 0xb2, 0x28, 0x02, 0x2c, 0x42, 0x08,
+  0x53, 0x45, 0x37, 0x2a, 0x0d, 0x9d, 0xa7, 0x02, 0xef, 0xcc, 0x4d, 0x74,
+  0xe3, 0xa6, 0x42, 0xa1, 0xac, 0x87, 0x08, 0xeb, 0x74, 0x0d, 0xff, 0xb0,
+  0xba, 0x15, 0x24, 0x5a, 0x17, 0x77, 0xe2, 0xa4, 0xdc, 0x53, 0xfd, 0x0e,
+  0x72, 0xcb, 0x21, 0x97, 0x5d, 0xc3, 0x7a, 0x9c, 0xd2, 0x35, 0x4d, 0x94,
+  0xeb, 0x4e, 0x9c, 0x4f, 0x8e, 0xa5, 0xcd, 0x74, 0x69, 0xee, 0x82, 0xdd,
+  0x6a, 0x77, 0xca, 0x0d, 0xb0, 0xa4, 0xb2, 0xc0, 0xc5, 0xf8, 0x62, 0x5c,
+  0x1d, 0x94, 0x85, 0x1f, 0x3a, 0x2d, 0x1f, 0x29, 0xb2, 0xc8, 0xe3, 0x95,
+  0x5d, 0x3f, 0xe7, 0x73, 0x5a, 0xd2, 0xbd, 0xe4, 0xa5, 0xad, 0xc4, 0xd2,
+  0x1a, 0x11, 0x98, 0x75, 0x82, 0xfe, 0xac, 0x32, 0xd4, 0x5f, 0x46, 0xbe,
+  0x61, 0x05, 0x70, 0xc5, 0x44, 0x1e, 0xaa, 0x97, 0x1a, 0xbd, 0x19, 0xe7,
+  0x15, 0xc6, 0x4b, 0xf7, 0x2e, 0x8a, 0x6d, 0xc8, 0xb4, 0xd8, 0xb9, 0xc0,
+  0x7c, 0xa7, 0xb4, 0x32, 0xc5, 0xec, 0x68, 0xa7, 0x64, 0x0d, 0x59, 0x9f,
+  0xd7, 0xc4, 0xca, 0xb5, 0xe7, 0x18, 0x61, 0xc7, 0xcb, 0x65, 0xe2, 0xbc,
+  0x0f, 0xa2, 0x9c, 0x4a, 0x72, 0xa6, 0x19, 0xdd, 0x2f, 0xb2, 0x69, 0x59,
+  0x76, 0xf5, 0xa3, 0x07, 0x19, 0xc2, 0xab, 0xc8, 0x2e, 0xfa, 0x07, 0xc6,
+  0xdc, 0xcb, 0x2b, 0xaa, 0x70, 0x90, 0xa8, 0x8c, 0xc4, 0x2f, 0xa8, 0xea,
+  0xa2, 0xa3, 0xe0, 0x48, 0x53, 0x75, 0x62, 0x99, 0xae, 0xed, 0x86, 0x9f,
+  0x28, 0xd6, 0x77, 0x22, 0x95, 0x61, 0x3b, 0x25, 0xf6, 0x34, 0xde, 0xe7,
+  0x8f, 0x3a, 0xaf, 0xf8, 0xdf, 0xd6, 0xa1, 0xbc, 0x75, 0x01, 0x6f, 0xed,
+  0x2f, 0x4e, 0xcd, 0xbf, 0xda, 0xfa, 0xb4, 0x1a, 0x8b, 0xec, 0xe2, 0xc0,
+  0xf8, 0x93, 0x90, 0x92, 0x6d, 0xd9, 0xd0, 0xd6, 0x13, 0x6a, 0x04, 0x3c,
+  0x47, 0x4e, 0x1f, 0xd2, 0xa4, 0x39, 0xe4, 0xf6, 0xca, 0x0d, 0x6a, 0x47,
+  0x49, 0xf3, 0xc8, 0x5c, 0x54, 0xe4, 0xef, 0x66, 0x08, 0xd2, 0xf4, 0x2a,
+  0x9c, 0xb8, 0xce, 0x15, 0x62, 0xbb, 0x8c, 0x71, 0x86, 0xbb, 0x0f, 0xbc,
+  0x1e, 0x88, 0xd1, 0xad, 0x64, 0x3f, 0xcb, 0x3e, 0xcf, 0xab, 0x24, 0x84,
+  0xff, 0xf0, 0x96, 0x7f, 0xa2, 0x88, 0xee, 0xc7, 0x10, 0x61, 0x10, 0x2c,
+  0x46, 0x7f, 0x7e, 0xe2, 0xb5, 0x18, 0xda, 0x6d, 0x5d, 0x65, 0xb0, 0xa5,
+  0xf7, 0x5f, 0x6d, 0xee, 0x8d, 0x1f, 0xd2, 0x0a, 0xff, 0xbf, 0xb5, 0xfa,
+  0xc2, 0xc6, 0x4b, 0x1a, 0xae, 0xa0, 0x3b, 0x17, 0xb6, 0x1d, 0x38, 0x8d,
+  0xca, 0x14, 0x9c, 0x44, 0xa6, 0x2b, 0xac, 0x8a, 0x80, 0x79, 0x48, 0xd4,
+  0x00, 0x8f, 0xdc, 0x87, 0x2c, 0xbd, 0x0c, 0x89, 0x83, 0x5c, 0x2c, 0x9b,
+  0x31, 0xb6, 0xb7, 0xe9, 0x26, 0x58, 0xeb, 0x23, 0xf8, 0x10, 0x90, 0x04,
+  0x0f, 0x5f, 0x1e, 0x13, 0xde, 0x07, 0x5c, 0x61, 0x93, 0x4a, 0xf4, 0x04,
+  0x1e, 0x20, 0x2a, 0x86, 0xb3, 0x50, 0x06, 0x97, 0x02, 0xe4, 0x83, 0x76,
+  0x10, 0x5c, 0xce, 0x16, 0x9d, 0xd8, 0xbb, 0x75, 0x6a, 0x43, 0xc1, 0x31,
+  0x08, 0x0c, 0x10, 0x40, 0xc8, 0x3c, 0x66, 0x5c, 0x12, 0x5f, 0xdf, 0x45,
+  0xe8, 0x4a, 0xab, 0x33, 0xcc, 0x2c, 0xaf, 0x45, 0x64, 0x3b, 0x34, 0x99,
+  0x72, 0x5c, 0x36, 0xd7, 0xe2, 0x36, 0xd3, 0x79, 0x38, 0x92, 0xe5, 0xed,
+  0xa4, 0x4a, 0x3f, 0x66, 0xa5, 0x26, 0x0d, 0x6b, 0x80, 0xe6, 0x57, 0x8f,
+  0x1e, 0x39, 0x95, 0xcc, 0x43, 0x04, 0xb1, 0xba, 0x2c, 0x4a, 0x2f, 0xd5,
+  0x90, 0xef, 0x26, 0xff, 0xa5, 0x20, 0xa1, 0xc0, 0xa4, 0xd9, 0xde, 0x8a,
+  0x3e, 0xfe, 0x47, 0x0b, 0xf0, 0x42, 0x41, 0x07, 0xd5, 0x7a, 0x1d, 0xe4,
+  0xf3, 0xc7, 0xf0, 0x49, 0x98, 0x71, 0xeb, 0x07, 0x8d, 0xa2, 0x44, 0xf5,
+  0x08, 0x85, 0xcf, 0x47, 0x62, 0x79, 0xfc, 0x20, 0x9a, 0x39, 0x8f, 0x56,
+  0x32, 0x7d, 0xdc, 0x7c, 0x78, 0x8f, 0xfb, 0x29, 0x6a, 0xf0, 0xbd, 0x0c,
+  0xa6, 0xa6, 0xdb, 0xf4, 0xdd, 0xf2, 0xf9, 0xd8, 0xa0, 0x68, 0xa1, 0x69,
+  0x42, 0x1a, 0x90, 0x2e, 0xab, 0x1b, 0xb0, 0x1e, 0x70, 0x84, 0xd0, 0x82,
+  0x84, 0x78, 0x4a, 0x4c, 0x8e, 0xc4, 0x5c, 0x19, 0xda, 0x8a, 0x10, 0xad,
+  0x14, 0xad, 0x41, 0x89, 0xf0, 0xfe, 0xb5, 0xa4, 0x4d, 0xab, 0x0d, 0x80,
+  0x3c, 0xb9, 0x51, 0xc1, 0x45, 0x20, 0x95, 0x47, 0xc4, 0x95, 0xe8, 0x71,
+  0x44, 0x53, 0xd4, 0xea, 0xdd, 0x8c, 0x70, 0x10, 0x5a, 0x1f, 0xa8, 0x97,
+  0x4d, 0x07, 0x62, 0x1c, 0x0d, 0x47, 0x41, 0xe1, 0xfa, 0xc2, 0x80, 0x5c,
+  0xc6, 0x51, 0x14, 0xf4, 0xe1, 0xca, 0x35, 0xf2, 0xe6, 0xe8, 0x55, 0xbc,
+  0xd1, 0xae, 0xcf, 0x23, 0xad, 0x94, 0x75, 0x2b, 0x45, 0xe4, 0xec, 0x43,
+  0x51, 0xfb, 0x20, 0x5a, 0x74, 0x0c, 0x2e, 0x1e, 0xe5, 0x08, 0x68, 0x61,
+  0x15, 0x49, 0xc2, 0x2d, 0xe2, 0xbf, 0x63, 0xfc, 0x7e, 0xf8, 0xa1, 0xca,
+  0x22, 0x0f, 0xfe, 0xe2, 0x4a, 0x6b, 0xf5, 0xe1, 0xda, 0x43, 0x0b, 0x5c,
+  0x58, 0x59, 0x5d, 0x39, 0x0c, 0x75, 0xc2, 0x00, 0xb0, 0x84, 0x76, 0xa2,
+  0x97, 0x1a, 0x25, 0xcb, 0x48, 0xae, 0xc8, 0x48, 0x4a, 0x13, 0x70, 0x5c,
+  0x2c, 0xed, 0xe4, 0x77, 0x41, 0x50, 0x60, 0x77, 0x8b, 0xe2, 0x86, 0x79,
+  0x40, 0xf1, 0xca, 0xfa, 0xa6, 0x92, 0x51, 0xb2, 0xe7, 0x78, 0x2a, 0xee,
+  0xdb, 0xf5, 0x05, 0xa6, 0xf9, 0x50, 0xaa, 0x51, 0xbd, 0x5d, 0x9a, 0xcb,
+  0x35, 0xa6, 0xfb, 0xad, 0x74, 0x15, 0x84, 0x17, 0xbf, 0xe3, 0x7f, 0x89,
+  0xd1, 0x7e, 0xea, 0xbb, 0x46, 0x17, 0x9f, 0xfc, 0x26, 0xbd, 0x45, 0x71,
+  0x17, 0x2b, 0x5f, 0x43, 0x5e, 0xc4, 0x8f, 0x74, 0x9d, 0x6c, 0x94, 0x5d,
+  0xf2, 0x35, 0xfc, 0xec, 0xf5, 0xd1, 0x4f, 0x47, 0xaf, 0xf5, 0x4a, 0x7a,
+  0x79, 0x7e, 0xbe, 0xf9, 0x21, 0x9b, 0xf5, 0xb2, 0x59, 0x51, 0xb2, 0x5b,
+  0x80, 0xbe, 0x26, 0x61, 0x3d, 0xc0, 0x47, 0xbb, 0xc8, 0x3f, 0x69, 0x49,
+  0x33, 0x95, 0x35, 0xaf, 0x11, 0x46, 0x64, 0x60, 0x86, 0x33, 0xf4, 0x44,
+  0x92, 0x05, 0x3e, 0x0d, 0x69, 0xa1, 0x88, 0x67, 0x8d, 0xa7, 0xe2, 0x39,
+  0xdb, 0x11, 0x38, 0x13, 0x1d, 0x49, 0x3e, 0x0c, 0x4d, 0x1f, 0x9d, 0x12,
+  0x5a, 0x2e, 0x3d, 0x2c, 0x9d, 0x11, 0x0c, 0x14, 0x4e, 0x8d, 0x56, 0x43,
+  0xfc, 0xf7, 0x27, 0x7f, 0xea, 0x1c, 0x9c, 0x77, 0x9e, 0x1f, 0xbd, 0x3e,
+  0x7a, 0x79, 0x70, 0x71, 0x64, 0x45, 0x5e, 0x49, 0xce, 0xe4, 0x53, 0x01,
+  0x2d, 0xfc, 0x49, 0xe6, 0x66, 0xa5, 0x2c, 0xab, 0x9c, 0x6b, 0xd0, 0xb3,
+  0x47, 0x95, 0xb0, 0x46, 0x80, 0x41, 0x57, 0x9c, 0x4a, 0x06, 0x64, 0x39,
+  0x1a, 0x4b, 0xff, 0x3a, 0x9a, 0x74, 0x74, 0x93, 0xde, 0x96, 0xc4, 0x16,
+  0x27, 0x98, 0x4f, 0x9f, 0x1b, 0x68, 0x13, 0xcf, 0xc1, 0x01, 0x86, 0xb9,
+  0xe5, 0x71, 0xd2, 0x67, 0xb4, 0xfa, 0xab, 0xfb, 0x43, 0xef, 0x0f, 0x6d,
+  0xa9, 0x13, 0x7b, 0xe8, 0xa5, 0x85, 0xab, 0xbd, 0xa2, 0xf4, 0x52, 0xab,
+  0x8b, 0x55, 0x96, 0xa3, 0x40, 0x35, 0x54, 0xb7, 0x31, 0xce, 0x62, 0x51,
+  0x8c, 0x35, 0x4e, 0x26, 0x79, 0x4e, 0x4f, 0x24, 0xb5, 0x34, 0x06, 0x8b,
+  0x1b, 0x89, 0x3f, 0x16, 0xe9, 0xb7, 0x7f, 0x95, 0x61, 0x5e, 0x20, 0xba,
+  0x33, 0x4a, 0x4d, 0x70, 0x89, 0x81, 0xf5, 0xb9, 0xb4, 0x19, 0x87, 0x41,
+  0xe5, 0x33, 0x46, 0xad, 0xa0, 0x50, 0xa6, 0x84, 0x40, 0xc2, 0xba, 0x21,
+  0x43, 0x4e, 0x03, 0xf8, 0xe3, 0xe0, 0x7d, 0x17, 0x50, 0x32, 0xa1, 0xba,
+  0x58, 0x5a, 0x08, 0x34, 0x2a, 0x59, 0x64, 0x8e, 0x08, 0xfc, 0xca, 0x92,
+  0x7f, 0x6d, 0x10, 0xb5, 0xe8, 0x08, 0x5e, 0x8b, 0x07, 0x0a, 0x8c, 0xb0,
+  0x8a, 0xcb, 0x9f, 0x52, 0x7a, 0x52, 0x46, 0xb0, 0xd2, 0xa6, 0xce, 0x09,
+  0xe3, 0x5a, 0xc1, 0x28, 0xe5, 0x4d, 0xde, 0x60, 0x29, 0x02, 0xad, 0x9b,
+  0xfc, 0xf7, 0x76, 0x00, 0x9a, 0x30, 0x92, 0x35, 0x1c, 0xb0, 0x00, 0x08,
+  0xe5, 0x1c, 0x6e, 0x8d, 0x76, 0xb5, 0x76, 0x40, 0x02, 0x99, 0x59, 0xea,
+  0x4d, 0x00, 0x9e, 0x09, 0xb5, 0xbe, 0x53, 0x0a, 0x77, 0x63, 0x4c, 0x19,
+  0x32, 0xe7, 0x08, 0x4e, 0xbe, 0x3c, 0x0c, 0xdf, 0x29, 0xe0, 0x68, 0x52,
+  0x4c, 0x7c, 0xbe, 0x65, 0x03, 0x9a, 0x8d, 0x14, 0x8a, 0x22, 0x9f, 0x67,
+  0x54, 0x25, 0xd4, 0x00, 0x72, 0x1e, 0xc2, 0x45, 0x1e, 0x60, 0x38, 0x96,
+  0x6f, 0xd7, 0xdf, 0x57, 0x8d, 0x04, 0xc3, 0xd1, 0xbb, 0x03, 0x46, 0x2d,
+  0x77, 0xb2, 0xe9, 0xac, 0x0a, 0x61, 0x05, 0x1b, 0x01, 0x18, 0x50, 0xa2,
+  0x41, 0x2c, 0x67, 0xe2, 0xe8, 0xf4, 0xec, 0x82, 0x25, 0x98, 0xd7, 0xf4,
+  0x9b, 0x6c, 0x81, 0xf8, 0x90, 0xb8, 0xe0, 0xbc, 0xba, 0x67, 0xa9, 0xb4,
+  0x1e, 0x85, 0x03, 0x59, 0x3e, 0x8a, 0x1a, 0x3f, 0x27, 0x5a, 0x2d, 0x4e,
+  0xf6, 0x16, 0x19, 0xe0, 0x78, 0x5a, 0x05, 0x1f, 0x30, 0x75, 0xa4, 0x66,
+  0x2c, 0x4a, 0x87, 0x65, 0xa9, 0x1c, 0xd3, 0xee, 0x39, 0x38, 0xd0, 0xe5,
+  0x49, 0x69, 0xd4, 0x59, 0x2e, 0xb5, 0x0c, 0xf1, 0xa1, 0x64, 0x26, 0x60,
+  0x9e, 0xc0, 0x3c, 0xe5, 0xbc, 0xd2, 0xd8, 0x35, 0x1f, 0x45, 0x41, 0xb8,
+  0x83, 0xe2, 0xa3, 0xa9, 0xf8, 0x34, 0x62, 0x8d, 0x91, 0x69, 0x4b, 0x46,
+  0x43, 0xe6, 0x0b, 0x9f, 0x10, 0x2a, 0x02, 0x47, 0xcc, 0x58, 0xc6, 0x25,
+  0x0f, 0x4a, 0x80, 0xbb, 0x4b, 0xf6, 0x98, 0xc4, 0x09, 0xa5, 0x62, 0xdb,
+  0xe9, 0x91, 0x45, 0x49, 0x1a, 0x62, 0x87, 0x9c, 0xd5, 0xa9, 0x56, 0xde,
+  0xce, 0x33, 0x90, 0xb5, 0x0d, 0x52, 0x0a, 0xee, 0x52, 0xac, 0xa5, 0x52,
+  0xb6, 0xb5, 0xa5, 0x85, 0x65, 0xc2, 0x1a, 0x69, 0xa2, 0x82, 0x74, 0xca,
+  0x79, 0x93, 0x40, 0x44, 0x61, 0x8b, 0x79, 0x09, 0xd8, 0x8e, 0x28, 0x66,
+  0x44, 0x47, 0x06, 0xb5, 0xb8, 0x51, 0x4d, 0xa8, 0x2b, 0x09, 0x08, 0xc5,
+  0x55, 0x42, 0x3a, 0x3e, 0xbd, 0x7e, 0x12, 0x07, 0x10, 0x19, 0x86, 0x27,
+  0xa3, 0x42, 0xa8, 0x39, 0x5c, 0x97, 0x3d, 0x04, 0xff, 0x21, 0x4f, 0xd6,
+  0x6e, 0x98, 0xd2, 0xb0, 0x41, 0x7a, 0x8e, 0xa3, 0x3c, 0xd9, 0x10, 0x2e,
+  0xee, 0x45, 0x21, 0x24, 0xad, 0xe2, 0x16, 0x2c, 0x45, 0x9a, 0x70, 0x21,
+  0x6c, 0x1d, 0x08, 0xa2, 0x4f, 0x55, 0xf6, 0x90, 0x65, 0xe1, 0x1b, 0x14,
+  0x93, 0xa3, 0x18, 0x65, 0xb4, 0x56, 0x92, 0xeb, 0x2c, 0xf1, 0x35, 0x14,
+  0xab, 0x0a, 0xf3, 0x87, 0x35, 0xe8, 0x67, 0x41, 0x92, 0x90, 0x73, 0x47,
+  0x4f, 0xa4, 0xe5, 0x75, 0x14, 0xf9, 0x12, 0x2f, 0x55, 0x52, 0x47, 0x31,
+  0xfd, 0x6c, 0x6e, 0xbc, 0xb8, 0xfc, 0x4b, 0xae, 0x58, 0xdf, 0xfb, 0x2a,
+  0xa1, 0x30, 0xe1, 0x85, 0xf2, 0x5a, 0xf8, 0xaf, 0x4e, 0xbd, 0x81, 0x09,
+  0x94, 0xd7, 0x4d, 0x4c, 0x40, 0x79, 0x80, 0xaa, 0x8f, 0x47, 0xa7, 0xe7,
+  0x3f, 0xd9, 0xc9, 0xe7, 0x83, 0xcf, 0xc9, 0x35, 0xba, 0xf0, 0x78, 0x84,
+  0x6a, 0x89, 0x68, 0x72, 0xf0, 0xed, 0xdc, 0xcb, 0xc1, 0x5f, 0x38, 0xf7,
+  0xd4, 0xb6, 0x9c, 0xf8, 0xe4, 0xf4, 0xe0, 0xfc, 0xa7, 0xb6, 0x56, 0x72,
+  0xad, 0xd4, 0x2a, 0x1b, 0x1f, 0x78, 0x73, 0xa3, 0x54, 0x40, 0x58, 0xf8,
+  0xb6, 0x3f, 0x2e, 0x30, 0xe7, 0x95, 0x8e, 0x0b, 0xf4, 0xb9, 0x78, 0x5c,
+  0x74, 0x31, 0xee, 0x3a, 0x2e, 0x40, 0x1e, 0xcb, 0x8e, 0x0b, 0xbe, 0x84,
+  0x67, 0x84, 0x70, 0x1e, 0xe2, 0x83, 0x62, 0x17, 0x80, 0x1e, 0x14, 0x1e,
+  0x43, 0x48, 0xc9, 0xbf, 0xf7, 0xa4, 0xc0, 0x80, 0x39, 0x5b, 0x4e, 0x0e,
+  0x8a, 0x49, 0x2f, 0xf1, 0x49, 0x51, 0x03, 0xf7, 0xb2, 0x93, 0xa2, 0x67,
+  0x4b, 0xe2, 0x42, 0xc9, 0xfc, 0x6a, 0x87, 0x85, 0xf7, 0xdc, 0xd1, 0x4b,
+  0x03, 0xa0, 0x6f, 0x44, 0x5e, 0x4b, 0x71, 0x67, 0xef, 0x80, 0x9d, 0x75,
+  0x45, 0xd9, 0x1a, 0x0f, 0x44, 0x58, 0xe0, 0xfb, 0x0e, 0x04, 0x0c, 0xe0,
+  0xd3, 0x0e, 0x84, 0xc5, 0x2c, 0x35, 0x1e, 0x08, 0x14, 0xad, 0x3b, 0x2a,
+  0x98, 0x81, 0x8c, 0xda, 0xb1, 0x38, 0xf8, 0xa3, 0x8f, 0xb9, 0xd0, 0xa2,
+  0xe4, 0xa0, 0x83, 0x3a, 0xa0, 0xde, 0x41, 0x06, 0x4b, 0x14, 0x6b, 0x8d,
+  0x20, 0x3e, 0x69, 0x23, 0xbc, 0x7e, 0x3d, 0x4c, 0x2c, 0x13, 0x58, 0x18,
+  0xb4, 0xc3, 0x71, 0xde, 0x3d, 0x9f, 0x22, 0x05, 0x3e, 0xa4, 0x34, 0xac,
+  0x8c, 0x4e, 0x94, 0xd5, 0xf3, 0xa1, 0xd2, 0xc2, 0x56, 0x58, 0x58, 0xcc,
+  0x76, 0x72, 0xb1, 0xd5, 0xf9, 0x53, 0xd3, 0xd8, 0x9b, 0x79, 0x95, 0x79,
+  0x4b, 0x84, 0x63, 0xad, 0xc6, 0xab, 0x9a, 0xda, 0xbf, 0x7f, 0x9b, 0x1a,
+  0x47, 0xb5, 0x52, 0x28, 0xcd, 0x93, 0xed, 0x5a, 0x28, 0x0d, 0xdd, 0xce,
+  0x61, 0xbb, 0x26, 0x65, 0x87, 0x4c, 0xbd, 0x43, 0x44, 0x5c, 0x7d, 0x66,
+  0xbf, 0xaa, 0x8a, 0xf9, 0xfc, 0xed, 0xb9, 0x04, 0xd3, 0x58, 0xbe, 0x34,
+  0x62, 0x5b, 0x59, 0x66, 0x74, 0x75, 0x35, 0x2b, 0xe6, 0x97, 0x57, 0x0e,
+  0x85, 0xc2, 0x9a, 0x68, 0x4a, 0x18, 0xe6, 0x44, 0x59, 0x86, 0xf6, 0xc8,
+  0x66, 0x64, 0x63, 0xaa, 0x0a, 0x2e, 0xf0, 0xab, 0x63, 0x48, 0xd6, 0x59,
+  0xbb, 0x73, 0x41, 0x24, 0x0c, 0x95, 0x24, 0x27, 0x19, 0x06, 0x24, 0xb6,
+  0x92, 0x50, 0x34, 0x50, 0x72, 0x63, 0x43, 0x05, 0x21, 0x2a, 0xea, 0x13,
+  0x9a, 0xe4, 0x74, 0xda, 0xf5, 0x08, 0x32, 0x5a, 0x52, 0x20, 0x37, 0x24,
+  0x0e, 0x2a, 0x5e, 0x88, 0x7b, 0xc3, 0xa1, 0x48, 0xd5, 0x53, 0x8f, 0xc0,
+  0x27, 0xc5, 0x0a, 0xc6, 0x1d, 0x65, 0xd5, 0xd5, 0x5d, 0xb8, 0x05, 0xf5,
+  0xc7, 0x05, 0x1b, 0xb5, 0x54, 0x98, 0xd6, 0x5e, 0xad, 0x48, 0x14, 0x46,
+  0x17, 0x6b, 0x4d, 0x90, 0x7e, 0x27, 0x9d, 0x59, 0x02, 0x9e, 0x3f, 0xc5,
+  0xd8, 0xe2, 0xf4, 0xfa, 0x71, 0x07, 0x57, 0x40, 0x6d, 0x0e, 0xfc, 0xd9,
+  0x13, 0xfa, 0x2c, 0x26, 0x0e, 0x7b, 0xf2, 0x99, 0xac, 0x58, 0x44, 0x1a,
+  0x3f, 0xe6, 0x8c, 0x51, 0x90, 0x86, 0x88, 0xc4, 0xe3, 0x53, 0x4b, 0x2f,
+  0xa5, 0x93, 0x39, 0x4e, 0x3f, 0x88, 0xcc, 0xf3, 0x38, 0x89, 0x88, 0x47,
+  0xae, 0x27, 0x2d, 0x9a, 0xa6, 0xb8, 0x69, 0x46, 0x5b, 0x22, 0x55, 0x56,
+  0x99, 0x66, 0x24, 0xe1, 0x6d, 0xc2, 0x2d, 0x0b, 0x05, 0x68, 0x20, 0x73,
+  0x14, 0x0c, 0x84, 0xdb, 0x6f, 0xa8, 0xb2, 0xdc, 0xab, 0xbd, 0xc5, 0xb0,
+  0x15, 0xf1, 0xbc, 0x7c, 0xce, 0xca, 0x83, 0x96, 0x32, 0x88, 0xbb, 0xd9,
+  0xde, 0xea, 0x6e, 0x77, 0x77, 0xba, 0xbb, 0xf7, 0xef, 0xb6, 0xbd, 0xf2,
+  0x60, 0xbb, 0x6d, 0xf4, 0xb3, 0xc2, 0x6e, 0x3f, 0x79, 0xa8, 0xdd, 0x7e,
+  0xf2, 0xbf, 0x64, 0xb7, 0x9f, 0x2c, 0xdb, 0xed, 0x27, 0xff, 0x9e, 0xdd,
+  0x96, 0x6e, 0x76, 0xd2, 0xad, 0xc7, 0xfb, 0x8f, 0xb3, 0xc7, 0x3b, 0xfb,
+  0xfb, 0x7b, 0x4f, 0xb6, 0x57, 0xd9, 0xf3, 0x27, 0xff, 0x96, 0x3d, 0x7f,
+  0xbc, 0xb8, 0xe7, 0x0a, 0x7b, 0xa3, 0x3b, 0x9e, 0x95, 0x35, 0xe6, 0xcf,
+  0x9b, 0xa5, 0xf5, 0x49, 0x70, 0xd3, 0xf4, 0x15, 0xb6, 0x0e, 0x4b, 0x86,
+  0x53, 0x94, 0xb0, 0x20, 0x89, 0x30, 0x51, 0xde, 0x02, 0x6f, 0xa3, 0xb6,
+  0x13, 0x08, 0x07, 0x26, 0x1b, 0x36, 0x33, 0x00, 0xb5, 0xb3, 0x92, 0x4a,
+  0xa2, 0xb2, 0xce, 0xf1, 0x34, 0xc0, 0x78, 0x95, 0x0c, 0x1f, 0xc7, 0xd1,
+  0x24, 0x0e, 0x8c, 0x1d, 0xdb, 0xa0, 0x8b, 0xa8, 0x1d, 0xec, 0xe3, 0xc1,
+  0xb7, 0x7e, 0x7c, 0x1a, 0xe7, 0xbf, 0x87, 0xde, 0x82, 0xc3, 0x8c, 0x50,
+  0xc6, 0xbb, 0x89, 0xa3, 0x1e, 0x9d, 0xee, 0x03, 0x12, 0x4f, 0xd9, 0x40,
+  0x3d, 0xda, 0xcd, 0xf6, 0x37, 0x3b, 0xdd, 0xed, 0x27, 0x4f, 0x11, 0x8a,
+  0xac, 0x1d, 0x7e, 0xdf, 0x59, 0xc1, 0x04, 0xed, 0x1b, 0xd9, 0x12, 0x30,
+  0xb3, 0xbd, 0xfb, 0x39, 0x8e, 0xbe, 0x63, 0xb4, 0xb7, 0x8c, 0xf8, 0x1e,
+  0x9a, 0xfa, 0x8a, 0xab, 0xc5, 0xfa, 0x62, 0xe7, 0x64, 0xcc, 0x2b, 0x6b,
+  0xe5, 0x9f, 0x50, 0x87, 0xb1, 0x14, 0xd6, 0xe7, 0xc5, 0x2b, 0x22, 0xce,
+  0x0e, 0x5a, 0x1a, 0x3b, 0x54, 0xd0, 0xd5, 0x60, 0xbf, 0x7f, 0x72, 0x55,
+  0xa0, 0xe5, 0x5d, 0x25, 0x49, 0x7c, 0x4d, 0x49, 0x77, 0xed, 0xdf, 0x5b,
+  0x9e, 0xcc, 0xcb, 0x3f, 0x0b, 0xf5, 0xc9, 0xdc, 0xb8, 0x5c, 0x91, 0x32,
+  0xad, 0x52, 0x26, 0x67, 0x91, 0xa2, 0xe9, 0xad, 0x48, 0x59, 0xa8, 0x51,
+  0xa6, 0xf9, 0x70, 0x56, 0x69, 0xc6, 0x0a, 0x94, 0x05, 0xc7, 0xce, 0xff,
+  0x51, 0xe5, 0xc9, 0x22, 0x81, 0x3d, 0x26, 0xa0, 0xa6, 0xc2, 0x28, 0x9f,
+  0x61, 0x51, 0x88, 0x1b, 0xbd, 0x87, 0xeb, 0xd7, 0x46, 0xc0, 0x9f, 0x78,
+  0xe9, 0x1c, 0xfe, 0x56, 0x28, 0xf1, 0x7b, 0xc1, 0xfb, 0x7c, 0x08, 0xfc,
+  0x93, 0x9a, 0xdc, 0x8e, 0xed, 0x2e, 0xd4, 0x4d, 0xf7, 0x1f, 0x72, 0x13,
+  0x3f, 0xde, 0x1a, 0xbf, 0x6d, 0x63, 0x66, 0x31, 0x27, 0xe1, 0x07, 0xf4,
+  0x5f, 0x3e, 0xd1, 0xec, 0x1a, 0x55, 0x8c, 0x8c, 0x88, 0x00, 0x55, 0x62,
+  0xe7, 0xbd, 0x35, 0xc7, 0xaf, 0xf8, 0x19, 0xc4, 0xbc, 0xe0, 0x01, 0xe9,
+  0x24, 0xe5, 0x8c, 0xe0, 0xa2, 0xbb, 0x0d, 0x39, 0xa7, 0x55, 0x36, 0x1a,
+  0x95, 0x01, 0x7d, 0x80, 0x10, 0xfe, 0x1a, 0xc8, 0x07, 0x8e, 0x52, 0x36,
+  0x95, 0x9c, 0x0e, 0x8a, 0x3e, 0x53, 0xa6, 0x6c, 0xb5, 0x33, 0x08, 0xfd,
+  0xd9, 0x05, 0x46, 0xfc, 0x7c, 0x70, 0xf6, 0xf6, 0xf8, 0xed, 0xcb, 0x7d,
+  0x17, 0xf4, 0xee, 0x23, 0x17, 0x75, 0x8e, 0x48, 0x57, 0x34, 0xc3, 0x00,
+  0x61, 0xc8, 0xe1, 0xb3, 0x16, 0x18, 0x41, 0x40, 0x89, 0x73, 0x3e, 0xa0,
+  0x61, 0x85, 0x17, 0xd0, 0x8c, 0xe9, 0xf0, 0x02, 0x87, 0x84, 0x63, 0x89,
+  0x1e, 0xf5, 0x2a, 0x72, 0xc0, 0x08, 0xa3, 0x63, 0x9b, 0x7d, 0xf8, 0xb4,
+  0x37, 0x0f, 0x7e, 0x0a, 0xc1, 0x6f, 0xe5, 0xc1, 0xd4, 0xf9, 0x57, 0x22,
+  0x18, 0xd6, 0xde, 0x71, 0xd1, 0xb8, 0xc1, 0x0f, 0x5b, 0xa1, 0xa6, 0x46,
+  0x55, 0xf7, 0x50, 0xba, 0xcd, 0xeb, 0x21, 0xc8, 0x9c, 0x5d, 0x3f, 0x46,
+  0xea, 0x1a, 0x1f, 0x2a, 0x57, 0x7a, 0xe8, 0x82, 0xa3, 0x43, 0xc3, 0x92,
+  0x46, 0x81, 0xa1, 0xf1, 0x7a, 0x47, 0xe7, 0x02, 0x47, 0xf7, 0xec, 0xdd,
+  0xd9, 0xeb, 0x5a, 0x05, 0x1c, 0x45, 0xa4, 0x8a, 0xd7, 0x1f, 0x37, 0xa4,
+  0x78, 0xb5, 0xe1, 0xe2, 0xde, 0xd4, 0x88, 0xc3, 0xc1, 0xda, 0x84, 0xa4,
+  0x29, 0x15, 0xd3, 0x14, 0x7b, 0x34, 0xce, 0xd2, 0x0c, 0x35, 0x1b, 0x2c,
+  0xcc, 0x8f, 0xd4, 0x4e, 0x79, 0x17, 0x03, 0x12, 0x33, 0x34, 0x39, 0xe5,
+  0xe5, 0xb8, 0x1b, 0x82, 0xa6, 0xd1, 0x64, 0xa1, 0xc5, 0x4a, 0x68, 0x20,
+  0x56, 0xbe, 0x02, 0x21, 0x09, 0x91, 0x15, 0x6a, 0x18, 0x11, 0xb1, 0x73,
+  0x03, 0x94, 0x40, 0x42, 0x82, 0x3f, 0x66, 0x81, 0xa8, 0x19, 0x8b, 0x6b,
+  0x8a, 0x25, 0x21, 0x70, 0xc8, 0x30, 0x1b, 0x2b, 0xaf, 0xa1, 0xa8, 0x40,
+  0xa2, 0x07, 0x33, 0x2e, 0x75, 0xc9, 0xb9, 0xa2, 0x8a, 0xec, 0x2f, 0x6e,
+  0x3b, 0xec, 0x12, 0xf6, 0xe2, 0x55, 0x71, 0x93, 0x5d, 0x73, 0xa5, 0xd5,
+  0xaa, 0xa9, 0xf6, 0x79, 0xfd, 0xe8, 0x72, 0xbd, 0x75, 0x5f, 0x73, 0x0c,
+  0xd6, 0xe6, 0x2a, 0x43, 0xac, 0x90, 0x81, 0xc4, 0x9a, 0x85, 0x10, 0x75,
+  0x34, 0xf1, 0xcc, 0x0a, 0xcc, 0x92, 0xf1, 0xd5, 0xc5, 0xae, 0xf3, 0xb4,
+  0x4e, 0x65, 0x22, 0x3b, 0x34, 0xf3, 0xe3, 0x1f, 0x6f, 0x03, 0x9f, 0xc3,
+  0x13, 0x85, 0x42, 0xca, 0xad, 0xda, 0x92, 0x48, 0x15, 0x91, 0x32, 0x3b,
+  0x88, 0x84, 0x8e, 0x99, 0xfa, 0x08, 0x22, 0x3c, 0x65, 0x64, 0x6e, 0x46,
+  0x89, 0x50, 0xd3, 0xc4, 0xd0, 0x6e, 0x61, 0xde, 0x7c, 0xa9, 0xf6, 0x5b,
+  0x47, 0xae, 0x70, 0x12, 0xeb, 0x7a, 0x86, 0x70, 0x47, 0x43, 0xe3, 0x2d,
+  0x11, 0x7e, 0x9e, 0xc2, 0x39, 0x0a, 0xfa, 0x2a, 0xaa, 0x4b, 0xe8, 0x2e,
+  0x25, 0xee, 0xb4, 0x8c, 0xad, 0xcc, 0x27, 0x84, 0x92, 0x3a, 0x24, 0xcb,
+  0x67, 0x84, 0xf7, 0x85, 0x38, 0x37, 0x96, 0xb7, 0x2c, 0x4e, 0x3d, 0xc2,
+  0x16, 0x16, 0xb9, 0xc0, 0x5d, 0x19, 0x4f, 0xf7, 0xba, 0x5b, 0x1b, 0x62,
+  0xcd, 0x10, 0xfa, 0xbf, 0x07, 0x1b, 0xfc, 0x13, 0xac, 0x18, 0x65, 0x03,
+  0x3b, 0x58, 0x76, 0xfe, 0xef, 0x17, 0x54, 0xef, 0x78, 0x39, 0xac, 0x1c,
+  0xb3, 0x11, 0xf7, 0x1d, 0x21, 0xe2, 0xa2, 0x44, 0x0c, 0xd2, 0x70, 0x77,
+  0x7b, 0x45, 0xfb, 0xd7, 0xce, 0x4a, 0xf7, 0xe8, 0x7c, 0x3c, 0xed, 0xf4,
+  0xd3, 0x4e, 0x06, 0xaa, 0xc5, 0xc0, 0xe7, 0x5a, 0xfe, 0xcc, 0x05, 0x6e,
+  0x70, 0xb1, 0x0e, 0xb1, 0x44, 0xcf, 0x7c, 0x32, 0x80, 0x31, 0xd2, 0x63,
+  0x03, 0x11, 0x5c, 0xec, 0x66, 0x53, 0x20, 0xd3, 0x44, 0xb0, 0x0c, 0xda,
+  0x0e, 0xb4, 0x0b, 0xae, 0x8d, 0x6a, 0xa1, 0xb6, 0xf7, 0x4d, 0x2a, 0x16,
+  0x2e, 0x91, 0xae, 0xa5, 0xcc, 0x51, 0x60, 0x20, 0xd0, 0xa5, 0xf4, 0x68,
+  0x5d, 0xfa, 0x54, 0x55, 0xc9, 0xb5, 0xc7, 0x28, 0x2d, 0x24, 0x99, 0xba,
+  0xb7, 0xc5, 0xcf, 0xe9, 0xa1, 0x7c, 0xdf, 0xbe, 0xcd, 0x7b, 0xee, 0x8b,
+  0x68, 0x49, 0x23, 0xc6, 0x8f, 0x7c, 0xff, 0x69, 0x97, 0x34, 0x94, 0x7a,
+  0x56, 0x00, 0xbc, 0x80, 0x71, 0x00, 0x58, 0xc5, 0xc2, 0xd2, 0x63, 0xf9,
+  0x02, 0xe0, 0xec, 0xd8, 0x76, 0xcc, 0xf8, 0xdd, 0xe3, 0xe1, 0x23, 0x97,
+  0x52, 0xab, 0x1f, 0xf9, 0xc4, 0xda, 0xe7, 0x6d, 0x1d, 0x9d, 0xe0, 0x2d,
+  0x36, 0x02, 0x2a, 0x25, 0xe4, 0xc6, 0x71, 0xdb, 0x6f, 0xa8, 0x99, 0x0e,
+  0xc1, 0x56, 0xe1, 0xec, 0x2c, 0xab, 0x25, 0x2e, 0xad, 0xc5, 0x79, 0x0f,
+  0xc7, 0x04, 0x59, 0x14, 0x55, 0x65, 0x34, 0x51, 0xda, 0x72, 0x51, 0x98,
+  0x9b, 0x38, 0x37, 0x47, 0x84, 0xff, 0x61, 0x4c, 0x81, 0x5b, 0xd4, 0xab,
+  0x0c, 0xcb, 0x16, 0x71, 0xc6, 0x21, 0x47, 0x12, 0xaf, 0xc7, 0x88, 0x42,
+  0x1b, 0x74, 0x11, 0x50, 0x72, 0x8f, 0xf9, 0xe7, 0x96, 0xa1, 0x09, 0x9d,
+  0x63, 0x14, 0x3f, 0xd2, 0x8d, 0x11, 0x34, 0x6f, 0x50, 0x3b, 0x24, 0x62,
+  0xb7, 0xfe, 0xa3, 0xe5, 0x7a, 0xc0, 0x98, 0xd5, 0x3e, 0xa3, 0xce, 0x5d,
+  0x22, 0xcc, 0xbc, 0x7a, 0x2c, 0x6d, 0x30, 0x02, 0x14, 0x45, 0x31, 0x93,
+  0x4c, 0xa7, 0xdc, 0x69, 0x36, 0x9b, 0x45, 0xe8, 0xc3, 0x06, 0x9e, 0xce,
+  0x90, 0x17, 0x8a, 0xbb, 0xac, 0xdc, 0x34, 0xa8, 0x22, 0x92, 0xf9, 0xc4,
+  0x10, 0x7c, 0x9a, 0xec, 0xad, 0x6e, 0x6e, 0x1c, 0x7a, 0x4b, 0xd6, 0xb8,
+  0x25, 0x85, 0xe3, 0xe6, 0xfc, 0x34, 0x55, 0xbb, 0xe4, 0x72, 0x66, 0x77,
+  0xce, 0x76, 0x1b, 0x67, 0x1b, 0x6e, 0xf1, 0x1a, 0xb2, 0x85, 0xec, 0x0b,
+  0x45, 0x84, 0x23, 0xb1, 0x7a, 0x3c, 0x15, 0x58, 0xee, 0xb2, 0x14, 0x10,
+  0x1e, 0xc3, 0x64, 0xc1, 0x58, 0xdd, 0x62, 0x42, 0x95, 0xf2, 0x5c, 0x19,
+  0x02, 0xc2, 0x48, 0x71, 0x51, 0x44, 0x8a, 0xec, 0x17, 0x51, 0xa4, 0x0e,
+  0xf3, 0x55, 0x7a, 0x8d, 0xad, 0x06, 0xad, 0xc6, 0xa0, 0x29, 0xf3, 0x09,
+  0xc5, 0xa4, 0x12, 0xd7, 0x06, 0xca, 0x09, 0x38, 0x59, 0xc9, 0x7a, 0xde,
+  0x05, 0x0a, 0xd1, 0x5b, 0x22, 0xc0, 0x14, 0xe0, 0xe3, 0x70, 0x84, 0xb1,
+  0x4c, 0x5f, 0x7f, 0x94, 0xc2, 0xa2, 0x6f, 0xb4, 0xc5, 0x3e, 0x52, 0x72,
+  0xe6, 0xb6, 0xd0, 0xb0, 0xe1, 0x33, 0xb5, 0x93, 0xa8, 0x68, 0x9e, 0xa6,
+  0xa9, 0x71, 0x5d, 0x31, 0x4e, 0xc6, 0xe2, 0xab, 0xc6, 0x9d, 0xa4, 0x2f,
+  0x78, 0xdd, 0xb8, 0x5e, 0x08, 0xd3, 0x67, 0x25, 0xfc, 0x9f, 0xe8, 0xb5,
+  0x46, 0x14, 0xe1, 0xa4, 0x53, 0x10, 0x81, 0x2c, 0x3a, 0xbb, 0x04, 0x27,
+  0x4b, 0x6f, 0x08, 0x90, 0xdd, 0x92, 0x67, 0x1c, 0x01, 0xe2, 0xd9, 0x84,
+  0xab, 0x10, 0xcc, 0xb8, 0xdd, 0x98, 0x6b, 0x77, 0x74, 0xf8, 0x2a, 0x59,
+  0x3f, 0x9a, 0xf4, 0x67, 0xb7, 0x53, 0x5c, 0xbc, 0x43, 0x2e, 0x25, 0xfd,
+  0x0a, 0x23, 0xd9, 0x37, 0x7c, 0xc6, 0x1c, 0x97, 0x43, 0xb1, 0x00, 0x3d,
+  0xa4, 0x12, 0xed, 0x42, 0x7c, 0xaf, 0x1a, 0x2b, 0x3d, 0x84, 0x41, 0x45,
+  0x11, 0x78, 0xec, 0xfb, 0xc5, 0x9e, 0xd8, 0xaa, 0x26, 0x40, 0x4f, 0x6a,
+  0x69, 0x93, 0xd7, 0x2e, 0x81, 0x3c, 0xf9, 0x3d, 0x72, 0xe1, 0xa4, 0xc9,
+  0xcb, 0xb3, 0xa3, 0x83, 0xf3, 0x23, 0x1a, 0xa0, 0xd9, 0x2a, 0xbe, 0x52,
+  0x77, 0xf3, 0x9c, 0x9e, 0x3c, 0x08, 0x4d, 0x73, 0x49, 0x22, 0x41, 0xf4,
+  0x41, 0x82, 0x90, 0xec, 0x5e, 0x8f, 0x5f, 0x85, 0x4f, 0xf0, 0xa3, 0x1a,
+  0xe5, 0xf1, 0x48, 0x06, 0x87, 0x31, 0x42, 0xeb, 0x17, 0x12, 0xfe, 0x6c,
+  0xfa, 0xe7, 0x90, 0xa3, 0x83, 0xa2, 0xd7, 0xec, 0x05, 0xd1, 0x97, 0x1e,
+  0xb1, 0x29, 0x41, 0x4b, 0x41, 0x5d, 0x21, 0x38, 0x78, 0x6d, 0x64, 0x54,
+  0x04, 0x4c, 0x07, 0xa0, 0x35, 0x32, 0x68, 0x58, 0x3a, 0xdc, 0x2e, 0x3d,
+  0xc7, 0xb6, 0x06, 0x0c, 0x3a, 0xc1, 0x18, 0x6f, 0xba, 0xc8, 0xa4, 0x06,
+  0xf3, 0x2e, 0xab, 0x6c, 0x7c, 0xf1, 0x04, 0xcb, 0x17, 0x33, 0x00, 0x52,
+  0xd1, 0xf0, 0xd0, 0x4e, 0x83, 0x36, 0x86, 0x8e, 0xa3, 0x47, 0xd0, 0xe6,
+  0x21, 0xed, 0x10, 0xa1, 0x55, 0xdc, 0x51, 0xc3, 0x32, 0xeb, 0x8f, 0xf6,
+  0x9f, 0xf5, 0x9e, 0x3c, 0x86, 0x3d, 0xfe, 0x9e, 0x06, 0x9f, 0xf4, 0x60,
+  0x2b, 0x9e, 0x3c, 0x4e, 0x34, 0x8e, 0x36, 0x6e, 0x29, 0x2a, 0xf3, 0x81,
+  0x84, 0x80, 0x3b, 0xab, 0x21, 0x95, 0x93, 0xfd, 0x67, 0x7c, 0x3d, 0x51,
+  0x3b, 0x56, 0xc8, 0x8e, 0xb3, 0x9d, 0x0b, 0x96, 0xdc, 0x3b, 0x33, 0x4b,
+  0x62, 0x6c, 0x4d, 0x09, 0x76, 0xf2, 0x3d, 0x3e, 0xd8, 0x4a, 0x24, 0x95,
+  0x99, 0x74, 0x94, 0x86, 0x29, 0xac, 0xd3, 0x0a, 0x05, 0xf4, 0x05, 0x5a,
+  0x22, 0x35, 0xc3, 0xe0, 0x52, 0x89, 0x11, 0x47, 0x37, 0xe3, 0x0d, 0x3a,
+  0x5e, 0x71, 0x65, 0x67, 0xd9, 0x88, 0x0d, 0xa7, 0xe4, 0xc9, 0x45, 0x88,
+  0x08, 0x1c, 0x8e, 0xb8, 0x75, 0xb1, 0x16, 0xd8, 0xd1, 0x7b, 0x78, 0xec,
+  0xfd, 0xd9, 0xd1, 0x9f, 0xdf, 0x1d, 0x9f, 0x1d, 0x3d, 0x4f, 0xd6, 0xb7,
+  0xb7, 0xb6, 0xe3, 0x9a, 0xe1, 0x19, 0xc7, 0x70, 0x3e, 0x74, 0xb5, 0x70,
+  0x6c, 0x16, 0x89, 0x79, 0x15, 0xf9, 0xf0, 0x69, 0xf7, 0x69, 0x83, 0x78,
+  0xc8, 0x2e, 0x59, 0x19, 0xe4, 0x25, 0x87, 0x4d, 0x37, 0xc0, 0x9f, 0x3c,
+  0xcf, 0x30, 0x6c, 0x9f, 0x31, 0xe0, 0xf8, 0x76, 0x58, 0x4f, 0x4d, 0xc0,
+  0x01, 0x71, 0xfc, 0x31, 0x15, 0xf7, 0x3e, 0x9d, 0xe5, 0x85, 0xe6, 0x88,
+  0x30, 0x08, 0x21, 0x11, 0xa5, 0x92, 0xf6, 0x80, 0x2e, 0x77, 0x0e, 0x66,
+  0x28, 0xb4, 0x76, 0xdc, 0x30, 0x18, 0xfb, 0x49, 0x36, 0x80, 0xfd, 0x0b,
+  0xf5, 0xb0, 0x86, 0xba, 0x3d, 0x4d, 0x95, 0x0e, 0xe9, 0x7e, 0x31, 0x54,
+  0x67, 0x8a, 0x38, 0x41, 0x65, 0x6b, 0x7a, 0x9b, 0xbc, 0x4c, 0xf1, 0x0a,
+  0x24, 0xe2, 0x4e, 0xb3, 0x31, 0x74, 0x55, 0x16, 0x18, 0x4c, 0xeb, 0xc1,
+  0x0d, 0xf9, 0x13, 0x23, 0x43, 0x8e, 0xb3, 0xe4, 0xbb, 0x33, 0x81, 0xab,
+  0x67, 0x80, 0x61, 0xf0, 0x82, 0xbe, 0x87, 0x24, 0x8a, 0x14, 0xe2, 0x40,
+  0x32, 0xe2, 0xbd, 0xd5, 0x65, 0xfb, 0x12, 0x1b, 0xac, 0x6d, 0x6f, 0xf2,
+  0xa0, 0x36, 0xa9, 0x52, 0xe9, 0xaa, 0xe0, 0xef, 0xf0, 0x42, 0x47, 0xf0,
+  0x07, 0x65, 0xa8, 0x3c, 0xa3, 0x67, 0x5e, 0x02, 0x64, 0x78, 0x9b, 0xf3,
+  0x6c, 0x64, 0x25, 0x7a, 0x82, 0x69, 0x92, 0xd8, 0x7a, 0x91, 0xd8, 0x52,
+  0x04, 0x53, 0x01, 0x5d, 0xf3, 0x52, 0x80, 0x7d, 0x11, 0xc0, 0xf2, 0x1d,
+  0x87, 0x84, 0xe8, 0x5b, 0xe4, 0x07, 0xa1, 0x77, 0xa7, 0xb3, 0x9c, 0x92,
+  0x5d, 0xf4, 0x33, 0x2a, 0x8b, 0x01, 0xfb, 0x3f, 0xa0, 0x72, 0x48, 0x8a,
+  0xb3, 0xab, 0x08, 0x54, 0xfc, 0x7e, 0x19, 0x85, 0xef, 0xb3, 0x63, 0x7b,
+  0x34, 0x02, 0x02, 0xa4, 0x12, 0x38, 0x0a, 0xc1, 0x86, 0x91, 0xc4, 0x1b,
+  0x31, 0x86, 0x94, 0xbc, 0x6e, 0xf8, 0xda, 0xee, 0xe8, 0xbb, 0x40, 0x09,
+  0x73, 0x7f, 0xe8, 0x68, 0xbf, 0x98, 0xdb, 0x4c, 0xe9, 0x69, 0x04, 0x4a,
+  0xf2, 0x6c, 0xc5, 0x38, 0xcc, 0xbb, 0xca, 0xb3, 0x67, 0x55, 0x7a, 0xd9,
+  0x91, 0x52, 0x3e, 0xf1, 0x99, 0xe5, 0x18, 0xe8, 0x37, 0x68, 0xf3, 0xa0,
+  0x5c, 0x27, 0x0b, 0x18, 0xe4, 0x68, 0x68, 0x85, 0x03, 0xd1, 0x3a, 0x49,
+  0xe6, 0xe1, 0x3c, 0xba, 0x48, 0x2f, 0x7d, 0x3d, 0xd0, 0x5a, 0xfd, 0x13,
+  0x2e, 0x3b, 0x72, 0x6b, 0xc1, 0xd0, 0xd0, 0xf6, 0x1c, 0x24, 0x94, 0x31,
+  0x2c, 0x60, 0xe7, 0x2d, 0xac, 0x7f, 0xe7, 0x0d, 0xa5, 0x10, 0x29, 0x44,
+  0xbd, 0x03, 0x18, 0xa3, 0x5e, 0x18, 0x67, 0x1d, 0xfb, 0xd0, 0x75, 0xc2,
+  0x62, 0x56, 0x9a, 0x74, 0xce, 0x39, 0x1d, 0x98, 0xa3, 0x44, 0xb8, 0x34,
+  0x25, 0x19, 0xc0, 0x9c, 0x61, 0x3f, 0x20, 0x02, 0x53, 0x48, 0xad, 0x56,
+  0xd1, 0x75, 0x98, 0xe0, 0x69, 0x54, 0x5f, 0x35, 0x04, 0x57, 0x0f, 0xb2,
+  0x32, 0xb7, 0x9e, 0x93, 0x03, 0xaa, 0x19, 0x6b, 0x38, 0xa8, 0x54, 0x6c,
+  0x18, 0x15, 0x0e, 0x07, 0x7a, 0x5a, 0x2b, 0x07, 0xab, 0x1a, 0x89, 0x1f,
+  0xf9, 0x3b, 0x41, 0xdf, 0x10, 0x6e, 0x28, 0x9b, 0x81, 0xe2, 0x15, 0x57,
+  0x43, 0xc4, 0xa8, 0x35, 0xfe, 0x0b, 0xf9, 0x12, 0x2e, 0xab, 0x02, 0x2d,
+  0x98, 0x3f, 0x23, 0x20, 0x21, 0x57, 0xa2, 0x1c, 0xc4, 0x70, 0x02, 0x78,
+  0x5e, 0x74, 0x77, 0x49, 0x39, 0x2d, 0x75, 0x29, 0x48, 0xca, 0xa7, 0x46,
+  0x09, 0xe1, 0xdf, 0xe0, 0xa9, 0xb9, 0x56, 0x62, 0xa5, 0xfb, 0x1b, 0x8f,
+  0xd5, 0xdb, 0x8b, 0x55, 0xfb, 0x56, 0x05, 0x87, 0xcb, 0xa8, 0x92, 0x4d,
+  0x56, 0xce, 0x82, 0x27, 0x2d, 0xb3, 0x93, 0x3f, 0x38, 0x77, 0xf3, 0xbd,
+  0xe0, 0x1f, 0xf7, 0xa0, 0x49, 0x79, 0x5b, 0x47, 0xfd, 0x32, 0x0b, 0xeb,
+  0xcf, 0x67, 0x05, 0x87, 0x86, 0x61, 0xcc, 0x83, 0xf8, 0xb8, 0xd0, 0x13,
+  0x0d, 0x67, 0xe5, 0x9c, 0x71, 0x21, 0x26, 0x72, 0x42, 0xf8, 0x20, 0x2c,
+  0xe8, 0xba, 0x56, 0xce, 0x77, 0x22, 0x4f, 0x90, 0x48, 0xa7, 0x99, 0xd4,
+  0xfd, 0x2b, 0x24, 0x28, 0x15, 0x16, 0xf8, 0x14, 0x10, 0x22, 0x09, 0x23,
+  0x0a, 0x70, 0x86, 0xb5, 0x64, 0xe1, 0x06, 0x3a, 0x10, 0x6e, 0x59, 0xd5,
+  0xe3, 0x87, 0x64, 0x8f, 0x64, 0x8b, 0x6c, 0x87, 0x82, 0x61, 0x05, 0x34,
+  0x6d, 0xa6, 0x81, 0x92, 0xd3, 0xaa, 0x25, 0x9d, 0x59, 0x11, 0x7d, 0x22,
+  0x45, 0xda, 0x21, 0x05, 0x5b, 0x0b, 0x18, 0xc0, 0x30, 0xb9, 0x0d, 0x48,
+  0xa7, 0x65, 0x88, 0x01, 0x94, 0xcb, 0x18, 0x9b, 0xd0, 0x73, 0x82, 0xab,
+  0x67, 0x29, 0x68, 0x42, 0x60, 0x01, 0xde, 0x97, 0xac, 0x7e, 0x83, 0xe2,
+  0x66, 0x82, 0xc9, 0x64, 0xaa, 0x56, 0x96, 0x6a, 0x13, 0xa6, 0x9a, 0x45,
+  0x6c, 0x5f, 0x41, 0xb1, 0x9a, 0x76, 0x8c, 0x36, 0x42, 0xd0, 0x3e, 0x6f,
+  0x84, 0x5f, 0x57, 0xb4, 0xa4, 0x43, 0x07, 0xbc, 0x8d, 0xd5, 0xad, 0x08,
+  0xb3, 0x8a, 0x02, 0x18, 0xd1, 0x22, 0xd4, 0xbb, 0xad, 0xa1, 0x9b, 0xf3,
+  0x5b, 0x62, 0x3a, 0xb6, 0x3b, 0xb9, 0x46, 0x0d, 0x11, 0xa5, 0x59, 0xda,
+  0xbe, 0x29, 0x80, 0x78, 0x1f, 0x1a, 0x06, 0x12, 0x7d, 0x6c, 0xd9, 0x42,
+  0x0b, 0xd2, 0x6e, 0xa3, 0x42, 0xbd, 0xf3, 0xbf, 0x56, 0xa1, 0xb6, 0xe9,
+  0x76, 0xfd, 0xf9, 0xa5, 0xf9, 0x47, 0x30, 0xb5, 0x0f, 0x1b, 0xde, 0x15,
+  0x3a, 0x21, 0xd6, 0xfe, 0x00, 0xe7, 0x57, 0x76, 0x28, 0x1c, 0x59, 0xca,
+  0xce, 0xdb, 0xde, 0xda, 0x5a, 0x56, 0x4a, 0xd4, 0x6e, 0xba, 0xb8, 0xa2,
+  0x68, 0x5c, 0x52, 0x34, 0x54, 0x14, 0x35, 0x90, 0x9c, 0x9b, 0x34, 0xaf,
+  0xa2, 0x22, 0xc4, 0xd8, 0x87, 0x96, 0xf8, 0x71, 0x86, 0x98, 0x9b, 0x80,
+  0xa8, 0x99, 0x51, 0x85, 0x51, 0x72, 0x57, 0x1f, 0xd1, 0xb0, 0xca, 0xfd,
+  0xf8, 0x35, 0x11, 0x73, 0xc5, 0x3c, 0x30, 0xe1, 0xba, 0x2d, 0xca, 0x8a,
+  0x23, 0x6f, 0xa5, 0xd9, 0x44, 0xa9, 0x6e, 0x35, 0x1b, 0x37, 0x88, 0x55,
+  0x35, 0x84, 0x11, 0x5a, 0x61, 0x51, 0xab, 0x02, 0x1a, 0x4a, 0x8b, 0x3a,
+  0xbc, 0x4f, 0x42, 0xa4, 0x2f, 0xb9, 0x4d, 0x2e, 0xe6, 0xe7, 0x52, 0xde,
+  0xb4, 0x90, 0x69, 0xca, 0xf9, 0x69, 0x61, 0x7e, 0x68, 0x95, 0x55, 0x03,
+  0x5d, 0x84, 0x6f, 0x13, 0x75, 0xa5, 0xd5, 0x00, 0xc5, 0x3d, 0xea, 0x28,
+  0x50, 0x4a, 0x8a, 0x26, 0x52, 0xae, 0xb4, 0xd5, 0x6d, 0x39, 0xf3, 0x58,
+  0x63, 0xd5, 0x52, 0x12, 0xdf, 0xe8, 0xbe, 0x20, 0x60, 0xdf, 0xb8, 0x60,
+  0xa9, 0x9e, 0x7d, 0x2e, 0x59, 0x6a, 0x60, 0x0e, 0x5a, 0x14, 0x55, 0x2a,
+  0x97, 0xba, 0xd2, 0xa5, 0x89, 0xdd, 0x57, 0x0b, 0x84, 0x42, 0x84, 0xff,
+  0x85, 0xe4, 0xb8, 0x85, 0xce, 0x76, 0xba, 0x7b, 0x86, 0x3c, 0xb9, 0x6a,
+  0x7e, 0x8d, 0x2f, 0x1d, 0xaa, 0x04, 0x3f, 0x44, 0x7b, 0x2d, 0xea, 0xfa,
+  0x11, 0x75, 0xbf, 0x40, 0xe5, 0xdf, 0x45, 0x12, 0x53, 0xd2, 0xe5, 0xce,
+  0x0e, 0xb1, 0x36, 0x05, 0x33, 0xb1, 0x2d, 0xed, 0x15, 0x58, 0x43, 0x46,
+  0xcc, 0x90, 0x5a, 0xa5, 0x08, 0xe5, 0xe5, 0x50, 0xe5, 0x2c, 0xd8, 0xd6,
+  0xe4, 0x4e, 0xc2, 0xe5, 0x55, 0xc9, 0x50, 0x9a, 0xc1, 0x3e, 0xc8, 0x5c,
+  0x41, 0xd5, 0xa6, 0x0c, 0x6a, 0xe8, 0x92, 0x78, 0xd6, 0xcc, 0xdd, 0x21,
+  0x92, 0xb8, 0xc6, 0x59, 0xe2, 0x7c, 0x5c, 0xf4, 0x16, 0x55, 0xff, 0x22,
+  0xdb, 0x41, 0x38, 0xe9, 0x30, 0xbf, 0x66, 0xdc, 0xfd, 0x41, 0xd1, 0xe7,
+  0xea, 0x3d, 0x86, 0x68, 0x6c, 0x00, 0x24, 0x3a, 0x85, 0x21, 0x25, 0xd1,
+  0x51, 0x64, 0x0b, 0xed, 0x3f, 0x2c, 0x9c, 0xc4, 0xcb, 0x72, 0x25, 0x0d,
+  0x36, 0x67, 0x28, 0xb8, 0x85, 0x02, 0x17, 0x5e, 0xdd, 0xb2, 0xcb, 0x1b,
+  0x33, 0x6b, 0x36, 0x34, 0xdd, 0xff, 0xf1, 0xc7, 0x8f, 0x32, 0xf7, 0x70,
+  0xb4, 0x09, 0x54, 0xa6, 0x86, 0xc9, 0xce, 0xa9, 0xba, 0xfe, 0xf8, 0x61,
+  0x9d, 0x20, 0xe2, 0xc3, 0xb4, 0xf7, 0x24, 0xc3, 0xf1, 0xda, 0x56, 0x56,
+  0x26, 0xc4, 0xf2, 0x59, 0x0d, 0x9a, 0x4d, 0xa6, 0x22, 0xb7, 0x1a, 0xed,
+  0x19, 0x6c, 0x97, 0x40, 0x9c, 0x47, 0x51, 0x0b, 0xd4, 0x6a, 0x94, 0xbf,
+  0x4f, 0xc6, 0xde, 0xda, 0x6e, 0xe8, 0x39, 0x1e, 0x70, 0xea, 0x2a, 0x5c,
+  0x8a, 0xec, 0x9a, 0xc4, 0x85, 0xf5, 0x0e, 0xfc, 0x82, 0xc1, 0xcd, 0xf9,
+  0x5e, 0xe4, 0xb2, 0x97, 0x6c, 0xa3, 0x60, 0x94, 0x21, 0x5e, 0x0c, 0x5a,
+  0xb5, 0x70, 0xfb, 0x6a, 0xd6, 0x3c, 0x09, 0x2a, 0x99, 0x21, 0x30, 0x43,
+  0xcb, 0x1d, 0xa4, 0xad, 0x0e, 0x6d, 0xc6, 0x02, 0x04, 0x16, 0x41, 0x25,
+  0x65, 0xd5, 0x55, 0x31, 0x30, 0x6b, 0x18, 0xef, 0x33, 0xdc, 0x07, 0x43,
+  0xed, 0x8a, 0xec, 0xd0, 0xe2, 0x27, 0x2d, 0xfa, 0x40, 0x21, 0x5c, 0x82,
+  0x8d, 0x4a, 0xff, 0x59, 0xb2, 0x6d, 0xa7, 0x9c, 0x53, 0xc2, 0x10, 0xe1,
+  0x1b, 0xc4, 0xbb, 0x83, 0x07, 0xb8, 0x1c, 0x71, 0x04, 0x05, 0x85, 0x5e,
+  0x63, 0xfd, 0x77, 0x41, 0xee, 0x20, 0x84, 0x26, 0x24, 0x37, 0x21, 0xf0,
+  0x28, 0x81, 0x53, 0x2b, 0xd2, 0x8f, 0x50, 0x4e, 0x5e, 0xaf, 0xd1, 0xf4,
+  0xe3, 0xad, 0x6d, 0x1a, 0xde, 0xe3, 0xad, 0xaf, 0x37, 0x9a, 0x72, 0x15,
+  0xc8, 0xd4, 0xd6, 0x1c, 0x5d, 0x53, 0x73, 0x1e, 0x2d, 0x7a, 0x8f, 0xea,
+  0x21, 0x07, 0xd8, 0xd6, 0xdd, 0xbc, 0x84, 0x7a, 0xbb, 0x07, 0xa0, 0x6a,
+  0xa5, 0x92, 0x7a, 0xf1, 0x8e, 0x49, 0xca, 0x62, 0x10, 0x36, 0x16, 0xb6,
+  0x54, 0x72, 0x1a, 0xf0, 0x43, 0x26, 0x4c, 0xbd, 0x73, 0xc3, 0x47, 0xa2,
+  0xa3, 0xe1, 0x08, 0xf1, 0x69, 0x2c, 0x7d, 0x1d, 0xb0, 0x9c, 0x51, 0xc1,
+  0xe1, 0x92, 0x2e, 0x68, 0x35, 0x51, 0xcf, 0x3c, 0xd1, 0x5b, 0xe4, 0xf3,
+  0x88, 0xd0, 0xa8, 0xd9, 0x66, 0xdc, 0x60, 0xe4, 0xaf, 0x59, 0x17, 0x25,
+  0x53, 0xd3, 0xf2, 0x3e, 0x5c, 0xfa, 0x0f, 0x9b, 0x19, 0x08, 0x5c, 0x30,
+  0x03, 0x89, 0x5b, 0x61, 0x0a, 0x40, 0x3e, 0x6e, 0xd3, 0x55, 0xda, 0xc3,
+  0xa0, 0xab, 0xac, 0x1b, 0xf9, 0xcc, 0xad, 0x21, 0xc6, 0x03, 0x2d, 0xd5,
+  0x8e, 0x27, 0x11, 0x65, 0xa8, 0x5f, 0x11, 0xda, 0x20, 0x86, 0xfb, 0xa0,
+  0x27, 0x41, 0xc1, 0x0f, 0x2c, 0x6c, 0x8d, 0x11, 0x41, 0xe1, 0xab, 0x35,
+  0xab, 0x05, 0x44, 0x44, 0x4b, 0x2b, 0x30, 0x1b, 0x93, 0x95, 0x81, 0xca,
+  0xda, 0x05, 0xfe, 0x2c, 0x58, 0x0c, 0xc4, 0x08, 0xba, 0xc9, 0x11, 0x81,
+  0xd2, 0xc8, 0x79, 0xf5, 0x18, 0x76, 0xad, 0xab, 0x1c, 0x84, 0xa2, 0x49,
+  0x8b, 0xd4, 0xea, 0xa0, 0xc1, 0xb9, 0x43, 0x11, 0x72, 0xa3, 0x4c, 0x9d,
+  0xab, 0x97, 0xb0, 0x54, 0x20, 0xfd, 0x3a, 0x03, 0x72, 0x15, 0x16, 0x34,
+  0x17, 0xd6, 0x03, 0x05, 0x85, 0xa8, 0x26, 0x64, 0x63, 0xc4, 0xa5, 0xdb,
+  0x51, 0x41, 0x59, 0x0b, 0x27, 0x4c, 0xc7, 0x98, 0xc5, 0x40, 0x7f, 0xd2,
+  0xfa, 0x58, 0x0d, 0x53, 0xb9, 0x15, 0xb8, 0x26, 0xe7, 0xc4, 0x38, 0x8a,
+  0x93, 0x9a, 0x95, 0x5b, 0xdc, 0xa4, 0xb7, 0x84, 0x4e, 0xef, 0xab, 0xab,
+  0xda, 0x72, 0x5c, 0x0a, 0x95, 0xce, 0x27, 0x46, 0x52, 0xb8, 0x1e, 0xc0,
+  0xd8, 0x71, 0xd7, 0xb1, 0x2d, 0xcb, 0x64, 0x59, 0x3c, 0x17, 0x96, 0xda,
+  0x85, 0x61, 0x76, 0xb7, 0x4a, 0xc2, 0x9a, 0x39, 0x4f, 0xb6, 0xda, 0xd2,
+  0x91, 0x1a, 0xaa, 0xd5, 0xe1, 0x8a, 0xc5, 0xfa, 0x76, 0x6a, 0x3e, 0xe4,
+  0xfb, 0x6a, 0xad, 0x94, 0xab, 0x42, 0xc2, 0xdc, 0xe4, 0xa2, 0xc0, 0x30,
+  0x09, 0x96, 0xe0, 0x05, 0xc6, 0x9f, 0xe7, 0x5a, 0xdd, 0x14, 0xfe, 0xbe,
+  0x80, 0x05, 0xbc, 0xe2, 0x78, 0x12, 0xe2, 0x89, 0x99, 0x31, 0x94, 0xc0,
+  0x25, 0x2f, 0x47, 0x45, 0x0f, 0x25, 0x1f, 0x22, 0x2e, 0x29, 0x6c, 0x36,
+  0xa3, 0x50, 0xb3, 0x20, 0xae, 0xa5, 0x54, 0x26, 0x00, 0x96, 0x80, 0xdd,
+  0x58, 0x4b, 0x42, 0x29, 0x7c, 0x4b, 0xb6, 0x08, 0x96, 0x97, 0xd5, 0xcb,
+  0xea, 0x55, 0x94, 0xf0, 0xbc, 0x58, 0x84, 0x16, 0x6e, 0xa6, 0xb4, 0x1e,
+  0xb9, 0xd2, 0xc3, 0xf1, 0x4f, 0x9a, 0xb8, 0xe0, 0xa7, 0x67, 0x02, 0x45,
+  0x2c, 0xe6, 0x1e, 0x4e, 0x28, 0x1d, 0x37, 0x39, 0xaf, 0xf4, 0x33, 0x58,
+  0x70, 0x8d, 0x91, 0x68, 0x80, 0xd5, 0x57, 0x5e, 0xb5, 0xc0, 0x0f, 0x23,
+  0xee, 0x66, 0x1f, 0x47, 0x62, 0xd6, 0x19, 0xa3, 0x9f, 0xc7, 0x67, 0x46,
+  0xc1, 0x1b, 0x99, 0x61, 0xdc, 0xf0, 0x8d, 0x16, 0x8a, 0x54, 0x2e, 0xde,
+  0xd0, 0xb8, 0x31, 0x28, 0x32, 0xc1, 0xfb, 0x22, 0x2c, 0x61, 0xda, 0x4d,
+  0x93, 0x9c, 0x64, 0xc6, 0x06, 0xe9, 0x83, 0x0e, 0xa0, 0xa9, 0xd4, 0x2a,
+  0x2b, 0x51, 0xb5, 0x32, 0x91, 0x95, 0x58, 0x31, 0xf6, 0x87, 0x9b, 0xf0,
+  0x76, 0xf5, 0xfb, 0xc4, 0xcb, 0x4a, 0x32, 0xb5, 0x05, 0x81, 0xc9, 0xe4,
+  0x25, 0x13, 0x95, 0x48, 0x52, 0x8a, 0xf1, 0x78, 0x15, 0x3e, 0x3a, 0x54,
+  0x75, 0x41, 0xce, 0x2b, 0x32, 0x25, 0x9e, 0x46, 0xb6, 0x6c, 0xa5, 0x95,
+  0x61, 0xee, 0x98, 0x5e, 0x4f, 0x08, 0xa4, 0xb4, 0x90, 0x2a, 0xf8, 0x44,
+  0xd4, 0xab, 0x59, 0x92, 0x15, 0xe6, 0x77, 0x51, 0x52, 0xa1, 0x83, 0x3a,
+  0x90, 0x0d, 0xd4, 0xaa, 0x88, 0x06, 0x69, 0xc3, 0x27, 0xc8, 0x95, 0xbb,
+  0xd5, 0x62, 0x65, 0xf9, 0x0c, 0x66, 0x8e, 0xb1, 0x28, 0x04, 0x1e, 0xab,
+  0xc9, 0x9f, 0x28, 0x91, 0x97, 0xec, 0x4f, 0xf6, 0xb8, 0x40, 0xcb, 0x2e,
+  0x7b, 0x77, 0x29, 0x2e, 0x89, 0x1c, 0xa9, 0x87, 0x1b, 0xde, 0x9b, 0x98,
+  0xb8, 0x40, 0x7c, 0xf7, 0xd1, 0x7d, 0x18, 0xc2, 0xca, 0xb2, 0x40, 0x10,
+  0x06, 0xea, 0x40, 0x95, 0xdc, 0x66, 0xd7, 0xe9, 0xdb, 0x1a, 0x79, 0x78,
+  0xef, 0x81, 0xa9, 0x8b, 0x02, 0xa3, 0x32, 0xeb, 0x10, 0xea, 0xa1, 0x77,
+  0x16, 0xbc, 0x2d, 0x12, 0x17, 0xa7, 0xec, 0xa2, 0x9d, 0xc5, 0x72, 0xcf,
+  0xb5, 0xf6, 0x92, 0x21, 0x50, 0xbf, 0x93, 0x4e, 0xd1, 0xca, 0x45, 0x0d,
+  0x0a, 0x8c, 0xa2, 0xe2, 0xb7, 0xe3, 0x0e, 0x91, 0x9f, 0x12, 0xcb, 0x5f,
+  0x96, 0x57, 0xb0, 0xeb, 0x5d, 0x90, 0x39, 0xf0, 0x39, 0x79, 0x90, 0xb0,
+  0x4f, 0x28, 0xf5, 0x54, 0x45, 0x7c, 0x16, 0x2b, 0x13, 0x7e, 0x8d, 0x21,
+  0xc5, 0x13, 0x79, 0xba, 0x4c, 0x02, 0x54, 0x87, 0x83, 0xdc, 0x53, 0x7c,
+  0x23, 0x09, 0xea, 0x75, 0x61, 0xbf, 0xb7, 0x66, 0xad, 0x52, 0xee, 0xff,
+  0x22, 0x9f, 0xe4, 0xe5, 0x15, 0xc6, 0x11, 0x61, 0x76, 0xed, 0x65, 0xd6,
+  0x16, 0xec, 0x5b, 0x21, 0x29, 0x50, 0x9f, 0xe1, 0x32, 0x44, 0x1e, 0x0b,
+  0xb7, 0x93, 0x8d, 0x68, 0xa2, 0xc0, 0x66, 0xfc, 0x08, 0x15, 0xb3, 0x77,
+  0x13, 0x8a, 0x39, 0xac, 0xad, 0xea, 0xc3, 0xe0, 0x3e, 0xb8, 0x06, 0xef,
+  0x23, 0xb5, 0xd0, 0xf3, 0x4a, 0x6a, 0x6a, 0xd5, 0x9f, 0xc2, 0x4b, 0x68,
+  0x5a, 0xa0, 0xfc, 0x62, 0xa1, 0x0a, 0x82, 0x39, 0x53, 0x05, 0x90, 0xeb,
+  0x7d, 0xfb, 0xa0, 0x67, 0xfe, 0xde, 0x18, 0xa4, 0x55, 0x87, 0x4d, 0xa5,
+  0xc4, 0xef, 0x40, 0x33, 0x54, 0xd8, 0x79, 0xa0, 0x71, 0xc9, 0xec, 0x92,
+  0x10, 0xa5, 0x02, 0x35, 0x72, 0x0b, 0x2e, 0xe4, 0x6f, 0x78, 0x95, 0x03,
+  0xc6, 0x5a, 0x68, 0x39, 0xf5, 0xd5, 0x41, 0xf9, 0xea, 0xf6, 0xa8, 0x6e,
+  0xb0, 0x71, 0xb7, 0x51, 0x91, 0x4f, 0xd3, 0x5c, 0x34, 0xee, 0x30, 0x94,
+  0xef, 0xf1, 0xfd, 0x59, 0xc9, 0x59, 0xb6, 0x28, 0x99, 0x70, 0x16, 0x0d,
+  0xb8, 0x0c, 0x4e, 0x14, 0x16, 0x17, 0x58, 0xc9, 0xd8, 0xdd, 0xfa, 0x9a,
+  0x9c, 0xea, 0xbb, 0x5b, 0x4f, 0x19, 0xf1, 0x01, 0x7d, 0x50, 0x3d, 0xb2,
+  0x2c, 0x65, 0x9c, 0x07, 0xfa, 0xf2, 0xe8, 0x42, 0xa1, 0xea, 0xf0, 0xb1,
+  0xed, 0x36, 0xfc, 0x60, 0x95, 0x7e, 0x77, 0x6b, 0xb7, 0xce, 0x32, 0xa1,
+  0x73, 0x02, 0x32, 0x1d, 0xe4, 0x40, 0x0d, 0x04, 0xa4, 0x4f, 0x70, 0x10,
+  0xae, 0xe2, 0x6b, 0x5b, 0x56, 0x01, 0x91, 0xce, 0xd4, 0x70, 0xc4, 0x80,
+  0x40, 0x66, 0xd9, 0x23, 0x56, 0xc8, 0xfe, 0x1a, 0x5d, 0x01, 0x2d, 0x10,
+  0xec, 0x24, 0xcf, 0x30, 0x31, 0x2f, 0x08, 0x5a, 0x99, 0xba, 0x48, 0x99,
+  0xaa, 0x57, 0xfb, 0x90, 0x9d, 0x5f, 0x06, 0x77, 0xf0, 0xc9, 0x92, 0x03,
+  0x35, 0x77, 0x27, 0x49, 0xff, 0x85, 0xf1, 0xed, 0xad, 0xeb, 0x95, 0xfc,
+  0xe0, 0xdb, 0xf5, 0x7c, 0x03, 0xdd, 0x72, 0x66, 0x84, 0xba, 0xa4, 0x4a,
+  0xf0, 0x2f, 0xda, 0x82, 0xfc, 0xcb, 0x7e, 0x53, 0x05, 0xa0, 0x8b, 0x22,
+  0xe8, 0xb0, 0xc0, 0x4a, 0x72, 0xfc, 0xe6, 0x00, 0xad, 0x35, 0x42, 0x0f,
+  0x71, 0x05, 0xf8, 0x61, 0x0a, 0xf2, 0x2b, 0x48, 0xc0, 0xd9, 0x98, 0xaa,
+  0x3a, 0x4b, 0x15, 0x91, 0x51, 0x36, 0xe8, 0xa8, 0x15, 0x97, 0x7a, 0x20,
+  0x1d, 0x92, 0xae, 0x3f, 0x8f, 0xb3, 0xcf, 0x30, 0xfa, 0xa2, 0x8b, 0x08,
+  0x8c, 0x7e, 0x8c, 0xa3, 0xbf, 0x08, 0xa0, 0xcf, 0x95, 0xeb, 0x95, 0xed,
+  0x45, 0x50, 0xf9, 0x1e, 0x9d, 0xd4, 0xa2, 0xec, 0x81, 0x27, 0x6c, 0x12,
+  0xd8, 0x2a, 0xbe, 0xb1, 0xa4, 0x72, 0xc6, 0xce, 0xee, 0xd3, 0xa7, 0xde,
+  0x75, 0x47, 0xb3, 0x66, 0x41, 0x16, 0xe7, 0x9e, 0xf8, 0x92, 0x41, 0x56,
+  0x9a, 0x7a, 0x8c, 0xc5, 0xb9, 0x39, 0x17, 0xda, 0x7a, 0xc2, 0xf1, 0xaa,
+  0x04, 0x2e, 0x5c, 0x96, 0x9c, 0x2d, 0x28, 0xa4, 0x8f, 0xf3, 0x58, 0xde,
+  0x55, 0xa8, 0x14, 0x06, 0x58, 0x26, 0x97, 0xdd, 0x50, 0x81, 0x5c, 0xb9,
+  0xa4, 0x51, 0x56, 0xf5, 0x09, 0xee, 0x9e, 0x01, 0x3a, 0x68, 0x8e, 0x6b,
+  0xb2, 0x49, 0x6b, 0x0e, 0xc5, 0x91, 0x65, 0xe2, 0x54, 0x22, 0xbe, 0xb0,
+  0x7c, 0x6b, 0xfe, 0x31, 0xae, 0x42, 0xcc, 0x2e, 0x97, 0x49, 0xf2, 0x03,
+  0x45, 0xfa, 0x31, 0x84, 0x3e, 0xe1, 0x29, 0x5f, 0x2a, 0x04, 0x93, 0x87,
+  0x19, 0xa4, 0x46, 0x7d, 0xbd, 0xd6, 0x3b, 0x1a, 0x65, 0xbf, 0x02, 0x01,
+  0x1d, 0x72, 0x43, 0xcf, 0xa4, 0xc4, 0xb8, 0x1c, 0xe8, 0x3e, 0xa6, 0x9b,
+  0x54, 0x37, 0x98, 0xa0, 0xf4, 0x03, 0x2d, 0xe8, 0x33, 0x2d, 0x68, 0x27,
+  0xd8, 0x99, 0x3f, 0x88, 0x3c, 0xa4, 0x40, 0xed, 0x36, 0x22, 0xd0, 0x8d,
+  0x41, 0xac, 0x0f, 0x78, 0x89, 0x0c, 0x5f, 0x9f, 0x86, 0x27, 0x79, 0xdd,
+  0x48, 0x1d, 0x12, 0x90, 0x0e, 0x68, 0x5c, 0x1b, 0x23, 0x13, 0x9b, 0x7a,
+  0x3e, 0x31, 0x76, 0x06, 0xfb, 0xd6, 0x29, 0x97, 0x7e, 0xba, 0xca, 0xe8,
+  0xd0, 0x1f, 0x8b, 0x66, 0x39, 0x7e, 0x5c, 0xa6, 0xef, 0x8b, 0x1c, 0x9e,
+  0x71, 0xfd, 0x44, 0x5e, 0xa3, 0x00, 0x3f, 0xe8, 0x13, 0x08, 0x52, 0xf3,
+  0x24, 0xab, 0x01, 0x59, 0x1d, 0x91, 0x1c, 0xe6, 0x59, 0x07, 0x4b, 0x66,
+  0x12, 0xbf, 0x2c, 0x32, 0x1e, 0x04, 0xdb, 0xb7, 0x78, 0x9d, 0x60, 0x2e,
+  0x68, 0x34, 0xe3, 0x4b, 0x48, 0x4d, 0xe2, 0xdc, 0x61, 0x04, 0x49, 0xd6,
+  0x8e, 0xad, 0x5d, 0x92, 0xe0, 0xd8, 0x9b, 0xd3, 0xf2, 0x0b, 0x8b, 0xd7,
+  0x42, 0x9e, 0x02, 0x36, 0x84, 0x9e, 0x26, 0xbd, 0xd5, 0xd4, 0xa2, 0x2d,
+  0xda, 0x3e, 0x99, 0xf6, 0xcb, 0xfc, 0x1f, 0x99, 0xc4, 0x55, 0x11, 0xd7,
+  0x4b, 0x2d, 0x1e, 0x8b, 0xd8, 0x3c, 0x9a, 0xf3, 0x9f, 0x03, 0x39, 0x4c,
+  0xc4, 0x44, 0x8e, 0xe4, 0xa2, 0xe6, 0x83, 0x08, 0x79, 0x5f, 0x40, 0xf7,
+  0xc9, 0x18, 0x36, 0xcb, 0x2e, 0xe7, 0x88, 0xb3, 0x2a, 0xa8, 0x8b, 0x54,
+  0xf7, 0x96, 0x37, 0x53, 0x9f, 0x9a, 0xe6, 0x53, 0x07, 0xfd, 0x2e, 0x6a,
+  0xf1, 0x46, 0x50, 0x2f, 0x81, 0x3d, 0xfc, 0xc6, 0x91, 0x1c, 0x85, 0xce,
+  0x8f, 0x06, 0xa0, 0xda, 0xa6, 0xb3, 0x11, 0xe0, 0xcf, 0xd4, 0xdb, 0x02,
+  0xc8, 0x15, 0x25, 0x75, 0xb9, 0xbe, 0x8d, 0xd3, 0x29, 0x48, 0xa0, 0xa1,
+  0x19, 0x4b, 0x10, 0x3f, 0x95, 0x22, 0x35, 0xd4, 0xa5, 0x70, 0xff, 0x9a,
+  0x7a, 0xcf, 0xe2, 0x58, 0x9b, 0x6b, 0xf7, 0x6a, 0x4d, 0x00, 0xf6, 0x54,
+  0xc2, 0x84, 0xa8, 0xbe, 0x02, 0xa6, 0x31, 0x30, 0x9f, 0xa4, 0xe1, 0x71,
+  0x49, 0x21, 0x0b, 0x74, 0xbd, 0x25, 0xa6, 0x52, 0x67, 0xff, 0x24, 0xde,
+  0xe1, 0x21, 0xcd, 0xc7, 0x5a, 0x64, 0xb5, 0xa6, 0x48, 0xb5, 0x45, 0x42,
+  0x5c, 0x03, 0x6e, 0x84, 0xeb, 0xb8, 0x16, 0x97, 0x0f, 0xa7, 0x43, 0xa9,
+  0x86, 0x0d, 0xe2, 0xba, 0x1d, 0xa6, 0xe5, 0x50, 0x4d, 0x36, 0x94, 0x2b,
+  0x4b, 0x50, 0x9e, 0x9d, 0xa5, 0xc0, 0x92, 0x7e, 0x9b, 0x5e, 0x26, 0x71,
+  0x43, 0x54, 0x59, 0x1b, 0xa3, 0x16, 0x1f, 0xf1, 0x5d, 0xf4, 0x22, 0x91,
+  0x0e, 0xbf, 0xfb, 0x21, 0x7a, 0xab, 0xe1, 0x4e, 0xda, 0x94, 0x4a, 0x5a,
+  0xfd, 0xcb, 0xbc, 0x71, 0x7a, 0x94, 0xee, 0x92, 0x18, 0xd6, 0x5b, 0x79,
+  0x55, 0x20, 0xfb, 0xc0, 0xd5, 0xc7, 0x53, 0x7e, 0x53, 0x24, 0xee, 0x0c,
+  0x96, 0x6a, 0xbf, 0xf0, 0x99, 0x19, 0xd1, 0xb0, 0xb8, 0x62, 0x6f, 0x71,
+  0x35, 0xc1, 0x3f, 0xb0, 0x2d, 0x6c, 0xe9, 0xbb, 0xed, 0xc6, 0xac, 0x82,
+  0xcd, 0xe5, 0xe3, 0x41, 0x3e, 0x7d, 0xcb, 0xe8, 0x54, 0x8e, 0x03, 0x68,
+  0x2c, 0xad, 0xa4, 0x93, 0x50, 0xf0, 0x25, 0x5d, 0xe6, 0x1a, 0xcf, 0xcd,
+  0x95, 0xd1, 0xdd, 0x2b, 0x2c, 0x10, 0x5d, 0x66, 0xd5, 0x22, 0x7b, 0xc9,
+  0x8d, 0xa1, 0xb2, 0x7b, 0x08, 0x57, 0x33, 0x9a, 0x4a, 0x0b, 0x3d, 0x8d,
+  0xb7, 0xdf, 0x3d, 0xbb, 0x9a, 0x5f, 0x52, 0xbd, 0x62, 0x74, 0x38, 0xb6,
+  0xee, 0x9a, 0x87, 0x66, 0xb7, 0x88, 0xdd, 0x3b, 0x17, 0x56, 0xa1, 0x1e,
+  0x38, 0xb2, 0x63, 0x45, 0xf7, 0xa1, 0x45, 0x38, 0xf5, 0xe2, 0x12, 0x79,
+  0x2d, 0x44, 0x00, 0xff, 0xae, 0xd5, 0xe6, 0x05, 0x10, 0xc0, 0x75, 0x85,
+  0x45, 0xae, 0x8a, 0x78, 0x94, 0x37, 0x59, 0xef, 0xbb, 0x1f, 0x50, 0x7e,
+  0xfa, 0xd8, 0xbd, 0xaa, 0xc6, 0xa3, 0x6f, 0xe9, 0x5d, 0x5c, 0x81, 0x4d,
+  0xfc, 0xb3, 0x95, 0x2c, 0x8a, 0x27, 0x70, 0xa0, 0x7d, 0x03, 0xae, 0xce,
+  0x88, 0x7b, 0x79, 0x58, 0x14, 0x4d, 0xef, 0xc6, 0x73, 0x74, 0xc8, 0x45,
+  0x5a, 0x28, 0x82, 0xbc, 0xec, 0x14, 0x4a, 0xc9, 0x7b, 0x46, 0xf1, 0x91,
+  0xd1, 0xf5, 0xe0, 0xae, 0x49, 0x8a, 0xef, 0x61, 0xf7, 0x86, 0x72, 0xe0,
+  0xef, 0xda, 0x5c, 0xad, 0x03, 0xaf, 0xf4, 0x78, 0xa2, 0x4c, 0xee, 0x56,
+  0xc8, 0xee, 0x5b, 0x7b, 0x03, 0x7f, 0xc0, 0x01, 0x81, 0xbb, 0xa8, 0x69,
+  0xc4, 0xe8, 0xb4, 0xd3, 0x47, 0x37, 0xc9, 0xad, 0xad, 0xe1, 0x3c, 0x70,
+  0x75, 0xb7, 0xd7, 0x38, 0x1e, 0x75, 0xed, 0xdb, 0x35, 0xb1, 0x78, 0x18,
+  0xd6, 0x49, 0xf2, 0xf7, 0x79, 0x51, 0xf9, 0x9a, 0x5c, 0x83, 0x62, 0x8e,
+  0x28, 0x3d, 0xf4, 0x31, 0xd7, 0x68, 0x69, 0x1a, 0xdf, 0x2f, 0x2d, 0x1a,
+  0x61, 0x1b, 0xff, 0xfa, 0xa5, 0x15, 0x06, 0xf9, 0x0b, 0xad, 0xf3, 0xb7,
+  0xf9, 0xe4, 0x5b, 0x1c, 0xe8, 0x2f, 0xad, 0x96, 0xe4, 0xe1, 0xdc, 0x95,
+  0xd0, 0x17, 0x6f, 0xd4, 0x1a, 0x77, 0xe0, 0xda, 0x77, 0xcd, 0x47, 0xad,
+  0xb7, 0xd6, 0x56, 0x68, 0xdc, 0xe1, 0x13, 0x53, 0x82, 0x54, 0x7d, 0x95,
+  0x90, 0xff, 0x84, 0x25, 0xa8, 0x4d, 0xbf, 0x4d, 0xd0, 0xbc, 0x8b, 0xeb,
+  0x82, 0x8b, 0x89, 0xba, 0x7a, 0x39, 0x4a, 0xcb, 0x2b, 0xd6, 0x73, 0xf2,
+  0x49, 0x2c, 0xa3, 0x58, 0x5e, 0x5e, 0x46, 0x35, 0x9e, 0xdd, 0x02, 0xdb,
+  0x8b, 0xca, 0x87, 0xff, 0x0c, 0x4d, 0x72, 0xa4, 0x3e, 0x01, 0xf2, 0xd1,
+  0xa9, 0x42, 0xb1, 0x4a, 0xf1, 0x69, 0xaa, 0x82, 0x6f, 0x32, 0xa2, 0x2e,
+  0xa9, 0x31, 0x22, 0x11, 0x1d, 0x71, 0xc8, 0x56, 0x99, 0x8d, 0x73, 0xc2,
+  0x1f, 0x80, 0x81, 0x8f, 0x32, 0x92, 0xec, 0x36, 0x91, 0x69, 0x12, 0x74,
+  0x55, 0x39, 0x4d, 0xd1, 0xa4, 0x03, 0x23, 0x97, 0xaf, 0x64, 0x46, 0x3c,
+  0xfb, 0x98, 0x08, 0xd7, 0xb0, 0x95, 0x59, 0xf9, 0x5d, 0x0b, 0x2e, 0xf2,
+  0x6f, 0xd1, 0xe8, 0x96, 0x4d, 0xbe, 0x4d, 0x7a, 0xa3, 0x39, 0x6c, 0x45,
+  0x38, 0x3a, 0x1f, 0x3b, 0xe3, 0x5b, 0x18, 0xa3, 0x6d, 0xc2, 0xf2, 0x3d,
+  0xd0, 0xd3, 0x94, 0x0e, 0x06, 0xaa, 0x2e, 0x69, 0x42, 0x8b, 0xf0, 0x3a,
+  0x3e, 0x44, 0xee, 0x9c, 0xc8, 0xf7, 0x72, 0x4c, 0x62, 0x7e, 0x45, 0xd2,
+  0xfa, 0x77, 0x27, 0x7f, 0xfa, 0x56, 0x1f, 0xfa, 0xa5, 0xf5, 0x97, 0x0e,
+  0x7f, 0x4a, 0x45, 0x05, 0xf6, 0x93, 0x93, 0x3f, 0x21, 0xe5, 0xdd, 0xcb,
+  0x12, 0x16, 0x5b, 0xfa, 0x81, 0x7f, 0x21, 0xaa, 0x4b, 0x9a, 0xec, 0x45,
+  0x99, 0x8d, 0x2c, 0x49, 0x3e, 0x64, 0xb7, 0x84, 0xcf, 0x49, 0xc1, 0x90,
+  0x98, 0x0d, 0x01, 0x6c, 0x6b, 0x2c, 0x57, 0xb7, 0x16, 0x6c, 0x62, 0x69,
+  0xa6, 0x87, 0xb5, 0x64, 0xc8, 0x7a, 0xad, 0x2c, 0x9c, 0x6a, 0x25, 0xff,
+  0x5d, 0x36, 0x9e, 0x13, 0x2f, 0xa5, 0xda, 0x4f, 0x3d, 0xd7, 0x07, 0x45,
+  0x8a, 0x58, 0x24, 0xf6, 0xc1, 0x75, 0xa1, 0xa0, 0x0f, 0xff, 0x56, 0x6a,
+  0x28, 0x0d, 0xeb, 0xde, 0x6b, 0x7f, 0x58, 0xf3, 0x55, 0xdb, 0xbe, 0x65,
+  0x07, 0x8f, 0x04, 0x54, 0x48, 0x7d, 0x02, 0x83, 0x77, 0x1f, 0xe8, 0x19,
+  0x00, 0x5a, 0x19, 0xe5, 0xbc, 0x0f, 0x26, 0x43, 0x27, 0x7c, 0x49, 0x62,
+  0x30, 0xfc, 0x40, 0x2c, 0x0f, 0x49, 0xe8, 0xad, 0x56, 0xde, 0x21, 0x9f,
+  0x70, 0xfc, 0x93, 0x94, 0xbc, 0x0c, 0xb5, 0xa6, 0x90, 0x06, 0xbf, 0x4d,
+  0x5c, 0x06, 0x9c, 0x16, 0xcb, 0xe8, 0xa8, 0x09, 0x36, 0xa4, 0xe7, 0xd6,
+  0x29, 0x97, 0xb2, 0x71, 0xa4, 0x3e, 0x51, 0x37, 0x79, 0x95, 0x71, 0x18,
+  0x1d, 0x47, 0x54, 0x71, 0xf2, 0x1f, 0xc9, 0xc1, 0x1a, 0x2a, 0x19, 0xaa,
+  0xea, 0xea, 0x7d, 0x48, 0x24, 0xfe, 0x07, 0x16, 0x7d, 0xe9, 0x2c, 0x19,
+  0x87, 0xc4, 0xa9, 0xc9, 0xb2, 0x77, 0xe1, 0x99, 0xbf, 0x48, 0xd2, 0x47,
+  0x67, 0x7b, 0x9f, 0x75, 0x2e, 0xb2, 0x97, 0xf1, 0x67, 0xda, 0x86, 0xc7,
+  0xa6, 0x0f, 0xf9, 0x2b, 0xbc, 0x8a, 0x51, 0x1b, 0x3b, 0xd6, 0x06, 0x1e,
+  0x13, 0x8d, 0xb8, 0xb0, 0xc6, 0xc4, 0xcb, 0xac, 0x60, 0x07, 0x6a, 0x69,
+  0x0b, 0x7a, 0xdd, 0x98, 0x9c, 0xa7, 0xac, 0xd1, 0x49, 0x84, 0x85, 0xa0,
+  0xcb, 0x33, 0xd8, 0x76, 0x45, 0x20, 0x25, 0x42, 0x56, 0x5a, 0xc4, 0xc2,
+  0x60, 0xf2, 0x3b, 0x7c, 0x4b, 0x69, 0x29, 0x8a, 0x62, 0x8c, 0x19, 0x5c,
+  0x83, 0x7d, 0x71, 0x65, 0x13, 0x26, 0x38, 0xe1, 0x81, 0x8b, 0x18, 0x26,
+  0x82, 0x7a, 0xa8, 0xef, 0x64, 0x56, 0x0a, 0xf2, 0x59, 0x09, 0x84, 0x4e,
+  0xdb, 0x1a, 0x07, 0x3e, 0x44, 0x0c, 0x49, 0x0c, 0x85, 0xb4, 0xd1, 0x6b,
+  0xeb, 0x6b, 0xaa, 0xab, 0x62, 0xd3, 0x29, 0x07, 0x2a, 0xb0, 0x89, 0x2c,
+  0xc5, 0xd0, 0x34, 0xa7, 0xb5, 0xee, 0x5b, 0xac, 0x82, 0xa0, 0x05, 0xc6,
+  0x55, 0x06, 0x54, 0xe7, 0xa1, 0x52, 0x21, 0x71, 0x5d, 0x01, 0x1b, 0x42,
+  0xea, 0xd6, 0x4a, 0x1a, 0x61, 0x95, 0x22, 0xc0, 0xc0, 0xa4, 0xc9, 0xda,
+  0x77, 0x1b, 0x6b, 0xa1, 0x70, 0x6d, 0x5d, 0x20, 0x8b, 0x2b, 0x0d, 0xa8,
+  0xaf, 0xcd, 0xb0, 0x34, 0x48, 0x27, 0x1f, 0x63, 0x1c, 0x54, 0x46, 0x9b,
+  0xc1, 0x31, 0x05, 0x65, 0x28, 0x99, 0xc6, 0x85, 0xfa, 0xf2, 0x09, 0x51,
+  0x3b, 0x43, 0xdf, 0xb3, 0x4c, 0xe9, 0x8d, 0xf2, 0x5c, 0xce, 0xb4, 0xdc,
+  0xf7, 0xc2, 0x1b, 0x1d, 0x23, 0x74, 0x38, 0x88, 0x19, 0xf9, 0xb8, 0x52,
+  0xe5, 0xb3, 0x0c, 0x22, 0x61, 0x4d, 0x5e, 0x5b, 0xfb, 0x6e, 0x9d, 0x99,
+  0x70, 0x30, 0x32, 0xb8, 0x6e, 0xc2, 0x95, 0xc8, 0xcf, 0xba, 0xce, 0x84,
+  0x86, 0xea, 0x4f, 0x24, 0xcf, 0xd0, 0x48, 0xfe, 0x3d, 0xb9, 0x3d, 0xe4,
+  0x91, 0x67, 0x9b, 0xf4, 0x51, 0x4d, 0xc6, 0xaa, 0xbf, 0x08, 0x2b, 0x4a,
+  0xff, 0xfe, 0x80, 0x4f, 0xa8, 0xe4, 0xb8, 0x96, 0x74, 0xbb, 0xa0, 0x33,
+  0x96, 0xe3, 0x3a, 0x20, 0xa0, 0x42, 0x29, 0xd2, 0xf5, 0x65, 0x95, 0x51,
+  0x34, 0x9d, 0x45, 0x42, 0xf2, 0xcc, 0x8f, 0x29, 0xc6, 0x15, 0xfe, 0x7a,
+  0xf6, 0x1d, 0x46, 0x25, 0x1d, 0x68, 0xa4, 0xb9, 0x46, 0xa2, 0x73, 0x9d,
+  0x0b, 0xe6, 0x0b, 0x62, 0xbc, 0xc0, 0xe5, 0x7c, 0xda, 0xcb, 0x25, 0x21,
+  0x86, 0xeb, 0x96, 0x51, 0x04, 0x69, 0x36, 0x2a, 0xa5, 0x8c, 0x1e, 0x5e,
+  0x42, 0x62, 0x9f, 0x76, 0x15, 0xba, 0xd0, 0x02, 0xc7, 0x26, 0x37, 0x93,
+  0x5c, 0x65, 0x2c, 0x9d, 0x23, 0xe9, 0x28, 0x09, 0xe1, 0xa7, 0x5f, 0x63,
+  0x17, 0x56, 0x84, 0x41, 0xbd, 0xfa, 0x52, 0xbe, 0x35, 0x79, 0xda, 0xc1,
+  0xaf, 0xed, 0x08, 0x95, 0x21, 0x36, 0x38, 0xf6, 0xe9, 0xb7, 0x55, 0xf0,
+  0xe8, 0x50, 0x08, 0x7f, 0x98, 0x1a, 0xf1, 0x56, 0xc9, 0xf7, 0x91, 0x5e,
+  0x78, 0x21, 0x4a, 0x35, 0x3e, 0x05, 0x33, 0x52, 0x00, 0x27, 0x8a, 0xe6,
+  0xe1, 0xf1, 0xb6, 0x51, 0x18, 0x00, 0xa1, 0x9a, 0xf8, 0x34, 0x5f, 0x12,
+  0x20, 0xa2, 0x5c, 0x56, 0x04, 0x43, 0xf9, 0xf5, 0x13, 0x37, 0xd0, 0x66,
+  0xbd, 0xb0, 0xc6, 0x89, 0x74, 0x32, 0xf5, 0xa1, 0x0b, 0x41, 0x0b, 0x05,
+  0x85, 0x89, 0xa4, 0x3a, 0x13, 0xb3, 0xaa, 0x34, 0x50, 0xb4, 0xa7, 0xcf,
+  0x6f, 0x75, 0xd3, 0xeb, 0x3d, 0xd4, 0xe9, 0xcf, 0xc9, 0xc8, 0xfa, 0x0a,
+  0x77, 0xc5, 0x34, 0xb8, 0x94, 0x04, 0xd1, 0x4a, 0x39, 0x9c, 0xcf, 0x88,
+  0x0d, 0xcb, 0xb7, 0x7c, 0x83, 0x2a, 0xf8, 0xb4, 0x88, 0x72, 0x6f, 0x0e,
+  0xde, 0xbe, 0x3b, 0x78, 0xdd, 0x55, 0x4b, 0xa5, 0xd2, 0xec, 0xc3, 0x14,
+  0xf3, 0xa1, 0x26, 0xa3, 0x7a, 0x6c, 0xf2, 0x91, 0x8a, 0xff, 0xe9, 0x00,
+  0x39, 0x68, 0xeb, 0x5e, 0x34, 0x8c, 0x4f, 0xad, 0xb7, 0xc6, 0xc5, 0x67,
+  0xee, 0xaf, 0xb7, 0x56, 0xab, 0x2e, 0xa0, 0x06, 0xdb, 0x8e, 0x18, 0xf8,
+  0xc5, 0xc1, 0x85, 0x9f, 0xb0, 0x80, 0xeb, 0x7c, 0x19, 0xf6, 0x99, 0x37,
+  0xe7, 0xe6, 0xe3, 0x74, 0x4a, 0x7b, 0xb2, 0x91, 0x9c, 0x62, 0x09, 0x0b,
+  0x1c, 0x2d, 0xe1, 0x60, 0xe0, 0xad, 0x1d, 0x68, 0x2c, 0x94, 0xcf, 0x94,
+  0x32, 0x85, 0x64, 0x8f, 0x8c, 0x82, 0x16, 0x83, 0x00, 0xcd, 0xdd, 0xf0,
+  0x87, 0x66, 0x84, 0x21, 0x55, 0x4c, 0xf3, 0x8b, 0x43, 0x39, 0x9c, 0xb8,
+  0x58, 0xb9, 0x1b, 0xe4, 0x8a, 0xe1, 0xbc, 0xae, 0x50, 0xf9, 0xa7, 0x20,
+  0xf3, 0xfb, 0x8e, 0x58, 0xb9, 0x81, 0xa9, 0xfd, 0x62, 0xfb, 0xbe, 0xe6,
+  0x34, 0x1e, 0x5c, 0xfc, 0x16, 0x6e, 0xfa, 0xda, 0xa7, 0x20, 0xfd, 0x3c,
+  0xad, 0x23, 0x74, 0x4a, 0xc9, 0x55, 0x37, 0x4f, 0xd9, 0x32, 0x36, 0xb5,
+  0xf3, 0x1f, 0xcb, 0x2c, 0xed, 0xc9, 0xb9, 0xa9, 0xdf, 0xfa, 0xba, 0x16,
+  0x3c, 0xb3, 0x1a, 0x2f, 0xba, 0x08, 0xdc, 0x52, 0xf0, 0xb8, 0x98, 0x4e,
+  0x3c, 0x48, 0xe2, 0x12, 0xcd, 0xea, 0xf3, 0x01, 0x99, 0x12, 0xd7, 0x96,
+  0x72, 0x22, 0x5e, 0x8b, 0x0e, 0x92, 0xfc, 0x20, 0xfc, 0xee, 0x99, 0xa2,
+  0xf4, 0x28, 0x37, 0x6a, 0x6b, 0x1e, 0x47, 0x22, 0x4a, 0x47, 0xcb, 0xbc,
+  0x4b, 0x6a, 0x97, 0xe5, 0x81, 0x50, 0x8a, 0x3a, 0xba, 0x42, 0xa2, 0x0a,
+  0x54, 0xe3, 0x2c, 0x9d, 0xf0, 0xbe, 0x5b, 0x2e, 0x00, 0x9b, 0x24, 0xd1,
+  0xa0, 0x2c, 0xf6, 0x61, 0x3f, 0x4b, 0x52, 0xa9, 0x24, 0xbc, 0x8e, 0x31,
+  0x84, 0x6f, 0xb5, 0x24, 0x05, 0x5a, 0x20, 0x73, 0x02, 0x12, 0x77, 0xb9,
+  0x33, 0x3c, 0x12, 0x1e, 0x01, 0x2b, 0x00, 0xfd, 0x3e, 0xd5, 0x9e, 0xa6,
+  0xa3, 0x07, 0xdf, 0x5e, 0x5e, 0x4a, 0x1d, 0x83, 0xe4, 0x07, 0x55, 0x3e,
+  0x92, 0x67, 0xea, 0xc1, 0x65, 0x58, 0x31, 0xd9, 0xac, 0xda, 0x3e, 0x79,
+  0x46, 0x53, 0xa3, 0x47, 0x57, 0xa9, 0xee, 0x93, 0x38, 0x8d, 0x36, 0xad,
+  0x46, 0x90, 0x2a, 0x5d, 0xb1, 0x42, 0x44, 0x4c, 0x4c, 0xd5, 0xb4, 0x83,
+  0x37, 0x0f, 0xc6, 0x2d, 0x45, 0xc5, 0xad, 0x18, 0xec, 0x40, 0x02, 0x30,
+  0x28, 0xff, 0x5e, 0xe3, 0x54, 0xd3, 0xf2, 0x03, 0x9b, 0xa1, 0x5a, 0xfa,
+  0x62, 0xc2, 0xbd, 0xa7, 0xc3, 0x8a, 0xef, 0x79, 0x06, 0xa5, 0x0d, 0xf7,
+  0x85, 0x55, 0x3d, 0x20, 0x0f, 0x17, 0xe1, 0x8b, 0xe9, 0xe1, 0x14, 0x28,
+  0xe7, 0x9a, 0xe5, 0xb3, 0x18, 0x0e, 0x17, 0xd0, 0xd7, 0x0e, 0x0e, 0x0f,
+  0x03, 0x88, 0x3b, 0x27, 0x9a, 0xfb, 0xc1, 0x3f, 0x5c, 0xa2, 0x79, 0x7d,
+  0xad, 0x5d, 0x27, 0xad, 0xf1, 0xac, 0x3b, 0x2b, 0x7a, 0x45, 0xd5, 0x5a,
+  0x09, 0x1d, 0x19, 0x57, 0x22, 0x5e, 0xe9, 0x20, 0xd4, 0x75, 0xaa, 0x82,
+  0x8b, 0x58, 0x3c, 0x93, 0x39, 0x45, 0x0b, 0x8f, 0x96, 0x1f, 0x1f, 0xac,
+  0x69, 0xca, 0x1f, 0x81, 0x1a, 0x9f, 0x1f, 0x9d, 0xf1, 0xc2, 0x9e, 0x1e,
+  0x9c, 0x9f, 0xbb, 0xaa, 0x01, 0x12, 0x9c, 0xa6, 0xd3, 0xe4, 0xb0, 0x3c,
+  0x71, 0x2f, 0xf1, 0xb2, 0x59, 0x30, 0xbc, 0x24, 0x69, 0xb2, 0x9a, 0x07,
+  0x27, 0xe6, 0x62, 0x3e, 0x86, 0xeb, 0x18, 0xb4, 0xc2, 0x01, 0x06, 0x76,
+  0xc1, 0x24, 0x02, 0xbc, 0x14, 0x49, 0x4d, 0xa2, 0xc8, 0x10, 0x05, 0x10,
+  0x2c, 0xd0, 0x0b, 0x84, 0x48, 0x52, 0xbf, 0x84, 0x04, 0x17, 0x38, 0x3c,
+  0x20, 0x4d, 0xf3, 0x48, 0x5a, 0xe7, 0xc7, 0x17, 0x47, 0xb2, 0x83, 0xef,
+  0x2e, 0x5e, 0xb5, 0x14, 0xfd, 0xab, 0x56, 0x53, 0xb0, 0x20, 0x61, 0x0b,
+  0x28, 0x3a, 0xb3, 0x88, 0x5b, 0xab, 0xe3, 0x21, 0x2e, 0x80, 0x46, 0xdc,
+  0x21, 0x4b, 0xc5, 0x5a, 0xb6, 0xbc, 0xf1, 0x55, 0xd0, 0x54, 0x89, 0xee,
+  0xf3, 0x23, 0xdc, 0x97, 0xf5, 0xd9, 0x7a, 0xb7, 0xb7, 0x3b, 0x6b, 0x20,
+  0x91, 0x86, 0xb3, 0xe8, 0x88, 0x8b, 0xaf, 0xdf, 0x05, 0x9a, 0x71, 0x19,
+  0x32, 0x81, 0x42, 0x92, 0xf3, 0xe8, 0x7c, 0xe2, 0x27, 0xe8, 0x68, 0xc4,
+  0x7f, 0xdf, 0x9d, 0xbd, 0xde, 0xb4, 0x24, 0x53, 0xae, 0xe0, 0x90, 0x4a,
+  0x4e, 0x8c, 0x48, 0xd0, 0xca, 0x73, 0x28, 0x94, 0xda, 0xa2, 0x52, 0x28,
+  0x85, 0xc9, 0xa2, 0x13, 0xd5, 0x47, 0xa0, 0xa8, 0x89, 0x0c, 0x63, 0xa3,
+  0x58, 0xe8, 0xc4, 0xe9, 0x42, 0xd4, 0x53, 0x1e, 0xc2, 0x05, 0xad, 0xe2,
+  0x56, 0x84, 0x2c, 0x2f, 0xe1, 0xad, 0x7a, 0x9d, 0x47, 0x38, 0xf5, 0x3c,
+  0x3f, 0x61, 0xf0, 0x92, 0xe4, 0xa3, 0x39, 0x3e, 0x39, 0xe5, 0x6f, 0xc4,
+  0xce, 0xf3, 0x78, 0x49, 0x16, 0xd0, 0xcf, 0x34, 0x8b, 0xfa, 0x13, 0x63,
+  0x43, 0xe2, 0x56, 0xef, 0xdf, 0x76, 0x3f, 0x04, 0x4d, 0x69, 0x58, 0x64,
+  0x09, 0xb3, 0x6c, 0x0c, 0xf2, 0x2e, 0x19, 0x25, 0x37, 0xc9, 0x76, 0xb1,
+  0x98, 0xe1, 0x10, 0x75, 0x1a, 0x76, 0x5d, 0x22, 0x0f, 0x9e, 0xf1, 0xbf,
+  0x11, 0x6f, 0x38, 0x64, 0xb0, 0x2c, 0xb1, 0xca, 0xcb, 0x83, 0x34, 0x34,
+  0xad, 0xf7, 0x27, 0x28, 0x00, 0x33, 0x32, 0x0c, 0xa9, 0x09, 0x9b, 0x62,
+  0x1d, 0xc4, 0x89, 0x0e, 0xed, 0xac, 0x9f, 0x6f, 0x98, 0x37, 0x02, 0x2d,
+  0x1f, 0xd2, 0x8e, 0xea, 0xd3, 0x1e, 0x4d, 0xd7, 0xd5, 0xba, 0x0b, 0x2a,
+  0xb5, 0x66, 0x4c, 0x18, 0xf5, 0x9b, 0x79, 0x82, 0x36, 0xa4, 0x7f, 0x33,
+  0x10, 0x70, 0x0a, 0xf3, 0x5a, 0x1e, 0xfe, 0xfc, 0x3c, 0x64, 0x3f, 0xd3,
+  0x05, 0x42, 0xe3, 0x23, 0xd2, 0x34, 0x05, 0x3b, 0x94, 0x54, 0x63, 0x44,
+  0xab, 0x47, 0x2f, 0xa8, 0x82, 0x4c, 0x36, 0x4d, 0xae, 0x72, 0x78, 0x75,
+  0xd6, 0x87, 0x7f, 0x24, 0x70, 0x0a, 0xa5, 0x81, 0x92, 0x93, 0xf3, 0x94,
+  0x03, 0x76, 0x2d, 0x14, 0x04, 0xa1, 0x37, 0xd0, 0x19, 0x0f, 0x2d, 0x6c,
+  0x7f, 0xbd, 0xfb, 0x94, 0x82, 0x5b, 0xd8, 0xbc, 0xea, 0xca, 0xcd, 0x52,
+  0x71, 0x56, 0x91, 0xb6, 0xd5, 0x58, 0x62, 0x48, 0x4b, 0xbd, 0xb9, 0x95,
+  0xbf, 0x2b, 0xd1, 0x7c, 0x41, 0x96, 0x5f, 0x29, 0x05, 0x60, 0x45, 0xb0,
+  0xc2, 0x34, 0x81, 0xda, 0x70, 0x82, 0x8c, 0x8e, 0xd9, 0x75, 0x19, 0x0b,
+  0xe7, 0xc7, 0xff, 0xe3, 0xa8, 0x9d, 0x9c, 0x1d, 0x5d, 0x9c, 0xb5, 0x93,
+  0xf3, 0x8b, 0x93, 0x33, 0xf4, 0xc3, 0xb3, 0x78, 0x84, 0xf3, 0x2c, 0xa5,
+  0x0b, 0x72, 0x1c, 0xd2, 0x52, 0xc4, 0x61, 0xb6, 0x21, 0x24, 0x55, 0x9d,
+  0x71, 0x65, 0x56, 0x9f, 0x2e, 0x9b, 0xa1, 0xc8, 0xe0, 0x01, 0x4c, 0xac,
+  0x69, 0xa0, 0xbc, 0x03, 0x61, 0xb0, 0xb8, 0xa3, 0x38, 0xda, 0xe0, 0x74,
+  0xa7, 0xfe, 0x2b, 0xd8, 0x7d, 0xe0, 0x80, 0x21, 0xc3, 0xce, 0xb2, 0x6e,
+  0x35, 0x9c, 0x9c, 0x6a, 0xf8, 0x3c, 0x0a, 0x7e, 0xbf, 0x96, 0x96, 0xa0,
+  0x00, 0xbe, 0xbe, 0xce, 0xa5, 0xca, 0x75, 0x17, 0x95, 0x0c, 0x12, 0x0a,
+  0xe6, 0xdc, 0xb0, 0x08, 0x67, 0x1a, 0x6c, 0x59, 0x8c, 0x33, 0xa2, 0x5f,
+  0xb2, 0xad, 0x2a, 0x7f, 0xa1, 0x0c, 0x13, 0x2e, 0x67, 0xc9, 0x8a, 0x7d,
+  0x8b, 0x56, 0xb8, 0x15, 0x85, 0x2c, 0x46, 0x0b, 0x96, 0x4d, 0x80, 0x02,
+  0x6f, 0x71, 0x69, 0x5a, 0xda, 0x5f, 0x2b, 0xaa, 0xd5, 0xe5, 0xce, 0xd2,
+  0x43, 0xd6, 0xea, 0x2a, 0x1b, 0x58, 0x82, 0x74, 0x63, 0xf3, 0x5e, 0x64,
+  0x07, 0xb0, 0xb0, 0xdb, 0xf8, 0x63, 0x67, 0x33, 0x18, 0x32, 0x1b, 0x5a,
+  0xa0, 0x49, 0x7f, 0xfe, 0xeb, 0xb6, 0xd9, 0xf7, 0x37, 0xb1, 0xc0, 0x8e,
+  0x10, 0x6e, 0xa0, 0x23, 0x09, 0xb4, 0x81, 0x19, 0x61, 0xe1, 0x16, 0xcf,
+  0x81, 0x48, 0xfa, 0x8e, 0xea, 0xc2, 0x58, 0x78, 0x17, 0x0b, 0x72, 0x01,
+  0x03, 0x02, 0xd9, 0xb7, 0x3c, 0x58, 0xf3, 0x0a, 0x13, 0xe3, 0x18, 0xd9,
+  0x79, 0x53, 0x92, 0x15, 0x4c, 0x99, 0xf9, 0xc2, 0x2d, 0x12, 0xcb, 0xd0,
+  0x16, 0x6c, 0x80, 0xc2, 0x08, 0x01, 0x9d, 0xa4, 0x94, 0x84, 0x94, 0x17,
+  0x04, 0xb9, 0x1a, 0x0a, 0xd2, 0x4c, 0xbd, 0x65, 0xf1, 0x2c, 0xa3, 0x44,
+  0x3a, 0xd2, 0x75, 0x93, 0x6c, 0x42, 0x91, 0x30, 0x83, 0x30, 0x15, 0xac,
+  0x17, 0x47, 0x40, 0xb4, 0x1c, 0x23, 0x3e, 0x28, 0x38, 0x7c, 0x15, 0xc7,
+  0x43, 0xc5, 0x3c, 0xd0, 0x99, 0xe3, 0x10, 0xdc, 0xf4, 0x3e, 0x93, 0x86,
+  0xc4, 0x4f, 0xcb, 0x69, 0xfa, 0x6e, 0x08, 0x74, 0xd7, 0xe8, 0x08, 0x4e,
+  0xfd, 0xaa, 0x31, 0x07, 0xab, 0xac, 0x36, 0x1f, 0x8a, 0x3f, 0x65, 0x28,
+  0x0a, 0xa3, 0xea, 0x80, 0x56, 0x75, 0x92, 0xc3, 0x28, 0x0d, 0x61, 0x35,
+  0x97, 0x64, 0x3e, 0x19, 0x61, 0x7e, 0x45, 0xad, 0x72, 0x87, 0x0a, 0x2f,
+  0x71, 0x3c, 0xa5, 0x6c, 0xe4, 0xea, 0xc1, 0x94, 0xf7, 0x5e, 0x82, 0xd4,
+  0xdc, 0x52, 0x41, 0xf8, 0x2e, 0x2b, 0x46, 0x53, 0xd1, 0xf8, 0x50, 0x18,
+  0x65, 0x21, 0x29, 0xa7, 0x56, 0xc1, 0x84, 0x3e, 0x3c, 0x6d, 0xfb, 0x45,
+  0xae, 0x83, 0xd3, 0xbf, 0xe0, 0x50, 0x75, 0xdc, 0xee, 0x2c, 0xe2, 0xeb,
+  0x0c, 0x01, 0x09, 0xdc, 0x6d, 0x13, 0x69, 0x3d, 0x43, 0xf7, 0x34, 0x5c,
+  0xa6, 0x96, 0x94, 0x17, 0x04, 0x63, 0x57, 0xbe, 0x08, 0x1a, 0xeb, 0xd6,
+  0xe7, 0x23, 0x58, 0xb2, 0x52, 0xe2, 0x36, 0x8b, 0x8b, 0xbf, 0x74, 0x2d,
+  0x24, 0xc6, 0xf6, 0xcb, 0x84, 0xf4, 0xba, 0xdc, 0x2b, 0x3d, 0xb2, 0x09,
+  0x24, 0x24, 0xd3, 0xb3, 0x48, 0x8d, 0xc2, 0x78, 0x0d, 0x42, 0x4e, 0x81,
+  0xca, 0x19, 0xd7, 0x63, 0x56, 0x69, 0xc8, 0x52, 0x7c, 0x20, 0x49, 0x49,
+  0xab, 0x15, 0x33, 0x04, 0xd6, 0x36, 0x9f, 0x06, 0x21, 0xc0, 0xe1, 0xf4,
+  0x6b, 0x5b, 0x1a, 0x5d, 0xe0, 0xc7, 0x55, 0x15, 0xdd, 0xb0, 0xba, 0xfe,
+  0xf6, 0x2c, 0x2c, 0x07, 0x70, 0xa8, 0x57, 0xbf, 0x81, 0x7c, 0xe3, 0x3d,
+  0xc3, 0xf8, 0xd4, 0x58, 0xcd, 0x02, 0xfb, 0x16, 0x44, 0x1a, 0x89, 0x1c,
+  0xb1, 0x07, 0x61, 0x82, 0x6e, 0x1c, 0x71, 0x75, 0x9d, 0x47, 0xb8, 0xae,
+  0xeb, 0xef, 0x26, 0xf9, 0x47, 0xb2, 0xc8, 0x2a, 0xde, 0x50, 0x78, 0xde,
+  0x7a, 0x51, 0x4c, 0x74, 0xac, 0xa8, 0xe0, 0x7b, 0xa3, 0x64, 0x23, 0x2c,
+  0x6f, 0x1f, 0xbf, 0xe4, 0x31, 0x5b, 0xad, 0x8d, 0xf1, 0x6d, 0x17, 0x3f,
+  0xeb, 0x0e, 0x8a, 0x31, 0x99, 0xd7, 0xe3, 0x56, 0xc6, 0x04, 0x5b, 0xa0,
+  0x1c, 0xb3, 0xf3, 0x95, 0x14, 0x93, 0xe5, 0x6d, 0x9e, 0xe6, 0xb4, 0x73,
+  0x1a, 0x6f, 0x7f, 0x7c, 0x1a, 0x76, 0x49, 0xbc, 0xd4, 0xa5, 0x16, 0x49,
+  0x0d, 0xa8, 0xbf, 0x72, 0x8f, 0x0a, 0xf4, 0x69, 0xc4, 0x32, 0x55, 0x88,
+  0x11, 0x90, 0x41, 0xa0, 0x1c, 0x06, 0xad, 0xef, 0x5f, 0x15, 0x79, 0x3f,
+  0x8b, 0x2b, 0x18, 0xc5, 0x05, 0xa5, 0xa8, 0xd2, 0xd9, 0x62, 0xcd, 0xad,
+  0xa8, 0x00, 0x9d, 0x22, 0x85, 0x19, 0x0b, 0x9d, 0xcb, 0x11, 0xa1, 0x92,
+  0x61, 0xca, 0x74, 0x5c, 0x1c, 0x1a, 0x35, 0x6a, 0x51, 0x68, 0xb5, 0xfa,
+  0x66, 0xbe, 0xb6, 0x5c, 0x5e, 0x2a, 0x0b, 0xc5, 0x57, 0xfe, 0xf8, 0xc7,
+  0x6e, 0xdd, 0x57, 0x2c, 0x80, 0xb4, 0xa8, 0x99, 0xb6, 0xf6, 0xff, 0x46,
+  0xee, 0xa3, 0x5f, 0x3b, 0x7f, 0x83, 0x3f, 0x7f, 0x6d, 0x19, 0xe5, 0x73,
+  0xa5, 0x39, 0x95, 0x37, 0x65, 0x1d, 0xdb, 0x96, 0x5e, 0x81, 0xda, 0x23,
+  0xaf, 0x3a, 0xc9, 0x0f, 0x17, 0x87, 0xa7, 0x4c, 0xb9, 0x08, 0x47, 0xc4,
+  0xe1, 0x91, 0xf3, 0x92, 0x84, 0x3a, 0x14, 0x2e, 0x88, 0xbf, 0x12, 0x42,
+  0xae, 0x42, 0x16, 0xa6, 0x6a, 0x00, 0x82, 0x57, 0xe8, 0x8d, 0x76, 0x08,
+  0xa5, 0xb9, 0xe1, 0x63, 0x92, 0x82, 0xa8, 0x79, 0x89, 0x86, 0x64, 0x2e,
+  0x2b, 0x80, 0x50, 0x28, 0x1a, 0x77, 0xc7, 0x9f, 0x28, 0x78, 0x98, 0x78,
+  0xe7, 0x6e, 0x60, 0x44, 0x1c, 0xac, 0x23, 0x38, 0x68, 0x99, 0xe1, 0x3a,
+  0xe5, 0x93, 0x3e, 0xe1, 0xad, 0xc9, 0x51, 0x9c, 0xe5, 0xe5, 0x07, 0x9c,
+  0x99, 0x64, 0x74, 0x49, 0xe8, 0x58, 0xf0, 0xc5, 0xd1, 0xa8, 0xd0, 0xf0,
+  0x44, 0x21, 0x6a, 0x18, 0x2e, 0xa0, 0xfe, 0x91, 0xae, 0xd3, 0x72, 0xe9,
+  0xa9, 0x26, 0x61, 0xe6, 0xf3, 0x74, 0xda, 0x9a, 0x28, 0x73, 0x9a, 0x74,
+  0x98, 0xa5, 0x2f, 0x43, 0xd0, 0x3b, 0xe5, 0x33, 0x7d, 0xcf, 0x33, 0xbe,
+  0x4a, 0xc1, 0xc2, 0xa3, 0x8d, 0x6a, 0x30, 0x5d, 0x26, 0x82, 0xef, 0x1b,
+  0x57, 0x70, 0x73, 0x82, 0xc8, 0x2c, 0x8b, 0x0a, 0x2b, 0x72, 0x18, 0x55,
+  0x9a, 0x9c, 0x82, 0x78, 0x1d, 0x12, 0xea, 0x34, 0xda, 0x0e, 0xaf, 0xc8,
+  0x84, 0x01, 0x90, 0xf0, 0x3e, 0x45, 0x11, 0x14, 0x21, 0xfc, 0x29, 0x03,
+  0xd5, 0x6a, 0xaa, 0x59, 0xc1, 0x41, 0x3c, 0xf5, 0x14, 0x3c, 0x3e, 0x83,
+  0x9e, 0x30, 0x10, 0x52, 0x10, 0xe0, 0xd4, 0x86, 0x42, 0x49, 0xb8, 0x86,
+  0xe7, 0x6a, 0x7d, 0x59, 0xba, 0x4d, 0x90, 0x9a, 0x47, 0xec, 0x47, 0x2c,
+  0x89, 0x3a, 0x88, 0x3c, 0xe8, 0x97, 0xf9, 0x54, 0x73, 0xd0, 0x18, 0xff,
+  0x43, 0x6c, 0x97, 0x3c, 0x4a, 0xba, 0x35, 0x16, 0xeb, 0x4f, 0xe9, 0xa4,
+  0x1b, 0x53, 0x6e, 0x02, 0xc2, 0x77, 0x3d, 0xd5, 0xd6, 0x3c, 0xb0, 0x4d,
+  0x7a, 0x2e, 0xb6, 0xb7, 0xc2, 0xdd, 0x8e, 0xbd, 0xae, 0x62, 0xe4, 0x0a,
+  0x72, 0x4e, 0x28, 0xff, 0x95, 0x86, 0x6b, 0x9a, 0x3e, 0x40, 0x80, 0x77,
+  0xfa, 0xb4, 0xa3, 0xb9, 0x20, 0x52, 0x13, 0x4f, 0x80, 0x03, 0x15, 0xd5,
+  0x87, 0x21, 0x95, 0x1d, 0xf3, 0x74, 0x57, 0xa5, 0x55, 0x31, 0x50, 0xd0,
+  0x88, 0x5a, 0xa4, 0x3d, 0xd9, 0x12, 0xd0, 0xfc, 0x5e, 0xea, 0x9a, 0xda,
+  0x1e, 0x39, 0x78, 0x0a, 0xe5, 0xb3, 0x6a, 0x80, 0x0a, 0x61, 0xdc, 0x9e,
+  0x01, 0x1f, 0xab, 0xa5, 0x42, 0xd2, 0x53, 0xe7, 0x76, 0x84, 0x89, 0xc1,
+  0xfb, 0x2b, 0x8b, 0xa1, 0xd4, 0x99, 0xb9, 0x1b, 0x3b, 0x0d, 0xe9, 0x0e,
+  0x0d, 0xec, 0xbd, 0x39, 0x4f, 0x49, 0x6b, 0x40, 0xf4, 0x2c, 0x21, 0x57,
+  0xb1, 0xe3, 0x18, 0xfc, 0x9f, 0xa0, 0xe3, 0x1a, 0x5e, 0x8d, 0x8b, 0xdf,
+  0xe5, 0x43, 0xa9, 0xe9, 0xc9, 0xe5, 0x1f, 0x67, 0x2c, 0x48, 0x1a, 0x5a,
+  0x74, 0x60, 0xea, 0x41, 0x88, 0xec, 0x2e, 0xda, 0x57, 0xfc, 0x76, 0x3d,
+  0x5c, 0x9a, 0x42, 0xad, 0xe1, 0xfb, 0x49, 0x30, 0x1a, 0xc6, 0xca, 0xa4,
+  0xb8, 0x40, 0x7b, 0xe5, 0xa8, 0xd3, 0xef, 0xf7, 0xeb, 0xfa, 0xcb, 0xe1,
+  0xe1, 0x61, 0xb2, 0x7e, 0x48, 0x55, 0x88, 0x0f, 0x85, 0x4e, 0x0e, 0xaf,
+  0x30, 0x5c, 0x71, 0x04, 0x6c, 0xe5, 0x6a, 0x0e, 0x04, 0x82, 0xe7, 0x94,
+  0xf6, 0xf0, 0xfc, 0xfc, 0xf5, 0x26, 0xe5, 0x50, 0x8d, 0xd2, 0x5b, 0x85,
+  0x71, 0x13, 0x5b, 0x77, 0xcd, 0x48, 0xdb, 0xd5, 0xd4, 0x19, 0x24, 0xcb,
+  0x4a, 0xfd, 0x56, 0x9c, 0x4e, 0xa0, 0x94, 0xc0, 0x28, 0x3d, 0xd0, 0x4f,
+  0x90, 0x0b, 0xe7, 0x13, 0x97, 0x91, 0x0f, 0x32, 0x7d, 0xa6, 0x40, 0xa1,
+  0xaa, 0xe0, 0x4b, 0xa2, 0xe1, 0xdb, 0x03, 0xe0, 0x72, 0x33, 0x50, 0x82,
+  0x2d, 0x41, 0xd7, 0xe5, 0x18, 0x51, 0x2f, 0xa1, 0x3e, 0x6c, 0xda, 0xb7,
+  0xd2, 0xcd, 0x99, 0xc3, 0x8f, 0x66, 0x6d, 0x8d, 0x6c, 0xa2, 0x2c, 0x2e,
+  0x36, 0xa6, 0xfb, 0x85, 0x65, 0x5b, 0x92, 0xdc, 0xba, 0xd4, 0xb0, 0xc6,
+  0xdb, 0x1e, 0x95, 0xfe, 0xd4, 0xbd, 0xe7, 0x06, 0x57, 0xd8, 0x76, 0xe9,
+  0x79, 0xb8, 0x34, 0x5a, 0xd5, 0x6d, 0x39, 0x3c, 0xec, 0x18, 0x8f, 0xbc,
+  0xda, 0x61, 0x6e, 0xba, 0x48, 0x04, 0xf4, 0x05, 0x48, 0xb3, 0x24, 0xaa,
+  0x6f, 0xca, 0x0a, 0x7c, 0x1f, 0xdf, 0x28, 0xe2, 0x10, 0x43, 0xfa, 0x18,
+  0x2b, 0xf6, 0x45, 0xa8, 0x06, 0xc9, 0x0b, 0x18, 0xa0, 0x28, 0x44, 0x9d,
+  0xf0, 0xa1, 0xdd, 0x25, 0x50, 0x0f, 0xd2, 0x0e, 0xcb, 0x04, 0x7a, 0xe4,
+  0x18, 0xc5, 0xc6, 0xd4, 0x64, 0x57, 0x62, 0xbc, 0x80, 0x75, 0x6b, 0x2c,
+  0x8c, 0x3b, 0xcb, 0x04, 0xba, 0x9f, 0x18, 0x8f, 0xb4, 0xea, 0xd0, 0xe6,
+  0x0c, 0x9b, 0x1e, 0x07, 0x28, 0xea, 0x87, 0xec, 0xaf, 0x8c, 0xaa, 0x74,
+  0x99, 0xa0, 0xf6, 0x3e, 0xe1, 0xa1, 0xd0, 0x68, 0x04, 0xda, 0x47, 0x3a,
+  0x0a, 0x0d, 0x87, 0x96, 0xef, 0x22, 0x0d, 0x5e, 0xcc, 0x95, 0x20, 0x20,
+  0xee, 0xcf, 0x04, 0x5d, 0xdc, 0xbc, 0xd5, 0xa8, 0x84, 0x07, 0x21, 0x93,
+  0xff, 0x0c, 0xfa, 0x89, 0x29, 0xb3, 0x36, 0x47, 0x3e, 0xb1, 0xb1, 0x46,
+  0x29, 0x32, 0x81, 0xf1, 0x04, 0xf3, 0x92, 0xd2, 0xd1, 0x1b, 0x15, 0x97,
+  0x39, 0xd9, 0xbb, 0xb9, 0xbc, 0x79, 0x14, 0x01, 0x23, 0xd7, 0xfb, 0x01,
+  0x9f, 0x65, 0x2d, 0x68, 0x10, 0x21, 0x72, 0x30, 0xc9, 0x10, 0xf0, 0x9e,
+  0x61, 0x05, 0x93, 0x41, 0xc5, 0x61, 0xd1, 0x98, 0xc0, 0x01, 0x8b, 0x9b,
+  0xf7, 0x41, 0x49, 0xec, 0xdf, 0x76, 0x09, 0x7d, 0x42, 0xaf, 0x34, 0x8b,
+  0x48, 0xc9, 0x87, 0xb1, 0x97, 0xc5, 0xd5, 0x4f, 0x94, 0xd0, 0x34, 0x59,
+  0x0e, 0x9e, 0xcb, 0xa2, 0xb9, 0xc0, 0x2d, 0xc2, 0x43, 0x15, 0xbc, 0xac,
+  0x35, 0xbb, 0xe2, 0x3e, 0xcb, 0x18, 0x56, 0x70, 0xa8, 0xb8, 0x7a, 0xf7,
+  0x2f, 0xd1, 0x40, 0x60, 0x09, 0x40, 0x92, 0xbd, 0xce, 0xee, 0x2f, 0x4b,
+  0x75, 0x69, 0xd0, 0xe8, 0xa9, 0x0c, 0x35, 0x87, 0xe4, 0x04, 0x60, 0x80,
+  0x08, 0xb1, 0x44, 0x63, 0x27, 0xf0, 0xdf, 0x8e, 0x44, 0x29, 0x11, 0x6c,
+  0x13, 0x7f, 0x02, 0x63, 0xe7, 0xd8, 0x15, 0xce, 0x2d, 0xc9, 0x42, 0x76,
+  0x24, 0xa7, 0xa2, 0xab, 0xe4, 0xf9, 0x12, 0x64, 0x56, 0x4d, 0xa9, 0x33,
+  0xd7, 0x88, 0xea, 0x3d, 0x94, 0x97, 0xa6, 0xdf, 0x4a, 0x54, 0x12, 0x7a,
+  0xb2, 0x6f, 0x72, 0xc4, 0xa3, 0x62, 0x33, 0x7f, 0x00, 0x7e, 0xc2, 0x9b,
+  0x82, 0xd6, 0xcc, 0xe1, 0x77, 0x07, 0xfd, 0x80, 0x29, 0xa8, 0xb0, 0x82,
+  0xa8, 0x94, 0x28, 0x03, 0x2d, 0xcf, 0xb4, 0xa4, 0x84, 0xb3, 0x98, 0x86,
+  0x4c, 0x4e, 0xc6, 0x6f, 0x48, 0x03, 0xc8, 0x9e, 0xc4, 0x97, 0x48, 0x8a,
+  0x10, 0x27, 0xce, 0x49, 0xe4, 0x72, 0x48, 0x98, 0x91, 0xe3, 0xed, 0xca,
+  0xac, 0x69, 0xaf, 0x1a, 0x30, 0xfa, 0xea, 0xe8, 0xe0, 0x79, 0xc0, 0xfb,
+  0xf2, 0x24, 0x87, 0xb6, 0xe7, 0x07, 0xc9, 0xf4, 0xbd, 0x5c, 0x10, 0x70,
+  0xeb, 0xf6, 0x5a, 0xec, 0xea, 0x5e, 0xa8, 0x70, 0x7c, 0xa8, 0x03, 0x9a,
+  0x6a, 0x55, 0x14, 0x23, 0x8d, 0xe8, 0x81, 0x3f, 0xd3, 0xcb, 0xec, 0xbb,
+  0x62, 0x34, 0x68, 0xad, 0xd8, 0xc0, 0x71, 0xbd, 0x8d, 0x95, 0x9c, 0xf4,
+  0x86, 0x96, 0x64, 0x69, 0x97, 0x4a, 0xd6, 0x97, 0x44, 0xd6, 0xa3, 0xa2,
+  0x57, 0x0c, 0x45, 0x8a, 0x3b, 0xe7, 0x0a, 0xc4, 0xe8, 0x34, 0x57, 0x94,
+  0x77, 0x02, 0xbd, 0xe8, 0x91, 0x48, 0xa7, 0x65, 0xd3, 0x25, 0x14, 0x99,
+  0x0c, 0x99, 0x9c, 0xe7, 0xea, 0x90, 0x51, 0xb8, 0xa1, 0xdb, 0x5a, 0x8d,
+  0x13, 0x07, 0x62, 0x22, 0x61, 0xb5, 0xac, 0x56, 0x52, 0xcd, 0xf5, 0x32,
+  0xf9, 0xe7, 0xbf, 0xfe, 0xf6, 0x6b, 0x30, 0xcb, 0x5f, 0x51, 0xde, 0xb7,
+  0xcb, 0xad, 0x84, 0x1b, 0x26, 0x1b, 0x0d, 0xd9, 0xd4, 0x43, 0xda, 0x04,
+  0x82, 0xca, 0x77, 0x5d, 0xf0, 0x3e, 0x3b, 0x33, 0xb4, 0x35, 0x0c, 0xf9,
+  0x23, 0xde, 0xc4, 0x2e, 0x05, 0x09, 0x85, 0xce, 0x2e, 0xd3, 0x91, 0x55,
+  0x01, 0xa6, 0x04, 0x18, 0xe4, 0x90, 0xf0, 0xe6, 0xad, 0x33, 0x45, 0x69,
+  0xc4, 0x61, 0x94, 0x89, 0x29, 0x84, 0x77, 0x2c, 0x97, 0xb2, 0x68, 0x6e,
+  0x35, 0x8a, 0xe3, 0x65, 0x5c, 0xa6, 0x5d, 0xc5, 0x78, 0x06, 0xb1, 0xd5,
+  0xa5, 0x89, 0xec, 0xb8, 0xb5, 0x3b, 0x79, 0x1a, 0xd6, 0x24, 0x68, 0x48,
+  0xc3, 0xf9, 0xe7, 0xdf, 0x7e, 0xfd, 0x17, 0xfc, 0x5f, 0xab, 0x11, 0x02,
+  0x6d, 0x98, 0x5f, 0xc6, 0x8a, 0xb1, 0xdd, 0x54, 0x57, 0x70, 0xd0, 0x6e,
+  0x3b, 0xd9, 0x6d, 0xd6, 0x03, 0xae, 0x55, 0x2a, 0x4c, 0x5a, 0x67, 0x5c,
+  0x26, 0xcf, 0xc6, 0x6a, 0x0a, 0xd5, 0x6a, 0x8d, 0x0a, 0xc2, 0x86, 0x77,
+  0xd2, 0x2b, 0x7c, 0x2f, 0x39, 0x92, 0xf7, 0x42, 0x71, 0x01, 0xff, 0xa9,
+  0x56, 0xdd, 0x4e, 0x47, 0x97, 0xc5, 0x0c, 0xe6, 0x38, 0x16, 0xff, 0x71,
+  0xec, 0xbc, 0x35, 0x23, 0x21, 0xe3, 0x4c, 0xaa, 0x85, 0xee, 0xfa, 0xb1,
+  0xe4, 0xbb, 0xfa, 0xf2, 0x9b, 0x99, 0x4a, 0x1c, 0x83, 0x79, 0x3a, 0x42,
+  0x5d, 0x1a, 0xad, 0x66, 0x68, 0x73, 0xc3, 0x9c, 0x8c, 0xcb, 0x9c, 0x91,
+  0x28, 0xe4, 0x8d, 0x80, 0x12, 0x28, 0x89, 0xf8, 0xca, 0x18, 0x03, 0x4f,
+  0x16, 0x63, 0x0c, 0xc5, 0x9a, 0xe5, 0x23, 0x50, 0xba, 0x19, 0xcc, 0xb0,
+  0x6b, 0xd5, 0xc3, 0xa9, 0xad, 0xd8, 0x68, 0x0a, 0xd4, 0x4d, 0xd5, 0x55,
+  0x32, 0x1d, 0x39, 0xf3, 0x28, 0x4b, 0xf6, 0x40, 0xaa, 0xcc, 0x11, 0xe4,
+  0x92, 0x0c, 0xfc, 0xa9, 0xd7, 0x0a, 0x23, 0x8c, 0x25, 0xe2, 0x79, 0xe3,
+  0x74, 0x90, 0x25, 0xbe, 0x92, 0xa4, 0x2b, 0x2c, 0x2b, 0x71, 0x49, 0x29,
+  0xc6, 0x46, 0x65, 0x23, 0x15, 0xc3, 0x1d, 0xaa, 0x90, 0x43, 0xc0, 0xe7,
+  0x8c, 0x5b, 0x38, 0xe2, 0x58, 0x90, 0x9c, 0x20, 0x15, 0xc4, 0xf6, 0x57,
+  0x4c, 0xb2, 0x08, 0x06, 0xde, 0x67, 0xe7, 0xb3, 0xb9, 0x0b, 0xf5, 0x0b,
+  0x51, 0x8c, 0xe1, 0x35, 0xa9, 0x7e, 0xad, 0x55, 0x04, 0x70, 0x03, 0x29,
+  0x4a, 0x94, 0x62, 0xeb, 0x69, 0x73, 0x6d, 0x77, 0xc5, 0x1f, 0xf2, 0xe2,
+  0x30, 0x79, 0xb2, 0xb7, 0xb7, 0xc7, 0xee, 0xd1, 0xd6, 0x31, 0xf5, 0x74,
+  0x76, 0x74, 0x78, 0xf2, 0xe6, 0xcd, 0xd1, 0xdb, 0xe7, 0x47, 0xcf, 0x0d,
+  0xbc, 0x44, 0x87, 0x6a, 0x9b, 0x4f, 0x00, 0x87, 0x69, 0x5f, 0x8d, 0xd2,
+  0xdb, 0x7b, 0x5b, 0x9d, 0x9d, 0xbd, 0xad, 0x04, 0x28, 0x2f, 0xe5, 0xcc,
+  0x65, 0x9c, 0x54, 0x3a, 0x42, 0xc8, 0x91, 0xe4, 0x6a, 0x3e, 0x4e, 0x09,
+  0xe7, 0x1f, 0xcd, 0x23, 0xa5, 0x81, 0xf4, 0x4e, 0xb2, 0x0a, 0x0d, 0x69,
+  0x28, 0x34, 0xa5, 0x83, 0x6e, 0x4b, 0x73, 0x1f, 0xb8, 0xc2, 0x64, 0x88,
+  0x4b, 0x10, 0xd5, 0x85, 0xe8, 0x6d, 0x67, 0x0b, 0xbb, 0x00, 0x71, 0x27,
+  0x47, 0x28, 0xa0, 0x8f, 0x09, 0x6b, 0x6d, 0x33, 0x2c, 0x8c, 0x15, 0xde,
+  0x88, 0x2a, 0x8c, 0xd2, 0xf6, 0xec, 0x22, 0x36, 0xdf, 0xb8, 0xb4, 0x58,
+  0x91, 0xe5, 0xc7, 0xe6, 0xcb, 0xa1, 0x5a, 0x2f, 0xef, 0x73, 0x6f, 0x6b,
+  0x6b, 0xb5, 0x3b, 0x61, 0x9c, 0x7e, 0xa4, 0xf7, 0x14, 0xe6, 0xba, 0x19,
+  0x1c, 0x11, 0x7b, 0xe2, 0x1a, 0x37, 0xe4, 0x41, 0x00, 0xd5, 0xf9, 0x59,
+  0x3e, 0xad, 0xa1, 0xf8, 0x66, 0x55, 0x08, 0xda, 0x39, 0x3e, 0x25, 0x52,
+  0x7d, 0x75, 0x70, 0x8a, 0x6f, 0x25, 0xa7, 0x67, 0x27, 0x7f, 0xf9, 0x6b,
+  0x48, 0xc8, 0xbf, 0xde, 0xd6, 0x4c, 0x88, 0xb4, 0x72, 0x3a, 0x4e, 0x2f,
+  0x03, 0x39, 0x77, 0x22, 0x59, 0xe6, 0x62, 0xe7, 0xa8, 0xd9, 0x37, 0xd0,
+  0x71, 0x4f, 0xe5, 0x2a, 0x43, 0xbd, 0xdf, 0xf8, 0x88, 0x20, 0xe4, 0xb8,
+  0xe4, 0x53, 0x19, 0x56, 0xdf, 0x40, 0xb2, 0x78, 0x41, 0x62, 0xcd, 0xb3,
+  0x50, 0x8d, 0x8b, 0x6c, 0xf8, 0x40, 0x0b, 0x8f, 0xe9, 0x36, 0xb9, 0xe4,
+  0xca, 0xab, 0x13, 0x45, 0xa1, 0xc7, 0xdc, 0xbd, 0xbf, 0x6d, 0x75, 0xbb,
+  0x3b, 0x7b, 0x7b, 0xbf, 0xa2, 0xc9, 0x55, 0x11, 0xdf, 0xa4, 0xb2, 0x8d,
+  0x01, 0xc0, 0x2a, 0xd2, 0xe6, 0x0c, 0x51, 0xfa, 0x31, 0xce, 0x4c, 0x70,
+  0x2f, 0x42, 0xc5, 0xd7, 0xde, 0xad, 0x75, 0x45, 0x78, 0xa3, 0x03, 0xe2,
+  0x15, 0x92, 0x2c, 0x13, 0x70, 0xa1, 0x48, 0x12, 0xc3, 0x74, 0x15, 0x89,
+  0x77, 0xfc, 0x47, 0x36, 0x2b, 0xb4, 0x10, 0x0d, 0x15, 0x9c, 0xc0, 0x5c,
+  0x85, 0x4a, 0xcb, 0x58, 0x82, 0x5a, 0xc5, 0xd0, 0x10, 0xa1, 0x4e, 0xad,
+  0x8e, 0x08, 0x6e, 0x2b, 0x56, 0x02, 0x05, 0x1a, 0x18, 0x63, 0x19, 0x42,
+  0x7a, 0x34, 0xb2, 0xfe, 0x79, 0x19, 0x90, 0xa8, 0x8b, 0x7e, 0x85, 0x51,
+  0x83, 0xd2, 0x4a, 0xb7, 0x81, 0xbf, 0xe9, 0x92, 0x2e, 0xae, 0xa9, 0xac,
+  0x28, 0x0d, 0xe3, 0x31, 0x32, 0xd6, 0x8f, 0xa9, 0xa1, 0x97, 0x0e, 0xf2,
+  0x4b, 0x33, 0xa7, 0xad, 0x83, 0x62, 0x80, 0x21, 0x5e, 0x33, 0xb1, 0x87,
+  0x93, 0xef, 0x9e, 0x50, 0x96, 0x88, 0x8f, 0xe0, 0x0a, 0x71, 0x36, 0x9a,
+  0xad, 0x0b, 0xc7, 0x26, 0xe0, 0x8a, 0xb4, 0xbd, 0x98, 0x4c, 0x9e, 0x06,
+  0xc2, 0x64, 0x25, 0x1e, 0x80, 0x25, 0x69, 0x26, 0x99, 0xa6, 0xa7, 0x51,
+  0x13, 0x09, 0x63, 0x69, 0xf4, 0x25, 0x56, 0x85, 0x6b, 0xce, 0x89, 0x23,
+  0x7e, 0x76, 0x69, 0xb8, 0xc9, 0xd2, 0x08, 0xa9, 0x8f, 0xb2, 0xd9, 0x14,
+  0x7d, 0x54, 0x50, 0xc5, 0x2e, 0xf6, 0xb9, 0xf1, 0x06, 0x28, 0x97, 0xad,
+  0x0a, 0xb7, 0x4e, 0x21, 0xdb, 0x05, 0xe6, 0x4b, 0x52, 0x42, 0x0f, 0x55,
+  0x5f, 0xcb, 0xe4, 0x93, 0xed, 0xde, 0xde, 0x31, 0xc8, 0x86, 0x13, 0x95,
+  0xb3, 0xdb, 0xb4, 0x1f, 0x8a, 0x7e, 0x22, 0x79, 0x28, 0x3c, 0x1c, 0x4d,
+  0x6f, 0x70, 0xae, 0x3a, 0x32, 0x0a, 0x52, 0x58, 0x47, 0x66, 0x81, 0x86,
+  0x21, 0x2f, 0xe5, 0xb8, 0xd2, 0x29, 0x96, 0xfe, 0x8c, 0xda, 0x39, 0xcb,
+  0x87, 0xaa, 0x95, 0xe4, 0x95, 0x39, 0xa0, 0x81, 0x45, 0x22, 0xbc, 0x1d,
+  0xea, 0x17, 0xe6, 0xac, 0x51, 0xd9, 0x8c, 0xb3, 0xfb, 0x87, 0xa3, 0xf4,
+  0x32, 0xe2, 0x6b, 0xf1, 0xc9, 0xaf, 0x05, 0xbf, 0x3d, 0x64, 0xec, 0xdb,
+  0x42, 0x5f, 0xff, 0xed, 0xf8, 0x74, 0x11, 0x43, 0xa4, 0x5e, 0x6a, 0x8d,
+  0xde, 0x59, 0xe0, 0x54, 0xba, 0x0a, 0x35, 0x26, 0x45, 0x99, 0x06, 0xab,
+  0xf0, 0x25, 0xda, 0x05, 0xcf, 0x92, 0x22, 0x14, 0x8a, 0xd8, 0xad, 0x16,
+  0x8c, 0xa1, 0x98, 0x99, 0x88, 0x37, 0x07, 0x5e, 0x3f, 0x89, 0x5e, 0x56,
+  0x52, 0x44, 0x00, 0xeb, 0xdf, 0xa2, 0xeb, 0xd8, 0x00, 0xdd, 0x3f, 0xe6,
+  0x35, 0x50, 0x51, 0x6a, 0x5c, 0x7d, 0xb4, 0x54, 0x5c, 0xa4, 0xc1, 0x9f,
+  0xba, 0xac, 0xb8, 0xdf, 0x74, 0x06, 0x27, 0x6f, 0x96, 0x8f, 0x6e, 0xed,
+  0xca, 0x26, 0x13, 0xb5, 0x26, 0x8a, 0x51, 0x0c, 0x4f, 0x40, 0x98, 0x21,
+  0xfe, 0x10, 0xbc, 0x15, 0x79, 0x5f, 0x93, 0x5f, 0x19, 0x61, 0xb7, 0x54,
+  0x45, 0x56, 0x4a, 0x45, 0xd5, 0x02, 0xe6, 0x9a, 0x17, 0xf9, 0x61, 0x6b,
+  0x86, 0xd6, 0xfb, 0x58, 0x8d, 0x74, 0x42, 0xd5, 0xb4, 0x95, 0xa0, 0xb0,
+  0xb7, 0xee, 0xa2, 0xa5, 0xe3, 0xb6, 0xa8, 0xa7, 0xb5, 0x82, 0x6d, 0xc9,
+  0x8b, 0xe3, 0xd7, 0x47, 0x1b, 0x70, 0x1b, 0x65, 0xa8, 0x22, 0x55, 0x21,
+  0xd7, 0x53, 0xab, 0xab, 0xe2, 0x83, 0x56, 0xee, 0x5a, 0x22, 0xb9, 0xa3,
+  0xcc, 0x47, 0xb6, 0x0d, 0x93, 0xd6, 0x6a, 0xb0, 0x07, 0x4c, 0x43, 0xbc,
+  0x33, 0xa8, 0xe4, 0x69, 0x4a, 0x92, 0xc6, 0x8c, 0x29, 0x6d, 0x52, 0x06,
+  0xb9, 0xa6, 0x1a, 0x33, 0xfa, 0x5c, 0xd7, 0xd5, 0x38, 0x2b, 0x2c, 0x78,
+  0x13, 0x19, 0x2e, 0x8e, 0x94, 0x01, 0x3a, 0x39, 0x78, 0x2c, 0x2f, 0x81,
+  0x5f, 0xdc, 0x96, 0x8a, 0x47, 0xa9, 0x2a, 0xb1, 0xe1, 0x69, 0xf0, 0xb1,
+  0x1d, 0x17, 0x03, 0x57, 0x76, 0x93, 0xc4, 0x83, 0x85, 0xb2, 0xb1, 0x9a,
+  0x18, 0xf2, 0x10, 0xba, 0xf5, 0x95, 0x03, 0xb8, 0x6d, 0xdc, 0xde, 0xe3,
+  0xd5, 0x84, 0x19, 0x58, 0x36, 0xdc, 0x32, 0x58, 0xf6, 0x5e, 0x51, 0x5a,
+  0x35, 0x82, 0x19, 0x30, 0xc8, 0x4e, 0x5a, 0xf6, 0xf3, 0x5c, 0x37, 0xf6,
+  0x95, 0x6e, 0x2c, 0x86, 0x4a, 0xf3, 0xbf, 0x9b, 0x3f, 0xd4, 0x0b, 0x13,
+  0x30, 0xae, 0x0e, 0xe6, 0x3c, 0x6c, 0xc0, 0xa0, 0x70, 0x26, 0xf2, 0x06,
+  0x9d, 0x58, 0x10, 0x08, 0x06, 0x04, 0x09, 0x91, 0x4f, 0x38, 0x61, 0x8f,
+  0x6f, 0x7d, 0x82, 0xba, 0xfb, 0xd9, 0x02, 0x34, 0x68, 0x47, 0x44, 0x11,
+  0x50, 0x43, 0x8d, 0x9e, 0x41, 0xe3, 0xca, 0x52, 0xcd, 0x47, 0x5d, 0xd5,
+  0x02, 0x43, 0x12, 0x03, 0xfd, 0x5b, 0xd2, 0x69, 0x90, 0x83, 0xa0, 0x3d,
+  0x1a, 0xa1, 0x81, 0x01, 0xbd, 0x39, 0x7e, 0x73, 0x24, 0x98, 0x02, 0x88,
+  0xa0, 0x86, 0x49, 0x58, 0x5c, 0xdf, 0x47, 0x5d, 0xf7, 0x94, 0xbe, 0xa0,
+  0x60, 0x99, 0xe6, 0xce, 0x13, 0xe6, 0x91, 0x89, 0x75, 0x25, 0xe8, 0x1e,
+  0x5c, 0x15, 0x84, 0x4e, 0x3c, 0x35, 0xed, 0xc1, 0x10, 0x79, 0x53, 0xe1,
+  0x9e, 0x54, 0xd1, 0x98, 0x57, 0x84, 0x92, 0x2e, 0xaa, 0xc4, 0xf8, 0x27,
+  0x0d, 0x42, 0xb1, 0x32, 0x47, 0xc0, 0xfe, 0x40, 0x6b, 0x39, 0xa6, 0xe2,
+  0x5e, 0x6a, 0x35, 0x4c, 0xd9, 0xc7, 0x04, 0xb7, 0xb0, 0xb8, 0x1c, 0xa2,
+  0x09, 0x94, 0xde, 0xdb, 0x4f, 0xd9, 0x13, 0x7a, 0x55, 0x91, 0x54, 0x23,
+  0xb7, 0x31, 0x9e, 0x88, 0xcc, 0xed, 0x10, 0x5e, 0x5e, 0xae, 0x6c, 0x0d,
+  0x5e, 0x83, 0xb7, 0xc5, 0x5c, 0x0d, 0xe9, 0xa4, 0xe0, 0x63, 0x86, 0x79,
+  0x9a, 0xc4, 0x49, 0xe6, 0xfc, 0xf4, 0x55, 0xea, 0xbd, 0x72, 0x1c, 0x2b,
+  0x9e, 0x96, 0x1a, 0xaf, 0xda, 0x10, 0x6c, 0x56, 0x4c, 0x14, 0x2b, 0xf1,
+  0xc6, 0x22, 0x65, 0xdb, 0x02, 0xdb, 0xf1, 0x91, 0x9f, 0x41, 0x43, 0x38,
+  0x5e, 0x85, 0x21, 0xff, 0xd7, 0x65, 0x87, 0xb9, 0xa0, 0x08, 0xec, 0xd6,
+  0xb7, 0x2b, 0xd7, 0x8b, 0x78, 0x6a, 0xd0, 0x92, 0x02, 0x9b, 0x43, 0x21,
+  0x22, 0x0c, 0xda, 0x0e, 0x52, 0x44, 0xff, 0x43, 0xae, 0xee, 0xa3, 0xb2,
+  0x9a, 0x0f, 0x87, 0x92, 0x53, 0xae, 0x20, 0x1b, 0x3c, 0x22, 0x0d, 0xa8,
+  0xc4, 0x85, 0x97, 0xb2, 0xb3, 0x16, 0xd7, 0x4b, 0x32, 0x81, 0xca, 0x11,
+  0xf1, 0xd4, 0x46, 0xb7, 0x6e, 0xd4, 0xa5, 0x59, 0x65, 0x10, 0x7e, 0x06,
+  0x37, 0x1a, 0x51, 0xf7, 0x32, 0x12, 0x74, 0xc8, 0x1d, 0x7d, 0xa3, 0x78,
+  0xff, 0x01, 0x9c, 0x76, 0x50, 0x90, 0xff, 0xea, 0x2c, 0x1b, 0x17, 0x54,
+  0x0e, 0xc2, 0xad, 0x9a, 0x2c, 0x05, 0x66, 0x91, 0x8b, 0x96, 0x9e, 0xea,
+  0x20, 0x38, 0x54, 0x38, 0xae, 0xc9, 0x2d, 0xf9, 0xbd, 0x82, 0x55, 0xcc,
+  0xe1, 0x1c, 0x08, 0xd7, 0x6d, 0x68, 0x32, 0x24, 0xfd, 0x11, 0x12, 0x5b,
+  0x3e, 0xd9, 0x87, 0x13, 0x9e, 0xb4, 0x5e, 0x15, 0x65, 0xb5, 0xdf, 0xe2,
+  0x20, 0x87, 0xb0, 0xfd, 0x99, 0xe4, 0x0a, 0x19, 0x1c, 0x9b, 0x0c, 0x84,
+  0x2d, 0x89, 0xc0, 0x8b, 0x24, 0x4e, 0x93, 0x83, 0xf1, 0x2a, 0xbb, 0x01,
+  0x03, 0x12, 0x86, 0x96, 0x1b, 0xaf, 0xa7, 0x0e, 0x1b, 0xa8, 0x82, 0xe0,
+  0xee, 0xc0, 0x50, 0x70, 0x18, 0x7f, 0xe9, 0x1c, 0x52, 0x4f, 0x9d, 0x57,
+  0xd4, 0xce, 0xb7, 0x2d, 0x29, 0x78, 0xa5, 0xe9, 0x74, 0xf5, 0x07, 0xf6,
+  0x2d, 0xd6, 0x94, 0xb6, 0x90, 0x0d, 0xc8, 0x54, 0x91, 0x87, 0xc8, 0x93,
+  0xc3, 0xaf, 0x65, 0x4c, 0x54, 0x5d, 0x61, 0x30, 0xd8, 0x54, 0x41, 0x57,
+  0xcb, 0x91, 0x58, 0x5a, 0x87, 0x89, 0x1a, 0x28, 0x7f, 0x43, 0x97, 0x9d,
+  0x62, 0xd8, 0xa1, 0xe4, 0x63, 0x90, 0x14, 0x3e, 0xa0, 0x70, 0x4d, 0x71,
+  0x2c, 0x42, 0x09, 0x84, 0xb4, 0x48, 0x67, 0x72, 0x30, 0x10, 0xb3, 0x4c,
+  0xa9, 0xe8, 0x49, 0x51, 0x0d, 0x63, 0x5d, 0x11, 0xd9, 0x95, 0x7d, 0xab,
+  0xd5, 0x87, 0x2f, 0x4e, 0xb2, 0x1b, 0x4e, 0x1e, 0x45, 0xc6, 0xa4, 0x59,
+  0xfb, 0x86, 0x9c, 0x1a, 0x8a, 0xd5, 0xde, 0x4a, 0xd1, 0xbc, 0x31, 0x3b,
+  0xe5, 0x39, 0xb6, 0x61, 0x3e, 0x65, 0x63, 0x0e, 0x0c, 0x4b, 0x8c, 0xcf,
+  0xe4, 0x24, 0xa3, 0xd6, 0x34, 0x97, 0x0b, 0x98, 0x3b, 0x70, 0xdb, 0xb1,
+  0xd2, 0x3c, 0x09, 0xd2, 0x38, 0x8d, 0x4b, 0x8a, 0x07, 0x0d, 0x94, 0x43,
+  0x2c, 0x02, 0x98, 0x3a, 0x67, 0xa7, 0xcf, 0x58, 0x9d, 0x48, 0x08, 0x23,
+  0xfd, 0x72, 0x8e, 0x81, 0xc1, 0x24, 0xda, 0x2b, 0x08, 0x93, 0x70, 0x74,
+  0x0c, 0xd9, 0xc3, 0x5a, 0xac, 0x04, 0x25, 0x40, 0x17, 0x88, 0x39, 0xdb,
+  0x17, 0xd2, 0x5f, 0x2f, 0xea, 0x71, 0xa4, 0x54, 0xe8, 0x9a, 0x52, 0x87,
+  0x35, 0xe0, 0x1d, 0xd8, 0xfe, 0x0f, 0x01, 0xe9, 0xa3, 0xac, 0x6e, 0x11,
+  0x96, 0x21, 0x00, 0x1d, 0x4d, 0x4c, 0xd1, 0x0a, 0xb8, 0x01, 0x21, 0x88,
+  0x9d, 0x36, 0x4a, 0x34, 0x52, 0x02, 0x3c, 0x92, 0x12, 0x38, 0x9c, 0x0c,
+  0xf1, 0x43, 0x27, 0x71, 0x38, 0xad, 0xea, 0xdc, 0x4b, 0x07, 0x7e, 0x87,
+  0x38, 0x83, 0xc0, 0x70, 0xc0, 0x2c, 0x5e, 0x74, 0x84, 0xf1, 0x43, 0x2e,
+  0xaa, 0x08, 0x2e, 0x7c, 0x82, 0xe0, 0xab, 0xf2, 0x0e, 0x4c, 0x7c, 0x9c,
+  0x80, 0x06, 0x34, 0xca, 0x2b, 0x52, 0xed, 0xfa, 0x57, 0x59, 0xff, 0x83,
+  0x98, 0xfe, 0x51, 0xbf, 0x15, 0xa8, 0x0a, 0x41, 0xf1, 0xa4, 0xb3, 0x42,
+  0xf6, 0x22, 0x4d, 0x3f, 0xa3, 0x9b, 0x82, 0x13, 0x80, 0x85, 0x6f, 0xec,
+  0x6b, 0x84, 0x39, 0xa9, 0xb2, 0xad, 0x17, 0x30, 0x9c, 0xfd, 0x16, 0x5c,
+  0x21, 0xad, 0x8b, 0x02, 0xfe, 0x95, 0x43, 0xf0, 0x1c, 0x4e, 0xd2, 0x3e,
+  0x57, 0x54, 0x6d, 0x9d, 0x33, 0x8c, 0x16, 0xfe, 0x39, 0x2e, 0x50, 0xf4,
+  0xae, 0xae, 0x18, 0xe6, 0x82, 0xe1, 0x98, 0xc4, 0x3e, 0xcb, 0xb7, 0xa6,
+  0x52, 0x7a, 0x5c, 0xb9, 0xc3, 0xdf, 0x1a, 0x0c, 0xca, 0xac, 0x35, 0x7a,
+  0xc3, 0x15, 0xce, 0xac, 0x20, 0xe6, 0x02, 0x25, 0xf1, 0xa7, 0x49, 0x48,
+  0x34, 0xd7, 0xb0, 0x46, 0x05, 0x14, 0xfc, 0x78, 0x1b, 0xc5, 0xdc, 0xe2,
+  0xe0, 0xa8, 0xa0, 0x50, 0x6b, 0x21, 0x0b, 0x7c, 0x3f, 0x61, 0x9c, 0xad,
+  0x6c, 0xd0, 0x0a, 0x3c, 0x86, 0xfc, 0x44, 0xc4, 0x14, 0x6b, 0x4d, 0xab,
+  0x53, 0x46, 0x13, 0xc0, 0xf5, 0x6f, 0x4c, 0xaf, 0x6f, 0x47, 0x61, 0xa1,
+  0xc6, 0xc0, 0xd8, 0x4b, 0xe2, 0x50, 0x92, 0xa4, 0x3b, 0x4b, 0x78, 0x37,
+  0x28, 0xf8, 0x83, 0xb3, 0xb7, 0xc7, 0x6f, 0x5f, 0xee, 0xdb, 0x1c, 0x0d,
+  0xe0, 0xd3, 0x07, 0x42, 0x13, 0x68, 0x46, 0x46, 0x14, 0x4b, 0xce, 0x2a,
+  0x3f, 0x2c, 0x2d, 0xed, 0x23, 0xb7, 0x8e, 0xc6, 0x29, 0x78, 0x7c, 0x51,
+  0xdc, 0x5a, 0xc3, 0x64, 0x68, 0x27, 0x8c, 0x59, 0x24, 0x13, 0xae, 0xb0,
+  0xb0, 0x60, 0x2c, 0xde, 0x1b, 0xce, 0xa3, 0xd4, 0x80, 0x80, 0x43, 0x33,
+  0x22, 0xda, 0x2d, 0x22, 0x51, 0x97, 0x0b, 0xee, 0x12, 0x4b, 0x43, 0x10,
+  0x64, 0x2e, 0x41, 0x42, 0xc6, 0x5d, 0x65, 0x23, 0x29, 0x1f, 0x8f, 0x02,
+  0x6e, 0x84, 0x9c, 0xae, 0x95, 0x02, 0x05, 0x2b, 0xac, 0x57, 0x51, 0x62,
+  0xd9, 0x51, 0xd2, 0xe4, 0x4d, 0x38, 0x0f, 0xc4, 0xc3, 0xca, 0x5a, 0x18,
+  0x51, 0x3f, 0x9d, 0xf3, 0x31, 0x66, 0x7c, 0x71, 0xa1, 0xab, 0x06, 0xc0,
+  0x53, 0x5d, 0xd4, 0xd6, 0xc1, 0x1c, 0x98, 0xcc, 0x2c, 0xff, 0x07, 0x4d,
+  0x43, 0x29, 0xf7, 0x10, 0x0b, 0xc0, 0x23, 0x1d, 0x5b, 0x9f, 0xb4, 0x30,
+  0x0e, 0x16, 0x8a, 0x6e, 0x5b, 0x2e, 0x1f, 0xaf, 0xd5, 0xd3, 0xd8, 0x52,
+  0xe6, 0x97, 0x7b, 0x01, 0x6f, 0xd5, 0x2d, 0x35, 0x15, 0xe2, 0xe4, 0x85,
+  0xe0, 0x49, 0x2b, 0x4b, 0xb5, 0xa8, 0x6d, 0x5d, 0x5b, 0x10, 0x7c, 0xe7,
+  0x25, 0xdb, 0x8b, 0x34, 0x74, 0x3b, 0x48, 0xbd, 0x71, 0xdc, 0xfb, 0xa2,
+  0x0e, 0x7f, 0x5f, 0xee, 0x68, 0xcd, 0xf7, 0x45, 0xf7, 0xdc, 0x0b, 0x34,
+  0x44, 0x77, 0xde, 0x02, 0xab, 0xdb, 0x4f, 0xfe, 0xab, 0xc8, 0xee, 0xf7,
+  0x65, 0xc1, 0x5b, 0xef, 0x40, 0x4b, 0xea, 0x1c, 0x5c, 0xd2, 0x2d, 0x72,
+  0x9b, 0x95, 0x9d, 0x29, 0xb1, 0xa6, 0xcd, 0x9d, 0xad, 0xad, 0xad, 0x95,
+  0xde, 0xe7, 0x4b, 0x7e, 0x85, 0x27, 0x7f, 0x50, 0xd1, 0xf0, 0xee, 0x32,
+  0x49, 0xb5, 0x44, 0xcb, 0x4e, 0x7a, 0x99, 0x59, 0x16, 0x1d, 0xe7, 0x03,
+  0x5b, 0x22, 0xdd, 0x15, 0x2b, 0x11, 0xa3, 0x69, 0xf2, 0x4c, 0x80, 0xff,
+  0xbe, 0x57, 0xb4, 0x65, 0xbc, 0xf1, 0xf0, 0x1b, 0x53, 0x98, 0xf8, 0x4f,
+  0xe7, 0xd8, 0x37, 0xa8, 0x40, 0xa9, 0x76, 0x20, 0xd5, 0x8d, 0xf8, 0x30,
+  0xea, 0x4e, 0xd4, 0x71, 0x48, 0xb8, 0xf0, 0x98, 0x4b, 0xa7, 0xf2, 0x96,
+  0x18, 0x2d, 0x44, 0x60, 0x2a, 0x9e, 0x48, 0xe0, 0x05, 0xe1, 0xe9, 0x8e,
+  0xd1, 0x72, 0x90, 0x4e, 0xaa, 0xc5, 0xda, 0x5a, 0xd6, 0x5c, 0x84, 0xd3,
+  0x6b, 0x7d, 0x10, 0xa1, 0x64, 0x39, 0x51, 0x1c, 0x41, 0x78, 0x26, 0x68,
+  0xa9, 0xb8, 0x2c, 0xc4, 0x3d, 0x1d, 0xd3, 0x48, 0xe0, 0xbf, 0xa1, 0x08,
+  0x45, 0x1a, 0x5e, 0x68, 0x18, 0x2e, 0x1c, 0xc9, 0x1b, 0xf1, 0x8f, 0x37,
+  0x35, 0x54, 0x86, 0xa0, 0x9f, 0x38, 0x91, 0xcb, 0x1a, 0x0d, 0x65, 0xca,
+  0x43, 0x3f, 0x49, 0x0b, 0xda, 0x63, 0x39, 0x8b, 0x4b, 0x5d, 0xc2, 0x9f,
+  0xb2, 0xa2, 0x56, 0x85, 0x52, 0xda, 0x77, 0x4b, 0xdb, 0xd2, 0xf7, 0x5b,
+  0xbc, 0xb0, 0xe6, 0x14, 0xd2, 0x54, 0x43, 0xb7, 0xb4, 0xc4, 0x22, 0x5d,
+  0x49, 0x4b, 0xdc, 0x5d, 0xe5, 0x24, 0xd4, 0x48, 0x9e, 0xf9, 0xa6, 0x19,
+  0x1c, 0x34, 0x98, 0xcc, 0x74, 0xf3, 0x23, 0x50, 0x48, 0x5a, 0x68, 0x2d,
+  0xf9, 0xb6, 0xbc, 0x2c, 0x4e, 0xdb, 0x79, 0xab, 0x64, 0x5f, 0x72, 0x91,
+  0x54, 0x61, 0x31, 0x15, 0x19, 0x21, 0xae, 0x60, 0x37, 0x20, 0xf4, 0x31,
+  0xbb, 0xb6, 0x43, 0xb1, 0x46, 0x72, 0x93, 0xb6, 0x71, 0x27, 0x75, 0x79,
+  0x47, 0x78, 0xe3, 0x86, 0x26, 0x10, 0x9c, 0x06, 0xdf, 0x16, 0xe4, 0x8b,
+  0x94, 0x1f, 0x50, 0x8d, 0x83, 0x6b, 0xb7, 0xc5, 0x96, 0x85, 0x94, 0x49,
+  0x9d, 0x31, 0x69, 0x14, 0xb6, 0x54, 0xcd, 0x54, 0xdc, 0x89, 0xc8, 0xce,
+  0xa3, 0x6e, 0x84, 0x96, 0x05, 0x2f, 0x09, 0xcc, 0x3d, 0x46, 0x2e, 0x72,
+  0xd9, 0x68, 0x86, 0xc3, 0x61, 0x93, 0xda, 0xe2, 0x8e, 0x45, 0x01, 0x09,
+  0x11, 0xf9, 0x04, 0xb3, 0x18, 0x32, 0x5c, 0xc2, 0xcb, 0x54, 0x82, 0xc3,
+  0x31, 0x96, 0xc5, 0x3d, 0xae, 0x7c, 0x1a, 0x8d, 0x51, 0x4d, 0xf4, 0x69,
+  0xa7, 0x93, 0x4f, 0x4a, 0x97, 0xc9, 0x1c, 0x7f, 0x39, 0x5c, 0xe4, 0x23,
+  0x62, 0x8d, 0x08, 0x06, 0x4a, 0x38, 0x91, 0xd3, 0x79, 0x6f, 0x3c, 0xd8,
+  0x4b, 0x9e, 0xc1, 0x0f, 0x35, 0x39, 0x50, 0x9e, 0xed, 0xf9, 0x21, 0x62,
+  0x2b, 0x10, 0xee, 0x45, 0x6a, 0xc2, 0xad, 0xb8, 0xc9, 0x89, 0x2c, 0x76,
+  0x77, 0x9a, 0xcc, 0xec, 0x51, 0x75, 0x5d, 0x7e, 0x49, 0x85, 0xfa, 0x1e,
+  0x5b, 0x15, 0xb7, 0x77, 0x9e, 0x26, 0x68, 0xa4, 0x4e, 0xde, 0x3c, 0xdf,
+  0x13, 0xa1, 0xae, 0x9c, 0x8f, 0x4d, 0x7b, 0xe2, 0x9c, 0x52, 0xbe, 0x5b,
+  0x15, 0x28, 0x95, 0xcb, 0x3b, 0x23, 0x78, 0x59, 0x5b, 0x43, 0x56, 0x87,
+  0x21, 0x66, 0xd5, 0xf9, 0xef, 0x42, 0x12, 0x39, 0xbe, 0xae, 0x17, 0x91,
+  0x33, 0x77, 0x49, 0x6f, 0xe8, 0xdc, 0xac, 0xfa, 0x57, 0x5d, 0xc9, 0xa2,
+  0x73, 0xeb, 0x70, 0x67, 0x1a, 0x5d, 0x68, 0xe8, 0xb3, 0x4c, 0xca, 0xa1,
+  0x97, 0x6c, 0xaf, 0xbf, 0xdd, 0x7f, 0xfc, 0xcd, 0xd6, 0xce, 0xd6, 0x93,
+  0xc7, 0x5b, 0xe9, 0x5e, 0xda, 0xdb, 0x1a, 0xee, 0x6c, 0xed, 0x3e, 0x7e,
+  0xba, 0xf7, 0xb8, 0xbf, 0xbb, 0xb3, 0x9d, 0x3e, 0x15, 0x34, 0x8d, 0x72,
+  0x95, 0xa8, 0x50, 0x69, 0xb6, 0xbc, 0x4a, 0x77, 0xf6, 0x9e, 0xd4, 0xb7,
+  0x96, 0x3f, 0x85, 0x6b, 0x81, 0xfe, 0x5d, 0xdc, 0x60, 0xda, 0x5f, 0x3c,
+  0x85, 0x8b, 0xfb, 0x9b, 0x26, 0x3f, 0x12, 0x34, 0x4d, 0x47, 0xc3, 0x0f,
+  0xce, 0x5f, 0x1d, 0x60, 0x5b, 0x68, 0x96, 0xb8, 0x8a, 0x94, 0x30, 0xd9,
+  0x32, 0xde, 0x31, 0xdd, 0x2c, 0xdc, 0xad, 0x6e, 0xbc, 0x5b, 0xb5, 0xcd,
+  0xaa, 0x79, 0x53, 0xfc, 0x8e, 0xd1, 0xdf, 0x7c, 0xd6, 0x79, 0xa3, 0xbc,
+  0x9e, 0xa3, 0x56, 0xcc, 0x50, 0xc2, 0x5c, 0xbd, 0xaa, 0x12, 0x90, 0xe4,
+  0x4c, 0x4d, 0xf8, 0x55, 0x59, 0x5e, 0x31, 0xa4, 0x7a, 0x2d, 0x37, 0x9c,
+  0xbc, 0xb3, 0xfc, 0x14, 0x8b, 0x31, 0xe7, 0xe7, 0xaf, 0xb4, 0x9c, 0x41,
+  0x59, 0x23, 0x0d, 0x59, 0xc7, 0x2f, 0xe7, 0x3e, 0x8d, 0xba, 0x79, 0xfb,
+  0xfc, 0xa7, 0x0f, 0x6f, 0x2e, 0xfe, 0xfc, 0xf1, 0xcd, 0xcb, 0x3f, 0x6f,
+  0x9f, 0x3c, 0x1f, 0x8c, 0xdf, 0xfc, 0xf6, 0xe7, 0xdd, 0x37, 0xbf, 0xf5,
+  0xff, 0xf1, 0xd7, 0xdf, 0x0e, 0x6e, 0x4f, 0x2e, 0xfe, 0xba, 0xf7, 0x66,
+  0x7c, 0xf6, 0xe1, 0xcd, 0x6f, 0x3f, 0x8d, 0xdf, 0x3e, 0xff, 0xf3, 0x77,
+  0x02, 0x30, 0xb4, 0x9c, 0x54, 0x3c, 0xf0, 0x4a, 0xdd, 0xc6, 0x1c, 0x48,
+  0x32, 0x10, 0x0e, 0x4a, 0x7d, 0xcf, 0x54, 0x53, 0xf4, 0x56, 0xc8, 0xf3,
+  0x8d, 0xe4, 0x88, 0xa2, 0xb8, 0x93, 0x57, 0xe7, 0x17, 0xe7, 0xe6, 0x1f,
+  0xb2, 0xf8, 0x3f, 0xe5, 0x83, 0xa6, 0x65, 0x4e, 0x41, 0xbd, 0xa8, 0x4a,
+  0x01, 0xe7, 0x95, 0x10, 0x3a, 0xbb, 0x55, 0xa8, 0x0d, 0x2a, 0x97, 0x9a,
+  0x19, 0x48, 0xa0, 0x65, 0x13, 0xa9, 0x90, 0x78, 0xc0, 0xe2, 0x7d, 0xca,
+  0x82, 0x02, 0x4c, 0xcc, 0x70, 0x81, 0xb5, 0x57, 0x5e, 0x72, 0x6e, 0x26,
+  0x2f, 0xa5, 0x28, 0xae, 0xca, 0xee, 0x36, 0x12, 0xb6, 0xf2, 0xe6, 0x43,
+  0x54, 0xca, 0x0d, 0xa4, 0x43, 0x3c, 0x05, 0x64, 0x60, 0x76, 0x05, 0x51,
+  0x87, 0x56, 0xac, 0x8a, 0xb4, 0x05, 0x29, 0x82, 0x8a, 0x0b, 0x00, 0xeb,
+  0x4b, 0xb3, 0x4e, 0x5d, 0x0c, 0x22, 0xd5, 0x17, 0x93, 0xf3, 0x62, 0x39,
+  0x57, 0xaa, 0x11, 0x54, 0x3c, 0xdf, 0xe0, 0xcd, 0x75, 0x93, 0x66, 0x9b,
+  0xeb, 0x7c, 0x7a, 0x39, 0x4b, 0x07, 0x72, 0x36, 0x5c, 0x29, 0xa6, 0xc2,
+  0xd5, 0x61, 0xa3, 0xb5, 0xc7, 0xe2, 0x51, 0xa8, 0xaa, 0xfb, 0x65, 0x03,
+  0xa1, 0x08, 0x45, 0x8c, 0x2b, 0x11, 0xd9, 0xd0, 0x77, 0x03, 0x94, 0x39,
+  0x27, 0x03, 0x67, 0x3e, 0xcc, 0xc8, 0x58, 0xce, 0x1a, 0x92, 0x16, 0xa8,
+  0xc8, 0xc5, 0x49, 0x20, 0xdd, 0xf2, 0xad, 0x24, 0xf7, 0xa8, 0x96, 0xae,
+  0x08, 0x4b, 0xa1, 0xe2, 0x0c, 0x28, 0x95, 0xad, 0x80, 0x41, 0x9a, 0xac,
+  0xa3, 0x3b, 0x32, 0x11, 0x44, 0xae, 0x0d, 0xe7, 0xde, 0x15, 0x64, 0xf6,
+  0x4d, 0xad, 0xba, 0x62, 0xb7, 0x7c, 0x48, 0x25, 0x23, 0x50, 0x71, 0xac,
+  0x88, 0xa1, 0x54, 0x04, 0x0b, 0xc3, 0x80, 0xdb, 0xd1, 0x65, 0x1a, 0xb9,
+  0x93, 0x22, 0x50, 0x19, 0x39, 0x67, 0xd4, 0x18, 0x67, 0x99, 0x04, 0x2c,
+  0x6f, 0xce, 0x74, 0xd2, 0xab, 0x52, 0x09, 0xc0, 0x42, 0xaa, 0xf8, 0x60,
+  0x16, 0x52, 0xdc, 0x9b, 0x5a, 0xa5, 0x1b, 0x9d, 0x46, 0xdb, 0x55, 0xd2,
+  0x17, 0x3f, 0xe8, 0x03, 0x61, 0x66, 0x49, 0x93, 0xb0, 0x5b, 0xab, 0x17,
+  0x45, 0xc5, 0x5c, 0x88, 0xba, 0x27, 0xa8, 0x2a, 0xc2, 0x01, 0x85, 0x36,
+  0xb6, 0xba, 0xdf, 0x44, 0xce, 0xc4, 0x03, 0xf2, 0xda, 0x1a, 0x04, 0xb6,
+  0x96, 0xd3, 0x84, 0xc7, 0x42, 0x81, 0xe1, 0xaf, 0x02, 0x35, 0x6d, 0xe2,
+  0x17, 0x04, 0x10, 0x19, 0x6a, 0x80, 0x5a, 0x9c, 0x9b, 0xaa, 0x8b, 0xac,
+  0xdc, 0x73, 0x4d, 0x2a, 0x0b, 0x9d, 0xf3, 0x85, 0x6b, 0x25, 0x36, 0x2a,
+  0xd8, 0x3d, 0x0c, 0xf5, 0xd5, 0xd5, 0x7d, 0x54, 0x63, 0x49, 0x95, 0xa3,
+  0x9c, 0x7a, 0x49, 0x91, 0x19, 0xb5, 0x7a, 0x49, 0x0c, 0x30, 0xce, 0x22,
+  0x11, 0x17, 0xef, 0xa2, 0x73, 0x80, 0x25, 0x60, 0x39, 0x42, 0x06, 0x44,
+  0x26, 0x39, 0x25, 0x84, 0xde, 0x98, 0xb2, 0x6a, 0xbf, 0x30, 0x21, 0x62,
+  0x1c, 0x12, 0x42, 0xa6, 0xc8, 0xb8, 0x9a, 0x17, 0x20, 0xb9, 0x26, 0x52,
+  0x05, 0xe7, 0xc9, 0x93, 0xee, 0xd6, 0x46, 0x43, 0xf4, 0xb7, 0x2c, 0xed,
+  0x67, 0x14, 0x00, 0x5a, 0x92, 0x18, 0x20, 0x0d, 0xde, 0xc3, 0xfb, 0xa5,
+  0xd7, 0xd5, 0xdc, 0x84, 0x75, 0xe2, 0xc0, 0xb7, 0xb6, 0xbb, 0xdb, 0x6d,
+  0xf9, 0x75, 0x47, 0x34, 0x44, 0xfc, 0x7d, 0x57, 0x69, 0x66, 0xab, 0x6d,
+  0x0f, 0x6e, 0x45, 0x74, 0x43, 0x99, 0xee, 0x8c, 0x9a, 0xae, 0x34, 0x93,
+  0xc0, 0x33, 0x49, 0x14, 0xb0, 0xab, 0xc9, 0xea, 0x39, 0x33, 0x32, 0x35,
+  0xc8, 0xab, 0x41, 0x17, 0x55, 0x51, 0x04, 0xcf, 0xf7, 0x94, 0x57, 0x4b,
+  0xba, 0x91, 0xae, 0x97, 0x04, 0xd3, 0xeb, 0xcd, 0xb0, 0x6a, 0x6a, 0xb6,
+  0xb6, 0xf6, 0x70, 0x00, 0x73, 0xb6, 0x86, 0xfa, 0xc7, 0x4e, 0xdb, 0x93,
+  0xc4, 0x0e, 0x02, 0xfa, 0x15, 0xb3, 0x0e, 0x0a, 0xef, 0x40, 0x5a, 0x97,
+  0x5a, 0xd9, 0x52, 0x57, 0x39, 0x71, 0x29, 0xdd, 0x9e, 0x8c, 0x22, 0xa4,
+  0x3a, 0xe9, 0x23, 0x3a, 0xc6, 0xf0, 0xf7, 0x92, 0xed, 0x70, 0xbb, 0xb1,
+  0xdd, 0x0d, 0x15, 0x60, 0x62, 0x08, 0x0f, 0x1e, 0xbe, 0xdc, 0x4c, 0xa2,
+  0xf0, 0x9f, 0xbd, 0x2e, 0xe3, 0x18, 0x50, 0xe9, 0x67, 0x95, 0x44, 0x97,
+  0x15, 0x56, 0x7d, 0xfb, 0xc1, 0x57, 0x7d, 0xeb, 0x21, 0x57, 0x9d, 0x68,
+  0xb7, 0xbe, 0xea, 0x7c, 0x00, 0x5d, 0xc3, 0x0b, 0x6b, 0x4e, 0x2c, 0x64,
+  0xc7, 0x7b, 0x34, 0xe9, 0xce, 0x6d, 0x7b, 0x20, 0x16, 0x5a, 0x86, 0x09,
+  0x28, 0xd4, 0x9c, 0x79, 0x22, 0xef, 0xe8, 0xc5, 0x5e, 0x2b, 0x5d, 0xe5,
+  0xbc, 0x26, 0xe4, 0x5f, 0xa4, 0x76, 0x42, 0xea, 0x5b, 0xbd, 0x27, 0x8b,
+  0xd5, 0x77, 0x5d, 0x85, 0x58, 0x44, 0x12, 0x41, 0xe4, 0xc2, 0x56, 0x77,
+  0xa8, 0x14, 0x27, 0xd2, 0xa8, 0x19, 0x19, 0x4c, 0x28, 0x3d, 0xfe, 0x8e,
+  0x9f, 0xdf, 0xb7, 0x47, 0x25, 0x78, 0x62, 0xa1, 0x26, 0x27, 0x09, 0xe6,
+  0xf2, 0x3a, 0x01, 0x5f, 0xc9, 0xcc, 0xf3, 0xca, 0x55, 0x54, 0xd4, 0x48,
+  0xe7, 0x92, 0x4c, 0x18, 0xb0, 0xbb, 0x30, 0x5d, 0x09, 0x8c, 0xec, 0xee,
+  0xa0, 0xca, 0x2e, 0x19, 0xc5, 0xec, 0x09, 0xbc, 0xc2, 0x22, 0xad, 0x16,
+  0xd8, 0x29, 0x52, 0xfa, 0x40, 0x0b, 0xd3, 0xd7, 0x30, 0x71, 0x93, 0x03,
+  0x73, 0x4f, 0x8b, 0x29, 0x90, 0x5d, 0x3e, 0xb8, 0x1a, 0x7a, 0x08, 0xa4,
+  0x89, 0xe0, 0x8c, 0x43, 0x57, 0xfa, 0xa8, 0xbc, 0x86, 0xce, 0xbb, 0x4b,
+  0xb8, 0xf8, 0xce, 0x83, 0xd0, 0xfb, 0xce, 0x1d, 0xd4, 0xae, 0x4f, 0x04,
+  0x2d, 0x84, 0x66, 0xac, 0xaa, 0x08, 0x4e, 0x9d, 0xf5, 0x10, 0x4a, 0xb5,
+  0x17, 0xa8, 0x64, 0xa5, 0xb4, 0xa6, 0x0a, 0xdf, 0x5c, 0xaa, 0xba, 0xf9,
+  0xc8, 0xc8, 0x99, 0x69, 0x62, 0x55, 0x78, 0x82, 0xee, 0x3e, 0x36, 0xf1,
+  0xa9, 0x09, 0x67, 0xc6, 0x37, 0x26, 0x5f, 0x07, 0x4c, 0x3b, 0xba, 0xbe,
+  0xd2, 0xd1, 0x74, 0x12, 0x1f, 0x9d, 0x7a, 0xe3, 0xd1, 0x51, 0x3a, 0x2e,
+  0xcb, 0x39, 0xda, 0xe5, 0x50, 0x04, 0xc0, 0x03, 0xa1, 0xb5, 0xbf, 0x98,
+  0x02, 0x99, 0x38, 0x85, 0xd4, 0xd8, 0x86, 0x8c, 0xd3, 0x8c, 0x9c, 0xab,
+  0xf4, 0x2d, 0x72, 0x19, 0xa1, 0xdf, 0x2e, 0x45, 0x96, 0xb9, 0x35, 0xa6,
+  0xee, 0x13, 0xc7, 0x12, 0x02, 0xc4, 0xa3, 0x08, 0x1c, 0x5a, 0x99, 0x55,
+  0x6a, 0xd0, 0x49, 0x7f, 0x25, 0x22, 0x73, 0xa3, 0xa7, 0x36, 0xbd, 0x49,
+  0x25, 0x2a, 0xe6, 0xdc, 0x85, 0x20, 0xb1, 0x78, 0x32, 0x28, 0xf4, 0x71,
+  0x97, 0xed, 0x66, 0x29, 0xd1, 0x37, 0xe9, 0xad, 0xee, 0x83, 0xb1, 0x81,
+  0x41, 0x12, 0xaa, 0x1d, 0x19, 0xbd, 0x4a, 0x70, 0x34, 0xa7, 0x45, 0xda,
+  0x49, 0x71, 0xcc, 0x41, 0xa4, 0x6b, 0x12, 0x7b, 0x08, 0xd4, 0x61, 0x8b,
+  0x4b, 0xd0, 0x3a, 0xf6, 0x99, 0xb3, 0x6f, 0x44, 0x3c, 0x3f, 0x32, 0xde,
+  0x90, 0x2f, 0x93, 0x4d, 0xdc, 0x10, 0x7d, 0x81, 0x3b, 0x4a, 0xe1, 0x74,
+  0x61, 0x64, 0x72, 0x82, 0xd6, 0x0f, 0x5e, 0x9f, 0xbe, 0xdd, 0xc0, 0x14,
+  0x0a, 0xaa, 0x73, 0x13, 0x55, 0xeb, 0x08, 0x40, 0x40, 0xe4, 0x05, 0x55,
+  0x0a, 0x3d, 0xa5, 0x95, 0xa6, 0x27, 0x71, 0x85, 0x29, 0x1e, 0xcf, 0xb6,
+  0x87, 0x31, 0xa0, 0x69, 0xa9, 0x6e, 0x08, 0x7e, 0x52, 0x5a, 0x5e, 0x48,
+  0xf1, 0x5e, 0xce, 0xcb, 0xef, 0x89, 0xd0, 0x5a, 0x39, 0xe3, 0xaa, 0xb1,
+  0xf9, 0x15, 0x8e, 0xf6, 0xc2, 0x88, 0xee, 0x3d, 0xea, 0x0b, 0x6f, 0x18,
+  0x59, 0x2e, 0x39, 0xf9, 0xe4, 0xda, 0xf3, 0x99, 0x68, 0xd1, 0xe9, 0xaf,
+  0x9d, 0xfc, 0xbb, 0xee, 0x4a, 0x77, 0x54, 0x63, 0x71, 0x62, 0xab, 0x59,
+  0xec, 0xab, 0xcb, 0x87, 0x8d, 0x42, 0xa1, 0x3f, 0xf1, 0xaa, 0x46, 0x68,
+  0xf4, 0x3f, 0x0d, 0x74, 0x37, 0xf8, 0xc0, 0xd8, 0x72, 0x3f, 0xb1, 0xfc,
+  0x1b, 0x41, 0x31, 0x1a, 0xc2, 0x80, 0x15, 0xd6, 0x45, 0x36, 0x2c, 0x9d,
+  0x8d, 0x72, 0xad, 0x5c, 0x6e, 0xe7, 0x81, 0x0b, 0x2c, 0x6b, 0xab, 0xce,
+  0x04, 0x64, 0x49, 0x01, 0xcc, 0xdb, 0x5d, 0xed, 0xd3, 0x82, 0x62, 0x53,
+  0x10, 0x99, 0xac, 0x6b, 0xc3, 0x41, 0xad, 0x90, 0x1c, 0xf5, 0xc1, 0xdc,
+  0x3d, 0xd4, 0xbb, 0x9a, 0xb9, 0x16, 0xde, 0x56, 0x56, 0xe1, 0xde, 0x49,
+  0x44, 0x0d, 0x6e, 0x72, 0x0d, 0x65, 0xd1, 0x0a, 0x6b, 0x68, 0xa4, 0x20,
+  0x2d, 0xd6, 0xdd, 0xa2, 0xc9, 0xc1, 0xa8, 0xea, 0x9c, 0x5f, 0xf7, 0xad,
+  0x54, 0xa0, 0x86, 0x5e, 0xf2, 0x75, 0xac, 0x99, 0x38, 0x32, 0x3c, 0x76,
+  0x95, 0x51, 0xd8, 0x09, 0xd2, 0x08, 0xcd, 0xa1, 0x9c, 0xe3, 0x75, 0x57,
+  0x45, 0x7c, 0x8a, 0x61, 0xc8, 0x2c, 0xdc, 0x35, 0xfd, 0x50, 0x6a, 0x0b,
+  0x12, 0x58, 0xc0, 0x7e, 0x85, 0xab, 0x42, 0x6a, 0xd1, 0xf9, 0x48, 0x4b,
+  0xf6, 0x63, 0x94, 0x1f, 0xc4, 0xc8, 0xa1, 0x96, 0x89, 0xcd, 0x5d, 0x2b,
+  0xfe, 0x8c, 0x3c, 0x58, 0x62, 0xcc, 0x39, 0xee, 0xdb, 0x72, 0x3a, 0x22,
+  0xa3, 0x02, 0x82, 0xfe, 0xd7, 0xb7, 0x49, 0x2d, 0xf5, 0x23, 0xe2, 0x94,
+  0x83, 0x6c, 0x84, 0xc5, 0x9a, 0x81, 0x88, 0x64, 0xfb, 0x8c, 0x2a, 0xc4,
+  0x4a, 0x21, 0x30, 0xba, 0x94, 0x9a, 0x19, 0xb6, 0x4b, 0x5d, 0x14, 0xcc,
+  0x52, 0x05, 0xf2, 0xa9, 0x20, 0x36, 0xd9, 0xcf, 0x2c, 0x44, 0x65, 0x22,
+  0x03, 0x70, 0x1b, 0x65, 0xaa, 0x03, 0xa7, 0x92, 0x18, 0x69, 0x89, 0x59,
+  0xa2, 0x54, 0xd1, 0x47, 0x62, 0xd2, 0x94, 0x07, 0xd3, 0x5e, 0x4a, 0xb0,
+  0xb6, 0xbf, 0x44, 0x1c, 0x8f, 0xf2, 0xb5, 0x47, 0x85, 0xec, 0x3b, 0x4c,
+  0x48, 0x44, 0x2b, 0x5a, 0xbe, 0x47, 0x33, 0xc9, 0x52, 0xc2, 0xcd, 0x0d,
+  0x1a, 0x71, 0x1a, 0x46, 0xd3, 0x00, 0x61, 0x41, 0xcd, 0x3d, 0x88, 0xb4,
+  0xb1, 0x7b, 0x2f, 0x0b, 0xda, 0xfd, 0x1c, 0x69, 0x63, 0xb7, 0x49, 0xda,
+  0xb8, 0xab, 0x8a, 0xfc, 0xa2, 0x52, 0xc9, 0x52, 0xfa, 0x6a, 0x42, 0xba,
+  0x97, 0x36, 0x3a, 0x12, 0xaa, 0x79, 0x50, 0x57, 0xbe, 0x19, 0x04, 0x4b,
+  0x31, 0x16, 0xbd, 0x2c, 0xe2, 0x38, 0xd5, 0x4e, 0xcc, 0xa9, 0x3a, 0x01,
+  0xb6, 0x5e, 0xe5, 0x8d, 0xa8, 0x8c, 0x93, 0x33, 0xd4, 0x31, 0xeb, 0x32,
+  0xce, 0x25, 0x8c, 0x8b, 0xf9, 0x16, 0x4d, 0x51, 0x95, 0x4e, 0xa3, 0x32,
+  0xa4, 0xd0, 0x88, 0x77, 0xd9, 0xa9, 0xe8, 0xda, 0xf1, 0xee, 0x53, 0x81,
+  0x14, 0x5c, 0x30, 0xf3, 0x56, 0x5b, 0xb2, 0x32, 0xf3, 0x20, 0x9a, 0xbb,
+  0xf2, 0x20, 0x6e, 0x86, 0x15, 0xb2, 0x17, 0xca, 0x93, 0xda, 0xf1, 0x35,
+  0x2f, 0x98, 0xcb, 0x65, 0x88, 0xc1, 0x20, 0x98, 0xfd, 0x2f, 0xcb, 0xaf,
+  0x64, 0x3e, 0xc6, 0xad, 0x88, 0x59, 0x19, 0x4c, 0xb4, 0x80, 0x24, 0x0a,
+  0x63, 0x0a, 0x9c, 0x29, 0x18, 0xd5, 0xee, 0x60, 0x4f, 0xd1, 0xbd, 0xe6,
+  0x63, 0x45, 0xa4, 0x78, 0xb3, 0x94, 0x33, 0xfa, 0xf3, 0xbb, 0xe3, 0xc3,
+  0x28, 0x45, 0x4c, 0x13, 0xd7, 0x2c, 0xa6, 0xcd, 0x65, 0x8b, 0x05, 0x5d,
+  0x84, 0x03, 0xbb, 0xf4, 0x8e, 0xc2, 0x98, 0x2a, 0xb6, 0xdb, 0xc7, 0x1b,
+  0x46, 0x71, 0x30, 0x96, 0xf0, 0x51, 0xdc, 0x4c, 0x14, 0x4f, 0x5b, 0xcf,
+  0x50, 0x7c, 0xea, 0x9b, 0x8e, 0xfd, 0x4a, 0x67, 0x9e, 0x59, 0xc8, 0x83,
+  0x1c, 0x7c, 0x6e, 0xea, 0xde, 0xd3, 0xcf, 0x8f, 0xdd, 0xc1, 0x02, 0x16,
+  0xe5, 0x0e, 0xe3, 0x01, 0x9f, 0x85, 0x59, 0x57, 0xd7, 0x0f, 0x16, 0x74,
+  0x8d, 0xf6, 0x9d, 0x6c, 0xc0, 0xc4, 0x11, 0xef, 0x82, 0x78, 0x7a, 0xd7,
+  0xe9, 0xbf, 0xd3, 0x8a, 0xd5, 0xe1, 0x8a, 0x40, 0x1d, 0x31, 0xf8, 0x76,
+  0xd8, 0x00, 0xed, 0x40, 0x83, 0x99, 0x2b, 0x78, 0xad, 0x9a, 0xdf, 0xe0,
+  0xb3, 0xa1, 0x55, 0x32, 0x5e, 0x73, 0x25, 0x09, 0xcb, 0x26, 0x08, 0xb0,
+  0x9d, 0x5a, 0xfc, 0x2c, 0xef, 0xe3, 0x15, 0x13, 0xb2, 0x17, 0xc8, 0x4a,
+  0xac, 0xd6, 0xcc, 0xd9, 0x9c, 0xb3, 0x30, 0x0e, 0xa6, 0x64, 0x83, 0xdf,
+  0xee, 0x7e, 0xb4, 0x30, 0xba, 0x59, 0x46, 0x3a, 0x87, 0x45, 0xf1, 0x09,
+  0x56, 0x62, 0xad, 0x63, 0x6c, 0x8d, 0xed, 0xd2, 0x94, 0x07, 0x34, 0xe3,
+  0xd0, 0xa1, 0x1d, 0x38, 0x56, 0x97, 0x69, 0xef, 0xb6, 0xca, 0xa2, 0xc8,
+  0xea, 0x17, 0xc6, 0x32, 0xa2, 0xc8, 0xab, 0x0f, 0xf9, 0x94, 0xa1, 0x5b,
+  0x8e, 0xff, 0xc7, 0x51, 0x70, 0xd0, 0xc3, 0xbe, 0x0f, 0xf3, 0x4b, 0x74,
+  0x8d, 0x05, 0x20, 0x51, 0x0b, 0xa9, 0x17, 0xd0, 0x28, 0x45, 0x67, 0x12,
+  0x97, 0x05, 0x87, 0xf1, 0x45, 0xf2, 0xfa, 0x1d, 0xab, 0xfc, 0xb0, 0x59,
+  0x15, 0x8d, 0x1d, 0xdd, 0x7d, 0x5a, 0x1a, 0x5f, 0x59, 0x11, 0x16, 0x7e,
+  0x11, 0x9f, 0x87, 0x46, 0xf2, 0xa1, 0xbd, 0xe0, 0x47, 0xc7, 0xfa, 0xe6,
+  0x49, 0xf0, 0x91, 0xfe, 0x18, 0x0c, 0xc9, 0x6d, 0x34, 0x71, 0x20, 0xae,
+  0x00, 0xa3, 0x5b, 0x78, 0x16, 0xe6, 0x42, 0x64, 0x8d, 0x98, 0xa8, 0xb4,
+  0x78, 0xce, 0xb2, 0x5a, 0x2f, 0xd3, 0xb7, 0x64, 0x27, 0xbc, 0xef, 0x8c,
+  0xe2, 0x35, 0xcb, 0x84, 0x42, 0x67, 0xbb, 0xd1, 0x29, 0x0d, 0x0e, 0x14,
+  0x63, 0xa5, 0xb4, 0xfb, 0xa2, 0x5e, 0x72, 0x0f, 0x9a, 0x1e, 0x51, 0x56,
+  0x99, 0x80, 0x70, 0x99, 0xb8, 0x55, 0x8f, 0x5e, 0x46, 0x07, 0xb8, 0x8f,
+  0xc8, 0x13, 0x55, 0xd2, 0xdd, 0x33, 0x56, 0x43, 0xd4, 0xae, 0x38, 0x57,
+  0xd1, 0xd7, 0x8c, 0xc1, 0xb0, 0x44, 0x6d, 0x8f, 0x91, 0x2d, 0x53, 0x8d,
+  0x40, 0xad, 0xd6, 0x4a, 0xa9, 0xcd, 0x1e, 0xf0, 0xcc, 0xad, 0x52, 0x68,
+  0x5e, 0x69, 0xd5, 0xad, 0x8c, 0xc3, 0x32, 0x53, 0x5f, 0x5b, 0xd7, 0xbd,
+  0x10, 0x0a, 0x5e, 0x59, 0xb4, 0x35, 0x17, 0xd4, 0xa5, 0x33, 0x47, 0xde,
+  0x61, 0xed, 0x35, 0xf6, 0xbf, 0xd1, 0xf0, 0xc3, 0xd5, 0xaf, 0x00, 0xa3,
+  0x72, 0xcd, 0xf9, 0x2e, 0x02, 0x6c, 0x3f, 0x16, 0x7f, 0xd2, 0x42, 0x4e,
+  0xc9, 0xe1, 0xc1, 0x02, 0x1c, 0xbb, 0x44, 0x9e, 0x56, 0xa6, 0xe0, 0xe3,
+  0x77, 0xb8, 0xee, 0x30, 0x27, 0x31, 0xad, 0xf0, 0x5a, 0x72, 0x5d, 0x25,
+  0x74, 0x74, 0x14, 0xf3, 0x59, 0x3f, 0x0b, 0x15, 0x27, 0xb4, 0x8a, 0x8b,
+  0x14, 0x6e, 0xd9, 0x37, 0xe2, 0xc5, 0xa5, 0xec, 0x96, 0xd9, 0xe6, 0xa0,
+  0xe8, 0x97, 0x9b, 0x65, 0x39, 0xc2, 0x96, 0x4b, 0xaa, 0x1b, 0xe9, 0x4b,
+  0x2d, 0xbf, 0xd0, 0x52, 0xcb, 0x40, 0x99, 0x75, 0x84, 0x8f, 0x05, 0x0e,
+  0xc1, 0xab, 0x42, 0x21, 0x27, 0xef, 0x5d, 0xa8, 0xa2, 0xa7, 0x99, 0xae,
+  0xff, 0x9a, 0x5d, 0x42, 0x8c, 0x7c, 0x6c, 0x71, 0xfa, 0x34, 0xb7, 0x50,
+  0x57, 0x18, 0x85, 0x0f, 0x0d, 0xcb, 0xb8, 0xa2, 0xc4, 0xe4, 0x00, 0x0c,
+  0x47, 0xab, 0xc2, 0x8f, 0xb5, 0xba, 0x65, 0x79, 0xd5, 0x22, 0x43, 0x4c,
+  0xcf, 0x1e, 0x68, 0x5b, 0x65, 0xd5, 0x5a, 0x11, 0x40, 0xdd, 0x38, 0xf3,
+  0x3a, 0xe5, 0x33, 0x17, 0xf3, 0x51, 0x2e, 0x84, 0x8f, 0xaa, 0xc4, 0x13,
+  0xa8, 0x96, 0xe7, 0x1e, 0x1d, 0x29, 0x3d, 0xd3, 0x4b, 0x6c, 0x9e, 0x72,
+  0x18, 0x03, 0x65, 0x63, 0x09, 0x26, 0x0c, 0x53, 0x2c, 0xcd, 0x3d, 0x55,
+  0x86, 0xba, 0xbe, 0x11, 0x30, 0x8d, 0x94, 0x6e, 0x13, 0x5f, 0x2c, 0x1d,
+  0x37, 0x15, 0xbc, 0xa2, 0x1c, 0x1c, 0x8d, 0x47, 0xd0, 0x35, 0xe4, 0x47,
+  0x9d, 0x63, 0xd1, 0xea, 0xad, 0xa3, 0x94, 0xfc, 0x4e, 0xe0, 0x27, 0x75,
+  0xdc, 0x2c, 0x70, 0x72, 0x8a, 0x85, 0xc0, 0xe7, 0xce, 0x15, 0x27, 0x97,
+  0xf0, 0xe4, 0x30, 0xb4, 0x5f, 0xef, 0x9a, 0xd0, 0x29, 0x39, 0x41, 0x61,
+  0xeb, 0xf2, 0x3e, 0x61, 0x05, 0xeb, 0xc5, 0x15, 0x3b, 0x05, 0x42, 0x1f,
+  0x0f, 0x91, 0x33, 0x55, 0x5f, 0xe9, 0x25, 0xbc, 0x5b, 0xfb, 0x5c, 0x89,
+  0x5d, 0x73, 0x8c, 0xb4, 0xbe, 0x83, 0x3c, 0xba, 0x9f, 0xd2, 0x61, 0x93,
+  0xe4, 0xf0, 0x14, 0xc1, 0xc4, 0x83, 0x64, 0xa0, 0x78, 0xab, 0x5c, 0x31,
+  0x46, 0xa2, 0x16, 0x4e, 0x59, 0x73, 0xe4, 0xb0, 0x5c, 0x43, 0x66, 0x0f,
+  0xd5, 0xa6, 0x03, 0xfc, 0x8d, 0xbd, 0xdf, 0x0d, 0x65, 0x54, 0xb3, 0x89,
+  0x39, 0xce, 0x43, 0xf3, 0x1c, 0x66, 0x16, 0xa1, 0xf8, 0x51, 0xf0, 0xa1,
+  0x52, 0xb0, 0xe5, 0x78, 0xa8, 0x67, 0x4c, 0x89, 0xc0, 0x67, 0xb7, 0xe6,
+  0xfd, 0xb6, 0x39, 0x54, 0x15, 0x9c, 0x34, 0x44, 0xd8, 0x4a, 0x49, 0x18,
+  0xa9, 0x98, 0x67, 0xd0, 0xb3, 0xc3, 0xff, 0x4b, 0xa6, 0xf6, 0xd5, 0xa3,
+  0x47, 0xc7, 0x36, 0x9e, 0x84, 0x3b, 0xa5, 0x5e, 0x6b, 0xa1, 0x7d, 0x1c,
+  0xe8, 0xef, 0x40, 0x91, 0x88, 0x57, 0xb2, 0xa6, 0xf1, 0xc8, 0xe2, 0x30,
+  0x6c, 0x6a, 0x16, 0x59, 0xc5, 0x35, 0x0d, 0x69, 0x77, 0x49, 0x19, 0x49,
+  0x1e, 0xef, 0x75, 0x1d, 0xa8, 0xac, 0x1f, 0x46, 0xc8, 0x08, 0x45, 0x1f,
+  0x80, 0x2e, 0x81, 0x8d, 0x98, 0x1f, 0xb7, 0x1e, 0xbe, 0xff, 0xbf, 0x9e,
+  0xe1, 0x27, 0x4d, 0x33, 0xd0, 0xf2, 0xf1, 0xcb, 0x97, 0x55, 0x2e, 0x45,
+  0x59, 0x15, 0x68, 0xc1, 0xc4, 0x60, 0x15, 0x80, 0x9f, 0x76, 0xbf, 0xe9,
+  0x6e, 0x51, 0x66, 0x37, 0x30, 0x6a, 0x52, 0xa1, 0x1e, 0x2d, 0xc4, 0x3b,
+  0xba, 0x35, 0x71, 0x4b, 0x12, 0x87, 0x3b, 0x86, 0x15, 0xd1, 0x7a, 0x5f,
+  0x77, 0xae, 0x49, 0x70, 0xf2, 0x44, 0xd0, 0x53, 0x4a, 0x66, 0x86, 0x02,
+  0x91, 0xc7, 0x33, 0x2e, 0x2d, 0x02, 0xb7, 0xa6, 0x99, 0xc3, 0xff, 0xff,
+  0x9c, 0x4f, 0x40, 0x4c, 0x73, 0x56, 0xab, 0x54, 0xee, 0x3c, 0xbc, 0x4e,
+  0x46, 0xd7, 0x9e, 0x98, 0xf3, 0xa1, 0x8b, 0x3b, 0x89, 0x62, 0xd7, 0xc2,
+  0x90, 0xcc, 0xe6, 0xf3, 0xfc, 0xed, 0x79, 0x07, 0x7d, 0x3c, 0x1d, 0xd6,
+  0x56, 0xc9, 0x5b, 0x93, 0x63, 0x90, 0xd3, 0xa0, 0xb8, 0xea, 0x48, 0xcc,
+  0x4b, 0x19, 0xb0, 0x85, 0x4e, 0x26, 0xc9, 0x6b, 0xb8, 0x9f, 0x3f, 0x2e,
+  0xa0, 0x94, 0xab, 0xfa, 0xeb, 0x30, 0x84, 0xd3, 0xe4, 0xa7, 0xb3, 0x17,
+  0x20, 0x39, 0xfd, 0x94, 0xcf, 0x50, 0x9f, 0x48, 0xce, 0x40, 0xe2, 0x08,
+  0x55, 0x14, 0x60, 0x6f, 0xe1, 0xf6, 0xba, 0x49, 0x09, 0xbc, 0x06, 0xd3,
+  0xed, 0x31, 0xc9, 0xb7, 0x1d, 0xd2, 0x49, 0x05, 0x64, 0x8a, 0xed, 0xda,
+  0x98, 0x25, 0x41, 0x26, 0x23, 0x09, 0x29, 0xa5, 0x62, 0x49, 0x0e, 0x03,
+  0xf0, 0xf0, 0xe0, 0xf4, 0xfd, 0xdb, 0xa3, 0x8b, 0xf7, 0x67, 0x07, 0x3f,
+  0x23, 0x8b, 0x9c, 0xa6, 0x52, 0xe8, 0x88, 0xab, 0x5d, 0xe1, 0x9a, 0x1a,
+  0xdf, 0x05, 0x59, 0x9d, 0x41, 0x4a, 0x67, 0x45, 0x81, 0x52, 0xa9, 0xab,
+  0xa6, 0x15, 0xb6, 0xe3, 0x9e, 0xca, 0x3a, 0x9f, 0x03, 0x32, 0xeb, 0x5a,
+  0x27, 0x30, 0xd9, 0x7b, 0x91, 0x94, 0xc2, 0xf3, 0x2d, 0x3a, 0x34, 0xe8,
+  0x13, 0x80, 0xff, 0x6d, 0xb7, 0x3e, 0xe9, 0x55, 0xe0, 0x11, 0xd9, 0x64,
+  0xba, 0x5b, 0x6e, 0xad, 0x0a, 0xc2, 0x34, 0x29, 0xc3, 0xeb, 0x81, 0x97,
+  0x4e, 0x3b, 0x55, 0x51, 0x26, 0xcf, 0xe2, 0xaa, 0x5b, 0x07, 0xa3, 0x91,
+  0xa0, 0x07, 0x52, 0x7d, 0x6c, 0x0c, 0x0b, 0x38, 0x97, 0x64, 0xed, 0xf5,
+  0x8b, 0x93, 0xf3, 0x0d, 0x26, 0x67, 0x06, 0xc0, 0xc0, 0x3d, 0xb8, 0x98,
+  0xa5, 0x88, 0xdf, 0x96, 0x1c, 0x8e, 0x28, 0xc2, 0xd0, 0x2e, 0x4f, 0xc4,
+  0x74, 0xf0, 0xc1, 0xb6, 0x82, 0xe5, 0x22, 0x31, 0x1d, 0x7c, 0x26, 0xb4,
+  0x6b, 0x8b, 0xc5, 0x49, 0x31, 0xbd, 0x12, 0xa4, 0x96, 0xbe, 0x6c, 0x82,
+  0x61, 0x56, 0x6c, 0x07, 0x02, 0xdb, 0xd9, 0xdb, 0xa3, 0xd4, 0xaa, 0x50,
+  0xcc, 0xc3, 0x58, 0xaa, 0xf2, 0xd0, 0xc3, 0xf3, 0xad, 0x36, 0xfc, 0xd8,
+  0xc6, 0x1f, 0xa0, 0xba, 0xc2, 0xcf, 0x5d, 0xfc, 0xf5, 0x31, 0xfe, 0xd8,
+  0xa3, 0xbf, 0x9f, 0xe0, 0xaf, 0x5f, 0xc3, 0xaf, 0x07, 0x2f, 0xb6, 0xe1,
+  0x31, 0xf8, 0xb9, 0x43, 0x3f, 0x77, 0xe9, 0xa3, 0x1d, 0x35, 0xbf, 0xc3,
+  0xaf, 0xf4, 0xf9, 0xce, 0x2e, 0xfe, 0xdc, 0xdd, 0xa6, 0x6f, 0x77, 0xe9,
+  0xa3, 0x5d, 0xfa, 0xe8, 0x31, 0x7f, 0xf4, 0x98, 0x3e, 0x7a, 0x0c, 0x1f,
+  0x1d, 0xbd, 0x80, 0x0f, 0x7e, 0x3a, 0x39, 0x3e, 0x3c, 0xea, 0x1c, 0x3c,
+  0x7f, 0x73, 0x7c, 0x21, 0x0d, 0x1d, 0x1d, 0x5e, 0xc0, 0x93, 0xf0, 0x13,
+  0xed, 0x6b, 0x87, 0x47, 0xed, 0xe4, 0x35, 0xfc, 0x97, 0xbc, 0x3e, 0xf9,
+  0xf9, 0xf0, 0xe4, 0xfc, 0xa2, 0x8d, 0xbf, 0x3c, 0x3f, 0x7a, 0x7d, 0xf0,
+  0x57, 0xf8, 0xec, 0xe2, 0xd5, 0xd9, 0xc9, 0xbb, 0x97, 0xaf, 0x4e, 0xdf,
+  0xc1, 0xc7, 0xc9, 0xd9, 0xd1, 0xeb, 0xe3, 0x83, 0x1f, 0x8f, 0x5f, 0x1f,
+  0x5f, 0xfc, 0x55, 0x1a, 0x7a, 0x73, 0xfc, 0x16, 0x5f, 0xe1, 0x98, 0x45,
+  0xd9, 0xc1, 0xfb, 0x0a, 0x42, 0xd4, 0x4a, 0xc4, 0x19, 0xc6, 0xf5, 0xfd,
+  0xd1, 0x8a, 0xd2, 0x01, 0xac, 0xda, 0x2a, 0x41, 0x2b, 0xc4, 0x98, 0x23,
+  0x9f, 0x44, 0xd5, 0x9f, 0x82, 0xdc, 0x40, 0x06, 0x66, 0xb9, 0xcf, 0xaf,
+  0x47, 0xe9, 0x84, 0x6d, 0x08, 0x70, 0x94, 0x1d, 0x29, 0x0e, 0xcb, 0xce,
+  0x25, 0xb0, 0x73, 0xf4, 0xbd, 0x3d, 0x03, 0x21, 0x5e, 0xa9, 0xf1, 0xf8,
+  0xf4, 0x05, 0x90, 0xdc, 0x79, 0x0c, 0xba, 0xae, 0x0f, 0x8a, 0x21, 0x50,
+  0x08, 0xf2, 0x85, 0x88, 0x68, 0xc7, 0xa7, 0x6f, 0xcf, 0xc5, 0x1a, 0x87,
+  0x19, 0xb9, 0x11, 0xda, 0x84, 0x49, 0x93, 0x21, 0xee, 0x25, 0xd2, 0xb8,
+  0x38, 0xf3, 0x2c, 0x00, 0x0e, 0x62, 0xab, 0xef, 0x5f, 0x1e, 0x5c, 0x1c,
+  0xfd, 0x7c, 0xf0, 0x57, 0x2d, 0xed, 0x79, 0x9d, 0xcf, 0x8a, 0x09, 0xbb,
+  0x31, 0xae, 0xd3, 0x59, 0x2e, 0xda, 0x2f, 0x09, 0x60, 0x98, 0x06, 0x84,
+  0x74, 0x2d, 0xd6, 0xaf, 0xd6, 0xff, 0x6f, 0xb3, 0x8b, 0x33, 0xdb, 0x94,
+  0x01, 0xb7, 0x7c, 0xfa, 0xfb, 0x55, 0x31, 0xd2, 0x5a, 0x9f, 0x36, 0x21,
+  0xd4, 0x5e, 0x38, 0x90, 0xd0, 0x05, 0xc9, 0xa1, 0x00, 0x81, 0xfc, 0x0d,
+  0x91, 0xbd, 0xfb, 0xb0, 0xb1, 0x34, 0x53, 0x5c, 0x54, 0xb1, 0x17, 0xe8,
+  0xcb, 0x1c, 0x78, 0x60, 0x41, 0x23, 0x69, 0x5c, 0x92, 0x74, 0x3e, 0x41,
+  0x2b, 0x3c, 0x61, 0x76, 0xc1, 0x26, 0x52, 0x4b, 0xc8, 0x80, 0xf6, 0x9f,
+  0x6e, 0x3d, 0xdd, 0x6a, 0x21, 0x34, 0x38, 0xd5, 0x21, 0x51, 0x89, 0x97,
+  0x70, 0xee, 0x28, 0x98, 0x7b, 0x54, 0x14, 0x1f, 0xea, 0x85, 0xd6, 0xe3,
+  0xed, 0x6a, 0x6c, 0x52, 0xcb, 0x61, 0xe2, 0x93, 0xf0, 0x65, 0x2f, 0x1d,
+  0xde, 0xf6, 0xb2, 0xfc, 0x32, 0xbd, 0x1c, 0xec, 0x4d, 0xc6, 0x93, 0xc9,
+  0x4e, 0x7e, 0x5b, 0xee, 0x0c, 0x77, 0x03, 0x7b, 0x40, 0x09, 0x95, 0x13,
+  0xba, 0xa8, 0x0e, 0x8e, 0x45, 0x82, 0x27, 0xb2, 0xb1, 0xd2, 0x59, 0x69,
+  0xc1, 0x20, 0xcc, 0x40, 0x74, 0xc0, 0x42, 0xb6, 0x4a, 0xa3, 0xd8, 0x6b,
+  0xf7, 0x12, 0x6e, 0x95, 0x79, 0xaf, 0x9b, 0x17, 0x9b, 0xdc, 0x96, 0x0e,
+  0xb8, 0x43, 0x9b, 0x9c, 0xcd, 0x36, 0xe3, 0x25, 0x2e, 0xc4, 0x71, 0x72,
+  0x59, 0x48, 0xe8, 0xa7, 0x46, 0x3b, 0xeb, 0x3c, 0x6f, 0x2d, 0xb1, 0x8f,
+  0x95, 0xfc, 0xf4, 0x26, 0x95, 0x72, 0xda, 0x95, 0x43, 0x9d, 0x93, 0xe0,
+  0x55, 0xb4, 0xb3, 0xb1, 0x18, 0xcf, 0x09, 0x24, 0xdc, 0x86, 0x4a, 0x37,
+  0x63, 0xd2, 0x6e, 0xa9, 0xa4, 0x30, 0x69, 0x8f, 0xa8, 0x4e, 0xd1, 0xfa,
+  0x71, 0x43, 0x3a, 0x59, 0x56, 0x62, 0xb1, 0x59, 0xb2, 0xc1, 0x62, 0x7a,
+  0x37, 0xc6, 0x67, 0x60, 0xb6, 0x3f, 0x0a, 0x28, 0xf1, 0xf8, 0x4a, 0x2d,
+  0x10, 0xd8, 0xc7, 0x7d, 0x53, 0x74, 0x78, 0xb4, 0x9e, 0xe4, 0xa4, 0xde,
+  0xf5, 0x32, 0xaf, 0x2c, 0x08, 0x84, 0x15, 0x0b, 0x3c, 0x9a, 0xcd, 0x2a,
+  0x00, 0x8b, 0x5a, 0x5c, 0xcb, 0x21, 0xb8, 0xb2, 0xf8, 0x14, 0x85, 0xa4,
+  0x70, 0x21, 0x91, 0x14, 0xc9, 0x10, 0xce, 0x12, 0xfb, 0xbe, 0x0a, 0x89,
+  0x0c, 0x11, 0x19, 0x08, 0x87, 0x53, 0x4b, 0x0b, 0x36, 0xbc, 0xc4, 0xbf,
+  0xf2, 0xeb, 0xb7, 0x0a, 0x95, 0x57, 0x31, 0x1a, 0x48, 0xae, 0x89, 0x68,
+  0x62, 0x7d, 0x20, 0x65, 0x19, 0xa8, 0x33, 0xc1, 0x1a, 0xb1, 0x97, 0x69,
+  0x30, 0x94, 0xf4, 0x35, 0xad, 0x0e, 0x36, 0xe3, 0xb2, 0x48, 0x64, 0xcf,
+  0x5a, 0xb4, 0xe6, 0x18, 0x59, 0xde, 0x72, 0x8b, 0x7e, 0x11, 0x82, 0x7b,
+  0x68, 0xd4, 0xb4, 0xd4, 0xea, 0x62, 0x20, 0x25, 0xf9, 0xd6, 0xd2, 0x1b,
+  0xbb, 0x64, 0x3f, 0x2c, 0x09, 0x71, 0x8b, 0x00, 0x87, 0x41, 0x4b, 0x4f,
+  0xa6, 0x98, 0x5c, 0x45, 0x7a, 0x9e, 0xa4, 0xb7, 0x5d, 0x97, 0xf2, 0x3b,
+  0x76, 0x55, 0x23, 0x3e, 0x7c, 0x83, 0x8e, 0x7d, 0xb7, 0xca, 0xfa, 0x57,
+  0x9b, 0x56, 0xd1, 0x71, 0x13, 0x1f, 0x50, 0x56, 0xb0, 0xf9, 0x07, 0x69,
+  0xaa, 0x73, 0x5d, 0x76, 0xac, 0x25, 0x57, 0xef, 0x27, 0x3a, 0x62, 0x9f,
+  0x26, 0xb9, 0x7c, 0x42, 0x05, 0xd0, 0x85, 0x83, 0x5c, 0xe3, 0xf0, 0x7a,
+  0x7e, 0x17, 0x39, 0xfd, 0x42, 0x74, 0x22, 0x65, 0xaf, 0x10, 0x8b, 0x87,
+  0x13, 0x3c, 0x4f, 0x0d, 0xbd, 0xf4, 0x31, 0x99, 0xdd, 0xa6, 0xd7, 0x8f,
+  0x83, 0x6b, 0xae, 0x8e, 0x9e, 0xc5, 0xce, 0x16, 0x4e, 0xdc, 0x64, 0xc9,
+  0x97, 0x4b, 0x1a, 0xab, 0xb1, 0xa0, 0x1d, 0xfc, 0x2d, 0x8b, 0xca, 0x39,
+  0x45, 0x46, 0x93, 0xb0, 0x51, 0xb3, 0x6e, 0x42, 0x97, 0x4b, 0xe3, 0x3b,
+  0x1b, 0x42, 0x0f, 0xee, 0x59, 0x27, 0x68, 0xec, 0x9e, 0x80, 0xb8, 0x06,
+  0x87, 0x5b, 0xdd, 0xd2, 0x4e, 0x0d, 0x3d, 0x71, 0xeb, 0x56, 0x0f, 0x0f,
+  0x6c, 0xf0, 0x89, 0x3d, 0x91, 0xf5, 0x7b, 0x12, 0xad, 0xdf, 0x93, 0x07,
+  0x5d, 0x3f, 0xdc, 0x10, 0x97, 0xbf, 0x3c, 0x53, 0xfd, 0x63, 0xc6, 0x47,
+  0x54, 0xec, 0x24, 0x03, 0x09, 0xf0, 0xe7, 0xe5, 0x16, 0xc7, 0xaa, 0x6a,
+  0x2a, 0x21, 0x54, 0xad, 0x67, 0x25, 0xa7, 0x95, 0xb7, 0xd0, 0x78, 0xc3,
+  0x70, 0x63, 0x20, 0xce, 0xd6, 0x18, 0x41, 0x56, 0x07, 0x2d, 0x01, 0x5b,
+  0x8c, 0x10, 0x16, 0x2d, 0x73, 0x70, 0x0a, 0x27, 0x5f, 0xa4, 0xff, 0xe9,
+  0x7c, 0x36, 0x2d, 0x4a, 0x02, 0xc9, 0x1a, 0xa7, 0xfd, 0x93, 0x73, 0xbe,
+  0x7b, 0xc9, 0xb8, 0xc5, 0xfa, 0xc0, 0xa0, 0x60, 0x65, 0xab, 0x29, 0x62,
+  0x0c, 0xd7, 0xf1, 0x77, 0x7b, 0x72, 0xa8, 0x91, 0x07, 0x22, 0x86, 0xc7,
+  0x9f, 0x46, 0x0c, 0x9d, 0xdf, 0x4a, 0x68, 0x35, 0xaa, 0x6f, 0xea, 0x40,
+  0xa6, 0x28, 0xd4, 0xc7, 0x6c, 0x1d, 0xff, 0x75, 0x7e, 0xf2, 0x56, 0x71,
+  0x6d, 0x51, 0x7a, 0x88, 0x91, 0x78, 0x8b, 0xe0, 0xe9, 0xf7, 0xf5, 0x23,
+  0xba, 0xda, 0x07, 0xd7, 0x06, 0xe1, 0x24, 0x51, 0xc9, 0xf2, 0xeb, 0x0b,
+  0xe8, 0x26, 0x63, 0x88, 0x4b, 0x1e, 0x3a, 0xa7, 0xd9, 0xc3, 0x3f, 0xb3,
+  0x2c, 0x4a, 0x19, 0xa4, 0x2a, 0x7a, 0x8f, 0x62, 0x6c, 0xe1, 0xbf, 0xa5,
+  0xb3, 0xcb, 0x5f, 0xe9, 0x53, 0xc9, 0x08, 0x6e, 0x59, 0x41, 0x73, 0x50,
+  0x35, 0xf6, 0x7d, 0x7c, 0xd3, 0x26, 0x0e, 0xa2, 0x15, 0x3d, 0xcb, 0xa1,
+  0xef, 0x4d, 0x4f, 0x79, 0x29, 0x82, 0x13, 0x1d, 0x22, 0x6b, 0xb9, 0x99,
+  0x82, 0x39, 0x07, 0x1a, 0x57, 0x43, 0xab, 0xb4, 0xc2, 0x35, 0x48, 0x59,
+  0x14, 0xb4, 0x56, 0x4a, 0x6f, 0xf6, 0x3c, 0x9b, 0x20, 0xf0, 0x39, 0xf1,
+  0xf0, 0xd4, 0xa4, 0xb2, 0x84, 0x11, 0x3d, 0x43, 0x66, 0x7c, 0x28, 0x43,
+  0xc7, 0x59, 0x8e, 0xc9, 0x0f, 0x6d, 0xcd, 0x75, 0x2b, 0xe3, 0x8a, 0x7d,
+  0xc2, 0x7b, 0x2c, 0xd5, 0x82, 0xab, 0x1c, 0x0e, 0x5c, 0xe9, 0x31, 0x34,
+  0xef, 0x51, 0x96, 0xa4, 0x65, 0x4e, 0x72, 0x4a, 0xe5, 0x7a, 0x67, 0x03,
+  0xe5, 0x4b, 0xea, 0xff, 0x26, 0x64, 0xd7, 0x8a, 0x63, 0xbc, 0xa1, 0x11,
+  0xc1, 0x61, 0x48, 0x4e, 0x0b, 0xb1, 0x7b, 0x84, 0x6f, 0xcc, 0x06, 0x8c,
+  0x85, 0x91, 0xb9, 0xa1, 0xb5, 0x61, 0x51, 0xf4, 0xd2, 0xd9, 0x9a, 0xc2,
+  0xb8, 0x10, 0x40, 0x87, 0xd6, 0x18, 0x34, 0x7f, 0x21, 0x91, 0xc8, 0x0f,
+  0xfc, 0xa8, 0xd8, 0xdb, 0x8b, 0x1a, 0x74, 0xb2, 0x8d, 0xa4, 0x36, 0x90,
+  0x36, 0xc9, 0xec, 0xda, 0x44, 0x67, 0x49, 0x36, 0x88, 0x25, 0x6e, 0x50,
+  0x5d, 0x3d, 0xf6, 0x9c, 0x15, 0x84, 0xbf, 0x37, 0x71, 0x48, 0x39, 0x51,
+  0xc2, 0x6a, 0xdb, 0xe1, 0xf5, 0x0d, 0x06, 0x39, 0x7b, 0x7a, 0xb9, 0xf7,
+  0x69, 0x8e, 0xf8, 0x73, 0x24, 0x60, 0x02, 0xdb, 0x41, 0xfb, 0x3e, 0xa3,
+  0xa8, 0xc8, 0x29, 0xb0, 0x7a, 0x6b, 0xe2, 0xb4, 0x08, 0xb0, 0x2d, 0xce,
+  0x81, 0x72, 0xe1, 0x20, 0xb7, 0x22, 0x6b, 0x3c, 0x5c, 0xbc, 0xa5, 0xa1,
+  0xea, 0x49, 0x15, 0xb7, 0x41, 0x36, 0xb1, 0x53, 0xae, 0xc8, 0x25, 0xa9,
+  0xdd, 0xca, 0x78, 0x3b, 0xea, 0x0a, 0x78, 0x33, 0xcb, 0x27, 0xe5, 0x9f,
+  0xd4, 0x2d, 0x11, 0xd4, 0xda, 0xda, 0x3f, 0x93, 0xd6, 0x00, 0x54, 0xea,
+  0x0f, 0xad, 0xfd, 0xa4, 0xd5, 0xc7, 0x58, 0xbd, 0xac, 0x95, 0xfc, 0x6b,
+  0xed, 0x7e, 0xe3, 0x42, 0xfd, 0xed, 0x35, 0xfb, 0xec, 0x33, 0xda, 0xf9,
+  0x01, 0x91, 0x9d, 0x52, 0x34, 0x84, 0xaf, 0xf8, 0x7c, 0xa7, 0x51, 0xf6,
+  0x78, 0x96, 0xe0, 0xb7, 0x98, 0x4e, 0xf3, 0x99, 0x71, 0xe7, 0x68, 0x13,
+  0x5e, 0xa5, 0x9c, 0x7c, 0x1c, 0xb6, 0xf2, 0x94, 0xb0, 0xfe, 0x6a, 0x31,
+  0xe7, 0x9e, 0x8d, 0x45, 0x0d, 0xd1, 0x17, 0xb3, 0xf4, 0x46, 0x39, 0xf4,
+  0x6f, 0x78, 0x5d, 0xff, 0x36, 0x9f, 0x7c, 0xe8, 0xc0, 0x1d, 0x85, 0x61,
+  0x0a, 0x9d, 0x3e, 0x01, 0x34, 0x94, 0x8b, 0xe8, 0xed, 0x9a, 0x7d, 0x66,
+  0xe9, 0x67, 0x74, 0x64, 0xe4, 0x71, 0x4d, 0x72, 0x92, 0x20, 0x0c, 0xcb,
+  0x9b, 0xab, 0x19, 0x11, 0x59, 0x7b, 0xc5, 0xb8, 0x89, 0xbc, 0xec, 0x53,
+  0xf4, 0x2a, 0xa6, 0x89, 0xb7, 0xa4, 0x6f, 0x6d, 0xac, 0xa5, 0x8a, 0x07,
+  0xde, 0x75, 0xec, 0xb7, 0x33, 0xef, 0x99, 0x14, 0x5c, 0x49, 0x4b, 0xd1,
+  0x5a, 0x27, 0xd9, 0x0d, 0xd2, 0x3e, 0xbf, 0x8f, 0x76, 0x42, 0xe4, 0x71,
+  0x94, 0xa3, 0x07, 0x4c, 0x3a, 0x47, 0x05, 0xb4, 0x37, 0x2b, 0x6e, 0x4a,
+  0x72, 0x91, 0x4b, 0xa7, 0x7a, 0x5e, 0xf8, 0x9d, 0x24, 0x4c, 0x41, 0x64,
+  0x12, 0x86, 0xde, 0x51, 0x05, 0xaf, 0x3f, 0x2a, 0xc8, 0xdf, 0x48, 0x1e,
+  0xea, 0x6e, 0x14, 0x71, 0xa1, 0x8b, 0xda, 0xb4, 0x7e, 0x2b, 0x15, 0xf0,
+  0xb8, 0xb7, 0x6e, 0x50, 0x53, 0xcb, 0x77, 0xdf, 0xf6, 0x8d, 0x63, 0xe9,
+  0xf4, 0x74, 0x92, 0xab, 0x63, 0x3b, 0xf0, 0x0b, 0x86, 0x79, 0x8b, 0x7f,
+  0x74, 0x7e, 0x4b, 0x43, 0x8d, 0xe4, 0x0f, 0x19, 0x1c, 0x9a, 0x11, 0x96,
+  0x5f, 0xee, 0x63, 0x0d, 0x73, 0x01, 0x88, 0xad, 0x81, 0x5f, 0x8f, 0xd3,
+  0x8f, 0xf9, 0x78, 0x3e, 0x76, 0x28, 0x64, 0xf6, 0x1a, 0xaa, 0x08, 0x3d,
+  0x18, 0x1b, 0x56, 0x12, 0x93, 0x9b, 0x86, 0x4b, 0x67, 0xa3, 0xf5, 0xd5,
+  0xe2, 0x10, 0x27, 0x45, 0x48, 0x05, 0xd3, 0x48, 0x81, 0x59, 0x31, 0x9d,
+  0xaa, 0x29, 0x62, 0x01, 0x67, 0xd2, 0xa1, 0x3d, 0x12, 0xe7, 0x1a, 0xdd,
+  0xc6, 0x5e, 0x57, 0x78, 0xe1, 0x37, 0x09, 0xac, 0xd1, 0x75, 0x0e, 0x33,
+  0xc1, 0xad, 0x6a, 0x0c, 0x19, 0x92, 0x20, 0x78, 0xb1, 0xa1, 0x13, 0x39,
+  0xd0, 0xa7, 0x64, 0x87, 0xc6, 0x98, 0xf7, 0xff, 0xfc, 0xf1, 0xfc, 0xf9,
+  0x26, 0x09, 0x78, 0xf8, 0x97, 0x18, 0xca, 0xb9, 0xa1, 0xef, 0xbf, 0x23,
+  0xab, 0xe9, 0xf6, 0x93, 0x9d, 0x6f, 0xbe, 0x69, 0x27, 0xe7, 0xc5, 0x28,
+  0x9d, 0x41, 0x63, 0xdb, 0xdb, 0x5d, 0x50, 0x35, 0x68, 0x79, 0xe1, 0xaa,
+  0x46, 0xf3, 0xcc, 0xc1, 0xf1, 0x5f, 0xe0, 0x83, 0x57, 0xa7, 0x9d, 0x77,
+  0x7f, 0xa1, 0x8f, 0xc7, 0xe4, 0xbb, 0x5d, 0x0c, 0x91, 0x5b, 0xa8, 0x3c,
+  0x44, 0x94, 0x12, 0xd6, 0xb5, 0x66, 0x29, 0xc3, 0xe2, 0x02, 0x13, 0x07,
+  0xd4, 0x40, 0xe7, 0x49, 0x9a, 0x32, 0x8c, 0x67, 0x3c, 0xce, 0xdf, 0x68,
+  0x6a, 0x71, 0xbc, 0xb3, 0x21, 0x02, 0xe5, 0xf7, 0x1a, 0xa3, 0x6b, 0x94,
+  0x1a, 0x77, 0xb3, 0xfb, 0x79, 0x16, 0xbb, 0x78, 0xef, 0x42, 0x86, 0x80,
+  0x7d, 0xde, 0x40, 0xaf, 0xf4, 0xe4, 0x33, 0x81, 0x2d, 0xaf, 0x11, 0x2c,
+  0x23, 0x39, 0xa6, 0x71, 0x10, 0x98, 0x59, 0xfe, 0xd1, 0x86, 0x41, 0x09,
+  0xbb, 0x03, 0xaa, 0x4f, 0x2a, 0x21, 0x03, 0x72, 0xf3, 0x72, 0x43, 0x0b,
+  0xf4, 0x2d, 0x9e, 0x63, 0x6e, 0x58, 0x0d, 0xc4, 0x2e, 0x25, 0x36, 0xbc,
+  0x20, 0x6f, 0x74, 0x0d, 0xb9, 0x96, 0x88, 0x2e, 0x20, 0x72, 0x07, 0x44,
+  0x41, 0xa6, 0x3e, 0xf1, 0xb6, 0xa0, 0x8c, 0x54, 0xde, 0x82, 0x28, 0x33,
+  0x2e, 0x25, 0xde, 0x5d, 0x4a, 0xb8, 0x0a, 0x5b, 0x69, 0xc1, 0x09, 0x7b,
+  0xff, 0xa7, 0xa3, 0xa3, 0xd3, 0xe3, 0xe7, 0xaf, 0x8f, 0x04, 0x85, 0xc7,
+  0x3e, 0x7a, 0x7b, 0xf1, 0xd3, 0xeb, 0x16, 0x82, 0x01, 0xf5, 0x3f, 0x64,
+  0x8a, 0x41, 0x51, 0x26, 0xeb, 0x68, 0x7d, 0xa0, 0x56, 0x98, 0xc0, 0xb9,
+  0x21, 0x4f, 0xe3, 0x42, 0xe1, 0x40, 0xb0, 0x42, 0xd0, 0x6d, 0xc5, 0x6f,
+  0x25, 0x5a, 0x66, 0x62, 0x66, 0x5a, 0xe6, 0x2f, 0x90, 0x9a, 0x37, 0x64,
+  0x6a, 0x7f, 0xaa, 0xd3, 0x6a, 0xa2, 0x49, 0x38, 0xc8, 0x0c, 0x12, 0x46,
+  0xa8, 0x27, 0xdd, 0x28, 0xab, 0x90, 0xc6, 0x81, 0x83, 0x7f, 0x80, 0x45,
+  0x13, 0x97, 0x55, 0x99, 0x58, 0xd4, 0x1f, 0xed, 0x43, 0xd8, 0x29, 0x45,
+  0x22, 0x76, 0x08, 0xf5, 0x54, 0xda, 0x1c, 0x3a, 0x58, 0x58, 0xe5, 0x58,
+  0x78, 0x1a, 0x64, 0x7d, 0x9c, 0xc5, 0x02, 0x53, 0x61, 0xae, 0x4f, 0xfb,
+  0x00, 0xaa, 0xdb, 0x80, 0x01, 0x20, 0x05, 0xed, 0x86, 0x05, 0xed, 0xf1,
+  0x98, 0x15, 0xcb, 0xa7, 0x72, 0x61, 0x86, 0x45, 0xda, 0x84, 0x35, 0xd8,
+  0x68, 0x27, 0xdf, 0x24, 0xeb, 0xb4, 0x88, 0xf4, 0x27, 0x0a, 0xc8, 0x7b,
+  0x9b, 0xdb, 0x5b, 0xc9, 0xba, 0x2c, 0xe0, 0x46, 0x5b, 0x08, 0x84, 0xa2,
+  0x5b, 0x68, 0xdc, 0x0a, 0x92, 0x42, 0x82, 0x16, 0xd6, 0xac, 0xba, 0xe4,
+  0xc8, 0x8f, 0xc8, 0x26, 0x2c, 0x79, 0xa9, 0x72, 0x8e, 0x5b, 0xd1, 0x59,
+  0x6a, 0x09, 0xb6, 0x63, 0xa4, 0x1e, 0xdc, 0x51, 0xb9, 0xec, 0x5e, 0xfe,
+  0x11, 0x33, 0x10, 0x0d, 0xf1, 0x31, 0xd6, 0x18, 0x71, 0x91, 0x24, 0x79,
+  0xb2, 0x45, 0xb7, 0xab, 0x16, 0x05, 0x70, 0xbe, 0xad, 0xda, 0x11, 0xbc,
+  0xc3, 0x4c, 0xf4, 0x3b, 0xed, 0x44, 0xb5, 0x8e, 0x76, 0x56, 0x04, 0x7a,
+  0xf7, 0xcb, 0xd0, 0x5e, 0xe0, 0x50, 0x6a, 0x2d, 0xfa, 0xa8, 0xd7, 0x84,
+  0x4e, 0xea, 0x36, 0x79, 0x06, 0x3f, 0xbe, 0xf7, 0x31, 0x5a, 0xe7, 0xaf,
+  0x36, 0x30, 0x51, 0xe5, 0x1a, 0x43, 0x73, 0xf0, 0x01, 0x55, 0x9c, 0xba,
+  0x5a, 0x86, 0x48, 0x80, 0x2a, 0x65, 0xfe, 0x0c, 0x85, 0x89, 0x49, 0x44,
+  0xf8, 0x86, 0x32, 0x92, 0x5b, 0x0e, 0x6e, 0x21, 0xe7, 0xa7, 0x84, 0xcc,
+  0x4b, 0x5c, 0x1c, 0x85, 0xdc, 0x9c, 0xbf, 0x6a, 0x93, 0xe9, 0x1e, 0xed,
+  0x24, 0x6e, 0x7b, 0xa4, 0x00, 0x6e, 0xc0, 0x71, 0xe7, 0xdd, 0xf2, 0x50,
+  0x59, 0x44, 0x5d, 0x83, 0x7c, 0x40, 0xf9, 0x82, 0x89, 0x84, 0xc7, 0x30,
+  0x28, 0xfa, 0x3e, 0x2d, 0x23, 0x7a, 0x02, 0xca, 0xf2, 0x6a, 0x33, 0x1f,
+  0xbc, 0x9f, 0x95, 0xa9, 0x21, 0xd0, 0x85, 0x4f, 0x07, 0xf8, 0x69, 0xd2,
+  0xea, 0xda, 0x13, 0xf2, 0x3b, 0x7e, 0xde, 0x00, 0x58, 0xc0, 0xe1, 0x9f,
+  0x5a, 0x80, 0xe0, 0x04, 0x4e, 0xd1, 0xf9, 0xf9, 0x6b, 0x74, 0x90, 0xcf,
+  0x52, 0x8c, 0xbe, 0x51, 0x16, 0x99, 0x4d, 0x2e, 0xc9, 0xbe, 0x3c, 0xfd,
+  0xd0, 0x2f, 0xb7, 0xb7, 0x4d, 0xc1, 0x95, 0x3f, 0x65, 0xad, 0x28, 0xa0,
+  0xdf, 0xbc, 0x05, 0x56, 0x31, 0xe2, 0xf4, 0x4f, 0x87, 0xe7, 0x7f, 0x80,
+  0xa7, 0xde, 0x9d, 0x1d, 0x27, 0xeb, 0x58, 0x5f, 0xe1, 0xeb, 0xbd, 0xed,
+  0x9d, 0x0d, 0x3d, 0x47, 0x4e, 0x06, 0xa0, 0x20, 0x54, 0x2b, 0x4b, 0xaa,
+  0x6b, 0xce, 0xeb, 0x4d, 0xb8, 0x60, 0x2a, 0x5a, 0x87, 0x36, 0xc5, 0x31,
+  0x8c, 0x92, 0x77, 0x04, 0x20, 0x13, 0xa0, 0xaf, 0x59, 0x84, 0x6f, 0xf1,
+  0x48, 0xf7, 0x5b, 0x38, 0x44, 0xab, 0xbf, 0x42, 0x01, 0x36, 0xa5, 0x6f,
+  0x0e, 0xc6, 0xd8, 0xb5, 0x35, 0x8a, 0x87, 0xee, 0x0f, 0x85, 0xcc, 0x8d,
+  0xf6, 0xaf, 0xd3, 0x91, 0xc5, 0x89, 0xf3, 0xb0, 0x4c, 0x4b, 0x93, 0xae,
+  0x5b, 0x4c, 0x10, 0xa8, 0xfa, 0xa6, 0xde, 0xcb, 0xa6, 0x2b, 0x4c, 0xe4,
+  0xda, 0xa9, 0xc8, 0x53, 0xba, 0xa4, 0xa1, 0xa3, 0xb7, 0x2f, 0x5b, 0xec,
+  0x16, 0x6a, 0x9d, 0x9e, 0x9d, 0xfc, 0xd4, 0x62, 0xf7, 0x10, 0xb5, 0x49,
+  0x8d, 0xba, 0x56, 0xd7, 0x99, 0x21, 0x12, 0x4d, 0x21, 0x27, 0x90, 0x8d,
+  0x8d, 0xd2, 0x26, 0x36, 0xee, 0x25, 0x87, 0xe4, 0x5c, 0x0a, 0xf3, 0xe9,
+  0x74, 0x23, 0x29, 0x8e, 0x23, 0x2b, 0x7d, 0x48, 0x3b, 0x1e, 0xb0, 0x10,
+  0x1d, 0xb5, 0x2e, 0x79, 0xa1, 0x49, 0x56, 0xf5, 0x37, 0xa4, 0xfe, 0xac,
+  0x60, 0xa5, 0x04, 0xa0, 0x6e, 0xd6, 0x9a, 0xc3, 0x46, 0x5b, 0x55, 0x5b,
+  0xf4, 0x8b, 0x48, 0x81, 0x60, 0x8d, 0xa0, 0xd3, 0x88, 0x32, 0x78, 0x0c,
+  0xc6, 0x85, 0x84, 0x00, 0x6b, 0xc1, 0x5b, 0xb4, 0x23, 0xf6, 0x87, 0x80,
+  0x46, 0xd3, 0x18, 0x1a, 0xd8, 0x55, 0x31, 0x2a, 0x86, 0xf3, 0x5a, 0x2a,
+  0x37, 0xe1, 0x06, 0x78, 0xb0, 0xc8, 0x95, 0xa4, 0x27, 0x8a, 0x39, 0xf2,
+  0x11, 0x80, 0xdc, 0x21, 0x19, 0x95, 0x56, 0x62, 0x76, 0x46, 0x08, 0x22,
+  0xe1, 0x67, 0xae, 0xe6, 0xab, 0x7d, 0xf7, 0x0c, 0x7f, 0x3a, 0xce, 0x46,
+  0xe0, 0x04, 0xee, 0xc0, 0xc8, 0x82, 0xe0, 0x53, 0xdd, 0x80, 0xcb, 0x61,
+  0xf0, 0x9d, 0xd8, 0x84, 0xf0, 0x36, 0x6a, 0xb4, 0x26, 0x48, 0x4e, 0x1d,
+  0x87, 0x24, 0x03, 0xe8, 0xf3, 0xa3, 0xb3, 0x76, 0x72, 0x7a, 0xf4, 0x46,
+  0x84, 0x09, 0x20, 0x45, 0x06, 0x5d, 0x54, 0xb1, 0x9b, 0xa3, 0x98, 0x26,
+  0xb1, 0x97, 0x94, 0xb8, 0x1e, 0xbc, 0xc4, 0xe2, 0x52, 0x5a, 0x96, 0xf3,
+  0x31, 0xe9, 0x7f, 0x8c, 0xcd, 0x6f, 0x53, 0xf9, 0x82, 0x98, 0xfc, 0xd6,
+  0x07, 0x8c, 0xff, 0x73, 0xf6, 0x21, 0xac, 0xfb, 0xac, 0x97, 0x3c, 0x23,
+  0x0c, 0xe8, 0xa8, 0x38, 0xa2, 0xa0, 0xdb, 0xfc, 0x29, 0x9b, 0x81, 0x78,
+  0x50, 0x94, 0x49, 0xad, 0x7a, 0x9d, 0x85, 0xef, 0x49, 0x8a, 0x12, 0x35,
+  0x50, 0xc3, 0xe2, 0xa5, 0xa0, 0x31, 0x2c, 0x49, 0x11, 0x00, 0x42, 0xc9,
+  0xfe, 0x23, 0x90, 0xcd, 0x6b, 0x54, 0x38, 0x6f, 0xad, 0x9d, 0xac, 0x21,
+  0xf8, 0x2b, 0xfe, 0x4b, 0xf5, 0x8f, 0x06, 0xec, 0x8e, 0x5b, 0x23, 0x3f,
+  0xb1, 0x18, 0xdc, 0x64, 0xd3, 0xd6, 0x40, 0x0c, 0x97, 0x76, 0xc8, 0xb6,
+  0xc7, 0xb5, 0xd8, 0xa5, 0xef, 0x00, 0x98, 0x43, 0x46, 0x7c, 0xe2, 0x1d,
+  0x82, 0xa3, 0x55, 0xaa, 0xe1, 0xcb, 0x1a, 0x72, 0xd8, 0x8b, 0x7c, 0x6e,
+  0x60, 0x11, 0x1a, 0x65, 0x03, 0xbf, 0x4d, 0xb4, 0x4f, 0xaa, 0xc8, 0x7f,
+  0xda, 0x66, 0x41, 0xf3, 0x5c, 0x26, 0x70, 0x29, 0x32, 0x11, 0x3f, 0xd4,
+  0x9c, 0x45, 0xe9, 0x93, 0x28, 0x35, 0xa4, 0x4a, 0x37, 0xc6, 0x25, 0x31,
+  0x9b, 0xbd, 0x25, 0xc3, 0x52, 0x5a, 0xb6, 0x4b, 0x51, 0xa1, 0xbc, 0x8e,
+  0xb6, 0xf9, 0xcc, 0xe1, 0xaa, 0x1f, 0x70, 0x99, 0x6e, 0xcf, 0x05, 0xc9,
+  0x8b, 0x71, 0x4b, 0x17, 0x34, 0x5b, 0x74, 0xb8, 0x52, 0x8f, 0x33, 0xb5,
+  0xf1, 0x79, 0xa1, 0x7d, 0x30, 0xcd, 0x59, 0x1a, 0xef, 0xb0, 0x67, 0xf2,
+  0x10, 0x65, 0x7c, 0x8c, 0xf8, 0x4d, 0xa8, 0x42, 0x5e, 0x28, 0xd2, 0xa2,
+  0x96, 0x75, 0x3a, 0xc8, 0xbc, 0x6d, 0xec, 0x4c, 0x35, 0xfd, 0x01, 0x97,
+  0x01, 0xd6, 0x97, 0xb0, 0xa5, 0x87, 0x06, 0x61, 0x3d, 0xd3, 0x01, 0x74,
+  0x04, 0x4d, 0x4e, 0x23, 0xbf, 0xf0, 0xed, 0x25, 0xf5, 0x17, 0x14, 0xe5,
+  0xdc, 0x6a, 0x6e, 0x22, 0x75, 0x78, 0x1f, 0x75, 0xf0, 0x06, 0x90, 0xe1,
+  0x3e, 0x54, 0x7e, 0x41, 0xea, 0x2a, 0x48, 0x52, 0xcd, 0x3e, 0x56, 0x4a,
+  0x28, 0x3e, 0xc3, 0xe4, 0x0b, 0x11, 0x8b, 0x95, 0x45, 0xa2, 0x8a, 0x13,
+  0xdd, 0xfe, 0x6a, 0x47, 0xba, 0x0e, 0x67, 0x47, 0x45, 0x5c, 0x3a, 0x24,
+  0xc0, 0x3d, 0x83, 0x29, 0x66, 0x83, 0xef, 0x63, 0x1c, 0x23, 0x6f, 0x29,
+  0xb1, 0x30, 0x61, 0x7a, 0xdc, 0xcc, 0xe6, 0x51, 0x2a, 0x59, 0x87, 0x97,
+  0x27, 0x14, 0xfe, 0x0a, 0xa5, 0xad, 0x99, 0x15, 0x90, 0xb5, 0xb0, 0xb4,
+  0xe0, 0x44, 0x2b, 0xaf, 0xc0, 0x73, 0xa6, 0xc2, 0x17, 0xb9, 0x86, 0x83,
+  0x62, 0x14, 0x9b, 0x19, 0xf8, 0xb5, 0xdc, 0xcc, 0x34, 0x9f, 0x4a, 0xec,
+  0x23, 0x8f, 0x80, 0x63, 0x2b, 0x08, 0xb0, 0x96, 0xf6, 0xde, 0x46, 0xc9,
+  0x07, 0x5c, 0x23, 0x5b, 0xf0, 0x3b, 0xe3, 0x37, 0x58, 0xaf, 0xb3, 0x07,
+  0x4d, 0xdc, 0xe4, 0x83, 0xea, 0x0a, 0x58, 0x93, 0xc0, 0xb2, 0xe7, 0x15,
+  0xa5, 0x63, 0x6a, 0x7e, 0x09, 0xfc, 0x59, 0x2f, 0xb0, 0xd8, 0xcb, 0xbc,
+  0x11, 0x9b, 0x0d, 0x8a, 0xb4, 0x6c, 0x5c, 0xfd, 0x2b, 0x4b, 0x11, 0xea,
+  0x9b, 0x85, 0x34, 0xca, 0x4b, 0xd9, 0x64, 0x65, 0xa3, 0x6d, 0xb0, 0x7a,
+  0x29, 0x9c, 0xcc, 0xe1, 0x30, 0xff, 0x18, 0x54, 0x06, 0x2d, 0x8c, 0xd8,
+  0x95, 0xf3, 0x85, 0x47, 0x62, 0xed, 0xc3, 0x1a, 0x5e, 0xed, 0x6b, 0x7f,
+  0x5a, 0x43, 0xef, 0xfc, 0x44, 0xc4, 0x04, 0xd1, 0x1d, 0x41, 0xd0, 0xf9,
+  0x90, 0x03, 0xb9, 0x62, 0xfb, 0xc0, 0xfd, 0xd6, 0xc6, 0x6b, 0x96, 0xfe,
+  0xbb, 0xf6, 0x66, 0xcd, 0xf2, 0x29, 0xb0, 0xd6, 0xbd, 0x64, 0xc7, 0x50,
+  0xb6, 0x0d, 0x5e, 0x86, 0x6b, 0x97, 0xd4, 0x6e, 0xb2, 0xf6, 0x72, 0x2d,
+  0xd8, 0x3b, 0x7d, 0x16, 0x8d, 0x4d, 0x8d, 0x47, 0x09, 0x0f, 0xac, 0x7f,
+  0x80, 0x3e, 0xe0, 0xd6, 0x7b, 0x89, 0x01, 0x55, 0x70, 0x99, 0x6d, 0xb0,
+  0xed, 0x71, 0x7b, 0x6b, 0xe7, 0x31, 0x2c, 0x21, 0xf1, 0x46, 0xca, 0xd4,
+  0x53, 0x27, 0xe8, 0xf6, 0x87, 0x30, 0x35, 0x7c, 0xa8, 0x1b, 0xac, 0xec,
+  0x58, 0xab, 0xeb, 0x4f, 0xed, 0x64, 0x77, 0x4c, 0xbb, 0xb7, 0xfd, 0x32,
+  0xae, 0x5d, 0x06, 0x24, 0x45, 0x5b, 0x8c, 0xf3, 0xc7, 0x9a, 0xa9, 0x7d,
+  0x75, 0x9c, 0x21, 0x7f, 0xc2, 0x83, 0x73, 0xa9, 0xb6, 0x83, 0xb0, 0xc5,
+  0xb2, 0xf4, 0x9a, 0x49, 0x0d, 0xaa, 0xe3, 0x98, 0xd3, 0x44, 0x04, 0x58,
+  0x98, 0x8b, 0x1a, 0x02, 0xa3, 0xc4, 0x10, 0x21, 0xc6, 0xea, 0x48, 0x31,
+  0x39, 0x36, 0x2f, 0x08, 0xb0, 0xdf, 0xec, 0xa0, 0xaa, 0x12, 0xd6, 0x9c,
+  0x52, 0x6c, 0xb2, 0x0e, 0x85, 0xc8, 0x81, 0x45, 0x62, 0x87, 0x7c, 0x68,
+  0x02, 0xa2, 0xa7, 0x16, 0xe3, 0x14, 0xa5, 0x93, 0xf2, 0x52, 0x0c, 0xe9,
+  0xa7, 0x9f, 0x0d, 0x08, 0x76, 0x9b, 0xcc, 0x66, 0x1c, 0xac, 0xd2, 0x9f,
+  0xe5, 0x53, 0xb2, 0xbe, 0xca, 0xbc, 0x3b, 0x36, 0x6f, 0xc9, 0x23, 0x1e,
+  0x81, 0xe2, 0x81, 0xba, 0x40, 0xc0, 0x25, 0x45, 0x75, 0xcf, 0xa0, 0x40,
+  0x6c, 0x04, 0x6e, 0x99, 0x08, 0x8e, 0x8b, 0xc5, 0x0a, 0x77, 0xa4, 0x1f,
+  0x0e, 0x7b, 0xaf, 0x5c, 0xe0, 0x3e, 0xd6, 0xc9, 0x36, 0xec, 0xea, 0xfd,
+  0xee, 0x89, 0xf8, 0x85, 0xad, 0x4f, 0x7c, 0xe1, 0xcd, 0x6a, 0xdc, 0x0d,
+  0x9f, 0x6e, 0xd7, 0xb6, 0x49, 0xee, 0x36, 0xfa, 0xc4, 0x6b, 0xc7, 0xa3,
+  0x36, 0x75, 0x52, 0x56, 0x3e, 0x49, 0x16, 0x73, 0x45, 0x4e, 0x4f, 0x4e,
+  0x77, 0x13, 0x49, 0x1b, 0x91, 0x52, 0x31, 0x9c, 0xf2, 0x33, 0x92, 0x70,
+  0x67, 0xf4, 0xdb, 0xd3, 0xb7, 0x3e, 0x4b, 0x03, 0xd8, 0x5e, 0x3f, 0x30,
+  0x2b, 0x54, 0xa8, 0xd9, 0xad, 0x7f, 0x9d, 0x67, 0x98, 0x8e, 0xff, 0x26,
+  0xbd, 0xed, 0x65, 0x71, 0xa6, 0x9c, 0xf2, 0x3b, 0x0d, 0x91, 0xe3, 0x1c,
+  0x55, 0xe4, 0xa8, 0x65, 0x20, 0xe9, 0x31, 0xdc, 0x33, 0x70, 0x89, 0x75,
+  0xe0, 0x4d, 0x89, 0x7a, 0x0f, 0xd8, 0x6d, 0x40, 0xc1, 0x3a, 0x14, 0x97,
+  0x50, 0xc2, 0xd0, 0x60, 0x44, 0x2b, 0xbe, 0x6c, 0x66, 0x78, 0x02, 0x47,
+  0xe4, 0xe2, 0xb9, 0x91, 0xbc, 0x53, 0x87, 0xd9, 0x41, 0x61, 0x6a, 0x05,
+  0x01, 0xd9, 0x8f, 0x53, 0xad, 0x4d, 0xe3, 0x32, 0x30, 0x88, 0xd5, 0xa2,
+  0x0c, 0x10, 0xdb, 0x6b, 0xfb, 0x29, 0xa3, 0x8b, 0xc2, 0x88, 0xde, 0xbe,
+  0xc6, 0x3a, 0xb0, 0x2e, 0xc3, 0xae, 0xc7, 0x96, 0xc8, 0x4a, 0xc1, 0x11,
+  0xbc, 0x9b, 0xdc, 0x17, 0xd0, 0x78, 0x7d, 0x7c, 0x7e, 0xa1, 0x74, 0x87,
+  0x56, 0xa2, 0xfd, 0xe4, 0x1c, 0xd3, 0x65, 0x5e, 0x38, 0x64, 0xb4, 0x91,
+  0xc0, 0xe9, 0x8c, 0x6e, 0x25, 0x21, 0x90, 0x55, 0xa2, 0x7c, 0x16, 0x6c,
+  0xf1, 0xd8, 0x09, 0x0e, 0xe1, 0x5b, 0x57, 0xac, 0x60, 0x50, 0x48, 0x69,
+  0x6e, 0x2e, 0xfc, 0x52, 0xce, 0x7b, 0x1d, 0x5d, 0x90, 0x5c, 0x0c, 0xa1,
+  0xe5, 0xed, 0xb8, 0x57, 0x60, 0xa0, 0x1c, 0x08, 0x0d, 0x1f, 0xca, 0x28,
+  0x03, 0x46, 0x37, 0x1e, 0x27, 0x77, 0x5e, 0xdf, 0x79, 0xb6, 0x8f, 0x95,
+  0x5c, 0x70, 0x95, 0xa8, 0x80, 0x1d, 0xfd, 0x46, 0x02, 0xa2, 0x3f, 0xc1,
+  0xaa, 0xb7, 0x49, 0xdc, 0xc4, 0x62, 0x0e, 0x28, 0x98, 0x74, 0x0d, 0xa2,
+  0x2a, 0x93, 0xfc, 0x85, 0x90, 0x3e, 0x29, 0xf0, 0x01, 0x9e, 0x24, 0x56,
+  0xa7, 0x88, 0xda, 0x10, 0x57, 0xa4, 0x08, 0xe1, 0x13, 0x25, 0xb3, 0x50,
+  0x9f, 0x1e, 0x43, 0xec, 0x94, 0x50, 0x08, 0xd5, 0x56, 0x14, 0x2f, 0xcf,
+  0x2c, 0x43, 0x93, 0xce, 0x75, 0x94, 0x21, 0x02, 0x6c, 0x29, 0xa3, 0x3a,
+  0x02, 0xe4, 0x7b, 0xc3, 0x23, 0xa5, 0xa9, 0x57, 0xf5, 0x95, 0xe2, 0x86,
+  0x70, 0xeb, 0x6b, 0x24, 0x63, 0xd8, 0x8a, 0x9e, 0x44, 0xce, 0x8e, 0x2e,
+  0xce, 0xc2, 0xc2, 0x45, 0x07, 0xca, 0xc4, 0xb1, 0xfa, 0x02, 0xea, 0xfa,
+  0x01, 0x11, 0x65, 0x1c, 0xfd, 0x6f, 0x83, 0xc4, 0xf2, 0x15, 0xe9, 0x65,
+  0xd6, 0xc9, 0x07, 0x89, 0xe2, 0x4e, 0xfa, 0xb4, 0x6d, 0x21, 0x51, 0x2a,
+  0x8f, 0x8e, 0x3c, 0x9e, 0xb2, 0x42, 0x73, 0xc4, 0x68, 0x8a, 0x12, 0x4e,
+  0x8f, 0x31, 0x04, 0xb9, 0x6e, 0xc7, 0x74, 0x86, 0xcc, 0xdb, 0x8c, 0xbc,
+  0x82, 0x11, 0xc5, 0x51, 0x98, 0xe6, 0x08, 0xa3, 0x0d, 0xf5, 0x58, 0x51,
+  0x38, 0x9c, 0x9a, 0xd5, 0x7c, 0xc5, 0x73, 0x3e, 0x0a, 0x7c, 0x0e, 0x63,
+  0x88, 0xfb, 0x50, 0x0a, 0xb8, 0x96, 0x24, 0x1f, 0x03, 0xc4, 0x5b, 0xa1,
+  0x38, 0xae, 0x9f, 0x96, 0xbc, 0x3b, 0x7e, 0xfe, 0x3a, 0x1c, 0x50, 0x59,
+  0x5d, 0xc6, 0xdd, 0xb7, 0x84, 0x35, 0x8e, 0x57, 0x0a, 0x77, 0x1f, 0xed,
+  0xa6, 0x66, 0xb1, 0xcd, 0x27, 0xf9, 0xdf, 0xf1, 0xaa, 0x20, 0x25, 0x6c,
+  0x98, 0xb3, 0x48, 0x78, 0x15, 0xe4, 0xa6, 0x32, 0xf1, 0x2b, 0xab, 0x55,
+  0x6f, 0x7c, 0xd0, 0x63, 0x43, 0x86, 0xb8, 0xf1, 0xe2, 0x65, 0x75, 0xc5,
+  0x3f, 0xd1, 0x41, 0x69, 0xed, 0xdd, 0x27, 0x47, 0x6b, 0xb7, 0x8b, 0x4a,
+  0x17, 0xec, 0x58, 0x03, 0x7a, 0xf0, 0xdf, 0xe7, 0x18, 0x2c, 0xda, 0x58,
+  0x89, 0x99, 0xe0, 0xfb, 0x47, 0x1d, 0x52, 0xbd, 0x9e, 0x51, 0x69, 0x42,
+  0xe7, 0xc4, 0x49, 0x3d, 0xf4, 0x9f, 0x46, 0xa2, 0xa8, 0xfb, 0x71, 0xa6,
+  0xa5, 0x0c, 0xd7, 0x5f, 0x9c, 0x9d, 0xbc, 0xe9, 0x5c, 0x9c, 0x6c, 0xd0,
+  0x71, 0xe6, 0x40, 0xe5, 0x24, 0xe0, 0xe1, 0x68, 0xc1, 0x48, 0x1f, 0xb1,
+  0xcd, 0x15, 0x71, 0xcc, 0x33, 0xb0, 0x5e, 0x6e, 0xf8, 0x9a, 0xca, 0xf4,
+  0x72, 0x28, 0x34, 0xa9, 0x41, 0x65, 0x13, 0x16, 0xbc, 0x91, 0x10, 0x31,
+  0x2c, 0xa9, 0x9f, 0xe2, 0xfd, 0xa5, 0xc9, 0x97, 0x52, 0x83, 0xa1, 0xaa,
+  0x42, 0x98, 0x37, 0x8f, 0x8e, 0x4c, 0x94, 0x05, 0x62, 0x25, 0x04, 0x13,
+  0x53, 0x01, 0xcc, 0x35, 0x9d, 0xcd, 0x8a, 0x1b, 0x13, 0x70, 0xf0, 0x2e,
+  0x00, 0x22, 0x09, 0xb5, 0x0a, 0xbd, 0xdb, 0x02, 0x9a, 0xc5, 0x42, 0x31,
+  0x40, 0x4e, 0xd0, 0x3f, 0x83, 0x06, 0xfb, 0xc2, 0x12, 0xb2, 0x7a, 0x8d,
+  0x26, 0x91, 0xc8, 0x06, 0x5f, 0x0f, 0xc6, 0xff, 0x14, 0x2b, 0xbc, 0xeb,
+  0x08, 0xa5, 0x91, 0xce, 0xee, 0xd6, 0xaa, 0x15, 0x57, 0x43, 0x45, 0x67,
+  0x1a, 0xf2, 0xeb, 0xb6, 0xab, 0xd9, 0x10, 0x23, 0x6d, 0x0c, 0x3d, 0x0b,
+  0x91, 0x3c, 0x77, 0x17, 0x12, 0x25, 0x94, 0x83, 0x1a, 0x0d, 0x15, 0x1c,
+  0x48, 0xf1, 0xd0, 0x5f, 0xfb, 0xe3, 0x9a, 0x02, 0xc7, 0x20, 0x8c, 0xa8,
+  0x49, 0x95, 0x68, 0x17, 0xc9, 0x7a, 0xa8, 0xe1, 0xa9, 0xb0, 0x0b, 0xaf,
+  0xe5, 0xbb, 0x7d, 0xab, 0x7f, 0xc8, 0xc7, 0x7c, 0xf7, 0x2f, 0x7f, 0xd1,
+  0x00, 0x22, 0xb9, 0x1a, 0x51, 0xc1, 0xde, 0x68, 0x37, 0x64, 0x81, 0x4a,
+  0xce, 0xd6, 0xa0, 0xf0, 0x43, 0x33, 0x2c, 0xa3, 0x49, 0x26, 0xd5, 0xbd,
+  0x24, 0xd9, 0xfa, 0x78, 0x68, 0x06, 0x6b, 0xd0, 0xe9, 0x29, 0xe1, 0x48,
+  0xd9, 0x11, 0x56, 0x04, 0xe8, 0x68, 0x70, 0x4f, 0x31, 0x73, 0x15, 0xe2,
+  0xe5, 0x43, 0x89, 0xd6, 0x12, 0xd8, 0xd9, 0xda, 0x2a, 0x30, 0x5f, 0xc4,
+  0x36, 0x26, 0x31, 0x7a, 0x4f, 0x6c, 0x54, 0x52, 0x19, 0x95, 0x73, 0x04,
+  0x38, 0x32, 0x42, 0x0b, 0x25, 0xa6, 0x1a, 0x34, 0xa1, 0x86, 0xef, 0xce,
+  0x2b, 0xc9, 0x64, 0x91, 0xea, 0x1e, 0xe2, 0x86, 0xa0, 0x13, 0x8f, 0x2f,
+  0x95, 0xcc, 0xaf, 0xfa, 0xb3, 0x4c, 0x4c, 0x4a, 0xa5, 0x1a, 0x1e, 0xf2,
+  0x49, 0x8e, 0x7f, 0x53, 0xf4, 0xa7, 0x23, 0xd3, 0xd4, 0xea, 0x79, 0x48,
+  0x0a, 0xba, 0x29, 0xc0, 0xd1, 0x8e, 0x49, 0x31, 0x93, 0x08, 0x88, 0x83,
+  0xca, 0xd9, 0x07, 0x64, 0x75, 0xd7, 0xa5, 0x04, 0xd4, 0x25, 0x18, 0x2c,
+  0x40, 0x96, 0x9a, 0xa6, 0x4a, 0x20, 0x78, 0xb3, 0x20, 0x48, 0x12, 0x95,
+  0xd9, 0x26, 0xef, 0x9b, 0x5e, 0x55, 0xe1, 0x42, 0x7a, 0x4d, 0x42, 0x2f,
+  0x85, 0x6e, 0x8d, 0x51, 0x75, 0x44, 0x26, 0xe2, 0x4a, 0xbd, 0x20, 0xde,
+  0x01, 0x79, 0x5b, 0xd0, 0x6d, 0xe7, 0x50, 0x50, 0xd8, 0x7b, 0x44, 0x0f,
+  0x36, 0xd6, 0xe2, 0x09, 0x61, 0x36, 0xf2, 0x7e, 0xc9, 0x71, 0xfd, 0xb2,
+  0x10, 0xec, 0x74, 0x1c, 0xc6, 0x71, 0xed, 0x64, 0xf3, 0xa4, 0x60, 0x49,
+  0xf4, 0x06, 0x85, 0x0a, 0xa8, 0x83, 0xb2, 0x96, 0xbe, 0xb9, 0x50, 0x40,
+  0xe7, 0xe5, 0xd1, 0x85, 0x89, 0xc5, 0x52, 0x5b, 0x45, 0x28, 0x18, 0xed,
+  0xfc, 0xdc, 0xd0, 0xee, 0xd6, 0x36, 0xe8, 0x92, 0x5b, 0x3b, 0x14, 0xd9,
+  0x07, 0xbf, 0xec, 0x76, 0x2d, 0xa3, 0x33, 0x3c, 0x4d, 0x16, 0x25, 0x74,
+  0x0d, 0xb0, 0x95, 0x8a, 0x68, 0x75, 0xf7, 0xe3, 0x47, 0xfe, 0xa2, 0xed,
+  0x02, 0xfe, 0xc8, 0xc2, 0x3e, 0xd0, 0xb2, 0x1b, 0x0d, 0x43, 0xd3, 0x30,
+  0x7a, 0x8b, 0xf9, 0xc1, 0x5b, 0x50, 0x81, 0xb0, 0x45, 0x32, 0x23, 0x04,
+  0x19, 0x5f, 0xbd, 0x08, 0xaf, 0xe1, 0x0a, 0xab, 0xab, 0x89, 0xe7, 0x8b,
+  0xa5, 0x50, 0xde, 0xba, 0x28, 0x8a, 0x94, 0x77, 0x06, 0xa7, 0xcd, 0xd5,
+  0x79, 0xf0, 0xf4, 0x6e, 0x7d, 0xac, 0x9d, 0xde, 0xde, 0x6d, 0x3c, 0x0a,
+  0xe0, 0x8c, 0xc2, 0x09, 0xcc, 0x3b, 0xae, 0x09, 0x92, 0x69, 0xb5, 0x4f,
+  0x55, 0x93, 0x80, 0x04, 0x71, 0x9d, 0x94, 0xbf, 0xf2, 0xdf, 0x8a, 0x14,
+  0xc2, 0x7f, 0xed, 0x7a, 0x35, 0x5c, 0x41, 0x70, 0x88, 0xab, 0xca, 0x55,
+  0x6a, 0x2b, 0x20, 0x11, 0x79, 0x5a, 0x43, 0x40, 0x9f, 0x75, 0xb5, 0xea,
+  0x5c, 0x2d, 0x64, 0x32, 0x9a, 0x94, 0xd9, 0x48, 0x4b, 0xc1, 0x93, 0x0d,
+  0x38, 0xba, 0xee, 0x95, 0xa3, 0x35, 0x5d, 0xf7, 0xa6, 0xcf, 0xaf, 0x9c,
+  0x50, 0x6d, 0x35, 0x89, 0xee, 0xe2, 0xfb, 0xaf, 0x57, 0x54, 0x23, 0x39,
+  0x12, 0x1b, 0x59, 0x7b, 0x3a, 0xaa, 0x3a, 0xe5, 0x75, 0x5f, 0x56, 0x8c,
+  0xe9, 0x22, 0xba, 0xec, 0xfd, 0x09, 0xbd, 0x1b, 0x69, 0x49, 0xce, 0x9d,
+  0xd0, 0xb3, 0x9e, 0x48, 0x52, 0xa7, 0x42, 0x53, 0x8c, 0x12, 0x27, 0xdc,
+  0x96, 0x6a, 0x46, 0xdb, 0xfb, 0x1c, 0x82, 0xe4, 0x99, 0x06, 0x0e, 0x4a,
+  0xaa, 0x09, 0x95, 0x19, 0x7c, 0x51, 0x61, 0x52, 0x60, 0x21, 0x08, 0x6b,
+  0xf4, 0x45, 0xc8, 0x41, 0x2e, 0x83, 0x55, 0x44, 0xf9, 0x1a, 0x96, 0x28,
+  0xf4, 0xd6, 0x50, 0x0a, 0x50, 0x2f, 0x34, 0x52, 0x9d, 0xf5, 0xa5, 0x6a,
+  0x56, 0x0c, 0xe6, 0xa4, 0xd8, 0x26, 0x9c, 0xfe, 0x8f, 0x81, 0xe3, 0xbd,
+  0x19, 0xd7, 0xb1, 0xb3, 0xe4, 0xae, 0x32, 0xaf, 0x2c, 0x2b, 0x45, 0x27,
+  0x26, 0x6e, 0xe4, 0x94, 0xbe, 0xa4, 0x11, 0xb1, 0xeb, 0x85, 0x6a, 0xd6,
+  0x99, 0x1d, 0x39, 0xd4, 0x79, 0xe2, 0xb8, 0x5f, 0x04, 0xed, 0x66, 0x63,
+  0xf3, 0x84, 0x67, 0x46, 0xf9, 0x3a, 0x9c, 0x71, 0x22, 0x66, 0x16, 0x34,
+  0xe9, 0xce, 0x24, 0x9a, 0x15, 0x98, 0x9b, 0xc6, 0xe6, 0xb7, 0x1d, 0xaa,
+  0x64, 0xd9, 0xbf, 0xca, 0x34, 0x2a, 0x0f, 0x9e, 0x75, 0x02, 0x90, 0x46,
+  0x2d, 0x34, 0x99, 0x81, 0x69, 0xf7, 0x15, 0xba, 0x40, 0x57, 0x7d, 0x4a,
+  0xb9, 0x98, 0xb4, 0xaa, 0x1a, 0xb2, 0x46, 0x87, 0x23, 0x54, 0x85, 0x8a,
+  0x00, 0xac, 0x15, 0x22, 0xa7, 0x89, 0xd2, 0x03, 0x23, 0x5f, 0x19, 0xd4,
+  0x79, 0x15, 0x8a, 0xd7, 0x66, 0xef, 0xb3, 0xd8, 0xd4, 0x47, 0xd1, 0x99,
+  0x93, 0xa0, 0xbf, 0x8f, 0x33, 0xbc, 0x29, 0x66, 0x2b, 0x84, 0x98, 0x2e,
+  0x36, 0xf1, 0xca, 0xaa, 0x66, 0x69, 0xd0, 0xe2, 0x77, 0x69, 0xaf, 0xdf,
+  0x92, 0x9c, 0xb5, 0x95, 0x0b, 0x35, 0x2d, 0x3b, 0x5e, 0x97, 0xf9, 0xa4,
+  0xa3, 0xac, 0xed, 0x99, 0xfc, 0x62, 0xf9, 0x8c, 0x58, 0x3d, 0xf5, 0xf5,
+  0x73, 0xf8, 0xc1, 0x16, 0x1b, 0x2e, 0xf5, 0x1a, 0x1c, 0x7d, 0x64, 0xda,
+  0xc2, 0x16, 0x02, 0x77, 0x54, 0xf8, 0xbf, 0x64, 0x30, 0x9f, 0x99, 0xf8,
+  0xaa, 0x3a, 0x5e, 0x24, 0x62, 0xd4, 0x99, 0x38, 0xbd, 0xd6, 0xd0, 0x9a,
+  0x7a, 0xeb, 0x1d, 0xe9, 0x99, 0xfe, 0x1b, 0xd5, 0x40, 0x22, 0xda, 0xc5,
+  0x73, 0xa5, 0x4a, 0x19, 0x0f, 0xa1, 0xde, 0x6d, 0x72, 0x50, 0x99, 0xb7,
+  0x97, 0x24, 0x14, 0x9c, 0x65, 0x9b, 0x67, 0x18, 0x52, 0x19, 0xa8, 0x60,
+  0xac, 0x25, 0xcd, 0xf3, 0xb0, 0xb4, 0xbe, 0x0e, 0x5b, 0x63, 0x17, 0x74,
+  0xf8, 0xb4, 0x47, 0xf8, 0x46, 0xf4, 0x6c, 0x94, 0x5c, 0x80, 0x42, 0x1d,
+  0xd5, 0x13, 0x24, 0xed, 0x38, 0xc1, 0xf0, 0x84, 0x64, 0x67, 0xf7, 0x29,
+  0x06, 0x00, 0xd2, 0xef, 0x7b, 0x5b, 0xdf, 0xec, 0x48, 0x9c, 0x14, 0x47,
+  0x6b, 0x1c, 0x1f, 0x5d, 0xbc, 0x80, 0x15, 0x9c, 0xc1, 0x45, 0x55, 0xcb,
+  0xd6, 0x82, 0x03, 0x8c, 0xd5, 0x7a, 0x3f, 0x00, 0xfd, 0xe7, 0x59, 0x35,
+  0xec, 0x16, 0xb3, 0x4b, 0x4c, 0xe1, 0xda, 0x44, 0x40, 0x96, 0x4d, 0x7a,
+  0xa1, 0x93, 0xa5, 0xb3, 0x2b, 0x50, 0xd9, 0x31, 0x73, 0xbe, 0x53, 0x8e,
+  0xab, 0x69, 0x67, 0x6b, 0xab, 0x06, 0xed, 0xba, 0x43, 0xb8, 0x79, 0xb4,
+  0xb9, 0x06, 0x48, 0xbb, 0xb8, 0x97, 0x49, 0xeb, 0xe0, 0xdd, 0xc5, 0xab,
+  0xef, 0xfe, 0xf8, 0xfa, 0xe4, 0xe5, 0xf1, 0xdb, 0x96, 0xa4, 0xf1, 0x05,
+  0x61, 0xc8, 0x4c, 0xb3, 0x01, 0xbb, 0x84, 0x1d, 0xed, 0x23, 0x3c, 0x42,
+  0xeb, 0x64, 0xf7, 0x3a, 0x3f, 0x38, 0x7f, 0xbd, 0x91, 0xb4, 0xa8, 0x05,
+  0xea, 0xaf, 0x65, 0x2a, 0xb1, 0x1c, 0x44, 0xc9, 0xf5, 0xf7, 0x86, 0x80,
+  0xc1, 0x35, 0xba, 0xb5, 0xa9, 0x3d, 0x7c, 0x7f, 0x61, 0xfb, 0x0e, 0x45,
+  0x7e, 0x15, 0x27, 0xa6, 0x8c, 0x28, 0xfd, 0x90, 0x71, 0x9d, 0xb8, 0x05,
+  0x10, 0x96, 0x36, 0xc5, 0x5f, 0xe4, 0x95, 0xca, 0x45, 0x12, 0x6c, 0xa3,
+  0x27, 0x92, 0x2c, 0xd6, 0x41, 0x60, 0x54, 0x60, 0x04, 0x6c, 0x8a, 0xa7,
+  0x42, 0x85, 0x9a, 0x14, 0xfd, 0x28, 0xd8, 0xf4, 0x04, 0x3e, 0x41, 0xe4,
+  0x31, 0x5a, 0xcc, 0x08, 0xea, 0x57, 0x10, 0xff, 0x4b, 0xb7, 0x28, 0xbc,
+  0x10, 0xad, 0x64, 0x3d, 0xeb, 0x5e, 0x76, 0x39, 0xfe, 0x07, 0x17, 0xa0,
+  0x0a, 0x83, 0x29, 0x27, 0x45, 0x81, 0xc1, 0xad, 0x1b, 0x35, 0x95, 0xcd,
+  0x1f, 0xd2, 0xfb, 0xf2, 0xa7, 0x7f, 0x47, 0xe0, 0x54, 0xdc, 0xd1, 0x1a,
+  0xed, 0xff, 0x7f, 0xae, 0x25, 0xf9, 0x38, 0x9d, 0xae, 0xc2, 0x62, 0x8c,
+  0xab, 0xa0, 0x1d, 0xa3, 0x83, 0xfb, 0x96, 0x3c, 0x93, 0x14, 0x29, 0x2b,
+  0xf1, 0x43, 0x1c, 0xe4, 0x3c, 0x04, 0xe0, 0xa8, 0x92, 0x2e, 0xcf, 0x39,
+  0xe0, 0x33, 0x33, 0xac, 0xb8, 0x80, 0x9d, 0x00, 0x2e, 0x5c, 0x73, 0x81,
+  0x0b, 0x3a, 0xc7, 0x3a, 0x9b, 0x4b, 0xaa, 0x5b, 0xd6, 0xec, 0xd1, 0x13,
+  0xd4, 0x1b, 0xa3, 0xab, 0x73, 0x60, 0xd6, 0x12, 0x73, 0x4e, 0x73, 0x43,
+  0x5c, 0x40, 0x11, 0xee, 0x54, 0x84, 0x28, 0x96, 0xee, 0xd2, 0x89, 0xdd,
+  0xf8, 0x9c, 0x65, 0x24, 0x56, 0xff, 0x30, 0xad, 0x2f, 0x57, 0x71, 0x27,
+  0xf4, 0x81, 0x2b, 0xfa, 0x83, 0xcf, 0x30, 0xe8, 0x5c, 0x70, 0xd9, 0x50,
+  0x3c, 0xd4, 0xf7, 0x96, 0x5f, 0xa2, 0x76, 0x66, 0xfd, 0x69, 0x08, 0x5c,
+  0x83, 0xbf, 0x51, 0x25, 0x8c, 0x37, 0x89, 0x94, 0xc4, 0x7b, 0x37, 0x49,
+  0x0d, 0x29, 0xba, 0xcc, 0x01, 0x35, 0x56, 0x6a, 0xcd, 0xf1, 0xb8, 0xe4,
+  0x4c, 0x06, 0x14, 0x59, 0xa4, 0x6d, 0xea, 0x93, 0x3d, 0xb6, 0xa1, 0xc7,
+  0x2f, 0x17, 0x18, 0x13, 0xfa, 0xf8, 0x02, 0xeb, 0x87, 0xfb, 0x12, 0xaf,
+  0x1f, 0x3d, 0x71, 0xf7, 0xfa, 0x05, 0x1a, 0x67, 0x6b, 0xad, 0xae, 0x22,
+  0xa5, 0x16, 0xcd, 0x18, 0xfa, 0x05, 0x85, 0x2d, 0xf8, 0x8e, 0x48, 0x11,
+  0x8d, 0x65, 0xc1, 0xc3, 0x01, 0xc4, 0x77, 0x96, 0x4d, 0x33, 0x5e, 0x6f,
+  0x1f, 0x92, 0x1e, 0x7b, 0xba, 0x93, 0x50, 0xb0, 0x95, 0x7e, 0x8b, 0xf1,
+  0x93, 0x40, 0x5a, 0xcc, 0xa7, 0xb9, 0xaf, 0x60, 0xc8, 0x96, 0x4e, 0x31,
+  0xff, 0xaa, 0xdd, 0x3d, 0x80, 0xdc, 0xc4, 0xf8, 0x6d, 0xeb, 0x3f, 0x9d,
+  0xbd, 0xf8, 0xab, 0x71, 0xee, 0x0d, 0x89, 0x01, 0xad, 0x35, 0xed, 0xe3,
+  0x4a, 0x9c, 0x27, 0x5f, 0x6b, 0x85, 0x87, 0xc9, 0xe2, 0xdd, 0x19, 0x66,
+  0x6e, 0x57, 0xc1, 0xa0, 0xa0, 0xd8, 0xea, 0x75, 0x0c, 0x5c, 0xc3, 0xa2,
+  0x57, 0x62, 0xca, 0xda, 0xed, 0xee, 0x91, 0x4d, 0x1a, 0xee, 0xc9, 0xbd,
+  0xdd, 0x9d, 0xed, 0x8d, 0x3b, 0x26, 0x90, 0x84, 0x35, 0x14, 0x1f, 0x06,
+  0x08, 0x90, 0x74, 0xab, 0xae, 0x1f, 0xfd, 0xe5, 0xf4, 0xed, 0xaa, 0x13,
+  0x88, 0x02, 0x11, 0x82, 0xfa, 0xae, 0x6d, 0x53, 0xcb, 0x2c, 0x0c, 0x53,
+  0x11, 0xeb, 0x10, 0x3a, 0xf7, 0x62, 0x96, 0xe3, 0x05, 0xd3, 0xe2, 0xe8,
+  0xb9, 0xd7, 0xc5, 0x64, 0x00, 0x62, 0xdc, 0x09, 0xc2, 0x8d, 0x64, 0xad,
+  0x6e, 0x4c, 0x31, 0x66, 0x3c, 0xfe, 0xec, 0xf2, 0xa2, 0x4d, 0x64, 0x4f,
+  0x4d, 0x47, 0x64, 0x3f, 0x41, 0xc8, 0xd4, 0x05, 0x72, 0xbf, 0x83, 0xda,
+  0x3b, 0x24, 0x9b, 0x0f, 0xa5, 0xb0, 0x7c, 0x8d, 0xd0, 0xdd, 0x97, 0x11,
+  0xa5, 0xd3, 0x5e, 0xa8, 0x71, 0x48, 0xd2, 0xf2, 0x0b, 0x97, 0xcd, 0x1c,
+  0xc8, 0xaf, 0xed, 0xaa, 0x4d, 0x78, 0x98, 0x3e, 0x10, 0x9d, 0x50, 0x08,
+  0x21, 0xa1, 0xab, 0x5f, 0x4c, 0xd0, 0x0d, 0x15, 0x80, 0x84, 0x50, 0xa6,
+  0xca, 0xb4, 0x46, 0x92, 0xd5, 0x76, 0xd3, 0x26, 0xc5, 0x14, 0x2a, 0x23,
+  0x3a, 0x3b, 0x3c, 0xbd, 0x48, 0x2e, 0x4e, 0xbc, 0x9b, 0x83, 0x33, 0x7b,
+  0x91, 0xbe, 0x6b, 0x20, 0xb6, 0x59, 0x92, 0xb8, 0x52, 0x3c, 0xb8, 0x1d,
+  0x57, 0xe9, 0x75, 0x4e, 0x40, 0x0d, 0xbc, 0x3f, 0xbc, 0x43, 0x89, 0x45,
+  0x61, 0x27, 0x5c, 0xbd, 0xc7, 0x52, 0x4a, 0xf5, 0x7e, 0x6e, 0x5a, 0xa0,
+  0x7a, 0x7c, 0x0c, 0x67, 0x9c, 0x08, 0x38, 0xa0, 0x99, 0x03, 0x25, 0xbe,
+  0xd1, 0x61, 0xec, 0xb2, 0xc6, 0x19, 0xa1, 0x52, 0x4b, 0x2d, 0x3b, 0x29,
+  0x80, 0x07, 0xbc, 0x30, 0x1f, 0x34, 0x9c, 0xe8, 0xe3, 0x21, 0xd7, 0xdc,
+  0xf4, 0x2b, 0x23, 0x38, 0xbe, 0xb2, 0x2c, 0xb8, 0x2e, 0x6a, 0x12, 0x36,
+  0x71, 0x93, 0x02, 0x44, 0x46, 0xe9, 0x65, 0xb8, 0x11, 0xeb, 0xc1, 0xc4,
+  0x8c, 0x98, 0x2d, 0x3b, 0x44, 0xe8, 0x9e, 0x0b, 0xbb, 0xc4, 0x69, 0x2c,
+  0x8c, 0x46, 0xe5, 0x22, 0x87, 0x08, 0x92, 0x8a, 0x72, 0x02, 0x72, 0x32,
+  0xba, 0x12, 0x5b, 0x36, 0x8b, 0xa7, 0x30, 0x79, 0x1b, 0x9a, 0xae, 0x58,
+  0x53, 0x26, 0x74, 0xe3, 0x0a, 0x3f, 0x48, 0x8a, 0xd5, 0x12, 0xca, 0x5f,
+  0xe5, 0xa8, 0xf9, 0xb1, 0xf8, 0x13, 0x38, 0xc8, 0xca, 0x2a, 0xba, 0x78,
+  0xa4, 0x6a, 0xe2, 0xb2, 0x73, 0xe8, 0xcb, 0x28, 0xd5, 0x13, 0x5c, 0xac,
+  0x55, 0x3d, 0x8d, 0x6f, 0xda, 0x86, 0x59, 0x20, 0x10, 0x3b, 0x8c, 0x5f,
+  0x80, 0x13, 0xc5, 0xf2, 0xa2, 0x0c, 0x2f, 0x3d, 0x97, 0xf2, 0xba, 0x2c,
+  0xbb, 0xde, 0x33, 0x1d, 0x6a, 0x6b, 0x59, 0x14, 0x53, 0xdb, 0x85, 0x41,
+  0xf1, 0x4d, 0x88, 0xfa, 0x47, 0xe6, 0x98, 0xc3, 0x47, 0xca, 0x4b, 0x24,
+  0xb7, 0xdd, 0x33, 0x0a, 0x71, 0xf9, 0xbe, 0x86, 0x7d, 0x0b, 0x63, 0xfc,
+  0xf3, 0xc5, 0x85, 0xb1, 0x09, 0x0e, 0x18, 0x4a, 0xb9, 0x24, 0x17, 0xd5,
+  0x6c, 0xa3, 0xeb, 0x9d, 0xec, 0x97, 0x46, 0x7c, 0x9e, 0x8e, 0x34, 0x36,
+  0x8a, 0xba, 0x40, 0xe3, 0x7c, 0xc2, 0x81, 0x3f, 0x2c, 0xe3, 0x11, 0x26,
+  0x32, 0x45, 0xaf, 0x15, 0x21, 0x12, 0xca, 0x43, 0xcf, 0x05, 0x10, 0x9b,
+  0x60, 0x08, 0xcf, 0x63, 0x94, 0x5b, 0x3e, 0x07, 0x32, 0x8c, 0xb8, 0xe4,
+  0x5d, 0x10, 0xf8, 0x29, 0xb5, 0x30, 0x28, 0x88, 0x0d, 0x10, 0x6c, 0x1f,
+  0x09, 0x3d, 0x74, 0x90, 0x25, 0x4f, 0xcc, 0xe0, 0x77, 0x6e, 0xfe, 0x9d,
+  0x10, 0xe3, 0xc5, 0xd2, 0x0c, 0x0c, 0x97, 0x26, 0x1f, 0xe9, 0x09, 0x14,
+  0x4e, 0xa1, 0xef, 0x1e, 0xc8, 0x8c, 0xc5, 0x02, 0x3a, 0x53, 0xdd, 0x56,
+  0xc2, 0x25, 0x7d, 0x48, 0x50, 0xdb, 0x05, 0x36, 0x69, 0x64, 0x13, 0x86,
+  0x36, 0x19, 0xfa, 0x88, 0xc6, 0x37, 0xb9, 0x00, 0x27, 0x1f, 0xe1, 0xb4,
+  0x36, 0x5e, 0xb3, 0xe0, 0x26, 0x17, 0xb5, 0x14, 0xa2, 0x9b, 0xac, 0x52,
+  0x1f, 0x2c, 0xb4, 0x44, 0x38, 0x45, 0x01, 0x4e, 0x21, 0xbe, 0xe9, 0xfe,
+  0x58, 0xa4, 0xb7, 0x27, 0x17, 0x47, 0xfb, 0x9a, 0x3e, 0x25, 0x18, 0x79,
+  0x8f, 0x51, 0x25, 0xbd, 0xb1, 0x78, 0x77, 0xda, 0x50, 0xf6, 0x04, 0xbb,
+  0x02, 0xb5, 0x52, 0x66, 0xc5, 0x9c, 0x37, 0xba, 0xdb, 0x6d, 0x81, 0xce,
+  0xc6, 0xeb, 0x98, 0x23, 0x16, 0x22, 0x51, 0xa9, 0xe6, 0x29, 0x36, 0xa5,
+  0x33, 0x50, 0x18, 0xd3, 0x8f, 0x6e, 0x39, 0x69, 0x89, 0xf3, 0xa9, 0xa8,
+  0x06, 0x9e, 0x4e, 0x18, 0xc1, 0x88, 0x44, 0xde, 0x68, 0xa7, 0xce, 0x91,
+  0x34, 0x2c, 0x11, 0x80, 0x39, 0xbb, 0xcc, 0x29, 0x1a, 0x89, 0x63, 0xa2,
+  0x0e, 0x10, 0x74, 0x18, 0x2c, 0xf7, 0x64, 0xf4, 0x53, 0x4d, 0xda, 0x85,
+  0x55, 0xa9, 0x29, 0xc3, 0x55, 0xb5, 0x34, 0x9d, 0xc4, 0x9d, 0xbf, 0x2f,
+  0x97, 0xad, 0x17, 0x75, 0xb3, 0x34, 0x1a, 0x69, 0x81, 0x89, 0x84, 0x00,
+  0xa3, 0x88, 0x61, 0xb0, 0x0f, 0x24, 0x79, 0x06, 0xc4, 0x58, 0x07, 0x86,
+  0xd0, 0x6a, 0x14, 0xb5, 0xd4, 0x51, 0x3a, 0xe9, 0x6a, 0xf8, 0x34, 0xd3,
+  0x90, 0x18, 0xb3, 0x58, 0x1a, 0xf4, 0x0e, 0x4e, 0x97, 0x04, 0x4a, 0x2e,
+  0x2c, 0xae, 0xf4, 0xc0, 0xca, 0xb6, 0xba, 0x58, 0xe8, 0x32, 0x72, 0x5e,
+  0x08, 0xf4, 0xb1, 0x12, 0x9e, 0x53, 0xcd, 0xca, 0xea, 0x65, 0x96, 0x76,
+  0x38, 0xa5, 0x89, 0xe6, 0x4e, 0x40, 0xdb, 0x7b, 0x5b, 0xe1, 0xf1, 0xae,
+  0x4e, 0xa2, 0x96, 0xb7, 0x89, 0x43, 0xe8, 0x6c, 0xb3, 0x70, 0x2e, 0x81,
+  0x90, 0x18, 0xb1, 0xc8, 0x11, 0x97, 0x5d, 0xb7, 0x9b, 0xb2, 0x38, 0x5f,
+  0x50, 0xc3, 0xb4, 0x3e, 0x76, 0xfd, 0x72, 0xad, 0xb6, 0xa1, 0xc1, 0x05,
+  0x40, 0xab, 0x3d, 0x6e, 0xbb, 0xa4, 0xa8, 0x65, 0x59, 0x95, 0xba, 0x97,
+  0x9c, 0x04, 0x99, 0x4f, 0x34, 0x16, 0x30, 0x09, 0x90, 0x51, 0x6c, 0x13,
+  0xa6, 0x90, 0x5f, 0x17, 0x5d, 0xaa, 0x07, 0x1d, 0xad, 0x3b, 0x68, 0xef,
+  0xa5, 0x0d, 0x14, 0x0b, 0x4e, 0x8f, 0x40, 0x9e, 0x7e, 0x2b, 0x7a, 0x9a,
+  0x7c, 0x8e, 0x42, 0x5a, 0xce, 0xa5, 0xb9, 0x93, 0x2b, 0x04, 0x9f, 0x82,
+  0x43, 0x23, 0xce, 0x74, 0x68, 0x3a, 0xb2, 0xee, 0x90, 0xdb, 0x94, 0x62,
+  0x90, 0x92, 0xcb, 0x02, 0xdf, 0xe1, 0xe4, 0xee, 0xc8, 0x50, 0x4d, 0xf8,
+  0x1d, 0x65, 0xa2, 0x75, 0xa4, 0x19, 0x10, 0xb0, 0x1e, 0xbd, 0x98, 0x71,
+  0x68, 0x3e, 0x46, 0xe7, 0xdc, 0x2e, 0x86, 0x4e, 0x26, 0xeb, 0xe8, 0xe7,
+  0x80, 0xaf, 0x36, 0x42, 0x6d, 0x24, 0xa3, 0xec, 0x20, 0xeb, 0x33, 0x7f,
+  0xe6, 0xcc, 0x26, 0xb4, 0x4b, 0x56, 0x89, 0xac, 0x03, 0x7e, 0x57, 0xe3,
+  0x15, 0xa5, 0x44, 0x02, 0x0d, 0x04, 0x93, 0xaa, 0xaf, 0x05, 0x1a, 0x18,
+  0xa6, 0x82, 0x7a, 0x0b, 0xfb, 0x01, 0x93, 0x1f, 0x99, 0xaf, 0x92, 0xbe,
+  0x4b, 0xe2, 0x1c, 0xe7, 0x2c, 0x9e, 0x5f, 0x48, 0x75, 0xed, 0x79, 0x78,
+  0x52, 0x45, 0xa6, 0x1d, 0x00, 0x23, 0x5e, 0xef, 0x6e, 0xd0, 0xe5, 0x21,
+  0xef, 0x29, 0x65, 0x52, 0x82, 0x1a, 0x2c, 0x6a, 0x47, 0x43, 0x82, 0xb9,
+  0x52, 0x3a, 0x06, 0x56, 0x58, 0xcd, 0x40, 0x01, 0xdb, 0x1a, 0xf2, 0xd5,
+  0x62, 0xa0, 0x62, 0xdc, 0xbc, 0x5e, 0xac, 0x6c, 0x79, 0xb1, 0x06, 0x35,
+  0xd8, 0xdb, 0xa6, 0xf4, 0x90, 0x85, 0xb0, 0xcb, 0x86, 0x93, 0x41, 0x9d,
+  0x6c, 0xaf, 0x10, 0x3b, 0x69, 0x0f, 0xef, 0x74, 0xbf, 0xd9, 0x59, 0x35,
+  0xa7, 0x9e, 0x22, 0x34, 0xe8, 0x35, 0x34, 0x15, 0x6b, 0x78, 0x8b, 0xdf,
+  0xb3, 0xc0, 0x27, 0xb3, 0x2a, 0x45, 0x12, 0x5d, 0xf4, 0xa1, 0x48, 0x1a,
+  0x16, 0xa3, 0x80, 0x70, 0x3c, 0x1b, 0x6b, 0xfd, 0x2e, 0xaf, 0xed, 0x8d,
+  0xbc, 0x1d, 0xb0, 0xbe, 0xc5, 0xe7, 0x63, 0x5f, 0xa8, 0x6d, 0x3b, 0xaa,
+  0x4e, 0x9a, 0x07, 0x07, 0xf4, 0x2c, 0xf8, 0xa2, 0xe0, 0x56, 0x2a, 0xc9,
+  0x8c, 0xcd, 0xe5, 0x4a, 0x15, 0x7c, 0x18, 0x6b, 0xc2, 0x3e, 0xed, 0x6e,
+  0x6d, 0xa8, 0x75, 0x47, 0x5b, 0xfe, 0x82, 0xc6, 0x1d, 0xed, 0x82, 0x2e,
+  0xec, 0xd5, 0x00, 0x9b, 0x81, 0x8e, 0x46, 0xa3, 0x2c, 0x64, 0x5d, 0x8c,
+  0xa7, 0x55, 0x5f, 0x22, 0x7e, 0x25, 0xb1, 0x46, 0x82, 0xd8, 0xf0, 0x8a,
+  0x79, 0x43, 0x2a, 0x45, 0x8a, 0x16, 0x3e, 0xcc, 0x45, 0x5e, 0x7f, 0x73,
+  0x7a, 0x81, 0x50, 0xfb, 0xb8, 0x1a, 0x51, 0x9e, 0x31, 0x7d, 0xee, 0xe2,
+  0xcb, 0x27, 0xa8, 0x76, 0xa0, 0x9b, 0x8d, 0x19, 0x3d, 0x99, 0xb3, 0x2d,
+  0xda, 0x13, 0x1f, 0x25, 0x46, 0x27, 0x7e, 0x2f, 0xd3, 0x5b, 0x24, 0xdd,
+  0x19, 0x96, 0x77, 0xac, 0x77, 0x05, 0x19, 0xa3, 0x5d, 0x80, 0x83, 0xe1,
+  0xf4, 0x26, 0x38, 0xaa, 0x32, 0x09, 0x18, 0xa3, 0xec, 0x29, 0x60, 0x2f,
+  0xb9, 0x06, 0x14, 0x39, 0x6b, 0x4a, 0x86, 0xe1, 0x94, 0xa9, 0x43, 0x46,
+  0x40, 0x8d, 0x36, 0x9b, 0x00, 0x93, 0xec, 0xbb, 0xb8, 0x7c, 0x22, 0xc1,
+  0x7c, 0x8c, 0xbb, 0x85, 0x0c, 0x62, 0x94, 0x1b, 0x6a, 0x6d, 0xcf, 0x62,
+  0xfd, 0xf0, 0xec, 0xdb, 0x90, 0x79, 0x14, 0x65, 0x8e, 0x1f, 0xa4, 0x93,
+  0x8c, 0x08, 0x50, 0xf7, 0x8c, 0x17, 0x05, 0x33, 0x64, 0xb2, 0x49, 0x36,
+  0xcc, 0x09, 0x2d, 0x3a, 0x77, 0x79, 0xdb, 0x37, 0x94, 0x15, 0x55, 0x6b,
+  0x8a, 0x22, 0x02, 0x6b, 0x95, 0x92, 0x38, 0xdd, 0x42, 0x42, 0x46, 0x39,
+  0x28, 0xb5, 0x2d, 0xe2, 0x1d, 0x92, 0xfe, 0xb8, 0xe8, 0xe1, 0xf6, 0xd7,
+  0xda, 0x45, 0xfe, 0x44, 0x79, 0x9a, 0xe4, 0x5b, 0x15, 0xbe, 0xc4, 0x71,
+  0x90, 0xba, 0x66, 0x3f, 0xe7, 0x2f, 0x72, 0x11, 0xde, 0xb3, 0xd1, 0x88,
+  0xeb, 0x35, 0x91, 0xb5, 0x02, 0xcb, 0x44, 0x11, 0x04, 0x0e, 0x46, 0x8d,
+  0x85, 0x3c, 0xf3, 0x50, 0x18, 0xc2, 0x06, 0x4d, 0x00, 0xd1, 0x68, 0x55,
+  0x51, 0x94, 0xd9, 0x53, 0x49, 0x4b, 0x6d, 0x2e, 0xe6, 0x95, 0x97, 0x3e,
+  0x81, 0x9f, 0xe3, 0x61, 0x02, 0x88, 0x44, 0xa1, 0x48, 0xc6, 0xac, 0x5b,
+  0xd0, 0x05, 0x82, 0x57, 0x99, 0xc6, 0xa3, 0xcf, 0x30, 0x2b, 0x72, 0xaf,
+  0xfb, 0xa4, 0x9b, 0x9c, 0x50, 0x92, 0x39, 0x2e, 0xaf, 0x23, 0x43, 0x0e,
+  0x70, 0xd4, 0xf8, 0x88, 0x36, 0x28, 0x7c, 0x13, 0x43, 0x25, 0xf4, 0x55,
+  0x1a, 0x4c, 0x85, 0x49, 0x59, 0x00, 0x96, 0xda, 0x39, 0xeb, 0x58, 0xee,
+  0x86, 0x52, 0xd2, 0xdf, 0x3d, 0x8f, 0xda, 0xf5, 0xd7, 0x83, 0x38, 0x65,
+  0x24, 0xe5, 0x88, 0x1e, 0x61, 0x5b, 0x23, 0xe5, 0x97, 0x71, 0xf0, 0xbe,
+  0x72, 0x12, 0xda, 0x7f, 0x62, 0x06, 0xd0, 0x99, 0x67, 0xc6, 0x71, 0x64,
+  0x5a, 0x3a, 0xc6, 0x34, 0x0d, 0x2a, 0x73, 0x05, 0x07, 0x02, 0x49, 0x9a,
+  0xea, 0x69, 0xd1, 0x4d, 0x4d, 0x0d, 0x78, 0x64, 0xbc, 0xf8, 0xc0, 0x3e,
+  0x6c, 0xa1, 0x0f, 0x6a, 0xf8, 0x1e, 0x86, 0x83, 0x8f, 0x7c, 0x3e, 0x98,
+  0xec, 0x10, 0x38, 0x5d, 0x01, 0x7a, 0x99, 0x31, 0x1f, 0xab, 0xd0, 0x18,
+  0x49, 0xbd, 0xc2, 0x87, 0xde, 0xea, 0x97, 0xc9, 0xfa, 0xf9, 0xe9, 0xdb,
+  0xa3, 0x97, 0x27, 0x1b, 0x4b, 0x3c, 0xa6, 0x9e, 0xc4, 0x2c, 0x4d, 0x2d,
+  0xd5, 0x84, 0x6a, 0x49, 0x50, 0x23, 0x55, 0xe4, 0xe5, 0xf9, 0x79, 0xe7,
+  0xe0, 0xf4, 0x38, 0xa1, 0x84, 0x71, 0xf8, 0x57, 0xf7, 0xaa, 0xeb, 0x2b,
+  0x8f, 0xe9, 0x05, 0x1d, 0xa2, 0x77, 0x39, 0xc1, 0x8b, 0x8c, 0x3f, 0xea,
+  0x1f, 0x94, 0x96, 0x36, 0xa9, 0x19, 0x6c, 0x8e, 0x46, 0x18, 0x59, 0x63,
+  0x1b, 0x3c, 0x6f, 0x28, 0x24, 0x05, 0x4a, 0xd1, 0x74, 0xf7, 0x14, 0x76,
+  0xfe, 0x03, 0x05, 0x44, 0x91, 0x63, 0xda, 0xd3, 0x2a, 0x5a, 0x06, 0x10,
+  0xe3, 0x22, 0xad, 0x98, 0x2f, 0xd7, 0xfc, 0x3c, 0x9c, 0xbd, 0x06, 0xed,
+  0x4c, 0xb3, 0x19, 0x16, 0x27, 0x38, 0xb7, 0x88, 0xb4, 0xb5, 0xce, 0x3c,
+  0xd9, 0x5f, 0x0b, 0x2c, 0x39, 0x9b, 0x50, 0xb9, 0x57, 0x41, 0x10, 0x32,
+  0x7b, 0x33, 0x19, 0xd7, 0xd4, 0xdb, 0x46, 0x62, 0x23, 0xe7, 0x45, 0xbb,
+  0x81, 0x30, 0xf2, 0x8f, 0x65, 0x99, 0x32, 0xe8, 0x9a, 0x5c, 0xb3, 0x35,
+  0xd4, 0x46, 0xdb, 0xce, 0x65, 0xe1, 0xb4, 0x9f, 0x58, 0x34, 0xd2, 0xda,
+  0xbb, 0x9b, 0x2a, 0x43, 0xb7, 0x38, 0xe9, 0xd5, 0xee, 0xc1, 0x5e, 0x5a,
+  0x22, 0xbe, 0x3f, 0xbc, 0x5c, 0x8d, 0x48, 0x68, 0x07, 0x45, 0x87, 0xdc,
+  0x4c, 0x12, 0xa7, 0x44, 0x75, 0x0d, 0x7c, 0xff, 0x44, 0xb0, 0x13, 0x7a,
+  0x03, 0x04, 0x94, 0xbe, 0x1a, 0x9b, 0x3e, 0x68, 0x49, 0xf4, 0x7e, 0x2a,
+  0x97, 0x50, 0x97, 0xbe, 0x97, 0x54, 0xe0, 0xb8, 0x1e, 0x07, 0x97, 0xe2,
+  0x70, 0x89, 0x13, 0x96, 0xc5, 0xcd, 0x9e, 0xe6, 0x85, 0x2d, 0x71, 0x35,
+  0xa5, 0x2b, 0xc6, 0x6f, 0x92, 0x24, 0x0e, 0x4e, 0x09, 0x44, 0x8b, 0x12,
+  0x6e, 0xd0, 0xbb, 0x49, 0xfe, 0x31, 0xa4, 0xd0, 0xd3, 0xd7, 0xb4, 0x88,
+  0x5c, 0x5e, 0x89, 0x25, 0x18, 0x16, 0xcd, 0x4b, 0x0e, 0xb4, 0xae, 0xfb,
+  0x90, 0x29, 0xfc, 0x8f, 0xc6, 0xbd, 0xbe, 0xb7, 0x11, 0x6c, 0x3a, 0xc3,
+  0x6a, 0xba, 0xbe, 0xcd, 0xd7, 0xbd, 0x14, 0x42, 0x31, 0x04, 0x37, 0x9a,
+  0x9e, 0xe6, 0x6b, 0x04, 0x70, 0x7d, 0x12, 0x76, 0x09, 0x46, 0xd7, 0xca,
+  0xac, 0x93, 0x4b, 0x18, 0x8d, 0xd6, 0xf4, 0x4a, 0x78, 0x8a, 0x32, 0xed,
+  0x38, 0x78, 0x8f, 0x64, 0x5f, 0x0a, 0x3d, 0x2a, 0xa5, 0x32, 0xeb, 0x7a,
+  0x5e, 0x2d, 0xf8, 0xb4, 0x27, 0x8a, 0x34, 0x0f, 0x2b, 0x33, 0x1a, 0x90,
+  0x64, 0x0d, 0x7f, 0x5c, 0xce, 0x8a, 0xf9, 0xb4, 0x83, 0x49, 0xeb, 0x38,
+  0xbf, 0x0d, 0xc1, 0x3c, 0x89, 0x91, 0x9e, 0x0d, 0xea, 0x59, 0x3c, 0x13,
+  0xaf, 0x4e, 0xde, 0x1c, 0xb5, 0x12, 0x53, 0x88, 0x99, 0xd7, 0x0e, 0x73,
+  0x0b, 0x38, 0xa8, 0x55, 0x4c, 0xf1, 0xd6, 0xb3, 0xd6, 0xdb, 0xa3, 0x8b,
+  0xb3, 0xc3, 0xd6, 0x22, 0x9c, 0xb4, 0xa1, 0x49, 0x1b, 0x98, 0x74, 0x98,
+  0xb5, 0xa2, 0xfe, 0x73, 0x67, 0x8a, 0xe2, 0xe5, 0xe8, 0x88, 0x71, 0x2c,
+  0xd6, 0x1d, 0xfb, 0xdc, 0x7e, 0x02, 0x92, 0xe4, 0x57, 0x0e, 0x52, 0x96,
+  0x9e, 0x26, 0x9b, 0x83, 0x0b, 0x45, 0xa5, 0x2e, 0x42, 0x8c, 0x1c, 0x19,
+  0xbc, 0x59, 0x63, 0x60, 0x4c, 0x61, 0x9a, 0xd6, 0xa5, 0x55, 0x4c, 0x42,
+  0x21, 0x5b, 0x37, 0xcf, 0xdf, 0x6a, 0x8e, 0x62, 0x2d, 0x25, 0xc3, 0x07,
+  0x7d, 0x09, 0x3e, 0x6f, 0x28, 0x60, 0x30, 0x09, 0xd8, 0x2f, 0x56, 0xbc,
+  0x8e, 0x8d, 0xf9, 0x16, 0x95, 0xa2, 0x35, 0xe7, 0xd4, 0x62, 0xc1, 0x12,
+  0xdf, 0x2c, 0x8b, 0xc4, 0xda, 0x13, 0xab, 0xa2, 0x90, 0x80, 0x90, 0x11,
+  0x72, 0x3d, 0xf4, 0xdc, 0xd4, 0xce, 0x0b, 0x41, 0x00, 0x12, 0xfe, 0xf3,
+  0x60, 0x3f, 0x91, 0x83, 0x16, 0xa8, 0xf5, 0x3d, 0xfd, 0xdd, 0xb6, 0x88,
+  0xf7, 0x10, 0xb5, 0x48, 0x39, 0x1d, 0xa8, 0x3b, 0x9d, 0x70, 0x35, 0xcb,
+  0x50, 0x01, 0x18, 0xc9, 0x39, 0x82, 0xa7, 0x92, 0xe6, 0x69, 0xc6, 0xdc,
+  0x60, 0xe2, 0xe3, 0xf9, 0x0f, 0x12, 0xb8, 0x5e, 0xe0, 0x7a, 0x26, 0x51,
+  0x2c, 0xa7, 0xec, 0x43, 0xcd, 0x42, 0x44, 0x8b, 0x0c, 0x86, 0xca, 0xd2,
+  0xb5, 0x81, 0xe1, 0xe6, 0xa9, 0xb2, 0x82, 0x4a, 0x42, 0xbc, 0xbc, 0x87,
+  0x07, 0x3e, 0xc3, 0xd3, 0x2b, 0xc2, 0xb1, 0x24, 0xd8, 0x70, 0xd8, 0x5c,
+  0xd7, 0xdb, 0xca, 0xe9, 0x1c, 0x1b, 0xbb, 0x5e, 0x1b, 0xdf, 0x22, 0x86,
+  0xf4, 0x9a, 0x93, 0x6c, 0x8d, 0x7b, 0xaf, 0x71, 0x3c, 0xde, 0x9a, 0x80,
+  0x2b, 0x53, 0x4e, 0x95, 0x56, 0xcf, 0xab, 0x0a, 0x02, 0xf4, 0xd4, 0x6e,
+  0xea, 0xbd, 0xc0, 0x57, 0xcc, 0x80, 0xb8, 0x79, 0xf8, 0x33, 0x44, 0x60,
+  0x50, 0xa3, 0x5f, 0x2d, 0xa6, 0x4e, 0xf0, 0xd4, 0x9a, 0x20, 0x7a, 0x83,
+  0xfc, 0x51, 0x67, 0xf1, 0x66, 0xd7, 0x5b, 0x64, 0xf4, 0xd0, 0xd8, 0x7d,
+  0x4c, 0x1e, 0xfb, 0x5b, 0xb5, 0xac, 0x7d, 0xbd, 0x4a, 0x77, 0x63, 0x91,
+  0x6e, 0x77, 0xa4, 0x22, 0x54, 0x40, 0xfe, 0x9c, 0x9b, 0x42, 0x57, 0x82,
+  0xc7, 0xc4, 0xb1, 0x57, 0xda, 0xac, 0xc0, 0xc2, 0xf1, 0x92, 0x2b, 0x23,
+  0x8a, 0xf8, 0x70, 0x4d, 0x3f, 0x53, 0xaa, 0xae, 0x63, 0x6b, 0xb9, 0x53,
+  0x67, 0xd1, 0xaa, 0xe7, 0x5a, 0xee, 0xb0, 0xb2, 0xde, 0xda, 0x34, 0xfa,
+  0x0c, 0x01, 0xce, 0x89, 0xa1, 0x80, 0x0c, 0xe1, 0x6a, 0xf2, 0xa9, 0x0c,
+  0xc1, 0x08, 0xa9, 0x30, 0xb1, 0xf5, 0xb4, 0x57, 0x16, 0xa3, 0x79, 0x45,
+  0x8e, 0x65, 0x0c, 0xe3, 0xc0, 0x48, 0xc7, 0x00, 0x3b, 0x02, 0x67, 0xb0,
+  0xc7, 0xf1, 0xb4, 0xbd, 0xdb, 0x85, 0xa9, 0x72, 0x78, 0xa5, 0x39, 0xbc,
+  0xd4, 0x0a, 0xe7, 0xd7, 0xe9, 0x4b, 0x19, 0x54, 0x5d, 0x1f, 0x2b, 0xed,
+  0xf4, 0x4a, 0x10, 0xbd, 0x4c, 0x56, 0x11, 0x46, 0x2f, 0x2f, 0xa9, 0x01,
+  0x49, 0x86, 0x40, 0x40, 0xde, 0xcb, 0xda, 0x06, 0xea, 0xc2, 0x68, 0xbc,
+  0x58, 0xd8, 0x1c, 0xb7, 0x3b, 0x52, 0x1f, 0xc5, 0x93, 0x9f, 0x24, 0x44,
+  0xd3, 0x36, 0x0b, 0x13, 0x80, 0x35, 0x48, 0x2f, 0x23, 0x90, 0xdd, 0x74,
+  0x64, 0xc5, 0x90, 0xd1, 0xce, 0x3a, 0x48, 0x99, 0xc7, 0x95, 0x1a, 0x1d,
+  0x2f, 0xdc, 0x67, 0x1a, 0x70, 0x04, 0x1a, 0x3c, 0x81, 0xb5, 0x0d, 0x5c,
+  0x06, 0x99, 0x5d, 0xd3, 0x07, 0x56, 0x3b, 0x90, 0xe1, 0x08, 0xac, 0xb0,
+  0x75, 0x36, 0x84, 0x55, 0x8f, 0xe8, 0xf2, 0x13, 0x1a, 0x1f, 0xd0, 0xae,
+  0xd6, 0x0c, 0xf0, 0x40, 0x12, 0x81, 0x5c, 0x74, 0xc7, 0xf6, 0xdb, 0x82,
+  0x87, 0x10, 0x44, 0x79, 0x5f, 0x5d, 0xd9, 0x41, 0x32, 0x48, 0xbc, 0x7a,
+  0x14, 0x73, 0x6f, 0x95, 0xe7, 0x10, 0x31, 0xa5, 0xe8, 0x53, 0xd1, 0xf8,
+  0x28, 0x66, 0x51, 0xac, 0x06, 0x69, 0xc0, 0xab, 0xb2, 0xf8, 0x68, 0x8b,
+  0x3c, 0xc1, 0x46, 0x34, 0xb8, 0xbe, 0xcd, 0x36, 0x4b, 0xa7, 0x63, 0x71,
+  0xca, 0x68, 0x42, 0x48, 0xd7, 0x0b, 0x11, 0x9b, 0x6d, 0x09, 0xa3, 0x37,
+  0xff, 0x95, 0x05, 0x53, 0x24, 0xce, 0xfe, 0x61, 0xa6, 0xcd, 0x19, 0xdf,
+  0x92, 0x68, 0x86, 0x01, 0x6d, 0x02, 0xae, 0x09, 0x8b, 0xe9, 0xc7, 0x56,
+  0xb0, 0xe7, 0xee, 0x57, 0x61, 0xa9, 0x3e, 0x56, 0x6c, 0x47, 0x15, 0x01,
+  0x81, 0xcd, 0x90, 0x16, 0x8b, 0x49, 0x11, 0xdd, 0xa8, 0x4f, 0x2b, 0x1e,
+  0x45, 0x31, 0x21, 0xc2, 0xb9, 0xce, 0x64, 0xcc, 0xce, 0x2c, 0x85, 0xa2,
+  0xcd, 0x1c, 0x14, 0x7d, 0xc2, 0xdc, 0xbb, 0xd6, 0xb2, 0x59, 0x9a, 0x94,
+  0x6b, 0xa5, 0xbb, 0xbc, 0x17, 0x81, 0xcc, 0x32, 0x7e, 0x67, 0x72, 0x09,
+  0x52, 0x27, 0xc1, 0x33, 0x49, 0x5e, 0x4a, 0xaf, 0x61, 0x40, 0x89, 0xe5,
+  0xcc, 0x26, 0xde, 0xef, 0x4a, 0x7f, 0x91, 0xb3, 0xd5, 0x8e, 0x2f, 0xfd,
+  0xd5, 0x49, 0xcb, 0x7e, 0x9e, 0x6b, 0x38, 0x2f, 0xfa, 0x87, 0xb1, 0x42,
+  0xf0, 0xad, 0xcf, 0x96, 0xb4, 0x55, 0xd5, 0x72, 0x5e, 0x83, 0x82, 0xe0,
+  0x22, 0x34, 0xef, 0x83, 0x93, 0x97, 0x28, 0x39, 0x82, 0xc2, 0x4c, 0x34,
+  0xbe, 0x2b, 0x8a, 0xcd, 0xc4, 0xc0, 0x85, 0x50, 0x46, 0xe3, 0xe6, 0xe6,
+  0x66, 0x3b, 0xba, 0xa8, 0x65, 0xa1, 0x3b, 0x28, 0xf5, 0x94, 0x15, 0xb1,
+  0x03, 0x78, 0x66, 0xa7, 0xdb, 0x54, 0x26, 0x96, 0x9e, 0x7c, 0x20, 0xec,
+  0xe0, 0x26, 0xec, 0xdd, 0x55, 0xc6, 0xe2, 0x8f, 0xf0, 0xf1, 0x5d, 0xad,
+  0xd4, 0xbf, 0x82, 0xa3, 0xb7, 0xb9, 0xdc, 0xae, 0xb8, 0x84, 0x9b, 0x16,
+  0x9d, 0x74, 0x34, 0xf5, 0xc9, 0x6a, 0xe7, 0x1b, 0xc6, 0x84, 0x90, 0x44,
+  0x0e, 0x5e, 0x9f, 0xbe, 0x25, 0x28, 0x2b, 0xb3, 0x1b, 0x76, 0xf9, 0x33,
+  0x4c, 0x55, 0x9e, 0xb0, 0x31, 0xd6, 0xd5, 0x47, 0x31, 0xcd, 0x42, 0x5d,
+  0xf1, 0x68, 0x03, 0x76, 0x7a, 0x3e, 0xa5, 0x24, 0x07, 0x4c, 0x35, 0xbe,
+  0x39, 0x4d, 0x77, 0xc7, 0x86, 0x11, 0xbd, 0x0c, 0xfe, 0x89, 0xaa, 0xe9,
+  0x24, 0x52, 0x51, 0xd2, 0x90, 0x54, 0xe2, 0xd7, 0xa4, 0x4c, 0x39, 0x91,
+  0x7c, 0x50, 0x39, 0xe5, 0x53, 0x2d, 0x15, 0xc8, 0xa6, 0x1f, 0x8b, 0x53,
+  0x11, 0x7b, 0x91, 0xb8, 0x2b, 0x69, 0x29, 0x35, 0x6a, 0xbd, 0xf4, 0xb9,
+  0xb6, 0x0e, 0x97, 0x30, 0x37, 0xf5, 0xe0, 0x92, 0x12, 0x6d, 0x84, 0x5f,
+  0x92, 0xfc, 0x37, 0x28, 0xfa, 0x73, 0xd4, 0x36, 0xd4, 0xdf, 0xa1, 0x71,
+  0xe2, 0x4a, 0x58, 0xb8, 0xc8, 0x54, 0x93, 0x8b, 0x2d, 0x28, 0x32, 0xd3,
+  0x48, 0x6c, 0xe3, 0x9d, 0x78, 0x88, 0x7c, 0x00, 0x6c, 0xe7, 0x9e, 0x9b,
+  0x41, 0x3a, 0xbb, 0xab, 0x64, 0xb2, 0x3e, 0xb3, 0x14, 0x5f, 0x68, 0x11,
+  0x60, 0x08, 0xe8, 0xa4, 0x01, 0x5b, 0x08, 0x6f, 0xad, 0xe9, 0xa4, 0x09,
+  0x77, 0xff, 0x6d, 0x9b, 0xbf, 0xee, 0xcd, 0x91, 0x8f, 0x4a, 0x91, 0x35,
+  0xbd, 0x01, 0x69, 0xad, 0xf9, 0x1b, 0x46, 0x6e, 0x53, 0x4d, 0x0f, 0x94,
+  0xa5, 0xe9, 0xbc, 0x52, 0x83, 0x34, 0xea, 0x80, 0x13, 0x4d, 0x66, 0xe7,
+  0x68, 0x67, 0xad, 0xda, 0x0b, 0x37, 0x98, 0xf0, 0x70, 0x17, 0xfa, 0xed,
+  0xe0, 0x0d, 0xb8, 0x71, 0x32, 0x70, 0x72, 0x93, 0xdc, 0xa2, 0x88, 0x73,
+  0x96, 0x79, 0x44, 0x90, 0x7f, 0xe2, 0x92, 0xa7, 0xaf, 0x08, 0xef, 0x83,
+  0xde, 0x28, 0x1d, 0x28, 0x3c, 0x5a, 0xee, 0xfa, 0x57, 0xf3, 0xc9, 0x07,
+  0xe8, 0x8f, 0xab, 0xaf, 0x48, 0xc6, 0x6b, 0xae, 0x69, 0x21, 0xb0, 0xca,
+  0xfd, 0xca, 0x4a, 0x4a, 0x04, 0x7c, 0xfb, 0x14, 0x54, 0xa2, 0x6b, 0x94,
+  0x22, 0xde, 0x69, 0x42, 0x97, 0xb3, 0xcc, 0x5a, 0xd8, 0x85, 0x2b, 0x89,
+  0x63, 0xab, 0xf2, 0x05, 0x28, 0x95, 0xdb, 0x76, 0xb4, 0x1a, 0xb6, 0x80,
+  0x88, 0x6c, 0x81, 0x6a, 0xe5, 0x85, 0xdf, 0x5f, 0x09, 0x93, 0x1b, 0xba,
+  0x97, 0x70, 0xa5, 0xbf, 0x55, 0xab, 0x60, 0x5e, 0x62, 0xa0, 0x68, 0xa7,
+  0xe7, 0x10, 0xa1, 0xa1, 0x8d, 0x3e, 0xdc, 0x6d, 0x06, 0x61, 0x2a, 0x36,
+  0xc1, 0x45, 0xdc, 0xe5, 0xc0, 0x2d, 0x3a, 0x1d, 0xde, 0xef, 0x36, 0x67,
+  0xd9, 0x63, 0x81, 0x20, 0xc9, 0xee, 0xe9, 0x50, 0x84, 0xa5, 0x2e, 0x9e,
+  0x7c, 0x25, 0x55, 0x2e, 0xb9, 0x98, 0x5e, 0xf4, 0x69, 0x87, 0x2e, 0x7a,
+  0x27, 0x5c, 0x88, 0x11, 0x28, 0xe1, 0x62, 0xf4, 0xce, 0xbb, 0x82, 0xc8,
+  0x57, 0xe4, 0x25, 0x96, 0x38, 0x11, 0x72, 0xcb, 0x30, 0x04, 0x20, 0xb9,
+  0x22, 0x88, 0xee, 0x25, 0x59, 0x9f, 0x3d, 0x9e, 0x92, 0xe9, 0xeb, 0xd1,
+  0x59, 0x2f, 0x49, 0xb6, 0x10, 0x50, 0x21, 0xd5, 0x69, 0x39, 0xb8, 0x75,
+  0x18, 0xac, 0x45, 0xd4, 0xb8, 0x62, 0x1a, 0xa1, 0x7d, 0x01, 0x89, 0xa6,
+  0x8d, 0xf8, 0x4c, 0xe6, 0xd8, 0x36, 0x60, 0xd0, 0xed, 0xad, 0x2d, 0x49,
+  0x4b, 0x64, 0xb3, 0x82, 0xa6, 0xb4, 0x52, 0x2e, 0x23, 0xbd, 0x49, 0xe9,
+  0x95, 0xde, 0x90, 0xd1, 0x4c, 0x9c, 0xab, 0xd0, 0x26, 0xe7, 0x4c, 0x5e,
+  0xcd, 0x43, 0x5e, 0x00, 0xad, 0xa7, 0xec, 0x9e, 0x68, 0xeb, 0x64, 0xee,
+  0x11, 0xc4, 0x15, 0x05, 0x11, 0x95, 0x27, 0x60, 0xfd, 0xda, 0x96, 0xbd,
+  0x41, 0xf7, 0x52, 0x6d, 0xa3, 0xdc, 0x1e, 0x52, 0x94, 0x84, 0x29, 0x58,
+  0x51, 0xec, 0x25, 0xdd, 0x9a, 0x54, 0x6a, 0xb9, 0x83, 0x8c, 0x21, 0xe8,
+  0xb2, 0x30, 0x3c, 0x3a, 0xe9, 0x1c, 0x7e, 0xc9, 0x37, 0x95, 0xcb, 0x83,
+  0xae, 0xdb, 0xf1, 0x65, 0x54, 0x0b, 0x27, 0xc8, 0xe6, 0xf3, 0x00, 0xc6,
+  0x59, 0xed, 0xe3, 0xbe, 0x53, 0xa4, 0x7d, 0x2a, 0x65, 0xb3, 0xf0, 0x49,
+  0x20, 0x07, 0xf7, 0xf8, 0x2c, 0x7d, 0x31, 0xfa, 0xdd, 0x9a, 0x2f, 0x41,
+  0xda, 0x52, 0x7f, 0xb1, 0x91, 0xbd, 0x3f, 0x7b, 0x86, 0x56, 0x1b, 0xf3,
+  0x7b, 0xe7, 0xdc, 0x74, 0x20, 0xc8, 0x92, 0x0b, 0x41, 0xe6, 0x4d, 0x05,
+  0x5e, 0xf6, 0x58, 0xea, 0xce, 0x70, 0x13, 0x32, 0x4d, 0xd5, 0xa2, 0x0a,
+  0x1f, 0x8c, 0x5d, 0x4c, 0xcc, 0x17, 0xa1, 0x47, 0x87, 0xbe, 0xcb, 0xd4,
+  0x68, 0xb4, 0x18, 0xa0, 0xbd, 0x93, 0x9a, 0x31, 0x7e, 0x61, 0x0d, 0x1e,
+  0xd0, 0x5d, 0xe4, 0x01, 0xc5, 0xef, 0xa6, 0x80, 0x30, 0xee, 0x15, 0xf1,
+  0x1f, 0x1b, 0x10, 0xcc, 0x23, 0xe4, 0x61, 0xbf, 0xc9, 0x93, 0xba, 0x4c,
+  0x49, 0xfd, 0x4e, 0x50, 0x9a, 0x96, 0x7b, 0xf8, 0xed, 0xe9, 0xdb, 0x18,
+  0x7c, 0xa0, 0x06, 0xf8, 0xcc, 0x2e, 0x7c, 0x54, 0x39, 0xb8, 0x21, 0xa0,
+  0x36, 0xb4, 0xbc, 0xea, 0xb4, 0x3c, 0xd9, 0x60, 0x5b, 0x8c, 0xb7, 0xea,
+  0xa5, 0x54, 0xfa, 0x14, 0xc5, 0x14, 0x15, 0x53, 0xa3, 0x3a, 0x7e, 0xc6,
+  0x0b, 0x16, 0x05, 0x55, 0xc9, 0x3c, 0x67, 0x41, 0x35, 0x96, 0x54, 0x83,
+  0xcc, 0xf9, 0x16, 0xe5, 0x37, 0xea, 0xd7, 0x67, 0x2d, 0xb1, 0x9c, 0xaa,
+  0x4d, 0xc6, 0x52, 0x6a, 0x10, 0x52, 0x83, 0x8c, 0x2a, 0x9f, 0xe9, 0x43,
+  0x2e, 0x7b, 0xf4, 0x5e, 0x19, 0xb5, 0xce, 0x44, 0x26, 0x5e, 0x76, 0xfc,
+  0xfc, 0x6a, 0xd4, 0x2b, 0x48, 0x8e, 0x93, 0xfb, 0x05, 0xc7, 0xc9, 0x52,
+  0xb9, 0x31, 0x02, 0xa6, 0xbc, 0x5f, 0x70, 0x24, 0x09, 0xb4, 0xa9, 0x62,
+  0x13, 0x7c, 0x67, 0x97, 0xfb, 0x38, 0xb3, 0x4a, 0xd3, 0x27, 0x16, 0xc3,
+  0x26, 0x2e, 0xf5, 0x62, 0x28, 0x62, 0xa3, 0x3e, 0x9d, 0xd0, 0xd3, 0x26,
+  0xf2, 0xe1, 0xbc, 0xd1, 0xfa, 0x3e, 0x9e, 0xb3, 0x5b, 0x5b, 0xfd, 0x3e,
+  0x81, 0x9b, 0x88, 0x37, 0x9a, 0xbe, 0xbd, 0x49, 0xb9, 0xf4, 0x96, 0x98,
+  0x24, 0x5c, 0x52, 0x25, 0xca, 0x9e, 0xc6, 0xac, 0x18, 0x18, 0x4b, 0xa7,
+  0x51, 0xe6, 0x04, 0x4a, 0xe9, 0x01, 0x27, 0x1f, 0x98, 0x05, 0xc5, 0x2b,
+  0xe1, 0x64, 0xb7, 0x86, 0x89, 0x8b, 0x10, 0xd7, 0x60, 0xb0, 0xaa, 0xaf,
+  0xe8, 0x4a, 0x71, 0xeb, 0x77, 0x1b, 0xac, 0xe2, 0x06, 0xef, 0xa5, 0xac,
+  0x5a, 0xff, 0x9d, 0x82, 0x2b, 0xbf, 0xaf, 0x76, 0x19, 0x3d, 0xf9, 0xba,
+  0x76, 0x19, 0x89, 0x81, 0x42, 0x41, 0xdf, 0x68, 0x17, 0x3c, 0xfd, 0xc8,
+  0x51, 0xca, 0x07, 0x1e, 0x37, 0x58, 0xe7, 0x83, 0x83, 0x5a, 0x2b, 0xf5,
+  0x46, 0x42, 0x4e, 0xa0, 0xc5, 0x4a, 0x8e, 0x9f, 0xc3, 0x1e, 0xa0, 0xb9,
+  0xfe, 0xb2, 0x9b, 0xfc, 0xe8, 0x92, 0x44, 0x40, 0xb2, 0x93, 0x63, 0x27,
+  0x41, 0x70, 0x1c, 0xf7, 0x40, 0x05, 0x9e, 0x42, 0x76, 0x0e, 0xbe, 0x9a,
+  0x79, 0x44, 0x1e, 0x0e, 0x55, 0xc6, 0x70, 0x32, 0x06, 0xfd, 0xbb, 0x0a,
+  0xd8, 0x09, 0xc4, 0x2d, 0x11, 0x26, 0xe4, 0x6a, 0x0e, 0x67, 0x04, 0xb9,
+  0x57, 0x5a, 0x55, 0xd9, 0x78, 0xca, 0x81, 0xda, 0x98, 0x30, 0x42, 0x12,
+  0x51, 0x3c, 0x38, 0x36, 0xf5, 0x72, 0xbd, 0x87, 0x6c, 0xec, 0x11, 0xa4,
+  0xa5, 0x3c, 0x01, 0x3e, 0x4e, 0x0e, 0x12, 0x24, 0xab, 0x54, 0x4c, 0x3b,
+  0xe2, 0xd6, 0xb9, 0xc9, 0xb1, 0x64, 0x8e, 0xa6, 0x27, 0xcb, 0x09, 0x76,
+  0x96, 0xed, 0xca, 0xc2, 0xc0, 0x85, 0x70, 0x27, 0x0c, 0xc7, 0x4e, 0xd6,
+  0x2d, 0x49, 0xf2, 0x2f, 0xe7, 0x7d, 0x4c, 0x09, 0xf9, 0x32, 0xd2, 0x5f,
+  0x27, 0xec, 0x9a, 0x4a, 0x7f, 0x41, 0xf8, 0x73, 0x3b, 0x94, 0x84, 0x3d,
+  0x6a, 0x26, 0xf5, 0xd0, 0xcc, 0xd2, 0xcb, 0xf7, 0x8e, 0xbb, 0xb7, 0x81,
+  0xd4, 0xad, 0xc1, 0x7b, 0xa9, 0x3c, 0x74, 0xbd, 0xd2, 0xc5, 0x9b, 0x4f,
+  0x28, 0xbe, 0xcd, 0xcb, 0x50, 0xe4, 0x04, 0x4f, 0x9e, 0xf1, 0x89, 0xf9,
+  0x78, 0x4b, 0xb0, 0x55, 0xdf, 0x2b, 0xb2, 0xcd, 0x78, 0x9c, 0x76, 0xd4,
+  0xba, 0x3a, 0xe0, 0x2c, 0x30, 0x41, 0x46, 0x60, 0x23, 0x24, 0xcb, 0xed,
+  0x28, 0xb7, 0x0a, 0x6c, 0x14, 0x82, 0xcb, 0x43, 0x2b, 0x8c, 0xd2, 0x0f,
+  0xd4, 0x6a, 0xa6, 0x17, 0xe7, 0x6f, 0x40, 0x41, 0x98, 0x0b, 0x48, 0x20,
+  0x89, 0x50, 0x49, 0xa4, 0xbc, 0x74, 0x19, 0x83, 0xad, 0xff, 0x6c, 0x61,
+  0xf6, 0xd1, 0x0c, 0x14, 0xdc, 0x6c, 0xd6, 0x16, 0x9f, 0xa3, 0x2b, 0x72,
+  0x2a, 0x3e, 0x50, 0x1a, 0x85, 0x94, 0x93, 0xb1, 0x2a, 0x21, 0xd0, 0xaa,
+  0x57, 0x72, 0x33, 0x1e, 0x4e, 0x37, 0x39, 0x22, 0x3b, 0xed, 0xc4, 0x4a,
+  0x2a, 0x29, 0x1c, 0x1a, 0xcf, 0x89, 0xea, 0x54, 0x51, 0xd3, 0x9c, 0xbb,
+  0x27, 0x3e, 0xe8, 0xd4, 0x12, 0xf4, 0x64, 0xa2, 0x02, 0x82, 0xee, 0xf3,
+  0x34, 0x02, 0x4a, 0x84, 0xe2, 0x65, 0x05, 0x07, 0x6a, 0xc5, 0xa5, 0x60,
+  0xe3, 0x9c, 0x85, 0x16, 0x09, 0xc7, 0xb8, 0x3d, 0xad, 0x08, 0xdc, 0x84,
+  0xeb, 0xb7, 0xba, 0x6f, 0x61, 0x6a, 0xe1, 0xaf, 0xfd, 0xa7, 0x5b, 0x2d,
+  0x99, 0x6b, 0xeb, 0xe6, 0xe6, 0xa6, 0x1b, 0x3d, 0x46, 0xbe, 0x09, 0x8b,
+  0xdd, 0xa0, 0xef, 0xe1, 0xaf, 0xf0, 0x48, 0x53, 0x08, 0x4d, 0x0d, 0x73,
+  0xa5, 0xc9, 0xc9, 0xad, 0xa1, 0xca, 0x03, 0x67, 0x45, 0x31, 0xbf, 0x10,
+  0xd0, 0xcc, 0x7a, 0x6b, 0x52, 0xbc, 0xa7, 0x5f, 0x5b, 0x72, 0x87, 0xb5,
+  0xde, 0x9e, 0xbc, 0x3f, 0x3d, 0x3b, 0xf9, 0xcb, 0x5f, 0x5b, 0x9c, 0xcb,
+  0xad, 0xdc, 0x23, 0x67, 0xfc, 0x46, 0xdf, 0x8b, 0xda, 0x9b, 0xc5, 0x9f,
+  0xce, 0x7d, 0x70, 0x54, 0x8b, 0x50, 0x90, 0x9a, 0x71, 0x4b, 0x71, 0xa5,
+  0x4d, 0x0a, 0xe9, 0x97, 0xb6, 0x0c, 0x8f, 0x6b, 0xab, 0x65, 0x3a, 0xa5,
+  0x4e, 0x27, 0x09, 0xf9, 0x09, 0xc7, 0xa7, 0xae, 0x54, 0x65, 0x48, 0x6e,
+  0xac, 0x8a, 0xd8, 0x28, 0xa2, 0x49, 0x89, 0xb5, 0xc0, 0xdf, 0xe4, 0xf0,
+  0xf8, 0xf9, 0x99, 0xa2, 0xc5, 0x54, 0x02, 0x91, 0x95, 0x3a, 0x75, 0x05,
+  0x05, 0xc8, 0x7d, 0x9c, 0x95, 0xa9, 0xc4, 0xe5, 0x08, 0x8b, 0xff, 0x91,
+  0xb7, 0x47, 0xe2, 0xf7, 0x2d, 0xb1, 0x27, 0x18, 0x7f, 0x7c, 0x68, 0xbf,
+  0xc6, 0x39, 0xf6, 0x08, 0x28, 0x8a, 0x70, 0x14, 0x44, 0x95, 0x0e, 0x49,
+  0xa9, 0x0a, 0xc7, 0x96, 0x4f, 0xa2, 0xd8, 0xb2, 0xf1, 0x14, 0x0b, 0xd0,
+  0xa0, 0x68, 0xea, 0x4c, 0xdf, 0x49, 0x6b, 0xfb, 0x9b, 0x9d, 0xee, 0xf6,
+  0x93, 0xa7, 0x58, 0xb0, 0x7e, 0x73, 0xfb, 0x49, 0x4b, 0x14, 0x71, 0x26,
+  0x2d, 0xb2, 0x16, 0xd8, 0x8a, 0x68, 0x51, 0x07, 0x9f, 0xc3, 0xa1, 0xaf,
+  0xb7, 0x34, 0x00, 0x59, 0xb9, 0x43, 0x63, 0x70, 0xab, 0x38, 0x03, 0xc3,
+  0xd4, 0x3e, 0xcb, 0x23, 0x28, 0x3d, 0x10, 0xd1, 0xca, 0x34, 0x5a, 0x2b,
+  0xdb, 0x63, 0x3e, 0x06, 0x18, 0x79, 0x8c, 0xf0, 0x89, 0xe2, 0xcb, 0xd0,
+  0x37, 0xf4, 0xf6, 0xe2, 0xf5, 0x9b, 0x85, 0x30, 0x18, 0x64, 0x3f, 0x0d,
+  0x5f, 0x18, 0xec, 0x90, 0x01, 0x41, 0xc1, 0xe1, 0xc8, 0x2f, 0x27, 0x62,
+  0x93, 0x7e, 0x93, 0xf7, 0x67, 0x45, 0x59, 0x0c, 0x43, 0x1d, 0x1c, 0x33,
+  0x26, 0x1f, 0x1f, 0x83, 0xb2, 0x70, 0x93, 0xf5, 0x34, 0x6c, 0xb3, 0x4b,
+  0x1e, 0xd8, 0x3c, 0x60, 0x50, 0x62, 0xe8, 0xd6, 0x2c, 0xcf, 0x2a, 0xaa,
+  0x4c, 0xa7, 0xb1, 0x13, 0x6d, 0x8c, 0x52, 0xc6, 0xc7, 0x33, 0x29, 0x73,
+  0xc1, 0xd6, 0x43, 0xec, 0xab, 0x3f, 0xa2, 0xdb, 0x3a, 0x99, 0x66, 0x05,
+  0xdd, 0x25, 0xe6, 0x9d, 0xb0, 0xab, 0xd6, 0x45, 0x2d, 0x13, 0x56, 0xb2,
+  0x46, 0xec, 0xe4, 0x33, 0x64, 0x85, 0xa8, 0x22, 0x88, 0x2b, 0xeb, 0x03,
+  0xc6, 0xbb, 0x20, 0xad, 0x69, 0x9e, 0xa7, 0xec, 0x3b, 0x47, 0xdd, 0x90,
+  0xc1, 0xa1, 0x87, 0xa7, 0x7f, 0x50, 0xcc, 0x38, 0xd8, 0x84, 0x50, 0x74,
+  0x24, 0x26, 0x27, 0x9b, 0xf4, 0x8b, 0xf9, 0x0c, 0xe1, 0x03, 0x70, 0x3c,
+  0xb7, 0x5c, 0x0e, 0xe3, 0x8a, 0xbd, 0xd8, 0xb2, 0x46, 0xb4, 0x90, 0x41,
+  0x42, 0x96, 0x24, 0x37, 0xa9, 0x0c, 0x4e, 0x2b, 0x15, 0x6e, 0xe2, 0x05,
+  0xb4, 0x35, 0x5e, 0xf1, 0xe0, 0x30, 0x22, 0xfb, 0x93, 0x46, 0xbc, 0x3e,
+  0xcf, 0x2f, 0x19, 0xff, 0xd0, 0xe7, 0x1e, 0x10, 0x2c, 0x78, 0x10, 0x49,
+  0xa9, 0x77, 0x11, 0x17, 0x66, 0xc2, 0x1d, 0xe2, 0x4e, 0x38, 0x22, 0x73,
+  0xe2, 0x8d, 0x92, 0x12, 0xf5, 0x05, 0xf4, 0x52, 0xd3, 0x7b, 0xe0, 0x93,
+  0x3b, 0xc5, 0x54, 0xab, 0x3c, 0x1b, 0x29, 0x8d, 0x4d, 0x11, 0x6d, 0xd8,
+  0xf6, 0xdd, 0x64, 0x8f, 0x7d, 0xad, 0x84, 0x93, 0x63, 0x62, 0x06, 0xbe,
+  0x61, 0x6a, 0xd0, 0x32, 0x3d, 0xc8, 0x1b, 0xd0, 0x97, 0x28, 0x42, 0x6e,
+  0xfa, 0xfe, 0xec, 0x74, 0x6e, 0x7a, 0xd1, 0xf1, 0x79, 0x9e, 0x21, 0xc6,
+  0xb4, 0x97, 0xab, 0x02, 0xf7, 0x7b, 0xda, 0x7d, 0xea, 0xb4, 0xe7, 0x23,
+  0x51, 0x89, 0x69, 0x33, 0xc6, 0xe4, 0xd0, 0x14, 0x09, 0xb0, 0xac, 0x6e,
+  0x47, 0x99, 0x0d, 0x1e, 0x75, 0x16, 0xb9, 0xac, 0xae, 0x52, 0x62, 0x98,
+  0x35, 0x14, 0x92, 0x1a, 0x79, 0x30, 0xee, 0x5d, 0xf0, 0xed, 0x66, 0x1f,
+  0x41, 0x74, 0xa9, 0xf4, 0x26, 0x42, 0x69, 0x97, 0xae, 0x6a, 0xfa, 0x14,
+  0x4f, 0xce, 0x8d, 0xa5, 0x43, 0x61, 0x42, 0x47, 0x1c, 0xb6, 0x68, 0x73,
+  0xfc, 0xdd, 0x95, 0x85, 0xb5, 0x9d, 0x4f, 0xd8, 0x3c, 0x1f, 0x59, 0x82,
+  0x0b, 0x11, 0x05, 0x1f, 0xfa, 0x7d, 0x28, 0x70, 0x05, 0x76, 0x3a, 0xbd,
+  0x0c, 0x64, 0xfd, 0x59, 0xf2, 0xac, 0x42, 0x11, 0x7b, 0x11, 0x95, 0xc8,
+  0x40, 0x89, 0x12, 0xde, 0xa9, 0x08, 0x52, 0xff, 0x47, 0x7e, 0xf7, 0x82,
+  0xa4, 0x73, 0x3c, 0x19, 0x27, 0x88, 0x67, 0x92, 0x24, 0x3b, 0xdd, 0xad,
+  0xbb, 0x50, 0x89, 0xd8, 0x3a, 0x29, 0x2f, 0xcb, 0xdb, 0x81, 0xc7, 0x91,
+  0x37, 0x22, 0xd8, 0xb2, 0x6b, 0x96, 0x05, 0x8b, 0x5b, 0x92, 0x0a, 0x28,
+  0xe2, 0xf2, 0x8c, 0xd1, 0x10, 0x10, 0x4f, 0x57, 0x2f, 0xb7, 0x4e, 0x87,
+  0x88, 0x56, 0x79, 0x51, 0x14, 0x87, 0x1a, 0xc5, 0x61, 0x47, 0x93, 0xc1,
+  0x55, 0x0b, 0x11, 0xad, 0x33, 0x8d, 0x4b, 0x24, 0xbe, 0xd2, 0xef, 0x53,
+  0x9d, 0x08, 0x52, 0x64, 0x08, 0x5c, 0xe8, 0xc9, 0xd7, 0x7b, 0x5b, 0x5d,
+  0x17, 0x57, 0x17, 0xaf, 0xec, 0x5d, 0xb9, 0x1a, 0xf1, 0x4d, 0xc6, 0x57,
+  0x59, 0xe4, 0x3f, 0xbc, 0x9b, 0x3c, 0xe2, 0x8e, 0x5a, 0xe3, 0x17, 0xef,
+  0xbf, 0xe9, 0xfe, 0xb8, 0x37, 0xec, 0x3c, 0xee, 0x6e, 0xff, 0xd7, 0xdf,
+  0xdf, 0xb4, 0x3e, 0x23, 0x6c, 0x55, 0xc8, 0x65, 0xa0, 0xec, 0x50, 0x48,
+  0x65, 0x5e, 0x75, 0x26, 0x73, 0xd5, 0x12, 0x9f, 0x4b, 0x65, 0x51, 0x06,
+  0xbe, 0x54, 0x8c, 0x42, 0xb1, 0x4a, 0x70, 0xba, 0x70, 0x80, 0xb6, 0x27,
+  0xdd, 0x15, 0xe3, 0x88, 0x03, 0xda, 0x71, 0xc8, 0x3a, 0x46, 0x0d, 0x39,
+  0x43, 0xf4, 0x86, 0x5c, 0x4b, 0xbe, 0x21, 0x2f, 0xa1, 0x43, 0xa7, 0x11,
+  0xd3, 0xc5, 0xd0, 0xfc, 0xe3, 0x3a, 0x1b, 0x1f, 0x6a, 0x86, 0x9a, 0xf6,
+  0xe6, 0x20, 0xbb, 0xde, 0xa4, 0xe1, 0x85, 0xcd, 0xf4, 0xe9, 0x5c, 0xac,
+  0xc8, 0x02, 0x59, 0x0d, 0xe1, 0x99, 0x36, 0x17, 0x44, 0x95, 0x32, 0xd8,
+  0x65, 0x48, 0x9d, 0xa7, 0xeb, 0x43, 0x42, 0xf5, 0xda, 0xea, 0xac, 0x62,
+  0x59, 0x90, 0xb2, 0x6e, 0x2d, 0x66, 0x39, 0x54, 0xf6, 0x48, 0x27, 0xb7,
+  0x94, 0x18, 0xd1, 0x75, 0x4b, 0xa4, 0x25, 0x72, 0xa2, 0x80, 0x0f, 0x01,
+  0x84, 0x14, 0x8d, 0xe3, 0xdd, 0xd9, 0xeb, 0x2e, 0x47, 0x93, 0x60, 0x69,
+  0x06, 0x4c, 0x28, 0x40, 0x34, 0x0e, 0x0a, 0x17, 0x21, 0xff, 0x1a, 0x5e,
+  0x3d, 0x73, 0x82, 0x1d, 0x0c, 0x41, 0x20, 0xa5, 0x29, 0x12, 0xb1, 0x1b,
+  0xff, 0x2e, 0xfa, 0x68, 0x35, 0x6c, 0x7f, 0xcb, 0xef, 0xa6, 0x37, 0x44,
+  0x68, 0x8d, 0x32, 0x0e, 0x13, 0xed, 0x2a, 0x8d, 0x68, 0x4c, 0x98, 0x92,
+  0x01, 0x7b, 0x92, 0xea, 0x0e, 0xa3, 0x06, 0x27, 0x12, 0xb9, 0x8b, 0x22,
+  0x6b, 0xba, 0xf3, 0x58, 0x28, 0x61, 0x15, 0xed, 0x60, 0x79, 0xf7, 0x25,
+  0x5a, 0x7e, 0x9e, 0x21, 0xd8, 0x9e, 0x7c, 0x21, 0xbe, 0x9f, 0x50, 0xf6,
+  0xd6, 0x03, 0x69, 0x97, 0xd5, 0x00, 0x1e, 0xeb, 0x86, 0x5a, 0x07, 0xb3,
+  0xcc, 0x27, 0xbb, 0x61, 0xfc, 0x49, 0x4f, 0x8e, 0xea, 0x30, 0x43, 0x99,
+  0xc1, 0x38, 0xb2, 0x4a, 0x0a, 0x65, 0xdb, 0x4b, 0x21, 0x0c, 0x8a, 0x8c,
+  0xfd, 0x69, 0xf8, 0x0e, 0x37, 0x74, 0xeb, 0x11, 0xd4, 0x92, 0xd6, 0x1f,
+  0x5a, 0x1a, 0x91, 0xa2, 0x52, 0x54, 0x6a, 0xb2, 0x76, 0x3e, 0x71, 0x59,
+  0xf1, 0x82, 0x2f, 0x73, 0x61, 0x0e, 0xd0, 0x28, 0xa6, 0xb7, 0x62, 0xdc,
+  0x71, 0xc2, 0xa3, 0x1d, 0x68, 0x90, 0x92, 0x94, 0x1e, 0xe4, 0xe4, 0x24,
+  0xa9, 0x83, 0x16, 0xe2, 0x8b, 0x60, 0x58, 0x1e, 0x55, 0x89, 0x26, 0x85,
+  0xb7, 0xcf, 0x6b, 0x04, 0x60, 0xcc, 0x27, 0x21, 0x9a, 0x84, 0x76, 0x1f,
+  0x36, 0xff, 0x9f, 0x40, 0xfc, 0x6d, 0x90, 0xfc, 0xff, 0xd5, 0x8d, 0xc9,
+  0xa0, 0x48, 0x5a, 0x38, 0xc0, 0xf7, 0x7f, 0xd8, 0xc6, 0x8a, 0xb5, 0x5a,
+  0x33, 0xbd, 0x98, 0x45, 0xa4, 0x17, 0x94, 0x33, 0x34, 0x0b, 0x36, 0x34,
+  0x8e, 0xa8, 0x88, 0x6d, 0x3c, 0x90, 0xff, 0xea, 0xe2, 0xcf, 0xbf, 0x6d,
+  0x77, 0xf6, 0x7e, 0x0d, 0x92, 0x35, 0x76, 0xf2, 0x87, 0xed, 0xf7, 0x7f,
+  0xd8, 0x69, 0x39, 0x20, 0x3a, 0x07, 0xc8, 0xed, 0x72, 0x41, 0x4b, 0xca,
+  0x0b, 0x56, 0x4b, 0x46, 0x1a, 0xa7, 0xd2, 0xc3, 0x46, 0xe3, 0x19, 0x70,
+  0xe6, 0x1c, 0x8c, 0x25, 0xaa, 0xeb, 0xba, 0x5a, 0x04, 0x5d, 0x73, 0xf4,
+  0x30, 0xfc, 0x97, 0xdf, 0x8b, 0x6a, 0x84, 0x2f, 0x86, 0xe0, 0x04, 0xed,
+  0x6f, 0xce, 0x87, 0xd2, 0x8a, 0x03, 0x84, 0x19, 0xc3, 0x54, 0xd2, 0x34,
+  0x89, 0x62, 0x59, 0x8a, 0xa4, 0xd7, 0x4b, 0x5c, 0x08, 0xcb, 0x57, 0x21,
+  0x6e, 0x18, 0x3b, 0x63, 0xf3, 0x92, 0xde, 0x42, 0x85, 0x05, 0x23, 0xe9,
+  0xf7, 0x34, 0xb2, 0x10, 0xbb, 0x4e, 0xb7, 0xcb, 0xac, 0x4d, 0x08, 0xf5,
+  0xb5, 0xb2, 0xf3, 0xc3, 0x7c, 0x86, 0x09, 0x5c, 0xd0, 0x46, 0x5e, 0x06,
+  0x52, 0xe0, 0x4f, 0x2d, 0xca, 0x0c, 0x0f, 0x29, 0x4a, 0xa0, 0x8a, 0x7e,
+  0x9e, 0xf6, 0x8a, 0xeb, 0xa0, 0xc0, 0x19, 0xc3, 0xa0, 0x69, 0xd2, 0x91,
+  0x86, 0x5b, 0x53, 0x39, 0x19, 0xe8, 0x20, 0x3a, 0x4f, 0x3f, 0x43, 0x0f,
+  0x71, 0xc3, 0xf3, 0xa7, 0x39, 0xd7, 0xaf, 0x10, 0xbe, 0x65, 0xd9, 0x85,
+  0xda, 0xa1, 0xa4, 0x67, 0xab, 0x21, 0x52, 0xa8, 0x67, 0x95, 0xa1, 0xef,
+  0x08, 0x04, 0xdc, 0xe1, 0xc7, 0x8b, 0xe6, 0x73, 0x0b, 0xa7, 0x84, 0x13,
+  0x11, 0xba, 0x2a, 0x5e, 0x18, 0xa2, 0xaf, 0xfa, 0xe5, 0xca, 0x64, 0xad,
+  0xb3, 0x86, 0xe9, 0x91, 0xca, 0x45, 0x07, 0xa0, 0xfe, 0x6e, 0x70, 0xac,
+  0xb2, 0xd7, 0x78, 0x03, 0xd3, 0x10, 0xd6, 0xa0, 0x97, 0x02, 0x8b, 0xaa,
+  0xa4, 0xe6, 0x06, 0x28, 0xda, 0x62, 0x90, 0x67, 0x65, 0xd8, 0x7e, 0x03,
+  0x02, 0x0e, 0xad, 0xd8, 0xe5, 0xb2, 0xdf, 0xb8, 0x44, 0x0d, 0xd7, 0xcf,
+  0x09, 0xdb, 0x14, 0x25, 0x04, 0x7c, 0xe9, 0x6b, 0xf0, 0x86, 0xbd, 0xd0,
+  0x66, 0x3f, 0xef, 0x1d, 0xf7, 0x21, 0x21, 0x59, 0x35, 0x37, 0x55, 0xe7,
+  0xe7, 0x5e, 0x40, 0x0b, 0xa9, 0x02, 0x24, 0x17, 0x69, 0x10, 0xda, 0x38,
+  0x9f, 0xcc, 0x35, 0xbd, 0x9f, 0x0c, 0x90, 0x51, 0x74, 0x8a, 0xe1, 0xec,
+  0xd3, 0x02, 0x72, 0x0d, 0x17, 0xb3, 0x78, 0xa8, 0x79, 0x99, 0xab, 0x2f,
+  0xa2, 0xf3, 0x40, 0x8b, 0xa0, 0xeb, 0xeb, 0x8c, 0xe7, 0x87, 0x88, 0x51,
+  0x1a, 0xe4, 0x2a, 0xb0, 0x00, 0x88, 0xed, 0xbd, 0x70, 0x99, 0x7b, 0x88,
+  0xb0, 0xdf, 0xa6, 0xd9, 0x25, 0x2e, 0x4d, 0xc7, 0xf4, 0x10, 0x69, 0x13,
+  0x0d, 0x76, 0x76, 0xa5, 0x36, 0xdd, 0xa6, 0xf5, 0xcb, 0x94, 0x8e, 0x45,
+  0x10, 0xd1, 0xeb, 0x37, 0x2a, 0x1d, 0xbd, 0xfb, 0xee, 0xd2, 0x5a, 0xea,
+  0x72, 0xb1, 0x3c, 0x23, 0xb6, 0x7e, 0xe7, 0x7e, 0x02, 0xd7, 0x6d, 0x7a,
+  0x75, 0x65, 0x9e, 0xba, 0xda, 0xf0, 0xf4, 0xbb, 0x9d, 0xa6, 0xb0, 0x3b,
+  0x77, 0x96, 0xed, 0xa6, 0x0f, 0x14, 0xd5, 0x6e, 0x0a, 0x0d, 0x69, 0x8a,
+  0x0a, 0x71, 0x91, 0xee, 0xcb, 0x6f, 0x7b, 0xd9, 0x4d, 0x64, 0x11, 0xc9,
+  0x33, 0xf8, 0xd1, 0x50, 0xa3, 0xcb, 0x27, 0x32, 0x05, 0x43, 0xa8, 0x44,
+  0x92, 0xc4, 0xf0, 0x67, 0xe8, 0x5e, 0x19, 0xb4, 0xbd, 0x22, 0x16, 0x0d,
+  0x0c, 0x6f, 0xb2, 0xe0, 0xd5, 0xaf, 0xe5, 0x88, 0x84, 0xaa, 0x57, 0xf2,
+  0x40, 0xe8, 0x56, 0xd5, 0x10, 0x4a, 0x4f, 0x19, 0x09, 0xa9, 0x90, 0x6c,
+  0xa8, 0x02, 0xae, 0xc7, 0x43, 0x15, 0xdf, 0x7e, 0x5c, 0x29, 0x6e, 0x3e,
+  0x4d, 0xe6, 0x40, 0xed, 0x23, 0xc7, 0xa5, 0xa5, 0xac, 0x5a, 0x30, 0x2f,
+  0xd0, 0x6d, 0x64, 0x3a, 0x4b, 0x52, 0x21, 0x02, 0x8a, 0x1f, 0x86, 0xbb,
+  0x18, 0x28, 0x66, 0xa6, 0x5d, 0x0b, 0x88, 0x95, 0xd8, 0x16, 0xca, 0x9f,
+  0xb2, 0xaa, 0x5c, 0x31, 0x13, 0x66, 0x49, 0x54, 0x6b, 0x3f, 0x85, 0x7a,
+  0x8d, 0x6e, 0x17, 0xbe, 0x58, 0xe8, 0xbd, 0xeb, 0xa3, 0x55, 0x8d, 0xa7,
+  0x40, 0xb5, 0x27, 0xab, 0xb9, 0xc2, 0xbe, 0xae, 0xc7, 0x65, 0xf8, 0x2d,
+  0xbd, 0x4f, 0x9c, 0xfc, 0x1f, 0x6d, 0x17, 0x35, 0x5a, 0xcf, 0xa6, 0x53,
+  0x20, 0x3b, 0xb6, 0x4c, 0x06, 0x4f, 0x17, 0xa1, 0x90, 0x5a, 0xa4, 0x69,
+  0xa9, 0xe6, 0x4e, 0xb3, 0xdd, 0x1a, 0xb0, 0xd1, 0x25, 0x65, 0x33, 0x83,
+  0x4e, 0x88, 0x49, 0xd7, 0x63, 0xac, 0xa7, 0x8a, 0xe9, 0x3f, 0xa7, 0xfa,
+  0xaa, 0x69, 0x1c, 0x8c, 0xf2, 0xcc, 0xb7, 0x37, 0x23, 0x18, 0xcd, 0xf1,
+  0xef, 0xf9, 0xd4, 0x1c, 0x51, 0x84, 0x93, 0x37, 0x51, 0x19, 0x2f, 0x0c,
+  0xa5, 0x96, 0xf4, 0xed, 0xe1, 0xe8, 0x29, 0xfb, 0x9a, 0x73, 0x91, 0x67,
+  0xa1, 0xec, 0xf4, 0x04, 0x9b, 0x72, 0xef, 0x53, 0xb5, 0x2d, 0x78, 0x6b,
+  0xa4, 0x50, 0x4f, 0x68, 0x70, 0x45, 0x97, 0x50, 0x76, 0x23, 0x31, 0xd8,
+  0x12, 0xc1, 0x87, 0xe1, 0xcc, 0xb9, 0x7a, 0x9e, 0x43, 0x03, 0xc3, 0x7c,
+  0x92, 0x97, 0x16, 0xe7, 0x8d, 0x60, 0xb4, 0x61, 0x69, 0xc2, 0x63, 0x42,
+  0x8b, 0x4b, 0xdc, 0xd2, 0x0c, 0x76, 0x10, 0x45, 0x97, 0x53, 0x12, 0x28,
+  0x75, 0x3c, 0x20, 0x28, 0x10, 0x59, 0x43, 0xd7, 0x20, 0xa3, 0xc7, 0x92,
+  0x38, 0x3c, 0x60, 0x90, 0xad, 0x1a, 0x84, 0x8f, 0x19, 0x90, 0xab, 0x39,
+  0x8b, 0x40, 0xc1, 0xb2, 0xe2, 0x77, 0xd2, 0x6e, 0x05, 0xcf, 0xcf, 0x2f,
+  0x3c, 0xd8, 0x4d, 0xa2, 0x05, 0x05, 0x48, 0x53, 0xf5, 0xfb, 0x10, 0xad,
+  0x24, 0x65, 0x12, 0x90, 0x4e, 0x1e, 0xc5, 0xa8, 0xe8, 0x6a, 0x20, 0x96,
+  0x04, 0x27, 0xf6, 0x57, 0xa1, 0x38, 0x37, 0xa1, 0xd4, 0x7c, 0xf1, 0xc2,
+  0x8c, 0xde, 0xcc, 0x14, 0x36, 0xe7, 0x61, 0x92, 0x63, 0x1d, 0x92, 0xc3,
+  0x1d, 0x87, 0xdb, 0x7a, 0xbd, 0xe3, 0xb2, 0xd9, 0x6e, 0xfc, 0x92, 0x51,
+  0xda, 0xf4, 0x3e, 0xaa, 0x9f, 0x7e, 0xf4, 0x84, 0x3f, 0xd1, 0xe3, 0x1f,
+  0xb2, 0xa3, 0x3e, 0x72, 0xec, 0xa2, 0x03, 0x4b, 0x8b, 0x76, 0xc1, 0xdf,
+  0x3d, 0xf6, 0x45, 0x3e, 0x1e, 0x83, 0x28, 0xe7, 0x31, 0x91, 0x16, 0xbf,
+  0x72, 0x21, 0x94, 0x4c, 0x96, 0xcd, 0xb4, 0x5e, 0x4b, 0xc3, 0xd1, 0x54,
+  0x03, 0xc5, 0x56, 0x37, 0x69, 0x89, 0x33, 0x04, 0x91, 0x43, 0x53, 0x9c,
+  0x05, 0x5c, 0x02, 0x24, 0xce, 0x79, 0x30, 0x01, 0x98, 0x63, 0xe0, 0x34,
+  0x22, 0xad, 0x48, 0xc5, 0x21, 0x3a, 0xcd, 0x62, 0x2c, 0x48, 0x73, 0x75,
+  0x93, 0x33, 0x98, 0x35, 0x55, 0x87, 0xc6, 0x13, 0x1c, 0xe8, 0xd3, 0xb0,
+  0x2d, 0x25, 0xd4, 0x88, 0x30, 0x1b, 0x84, 0x04, 0x3e, 0x1a, 0x98, 0x11,
+  0xc3, 0x5e, 0x50, 0xe5, 0x41, 0x01, 0x7d, 0x71, 0x01, 0x68, 0xb2, 0xfa,
+  0x3f, 0x3a, 0xe0, 0x25, 0x8d, 0x28, 0xf1, 0x8a, 0x19, 0xa5, 0x9d, 0xd2,
+  0x4c, 0x79, 0x82, 0x44, 0xe6, 0x38, 0x44, 0xaa, 0x45, 0x0b, 0xea, 0x83,
+  0x86, 0xec, 0x50, 0x65, 0x40, 0x1d, 0x02, 0x0f, 0xd8, 0x9d, 0x27, 0x32,
+  0xbe, 0xd2, 0x4d, 0x46, 0x2b, 0x1d, 0x21, 0x7d, 0x1c, 0x57, 0x1c, 0x72,
+  0xb6, 0xe8, 0xb7, 0x02, 0xba, 0xf7, 0xeb, 0x87, 0xf9, 0x8e, 0xa2, 0x12,
+  0x61, 0xdd, 0xe9, 0x09, 0x9f, 0x8c, 0x59, 0x5e, 0x7e, 0x10, 0x74, 0x52,
+  0xad, 0x3b, 0x28, 0xf3, 0x97, 0x22, 0x98, 0x66, 0x8b, 0x42, 0x6e, 0x38,
+  0x9f, 0xfe, 0x2f, 0x39, 0xa1, 0x81, 0xec, 0x1e, 0xa8, 0x50, 0x44, 0x23,
+  0xa9, 0xaf, 0x70, 0x68, 0xdd, 0x40, 0x3a, 0xff, 0xe3, 0xee, 0x13, 0xbc,
+  0x14, 0xfd, 0x7e, 0xe9, 0x09, 0x86, 0x03, 0xfc, 0xb4, 0x76, 0x7f, 0xd7,
+  0x92, 0x38, 0xfc, 0xd1, 0x5d, 0x3c, 0x9b, 0x78, 0x9e, 0x1d, 0x62, 0x19,
+  0x17, 0xcd, 0x29, 0x3f, 0xf0, 0x5d, 0x3c, 0x28, 0xc2, 0xe9, 0x71, 0xe7,
+  0x93, 0x1d, 0xa8, 0xa1, 0x91, 0x76, 0x03, 0x3c, 0x07, 0x7a, 0xd2, 0x67,
+  0x58, 0xcb, 0xdc, 0x43, 0x65, 0x85, 0xc2, 0x32, 0x81, 0x4e, 0xb9, 0x9b,
+  0x66, 0xec, 0x15, 0x86, 0x72, 0xe2, 0x90, 0x19, 0xe8, 0x00, 0x58, 0x7d,
+  0xf2, 0x64, 0x6f, 0x6f, 0x77, 0x4f, 0x03, 0x43, 0x08, 0xc5, 0xae, 0xac,
+  0x1c, 0xfa, 0x08, 0x09, 0x4c, 0xff, 0x9e, 0x4a, 0xbd, 0x31, 0x4b, 0x7c,
+  0x40, 0x00, 0xa7, 0x65, 0x64, 0x84, 0xfd, 0x60, 0x44, 0xf5, 0x12, 0x22,
+  0x5a, 0x5a, 0xf9, 0xd9, 0xd3, 0xca, 0x93, 0xd5, 0x69, 0xa5, 0x43, 0x46,
+  0xdf, 0x26, 0x82, 0xa1, 0x6f, 0xbe, 0x3c, 0xd5, 0x04, 0x01, 0xc2, 0xc9,
+  0x0f, 0x5e, 0x7a, 0xf0, 0x8c, 0x4a, 0x91, 0x67, 0x15, 0xbb, 0x48, 0x0c,
+  0x85, 0x0c, 0x9f, 0x19, 0xe0, 0x59, 0xd9, 0x1c, 0x15, 0x8a, 0x2e, 0xfc,
+  0x31, 0x44, 0x73, 0xc0, 0xef, 0x9c, 0xea, 0x1e, 0x05, 0xc5, 0xb3, 0x9a,
+  0xe0, 0x09, 0x92, 0xb1, 0xc7, 0x38, 0x56, 0x94, 0x74, 0x79, 0xf6, 0x1f,
+  0x7b, 0x38, 0xd1, 0xe4, 0xef, 0xf3, 0x6c, 0x0e, 0x9f, 0xb7, 0x54, 0x63,
+  0x1f, 0xdd, 0xb6, 0x6a, 0x71, 0x2e, 0xa1, 0x2e, 0x89, 0x3b, 0x0a, 0x9a,
+  0x5c, 0x6f, 0x17, 0x12, 0xa9, 0x44, 0x58, 0xc5, 0x16, 0xb4, 0x0e, 0x76,
+  0x8c, 0x85, 0x39, 0xeb, 0x8d, 0x83, 0x38, 0xb6, 0x94, 0x26, 0x4e, 0x26,
+  0x34, 0xe2, 0xb8, 0x38, 0x71, 0x2f, 0xa3, 0x2d, 0x46, 0xf6, 0x35, 0x9d,
+  0x30, 0x9a, 0xd3, 0x56, 0x92, 0xac, 0x1b, 0x80, 0xdf, 0x86, 0x9e, 0x37,
+  0x35, 0x9d, 0x26, 0x76, 0xe4, 0xc2, 0x99, 0x73, 0x89, 0x85, 0xff, 0xfe,
+  0x83, 0xc7, 0xa4, 0xf8, 0xe5, 0xc2, 0x17, 0x16, 0xfb, 0xda, 0x5b, 0x76,
+  0xfe, 0x98, 0x77, 0xdf, 0x7f, 0x0a, 0xd5, 0xdc, 0xff, 0xc9, 0x1c, 0x1b,
+  0xf6, 0xee, 0xd9, 0xf4, 0x6a, 0x96, 0x96, 0x99, 0x41, 0xb2, 0x9f, 0xbf,
+  0x4a, 0x28, 0x10, 0xf1, 0x14, 0xbe, 0xe4, 0xaf, 0x82, 0xb1, 0x52, 0x4a,
+  0xd1, 0xc3, 0x3d, 0xaf, 0x60, 0x6a, 0x43, 0x02, 0xcc, 0x79, 0x85, 0x7a,
+  0x3a, 0xb9, 0x8e, 0x5d, 0x31, 0x06, 0x6a, 0xbd, 0xa9, 0xe4, 0xf8, 0xef,
+  0xd4, 0x4a, 0xa9, 0x5d, 0x46, 0x1f, 0xa0, 0x08, 0xf0, 0xdb, 0x4f, 0x00,
+  0x39, 0xc3, 0xa7, 0x1b, 0x92, 0xf2, 0x31, 0x3f, 0xbe, 0x93, 0x96, 0x1d,
+  0x3d, 0xea, 0xcf, 0x0b, 0x45, 0x22, 0x41, 0x2d, 0x0c, 0x3a, 0x83, 0xc3,
+  0x37, 0xa1, 0x0a, 0xa1, 0x40, 0x39, 0x9b, 0xdd, 0xee, 0x26, 0x99, 0xd8,
+  0x37, 0xf1, 0x5f, 0xc5, 0x71, 0x61, 0x43, 0x04, 0xd9, 0x71, 0xb1, 0xb5,
+  0xae, 0x06, 0x1f, 0x62, 0x56, 0xd8, 0x48, 0x4a, 0xd1, 0x97, 0x7f, 0x9f,
+  0xa7, 0x25, 0xa1, 0x96, 0xa2, 0xea, 0x93, 0x21, 0xd5, 0x73, 0x8e, 0x40,
+  0xec, 0x8d, 0xd4, 0xfc, 0xb0, 0xd2, 0x95, 0x5f, 0x12, 0xcf, 0x69, 0x8c,
+  0x6b, 0x5f, 0x49, 0x69, 0x72, 0xaa, 0xea, 0x85, 0xe2, 0x85, 0x16, 0x19,
+  0x67, 0xfe, 0x74, 0x95, 0x56, 0x4d, 0x71, 0xb6, 0x61, 0xb2, 0x4b, 0x1c,
+  0xdb, 0xcb, 0xc5, 0x17, 0x96, 0x5f, 0xa2, 0x1a, 0x43, 0x24, 0xc4, 0x68,
+  0x83, 0xf7, 0x6d, 0x9c, 0x75, 0xdc, 0x64, 0x37, 0x84, 0x65, 0x85, 0xff,
+  0xcf, 0xaa, 0xfe, 0x26, 0xf9, 0xc7, 0x07, 0x4d, 0xa5, 0xb0, 0x28, 0x97,
+  0xb9, 0x63, 0x0c, 0x54, 0x26, 0x94, 0x03, 0xff, 0x1a, 0x4c, 0xe7, 0x3d,
+  0xdc, 0xdd, 0x67, 0x57, 0xb4, 0xc4, 0xdf, 0xfb, 0x98, 0xda, 0x77, 0x52,
+  0x9b, 0x36, 0xf0, 0x04, 0x09, 0x36, 0x49, 0x8c, 0x7a, 0xd6, 0x11, 0x0b,
+  0x93, 0xde, 0xdc, 0xc0, 0x05, 0x24, 0x58, 0x7f, 0x5f, 0x46, 0x63, 0x9a,
+  0xa1, 0x9d, 0xc0, 0xf0, 0xe1, 0x7a, 0x14, 0xb5, 0x48, 0xf0, 0x77, 0x14,
+  0xbd, 0x42, 0x6d, 0xd4, 0xe2, 0xfd, 0x42, 0xb6, 0x30, 0xf7, 0xa6, 0x60,
+  0x65, 0xb7, 0x48, 0x33, 0xa7, 0x47, 0x6f, 0x28, 0x3b, 0xeb, 0xf9, 0xd1,
+  0x99, 0x38, 0xa5, 0x29, 0x18, 0x90, 0x9c, 0x27, 0x41, 0x6c, 0xc6, 0x38,
+  0x9d, 0x27, 0x8f, 0x29, 0xa6, 0x86, 0x85, 0x80, 0xab, 0x74, 0x67, 0xef,
+  0x89, 0xfa, 0x4e, 0x88, 0x94, 0xa4, 0xaa, 0x37, 0x5d, 0x18, 0x6b, 0xfc,
+  0xfd, 0xe6, 0xe6, 0x9a, 0x20, 0xc2, 0x69, 0x10, 0x26, 0x7e, 0xf7, 0xed,
+  0x5a, 0x84, 0x41, 0xa5, 0x39, 0x00, 0x5a, 0x11, 0x00, 0xb3, 0x17, 0x70,
+  0x40, 0x94, 0x73, 0x10, 0x6e, 0x04, 0xb1, 0x12, 0x48, 0x04, 0x80, 0x14,
+  0x86, 0xd1, 0x18, 0xa5, 0x3e, 0xd6, 0x9f, 0xa1, 0xea, 0x07, 0x84, 0xfc,
+  0x42, 0x81, 0x01, 0xd8, 0x1c, 0x86, 0xa6, 0x69, 0x7d, 0x11, 0x4c, 0xa7,
+  0xb5, 0xe0, 0x1e, 0x9c, 0x3c, 0x5f, 0x73, 0x48, 0x61, 0x7d, 0xe3, 0xf4,
+  0x82, 0x2f, 0x85, 0x8b, 0xeb, 0x9a, 0x24, 0xcd, 0x9c, 0x30, 0x7f, 0x03,
+  0x8b, 0xd7, 0x14, 0x46, 0x0e, 0x4f, 0x63, 0x0b, 0x46, 0x6d, 0x75, 0x83,
+  0xcc, 0x44, 0x3e, 0xc7, 0x70, 0x64, 0x14, 0xf0, 0xc8, 0x83, 0x0b, 0x7b,
+  0xc4, 0x35, 0x06, 0x5a, 0x0e, 0x95, 0x01, 0x71, 0x2e, 0x04, 0x95, 0x81,
+  0xbe, 0x65, 0xae, 0xb5, 0x7d, 0x4b, 0x2e, 0xe7, 0x25, 0x77, 0x52, 0x0d,
+  0xfc, 0x46, 0xbf, 0x71, 0x11, 0xb4, 0x16, 0x93, 0x44, 0x9e, 0x33, 0x4c,
+  0x34, 0x8f, 0xcb, 0x1f, 0x59, 0xea, 0x56, 0xa5, 0x00, 0xcf, 0x48, 0x77,
+  0x14, 0x0a, 0x4b, 0x77, 0x32, 0x57, 0x9b, 0xe0, 0x0d, 0x0d, 0x4b, 0xaa,
+  0xc3, 0x01, 0x9a, 0xda, 0x44, 0x7a, 0x92, 0x6b, 0x74, 0x5f, 0x1d, 0x13,
+  0x30, 0x26, 0xdc, 0x55, 0x5c, 0xce, 0x97, 0x93, 0x39, 0x6c, 0x34, 0xe8,
+  0x88, 0xc5, 0x68, 0x08, 0x9f, 0xb5, 0x13, 0xa0, 0xb4, 0x01, 0x7d, 0x72,
+  0x8e, 0xd8, 0xfd, 0x93, 0x4c, 0xdd, 0x0f, 0x4c, 0x49, 0x4b, 0x9a, 0x6a,
+  0x4b, 0x3b, 0x5c, 0x8b, 0xf8, 0xbe, 0xa6, 0x4e, 0x68, 0x46, 0x44, 0x57,
+  0x08, 0x60, 0x47, 0x14, 0xc4, 0x38, 0xe1, 0x7a, 0xdd, 0x2b, 0x9c, 0x48,
+  0x74, 0x90, 0xbf, 0x5c, 0xb9, 0xf8, 0xa8, 0x1b, 0xf8, 0x6f, 0x15, 0x8f,
+  0x40, 0xed, 0x2d, 0x3b, 0x69, 0xfd, 0x6c, 0x7b, 0xfb, 0x69, 0x6f, 0x6f,
+  0xfb, 0xe9, 0x37, 0x5f, 0x0f, 0x1f, 0x3f, 0xde, 0xdb, 0x19, 0xf4, 0xd7,
+  0x3e, 0xa5, 0xde, 0x18, 0x5e, 0xff, 0xd0, 0x24, 0xb7, 0x16, 0x18, 0x1a,
+  0x57, 0x4a, 0x8c, 0x62, 0xab, 0xce, 0xa8, 0x2e, 0x77, 0xc5, 0x85, 0xb0,
+  0xbe, 0xde, 0xd9, 0xdd, 0xde, 0x7c, 0xd2, 0x7d, 0xdc, 0xdd, 0x51, 0x09,
+  0x88, 0xd1, 0x64, 0xb9, 0xd6, 0x40, 0x95, 0x30, 0x62, 0x81, 0x61, 0x3f,
+  0x68, 0xd4, 0x81, 0x54, 0x75, 0x74, 0x75, 0x1e, 0xd9, 0x8e, 0x18, 0x50,
+  0x19, 0xa8, 0xd4, 0xe3, 0x76, 0xc0, 0x74, 0x56, 0xd0, 0x2c, 0x44, 0xa0,
+  0x87, 0x8e, 0xd5, 0x67, 0xad, 0xe5, 0x1f, 0x08, 0x27, 0xab, 0x97, 0xff,
+  0x7d, 0x9e, 0x57, 0xa0, 0x64, 0x89, 0xb1, 0x3f, 0xeb, 0xe1, 0x33, 0xb3,
+  0xe2, 0xa6, 0x14, 0x38, 0xca, 0x42, 0x25, 0x69, 0xae, 0x3d, 0x1a, 0xc1,
+  0x1d, 0x6a, 0x80, 0x88, 0xaf, 0x76, 0x41, 0x25, 0x9a, 0x73, 0xe2, 0xa2,
+  0xf8, 0x48, 0x89, 0xc5, 0xa8, 0x27, 0x7d, 0xe4, 0x24, 0xaf, 0x40, 0x00,
+  0xbf, 0x46, 0xf7, 0x6a, 0x1a, 0x97, 0x90, 0xf2, 0xc9, 0x02, 0x02, 0xd7,
+  0x40, 0xe9, 0x09, 0x14, 0x87, 0x2d, 0x1f, 0x70, 0xd2, 0x28, 0x47, 0x0a,
+  0x46, 0x08, 0xd9, 0xcc, 0xd6, 0x23, 0x08, 0x6a, 0x0e, 0xee, 0x06, 0x79,
+  0x1a, 0xd6, 0x04, 0x0b, 0x78, 0x4b, 0xe8, 0xb9, 0x2c, 0x97, 0x04, 0xfb,
+  0x3a, 0x8c, 0xe7, 0xa6, 0x18, 0x7f, 0xd9, 0xc4, 0xcf, 0x00, 0x5e, 0x59,
+  0x76, 0xcd, 0x72, 0x83, 0xf7, 0xdc, 0xb1, 0xd2, 0xab, 0x83, 0xab, 0xee,
+  0x80, 0xd2, 0x80, 0x5c, 0x6b, 0xd5, 0x10, 0x59, 0x2e, 0xcb, 0xd9, 0x0e,
+  0x35, 0x39, 0x45, 0x62, 0xaa, 0x23, 0x5a, 0xeb, 0x93, 0x2b, 0x90, 0xe9,
+  0xee, 0x97, 0x20, 0xd3, 0x9d, 0xff, 0x8f, 0x4c, 0x1f, 0x8c, 0x4c, 0x77,
+  0x1e, 0x9a, 0x4c, 0x77, 0x56, 0x21, 0xd3, 0x9d, 0xdf, 0x4d, 0xa6, 0xdb,
+  0x2b, 0x93, 0xe9, 0x6e, 0x44, 0xa6, 0x3f, 0xe5, 0xc5, 0x88, 0xac, 0x78,
+  0x11, 0x99, 0x3e, 0x7e, 0x60, 0x32, 0xc5, 0x42, 0xc0, 0x11, 0x91, 0x1e,
+  0x04, 0x49, 0xca, 0xa0, 0x77, 0x03, 0x41, 0x18, 0x45, 0x04, 0x92, 0xf0,
+  0x34, 0xc1, 0x54, 0xbf, 0x1b, 0xd3, 0xc4, 0x97, 0x24, 0x8a, 0xdd, 0x87,
+  0x26, 0x8a, 0xdd, 0x55, 0x88, 0x62, 0xf7, 0x21, 0x79, 0xd7, 0xf6, 0x52,
+  0xa2, 0x98, 0x65, 0x92, 0xc4, 0xf4, 0x37, 0xb5, 0xdc, 0x40, 0xe3, 0xbf,
+  0x92, 0xa7, 0x7e, 0x1f, 0xa5, 0x92, 0x5f, 0xbf, 0x0f, 0x70, 0x51, 0x2c,
+  0x02, 0x9b, 0xf2, 0x70, 0x7e, 0x72, 0xf8, 0xa7, 0x73, 0x4d, 0x68, 0xb1,
+  0xf2, 0x1c, 0x22, 0x48, 0x72, 0x81, 0x04, 0xca, 0x5c, 0xe1, 0x92, 0x2e,
+  0x1a, 0xb2, 0x4a, 0x79, 0xc8, 0x96, 0x82, 0x40, 0xa0, 0x21, 0x7a, 0xca,
+  0xfb, 0xa8, 0x64, 0x0b, 0x9c, 0x38, 0x39, 0x9a, 0x23, 0x00, 0x61, 0xea,
+  0x9d, 0xfa, 0xf4, 0x89, 0x34, 0x5a, 0x04, 0x73, 0x92, 0x84, 0xa7, 0xd7,
+  0xab, 0xab, 0x19, 0x81, 0xb9, 0xf2, 0xe3, 0x1b, 0xe1, 0x75, 0x1d, 0x8a,
+  0x0c, 0xc3, 0x35, 0xd4, 0x4d, 0x5e, 0x11, 0x1a, 0x32, 0x2c, 0x48, 0xa2,
+  0xd9, 0x11, 0x66, 0xc6, 0xb1, 0x0f, 0x35, 0x82, 0xad, 0xa9, 0xf2, 0x97,
+  0x04, 0x72, 0xb8, 0x65, 0x64, 0x37, 0x4a, 0xfe, 0xd1, 0x5c, 0xa5, 0x1a,
+  0xcb, 0x95, 0x8e, 0xc8, 0x76, 0x45, 0x25, 0x76, 0xb9, 0x5d, 0x7d, 0xab,
+  0xe4, 0xe8, 0x8f, 0xb2, 0xe8, 0x7f, 0x28, 0x1f, 0x43, 0x13, 0xc4, 0x90,
+  0xf1, 0xf7, 0x14, 0xff, 0x10, 0xf9, 0x0f, 0x3f, 0xd8, 0xc3, 0xf6, 0x11,
+  0x73, 0x9d, 0xfe, 0xb8, 0xa2, 0xde, 0x88, 0x89, 0x4a, 0x95, 0x78, 0xb7,
+  0x55, 0x7d, 0xd9, 0x29, 0xc3, 0xd5, 0x57, 0x27, 0x8f, 0x80, 0x2b, 0x61,
+  0x16, 0x64, 0xb0, 0xdb, 0x85, 0x09, 0xb9, 0xb2, 0x53, 0xca, 0xec, 0xa1,
+  0x07, 0x6a, 0xeb, 0x71, 0xcd, 0xf9, 0xef, 0x8d, 0x7b, 0x74, 0xf0, 0x90,
+  0x6f, 0xb8, 0x88, 0x80, 0x60, 0x28, 0x43, 0x52, 0xe1, 0x45, 0xa4, 0x32,
+  0xec, 0xc1, 0xaa, 0x58, 0x96, 0xf3, 0x31, 0x5b, 0x15, 0x7b, 0x88, 0xa7,
+  0xff, 0xd4, 0x7c, 0x8f, 0xef, 0x14, 0x82, 0xce, 0xc2, 0xc5, 0x39, 0x05,
+  0x9c, 0x0b, 0x02, 0xf8, 0xec, 0xa3, 0xb8, 0x1b, 0xd9, 0x2a, 0xb4, 0xfa,
+  0x49, 0x43, 0x67, 0xaf, 0xb1, 0x0a, 0x41, 0x21, 0x5a, 0x22, 0x4e, 0x6c,
+  0x11, 0xb4, 0x4c, 0xab, 0x0b, 0xe7, 0x0a, 0x42, 0x06, 0x82, 0xb6, 0x25,
+  0xd4, 0x69, 0xe6, 0x8f, 0xa4, 0x59, 0xfc, 0x10, 0xea, 0xb5, 0xff, 0xc7,
+  0xe3, 0x2d, 0x22, 0x2b, 0x7d, 0x17, 0x63, 0x71, 0x46, 0x85, 0xb8, 0x38,
+  0xfe, 0x63, 0x37, 0x35, 0xd1, 0x5e, 0xce, 0x9b, 0x85, 0x45, 0x3f, 0xb8,
+  0x55, 0x48, 0x0f, 0xb4, 0x51, 0x09, 0x53, 0xb3, 0x45, 0x18, 0x7f, 0x4c,
+  0x24, 0x32, 0x07, 0xff, 0xb1, 0x8f, 0x3f, 0x41, 0x56, 0x0f, 0xe7, 0xae,
+  0xd3, 0xe1, 0x4e, 0x94, 0x9b, 0xfc, 0xa1, 0x5d, 0x83, 0x7a, 0x59, 0x88,
+  0x5a, 0x10, 0x77, 0xb8, 0x2b, 0x50, 0x11, 0x8c, 0xa7, 0x69, 0x29, 0xe5,
+  0x3d, 0x69, 0x40, 0xe1, 0xf3, 0xc4, 0x1a, 0x72, 0x91, 0xb2, 0x1e, 0x30,
+  0xbf, 0xbd, 0x50, 0x59, 0x37, 0x1d, 0xb5, 0xeb, 0xb6, 0x58, 0x5e, 0x6a,
+  0x6e, 0x11, 0x1a, 0xc4, 0x5a, 0xb9, 0x37, 0x65, 0xec, 0x61, 0xc7, 0x76,
+  0xd7, 0xfe, 0xb0, 0xe6, 0xb6, 0x1b, 0x0d, 0x52, 0xb3, 0x82, 0xea, 0x57,
+  0xaa, 0x3e, 0xdc, 0x9f, 0x65, 0x12, 0x50, 0x0f, 0x3c, 0x80, 0x5a, 0xc0,
+  0x50, 0x8c, 0x3e, 0xa6, 0xf0, 0x5e, 0x66, 0x56, 0xdd, 0xd5, 0x45, 0x8c,
+  0x73, 0x49, 0x22, 0x2a, 0x47, 0xd4, 0x25, 0xb0, 0xb5, 0x7a, 0x98, 0x82,
+  0xfa, 0x29, 0x53, 0xa9, 0x59, 0x84, 0xaf, 0x68, 0xee, 0x30, 0xe5, 0x76,
+  0x96, 0xd3, 0xb4, 0x8f, 0x05, 0x6c, 0xf3, 0x29, 0x16, 0x08, 0xf9, 0xae,
+  0xf8, 0xae, 0xb3, 0xe1, 0x30, 0x88, 0xc6, 0xc5, 0x75, 0x56, 0x0a, 0x24,
+  0x3a, 0x41, 0x12, 0xc3, 0x51, 0xbc, 0xe2, 0x68, 0x6f, 0x49, 0x14, 0xa5,
+  0xc4, 0x66, 0x0b, 0x11, 0x97, 0xfa, 0xa5, 0xda, 0xff, 0xcc, 0xe2, 0xc3,
+  0x35, 0x10, 0x2d, 0x23, 0x2f, 0xd2, 0x70, 0x44, 0x51, 0x8b, 0x68, 0x5d,
+  0x49, 0x30, 0x95, 0x2b, 0x29, 0x6f, 0xc7, 0xbd, 0x82, 0xf1, 0x8d, 0xab,
+  0xe2, 0x8b, 0xb9, 0x1d, 0x9b, 0xfc, 0x8e, 0x35, 0xa2, 0x5a, 0x9a, 0x28,
+  0xfc, 0x89, 0xa5, 0xba, 0x6b, 0x98, 0x44, 0xcb, 0xcf, 0xd4, 0x1f, 0xee,
+  0x8e, 0xf7, 0x71, 0x47, 0x83, 0x92, 0x76, 0x06, 0x12, 0x2f, 0xe4, 0xee,
+  0x58, 0x60, 0xad, 0xc9, 0x33, 0x63, 0xf1, 0x72, 0xa3, 0xbe, 0xe6, 0xa2,
+  0x40, 0x37, 0xc4, 0xcc, 0xec, 0x4b, 0x29, 0x28, 0xcb, 0x68, 0xb8, 0x6c,
+  0x70, 0x56, 0x4a, 0xe1, 0x45, 0xd1, 0xc7, 0x02, 0x5f, 0xcb, 0x90, 0x3d,
+  0x70, 0x92, 0x71, 0x36, 0x14, 0xc3, 0x27, 0x21, 0x46, 0xb7, 0xd9, 0xe3,
+  0x41, 0xf1, 0x5c, 0x01, 0xe9, 0x11, 0x71, 0x8a, 0x08, 0xc7, 0x11, 0xbf,
+  0x63, 0x0c, 0xc6, 0x90, 0x6b, 0xc7, 0x77, 0x80, 0xd5, 0x18, 0x4d, 0xd6,
+  0x60, 0x24, 0x6b, 0xed, 0x00, 0xc8, 0x39, 0xba, 0xd5, 0x4b, 0x4d, 0x43,
+  0xc5, 0xa9, 0x26, 0x59, 0xa2, 0xf5, 0xad, 0x95, 0x26, 0xb9, 0x00, 0x19,
+  0x0c, 0xf9, 0xc0, 0xfc, 0x2b, 0xf6, 0x21, 0xf6, 0xac, 0x96, 0x94, 0x3f,
+  0x62, 0x08, 0xe5, 0x29, 0xc6, 0x57, 0x1a, 0x44, 0x68, 0xf0, 0x20, 0x11,
+  0x13, 0x4e, 0x07, 0x83, 0x5c, 0x60, 0x7e, 0xb8, 0x28, 0x93, 0x5b, 0x01,
+  0xc6, 0x61, 0x42, 0x34, 0x5e, 0x6a, 0x01, 0x97, 0x60, 0xdd, 0x67, 0xb7,
+  0x9b, 0x83, 0x13, 0x2b, 0x0c, 0x84, 0xb2, 0x68, 0xc2, 0x48, 0x2d, 0x0b,
+  0x0b, 0x23, 0x34, 0x1f, 0x3d, 0xcf, 0x26, 0xb7, 0xb5, 0x11, 0xb4, 0x51,
+  0x00, 0x2d, 0xae, 0xc5, 0x96, 0xa7, 0xd5, 0x08, 0xc9, 0x4f, 0x55, 0x4a,
+  0xc8, 0x8d, 0x0d, 0x07, 0x5a, 0x50, 0x58, 0x28, 0x1b, 0x8c, 0xb6, 0xff,
+  0x9d, 0x9f, 0xa4, 0x88, 0xa1, 0x0b, 0x73, 0x5d, 0xa7, 0xca, 0x8e, 0x0e,
+  0x12, 0x92, 0x3b, 0x69, 0x9a, 0xe4, 0x06, 0xb2, 0x07, 0x12, 0x70, 0xca,
+  0x79, 0xef, 0x37, 0x54, 0x33, 0xb1, 0x6e, 0x4f, 0x4a, 0x50, 0x11, 0x34,
+  0x47, 0x91, 0x1a, 0x71, 0x7b, 0xe0, 0x09, 0x36, 0xdb, 0x03, 0xbb, 0x78,
+  0x04, 0x3f, 0x31, 0x50, 0x59, 0xef, 0x49, 0x26, 0x8c, 0x38, 0x47, 0xdd,
+  0xa3, 0x42, 0x6a, 0x64, 0xee, 0x7e, 0xa0, 0xe2, 0xa4, 0x33, 0x44, 0xf4,
+  0x13, 0x57, 0xbe, 0x3b, 0x28, 0x82, 0xb6, 0x16, 0xed, 0xc4, 0x59, 0xec,
+  0x2d, 0xa5, 0x1c, 0x5f, 0xfc, 0xca, 0x65, 0xd2, 0x21, 0x80, 0x2f, 0x10,
+  0x54, 0x9b, 0x4e, 0x56, 0xfb, 0x8f, 0xf8, 0x0f, 0x2f, 0x8e, 0xc2, 0x06,
+  0xd1, 0x27, 0x48, 0xaa, 0xf4, 0x44, 0xed, 0xd5, 0xef, 0xf0, 0x43, 0x7e,
+  0x97, 0x4f, 0xdf, 0xfd, 0xaf, 0xbe, 0x9b, 0x30, 0x83, 0xe5, 0xd4, 0x4a,
+  0xad, 0x60, 0xe3, 0x29, 0x0a, 0x7e, 0x1d, 0xcc, 0xfb, 0xa4, 0x83, 0x08,
+  0xc2, 0x88, 0x95, 0x97, 0x66, 0x11, 0xc1, 0x2e, 0x81, 0x7c, 0x5a, 0x49,
+  0xb1, 0xf9, 0x74, 0x88, 0x89, 0xf3, 0x08, 0x24, 0x7c, 0xcb, 0x68, 0xd9,
+  0xc2, 0x60, 0x25, 0xd9, 0xae, 0x48, 0x42, 0x0e, 0xf8, 0xb4, 0xa8, 0x18,
+  0x30, 0x5c, 0x63, 0x3a, 0x06, 0x58, 0x26, 0x74, 0x46, 0xba, 0xb8, 0x5f,
+  0x3c, 0xbd, 0x11, 0xa8, 0x51, 0x86, 0x39, 0x99, 0x4f, 0xc9, 0xd5, 0xa1,
+  0xe9, 0x89, 0xc4, 0x18, 0xdc, 0x25, 0x60, 0x74, 0xc4, 0x9d, 0x73, 0x42,
+  0x23, 0xa9, 0x66, 0x0c, 0x80, 0x53, 0x30, 0xac, 0x59, 0x43, 0x4d, 0xd3,
+  0x38, 0x99, 0xdb, 0x0a, 0xcc, 0xc6, 0x1e, 0x91, 0x36, 0x1d, 0x45, 0xb1,
+  0xeb, 0xa7, 0xaa, 0x09, 0x30, 0x8f, 0x35, 0x49, 0x26, 0xf8, 0x80, 0xd3,
+  0x92, 0x7c, 0xc9, 0x40, 0x53, 0x13, 0xb1, 0x84, 0x8b, 0x54, 0x26, 0xeb,
+  0x4c, 0x03, 0x4b, 0x38, 0x8d, 0x09, 0x2f, 0x71, 0x8c, 0xd9, 0x56, 0x90,
+  0x74, 0x8a, 0x7a, 0x9f, 0x8a, 0x46, 0xc6, 0x3e, 0x49, 0x26, 0xbc, 0xfb,
+  0xa2, 0x00, 0x7e, 0x47, 0x95, 0xa0, 0x05, 0x8a, 0x6a, 0x97, 0x40, 0xac,
+  0x2b, 0x4b, 0x43, 0x55, 0xc1, 0xe5, 0xd1, 0x42, 0x72, 0x22, 0x7c, 0x12,
+  0xb0, 0xae, 0x1c, 0xd5, 0xea, 0xa7, 0xe1, 0x32, 0x70, 0xda, 0x95, 0xed,
+  0xe1, 0x50, 0x1c, 0x20, 0x36, 0x5d, 0x14, 0x5c, 0x09, 0xf9, 0x9f, 0x4c,
+  0x3e, 0x65, 0xff, 0x2a, 0x0b, 0x25, 0xb9, 0x0e, 0x28, 0xcf, 0x69, 0x2e,
+  0xa4, 0xad, 0x58, 0x77, 0xf8, 0x89, 0xab, 0x1b, 0x13, 0x31, 0x1a, 0x29,
+  0x7f, 0x9b, 0x58, 0xc5, 0x55, 0x01, 0xac, 0x80, 0x5e, 0x8e, 0xde, 0xbf,
+  0x7b, 0x7b, 0xfe, 0xee, 0xf4, 0xf4, 0xe4, 0xec, 0xe2, 0xe8, 0x39, 0xa2,
+  0x11, 0x5c, 0x9c, 0x1c, 0x9e, 0xbc, 0x6e, 0x22, 0x96, 0x80, 0x35, 0x47,
+  0xa5, 0x6e, 0x23, 0x6e, 0x1b, 0x6b, 0x34, 0xc9, 0x3a, 0xae, 0xe3, 0x86,
+  0x0f, 0xc3, 0xb4, 0xa8, 0x2c, 0xef, 0xc3, 0x6b, 0xab, 0xd9, 0xe9, 0x72,
+  0xce, 0xb0, 0x03, 0x6e, 0xcc, 0x9c, 0xa7, 0xad, 0x89, 0x2f, 0x75, 0xf0,
+  0x08, 0x0a, 0x2b, 0xe3, 0xc4, 0x48, 0x3a, 0x17, 0x52, 0x89, 0x21, 0x88,
+  0xdc, 0x7e, 0xe5, 0xbf, 0x58, 0x95, 0xbc, 0xb8, 0x1b, 0x66, 0x4c, 0xc3,
+  0x20, 0x61, 0xdf, 0x41, 0x3d, 0x11, 0xdd, 0x10, 0x25, 0xd5, 0xa8, 0x86,
+  0xa9, 0x6b, 0x89, 0x00, 0x41, 0xf2, 0x43, 0x2c, 0x3e, 0x88, 0xf4, 0x50,
+  0x4c, 0x7c, 0x91, 0x41, 0x27, 0x3b, 0x0c, 0xb2, 0x49, 0xce, 0xd7, 0x77,
+  0xcc, 0x53, 0x49, 0x22, 0xc0, 0x4d, 0x95, 0xfc, 0x88, 0x41, 0x46, 0x95,
+  0x53, 0xa3, 0xbd, 0x92, 0x78, 0x46, 0x7d, 0x85, 0x16, 0xfc, 0x4a, 0xab,
+  0xe5, 0x85, 0x61, 0x60, 0x53, 0xa8, 0x89, 0x64, 0x25, 0x03, 0xc9, 0xc4,
+  0x4b, 0xd7, 0x96, 0x21, 0x12, 0xcf, 0x26, 0x9d, 0x1c, 0x97, 0x80, 0x2d,
+  0x03, 0x6e, 0xd4, 0x2e, 0x5f, 0x29, 0x5a, 0x09, 0xbb, 0x36, 0x84, 0xff,
+  0x8b, 0x42, 0xb3, 0xb8, 0xd2, 0x0e, 0x16, 0x88, 0x9a, 0xa1, 0xfe, 0x44,
+  0xd9, 0xe3, 0xd2, 0x1f, 0xd4, 0x67, 0x9b, 0x2a, 0x0d, 0xe0, 0x10, 0x5e,
+  0xe0, 0x08, 0xa2, 0x85, 0x13, 0x73, 0x99, 0x43, 0xaf, 0x78, 0xb2, 0xd7,
+  0xdd, 0xd9, 0x88, 0x52, 0x7b, 0x30, 0x06, 0x1b, 0xd6, 0xe1, 0x8f, 0xf8,
+  0xaf, 0xde, 0x40, 0xf8, 0xbb, 0xdb, 0x15, 0x8d, 0x29, 0x71, 0x45, 0x22,
+  0x25, 0x1b, 0x40, 0xea, 0x95, 0x26, 0x97, 0x45, 0x21, 0x42, 0xb1, 0x96,
+  0x51, 0x8b, 0x09, 0x98, 0xa7, 0xfe, 0xc5, 0x62, 0xdc, 0x7d, 0x27, 0xdf,
+  0xd5, 0xd6, 0x76, 0x35, 0x26, 0xa8, 0x44, 0xfb, 0xb1, 0x6d, 0x4a, 0xe2,
+  0xaa, 0x46, 0x25, 0xe7, 0x90, 0x5e, 0x34, 0xbd, 0x78, 0x5d, 0x5e, 0xef,
+  0xa8, 0x05, 0xab, 0x4b, 0x64, 0x76, 0x61, 0x01, 0x15, 0x91, 0xe7, 0x8a,
+  0xda, 0xf5, 0x18, 0xde, 0x2b, 0x66, 0x4a, 0x36, 0x62, 0x86, 0x48, 0x2a,
+  0xc6, 0xdb, 0xc4, 0xdb, 0x0b, 0x7a, 0x21, 0xaa, 0x54, 0x1b, 0xd5, 0x3b,
+  0x45, 0x40, 0x58, 0x62, 0x97, 0xf1, 0x36, 0x19, 0x62, 0xc0, 0x35, 0xab,
+  0x8c, 0x99, 0x65, 0x4c, 0xd4, 0x5e, 0x62, 0x9a, 0x61, 0x25, 0xc9, 0xef,
+  0x16, 0x56, 0xae, 0x51, 0x24, 0x1d, 0x6c, 0x15, 0x81, 0x44, 0xe9, 0x74,
+  0x05, 0xf6, 0x3e, 0xb4, 0x1e, 0x75, 0xc0, 0x54, 0x50, 0x94, 0x12, 0xd4,
+  0x70, 0xcd, 0xc5, 0xb7, 0x2c, 0x18, 0x3b, 0x14, 0x69, 0x83, 0x29, 0xe5,
+  0xdd, 0x24, 0xeb, 0x82, 0x7c, 0x13, 0x86, 0x6a, 0x2f, 0x6c, 0xa2, 0x47,
+  0x7f, 0xb3, 0x2a, 0x36, 0xb9, 0xc3, 0x2e, 0xfe, 0xf3, 0x95, 0xb7, 0xde,
+  0xc9, 0xa6, 0xa8, 0x34, 0x22, 0x55, 0xd5, 0x2c, 0xdf, 0x53, 0x69, 0xc6,
+  0x2d, 0x3c, 0x6f, 0x89, 0xab, 0xe7, 0xb3, 0xe8, 0x8d, 0x65, 0xe8, 0x0f,
+  0x4e, 0xf1, 0xe0, 0x16, 0x69, 0x62, 0xe6, 0x4e, 0x3d, 0x9b, 0x97, 0x15,
+  0x89, 0x47, 0xe6, 0x57, 0xb5, 0x48, 0x5d, 0xf1, 0xbd, 0xc6, 0x20, 0x33,
+  0x5f, 0x3b, 0x9c, 0x85, 0x77, 0x13, 0x38, 0x74, 0xc5, 0xe5, 0x04, 0x54,
+  0xeb, 0x81, 0xe0, 0xed, 0x44, 0x17, 0xa4, 0x18, 0xa6, 0xdc, 0x81, 0xa5,
+  0x4b, 0x52, 0x90, 0x77, 0x58, 0x62, 0x92, 0xeb, 0x96, 0xb3, 0xd9, 0xf8,
+  0xaa, 0xb2, 0x32, 0x29, 0x5c, 0x95, 0x7d, 0xe0, 0x2e, 0x62, 0xbe, 0xa5,
+  0x25, 0xd9, 0x86, 0x63, 0x84, 0x84, 0xde, 0x22, 0x5b, 0xc6, 0xbf, 0xd1,
+  0x8e, 0xd6, 0x8c, 0x60, 0x14, 0xa2, 0x98, 0x9b, 0x61, 0x8c, 0x18, 0x3b,
+  0x51, 0xaa, 0xec, 0x7a, 0xc3, 0x2b, 0x83, 0xeb, 0x74, 0x03, 0x52, 0x51,
+  0x4e, 0xe7, 0xa6, 0xb1, 0xe2, 0x4f, 0x29, 0x45, 0xad, 0x0d, 0xa0, 0x28,
+  0x4e, 0x43, 0xc6, 0xe6, 0xad, 0x51, 0x02, 0x26, 0x6a, 0xc2, 0x24, 0x3a,
+  0xa0, 0xda, 0x3d, 0x9a, 0x32, 0xa4, 0x39, 0x29, 0x7c, 0x69, 0x49, 0x36,
+  0x0c, 0xc9, 0x3a, 0x8c, 0x8c, 0x11, 0x0c, 0xcf, 0xb2, 0x58, 0x41, 0x5f,
+  0x26, 0x85, 0x1a, 0x93, 0x62, 0xa8, 0xc8, 0x9e, 0x78, 0x37, 0xc4, 0x44,
+  0x81, 0xaf, 0x30, 0x21, 0x46, 0x89, 0x2f, 0xf0, 0x00, 0x41, 0x59, 0x29,
+  0x81, 0xd4, 0x0e, 0xb1, 0x1b, 0x15, 0x5b, 0x25, 0x15, 0x1c, 0xc6, 0xa2,
+  0x0b, 0xc5, 0xd0, 0xa8, 0xdc, 0x9e, 0x63, 0x2e, 0x52, 0x65, 0x2b, 0x92,
+  0xeb, 0x4b, 0x38, 0x6b, 0x73, 0x24, 0xed, 0x44, 0x2d, 0xd8, 0xb6, 0xdb,
+  0x94, 0x55, 0x82, 0x22, 0x73, 0x38, 0x66, 0xc2, 0x65, 0xf9, 0x0d, 0xef,
+  0xfb, 0xf8, 0xdf, 0xd1, 0x72, 0xba, 0xd4, 0x70, 0xea, 0xd3, 0x5e, 0x78,
+  0x78, 0xc4, 0xc1, 0x42, 0xd2, 0x80, 0x4f, 0x3c, 0x23, 0xab, 0x37, 0xe9,
+  0x20, 0x37, 0x68, 0x65, 0x4c, 0x55, 0x47, 0x75, 0x36, 0xd7, 0x46, 0x32,
+  0x6f, 0x4b, 0x45, 0x05, 0x4d, 0xd4, 0xad, 0xf3, 0xad, 0x75, 0x39, 0xbb,
+  0x1b, 0x2e, 0x41, 0x83, 0x02, 0xf7, 0x91, 0x3b, 0x31, 0xf0, 0x15, 0x2c,
+  0xf5, 0x1f, 0x43, 0x59, 0x32, 0x1f, 0x62, 0x24, 0x44, 0x1f, 0xaa, 0x52,
+  0x71, 0x46, 0x33, 0x61, 0xae, 0x91, 0xe4, 0x31, 0xc6, 0x22, 0x75, 0x29,
+  0x17, 0x87, 0xe6, 0xed, 0xed, 0xa0, 0x9a, 0xdd, 0x41, 0x6e, 0x20, 0x47,
+  0x45, 0x10, 0x8e, 0x6b, 0x97, 0xc3, 0x73, 0xca, 0xf4, 0xa0, 0x22, 0x67,
+  0x04, 0x4c, 0xa2, 0x34, 0xcf, 0xfd, 0x99, 0x1a, 0x19, 0x11, 0x8a, 0x37,
+  0xeb, 0xc3, 0xc5, 0x12, 0xd8, 0xba, 0xc1, 0xad, 0x52, 0x83, 0xb8, 0xe5,
+  0x86, 0x31, 0x63, 0x17, 0x21, 0x5a, 0x05, 0x68, 0x0f, 0x7d, 0x4a, 0x09,
+  0x9a, 0x11, 0x54, 0xbe, 0xc1, 0x57, 0x17, 0x8b, 0x77, 0x24, 0xe6, 0x4b,
+  0x24, 0xce, 0xde, 0x4e, 0xdc, 0x72, 0xa3, 0xd9, 0xac, 0x1c, 0x61, 0x4c,
+  0xdb, 0x20, 0x4e, 0xbd, 0xc4, 0x15, 0xc0, 0x6f, 0x24, 0x70, 0xb9, 0x6b,
+  0xda, 0xe0, 0x32, 0x50, 0x2d, 0x27, 0x01, 0x91, 0x08, 0xa4, 0xe2, 0xfd,
+  0xa7, 0xca, 0x41, 0x48, 0x62, 0xbc, 0xdd, 0xb1, 0xe9, 0x7c, 0x35, 0x13,
+  0x20, 0x5d, 0xa7, 0x11, 0x4e, 0x0d, 0x41, 0x92, 0x78, 0x91, 0x1e, 0x3e,
+  0x93, 0x62, 0x7a, 0xc2, 0xd9, 0xe6, 0x55, 0x81, 0x86, 0x6b, 0xa9, 0x5e,
+  0x37, 0xcd, 0xa9, 0xbc, 0x65, 0x4a, 0xe7, 0x25, 0x17, 0xd4, 0x9e, 0x05,
+  0x00, 0x28, 0xc3, 0xdc, 0x72, 0x39, 0xa3, 0xb8, 0x13, 0xf3, 0x89, 0xc6,
+  0x9f, 0x19, 0xca, 0x0c, 0xc7, 0x64, 0x7a, 0x89, 0x86, 0xce, 0x2e, 0xb3,
+  0x01, 0xbe, 0xe8, 0xe8, 0x9e, 0x0b, 0xd9, 0x55, 0x22, 0xaf, 0x6c, 0x5a,
+  0x6e, 0x39, 0x70, 0xa3, 0xc9, 0xa0, 0x03, 0x7c, 0x61, 0xba, 0xc2, 0xf2,
+  0x59, 0xa9, 0x40, 0xfd, 0x9b, 0x4e, 0x47, 0x80, 0xfc, 0x19, 0xa0, 0x17,
+  0x82, 0x17, 0xfa, 0x53, 0xfd, 0x0e, 0xed, 0x78, 0x55, 0xa3, 0x75, 0xae,
+  0xc1, 0xbc, 0xb8, 0xc7, 0x82, 0xb4, 0xc9, 0x57, 0xc2, 0x8f, 0xfc, 0x6e,
+  0x6d, 0x45, 0xc9, 0x33, 0x1c, 0x2f, 0x61, 0x58, 0x43, 0x5e, 0xc4, 0xc8,
+  0x61, 0xf8, 0x8e, 0x81, 0x30, 0x79, 0x20, 0x6c, 0xce, 0x9e, 0x08, 0x10,
+  0x9f, 0xef, 0x46, 0xea, 0x6d, 0x24, 0x9c, 0xe9, 0x29, 0x15, 0xcc, 0x44,
+  0x3f, 0xa1, 0x07, 0x6a, 0xc6, 0xca, 0x66, 0x68, 0xb5, 0x50, 0x39, 0x81,
+  0xdb, 0xc3, 0x31, 0xe4, 0x08, 0x64, 0x5b, 0xab, 0x3b, 0x56, 0x5b, 0x9f,
+  0xfb, 0x21, 0xad, 0x57, 0x46, 0xe6, 0x8a, 0x89, 0xf9, 0x5e, 0x1a, 0xe0,
+  0xfe, 0xbf, 0x24, 0x05, 0x34, 0x15, 0xa4, 0x6c, 0xa4, 0x81, 0x7e, 0xda,
+  0x61, 0x67, 0x6b, 0x53, 0x30, 0xac, 0x5e, 0xde, 0xe8, 0xd5, 0xbd, 0x05,
+  0x99, 0x6c, 0xbc, 0x06, 0x57, 0x34, 0xbb, 0x66, 0x93, 0xc3, 0x03, 0x01,
+  0xbe, 0xa5, 0xdd, 0x75, 0x31, 0x99, 0x62, 0x62, 0xa2, 0x30, 0x44, 0xd9,
+  0x27, 0x71, 0x4a, 0x39, 0x01, 0x79, 0x59, 0x81, 0xdf, 0x85, 0xf8, 0x48,
+  0xce, 0x99, 0xf3, 0xa2, 0x35, 0xf6, 0xbc, 0xd8, 0x9f, 0x7a, 0xef, 0xf9,
+  0xa6, 0xc0, 0xe4, 0x31, 0xcc, 0xc6, 0xe5, 0xb2, 0xef, 0xa4, 0x76, 0xa0,
+  0xdd, 0x6f, 0xc0, 0x15, 0xdb, 0xb1, 0x5b, 0x04, 0xdd, 0x75, 0x2f, 0x85,
+  0xfb, 0xbc, 0xcc, 0xd2, 0x19, 0x01, 0x76, 0xe2, 0x85, 0xab, 0xf6, 0x75,
+  0xab, 0x4a, 0x40, 0x73, 0xd7, 0xa9, 0xdb, 0x56, 0xff, 0x7d, 0x9e, 0x03,
+  0x1b, 0xcd, 0x18, 0x43, 0xae, 0x13, 0xd6, 0x94, 0x5d, 0x4d, 0x5a, 0xb6,
+  0x21, 0x9a, 0x05, 0x72, 0x6e, 0x76, 0xe6, 0x9c, 0x65, 0x96, 0xf5, 0x5a,
+  0x71, 0x52, 0xbe, 0x7b, 0x5f, 0xac, 0x99, 0x0c, 0x1c, 0xae, 0xb1, 0x91,
+  0x64, 0x00, 0x1f, 0xe7, 0x02, 0x8c, 0xdb, 0x4d, 0x1a, 0xc3, 0x33, 0xe2,
+  0xdd, 0x5d, 0x96, 0x36, 0xfa, 0xa9, 0xa5, 0xbd, 0x6a, 0xcd, 0xae, 0x42,
+  0xec, 0x61, 0x0c, 0xf7, 0xe5, 0x85, 0xd3, 0x22, 0x3d, 0xed, 0xee, 0x30,
+  0x2a, 0x51, 0xc8, 0x0d, 0x8d, 0xd6, 0xa4, 0xcd, 0x7f, 0x21, 0x01, 0xb4,
+  0xe5, 0x1b, 0x54, 0xc9, 0x0c, 0x99, 0x68, 0x30, 0x1f, 0x4f, 0xf1, 0x69,
+  0x12, 0x3f, 0x84, 0xfe, 0x17, 0xe0, 0x69, 0x75, 0x64, 0xd8, 0x4a, 0x84,
+  0x47, 0xb4, 0xa8, 0x75, 0xfb, 0x68, 0x63, 0xae, 0x62, 0x17, 0x62, 0xbf,
+  0xeb, 0x44, 0x4d, 0xa2, 0x58, 0x28, 0x46, 0x41, 0xc1, 0x5c, 0x12, 0xeb,
+  0x1d, 0x36, 0x00, 0xa8, 0xc7, 0xb5, 0x59, 0x32, 0x70, 0xa4, 0xfb, 0x64,
+  0xbd, 0xdc, 0x48, 0xa8, 0xce, 0xaf, 0x05, 0x22, 0x48, 0x2c, 0xb8, 0x14,
+  0x4c, 0xf5, 0x27, 0x27, 0x16, 0x31, 0x19, 0x28, 0x37, 0x14, 0x3c, 0xaf,
+  0x66, 0x58, 0x2d, 0x58, 0x95, 0x5b, 0x39, 0x3d, 0x2e, 0xe9, 0x3d, 0xc8,
+  0x6a, 0xc2, 0x7f, 0xb5, 0x40, 0x35, 0x07, 0x8b, 0xb0, 0xa6, 0x74, 0x9d,
+  0xa7, 0x4e, 0xcc, 0x59, 0xa4, 0x78, 0xa9, 0x67, 0x27, 0x6b, 0xc9, 0x98,
+  0xb1, 0x01, 0xde, 0x8d, 0x57, 0x27, 0xf4, 0xad, 0x44, 0xef, 0x52, 0x40,
+  0xfc, 0x56, 0xac, 0x6e, 0xc8, 0x16, 0xb9, 0x25, 0x42, 0xb6, 0x5f, 0x8d,
+  0x1a, 0xa9, 0xa3, 0xc3, 0x03, 0xae, 0xff, 0x56, 0x61, 0xa5, 0xab, 0x8f,
+  0x46, 0x99, 0x9f, 0xc8, 0x76, 0x5d, 0xab, 0x44, 0x83, 0x9e, 0x32, 0x3b,
+  0xee, 0xc3, 0x98, 0x26, 0xa3, 0x3c, 0xe6, 0x08, 0x6c, 0xd4, 0x37, 0x16,
+  0x01, 0x67, 0x10, 0x26, 0x42, 0x69, 0x6d, 0x46, 0x6c, 0xa5, 0x89, 0xab,
+  0x7c, 0xb5, 0x34, 0x30, 0x29, 0xa2, 0x67, 0x0f, 0x43, 0x81, 0xdb, 0xe8,
+  0x52, 0x1a, 0xf4, 0x26, 0x97, 0x30, 0x85, 0xb8, 0xce, 0xbc, 0x98, 0x9a,
+  0x6c, 0xab, 0x40, 0x61, 0x11, 0x4f, 0x99, 0x28, 0x09, 0x52, 0x7a, 0x94,
+  0xd5, 0x95, 0x64, 0xbd, 0xb5, 0xdf, 0x92, 0xc2, 0xc0, 0xeb, 0x64, 0x57,
+  0x49, 0x5a, 0xd8, 0xce, 0xf6, 0x3e, 0xfe, 0xdc, 0xa1, 0x9f, 0xbb, 0x2d,
+  0x2b, 0xbe, 0xeb, 0x0f, 0x07, 0x1f, 0x04, 0xd6, 0x65, 0x08, 0xb5, 0x0c,
+  0xce, 0x81, 0x99, 0x6c, 0x28, 0x21, 0x42, 0x12, 0x00, 0x6a, 0x78, 0x95,
+  0xc4, 0xb6, 0xf0, 0x45, 0x8b, 0x46, 0x27, 0x29, 0x22, 0xcc, 0x36, 0x9c,
+  0x2f, 0xaa, 0x55, 0xd7, 0xc3, 0xc0, 0x05, 0x9c, 0x0f, 0x56, 0x43, 0x22,
+  0x5b, 0x45, 0x19, 0xbc, 0x8d, 0xfd, 0xf7, 0xb3, 0x8c, 0x7c, 0xfd, 0xc9,
+  0xbc, 0xca, 0x47, 0x79, 0x75, 0xcb, 0xce, 0xa6, 0x51, 0xae, 0x48, 0x5e,
+  0x91, 0xd5, 0xc6, 0x2a, 0x24, 0xd5, 0xb6, 0x93, 0x74, 0x32, 0x36, 0xed,
+  0xca, 0x93, 0xa0, 0xc3, 0xdc, 0x30, 0x38, 0x6b, 0x9c, 0x5f, 0x3e, 0xa6,
+  0x7a, 0xde, 0x18, 0x0d, 0xdf, 0x89, 0x52, 0x0d, 0x05, 0x04, 0x53, 0xd0,
+  0xf4, 0x92, 0x80, 0x1f, 0x24, 0x4e, 0xd3, 0x94, 0xdd, 0x1d, 0x65, 0xc3,
+  0x2d, 0xc0, 0x67, 0x33, 0xd7, 0xea, 0x54, 0xf5, 0x2f, 0x84, 0xb1, 0x05,
+  0x18, 0x6a, 0x46, 0xe8, 0x82, 0x53, 0xb2, 0x90, 0xc4, 0x51, 0x46, 0x56,
+  0x19, 0xe7, 0xa7, 0xc8, 0x4b, 0xf1, 0x54, 0x78, 0x79, 0x2d, 0x91, 0xc9,
+  0xdb, 0x61, 0x55, 0x6b, 0x50, 0x23, 0x0b, 0xa0, 0x47, 0xff, 0x1d, 0x2c,
+  0x80, 0x3a, 0xda, 0xb4, 0x6a, 0x32, 0x42, 0x14, 0x9f, 0xcf, 0x07, 0xe2,
+  0xf5, 0x6c, 0x7b, 0x71, 0x4c, 0x3a, 0x13, 0xb0, 0x45, 0xcf, 0x07, 0xea,
+  0xa7, 0x9e, 0xae, 0x22, 0xfc, 0xf9, 0x37, 0x91, 0x03, 0x97, 0x5b, 0x82,
+  0xfb, 0xa3, 0x9c, 0x33, 0x51, 0xeb, 0x77, 0xd3, 0x32, 0x31, 0x5d, 0xcd,
+  0x81, 0xc9, 0xe2, 0x75, 0x55, 0xe3, 0x08, 0xe1, 0xbc, 0xe1, 0x95, 0x63,
+  0x45, 0xba, 0xb5, 0x86, 0x75, 0xad, 0x04, 0xa9, 0x19, 0x4f, 0x16, 0x0d,
+  0x72, 0x8c, 0x4b, 0x82, 0x9f, 0x83, 0xba, 0x34, 0xcb, 0x35, 0x11, 0x30,
+  0x76, 0x54, 0x29, 0x7a, 0x14, 0x2b, 0x0c, 0xba, 0x14, 0x98, 0x3d, 0x51,
+  0xd5, 0xaa, 0xd3, 0x86, 0xac, 0xc2, 0x25, 0xe1, 0x35, 0x6c, 0x73, 0x88,
+  0x24, 0x31, 0x5c, 0x7e, 0x5c, 0xd5, 0x70, 0x27, 0x19, 0xbb, 0xf4, 0x56,
+  0x0f, 0xbb, 0x95, 0x82, 0x12, 0xdd, 0x91, 0x03, 0x53, 0x2e, 0xcd, 0xef,
+  0xfc, 0xfd, 0x6e, 0x55, 0xed, 0x85, 0x36, 0x6e, 0x81, 0xf6, 0x3e, 0x47,
+  0xe8, 0x0f, 0x99, 0x8b, 0xa1, 0xf9, 0x4e, 0x75, 0x3b, 0xcd, 0x1a, 0x48,
+  0x8d, 0x3e, 0x4f, 0x9e, 0xe1, 0x4f, 0x5f, 0x5a, 0x18, 0x3f, 0x0c, 0x55,
+  0xec, 0x6c, 0xf2, 0x4d, 0x04, 0x17, 0x47, 0x0b, 0x2f, 0xc6, 0x8c, 0x02,
+  0xfd, 0xb4, 0x31, 0x77, 0xad, 0x9d, 0x1c, 0xbd, 0x7d, 0xd9, 0x4e, 0x4e,
+  0xcf, 0x4e, 0x7e, 0xa2, 0xd1, 0x9d, 0x6e, 0xef, 0x88, 0x0b, 0xcc, 0xac,
+  0xce, 0xd8, 0x6d, 0xd9, 0x94, 0x1b, 0xcc, 0xe3, 0x61, 0x95, 0xc0, 0xea,
+  0x2b, 0x91, 0x30, 0x6c, 0xa2, 0x30, 0x5d, 0x00, 0xb8, 0xe4, 0x52, 0x0a,
+  0x16, 0xba, 0xed, 0x86, 0x30, 0x0d, 0xb5, 0x87, 0x27, 0x9c, 0x3b, 0x0d,
+  0x7d, 0x3b, 0xcf, 0x91, 0xee, 0x00, 0x45, 0x92, 0x4d, 0x3f, 0xf4, 0xcb,
+  0xed, 0xed, 0xfd, 0xe4, 0xdd, 0xd9, 0xb1, 0xc4, 0xcc, 0xc2, 0xb0, 0x0d,
+  0x2a, 0x91, 0x46, 0x5f, 0x53, 0x46, 0x69, 0x70, 0xeb, 0x3c, 0x38, 0xca,
+  0x03, 0x9b, 0x98, 0xe5, 0x5e, 0x8c, 0xdf, 0x1b, 0xcd, 0x1a, 0x82, 0xd0,
+  0x25, 0x6f, 0x41, 0xb8, 0xcb, 0x17, 0x74, 0x84, 0xbb, 0xe4, 0x25, 0x7b,
+  0xff, 0xd3, 0xe2, 0x24, 0x3f, 0x9d, 0x59, 0x5a, 0x47, 0xc8, 0x0f, 0x56,
+  0x20, 0xdc, 0x4f, 0x67, 0x9a, 0xd8, 0x96, 0x27, 0x5b, 0x3e, 0xe3, 0xd1,
+  0x6c, 0xf3, 0xe9, 0x15, 0x06, 0x47, 0x3d, 0x73, 0x45, 0x24, 0x58, 0x53,
+  0x75, 0x92, 0x91, 0x3c, 0xb3, 0xa2, 0x68, 0xa4, 0x58, 0x64, 0x12, 0xb8,
+  0x41, 0x2f, 0x93, 0x49, 0x29, 0x2b, 0x55, 0x94, 0xb6, 0x48, 0x20, 0x4b,
+  0xff, 0xc3, 0xbd, 0x23, 0x48, 0xf0, 0x3a, 0xb5, 0xf3, 0x59, 0xc0, 0xec,
+  0x5a, 0x2d, 0x9b, 0x54, 0x32, 0x99, 0x6e, 0x77, 0x77, 0x92, 0xf5, 0xed,
+  0xee, 0x36, 0x70, 0xc3, 0x6d, 0xf4, 0xb9, 0x48, 0x2a, 0x3f, 0xd7, 0xbb,
+  0x90, 0x6e, 0xcd, 0xfe, 0x4b, 0x9d, 0x13, 0x03, 0xd6, 0x60, 0x68, 0xd8,
+  0xb4, 0x7c, 0xa0, 0x8f, 0x75, 0x41, 0x55, 0x4c, 0x07, 0x88, 0x37, 0x83,
+  0x11, 0x29, 0x6e, 0xc4, 0xe6, 0xd6, 0x77, 0x50, 0x65, 0x40, 0x16, 0xef,
+  0xce, 0x5e, 0x6b, 0x28, 0x99, 0x6e, 0x07, 0x59, 0xa7, 0xcb, 0x6c, 0x73,
+  0x50, 0xf4, 0xcb, 0x4d, 0x32, 0x20, 0x4a, 0xd3, 0x57, 0xd5, 0x78, 0xc4,
+  0x97, 0x7a, 0xc3, 0xb2, 0x27, 0x5f, 0xd4, 0xb5, 0xea, 0x3a, 0x3a, 0x3a,
+  0x7c, 0xfe, 0xea, 0xa8, 0x03, 0x3f, 0xcf, 0x0f, 0x3a, 0x07, 0x47, 0xe7,
+  0xdb, 0x3b, 0x4f, 0x3b, 0x2f, 0x0f, 0xdf, 0x74, 0xce, 0x5f, 0x1d, 0xec,
+  0xec, 0x3d, 0xd9, 0x67, 0xca, 0xe2, 0x67, 0xce, 0x9a, 0x9e, 0x78, 0x00,
+  0x62, 0xac, 0x46, 0xe5, 0xf6, 0xae, 0x8e, 0xa7, 0xed, 0xc8, 0xca, 0x11,
+  0x68, 0x9d, 0x38, 0x67, 0xa3, 0x50, 0xaa, 0xfd, 0x7b, 0x6f, 0x73, 0xca,
+  0x1c, 0x28, 0x23, 0xdd, 0x7d, 0x69, 0xe2, 0x14, 0x39, 0x72, 0xab, 0xb0,
+  0xe0, 0xa5, 0x66, 0xb0, 0xe4, 0xb0, 0x6e, 0xd6, 0x38, 0xcb, 0xae, 0x35,
+  0xcf, 0x21, 0x79, 0x4d, 0x41, 0x6f, 0xec, 0xa6, 0x08, 0x25, 0x20, 0x38,
+  0xef, 0x38, 0xa9, 0xcb, 0xcd, 0xf2, 0x98, 0x99, 0x35, 0x28, 0xfb, 0x68,
+  0x40, 0xe2, 0xe6, 0x0c, 0xda, 0x44, 0xcc, 0x8c, 0x06, 0x61, 0x41, 0xcd,
+  0xdc, 0x0d, 0x96, 0x9a, 0x05, 0x23, 0x87, 0x4c, 0x9b, 0x2e, 0x57, 0x0a,
+  0x1e, 0xb8, 0xc7, 0xce, 0xb1, 0xc0, 0xc2, 0xa4, 0x81, 0xbb, 0x04, 0x3e,
+  0xb3, 0x57, 0xff, 0x2e, 0x16, 0x26, 0x1d, 0xcd, 0xb2, 0xdf, 0x28, 0xdc,
+  0xe3, 0xf7, 0xe9, 0x7c, 0x61, 0xe6, 0xcb, 0x49, 0x82, 0x2d, 0x6d, 0x35,
+  0xcb, 0x2a, 0x17, 0x1e, 0x58, 0x30, 0x56, 0x7f, 0x8e, 0x65, 0x55, 0x61,
+  0xbb, 0x9b, 0x2c, 0xab, 0xda, 0x8d, 0x38, 0xff, 0x1b, 0x2c, 0xab, 0x0d,
+  0x06, 0x51, 0x69, 0x6e, 0xe5, 0x22, 0x7f, 0x2b, 0x1a, 0x44, 0x07, 0x51,
+  0xad, 0x85, 0xbb, 0xf6, 0x48, 0x06, 0xf0, 0xef, 0x36, 0x89, 0x36, 0xb9,
+  0x1f, 0x18, 0x6e, 0x30, 0x79, 0xc6, 0xff, 0x6e, 0xfe, 0xe0, 0x8e, 0xb5,
+  0x64, 0x86, 0x1d, 0xd1, 0x5a, 0xc8, 0x73, 0x70, 0x18, 0xb4, 0xe2, 0xb8,
+  0x5c, 0x18, 0x1a, 0xd0, 0x40, 0x3b, 0xab, 0x49, 0xe2, 0xbc, 0x39, 0xaa,
+  0xe2, 0xa5, 0xba, 0x9b, 0x0a, 0x93, 0x6c, 0xd9, 0x2f, 0x71, 0x72, 0x7f,
+  0xe6, 0x7a, 0xd2, 0xd2, 0x1b, 0x11, 0xb0, 0xba, 0x13, 0x78, 0x0b, 0x2b,
+  0x2b, 0xd7, 0xd1, 0x39, 0xd0, 0xd9, 0x14, 0x24, 0x61, 0x3d, 0x8e, 0x46,
+  0x68, 0xc8, 0x52, 0xf0, 0xdc, 0x2a, 0x3a, 0x32, 0xa1, 0x4a, 0x27, 0x87,
+  0x27, 0x6f, 0xdf, 0x1e, 0x1d, 0x5e, 0xd4, 0x33, 0xd6, 0xac, 0x48, 0x86,
+  0x2f, 0x9d, 0x20, 0xbd, 0x94, 0x62, 0x06, 0x0a, 0xe6, 0x24, 0x73, 0x58,
+  0x53, 0x00, 0x16, 0x69, 0x86, 0x13, 0x83, 0xf7, 0x4e, 0xfb, 0x15, 0x88,
+  0x6a, 0x4a, 0x98, 0x82, 0xf6, 0xf3, 0xc8, 0x28, 0x82, 0x5d, 0x70, 0xe5,
+  0x7c, 0x26, 0x15, 0xb9, 0x38, 0x0a, 0x5b, 0xba, 0xc2, 0x61, 0xa4, 0x83,
+  0xc1, 0xa6, 0x20, 0x69, 0x5b, 0xd3, 0xe6, 0xf8, 0x0d, 0x85, 0x51, 0x10,
+  0x85, 0x6c, 0x32, 0xe8, 0x14, 0xc3, 0x0e, 0xe5, 0x2f, 0x8c, 0xd3, 0xd9,
+  0x07, 0x4c, 0xb7, 0xf4, 0x75, 0x48, 0xb0, 0x6e, 0x17, 0x29, 0x2d, 0xd0,
+  0xa4, 0xa0, 0xe0, 0x70, 0xd2, 0x42, 0xaa, 0x65, 0x0e, 0xc5, 0x70, 0x2d,
+  0xbd, 0x33, 0x33, 0x9b, 0x54, 0xfb, 0xe6, 0xb2, 0xc3, 0x17, 0x27, 0xd9,
+  0x0d, 0xf6, 0xc0, 0x88, 0x1d, 0x7d, 0xac, 0x93, 0x8c, 0xd9, 0x0e, 0x30,
+  0xbf, 0x6a, 0x3e, 0x9b, 0x38, 0x20, 0x98, 0x5b, 0xe6, 0x92, 0x58, 0x80,
+  0x2f, 0xa1, 0x42, 0x6a, 0x25, 0x5e, 0xe5, 0x52, 0x65, 0x44, 0x97, 0xe0,
+  0x15, 0x6f, 0x75, 0x3d, 0x88, 0x27, 0x2e, 0x42, 0xa9, 0xf0, 0xf4, 0x4a,
+  0x78, 0xcc, 0x75, 0xe3, 0xdc, 0xc3, 0x00, 0x4a, 0x89, 0x41, 0x17, 0xa5,
+  0xbd, 0x23, 0xa9, 0x06, 0xb2, 0x1f, 0xe9, 0x72, 0x6b, 0x3c, 0xd9, 0x2b,
+  0x2a, 0x34, 0x45, 0x90, 0xe1, 0x62, 0x76, 0x49, 0x18, 0xea, 0xd8, 0xd3,
+  0x0f, 0xe1, 0x56, 0xa3, 0xa0, 0x7e, 0x0b, 0xd7, 0xaa, 0xcc, 0xd9, 0x06,
+  0xeb, 0x82, 0x2b, 0x29, 0xeb, 0x86, 0x73, 0xa4, 0x6d, 0xa4, 0x9d, 0x90,
+  0x53, 0x92, 0x4f, 0x10, 0x43, 0x92, 0x8c, 0x70, 0x62, 0x31, 0xf9, 0xa1,
+  0x93, 0x38, 0x07, 0xac, 0x3a, 0xdb, 0xd2, 0x81, 0xdb, 0x82, 0x92, 0x03,
+  0xcd, 0xcb, 0x0a, 0xce, 0x54, 0xa3, 0x0b, 0xc1, 0x3c, 0xdf, 0x2c, 0x51,
+  0x2f, 0xf0, 0x33, 0x4a, 0x20, 0x08, 0x04, 0xb4, 0x49, 0x41, 0xec, 0xf5,
+  0x0a, 0xa7, 0x76, 0xde, 0x6a, 0x2c, 0x21, 0x0e, 0x03, 0x8e, 0x15, 0x42,
+  0x8e, 0xc7, 0x5f, 0x44, 0xe1, 0xbe, 0x07, 0x66, 0xc0, 0x37, 0xdf, 0xfa,
+  0x4b, 0xe7, 0x05, 0xa6, 0xf6, 0x75, 0xde, 0xc2, 0xda, 0xee, 0x27, 0xff,
+  0x55, 0x20, 0x06, 0xf0, 0xc7, 0xc8, 0xdf, 0x7a, 0x07, 0xfb, 0xbb, 0xa3,
+  0x5d, 0x8c, 0x75, 0xe8, 0x1c, 0x5c, 0x12, 0xe5, 0xc2, 0xc1, 0x02, 0x5d,
+  0xba, 0x7c, 0xa8, 0xa6, 0x5f, 0xc1, 0xf1, 0xdd, 0x5f, 0x6c, 0xeb, 0x33,
+  0x0a, 0x2d, 0x49, 0xbb, 0x58, 0x40, 0x33, 0x62, 0xb6, 0x6f, 0xeb, 0x85,
+  0x48, 0x9b, 0x64, 0x14, 0x17, 0x0e, 0xc7, 0x9e, 0x5b, 0x06, 0xc3, 0x50,
+  0x79, 0x18, 0x8e, 0x5d, 0x41, 0x05, 0xb9, 0xa9, 0x89, 0x6d, 0x05, 0x66,
+  0x97, 0x4a, 0x47, 0xf0, 0x28, 0xc6, 0x87, 0x91, 0xd4, 0xcf, 0xf6, 0x4b,
+  0x38, 0x3a, 0xa2, 0xc1, 0x45, 0x44, 0x16, 0x2e, 0x43, 0x2e, 0xff, 0xca,
+  0x32, 0x1d, 0x72, 0x6c, 0x76, 0x53, 0x61, 0x51, 0xa4, 0xd2, 0x72, 0x1f,
+  0xc8, 0x05, 0xb9, 0xd4, 0x33, 0x43, 0x13, 0xfd, 0xa4, 0xea, 0x95, 0xcb,
+  0x13, 0x67, 0x43, 0x83, 0xab, 0x5c, 0xb5, 0xdc, 0xb3, 0x5d, 0xa8, 0x77,
+  0x15, 0x07, 0xf2, 0x2f, 0x7c, 0x5a, 0x8d, 0x20, 0xde, 0xab, 0xee, 0x22,
+  0x06, 0x55, 0x1d, 0x82, 0xaa, 0x81, 0x06, 0xd4, 0x5b, 0x53, 0xb7, 0x7d,
+  0xeb, 0xe7, 0xab, 0xaa, 0x78, 0x47, 0x58, 0x5c, 0x2a, 0x91, 0x77, 0x9c,
+  0x16, 0xe7, 0xae, 0x19, 0x18, 0xbc, 0xe1, 0xa5, 0x28, 0x67, 0xa4, 0xc7,
+  0x23, 0xa0, 0x97, 0x38, 0x6d, 0x8d, 0x98, 0x22, 0x8a, 0xdd, 0xc8, 0x40,
+  0x2c, 0x07, 0x42, 0x19, 0x10, 0xb7, 0x2b, 0x16, 0xdd, 0xf2, 0x03, 0xe6,
+  0xa5, 0x85, 0x7b, 0x29, 0x72, 0x8a, 0x96, 0x55, 0x36, 0x75, 0x89, 0xb1,
+  0x92, 0x37, 0x48, 0x36, 0x68, 0x61, 0xfb, 0x18, 0xa0, 0x42, 0x75, 0x4a,
+  0x30, 0xd9, 0xc2, 0x47, 0xcd, 0xd4, 0x80, 0x4a, 0xc5, 0xf4, 0xe6, 0xe0,
+  0xb6, 0x52, 0x73, 0xb9, 0x78, 0xf3, 0x4c, 0xdb, 0x97, 0xa2, 0x96, 0x79,
+  0x97, 0xe1, 0xc2, 0x5e, 0x2b, 0x49, 0x65, 0xf5, 0x36, 0x1e, 0x49, 0x5c,
+  0xce, 0x29, 0xdd, 0x98, 0xaa, 0x8b, 0x97, 0xfb, 0xa2, 0x5a, 0x04, 0xe8,
+  0x03, 0xf7, 0xbc, 0x59, 0x90, 0x49, 0x0e, 0xe2, 0x70, 0xaf, 0x50, 0xc2,
+  0x47, 0xab, 0x2c, 0x6a, 0xa8, 0xa5, 0xc0, 0xd5, 0x87, 0xa0, 0x21, 0x81,
+  0xfc, 0xf4, 0x2d, 0xd2, 0x99, 0x23, 0xf3, 0xbc, 0x2b, 0x9a, 0x96, 0xd6,
+  0x9c, 0x68, 0x94, 0x77, 0x55, 0x1a, 0x0a, 0xb1, 0x2a, 0xee, 0x68, 0x58,
+  0x60, 0x47, 0x2d, 0xf3, 0x1d, 0xbe, 0x44, 0x27, 0x74, 0x0b, 0x61, 0x69,
+  0x00, 0xd0, 0xe4, 0xfb, 0xec, 0xbf, 0x1e, 0xce, 0x67, 0xec, 0x68, 0x16,
+  0x45, 0x7a, 0xff, 0x6e, 0xb5, 0x19, 0x5b, 0x66, 0x9d, 0x59, 0x77, 0xe5,
+  0xe0, 0xec, 0xed, 0xf1, 0xdb, 0x97, 0xfb, 0xce, 0x71, 0xd0, 0x40, 0x14,
+  0x75, 0x3a, 0x2a, 0x16, 0x23, 0xb0, 0x02, 0x0c, 0x50, 0x84, 0x2d, 0x1a,
+  0x9d, 0x8b, 0x07, 0xc3, 0x00, 0x8e, 0x5a, 0x5d, 0x85, 0x75, 0xd8, 0x08,
+  0x7e, 0x87, 0xb9, 0xf2, 0x6e, 0x97, 0x2c, 0xc1, 0x73, 0xc1, 0x8f, 0xef,
+  0xef, 0xac, 0x70, 0x40, 0x8c, 0x97, 0x0c, 0x31, 0x66, 0x18, 0x66, 0xdc,
+  0xa8, 0xc8, 0x24, 0xc9, 0x46, 0xcb, 0x45, 0x0f, 0x06, 0x2f, 0x41, 0xb0,
+  0xe3, 0x38, 0x6b, 0x78, 0x64, 0x51, 0xe6, 0x44, 0x1e, 0x13, 0xb0, 0xcd,
+  0x45, 0xcf, 0x10, 0x71, 0xcd, 0x9e, 0xce, 0x06, 0xc3, 0x5d, 0x3c, 0xb9,
+  0x2f, 0x6c, 0x49, 0xc1, 0x2e, 0x28, 0xe2, 0xf4, 0x77, 0xec, 0x10, 0x36,
+  0xc2, 0x26, 0xbf, 0xe5, 0x1a, 0xae, 0x3d, 0x12, 0x59, 0x90, 0x65, 0xb7,
+  0x94, 0xaa, 0xfd, 0xce, 0x88, 0xeb, 0x9c, 0x2c, 0x9e, 0xbc, 0x73, 0xd1,
+  0xaa, 0xc4, 0x69, 0x27, 0xf1, 0xab, 0x18, 0xd9, 0xd3, 0x4d, 0xd8, 0x94,
+  0xcc, 0x56, 0x65, 0x8e, 0x1c, 0x3e, 0x7a, 0xfb, 0x52, 0x42, 0x5c, 0x1d,
+  0x4a, 0x14, 0x2d, 0xb8, 0xd5, 0x2c, 0x75, 0xde, 0x08, 0x34, 0xbc, 0x70,
+  0x75, 0x09, 0x8c, 0x01, 0x5e, 0x6a, 0x98, 0xb5, 0x89, 0xc5, 0x5e, 0x83,
+  0x95, 0x1d, 0xd9, 0xf6, 0xfe, 0x1d, 0x76, 0xd9, 0x07, 0x31, 0xcc, 0x5a,
+  0x47, 0x08, 0xe7, 0x75, 0xff, 0xf6, 0x7f, 0xb2, 0x25, 0xac, 0xe6, 0x4c,
+  0xa8, 0xed, 0xbf, 0xd9, 0x39, 0x6b, 0x46, 0x8e, 0x20, 0xad, 0xad, 0x9f,
+  0x9f, 0xbe, 0x3d, 0x7a, 0x79, 0xb2, 0xb1, 0xaa, 0xbd, 0x23, 0x5c, 0xb5,
+  0x1c, 0x92, 0xe7, 0x13, 0x0c, 0x38, 0xf5, 0x59, 0x5b, 0xae, 0x59, 0x3d,
+  0x24, 0xa0, 0xec, 0x6d, 0x3c, 0x22, 0xeb, 0xbe, 0xc9, 0x0e, 0xd2, 0xc0,
+  0x5c, 0x5d, 0xf3, 0xab, 0x16, 0xa8, 0x5f, 0x61, 0x93, 0x42, 0xab, 0x0f,
+  0x6f, 0xd9, 0x50, 0x83, 0xc6, 0x5d, 0x61, 0x7f, 0x18, 0xd0, 0x91, 0xf7,
+  0xb3, 0xb8, 0x38, 0x47, 0xa8, 0x10, 0x58, 0x8f, 0xfd, 0x6b, 0x2a, 0x5f,
+  0x2a, 0x3c, 0xb5, 0xc1, 0x4e, 0x78, 0xb7, 0x85, 0x8a, 0x6a, 0xcc, 0x91,
+  0xe6, 0x67, 0x1b, 0x45, 0xcd, 0xc7, 0xfb, 0xc1, 0xdb, 0xb1, 0x4c, 0x48,
+  0xbe, 0xa3, 0x74, 0xe6, 0xe7, 0x09, 0xc9, 0xf7, 0x57, 0xd0, 0x74, 0x1d,
+  0xdf, 0xb5, 0x65, 0x2b, 0x6a, 0x4e, 0x4b, 0x76, 0xce, 0xc8, 0xe2, 0x6e,
+  0xeb, 0x54, 0x8c, 0x3f, 0x4a, 0x1f, 0x35, 0xc0, 0xb1, 0xd6, 0x40, 0x58,
+  0xeb, 0x18, 0xac, 0xf8, 0x59, 0x24, 0x24, 0xb3, 0x2b, 0xcf, 0x5d, 0x88,
+  0xcb, 0x83, 0x7a, 0xa8, 0x37, 0x7f, 0xd1, 0xdd, 0xc9, 0x0a, 0x17, 0x78,
+  0xa1, 0xa2, 0xbb, 0xde, 0xe3, 0xd0, 0xaf, 0x97, 0x45, 0xfc, 0x74, 0x5e,
+  0x18, 0xc3, 0xbd, 0x3e, 0x34, 0x2b, 0xbc, 0xc7, 0x39, 0xf5, 0x6f, 0x81,
+  0x16, 0x75, 0xa1, 0xc9, 0x31, 0xb6, 0xe8, 0x1d, 0xd0, 0xa2, 0x8a, 0xdf,
+  0xf1, 0xff, 0x41, 0x8b, 0xfe, 0x9f, 0x09, 0x2d, 0xfa, 0xa3, 0xa0, 0x4a,
+  0x51, 0xab, 0xa0, 0x5a, 0x6f, 0x75, 0xb7, 0x6a, 0x7a, 0xc7, 0x20, 0x1f,
+  0x84, 0xcc, 0x82, 0x64, 0x30, 0xcf, 0xb4, 0x90, 0x72, 0x6f, 0x7e, 0xd9,
+  0x20, 0xbb, 0xd4, 0xb1, 0x35, 0x57, 0x12, 0x51, 0xef, 0x2f, 0x65, 0xda,
+  0x6c, 0xf4, 0xfa, 0x4c, 0x84, 0xcd, 0xc5, 0x77, 0x1f, 0x0a, 0x67, 0x33,
+  0x6a, 0x74, 0xb9, 0xe4, 0xe3, 0xaf, 0xd4, 0xe4, 0x19, 0xfe, 0xf4, 0xf1,
+  0x13, 0x57, 0x1c, 0x44, 0x99, 0x63, 0xda, 0x3e, 0x3d, 0x41, 0xe0, 0xd7,
+  0x24, 0x8a, 0x24, 0xbe, 0x30, 0x8e, 0x30, 0xcf, 0x5a, 0xb9, 0x5c, 0x57,
+  0x59, 0xb6, 0xa1, 0xb3, 0x2f, 0x9c, 0xe6, 0x5f, 0xef, 0xae, 0x55, 0x5e,
+  0xcd, 0xe6, 0x3d, 0x60, 0x05, 0xb7, 0xad, 0xcf, 0x12, 0x52, 0x7c, 0x63,
+  0xed, 0x46, 0x5e, 0x6a, 0xd7, 0x60, 0x7d, 0x89, 0xcb, 0x51, 0x87, 0x22,
+  0xe5, 0xb0, 0xde, 0xad, 0xfa, 0xd1, 0x04, 0x6f, 0x9b, 0x28, 0x39, 0xa5,
+  0x94, 0x0b, 0x72, 0x45, 0x70, 0x3a, 0x70, 0x32, 0x1c, 0xa5, 0x37, 0xaa,
+  0xf7, 0x03, 0x2f, 0xd9, 0x86, 0xa3, 0x10, 0x52, 0xe4, 0x05, 0xda, 0x42,
+  0x2e, 0x95, 0x1f, 0x8f, 0x0e, 0xce, 0x2f, 0x9a, 0xc4, 0x50, 0x07, 0xc9,
+  0x66, 0x3a, 0xa1, 0x46, 0xb9, 0xb9, 0x38, 0x23, 0x53, 0x2e, 0x38, 0x61,
+  0x29, 0x84, 0xa4, 0xe0, 0x45, 0x76, 0x2b, 0xb8, 0x7d, 0x82, 0xda, 0x43,
+  0xc3, 0xe5, 0xd1, 0xa2, 0x1b, 0x5d, 0xf2, 0x1f, 0x29, 0xcc, 0x9b, 0x72,
+  0x4b, 0x0c, 0x27, 0x30, 0x23, 0x8f, 0x45, 0xda, 0xe3, 0xf8, 0x42, 0xe8,
+  0x1c, 0x84, 0x99, 0xb1, 0x68, 0xaa, 0x65, 0x81, 0x45, 0xce, 0x46, 0xec,
+  0x6a, 0x21, 0x46, 0x68, 0xf5, 0xda, 0xd3, 0x5a, 0x6d, 0x63, 0x97, 0xc5,
+  0x88, 0x46, 0x4f, 0x06, 0x20, 0x28, 0x31, 0x09, 0x5d, 0xb0, 0xca, 0x90,
+  0x91, 0x71, 0x5c, 0xc2, 0x56, 0xc8, 0x69, 0x72, 0x33, 0x0e, 0x79, 0xa3,
+  0x2a, 0xf1, 0xb2, 0xa9, 0x13, 0x5a, 0x64, 0x10, 0x15, 0x7c, 0x59, 0x53,
+  0x3b, 0xbb, 0x75, 0xeb, 0x87, 0x5f, 0xaa, 0x51, 0x51, 0x00, 0x17, 0x13,
+  0xab, 0x07, 0xbe, 0xa5, 0x7b, 0x25, 0xea, 0x9b, 0x25, 0xb9, 0xd1, 0x5b,
+  0xc2, 0x88, 0x47, 0xe9, 0x25, 0xfb, 0x78, 0xca, 0x0f, 0x2c, 0x3b, 0x0a,
+  0xbf, 0x25, 0x9c, 0xf2, 0x25, 0x8e, 0xe8, 0x1a, 0xb5, 0xdc, 0x11, 0x73,
+  0x1f, 0x0c, 0x84, 0xcb, 0xfc, 0xa0, 0x0b, 0x6d, 0xdd, 0xe3, 0x10, 0xfd,
+  0x44, 0x5b, 0x4b, 0xad, 0xf9, 0x95, 0x8e, 0x64, 0x6d, 0x44, 0x9f, 0xa7,
+  0xd7, 0xd7, 0x5b, 0xb9, 0x83, 0xbd, 0xe1, 0x93, 0xf3, 0xaa, 0xe8, 0xb0,
+  0x9c, 0x48, 0xd1, 0x39, 0x75, 0x43, 0x6c, 0xd3, 0x33, 0xab, 0x1a, 0x65,
+  0xd9, 0x5a, 0x2a, 0x65, 0xb7, 0x0c, 0xf1, 0xc7, 0xa9, 0xf0, 0x14, 0xf3,
+  0xce, 0x9f, 0x69, 0xf0, 0x16, 0x65, 0x38, 0x2c, 0xd3, 0x11, 0x1a, 0x07,
+  0xb3, 0x1a, 0x28, 0xe5, 0x8a, 0x5e, 0xec, 0xa6, 0x1e, 0x56, 0xde, 0xba,
+  0xfa, 0xc8, 0x3e, 0x59, 0x1a, 0xf5, 0x25, 0xf3, 0xbe, 0xae, 0x59, 0xcf,
+  0x1b, 0x7b, 0x58, 0xbe, 0xb7, 0x51, 0x70, 0xcb, 0x9d, 0xc1, 0x54, 0xf1,
+  0x93, 0xff, 0x8f, 0x09, 0xa9, 0x22, 0x2e, 0xbb, 0xdd, 0xdd, 0x8d, 0xc3,
+  0xa8, 0x74, 0x98, 0xd2, 0x95, 0x8b, 0xed, 0xbe, 0x27, 0x8c, 0x0a, 0xb9,
+  0x1a, 0x33, 0xc3, 0xdd, 0x38, 0x9e, 0x4a, 0xac, 0xc0, 0x01, 0x9a, 0xe2,
+  0xb3, 0xe2, 0xa9, 0x96, 0xc4, 0xa9, 0xd2, 0x4a, 0x8a, 0x52, 0x8d, 0xe4,
+  0x92, 0x97, 0x89, 0x78, 0x50, 0x64, 0x91, 0x2c, 0x8a, 0x70, 0xbb, 0x0b,
+  0xff, 0x0b, 0xe8, 0xa0, 0xc4, 0x80, 0x03, 0x74, 0xba, 0x43, 0x68, 0xc7,
+  0x52, 0x11, 0x0c, 0x05, 0x90, 0xec, 0x76, 0x9f, 0x74, 0x29, 0x69, 0x98,
+  0x9e, 0x6e, 0x12, 0x15, 0x45, 0x52, 0x24, 0x2a, 0xd7, 0xb7, 0xf0, 0x05,
+  0x6b, 0xad, 0xb6, 0x24, 0xb2, 0xae, 0xa2, 0x50, 0x53, 0x7d, 0x42, 0xa9,
+  0x97, 0x27, 0xe7, 0x54, 0xd8, 0xb8, 0x40, 0x73, 0x35, 0x45, 0x8f, 0x19,
+  0x68, 0xd1, 0xa2, 0xcc, 0x19, 0x53, 0x5a, 0xb3, 0xb2, 0xd8, 0xa0, 0x2d,
+  0xfe, 0x0e, 0x21, 0x27, 0xee, 0x11, 0x26, 0xfb, 0xfe, 0xe0, 0xe8, 0xfc,
+  0xfd, 0xf6, 0xce, 0xd3, 0xf7, 0x2f, 0x0f, 0xdf, 0xbc, 0x0f, 0x91, 0x64,
+  0x9f, 0x78, 0x3c, 0x11, 0xfd, 0x84, 0xbc, 0x5b, 0x4d, 0xe9, 0x21, 0x1a,
+  0x4f, 0xb6, 0x70, 0xb4, 0xee, 0xcb, 0x05, 0x81, 0xa7, 0x51, 0x46, 0x6c,
+  0x0c, 0xd6, 0x25, 0x74, 0xfd, 0x9a, 0xb1, 0x86, 0x1e, 0xa4, 0xad, 0xf5,
+  0x5a, 0x3a, 0x9f, 0x17, 0xe6, 0xb5, 0xb5, 0x02, 0x3a, 0x81, 0x30, 0x5b,
+  0xe7, 0x67, 0xa7, 0xad, 0x36, 0x5d, 0xbb, 0xd0, 0x72, 0x07, 0xfe, 0x4a,
+  0xd6, 0x11, 0xfa, 0x78, 0x6f, 0x6b, 0xef, 0xf1, 0x46, 0x37, 0x22, 0x63,
+  0x86, 0xa0, 0xe0, 0x06, 0x73, 0x07, 0x4e, 0x05, 0x62, 0x4e, 0x36, 0x63,
+  0x58, 0x2e, 0xf5, 0x0f, 0x9a, 0x7b, 0x90, 0x06, 0xa5, 0x0d, 0xcb, 0x20,
+  0x96, 0x5d, 0xe9, 0x7e, 0xd6, 0x71, 0x7c, 0x6c, 0x64, 0x7b, 0x58, 0x6e,
+  0x85, 0xf5, 0x0d, 0xac, 0x14, 0xc4, 0xbd, 0x9a, 0x26, 0xb3, 0x8c, 0x9e,
+  0xac, 0x2f, 0x9c, 0xdb, 0x83, 0x84, 0x72, 0x43, 0xa3, 0x73, 0x45, 0x28,
+  0x70, 0x9f, 0xb9, 0x1c, 0xfa, 0xda, 0x74, 0x2d, 0x12, 0xff, 0x19, 0x23,
+  0x14, 0x38, 0x3a, 0x09, 0x08, 0x07, 0x5c, 0x20, 0xd6, 0x85, 0x97, 0x35,
+  0x90, 0x90, 0xa6, 0x4e, 0x9b, 0xb5, 0x22, 0xb2, 0xa4, 0x2d, 0x4e, 0x39,
+  0xf2, 0xb9, 0xc4, 0x44, 0x07, 0x8c, 0xd6, 0xfb, 0x8c, 0x17, 0xb6, 0x88,
+  0x66, 0xc8, 0x79, 0x23, 0x77, 0xe2, 0x68, 0x91, 0xcc, 0xaf, 0xf4, 0x43,
+  0xfc, 0x7f, 0x39, 0xdd, 0x84, 0x8c, 0x84, 0xcf, 0xa4, 0x1b, 0x6b, 0xe0,
+  0xdf, 0x40, 0x37, 0xd6, 0x57, 0x6c, 0x58, 0x7c, 0x20, 0x53, 0x95, 0xac,
+  0xf0, 0x22, 0xad, 0xd0, 0xba, 0xd7, 0x55, 0x57, 0xfc, 0xd0, 0x34, 0x56,
+  0xba, 0x86, 0xea, 0x96, 0xc3, 0x40, 0x37, 0x74, 0x65, 0xc4, 0x74, 0xa3,
+  0xf5, 0xc5, 0x24, 0xef, 0xde, 0x25, 0x9c, 0x89, 0xb1, 0xb8, 0x89, 0x78,
+  0xba, 0x89, 0xa7, 0x91, 0x25, 0x54, 0x62, 0x8b, 0x44, 0x13, 0x5d, 0x4e,
+  0x2e, 0xae, 0x90, 0x32, 0x11, 0x4c, 0xa0, 0x18, 0x16, 0x19, 0xbc, 0x27,
+  0x4e, 0x17, 0xe1, 0x0b, 0x7b, 0xe3, 0xb4, 0x9b, 0x72, 0x4c, 0xa7, 0xe7,
+  0x77, 0x3b, 0x4d, 0x57, 0xe0, 0x03, 0xd7, 0xdb, 0xc1, 0xa8, 0x8f, 0x61,
+  0x1a, 0x24, 0xee, 0x3b, 0xa5, 0x0d, 0xd6, 0xe2, 0x23, 0x1f, 0x59, 0x6f,
+  0x82, 0x6b, 0x52, 0x05, 0xbb, 0xba, 0xc4, 0xa9, 0x02, 0xbe, 0xc4, 0xcd,
+  0x90, 0x94, 0x71, 0x95, 0x5f, 0xc2, 0x3d, 0xb6, 0xfc, 0x38, 0x5e, 0x6f,
+  0xf3, 0x41, 0x94, 0x50, 0x99, 0x65, 0xe7, 0x70, 0x89, 0x6c, 0xcf, 0x0d,
+  0xac, 0x10, 0x24, 0xb3, 0xda, 0x5e, 0x40, 0x5b, 0xbf, 0x63, 0x0f, 0x74,
+  0xad, 0xdf, 0xb5, 0x63, 0xcf, 0xc0, 0xb3, 0xe0, 0x1a, 0x80, 0x1d, 0x69,
+  0x70, 0x5c, 0xdb, 0xc9, 0x8a, 0xe1, 0x66, 0x58, 0xd8, 0x0b, 0xa1, 0x99,
+  0x75, 0x5b, 0x90, 0x19, 0x83, 0xa8, 0x7e, 0x17, 0x23, 0x2e, 0x21, 0x46,
+  0xe0, 0x64, 0x80, 0xf1, 0x7c, 0xc9, 0xf9, 0xf9, 0xe9, 0x71, 0x87, 0x11,
+  0xd5, 0x04, 0x01, 0x21, 0xe9, 0xe5, 0x93, 0x14, 0x93, 0x1b, 0x19, 0xc4,
+  0x13, 0x75, 0xd4, 0x1c, 0xa3, 0x1a, 0xa4, 0xcc, 0x98, 0xb9, 0xa2, 0xa0,
+  0xc7, 0x26, 0x47, 0x0f, 0x27, 0xbd, 0x18, 0xd6, 0x0e, 0xd6, 0x0b, 0x53,
+  0x80, 0x4c, 0xa0, 0xfe, 0x91, 0xc1, 0x59, 0x2e, 0x4c, 0x29, 0xcc, 0x89,
+  0x51, 0x60, 0x49, 0x9c, 0xf7, 0x50, 0x32, 0x94, 0x1f, 0x1a, 0x20, 0xe1,
+  0x0c, 0xe7, 0x8b, 0xcd, 0xd3, 0x0e, 0xd3, 0xc6, 0xd9, 0x0f, 0xf6, 0x93,
+  0x56, 0xe7, 0x5d, 0xb2, 0xdf, 0xd2, 0x75, 0x38, 0x99, 0x08, 0x04, 0x41,
+  0x89, 0xd4, 0x3b, 0xe3, 0x42, 0x02, 0x24, 0x87, 0x28, 0x38, 0xe2, 0x15,
+  0x61, 0x36, 0xb9, 0x42, 0x6b, 0x21, 0x5c, 0x92, 0x63, 0x17, 0x9d, 0xb1,
+  0x57, 0x32, 0x3d, 0x49, 0x85, 0xc0, 0x48, 0x4c, 0x75, 0xfe, 0x2b, 0xe0,
+  0x5c, 0x36, 0x61, 0x84, 0x21, 0xc6, 0x7e, 0xa7, 0x62, 0x25, 0xfd, 0x59,
+  0x36, 0x60, 0x84, 0xd2, 0xd2, 0x37, 0x54, 0x94, 0x65, 0xde, 0x03, 0x31,
+  0xe8, 0x52, 0x61, 0x9c, 0x4a, 0x8c, 0x55, 0x81, 0x09, 0x0b, 0x72, 0x01,
+  0xae, 0x54, 0xa9, 0x49, 0x6f, 0x8c, 0xbf, 0xc3, 0xf3, 0x48, 0xcc, 0x20,
+  0x45, 0xb1, 0xa1, 0x5c, 0xbc, 0x89, 0xdc, 0xd9, 0xd7, 0x39, 0x36, 0x99,
+  0x59, 0x24, 0xcf, 0xb8, 0xa0, 0x55, 0x94, 0x58, 0x1c, 0x81, 0x31, 0xed,
+  0xc3, 0xc9, 0xe6, 0x3c, 0xca, 0xf3, 0xb9, 0xe2, 0x44, 0xa3, 0xbd, 0x25,
+  0xa7, 0x4c, 0x7b, 0x42, 0xb4, 0x0e, 0x40, 0xfc, 0xb3, 0x0c, 0xb1, 0x6d,
+  0xaf, 0x29, 0x3a, 0x08, 0x47, 0x2d, 0x1e, 0x03, 0xc3, 0x0c, 0x9f, 0x11,
+  0xb4, 0x78, 0x3e, 0x52, 0x30, 0x71, 0xdc, 0xd5, 0x09, 0x32, 0x42, 0x53,
+  0xfb, 0xa8, 0xbb, 0x04, 0x4f, 0xab, 0x02, 0x11, 0x85, 0x10, 0xc7, 0x98,
+  0xb5, 0xca, 0xa5, 0xfe, 0x25, 0xd9, 0x6a, 0xe0, 0xa9, 0xfb, 0xea, 0xf4,
+  0xb9, 0x3f, 0x9a, 0x6d, 0xc1, 0x09, 0x87, 0x54, 0x1b, 0xf3, 0x4f, 0xe4,
+  0x69, 0xcf, 0x56, 0x2a, 0xef, 0x20, 0xfe, 0x52, 0x31, 0x33, 0x72, 0xad,
+  0x06, 0x49, 0x9a, 0x8b, 0x60, 0xca, 0x62, 0x83, 0xa1, 0x8b, 0x46, 0xe0,
+  0x74, 0x34, 0x05, 0x24, 0x43, 0x94, 0x4a, 0x7c, 0x2d, 0x86, 0x24, 0xcb,
+  0xd4, 0x3c, 0xa2, 0x19, 0xfd, 0x7d, 0xda, 0xfd, 0xea, 0x86, 0x92, 0x95,
+  0xd9, 0xd2, 0xaf, 0x25, 0x1e, 0x6a, 0x80, 0x5e, 0xbe, 0xb8, 0xa9, 0xc9,
+  0x96, 0x12, 0x39, 0x4e, 0xc0, 0x60, 0x15, 0x50, 0xe0, 0x54, 0x8a, 0x47,
+  0x30, 0x6f, 0xd1, 0xc0, 0x6f, 0x83, 0xd7, 0x5a, 0x88, 0x4d, 0x0a, 0x29,
+  0x27, 0x8a, 0x01, 0x98, 0xc4, 0x76, 0xd6, 0x1a, 0x06, 0xbd, 0x25, 0xca,
+  0xe9, 0xb3, 0xdb, 0x0b, 0x86, 0x37, 0xb7, 0xf0, 0x0f, 0xc2, 0xe5, 0xb1,
+  0xa1, 0xcf, 0x0c, 0x44, 0x6d, 0x2f, 0x02, 0x14, 0x65, 0x11, 0xdf, 0x9f,
+  0xb6, 0x9b, 0x50, 0xc5, 0x18, 0xc5, 0xca, 0x23, 0x08, 0x05, 0x25, 0xdf,
+  0x5a, 0xf6, 0x76, 0x51, 0x0f, 0x31, 0xe5, 0x1b, 0xc2, 0x15, 0x83, 0xb9,
+  0x62, 0x4e, 0x77, 0xbc, 0x05, 0x3e, 0x57, 0x57, 0x60, 0xaa, 0xd2, 0x29,
+  0x7c, 0x98, 0x0a, 0x42, 0xe6, 0x38, 0x1d, 0x64, 0xf5, 0x10, 0x0a, 0x37,
+  0x9a, 0x5a, 0x40, 0x3f, 0x93, 0x8c, 0x05, 0x73, 0x5a, 0xcc, 0x9d, 0x3a,
+  0x24, 0x1c, 0x94, 0x33, 0x67, 0x46, 0xd7, 0x8c, 0x35, 0xb4, 0xb1, 0xe2,
+  0xbc, 0x27, 0x9a, 0x55, 0x4a, 0xa7, 0x19, 0x61, 0x8a, 0x00, 0x63, 0x3f,
+  0xc7, 0x53, 0x13, 0xc0, 0xb6, 0xc2, 0x88, 0x9b, 0x43, 0x45, 0xb9, 0x86,
+  0x41, 0x3c, 0xce, 0xc4, 0x70, 0x95, 0x34, 0xe4, 0x5b, 0x6c, 0xf5, 0x1a,
+  0x6d, 0xca, 0x80, 0x7b, 0x92, 0x6d, 0xc0, 0x70, 0xf2, 0x49, 0x12, 0x1e,
+  0x16, 0x72, 0x26, 0xec, 0x2c, 0xe9, 0x42, 0xd3, 0xe8, 0x3b, 0x16, 0xd8,
+  0xbd, 0xd4, 0x9c, 0xa8, 0x38, 0x60, 0x0f, 0x16, 0x97, 0xcb, 0x0d, 0xae,
+  0x40, 0xba, 0xd2, 0xf3, 0x43, 0x44, 0x52, 0x8b, 0x2b, 0x3a, 0x84, 0xd1,
+  0xad, 0x9f, 0x23, 0xf6, 0xd8, 0xf9, 0xe1, 0xe9, 0x46, 0x72, 0x1a, 0x5c,
+  0xa1, 0x1a, 0x4f, 0xd7, 0x25, 0xfc, 0x40, 0x0f, 0x55, 0x27, 0xd9, 0x6b,
+  0x12, 0x61, 0xb7, 0xe8, 0x3e, 0x26, 0x7a, 0xb6, 0x34, 0x10, 0x8a, 0xe1,
+  0xf7, 0x29, 0x1c, 0x11, 0x77, 0x49, 0x63, 0x00, 0x2f, 0x71, 0xbd, 0x7a,
+  0xdf, 0xa9, 0x04, 0x88, 0x29, 0x82, 0x7c, 0x53, 0x08, 0x18, 0x76, 0x21,
+  0xf5, 0xb7, 0x90, 0x6d, 0x37, 0x84, 0x58, 0xe2, 0xef, 0x97, 0xd9, 0x04,
+  0x2f, 0x19, 0xb2, 0x28, 0x1b, 0xd3, 0x15, 0x52, 0xa7, 0x4a, 0x2e, 0x55,
+  0xa6, 0x04, 0x8f, 0xca, 0x5d, 0xe8, 0x5c, 0x06, 0x95, 0x13, 0xb8, 0xad,
+  0x9c, 0x0c, 0x0b, 0x70, 0x76, 0x15, 0x61, 0xe0, 0xb6, 0xc3, 0xc4, 0x39,
+  0x45, 0x97, 0xc0, 0x6b, 0x70, 0x8a, 0xa1, 0xe5, 0xf8, 0x70, 0x59, 0x5e,
+  0xed, 0x60, 0xba, 0x67, 0xf7, 0x69, 0x90, 0x8b, 0x85, 0xdb, 0xa2, 0x60,
+  0x51, 0x81, 0x08, 0x35, 0xd4, 0x54, 0x9b, 0xa8, 0x15, 0xc3, 0x8d, 0x60,
+  0xbf, 0xdf, 0xbd, 0xde, 0xd7, 0xdf, 0x59, 0xd6, 0x9b, 0xdb, 0xa7, 0x3d,
+  0x83, 0xdf, 0x93, 0x72, 0x69, 0xe5, 0xe0, 0xa8, 0x50, 0x70, 0xb8, 0x2a,
+  0xff, 0x8c, 0x6c, 0xf0, 0xef, 0x73, 0x5c, 0xcb, 0x67, 0x22, 0x05, 0x28,
+  0x95, 0x11, 0x91, 0xbd, 0xc0, 0xa0, 0x7d, 0x78, 0x79, 0x42, 0x88, 0xea,
+  0xe9, 0xac, 0x97, 0xc3, 0xda, 0xce, 0x6e, 0x43, 0x56, 0x84, 0x86, 0xbd,
+  0x6a, 0x44, 0x16, 0x41, 0xf4, 0xa1, 0xeb, 0x1f, 0x7e, 0x51, 0x39, 0x06,
+  0xbd, 0x5c, 0xdd, 0xe4, 0xcf, 0xd4, 0x8b, 0xbc, 0xa7, 0xd0, 0xae, 0x24,
+  0x50, 0xfe, 0x78, 0xf4, 0xe2, 0xe4, 0xec, 0xa8, 0x16, 0x50, 0xeb, 0xe3,
+  0xb2, 0x65, 0x44, 0xbf, 0x61, 0x32, 0xad, 0x94, 0xc6, 0xe2, 0xa4, 0x93,
+  0x1c, 0x25, 0x38, 0x38, 0xfd, 0x3f, 0x3f, 0xb7, 0x01, 0x91, 0x44, 0x23,
+  0xd0, 0x7e, 0xd6, 0x5a, 0x9b, 0xc6, 0xd9, 0xd3, 0x34, 0x2b, 0xf4, 0x43,
+  0xa1, 0x11, 0xac, 0x10, 0x74, 0x0e, 0x1b, 0x14, 0x65, 0xc8, 0x70, 0x32,
+  0x92, 0x74, 0x94, 0x22, 0x0a, 0x20, 0x4a, 0x97, 0x54, 0x59, 0xcb, 0xda,
+  0x53, 0xb2, 0x26, 0xcc, 0xc4, 0x00, 0x91, 0x92, 0x82, 0xac, 0x56, 0x5e,
+  0x25, 0x6b, 0x1d, 0x8b, 0x8f, 0xa0, 0x65, 0xc4, 0x8b, 0x7f, 0x23, 0xb1,
+  0xfe, 0xc2, 0x1a, 0x68, 0xf2, 0x8e, 0x74, 0xc6, 0x24, 0x8a, 0xfc, 0x89,
+  0x7d, 0x7d, 0x03, 0x47, 0x1e, 0x28, 0x1d, 0xd3, 0x49, 0x31, 0x88, 0x0b,
+  0x20, 0x9e, 0xdf, 0x04, 0xdf, 0x81, 0x65, 0x49, 0x8b, 0xab, 0xf5, 0x71,
+  0xc9, 0xd2, 0xd9, 0x7a, 0xb9, 0xb1, 0x30, 0x68, 0x5b, 0x33, 0x19, 0xfb,
+  0xda, 0x1f, 0x6d, 0xd8, 0x4d, 0x99, 0x6c, 0x21, 0x94, 0x44, 0x27, 0xd0,
+  0x5d, 0x82, 0x3e, 0x5d, 0x56, 0x05, 0x16, 0x2b, 0xa8, 0xa4, 0xb8, 0xd5,
+  0x30, 0xcd, 0x47, 0x14, 0x05, 0x6d, 0x0b, 0x40, 0xf3, 0xd4, 0x20, 0xf4,
+  0x24, 0xb3, 0x98, 0x33, 0xad, 0x2a, 0xa3, 0x03, 0xc3, 0x37, 0xf1, 0x90,
+  0xb8, 0x31, 0xc7, 0x83, 0x26, 0xaa, 0x04, 0x39, 0x65, 0x96, 0x97, 0x1f,
+  0x60, 0xb1, 0xff, 0x73, 0xa3, 0xeb, 0x4a, 0x90, 0xde, 0xe4, 0x25, 0xf0,
+  0x19, 0x69, 0x53, 0x9c, 0xad, 0x92, 0xc8, 0x95, 0xe8, 0xa0, 0x48, 0x2c,
+  0x2f, 0xb8, 0x24, 0x8e, 0x6f, 0xde, 0xd7, 0xfc, 0x46, 0x45, 0x61, 0x96,
+  0x05, 0xec, 0x53, 0x12, 0xf6, 0x7a, 0x1c, 0xa2, 0xea, 0xd7, 0x6b, 0xce,
+  0xa6, 0x6c, 0x24, 0xc2, 0xf2, 0x76, 0x52, 0x21, 0x0f, 0x12, 0x3e, 0xd9,
+  0x2f, 0x66, 0x74, 0xfb, 0x32, 0x55, 0xba, 0x33, 0x50, 0x72, 0x41, 0xba,
+  0xe4, 0x9b, 0xbd, 0x6f, 0xe4, 0x9a, 0x86, 0x89, 0x4e, 0xd8, 0xc5, 0x42,
+  0x0f, 0xf3, 0xb0, 0x4b, 0xf2, 0x0a, 0xe8, 0x38, 0xfd, 0xde, 0x95, 0x5c,
+  0x3e, 0x03, 0xe3, 0x72, 0x32, 0xc2, 0x42, 0x57, 0x06, 0x77, 0xee, 0xde,
+  0x36, 0x9f, 0x0e, 0x7e, 0x46, 0xf8, 0x08, 0xaa, 0x5d, 0xaa, 0xb8, 0x87,
+  0x91, 0x99, 0x13, 0xca, 0x1a, 0xc4, 0xf5, 0x78, 0x81, 0x80, 0xe1, 0xe2,
+  0xcf, 0x40, 0x6f, 0x36, 0x2c, 0x3f, 0xf2, 0xff, 0x70, 0xa6, 0xff, 0x1e,
+  0x9f, 0x65, 0xe6, 0x87, 0x4a, 0x87, 0x1a, 0xee, 0x42, 0xc7, 0x42, 0x84,
+  0x0c, 0x65, 0x02, 0xc9, 0x0b, 0xb9, 0xa6, 0xca, 0x50, 0x20, 0x11, 0x0e,
+  0x01, 0xb5, 0x47, 0x31, 0x49, 0xa0, 0xa8, 0x72, 0x71, 0x19, 0x7c, 0x53,
+  0x10, 0x96, 0xa8, 0x2c, 0x50, 0x49, 0x35, 0xc0, 0x04, 0x6d, 0xd5, 0xc1,
+  0xad, 0x1a, 0x3c, 0x84, 0xd6, 0xe0, 0x93, 0x58, 0x6f, 0xf5, 0x27, 0x21,
+  0x3c, 0x79, 0x70, 0x47, 0xd2, 0x0a, 0xc4, 0xa3, 0x57, 0x2f, 0x50, 0x4a,
+  0xe8, 0x72, 0x03, 0xbd, 0x03, 0x11, 0x91, 0x1d, 0x85, 0x34, 0xfe, 0x58,
+  0x89, 0xae, 0xcc, 0x34, 0xd8, 0x87, 0xd8, 0x75, 0x4a, 0xac, 0x81, 0x71,
+  0xe9, 0x84, 0x80, 0xf8, 0xfc, 0xe1, 0x14, 0x07, 0xd0, 0x42, 0xef, 0x36,
+  0x7c, 0x48, 0xf4, 0x33, 0x19, 0x88, 0xf0, 0x47, 0x1d, 0x65, 0x1f, 0x49,
+  0xa4, 0xb1, 0x64, 0x37, 0x8c, 0x04, 0xc3, 0xf1, 0x52, 0x4c, 0x11, 0x55,
+  0x8a, 0x78, 0x44, 0xcf, 0x09, 0x50, 0x2d, 0x55, 0xad, 0xcc, 0xf4, 0xa4,
+  0xe3, 0xfe, 0xbc, 0x07, 0x4d, 0x15, 0x9f, 0x58, 0xdf, 0xdd, 0x20, 0x9c,
+  0x1f, 0xbc, 0x51, 0x2f, 0x35, 0xa8, 0x76, 0x40, 0xf1, 0xb3, 0x8f, 0x5c,
+  0x27, 0x56, 0x30, 0x60, 0xdd, 0x3b, 0x22, 0x77, 0xbb, 0x5b, 0x1b, 0x7a,
+  0xe3, 0x5f, 0x5d, 0xce, 0xa6, 0xc9, 0x25, 0x48, 0x78, 0xd3, 0x68, 0x15,
+  0xf8, 0xf3, 0x68, 0x15, 0x38, 0xba, 0x97, 0x9e, 0x3c, 0x7e, 0x6e, 0x64,
+  0x49, 0x33, 0xa5, 0xd9, 0x93, 0x3f, 0x89, 0xd8, 0xd7, 0x23, 0x3f, 0x7d,
+  0x13, 0x3b, 0xed, 0x55, 0xa7, 0x88, 0xc9, 0x72, 0xf1, 0x57, 0xb6, 0x60,
+  0x32, 0x06, 0xfe, 0x54, 0x9b, 0x21, 0x32, 0x1e, 0xc0, 0x9b, 0xe3, 0x94,
+  0xa9, 0xf4, 0x12, 0x4e, 0xb7, 0xb6, 0x69, 0x02, 0xcc, 0xd5, 0xb8, 0x18,
+  0x30, 0xea, 0x6c, 0x3c, 0x1b, 0xfc, 0x58, 0x67, 0x23, 0xd5, 0x72, 0xca,
+  0x30, 0x7e, 0x7a, 0xa1, 0x87, 0x91, 0x67, 0xca, 0x15, 0x9c, 0xfd, 0xfc,
+  0x11, 0x67, 0x39, 0x62, 0x3b, 0xf4, 0x9c, 0x1f, 0xd0, 0x24, 0x29, 0xfa,
+  0x95, 0x1b, 0x0f, 0x3d, 0xc0, 0x7c, 0x33, 0x0c, 0x09, 0xa3, 0x46, 0x48,
+  0xe9, 0x8d, 0x87, 0x84, 0x1f, 0x2f, 0x90, 0x19, 0x7c, 0xc8, 0x2c, 0xb7,
+  0x79, 0x6d, 0xb9, 0x89, 0x47, 0x8f, 0x6a, 0x6b, 0x4b, 0xad, 0x47, 0x2b,
+  0xdb, 0x0b, 0xc6, 0xab, 0x1a, 0x1d, 0xe2, 0x47, 0xae, 0x85, 0xc6, 0x65,
+  0x95, 0xf6, 0x74, 0x0a, 0x23, 0x04, 0x68, 0xc7, 0x6c, 0x9b, 0xf7, 0x34,
+  0x22, 0x2e, 0xce, 0xfe, 0xde, 0xcf, 0x66, 0x34, 0x61, 0xcd, 0xa4, 0xbc,
+  0x1d, 0xa3, 0x7c, 0xe4, 0x59, 0x5e, 0x9f, 0xc0, 0xe7, 0x29, 0xa0, 0x91,
+  0xea, 0x6c, 0x81, 0xd0, 0xc6, 0x8f, 0x58, 0x1a, 0xd2, 0x23, 0xd7, 0xa0,
+  0x81, 0x3a, 0x82, 0x7a, 0x92, 0x4f, 0x34, 0xb0, 0x87, 0x38, 0x8a, 0x1b,
+  0x81, 0x2b, 0xf6, 0xc8, 0x5c, 0xe5, 0x03, 0x82, 0xfb, 0xdb, 0x45, 0xf9,
+  0x1e, 0xd7, 0x4c, 0x87, 0x26, 0x5f, 0x06, 0x79, 0x41, 0x46, 0x64, 0x45,
+  0x7e, 0x02, 0xac, 0x98, 0xac, 0x35, 0x3b, 0x46, 0x79, 0x68, 0x71, 0x9b,
+  0x81, 0x42, 0xa5, 0xdf, 0x66, 0x16, 0x32, 0xbe, 0x8b, 0x85, 0x44, 0x75,
+  0x8c, 0x3c, 0x23, 0xd1, 0xbd, 0x5d, 0xdc, 0xf0, 0xa4, 0x89, 0x95, 0x78,
+  0x5e, 0x62, 0x79, 0xb3, 0x29, 0x66, 0x4d, 0x3e, 0x62, 0x76, 0x02, 0xcd,
+  0xd6, 0x78, 0x89, 0xb1, 0x92, 0x46, 0x4e, 0x62, 0x8c, 0x44, 0x99, 0xd0,
+  0xa7, 0xf0, 0x91, 0xe9, 0xcd, 0x40, 0x67, 0x0f, 0xbf, 0xda, 0xdc, 0xf5,
+  0xf6, 0x65, 0x5c, 0xe8, 0x5e, 0x59, 0x8c, 0xe6, 0x15, 0xc3, 0xd0, 0x71,
+  0x7c, 0x9d, 0x5d, 0xc2, 0xf3, 0xd9, 0x8c, 0x0b, 0x39, 0xa9, 0xd8, 0x63,
+  0x0b, 0xaf, 0x6b, 0x3d, 0xe3, 0xec, 0x21, 0x49, 0xfb, 0x62, 0x92, 0xd1,
+  0x2e, 0xe5, 0xbb, 0xd0, 0x2b, 0xdd, 0x38, 0x4e, 0x3e, 0x2a, 0x1c, 0x75,
+  0x2c, 0x70, 0x2b, 0x69, 0x52, 0x4f, 0x84, 0x31, 0xac, 0x41, 0x86, 0xe6,
+  0x45, 0xa1, 0x46, 0x1c, 0x72, 0xed, 0x2c, 0xea, 0x20, 0xec, 0x30, 0xd9,
+  0x50, 0xc7, 0x11, 0x39, 0xc0, 0x9f, 0x61, 0x64, 0x5c, 0xd4, 0xce, 0x76,
+  0x76, 0xe1, 0xc4, 0x46, 0x37, 0x87, 0xb5, 0x17, 0x91, 0x77, 0x68, 0x17,
+  0x3f, 0x6e, 0x6a, 0x3a, 0xcc, 0x15, 0xeb, 0x62, 0xdd, 0xc6, 0xbd, 0xd4,
+  0x29, 0x5b, 0x7b, 0x6b, 0x07, 0x9d, 0x85, 0xed, 0x5b, 0xa8, 0x05, 0xda,
+  0xf2, 0xeb, 0xc9, 0xbe, 0x83, 0x11, 0xa0, 0xca, 0x31, 0xb2, 0x33, 0xa9,
+  0x6a, 0x86, 0x5c, 0x73, 0x51, 0xd2, 0xb5, 0xe5, 0x5c, 0xa7, 0x77, 0x64,
+  0x5b, 0xd7, 0x54, 0x1f, 0x6e, 0xad, 0xf5, 0xfc, 0xe8, 0xf5, 0x11, 0x2d,
+  0x52, 0x2b, 0x59, 0xd4, 0x7d, 0x86, 0x45, 0xb1, 0xa8, 0xfe, 0x88, 0xe9,
+  0xc4, 0x14, 0x6c, 0x9c, 0x6b, 0x31, 0xee, 0x2c, 0xa0, 0xbe, 0x3c, 0xc7,
+  0xa2, 0x2e, 0x7d, 0x0a, 0x79, 0xd6, 0x88, 0x87, 0x5a, 0xf0, 0x87, 0xd6,
+  0x42, 0x88, 0x8a, 0x31, 0x3c, 0x26, 0x60, 0xa0, 0xe4, 0x74, 0x96, 0x17,
+  0x01, 0x07, 0x96, 0x34, 0xc7, 0x5c, 0xea, 0x14, 0x5e, 0xa5, 0x5c, 0x9e,
+  0xca, 0x62, 0xf1, 0x58, 0xd0, 0x1a, 0xd6, 0xe2, 0x46, 0x8a, 0xd1, 0xc0,
+  0x62, 0xf3, 0x0c, 0xbf, 0x40, 0xd5, 0xcb, 0xaf, 0x16, 0x1d, 0x13, 0xe1,
+  0x14, 0x61, 0xb5, 0x9a, 0x7c, 0x64, 0xf9, 0x9b, 0x78, 0x7c, 0x78, 0x92,
+  0x1c, 0x70, 0xcc, 0xc6, 0x48, 0x32, 0x2a, 0x5b, 0x4d, 0xe2, 0x90, 0x64,
+  0xcf, 0x0e, 0x02, 0xc3, 0x98, 0x97, 0x17, 0x81, 0x70, 0x2e, 0x29, 0xd1,
+  0x72, 0xd8, 0x10, 0xd7, 0x5d, 0x46, 0xbe, 0x57, 0xbf, 0x9e, 0x8d, 0xe8,
+  0xe5, 0xcd, 0x70, 0x30, 0x9f, 0x9e, 0x2d, 0xe0, 0x3b, 0xc2, 0xd8, 0xd6,
+  0x1c, 0x34, 0xaf, 0x95, 0x0c, 0x2c, 0xd9, 0xe5, 0xa0, 0x23, 0x66, 0x0e,
+  0x1a, 0xf2, 0xac, 0xcd, 0xad, 0x01, 0xbf, 0x7b, 0x46, 0xff, 0x78, 0x80,
+  0x10, 0x16, 0xc3, 0x49, 0x6e, 0x4c, 0x5e, 0x1c, 0xbf, 0x3e, 0xda, 0x40,
+  0x27, 0x27, 0x1b, 0xe0, 0xc9, 0x85, 0xd3, 0xbb, 0xad, 0x78, 0x99, 0x90,
+  0x5b, 0xae, 0xe7, 0x5d, 0x34, 0xc0, 0x08, 0xea, 0x04, 0x48, 0xaa, 0x22,
+  0xd4, 0x17, 0x7d, 0xf2, 0x59, 0x6c, 0x88, 0xc1, 0x5e, 0x5c, 0x73, 0x9b,
+  0x04, 0x25, 0xe5, 0x35, 0x66, 0x8b, 0x8d, 0x27, 0x5f, 0x01, 0x41, 0x1a,
+  0x72, 0xaf, 0x22, 0xe5, 0x9e, 0x71, 0x04, 0xa8, 0x9c, 0xa1, 0x70, 0x8c,
+  0xe9, 0xe8, 0x04, 0xfd, 0xec, 0x26, 0xbd, 0x35, 0x99, 0x7f, 0xab, 0xf3,
+  0xf8, 0x9b, 0x6f, 0xf0, 0x38, 0x06, 0x83, 0x2f, 0xf3, 0x15, 0xd4, 0xcc,
+  0xf6, 0xb6, 0xb6, 0x68, 0x02, 0x5a, 0x38, 0x0e, 0xfe, 0xee, 0x7c, 0xd3,
+  0xf4, 0x78, 0x99, 0xc1, 0x76, 0x0f, 0x16, 0x9e, 0xef, 0xc0, 0x07, 0x8b,
+  0x0f, 0xd3, 0x9e, 0xd6, 0x1f, 0xfd, 0x06, 0xdb, 0x5e, 0x7c, 0x96, 0x1e,
+  0xe1, 0x65, 0x29, 0x86, 0x43, 0x24, 0x04, 0x7c, 0x50, 0xeb, 0x7b, 0xde,
+  0xa4, 0xb3, 0x81, 0xcd, 0x63, 0xab, 0xdd, 0xd9, 0x5e, 0x36, 0x11, 0x62,
+  0x19, 0xd8, 0x2d, 0x6d, 0x07, 0x1e, 0x33, 0xd0, 0x05, 0x19, 0x73, 0x40,
+  0xde, 0xdf, 0x86, 0xee, 0xb7, 0xbf, 0xf9, 0xa6, 0x8d, 0xc3, 0xd8, 0x5b,
+  0x98, 0xe2, 0x4d, 0x11, 0x2c, 0x60, 0xf8, 0x24, 0x35, 0x43, 0x9b, 0x5a,
+  0x42, 0x43, 0x49, 0xd4, 0x12, 0x7e, 0xf0, 0x5d, 0x92, 0xbc, 0x3d, 0xb9,
+  0x38, 0x12, 0x0b, 0x3c, 0x26, 0x16, 0x78, 0x97, 0x98, 0x19, 0x1c, 0xb9,
+  0x05, 0x6f, 0xd8, 0xf7, 0xd5, 0xe1, 0x45, 0x2d, 0x29, 0x13, 0x2e, 0x09,
+  0xc9, 0x01, 0x72, 0x58, 0x4c, 0x6a, 0x94, 0x1b, 0xfa, 0x79, 0xea, 0xa2,
+  0x1f, 0x91, 0xa6, 0x82, 0x41, 0xd5, 0xf9, 0xd7, 0xe9, 0x40, 0xe8, 0xdd,
+  0x9a, 0x96, 0x9d, 0xbc, 0xe4, 0xca, 0x1e, 0x0e, 0x02, 0x14, 0x2e, 0x6c,
+  0x5f, 0x37, 0x36, 0x89, 0x00, 0xb1, 0x23, 0xb8, 0x17, 0xb5, 0x2d, 0xb3,
+  0xe4, 0x53, 0x31, 0xec, 0x41, 0x3a, 0x63, 0x33, 0x1d, 0x69, 0xa1, 0xaa,
+  0x5b, 0xab, 0x99, 0xa1, 0x40, 0xd8, 0xc7, 0xcb, 0xc4, 0xc7, 0xfe, 0xda,
+  0x28, 0x45, 0x1b, 0x93, 0xbf, 0x73, 0x09, 0x89, 0x96, 0x7b, 0x1e, 0xb5,
+  0xe3, 0x20, 0x19, 0x9f, 0x20, 0x73, 0x1c, 0xe4, 0x97, 0x79, 0x15, 0x15,
+  0xa6, 0x5d, 0x07, 0x92, 0xdc, 0xe0, 0xcc, 0x50, 0x8e, 0xfc, 0x93, 0xb0,
+  0xc3, 0x64, 0xad, 0x84, 0x0b, 0xa7, 0xe2, 0xf4, 0x14, 0xfc, 0xa3, 0x98,
+  0xae, 0x29, 0x5a, 0x73, 0x36, 0x1a, 0x98, 0xec, 0xce, 0x8f, 0x75, 0xe8,
+  0x7b, 0x3d, 0xa7, 0xa4, 0x9e, 0x7f, 0x24, 0x23, 0x1d, 0x9c, 0x9b, 0x62,
+  0xd2, 0xe1, 0x6e, 0x43, 0xbf, 0x16, 0xff, 0x21, 0xe9, 0x8b, 0xf9, 0x24,
+  0xf0, 0xc3, 0xcb, 0x2c, 0x4a, 0x64, 0x59, 0x2b, 0xdd, 0x74, 0xd9, 0x5d,
+  0x30, 0x09, 0xbe, 0x21, 0xd5, 0xea, 0x1d, 0xac, 0x60, 0xd0, 0x87, 0xd7,
+  0xa8, 0x7c, 0xe0, 0x30, 0xbf, 0x9c, 0xcf, 0x22, 0xf9, 0xf5, 0x0d, 0x9a,
+  0x5b, 0x94, 0x43, 0xa8, 0x12, 0x4f, 0x4e, 0x60, 0xf2, 0x67, 0x12, 0xc8,
+  0x2d, 0x59, 0x3d, 0x87, 0x20, 0xb9, 0x52, 0x0e, 0xb9, 0xb8, 0x8e, 0xdb,
+  0x64, 0x54, 0x0d, 0x84, 0x61, 0x68, 0x3f, 0x6a, 0xc5, 0x25, 0xfe, 0x7e,
+  0x49, 0x98, 0xea, 0x3a, 0x15, 0xb5, 0xc5, 0x8b, 0xbb, 0xe7, 0xd2, 0x74,
+  0x3b, 0x78, 0xbb, 0xd0, 0xbc, 0x49, 0xe5, 0x60, 0x56, 0x34, 0x53, 0xca,
+  0x88, 0x11, 0xd3, 0xe2, 0x45, 0x1d, 0x80, 0xae, 0x32, 0x2a, 0xd2, 0x81,
+  0x86, 0x92, 0x29, 0x7a, 0x04, 0x4d, 0x57, 0x4a, 0x1d, 0xfb, 0xbd, 0x50,
+  0x39, 0x02, 0x77, 0x22, 0x59, 0xf7, 0x65, 0x57, 0x99, 0xf2, 0xd1, 0xd8,
+  0x61, 0x02, 0x21, 0xf3, 0x36, 0x6c, 0x5a, 0x0a, 0x83, 0x76, 0xc5, 0x96,
+  0x62, 0x61, 0xf7, 0x35, 0x58, 0xc9, 0xec, 0x63, 0x85, 0xc0, 0xf3, 0x54,
+  0xe8, 0xcc, 0x84, 0x8a, 0xf3, 0xe3, 0xff, 0x71, 0x14, 0x25, 0x2e, 0x19,
+  0x46, 0x88, 0x37, 0x3e, 0x0f, 0xb5, 0x6a, 0x3a, 0x16, 0xa3, 0x94, 0x19,
+  0x49, 0x54, 0xe4, 0xe9, 0xc9, 0xf9, 0x05, 0x1f, 0x82, 0xd3, 0x77, 0x17,
+  0xb2, 0xb7, 0xc3, 0xf9, 0xa4, 0xcf, 0x63, 0x47, 0xca, 0x16, 0x9f, 0xf3,
+  0xe5, 0x1c, 0x08, 0x09, 0xb4, 0x27, 0xb4, 0x54, 0x5f, 0x38, 0x17, 0x0e,
+  0xfb, 0xd6, 0x34, 0xeb, 0x51, 0xeb, 0x3a, 0x2f, 0x24, 0x0e, 0x10, 0xbe,
+  0x19, 0x7a, 0x13, 0x75, 0x08, 0x4c, 0xe4, 0xa1, 0x34, 0x82, 0x94, 0x2f,
+  0xc6, 0xf5, 0x31, 0x5f, 0x89, 0x55, 0x9c, 0x12, 0x83, 0xf8, 0x6c, 0x5a,
+  0x94, 0x62, 0x22, 0x87, 0x55, 0xe9, 0x33, 0xc2, 0x33, 0xa1, 0x1c, 0x8b,
+  0x4c, 0x3d, 0xa4, 0xaa, 0xea, 0x63, 0xa3, 0x64, 0xa9, 0xe1, 0x84, 0xe4,
+  0xa5, 0x52, 0x01, 0xac, 0x11, 0x95, 0xda, 0xe5, 0x5c, 0x44, 0x6c, 0x0f,
+  0x88, 0x02, 0x0e, 0xd8, 0x44, 0x20, 0x96, 0x60, 0x30, 0xc3, 0xf9, 0x28,
+  0x0a, 0xe0, 0xf1, 0x12, 0x9c, 0x13, 0x96, 0xc6, 0xf3, 0x8a, 0x31, 0x3d,
+  0xb3, 0x8f, 0xfd, 0x11, 0x2c, 0xe7, 0x75, 0x66, 0x15, 0x60, 0xd4, 0x10,
+  0xd8, 0x49, 0xab, 0xfd, 0xb8, 0x5e, 0x92, 0x22, 0xd1, 0x79, 0xcb, 0xd7,
+  0x58, 0x3c, 0xe9, 0x12, 0x70, 0xa0, 0x96, 0x4e, 0xb1, 0xb8, 0xcb, 0x01,
+  0xff, 0x52, 0x2e, 0x6b, 0x6e, 0x7e, 0x67, 0xa7, 0xf3, 0xf8, 0xf1, 0x8a,
+  0xf0, 0x72, 0x61, 0x6e, 0xe2, 0x89, 0x4c, 0xa7, 0x48, 0xa8, 0x4e, 0xfc,
+  0x44, 0xdb, 0xfb, 0x18, 0xce, 0x80, 0xfa, 0xf4, 0xf0, 0x93, 0x86, 0xc0,
+  0x13, 0x78, 0x24, 0x1f, 0xcf, 0xc7, 0xc1, 0xb4, 0x3b, 0xa4, 0x17, 0x26,
+  0xfd, 0x5b, 0x5e, 0x2f, 0x46, 0xa3, 0xd6, 0x20, 0x0f, 0x5c, 0xb4, 0x0e,
+  0xd2, 0x14, 0x37, 0x14, 0x64, 0x83, 0x50, 0xb0, 0x1b, 0x8f, 0x62, 0x89,
+  0x05, 0xa5, 0x58, 0x22, 0x03, 0xb6, 0x05, 0x2c, 0x70, 0x1d, 0x09, 0x82,
+  0xe5, 0x71, 0xe2, 0xce, 0x03, 0xbb, 0x0f, 0x84, 0xb1, 0xc3, 0xe0, 0xe0,
+  0xf0, 0x45, 0xc5, 0x2d, 0xe3, 0x8c, 0x38, 0x69, 0x97, 0x2a, 0x2c, 0x60,
+  0x84, 0x81, 0x75, 0x98, 0x92, 0xd5, 0x55, 0x1b, 0x82, 0xbf, 0x24, 0xdc,
+  0x22, 0x73, 0xd1, 0x31, 0xc2, 0x6e, 0x75, 0xb7, 0xde, 0x9d, 0xbd, 0x96,
+  0xdb, 0x33, 0x75, 0x36, 0x6d, 0x04, 0xbd, 0x1f, 0x65, 0xa4, 0xb2, 0x0f,
+  0xc9, 0xf8, 0x2b, 0x70, 0xd9, 0x66, 0x2b, 0xa7, 0xa5, 0x40, 0x6c, 0x44,
+  0x4a, 0xca, 0x55, 0x67, 0x26, 0xda, 0x73, 0x60, 0x92, 0x55, 0x3e, 0x12,
+  0x9e, 0x12, 0x8d, 0x8e, 0x9c, 0x91, 0x38, 0x74, 0x16, 0x82, 0xd5, 0x3c,
+  0x99, 0x33, 0xde, 0x7f, 0xfd, 0x62, 0xc4, 0x96, 0x17, 0xd0, 0x62, 0xea,
+  0x88, 0x42, 0xae, 0x5e, 0x0d, 0x7a, 0x5d, 0xd0, 0x99, 0x95, 0x8d, 0xea,
+  0x74, 0x76, 0xe1, 0x30, 0xe6, 0x88, 0x16, 0xbc, 0xb3, 0x08, 0x1a, 0x6c,
+  0xbd, 0xdd, 0x7c, 0xd7, 0x92, 0x28, 0x99, 0xb7, 0x62, 0x64, 0x32, 0xc3,
+  0x0c, 0x6f, 0x6b, 0x08, 0xf3, 0x78, 0xc7, 0x17, 0x50, 0xea, 0x76, 0x94,
+  0x62, 0x4a, 0x2c, 0x1b, 0x03, 0x3f, 0x61, 0xf8, 0x30, 0xe0, 0xc5, 0x6b,
+  0x70, 0xb9, 0xb2, 0x60, 0xb7, 0x01, 0xab, 0xb4, 0x36, 0x16, 0x96, 0xbc,
+  0x0e, 0xb7, 0x39, 0xa8, 0xe5, 0xf0, 0xd9, 0xda, 0xd5, 0x5a, 0xb2, 0x0e,
+  0xfb, 0x3c, 0xe3, 0x6a, 0x50, 0xc9, 0xda, 0x00, 0x5e, 0xd9, 0x5c, 0x1f,
+  0xa4, 0x5c, 0xa4, 0x8b, 0xc5, 0xce, 0x9d, 0xc7, 0x98, 0x87, 0x3f, 0x9f,
+  0x51, 0xdb, 0x1b, 0xbe, 0x6a, 0x82, 0x41, 0xeb, 0xea, 0x58, 0xda, 0x52,
+  0x9f, 0x3a, 0x69, 0xe1, 0x9c, 0xdc, 0x44, 0xdb, 0xc4, 0x37, 0x8d, 0x46,
+  0x43, 0xd1, 0x25, 0x39, 0xc5, 0xf0, 0x31, 0x76, 0xe1, 0x08, 0x45, 0xc3,
+  0x91, 0x2b, 0x54, 0x93, 0xac, 0x12, 0xe8, 0xf6, 0x56, 0x80, 0xba, 0xc3,
+  0x97, 0x78, 0x26, 0x6d, 0xcb, 0xfa, 0x64, 0x50, 0xeb, 0xca, 0x10, 0xe1,
+  0x8c, 0x48, 0x75, 0x07, 0x98, 0x3c, 0x92, 0x27, 0x22, 0xf0, 0x96, 0x7c,
+  0xd7, 0x26, 0xd9, 0x28, 0x9d, 0x92, 0xc2, 0x9a, 0x23, 0x1f, 0x95, 0x50,
+  0x8a, 0xec, 0x3a, 0x2f, 0xe6, 0x65, 0x5c, 0xe4, 0x1e, 0xc8, 0xcc, 0xc8,
+  0x28, 0x4e, 0x92, 0xd1, 0x6b, 0x42, 0x2b, 0x4a, 0xc3, 0xd8, 0x46, 0xa3,
+  0x5c, 0xe4, 0x6a, 0xc2, 0xaf, 0x19, 0xcd, 0x35, 0xae, 0x5e, 0xa3, 0x4f,
+  0x8c, 0x92, 0x35, 0x46, 0x49, 0x0f, 0x3c, 0x36, 0x48, 0xfc, 0x7f, 0x2c,
+  0x8e, 0x1f, 0x24, 0x0a, 0x90, 0x5b, 0xb7, 0xf8, 0x38, 0x73, 0xab, 0x8a,
+  0xd9, 0x2d, 0x17, 0x3b, 0x56, 0x50, 0x51, 0xdd, 0x6a, 0x02, 0xfd, 0x81,
+  0x0e, 0xd3, 0x77, 0xa3, 0xa4, 0xfb, 0x10, 0x43, 0x8b, 0x48, 0x84, 0x75,
+  0x55, 0xaf, 0x34, 0x2a, 0x4d, 0x7d, 0xe1, 0xf4, 0x4c, 0x5b, 0xa4, 0x18,
+  0x11, 0x99, 0xf9, 0x45, 0xdd, 0xf5, 0x51, 0x7a, 0x0b, 0xba, 0xcb, 0x25,
+  0x17, 0xfc, 0x21, 0xad, 0x92, 0x42, 0x90, 0x8a, 0x4a, 0x5d, 0xcd, 0x14,
+  0x5c, 0x65, 0x3a, 0x2c, 0xae, 0x16, 0x19, 0xee, 0x27, 0x56, 0x67, 0x50,
+  0xd2, 0x1a, 0xda, 0xe1, 0x26, 0x30, 0x4f, 0x94, 0x13, 0x07, 0x98, 0x54,
+  0x80, 0xb8, 0x74, 0x56, 0x74, 0xc2, 0xed, 0xb4, 0xd6, 0xac, 0x62, 0x5d,
+  0x94, 0xab, 0x3e, 0x64, 0x89, 0x15, 0x04, 0xe3, 0xb3, 0xea, 0x57, 0x70,
+  0x2f, 0xde, 0x4c, 0xa6, 0xa1, 0xed, 0x3d, 0x23, 0x06, 0x5e, 0x82, 0xd6,
+  0xde, 0xe6, 0xf6, 0x5e, 0xd9, 0x22, 0x31, 0x80, 0x2a, 0xb7, 0xe0, 0x32,
+  0x03, 0x09, 0xee, 0x36, 0xd2, 0xed, 0x63, 0xa2, 0x5c, 0x11, 0xe7, 0x5b,
+  0xbb, 0x9b, 0x8f, 0xaf, 0x5a, 0xe8, 0xbc, 0x56, 0xa7, 0x86, 0x6c, 0xf0,
+  0x12, 0x18, 0xf4, 0xcb, 0x51, 0xd1, 0x43, 0x15, 0x10, 0xd7, 0xcf, 0x02,
+  0x62, 0x27, 0x99, 0xe8, 0xe9, 0x91, 0x0a, 0xc8, 0x30, 0x1a, 0xa9, 0x46,
+  0x8f, 0xd1, 0xa5, 0x39, 0x24, 0xa4, 0x0d, 0x01, 0x43, 0xd7, 0xbb, 0xe6,
+  0x3e, 0x84, 0xd6, 0x4f, 0xc8, 0xc8, 0x28, 0x17, 0x6e, 0x47, 0x68, 0x7f,
+  0x67, 0xb3, 0xb1, 0x96, 0x6a, 0xd2, 0xed, 0x76, 0x1b, 0x9e, 0xde, 0xdd,
+  0xbc, 0xfa, 0x84, 0xa7, 0xb7, 0x1f, 0x6f, 0x8e, 0x97, 0x3e, 0xbe, 0x90,
+  0x61, 0x85, 0xb6, 0x98, 0x28, 0xc3, 0x8a, 0x76, 0x8b, 0x5b, 0xe2, 0xbb,
+  0x98, 0xc8, 0xb6, 0x43, 0x14, 0xeb, 0x2e, 0xe4, 0x9b, 0x08, 0xb2, 0x4e,
+  0x05, 0x45, 0x03, 0xc1, 0xb7, 0x3a, 0xef, 0xe4, 0xab, 0x61, 0xb1, 0x0d,
+  0xe1, 0xf3, 0x45, 0x66, 0xa4, 0xf2, 0x81, 0xac, 0x2c, 0x0d, 0x1d, 0x24,
+  0x3d, 0x62, 0x7a, 0xce, 0x1c, 0xa3, 0xa0, 0x3c, 0x7c, 0xc2, 0x8d, 0xe4,
+  0xdc, 0x74, 0x3d, 0xa5, 0x1c, 0x51, 0x44, 0x72, 0x0e, 0x45, 0x47, 0x70,
+  0x39, 0x68, 0xa5, 0xf0, 0x74, 0x54, 0x21, 0xea, 0x6f, 0x1b, 0xc9, 0xfb,
+  0xa6, 0x5b, 0xcb, 0x7a, 0x84, 0x8f, 0x1e, 0x2e, 0xc7, 0x11, 0xdb, 0xbf,
+  0x47, 0x14, 0xba, 0x59, 0x4d, 0x04, 0xaa, 0x66, 0x1d, 0x9d, 0xac, 0x2e,
+  0x32, 0xa5, 0x10, 0xcf, 0xb0, 0x54, 0x12, 0x86, 0xdc, 0xc2, 0x2d, 0x1f,
+  0x43, 0xb2, 0x6a, 0xf2, 0x35, 0x3d, 0x81, 0x8f, 0x60, 0x8d, 0x3e, 0x55,
+  0xc1, 0x68, 0x95, 0xd5, 0x88, 0x17, 0x40, 0x14, 0x38, 0x47, 0xa7, 0x97,
+  0x85, 0x5a, 0x78, 0x21, 0x31, 0xc2, 0x20, 0x54, 0x29, 0x25, 0x95, 0x3d,
+  0xd8, 0x70, 0x26, 0xe1, 0x06, 0x0f, 0x9b, 0x6b, 0xd2, 0xa8, 0x3a, 0x13,
+  0x82, 0x24, 0x2a, 0xd5, 0x3e, 0x48, 0x6e, 0x83, 0xbb, 0xeb, 0x5b, 0x0c,
+  0x82, 0x69, 0xb5, 0x1c, 0xe4, 0x57, 0x98, 0x0b, 0x8d, 0x94, 0xbe, 0x18,
+  0x1b, 0xaf, 0x91, 0xeb, 0x39, 0x8a, 0x9c, 0xd1, 0x3a, 0xa3, 0x76, 0x8d,
+  0xf0, 0x9b, 0x9c, 0x7d, 0x91, 0xa3, 0xbc, 0xcd, 0x31, 0x3c, 0x78, 0x95,
+  0xbf, 0x96, 0x01, 0x29, 0x8c, 0x19, 0x4d, 0x85, 0xd5, 0x0a, 0x19, 0x4b,
+  0xbd, 0x6a, 0x30, 0xf3, 0xdc, 0x11, 0x08, 0xcd, 0x40, 0x28, 0xe8, 0x5d,
+  0xd7, 0xba, 0x9b, 0x82, 0x74, 0x1a, 0xd6, 0x08, 0x9e, 0xd7, 0x28, 0x0a,
+  0x9b, 0x84, 0x71, 0x0b, 0x99, 0xd3, 0x1d, 0xa9, 0x13, 0xe1, 0x16, 0x5d,
+  0x49, 0x98, 0x5e, 0xe0, 0x17, 0xd2, 0x43, 0x4b, 0xe9, 0x68, 0x08, 0x8b,
+  0xa6, 0x55, 0x08, 0x5b, 0xf7, 0xe3, 0x07, 0xdc, 0xf9, 0xbe, 0x2c, 0x4d,
+  0xe7, 0xf5, 0x27, 0xb4, 0x73, 0xf7, 0x3b, 0x0b, 0x94, 0x8d, 0x7e, 0xb1,
+  0x4e, 0x8a, 0x50, 0x9c, 0xc2, 0x4f, 0x64, 0x6f, 0x84, 0xca, 0xff, 0x8b,
+  0xa9, 0x1c, 0x03, 0x63, 0xe4, 0x1b, 0x4a, 0x9f, 0x8f, 0x48, 0xfd, 0x02,
+  0x23, 0xb3, 0x8d, 0x88, 0xe8, 0x51, 0xf1, 0x2c, 0x59, 0x42, 0xe5, 0xdc,
+  0x22, 0x56, 0x49, 0x4b, 0xeb, 0xd4, 0x72, 0x79, 0x0e, 0x99, 0xbb, 0x74,
+  0xe0, 0x2c, 0x83, 0x40, 0xcd, 0x06, 0x1d, 0x03, 0x57, 0x73, 0x41, 0x9c,
+  0x1a, 0x16, 0x85, 0xd8, 0x13, 0x1e, 0x7d, 0x6d, 0xa6, 0xab, 0x81, 0x7d,
+  0x00, 0x11, 0x6a, 0xa1, 0x5b, 0xed, 0x2e, 0x5c, 0x16, 0xf6, 0x92, 0x83,
+  0x25, 0xe1, 0xa2, 0x48, 0x1a, 0x19, 0x25, 0x84, 0x85, 0xd5, 0x13, 0xa7,
+  0x68, 0x37, 0x1f, 0x5a, 0x50, 0x80, 0xfa, 0x32, 0x78, 0x54, 0x8b, 0x22,
+  0xb0, 0x99, 0x8b, 0xcb, 0xf4, 0x3a, 0x0b, 0x36, 0x1e, 0x71, 0x04, 0x45,
+  0x41, 0x2f, 0xc0, 0x46, 0xf5, 0xeb, 0xe0, 0x03, 0x89, 0x43, 0x72, 0x95,
+  0x8f, 0x71, 0x40, 0x61, 0x87, 0x0b, 0xcd, 0xfb, 0xf2, 0xc3, 0x01, 0x84,
+  0x24, 0x84, 0xc1, 0xba, 0x09, 0x92, 0x1e, 0x2c, 0x1f, 0x18, 0x3c, 0x12,
+  0x4e, 0x31, 0xec, 0x5f, 0x3a, 0x42, 0x34, 0xdb, 0x5b, 0x2e, 0x2b, 0x5c,
+  0xea, 0x88, 0xbc, 0x8f, 0xc8, 0x8d, 0x99, 0x1d, 0x28, 0x64, 0xbc, 0xc1,
+  0x52, 0xa3, 0x37, 0x33, 0x34, 0x62, 0x4c, 0x82, 0xdc, 0x8e, 0xee, 0x00,
+  0xac, 0xbd, 0x9c, 0x14, 0xfd, 0x3e, 0x0a, 0x0b, 0xa0, 0xba, 0xcd, 0x27,
+  0x23, 0x0c, 0x2d, 0x08, 0x9a, 0x1d, 0x36, 0x62, 0x69, 0xf6, 0x42, 0x31,
+  0x7d, 0x90, 0x0f, 0x4c, 0x01, 0x50, 0x2f, 0x45, 0xb4, 0x7d, 0x41, 0x6c,
+  0xb0, 0x50, 0x9e, 0x30, 0x4d, 0x4e, 0x12, 0x70, 0x3a, 0x9c, 0xa1, 0xc1,
+  0x04, 0xb0, 0x00, 0xb7, 0x49, 0x5c, 0xfa, 0x18, 0xaf, 0x12, 0xb5, 0x26,
+  0x21, 0x79, 0x72, 0xb9, 0xdc, 0xe4, 0x3f, 0x3a, 0x25, 0x4b, 0xa7, 0xd0,
+  0xdd, 0xfa, 0x6d, 0x56, 0x6d, 0x04, 0x49, 0x2c, 0x86, 0x83, 0xd3, 0xde,
+  0xc9, 0x56, 0x15, 0x59, 0x5e, 0x08, 0x69, 0xc1, 0x85, 0x2b, 0x8a, 0xbc,
+  0x05, 0xf7, 0x35, 0x07, 0xdf, 0x83, 0x28, 0x33, 0xcd, 0x1c, 0xd0, 0x8b,
+  0x86, 0x92, 0x44, 0xc2, 0x93, 0x9a, 0xc4, 0x48, 0xca, 0xe6, 0x32, 0x7f,
+  0x4a, 0xe6, 0xf4, 0x67, 0x4b, 0x5f, 0x6b, 0xb1, 0x9d, 0x30, 0x56, 0x0e,
+  0x84, 0xe9, 0x23, 0x77, 0x36, 0xf4, 0x53, 0x9a, 0x83, 0xbd, 0xf6, 0x9f,
+  0x2d, 0xb5, 0x30, 0xc2, 0x19, 0xb6, 0x21, 0x58, 0x5e, 0x14, 0x0c, 0x71,
+  0x94, 0xf7, 0xb5, 0xe0, 0x9e, 0xd9, 0x13, 0xc9, 0xeb, 0xbb, 0xb1, 0x00,
+  0xb1, 0x70, 0xf4, 0x31, 0x9b, 0xf5, 0xc9, 0x92, 0xfa, 0xdb, 0x7c, 0x00,
+  0xaf, 0xd1, 0x45, 0xc0, 0xde, 0x9f, 0x61, 0x0d, 0x6e, 0x26, 0xc9, 0x24,
+  0xf8, 0x05, 0x2d, 0x64, 0xba, 0x53, 0x92, 0x3f, 0xd2, 0x4d, 0x0e, 0x92,
+  0x59, 0x71, 0x39, 0x77, 0x35, 0xdf, 0x30, 0x57, 0x80, 0x43, 0x91, 0x28,
+  0x0c, 0x54, 0xd7, 0x01, 0x03, 0x62, 0x92, 0xe7, 0xaf, 0x5f, 0x07, 0x43,
+  0xae, 0x2b, 0x70, 0xc7, 0x28, 0xd3, 0x9a, 0x66, 0x90, 0xa0, 0xdd, 0x09,
+  0xef, 0x91, 0xe8, 0xe2, 0x42, 0x87, 0xa1, 0x66, 0xad, 0x98, 0xf9, 0x08,
+  0x46, 0xaa, 0x46, 0x2c, 0xb4, 0x51, 0xc3, 0xf5, 0x56, 0x0c, 0xab, 0x9b,
+  0x34, 0x06, 0xbe, 0x6c, 0xe4, 0x85, 0x4d, 0xe0, 0x97, 0x62, 0xb1, 0xb8,
+  0x23, 0x42, 0x77, 0x41, 0x56, 0x59, 0x68, 0xf7, 0x4e, 0xd1, 0xe5, 0xe4,
+  0xbf, 0x9a, 0xd8, 0xfb, 0xa6, 0xf8, 0x2d, 0x17, 0xdc, 0x85, 0xc6, 0x94,
+  0x95, 0xaf, 0x9f, 0xb4, 0xe3, 0xcf, 0x65, 0x2f, 0x66, 0x98, 0x6c, 0x2e,
+  0x21, 0xcc, 0x84, 0x4c, 0x2d, 0x0e, 0x1c, 0x17, 0x11, 0xc4, 0xc0, 0xec,
+  0x3e, 0xea, 0x9a, 0x39, 0x0c, 0x86, 0xc3, 0x64, 0x0a, 0x61, 0xb0, 0x4e,
+  0x86, 0xf0, 0xe0, 0xec, 0x27, 0xb3, 0xbf, 0x18, 0x42, 0x35, 0xcc, 0x52,
+  0xd9, 0xa5, 0x43, 0x2d, 0xd1, 0x7a, 0x5b, 0x30, 0x49, 0xc3, 0x3b, 0x1f,
+  0x76, 0x37, 0x56, 0xe7, 0xb1, 0x8b, 0x11, 0x86, 0x5d, 0x4b, 0x58, 0xc2,
+  0x50, 0xf0, 0x70, 0x4b, 0xb0, 0xab, 0x5a, 0x1b, 0x49, 0x13, 0x57, 0xa5,
+  0xd0, 0x31, 0x3d, 0x92, 0x80, 0x08, 0xfa, 0x9d, 0x94, 0xb8, 0x2b, 0xb6,
+  0xcc, 0x05, 0xa4, 0xd9, 0x5a, 0xb7, 0xc1, 0x01, 0xad, 0x38, 0xb5, 0x93,
+  0xeb, 0x82, 0xbe, 0x61, 0xfb, 0x4d, 0x2d, 0xa5, 0x28, 0x64, 0xd2, 0x93,
+  0xa9, 0xab, 0x81, 0xd5, 0x5f, 0x84, 0xf5, 0x0a, 0x1c, 0xaf, 0x08, 0xd9,
+  0x90, 0x30, 0x01, 0x89, 0x17, 0x33, 0x04, 0xa9, 0xc0, 0x26, 0x3c, 0x12,
+  0x1e, 0x5c, 0x8a, 0x6d, 0x64, 0x0e, 0x08, 0xf3, 0x9e, 0x64, 0x23, 0x0c,
+  0x2a, 0x74, 0x70, 0x52, 0xf5, 0x8b, 0x80, 0x58, 0xbd, 0xe3, 0xf2, 0xce,
+  0x39, 0x6a, 0xb8, 0xfb, 0xfe, 0x0a, 0xe2, 0xc8, 0xd4, 0x84, 0x2b, 0x75,
+  0xc2, 0x1f, 0xfd, 0xab, 0xa2, 0xd0, 0x1b, 0xdf, 0xc6, 0x4d, 0x12, 0x4a,
+  0xb0, 0x4b, 0x35, 0x1e, 0x25, 0x41, 0x6a, 0x70, 0x22, 0xe0, 0x42, 0xd1,
+  0xd3, 0xc0, 0x50, 0xba, 0xd1, 0x75, 0xa8, 0x6c, 0x83, 0xba, 0x26, 0xa9,
+  0x33, 0xbe, 0x0a, 0x89, 0x33, 0xf0, 0x9f, 0xf1, 0x6c, 0xad, 0xb4, 0xa8,
+  0x5c, 0x6f, 0x7e, 0xde, 0x4d, 0x17, 0x87, 0xd5, 0x57, 0xa7, 0x1d, 0x27,
+  0xab, 0xee, 0x24, 0x89, 0x84, 0x03, 0x96, 0x3e, 0x61, 0x15, 0xf1, 0x16,
+  0xfa, 0x8f, 0x9d, 0xad, 0xb0, 0xcf, 0x92, 0x83, 0x85, 0x4d, 0x18, 0x88,
+  0xd9, 0x34, 0x95, 0x48, 0x39, 0x61, 0xd3, 0x7c, 0xb1, 0x70, 0x12, 0x56,
+  0x42, 0xec, 0x0f, 0x03, 0xc9, 0xc8, 0x25, 0x16, 0x52, 0xb4, 0xac, 0xab,
+  0x5a, 0xb0, 0xeb, 0x9c, 0xbd, 0x6a, 0x81, 0xc4, 0xd2, 0x52, 0x6a, 0xe7,
+  0x31, 0x73, 0x4a, 0xcb, 0xba, 0xf5, 0x81, 0xed, 0x93, 0xb0, 0xad, 0xa1,
+  0xfa, 0xe0, 0x72, 0x90, 0x86, 0xb6, 0xf7, 0xd3, 0x65, 0xee, 0xd2, 0x97,
+  0x08, 0x55, 0x9e, 0xd8, 0xc0, 0x4c, 0x2d, 0x9a, 0x58, 0x07, 0xa2, 0xf5,
+  0x95, 0xa1, 0xf2, 0x73, 0xee, 0xa6, 0x81, 0x36, 0xf3, 0xca, 0xe2, 0xd2,
+  0x06, 0x89, 0x8e, 0xf8, 0x85, 0x9d, 0x6e, 0x94, 0xe8, 0x16, 0x0d, 0x2d,
+  0xd1, 0x88, 0x42, 0x48, 0x52, 0x68, 0x44, 0x82, 0x5e, 0xd8, 0x18, 0x50,
+  0x13, 0xb3, 0x94, 0x21, 0xd9, 0xa8, 0x13, 0x9e, 0x84, 0x54, 0x5d, 0x20,
+  0x45, 0x0c, 0x47, 0x35, 0xce, 0x39, 0xb8, 0x1f, 0x29, 0xbc, 0x45, 0x31,
+  0x46, 0xea, 0x27, 0x6b, 0x09, 0xa7, 0xb3, 0xc2, 0xed, 0xe4, 0xae, 0xa1,
+  0x22, 0x5b, 0x56, 0x25, 0x97, 0xa9, 0x35, 0x01, 0x89, 0x76, 0x9e, 0xaa,
+  0x61, 0x2c, 0x96, 0x91, 0x83, 0xc4, 0x09, 0x7a, 0x72, 0xd1, 0xcf, 0x29,
+  0x56, 0x43, 0x62, 0x99, 0xd5, 0x3d, 0x40, 0x02, 0x2d, 0x25, 0x7d, 0xe5,
+  0xe6, 0x06, 0x11, 0x85, 0xd2, 0x79, 0xc7, 0xcc, 0x8b, 0x14, 0x19, 0x9e,
+  0x17, 0x73, 0xe3, 0xee, 0x54, 0x67, 0x4e, 0x96, 0xde, 0x2a, 0xe1, 0x92,
+  0x58, 0xe9, 0xd1, 0xbb, 0xbe, 0xdf, 0xb9, 0xf3, 0x86, 0x42, 0x58, 0xa0,
+  0x76, 0xc4, 0x0c, 0xcd, 0xd0, 0xd1, 0x70, 0x43, 0x26, 0xf5, 0x15, 0xed,
+  0xa4, 0x8a, 0xb2, 0x7f, 0xc8, 0xdc, 0x3a, 0xaa, 0xd6, 0xdd, 0x0f, 0xee,
+  0x31, 0x34, 0x7c, 0xb0, 0xa9, 0x9e, 0x4f, 0x00, 0x1b, 0xa3, 0x06, 0x59,
+  0xaa, 0xd0, 0x10, 0x76, 0xd6, 0xf2, 0x61, 0x6d, 0xd3, 0x18, 0x73, 0x84,
+  0xd8, 0x93, 0x55, 0x92, 0x40, 0xf7, 0x0e, 0x9f, 0xfb, 0xc0, 0x21, 0x0b,
+  0x33, 0xb4, 0x38, 0x3c, 0x71, 0xf1, 0xfc, 0xb0, 0xcc, 0xde, 0xa7, 0x5d,
+  0xe4, 0xc8, 0xf9, 0x85, 0x69, 0x10, 0xfb, 0x20, 0xff, 0x95, 0x5c, 0x91,
+  0x76, 0x48, 0x29, 0x4c, 0x1b, 0x8f, 0x7a, 0xab, 0x83, 0xa0, 0x1e, 0x6c,
+  0xc7, 0xf3, 0x62, 0x04, 0x73, 0xa1, 0x26, 0xc1, 0x25, 0x5e, 0xa3, 0x55,
+  0xcb, 0xeb, 0x24, 0xbe, 0x10, 0xb3, 0x16, 0x61, 0xf6, 0x39, 0x5e, 0xf5,
+  0xce, 0xb1, 0x8b, 0x7b, 0x6c, 0x2f, 0xb5, 0xc9, 0x36, 0x84, 0x3e, 0x01,
+  0xad, 0x6c, 0x0b, 0xe2, 0x40, 0xf3, 0xb7, 0x3b, 0x2b, 0xc9, 0x3a, 0x67,
+  0x4e, 0xd6, 0x09, 0xa6, 0xd6, 0x37, 0x16, 0xc5, 0xef, 0x35, 0x01, 0x72,
+  0x64, 0x93, 0x08, 0x24, 0xf1, 0x70, 0xb8, 0x2c, 0x15, 0xf4, 0xda, 0x24,
+  0xbd, 0xb8, 0x5d, 0xe5, 0x6c, 0x1f, 0xce, 0xb8, 0x55, 0x2f, 0x32, 0xed,
+  0x19, 0xe7, 0x73, 0x0c, 0x43, 0xe2, 0x4d, 0x7a, 0x9d, 0xe6, 0x23, 0x5e,
+  0x4a, 0xb6, 0xaf, 0x84, 0xec, 0x19, 0x8e, 0x95, 0x61, 0x89, 0xe9, 0x32,
+  0xb3, 0xd2, 0x5a, 0x25, 0x73, 0x33, 0x1d, 0x49, 0x6c, 0x32, 0x6b, 0x9a,
+  0xda, 0x17, 0xd9, 0x55, 0x2a, 0x54, 0xbe, 0xca, 0x8e, 0x92, 0xab, 0x04,
+  0xe8, 0x72, 0x58, 0x14, 0xab, 0x99, 0x20, 0xfc, 0xd1, 0xe2, 0xa3, 0x8e,
+  0x4d, 0xa0, 0xdb, 0x71, 0x10, 0x9d, 0xf0, 0xeb, 0xac, 0x53, 0x4c, 0x3a,
+  0x74, 0xdf, 0x68, 0x2d, 0x32, 0xfc, 0x50, 0x0a, 0xc3, 0xb3, 0xd0, 0xca,
+  0x8b, 0x07, 0xeb, 0x8d, 0xe6, 0x2e, 0xaf, 0x8f, 0x4a, 0x42, 0x6c, 0x14,
+  0x66, 0x02, 0x0f, 0x89, 0x2d, 0x91, 0x1e, 0x24, 0x5e, 0xaa, 0xce, 0x18,
+  0x14, 0x0d, 0xb5, 0x51, 0x62, 0xa2, 0x41, 0x10, 0x16, 0x8b, 0x1d, 0xd9,
+  0xbd, 0x32, 0x4c, 0x2f, 0x0c, 0x16, 0x32, 0x92, 0xbd, 0x46, 0x19, 0x4b,
+  0x65, 0x2e, 0x86, 0x4a, 0x77, 0x55, 0x0d, 0x80, 0xfd, 0x54, 0x14, 0x24,
+  0x37, 0xce, 0x64, 0x30, 0x9f, 0x59, 0xf6, 0x9f, 0xb9, 0x84, 0x63, 0x9d,
+  0x5f, 0x07, 0x24, 0x55, 0x82, 0x60, 0x26, 0x97, 0xf3, 0x51, 0x3a, 0x93,
+  0x74, 0x34, 0x7f, 0xef, 0x2f, 0x53, 0x80, 0x93, 0x9a, 0xb7, 0x3a, 0x20,
+  0xee, 0x90, 0xe9, 0x8d, 0xf4, 0x7b, 0x52, 0x9d, 0x14, 0x60, 0xb7, 0x2a,
+  0x80, 0x14, 0x49, 0x6a, 0x89, 0x08, 0xa3, 0xb6, 0x21, 0x31, 0x82, 0x75,
+  0xed, 0xcb, 0xe4, 0xe1, 0x54, 0x24, 0xdf, 0xe5, 0xbd, 0xc4, 0xe8, 0x87,
+  0x00, 0x04, 0x29, 0x8b, 0xb7, 0x12, 0xb2, 0xd9, 0xd3, 0xdd, 0x9a, 0xdd,
+  0x1d, 0x73, 0x6d, 0x94, 0x1a, 0xff, 0xd2, 0x0e, 0x31, 0x98, 0xc9, 0x33,
+  0x86, 0x18, 0xf9, 0x7e, 0xe1, 0xd2, 0x11, 0xe8, 0x11, 0x11, 0xd7, 0xb9,
+  0xf6, 0x96, 0x8a, 0x2f, 0x92, 0x5b, 0x1b, 0x6d, 0x31, 0x0d, 0x9c, 0xcc,
+  0xe5, 0x65, 0x62, 0x95, 0x45, 0xe1, 0x2a, 0xef, 0x61, 0xfa, 0x86, 0x99,
+  0x47, 0xf1, 0x76, 0xc1, 0x6b, 0x4b, 0x1d, 0x63, 0x91, 0x5b, 0x37, 0x24,
+  0x7c, 0x22, 0x03, 0x43, 0xb1, 0x0f, 0x08, 0x03, 0xef, 0x16, 0x3c, 0x06,
+  0xb4, 0x89, 0x65, 0x3a, 0xcc, 0x28, 0xb2, 0x63, 0x40, 0xd5, 0xbb, 0x90,
+  0x73, 0x71, 0xc9, 0x26, 0x44, 0x31, 0xa0, 0xca, 0x8d, 0xe4, 0xd4, 0x09,
+  0x66, 0x1d, 0x24, 0x95, 0x59, 0x31, 0x8a, 0xb2, 0x55, 0xa4, 0x32, 0xd4,
+  0xc5, 0xc5, 0x29, 0xc5, 0xc8, 0x7a, 0xf3, 0x53, 0x1f, 0x6e, 0x26, 0x38,
+  0x02, 0x96, 0xdb, 0x1b, 0x16, 0x21, 0xac, 0x42, 0x8c, 0x72, 0x89, 0x01,
+  0xd2, 0x66, 0xe5, 0x26, 0xc3, 0xb8, 0x25, 0xda, 0x5c, 0x44, 0x18, 0xc5,
+  0xd6, 0xa8, 0x62, 0xba, 0x68, 0x5a, 0x33, 0xb4, 0x50, 0x4b, 0xf4, 0x96,
+  0x27, 0x5c, 0x94, 0x17, 0x11, 0xf3, 0x3a, 0x0b, 0xa0, 0x22, 0x0d, 0x70,
+  0x82, 0xd2, 0xcb, 0xa3, 0x0b, 0x4c, 0xb8, 0x7a, 0x74, 0xa6, 0x75, 0x9d,
+  0x68, 0x08, 0x04, 0x73, 0xa6, 0x77, 0x34, 0x9b, 0xc2, 0xf0, 0xde, 0x56,
+  0x18, 0x36, 0x62, 0xea, 0x68, 0x26, 0x49, 0x27, 0x0a, 0x78, 0xf9, 0xe8,
+  0xd1, 0x21, 0xcc, 0xaa, 0x08, 0xda, 0x0a, 0x1c, 0x7a, 0x6f, 0xe6, 0x2f,
+  0xad, 0x38, 0x16, 0xc6, 0xdd, 0x50, 0x0b, 0x18, 0xf7, 0x7b, 0x71, 0xd4,
+  0x46, 0x21, 0x8e, 0xc3, 0xe4, 0x67, 0xd9, 0x88, 0xe4, 0xbf, 0x2a, 0xeb,
+  0x5f, 0x4d, 0x0a, 0x74, 0x3f, 0x52, 0xda, 0x27, 0x5e, 0x12, 0x3f, 0x67,
+  0xbd, 0xe7, 0x07, 0x3f, 0x71, 0xd1, 0x20, 0x68, 0xea, 0xf4, 0xec, 0xe4,
+  0xf4, 0xc5, 0xf1, 0xdb, 0xe7, 0xed, 0xe4, 0xf0, 0xe4, 0xf4, 0xaf, 0xd0,
+  0xc4, 0x9b, 0x93, 0x9f, 0x8e, 0xa0, 0x05, 0xce, 0x05, 0xe1, 0xda, 0x19,
+  0x8f, 0xde, 0x62, 0xa4, 0x1c, 0x1a, 0x3c, 0xc4, 0x6c, 0xee, 0x1c, 0x6f,
+  0x81, 0x51, 0x74, 0x31, 0xd5, 0x36, 0xb1, 0xf0, 0x7a, 0x58, 0x0e, 0x68,
+  0xed, 0xd5, 0xd1, 0xc1, 0xf3, 0x36, 0xb4, 0x40, 0xb1, 0x42, 0x54, 0x22,
+  0xf7, 0xdd, 0x45, 0xa8, 0xe7, 0xc5, 0xbe, 0x77, 0x31, 0x69, 0x91, 0x86,
+  0x2b, 0x19, 0x06, 0x12, 0x61, 0x04, 0x87, 0x88, 0x00, 0x8b, 0x71, 0x63,
+  0x1a, 0x22, 0x69, 0x88, 0x80, 0x1e, 0x45, 0x40, 0x39, 0x11, 0x36, 0xa8,
+  0x44, 0xd6, 0x73, 0x51, 0x36, 0x46, 0x4e, 0x32, 0xf0, 0x4c, 0x23, 0x12,
+  0x5a, 0x2d, 0x1a, 0x4e, 0x3b, 0xc2, 0x43, 0x4e, 0xc8, 0xbb, 0x44, 0xcf,
+  0xdd, 0xa0, 0x29, 0x8e, 0x0e, 0x55, 0x2f, 0x43, 0xad, 0x06, 0x08, 0xfe,
+  0x05, 0x39, 0x18, 0xf9, 0xdc, 0x23, 0xd5, 0x0c, 0x23, 0x61, 0x8d, 0xae,
+  0xe3, 0xd4, 0x8a, 0xb5, 0xe1, 0x22, 0x24, 0xd6, 0x09, 0xcf, 0xad, 0xf3,
+  0x17, 0xfe, 0x98, 0x3a, 0xc4, 0xc4, 0x06, 0x34, 0x4a, 0xce, 0x31, 0x45,
+  0x3e, 0xe3, 0xd2, 0x79, 0xb4, 0xbe, 0x72, 0xe4, 0x71, 0x10, 0x6c, 0x4f,
+  0x37, 0x85, 0x55, 0xb3, 0x29, 0x14, 0xd2, 0xca, 0x1d, 0x6a, 0x72, 0xa7,
+  0xa8, 0x03, 0x47, 0x49, 0xdd, 0x32, 0xf7, 0x05, 0xaf, 0x86, 0x72, 0x21,
+  0x74, 0x1f, 0x54, 0xa1, 0xca, 0x45, 0xe8, 0x1c, 0xba, 0xd9, 0xb1, 0x22,
+  0x18, 0x3c, 0x41, 0x6c, 0x98, 0x14, 0x88, 0xd7, 0x47, 0x70, 0xf8, 0x26,
+  0x12, 0x5b, 0x86, 0x35, 0x38, 0x3b, 0xcc, 0x7c, 0xcb, 0xc4, 0xa3, 0x00,
+  0xba, 0x68, 0x03, 0x33, 0x7c, 0x18, 0x9b, 0x79, 0x24, 0x33, 0x48, 0xfb,
+  0x7d, 0xd8, 0x20, 0x97, 0xd2, 0x42, 0x24, 0xbf, 0xbb, 0xf5, 0x31, 0x84,
+  0x13, 0xa2, 0x96, 0x5b, 0x26, 0x1d, 0xce, 0xa5, 0x61, 0x4c, 0x0f, 0x17,
+  0x81, 0xb7, 0x8c, 0x81, 0xf8, 0x24, 0x43, 0xe3, 0x1e, 0xe6, 0x60, 0x04,
+  0x42, 0x7d, 0x7d, 0x8c, 0x61, 0x6c, 0x1c, 0x9d, 0xf2, 0x88, 0x21, 0x8c,
+  0x39, 0x8f, 0x86, 0x74, 0x7a, 0x5a, 0x47, 0x68, 0x43, 0x7b, 0x3a, 0x3d,
+  0x39, 0xdd, 0x5d, 0xd6, 0x15, 0x7e, 0xe7, 0x72, 0x69, 0xd4, 0xbc, 0xe2,
+  0x58, 0x8a, 0x74, 0x46, 0x69, 0x24, 0x67, 0x47, 0x17, 0x67, 0x76, 0x29,
+  0xbf, 0x39, 0x58, 0x98, 0x80, 0x34, 0x8a, 0x5f, 0xf9, 0xf1, 0xfb, 0xe1,
+  0xcb, 0xe8, 0x2d, 0x78, 0xe0, 0xcd, 0xf2, 0x65, 0xc0, 0xef, 0xee, 0x19,
+  0xdb, 0xab, 0xa3, 0xd7, 0xa7, 0x32, 0xb6, 0x9f, 0xce, 0x5e, 0xfc, 0xd5,
+  0x09, 0x0c, 0x81, 0x8c, 0x9a, 0x1d, 0xe6, 0x9f, 0x1d, 0xc4, 0x5e, 0x53,
+  0x1a, 0xff, 0xc2, 0x29, 0x0c, 0x17, 0x47, 0xf7, 0xbb, 0xbb, 0xfe, 0x92,
+  0xbc, 0x7d, 0x0d, 0x4b, 0xb9, 0x4a, 0x8a, 0xb7, 0x8c, 0xbd, 0xc3, 0x19,
+  0x19, 0x4e, 0x10, 0xf4, 0x1f, 0x27, 0xcf, 0xd0, 0x64, 0x18, 0x7b, 0x5e,
+  0x09, 0x68, 0x6a, 0xc2, 0x8c, 0x00, 0xd9, 0xf3, 0xb5, 0x66, 0x75, 0xc0,
+  0x13, 0xf8, 0xf4, 0x86, 0x5f, 0x3e, 0xe7, 0x8a, 0xc0, 0xef, 0x42, 0x5c,
+  0x97, 0xe5, 0x8d, 0x4c, 0x82, 0x53, 0x09, 0x63, 0x88, 0xab, 0xbc, 0x8f,
+  0x12, 0x17, 0xc7, 0xf4, 0x61, 0x42, 0x35, 0x1d, 0x19, 0x64, 0x21, 0x6a,
+  0x26, 0xc8, 0xcb, 0x52, 0xc1, 0xd7, 0xe2, 0x0b, 0xc0, 0x2c, 0x05, 0x20,
+  0x20, 0xd2, 0x99, 0x21, 0xb3, 0x48, 0x12, 0x2e, 0x67, 0xca, 0x67, 0x60,
+  0xa1, 0xbf, 0x66, 0xcd, 0x67, 0x5f, 0xaa, 0x28, 0x20, 0x2c, 0xf2, 0xa1,
+  0xe2, 0x38, 0x45, 0xd5, 0x65, 0x36, 0x69, 0xf3, 0x25, 0xd1, 0x3a, 0x39,
+  0xbd, 0x38, 0x3e, 0x79, 0x7b, 0x9e, 0xfc, 0x67, 0xeb, 0x7f, 0x0f, 0x99,
+  0xc2, 0x0b, 0x15, 0xe6, 0xb0, 0x8d, 0xb6, 0xb7, 0x11, 0x7e, 0xd3, 0x95,
+  0x41, 0xf9, 0x1d, 0x51, 0x90, 0x71, 0x47, 0xad, 0xff, 0x6c, 0x21, 0x75,
+  0xea, 0x0a, 0xae, 0xa8, 0xb7, 0xd4, 0xb2, 0x70, 0x30, 0x00, 0x0a, 0x56,
+  0xf1, 0xd9, 0xdf, 0xfe, 0xf8, 0x2b, 0x82, 0xf6, 0x10, 0x66, 0xcf, 0x3e,
+  0xc8, 0x03, 0xb3, 0xbf, 0xb5, 0xf1, 0xe7, 0xaf, 0xdd, 0x6e, 0xb7, 0x56,
+  0x8e, 0xd9, 0xf8, 0x05, 0x7e, 0x8f, 0xbe, 0x32, 0xa9, 0xca, 0x6c, 0xe6,
+  0x01, 0x6c, 0x87, 0x61, 0xba, 0xd0, 0x8f, 0x33, 0x4d, 0xf3, 0x19, 0x99,
+  0x82, 0x82, 0x9e, 0x00, 0xd7, 0x68, 0x3b, 0x44, 0x18, 0xd1, 0x15, 0x66,
+  0x99, 0xb5, 0x46, 0x7a, 0xeb, 0xe5, 0x86, 0xe2, 0x75, 0x39, 0x79, 0x4a,
+  0xfa, 0x0c, 0xfb, 0x22, 0x0a, 0x8d, 0x28, 0x54, 0x26, 0x3c, 0x4d, 0x54,
+  0x8e, 0x48, 0x64, 0x86, 0x03, 0x1b, 0xae, 0x58, 0x4d, 0x64, 0xbd, 0xd5,
+  0x97, 0x4b, 0x75, 0x9d, 0x59, 0xa5, 0x4c, 0x48, 0xb4, 0x20, 0x8e, 0xbd,
+  0x99, 0x55, 0xfd, 0x4d, 0x9c, 0x4f, 0x99, 0x44, 0x87, 0xd3, 0x6d, 0x70,
+  0xe1, 0x23, 0x20, 0x63, 0x44, 0x27, 0x52, 0x5d, 0x3c, 0xbe, 0x8b, 0xd6,
+  0x4c, 0xed, 0x65, 0x91, 0x45, 0xd3, 0xac, 0x32, 0xa1, 0x21, 0x5b, 0x4c,
+  0x0b, 0x5e, 0xd6, 0x7a, 0x6f, 0xe1, 0x7e, 0x1d, 0xa2, 0x0a, 0x73, 0xac,
+  0xb8, 0x72, 0xb7, 0x7a, 0x93, 0xc7, 0x24, 0x87, 0x99, 0x67, 0xc8, 0x9f,
+  0xf3, 0xba, 0x95, 0x47, 0x1d, 0x7e, 0xb2, 0x2c, 0x19, 0x47, 0x32, 0x8b,
+  0x89, 0x1c, 0xd5, 0x5a, 0xea, 0x0c, 0x71, 0xe7, 0x14, 0xc8, 0x46, 0x7d,
+  0x0d, 0x94, 0x3c, 0xe1, 0x30, 0x08, 0x5c, 0x0a, 0x06, 0x92, 0x24, 0xb2,
+  0x22, 0x7a, 0xd7, 0x62, 0x38, 0x02, 0x0c, 0x1a, 0xf6, 0xac, 0x24, 0x47,
+  0x16, 0x5e, 0x7c, 0x30, 0x6c, 0xa6, 0xcd, 0x5a, 0x00, 0xa0, 0x90, 0x76,
+  0x42, 0x22, 0xe0, 0x22, 0x19, 0x74, 0xd1, 0x29, 0x36, 0x1a, 0xf4, 0xd3,
+  0xd9, 0x20, 0x30, 0x7f, 0xdb, 0x70, 0x3e, 0x62, 0x05, 0x57, 0x97, 0x0c,
+  0xa4, 0xae, 0x09, 0x1e, 0xa1, 0xb3, 0x98, 0x60, 0xa3, 0x5b, 0x84, 0xf3,
+  0x5c, 0xbc, 0x2e, 0x1a, 0x82, 0x44, 0x85, 0x9e, 0xf0, 0x10, 0x53, 0xd6,
+  0xa0, 0x73, 0xa9, 0x6a, 0x00, 0x9e, 0x06, 0x81, 0x74, 0x3a, 0xf9, 0xf4,
+  0xfa, 0x71, 0xb0, 0xa9, 0xd3, 0xdf, 0x4f, 0x14, 0x88, 0xa7, 0xf2, 0xf8,
+  0x0c, 0x73, 0xba, 0x0a, 0x98, 0x4b, 0x1d, 0x9f, 0xd6, 0x4b, 0x68, 0xfe,
+  0x78, 0x2b, 0xa0, 0x0c, 0x7a, 0x05, 0xf0, 0x2e, 0x05, 0x24, 0x89, 0x86,
+  0x73, 0xc5, 0xc9, 0x87, 0x64, 0xe2, 0x40, 0x7d, 0x52, 0x96, 0xdb, 0x90,
+  0x2f, 0xd6, 0xca, 0x28, 0x62, 0x14, 0x39, 0xe6, 0xfa, 0xb6, 0x84, 0x70,
+  0x6e, 0x2c, 0x00, 0xbe, 0x30, 0x98, 0x16, 0x45, 0x4b, 0x05, 0xbc, 0x34,
+  0x86, 0x2f, 0x18, 0x15, 0x98, 0xf1, 0x36, 0x9f, 0x50, 0xe6, 0x9b, 0xc5,
+  0xdd, 0xba, 0xb0, 0x3e, 0x19, 0xe5, 0xa8, 0x20, 0x33, 0x36, 0x8a, 0x3e,
+  0x64, 0xe2, 0x98, 0x68, 0x5a, 0x0e, 0xb9, 0x51, 0x4a, 0xe4, 0x90, 0xf9,
+  0x62, 0xc5, 0x00, 0x5a, 0x4f, 0x0e, 0xb3, 0x26, 0x82, 0x76, 0x94, 0x44,
+  0xd4, 0xe1, 0x28, 0x89, 0xbc, 0x41, 0xc6, 0x01, 0x6e, 0xe8, 0xcc, 0x15,
+  0x1a, 0x41, 0xaa, 0x73, 0x44, 0x63, 0x03, 0xa8, 0x43, 0x84, 0x6a, 0xf3,
+  0x55, 0xcc, 0xe1, 0x8e, 0x4f, 0x61, 0x6f, 0xc2, 0xb9, 0xc0, 0x61, 0xc3,
+  0x05, 0xf3, 0xb7, 0x1e, 0xf0, 0xfd, 0x0f, 0x59, 0x55, 0xfe, 0xea, 0x00,
+  0x98, 0xe0, 0x6d, 0x06, 0x78, 0xd2, 0xbc, 0x3c, 0x49, 0xaa, 0x5a, 0xa0,
+  0x2f, 0x76, 0x03, 0x6b, 0xa9, 0x53, 0xfd, 0xa4, 0xad, 0x29, 0x08, 0x9c,
+  0x46, 0x01, 0x3b, 0x45, 0x55, 0x56, 0x3d, 0xd3, 0x68, 0x5b, 0xd5, 0x79,
+  0x11, 0xce, 0x15, 0x87, 0x09, 0x16, 0x20, 0x88, 0xe8, 0xc4, 0xe6, 0xc5,
+  0x73, 0x3e, 0xa4, 0x82, 0x27, 0xb8, 0x34, 0x86, 0x4a, 0x79, 0xa3, 0xa7,
+  0x04, 0xe3, 0x64, 0x5d, 0xda, 0xe4, 0x13, 0x0c, 0xd5, 0x6b, 0x78, 0x9d,
+  0x12, 0x78, 0x80, 0x98, 0x04, 0x00, 0xa4, 0xf6, 0xd6, 0xd7, 0x7b, 0xcd,
+  0x6f, 0x39, 0x46, 0x60, 0x5b, 0x42, 0x51, 0xe3, 0xc5, 0x84, 0x62, 0x75,
+  0xc8, 0x7a, 0x15, 0xad, 0x2e, 0x7a, 0x38, 0x4b, 0xab, 0x76, 0x6c, 0xf5,
+  0x4d, 0xc9, 0x90, 0x11, 0x4e, 0xac, 0xe6, 0x55, 0x2f, 0x4b, 0x5e, 0x55,
+  0xb6, 0x6b, 0xc8, 0x40, 0xd9, 0x7d, 0xf1, 0x4f, 0xdc, 0xae, 0xbb, 0x29,
+  0xf7, 0x1f, 0x3f, 0xde, 0xdd, 0xdf, 0xde, 0x41, 0x6c, 0xf8, 0x2d, 0xd0,
+  0xa3, 0x57, 0x08, 0x5d, 0x6a, 0x6e, 0xe2, 0x6f, 0x3b, 0x5b, 0x5b, 0xdb,
+  0xfb, 0x83, 0xde, 0xd3, 0xfd, 0xfd, 0x9d, 0xbd, 0x9d, 0xe1, 0x7e, 0x36,
+  0x1c, 0x3c, 0xf9, 0xf5, 0x53, 0x10, 0x68, 0xdd, 0xee, 0x4a, 0xde, 0xc2,
+  0xa8, 0xea, 0x94, 0xd7, 0x7d, 0x77, 0x63, 0xe3, 0x69, 0x7e, 0x06, 0xc4,
+  0xf1, 0xbd, 0x49, 0xcd, 0x1a, 0xa5, 0x4f, 0x45, 0xa9, 0xc4, 0x7c, 0x05,
+  0x67, 0xc6, 0x5c, 0x5e, 0x1e, 0xfc, 0x8b, 0x4f, 0x0f, 0x21, 0x54, 0x65,
+  0x33, 0xcc, 0x21, 0x33, 0x28, 0xc9, 0x80, 0xda, 0xc3, 0xf9, 0x70, 0xfa,
+  0x24, 0x31, 0x36, 0x45, 0x28, 0xd3, 0xd8, 0xdf, 0x32, 0xe0, 0xdf, 0x5c,
+  0x72, 0x65, 0x9d, 0x64, 0x3e, 0xed, 0x1a, 0x12, 0xae, 0x59, 0x8c, 0xf4,
+  0x3d, 0xe8, 0x6f, 0x2b, 0x89, 0x70, 0xdb, 0x48, 0xbb, 0x0f, 0xdd, 0x88,
+  0xa1, 0x23, 0x2a, 0xcc, 0x2e, 0x7c, 0x09, 0x31, 0x83, 0x6c, 0x7a, 0x3a,
+  0x3f, 0xbe, 0xf5, 0x18, 0x9c, 0x73, 0xdf, 0x62, 0xef, 0xe1, 0x64, 0xb7,
+  0x03, 0x0e, 0xd1, 0xe3, 0x8f, 0x1f, 0x6b, 0x79, 0x71, 0x14, 0x33, 0x43,
+  0x45, 0x9a, 0x44, 0xd2, 0x7d, 0xbc, 0xf5, 0xb4, 0x9d, 0x3c, 0xde, 0xf9,
+  0xa6, 0x8d, 0x99, 0x93, 0x6d, 0x4c, 0xc5, 0xdc, 0xc1, 0x5f, 0x77, 0xf1,
+  0xa1, 0xbd, 0xad, 0xc7, 0xe1, 0x55, 0xbd, 0xe0, 0x07, 0x59, 0x14, 0xba,
+  0xad, 0x01, 0xf1, 0x69, 0xaf, 0xe0, 0xf8, 0x03, 0xde, 0x1f, 0x18, 0x4f,
+  0xb4, 0x9c, 0x9c, 0x2e, 0xc9, 0xc9, 0x10, 0x94, 0x61, 0xc5, 0xb1, 0xcd,
+  0xe1, 0xea, 0xa3, 0x98, 0x20, 0xf5, 0xf1, 0xe0, 0x2f, 0xd5, 0x15, 0xd0,
+  0x07, 0xe5, 0x10, 0xcb, 0x0a, 0x51, 0x0c, 0x6c, 0x31, 0xa7, 0x10, 0x58,
+  0xb6, 0x15, 0xe4, 0x0c, 0x96, 0xe9, 0x43, 0xb1, 0x31, 0x8c, 0x9e, 0x77,
+  0x2f, 0xa5, 0x2a, 0xb1, 0xdb, 0xb8, 0xe8, 0xc4, 0xca, 0x4b, 0x36, 0xda,
+  0x70, 0xc5, 0x25, 0xaa, 0x74, 0x3e, 0xb6, 0x22, 0xb3, 0xac, 0x44, 0xc1,
+  0x49, 0xd7, 0x18, 0x1f, 0x0e, 0x26, 0xa7, 0x2b, 0x43, 0xb1, 0x12, 0x25,
+  0x9d, 0xd0, 0x85, 0x44, 0xd0, 0xb0, 0xba, 0x78, 0x25, 0x89, 0x11, 0x25,
+  0x0a, 0xec, 0x75, 0x71, 0x9c, 0x03, 0xb5, 0xd8, 0x0b, 0x2d, 0x01, 0xdb,
+  0x25, 0x8e, 0x40, 0x46, 0xe6, 0xa4, 0x07, 0x5c, 0x15, 0x23, 0xd6, 0x60,
+  0xe6, 0x97, 0xc5, 0x0c, 0xf6, 0x73, 0xdc, 0x95, 0x23, 0x91, 0xd0, 0xa1,
+  0x08, 0xd6, 0x5b, 0x6c, 0x7b, 0x9c, 0x7e, 0x64, 0x6b, 0x3d, 0x2c, 0x35,
+  0x47, 0x81, 0x13, 0x53, 0x2f, 0x2a, 0x61, 0x09, 0x96, 0x84, 0xc2, 0x5c,
+  0x90, 0xc7, 0xe8, 0x35, 0x0b, 0xca, 0x62, 0xc9, 0x2d, 0x74, 0x88, 0xa6,
+  0x7f, 0x46, 0x4d, 0x1f, 0xe0, 0x95, 0xb8, 0xef, 0x92, 0x0a, 0x25, 0x7a,
+  0x15, 0x45, 0x27, 0xda, 0x33, 0xe3, 0x55, 0x52, 0x28, 0x17, 0xc7, 0x80,
+  0xd5, 0x68, 0xd4, 0x0a, 0xcf, 0x6a, 0x94, 0xcf, 0x6e, 0x40, 0x52, 0x08,
+  0x69, 0xea, 0xc8, 0x70, 0x9f, 0x50, 0x9e, 0xba, 0x4b, 0xdb, 0xa6, 0x67,
+  0x56, 0xad, 0x13, 0xf5, 0x49, 0xca, 0x02, 0x36, 0xfc, 0xf5, 0xaa, 0x6a,
+  0x81, 0x5f, 0xdb, 0x98, 0xd7, 0xa0, 0xa7, 0x8b, 0x0d, 0xd2, 0xa5, 0xba,
+  0x30, 0xb0, 0x65, 0x34, 0x1b, 0xc2, 0x55, 0x26, 0x96, 0xf4, 0x5a, 0x00,
+  0x3d, 0x71, 0x6a, 0xb3, 0xc2, 0xfb, 0x0c, 0x86, 0x46, 0xd0, 0x69, 0xad,
+  0x13, 0xdb, 0x2a, 0x47, 0xd9, 0xe0, 0x32, 0xbb, 0x4a, 0xc7, 0xe3, 0x6c,
+  0xd6, 0x22, 0x5e, 0xa3, 0xa9, 0x11, 0x5d, 0xac, 0x5d, 0x44, 0x96, 0x1d,
+  0x0b, 0x17, 0x88, 0xb0, 0xf7, 0x31, 0x40, 0x4a, 0xc5, 0x98, 0x64, 0x5d,
+  0xca, 0xde, 0x70, 0xf6, 0x63, 0x3e, 0x11, 0x38, 0x5d, 0x5c, 0x99, 0x59,
+  0x7f, 0xa3, 0xad, 0x2e, 0x7c, 0x36, 0x30, 0xf5, 0x42, 0x1e, 0x83, 0x1a,
+  0x98, 0xf0, 0xc6, 0xb5, 0xa8, 0x3a, 0x16, 0x4c, 0xf0, 0xf6, 0x52, 0x84,
+  0x25, 0xba, 0xc7, 0x43, 0x49, 0xb1, 0x64, 0x30, 0xc7, 0xe0, 0x33, 0xab,
+  0x9a, 0xc9, 0xd9, 0xfe, 0x7e, 0xb8, 0x2c, 0x72, 0xaa, 0xac, 0x40, 0xc4,
+  0x40, 0x80, 0x8b, 0xa8, 0x8e, 0x92, 0x81, 0xbf, 0x2b, 0xd1, 0x10, 0x5c,
+  0x76, 0xbd, 0x67, 0x79, 0x80, 0x15, 0x29, 0xad, 0x70, 0x38, 0xae, 0x80,
+  0x47, 0x50, 0xfd, 0xc7, 0x5b, 0x49, 0xf9, 0x81, 0xd1, 0x85, 0x0a, 0x47,
+  0x74, 0x0b, 0x12, 0x88, 0x53, 0x52, 0xf6, 0x67, 0xf9, 0x94, 0xd0, 0xa0,
+  0x11, 0xb5, 0x3a, 0x53, 0xf6, 0x27, 0x86, 0x62, 0x5d, 0x13, 0x02, 0xad,
+  0x5a, 0x08, 0x8b, 0x23, 0x53, 0xa3, 0x85, 0xb2, 0x8d, 0x41, 0x53, 0xd7,
+  0xc4, 0xe1, 0x06, 0x48, 0x42, 0xe1, 0x73, 0xe8, 0x63, 0xb0, 0xc8, 0xc0,
+  0x51, 0xfa, 0xe1, 0xd6, 0xc9, 0x7b, 0x08, 0xa8, 0x36, 0xc2, 0xa0, 0x1a,
+  0x97, 0x74, 0x86, 0xaf, 0x5e, 0xb1, 0x59, 0xe0, 0x56, 0x9c, 0xd2, 0x92,
+  0xb7, 0xd3, 0x0e, 0xba, 0x46, 0xe5, 0x60, 0x84, 0xed, 0x45, 0x0e, 0x4a,
+  0xac, 0xaf, 0xa1, 0x5b, 0x42, 0x6f, 0x29, 0x6d, 0xeb, 0x0a, 0xd2, 0x15,
+  0x65, 0xf9, 0x35, 0xc2, 0x1b, 0x19, 0xa2, 0x43, 0x9d, 0x2b, 0x6c, 0xc2,
+  0x50, 0xb1, 0x4d, 0x66, 0x54, 0x83, 0x12, 0x08, 0xf8, 0x78, 0x28, 0x09,
+  0xa3, 0x3c, 0x24, 0xe1, 0x36, 0x89, 0x54, 0xbc, 0x52, 0x0c, 0x4d, 0x76,
+  0xb6, 0xbd, 0x02, 0x16, 0x44, 0x41, 0x46, 0x32, 0x91, 0x60, 0x15, 0xa9,
+  0x66, 0x73, 0x4e, 0xa9, 0xa4, 0x5e, 0xdd, 0x74, 0xa4, 0xa8, 0xdc, 0xff,
+  0x4c, 0xa6, 0x39, 0x16, 0x04, 0x80, 0xb9, 0x7c, 0x6f, 0x90, 0x8d, 0xcc,
+  0xb7, 0xc9, 0x84, 0xed, 0x20, 0x19, 0x11, 0xc2, 0x3d, 0xf9, 0x39, 0x43,
+  0x93, 0x08, 0x48, 0xde, 0x94, 0xfa, 0x7b, 0x79, 0x49, 0xa6, 0x33, 0x67,
+  0x3c, 0xc7, 0x69, 0x94, 0x99, 0xd4, 0xc0, 0x43, 0xc3, 0xb4, 0x0e, 0xf4,
+  0x3a, 0x4f, 0xb5, 0x21, 0x11, 0x61, 0x73, 0x02, 0x42, 0xea, 0x69, 0x1c,
+  0xad, 0x0b, 0xfd, 0xb2, 0x68, 0x48, 0x4e, 0xc4, 0xa2, 0xf6, 0xe9, 0xec,
+  0xf0, 0x21, 0x50, 0xba, 0xd7, 0x63, 0x10, 0x17, 0xd8, 0x0b, 0x20, 0x75,
+  0xae, 0x7c, 0x16, 0x0d, 0x8d, 0xe5, 0x13, 0xe7, 0x4e, 0x1c, 0xfa, 0x54,
+  0x0d, 0x4b, 0xc5, 0x9f, 0x44, 0x86, 0x29, 0x7f, 0x91, 0x8b, 0x83, 0x9a,
+  0xcb, 0x16, 0x7a, 0x48, 0x5d, 0x6a, 0xce, 0x30, 0xe8, 0xac, 0x49, 0xb1,
+  0x0b, 0xe1, 0x51, 0x36, 0x74, 0x41, 0xa6, 0x1b, 0x25, 0x1b, 0x72, 0xc3,
+  0x06, 0xd0, 0x3a, 0xbe, 0x29, 0x1e, 0x83, 0x1c, 0xf0, 0x16, 0x07, 0xfc,
+  0x82, 0x2b, 0xa6, 0x85, 0x5a, 0xeb, 0x19, 0x3d, 0x23, 0x05, 0x11, 0xa1,
+  0xb1, 0x51, 0x58, 0x93, 0x81, 0x85, 0xf9, 0x8a, 0x13, 0x9d, 0x4d, 0xfd,
+  0x3a, 0xd7, 0x2e, 0xcb, 0x0f, 0x0b, 0xd7, 0x00, 0x73, 0x4e, 0x93, 0x2c,
+  0xf4, 0xf2, 0xc7, 0x52, 0xf7, 0x18, 0xf3, 0x19, 0x2f, 0x82, 0x18, 0xaa,
+  0x43, 0xe2, 0xb9, 0x2e, 0x85, 0x13, 0x07, 0xe9, 0x0d, 0x66, 0xdf, 0x74,
+  0xc2, 0x9c, 0xad, 0x0e, 0x47, 0xa4, 0x0e, 0x9e, 0x31, 0xe9, 0x91, 0xcd,
+  0x02, 0x53, 0xc9, 0x2c, 0x10, 0xe5, 0x77, 0x58, 0x0a, 0x8b, 0x4e, 0x24,
+  0x53, 0x42, 0x60, 0x05, 0x78, 0x21, 0xa0, 0xec, 0xb2, 0x28, 0x30, 0x49,
+  0xe0, 0x94, 0x0d, 0xce, 0x8f, 0x09, 0x98, 0x35, 0x74, 0x4a, 0x22, 0xd0,
+  0xde, 0xc7, 0x8f, 0x1b, 0x02, 0xc8, 0xc0, 0x74, 0x98, 0xc5, 0xee, 0x5b,
+  0x72, 0x67, 0xd6, 0x7c, 0xb6, 0xf1, 0xfd, 0xf4, 0x50, 0x45, 0xdd, 0xeb,
+  0xed, 0xae, 0x72, 0xd3, 0xee, 0x35, 0x8d, 0x67, 0xb5, 0x8a, 0x54, 0xdb,
+  0x35, 0xbf, 0xad, 0x5e, 0x94, 0xfe, 0x12, 0x46, 0xbd, 0x00, 0x94, 0x31,
+  0xf6, 0x1d, 0x92, 0xd8, 0x1f, 0x07, 0x19, 0xb2, 0xab, 0x9d, 0x9d, 0xde,
+  0x28, 0x59, 0xd2, 0x17, 0xa5, 0x53, 0x1e, 0x93, 0x23, 0x04, 0x07, 0x3e,
+  0x3b, 0x7a, 0xf1, 0xee, 0xfc, 0xe8, 0x39, 0xeb, 0x62, 0x8e, 0xb5, 0x39,
+  0xcd, 0xa1, 0x2a, 0x0a, 0x3a, 0x88, 0x3a, 0x8e, 0xbb, 0xef, 0xf6, 0x9a,
+  0x83, 0x9d, 0x5e, 0x58, 0xdc, 0x22, 0x37, 0xfa, 0x3b, 0x4b, 0x11, 0x7f,
+  0xe2, 0x0e, 0xb9, 0x66, 0x57, 0xd8, 0xa2, 0x68, 0x14, 0x9f, 0x23, 0x20,
+  0x45, 0xd9, 0x6b, 0x11, 0x75, 0xf8, 0x9d, 0x62, 0xd9, 0xf9, 0x99, 0x24,
+  0x2f, 0x7e, 0x5f, 0x8f, 0xdc, 0x49, 0x40, 0xc6, 0xc9, 0xa6, 0x72, 0xc7,
+  0xa5, 0x63, 0xe0, 0x28, 0x6c, 0x6a, 0x64, 0xfb, 0x8c, 0xea, 0x54, 0x14,
+  0x9f, 0x25, 0x57, 0x2c, 0x3b, 0xb8, 0x6a, 0x4a, 0x1a, 0xad, 0x9b, 0x5c,
+  0x55, 0x62, 0x57, 0xa9, 0x6f, 0xe4, 0x3a, 0x23, 0x7a, 0x90, 0x83, 0xd2,
+  0x43, 0x89, 0xcb, 0xd5, 0x28, 0x62, 0x37, 0xf7, 0x6b, 0xb2, 0xb7, 0x03,
+  0x47, 0x17, 0xde, 0xb3, 0xb1, 0x90, 0x70, 0x9d, 0x0b, 0xd6, 0x84, 0xc3,
+  0x4f, 0xa0, 0xfc, 0x8b, 0x4b, 0x0d, 0x3b, 0xa3, 0x61, 0xe3, 0xf4, 0x28,
+  0x26, 0x91, 0xb6, 0xc7, 0x29, 0x85, 0xf8, 0xba, 0x28, 0x18, 0xf0, 0xed,
+  0x3f, 0xb2, 0x99, 0x65, 0x7d, 0x9b, 0x72, 0xa8, 0xae, 0x48, 0xbd, 0x39,
+  0xfc, 0x60, 0x17, 0x2f, 0x96, 0x76, 0x84, 0xd0, 0x30, 0xf1, 0xfa, 0x05,
+  0xd6, 0x56, 0x9a, 0x20, 0xd2, 0x1c, 0xfb, 0x4c, 0xc4, 0xf6, 0xa3, 0x73,
+  0x54, 0x5e, 0x17, 0x69, 0x09, 0x51, 0x62, 0xac, 0xc6, 0x91, 0x3e, 0xa1,
+  0xac, 0xd8, 0x28, 0x0e, 0x1a, 0x41, 0x28, 0x51, 0x18, 0xd2, 0xac, 0xef,
+  0x94, 0xa6, 0x45, 0x08, 0x7e, 0x51, 0xf2, 0x3f, 0x57, 0xa7, 0x08, 0x01,
+  0xb3, 0x42, 0x18, 0x12, 0x2b, 0x60, 0xa0, 0x7f, 0xea, 0xc3, 0x42, 0x1b,
+  0xae, 0x40, 0xca, 0xf7, 0xb2, 0x1a, 0x9a, 0x82, 0xe8, 0x59, 0x29, 0xb0,
+  0x6f, 0x94, 0x72, 0xbb, 0x1b, 0xbe, 0x53, 0x4d, 0x0b, 0xa6, 0xb8, 0xba,
+  0x44, 0xf2, 0x7e, 0x33, 0x09, 0xd1, 0x92, 0xa4, 0x52, 0x49, 0xf3, 0x65,
+  0xbb, 0x24, 0x29, 0x36, 0x24, 0x11, 0x99, 0xdc, 0x19, 0x0a, 0x91, 0xa9,
+  0x09, 0x32, 0xb4, 0x1a, 0x17, 0xa7, 0xf6, 0xb4, 0xfe, 0x65, 0xe1, 0xa6,
+  0x5c, 0x47, 0x7b, 0xbf, 0xff, 0xd8, 0x2e, 0xd1, 0x71, 0x4c, 0xad, 0xac,
+  0x9d, 0xdb, 0x0b, 0xd1, 0x74, 0x25, 0x18, 0x59, 0x8a, 0x11, 0x90, 0xec,
+  0xb5, 0x00, 0x00, 0x8c, 0x1a, 0xbe, 0x03, 0x36, 0x10, 0x69, 0xb9, 0x1b,
+  0x94, 0x26, 0xf2, 0x93, 0xce, 0x32, 0x0e, 0xc0, 0x4e, 0xc9, 0xa6, 0x89,
+  0xf1, 0x02, 0xeb, 0x08, 0x08, 0x28, 0x03, 0xe1, 0x1d, 0x25, 0x4b, 0xaa,
+  0x84, 0x3d, 0x4b, 0xb7, 0x2e, 0xfa, 0xa8, 0x12, 0xed, 0x5e, 0x83, 0x22,
+  0x38, 0x22, 0x94, 0x94, 0x61, 0xd8, 0x23, 0x10, 0x54, 0xf2, 0xbe, 0x89,
+  0x46, 0xc3, 0x10, 0x12, 0x38, 0xd3, 0x90, 0x3a, 0x13, 0x20, 0xb9, 0x11,
+  0x46, 0x6d, 0x1d, 0x23, 0x4c, 0x80, 0x48, 0x34, 0xc1, 0x01, 0x4b, 0xb0,
+  0xf8, 0xe4, 0xc6, 0xa5, 0x78, 0x0f, 0x35, 0x19, 0x01, 0x85, 0xb4, 0x43,
+  0x0c, 0x3a, 0x4a, 0x82, 0x84, 0xe0, 0x4c, 0xe3, 0x56, 0x58, 0x08, 0x3e,
+  0xe7, 0x3c, 0x36, 0xe6, 0x31, 0xf0, 0x72, 0x5e, 0x0c, 0x08, 0x8e, 0x58,
+  0x54, 0x77, 0x8b, 0x17, 0x0e, 0x28, 0xe3, 0xd0, 0xf3, 0x5a, 0x19, 0x40,
+  0x37, 0x72, 0x8c, 0x2b, 0xe7, 0x4c, 0x03, 0xdb, 0x39, 0xc9, 0x53, 0x0d,
+  0x47, 0x11, 0xce, 0x0a, 0x72, 0x91, 0x10, 0xa7, 0x4f, 0xb4, 0x2f, 0x67,
+  0xfd, 0xff, 0x3b, 0xdd, 0x9f, 0x7d, 0xba, 0xed, 0x50, 0xdc, 0x03, 0xa4,
+  0x5e, 0xb7, 0x4f, 0x7c, 0xf2, 0xe9, 0xb6, 0x8e, 0x76, 0xb7, 0xec, 0xd0,
+  0x6e, 0x6f, 0x7d, 0xee, 0x11, 0x8f, 0xf3, 0xca, 0xcb, 0x94, 0xeb, 0x7b,
+  0x5e, 0xfd, 0x23, 0x1f, 0x24, 0xcf, 0xb4, 0xa4, 0xb9, 0xab, 0x4a, 0xa2,
+  0x45, 0x40, 0xe0, 0x11, 0xb8, 0x02, 0xff, 0xa1, 0x38, 0x5d, 0xf2, 0x20,
+  0x6c, 0x84, 0xbc, 0x8c, 0x76, 0x03, 0x0e, 0x77, 0x84, 0xfe, 0x0f, 0x10,
+  0x8a, 0xef, 0xf4, 0xf5, 0xc1, 0xf1, 0x5b, 0x4b, 0x33, 0x76, 0x65, 0x80,
+  0xda, 0x6c, 0x74, 0x88, 0x90, 0xbe, 0x14, 0xe6, 0xab, 0x5e, 0x6c, 0xd0,
+  0x7a, 0x92, 0x80, 0x00, 0xfc, 0xbe, 0x0f, 0xbd, 0x91, 0xc1, 0xc1, 0x03,
+  0x46, 0x72, 0xde, 0x6b, 0x3d, 0xa1, 0x32, 0xae, 0xa9, 0xec, 0xab, 0xa3,
+  0xf8, 0x0c, 0x13, 0xa0, 0xa2, 0x59, 0xae, 0xb0, 0x94, 0x89, 0x4c, 0x28,
+  0xaa, 0xdb, 0x9e, 0x25, 0xd2, 0x71, 0x9b, 0x6b, 0x4d, 0x05, 0x6c, 0x35,
+  0x6a, 0x8c, 0x90, 0x10, 0x0c, 0x4d, 0xcb, 0xdc, 0xf2, 0x1e, 0x56, 0x2d,
+  0xae, 0xa7, 0xcc, 0x46, 0x64, 0xc1, 0x99, 0x56, 0x99, 0x31, 0x51, 0xe4,
+  0x66, 0xa3, 0x3f, 0x9c, 0xd2, 0x1a, 0xc5, 0x99, 0xf5, 0x8a, 0x8f, 0x6d,
+  0x17, 0x9c, 0x6c, 0xb0, 0xb9, 0x16, 0x50, 0x7e, 0x49, 0xc8, 0x4e, 0x03,
+  0x6b, 0xa3, 0x2a, 0xda, 0x8c, 0xd7, 0x57, 0x5e, 0x61, 0x11, 0x1f, 0x04,
+  0x8d, 0x19, 0x41, 0x23, 0x0e, 0x90, 0x49, 0xe9, 0x86, 0x03, 0x4b, 0x22,
+  0x42, 0x58, 0xc5, 0xe0, 0xf6, 0x59, 0xe5, 0x31, 0xa3, 0x5e, 0xa8, 0xa7,
+  0x71, 0xba, 0x24, 0x70, 0xc4, 0xa9, 0x00, 0x68, 0x16, 0x8c, 0x21, 0x13,
+  0x8a, 0xcb, 0x7c, 0xd2, 0x09, 0xc1, 0x67, 0x8e, 0x96, 0x73, 0x99, 0xdd,
+  0xd1, 0x44, 0xc2, 0xa0, 0x15, 0x8e, 0xdf, 0xe9, 0x85, 0x44, 0x7e, 0x4c,
+  0xa4, 0xf5, 0x92, 0x58, 0x4d, 0x55, 0x3b, 0xa4, 0xdd, 0x15, 0x2b, 0xfe,
+  0x36, 0x44, 0x60, 0xd7, 0xab, 0x76, 0x48, 0x83, 0x2b, 0x2c, 0x55, 0x3e,
+  0xbb, 0x63, 0x85, 0x7c, 0x95, 0x5e, 0xb7, 0xae, 0x61, 0x3d, 0xee, 0x2b,
+  0x23, 0x6f, 0x75, 0xe4, 0x25, 0x1b, 0xd5, 0xea, 0xc8, 0x77, 0x25, 0xda,
+  0x68, 0xa1, 0x36, 0x7c, 0x2d, 0x6b, 0xf6, 0x81, 0x8c, 0xb1, 0x51, 0x37,
+  0x58, 0x20, 0x67, 0xb0, 0x29, 0x27, 0x73, 0x25, 0x1e, 0x67, 0xd5, 0x7b,
+  0xa3, 0x12, 0x76, 0xbe, 0x51, 0x5d, 0x92, 0x73, 0xaa, 0xc0, 0x73, 0x55,
+  0xdc, 0xf8, 0x98, 0x73, 0x72, 0x54, 0x04, 0xb0, 0x05, 0x78, 0x00, 0x33,
+  0x5e, 0x38, 0x0a, 0xd1, 0x09, 0xdd, 0xf8, 0x5a, 0xc8, 0x8e, 0x82, 0xf9,
+  0x96, 0x04, 0x45, 0x0c, 0x9c, 0x40, 0x6f, 0x7a, 0xaa, 0x0b, 0xf0, 0xa5,
+  0x31, 0x53, 0xbc, 0xf6, 0x18, 0x66, 0x92, 0x3c, 0x8c, 0xde, 0x18, 0x1a,
+  0xbc, 0x67, 0xc3, 0x42, 0xc7, 0xba, 0x5c, 0x2b, 0x6e, 0x15, 0x95, 0xac,
+  0xb9, 0xa4, 0x8a, 0x39, 0xe3, 0xac, 0x0a, 0xa8, 0x04, 0xb9, 0xed, 0x8c,
+  0x20, 0xc7, 0x79, 0xb0, 0x53, 0xa9, 0xf7, 0x81, 0x1b, 0xd0, 0x50, 0xba,
+  0x47, 0xa3, 0x48, 0xcd, 0x56, 0xcc, 0x46, 0xae, 0xd8, 0xd0, 0xa2, 0x4f,
+  0xf7, 0x09, 0x5b, 0x82, 0x8d, 0x3a, 0x94, 0x3a, 0xa9, 0xe1, 0xb8, 0x42,
+  0x70, 0x9c, 0xaa, 0xd7, 0x2f, 0x8a, 0x0f, 0x39, 0x52, 0x34, 0x41, 0x4c,
+  0x4b, 0x52, 0x59, 0x8c, 0x39, 0xd8, 0x96, 0x6e, 0x4c, 0xac, 0x20, 0x39,
+  0x90, 0x22, 0x75, 0x09, 0x87, 0x2c, 0x21, 0x04, 0x47, 0xab, 0x98, 0x45,
+  0x51, 0x2a, 0x51, 0x65, 0x95, 0x96, 0x0c, 0xa9, 0x45, 0x42, 0xaf, 0xc4,
+  0x5d, 0x99, 0x75, 0x59, 0xa3, 0xa9, 0x8b, 0x49, 0xa3, 0x4b, 0x80, 0xe9,
+  0xd2, 0x83, 0x58, 0x66, 0xae, 0x3e, 0x11, 0x86, 0x3f, 0x71, 0x22, 0x6c,
+  0x08, 0xb1, 0x2d, 0x2d, 0xdb, 0xab, 0xac, 0x40, 0xb6, 0x1d, 0x6f, 0x8a,
+  0xa5, 0x53, 0xe4, 0x68, 0xb6, 0xca, 0x77, 0x3a, 0x83, 0xf9, 0x78, 0xaa,
+  0xb8, 0x24, 0x92, 0x4d, 0xa9, 0xa9, 0x13, 0x6e, 0xc1, 0xe5, 0x56, 0x0f,
+  0x50, 0x4b, 0xdc, 0xa6, 0xf3, 0xfc, 0x5f, 0xe7, 0xd9, 0x4d, 0x24, 0x2f,
+  0xcb, 0xdb, 0x0b, 0xfe, 0x7a, 0x0c, 0x5d, 0x43, 0x23, 0x78, 0xec, 0xac,
+  0x27, 0xa0, 0x62, 0xec, 0x99, 0xdd, 0xe9, 0x62, 0x1a, 0xcd, 0x07, 0x62,
+  0xb4, 0x05, 0x31, 0x83, 0x39, 0x98, 0x8e, 0x89, 0x34, 0x6b, 0x3c, 0x7f,
+  0x64, 0xbe, 0x4c, 0x82, 0x1d, 0xa8, 0x66, 0xb5, 0x5d, 0xc8, 0xd7, 0x15,
+  0xe7, 0xe2, 0x2c, 0x63, 0x2f, 0xbe, 0x1e, 0x6f, 0x34, 0x5c, 0x32, 0x38,
+  0x59, 0xef, 0x36, 0x58, 0x33, 0x25, 0x8c, 0xbd, 0x61, 0x43, 0xf0, 0x65,
+  0x41, 0xa6, 0xeb, 0x74, 0x94, 0xbe, 0x54, 0x03, 0xe2, 0xb4, 0xc6, 0xae,
+  0xc4, 0xc7, 0x28, 0xb2, 0x4a, 0x48, 0xbf, 0x53, 0x5f, 0x63, 0xc0, 0x6c,
+  0x6c, 0x38, 0xe6, 0x3a, 0xd3, 0x86, 0x73, 0x0e, 0x8b, 0xa2, 0x37, 0xfa,
+  0x8a, 0x79, 0x17, 0xbe, 0xc5, 0x3b, 0x4f, 0x7a, 0xbe, 0xda, 0xb1, 0xd6,
+  0x4d, 0x64, 0xfe, 0xeb, 0x68, 0x28, 0xdc, 0x45, 0xf9, 0x65, 0x3a, 0xba,
+  0x6c, 0xac, 0x08, 0x9f, 0x55, 0x21, 0x18, 0x04, 0x1e, 0x9b, 0x30, 0x52,
+  0x82, 0x99, 0x5c, 0x4a, 0x0b, 0x92, 0x15, 0xf1, 0x92, 0x70, 0x9e, 0x4b,
+  0x86, 0xcf, 0x92, 0x79, 0x97, 0x15, 0xcc, 0x34, 0x2f, 0xaf, 0xa8, 0x88,
+  0x61, 0x14, 0xc1, 0x4c, 0xd5, 0xa5, 0x77, 0x1e, 0x3f, 0x69, 0x03, 0x25,
+  0x3d, 0xee, 0x6e, 0xd3, 0x7f, 0x2a, 0x60, 0x4c, 0xbc, 0x5d, 0x87, 0xa2,
+  0x28, 0xb0, 0x17, 0xf6, 0x99, 0x73, 0xa0, 0xdb, 0xe2, 0x68, 0x12, 0x43,
+  0xe1, 0x80, 0x95, 0xd7, 0xe0, 0x52, 0xfb, 0x92, 0x22, 0xb2, 0xf4, 0x50,
+  0x70, 0x04, 0x3d, 0x3c, 0xd9, 0xfa, 0x63, 0x2b, 0x59, 0xcf, 0xba, 0x97,
+  0xc0, 0x9a, 0x5a, 0x47, 0x87, 0xcf, 0xcf, 0x0f, 0xfe, 0x88, 0x15, 0xc0,
+  0x77, 0x1e, 0xb7, 0x36, 0xb8, 0x80, 0x4a, 0x5e, 0x09, 0xb7, 0xd3, 0xaa,
+  0xe8, 0xa1, 0xdf, 0x12, 0x74, 0xd0, 0xb1, 0xdc, 0xcf, 0xdc, 0x44, 0x2b,
+  0x1b, 0xec, 0xec, 0xed, 0x6d, 0x7f, 0xd3, 0x32, 0xdc, 0x86, 0x37, 0x4a,
+  0x11, 0x6e, 0xc9, 0x34, 0x26, 0x24, 0x04, 0xe2, 0x61, 0x7d, 0x4c, 0x1e,
+  0x98, 0x54, 0xb6, 0xd2, 0xea, 0x40, 0x49, 0x6b, 0x5f, 0x13, 0x5f, 0xb9,
+  0x03, 0x1d, 0xe0, 0xde, 0x93, 0xfd, 0x59, 0x99, 0xbe, 0x9f, 0x96, 0x25,
+  0xfd, 0x07, 0x72, 0x24, 0x7c, 0xd4, 0xda, 0x10, 0x3a, 0x86, 0x96, 0x88,
+  0x81, 0x33, 0xb4, 0x9f, 0x66, 0xc0, 0x59, 0x88, 0x51, 0x4b, 0x77, 0xbc,
+  0xa5, 0xd1, 0xa7, 0x5a, 0x71, 0xbe, 0x55, 0xbe, 0xef, 0x8f, 0xd0, 0x0e,
+  0xd7, 0xa2, 0xa5, 0x84, 0x3f, 0xf9, 0x58, 0xb5, 0x92, 0x79, 0x85, 0xee,
+  0x34, 0xa7, 0x8d, 0xb6, 0x3a, 0xa1, 0x15, 0xae, 0x1a, 0x07, 0xcb, 0xa9,
+  0xed, 0x24, 0xd3, 0x02, 0x1d, 0x64, 0x03, 0x03, 0x97, 0xe4, 0xdc, 0x3b,
+  0xf8, 0xaa, 0xe3, 0x40, 0xc0, 0x9d, 0xe8, 0x45, 0x05, 0x96, 0x46, 0x02,
+  0x8b, 0x1f, 0x96, 0x38, 0xa2, 0xb4, 0x00, 0xa6, 0x68, 0xf8, 0xf9, 0x3c,
+  0x58, 0x11, 0xbe, 0xd3, 0xeb, 0x82, 0x4f, 0xe5, 0x04, 0x03, 0x5e, 0xd3,
+  0x49, 0x09, 0xeb, 0x80, 0x34, 0xc7, 0x0f, 0xa9, 0xd4, 0x62, 0x65, 0x6f,
+  0x25, 0x35, 0xc2, 0x34, 0x92, 0x48, 0x24, 0x00, 0x21, 0x49, 0xd4, 0x10,
+  0xb5, 0xe3, 0x35, 0xd1, 0x1b, 0x55, 0x8c, 0x61, 0x10, 0x76, 0x33, 0x28,
+  0x16, 0xb6, 0x08, 0x78, 0x75, 0x08, 0xe0, 0xbb, 0xc6, 0xdb, 0xea, 0x49,
+  0x7b, 0x38, 0x80, 0xa4, 0xfa, 0xe5, 0x2f, 0x1d, 0x64, 0xfd, 0x01, 0x90,
+  0x07, 0x68, 0xf4, 0x53, 0xa0, 0x8b, 0xd9, 0xb6, 0x10, 0xc8, 0x2a, 0x46,
+  0x7d, 0x60, 0x88, 0x75, 0x10, 0x34, 0x29, 0x56, 0xaf, 0xfc, 0xa2, 0x6c,
+  0x9b, 0x60, 0x21, 0xcc, 0x86, 0x85, 0x0c, 0x3a, 0x2f, 0x7f, 0x9f, 0xe7,
+  0x8c, 0x32, 0x38, 0x40, 0xb4, 0x4b, 0xf5, 0x24, 0xb3, 0x80, 0x96, 0xa8,
+  0x78, 0x41, 0x89, 0x4a, 0x02, 0x5a, 0x9e, 0x38, 0x69, 0x4f, 0x04, 0xb7,
+  0xb2, 0x4b, 0x46, 0x67, 0x91, 0xed, 0xc6, 0x73, 0x04, 0xce, 0x3c, 0xc6,
+  0x46, 0xa8, 0x46, 0x2a, 0xdf, 0x8d, 0xe1, 0x66, 0x64, 0xc0, 0x1b, 0x2c,
+  0xe6, 0x04, 0x0c, 0x5d, 0x2b, 0x56, 0x15, 0x95, 0x19, 0x51, 0xc9, 0xa4,
+  0x20, 0x81, 0x98, 0xd0, 0xe9, 0x18, 0xae, 0x9b, 0xd1, 0x66, 0x59, 0x0d,
+  0xd0, 0xc2, 0xe2, 0x20, 0x73, 0x82, 0x2f, 0xd1, 0x62, 0x26, 0xdf, 0x91,
+  0xf1, 0xc6, 0xc9, 0x53, 0x78, 0x61, 0xd7, 0x3c, 0x17, 0xee, 0xde, 0x87,
+  0x0f, 0x2c, 0x5c, 0x44, 0x67, 0x6a, 0x65, 0xb1, 0x61, 0xb6, 0xa8, 0x9b,
+  0x4a, 0x99, 0x57, 0x5a, 0x8e, 0x48, 0x58, 0x2d, 0xbb, 0x71, 0x5d, 0x4c,
+  0x11, 0xdc, 0xec, 0x4a, 0x71, 0x51, 0xd8, 0xf7, 0x96, 0x23, 0x5c, 0xb8,
+  0x51, 0xa8, 0xad, 0x3b, 0x09, 0xa7, 0xfc, 0xa4, 0xbb, 0x84, 0x08, 0xa0,
+  0x82, 0x2b, 0x44, 0x93, 0xc5, 0x97, 0x8a, 0x8e, 0x9d, 0xf2, 0x43, 0x3e,
+  0xed, 0x90, 0xb0, 0x62, 0x4a, 0x1b, 0xeb, 0xff, 0x8c, 0x43, 0x10, 0x21,
+  0x9e, 0x68, 0x6c, 0x0a, 0x79, 0x0d, 0x52, 0x4b, 0xec, 0x15, 0xbb, 0xa5,
+  0x1c, 0xfe, 0x76, 0x90, 0xd2, 0xa2, 0xf2, 0x5a, 0xd8, 0xd1, 0x34, 0x2e,
+  0xf3, 0xc7, 0x41, 0x33, 0x9c, 0x65, 0x49, 0xc1, 0x2e, 0x6a, 0x53, 0x0c,
+  0x7d, 0x06, 0xb7, 0xaa, 0x5e, 0xfe, 0x54, 0x70, 0xd5, 0x52, 0x8a, 0x11,
+  0xb8, 0x38, 0x6b, 0x1b, 0x5c, 0x01, 0x43, 0x75, 0xa0, 0x90, 0x2a, 0x80,
+  0xb2, 0x49, 0x56, 0xf5, 0x9d, 0x3d, 0x91, 0xaa, 0xab, 0x61, 0x57, 0xa5,
+  0xa0, 0x1b, 0xd8, 0x34, 0x03, 0x50, 0x82, 0xce, 0x32, 0x9f, 0x78, 0x68,
+  0x14, 0xa9, 0x09, 0xac, 0x27, 0x81, 0xf2, 0x4d, 0x27, 0x54, 0x47, 0x03,
+  0x27, 0x56, 0xd6, 0x4a, 0xdd, 0x91, 0x62, 0x93, 0x20, 0x68, 0x7b, 0x94,
+  0x74, 0xde, 0xb0, 0xd8, 0x0f, 0x9b, 0x9c, 0x1c, 0x75, 0x70, 0x0f, 0x27,
+  0xf2, 0x8f, 0x1a, 0xc0, 0x00, 0x2f, 0xfd, 0x26, 0x1c, 0x35, 0xca, 0x28,
+  0xbf, 0x97, 0x21, 0x89, 0x35, 0x4a, 0xa5, 0x34, 0x1f, 0x5c, 0x45, 0x63,
+  0xe2, 0x56, 0xdb, 0x0d, 0x40, 0x0f, 0xe6, 0xea, 0xa6, 0x81, 0x0b, 0xec,
+  0x55, 0x20, 0x4b, 0xac, 0xf4, 0xfa, 0x78, 0x59, 0xb5, 0xdf, 0x85, 0xa0,
+  0xed, 0xf3, 0x93, 0xc3, 0x3f, 0x9d, 0x3f, 0x4e, 0x16, 0x8a, 0xfd, 0xae,
+  0x5e, 0xed, 0xd7, 0x97, 0xfb, 0xa5, 0xc2, 0x45, 0xa1, 0xe0, 0xaf, 0x64,
+  0x18, 0x88, 0x31, 0x0f, 0x47, 0x46, 0xc9, 0xe8, 0xb7, 0xd3, 0x6c, 0xc1,
+  0xb9, 0x14, 0xc5, 0x0d, 0x5b, 0x6c, 0xae, 0x15, 0x16, 0xe7, 0x41, 0x59,
+  0x80, 0x6a, 0x70, 0xaf, 0x9a, 0xb9, 0xf6, 0xe3, 0xad, 0x2f, 0xc1, 0x2a,
+  0xf8, 0x5e, 0x5c, 0x69, 0xb4, 0xa0, 0x78, 0xd4, 0x77, 0x93, 0xfc, 0x23,
+  0xd0, 0x3f, 0x0a, 0xbd, 0x32, 0x14, 0x36, 0x62, 0xd3, 0xbe, 0x51, 0x54,
+  0x2c, 0xa9, 0xc0, 0xf8, 0x9b, 0xf0, 0x5a, 0x16, 0x4c, 0x78, 0x41, 0x61,
+  0x27, 0xed, 0xc1, 0x4d, 0xcc, 0xf0, 0xd9, 0xac, 0x8a, 0x4d, 0x6e, 0xa6,
+  0x8b, 0xff, 0xb4, 0x9a, 0xf4, 0x25, 0x44, 0x80, 0x99, 0x51, 0xf1, 0x6e,
+  0x0a, 0x30, 0x36, 0x29, 0x5c, 0x51, 0xad, 0x42, 0x01, 0x63, 0xd6, 0x87,
+  0x6e, 0xa9, 0x12, 0xa4, 0x92, 0x77, 0x1d, 0x23, 0x7c, 0x89, 0x8e, 0x8f,
+  0xe0, 0x5c, 0xd9, 0x6c, 0x38, 0x9a, 0x63, 0xcb, 0x2e, 0x16, 0x04, 0x85,
+  0x31, 0x5d, 0x07, 0x54, 0x9a, 0x98, 0x2e, 0x7c, 0xd9, 0x63, 0xe1, 0xa3,
+  0xbc, 0x48, 0x6c, 0x84, 0xd6, 0xe7, 0x60, 0xba, 0x21, 0xcb, 0x81, 0x03,
+  0x8e, 0x43, 0xf1, 0x1a, 0xad, 0x1f, 0x1c, 0xe1, 0xeb, 0x90, 0xc2, 0x66,
+  0xb0, 0x6a, 0x44, 0x56, 0x5a, 0x00, 0x57, 0x2c, 0x87, 0x01, 0x7e, 0xc0,
+  0x6d, 0x9a, 0x39, 0xaf, 0xd9, 0x5f, 0xca, 0xb1, 0x22, 0x9b, 0xf8, 0xe3,
+  0x5c, 0x69, 0xf2, 0x78, 0x22, 0xa1, 0x0e, 0x14, 0x88, 0xae, 0x18, 0xd6,
+  0xe4, 0xda, 0x31, 0x4c, 0x51, 0x8e, 0xf2, 0x96, 0xbb, 0x30, 0xee, 0x5c,
+  0xe3, 0x38, 0xc3, 0x63, 0xeb, 0x5a, 0xb6, 0x97, 0x1e, 0xdc, 0x88, 0x4b,
+  0x3e, 0x90, 0xee, 0xac, 0xa8, 0xf7, 0xe7, 0xfe, 0x5c, 0xd8, 0xd9, 0xba,
+  0xcb, 0xb5, 0xf6, 0x3b, 0x85, 0x1c, 0xee, 0x40, 0xe9, 0x7f, 0xff, 0xf1,
+  0xd6, 0x37, 0x4f, 0x56, 0xbb, 0xbf, 0xf8, 0xcd, 0x74, 0xa1, 0xd6, 0x33,
+  0xff, 0xd1, 0xd1, 0x16, 0x6b, 0x6c, 0x22, 0xbd, 0x93, 0x4f, 0x2c, 0xb0,
+  0x89, 0xf4, 0x21, 0xf9, 0x04, 0xbf, 0xc8, 0x7c, 0x82, 0x5d, 0xd9, 0x20,
+  0xea, 0x94, 0x89, 0xaf, 0xd9, 0xac, 0xfb, 0xd2, 0xc4, 0x1b, 0xbe, 0xe8,
+  0x69, 0x4f, 0xff, 0x9f, 0x7b, 0xdc, 0xfd, 0x69, 0x97, 0xe3, 0xbe, 0x80,
+  0x0b, 0xad, 0xa7, 0x38, 0x5d, 0xf5, 0xb8, 0xa7, 0xff, 0x8e, 0xf3, 0xae,
+  0x5d, 0x5b, 0xe2, 0x88, 0x1e, 0xf9, 0x86, 0x33, 0x6f, 0x87, 0x3e, 0x3e,
+  0xf5, 0x8a, 0x59, 0x35, 0x2b, 0xab, 0x70, 0x9c, 0x03, 0xf6, 0x2c, 0x8f,
+  0x42, 0x0b, 0x7e, 0x4b, 0x9d, 0x19, 0x7f, 0xf2, 0xed, 0xe8, 0xcb, 0xf9,
+  0xe1, 0xf3, 0x6f, 0xef, 0xb3, 0xdd, 0xac, 0xf1, 0xf0, 0xbb, 0x23, 0xf3,
+  0x05, 0x2d, 0xd2, 0xd2, 0xc3, 0x67, 0x9f, 0xff, 0x4f, 0x3b, 0xfe, 0x7b,
+  0xcb, 0x4e, 0x7f, 0x7c, 0xf8, 0x69, 0x95, 0xf6, 0x64, 0x59, 0x3b, 0x24,
+  0xec, 0x37, 0x5f, 0xd6, 0x74, 0x62, 0x46, 0xb7, 0x31, 0x9c, 0x9a, 0x4f,
+  0xb5, 0xcb, 0xcb, 0xba, 0x3f, 0x8c, 0xc5, 0x4e, 0x65, 0x0b, 0xca, 0x15,
+  0x88, 0x29, 0x7c, 0xc1, 0xf3, 0xbd, 0xf7, 0x7f, 0xc6, 0x6d, 0xbe, 0xb7,
+  0xe2, 0xf1, 0xde, 0xfb, 0x7f, 0xfb, 0xe9, 0xf6, 0xf7, 0xba, 0x1f, 0x48,
+  0xd3, 0x2e, 0x3b, 0xb4, 0x02, 0x44, 0x63, 0x14, 0x6b, 0xd5, 0x0b, 0x7c,
+  0x09, 0x5f, 0x7f, 0xfd, 0xfc, 0xe0, 0x34, 0xe6, 0x08, 0x7b, 0x5f, 0xae,
+  0xc2, 0x8a, 0xb4, 0xcf, 0x83, 0x95, 0xe3, 0xbf, 0xff, 0x35, 0x96, 0x36,
+  0x58, 0x9d, 0x27, 0x84, 0xc3, 0xef, 0x59, 0xc2, 0xe3, 0xb4, 0xc6, 0x0a,
+  0x3a, 0xbd, 0xb4, 0xcc, 0xfb, 0x81, 0x05, 0xa0, 0x9b, 0x17, 0x5f, 0xda,
+  0x44, 0xe9, 0x9b, 0xc0, 0x33, 0xea, 0x3e, 0x72, 0x4e, 0x5f, 0x12, 0x9b,
+  0x17, 0x19, 0xf7, 0x28, 0x56, 0x9a, 0xb9, 0x85, 0x17, 0xcb, 0xad, 0xb4,
+  0xea, 0x9d, 0xed, 0x21, 0xf4, 0xa4, 0x54, 0x57, 0x70, 0x69, 0x03, 0xdd,
+  0xc8, 0x5e, 0xc1, 0x23, 0xbd, 0x2c, 0xcb, 0x74, 0x9a, 0x33, 0x61, 0xc0,
+  0x21, 0xc7, 0x13, 0xf2, 0xf2, 0xfc, 0xbc, 0x73, 0x70, 0x7a, 0xbc, 0xe8,
+  0xc8, 0xc7, 0x67, 0xea, 0x23, 0xa2, 0x04, 0x99, 0x58, 0xbb, 0x74, 0x4b,
+  0xf0, 0x69, 0xa8, 0xf1, 0x2b, 0x6c, 0x9f, 0x34, 0x6b, 0xbb, 0xf9, 0xb9,
+  0xcc, 0x7d, 0xaf, 0xbe, 0x63, 0xbc, 0x0e, 0x61, 0x81, 0x74, 0x11, 0x6a,
+  0x6b, 0xd0, 0xbc, 0x4f, 0x9e, 0xa9, 0xfb, 0x3a, 0x25, 0x4b, 0x1a, 0x69,
+  0xde, 0x9d, 0x64, 0x3d, 0x0f, 0xd5, 0x47, 0x28, 0x3b, 0x21, 0xe4, 0x1d,
+  0x08, 0x06, 0xb0, 0xed, 0x8c, 0x81, 0x08, 0x63, 0xe8, 0xa2, 0x08, 0x99,
+  0x8b, 0x6b, 0x2f, 0x41, 0x19, 0xbc, 0xaf, 0xe6, 0x89, 0xac, 0x51, 0xce,
+  0x1d, 0xbb, 0xec, 0x76, 0xb8, 0xc9, 0xa5, 0x1e, 0x11, 0xd0, 0x32, 0xc7,
+  0x7a, 0xcd, 0xfc, 0xe4, 0xcd, 0x07, 0x62, 0x8e, 0xad, 0x5b, 0xa1, 0x7c,
+  0xb3, 0x2b, 0x91, 0x84, 0x8c, 0xe0, 0x4b, 0xd1, 0x44, 0x07, 0xf6, 0x5a,
+  0x6c, 0x0d, 0xa5, 0x62, 0x60, 0xa2, 0x3b, 0x91, 0xf9, 0xa8, 0x6d, 0x89,
+  0x33, 0x18, 0x27, 0x89, 0x00, 0xd6, 0x54, 0x99, 0x40, 0x1b, 0x52, 0xb9,
+  0xe6, 0xc0, 0xda, 0xcc, 0xdb, 0x8d, 0x85, 0x76, 0xa9, 0x4c, 0xfb, 0xf6,
+  0x37, 0x4f, 0x10, 0xdb, 0x28, 0xbd, 0x15, 0x67, 0x68, 0xa9, 0x6f, 0x3e,
+  0xee, 0xee, 0x6e, 0x3e, 0xee, 0x3e, 0x66, 0x73, 0x8b, 0x66, 0xd7, 0xfb,
+  0xc8, 0xaa, 0x8a, 0x92, 0x2b, 0x38, 0xf0, 0x9d, 0x87, 0xf4, 0xf6, 0xe8,
+  0x30, 0x61, 0x5c, 0x57, 0x4c, 0xef, 0xa9, 0x45, 0xad, 0x38, 0x9e, 0xec,
+  0x29, 0x55, 0x18, 0x76, 0xc3, 0xd4, 0xd5, 0x6a, 0x4f, 0x4d, 0xcf, 0x27,
+  0xd6, 0x23, 0x5e, 0xbe, 0x0c, 0x40, 0x13, 0xf9, 0x56, 0xfd, 0xac, 0x75,
+  0xda, 0x6e, 0x69, 0x22, 0x4a, 0xba, 0x73, 0xb1, 0x1f, 0xd8, 0x22, 0x55,
+  0xef, 0xe4, 0x13, 0x28, 0x8b, 0x56, 0x61, 0x09, 0x75, 0x7d, 0x42, 0xde,
+  0xeb, 0x9d, 0x34, 0xa6, 0x51, 0x1c, 0xf5, 0x10, 0x0f, 0xa9, 0xd6, 0xa3,
+  0x5f, 0x27, 0x12, 0xe6, 0xa1, 0x88, 0x14, 0x6c, 0x07, 0x2a, 0x93, 0x24,
+  0xc0, 0x73, 0x25, 0xcf, 0x35, 0x17, 0x25, 0xe0, 0x05, 0xf4, 0xc7, 0x1a,
+  0x8d, 0xd1, 0x19, 0xfe, 0x7d, 0x30, 0xe9, 0x46, 0x37, 0x6e, 0x7d, 0x08,
+  0x5f, 0x0e, 0xdd, 0xa3, 0xb9, 0x3f, 0x0a, 0x16, 0xf9, 0x62, 0xeb, 0x6b,
+  0xf7, 0xf5, 0x1d, 0xd2, 0xf9, 0xa2, 0x78, 0xae, 0x82, 0xd1, 0x3a, 0x41,
+  0x5d, 0x84, 0x92, 0x1a, 0xf4, 0xa1, 0xca, 0xeb, 0x81, 0xe8, 0xb5, 0x93,
+  0x8d, 0x6e, 0x24, 0xa8, 0xd7, 0x24, 0xf5, 0xe5, 0xa2, 0x7a, 0xa2, 0xd9,
+  0x2d, 0xff, 0x1e, 0x81, 0xfd, 0xea, 0x7f, 0x0f, 0x85, 0x3c, 0xd6, 0xc7,
+  0x6b, 0xea, 0xf8, 0x5e, 0x58, 0x75, 0x6f, 0x00, 0xbb, 0x43, 0x6e, 0xbf,
+  0xfa, 0x7f, 0xb5, 0xe0, 0xbe, 0x5c, 0x2f, 0x6f, 0x52, 0xcc, 0xdd, 0xb9,
+  0xf9, 0xc2, 0xf2, 0x78, 0xe8, 0xe8, 0xf7, 0x09, 0xe6, 0xcd, 0xf2, 0xf8,
+  0x5f, 0x49, 0x87, 0x9f, 0x66, 0xd9, 0x80, 0x4b, 0x34, 0x25, 0xcf, 0xe8,
+  0x0f, 0x8f, 0x2b, 0x10, 0x9c, 0x25, 0x40, 0x71, 0x98, 0x58, 0x1d, 0x8a,
+  0xfe, 0x09, 0x78, 0x09, 0xbd, 0x02, 0xd2, 0xd9, 0x44, 0x6a, 0x0a, 0xbb,
+  0x4a, 0x68, 0x1b, 0x0a, 0x04, 0x85, 0x51, 0x9a, 0x1c, 0x09, 0x1e, 0x30,
+  0xbc, 0x25, 0x50, 0x9a, 0x0e, 0x3b, 0x15, 0x3f, 0x4d, 0x7b, 0x14, 0x8f,
+  0xc2, 0x32, 0xbc, 0x8f, 0x18, 0x0f, 0x05, 0x4e, 0x3c, 0xdc, 0x1c, 0x8f,
+  0x9b, 0x9f, 0x13, 0xc4, 0x5a, 0xe4, 0xf4, 0xbb, 0x5b, 0x49, 0xa8, 0x1b,
+  0x16, 0x89, 0xf7, 0x51, 0x80, 0xb3, 0x9f, 0xf5, 0x17, 0x4d, 0x5f, 0xf0,
+  0x1d, 0xed, 0x6e, 0x6d, 0xc5, 0x03, 0x5f, 0x35, 0xc6, 0x39, 0xbc, 0xd2,
+  0x6e, 0x2a, 0xa7, 0x55, 0xcf, 0x69, 0xb8, 0x6d, 0xc7, 0xdd, 0xd4, 0x72,
+  0x1a, 0xe2, 0x8d, 0xc5, 0xf2, 0x74, 0xd1, 0xd6, 0xfa, 0x11, 0x87, 0x2d,
+  0xd5, 0x8a, 0x79, 0x1e, 0xf0, 0x35, 0x4d, 0xfc, 0x26, 0xf0, 0x66, 0xb5,
+  0xeb, 0x4e, 0x36, 0x34, 0xb6, 0xea, 0xce, 0x1e, 0x73, 0x50, 0xb1, 0xbd,
+  0xe2, 0x97, 0xb1, 0x1d, 0x07, 0x0a, 0xc4, 0xfb, 0xb3, 0xad, 0x4e, 0x66,
+  0x2b, 0x30, 0x15, 0xad, 0x6c, 0x13, 0xbb, 0x14, 0xc0, 0xae, 0xd2, 0x27,
+  0x94, 0x12, 0x95, 0x16, 0x48, 0x3f, 0xec, 0xa6, 0xc6, 0xf0, 0x85, 0x0d,
+  0x92, 0x0d, 0x6b, 0xd8, 0x65, 0x29, 0x57, 0x92, 0x2c, 0xa9, 0xb4, 0xa7,
+  0xb1, 0x8e, 0xac, 0xea, 0x77, 0x2d, 0xcc, 0x81, 0x3d, 0x92, 0x7d, 0xc4,
+  0x95, 0x99, 0x09, 0x3c, 0x37, 0x30, 0x63, 0x98, 0xc5, 0xec, 0xd6, 0xdd,
+  0x7d, 0x0e, 0xd0, 0x43, 0x73, 0x8f, 0x14, 0xc3, 0x52, 0x39, 0x4a, 0xb4,
+  0x1e, 0x5f, 0x4c, 0xb8, 0x78, 0x38, 0x32, 0x94, 0xd4, 0x0d, 0xa2, 0xbc,
+  0x40, 0x8a, 0x41, 0xb2, 0x28, 0x65, 0xc4, 0xeb, 0x08, 0xc1, 0x41, 0x98,
+  0x82, 0x84, 0x56, 0x48, 0xb0, 0x80, 0x68, 0xd2, 0x00, 0x6e, 0xfb, 0x73,
+  0x3a, 0x43, 0x90, 0xa0, 0x7d, 0xcb, 0x8f, 0xd6, 0x90, 0x39, 0x86, 0xe7,
+  0x47, 0xb0, 0xbb, 0x0c, 0x06, 0x9e, 0xc5, 0x05, 0x76, 0x0c, 0xa5, 0x4b,
+  0x70, 0x2d, 0xb1, 0x2b, 0x04, 0x34, 0x0b, 0x55, 0xdc, 0x24, 0xd0, 0x74,
+  0xae, 0x05, 0x00, 0x92, 0xf9, 0xf4, 0x72, 0x96, 0x0e, 0x14, 0xaa, 0x88,
+  0xb4, 0x51, 0x6e, 0x39, 0x09, 0x11, 0x34, 0x46, 0x3c, 0xb3, 0x5b, 0x43,
+  0x6d, 0xc4, 0x20, 0x9b, 0x4d, 0x0c, 0x56, 0x52, 0x54, 0x2e, 0xf7, 0x3c,
+  0xe5, 0x5f, 0x14, 0xc3, 0x8a, 0xea, 0x36, 0x52, 0xa1, 0x34, 0xbe, 0x0a,
+  0x0d, 0x7b, 0xfd, 0xfc, 0xe2, 0xe0, 0xec, 0x02, 0x5f, 0xc6, 0x68, 0x63,
+  0xfc, 0x17, 0x06, 0x45, 0x28, 0x96, 0x06, 0xde, 0x8f, 0x00, 0xa4, 0x04,
+  0x51, 0x25, 0xc0, 0x35, 0xa8, 0x42, 0x9e, 0xe1, 0x6e, 0x0b, 0xc0, 0x6b,
+  0xaa, 0xfe, 0xeb, 0x49, 0x67, 0x61, 0xb8, 0xea, 0x7f, 0xb7, 0xc8, 0x7e,
+  0x2b, 0x34, 0x24, 0x48, 0x3c, 0x32, 0xf4, 0x2e, 0x6d, 0x9d, 0xc6, 0x6f,
+  0x31, 0x1e, 0x70, 0x35, 0xa5, 0x35, 0x33, 0x2c, 0x3b, 0x62, 0x9b, 0x6e,
+  0x1d, 0x79, 0xba, 0x01, 0xe9, 0x0b, 0x84, 0xbb, 0xeb, 0x6c, 0x54, 0x86,
+  0x92, 0x7a, 0xa0, 0x32, 0xcd, 0x6e, 0xf9, 0x7c, 0x61, 0x2c, 0x81, 0x07,
+  0x4f, 0xaa, 0x03, 0x3a, 0x10, 0x62, 0x81, 0x04, 0x68, 0xe2, 0xb6, 0x27,
+  0x31, 0x10, 0xc6, 0xd3, 0x6d, 0x02, 0xc2, 0xc0, 0x90, 0x14, 0xcb, 0x9d,
+  0x8e, 0xca, 0xb3, 0xb3, 0xfa, 0xaf, 0x71, 0x55, 0xd4, 0x02, 0x66, 0x01,
+  0x52, 0x71, 0x09, 0x72, 0xea, 0x73, 0x50, 0x90, 0x3e, 0x74, 0x99, 0x4d,
+  0x80, 0xff, 0x80, 0x5a, 0x3f, 0x1a, 0xa4, 0xd3, 0x90, 0xe1, 0xc8, 0x25,
+  0x7f, 0x39, 0xe2, 0x92, 0x00, 0x11, 0xe8, 0x90, 0x67, 0x9a, 0x96, 0x9d,
+  0x86, 0x8a, 0x54, 0x0c, 0x36, 0x4a, 0x70, 0x05, 0x12, 0x16, 0xe5, 0x76,
+  0x3c, 0xf7, 0x4a, 0x9c, 0xd7, 0x65, 0xdd, 0xea, 0xf7, 0xfb, 0x59, 0xf3,
+  0x6a, 0x60, 0x60, 0x04, 0x66, 0x4d, 0x65, 0x88, 0xc0, 0x88, 0x71, 0x0d,
+  0x13, 0x12, 0x02, 0x6d, 0x3f, 0x04, 0x80, 0x50, 0x9e, 0x66, 0xb1, 0xa2,
+  0xaf, 0x59, 0xef, 0x1c, 0xeb, 0xa2, 0x22, 0x17, 0xb2, 0xaa, 0x90, 0xce,
+  0xc3, 0x40, 0x06, 0x52, 0x0c, 0x66, 0x38, 0xa7, 0xb8, 0x2a, 0xc5, 0x0b,
+  0x6b, 0x32, 0x49, 0x94, 0xa3, 0xbb, 0xf3, 0xa3, 0x1b, 0x03, 0xfc, 0x45,
+  0x65, 0xac, 0x6b, 0x8c, 0xe5, 0x3d, 0x50, 0xf9, 0xd8, 0xd9, 0xb4, 0x98,
+  0xee, 0xde, 0x1f, 0xd8, 0x2f, 0xc4, 0xd7, 0xa6, 0xb8, 0x52, 0x21, 0x77,
+  0xe6, 0x2e, 0xb5, 0x90, 0x29, 0x7a, 0x94, 0xf4, 0xed, 0x4e, 0x2f, 0xb3,
+  0x82, 0xc6, 0x1c, 0x63, 0xf9, 0xbc, 0x70, 0x76, 0xd4, 0x74, 0xc6, 0x79,
+  0xfa, 0x09, 0x1f, 0x76, 0xcc, 0xe2, 0x19, 0x8e, 0xb0, 0x48, 0xa3, 0x04,
+  0xea, 0xc1, 0x1b, 0x40, 0x7d, 0x21, 0x6a, 0x99, 0x1b, 0xe2, 0x9d, 0x81,
+  0xf5, 0xf8, 0xf1, 0xe8, 0xe0, 0xfc, 0xa2, 0x5b, 0x8f, 0x67, 0x53, 0x3d,
+  0x25, 0xdc, 0x55, 0x78, 0xb4, 0x47, 0xe9, 0x2d, 0xd6, 0xbb, 0x45, 0xda,
+  0xb1, 0x62, 0x16, 0x38, 0x06, 0x1e, 0x42, 0xa9, 0xdb, 0x8d, 0x87, 0x9a,
+  0x59, 0x80, 0xab, 0x36, 0x2e, 0xd0, 0x1a, 0x86, 0xe2, 0x21, 0xa2, 0x0d,
+  0xe6, 0xf9, 0x0b, 0xe3, 0x1b, 0x0d, 0x42, 0xc8, 0x74, 0x6c, 0xa8, 0x68,
+  0x8c, 0xc2, 0x8f, 0x21, 0x89, 0xaf, 0xb4, 0x2c, 0x35, 0xd1, 0x28, 0xf1,
+  0x21, 0x9c, 0x35, 0x2e, 0xad, 0xed, 0x3a, 0xed, 0xb7, 0x74, 0x36, 0x49,
+  0x10, 0xc9, 0x79, 0x46, 0x4f, 0x0a, 0x15, 0x95, 0x0b, 0x10, 0x21, 0x7e,
+  0x45, 0x46, 0x58, 0xb5, 0x66, 0x22, 0x6e, 0x54, 0x7c, 0x4b, 0x57, 0x5b,
+  0x4a, 0x08, 0x04, 0x74, 0xe5, 0x80, 0xd6, 0xc2, 0x95, 0x20, 0x09, 0x15,
+  0x48, 0xa3, 0xcd, 0x38, 0x51, 0x47, 0x03, 0x17, 0xd3, 0x6a, 0xa1, 0x56,
+  0x40, 0xe3, 0xb6, 0x3f, 0xb0, 0x01, 0x24, 0xee, 0xe2, 0x5e, 0xd2, 0xf6,
+  0x0f, 0xaf, 0x76, 0x77, 0x4a, 0xca, 0x46, 0xed, 0x55, 0xa6, 0x73, 0x25,
+  0xfb, 0x98, 0xd0, 0xe7, 0x15, 0x46, 0xdc, 0x60, 0xd4, 0x65, 0x07, 0x44,
+  0x8c, 0x88, 0xda, 0xd7, 0xcf, 0x71, 0x97, 0x27, 0xd9, 0x68, 0x23, 0x39,
+  0x88, 0xca, 0x84, 0x11, 0x74, 0x32, 0x1f, 0x1f, 0xc2, 0x11, 0x94, 0xb0,
+  0x4d, 0x18, 0x3a, 0xb4, 0xc0, 0xb8, 0xe0, 0x99, 0x13, 0xca, 0x6b, 0x49,
+  0x6b, 0x37, 0x5c, 0x8b, 0xd8, 0x05, 0x88, 0xba, 0x98, 0xf0, 0xe4, 0x3c,
+  0x14, 0x61, 0xf6, 0x69, 0x5f, 0xa8, 0x11, 0x6a, 0x08, 0x3c, 0xaa, 0xbe,
+  0xae, 0x27, 0x66, 0xb2, 0xc2, 0xcf, 0x4b, 0x1d, 0x4b, 0xdd, 0xa2, 0xaa,
+  0xc1, 0xf6, 0xc4, 0xea, 0xcf, 0xa3, 0xa1, 0x22, 0xfb, 0xa3, 0x92, 0x54,
+  0x84, 0xaf, 0xa7, 0xd0, 0x99, 0x64, 0x3d, 0xcc, 0xaf, 0x53, 0xac, 0xc0,
+  0x0e, 0x4a, 0xf6, 0x48, 0xda, 0xb1, 0x58, 0xa5, 0x50, 0xb0, 0xae, 0x16,
+  0x65, 0xde, 0xb0, 0xaa, 0x0f, 0x14, 0x6d, 0xde, 0xd0, 0xf2, 0x0a, 0x34,
+  0x54, 0x1f, 0xcb, 0x6a, 0x68, 0x11, 0x5f, 0xd7, 0x02, 0x4b, 0x1d, 0x65,
+  0x2d, 0x0e, 0x21, 0xd0, 0x13, 0x81, 0x26, 0x20, 0xee, 0xf9, 0x12, 0x42,
+  0xb2, 0xf9, 0x45, 0xeb, 0x8f, 0xaf, 0xc8, 0x46, 0xf5, 0xaf, 0x32, 0xd0,
+  0x1e, 0xbb, 0x81, 0x19, 0x38, 0xac, 0x9e, 0x1a, 0x47, 0x60, 0x55, 0xfc,
+  0xfc, 0xb5, 0xe3, 0x08, 0x24, 0x6a, 0xb8, 0x3a, 0x8a, 0x58, 0x32, 0x50,
+  0x79, 0x81, 0xc6, 0x54, 0x7f, 0x48, 0x04, 0xb7, 0x89, 0x98, 0x01, 0xf3,
+  0x82, 0xfa, 0x06, 0xda, 0x34, 0x1e, 0xa6, 0x3e, 0x43, 0xd4, 0xe4, 0xfd,
+  0x5b, 0x16, 0x7a, 0x5f, 0x0d, 0xcc, 0x6f, 0x36, 0x22, 0x3c, 0x20, 0xbf,
+  0x0f, 0x78, 0xd7, 0xd5, 0x05, 0x64, 0x27, 0x21, 0x8b, 0x88, 0x7c, 0xc6,
+  0xd2, 0xd5, 0x7d, 0x82, 0xa8, 0x16, 0x9c, 0x5b, 0x10, 0x46, 0x91, 0x8c,
+  0x4d, 0x0e, 0x5d, 0x2e, 0x88, 0x9a, 0x24, 0x1a, 0xc1, 0xd7, 0x22, 0x24,
+  0x32, 0xc7, 0xf8, 0x56, 0x86, 0x6d, 0x5f, 0x93, 0x86, 0x62, 0x25, 0xcf,
+  0xaa, 0x70, 0x18, 0x96, 0x16, 0xcb, 0xdd, 0x06, 0x23, 0xae, 0x32, 0xe9,
+  0xbf, 0x5f, 0x56, 0x44, 0xba, 0x9b, 0x65, 0xbf, 0xb1, 0x51, 0xfe, 0x5e,
+  0x59, 0x11, 0xa7, 0xa6, 0xa5, 0x24, 0xe9, 0x4a, 0x23, 0x14, 0xc5, 0xe5,
+  0x82, 0x2e, 0xea, 0x5e, 0xb8, 0x2e, 0x18, 0x7e, 0x8c, 0xf8, 0x3d, 0x43,
+  0xab, 0x6b, 0x05, 0x5c, 0x0a, 0xd1, 0xae, 0x25, 0xbd, 0x41, 0xf0, 0x6f,
+  0x28, 0x13, 0x22, 0x1b, 0x0d, 0x43, 0xc2, 0x2c, 0x01, 0xfb, 0x8d, 0xc7,
+  0xd9, 0xc0, 0xb2, 0xfb, 0xe8, 0x53, 0xec, 0x5e, 0xf3, 0xe2, 0x60, 0x18,
+  0xed, 0x84, 0x73, 0xb8, 0x90, 0x08, 0xd0, 0x3d, 0xdc, 0x66, 0x1c, 0xf7,
+  0xf3, 0x76, 0x40, 0x8a, 0x87, 0xcf, 0x90, 0x7e, 0xce, 0xf9, 0xa0, 0xe1,
+  0x12, 0x80, 0x06, 0x70, 0xce, 0xb1, 0x6c, 0x61, 0xa3, 0xd2, 0xd1, 0x0d,
+  0x39, 0x51, 0x28, 0x91, 0xcf, 0xf6, 0x11, 0x7a, 0xd0, 0x42, 0x6a, 0xb0,
+  0xf9, 0x57, 0x98, 0x65, 0x60, 0x72, 0x2d, 0x0a, 0x33, 0xd1, 0xcc, 0x6d,
+  0xdf, 0x28, 0x0f, 0xc9, 0xe4, 0x5a, 0x27, 0xd8, 0x3a, 0x4d, 0x03, 0x89,
+  0xbd, 0xd9, 0x3d, 0xa6, 0x2a, 0xc7, 0x6a, 0x02, 0xa9, 0x3f, 0xc2, 0x4b,
+  0x32, 0x4e, 0xb5, 0xb7, 0x7b, 0xcf, 0x30, 0x75, 0xbb, 0x80, 0xe6, 0xde,
+  0x28, 0x98, 0xde, 0x75, 0x3f, 0x33, 0x1f, 0x80, 0x7b, 0xbc, 0xac, 0xb0,
+  0x16, 0x41, 0xb1, 0xf4, 0x86, 0x4e, 0x8e, 0x49, 0x53, 0xb9, 0x87, 0xaf,
+  0x2a, 0xcc, 0x0b, 0x9a, 0x86, 0x43, 0xb2, 0x65, 0x46, 0x16, 0x97, 0x4c,
+  0x5c, 0x95, 0x52, 0xd8, 0x6d, 0xb3, 0x18, 0x0e, 0xa9, 0x36, 0x05, 0x46,
+  0xca, 0x57, 0xb3, 0x1c, 0x94, 0x02, 0x76, 0x28, 0x4d, 0x8b, 0x1c, 0x4b,
+  0xfb, 0x58, 0x21, 0x37, 0xcb, 0xbe, 0xb2, 0xbe, 0x12, 0xee, 0x8d, 0x50,
+  0x52, 0xcb, 0xaa, 0x6c, 0xf2, 0x37, 0xdd, 0x31, 0xb5, 0x87, 0x97, 0xb9,
+  0x16, 0x7b, 0x5a, 0x65, 0xff, 0xea, 0xef, 0xac, 0x78, 0x71, 0x6e, 0xd5,
+  0x33, 0x32, 0x98, 0x3b, 0xdf, 0xb5, 0xc9, 0x92, 0x84, 0x55, 0x26, 0xcf,
+  0x34, 0xf2, 0x3c, 0xca, 0xec, 0x52, 0x17, 0x09, 0xdb, 0x36, 0xa5, 0x9a,
+  0x6b, 0x41, 0x15, 0x5c, 0xf5, 0xfe, 0xa3, 0xf7, 0x61, 0xbd, 0x08, 0x39,
+  0x98, 0x53, 0x5b, 0x04, 0x75, 0x59, 0xc5, 0x27, 0xd8, 0x11, 0xcd, 0xa3,
+  0xb3, 0x5a, 0x3b, 0x24, 0x49, 0x99, 0xdd, 0x0a, 0x16, 0xf4, 0xa0, 0x12,
+  0x28, 0xe7, 0xff, 0x7f, 0x7b, 0xdf, 0xfe, 0xd4, 0xc6, 0x95, 0xad, 0xfb,
+  0x33, 0xfc, 0x15, 0x7d, 0x74, 0x2f, 0x65, 0x38, 0x23, 0x89, 0x97, 0xdf,
+  0xc7, 0xc9, 0x09, 0xc6, 0x24, 0xe1, 0x0e, 0x06, 0x06, 0x61, 0x3b, 0x39,
+  0x99, 0x14, 0xd5, 0xa0, 0x06, 0x7a, 0x2c, 0x24, 0x45, 0x2d, 0xf1, 0x88,
+  0x2b, 0xf7, 0x6f, 0xbf, 0x7b, 0x7d, 0xeb, 0xb1, 0xd7, 0x6e, 0x09, 0x8c,
+  0x1d, 0x7b, 0xce, 0x54, 0x9d, 0x9b, 0x4a, 0x19, 0x90, 0xba, 0xf7, 0x73,
+  0xed, 0xb5, 0xd7, 0xf3, 0x5b, 0x5c, 0x49, 0x22, 0xcf, 0x1c, 0x82, 0x99,
+  0x03, 0xb7, 0x1c, 0x4d, 0xfa, 0x4d, 0x29, 0xd6, 0xc4, 0x00, 0x21, 0x6e,
+  0x10, 0x95, 0x8d, 0x02, 0x49, 0x35, 0x9c, 0x3e, 0xa9, 0xd8, 0xda, 0x00,
+  0x9a, 0x53, 0x72, 0x19, 0xf6, 0xf2, 0x13, 0xf8, 0x06, 0xfa, 0x37, 0xd1,
+  0x91, 0x71, 0xc2, 0xf5, 0xae, 0xa7, 0x8a, 0x47, 0x47, 0x38, 0x37, 0x2a,
+  0x58, 0x42, 0x0d, 0x22, 0x5e, 0x9d, 0x5d, 0xae, 0x1a, 0x6f, 0xcd, 0x02,
+  0xa0, 0xaf, 0xbc, 0xe8, 0x2b, 0x58, 0x4e, 0xfa, 0xb1, 0x0a, 0xe7, 0xa8,
+  0xc0, 0xf9, 0x20, 0x28, 0x93, 0x37, 0x7d, 0x76, 0x33, 0x48, 0x12, 0xc1,
+  0x8c, 0xd1, 0x33, 0x69, 0x35, 0x55, 0xec, 0x83, 0x85, 0x90, 0x7d, 0x2b,
+  0x28, 0x9d, 0xc0, 0x33, 0x01, 0x48, 0x7b, 0x38, 0x10, 0xc3, 0xc9, 0xe8,
+  0x4c, 0x4b, 0x8d, 0xca, 0x9d, 0x86, 0xb5, 0xe7, 0xe3, 0xe2, 0xe0, 0xfe,
+  0x09, 0x2d, 0xc8, 0xe9, 0x3e, 0x6f, 0xd4, 0x4f, 0x22, 0x7b, 0xc9, 0xd3,
+  0x16, 0xbf, 0x2f, 0x65, 0x70, 0x8d, 0x7b, 0x55, 0xab, 0xa0, 0xf2, 0x0a,
+  0x94, 0x48, 0xd3, 0xc0, 0x51, 0x45, 0x09, 0xe0, 0x08, 0x0b, 0x93, 0xc0,
+  0x9b, 0x10, 0x35, 0x36, 0x56, 0x5a, 0xe1, 0x6a, 0x6e, 0xc0, 0x05, 0xdc,
+  0x54, 0xc7, 0x75, 0x58, 0x1e, 0x4f, 0x33, 0x11, 0x9e, 0x54, 0x6b, 0x2b,
+  0x1f, 0x9b, 0xec, 0x1e, 0x74, 0x4b, 0x9f, 0xa3, 0x11, 0x21, 0xeb, 0xa0,
+  0x89, 0x7a, 0x6b, 0x50, 0x86, 0x91, 0x49, 0xf6, 0xeb, 0x06, 0x22, 0xfe,
+  0xc9, 0x00, 0xe2, 0x90, 0x16, 0xe2, 0x03, 0x2e, 0x20, 0x49, 0xd1, 0xe1,
+  0xc3, 0xda, 0x5c, 0x01, 0x5d, 0x3d, 0x1c, 0x8e, 0x51, 0x71, 0x12, 0x04,
+  0x39, 0xb8, 0xca, 0x0c, 0xce, 0xce, 0x2c, 0xf3, 0x72, 0x74, 0x8c, 0x36,
+  0xfc, 0x4c, 0x6c, 0xeb, 0xf2, 0x91, 0x8a, 0xf4, 0x5d, 0xba, 0x28, 0x8e,
+  0xf3, 0xaa, 0x78, 0xfc, 0x30, 0xb3, 0xb2, 0xa2, 0xe3, 0xc0, 0x46, 0x9a,
+  0x3e, 0x33, 0x9c, 0xdf, 0x23, 0xd5, 0x14, 0xb8, 0xb9, 0x57, 0x7d, 0x07,
+  0xac, 0xaf, 0x9e, 0x11, 0x6e, 0x15, 0x66, 0xa9, 0x41, 0x10, 0x3a, 0x86,
+  0xe7, 0xa2, 0x0a, 0x05, 0x12, 0xe9, 0x59, 0xcd, 0x6a, 0x51, 0x7a, 0xcf,
+  0x11, 0x52, 0xf0, 0xee, 0x9c, 0xab, 0x2e, 0x27, 0xf5, 0xd0, 0x48, 0xeb,
+  0x06, 0xc8, 0x2b, 0xe8, 0x83, 0xf0, 0xa2, 0xd0, 0x46, 0x51, 0x68, 0x32,
+  0x61, 0xf4, 0x65, 0x72, 0xaa, 0x13, 0x8a, 0xb1, 0x9f, 0x68, 0x2e, 0xcd,
+  0x8d, 0xd6, 0x7e, 0x86, 0xb9, 0x86, 0x99, 0x2c, 0x43, 0x09, 0x4e, 0xa1,
+  0x80, 0x6b, 0x3e, 0xc2, 0x18, 0x00, 0xbd, 0xa8, 0xc5, 0xca, 0xf7, 0x30,
+  0xcc, 0xb9, 0xb3, 0xab, 0x6a, 0x8b, 0x0c, 0x52, 0x79, 0x70, 0x8c, 0x7e,
+  0x97, 0x2e, 0x5e, 0x0c, 0xaf, 0x57, 0x1e, 0x73, 0xb1, 0x5e, 0x5a, 0x54,
+  0x4a, 0xa4, 0xf3, 0xcc, 0x96, 0x71, 0x3f, 0xc9, 0x3a, 0x0f, 0xeb, 0x41,
+  0x2f, 0xe5, 0x4c, 0x24, 0x6f, 0x04, 0x3a, 0x59, 0x26, 0xcc, 0x2c, 0x82,
+  0xf1, 0x96, 0x0e, 0xc3, 0x05, 0xd6, 0xd9, 0xe9, 0xb4, 0xb6, 0x7e, 0xda,
+  0xdf, 0x3b, 0x38, 0x5c, 0x52, 0xe3, 0x1f, 0xa2, 0x72, 0x14, 0x4e, 0xc3,
+  0xb3, 0xc7, 0xaf, 0x07, 0xa7, 0xe1, 0x7b, 0xd1, 0x5f, 0xda, 0xe3, 0xeb,
+  0xf1, 0x3d, 0xb3, 0xf0, 0xd6, 0x6a, 0x3c, 0x3f, 0x39, 0xab, 0xca, 0xea,
+  0xd7, 0x9a, 0xdc, 0xd3, 0xe5, 0x9a, 0x30, 0xf7, 0x30, 0xf7, 0xa5, 0x44,
+  0xce, 0xf3, 0x79, 0x4d, 0x41, 0x4f, 0x71, 0x39, 0x99, 0x2a, 0xde, 0x5e,
+  0xae, 0x31, 0xc7, 0xe3, 0xa8, 0xf4, 0x2b, 0xe1, 0x6d, 0x62, 0xa3, 0x14,
+  0x69, 0x36, 0x2a, 0x70, 0x24, 0xcd, 0xe2, 0x25, 0xf0, 0xbf, 0xab, 0xb0,
+  0x6e, 0xd4, 0xb2, 0xb3, 0x82, 0xd7, 0x4c, 0xe0, 0x80, 0x88, 0x42, 0x28,
+  0xcc, 0xe3, 0xd5, 0x27, 0x8f, 0x97, 0xea, 0x69, 0x6e, 0x34, 0xf4, 0xec,
+  0x23, 0x41, 0x46, 0x9f, 0x10, 0x4b, 0x86, 0xe6, 0x6e, 0x5f, 0x5f, 0x7d,
+  0xc2, 0x88, 0x12, 0x34, 0xa9, 0x34, 0x58, 0x2a, 0x09, 0x92, 0x77, 0x58,
+  0x98, 0x10, 0xcc, 0xd1, 0x5e, 0x7a, 0x34, 0xd6, 0x1f, 0x7d, 0xdf, 0xd1,
+  0xf9, 0x6d, 0x01, 0x5d, 0xdc, 0xd1, 0x7a, 0x33, 0xe3, 0x8d, 0xbb, 0x5c,
+  0x8d, 0xbf, 0x51, 0xad, 0x33, 0x9f, 0x9d, 0xc4, 0x1f, 0xae, 0x25, 0x7b,
+  0x4d, 0x33, 0xa0, 0x07, 0xf9, 0x7e, 0xa7, 0xbf, 0xd6, 0x74, 0xc7, 0xd7,
+  0x75, 0xc7, 0xd7, 0xff, 0xc4, 0x8e, 0xaf, 0x7f, 0xce, 0x8e, 0xaf, 0x7f,
+  0xf2, 0x8e, 0x3f, 0x79, 0xf4, 0xf8, 0xe9, 0xac, 0x1d, 0x5f, 0xff, 0xb2,
+  0x3b, 0xbe, 0xfe, 0xd1, 0x1d, 0x5f, 0xff, 0x67, 0xed, 0xf8, 0xda, 0x57,
+  0xd8, 0x71, 0x4d, 0xb5, 0x84, 0x20, 0xf7, 0xad, 0x62, 0xb2, 0x49, 0xb6,
+  0x2a, 0xe1, 0x96, 0x12, 0x9e, 0xaf, 0x00, 0xe3, 0xcb, 0xa3, 0x2a, 0x1c,
+  0xb9, 0xdc, 0x14, 0x2e, 0xe5, 0xce, 0xde, 0x26, 0x57, 0x60, 0x3c, 0xa9,
+  0xe1, 0x0c, 0xbf, 0x60, 0x10, 0x3c, 0xc2, 0xd6, 0x3f, 0x68, 0x3d, 0xd0,
+  0x60, 0x16, 0x75, 0x51, 0x29, 0x6c, 0x30, 0x77, 0x33, 0x98, 0x8c, 0xbf,
+  0x36, 0x9c, 0x0a, 0x33, 0x6b, 0x9e, 0xd1, 0x47, 0xd8, 0xb4, 0x79, 0x16,
+  0x3f, 0x9d, 0x4d, 0x73, 0xfb, 0x02, 0x50, 0x72, 0x37, 0x7b, 0xbe, 0x15,
+  0x55, 0xc1, 0x32, 0x6c, 0x75, 0xc3, 0x6e, 0xc2, 0x6d, 0x23, 0xc9, 0x89,
+  0x09, 0xe4, 0x51, 0xae, 0x36, 0x4f, 0x9d, 0xeb, 0x31, 0x15, 0x40, 0x3d,
+  0x0d, 0x17, 0x72, 0x86, 0x97, 0x2a, 0x29, 0x70, 0x35, 0x62, 0x80, 0x7c,
+  0x0e, 0xe9, 0x48, 0x50, 0x57, 0x6a, 0x99, 0xcc, 0x6d, 0x89, 0xfa, 0x25,
+  0xad, 0xc4, 0xf7, 0x8a, 0x5d, 0x0a, 0xa4, 0xc9, 0xa0, 0xf9, 0x17, 0x84,
+  0xc4, 0x1d, 0x71, 0xe4, 0xe8, 0x39, 0x45, 0x53, 0x8e, 0xf7, 0x73, 0x6e,
+  0x8d, 0x6a, 0x25, 0x5c, 0x35, 0x7f, 0xda, 0x20, 0x2b, 0x01, 0xd4, 0x14,
+  0x61, 0x4e, 0x6e, 0x5c, 0x15, 0xa9, 0x34, 0xb3, 0x75, 0xa0, 0xf8, 0x74,
+  0xd8, 0xde, 0x77, 0x65, 0xbf, 0x4b, 0xf2, 0x26, 0x29, 0x83, 0xc4, 0x83,
+  0x82, 0x5c, 0xfb, 0x5e, 0xac, 0x38, 0xa5, 0x69, 0x12, 0x43, 0xf1, 0x29,
+  0x7c, 0x2d, 0x92, 0x9a, 0x01, 0xd1, 0x53, 0xdf, 0xa7, 0xd9, 0x08, 0xbc,
+  0x9f, 0x61, 0x51, 0xf5, 0x8d, 0x7e, 0x8c, 0xf6, 0x7c, 0xff, 0xad, 0xed,
+  0xfb, 0x69, 0x83, 0x8f, 0xeb, 0xa0, 0xbb, 0xa8, 0x79, 0xc8, 0x84, 0x28,
+  0x64, 0x19, 0x29, 0x31, 0x6c, 0x21, 0xb2, 0xb2, 0xd5, 0x97, 0x9f, 0xd0,
+  0x12, 0xd0, 0x95, 0xc4, 0x0c, 0x3b, 0x26, 0x6b, 0x50, 0xcf, 0x12, 0x0d,
+  0xd1, 0x5e, 0x9e, 0x11, 0xf0, 0xee, 0xd6, 0xe6, 0xa1, 0xd3, 0x00, 0x18,
+  0x59, 0xb1, 0x49, 0x20, 0xdd, 0x31, 0xe8, 0x40, 0x66, 0xc0, 0xc1, 0x4b,
+  0xfa, 0x4e, 0x1d, 0x0d, 0xa8, 0x3d, 0xb5, 0xad, 0x54, 0x08, 0x63, 0x9c,
+  0x20, 0x0a, 0x7a, 0xa8, 0x27, 0x0f, 0x77, 0x93, 0x31, 0x9a, 0x91, 0x07,
+  0x5b, 0x91, 0xf2, 0xf6, 0x24, 0x42, 0x1b, 0x46, 0x1b, 0x3d, 0x10, 0xc3,
+  0x55, 0x11, 0x0f, 0x66, 0x28, 0x34, 0xfd, 0x14, 0x88, 0x68, 0x7b, 0x9c,
+  0x16, 0xed, 0x25, 0xaa, 0xed, 0x16, 0xc7, 0x93, 0x33, 0x65, 0xfb, 0x95,
+  0xab, 0xed, 0x23, 0xb6, 0x21, 0x3d, 0xf4, 0x52, 0x00, 0x3c, 0x10, 0xc4,
+  0x89, 0x24, 0x87, 0x73, 0xe8, 0x5c, 0x45, 0x1e, 0xae, 0x20, 0x47, 0x9f,
+  0xdc, 0x12, 0x58, 0x7d, 0xcb, 0x66, 0xdc, 0xdb, 0x3a, 0xc1, 0x0d, 0xdd,
+  0x45, 0x7b, 0xb7, 0xf4, 0xf0, 0x11, 0x32, 0xbc, 0x6d, 0x5c, 0xb5, 0x15,
+  0x6f, 0x5d, 0xcb, 0x0e, 0x7f, 0x42, 0xf0, 0xa6, 0xdb, 0xc4, 0x3a, 0x8a,
+  0x94, 0x47, 0x04, 0x63, 0xea, 0x33, 0xb2, 0x1d, 0x9f, 0x0c, 0x5b, 0xa7,
+  0x81, 0xa3, 0x0f, 0x86, 0x8a, 0x74, 0x2b, 0xfc, 0x53, 0x8f, 0xf3, 0xe1,
+  0xe6, 0x7e, 0xf6, 0x3d, 0x44, 0x73, 0x32, 0x9b, 0x66, 0x8b, 0x24, 0x6e,
+  0x3c, 0x79, 0xb8, 0xba, 0x0e, 0xc4, 0x5f, 0xfd, 0x0e, 0x5f, 0x49, 0xfa,
+  0x7d, 0xf8, 0xd0, 0xce, 0x71, 0xd1, 0x67, 0xcb, 0x06, 0x31, 0x39, 0x51,
+  0x86, 0xa1, 0x43, 0x32, 0x21, 0x66, 0xe0, 0x61, 0x24, 0x69, 0x97, 0x14,
+  0xee, 0x75, 0x29, 0x68, 0x48, 0xce, 0x8c, 0x2c, 0x62, 0x8e, 0x58, 0x3e,
+  0x44, 0x57, 0x26, 0xb6, 0x19, 0x8d, 0x90, 0xd9, 0xc6, 0xe6, 0x5f, 0x97,
+  0xd4, 0xf7, 0x6e, 0xae, 0x2c, 0x14, 0x0a, 0x13, 0xa7, 0x3d, 0x99, 0x1c,
+  0x14, 0xe9, 0x3f, 0xa6, 0x1e, 0x14, 0x5d, 0x27, 0xbe, 0xa5, 0x2e, 0x04,
+  0xbf, 0x26, 0x75, 0x8a, 0x51, 0x1b, 0xe8, 0xa7, 0xe1, 0x42, 0xf8, 0x16,
+  0xef, 0xa6, 0x90, 0xa4, 0xef, 0x7b, 0xed, 0xfb, 0x69, 0xf8, 0x59, 0xb4,
+  0x60, 0x15, 0x4a, 0x76, 0xb5, 0x3f, 0x70, 0x25, 0x56, 0x0e, 0x09, 0x43,
+  0x5f, 0xaa, 0xd0, 0xd1, 0x0e, 0x1d, 0xed, 0xee, 0xbd, 0xda, 0xda, 0xd9,
+  0xf8, 0x39, 0x06, 0xce, 0x20, 0xdd, 0x1f, 0x4b, 0x18, 0x06, 0x72, 0x14,
+  0x74, 0xdb, 0x9b, 0xa3, 0x70, 0xc9, 0x87, 0x6f, 0x17, 0xd7, 0x97, 0x48,
+  0x13, 0x95, 0xbd, 0x18, 0x12, 0xdc, 0x5b, 0x52, 0x32, 0x98, 0x6b, 0xda,
+  0xb8, 0xc2, 0xbb, 0xbe, 0x90, 0x4a, 0x55, 0x00, 0x3f, 0x24, 0xf2, 0xa2,
+  0xe3, 0x88, 0xf4, 0x4f, 0x7b, 0x74, 0xe3, 0x4a, 0xcb, 0x9a, 0x51, 0x9d,
+  0xaa, 0x14, 0xe0, 0x42, 0x15, 0x79, 0x70, 0x8c, 0xea, 0x16, 0x62, 0x37,
+  0x17, 0x6e, 0xc8, 0xc0, 0xf2, 0xf4, 0x55, 0x7f, 0x7a, 0xf3, 0x64, 0xea,
+  0x5f, 0x06, 0xd3, 0xc3, 0x35, 0xf8, 0xf1, 0xad, 0xd3, 0x9e, 0xef, 0x0b,
+  0x03, 0x77, 0x3c, 0x39, 0x3d, 0x8d, 0x60, 0x09, 0x63, 0x3a, 0xb8, 0xe3,
+  0xa2, 0xd7, 0x2f, 0xc6, 0x02, 0xeb, 0x98, 0xbd, 0x08, 0x3f, 0xbf, 0x09,
+  0x42, 0x96, 0xd6, 0x57, 0x24, 0xec, 0x01, 0xe1, 0x9a, 0x51, 0x40, 0xa1,
+  0x17, 0x8c, 0x0f, 0xb7, 0xb5, 0xdc, 0x56, 0xd1, 0xb5, 0x27, 0x03, 0xeb,
+  0x7e, 0xae, 0xf7, 0xfd, 0xe1, 0xcf, 0xfb, 0x5b, 0xdf, 0xbc, 0x20, 0x01,
+  0xe4, 0x5b, 0x54, 0x67, 0x2d, 0x04, 0xe1, 0x25, 0x8a, 0x24, 0x37, 0x43,
+  0xb3, 0xd2, 0xfc, 0xf4, 0x6a, 0xbb, 0xb3, 0xbf, 0xb3, 0xb7, 0xf9, 0xcd,
+  0x8b, 0x9f, 0xc8, 0x90, 0x1c, 0x24, 0xd6, 0x9b, 0xf4, 0x2d, 0xfb, 0x38,
+  0xd3, 0x8a, 0xbc, 0xfa, 0xea, 0xee, 0xd6, 0xbb, 0xa3, 0xad, 0xdd, 0xb7,
+  0xdf, 0xbc, 0xb8, 0xcc, 0x47, 0x4d, 0xcc, 0x40, 0xdf, 0x23, 0x13, 0x5f,
+  0xff, 0xb2, 0x1c, 0x0d, 0xfa, 0x40, 0xaa, 0x0a, 0xdf, 0x97, 0xb4, 0xf8,
+  0x31, 0x92, 0x38, 0x5d, 0x02, 0x1f, 0x4e, 0x3c, 0xa3, 0xb0, 0x97, 0x2f,
+  0xa7, 0x78, 0xd7, 0xfe, 0x8c, 0x65, 0xea, 0x97, 0xe3, 0xd5, 0x95, 0x15,
+  0x59, 0xb4, 0x8f, 0x06, 0x9e, 0x04, 0x66, 0x71, 0x5a, 0x9e, 0xc5, 0x73,
+  0x45, 0x3e, 0x8b, 0xe3, 0xde, 0xfb, 0xaa, 0xfc, 0xbd, 0xc8, 0x5e, 0x40,
+  0xf6, 0x35, 0x5b, 0x2f, 0xe0, 0xf9, 0x14, 0x53, 0xf2, 0x10, 0xa5, 0xa5,
+  0x5e, 0xee, 0xfc, 0xb5, 0xb3, 0xfd, 0x5f, 0x5b, 0x4a, 0xfb, 0x8b, 0x17,
+  0x93, 0x8a, 0x83, 0x72, 0x1e, 0xad, 0xae, 0xd1, 0x5d, 0xd6, 0xa3, 0x1a,
+  0x9d, 0xa3, 0xa5, 0x44, 0xd4, 0x93, 0x32, 0x37, 0xc7, 0x61, 0x39, 0xdf,
+  0x67, 0xe8, 0x27, 0x22, 0xac, 0x58, 0x51, 0x3b, 0x2b, 0x39, 0xae, 0xe6,
+  0x5f, 0x46, 0x9c, 0x15, 0xde, 0x2a, 0x92, 0xc2, 0xc8, 0xd5, 0x2b, 0xe1,
+  0xf1, 0x58, 0x86, 0xc3, 0x4b, 0x5f, 0x08, 0x87, 0x06, 0x23, 0x41, 0x9c,
+  0x6c, 0x7c, 0x63, 0x2c, 0x76, 0x17, 0x08, 0x9b, 0x4c, 0x7b, 0x66, 0xc9,
+  0xdd, 0x29, 0xa0, 0xdf, 0xcf, 0x43, 0xfa, 0x4d, 0x3a, 0x5a, 0x5d, 0x59,
+  0x7b, 0x98, 0x8d, 0xa7, 0x4b, 0xea, 0x02, 0x4d, 0x66, 0x6a, 0xa7, 0xf0,
+  0x6a, 0x38, 0x51, 0x75, 0x38, 0xd4, 0xda, 0xe7, 0xc9, 0x6e, 0x69, 0x40,
+  0x10, 0x2c, 0xb1, 0xbc, 0x44, 0x7a, 0x62, 0xb4, 0xc2, 0xa8, 0x8a, 0x52,
+  0xe5, 0x05, 0x4d, 0xba, 0xa8, 0x32, 0x0d, 0xce, 0x71, 0xbe, 0x25, 0x14,
+  0xdd, 0xc8, 0x7a, 0xc5, 0x19, 0xa2, 0x0d, 0x78, 0x91, 0x2b, 0xab, 0x77,
+  0x2b, 0xc9, 0x9b, 0x41, 0x16, 0xef, 0x0f, 0xae, 0x50, 0xba, 0x48, 0x4c,
+  0xcd, 0x88, 0xf0, 0x31, 0x80, 0x7c, 0x8d, 0xdc, 0xe1, 0x71, 0xe8, 0x2c,
+  0x58, 0x70, 0x1c, 0xcf, 0x28, 0xae, 0x50, 0x5b, 0x2c, 0x5b, 0x64, 0xc3,
+  0xc1, 0x4a, 0x98, 0x62, 0xba, 0x08, 0x5f, 0xaa, 0x04, 0xc6, 0xf4, 0x9a,
+  0x7f, 0x6c, 0x6f, 0xdd, 0x18, 0x64, 0x67, 0x57, 0x9f, 0xad, 0xb5, 0x57,
+  0x1f, 0x3f, 0xa5, 0x8a, 0x7a, 0xcb, 0xb7, 0xec, 0xaa, 0xcc, 0x51, 0xb7,
+  0xf4, 0x77, 0x70, 0xc9, 0x30, 0xee, 0x16, 0xa2, 0x8d, 0x5f, 0xd0, 0xaf,
+  0xdf, 0x4e, 0x01, 0x65, 0x1e, 0x28, 0x42, 0x79, 0x2e, 0x2e, 0x17, 0x28,
+  0x5a, 0x06, 0x14, 0x4c, 0x56, 0x75, 0x56, 0x63, 0x38, 0xa0, 0x49, 0x03,
+  0xd6, 0xe5, 0xaa, 0xf0, 0x90, 0xe4, 0x50, 0x85, 0xc2, 0x43, 0x0c, 0x53,
+  0x47, 0xb6, 0xd8, 0x5b, 0xdb, 0x8a, 0x60, 0xef, 0x9a, 0x8e, 0xc2, 0x60,
+  0xe4, 0x87, 0x8c, 0xa0, 0x05, 0x1b, 0xeb, 0x48, 0x8d, 0xaa, 0xc2, 0xd7,
+  0x72, 0x2b, 0x53, 0x4f, 0xf2, 0x56, 0x57, 0x70, 0x24, 0x81, 0xc9, 0x09,
+  0x58, 0xbc, 0x53, 0xbb, 0x05, 0x4d, 0x1f, 0x83, 0x5d, 0x98, 0x25, 0x61,
+  0x50, 0x23, 0x71, 0xed, 0x30, 0xae, 0xca, 0x70, 0x2d, 0xc6, 0xf0, 0x90,
+  0xc0, 0x7e, 0xee, 0x00, 0x91, 0x5c, 0xa1, 0xe2, 0x84, 0x9b, 0x9c, 0x09,
+  0xd3, 0xe2, 0x69, 0x88, 0x17, 0x10, 0x03, 0x59, 0xbc, 0xa0, 0xf1, 0x2f,
+  0x99, 0x3f, 0x24, 0x1f, 0x3b, 0x2c, 0x27, 0x33, 0x71, 0xa4, 0xa2, 0x43,
+  0x68, 0x8d, 0xde, 0x55, 0xb1, 0x81, 0x45, 0x06, 0x29, 0x00, 0x8c, 0x46,
+  0xdd, 0x22, 0x68, 0x21, 0xb9, 0xb1, 0xc7, 0x8c, 0x05, 0xfa, 0xba, 0x82,
+  0x8e, 0x25, 0x4b, 0x26, 0x35, 0x2c, 0xba, 0x54, 0x5d, 0x7a, 0xb1, 0xb5,
+  0x64, 0x70, 0x77, 0xe5, 0x38, 0x02, 0xd2, 0x23, 0x66, 0x29, 0x05, 0x29,
+  0x8d, 0xe5, 0x75, 0x38, 0x58, 0x2e, 0x6e, 0xb6, 0x3a, 0xe5, 0xa8, 0xa3,
+  0x65, 0x0e, 0x9d, 0x37, 0xb6, 0x58, 0xc6, 0xea, 0x27, 0x69, 0x43, 0xa4,
+  0x84, 0x17, 0x57, 0x11, 0xc2, 0xde, 0xeb, 0xc4, 0xd6, 0x90, 0x03, 0xbc,
+  0x8b, 0xc5, 0x60, 0x11, 0xac, 0x6b, 0x48, 0x4d, 0x5c, 0xb7, 0x09, 0x5b,
+  0xa1, 0x48, 0x6b, 0x79, 0x10, 0x6b, 0x10, 0xf5, 0x2c, 0x62, 0x95, 0x23,
+  0xa4, 0xd3, 0xfc, 0x44, 0xea, 0xcf, 0x8e, 0x06, 0x27, 0x00, 0x88, 0x27,
+  0x14, 0x34, 0xc9, 0x48, 0x31, 0xdf, 0xbd, 0x95, 0xb3, 0x66, 0xda, 0xb5,
+  0x22, 0x2f, 0x29, 0x3b, 0xb7, 0xb3, 0xf3, 0x25, 0x4a, 0xca, 0xd5, 0x0a,
+  0x67, 0xfe, 0x9e, 0x35, 0xde, 0x85, 0xd6, 0x56, 0x56, 0x03, 0x59, 0x0c,
+  0xb3, 0xb5, 0x95, 0xb5, 0xd5, 0x6c, 0x75, 0xed, 0xf9, 0xea, 0xd3, 0xe7,
+  0x2b, 0x2b, 0x1f, 0x2f, 0xa3, 0x1e, 0x5e, 0x6e, 0xfd, 0x99, 0xb7, 0x3f,
+  0x82, 0x74, 0xe5, 0x18, 0x4b, 0x20, 0xb9, 0xb3, 0x16, 0xea, 0x97, 0x59,
+  0x24, 0xa9, 0xa0, 0x5a, 0x25, 0x85, 0x1f, 0x12, 0x57, 0x80, 0xf7, 0xea,
+  0x8a, 0x96, 0x24, 0x08, 0xe4, 0x99, 0xc4, 0x60, 0x5c, 0x12, 0x6e, 0x25,
+  0xfb, 0xca, 0x70, 0x19, 0x37, 0xb9, 0x3b, 0x8b, 0x1a, 0xcd, 0x1e, 0xac,
+  0x1c, 0x1c, 0x1e, 0x3e, 0x90, 0xbb, 0x03, 0x98, 0x65, 0x5a, 0xba, 0x4c,
+  0x2f, 0x1a, 0x28, 0xa4, 0x16, 0x92, 0xca, 0x81, 0x1e, 0xb9, 0x70, 0x6d,
+  0xab, 0xbd, 0xac, 0xb7, 0x93, 0x55, 0xd7, 0x1d, 0x6b, 0xcd, 0xb1, 0x99,
+  0x76, 0x1d, 0x2f, 0x41, 0x5d, 0xf9, 0x82, 0x94, 0x66, 0x92, 0xc5, 0x1c,
+  0x7e, 0xe8, 0x4f, 0x10, 0x47, 0x72, 0x35, 0xe8, 0x9d, 0x76, 0x3a, 0x3b,
+  0xe2, 0x32, 0xfd, 0x6d, 0x52, 0x9e, 0x8c, 0x7b, 0xac, 0x43, 0x1a, 0xe0,
+  0x22, 0x6b, 0x7a, 0x3b, 0x1d, 0x25, 0x9f, 0x51, 0x50, 0xd2, 0x26, 0x63,
+  0x30, 0xa7, 0x97, 0x03, 0x62, 0x5e, 0xf4, 0x7e, 0xd0, 0xcd, 0xde, 0x75,
+  0x5a, 0x3b, 0x9b, 0x4d, 0x13, 0x48, 0x46, 0x41, 0x00, 0xea, 0x55, 0x4b,
+  0xee, 0x70, 0x98, 0x53, 0xd2, 0x4c, 0x60, 0xec, 0x73, 0xd3, 0xc5, 0x14,
+  0xcb, 0x17, 0xc7, 0x86, 0x85, 0x81, 0x5e, 0xc1, 0x1b, 0x49, 0x9a, 0x25,
+  0x79, 0x01, 0x4b, 0x2b, 0xf2, 0xdd, 0x1f, 0x4c, 0xfa, 0x27, 0xcc, 0xf1,
+  0x2c, 0xbf, 0x58, 0x43, 0x4e, 0xb3, 0x86, 0x38, 0x85, 0x1a, 0xbc, 0x54,
+  0x08, 0xe4, 0x81, 0x23, 0x39, 0x2c, 0x03, 0x81, 0x82, 0x51, 0x45, 0x4c,
+  0xa7, 0xb4, 0xc8, 0x16, 0x14, 0x86, 0xf3, 0x64, 0x8e, 0x30, 0xc0, 0x12,
+  0x3a, 0xf4, 0x5a, 0xd9, 0x87, 0xa6, 0xdf, 0x73, 0x8b, 0x78, 0xa4, 0xc5,
+  0x90, 0x55, 0x4f, 0xaa, 0x81, 0xe6, 0xc4, 0x3e, 0xd2, 0x58, 0xa9, 0x4a,
+  0x00, 0xda, 0xc7, 0x6a, 0x93, 0x09, 0x0f, 0x31, 0xd1, 0xe8, 0x3a, 0xe8,
+  0x10, 0x9a, 0xbe, 0x1a, 0x28, 0x05, 0x4e, 0xea, 0x6d, 0x12, 0x97, 0xc0,
+  0xf9, 0x6a, 0x75, 0x55, 0x9b, 0x62, 0x7d, 0x46, 0xf5, 0x11, 0x19, 0xb4,
+  0x45, 0xf4, 0x62, 0xc1, 0x7d, 0xee, 0x40, 0x25, 0x24, 0xe5, 0xd5, 0x6e,
+  0x5a, 0xc7, 0xa8, 0x74, 0x6b, 0x7a, 0x3d, 0x01, 0xf3, 0xb5, 0x75, 0x6a,
+  0xa5, 0x9c, 0x07, 0xbf, 0x18, 0xc2, 0x46, 0xe9, 0x10, 0x48, 0x5a, 0x00,
+  0xaa, 0x0e, 0xc8, 0x35, 0xa5, 0xc6, 0x4c, 0xc9, 0x87, 0x76, 0xd9, 0xec,
+  0xd5, 0x98, 0x1d, 0xf3, 0x37, 0x88, 0x6b, 0xe8, 0xa3, 0x50, 0x0a, 0x45,
+  0x5f, 0x8d, 0x04, 0x58, 0x08, 0x31, 0x0e, 0x28, 0x73, 0x98, 0x74, 0x96,
+  0x80, 0xb0, 0x09, 0x61, 0xb1, 0xd0, 0x22, 0xb0, 0x5b, 0xfa, 0x21, 0xd7,
+  0x7b, 0xe6, 0xfa, 0x1d, 0x0e, 0x87, 0x92, 0x8b, 0x96, 0x8d, 0xa2, 0x11,
+  0x4e, 0x1c, 0xb8, 0x15, 0xa7, 0xa3, 0x4f, 0x8e, 0x7b, 0x84, 0xce, 0x2b,
+  0x76, 0x05, 0x6a, 0x92, 0x2b, 0x5d, 0x73, 0xf9, 0x10, 0x48, 0x87, 0xb9,
+  0xe6, 0x1e, 0x12, 0x6f, 0x67, 0x54, 0x42, 0xa9, 0x6f, 0x10, 0xc4, 0xab,
+  0xf3, 0x9c, 0x2a, 0xe9, 0x96, 0x7d, 0x09, 0x5b, 0x94, 0x44, 0x57, 0xde,
+  0x16, 0xed, 0x71, 0x30, 0x62, 0x78, 0x69, 0x2b, 0xbc, 0x77, 0x3a, 0x2a,
+  0xcf, 0x0a, 0x2e, 0xea, 0x61, 0xf9, 0x43, 0xec, 0x2e, 0xa0, 0xa0, 0xf0,
+  0xc0, 0x85, 0xc4, 0x99, 0x9f, 0x67, 0x67, 0x03, 0xca, 0x83, 0xeb, 0x16,
+  0xb9, 0x9d, 0x68, 0x2c, 0x4e, 0x2c, 0x38, 0x89, 0x06, 0x28, 0x6a, 0xc2,
+  0xe3, 0x35, 0x86, 0x1b, 0xaf, 0x3b, 0x39, 0x29, 0xf8, 0x64, 0xf1, 0x12,
+  0xcd, 0x64, 0x3e, 0x9a, 0xde, 0x81, 0x05, 0x52, 0x06, 0x14, 0x96, 0x50,
+  0x1c, 0x35, 0xca, 0x47, 0xa5, 0xa2, 0x78, 0x59, 0xa1, 0x28, 0x09, 0x68,
+  0x53, 0x86, 0xed, 0x3d, 0xff, 0xae, 0xa6, 0x55, 0xb2, 0x83, 0x7c, 0x3e,
+  0x15, 0xb7, 0x37, 0xd0, 0xc1, 0x50, 0x0a, 0x1f, 0x1e, 0xdf, 0x64, 0x31,
+  0x50, 0xbc, 0x30, 0x60, 0x5c, 0x38, 0x64, 0xc8, 0xac, 0xdb, 0x30, 0x35,
+  0x32, 0x6b, 0x04, 0x16, 0x73, 0x14, 0x63, 0x2d, 0xee, 0x0c, 0x4f, 0x3f,
+  0x47, 0xc5, 0xce, 0x19, 0xf3, 0x15, 0xb3, 0xef, 0x71, 0x90, 0xf9, 0x59,
+  0x74, 0x21, 0x4c, 0xf3, 0x54, 0x5c, 0x49, 0x2d, 0xdc, 0xc9, 0x4d, 0x71,
+  0xab, 0x85, 0xfb, 0x93, 0x25, 0xec, 0x9a, 0x2b, 0xfa, 0x2e, 0xf9, 0x3a,
+  0x19, 0xc0, 0xfd, 0x3c, 0xdf, 0xab, 0xd3, 0x9e, 0x6f, 0xe2, 0x36, 0x4d,
+  0x69, 0xee, 0x22, 0xbf, 0x56, 0xb7, 0x8b, 0x73, 0xb1, 0x27, 0x97, 0x23,
+  0x3d, 0xf2, 0xe2, 0xed, 0xd6, 0x41, 0x67, 0x7b, 0x6f, 0x77, 0x0a, 0xd0,
+  0x1a, 0x42, 0xa5, 0x54, 0xe9, 0xd1, 0x92, 0xbb, 0x3e, 0x75, 0x80, 0x05,
+  0xe3, 0x8b, 0xc0, 0xfb, 0xe8, 0x09, 0x39, 0x8e, 0x11, 0x40, 0x59, 0x41,
+  0xe5, 0x25, 0x89, 0x94, 0x02, 0x33, 0x31, 0xbe, 0x95, 0xa6, 0xfc, 0xb2,
+  0xaa, 0xbf, 0x40, 0x9b, 0x96, 0xc1, 0xd7, 0x8a, 0x9f, 0xa4, 0x8c, 0xad,
+  0x3b, 0xd0, 0x82, 0x81, 0x24, 0x25, 0xe1, 0xb6, 0xab, 0x93, 0x43, 0xcc,
+  0x79, 0x68, 0xbb, 0x9b, 0x54, 0xd0, 0xcc, 0xab, 0xec, 0x6f, 0x6f, 0xb6,
+  0x37, 0x5b, 0x4c, 0x89, 0xd0, 0x36, 0x96, 0x83, 0x9c, 0x1b, 0x83, 0xb0,
+  0xe6, 0x93, 0x9a, 0xd4, 0x64, 0xf1, 0x00, 0x78, 0xcd, 0x50, 0x6d, 0x35,
+  0x54, 0x5f, 0xf3, 0xe2, 0x82, 0x0b, 0xc8, 0xfa, 0x85, 0x90, 0xf7, 0xc2,
+  0xdc, 0xd2, 0x77, 0x98, 0xfd, 0xaf, 0xc4, 0xef, 0x57, 0x67, 0x7d, 0xbf,
+  0x1a, 0xbf, 0x5f, 0x9b, 0xf5, 0xfd, 0x5a, 0xfc, 0x7e, 0x7d, 0xd6, 0xf7,
+  0x7e, 0xcd, 0xe2, 0xb6, 0xce, 0xd6, 0xf4, 0x3f, 0x3b, 0xe7, 0xb5, 0x9a,
+  0x41, 0xaf, 0xd4, 0x0d, 0xed, 0xde, 0x47, 0x4b, 0xa9, 0xc7, 0x87, 0xd7,
+  0xa3, 0x5b, 0xf7, 0x4e, 0x67, 0xb4, 0xbe, 0x71, 0xab, 0x3b, 0xfa, 0x16,
+  0x7f, 0x34, 0x94, 0x19, 0x5f, 0x52, 0xda, 0x68, 0xce, 0x7c, 0xcc, 0x4d,
+  0x37, 0x04, 0x3e, 0x1e, 0x91, 0xf4, 0xec, 0x9d, 0xd5, 0x75, 0x4d, 0x4d,
+  0xba, 0x05, 0xed, 0x5d, 0xdd, 0x2a, 0xfc, 0x54, 0x18, 0x84, 0xb9, 0x96,
+  0xc1, 0xba, 0x15, 0xb4, 0xb6, 0x9e, 0x61, 0xa6, 0x21, 0x71, 0x06, 0x80,
+  0x52, 0x29, 0x60, 0x3a, 0x9f, 0x26, 0x46, 0xca, 0x0e, 0x7c, 0x55, 0x7b,
+  0x97, 0x86, 0x61, 0x7b, 0x32, 0xc4, 0xae, 0xb0, 0x5d, 0x5a, 0xdb, 0x47,
+  0x13, 0xa8, 0x82, 0xc6, 0x9c, 0x77, 0x89, 0x2c, 0x06, 0x7d, 0x83, 0x60,
+  0xf7, 0x63, 0x33, 0x8b, 0xaf, 0x8a, 0x0c, 0x6f, 0x0e, 0x76, 0xd4, 0xa8,
+  0xa8, 0x1b, 0x01, 0x81, 0xaa, 0x2a, 0x96, 0x83, 0xc2, 0x54, 0x2d, 0x23,
+  0x8b, 0x50, 0x1a, 0x3f, 0x1f, 0x5f, 0xf4, 0x6e, 0x01, 0x18, 0x8b, 0x52,
+  0x69, 0x36, 0xbd, 0x35, 0x58, 0x0a, 0x95, 0x3a, 0x89, 0xd0, 0x57, 0x23,
+  0x72, 0x2f, 0x14, 0xf7, 0x28, 0xad, 0x12, 0x0b, 0xb8, 0x38, 0x2e, 0xba,
+  0x34, 0xf6, 0xf5, 0xf6, 0xe3, 0xf6, 0x0a, 0x5b, 0xd8, 0xc6, 0xb1, 0x54,
+  0xc1, 0x4b, 0x96, 0x67, 0xb4, 0xa0, 0xd7, 0x4a, 0x78, 0x04, 0x9c, 0x56,
+  0xdf, 0xa2, 0x17, 0xac, 0xb5, 0xda, 0x12, 0xc8, 0x32, 0x8a, 0xe4, 0x4e,
+  0xd7, 0x3a, 0x57, 0x77, 0xb3, 0x6b, 0x09, 0xe7, 0xc1, 0xd2, 0xd1, 0xa2,
+  0x5d, 0x9d, 0x13, 0x78, 0x53, 0x82, 0xf8, 0x6a, 0x80, 0x00, 0x69, 0x37,
+  0x61, 0x0a, 0x47, 0x1b, 0x5b, 0x9d, 0xa3, 0xd5, 0xb5, 0xa7, 0x47, 0x3f,
+  0x6c, 0xbe, 0x3e, 0x62, 0x38, 0xfb, 0xfb, 0x5c, 0x0d, 0xe6, 0xfb, 0x8c,
+  0x97, 0x43, 0x9c, 0x5b, 0xd3, 0x30, 0x1a, 0xea, 0xd3, 0x72, 0x91, 0x17,
+  0x61, 0x40, 0x97, 0x45, 0x72, 0x55, 0x50, 0x4a, 0x0f, 0x99, 0x96, 0xb3,
+  0x17, 0xf4, 0xef, 0xd4, 0x71, 0xc0, 0x06, 0xd4, 0xd2, 0x7e, 0x60, 0x89,
+  0xce, 0x36, 0x27, 0x23, 0x4a, 0x34, 0xed, 0xdd, 0x88, 0x7d, 0x91, 0x65,
+  0x2e, 0x8b, 0xea, 0x4f, 0xd0, 0x77, 0x40, 0x3d, 0x8d, 0xce, 0xc1, 0x7e,
+  0xa3, 0x29, 0x31, 0x9b, 0xa1, 0xdd, 0x56, 0xf8, 0x3b, 0x63, 0xcf, 0x55,
+  0xf6, 0x68, 0xe5, 0xd1, 0xc3, 0x25, 0xcb, 0xab, 0x0e, 0xc3, 0x42, 0xfd,
+  0xa8, 0x7a, 0xd0, 0x48, 0x04, 0x05, 0x1b, 0x25, 0xd8, 0x26, 0x40, 0x08,
+  0x4a, 0x67, 0x23, 0x62, 0x6c, 0xd3, 0x2a, 0xf9, 0xd6, 0x6a, 0x8e, 0xcb,
+  0x55, 0x00, 0x75, 0x1d, 0x03, 0x4b, 0x6b, 0xa5, 0x52, 0xe8, 0x7c, 0xc5,
+  0x53, 0xd2, 0x48, 0xfb, 0x18, 0xb4, 0x27, 0x74, 0x5e, 0x0f, 0xa1, 0x61,
+  0xaa, 0xd5, 0x89, 0x99, 0x88, 0x2f, 0x0c, 0xc5, 0x18, 0x9e, 0x95, 0x08,
+  0xd0, 0x03, 0xc3, 0xfa, 0xdd, 0xcc, 0xb7, 0xdb, 0x91, 0xf7, 0xfb, 0x99,
+  0x7d, 0x9d, 0x3c, 0x73, 0xdf, 0x09, 0x8d, 0xe1, 0x5e, 0x0a, 0xbb, 0x6c,
+  0x95, 0xa7, 0x28, 0xdb, 0xa5, 0x17, 0x6c, 0x30, 0x9b, 0x66, 0xb1, 0x11,
+  0xa2, 0x4b, 0x63, 0xb2, 0x58, 0xbb, 0x32, 0x95, 0x66, 0x2a, 0xd1, 0xec,
+  0xa2, 0x08, 0xa2, 0x41, 0xb7, 0x86, 0x17, 0xab, 0x02, 0x99, 0x1b, 0x78,
+  0x5b, 0xb3, 0x6f, 0xe4, 0x62, 0x89, 0xb4, 0xc4, 0xd2, 0xca, 0xbd, 0xb0,
+  0xfc, 0x6c, 0x2b, 0x32, 0xe6, 0xdf, 0x91, 0x2a, 0xe3, 0xc0, 0xbf, 0x22,
+  0xab, 0xb0, 0x4e, 0x86, 0x57, 0x5d, 0x37, 0x01, 0xae, 0xa8, 0xf6, 0x99,
+  0x7b, 0x82, 0x97, 0x5f, 0x4c, 0x05, 0xc1, 0x63, 0x37, 0x14, 0x39, 0x8d,
+  0x4f, 0x26, 0x58, 0x7b, 0xdc, 0x8e, 0x2f, 0xb5, 0x1b, 0x6e, 0x3b, 0xe2,
+  0x29, 0x06, 0x03, 0x73, 0x08, 0x21, 0xb3, 0x76, 0x27, 0xc6, 0xa8, 0x47,
+  0x9c, 0xc5, 0xb8, 0x35, 0x7a, 0x3a, 0x74, 0x8b, 0xbf, 0x0e, 0xe0, 0xea,
+  0x17, 0xda, 0x14, 0x6d, 0x43, 0x37, 0x26, 0x4a, 0x2c, 0xf5, 0xc4, 0x04,
+  0x12, 0x89, 0x90, 0x64, 0x8a, 0x99, 0xaa, 0xc0, 0xbd, 0xda, 0xbe, 0xe6,
+  0x1b, 0xd9, 0xb2, 0xd8, 0xc3, 0x05, 0x27, 0xc6, 0xd7, 0x8c, 0xcd, 0x64,
+  0xb1, 0x54, 0x8b, 0x3a, 0x95, 0x90, 0x9f, 0x4e, 0x71, 0x26, 0x95, 0x97,
+  0x6c, 0x91, 0x4e, 0x1c, 0x76, 0xfb, 0xbc, 0x3c, 0xa3, 0x6b, 0xb4, 0xae,
+  0x32, 0xe9, 0x88, 0x66, 0xd7, 0xed, 0x4a, 0x7c, 0xb4, 0x1f, 0x5b, 0xb8,
+  0xcb, 0xd5, 0x8f, 0xc9, 0x83, 0xe1, 0x89, 0x2f, 0x11, 0x9c, 0x38, 0x8d,
+  0xc4, 0xe4, 0x28, 0xf2, 0x6e, 0xf9, 0x70, 0x1a, 0x6e, 0xe1, 0xae, 0x68,
+  0x44, 0x91, 0x3c, 0xfd, 0x9e, 0x7d, 0x0f, 0x7c, 0xc9, 0x24, 0xca, 0xd4,
+  0x2f, 0xb6, 0xae, 0x36, 0xfb, 0x34, 0xae, 0x3c, 0xaa, 0x91, 0x5d, 0x27,
+  0x00, 0xb8, 0xe0, 0x4d, 0xf4, 0xfb, 0x37, 0x6f, 0x15, 0xc3, 0x29, 0x04,
+  0x4d, 0x73, 0xbb, 0x21, 0x48, 0xa2, 0xb7, 0x1a, 0x56, 0x81, 0x9a, 0xc4,
+  0xb5, 0x64, 0x23, 0x69, 0x77, 0xd9, 0x11, 0xdd, 0x63, 0x47, 0xbe, 0x8a,
+  0xcf, 0x0a, 0xcc, 0x9a, 0x39, 0xbc, 0x9e, 0xe7, 0xf9, 0x25, 0x95, 0xb3,
+  0xc2, 0xeb, 0x54, 0xd7, 0xa1, 0x5f, 0x05, 0x51, 0x15, 0xfa, 0x7e, 0x5a,
+  0x34, 0xb2, 0x96, 0x6f, 0x16, 0x36, 0x69, 0x94, 0x53, 0xc5, 0x70, 0x0e,
+  0xbf, 0x53, 0xb9, 0x9e, 0x64, 0x61, 0x2b, 0x30, 0xcf, 0xe9, 0x14, 0x64,
+  0x03, 0x51, 0x75, 0xd3, 0xd3, 0x73, 0x5b, 0xab, 0x69, 0x39, 0x87, 0x18,
+  0x2f, 0xed, 0x97, 0xa1, 0xbb, 0xf6, 0xca, 0xbd, 0x4f, 0x66, 0x5d, 0x4b,
+  0x20, 0x72, 0xf9, 0xb4, 0xfd, 0x5d, 0xfd, 0x97, 0xda, 0xdf, 0xd5, 0x7f,
+  0xe9, 0xfd, 0x5d, 0xfd, 0x42, 0xfb, 0xbb, 0xfa, 0x49, 0xfb, 0x1b, 0xcf,
+  0x3c, 0x4d, 0xa4, 0xb6, 0xdb, 0x6b, 0x9f, 0xb6, 0xdb, 0x6b, 0xff, 0x52,
+  0xbb, 0xbd, 0xf6, 0x2f, 0xbd, 0xdb, 0x6b, 0x5f, 0x68, 0xb7, 0xd7, 0xbe,
+  0xdc, 0x6e, 0xaf, 0x7f, 0xda, 0x6e, 0xaf, 0xff, 0xc9, 0xdd, 0xfe, 0x6f,
+  0xb4, 0x78, 0xc5, 0x3c, 0x33, 0x55, 0x9c, 0xad, 0xda, 0xb0, 0x4f, 0xbf,
+  0x26, 0x67, 0x37, 0x3d, 0x20, 0xa9, 0xd4, 0xd5, 0x2c, 0x08, 0x1a, 0x5d,
+  0xd8, 0x2f, 0xb3, 0x9b, 0xeb, 0x9f, 0xb2, 0x9b, 0x6b, 0xb7, 0xed, 0xe6,
+  0xa8, 0x85, 0xfc, 0x33, 0x1b, 0x25, 0x16, 0x22, 0x06, 0x19, 0xe4, 0xec,
+  0x0e, 0x21, 0x3f, 0x35, 0x19, 0xf6, 0x64, 0x71, 0x5a, 0x5b, 0xf2, 0x8e,
+  0xab, 0xd7, 0x29, 0x36, 0xec, 0xb0, 0x29, 0x9a, 0x96, 0x2f, 0xe5, 0x96,
+  0x5d, 0xd5, 0x3a, 0xe4, 0x43, 0xaa, 0x3f, 0x4c, 0x50, 0x11, 0x26, 0x7d,
+  0xed, 0x80, 0x9f, 0x67, 0x2b, 0x33, 0x0a, 0xae, 0xab, 0xa3, 0xe0, 0xa4,
+  0x28, 0x2f, 0x51, 0xb4, 0xbc, 0x86, 0x88, 0xe0, 0x06, 0xff, 0x85, 0x0a,
+  0xa4, 0xba, 0x16, 0x3f, 0xb2, 0x05, 0xae, 0xeb, 0xfb, 0x81, 0x21, 0xd8,
+  0x2a, 0xba, 0xb5, 0xcf, 0x09, 0xd5, 0xd5, 0xa5, 0x64, 0x74, 0x28, 0x87,
+  0x14, 0x81, 0x0d, 0x13, 0x2a, 0xf1, 0xc5, 0x0f, 0x64, 0x14, 0xff, 0xca,
+  0x0e, 0x05, 0x22, 0x32, 0xae, 0x1c, 0x25, 0x69, 0xb2, 0x5d, 0xc4, 0x4d,
+  0x9f, 0x0d, 0x2c, 0x48, 0xaa, 0xa9, 0x11, 0x0c, 0x44, 0xe2, 0xf4, 0x69,
+  0xa0, 0xf3, 0x93, 0x51, 0x19, 0x8e, 0xc4, 0x25, 0x79, 0x1d, 0x28, 0x61,
+  0xdd, 0xd5, 0xe8, 0x76, 0x81, 0x02, 0x12, 0x7e, 0x0d, 0xc0, 0x06, 0xa0,
+  0x9f, 0xaa, 0x27, 0xa2, 0x01, 0xf7, 0xae, 0xe5, 0x77, 0xd0, 0x01, 0xe7,
+  0x54, 0x57, 0xd4, 0xdf, 0xe6, 0xb7, 0xd8, 0xb9, 0x11, 0x93, 0x3a, 0x18,
+  0x3e, 0xb5, 0xb1, 0xd0, 0x88, 0x39, 0x92, 0xbe, 0x01, 0x7b, 0xdf, 0xbf,
+  0x6e, 0x99, 0x27, 0xd3, 0x07, 0x2f, 0xc6, 0x4c, 0xf3, 0xf3, 0xb4, 0x14,
+  0xd8, 0x87, 0x3c, 0x30, 0x83, 0x4b, 0x94, 0x14, 0xe4, 0xc5, 0xe8, 0x17,
+  0x63, 0x56, 0x3f, 0xc3, 0xca, 0x9d, 0x9e, 0x2a, 0xca, 0x3a, 0x43, 0x46,
+  0xc1, 0xe1, 0x45, 0x90, 0xa8, 0x14, 0xba, 0x8b, 0xe5, 0x60, 0x3f, 0xb6,
+  0x5b, 0x2b, 0x55, 0xe3, 0xa8, 0x8a, 0xe9, 0xa8, 0xe8, 0x72, 0xf9, 0xb7,
+  0x2a, 0x9a, 0x19, 0x90, 0x05, 0x3a, 0x66, 0x0a, 0xd5, 0x84, 0x60, 0x32,
+  0xbe, 0x65, 0xf9, 0x15, 0xcc, 0x29, 0x80, 0xfd, 0xa1, 0xec, 0xe3, 0x51,
+  0x11, 0x36, 0x50, 0x72, 0xda, 0xa9, 0x3e, 0x37, 0x7b, 0x77, 0x46, 0x96,
+  0x63, 0xdb, 0x1b, 0x9c, 0x55, 0x4c, 0x75, 0xa8, 0x0b, 0x5b, 0xfd, 0x53,
+  0xb2, 0x60, 0x84, 0x9a, 0xbe, 0x5a, 0xb2, 0x22, 0xb7, 0x1f, 0xa6, 0xf6,
+  0x91, 0x0c, 0x18, 0x56, 0x3d, 0xcc, 0x74, 0xc0, 0xc0, 0x95, 0x31, 0x2d,
+  0xca, 0xe7, 0x45, 0xc5, 0xc4, 0x28, 0x23, 0x81, 0xd4, 0xa0, 0x45, 0x5d,
+  0xb6, 0xf2, 0xea, 0xa4, 0x2c, 0x53, 0x6f, 0x4f, 0xfc, 0xbc, 0x69, 0x7f,
+  0x72, 0xc4, 0x63, 0x33, 0xbe, 0x57, 0x76, 0xab, 0xe8, 0x73, 0xd6, 0x0f,
+  0xd3, 0x20, 0x89, 0xd8, 0xce, 0xff, 0xc4, 0x73, 0x6a, 0x79, 0xdc, 0x2e,
+  0x1f, 0x28, 0x39, 0xa2, 0x87, 0x02, 0x60, 0x58, 0x95, 0x17, 0x65, 0x2f,
+  0x47, 0x41, 0xdf, 0x98, 0xd3, 0x40, 0x26, 0xc5, 0xa0, 0x82, 0x93, 0xf3,
+  0x78, 0xa0, 0xf8, 0xe3, 0xe7, 0xc5, 0x35, 0x47, 0x31, 0xf0, 0x92, 0xf4,
+  0x0d, 0xc9, 0xe4, 0xdc, 0x60, 0xc4, 0x37, 0x3a, 0x9b, 0xdb, 0xdb, 0xfc,
+  0x90, 0xe2, 0xb4, 0xd0, 0xc2, 0x72, 0xba, 0x85, 0xd4, 0x45, 0xae, 0x2e,
+  0xa8, 0x16, 0xaf, 0x66, 0x5c, 0xf9, 0x60, 0x22, 0x3e, 0xeb, 0xe1, 0x68,
+  0x50, 0x0e, 0x73, 0x81, 0x11, 0x8d, 0xc8, 0xfa, 0x0f, 0xbb, 0x0c, 0x95,
+  0xf4, 0x2c, 0xfb, 0x81, 0xee, 0xcf, 0x27, 0x17, 0x79, 0xbf, 0xfa, 0xff,
+  0x8c, 0xe6, 0xcb, 0xe7, 0x46, 0x89, 0x9d, 0xcf, 0x9d, 0x9b, 0x3b, 0xf1,
+  0x65, 0xa3, 0xcb, 0xfb, 0xb3, 0x8c, 0x4a, 0xae, 0x9b, 0x7b, 0xf2, 0x1d,
+  0x97, 0x38, 0x34, 0x6d, 0xec, 0x30, 0x6b, 0x07, 0xce, 0x73, 0x9a, 0x0d,
+  0x35, 0x6d, 0xe0, 0x48, 0xd3, 0xf7, 0xf0, 0x4e, 0x8d, 0x71, 0x30, 0xc7,
+  0xa9, 0x19, 0x71, 0xc9, 0x60, 0xc8, 0x5f, 0x4c, 0xa4, 0xf2, 0xa4, 0xa0,
+  0x1b, 0x31, 0x13, 0xd1, 0xe4, 0xa2, 0x0d, 0xc1, 0x23, 0x6a, 0xb9, 0x72,
+  0xc3, 0xea, 0x01, 0x33, 0xb8, 0xa2, 0x20, 0x79, 0x21, 0x7d, 0x9f, 0x03,
+  0xae, 0xd8, 0x8d, 0x15, 0xd3, 0xf2, 0x24, 0x38, 0x8a, 0x72, 0xad, 0x62,
+  0x05, 0x5f, 0x44, 0x3c, 0x86, 0xd9, 0xec, 0xe6, 0x96, 0xf3, 0x01, 0x92,
+  0x22, 0x90, 0x69, 0xa0, 0x80, 0x08, 0xd1, 0xa2, 0x50, 0xa2, 0x3a, 0xd5,
+  0xb2, 0x07, 0x61, 0xa5, 0x1e, 0x08, 0x0e, 0x4b, 0x21, 0x78, 0x15, 0xcc,
+  0xe5, 0x3c, 0xb5, 0xc5, 0x11, 0x39, 0x35, 0xcd, 0x17, 0x3b, 0xe5, 0x39,
+  0xda, 0x63, 0x8c, 0x58, 0x1f, 0xc8, 0x40, 0xbd, 0x77, 0x8d, 0xc0, 0x92,
+  0xa5, 0x6c, 0x30, 0x11, 0x48, 0x23, 0x16, 0x26, 0x43, 0x61, 0x5e, 0x11,
+  0x91, 0x1d, 0xff, 0xe6, 0x9c, 0xae, 0xc8, 0xb9, 0x63, 0xdd, 0xe2, 0x18,
+  0x74, 0x59, 0x14, 0x2e, 0x84, 0x13, 0x84, 0x7e, 0x84, 0x17, 0x28, 0x8e,
+  0x93, 0xc2, 0x38, 0x2d, 0xf1, 0x83, 0x02, 0x21, 0xea, 0x21, 0x9b, 0x5f,
+  0xed, 0xa0, 0xd4, 0x89, 0x44, 0x23, 0x43, 0xd2, 0x6c, 0x00, 0x0d, 0xb2,
+  0x40, 0x78, 0x56, 0x82, 0x52, 0xf5, 0xd1, 0xac, 0x80, 0xb4, 0xf9, 0xb0,
+  0x56, 0x4d, 0x3a, 0x1a, 0xcb, 0x6b, 0xf7, 0x0b, 0xa0, 0x58, 0xaf, 0xc5,
+  0x4f, 0x7c, 0x9c, 0xd8, 0xed, 0x36, 0xdd, 0x1f, 0x41, 0x4d, 0x4e, 0xc3,
+  0x37, 0x39, 0x38, 0xd7, 0xe9, 0x6f, 0x60, 0x7a, 0x61, 0xa1, 0x46, 0xec,
+  0x19, 0xa6, 0x85, 0xb2, 0x23, 0x30, 0xb2, 0x28, 0x09, 0xf4, 0x09, 0xb4,
+  0x9f, 0x98, 0x2b, 0x20, 0x69, 0x19, 0x5f, 0x5d, 0x68, 0xaa, 0xa9, 0x1a,
+  0x4a, 0x71, 0xb3, 0xb2, 0xce, 0x3f, 0x47, 0xd1, 0x90, 0xf6, 0xee, 0xc3,
+  0xe1, 0xa8, 0xdb, 0x94, 0xdb, 0xc9, 0x09, 0xbf, 0xd7, 0x56, 0x4e, 0x81,
+  0x40, 0xcc, 0xe0, 0x6e, 0xe9, 0x56, 0x46, 0xc8, 0x7a, 0xdd, 0xcb, 0x3c,
+  0x93, 0x90, 0xf1, 0x6a, 0x1c, 0x7a, 0xe2, 0x9c, 0xa6, 0x64, 0xc7, 0x6a,
+  0xbb, 0x25, 0x81, 0xc9, 0x11, 0xb2, 0xfe, 0x9f, 0xb5, 0x69, 0xd3, 0x7b,
+  0xc6, 0xe3, 0xfe, 0x42, 0xda, 0xa1, 0x93, 0x10, 0x3f, 0xba, 0x6b, 0xe8,
+  0xf8, 0x13, 0xb7, 0xed, 0x9e, 0xdb, 0x34, 0xe9, 0x97, 0xd7, 0x2d, 0xa9,
+  0xf2, 0xfa, 0x82, 0x6a, 0x34, 0x7c, 0x9b, 0x28, 0xef, 0x9b, 0x7c, 0xce,
+  0x32, 0xad, 0xbe, 0x29, 0x51, 0x0d, 0xae, 0x2e, 0x84, 0x15, 0x86, 0xd0,
+  0xc4, 0x7c, 0x62, 0x4d, 0xd0, 0xe0, 0x63, 0x4a, 0xbf, 0xc8, 0x38, 0xa2,
+  0x3d, 0xf8, 0x2e, 0x67, 0x5e, 0xe9, 0xf5, 0xe8, 0x99, 0x08, 0x5a, 0xff,
+  0x09, 0x37, 0xba, 0xef, 0x85, 0x7f, 0xb4, 0x68, 0x7a, 0xf7, 0x5b, 0xb1,
+  0xfc, 0xb8, 0xa2, 0x45, 0x1b, 0xfb, 0x56, 0x74, 0xc9, 0x0e, 0x49, 0x0f,
+  0x98, 0x0c, 0x09, 0x4c, 0xa9, 0x85, 0x58, 0x6a, 0x2f, 0xce, 0xbf, 0xc1,
+  0xe7, 0xb5, 0x80, 0x77, 0x57, 0x54, 0xda, 0x42, 0x9c, 0x60, 0x9e, 0x7a,
+  0x73, 0xb0, 0x93, 0xda, 0xa5, 0x46, 0xea, 0x2b, 0x97, 0x12, 0xd4, 0x88,
+  0xd2, 0x2d, 0xeb, 0x01, 0xf4, 0xf4, 0x9e, 0x04, 0xc5, 0xe7, 0x43, 0x3a,
+  0x54, 0x95, 0x97, 0x7e, 0x62, 0x67, 0x2a, 0x7c, 0x2b, 0xe0, 0x95, 0xd8,
+  0x51, 0x08, 0x4e, 0xcf, 0x87, 0xad, 0xc6, 0xc2, 0xd5, 0x48, 0x90, 0xac,
+  0xc4, 0xc0, 0xf5, 0xf3, 0x60, 0xc2, 0x01, 0x31, 0x0c, 0xc2, 0x47, 0x07,
+  0xb4, 0xec, 0xd1, 0x71, 0xa8, 0x7a, 0xc8, 0x2d, 0x58, 0x5e, 0x32, 0xd3,
+  0x25, 0x24, 0x2e, 0x86, 0x80, 0x18, 0x08, 0xf8, 0x37, 0x32, 0x81, 0xcc,
+  0x20, 0x27, 0x06, 0xd5, 0x7c, 0xec, 0xaa, 0x50, 0xd3, 0xa1, 0x31, 0x15,
+  0x21, 0x9c, 0x44, 0x36, 0xe9, 0x04, 0xfa, 0xea, 0xbf, 0x17, 0xd7, 0x13,
+  0x87, 0x99, 0x46, 0x0a, 0x88, 0x3d, 0x28, 0x3e, 0x84, 0x5b, 0x4b, 0xaf,
+  0x6d, 0x4c, 0xaa, 0x22, 0x89, 0x26, 0x0e, 0x27, 0x65, 0xac, 0x61, 0x91,
+  0xba, 0x42, 0xf1, 0x85, 0x5c, 0xeb, 0xdf, 0xc8, 0x1a, 0xf1, 0x1f, 0x58,
+  0x63, 0xc7, 0x76, 0x38, 0x67, 0xa8, 0xe2, 0x10, 0xd0, 0x52, 0xea, 0x19,
+  0xa3, 0xb9, 0xe2, 0x34, 0x50, 0x18, 0x61, 0x3c, 0x01, 0x50, 0xac, 0x7f,
+  0x23, 0x0b, 0xc4, 0x2b, 0x34, 0xe2, 0x48, 0x6a, 0x7c, 0x24, 0x27, 0xeb,
+  0xef, 0x7f, 0x5f, 0xe2, 0xab, 0xd9, 0xd7, 0xdc, 0xb6, 0x62, 0x6f, 0x1c,
+  0xe7, 0xa0, 0xfb, 0x7a, 0x65, 0x59, 0x19, 0xd2, 0xdb, 0x88, 0x14, 0x03,
+  0x39, 0x10, 0xd4, 0xa7, 0xec, 0x29, 0x3e, 0xbe, 0xa0, 0x8a, 0x2c, 0x08,
+  0xc7, 0x3e, 0x09, 0x02, 0x3c, 0x61, 0x2a, 0x8d, 0x7c, 0xf1, 0xf8, 0xa4,
+  0x2b, 0xa8, 0x79, 0x8b, 0x39, 0xca, 0x91, 0x9e, 0x11, 0xfa, 0x58, 0x18,
+  0xdf, 0x92, 0x45, 0x56, 0x05, 0xdd, 0xac, 0xec, 0x67, 0xc9, 0x91, 0xce,
+  0x7d, 0xd2, 0x0f, 0xeb, 0x8c, 0x1b, 0x3d, 0xe4, 0xd5, 0x8c, 0x0b, 0x0a,
+  0x3b, 0x49, 0x5a, 0x6f, 0xb4, 0xd1, 0xb8, 0xb4, 0xcd, 0x05, 0x0d, 0x96,
+  0x18, 0x53, 0x4b, 0x73, 0xeb, 0x23, 0x39, 0x6b, 0x2f, 0xd4, 0x0d, 0x8d,
+  0xca, 0x2c, 0xbf, 0x36, 0x0a, 0xe4, 0x84, 0x20, 0xdb, 0x8f, 0xed, 0x73,
+  0xa8, 0xf7, 0x64, 0xf2, 0x1c, 0x0c, 0xf1, 0xa4, 0x9a, 0x81, 0x38, 0x39,
+  0xf0, 0x58, 0xd8, 0x23, 0x6c, 0x7f, 0xd2, 0x0e, 0x39, 0x30, 0x01, 0x42,
+  0xc5, 0x67, 0x37, 0xf2, 0x0f, 0x2b, 0x44, 0x30, 0x15, 0x70, 0xc5, 0x51,
+  0xe6, 0x5c, 0xdf, 0x78, 0x91, 0xaa, 0x9b, 0x80, 0x28, 0xb0, 0x0f, 0xfb,
+  0x6f, 0x0e, 0xc5, 0xf3, 0x3e, 0x3b, 0xa0, 0xef, 0xe7, 0x7a, 0x7d, 0x57,
+  0x98, 0x98, 0x53, 0xc6, 0xc1, 0x28, 0xad, 0x74, 0xf9, 0xe1, 0x4c, 0x9a,
+  0x23, 0x40, 0xe4, 0x32, 0x75, 0x06, 0x10, 0x50, 0xd7, 0x16, 0x3d, 0x95,
+  0xbe, 0xfd, 0x17, 0x7e, 0x6b, 0x98, 0x97, 0x23, 0x5b, 0x4c, 0xa0, 0x1f,
+  0xe6, 0x1c, 0x15, 0xc6, 0x9c, 0x28, 0xda, 0x38, 0x68, 0x55, 0x21, 0xdd,
+  0xb7, 0x85, 0x47, 0x8a, 0xcb, 0xdf, 0x92, 0x0a, 0x70, 0x75, 0x1e, 0xb3,
+  0xe9, 0x55, 0x4f, 0x41, 0xda, 0xa7, 0x0a, 0xf9, 0x67, 0x70, 0x84, 0x34,
+  0xe1, 0xc9, 0xe6, 0xb8, 0x2e, 0x3e, 0xad, 0x1c, 0x95, 0x2c, 0x3d, 0x47,
+  0xe9, 0x86, 0x5e, 0xad, 0xa4, 0xd4, 0x20, 0x93, 0x84, 0x10, 0x25, 0x31,
+  0xa2, 0x1b, 0x17, 0x1b, 0x86, 0x32, 0x37, 0xf4, 0xa9, 0x8d, 0x04, 0x98,
+  0x14, 0xce, 0x3c, 0x2e, 0xbc, 0xd0, 0x31, 0x4e, 0x1c, 0x70, 0xee, 0x12,
+  0xcd, 0x0c, 0x00, 0xff, 0xf6, 0x3a, 0xa6, 0x72, 0x3e, 0xe7, 0x04, 0x14,
+  0xd9, 0x74, 0xd6, 0x84, 0x7d, 0x51, 0x24, 0xa5, 0xa3, 0x63, 0x81, 0x09,
+  0x7a, 0xb4, 0xbe, 0xb6, 0x96, 0xb1, 0xd5, 0x84, 0x2b, 0xa7, 0x09, 0x36,
+  0x03, 0x35, 0x6d, 0xa8, 0x5e, 0x58, 0x9c, 0x88, 0x57, 0x8a, 0x38, 0x37,
+  0xd5, 0xa6, 0x3c, 0xa0, 0x40, 0xb8, 0x22, 0x7b, 0xd9, 0xf1, 0xa0, 0x7b,
+  0x13, 0x5b, 0x0c, 0xdb, 0x3b, 0x22, 0x3e, 0x16, 0x4e, 0xb9, 0xc0, 0xa8,
+  0x22, 0x6e, 0x81, 0x7a, 0x30, 0x94, 0x71, 0xc5, 0xdf, 0x1d, 0xb3, 0xd8,
+  0x4b, 0xa8, 0x6e, 0xe1, 0xaf, 0x91, 0x00, 0xbc, 0x21, 0x37, 0xe0, 0x74,
+  0x32, 0x22, 0x56, 0xca, 0xf2, 0x7c, 0x60, 0x3a, 0x94, 0xd6, 0x52, 0xa7,
+  0x2f, 0x4b, 0xfd, 0xa8, 0xc2, 0x15, 0xe6, 0x32, 0x27, 0xe2, 0xb1, 0xa7,
+  0x85, 0x64, 0xee, 0x40, 0xe9, 0x06, 0x54, 0x83, 0x03, 0x45, 0x4a, 0x68,
+  0x0f, 0xd8, 0x14, 0xa0, 0x30, 0xac, 0x69, 0x08, 0x47, 0xf8, 0x7e, 0x46,
+  0x66, 0xf1, 0xdd, 0xc1, 0xac, 0x87, 0xb7, 0x67, 0x1e, 0xa5, 0x8f, 0x35,
+  0xca, 0x8b, 0xb3, 0x5f, 0x56, 0x5b, 0xab, 0x2b, 0x2b, 0x2b, 0xbf, 0xb6,
+  0x87, 0xfd, 0xb3, 0x86, 0x80, 0x8c, 0x86, 0x7f, 0xdb, 0x49, 0x26, 0x72,
+  0x7a, 0xdf, 0xbb, 0x89, 0x37, 0x3e, 0xd0, 0x8f, 0xd5, 0x26, 0xfd, 0xbb,
+  0xf6, 0x47, 0xe3, 0x1e, 0x7d, 0xe2, 0x35, 0xf9, 0x39, 0x53, 0xaf, 0xb9,
+  0x9f, 0xdc, 0x70, 0x56, 0x20, 0x3d, 0x9d, 0x28, 0xa0, 0x89, 0x6c, 0x29,
+  0x85, 0xf3, 0x26, 0xd1, 0xcb, 0x23, 0xa5, 0xd9, 0x70, 0x7b, 0xf9, 0x19,
+  0x81, 0x62, 0xd2, 0x0f, 0xd5, 0xea, 0xb5, 0x12, 0x94, 0x68, 0xbb, 0x79,
+  0x2f, 0x7a, 0x12, 0x89, 0xba, 0x87, 0x43, 0x00, 0xbc, 0x0f, 0x22, 0x49,
+  0xe3, 0x7c, 0xb5, 0xb3, 0xef, 0xd1, 0x56, 0xac, 0x86, 0x15, 0x39, 0x6c,
+  0xa0, 0xad, 0xa2, 0x04, 0xb5, 0x18, 0x4f, 0x66, 0xd0, 0x68, 0x96, 0xa7,
+  0x50, 0x56, 0x68, 0xa6, 0x89, 0xc0, 0xfc, 0x2f, 0xf1, 0xe9, 0x0a, 0x21,
+  0xb4, 0x95, 0xa2, 0xec, 0x31, 0x68, 0x20, 0x69, 0xfc, 0xd1, 0x48, 0xc5,
+  0x84, 0x8f, 0x84, 0x0e, 0x8a, 0x8e, 0xc9, 0x2d, 0x00, 0xf1, 0x18, 0x30,
+  0x98, 0xea, 0xf9, 0x04, 0x12, 0x90, 0x12, 0xe4, 0x83, 0xd6, 0x83, 0xcc,
+  0x5d, 0x5b, 0x31, 0xa0, 0x51, 0x10, 0x2d, 0x06, 0xc4, 0xe5, 0x4d, 0xa8,
+  0x74, 0xc3, 0x61, 0x9b, 0x03, 0x87, 0xc5, 0x17, 0xdd, 0xe7, 0xa1, 0xf3,
+  0x8a, 0x42, 0x4f, 0xbb, 0x94, 0xa5, 0x48, 0xa9, 0x37, 0x94, 0x4a, 0xd3,
+  0x1d, 0xe5, 0xa7, 0x61, 0x63, 0xe8, 0xad, 0x33, 0x7c, 0x60, 0x4c, 0x91,
+  0x32, 0x98, 0x38, 0x26, 0xf8, 0x44, 0x3b, 0x6c, 0x69, 0x5b, 0x49, 0x2f,
+  0x09, 0xb2, 0x0b, 0x1d, 0x77, 0xde, 0xb9, 0x4c, 0x63, 0x5e, 0x00, 0x3f,
+  0xcd, 0x3b, 0x52, 0x69, 0xa0, 0x60, 0xb2, 0xc7, 0x5f, 0xd3, 0x7a, 0x95,
+  0x74, 0xf4, 0xbd, 0xcc, 0xf2, 0xdf, 0x3a, 0x05, 0xf0, 0x74, 0xfc, 0xc1,
+  0x80, 0xe8, 0xb3, 0x1c, 0xe4, 0x28, 0x24, 0x88, 0x7f, 0x14, 0x39, 0xc5,
+  0xa7, 0x41, 0xd4, 0xd5, 0x78, 0xd7, 0x6c, 0x24, 0xea, 0x30, 0x9a, 0x17,
+  0xe1, 0x9f, 0x65, 0x6f, 0xe0, 0xb6, 0xc2, 0x66, 0xc4, 0x54, 0xc0, 0x43,
+  0x29, 0x31, 0x77, 0x30, 0x62, 0x9b, 0xb0, 0xa4, 0xe3, 0xd7, 0xdc, 0xb3,
+  0x6a, 0xa2, 0x06, 0x1f, 0x02, 0xd6, 0x19, 0x23, 0xf6, 0x02, 0xa0, 0x93,
+  0x91, 0xa0, 0xb3, 0xc5, 0x88, 0x85, 0xd3, 0xa0, 0x29, 0x84, 0x19, 0x34,
+  0xa2, 0xc6, 0xdf, 0x38, 0x95, 0x4f, 0x42, 0x6f, 0x4b, 0x7a, 0xe1, 0x9d,
+  0x4d, 0xc8, 0x6d, 0x56, 0x59, 0x58, 0xb9, 0x82, 0x4a, 0x6b, 0xb1, 0x1a,
+  0xc2, 0xd1, 0xec, 0x9a, 0x47, 0x3e, 0x2d, 0xba, 0x67, 0xa9, 0x48, 0x41,
+  0xb4, 0x28, 0x46, 0x22, 0x6a, 0x1d, 0x8b, 0x12, 0x04, 0xa1, 0x47, 0x91,
+  0x28, 0x5f, 0x6d, 0x6f, 0x06, 0x1d, 0xe1, 0xfb, 0xc3, 0x7d, 0x41, 0x97,
+  0x16, 0x03, 0x3d, 0x41, 0x49, 0x37, 0x19, 0xa0, 0x9c, 0x60, 0xc4, 0xe9,
+  0x86, 0xa2, 0x73, 0x93, 0x39, 0x4b, 0x99, 0xc8, 0x51, 0x02, 0x06, 0x63,
+  0xa0, 0x41, 0x2a, 0x90, 0x68, 0x8e, 0x20, 0x9d, 0xe4, 0xab, 0x52, 0x78,
+  0x36, 0xdf, 0x63, 0x15, 0x97, 0x59, 0x23, 0xdb, 0x22, 0xcf, 0x09, 0x53,
+  0xc5, 0x8a, 0x99, 0x39, 0x08, 0x86, 0x2f, 0xce, 0x13, 0xf2, 0xe1, 0x92,
+  0x0c, 0xca, 0x0a, 0xf7, 0x03, 0x2d, 0x77, 0x34, 0x2d, 0xf3, 0x95, 0x8c,
+  0xe6, 0x10, 0x38, 0xde, 0x65, 0x75, 0x96, 0xab, 0xc9, 0x06, 0x0a, 0x1d,
+  0xbb, 0xfa, 0x55, 0x9a, 0x11, 0xac, 0x63, 0x6e, 0xd2, 0xc9, 0xe2, 0x10,
+  0xe8, 0xf1, 0xa0, 0xa5, 0xdf, 0x3a, 0x4c, 0x14, 0x57, 0x79, 0xd0, 0xaa,
+  0xe8, 0xb0, 0xed, 0xd1, 0xf0, 0x6d, 0xc6, 0x30, 0x48, 0x0a, 0x4a, 0xaf,
+  0xa6, 0x8f, 0x75, 0x1d, 0x51, 0x08, 0x04, 0x5c, 0x92, 0x69, 0xed, 0x65,
+  0x17, 0x4b, 0x53, 0x66, 0x1f, 0x45, 0x53, 0x74, 0x7c, 0x93, 0x6c, 0xd4,
+  0xe6, 0x9f, 0xa2, 0x3c, 0x5b, 0x92, 0x2b, 0x2b, 0x26, 0x09, 0xc8, 0x80,
+  0x0e, 0x83, 0x96, 0xc7, 0xe4, 0x1b, 0x5c, 0x86, 0x7c, 0x1b, 0x26, 0xe2,
+  0x0d, 0x41, 0xc2, 0xbf, 0x2f, 0x9a, 0x22, 0xe1, 0xc5, 0x30, 0x61, 0x8c,
+  0xbf, 0x8f, 0xf4, 0xe4, 0x12, 0x13, 0x24, 0xb8, 0xef, 0xf0, 0x0d, 0x10,
+  0xad, 0x09, 0xa7, 0xba, 0xa0, 0xdc, 0xe7, 0x3c, 0xc6, 0xd3, 0x89, 0x5c,
+  0x2a, 0xb8, 0xbc, 0xc9, 0xf8, 0xa8, 0x08, 0x46, 0x9d, 0x47, 0xec, 0xf5,
+  0x0d, 0xe6, 0xac, 0x49, 0x07, 0x21, 0x9c, 0x45, 0x3e, 0x1b, 0x39, 0x80,
+  0x8e, 0x89, 0x56, 0x8c, 0x26, 0xc2, 0x32, 0x53, 0xb5, 0x24, 0xad, 0xbc,
+  0xa4, 0x9a, 0xba, 0x6c, 0xab, 0x3e, 0x2f, 0x72, 0x8a, 0x28, 0x8a, 0x24,
+  0x96, 0xdd, 0x84, 0xc5, 0xbe, 0x48, 0x92, 0xd1, 0x41, 0x31, 0xa5, 0xa4,
+  0xcd, 0x0a, 0xc3, 0x68, 0xea, 0xc1, 0xb3, 0xfe, 0xc6, 0x14, 0x6a, 0x83,
+  0xae, 0xc2, 0xf0, 0xfa, 0x2c, 0xa1, 0xd2, 0xfa, 0xd5, 0xe2, 0x77, 0xb1,
+  0x98, 0x84, 0x62, 0x2b, 0x49, 0x82, 0x10, 0x9e, 0x21, 0xed, 0x86, 0x3b,
+  0x8c, 0x25, 0x62, 0xc6, 0xb0, 0x47, 0xe4, 0x06, 0xcb, 0xe9, 0x0d, 0xf0,
+  0x1f, 0x6e, 0xe8, 0x3b, 0xd5, 0x44, 0x1a, 0xcf, 0x83, 0xf2, 0x9f, 0xea,
+  0x31, 0x2c, 0xc4, 0x43, 0xae, 0x89, 0x45, 0x17, 0xa3, 0x5e, 0xc4, 0x15,
+  0x1b, 0x93, 0x8a, 0xc8, 0x34, 0xf7, 0xc6, 0x77, 0x8d, 0x30, 0xeb, 0x8b,
+  0x63, 0xc2, 0x8e, 0xd9, 0x36, 0x83, 0x38, 0xcf, 0x47, 0x91, 0xaa, 0xc7,
+  0x9a, 0x5a, 0x12, 0xfa, 0x61, 0xa2, 0x20, 0x0b, 0xb9, 0x96, 0x1f, 0xea,
+  0xa2, 0xb2, 0x9f, 0x3f, 0x74, 0x7d, 0x13, 0xa5, 0x19, 0x95, 0xbe, 0xf1,
+  0x5d, 0xab, 0x91, 0x88, 0xb5, 0xb6, 0x48, 0x58, 0x5c, 0x6e, 0x52, 0x59,
+  0x23, 0xa7, 0xd9, 0x6a, 0x16, 0x25, 0x67, 0x8b, 0x0a, 0x0e, 0x7e, 0x62,
+  0x7f, 0x49, 0xc9, 0xd9, 0x34, 0x8e, 0x84, 0x1c, 0xf9, 0x06, 0xe4, 0xf6,
+  0xe9, 0x9e, 0x23, 0x66, 0xa0, 0x99, 0x99, 0xb1, 0x9a, 0xf0, 0xc0, 0x6b,
+  0x08, 0x24, 0x86, 0xc0, 0x16, 0x81, 0xd3, 0xc3, 0x01, 0x34, 0xca, 0x38,
+  0xe1, 0xe3, 0xc8, 0xbe, 0x67, 0x59, 0xb9, 0x52, 0xd0, 0x32, 0xf3, 0x0b,
+  0xb6, 0x5a, 0xd5, 0xfb, 0x72, 0x18, 0x73, 0xfc, 0xe1, 0xfe, 0x3a, 0x25,
+  0x5b, 0x1f, 0x91, 0xcf, 0xe0, 0xe2, 0x58, 0x88, 0x5f, 0x17, 0xbf, 0x34,
+  0x66, 0xb1, 0x13, 0x1e, 0xaa, 0x9c, 0x0e, 0xe0, 0x51, 0x2b, 0x60, 0xbb,
+  0xe0, 0x57, 0x1a, 0xff, 0xab, 0x81, 0x69, 0x38, 0x84, 0x87, 0x8c, 0x53,
+  0xca, 0xc6, 0xce, 0x4d, 0x0b, 0xf4, 0xeb, 0x30, 0x90, 0x21, 0x09, 0xf9,
+  0x7c, 0x77, 0x7d, 0x36, 0x8a, 0x4e, 0x3d, 0x6f, 0x0b, 0x19, 0xd2, 0x1f,
+  0xcb, 0xd7, 0xa2, 0x7f, 0xbf, 0xab, 0x01, 0xb5, 0x98, 0x53, 0x28, 0x13,
+  0x78, 0x77, 0x46, 0x72, 0xb6, 0x0a, 0x78, 0xec, 0x76, 0x96, 0x12, 0xa0,
+  0xf9, 0xf8, 0xbc, 0x95, 0x57, 0x2d, 0x78, 0xbd, 0x53, 0x6f, 0x36, 0xb1,
+  0x6a, 0x54, 0xc7, 0x51, 0xf7, 0x60, 0xab, 0xec, 0x53, 0x7f, 0xfe, 0xa6,
+  0x6e, 0x05, 0xd9, 0x34, 0xa8, 0x2e, 0x2f, 0xe8, 0x06, 0x56, 0xa3, 0x5f,
+  0x78, 0x69, 0x89, 0x6e, 0x7d, 0x4a, 0xe0, 0x2e, 0x83, 0x76, 0x23, 0x68,
+  0x1b, 0x39, 0x95, 0x7d, 0x95, 0x14, 0x56, 0xbe, 0xeb, 0xfe, 0x22, 0xe2,
+  0x09, 0x69, 0x9f, 0x4d, 0x2b, 0xfa, 0x59, 0xe8, 0x08, 0x9c, 0xa5, 0x29,
+  0xe3, 0x6e, 0xc8, 0x94, 0xc5, 0x64, 0x16, 0x8e, 0x51, 0x7f, 0x4c, 0xe1,
+  0x6c, 0x95, 0x98, 0xee, 0x61, 0x8d, 0x81, 0x99, 0x2a, 0x1f, 0x0b, 0xdc,
+  0xdf, 0xa9, 0x5e, 0xe3, 0x2c, 0x35, 0xd3, 0x70, 0x45, 0xf5, 0x61, 0x0f,
+  0x64, 0xbf, 0x88, 0xc8, 0x69, 0xcf, 0x53, 0xd1, 0xc1, 0x8e, 0x14, 0x1b,
+  0xb3, 0xa2, 0x80, 0xf9, 0x97, 0x07, 0xd9, 0xe2, 0xb0, 0x37, 0xa9, 0x96,
+  0x24, 0x45, 0x66, 0x54, 0xf0, 0x49, 0xe5, 0x42, 0x3c, 0xe3, 0x58, 0x8d,
+  0xd1, 0x87, 0x35, 0xf0, 0xf2, 0x4e, 0xfa, 0x82, 0xac, 0xed, 0xd3, 0x73,
+  0xe3, 0xbc, 0xf8, 0x8a, 0xd2, 0x6b, 0x89, 0xd3, 0x6f, 0x8a, 0x28, 0xb2,
+  0xe2, 0x13, 0x28, 0x02, 0x44, 0xd4, 0x17, 0x39, 0x39, 0x7b, 0x07, 0xae,
+  0x56, 0x0f, 0x6c, 0x37, 0xb4, 0x76, 0xed, 0x64, 0x63, 0x94, 0x67, 0xde,
+  0x46, 0x8d, 0xd3, 0x66, 0x82, 0x8f, 0xd2, 0xa4, 0xb4, 0x4c, 0x3b, 0x48,
+  0x78, 0x59, 0xf7, 0x22, 0x51, 0x79, 0xe7, 0x1b, 0x5e, 0x01, 0x18, 0x4a,
+  0x44, 0xda, 0xd2, 0xb7, 0xc2, 0x9d, 0xb1, 0x7c, 0x3a, 0x18, 0xdc, 0xd5,
+  0xdb, 0x77, 0xf7, 0x52, 0xfd, 0xdc, 0x4b, 0x78, 0x01, 0x96, 0xb0, 0x4f,
+  0x78, 0xa9, 0xf1, 0x17, 0xcc, 0x6c, 0x61, 0x6d, 0x25, 0x0c, 0xa7, 0x71,
+  0x3f, 0xf8, 0xca, 0xa7, 0xf5, 0x2a, 0x40, 0x35, 0x7a, 0x63, 0xd5, 0xed,
+  0x2c, 0x9a, 0x7f, 0x5f, 0xc2, 0xfc, 0x5b, 0x89, 0x1d, 0xde, 0x15, 0xa0,
+  0xe1, 0x7a, 0x33, 0x82, 0x79, 0xc1, 0xa1, 0x07, 0xd1, 0x69, 0x45, 0x26,
+  0xab, 0x36, 0x45, 0x37, 0x66, 0x2c, 0x18, 0x32, 0x9e, 0x00, 0xdd, 0x00,
+  0x38, 0xec, 0x6a, 0x14, 0x2b, 0x28, 0x5c, 0xe3, 0x44, 0x44, 0x2c, 0xad,
+  0x2b, 0xcc, 0x94, 0xc5, 0x10, 0xf3, 0xb0, 0xf5, 0x32, 0x93, 0xfb, 0x0f,
+  0x4a, 0xea, 0xf8, 0x66, 0xa3, 0xd1, 0xce, 0x66, 0x84, 0xe0, 0xa3, 0x3a,
+  0x4d, 0xe5, 0xf2, 0xc5, 0x11, 0x2f, 0x0a, 0x31, 0x48, 0xdc, 0x20, 0x30,
+  0x3e, 0xd2, 0x0d, 0x0b, 0x6b, 0x1a, 0xdd, 0x0b, 0x41, 0x66, 0x58, 0x5f,
+  0xcb, 0xe4, 0x6e, 0xaf, 0x66, 0x84, 0x90, 0xda, 0xac, 0x6f, 0x83, 0x46,
+  0x9a, 0x5d, 0x6b, 0xc4, 0xb0, 0x79, 0xea, 0x4e, 0x10, 0x6b, 0xef, 0x4e,
+  0xed, 0xe6, 0xe5, 0x74, 0x8d, 0x91, 0xe5, 0x83, 0xad, 0x8d, 0x57, 0xaf,
+  0xb7, 0x66, 0xd7, 0x09, 0x72, 0xda, 0xb6, 0xb5, 0x8e, 0x9d, 0x9b, 0xc8,
+  0xce, 0x8d, 0x82, 0x8e, 0x12, 0xfe, 0x7d, 0xae, 0x19, 0x20, 0x35, 0x45,
+  0x45, 0xe5, 0xc3, 0x98, 0x89, 0xc3, 0x76, 0x59, 0x97, 0x28, 0xc5, 0xb2,
+  0x12, 0x64, 0x49, 0xa9, 0x11, 0xe2, 0x0b, 0x79, 0xa5, 0x09, 0x3a, 0xed,
+  0x6c, 0xcf, 0x2a, 0x5a, 0x13, 0x3f, 0x1f, 0x8f, 0x4e, 0x64, 0x84, 0xf8,
+  0x5d, 0xa0, 0x9e, 0xf2, 0x5e, 0x0a, 0xaf, 0x40, 0x71, 0x30, 0xa4, 0xe7,
+  0xab, 0x84, 0xa2, 0x66, 0x22, 0x1a, 0x90, 0x98, 0xfe, 0x03, 0x8f, 0xba,
+  0x18, 0x8e, 0x2b, 0xa9, 0x0a, 0xec, 0xd2, 0x59, 0x8c, 0x43, 0xd9, 0x0c,
+  0x00, 0x89, 0x23, 0x0f, 0x68, 0xf1, 0x80, 0x70, 0x7d, 0x8f, 0x25, 0x93,
+  0x35, 0x02, 0x2c, 0x04, 0xc9, 0x1d, 0x81, 0x42, 0xd0, 0x8f, 0x14, 0x5f,
+  0x9f, 0xe2, 0x64, 0x44, 0xbc, 0x10, 0x1c, 0x96, 0x98, 0x81, 0x9b, 0xf3,
+  0x2b, 0x31, 0x15, 0x37, 0xae, 0x9a, 0xa6, 0x2d, 0xa5, 0xb9, 0x7e, 0x7c,
+  0x07, 0xd8, 0x52, 0x86, 0x23, 0xd0, 0x64, 0xac, 0x7f, 0x27, 0xbd, 0x0a,
+  0x05, 0xaa, 0x3e, 0x50, 0x72, 0xf1, 0x9c, 0x4a, 0xa5, 0xc9, 0x73, 0xac,
+  0xa5, 0x53, 0x13, 0x35, 0xfe, 0x4b, 0x59, 0xbf, 0xd8, 0x08, 0x08, 0x8f,
+  0x09, 0x40, 0x40, 0x41, 0x68, 0xee, 0xb1, 0xac, 0x11, 0xa1, 0xca, 0x24,
+  0x8d, 0xa9, 0xe8, 0xc3, 0xad, 0x15, 0xa6, 0x23, 0x08, 0x1b, 0x99, 0x0f,
+  0xa3, 0xf1, 0x0d, 0xf1, 0xd4, 0x6f, 0x08, 0x08, 0x8a, 0x65, 0x5d, 0x80,
+  0x9f, 0x84, 0x73, 0x0a, 0x75, 0x8c, 0xc9, 0xa5, 0x32, 0x1b, 0x2e, 0x2c,
+  0x99, 0x3c, 0x8f, 0x28, 0xf8, 0xa0, 0xbc, 0x01, 0x17, 0x36, 0xc0, 0x26,
+  0x5c, 0x96, 0xb2, 0x9a, 0xbc, 0x85, 0xe1, 0x24, 0x5e, 0x38, 0x48, 0x11,
+  0xb1, 0x56, 0x9f, 0xf4, 0x8a, 0x1c, 0x58, 0x65, 0x28, 0x42, 0x64, 0x60,
+  0x36, 0x2e, 0x1e, 0x48, 0xcb, 0x5e, 0xa0, 0x90, 0xa5, 0x69, 0x49, 0x18,
+  0x75, 0x9e, 0x00, 0x6d, 0x43, 0x54, 0x93, 0x00, 0xab, 0x28, 0x07, 0xf5,
+  0xe9, 0x6a, 0x31, 0x87, 0x04, 0xba, 0x63, 0xc6, 0x70, 0xab, 0x7d, 0x8f,
+  0x4d, 0xae, 0xac, 0x5d, 0xfe, 0xb5, 0x18, 0x1d, 0x17, 0xa3, 0x41, 0x95,
+  0xbd, 0x7d, 0x94, 0x19, 0x2c, 0x8b, 0x82, 0x2c, 0x8b, 0x42, 0xad, 0x60,
+  0x20, 0x2c, 0x73, 0x63, 0xb0, 0x3e, 0x66, 0x8d, 0x3d, 0x13, 0x06, 0xcc,
+  0xec, 0x34, 0x6a, 0x15, 0xf5, 0x22, 0xe5, 0x87, 0x0f, 0x00, 0xfe, 0x61,
+  0x65, 0xbc, 0x12, 0x18, 0x13, 0xa4, 0x26, 0x69, 0x35, 0x17, 0xb2, 0x92,
+  0x0d, 0x8e, 0x11, 0x3f, 0x95, 0xbb, 0x71, 0x1e, 0xa2, 0x14, 0x06, 0x87,
+  0x17, 0x39, 0xac, 0xcc, 0xa6, 0x6d, 0x51, 0x5f, 0x2a, 0xcb, 0x12, 0xd6,
+  0x4c, 0xaf, 0x9e, 0x6d, 0x17, 0xe1, 0x5d, 0xc8, 0xc0, 0x45, 0x95, 0x85,
+  0x66, 0x2d, 0xca, 0xee, 0xe1, 0xce, 0xeb, 0x66, 0xfd, 0x3c, 0xe8, 0x7d,
+  0xee, 0xfc, 0x78, 0x72, 0xc8, 0x21, 0xa0, 0xda, 0x5c, 0xe2, 0x64, 0x35,
+  0x20, 0x9d, 0x23, 0xd7, 0xb0, 0x2e, 0x4d, 0x2b, 0xa1, 0x2a, 0xae, 0xc2,
+  0x68, 0xd0, 0x53, 0x7f, 0xac, 0x89, 0x04, 0x44, 0x45, 0x5c, 0x25, 0x05,
+  0x8e, 0xb4, 0xa0, 0xb1, 0x87, 0xe3, 0x2e, 0x85, 0xe1, 0xc0, 0x49, 0xa3,
+  0x0a, 0xee, 0xd9, 0x8c, 0xdf, 0x00, 0x3a, 0xe3, 0x62, 0x39, 0x7c, 0x15,
+  0x54, 0x91, 0xd6, 0x0e, 0x95, 0xb1, 0xcd, 0x76, 0x06, 0x67, 0x61, 0x29,
+  0x76, 0x31, 0xab, 0xd0, 0xdc, 0x9b, 0xfd, 0x5d, 0xb9, 0x06, 0xdf, 0x20,
+  0x4f, 0x78, 0x3f, 0x88, 0x52, 0x27, 0xe5, 0x90, 0xa4, 0x3a, 0x7a, 0x66,
+  0x29, 0x13, 0xdb, 0x37, 0x1d, 0x3e, 0xdc, 0x80, 0xd2, 0x7f, 0x98, 0xcb,
+  0xd6, 0x4f, 0x1b, 0xaf, 0xf7, 0x77, 0xb6, 0xfe, 0xce, 0x09, 0xc6, 0xb1,
+  0xf0, 0x60, 0xf8, 0xf3, 0x3b, 0x6f, 0x7c, 0xa5, 0xd0, 0x70, 0x0a, 0xf7,
+  0x20, 0x13, 0x49, 0x8d, 0x51, 0xb2, 0x77, 0x52, 0xa9, 0xa7, 0xd3, 0xd9,
+  0xdf, 0x6e, 0x49, 0x7d, 0x0d, 0xe6, 0x16, 0xa4, 0x4d, 0x04, 0xd9, 0x00,
+  0x2c, 0xb0, 0x18, 0xd1, 0x48, 0x22, 0x31, 0x70, 0x43, 0x6f, 0x1f, 0x35,
+  0xb3, 0x5d, 0x45, 0x0a, 0x68, 0xf2, 0xee, 0xe1, 0xa8, 0xbc, 0x2a, 0xcf,
+  0x60, 0xbd, 0xad, 0x25, 0x5c, 0x8e, 0xcd, 0x2e, 0x8e, 0x2d, 0x1d, 0x17,
+  0x3d, 0x0f, 0x8c, 0x04, 0xf3, 0x60, 0x8f, 0x7d, 0xe6, 0x7e, 0xfb, 0x3d,
+  0x0f, 0xe6, 0xc3, 0xc9, 0xd0, 0x3c, 0x0e, 0xe4, 0xd3, 0x0c, 0x33, 0xb2,
+  0x1d, 0x52, 0x2e, 0x87, 0xf7, 0x57, 0xf8, 0xac, 0xe9, 0x44, 0xc2, 0xf5,
+  0x9e, 0x93, 0xe2, 0x3b, 0xc9, 0x9e, 0x37, 0xd4, 0xb9, 0x8e, 0x95, 0xfc,
+  0x4a, 0x09, 0xb1, 0x58, 0xed, 0xd1, 0x73, 0x89, 0x29, 0xbc, 0x1f, 0x7e,
+  0xab, 0xbb, 0xf0, 0x52, 0xa0, 0xd0, 0x0d, 0xbd, 0x8e, 0x5b, 0xf9, 0x19,
+  0xcd, 0x3e, 0x49, 0x88, 0xe5, 0xe8, 0x83, 0x8e, 0x23, 0x4b, 0xa2, 0xad,
+  0xd6, 0x06, 0x9e, 0x14, 0x69, 0xdd, 0xe2, 0x4a, 0xd5, 0xc7, 0xcd, 0xf8,
+  0xf4, 0x9a, 0xef, 0xa1, 0xb4, 0x2d, 0x82, 0xdc, 0x71, 0x2f, 0x27, 0xc7,
+  0xb2, 0xb2, 0x14, 0x69, 0xa3, 0x49, 0x45, 0xae, 0xb9, 0xca, 0xad, 0xfb,
+  0x54, 0x0b, 0xc8, 0x3a, 0x63, 0xce, 0x6f, 0x13, 0x72, 0x32, 0x93, 0xf0,
+  0x5e, 0x49, 0xca, 0xa3, 0x60, 0x81, 0x7b, 0x21, 0x2e, 0x56, 0x55, 0xa7,
+  0xc6, 0x5a, 0x0a, 0x17, 0x9e, 0xb0, 0x2a, 0x85, 0x05, 0xd0, 0xef, 0x52,
+  0x58, 0x48, 0x21, 0xea, 0x33, 0x36, 0xa3, 0x67, 0x45, 0xb8, 0xe1, 0x6f,
+  0xa2, 0x4a, 0x33, 0x1e, 0xa4, 0x4b, 0xb6, 0xd8, 0x68, 0x2c, 0x31, 0x9e,
+  0x21, 0x57, 0x30, 0xae, 0x9c, 0xd9, 0x52, 0x46, 0x27, 0x00, 0x54, 0x81,
+  0xcb, 0x80, 0xe6, 0x58, 0xf1, 0x81, 0x32, 0xd2, 0xb6, 0xde, 0x86, 0xa8,
+  0x78, 0x18, 0x48, 0x0d, 0x6b, 0xa4, 0xef, 0x36, 0x0d, 0xca, 0x08, 0x73,
+  0xa4, 0xa9, 0x95, 0x63, 0x29, 0xfd, 0xcd, 0x24, 0x89, 0x52, 0x4f, 0x61,
+  0x10, 0x59, 0xc3, 0xd0, 0xca, 0x1c, 0x68, 0x6a, 0x53, 0xc9, 0x06, 0xe7,
+  0x59, 0xbc, 0x5b, 0xcb, 0x02, 0x83, 0xd3, 0xcc, 0x9c, 0x59, 0x80, 0xfd,
+  0xd3, 0xb2, 0xbb, 0xcf, 0xe3, 0x59, 0x5a, 0x7e, 0xda, 0x5e, 0x7d, 0x4c,
+  0xe2, 0xb9, 0x51, 0xb6, 0xcc, 0x7b, 0x66, 0xe4, 0xf9, 0x17, 0x09, 0x1b,
+  0xd9, 0xc8, 0x1a, 0x4c, 0x63, 0x2b, 0x2b, 0x4f, 0x1a, 0xf7, 0xa3, 0x70,
+  0x59, 0x69, 0x07, 0x1f, 0x2e, 0x1f, 0x99, 0xb2, 0x6d, 0xa8, 0x4b, 0x2f,
+  0x7e, 0x59, 0xf8, 0x15, 0x2a, 0x0a, 0xdd, 0xaf, 0xcb, 0xdf, 0x79, 0x2b,
+  0x39, 0x52, 0xb9, 0x22, 0x3e, 0x93, 0x98, 0xb4, 0xf0, 0xb0, 0x98, 0x42,
+  0x1b, 0xa0, 0xa3, 0x86, 0xa9, 0x53, 0x8d, 0x6c, 0x51, 0x04, 0x24, 0x98,
+  0xf8, 0x1a, 0xb1, 0x8a, 0xec, 0xb1, 0xb9, 0xbc, 0x4f, 0x79, 0xfe, 0xde,
+  0xf5, 0x2a, 0xc8, 0x90, 0x8d, 0x56, 0x63, 0x69, 0x49, 0x14, 0xf2, 0x58,
+  0x6d, 0x03, 0x16, 0xe9, 0xba, 0x8c, 0x11, 0x03, 0xec, 0xc4, 0xd4, 0x82,
+  0xa8, 0x10, 0xc9, 0x66, 0x83, 0xae, 0x4f, 0xa6, 0x21, 0x16, 0x83, 0x02,
+  0xad, 0x8d, 0x15, 0xd8, 0x55, 0x54, 0x91, 0x9c, 0xc0, 0x48, 0xb3, 0x8d,
+  0xd6, 0x7f, 0x85, 0x7f, 0x57, 0x5a, 0xcf, 0xd8, 0x60, 0x04, 0xfc, 0x86,
+  0xea, 0x64, 0x30, 0x62, 0x4c, 0xbf, 0x04, 0x40, 0x42, 0x6d, 0xbf, 0x6c,
+  0xe4, 0x25, 0x6e, 0x3b, 0xdb, 0x8b, 0xc9, 0x35, 0xef, 0x6d, 0x70, 0x31,
+  0x4a, 0x93, 0x05, 0x34, 0x13, 0xc3, 0xe2, 0xaa, 0xb2, 0x30, 0xcc, 0x55,
+  0xf4, 0x08, 0x4a, 0x5d, 0x4a, 0x95, 0x40, 0x63, 0xef, 0xc5, 0x8e, 0xab,
+  0x9a, 0xed, 0xaf, 0x5f, 0x5c, 0x79, 0xb1, 0xda, 0x4c, 0xd3, 0x6c, 0x4e,
+  0xb4, 0xd6, 0xf5, 0x82, 0xc7, 0x69, 0x2a, 0x00, 0x33, 0xc7, 0x32, 0x14,
+  0x67, 0xab, 0x4d, 0xeb, 0xeb, 0x96, 0x5d, 0x28, 0xa8, 0x18, 0xb1, 0x76,
+  0xb9, 0x6d, 0x89, 0x99, 0x23, 0xa3, 0x91, 0xb3, 0xb8, 0x1e, 0x86, 0x56,
+  0x5a, 0x8d, 0x04, 0xe5, 0xae, 0xb0, 0x37, 0x20, 0xc8, 0x85, 0x33, 0xd5,
+  0xf8, 0xf0, 0x81, 0x3e, 0xfa, 0xe3, 0x8f, 0x46, 0xc4, 0x8c, 0x4e, 0x86,
+  0xca, 0xf5, 0xaa, 0xb2, 0x99, 0x30, 0xd3, 0x5a, 0x60, 0xcf, 0x1a, 0xe6,
+  0xb3, 0x2e, 0x4c, 0x75, 0x6f, 0xc8, 0xfa, 0xa4, 0x48, 0x06, 0x9a, 0x30,
+  0x6e, 0x51, 0x34, 0xd3, 0xed, 0x65, 0x8a, 0x66, 0x2f, 0x9e, 0xf2, 0x51,
+  0x72, 0x3d, 0x39, 0xff, 0x01, 0x9f, 0x54, 0xc5, 0x70, 0xb4, 0xd7, 0x49,
+  0x30, 0xcd, 0xd9, 0xe1, 0xa1, 0x29, 0x73, 0x79, 0x8f, 0x42, 0x3e, 0x6e,
+  0xa6, 0xe0, 0x0a, 0xdc, 0x2c, 0x17, 0x78, 0x4d, 0x2e, 0x14, 0x33, 0xb1,
+  0xf0, 0x7b, 0xd5, 0x23, 0x09, 0x01, 0xa7, 0xa9, 0x81, 0xfc, 0x82, 0xe2,
+  0xba, 0x54, 0x6b, 0x91, 0x2e, 0xac, 0x14, 0xd9, 0x13, 0x89, 0x0b, 0xea,
+  0xb7, 0xbb, 0xac, 0xe3, 0xdc, 0xac, 0x88, 0x1b, 0x0f, 0x89, 0x87, 0x43,
+  0x77, 0xcf, 0x6d, 0xb3, 0x54, 0x86, 0x74, 0xaa, 0x66, 0xb3, 0x59, 0x2b,
+  0xa6, 0xad, 0x86, 0xc6, 0x9a, 0x31, 0x40, 0xd1, 0x4d, 0x8f, 0xe7, 0xf7,
+  0x8d, 0x9d, 0x16, 0x2e, 0x03, 0x51, 0xfb, 0xfa, 0xbb, 0x18, 0xf4, 0xbf,
+  0x9b, 0x96, 0xab, 0x1b, 0xf4, 0xb9, 0x44, 0xba, 0xa9, 0x5b, 0xad, 0x2c,
+  0x53, 0x7c, 0x4a, 0x04, 0x64, 0xb7, 0x6e, 0xa3, 0x8d, 0xe8, 0x62, 0xae,
+  0x3b, 0xb0, 0xda, 0x75, 0x03, 0x8b, 0xe2, 0x08, 0xad, 0xb5, 0x57, 0x9e,
+  0xdb, 0x55, 0x02, 0x30, 0xdd, 0x1c, 0x70, 0xda, 0xd9, 0x88, 0x8a, 0xac,
+  0xc7, 0xbb, 0xa9, 0x0a, 0x32, 0x11, 0x85, 0x81, 0xaa, 0x24, 0xc4, 0x71,
+  0x50, 0x74, 0x9c, 0x1b, 0xbf, 0xc0, 0xa0, 0x17, 0x84, 0xbb, 0xee, 0xaf,
+  0x0d, 0xbd, 0xf1, 0xe3, 0x64, 0x45, 0x62, 0x06, 0x43, 0x64, 0x53, 0x30,
+  0x94, 0x76, 0xb3, 0x48, 0x92, 0xbe, 0x85, 0x0e, 0x07, 0xa7, 0xa7, 0x0c,
+  0xb8, 0x3f, 0x30, 0xf5, 0xc3, 0x7a, 0xd7, 0x93, 0xcd, 0x96, 0x9a, 0x28,
+  0xa6, 0xe6, 0xd5, 0xfb, 0xe8, 0x7a, 0x0e, 0xdf, 0x70, 0x1b, 0xe1, 0x34,
+  0xae, 0xb5, 0x56, 0x57, 0x1a, 0x99, 0x20, 0x3a, 0xe8, 0xc7, 0xe3, 0xab,
+  0x01, 0xd3, 0xbb, 0x3e, 0x16, 0xda, 0xd4, 0x9c, 0x0d, 0x4a, 0x0e, 0xb0,
+  0xf2, 0x90, 0x15, 0x59, 0x51, 0x28, 0x19, 0xb1, 0x9f, 0x3d, 0x13, 0x70,
+  0x71, 0x92, 0x4e, 0x06, 0x63, 0x2a, 0xa4, 0x13, 0xda, 0x5e, 0x6b, 0x48,
+  0xcb, 0x76, 0xe3, 0x62, 0x06, 0x14, 0xb0, 0xc6, 0x4d, 0x73, 0x43, 0x6b,
+  0xa8, 0x60, 0x98, 0x78, 0xf3, 0x28, 0xed, 0x83, 0xb0, 0x6b, 0xfb, 0x93,
+  0x8b, 0x63, 0x29, 0x79, 0x2f, 0x38, 0xc6, 0x3e, 0x18, 0x90, 0x6b, 0x19,
+  0x12, 0x4f, 0x53, 0x1f, 0x05, 0x1b, 0x33, 0x31, 0xea, 0x58, 0x89, 0x58,
+  0x20, 0xd8, 0x1d, 0x22, 0xb0, 0x54, 0xcf, 0x3c, 0x05, 0x9d, 0x6f, 0x60,
+  0x71, 0x58, 0x21, 0x53, 0x40, 0x46, 0x6c, 0xaa, 0x02, 0x01, 0x07, 0x15,
+  0xc6, 0x87, 0xaa, 0x41, 0x23, 0x05, 0x1e, 0x37, 0x9b, 0x16, 0xc0, 0x34,
+  0xe2, 0xc1, 0x4c, 0x58, 0x30, 0xe4, 0x9f, 0x76, 0x4d, 0x6b, 0x30, 0x0d,
+  0xdc, 0xe1, 0x75, 0x92, 0xc1, 0xf5, 0x3c, 0x5c, 0x2a, 0x23, 0xf6, 0x6f,
+  0xd2, 0x52, 0x0a, 0xae, 0x7b, 0x3d, 0x6c, 0x8d, 0xcc, 0xc5, 0x73, 0x62,
+  0x3a, 0x8c, 0x70, 0x88, 0xa7, 0x14, 0x77, 0x10, 0x38, 0xef, 0x2f, 0xe1,
+  0x86, 0x7a, 0xf6, 0x6b, 0x74, 0x1f, 0x09, 0x3d, 0xff, 0x80, 0xd7, 0x85,
+  0x64, 0xfd, 0xf4, 0x14, 0xb2, 0x10, 0x7a, 0x38, 0xef, 0xa8, 0xf8, 0x02,
+  0x55, 0x78, 0x13, 0x91, 0x52, 0x58, 0xa7, 0x5b, 0xac, 0xbc, 0xb6, 0x4c,
+  0xc9, 0x32, 0x3b, 0x6a, 0x94, 0x65, 0x62, 0x51, 0xca, 0x22, 0x71, 0xe8,
+  0x01, 0x33, 0xd1, 0x0b, 0x0e, 0x74, 0x2e, 0x5c, 0xea, 0x1a, 0x25, 0x69,
+  0xa3, 0x76, 0x17, 0x2e, 0xce, 0xf2, 0xac, 0x9f, 0xdc, 0x55, 0xa2, 0xa9,
+  0x46, 0x2f, 0x2b, 0x9b, 0x0b, 0xfa, 0x62, 0xcc, 0xd0, 0xe7, 0x9a, 0xae,
+  0x47, 0xbb, 0x79, 0xac, 0x16, 0x41, 0xb6, 0xa3, 0xb5, 0x94, 0x65, 0x6f,
+  0xa4, 0x27, 0xa6, 0x41, 0x02, 0x70, 0xad, 0xf5, 0xa7, 0x69, 0x07, 0xd2,
+  0x29, 0x9f, 0xbb, 0x70, 0x5a, 0xd0, 0xab, 0xdf, 0x98, 0x5a, 0x4f, 0x59,
+  0x83, 0x84, 0xbf, 0x6f, 0x3e, 0x7c, 0xc0, 0x6e, 0xf3, 0xb5, 0x96, 0x7d,
+  0xf8, 0x40, 0x42, 0x9e, 0xdc, 0x71, 0x5e, 0x09, 0xe7, 0x97, 0x69, 0x10,
+  0xc6, 0xb2, 0xd4, 0x74, 0x14, 0x63, 0xdd, 0x72, 0x8d, 0xd9, 0xca, 0x4e,
+  0x27, 0xfd, 0x13, 0x81, 0xef, 0x8c, 0xc9, 0x5f, 0xc4, 0xa6, 0x04, 0xa5,
+  0xb3, 0x98, 0x26, 0x4e, 0xce, 0xef, 0x80, 0xef, 0xb4, 0x5f, 0x8a, 0x60,
+  0x4e, 0x31, 0xa7, 0x88, 0xfa, 0x93, 0x08, 0x1d, 0x05, 0x39, 0x95, 0xd6,
+  0x59, 0x06, 0x8b, 0xeb, 0x81, 0x41, 0x56, 0x52, 0xed, 0x83, 0x42, 0x7d,
+  0x38, 0xb8, 0x81, 0xb5, 0x3c, 0xb9, 0xd3, 0xfb, 0x3e, 0x08, 0x07, 0x7b,
+  0x5c, 0x54, 0x54, 0x40, 0xdb, 0x0d, 0xd9, 0x79, 0x02, 0x5c, 0xec, 0x0e,
+  0x9c, 0x90, 0x46, 0x57, 0x05, 0xdd, 0x36, 0x31, 0x08, 0x87, 0x45, 0x92,
+  0xe2, 0x74, 0xdc, 0x1a, 0x0f, 0x5a, 0xec, 0x7b, 0x80, 0x49, 0xa5, 0x9d,
+  0xbd, 0xad, 0xcd, 0x33, 0x3b, 0x0f, 0x52, 0x11, 0x0d, 0xac, 0x4f, 0xc1,
+  0x01, 0x52, 0xfd, 0x20, 0xae, 0x11, 0xb1, 0x54, 0x62, 0x11, 0x5a, 0x75,
+  0xf4, 0x2a, 0x2e, 0x3e, 0x29, 0xdf, 0x6c, 0x81, 0xd6, 0x5b, 0xd4, 0x6e,
+  0x86, 0x98, 0x3d, 0xa4, 0x93, 0x50, 0x07, 0x4e, 0x38, 0x27, 0x24, 0x5e,
+  0xcf, 0xa9, 0x2e, 0x43, 0x77, 0x50, 0x4f, 0xc2, 0x3a, 0xb1, 0x22, 0x1a,
+  0x80, 0x7c, 0x75, 0x4e, 0x50, 0x7b, 0x22, 0x91, 0x84, 0x17, 0x4c, 0x92,
+  0x47, 0x38, 0x8b, 0x39, 0x06, 0x84, 0x88, 0x6e, 0xf1, 0xc5, 0x2d, 0x7f,
+  0xf8, 0x10, 0x76, 0xe3, 0x39, 0x75, 0xfa, 0xc7, 0x1f, 0x32, 0x82, 0x7f,
+  0x54, 0x83, 0x3e, 0x35, 0xa2, 0x50, 0xe3, 0xfe, 0x14, 0xf2, 0x81, 0xf9,
+  0x3f, 0x9d, 0xbd, 0x5d, 0x55, 0x12, 0x49, 0x25, 0xa4, 0x9f, 0xa3, 0x49,
+  0x8f, 0xab, 0x8d, 0x7e, 0x64, 0x20, 0x38, 0xa1, 0x1f, 0x3e, 0xd0, 0x8f,
+  0xe7, 0xd4, 0x53, 0xa0, 0xe1, 0xdb, 0x15, 0x0c, 0x72, 0x65, 0x87, 0x56,
+  0x62, 0x36, 0xa3, 0x8e, 0x83, 0x9c, 0x01, 0x8b, 0xc3, 0x22, 0xdc, 0x92,
+  0xfd, 0xf1, 0x52, 0xe6, 0xfc, 0x52, 0x9f, 0xbd, 0x0c, 0xe4, 0x47, 0x7c,
+  0x1e, 0xbe, 0xb6, 0x65, 0x38, 0x7e, 0xfc, 0x90, 0xda, 0xe0, 0x17, 0x6b,
+  0x82, 0x93, 0x94, 0x9a, 0x95, 0x7e, 0xff, 0xec, 0xea, 0x87, 0x9e, 0xac,
+  0xd7, 0xc7, 0x0f, 0xbb, 0xc5, 0x09, 0x35, 0x12, 0x7e, 0x0c, 0xc8, 0xc2,
+  0x9b, 0x4f, 0xd5, 0xb5, 0xb5, 0xf8, 0xb0, 0x70, 0x78, 0x83, 0x0e, 0x1b,
+  0x44, 0xec, 0x76, 0x0c, 0x19, 0xd2, 0x8f, 0x42, 0x0b, 0x22, 0x3a, 0x99,
+  0xb9, 0x9a, 0x50, 0xe0, 0xd1, 0x28, 0xa3, 0x02, 0xab, 0x35, 0x54, 0x76,
+  0xb9, 0xf1, 0x0b, 0xba, 0x6e, 0x91, 0x35, 0xef, 0xd7, 0xc6, 0x9f, 0x9d,
+  0x12, 0xda, 0xc2, 0xa4, 0xe6, 0x16, 0x6b, 0xf1, 0x53, 0x4b, 0xb3, 0x05,
+  0xf1, 0x2f, 0x50, 0xb7, 0xa5, 0x95, 0xa8, 0x38, 0xdf, 0x54, 0x17, 0xec,
+  0x63, 0x71, 0x03, 0x6e, 0xf0, 0x88, 0x39, 0xe2, 0xab, 0x3e, 0xee, 0x94,
+  0x89, 0xde, 0x91, 0xbb, 0x95, 0x5a, 0x70, 0x2e, 0x9b, 0x31, 0xa1, 0x84,
+  0x5f, 0x7d, 0x4d, 0x2c, 0xd3, 0xa1, 0xf5, 0xc7, 0x34, 0x58, 0x97, 0x88,
+  0x9c, 0x75, 0x27, 0x23, 0x55, 0xd0, 0x2c, 0xf7, 0x80, 0xa3, 0x50, 0xad,
+  0x08, 0x37, 0x47, 0x0a, 0x1d, 0x4f, 0xce, 0xce, 0xf4, 0xf4, 0x6b, 0x09,
+  0x61, 0x8a, 0x6f, 0x7e, 0x50, 0x65, 0x92, 0x00, 0x8d, 0xb0, 0x18, 0xa9,
+  0x57, 0x40, 0xa5, 0x8c, 0x07, 0x5d, 0xe4, 0x3b, 0x62, 0xbd, 0xa2, 0x4c,
+  0x13, 0x4d, 0x3a, 0xdf, 0x8a, 0x44, 0xa5, 0x85, 0xdc, 0x1c, 0xa0, 0x72,
+  0xe0, 0xc3, 0x34, 0xf2, 0x70, 0x55, 0xbc, 0x50, 0x81, 0x8e, 0x9f, 0x72,
+  0xd8, 0xd0, 0x0c, 0x20, 0xc1, 0xfe, 0x39, 0xcd, 0x57, 0x60, 0x2e, 0x7b,
+  0x5e, 0x86, 0x55, 0x63, 0xf0, 0xf3, 0x3e, 0x4d, 0xb4, 0x07, 0xd9, 0x58,
+  0x90, 0x29, 0xf2, 0xdb, 0x47, 0xf4, 0xef, 0x2a, 0xe2, 0xc5, 0x68, 0x4f,
+  0x5a, 0xaa, 0x68, 0xde, 0x90, 0x9e, 0x6a, 0x06, 0x22, 0xce, 0x12, 0x00,
+  0x12, 0x0c, 0x9b, 0xbd, 0x34, 0xe8, 0xd8, 0xec, 0x5b, 0xbc, 0x01, 0x53,
+  0x55, 0xce, 0x32, 0xe7, 0x59, 0x77, 0x15, 0xed, 0x2c, 0xd9, 0x19, 0x37,
+  0x1b, 0xe1, 0x78, 0x82, 0x9a, 0x6a, 0xd6, 0xa9, 0x4e, 0xd9, 0x3f, 0x71,
+  0xd8, 0xa0, 0x14, 0x00, 0xde, 0xa7, 0x07, 0x78, 0x37, 0x5d, 0x08, 0xfd,
+  0x14, 0x29, 0xf3, 0x09, 0x8d, 0xf5, 0x35, 0xd4, 0xa2, 0x15, 0x1a, 0xa4,
+  0x2a, 0xe1, 0x7c, 0xb1, 0x20, 0x99, 0x82, 0x0c, 0xcc, 0x16, 0xc2, 0xc5,
+  0x99, 0x4b, 0x56, 0x25, 0xef, 0xc7, 0xc1, 0x15, 0x35, 0xdc, 0x8c, 0x2e,
+  0x15, 0xf6, 0x95, 0x34, 0x9d, 0x19, 0x3c, 0x26, 0x18, 0x22, 0xa1, 0xb3,
+  0x3f, 0x88, 0x09, 0xff, 0x54, 0xa2, 0x9a, 0xcb, 0xa7, 0x93, 0xcd, 0x5d,
+  0x16, 0xbc, 0xf2, 0xa1, 0xa9, 0x0c, 0x59, 0xdf, 0x68, 0x5d, 0x5e, 0x36,
+  0xd8, 0x4e, 0x20, 0xb6, 0x3e, 0xde, 0x23, 0xec, 0x35, 0x7d, 0x19, 0x48,
+  0xbf, 0xc1, 0x57, 0x6b, 0x50, 0x7c, 0xc3, 0xed, 0xca, 0x22, 0x80, 0xc6,
+  0xc2, 0xd9, 0x48, 0x2e, 0x15, 0x1c, 0x0d, 0x91, 0x77, 0x14, 0x46, 0x40,
+  0x1b, 0x46, 0x12, 0x2a, 0x0f, 0x89, 0xf0, 0xb4, 0x55, 0xf7, 0x2f, 0x1c,
+  0x3a, 0xa7, 0x38, 0xde, 0x78, 0x6d, 0x63, 0xd0, 0xbb, 0x67, 0x06, 0xb1,
+  0x42, 0x89, 0x64, 0x65, 0x72, 0x0c, 0x70, 0x52, 0x69, 0x1d, 0x86, 0xc1,
+  0xf1, 0x55, 0x89, 0xaa, 0x80, 0xa8, 0x36, 0xce, 0x33, 0x6b, 0x66, 0xc6,
+  0xfa, 0x24, 0x15, 0x6f, 0xd1, 0x27, 0x9a, 0x2d, 0xf9, 0x9c, 0x01, 0xf5,
+  0x5f, 0xd3, 0xf0, 0x17, 0x5d, 0x12, 0xe1, 0x12, 0xf6, 0x20, 0xbb, 0x2a,
+  0xe0, 0xcb, 0xaa, 0x38, 0x93, 0xd7, 0x52, 0xc6, 0xa3, 0x3e, 0xa0, 0xa6,
+  0x71, 0x8d, 0x0b, 0x74, 0xad, 0xc8, 0xc0, 0xf5, 0x9b, 0x25, 0xa7, 0x3b,
+  0xb2, 0x00, 0x19, 0x28, 0x6a, 0xd4, 0xad, 0x27, 0xd2, 0x57, 0x71, 0x4c,
+  0x7a, 0x23, 0x2e, 0xa6, 0x99, 0x71, 0xd9, 0xc2, 0x52, 0xb4, 0x8c, 0x68,
+  0x8e, 0x71, 0x95, 0xc5, 0x91, 0x71, 0x88, 0x20, 0x53, 0x7a, 0x92, 0xfb,
+  0x9c, 0x65, 0xf5, 0xd1, 0x59, 0x1d, 0xfb, 0x6e, 0x13, 0xb6, 0xa2, 0x66,
+  0x55, 0xb9, 0x81, 0xa2, 0x80, 0xfc, 0x08, 0xb0, 0x12, 0xbc, 0x8e, 0x44,
+  0x54, 0x49, 0x4f, 0xe8, 0x88, 0x93, 0x9b, 0x2d, 0xcf, 0x3f, 0xc9, 0x6d,
+  0x9e, 0x9b, 0xd1, 0xa9, 0x3e, 0x1a, 0x3b, 0xea, 0xc7, 0x68, 0x70, 0xab,
+  0x71, 0xae, 0x44, 0xce, 0x54, 0x93, 0x9f, 0x8e, 0xd5, 0x3c, 0x97, 0xd4,
+  0x91, 0xac, 0xb3, 0x0d, 0xa4, 0x57, 0xa5, 0x67, 0x35, 0x02, 0x6e, 0xc2,
+  0xea, 0xac, 0xcf, 0x69, 0x5c, 0x8a, 0x06, 0x6c, 0x36, 0x4d, 0x78, 0x47,
+  0xa1, 0x65, 0x91, 0x87, 0x0c, 0x0b, 0xc4, 0x65, 0x4f, 0xcb, 0x36, 0x58,
+  0xe9, 0x9b, 0x3d, 0xf6, 0x8e, 0x4a, 0x86, 0x81, 0xe2, 0x34, 0x20, 0xd7,
+  0x80, 0xb6, 0x08, 0x7e, 0xe4, 0xda, 0x0a, 0x58, 0x82, 0xb7, 0xcf, 0x7c,
+  0x3b, 0x49, 0xf6, 0x2a, 0x0c, 0x53, 0xcd, 0x74, 0xd5, 0x39, 0xbb, 0x02,
+  0x8a, 0xff, 0xc1, 0x30, 0x0c, 0xef, 0xd4, 0x71, 0x69, 0x48, 0x16, 0x32,
+  0xea, 0xca, 0x55, 0x1f, 0xd5, 0x5b, 0x02, 0xbe, 0x49, 0x2c, 0x4b, 0x0f,
+  0x11, 0x75, 0x3c, 0xcf, 0xd4, 0x27, 0x4b, 0x63, 0x09, 0x32, 0xc5, 0x19,
+  0xf8, 0xe6, 0x98, 0x4a, 0x23, 0x66, 0x8b, 0x12, 0xd5, 0xc2, 0x39, 0x28,
+  0xab, 0x54, 0xbc, 0xc8, 0x24, 0x32, 0x6a, 0xb3, 0x60, 0x58, 0x11, 0xad,
+  0x82, 0xd8, 0xcb, 0xc7, 0x74, 0xe7, 0x0b, 0xdf, 0x74, 0x61, 0xcb, 0x7c,
+  0x41, 0xc2, 0x3f, 0x0b, 0x98, 0xe2, 0x89, 0xe4, 0xfa, 0x9e, 0x6a, 0x96,
+  0x6e, 0x06, 0x2d, 0xf2, 0xf4, 0xc6, 0x99, 0x4a, 0x45, 0xb9, 0x81, 0xd2,
+  0xd3, 0x22, 0x8e, 0x23, 0x08, 0x50, 0x26, 0x1f, 0x07, 0x89, 0xe6, 0x64,
+  0x1c, 0x35, 0x34, 0x1a, 0x3c, 0xc2, 0x74, 0x5d, 0x0c, 0x66, 0xac, 0x6d,
+  0xf1, 0xcf, 0x2d, 0xec, 0xab, 0x44, 0xf8, 0x09, 0x55, 0xc6, 0xef, 0xca,
+  0x1d, 0x8e, 0x29, 0xbc, 0x77, 0x09, 0x84, 0xd2, 0xe7, 0xa7, 0x83, 0x58,
+  0xcc, 0x80, 0xec, 0xb4, 0xfc, 0xe1, 0x1a, 0x50, 0xce, 0x94, 0x2f, 0xc4,
+  0x8b, 0x1a, 0x4d, 0xab, 0x44, 0xdd, 0xac, 0xe5, 0x20, 0x27, 0x4d, 0xb0,
+  0x28, 0xf9, 0x56, 0x44, 0xc9, 0x58, 0xf0, 0xea, 0x95, 0x94, 0x4c, 0xf4,
+  0x82, 0x23, 0x17, 0x7c, 0xe2, 0xf3, 0xdb, 0xd7, 0x78, 0x5b, 0x86, 0x27,
+  0xb5, 0x3a, 0x08, 0x08, 0x21, 0xac, 0xbc, 0xbd, 0x5e, 0x4c, 0x44, 0x3d,
+  0x8e, 0x30, 0x15, 0xc0, 0x36, 0x49, 0x2b, 0x21, 0xc5, 0xd6, 0xc0, 0xe5,
+  0x04, 0xf9, 0xaf, 0x19, 0xe1, 0xa4, 0xe3, 0x4d, 0xc8, 0x86, 0x91, 0x75,
+  0xc2, 0x9c, 0x0d, 0xe2, 0xdb, 0x8d, 0x60, 0xf4, 0x11, 0xfb, 0x08, 0xed,
+  0xbe, 0x8f, 0x2e, 0x09, 0x22, 0xc4, 0xe2, 0x64, 0x32, 0xf6, 0xc5, 0x1a,
+  0xb1, 0xd2, 0xe8, 0x9e, 0x82, 0x06, 0x94, 0x9b, 0x90, 0xc9, 0x4a, 0xa1,
+  0x22, 0x08, 0xee, 0xcd, 0x5a, 0x8c, 0xa5, 0x47, 0x60, 0x7d, 0x03, 0xea,
+  0xaa, 0xa5, 0xf0, 0x29, 0xf4, 0xea, 0x85, 0xd6, 0x50, 0xe3, 0x86, 0x00,
+  0xfe, 0x27, 0xb8, 0x81, 0x92, 0xdd, 0xc0, 0x06, 0x04, 0x67, 0x3c, 0x6a,
+  0x91, 0xe5, 0xd0, 0xc9, 0xa0, 0xad, 0xc9, 0x30, 0xa3, 0x0f, 0xc5, 0x5d,
+  0xad, 0x49, 0x11, 0x34, 0xbf, 0xf2, 0x64, 0x42, 0x20, 0x3c, 0x0a, 0x41,
+  0x17, 0x53, 0x32, 0x35, 0xee, 0xc2, 0x2a, 0xe9, 0xf5, 0x2f, 0x6b, 0x25,
+  0x2d, 0xb7, 0x4f, 0x6b, 0xe0, 0x6c, 0x3c, 0x54, 0x36, 0x1e, 0x4e, 0x0d,
+  0x15, 0x71, 0xcf, 0x68, 0x4f, 0x1c, 0x77, 0x54, 0xa2, 0xcd, 0x19, 0xa9,
+  0xd5, 0xc6, 0x20, 0x83, 0x94, 0xc8, 0x38, 0xab, 0x8e, 0x3a, 0x2a, 0xd8,
+  0x44, 0x22, 0xeb, 0x5f, 0xa2, 0x92, 0x1a, 0xa5, 0xf1, 0x50, 0x10, 0x72,
+  0x65, 0x48, 0x7d, 0x13, 0xaa, 0xfa, 0x26, 0xf1, 0x1e, 0xb1, 0xda, 0xa0,
+  0x01, 0xfd, 0xf3, 0xc4, 0xa7, 0xe7, 0xba, 0x68, 0xc8, 0xcb, 0x92, 0x53,
+  0xb2, 0x19, 0x94, 0xef, 0xa3, 0x4e, 0x67, 0xe7, 0xe8, 0xe5, 0xc6, 0xe6,
+  0x5f, 0xb7, 0x76, 0x5f, 0x35, 0x66, 0x7b, 0x04, 0x96, 0x32, 0x0b, 0x02,
+  0xd5, 0xd1, 0x69, 0x2c, 0x87, 0x16, 0x88, 0xb5, 0x31, 0x5a, 0x72, 0x47,
+  0x1b, 0xf1, 0x3d, 0x0c, 0xeb, 0x4f, 0x41, 0x5a, 0x70, 0x29, 0x03, 0x76,
+  0xa9, 0xf1, 0x9a, 0xf8, 0x46, 0xe8, 0xb6, 0x21, 0x90, 0x8f, 0xae, 0x84,
+  0x0e, 0xc7, 0x58, 0x7b, 0x6a, 0x17, 0xcb, 0x2f, 0xd3, 0xdb, 0x62, 0x12,
+  0x04, 0xdb, 0x38, 0x28, 0x08, 0xc8, 0xb8, 0x68, 0xbd, 0xca, 0xc7, 0xc5,
+  0xf3, 0xc6, 0x52, 0x02, 0x96, 0x34, 0xe2, 0xef, 0x4c, 0xd9, 0x49, 0x1a,
+  0x65, 0x51, 0x2c, 0x69, 0x92, 0x5b, 0xdc, 0x57, 0xb9, 0x8e, 0x9a, 0xe3,
+  0xd6, 0x48, 0xdc, 0x89, 0xe2, 0x9e, 0xb3, 0x17, 0xe9, 0xa1, 0x1a, 0x15,
+  0xe2, 0x90, 0x31, 0x6a, 0x4e, 0x4e, 0x2b, 0x8b, 0x54, 0xb3, 0x86, 0xaf,
+  0x11, 0xe5, 0xb1, 0x2f, 0x93, 0x0c, 0x74, 0x25, 0xaa, 0x5b, 0xbb, 0x1a,
+  0xa0, 0x88, 0xac, 0xb7, 0x3f, 0x69, 0x7c, 0xba, 0xf0, 0x04, 0x35, 0x43,
+  0xe5, 0xbd, 0x71, 0xab, 0xba, 0x84, 0x25, 0x42, 0x8a, 0xc4, 0x9a, 0x3f,
+  0x6a, 0x23, 0x7c, 0xd5, 0xb9, 0x3c, 0x79, 0xae, 0xea, 0xa3, 0x73, 0x43,
+  0x9b, 0xac, 0x56, 0xdd, 0xf4, 0x4f, 0xce, 0x5f, 0xed, 0x76, 0xe8, 0x7d,
+  0x1c, 0x7c, 0x0c, 0x84, 0x3d, 0xe0, 0x39, 0xbe, 0x0c, 0xf4, 0x42, 0x5a,
+  0x06, 0xfb, 0xd5, 0xc2, 0x00, 0x06, 0x3d, 0xaa, 0x02, 0x20, 0x6f, 0xca,
+  0x97, 0x19, 0xd7, 0x22, 0x9c, 0xd3, 0xaf, 0xd5, 0x50, 0xc0, 0x81, 0xf6,
+  0x2c, 0x7b, 0x89, 0xfb, 0x8d, 0xd3, 0x65, 0x5a, 0x39, 0x4d, 0x45, 0x6b,
+  0x9f, 0x8d, 0xcf, 0x49, 0x66, 0x25, 0x8b, 0x9f, 0xb6, 0x30, 0x8a, 0x70,
+  0x92, 0x6a, 0xe5, 0x09, 0x7b, 0xd4, 0x2b, 0xeb, 0xd3, 0xcc, 0x27, 0xe3,
+  0x01, 0x71, 0xdb, 0x13, 0xf9, 0xde, 0x30, 0x1b, 0x21, 0x7b, 0x52, 0x3b,
+  0x92, 0x0c, 0xad, 0xcd, 0x6c, 0x06, 0x09, 0x60, 0x73, 0xd0, 0xbf, 0x34,
+  0xeb, 0x2d, 0x81, 0x9d, 0x26, 0x20, 0xfc, 0xc6, 0xb3, 0xc0, 0x3b, 0xa2,
+  0x0d, 0x87, 0x2d, 0xb0, 0x9c, 0x81, 0x52, 0xb1, 0x26, 0x36, 0xb7, 0x08,
+  0x86, 0xb0, 0xf5, 0x72, 0xf3, 0xd5, 0xf6, 0xa6, 0x9a, 0x4b, 0x5e, 0x91,
+  0x1d, 0x60, 0xc6, 0x72, 0xe6, 0x71, 0x9f, 0xb9, 0x3b, 0xee, 0x0d, 0x8f,
+  0x8b, 0xe6, 0x65, 0xc2, 0x3f, 0x57, 0x26, 0x9a, 0x83, 0x29, 0x12, 0xf7,
+  0xcf, 0x7b, 0xb3, 0x2b, 0x5c, 0x14, 0x17, 0x04, 0x29, 0x10, 0xad, 0x0d,
+  0x94, 0x32, 0x26, 0x3e, 0x07, 0x6a, 0xbc, 0xd5, 0x25, 0x9d, 0x94, 0x0c,
+  0x15, 0x34, 0x40, 0x92, 0x58, 0xec, 0xe6, 0xdd, 0xfc, 0x11, 0xd6, 0xa2,
+  0xcd, 0x1f, 0x6d, 0x8a, 0xa0, 0x88, 0x82, 0x0c, 0x0a, 0xfa, 0xd0, 0x59,
+  0x95, 0x57, 0x3d, 0x1e, 0x7d, 0x21, 0xeb, 0xd2, 0x22, 0x3e, 0xd5, 0xd9,
+  0xa0, 0xb2, 0x03, 0x53, 0xc1, 0x45, 0xf1, 0x82, 0xb2, 0x00, 0x77, 0x68,
+  0x14, 0x03, 0x32, 0x06, 0x4a, 0x27, 0x9d, 0xcd, 0x83, 0x8d, 0xd7, 0x81,
+  0x1a, 0x60, 0x62, 0xb5, 0x35, 0xa0, 0x75, 0x77, 0xeb, 0x10, 0x3e, 0x46,
+  0xd7, 0x3a, 0x8e, 0x1f, 0x3a, 0x9d, 0xd6, 0xc6, 0xfe, 0x36, 0x8d, 0x44,
+  0x7e, 0x05, 0xdc, 0x9a, 0x66, 0x56, 0xeb, 0x63, 0x3f, 0x76, 0x0e, 0x41,
+  0xba, 0xf4, 0xf3, 0x8e, 0x59, 0x11, 0x11, 0xa0, 0x8c, 0x0e, 0xc0, 0x4e,
+  0xd7, 0xec, 0x49, 0xab, 0xf7, 0xa9, 0x13, 0xf5, 0x2f, 0xac, 0xdb, 0x0b,
+  0xeb, 0xf7, 0x7b, 0xa1, 0xc3, 0xf1, 0x14, 0xe9, 0xde, 0xcf, 0x02, 0x22,
+  0xc7, 0xc3, 0x5c, 0x0e, 0xde, 0xee, 0xa1, 0x57, 0xbb, 0xe9, 0x7b, 0x76,
+  0x1f, 0x85, 0x6f, 0xc2, 0xb5, 0x27, 0x45, 0x41, 0xc5, 0xe6, 0xe2, 0x82,
+  0xde, 0x62, 0x2c, 0xce, 0xfe, 0xe5, 0x63, 0x6a, 0x42, 0x53, 0xf9, 0x69,
+  0xb1, 0xe9, 0xb3, 0xe9, 0xbc, 0x14, 0x8b, 0x27, 0x0b, 0x4f, 0xfb, 0x80,
+  0xc8, 0xda, 0xe6, 0xce, 0x5a, 0xef, 0x1d, 0x72, 0xfa, 0x48, 0x12, 0xc8,
+  0xac, 0xc1, 0x1a, 0x88, 0x2c, 0x49, 0x27, 0xf0, 0x10, 0xb1, 0xaa, 0xdf,
+  0x94, 0xac, 0x7a, 0x71, 0x1a, 0x49, 0xbc, 0xc5, 0xdc, 0xda, 0x0f, 0x2f,
+  0xb5, 0xe5, 0x40, 0x00, 0xbf, 0x53, 0xa3, 0x1b, 0x76, 0xa2, 0x61, 0x04,
+  0x8d, 0xa7, 0x39, 0x5b, 0xbc, 0x2c, 0xc3, 0x19, 0x3a, 0xfb, 0xbd, 0x1c,
+  0x36, 0x71, 0xa7, 0x52, 0x9c, 0xc2, 0x12, 0x2b, 0xad, 0x11, 0x63, 0x34,
+  0xb4, 0xc0, 0x3d, 0xd9, 0xe1, 0x9f, 0x39, 0x0f, 0xbd, 0xa3, 0x6e, 0x99,
+  0x86, 0x89, 0xbe, 0x09, 0xb0, 0xad, 0xaa, 0x6b, 0x87, 0x3b, 0xaf, 0xe9,
+  0x3d, 0x04, 0xde, 0xdd, 0x63, 0xcd, 0xe8, 0xb9, 0xa3, 0x77, 0x2f, 0xed,
+  0x15, 0x4a, 0xf4, 0x3d, 0xcb, 0xd5, 0xcb, 0x12, 0xb6, 0xa7, 0x7f, 0x5c,
+  0x86, 0x93, 0x7d, 0x5e, 0xf4, 0x86, 0x52, 0x88, 0x20, 0x36, 0x21, 0x16,
+  0x19, 0x61, 0xfe, 0xa1, 0x05, 0x3a, 0x36, 0xec, 0x71, 0x90, 0xb0, 0x3c,
+  0x26, 0x32, 0xb2, 0x7e, 0x3e, 0x8d, 0x45, 0xa5, 0xf6, 0x79, 0x66, 0xe1,
+  0x07, 0x46, 0x74, 0x6e, 0xec, 0x6c, 0x9f, 0xeb, 0xdd, 0x75, 0x26, 0x41,
+  0x69, 0xbc, 0xce, 0x76, 0x10, 0x11, 0x83, 0xfc, 0xe7, 0x68, 0x31, 0x62,
+  0x6d, 0x9b, 0x91, 0x44, 0xe6, 0x52, 0x7a, 0x67, 0x52, 0x8a, 0x45, 0x8f,
+  0x59, 0xc0, 0x6d, 0x68, 0x11, 0x3d, 0x34, 0x5a, 0x54, 0x16, 0xc1, 0xd1,
+  0xd9, 0xdf, 0xdd, 0xfa, 0x61, 0x0f, 0x2c, 0x1b, 0xbf, 0xdd, 0x67, 0xb1,
+  0x64, 0x4f, 0xa8, 0xc8, 0x89, 0x41, 0x5c, 0x63, 0x8b, 0x49, 0x5a, 0xc1,
+  0x55, 0xe3, 0x2e, 0x6b, 0x0e, 0x0d, 0xd7, 0x26, 0x9a, 0x1a, 0xa3, 0x45,
+  0xd6, 0x36, 0x1c, 0xdc, 0x0e, 0xf2, 0x5a, 0x3b, 0x9c, 0xc6, 0xda, 0xc1,
+  0x44, 0x83, 0x98, 0x12, 0x85, 0xbf, 0xd0, 0x4b, 0xa7, 0xb5, 0xf5, 0xd3,
+  0xfe, 0xde, 0xc1, 0xa1, 0x11, 0x02, 0x04, 0x1a, 0xe7, 0x79, 0x63, 0x4c,
+  0x66, 0x26, 0xc1, 0xe2, 0x9a, 0x3e, 0x5c, 0xe6, 0x10, 0x0d, 0xc8, 0xdd,
+  0xef, 0x5d, 0xf9, 0x91, 0xd0, 0xc2, 0x54, 0x55, 0x35, 0xe9, 0x86, 0x19,
+  0x19, 0xfd, 0x9c, 0x39, 0x69, 0xa9, 0xdc, 0x82, 0x67, 0x0e, 0xf6, 0xb3,
+  0xc5, 0x0e, 0x95, 0xaf, 0x2b, 0xb2, 0x03, 0x86, 0x8a, 0x41, 0x85, 0x78,
+  0x8a, 0xc3, 0x5c, 0x9a, 0x66, 0xbf, 0xae, 0x31, 0x49, 0x43, 0x9a, 0xa3,
+  0x2a, 0x07, 0xda, 0x2e, 0xdd, 0x1c, 0xaf, 0x71, 0x61, 0x50, 0xdb, 0xb8,
+  0x6a, 0xf4, 0x02, 0xb1, 0x5b, 0x65, 0xd6, 0x80, 0xde, 0xf4, 0x4b, 0xd2,
+  0x9a, 0x51, 0x58, 0x8c, 0x7f, 0x35, 0xde, 0x15, 0xba, 0x95, 0xe8, 0x55,
+  0xf7, 0xf0, 0x75, 0x07, 0x98, 0x43, 0x95, 0xbc, 0x70, 0x2d, 0x10, 0x46,
+  0x55, 0xca, 0x92, 0x53, 0xd1, 0xe3, 0xf7, 0x6a, 0xdc, 0x4d, 0x0f, 0xfc,
+  0xac, 0xf3, 0x4e, 0x4f, 0xf1, 0x21, 0x77, 0x68, 0xcc, 0xc2, 0x4c, 0x70,
+  0xc6, 0x65, 0xab, 0x67, 0x4e, 0xe3, 0x56, 0x5d, 0x13, 0x7a, 0xdb, 0x8c,
+  0xd0, 0xb8, 0xde, 0x50, 0x74, 0xbe, 0x8b, 0xbc, 0x3f, 0xc9, 0x63, 0xfe,
+  0xd9, 0x65, 0x2f, 0xef, 0x07, 0xe6, 0x5e, 0x0e, 0x50, 0x54, 0xf0, 0x85,
+  0xfe, 0xa6, 0xe1, 0x9f, 0x1b, 0x94, 0x87, 0x46, 0x31, 0x71, 0x6f, 0x77,
+  0x36, 0x76, 0x33, 0x7b, 0x8e, 0x50, 0xd8, 0x8b, 0xd3, 0x52, 0x6c, 0xa2,
+  0xdb, 0x5b, 0x5b, 0x5b, 0xd9, 0xd3, 0x95, 0xb5, 0xf6, 0xea, 0xdf, 0x12,
+  0x4d, 0x2b, 0xe8, 0xe7, 0xbd, 0xae, 0x16, 0xc4, 0x0b, 0xf3, 0xde, 0x22,
+  0x31, 0xa9, 0x5f, 0x8c, 0xd9, 0xb8, 0xdc, 0x8c, 0x35, 0x29, 0xb9, 0xae,
+  0x90, 0x2a, 0x0e, 0x39, 0x67, 0xc7, 0x6b, 0xe5, 0x30, 0x46, 0xac, 0x72,
+  0x82, 0x29, 0xca, 0x81, 0x89, 0xcf, 0x1e, 0x67, 0x3f, 0x8e, 0x1a, 0x3c,
+  0x66, 0x05, 0xcc, 0xe7, 0x89, 0x44, 0x2b, 0xa6, 0x13, 0xfc, 0x6a, 0x15,
+  0x6a, 0xd2, 0x6e, 0x1e, 0xde, 0x2f, 0x97, 0xff, 0x59, 0xcd, 0xab, 0x53,
+  0x0e, 0x5b, 0xe3, 0x81, 0xd5, 0xa1, 0xba, 0x22, 0x55, 0xdc, 0x6a, 0x46,
+  0x66, 0x2f, 0x58, 0xfd, 0xfe, 0xd6, 0x39, 0x78, 0x44, 0xc1, 0x13, 0x20,
+  0xb6, 0xd4, 0xb7, 0xc3, 0x49, 0xa0, 0x92, 0x69, 0x24, 0x66, 0x49, 0xe4,
+  0xa9, 0x6a, 0x24, 0x6a, 0xcd, 0xb2, 0xdc, 0x16, 0xa1, 0x9f, 0xde, 0xe7,
+  0x18, 0x44, 0x0d, 0xee, 0x45, 0xa9, 0x14, 0xa7, 0x2f, 0x87, 0xbe, 0x62,
+  0xce, 0x52, 0x2d, 0x43, 0x17, 0x16, 0x7d, 0x09, 0x76, 0x09, 0x94, 0x6d,
+  0x7e, 0xff, 0x76, 0xe6, 0x9b, 0xb7, 0xac, 0xdd, 0x04, 0x19, 0x43, 0x75,
+  0xa9, 0x5e, 0x98, 0x31, 0xed, 0x48, 0x83, 0x07, 0xd0, 0x40, 0xce, 0xbb,
+  0x86, 0x2c, 0x41, 0x11, 0x13, 0x95, 0x42, 0x32, 0x7d, 0xa5, 0x51, 0x09,
+  0x33, 0x71, 0x35, 0xbf, 0x59, 0x59, 0x89, 0x31, 0x24, 0x2c, 0x66, 0x92,
+  0x49, 0x93, 0xac, 0xe5, 0xe2, 0x36, 0x12, 0x30, 0xd9, 0xe9, 0x96, 0x10,
+  0xb9, 0x19, 0x43, 0x6f, 0xb1, 0x11, 0x49, 0x66, 0xf0, 0xa1, 0x73, 0xc7,
+  0x9a, 0x5c, 0x56, 0x73, 0xfb, 0x68, 0x93, 0xc8, 0x71, 0x9d, 0x1c, 0x57,
+  0xe3, 0x72, 0x3c, 0x51, 0xe5, 0xd9, 0xd4, 0x59, 0x03, 0xff, 0xe0, 0x35,
+  0x75, 0x40, 0x7b, 0x06, 0xc3, 0x75, 0x5a, 0x8e, 0xd9, 0xd0, 0x2f, 0xa0,
+  0xc2, 0xc7, 0x08, 0xaf, 0x09, 0xd2, 0xf0, 0x15, 0x95, 0x9c, 0x55, 0xe3,
+  0x7e, 0x1c, 0x0d, 0xfa, 0xf3, 0x8b, 0xbb, 0xf0, 0x41, 0xbf, 0x3c, 0x82,
+  0x93, 0x51, 0x4b, 0x14, 0xcb, 0x30, 0x73, 0xf5, 0x96, 0x71, 0x43, 0x0b,
+  0x98, 0xf2, 0x3f, 0x28, 0xbc, 0x94, 0xe7, 0x0d, 0x88, 0x10, 0x6a, 0x66,
+  0xa1, 0x6d, 0x88, 0x4a, 0xf6, 0x6a, 0xbf, 0xb8, 0x82, 0x96, 0x18, 0x73,
+  0xe5, 0xfe, 0x6e, 0xa5, 0x7f, 0xa3, 0xf5, 0x52, 0x8c, 0x97, 0xd8, 0x94,
+  0xbf, 0x8f, 0xc4, 0x1d, 0x37, 0xce, 0x8f, 0x25, 0x7a, 0x99, 0x3f, 0x4f,
+  0x34, 0x50, 0xe9, 0x00, 0x35, 0xf6, 0x6e, 0xcc, 0xd6, 0x20, 0x60, 0x03,
+  0x82, 0x79, 0x1c, 0x9a, 0xc9, 0x47, 0xdd, 0xe8, 0x65, 0x3b, 0x16, 0x90,
+  0x54, 0xcb, 0xe4, 0x0b, 0x6a, 0x4e, 0x60, 0x14, 0x62, 0x16, 0x5a, 0xf8,
+  0xc0, 0x60, 0xc7, 0x3c, 0xfd, 0x05, 0x7e, 0xe9, 0xc3, 0x1f, 0x96, 0xf2,
+  0xc4, 0x1d, 0x3a, 0x3f, 0x5e, 0xa6, 0xb0, 0x23, 0x16, 0x9a, 0x66, 0x07,
+  0xe6, 0x01, 0x19, 0x54, 0x50, 0x0b, 0xf7, 0x84, 0x63, 0xe1, 0x5d, 0xe6,
+  0x99, 0x21, 0xe8, 0x1b, 0xaa, 0xd2, 0x02, 0xb7, 0xc7, 0x1e, 0x5e, 0x09,
+  0x8f, 0xf3, 0xe0, 0x69, 0x08, 0xe0, 0xf3, 0x11, 0x7c, 0xc2, 0xfe, 0x00,
+  0x7d, 0xa0, 0x5e, 0x38, 0x1d, 0xd3, 0x62, 0x92, 0x90, 0x12, 0xe3, 0x31,
+  0x38, 0x6a, 0x65, 0x49, 0x23, 0x79, 0xbd, 0xd7, 0xd4, 0xd9, 0x63, 0x11,
+  0xf4, 0x92, 0x03, 0xf7, 0x48, 0x28, 0xaa, 0x17, 0xfa, 0x43, 0xc0, 0x16,
+  0x44, 0x4b, 0xc5, 0x54, 0x12, 0x3b, 0x3c, 0xca, 0xc8, 0xc5, 0x68, 0xcc,
+  0x99, 0x81, 0x20, 0x1c, 0x09, 0xc2, 0x1b, 0xc9, 0x46, 0xfc, 0x2b, 0x31,
+  0x68, 0xd3, 0x19, 0xa6, 0xcc, 0x6e, 0x52, 0xfb, 0x29, 0xaf, 0xb9, 0xdb,
+  0x75, 0xe1, 0x2f, 0x4f, 0xda, 0x4f, 0x1f, 0xb6, 0x57, 0x96, 0x62, 0xc0,
+  0x30, 0xec, 0x5f, 0x79, 0xb4, 0x26, 0x8c, 0x49, 0xa8, 0x1e, 0x7b, 0x20,
+  0x86, 0xcc, 0xe0, 0xfb, 0x8c, 0x30, 0x23, 0x64, 0xf4, 0xa0, 0x69, 0x3e,
+  0x44, 0x49, 0x00, 0xd2, 0x2d, 0xe6, 0x65, 0xe7, 0xee, 0x13, 0x74, 0x04,
+  0x8a, 0x06, 0xd0, 0xfc, 0x36, 0x8b, 0xf5, 0xb5, 0x93, 0x09, 0xb3, 0xa4,
+  0xf2, 0x0f, 0x5d, 0x56, 0xed, 0x2e, 0xe6, 0x15, 0xcb, 0x89, 0x25, 0x47,
+  0xcb, 0x68, 0x12, 0xcb, 0x64, 0xbb, 0x90, 0x69, 0x25, 0x5a, 0xcd, 0xae,
+  0x16, 0xac, 0xef, 0xd7, 0x66, 0x91, 0x83, 0x39, 0xc1, 0x08, 0x32, 0x69,
+  0x2a, 0x21, 0x67, 0x8f, 0xd6, 0x16, 0x9d, 0xb9, 0x59, 0xbc, 0x26, 0xd4,
+  0xa3, 0x1b, 0x03, 0x32, 0x22, 0xa4, 0x02, 0x87, 0x12, 0x1a, 0xca, 0xd6,
+  0x09, 0xa7, 0xe5, 0x6b, 0x4c, 0x96, 0x00, 0x7b, 0x27, 0x4b, 0xea, 0x57,
+  0x5e, 0x83, 0x16, 0xc5, 0xf2, 0xa1, 0xfb, 0x88, 0x4b, 0x4f, 0xe3, 0x40,
+  0xe3, 0x0c, 0xfc, 0x14, 0xb8, 0x80, 0x8a, 0x7e, 0xf7, 0xed, 0xb7, 0xbc,
+  0x1b, 0x28, 0xde, 0x82, 0xb0, 0x52, 0xe7, 0xd8, 0x67, 0xd8, 0x30, 0x83,
+  0x24, 0x10, 0x54, 0x1b, 0x67, 0x27, 0x97, 0x81, 0x59, 0xb1, 0x90, 0x20,
+  0xb1, 0x01, 0xc8, 0x88, 0x31, 0x8a, 0xe8, 0xac, 0x68, 0x34, 0x2f, 0x43,
+  0x6f, 0x45, 0xb8, 0xda, 0x2b, 0xf5, 0x55, 0xc7, 0xd4, 0x34, 0x62, 0xba,
+  0x61, 0x45, 0x6a, 0xa0, 0x37, 0x8e, 0x71, 0xf2, 0x0e, 0x0c, 0x0c, 0xc7,
+  0xae, 0x56, 0xd7, 0xcd, 0x17, 0x27, 0x41, 0x12, 0x5a, 0x15, 0x43, 0xbb,
+  0x18, 0x0a, 0x0c, 0x81, 0x2e, 0xe6, 0xc2, 0xb8, 0xb0, 0xb0, 0x0c, 0xe1,
+  0x86, 0x79, 0xb6, 0xd8, 0x2d, 0x4f, 0x11, 0xa6, 0x4e, 0x41, 0x44, 0x3e,
+  0x40, 0x6b, 0x77, 0xef, 0x70, 0xeb, 0x39, 0x65, 0x61, 0x1a, 0x84, 0x08,
+  0x16, 0xb8, 0xc5, 0xe0, 0x17, 0x99, 0xdc, 0xd1, 0x34, 0x9e, 0x70, 0x57,
+  0xca, 0x87, 0x8a, 0x8b, 0x24, 0xd1, 0x5f, 0x9a, 0xcb, 0x3c, 0x23, 0x76,
+  0xb8, 0x4d, 0x38, 0xce, 0x41, 0x01, 0x24, 0x08, 0x20, 0xd1, 0x63, 0xe1,
+  0x1e, 0x1d, 0x9c, 0x30, 0xfe, 0xd2, 0x49, 0x01, 0x45, 0x77, 0x81, 0x93,
+  0x0c, 0x8c, 0x64, 0x82, 0x34, 0x81, 0x8c, 0x2e, 0xf6, 0x8b, 0x59, 0x8d,
+  0x6b, 0xe7, 0xc5, 0x14, 0xcc, 0xc9, 0x21, 0x55, 0x85, 0xcc, 0xc2, 0x5d,
+  0x95, 0x0f, 0x25, 0x36, 0x68, 0xba, 0xda, 0xa4, 0x05, 0xc9, 0x8f, 0x13,
+  0xb7, 0xba, 0x24, 0xd4, 0xc6, 0x14, 0xc0, 0x05, 0x57, 0xa0, 0x5e, 0x9a,
+  0xec, 0x46, 0xcf, 0xf2, 0xa4, 0x4f, 0x16, 0x04, 0x84, 0xba, 0xc5, 0x58,
+  0x3e, 0x92, 0xca, 0x25, 0xe8, 0x68, 0xf6, 0x75, 0x1d, 0xc1, 0xb3, 0x03,
+  0x43, 0x54, 0x8b, 0xe3, 0x09, 0x45, 0x25, 0x90, 0xe4, 0x2e, 0x17, 0x01,
+  0x46, 0x15, 0x3e, 0x23, 0x5e, 0x94, 0x93, 0xbe, 0x12, 0x2e, 0x13, 0xf5,
+  0x00, 0x59, 0x61, 0xed, 0xac, 0x63, 0x7a, 0x0a, 0x7b, 0xd1, 0x28, 0x64,
+  0x7a, 0x8e, 0x5e, 0x95, 0x9a, 0x96, 0x4d, 0xa9, 0x65, 0xd9, 0x04, 0x26,
+  0x50, 0x98, 0x49, 0xc1, 0x5e, 0x93, 0x83, 0xb0, 0xb0, 0xbd, 0x2a, 0x73,
+  0xe5, 0x65, 0x24, 0x4e, 0x29, 0x23, 0xb9, 0x63, 0x2e, 0x30, 0xc7, 0xa7,
+  0x31, 0x54, 0x89, 0x70, 0x96, 0x8f, 0xca, 0xae, 0xda, 0xaf, 0x92, 0x42,
+  0xbb, 0x31, 0x2d, 0x44, 0x4a, 0x3d, 0x30, 0x76, 0x83, 0xc8, 0x18, 0x5e,
+  0xc4, 0xe3, 0x10, 0xe3, 0xb9, 0x04, 0xb4, 0x19, 0xdb, 0xd0, 0x2f, 0x7f,
+  0x0b, 0x22, 0x88, 0x08, 0x6e, 0xf9, 0xc5, 0x80, 0x18, 0x7c, 0xaf, 0xe7,
+  0xba, 0xa9, 0x92, 0x82, 0xe6, 0x73, 0x60, 0x3a, 0xae, 0x99, 0x93, 0xfc,
+  0xe4, 0xbc, 0xb0, 0x09, 0x28, 0x46, 0xb1, 0x1b, 0x3c, 0x5d, 0x3e, 0x47,
+  0x94, 0x28, 0xaf, 0x33, 0xd8, 0xe4, 0xcf, 0x5a, 0x87, 0x54, 0x58, 0x53,
+  0xc1, 0x33, 0x39, 0x21, 0x8a, 0xc0, 0x01, 0xa5, 0xc6, 0x53, 0x53, 0x0a,
+  0x8d, 0x06, 0x36, 0x49, 0xf6, 0x81, 0x70, 0xa8, 0x74, 0x3b, 0x71, 0x56,
+  0x2e, 0xaa, 0x33, 0x6d, 0x8f, 0x53, 0x04, 0x2e, 0x08, 0x07, 0xf0, 0x2c,
+  0x19, 0xc9, 0x93, 0xf6, 0x93, 0x47, 0x71, 0x28, 0x94, 0x5d, 0xa0, 0x0a,
+  0x20, 0xbd, 0x16, 0xa6, 0x5c, 0x8c, 0x80, 0x7c, 0x41, 0xdf, 0xb0, 0x47,
+  0x55, 0x46, 0x13, 0x97, 0xed, 0xb6, 0xc6, 0x94, 0xb3, 0x1e, 0xb1, 0xb3,
+  0x90, 0x6e, 0x6d, 0x69, 0x96, 0xac, 0x2c, 0x17, 0xb9, 0x47, 0x43, 0x75,
+  0x68, 0xd7, 0x99, 0xa4, 0xbb, 0x30, 0x06, 0x80, 0xcb, 0x84, 0x16, 0xaf,
+  0xfc, 0x9c, 0xc0, 0x39, 0x12, 0x83, 0x2a, 0xd5, 0x4f, 0xce, 0x17, 0x8a,
+  0xa1, 0xf6, 0xc8, 0xed, 0x37, 0xe0, 0x92, 0x15, 0xe0, 0x74, 0xa9, 0xba,
+  0xee, 0xc1, 0x66, 0x24, 0x23, 0xc1, 0x60, 0x96, 0x24, 0x01, 0x9c, 0xf0,
+  0x73, 0x18, 0xd4, 0x6b, 0x20, 0x54, 0x03, 0x97, 0x37, 0x93, 0xdf, 0x0c,
+  0xfc, 0x97, 0x22, 0x62, 0xd8, 0xb0, 0x68, 0xe1, 0x91, 0x99, 0x74, 0x5f,
+  0x4e, 0xc7, 0xc3, 0xa3, 0xb0, 0x71, 0xa3, 0x9b, 0x23, 0x0a, 0x67, 0xd4,
+  0xf5, 0xd0, 0x2c, 0xde, 0x0c, 0xd0, 0xbf, 0x3c, 0x23, 0x3e, 0xb3, 0x94,
+  0xfa, 0x4e, 0xea, 0x04, 0xc7, 0xdf, 0xf4, 0x06, 0x6c, 0xfa, 0x1d, 0xb0,
+  0x7c, 0x27, 0xb3, 0x11, 0x64, 0x59, 0x02, 0x77, 0x48, 0xdd, 0xc6, 0x5e,
+  0xa8, 0xd2, 0xae, 0xa4, 0xb8, 0x77, 0xd8, 0x44, 0x15, 0x97, 0x24, 0xb9,
+  0x84, 0xc5, 0x7a, 0xbf, 0xb3, 0x0f, 0x6c, 0xee, 0x2c, 0xc4, 0x11, 0x61,
+  0x73, 0x02, 0xb3, 0x0a, 0x70, 0x14, 0x0d, 0xd7, 0x67, 0xdf, 0x18, 0x3b,
+  0x1e, 0x7d, 0x24, 0x73, 0x1a, 0x30, 0xaf, 0x9e, 0x82, 0x06, 0x77, 0xdb,
+  0xd0, 0xbc, 0x11, 0x9a, 0xdc, 0x31, 0x39, 0x5a, 0xd3, 0x6c, 0x86, 0xac,
+  0xa1, 0x22, 0x21, 0xf9, 0x78, 0xfe, 0x20, 0xf4, 0x88, 0x03, 0xca, 0x57,
+  0x22, 0xde, 0x31, 0x48, 0x14, 0xbf, 0x30, 0x7b, 0xce, 0x76, 0xf4, 0x64,
+  0x08, 0xc1, 0x29, 0x59, 0x85, 0x23, 0x0d, 0x9a, 0xdd, 0xe0, 0xe0, 0xd8,
+  0xc1, 0xf1, 0x3f, 0x48, 0x9a, 0x92, 0x54, 0xf0, 0x70, 0x98, 0x21, 0xd6,
+  0x9a, 0x64, 0x6a, 0x81, 0x6a, 0x51, 0xb2, 0xb5, 0x45, 0x88, 0x94, 0xff,
+  0x36, 0x42, 0xfb, 0x39, 0x28, 0x16, 0xb2, 0x4f, 0x8d, 0xf2, 0x1b, 0x42,
+  0xf9, 0x47, 0x20, 0x9a, 0xc6, 0x45, 0x41, 0x86, 0x25, 0xf4, 0xcd, 0x39,
+  0x33, 0x33, 0x5a, 0xb8, 0x9b, 0x80, 0x18, 0x19, 0x00, 0x55, 0xf4, 0xc1,
+  0x2b, 0x9a, 0xe1, 0x14, 0xfb, 0x93, 0x48, 0x4d, 0xec, 0xaa, 0xee, 0x25,
+  0x0c, 0xc3, 0x0e, 0x34, 0x29, 0x74, 0x1d, 0x84, 0xb0, 0x62, 0x44, 0x7d,
+  0x37, 0xcd, 0xcb, 0x87, 0xbc, 0x32, 0xa4, 0xa7, 0xf3, 0x70, 0x48, 0xcc,
+  0xc8, 0xc3, 0xa4, 0x28, 0x86, 0xed, 0x52, 0x5c, 0x35, 0x57, 0x25, 0x72,
+  0xde, 0xb6, 0xae, 0x09, 0x64, 0x90, 0xe3, 0x1c, 0x27, 0xc3, 0x9e, 0x60,
+  0x7f, 0xc9, 0xb0, 0x99, 0x63, 0xd2, 0x91, 0xa4, 0x15, 0x38, 0x1b, 0x0d,
+  0x26, 0x10, 0x65, 0x3d, 0x52, 0x43, 0xbc, 0x30, 0x99, 0x6f, 0x50, 0xe0,
+  0x0f, 0xa7, 0x6d, 0x0a, 0xde, 0x18, 0xa6, 0xc7, 0xb1, 0xb0, 0xa2, 0x23,
+  0x46, 0xe1, 0x0d, 0x1b, 0x85, 0xb5, 0x6c, 0xbb, 0xe2, 0xe4, 0x47, 0x9e,
+  0x41, 0x39, 0x0e, 0xe5, 0x36, 0x8f, 0x23, 0x3f, 0x58, 0xec, 0x84, 0x9f,
+  0xe7, 0x14, 0xa9, 0xb3, 0x86, 0xfe, 0x20, 0x79, 0x97, 0x73, 0x11, 0x87,
+  0x40, 0xa1, 0x73, 0xc3, 0x3c, 0xc3, 0x39, 0x5a, 0xac, 0x62, 0x59, 0xb4,
+  0x5a, 0xd7, 0xe0, 0xe9, 0xd3, 0xec, 0x11, 0x3d, 0xa2, 0x43, 0xea, 0x8f,
+  0xbb, 0x93, 0x59, 0xe0, 0xd2, 0x89, 0x63, 0x5b, 0xe4, 0x14, 0x86, 0xd0,
+  0x02, 0xfc, 0x00, 0x4b, 0x1c, 0x71, 0x8f, 0x23, 0xbf, 0xb9, 0xb7, 0xbb,
+  0xbb, 0xb5, 0x79, 0x68, 0x99, 0xaf, 0xbe, 0xe7, 0x68, 0xbc, 0xe2, 0x0d,
+  0x0f, 0x9f, 0x59, 0x44, 0x80, 0xf5, 0x6b, 0x8c, 0xb6, 0x77, 0x93, 0x18,
+  0x65, 0x6a, 0xb4, 0x3f, 0x4d, 0xfc, 0xf1, 0xbe, 0xcf, 0xde, 0x17, 0x37,
+  0x15, 0xc5, 0x56, 0xd0, 0xb6, 0x67, 0x0d, 0x77, 0x78, 0x82, 0x66, 0xef,
+  0x63, 0x85, 0x03, 0xaf, 0x5f, 0x89, 0x87, 0x0c, 0x36, 0xa9, 0xa3, 0x72,
+  0xa8, 0xe3, 0xdb, 0xde, 0x47, 0x94, 0x19, 0x8a, 0x9c, 0xa9, 0x82, 0x26,
+  0x80, 0xd6, 0x09, 0x7c, 0xb5, 0xd3, 0x11, 0x49, 0x38, 0xe8, 0xa2, 0x98,
+  0x9a, 0xbf, 0x81, 0x5b, 0x6a, 0x0d, 0x11, 0x37, 0xe2, 0xf6, 0xfe, 0xe5,
+  0x43, 0xda, 0x25, 0xf2, 0x70, 0xb4, 0x93, 0xce, 0x49, 0xca, 0xd0, 0xee,
+  0xb9, 0x2b, 0x58, 0x20, 0xa3, 0xb9, 0x85, 0x3a, 0x4c, 0xfb, 0x83, 0x8c,
+  0x1c, 0x3b, 0xd3, 0xf6, 0xa4, 0x54, 0xb1, 0x5f, 0x6a, 0xc1, 0x50, 0x66,
+  0xd1, 0x41, 0x36, 0xd6, 0xf3, 0x46, 0x65, 0x1f, 0x9a, 0xb2, 0xcc, 0xeb,
+  0x44, 0x74, 0x8d, 0x95, 0x72, 0xb7, 0x7d, 0x18, 0xcf, 0x91, 0x49, 0x52,
+  0xbb, 0x36, 0x38, 0x05, 0x9f, 0x70, 0x02, 0x55, 0x15, 0xe3, 0x78, 0x95,
+  0x70, 0x11, 0x94, 0x60, 0xe0, 0x0e, 0xed, 0xe8, 0x14, 0x75, 0xe2, 0x15,
+  0x2f, 0xac, 0x49, 0x57, 0x26, 0x5e, 0x99, 0x74, 0xc5, 0x86, 0x1e, 0x96,
+  0xaf, 0x42, 0x0b, 0x53, 0x02, 0x16, 0x73, 0xd0, 0xa7, 0xb5, 0x21, 0xf3,
+  0x2a, 0xd5, 0x46, 0x4d, 0xc9, 0x33, 0xfa, 0x0d, 0x97, 0x5d, 0x91, 0xb5,
+  0x91, 0x55, 0xa9, 0x1f, 0x22, 0x6a, 0x49, 0x98, 0x87, 0x3b, 0x43, 0xc7,
+  0xcc, 0x89, 0xdc, 0x09, 0xf6, 0x61, 0xc2, 0xd3, 0x6b, 0xad, 0xeb, 0x4c,
+  0xf4, 0x48, 0xd8, 0x11, 0x39, 0xe6, 0x4f, 0x29, 0x45, 0x39, 0x8a, 0xa6,
+  0x33, 0x00, 0xfb, 0x52, 0xdb, 0x05, 0xd8, 0x41, 0x71, 0x19, 0xe7, 0xe3,
+  0x89, 0x44, 0xb8, 0x6c, 0x77, 0xa0, 0x42, 0x10, 0xeb, 0x92, 0xce, 0x6a,
+  0x72, 0xcc, 0x7a, 0x3a, 0x7d, 0x6d, 0xb4, 0x36, 0x7f, 0xfb, 0x58, 0xce,
+  0x20, 0x31, 0x71, 0x56, 0x7c, 0x23, 0x17, 0xab, 0x9d, 0x66, 0x6e, 0x8d,
+  0xf8, 0xce, 0x54, 0x5b, 0xf8, 0x90, 0xf0, 0x0c, 0x25, 0xc4, 0x49, 0x80,
+  0x20, 0x34, 0x67, 0x85, 0xb2, 0x6a, 0xe9, 0xa1, 0x9b, 0x06, 0x87, 0x64,
+  0x91, 0x7f, 0x26, 0xb4, 0xc0, 0x51, 0x19, 0x8b, 0xa9, 0xe1, 0x54, 0xc7,
+  0x1e, 0x08, 0x9c, 0x24, 0x3f, 0x5d, 0x6c, 0x0f, 0x26, 0xe6, 0x74, 0x45,
+  0x90, 0x0e, 0x85, 0x2a, 0xf4, 0xb5, 0x72, 0x7d, 0xd4, 0x0b, 0x59, 0x15,
+  0x03, 0x2d, 0xe7, 0x00, 0x38, 0xff, 0xbd, 0x18, 0x0d, 0x44, 0x17, 0xbb,
+  0x55, 0xf4, 0x13, 0x5d, 0x56, 0xc5, 0x3b, 0x48, 0x1f, 0xdf, 0xf3, 0x4d,
+  0x0a, 0xdd, 0x23, 0xe8, 0x24, 0x19, 0x10, 0x7c, 0x58, 0x6c, 0x8a, 0xb7,
+  0xb9, 0x1b, 0x94, 0x33, 0x0a, 0x88, 0xa0, 0x63, 0xd2, 0xa2, 0x4b, 0xc2,
+  0x26, 0xb4, 0x42, 0x11, 0x1f, 0xd8, 0xfe, 0x60, 0x0f, 0xd9, 0x5d, 0x1a,
+  0xa1, 0x12, 0xe7, 0xd8, 0xe6, 0xf9, 0xed, 0xb7, 0x0d, 0x81, 0x28, 0xf6,
+  0xb0, 0x0c, 0x5a, 0x60, 0x8c, 0x05, 0x9a, 0x99, 0xf2, 0x4c, 0x68, 0x21,
+  0x15, 0x68, 0xc2, 0x9e, 0xf0, 0x88, 0x1b, 0x52, 0xd6, 0x0d, 0x11, 0x3b,
+  0x44, 0xb4, 0x71, 0x54, 0xf0, 0xd0, 0xab, 0x5c, 0x43, 0x12, 0x50, 0xd4,
+  0xf4, 0x89, 0x22, 0x2b, 0x2a, 0xe2, 0x44, 0x02, 0x0e, 0xe4, 0x9b, 0x2c,
+  0xab, 0x89, 0x37, 0x51, 0xbe, 0x49, 0x78, 0x0a, 0x9b, 0x66, 0xe6, 0xcd,
+  0x5a, 0x7f, 0x7d, 0x73, 0x54, 0x55, 0x3d, 0xba, 0x25, 0xca, 0xd3, 0x9b,
+  0x23, 0xce, 0xf0, 0xb3, 0x3b, 0x92, 0xff, 0x94, 0x30, 0x5f, 0x70, 0x07,
+  0x76, 0x44, 0xf3, 0x8b, 0x24, 0xe6, 0x91, 0x47, 0x2c, 0xfc, 0x59, 0xd0,
+  0x00, 0x3c, 0x0b, 0xa2, 0x09, 0x53, 0x93, 0xea, 0x78, 0xb2, 0x9b, 0xc6,
+  0x74, 0x91, 0x36, 0x79, 0x14, 0xd4, 0x8b, 0x88, 0x78, 0xdf, 0xf8, 0x34,
+  0xdb, 0x14, 0xe6, 0xa2, 0x41, 0xa1, 0x9d, 0x0c, 0x18, 0x46, 0x92, 0xf0,
+  0xfd, 0x01, 0x28, 0xac, 0xca, 0x56, 0x95, 0xf8, 0x2c, 0xc2, 0x3d, 0x92,
+  0x21, 0x6b, 0xc2, 0xfc, 0x62, 0xd3, 0xc5, 0x68, 0x66, 0x2b, 0xc4, 0x04,
+  0x39, 0x25, 0x03, 0xa8, 0xbd, 0x4e, 0x84, 0xec, 0x52, 0x55, 0xa4, 0x0b,
+  0x84, 0xd3, 0x11, 0xf0, 0x5d, 0x63, 0x77, 0x6f, 0xff, 0x60, 0xef, 0xa7,
+  0x9f, 0x1b, 0x24, 0x65, 0x93, 0x53, 0x3d, 0x13, 0x28, 0xdc, 0xae, 0x28,
+  0xa4, 0x0a, 0xa1, 0xab, 0x66, 0x8f, 0xe4, 0x4c, 0x3d, 0x89, 0xcb, 0xad,
+  0x87, 0xfe, 0x48, 0x92, 0x9f, 0x10, 0xd3, 0x4a, 0xc4, 0xe6, 0xef, 0x00,
+  0x16, 0x3c, 0xc0, 0x12, 0x0d, 0x20, 0xa7, 0xd5, 0xea, 0x0d, 0x0c, 0x9d,
+  0x65, 0xa0, 0x26, 0x32, 0xc8, 0x21, 0xca, 0x46, 0x16, 0x07, 0x5a, 0x2f,
+  0x96, 0x7c, 0x51, 0xd7, 0x2d, 0x7c, 0x03, 0xed, 0x27, 0xdc, 0x40, 0x0c,
+  0x09, 0x18, 0x7e, 0x8f, 0x44, 0x88, 0xf8, 0x22, 0x19, 0x3f, 0xf3, 0x0d,
+  0x64, 0x5e, 0xe5, 0x36, 0xc8, 0xec, 0x0a, 0xa0, 0x4b, 0x70, 0x0c, 0x9c,
+  0xd1, 0x75, 0x17, 0x41, 0x8c, 0x19, 0x00, 0xc0, 0x78, 0xc3, 0x01, 0xff,
+  0xf9, 0xdc, 0x04, 0xb4, 0x29, 0xdd, 0x32, 0x3d, 0xee, 0x8f, 0xfd, 0x8a,
+  0x90, 0x06, 0xe2, 0xae, 0x7f, 0x51, 0x49, 0x82, 0x14, 0xa0, 0x42, 0x40,
+  0x72, 0x01, 0xdf, 0x7a, 0x03, 0x87, 0x69, 0xd3, 0xf5, 0xff, 0xd1, 0x1b,
+  0x5f, 0x3a, 0xf4, 0x57, 0xbe, 0x74, 0xf9, 0xb9, 0x77, 0xbe, 0x5e, 0x3d,
+  0x5f, 0x50, 0xba, 0x34, 0xe2, 0x5d, 0x04, 0x17, 0x27, 0x8b, 0x0f, 0xb9,
+  0xd0, 0xfb, 0x80, 0x3d, 0x30, 0x49, 0x36, 0x82, 0x92, 0x30, 0x86, 0xb1,
+  0xf5, 0x0d, 0x38, 0x3d, 0x83, 0x91, 0xce, 0x16, 0x29, 0x09, 0x5e, 0x70,
+  0xec, 0x04, 0x16, 0x20, 0xfa, 0xc4, 0x97, 0x34, 0x10, 0x51, 0xcf, 0xdc,
+  0x6d, 0x92, 0x20, 0x25, 0x34, 0x1f, 0x29, 0x5c, 0xab, 0x76, 0x85, 0x54,
+  0x6e, 0xb2, 0x6b, 0x4c, 0xfa, 0xcc, 0x25, 0x5c, 0x0e, 0x25, 0xdf, 0x69,
+  0xfa, 0x06, 0xce, 0xbb, 0xe9, 0xe3, 0x62, 0xec, 0xa0, 0x1c, 0x69, 0x59,
+  0x6a, 0x2a, 0x21, 0xb0, 0x1c, 0x53, 0x7c, 0x69, 0x75, 0x74, 0x15, 0x80,
+  0x75, 0x8e, 0x98, 0x5d, 0x2e, 0x21, 0x2b, 0x2a, 0x84, 0x1f, 0x97, 0x58,
+  0xe4, 0x67, 0x8d, 0xca, 0x06, 0xa5, 0x69, 0xc4, 0x36, 0xa0, 0x99, 0x2d,
+  0xa9, 0x80, 0x70, 0x67, 0x53, 0x71, 0x7a, 0xde, 0x35, 0x95, 0x08, 0x72,
+  0xbe, 0x4d, 0x46, 0x12, 0xbf, 0x6f, 0x93, 0x56, 0xbd, 0x23, 0x59, 0x2e,
+  0xb4, 0x44, 0xe1, 0x59, 0x7f, 0x76, 0xb9, 0x02, 0xab, 0xee, 0x4e, 0xed,
+  0x63, 0x4e, 0xbe, 0xda, 0xb3, 0xb8, 0x38, 0xfc, 0x98, 0x33, 0xad, 0x04,
+  0x3e, 0x5d, 0x4d, 0x46, 0x12, 0x16, 0xae, 0x35, 0x3c, 0xe0, 0xee, 0xa4,
+  0x7c, 0x46, 0x79, 0xab, 0x9d, 0xbd, 0xc4, 0x5c, 0x86, 0xc8, 0x5f, 0xa4,
+  0x28, 0xcd, 0xb4, 0xd7, 0x74, 0x1d, 0xb4, 0x4f, 0xad, 0xe3, 0x51, 0xef,
+  0xf2, 0xee, 0x3e, 0xf9, 0xad, 0x3b, 0x7a, 0xbc, 0xed, 0x4e, 0x93, 0x2b,
+  0x4d, 0xf5, 0x08, 0xba, 0xbe, 0xf8, 0xf6, 0xf2, 0x06, 0xc9, 0xe9, 0xab,
+  0x4b, 0x4e, 0x87, 0xbb, 0xbd, 0x6e, 0xbd, 0xbc, 0x68, 0x33, 0xa6, 0x6f,
+  0x2e, 0x76, 0x90, 0xa5, 0xe2, 0x8c, 0xc8, 0x33, 0xb3, 0x05, 0x1a, 0x2f,
+  0xd1, 0x78, 0xe7, 0x1c, 0x1d, 0x1c, 0x75, 0xcf, 0xcd, 0x10, 0xa6, 0x1e,
+  0xbb, 0xeb, 0x9d, 0xbd, 0xd4, 0x5f, 0xb8, 0x4f, 0x4b, 0x56, 0xe3, 0x40,
+  0xa3, 0x52, 0x6b, 0x51, 0x1b, 0x28, 0x92, 0x73, 0x15, 0xaa, 0xc9, 0x94,
+  0x5b, 0x08, 0xb7, 0x99, 0x84, 0x21, 0x8b, 0xdf, 0x9c, 0x3f, 0x51, 0xa4,
+  0x2b, 0x2e, 0x97, 0x7a, 0xeb, 0x64, 0x88, 0x83, 0x7d, 0x60, 0xb7, 0xef,
+  0x1f, 0x35, 0x5b, 0xb2, 0xd6, 0x36, 0xc8, 0xde, 0x1c, 0x6e, 0x6a, 0xaa,
+  0x12, 0x9b, 0x55, 0xc9, 0xd7, 0x7d, 0x4a, 0x1f, 0x2c, 0x2e, 0x35, 0x14,
+  0xa6, 0x4d, 0xeb, 0x53, 0xce, 0x1d, 0x6e, 0xbf, 0xde, 0xca, 0xf6, 0xde,
+  0x1c, 0x52, 0xa9, 0x9b, 0xef, 0xf7, 0x0e, 0x5e, 0x6f, 0x1c, 0xb2, 0xeb,
+  0x37, 0x81, 0x71, 0x4f, 0xee, 0xf2, 0xd5, 0xc7, 0xe9, 0x78, 0x8e, 0x82,
+  0x24, 0x58, 0xd3, 0xec, 0xf1, 0x39, 0x70, 0xfc, 0x84, 0x22, 0x2b, 0x01,
+  0xaf, 0x1e, 0x0f, 0x06, 0xef, 0x33, 0x67, 0x2c, 0x13, 0x34, 0x0a, 0x2a,
+  0xb5, 0x5a, 0xf6, 0x94, 0x25, 0x06, 0x72, 0x5c, 0xee, 0x74, 0x7e, 0x5c,
+  0x2e, 0xc6, 0x27, 0x56, 0xf8, 0x7d, 0x39, 0x62, 0xf2, 0x09, 0x30, 0x27,
+  0xe3, 0x77, 0xca, 0xbd, 0xc5, 0x08, 0xfe, 0xc6, 0xbf, 0x2d, 0x0c, 0xa1,
+  0xed, 0xc7, 0x59, 0x1b, 0x24, 0x8f, 0x31, 0x43, 0xca, 0x8f, 0x8c, 0xd1,
+  0x86, 0x18, 0x47, 0x98, 0x0c, 0x10, 0x7d, 0x1e, 0x6e, 0xee, 0x47, 0x25,
+  0xbb, 0x56, 0xeb, 0x0b, 0xa3, 0x20, 0x29, 0x44, 0xac, 0x13, 0x74, 0x0c,
+  0x66, 0x0f, 0x86, 0x44, 0xa5, 0x5e, 0xe8, 0x6a, 0x32, 0x4c, 0xc7, 0x93,
+  0xac, 0x19, 0xa0, 0xb8, 0x6c, 0xc5, 0xdc, 0x82, 0xb9, 0xe1, 0x24, 0x31,
+  0xc4, 0xc8, 0x38, 0xbd, 0xb5, 0xcf, 0x61, 0x18, 0x9d, 0x72, 0x48, 0xdf,
+  0xab, 0xf5, 0x13, 0x11, 0x5a, 0x6a, 0xbd, 0xc0, 0x0a, 0x03, 0x5c, 0x0c,
+  0x04, 0xda, 0x01, 0xc0, 0x92, 0x2c, 0x57, 0x12, 0x96, 0x0a, 0x87, 0xcf,
+  0x45, 0x79, 0x32, 0x1a, 0xc8, 0xd0, 0x6b, 0x14, 0xb3, 0x52, 0xa3, 0x98,
+  0x21, 0x29, 0x62, 0xd3, 0xe3, 0xf8, 0x8c, 0xd9, 0x73, 0x40, 0xc6, 0x5c,
+  0xe2, 0x88, 0x23, 0x93, 0xcd, 0x04, 0x21, 0x7a, 0x08, 0xb4, 0x53, 0x58,
+  0xa2, 0x33, 0x4a, 0xf4, 0xb4, 0x13, 0x6b, 0x11, 0xb8, 0x9c, 0xbe, 0x38,
+  0x17, 0x86, 0xd4, 0x72, 0x49, 0x87, 0xf0, 0x16, 0x59, 0xd6, 0x18, 0xc3,
+  0x06, 0x46, 0xf8, 0x08, 0x45, 0x57, 0xd5, 0xb8, 0x74, 0x1c, 0x6d, 0xc8,
+  0xde, 0x31, 0xad, 0x42, 0x85, 0x0b, 0xb2, 0x86, 0x51, 0x02, 0x45, 0xef,
+  0xb2, 0xb6, 0x1b, 0x81, 0x89, 0x4e, 0x8a, 0xa9, 0xe9, 0xdb, 0xec, 0x13,
+  0xef, 0x0a, 0xa6, 0x85, 0x17, 0xba, 0x9a, 0x58, 0x0d, 0x20, 0xa3, 0xd1,
+  0xa4, 0xdf, 0xd6, 0x10, 0x3c, 0xa4, 0x25, 0x0a, 0x0a, 0xf5, 0x44, 0x36,
+  0x36, 0x42, 0xc1, 0x9b, 0x44, 0x1b, 0x18, 0xf7, 0x30, 0xc6, 0xdd, 0x40,
+  0xb4, 0x45, 0xc4, 0x22, 0xa9, 0x73, 0xb8, 0x70, 0x2d, 0x16, 0x55, 0x2a,
+  0x79, 0x69, 0xbf, 0xa7, 0x0c, 0x2c, 0x4a, 0x39, 0x5b, 0x81, 0xcb, 0x07,
+  0x0a, 0xe0, 0xeb, 0xbb, 0x12, 0x33, 0x28, 0xfa, 0x83, 0xf0, 0xed, 0x05,
+  0x52, 0x3a, 0x0a, 0xf9, 0x88, 0x04, 0xae, 0x5e, 0xd6, 0x2b, 0x2f, 0x30,
+  0x68, 0x5a, 0x3c, 0x0e, 0xf5, 0x41, 0x6a, 0x7f, 0xaa, 0x98, 0xad, 0xae,
+  0xd5, 0x68, 0x45, 0x07, 0x3e, 0x7d, 0x6c, 0x67, 0xf3, 0x16, 0xc9, 0x48,
+  0x8d, 0x8a, 0x46, 0xc9, 0xb1, 0x4a, 0xc5, 0xb0, 0x42, 0x1f, 0x56, 0xf8,
+  0x82, 0x35, 0x50, 0x3e, 0x83, 0x4d, 0x63, 0x34, 0x4d, 0x68, 0xbc, 0x69,
+  0x1d, 0xd2, 0xb8, 0x0f, 0x64, 0xf0, 0x11, 0xe0, 0x56, 0x21, 0xbf, 0x7e,
+  0xde, 0x93, 0xaf, 0xc5, 0x9f, 0xcb, 0x14, 0x28, 0x66, 0x15, 0xca, 0xc6,
+  0x4d, 0x66, 0xd1, 0xa8, 0xc1, 0x3d, 0xf0, 0x31, 0x95, 0x74, 0x22, 0x5c,
+  0xb4, 0xa5, 0x00, 0xf8, 0x9b, 0x0d, 0xdb, 0xcd, 0xa3, 0x4a, 0x08, 0x08,
+  0x7d, 0xdc, 0x7a, 0x8e, 0x92, 0xc5, 0x99, 0xc9, 0xd4, 0x92, 0x63, 0x34,
+  0x82, 0xd0, 0x8d, 0x23, 0xce, 0x1a, 0x2a, 0xdb, 0xce, 0x54, 0x00, 0xd3,
+  0xe3, 0x52, 0x3f, 0xbe, 0x1c, 0x6a, 0x83, 0x34, 0x16, 0x66, 0xde, 0x18,
+  0x7f, 0xcc, 0xc1, 0x43, 0x62, 0x1d, 0xfb, 0x8d, 0x83, 0xd8, 0x4d, 0x27,
+  0x43, 0xe2, 0x2a, 0x58, 0x04, 0x49, 0xe6, 0x03, 0xa1, 0x30, 0x95, 0x10,
+  0x67, 0x1d, 0x0b, 0xb1, 0x47, 0x21, 0x7c, 0x22, 0x56, 0x35, 0x24, 0x0e,
+  0xe5, 0x0e, 0x58, 0xaf, 0x3a, 0x2a, 0xf2, 0xa0, 0x33, 0x90, 0x78, 0x68,
+  0xc2, 0xd6, 0xdd, 0x12, 0x6c, 0x98, 0xf5, 0xe1, 0x4e, 0xe7, 0x72, 0xb5,
+  0xbd, 0x9e, 0xe1, 0xd5, 0x4c, 0xa0, 0x93, 0x0e, 0xe1, 0x5a, 0x26, 0x13,
+  0xfb, 0x0a, 0x2b, 0x75, 0x25, 0x1e, 0xb4, 0x32, 0x61, 0x57, 0x39, 0xfb,
+  0x62, 0x58, 0xc9, 0x66, 0x7e, 0x91, 0x33, 0xa6, 0x9e, 0xd6, 0x23, 0xa7,
+  0x41, 0x90, 0xfb, 0x87, 0xd0, 0x56, 0xf2, 0x2e, 0x87, 0x06, 0x8f, 0x8a,
+  0x7f, 0x58, 0xae, 0x93, 0xcb, 0x59, 0x54, 0x4c, 0x67, 0x1a, 0xa6, 0x1b,
+  0x06, 0x62, 0x0b, 0xe7, 0x14, 0xf3, 0x94, 0x42, 0x3c, 0x13, 0xaf, 0xb6,
+  0x07, 0x9a, 0x6b, 0xb4, 0x5a, 0x61, 0xfa, 0x2d, 0x9b, 0x7e, 0xe3, 0xce,
+  0x33, 0x26, 0x5a, 0xb8, 0x94, 0x86, 0x70, 0x46, 0xf8, 0x02, 0xca, 0xfd,
+  0xed, 0x46, 0x2a, 0x62, 0xfb, 0xa9, 0xce, 0x25, 0xca, 0x96, 0x82, 0xe5,
+  0x8f, 0xef, 0xd1, 0x64, 0x18, 0x4b, 0xda, 0x22, 0xa5, 0xd8, 0x9a, 0x9f,
+  0x93, 0x50, 0x4e, 0xff, 0x54, 0x6b, 0x0a, 0xc5, 0xaa, 0x2d, 0x46, 0x70,
+  0x6f, 0x2e, 0xba, 0xa9, 0x85, 0x01, 0x22, 0xf6, 0x3a, 0x6b, 0xa4, 0xda,
+  0x74, 0xea, 0x35, 0x9a, 0x6a, 0x5e, 0x80, 0x13, 0xb4, 0x75, 0xf9, 0xf3,
+  0xcf, 0x0d, 0x99, 0x24, 0x08, 0xb3, 0x9d, 0x93, 0x34, 0xf1, 0xe7, 0x16,
+  0xc0, 0xa9, 0xf8, 0x33, 0x74, 0xfb, 0xd9, 0xed, 0x6d, 0x33, 0xd6, 0xa3,
+  0x7b, 0x5e, 0x22, 0xe8, 0x9d, 0xe1, 0x90, 0xa3, 0x1d, 0x75, 0xed, 0x54,
+  0xcd, 0xa6, 0x9b, 0x15, 0x4a, 0x7a, 0x53, 0x15, 0x6a, 0xfe, 0xe6, 0x41,
+  0x05, 0xc4, 0x17, 0xa9, 0x1e, 0xe4, 0xc6, 0xc1, 0x61, 0xf6, 0x57, 0xfd,
+  0x8f, 0xec, 0x62, 0xf4, 0xf5, 0xc2, 0xc5, 0xfb, 0xa7, 0x96, 0x04, 0x55,
+  0x04, 0xb4, 0xb9, 0xb4, 0xbc, 0xc3, 0x67, 0xb5, 0x77, 0x1a, 0x14, 0x38,
+  0xe0, 0x91, 0x4b, 0x93, 0xfa, 0xf7, 0x17, 0xa2, 0xb1, 0xdf, 0x07, 0xfd,
+  0x22, 0x86, 0x66, 0xd0, 0x5f, 0x14, 0x56, 0xf1, 0x67, 0x46, 0x5c, 0x7c,
+  0xfc, 0xd8, 0x46, 0x57, 0x58, 0xb6, 0x48, 0x8c, 0x75, 0x29, 0xed, 0xc4,
+  0x7a, 0xa9, 0xc3, 0xdf, 0xd4, 0xfa, 0x99, 0x7d, 0x98, 0xef, 0xee, 0xe4,
+  0xd3, 0x7b, 0xa9, 0x1f, 0xf2, 0x59, 0xa7, 0xbc, 0xde, 0xa1, 0xf6, 0xe8,
+  0xba, 0x14, 0xd5, 0xe1, 0x5e, 0x0b, 0x78, 0x8f, 0x83, 0xff, 0x65, 0x56,
+  0x70, 0x36, 0x37, 0xf8, 0xe2, 0x2b, 0x78, 0x37, 0x97, 0xf8, 0x84, 0xb9,
+  0x30, 0xeb, 0xf0, 0x6d, 0xb0, 0x34, 0xa4, 0x8c, 0x83, 0x63, 0x68, 0x95,
+  0x6a, 0x85, 0xf2, 0x22, 0xd7, 0x80, 0x14, 0x1d, 0x9a, 0x55, 0xae, 0x91,
+  0x7d, 0x2e, 0xcf, 0x28, 0x6e, 0x61, 0x1a, 0x5f, 0x7a, 0xe5, 0xee, 0x60,
+  0x26, 0xb3, 0xa9, 0xe0, 0xf3, 0xc8, 0xa0, 0xce, 0x63, 0x66, 0x31, 0x99,
+  0x2f, 0x4c, 0xe2, 0x1f, 0xe7, 0x3b, 0xb7, 0x53, 0x45, 0xc2, 0x89, 0xee,
+  0x9c, 0x5a, 0xd8, 0x52, 0x2f, 0x7d, 0x20, 0xe0, 0xf2, 0xda, 0x3b, 0x35,
+  0xd9, 0x5c, 0xa3, 0xd2, 0x66, 0x33, 0x5b, 0x69, 0xe1, 0x11, 0x30, 0xce,
+  0x37, 0x7d, 0x54, 0xaa, 0x82, 0x5c, 0x83, 0xb2, 0x56, 0x04, 0xa5, 0x51,
+  0xb8, 0xc0, 0x55, 0x6e, 0xcd, 0x22, 0xcf, 0xc4, 0x48, 0x33, 0x18, 0x95,
+  0x41, 0x15, 0xcc, 0xe4, 0x5d, 0x2e, 0x8d, 0x55, 0xf7, 0xcd, 0xa7, 0x72,
+  0xce, 0x74, 0x08, 0xd6, 0x2c, 0x9e, 0xcb, 0x96, 0xeb, 0x68, 0xb1, 0x84,
+  0xe1, 0xbc, 0x16, 0x6d, 0x05, 0x3c, 0x93, 0x39, 0xb8, 0x13, 0x10, 0x6e,
+  0xa5, 0x60, 0xf2, 0xec, 0xcb, 0xc8, 0xd4, 0xc1, 0xf1, 0xbc, 0x6e, 0xb1,
+  0xbc, 0x0e, 0x93, 0x77, 0x11, 0x7a, 0xd1, 0xb0, 0xee, 0xe2, 0xf3, 0x2c,
+  0x50, 0x80, 0x74, 0xf5, 0xa8, 0xc0, 0x90, 0xc5, 0xbe, 0x9d, 0xb5, 0xe0,
+  0x1e, 0x0a, 0x87, 0xd3, 0x2b, 0xcb, 0x96, 0xa6, 0xa6, 0x4e, 0xe0, 0x9b,
+  0x62, 0x9c, 0x99, 0xa5, 0x91, 0x2c, 0x2e, 0xe4, 0xd3, 0x3b, 0x4c, 0x1c,
+  0x9a, 0x65, 0x97, 0x65, 0x61, 0x0d, 0xeb, 0x93, 0x80, 0x3e, 0x56, 0xb9,
+  0x62, 0x1e, 0xa3, 0xf3, 0xbe, 0xba, 0xe0, 0xbe, 0x4c, 0xe1, 0xa1, 0xe6,
+  0xee, 0x1d, 0xde, 0x37, 0x6d, 0x9f, 0x72, 0x05, 0x0d, 0x02, 0x1b, 0x60,
+  0x85, 0x49, 0x70, 0x93, 0x17, 0x60, 0x1f, 0xfb, 0xa3, 0xc1, 0xc2, 0xb1,
+  0xa1, 0x96, 0x64, 0x9a, 0xfe, 0xd3, 0xa0, 0xef, 0x38, 0x32, 0x39, 0xa6,
+  0x84, 0x68, 0x98, 0xab, 0x64, 0x53, 0xdc, 0x96, 0x99, 0xa2, 0x8f, 0x25,
+  0xa9, 0xcd, 0x0c, 0x46, 0x57, 0x29, 0x9c, 0x24, 0xfc, 0x0a, 0x31, 0xd7,
+  0x39, 0x9a, 0x08, 0x72, 0xa9, 0x2f, 0xc8, 0x25, 0x9e, 0x6f, 0x7f, 0xc4,
+  0x01, 0x37, 0x68, 0xf2, 0xfd, 0x02, 0xa7, 0x96, 0x50, 0xca, 0x93, 0xba,
+  0xc6, 0x09, 0x4c, 0xd2, 0x8d, 0x23, 0x0d, 0x10, 0xaf, 0x5c, 0x39, 0x73,
+  0x9f, 0x83, 0xe1, 0x4c, 0x13, 0x6c, 0x1a, 0x60, 0xe3, 0x1e, 0x15, 0xf8,
+  0xee, 0x89, 0xbf, 0xd6, 0xad, 0x18, 0x9b, 0x2c, 0x0d, 0x02, 0x58, 0xb2,
+  0x80, 0xac, 0x56, 0x16, 0x01, 0xce, 0x25, 0xe9, 0xfc, 0x1a, 0xad, 0xee,
+  0x66, 0x96, 0x4c, 0x0c, 0x4a, 0xbf, 0xc5, 0xc9, 0x68, 0x4c, 0xec, 0x42,
+  0xd4, 0xcd, 0x8e, 0x8f, 0xc9, 0x6d, 0x89, 0xf8, 0xa8, 0x24, 0x2f, 0xa1,
+  0x1b, 0xb6, 0x40, 0x7f, 0xbf, 0x2a, 0x8a, 0xf7, 0x54, 0xaf, 0x30, 0xdc,
+  0xed, 0x62, 0x2f, 0x15, 0xa5, 0x53, 0x4d, 0x9f, 0x08, 0x5c, 0xb1, 0xa0,
+  0xdc, 0x85, 0x0d, 0x93, 0xc9, 0x48, 0x57, 0xd4, 0x66, 0xb5, 0x55, 0xfd,
+  0x7d, 0xba, 0x55, 0x6f, 0x4e, 0x25, 0x23, 0x57, 0xda, 0xea, 0xf1, 0xac,
+  0x31, 0x87, 0x43, 0x10, 0x36, 0x8b, 0xa1, 0xc7, 0xeb, 0x4d, 0xdd, 0x32,
+  0xba, 0x97, 0xc9, 0xe8, 0x3e, 0xa3, 0x81, 0x13, 0xbb, 0xdf, 0xe0, 0x8b,
+  0x44, 0x92, 0x05, 0xc5, 0xfb, 0x89, 0x70, 0x5e, 0x32, 0xf2, 0x80, 0xc4,
+  0x85, 0xf1, 0x2e, 0x68, 0x41, 0x95, 0x19, 0xd3, 0xcb, 0x16, 0xb7, 0xd9,
+  0x85, 0xb3, 0xbf, 0xd7, 0xd9, 0xfe, 0x49, 0xc2, 0x82, 0x0a, 0xc1, 0x5f,
+  0xaf, 0xa3, 0xa0, 0x05, 0xb2, 0xcc, 0xc3, 0x4a, 0x84, 0x41, 0xd0, 0xf2,
+  0x2f, 0xfc, 0xf8, 0x7c, 0xe1, 0xf5, 0xf3, 0x85, 0x4e, 0xb6, 0xf0, 0x73,
+  0xa3, 0xad, 0x07, 0x77, 0x61, 0xd3, 0xe2, 0x89, 0xc3, 0x3b, 0x13, 0xaa,
+  0x11, 0xc6, 0x7c, 0x78, 0xf1, 0x26, 0xa8, 0xa6, 0xcb, 0xab, 0x2b, 0x2b,
+  0x4b, 0xc4, 0x92, 0xf3, 0x6c, 0xad, 0xd5, 0x0d, 0x0c, 0x79, 0x8c, 0x5c,
+  0xed, 0xb3, 0x18, 0xec, 0xb2, 0x60, 0xdc, 0x4e, 0x48, 0x80, 0x9d, 0x91,
+  0xb4, 0x4a, 0x78, 0xad, 0x1b, 0xa8, 0x8b, 0x10, 0xf8, 0xb4, 0x55, 0xce,
+  0xd9, 0x5b, 0x59, 0xa5, 0xd1, 0xad, 0xaf, 0x9a, 0x5b, 0x70, 0xe1, 0x15,
+  0xb2, 0xf7, 0xe3, 0xe0, 0x41, 0x36, 0x8d, 0x85, 0x8b, 0xe5, 0x85, 0xee,
+  0xf2, 0xc2, 0x0d, 0x29, 0xc7, 0xdb, 0xc8, 0xc8, 0xf7, 0x89, 0xe2, 0x1c,
+  0x54, 0x7c, 0x3d, 0xae, 0x9a, 0x1a, 0x59, 0x3e, 0xe7, 0x92, 0xd7, 0x2e,
+  0x8e, 0xcb, 0xb3, 0x09, 0x39, 0xd8, 0x91, 0x19, 0x6b, 0x65, 0x79, 0xa4,
+  0xf2, 0x6a, 0x5c, 0x00, 0xdc, 0x16, 0x40, 0xcf, 0x6d, 0x2c, 0x74, 0x1b,
+  0x62, 0xd1, 0xf3, 0xf4, 0xcc, 0xb3, 0x49, 0xa7, 0x23, 0xf3, 0x61, 0x41,
+  0x09, 0x81, 0x6e, 0x9a, 0x14, 0x83, 0xc8, 0x91, 0x92, 0x4c, 0x33, 0xb0,
+  0x9c, 0x09, 0x1b, 0x30, 0x80, 0x54, 0x74, 0x79, 0x3a, 0x2b, 0x2e, 0xc8,
+  0x1b, 0x66, 0xc3, 0x3e, 0xf6, 0xf2, 0x61, 0x55, 0xb8, 0x20, 0x32, 0xa5,
+  0x2e, 0x73, 0x1e, 0x85, 0xbb, 0x90, 0x0d, 0x8a, 0x92, 0xde, 0xad, 0x8c,
+  0x4f, 0x2b, 0xa5, 0x01, 0x98, 0x3d, 0xa6, 0x47, 0xd1, 0xfd, 0x62, 0x73,
+  0xfe, 0xbe, 0xb6, 0xda, 0x20, 0x95, 0x9f, 0x5b, 0x0b, 0x17, 0xad, 0xb0,
+  0x04, 0xd9, 0x22, 0x75, 0xb8, 0xdd, 0xd9, 0xcb, 0x9e, 0x3e, 0x0e, 0x1b,
+  0x05, 0x5a, 0xe5, 0x75, 0x8d, 0xdb, 0xf5, 0x83, 0xc5, 0xc0, 0xe9, 0x63,
+  0x74, 0x3e, 0x5b, 0x5c, 0x63, 0x88, 0x28, 0x87, 0xd9, 0xa2, 0xd2, 0xd4,
+  0xac, 0xb5, 0x6b, 0x4b, 0x0b, 0x0f, 0x85, 0xb0, 0xf8, 0x35, 0x14, 0x64,
+  0x27, 0x27, 0xb4, 0x94, 0xbd, 0x95, 0x63, 0x4e, 0xdd, 0x80, 0x03, 0xd8,
+  0x92, 0x2d, 0x56, 0x05, 0x07, 0x9a, 0xbc, 0x6d, 0x2c, 0x69, 0x15, 0x10,
+  0x91, 0x1d, 0x2a, 0xa9, 0xae, 0x89, 0xac, 0xbb, 0xb0, 0x12, 0x1c, 0x0e,
+  0x4c, 0x0e, 0xe9, 0x40, 0xf9, 0xcd, 0x4c, 0x03, 0xff, 0x18, 0x0d, 0x65,
+  0x4e, 0xe2, 0x31, 0xa6, 0x7a, 0x20, 0xff, 0x4a, 0xff, 0x2c, 0x02, 0x75,
+  0x5b, 0xc0, 0x06, 0x45, 0x4e, 0x20, 0x49, 0x8f, 0x06, 0x6c, 0xc2, 0x30,
+  0x46, 0xaf, 0xe9, 0x0c, 0x8a, 0xb7, 0xa6, 0xcb, 0x75, 0xe6, 0x68, 0xec,
+  0x87, 0x06, 0x53, 0x8d, 0x25, 0x70, 0xc9, 0x22, 0x35, 0x15, 0xbf, 0xb2,
+  0x69, 0x75, 0x12, 0xd7, 0xfc, 0xd2, 0xd0, 0x86, 0xaf, 0x10, 0x24, 0x76,
+  0xdc, 0x85, 0xf3, 0x59, 0xdb, 0x78, 0x6c, 0xd9, 0x89, 0x0b, 0x3f, 0x46,
+  0xa5, 0x64, 0x32, 0xe2, 0x4d, 0xa8, 0x1f, 0xc8, 0x89, 0x96, 0x72, 0x5e,
+  0x7b, 0xd8, 0xc2, 0x53, 0x27, 0x81, 0xa3, 0xbc, 0xd7, 0x73, 0x9a, 0xad,
+  0xac, 0x70, 0x30, 0xf2, 0xda, 0x7a, 0xec, 0x75, 0xfb, 0x13, 0x5a, 0x5d,
+  0x5d, 0x9b, 0xd9, 0xea, 0x2a, 0xb7, 0xba, 0xba, 0x16, 0x5b, 0xfd, 0xc7,
+  0x0c, 0x3e, 0x82, 0x35, 0xbd, 0x8b, 0x8d, 0x08, 0x1f, 0x79, 0xfc, 0x38,
+  0xb6, 0xf3, 0x3e, 0x19, 0xdd, 0x62, 0x32, 0xad, 0x25, 0x0e, 0x5c, 0xbe,
+  0xad, 0x35, 0x6c, 0x75, 0x98, 0xe9, 0x7f, 0xc0, 0xe1, 0xcf, 0x05, 0x3a,
+  0x68, 0xfd, 0x35, 0xf8, 0xb9, 0x38, 0x29, 0xba, 0x7a, 0xa0, 0x51, 0x9e,
+  0xc5, 0x3a, 0xed, 0xa5, 0x9d, 0x26, 0xb3, 0xbe, 0xbb, 0x53, 0x4c, 0x80,
+  0x16, 0xe2, 0xd3, 0x3b, 0x35, 0x99, 0xfc, 0x9e, 0xec, 0xd6, 0xaf, 0xf6,
+  0x6b, 0x7b, 0xb7, 0xec, 0x4f, 0xc6, 0xc5, 0xdd, 0x8b, 0x4c, 0x2f, 0x3f,
+  0x72, 0x64, 0x07, 0x5f, 0xd8, 0x16, 0x07, 0xae, 0x34, 0x36, 0x5e, 0xa3,
+  0x18, 0x4a, 0x63, 0x3f, 0xfc, 0x8c, 0x57, 0xa2, 0x1e, 0x5c, 0xc6, 0x7a,
+  0xc7, 0x25, 0x87, 0x53, 0xd8, 0x8c, 0x05, 0x78, 0xe6, 0xd2, 0xa3, 0xce,
+  0x02, 0x5d, 0xe5, 0x3c, 0xe8, 0xe9, 0x75, 0x9a, 0xed, 0x0e, 0x38, 0xa9,
+  0x47, 0x4b, 0xc9, 0x52, 0xac, 0x5e, 0x25, 0xfd, 0x12, 0xc8, 0x43, 0xd9,
+  0xed, 0x03, 0x21, 0x90, 0x3e, 0x0c, 0x83, 0xb2, 0xd1, 0xee, 0xbb, 0xb3,
+  0x37, 0xe4, 0xfa, 0x12, 0x49, 0xc8, 0x38, 0x55, 0x6d, 0xca, 0x2f, 0x78,
+  0x12, 0xc3, 0x0b, 0x94, 0x2d, 0x67, 0x1c, 0x6f, 0x37, 0x3a, 0x38, 0x95,
+  0x47, 0x0a, 0xa5, 0x79, 0xc7, 0x65, 0x5f, 0x73, 0xd8, 0x05, 0x81, 0xea,
+  0x02, 0xce, 0x95, 0x0b, 0x62, 0xc7, 0x09, 0x36, 0xd7, 0xc2, 0x41, 0xe2,
+  0x86, 0x65, 0x57, 0x89, 0x52, 0x6b, 0x66, 0x8f, 0x07, 0x46, 0xd7, 0xc0,
+  0xc5, 0x4d, 0x5c, 0x8e, 0xc3, 0xec, 0x28, 0x83, 0xdb, 0xe0, 0xd9, 0x9c,
+  0xab, 0x64, 0x6c, 0x88, 0x53, 0x15, 0x97, 0xfc, 0x6e, 0x2c, 0x1c, 0x36,
+  0x24, 0x43, 0x58, 0x3b, 0x9d, 0x15, 0x91, 0x6a, 0x77, 0x0e, 0x47, 0xf2,
+  0xa3, 0x9d, 0xad, 0xe1, 0xe0, 0xe4, 0x3c, 0x30, 0xa2, 0xd5, 0x67, 0x4f,
+  0x56, 0x5a, 0x2b, 0xab, 0xe1, 0x7f, 0xe2, 0x05, 0xcf, 0xf1, 0x7f, 0x68,
+  0xe1, 0x2f, 0x2b, 0xe1, 0xbf, 0x6c, 0xf1, 0xcd, 0xe1, 0x66, 0xa4, 0x8a,
+  0x8e, 0x59, 0xaa, 0x18, 0xf5, 0xea, 0xa3, 0x24, 0xf5, 0x78, 0x25, 0x4c,
+  0x69, 0x91, 0x83, 0xf7, 0xf0, 0x31, 0x6e, 0xf0, 0xc9, 0x90, 0xbf, 0xe3,
+  0xc4, 0x96, 0x9e, 0xfa, 0xb8, 0x07, 0x27, 0x61, 0xaf, 0xe4, 0xda, 0x0f,
+  0x57, 0xed, 0x50, 0x47, 0xdd, 0x5e, 0x42, 0xf6, 0x7c, 0x63, 0xe1, 0xb4,
+  0xa1, 0x18, 0x11, 0x89, 0x87, 0x53, 0x47, 0x77, 0x58, 0xdf, 0x18, 0x5d,
+  0x6a, 0x5b, 0x68, 0x59, 0xe7, 0x20, 0x20, 0xc5, 0x68, 0xa5, 0x85, 0xc9,
+  0x0c, 0xae, 0x24, 0xa2, 0xa8, 0x9b, 0x5e, 0x53, 0xa1, 0x08, 0x70, 0xce,
+  0x9e, 0x34, 0xb3, 0xd7, 0xa1, 0x6f, 0x76, 0xcb, 0x31, 0xf1, 0xac, 0x5a,
+  0x83, 0x6f, 0xb4, 0x41, 0x34, 0x92, 0x5a, 0x70, 0x94, 0xa6, 0xa6, 0xd9,
+  0x9e, 0x89, 0x1b, 0xe8, 0x27, 0xb4, 0x20, 0x87, 0x72, 0xbd, 0x19, 0x21,
+  0x8c, 0x63, 0x8a, 0x0e, 0x67, 0x25, 0x74, 0x26, 0x3c, 0x06, 0xb9, 0x14,
+  0xf9, 0x43, 0x91, 0xa8, 0xc9, 0x52, 0x4c, 0xfd, 0xaf, 0xac, 0x3a, 0xf0,
+  0x01, 0xba, 0x4a, 0x71, 0x94, 0x1a, 0x0b, 0xef, 0xe2, 0xf1, 0x79, 0x3b,
+  0xf3, 0xa6, 0xb7, 0x0d, 0x25, 0x3a, 0x43, 0x9e, 0x22, 0xe5, 0x15, 0xcc,
+  0x9e, 0x06, 0xc4, 0xa3, 0x94, 0x10, 0x74, 0xc1, 0x98, 0x31, 0xd1, 0x34,
+  0x38, 0xff, 0x16, 0x4d, 0xaf, 0x5a, 0xa0, 0x06, 0x8f, 0x99, 0x3e, 0xd4,
+  0x5b, 0x96, 0xae, 0x78, 0x52, 0xa3, 0x08, 0x1f, 0x6d, 0x9c, 0x3d, 0xa4,
+  0xf9, 0x54, 0x16, 0x93, 0x46, 0x81, 0xda, 0xd4, 0x69, 0x3b, 0xf3, 0x93,
+  0x7a, 0xd3, 0x10, 0xe8, 0xc0, 0xb9, 0x64, 0x5e, 0x57, 0x9f, 0xb6, 0xb3,
+  0x4c, 0xb1, 0x4d, 0x5b, 0x55, 0xdd, 0xd9, 0x95, 0x64, 0x01, 0x27, 0xb1,
+  0xfd, 0x77, 0xff, 0xb4, 0x8d, 0x56, 0x62, 0xfb, 0xc8, 0x46, 0xeb, 0xc0,
+  0xae, 0xa3, 0x05, 0xb6, 0xa6, 0x90, 0xd4, 0xd5, 0x90, 0x69, 0x3d, 0x44,
+  0xf5, 0x0d, 0x89, 0x32, 0x1e, 0x88, 0x95, 0x90, 0xce, 0x94, 0xb5, 0xff,
+  0xd3, 0xac, 0xf6, 0x67, 0xaa, 0x39, 0xf7, 0x6e, 0xdf, 0x43, 0xe0, 0x2d,
+  0x98, 0x21, 0x2f, 0xd2, 0x57, 0x9d, 0xcd, 0x98, 0x6c, 0x95, 0x9b, 0x74,
+  0xe5, 0x58, 0x0f, 0xc7, 0x01, 0x78, 0x39, 0xea, 0xe7, 0x7a, 0x93, 0x53,
+  0x2d, 0xa6, 0x5c, 0x56, 0xda, 0xb4, 0xf7, 0x7f, 0xd7, 0xf7, 0x1b, 0x7f,
+  0x39, 0x3f, 0xbf, 0x90, 0xbb, 0xa4, 0xc5, 0xbf, 0x8a, 0x11, 0x08, 0x2b,
+  0x00, 0xfb, 0xdc, 0xa2, 0x89, 0x79, 0x63, 0x15, 0x18, 0x84, 0x3e, 0xe5,
+  0x2e, 0x96, 0xa2, 0x2f, 0xf0, 0x03, 0x83, 0xc3, 0x12, 0x92, 0x9d, 0xf0,
+  0x2d, 0x9a, 0x6d, 0xef, 0x8a, 0x88, 0x3e, 0x7c, 0xd3, 0xd4, 0xb4, 0x5b,
+  0x46, 0x63, 0x26, 0x0a, 0x07, 0x63, 0x8e, 0x44, 0xf8, 0x5f, 0x9e, 0xeb,
+  0xa1, 0x77, 0xce, 0x62, 0xa7, 0x7b, 0x04, 0xf5, 0x86, 0x08, 0xf0, 0x9b,
+  0x9c, 0x91, 0x3f, 0xbc, 0x3e, 0x8c, 0x6f, 0x2d, 0x70, 0x1a, 0x8d, 0x81,
+  0x70, 0x2c, 0x34, 0xa2, 0xcd, 0xc1, 0xe5, 0x49, 0xfb, 0x68, 0x2c, 0x2e,
+  0x8f, 0x75, 0x47, 0x15, 0x38, 0xce, 0x4a, 0x8d, 0x88, 0x2a, 0x86, 0xc2,
+  0xf2, 0x51, 0x5c, 0x95, 0xab, 0xec, 0xc1, 0xc2, 0x87, 0x24, 0x72, 0xf5,
+  0x8f, 0xbf, 0xf7, 0x1f, 0xdc, 0xaf, 0x1e, 0x9c, 0x22, 0xaf, 0x32, 0xee,
+  0xcd, 0x39, 0x8b, 0xe4, 0x8c, 0x7a, 0x73, 0x9d, 0x8f, 0xc7, 0x02, 0x8c,
+  0xd0, 0x19, 0x53, 0xa8, 0xc0, 0x45, 0x31, 0xce, 0xd9, 0x87, 0xdb, 0x17,
+  0xec, 0x50, 0x49, 0x29, 0x46, 0x6a, 0x25, 0x3d, 0x5d, 0x06, 0xd9, 0xa1,
+  0x48, 0x51, 0x7e, 0xab, 0x1c, 0xc1, 0x3c, 0x62, 0xbe, 0x41, 0x96, 0x13,
+  0x3d, 0xde, 0xcc, 0x1c, 0xc0, 0x08, 0x02, 0xc6, 0xa8, 0x07, 0x34, 0x64,
+  0xdd, 0x64, 0x0a, 0x2d, 0x92, 0x76, 0xe4, 0x7b, 0xca, 0xb2, 0x4d, 0x3e,
+  0x17, 0xbd, 0xa0, 0x1d, 0x64, 0x0d, 0x6a, 0xad, 0xc1, 0xee, 0x3b, 0x34,
+  0x18, 0xc3, 0x71, 0x05, 0x13, 0x13, 0x36, 0xb3, 0xc1, 0xa8, 0x11, 0xdb,
+  0x90, 0xc0, 0x39, 0xad, 0x87, 0xae, 0xef, 0x59, 0x14, 0x6f, 0xe3, 0xba,
+  0x7b, 0xd6, 0x66, 0x53, 0x6b, 0x9b, 0x5a, 0x97, 0x9c, 0x6a, 0x7d, 0x1d,
+  0x94, 0xd9, 0xe4, 0x73, 0x4a, 0x31, 0xa3, 0x9a, 0xf1, 0x68, 0x75, 0xae,
+  0x28, 0x9d, 0xf7, 0xae, 0x11, 0x5d, 0x20, 0x62, 0x20, 0x3c, 0xd4, 0x70,
+  0xad, 0x5a, 0x32, 0x78, 0xa1, 0x79, 0xab, 0x5a, 0x9d, 0x37, 0xe2, 0x5f,
+  0x1b, 0xf4, 0x55, 0x6d, 0x8d, 0xdc, 0xf2, 0x34, 0x21, 0x0a, 0x5d, 0xe5,
+  0xa3, 0x3e, 0x23, 0xac, 0x23, 0xc2, 0xaf, 0x9a, 0xc0, 0xe8, 0xec, 0x30,
+  0x7f, 0xd3, 0xbd, 0xae, 0xe3, 0xfe, 0xd6, 0x80, 0x7f, 0xb3, 0xa9, 0x8a,
+  0xd9, 0x1c, 0xb5, 0x22, 0x85, 0xea, 0x1c, 0x08, 0x06, 0xe0, 0x7f, 0xd1,
+  0xf0, 0xdd, 0xa8, 0x40, 0x78, 0x24, 0x6b, 0x31, 0x0d, 0x50, 0x10, 0xe9,
+  0xbd, 0x08, 0x57, 0x72, 0x6c, 0x39, 0xb0, 0xc2, 0x1f, 0x34, 0xa6, 0xe4,
+  0x08, 0x3b, 0xfc, 0xfd, 0xf6, 0xce, 0x56, 0x87, 0x69, 0xfa, 0xff, 0x2e,
+  0xb7, 0xa9, 0xcf, 0xd1, 0x09, 0xff, 0xf9, 0x4a, 0x9c, 0x32, 0x0e, 0x94,
+  0x9e, 0xc5, 0x42, 0x2d, 0x1d, 0x91, 0xc4, 0x0e, 0xce, 0xcf, 0x6f, 0xed,
+  0xbe, 0xdd, 0x3e, 0xd8, 0xdb, 0x7d, 0xbd, 0xb5, 0x7b, 0xc8, 0x0d, 0x1c,
+  0xde, 0x52, 0x0e, 0xad, 0x8a, 0x95, 0x0d, 0x93, 0x14, 0x15, 0x48, 0xd4,
+  0x52, 0x87, 0x2c, 0xb4, 0x1c, 0xb6, 0x4f, 0xff, 0x6c, 0x5b, 0x7b, 0xfc,
+  0x0c, 0x1e, 0x51, 0x03, 0x24, 0x36, 0x40, 0xf4, 0x1c, 0x54, 0x11, 0xe1,
+  0xb0, 0x71, 0x84, 0xe6, 0x21, 0x83, 0x16, 0x60, 0x10, 0xa4, 0xb1, 0xc3,
+  0x40, 0x49, 0xbb, 0x3c, 0x46, 0x7b, 0x9a, 0xd3, 0x13, 0xf3, 0xfa, 0x6c,
+  0x10, 0xdc, 0xe9, 0x7c, 0xc4, 0xdf, 0xa7, 0x18, 0xcf, 0x5b, 0x8b, 0xe1,
+  0x71, 0x61, 0x30, 0xa8, 0xf8, 0xa1, 0xcf, 0xcc, 0xec, 0x08, 0x6c, 0x48,
+  0x60, 0x82, 0x00, 0xf0, 0x1a, 0xf3, 0x2b, 0xbd, 0x05, 0xa4, 0xc2, 0x64,
+  0x4c, 0x7e, 0xb6, 0x3c, 0x46, 0xfe, 0xfc, 0x17, 0x8d, 0x2d, 0x0b, 0x9b,
+  0xfd, 0xeb, 0x0b, 0xf2, 0x0b, 0x7e, 0xfb, 0xcb, 0x73, 0x22, 0xe9, 0x5f,
+  0xc3, 0x7e, 0x77, 0x0a, 0xa9, 0x69, 0xc3, 0xcf, 0xc6, 0xa2, 0xc9, 0x14,
+  0x54, 0x42, 0x1b, 0x43, 0xc7, 0x4d, 0xda, 0x44, 0x22, 0xcb, 0x11, 0xf2,
+  0x3a, 0xbe, 0x40, 0xa3, 0x1d, 0x69, 0xf5, 0x17, 0xc2, 0xd3, 0xd4, 0xd6,
+  0x7e, 0xfd, 0x22, 0xcd, 0xa7, 0x4d, 0xaa, 0x50, 0x37, 0x66, 0x59, 0x40,
+  0x70, 0xcf, 0x89, 0xef, 0xe7, 0xf1, 0x4f, 0x07, 0x74, 0x64, 0xb0, 0x74,
+  0x30, 0x8c, 0x26, 0x81, 0x0c, 0x8c, 0x09, 0x46, 0x2e, 0x20, 0xca, 0x5c,
+  0x0d, 0x07, 0x1f, 0xc8, 0x77, 0xf3, 0x73, 0x04, 0x7d, 0xd7, 0xcc, 0xb6,
+  0x5f, 0x6f, 0x84, 0xcf, 0x3a, 0xaf, 0xe9, 0x9b, 0x9d, 0x57, 0xf4, 0x3b,
+  0xa1, 0x86, 0xf2, 0x2c, 0x37, 0x76, 0x76, 0xfe, 0xf4, 0xd4, 0x4a, 0x76,
+  0x97, 0xca, 0xeb, 0x2d, 0x0b, 0x28, 0xe4, 0x67, 0x19, 0xdc, 0x4c, 0xba,
+  0xdb, 0xdd, 0x93, 0xde, 0x5e, 0xcc, 0xac, 0x03, 0x45, 0x19, 0xe9, 0xa1,
+  0xe3, 0x6a, 0x99, 0x31, 0x2e, 0xab, 0x6f, 0x43, 0xd7, 0xfe, 0x0b, 0x4e,
+  0x6d, 0x96, 0x98, 0x0c, 0x36, 0x59, 0xa2, 0x18, 0x00, 0x29, 0xd3, 0x23,
+  0x54, 0x47, 0x07, 0xba, 0x16, 0x83, 0x6b, 0x12, 0x13, 0x95, 0x8a, 0xa2,
+  0x19, 0x01, 0x4e, 0x52, 0x68, 0xd5, 0xa8, 0xac, 0xde, 0x67, 0x0f, 0xfe,
+  0xfd, 0x01, 0x4e, 0x06, 0x07, 0x95, 0x71, 0xfe, 0x4f, 0xc5, 0xbe, 0x1f,
+  0xf4, 0xae, 0x0e, 0x0e, 0x06, 0xbb, 0xe9, 0x4b, 0xbe, 0x0d, 0xc6, 0x81,
+  0xed, 0x91, 0x8c, 0x21, 0xd4, 0x92, 0x90, 0xb2, 0x92, 0x79, 0x5a, 0x0b,
+  0x9c, 0x51, 0x9a, 0x23, 0xaa, 0xbd, 0xcf, 0x2c, 0x72, 0x2a, 0xbe, 0x25,
+  0x1b, 0x95, 0xe3, 0xaa, 0xe8, 0x9d, 0x12, 0xa3, 0xe4, 0xb8, 0xce, 0x5b,
+  0x8a, 0x37, 0x76, 0x99, 0xe5, 0x56, 0x82, 0xf9, 0x6c, 0xb6, 0x4f, 0x39,
+  0x97, 0x8c, 0x69, 0x8f, 0xe8, 0xc5, 0xf9, 0xb9, 0x29, 0x18, 0x96, 0xa9,
+  0x03, 0x19, 0x18, 0x0e, 0x04, 0x2d, 0x03, 0x53, 0xe1, 0xad, 0xf9, 0x86,
+  0xe3, 0xf4, 0xda, 0xbe, 0xa6, 0x35, 0xf3, 0xea, 0x6b, 0x9c, 0xde, 0x40,
+  0x1e, 0xbc, 0xbe, 0x9e, 0x41, 0x5b, 0x8e, 0x72, 0xf8, 0x76, 0xfa, 0xfd,
+  0xd0, 0x43, 0x8e, 0x20, 0x7a, 0x29, 0xa1, 0x27, 0x98, 0x45, 0x74, 0xeb,
+  0xf2, 0xc3, 0xb4, 0x17, 0x24, 0xe3, 0x7d, 0xe1, 0x91, 0x90, 0x08, 0x87,
+  0x33, 0x76, 0xcf, 0xc1, 0x28, 0x11, 0x19, 0xa1, 0xf3, 0x8e, 0x14, 0xb2,
+  0xf7, 0x09, 0x11, 0xba, 0x62, 0xca, 0x5a, 0x86, 0xc0, 0x25, 0x0a, 0xc5,
+  0xa4, 0x27, 0xbe, 0x87, 0x49, 0x7e, 0x05, 0x1e, 0xab, 0xe1, 0x5a, 0x0a,
+  0xf9, 0x02, 0xc1, 0xe5, 0x58, 0x0d, 0x41, 0x2a, 0x97, 0x07, 0x46, 0xdf,
+  0x1b, 0x80, 0x91, 0x52, 0x06, 0x21, 0x81, 0x29, 0xd2, 0x48, 0x7c, 0xa3,
+  0x33, 0xf0, 0xe1, 0x98, 0xf3, 0x6e, 0x6e, 0xbf, 0x3a, 0x88, 0xe6, 0x91,
+  0xe7, 0xc4, 0xd9, 0x39, 0xc7, 0x11, 0x45, 0xdc, 0x83, 0x98, 0x19, 0xee,
+  0xe7, 0x3c, 0x96, 0x5b, 0xd4, 0xd7, 0x85, 0xa3, 0x47, 0x3d, 0xac, 0x11,
+  0xd1, 0xad, 0x02, 0x75, 0x36, 0x80, 0xc4, 0xa1, 0x6a, 0xa0, 0x8c, 0x62,
+  0x7e, 0xce, 0xe0, 0xc7, 0x39, 0xdd, 0x91, 0x7d, 0xa3, 0x14, 0x0e, 0x1a,
+  0x48, 0xb6, 0x82, 0x71, 0x46, 0xe0, 0xa4, 0xf8, 0xfb, 0x27, 0xed, 0xa7,
+  0x14, 0x75, 0x4f, 0xf1, 0xcb, 0xb5, 0x84, 0xc8, 0xc6, 0xea, 0xb3, 0xb5,
+  0xf6, 0xea, 0x63, 0x42, 0x31, 0x5d, 0x59, 0x5e, 0x7d, 0xdc, 0x90, 0x8c,
+  0x35, 0x9c, 0x34, 0x4e, 0x4e, 0xb7, 0x89, 0xa7, 0x35, 0x89, 0xf4, 0xc5,
+  0x86, 0xf2, 0xb3, 0xfd, 0xfd, 0x57, 0x1b, 0x87, 0x1b, 0xd9, 0x0b, 0xa6,
+  0x9d, 0xc1, 0xe8, 0x86, 0x78, 0x88, 0x87, 0x08, 0x12, 0xa5, 0x20, 0x29,
+  0x5e, 0x2a, 0x8e, 0x42, 0xc4, 0xfd, 0x8e, 0x47, 0x37, 0x6a, 0xa1, 0xa3,
+  0xc0, 0x58, 0x0d, 0x10, 0x3b, 0x1f, 0x90, 0xc7, 0xd7, 0x5a, 0x6d, 0x2b,
+  0x12, 0xd2, 0x70, 0x14, 0xf4, 0xa0, 0xa0, 0x3f, 0xd1, 0xf7, 0x35, 0x74,
+  0x39, 0x1a, 0xf7, 0xa4, 0x1f, 0x99, 0xdf, 0xe6, 0xde, 0xce, 0x9b, 0xd7,
+  0xbb, 0x9d, 0xec, 0x05, 0xa7, 0x24, 0x06, 0x3a, 0xb9, 0x2a, 0xbb, 0xe3,
+  0x73, 0x1a, 0x20, 0xb3, 0xaa, 0x66, 0x56, 0x03, 0x57, 0x72, 0x56, 0x28,
+  0xef, 0x07, 0x2e, 0xcd, 0xb3, 0x29, 0xdb, 0xa6, 0x0d, 0xce, 0xcf, 0xa1,
+  0x45, 0x57, 0xa9, 0x27, 0xef, 0x89, 0x47, 0xe8, 0x92, 0xf9, 0xc4, 0x19,
+  0xad, 0x62, 0xeb, 0x38, 0x17, 0xac, 0x59, 0x8e, 0x40, 0xd9, 0x3e, 0x65,
+  0xa1, 0x92, 0x87, 0xc0, 0x8e, 0x57, 0xce, 0x43, 0x26, 0xa7, 0x7e, 0x79,
+  0x46, 0xf1, 0xa1, 0x25, 0xf2, 0x72, 0x85, 0xc8, 0xd8, 0xd1, 0x4a, 0x7a,
+  0x96, 0x4e, 0x8d, 0xd0, 0xe6, 0x37, 0x37, 0x8e, 0x5e, 0xbe, 0xd9, 0x7d,
+  0xb5, 0xb3, 0x95, 0xbd, 0xe0, 0x72, 0xd1, 0x71, 0x5e, 0x5c, 0x0c, 0x57,
+  0xeb, 0xfd, 0x32, 0x33, 0x3a, 0xc9, 0x29, 0x4f, 0x87, 0xf5, 0x1d, 0xc3,
+  0xc0, 0x9e, 0xc5, 0xf7, 0x88, 0xe7, 0x96, 0x67, 0x7d, 0x96, 0xcc, 0x4f,
+  0x63, 0x0e, 0x7b, 0xad, 0x45, 0x07, 0xd7, 0xeb, 0x47, 0xf5, 0xe3, 0xde,
+  0xeb, 0xad, 0x1a, 0x39, 0xd8, 0xa8, 0xbc, 0x45, 0x20, 0xd6, 0x39, 0x43,
+  0x45, 0x83, 0xf3, 0xe2, 0x84, 0x00, 0x37, 0x1d, 0x45, 0x60, 0x2d, 0x90,
+  0xe3, 0x17, 0xee, 0xc2, 0x59, 0xe4, 0x60, 0x4b, 0x58, 0x72, 0x71, 0x8f,
+  0xa0, 0xae, 0xf2, 0x12, 0xa2, 0xb1, 0xec, 0xa7, 0x57, 0x3f, 0x1c, 0x6d,
+  0xee, 0xed, 0x7e, 0xbf, 0xfd, 0x03, 0xc6, 0xe4, 0x86, 0xe8, 0x60, 0xfa,
+  0xb3, 0x17, 0x6e, 0x1a, 0x32, 0x56, 0x41, 0xc4, 0x49, 0x31, 0xb3, 0x53,
+  0xa4, 0xf2, 0x88, 0xbb, 0xdf, 0xd4, 0x60, 0x0d, 0xad, 0xf7, 0x35, 0x86,
+  0xc0, 0x36, 0x3f, 0x67, 0x70, 0xde, 0xfa, 0x22, 0xbf, 0x59, 0x2b, 0xce,
+  0xc0, 0xe8, 0x02, 0xd2, 0xbf, 0x1d, 0x16, 0xb7, 0x2f, 0xf3, 0x73, 0x53,
+  0x45, 0xa4, 0xf5, 0x92, 0x9d, 0x09, 0xd2, 0x27, 0x37, 0xa2, 0xb2, 0x8e,
+  0xe8, 0xbf, 0x9f, 0x57, 0xd0, 0x01, 0x2b, 0x62, 0xc0, 0x61, 0xf7, 0x8a,
+  0xe4, 0x43, 0xd9, 0x06, 0xef, 0xa1, 0xac, 0x68, 0x95, 0xec, 0x5c, 0xa2,
+  0xdd, 0x25, 0x52, 0x40, 0x2b, 0x19, 0xbb, 0xa9, 0x79, 0x6a, 0x77, 0xd5,
+  0x24, 0x02, 0xcb, 0xb8, 0x89, 0xd7, 0xa0, 0x44, 0x63, 0x11, 0x47, 0x45,
+  0xc6, 0xb3, 0x15, 0x53, 0x10, 0xc6, 0x9e, 0x2d, 0xd2, 0x24, 0x5a, 0x6e,
+  0x0e, 0x4b, 0xcf, 0xb3, 0xec, 0xac, 0x3f, 0x19, 0xf7, 0x88, 0x7d, 0x84,
+  0x13, 0xd9, 0xe5, 0xdf, 0x28, 0x6e, 0xbb, 0x5f, 0x55, 0xbd, 0x20, 0x68,
+  0x8d, 0x00, 0xa4, 0xd0, 0xa4, 0x90, 0x2f, 0xd0, 0x66, 0x90, 0xed, 0x06,
+  0xbd, 0xd3, 0x8a, 0xd0, 0xd4, 0x21, 0xa1, 0xde, 0x4e, 0x83, 0xe6, 0x99,
+  0x56, 0x60, 0x32, 0xd0, 0x18, 0x0b, 0x0c, 0x88, 0x6f, 0xd0, 0x97, 0x84,
+  0x16, 0xb5, 0x52, 0x26, 0x47, 0xa4, 0xb7, 0xe7, 0xd9, 0x74, 0x2f, 0x27,
+  0x1e, 0x79, 0x00, 0xac, 0xd5, 0x61, 0x73, 0x85, 0x23, 0x5b, 0x2d, 0xe7,
+  0x4c, 0x34, 0xa0, 0x76, 0x72, 0x38, 0xe4, 0x7e, 0xaa, 0xd1, 0x27, 0xa7,
+  0x0b, 0x0f, 0xad, 0x42, 0xb8, 0x4a, 0x70, 0x5b, 0x87, 0x07, 0x9b, 0xd9,
+  0x0b, 0x0a, 0x46, 0x9b, 0x35, 0x8d, 0xa9, 0x59, 0x34, 0xda, 0xe1, 0x22,
+  0x19, 0x9d, 0x34, 0x24, 0xb5, 0x7e, 0x7b, 0x0c, 0x78, 0x99, 0x51, 0xd9,
+  0x55, 0x91, 0x0b, 0xbc, 0x64, 0x7e, 0x0e, 0x4f, 0x89, 0xba, 0x6b, 0x19,
+  0xd2, 0x17, 0x05, 0xad, 0x67, 0x59, 0x5d, 0x48, 0x0e, 0x8b, 0x5c, 0x9a,
+  0x4a, 0x74, 0x46, 0x75, 0x88, 0x3d, 0x90, 0x2c, 0x1a, 0x1a, 0x99, 0x8f,
+  0xc3, 0xd1, 0x12, 0x70, 0x9c, 0xef, 0x45, 0x53, 0xf8, 0xdb, 0xce, 0xde,
+  0x0f, 0xaf, 0xb6, 0x0f, 0xa6, 0x37, 0x24, 0x1e, 0xb4, 0xb4, 0x28, 0x80,
+  0xe0, 0xc0, 0xeb, 0xc9, 0x69, 0xc2, 0x50, 0x33, 0x76, 0xc0, 0x6e, 0xb3,
+  0xcf, 0x87, 0xd4, 0xb2, 0x17, 0xc8, 0x93, 0xb8, 0x91, 0x42, 0x9a, 0xd2,
+  0x5d, 0x60, 0xca, 0xdd, 0x09, 0xf9, 0x15, 0x7e, 0x43, 0xbd, 0x24, 0x11,
+  0x38, 0xc9, 0xf5, 0x6a, 0x6f, 0x34, 0x85, 0xed, 0x62, 0x75, 0x98, 0x4a,
+  0xe9, 0xdf, 0x6e, 0x66, 0xb5, 0xb4, 0x8a, 0x04, 0x86, 0x30, 0x85, 0x3e,
+  0x9b, 0x9f, 0x5b, 0x0c, 0x6d, 0x9e, 0x17, 0xd7, 0xe1, 0xe2, 0x7d, 0x35,
+  0xa0, 0x43, 0x13, 0xf1, 0x30, 0x2a, 0x81, 0x68, 0x17, 0x71, 0xe2, 0x04,
+  0x36, 0xaf, 0x1c, 0xdc, 0x1d, 0x68, 0xed, 0x81, 0x50, 0xde, 0x19, 0xf2,
+  0xf0, 0x3c, 0x92, 0x83, 0xfa, 0x67, 0xe3, 0x93, 0xe1, 0x1a, 0xb6, 0xe3,
+  0xb7, 0x49, 0x10, 0x73, 0x8b, 0xec, 0x6f, 0x6f, 0xb6, 0x37, 0x3d, 0x50,
+  0x3a, 0x74, 0xf5, 0x1f, 0xb7, 0x76, 0x08, 0xcc, 0xfb, 0x4d, 0xc5, 0x68,
+  0x40, 0x6f, 0x5f, 0x77, 0xea, 0xcc, 0x94, 0x52, 0xf3, 0x83, 0xe2, 0x18,
+  0x38, 0x3a, 0xcf, 0x2e, 0xcf, 0x5e, 0x6d, 0xee, 0xb0, 0x77, 0x89, 0x61,
+  0xa4, 0xcf, 0x8b, 0x9e, 0xa2, 0x30, 0x13, 0x87, 0xdc, 0xdc, 0x3a, 0x38,
+  0x3c, 0x9a, 0xb9, 0x6f, 0x77, 0x5c, 0x31, 0x08, 0x9a, 0xfc, 0x8a, 0x57,
+  0x8c, 0x0d, 0x8c, 0x0c, 0x0d, 0xd3, 0xc7, 0xe2, 0xbf, 0xe7, 0xde, 0x0b,
+  0x83, 0xfa, 0xeb, 0xd6, 0xcf, 0x81, 0xca, 0xa7, 0x06, 0x45, 0x98, 0xb5,
+  0xa2, 0xce, 0xd7, 0xba, 0xad, 0x53, 0xad, 0x42, 0x68, 0x34, 0x95, 0x85,
+  0x0e, 0xa8, 0x68, 0x07, 0x75, 0x16, 0x74, 0x0b, 0x54, 0x08, 0x13, 0x5c,
+  0x2c, 0xba, 0x0d, 0x3d, 0x08, 0x1e, 0xdb, 0x07, 0x05, 0xc0, 0x53, 0x18,
+  0x93, 0xf0, 0x72, 0x6a, 0x9a, 0x93, 0x3f, 0x24, 0x86, 0x10, 0x50, 0x96,
+  0x79, 0xef, 0xe6, 0xf7, 0xc2, 0x66, 0x22, 0x35, 0xcd, 0xd0, 0xcc, 0xa8,
+  0x90, 0xe4, 0x19, 0xa1, 0x10, 0x15, 0x49, 0xf9, 0x1d, 0x91, 0xd2, 0x06,
+  0x04, 0x60, 0xa3, 0xd8, 0xef, 0x81, 0x5c, 0x03, 0x6d, 0x50, 0x04, 0xe5,
+  0x7b, 0x4b, 0x6b, 0x65, 0xe8, 0xec, 0x88, 0xfd, 0x96, 0xc0, 0x92, 0xfa,
+  0xeb, 0xae, 0x7a, 0x1e, 0x24, 0x45, 0x83, 0xcc, 0xd9, 0x29, 0x8f, 0x47,
+  0x05, 0x2e, 0x88, 0x45, 0x3c, 0xb4, 0xda, 0x5e, 0xa3, 0x93, 0x7b, 0x4d,
+  0x00, 0x0c, 0x2f, 0x07, 0xe4, 0xec, 0x4c, 0xa1, 0x75, 0xc0, 0xf1, 0xf1,
+  0x3c, 0xb8, 0x29, 0x43, 0xeb, 0xa8, 0x91, 0xa5, 0xb3, 0x75, 0x10, 0x54,
+  0x1a, 0xde, 0x8e, 0x7f, 0x86, 0x64, 0xca, 0xe0, 0x2e, 0x74, 0x8e, 0x91,
+  0x09, 0x06, 0x11, 0xb5, 0xe9, 0x2d, 0x54, 0x2a, 0x9f, 0x8a, 0x80, 0x8a,
+  0x77, 0x88, 0x62, 0xe7, 0xe7, 0x62, 0xd1, 0x92, 0xb1, 0x06, 0x1d, 0x37,
+  0xfe, 0xb7, 0x9b, 0xc0, 0xdf, 0x37, 0x86, 0x8c, 0x01, 0x46, 0xec, 0xe5,
+  0x15, 0x32, 0x73, 0x78, 0x92, 0xf5, 0xfb, 0x63, 0xea, 0x98, 0xc6, 0x1b,
+  0x47, 0xef, 0xee, 0x78, 0x75, 0x38, 0xa2, 0xcf, 0x58, 0x5e, 0x52, 0xc4,
+  0x1b, 0xbd, 0xd2, 0xb4, 0x68, 0xbb, 0x5e, 0x66, 0x72, 0x95, 0x29, 0xfe,
+  0x29, 0x9b, 0x15, 0xc2, 0xbf, 0x87, 0x7b, 0x41, 0xce, 0x0e, 0xbf, 0x6c,
+  0x7d, 0xbf, 0xfd, 0x93, 0x9a, 0xfe, 0x0e, 0xa3, 0xf1, 0x4a, 0xfc, 0xd4,
+  0x14, 0x13, 0x99, 0xaa, 0x4f, 0x02, 0x84, 0x95, 0x39, 0x33, 0x88, 0xc2,
+  0xc6, 0x70, 0x9d, 0x37, 0x2e, 0xc1, 0x34, 0x2f, 0x75, 0x77, 0x4c, 0xce,
+  0xe0, 0x76, 0xad, 0x30, 0x81, 0x2c, 0xc6, 0x76, 0x62, 0x13, 0x81, 0x11,
+  0x64, 0x0a, 0x96, 0x56, 0x6c, 0x29, 0x3c, 0xa0, 0x30, 0x3b, 0x89, 0xb4,
+  0x91, 0x0f, 0xcc, 0xd6, 0x8b, 0xf6, 0x44, 0x13, 0x72, 0x88, 0xff, 0x41,
+  0x5a, 0x6b, 0x3a, 0x93, 0x0c, 0xc9, 0xb2, 0xec, 0xf8, 0x87, 0x83, 0xa6,
+  0xcf, 0x18, 0x06, 0xaa, 0xc5, 0x5a, 0xc5, 0x25, 0x7b, 0x3d, 0x1d, 0xb6,
+  0xe2, 0xe3, 0x88, 0xe2, 0xa2, 0x51, 0x9a, 0x54, 0xef, 0xda, 0xe9, 0xd3,
+  0x61, 0x1b, 0x5f, 0xe3, 0xea, 0xe2, 0xca, 0x65, 0x28, 0xf8, 0x86, 0x9b,
+  0xd9, 0x77, 0xc6, 0x08, 0x3c, 0xba, 0x4b, 0x6c, 0x1b, 0xd2, 0xe4, 0x0c,
+  0x5e, 0x4d, 0x30, 0x36, 0xf1, 0x6b, 0x68, 0xeb, 0x55, 0xad, 0xf9, 0xe9,
+  0xb9, 0x74, 0x92, 0xc9, 0x50, 0x8d, 0x81, 0xea, 0x61, 0xfd, 0x25, 0xb2,
+  0xc8, 0xc6, 0x70, 0x9f, 0x01, 0xf9, 0x60, 0xf8, 0x41, 0xff, 0x52, 0x7e,
+  0xef, 0xb7, 0x72, 0xf7, 0xda, 0xa3, 0xfb, 0xbe, 0xf5, 0xc8, 0xbf, 0x74,
+  0x7e, 0xef, 0xb7, 0x5a, 0x6a, 0x5a, 0x98, 0x9f, 0xdf, 0xfa, 0x69, 0xfb,
+  0x30, 0x28, 0x8b, 0xaf, 0x1c, 0xf5, 0x8e, 0x0a, 0xde, 0x98, 0x20, 0x97,
+  0xf4, 0x89, 0xd3, 0x85, 0x17, 0x0d, 0x14, 0x57, 0x70, 0x3d, 0x33, 0xa9,
+  0x44, 0xcd, 0x72, 0x57, 0x39, 0x15, 0x2a, 0xc6, 0x18, 0x50, 0x0c, 0x6d,
+  0x06, 0x04, 0x50, 0x35, 0xa4, 0x21, 0x41, 0x96, 0xe1, 0xff, 0xb4, 0x40,
+  0x31, 0xb7, 0x48, 0x11, 0x02, 0xa5, 0x86, 0xfc, 0x6e, 0x88, 0x0d, 0x98,
+  0x3d, 0x95, 0x03, 0x05, 0xab, 0x55, 0xe4, 0xe6, 0xd0, 0x45, 0x53, 0xdc,
+  0x42, 0x82, 0x11, 0x5a, 0x09, 0x6c, 0x2c, 0x3d, 0xb1, 0x42, 0xb2, 0x36,
+  0xe3, 0x28, 0x18, 0x44, 0xb4, 0xe5, 0x3c, 0xc6, 0x34, 0xef, 0x04, 0x78,
+  0x18, 0xd8, 0xdb, 0x49, 0xc0, 0x8c, 0x58, 0xcd, 0x1c, 0x6a, 0xb2, 0x9e,
+  0xb6, 0x55, 0x92, 0x34, 0xfa, 0x09, 0x71, 0x83, 0xac, 0xed, 0x0e, 0xe0,
+  0xc2, 0x1e, 0x56, 0x51, 0x53, 0x0b, 0x8f, 0xd6, 0x74, 0x21, 0x0e, 0x92,
+  0xb4, 0x97, 0xb9, 0x6d, 0x2a, 0x1d, 0xf4, 0x7d, 0x5e, 0xf6, 0xf8, 0xfa,
+  0x12, 0x94, 0xce, 0xf2, 0x77, 0x95, 0x87, 0xa9, 0x50, 0x10, 0xd9, 0x8e,
+  0x2e, 0xf2, 0x1e, 0x47, 0x8a, 0xf3, 0x01, 0xa8, 0x6e, 0xfa, 0xe3, 0xfc,
+  0xda, 0xb2, 0x2a, 0xb1, 0x17, 0x27, 0x6a, 0x08, 0xa0, 0x92, 0xe5, 0x1b,
+  0x96, 0x79, 0x49, 0xd1, 0x1b, 0xc3, 0x14, 0x59, 0x29, 0xa6, 0x9b, 0x4a,
+  0x00, 0xba, 0x8a, 0x78, 0x25, 0x7c, 0x48, 0x0a, 0x2f, 0x84, 0x44, 0x08,
+  0x2e, 0x6b, 0xcf, 0x19, 0x95, 0xd4, 0x16, 0xc4, 0xd7, 0xe2, 0x9a, 0x78,
+  0x74, 0x09, 0xac, 0x1b, 0x36, 0x1a, 0xc2, 0x35, 0xc4, 0xeb, 0x00, 0xb7,
+  0x49, 0x1b, 0xb1, 0xe7, 0x17, 0x56, 0x23, 0x61, 0x7e, 0x2e, 0xd7, 0xf2,
+  0xe3, 0x03, 0x29, 0x72, 0x47, 0xc2, 0x42, 0x58, 0x8c, 0xe3, 0xf0, 0xc5,
+  0x0d, 0x97, 0x96, 0xcc, 0xfb, 0xac, 0xf9, 0xdb, 0x72, 0x6a, 0xe6, 0x3c,
+  0xcf, 0x2b, 0x90, 0xfe, 0xdc, 0xa6, 0x59, 0x65, 0xa5, 0x9a, 0x97, 0x67,
+  0x0b, 0x6c, 0xe5, 0x62, 0xd6, 0x83, 0x44, 0xa0, 0x13, 0x7b, 0xfa, 0xb8,
+  0xd0, 0x17, 0x94, 0x2d, 0x3c, 0x9e, 0xd9, 0x1a, 0xbd, 0xe6, 0x1b, 0xf3,
+  0x90, 0x05, 0x77, 0xb5, 0xf6, 0x24, 0xd9, 0x46, 0x87, 0x7b, 0x80, 0x06,
+  0xf9, 0x99, 0xa7, 0xe1, 0x99, 0x77, 0x05, 0x95, 0x8f, 0x33, 0x8c, 0xd3,
+  0x61, 0x4f, 0x86, 0x2e, 0x9f, 0x20, 0xfb, 0x95, 0x4b, 0xa3, 0x72, 0x45,
+  0x63, 0xed, 0x31, 0x28, 0xb6, 0xe6, 0x53, 0x79, 0x46, 0x7d, 0x05, 0x86,
+  0xc8, 0x76, 0x46, 0x62, 0x86, 0xfd, 0xd2, 0x08, 0x43, 0x30, 0xfe, 0xf8,
+  0x33, 0x42, 0x73, 0x65, 0x24, 0x4e, 0xfd, 0x40, 0x5f, 0xb2, 0xb0, 0x70,
+  0x17, 0xf1, 0x4e, 0x53, 0x9a, 0x8c, 0x4e, 0x40, 0x32, 0x4e, 0x9d, 0x40,
+  0xed, 0x05, 0xae, 0xd6, 0x4c, 0x6f, 0x8d, 0x28, 0x53, 0xbe, 0x9d, 0xbd,
+  0x1e, 0xc0, 0x6e, 0x0e, 0xd8, 0x0f, 0x16, 0xb6, 0x46, 0xa5, 0x4c, 0x1e,
+  0x78, 0xff, 0x2c, 0xe7, 0xc5, 0x66, 0x40, 0x7c, 0x06, 0xc3, 0x0d, 0x78,
+  0x71, 0x85, 0xf1, 0x34, 0x44, 0x59, 0x9c, 0xb5, 0x15, 0x37, 0x3b, 0x82,
+  0x05, 0xc5, 0xa2, 0xb6, 0xb3, 0x77, 0xe7, 0x2c, 0xef, 0xe5, 0xe5, 0xd8,
+  0x07, 0x82, 0x39, 0x5f, 0x81, 0x2e, 0x3a, 0x60, 0x43, 0xc4, 0x4c, 0x4d,
+  0xe6, 0x49, 0x4e, 0xbf, 0x61, 0xe8, 0xda, 0xaa, 0x72, 0xb0, 0xd7, 0x4d,
+  0xf8, 0xb6, 0x84, 0x17, 0x75, 0x39, 0x47, 0x19, 0x1b, 0x10, 0x41, 0xf8,
+  0xc9, 0xce, 0x32, 0x1a, 0x04, 0xea, 0x75, 0x3a, 0x0f, 0x39, 0xef, 0xcb,
+  0x8b, 0x32, 0xac, 0x98, 0x0e, 0x79, 0x55, 0x86, 0x7c, 0x85, 0xcd, 0xdd,
+  0xdf, 0xe8, 0x74, 0x74, 0x6b, 0xdd, 0x2e, 0xc6, 0x6d, 0x94, 0xd4, 0xee,
+  0x21, 0x01, 0xe2, 0x49, 0xdc, 0x28, 0xa6, 0x42, 0x2f, 0xce, 0xcf, 0x45,
+  0x5c, 0x20, 0xb4, 0x4d, 0xfc, 0xe1, 0x15, 0x83, 0x19, 0xa4, 0x93, 0xb1,
+  0xd9, 0x5c, 0x61, 0x65, 0x74, 0x61, 0x6c, 0x65, 0xe2, 0xc2, 0xe8, 0xca,
+  0xb0, 0x49, 0x04, 0x4b, 0x85, 0xda, 0x9e, 0xca, 0x6f, 0x61, 0x12, 0xbe,
+  0x1e, 0xd2, 0xe1, 0xd7, 0x5e, 0xd7, 0xeb, 0x33, 0x7a, 0xcb, 0x03, 0x6e,
+  0x7e, 0xf2, 0x8c, 0xde, 0x4e, 0xcd, 0xe8, 0x61, 0xd2, 0x76, 0xb6, 0xb6,
+  0xf6, 0xc4, 0xe0, 0x56, 0x98, 0x7b, 0x46, 0xaa, 0x77, 0xad, 0xd3, 0x73,
+  0x2d, 0x64, 0x70, 0xbb, 0x6d, 0x9f, 0x9f, 0x93, 0x4a, 0x6c, 0x68, 0xf8,
+  0x91, 0x34, 0x2c, 0x58, 0xe5, 0x90, 0x21, 0xf8, 0x3c, 0x67, 0xf1, 0xa0,
+  0xdb, 0x49, 0x17, 0xe1, 0x36, 0x90, 0x21, 0x01, 0x89, 0x5e, 0x85, 0x3f,
+  0xce, 0x04, 0x2b, 0x18, 0xe7, 0x42, 0xbb, 0xd3, 0xc6, 0x89, 0x5d, 0x48,
+  0x85, 0x37, 0xc1, 0xd2, 0xd9, 0x00, 0xf7, 0xea, 0x15, 0x17, 0xcc, 0x13,
+  0x59, 0xdf, 0x8c, 0xf2, 0x17, 0xea, 0xc2, 0x51, 0x0e, 0xda, 0x05, 0x6d,
+  0x0b, 0xe5, 0x85, 0x8c, 0xe4, 0xbe, 0x98, 0xa7, 0xd4, 0x20, 0x76, 0x1e,
+  0x84, 0x33, 0x71, 0x56, 0xf4, 0x11, 0xa1, 0xc2, 0x75, 0xcc, 0xc5, 0xec,
+  0x8e, 0x8a, 0xa8, 0x52, 0xa4, 0x59, 0xe3, 0x39, 0xa4, 0x37, 0x89, 0x2e,
+  0xe4, 0x51, 0x26, 0x98, 0xdb, 0x35, 0x8f, 0x32, 0x86, 0xfd, 0x44, 0xd7,
+  0xc4, 0x16, 0x80, 0xf4, 0x33, 0xc2, 0x95, 0x26, 0x51, 0x3e, 0x2e, 0x8b,
+  0x1e, 0x5a, 0x4d, 0x61, 0x12, 0x30, 0x52, 0xaa, 0xf5, 0xcb, 0xcf, 0x4a,
+  0x7b, 0xc4, 0xc3, 0xf6, 0x89, 0x65, 0xe4, 0x3d, 0x31, 0xb9, 0xec, 0xc1,
+  0x09, 0x9c, 0x24, 0xbd, 0x9d, 0x32, 0x41, 0x26, 0x48, 0x53, 0xda, 0xc0,
+  0xb3, 0xa9, 0x01, 0x19, 0x96, 0xd4, 0xb2, 0xf2, 0x26, 0xda, 0x19, 0x66,
+  0xbf, 0xec, 0x36, 0xc7, 0x07, 0x07, 0x5b, 0x87, 0x07, 0x40, 0x8d, 0xd1,
+  0xd3, 0xb7, 0x44, 0xa7, 0x92, 0x53, 0xfb, 0x85, 0x49, 0xc8, 0x8d, 0xaa,
+  0xc7, 0xf1, 0xb7, 0x09, 0xb1, 0x6e, 0xdb, 0x2d, 0xfe, 0x53, 0x5f, 0x51,
+  0xcc, 0x49, 0x61, 0x00, 0x11, 0xd4, 0xc5, 0x33, 0xa3, 0xb5, 0x35, 0xd9,
+  0xf5, 0x30, 0xbd, 0xb3, 0x42, 0x2e, 0x0a, 0xc1, 0xf3, 0x15, 0x49, 0x23,
+  0x22, 0xa6, 0x23, 0xca, 0x43, 0x6f, 0x64, 0xc6, 0x6b, 0x1b, 0x24, 0xe0,
+  0x96, 0x7a, 0xbd, 0x71, 0x8f, 0x66, 0x30, 0x44, 0xfb, 0x8e, 0x0d, 0x21,
+  0xb6, 0x2d, 0x7b, 0xb8, 0xb2, 0x02, 0x63, 0xc5, 0x71, 0x60, 0x46, 0x2a,
+  0x67, 0x70, 0x53, 0x34, 0x6d, 0xc2, 0x48, 0xc7, 0xba, 0x43, 0xae, 0xaa,
+  0x48, 0x0e, 0x6e, 0xb5, 0x68, 0x15, 0x5c, 0xad, 0x24, 0x4c, 0x80, 0x0e,
+  0xf2, 0x3b, 0x20, 0x95, 0xcb, 0x3a, 0x4c, 0x1d, 0x60, 0x01, 0x32, 0xe7,
+  0xa0, 0x18, 0x6f, 0x52, 0x4a, 0x63, 0x43, 0x28, 0xb6, 0x33, 0x65, 0x7b,
+  0x6b, 0x8f, 0xe2, 0x9d, 0x67, 0x5e, 0x13, 0x9a, 0x90, 0x22, 0x6e, 0xc1,
+  0x0b, 0x03, 0x87, 0x71, 0xc2, 0xa9, 0x6f, 0x86, 0xe4, 0xc4, 0x22, 0xd1,
+  0x41, 0xae, 0x24, 0x50, 0x72, 0xe7, 0x70, 0xef, 0x40, 0x37, 0x47, 0x3b,
+  0xa0, 0x33, 0x77, 0x40, 0xb5, 0x81, 0x64, 0xec, 0x6f, 0xa5, 0x4e, 0xdb,
+  0x48, 0x92, 0x3d, 0xf4, 0x44, 0xe8, 0xf3, 0x44, 0xec, 0x7b, 0x7c, 0x6a,
+  0xb8, 0x12, 0x19, 0x6d, 0xbb, 0xd4, 0x24, 0xa3, 0x58, 0x56, 0xd1, 0x2a,
+  0x55, 0xbe, 0x49, 0xa9, 0x86, 0x28, 0x7b, 0xcf, 0xa4, 0x46, 0xe1, 0x8b,
+  0x72, 0xa9, 0x9a, 0x6e, 0x45, 0x1f, 0x23, 0x10, 0x24, 0x3c, 0x58, 0x86,
+  0xf3, 0xc1, 0x28, 0x20, 0x39, 0x67, 0x36, 0x9a, 0x38, 0x09, 0xcb, 0x83,
+  0x5c, 0x1f, 0x2a, 0xe2, 0x8a, 0x38, 0xa7, 0xb7, 0x1b, 0xd5, 0x85, 0xb3,
+  0xbb, 0xed, 0x10, 0x09, 0x45, 0xe1, 0x83, 0xac, 0x46, 0xd0, 0x84, 0x2e,
+  0x0b, 0x3d, 0x3a, 0x02, 0xaf, 0x57, 0x2e, 0x34, 0x67, 0xac, 0xef, 0xc9,
+  0x6b, 0x4d, 0xd2, 0xe1, 0xc3, 0x71, 0x62, 0x73, 0x97, 0x03, 0xb6, 0xa4,
+  0x0f, 0xc0, 0xc4, 0x63, 0x66, 0x04, 0x46, 0xb3, 0x3a, 0x75, 0x18, 0x89,
+  0x67, 0x1e, 0x6c, 0x75, 0x0e, 0x45, 0xcf, 0xa2, 0x5f, 0xa7, 0x06, 0xc5,
+  0x45, 0x0d, 0xe5, 0x43, 0x35, 0x22, 0xcc, 0x53, 0xf2, 0x0f, 0x00, 0x4b,
+  0xc8, 0x72, 0x48, 0x8d, 0x5a, 0x9e, 0xa3, 0xf6, 0xb6, 0xae, 0x87, 0x89,
+  0x63, 0x01, 0x65, 0x53, 0x71, 0x88, 0xf0, 0x41, 0x43, 0xda, 0x6c, 0x04,
+  0xb1, 0x81, 0x47, 0x23, 0x85, 0xc7, 0xf0, 0xf6, 0x43, 0x3b, 0x8a, 0xc4,
+  0xb3, 0xe5, 0xe5, 0x6d, 0xce, 0x48, 0xea, 0xe1, 0xc3, 0x96, 0x6e, 0x2c,
+  0x58, 0x2a, 0xef, 0xa3, 0x16, 0xf4, 0x40, 0x13, 0x8f, 0xc4, 0x26, 0xaf,
+  0x92, 0x82, 0x1b, 0x01, 0x7d, 0xac, 0xe8, 0x59, 0x90, 0x2f, 0x3c, 0x6d,
+  0xac, 0x13, 0x21, 0xbe, 0xcc, 0xbb, 0x11, 0xf5, 0x8e, 0xe7, 0x99, 0x30,
+  0x50, 0xf1, 0xc8, 0x40, 0xa6, 0xc8, 0x47, 0x3d, 0x4a, 0x36, 0x0d, 0x87,
+  0x77, 0xc4, 0xb5, 0x14, 0x04, 0xf6, 0x4e, 0x9a, 0x03, 0x53, 0x26, 0x63,
+  0xcd, 0x89, 0x93, 0x3f, 0xf3, 0xae, 0x30, 0xd4, 0x28, 0x46, 0x92, 0x03,
+  0xc0, 0xe1, 0xc6, 0xee, 0x93, 0x1b, 0x8e, 0xcb, 0xff, 0xfd, 0xa7, 0xb4,
+  0x44, 0x44, 0x4b, 0x31, 0x17, 0x56, 0x9f, 0xa3, 0x0c, 0xa7, 0x07, 0x51,
+  0x18, 0xf8, 0xd5, 0xa9, 0x41, 0xe9, 0x84, 0x9e, 0xe9, 0x7b, 0x55, 0x18,
+  0x2b, 0x15, 0x20, 0xf1, 0xdf, 0x3e, 0x04, 0x59, 0x04, 0x4d, 0x10, 0x2f,
+  0x1a, 0x37, 0xa3, 0xc3, 0x44, 0x2b, 0x0c, 0x25, 0x01, 0x2f, 0x9f, 0xea,
+  0x33, 0x09, 0xd7, 0xd3, 0x56, 0x88, 0x77, 0x6e, 0xc8, 0x0a, 0x1c, 0xdf,
+  0x20, 0xf1, 0x93, 0xe4, 0x8f, 0xd0, 0x0c, 0x7c, 0xc6, 0x66, 0xe4, 0x49,
+  0x72, 0x7c, 0xb1, 0x64, 0x6c, 0x5e, 0xd2, 0xa1, 0x6b, 0x7b, 0x44, 0x3e,
+  0xb6, 0xdf, 0xc6, 0xd5, 0x93, 0x31, 0x48, 0x72, 0xa9, 0xe4, 0xef, 0x1c,
+  0xe7, 0xc8, 0xc5, 0x0e, 0x4a, 0xef, 0xd8, 0x38, 0xfa, 0xc3, 0x47, 0xda,
+  0xca, 0x29, 0x95, 0x4a, 0xb2, 0x66, 0xe2, 0x11, 0x0f, 0xa7, 0xfb, 0x0c,
+  0x27, 0xa8, 0xb4, 0xa7, 0x12, 0xc1, 0xdf, 0x71, 0xd7, 0x87, 0xb4, 0x91,
+  0x87, 0x03, 0xd2, 0x73, 0x28, 0x2e, 0xc4, 0x20, 0x56, 0xdb, 0x1c, 0x9d,
+  0xe8, 0x0c, 0x81, 0xf6, 0x95, 0x96, 0xfa, 0x39, 0x2f, 0xb5, 0x76, 0xd4,
+  0x45, 0x7e, 0x5d, 0x5e, 0x4c, 0x2e, 0xc2, 0xf5, 0x00, 0xe4, 0x1d, 0x6d,
+  0xfa, 0x29, 0x74, 0x4e, 0x06, 0xf3, 0x14, 0xfd, 0xcd, 0xb1, 0xa1, 0x81,
+  0xa9, 0x46, 0x8a, 0x95, 0x19, 0x18, 0x0d, 0x03, 0x7a, 0x73, 0x3a, 0x14,
+  0xe9, 0x56, 0x39, 0x17, 0x34, 0xcc, 0xe7, 0xe7, 0x58, 0xd4, 0x8a, 0xf5,
+  0x61, 0x78, 0xb5, 0x2d, 0xc1, 0x5e, 0x9e, 0xe4, 0xef, 0xb4, 0x88, 0x2e,
+  0x5f, 0x92, 0x0c, 0xbf, 0x83, 0xd2, 0x08, 0x79, 0x38, 0xe3, 0x5c, 0x2a,
+  0x02, 0x69, 0x79, 0xbe, 0x8a, 0xe1, 0xc3, 0x67, 0xb0, 0x42, 0x88, 0x8a,
+  0x4a, 0xc1, 0x97, 0x54, 0x64, 0x30, 0x89, 0xcc, 0x7a, 0xb4, 0x26, 0xc1,
+  0x0e, 0x72, 0x0d, 0xe8, 0x11, 0x67, 0xa9, 0x31, 0xac, 0x1f, 0xe5, 0x1e,
+  0x9f, 0x35, 0x25, 0xb6, 0x05, 0x26, 0x09, 0x70, 0x99, 0x7e, 0x55, 0x76,
+  0x51, 0x1a, 0x2b, 0x4f, 0x0f, 0xf3, 0xa3, 0x75, 0x3d, 0xcc, 0xa3, 0x9b,
+  0x21, 0x0c, 0xbf, 0x67, 0x24, 0x1c, 0xd6, 0xa9, 0xf0, 0x11, 0xb1, 0x8d,
+  0x4d, 0x3e, 0x1c, 0x24, 0xf9, 0x4c, 0xbf, 0x91, 0x57, 0xce, 0x65, 0x87,
+  0x57, 0xfc, 0xbd, 0x56, 0xb0, 0x79, 0x43, 0x4d, 0xc3, 0x00, 0x3b, 0x92,
+  0xc7, 0x1e, 0xcb, 0x63, 0x13, 0x46, 0xea, 0x62, 0x30, 0xa8, 0xdb, 0x1e,
+  0x86, 0xdc, 0xa4, 0xe2, 0xa2, 0xde, 0xfc, 0x7c, 0xcf, 0x3a, 0x38, 0x49,
+  0x7d, 0xfa, 0x59, 0xa2, 0x9b, 0x12, 0x4f, 0x8e, 0x7b, 0x8f, 0x19, 0x94,
+  0xc3, 0x73, 0x23, 0xe9, 0xc7, 0x74, 0xa7, 0xec, 0x13, 0x32, 0xa5, 0x07,
+  0xa6, 0x8c, 0x05, 0x7b, 0x5c, 0x61, 0x4f, 0x3d, 0x1b, 0x4c, 0x56, 0x9b,
+  0x1b, 0x09, 0x14, 0xbc, 0x36, 0xc7, 0xd6, 0x8e, 0x30, 0x9d, 0xc1, 0x59,
+  0xbf, 0xfc, 0xbd, 0xe8, 0xc6, 0x8b, 0xa4, 0xe8, 0x07, 0xc9, 0x23, 0xcc,
+  0x50, 0x9f, 0x5c, 0xc7, 0xae, 0x83, 0x7c, 0x59, 0x5a, 0x00, 0x4e, 0x2b,
+  0x45, 0x0b, 0xb2, 0xf3, 0x90, 0x9f, 0x7a, 0x88, 0x5b, 0x5c, 0xa5, 0x24,
+  0xba, 0x19, 0x68, 0x0a, 0xa8, 0x40, 0x99, 0xf2, 0x9d, 0xc7, 0xe0, 0xcf,
+  0xb2, 0xe2, 0x0a, 0x09, 0xa5, 0x2c, 0xa7, 0x02, 0xe0, 0xf0, 0x15, 0xfb,
+  0xfd, 0xf2, 0xda, 0xe5, 0xfd, 0xf8, 0xf1, 0x2d, 0x56, 0x14, 0x74, 0xb5,
+  0x85, 0x8d, 0xd6, 0x47, 0x9f, 0x08, 0x1d, 0x12, 0xd6, 0x0a, 0x7b, 0x20,
+  0x14, 0x0a, 0xa5, 0xe9, 0x54, 0x3b, 0x63, 0x69, 0xac, 0x86, 0x0a, 0x68,
+  0x15, 0xeb, 0x27, 0xa7, 0xda, 0xd1, 0xfc, 0x5c, 0xd0, 0xaf, 0xb3, 0x52,
+  0x49, 0xfc, 0x31, 0x6d, 0xf2, 0xf7, 0x70, 0xa2, 0x45, 0x09, 0xb0, 0x9f,
+  0x1d, 0x26, 0x55, 0x53, 0xf0, 0xe0, 0x33, 0xec, 0x98, 0x72, 0x73, 0xd3,
+  0x23, 0x66, 0x3e, 0xfc, 0x64, 0x25, 0x4a, 0x35, 0x5d, 0x8a, 0x2f, 0xe3,
+  0x22, 0x6f, 0xb3, 0x9f, 0xa5, 0xbd, 0xdb, 0xee, 0x51, 0x0d, 0xe0, 0x1e,
+  0x7f, 0x5d, 0xe7, 0xa2, 0x4f, 0xd6, 0x1c, 0x5f, 0x39, 0xf4, 0xd7, 0x74,
+  0xb6, 0xfd, 0x4a, 0x9f, 0x59, 0xd7, 0x79, 0xe4, 0x3d, 0xba, 0x97, 0x6e,
+  0x58, 0x5d, 0xaf, 0xb2, 0x45, 0x7a, 0x61, 0x49, 0x9f, 0xa2, 0x7d, 0xdd,
+  0x1d, 0x70, 0x5d, 0x5c, 0x00, 0xd7, 0xa4, 0x5f, 0x3f, 0x71, 0x14, 0xaf,
+  0x02, 0x9b, 0xe2, 0xa8, 0x0a, 0xe5, 0x65, 0x8b, 0x64, 0xff, 0xff, 0x4f,
+  0xb5, 0x49, 0x8c, 0x28, 0x81, 0xac, 0xfa, 0x4f, 0x6b, 0xe1, 0xa9, 0xec,
+  0x94, 0xd9, 0x25, 0xcc, 0x59, 0x6c, 0x4a, 0x16, 0x62, 0xbc, 0x12, 0xa3,
+  0x82, 0xbe, 0x4c, 0x4b, 0x1c, 0x2e, 0x9a, 0x49, 0x3f, 0x9e, 0x1c, 0x96,
+  0xb1, 0xa5, 0x5c, 0x88, 0x41, 0x04, 0xf2, 0x98, 0x7e, 0x54, 0x75, 0x5a,
+  0x6d, 0x35, 0x2b, 0x09, 0x45, 0x55, 0xe7, 0x93, 0x31, 0xae, 0x71, 0x9b,
+  0x42, 0x02, 0xef, 0x8c, 0x37, 0xd6, 0x92, 0x43, 0x0b, 0x31, 0x61, 0x33,
+  0x0c, 0x8f, 0x55, 0x18, 0x6c, 0x35, 0xdb, 0xe1, 0xaf, 0x46, 0x03, 0x36,
+  0x60, 0x90, 0xca, 0x2b, 0xef, 0xe2, 0x6e, 0xa3, 0xe8, 0xe9, 0x91, 0x44,
+  0x73, 0x24, 0xe4, 0xfd, 0xf4, 0xa1, 0xac, 0x04, 0x24, 0xc7, 0xa0, 0x08,
+  0x65, 0x33, 0x15, 0x9f, 0xa7, 0x74, 0x7e, 0x5e, 0x97, 0x15, 0x1b, 0xf3,
+  0x03, 0xb9, 0x1c, 0x1c, 0x76, 0xf6, 0xb3, 0xcd, 0x4e, 0xf1, 0x9b, 0x44,
+  0xfa, 0xe8, 0x11, 0x7f, 0xfa, 0x78, 0xd6, 0x83, 0x1d, 0xb1, 0x27, 0x6c,
+  0x1b, 0x5a, 0x86, 0x3d, 0xff, 0x04, 0x44, 0xa3, 0x16, 0x3c, 0x56, 0xca,
+  0x69, 0x2c, 0x38, 0xf4, 0xbd, 0xb8, 0xea, 0x4f, 0x9f, 0xaa, 0x40, 0x79,
+  0x3e, 0xe9, 0xbf, 0xb7, 0x2b, 0x9f, 0x98, 0x3c, 0xcb, 0x01, 0x9e, 0x83,
+  0x3f, 0x7d, 0xc6, 0x04, 0xe4, 0x4c, 0x2b, 0x16, 0x4b, 0xdc, 0x14, 0x5d,
+  0xcc, 0xec, 0x35, 0x0c, 0xaf, 0xa8, 0x06, 0xb0, 0x15, 0xe1, 0xfd, 0x52,
+  0x1d, 0xfa, 0x7d, 0x71, 0xe3, 0x2b, 0xbc, 0xd1, 0xa4, 0x86, 0x65, 0x9f,
+  0x94, 0xbb, 0xf8, 0x80, 0xbe, 0x8a, 0x13, 0xd2, 0xe7, 0x0a, 0xb6, 0xd8,
+  0x47, 0xc7, 0x33, 0xb9, 0x7a, 0x83, 0x3e, 0x49, 0xfb, 0xd9, 0x21, 0x47,
+  0xc1, 0x85, 0x50, 0x4e, 0xc9, 0x9e, 0x82, 0xe5, 0xba, 0x56, 0x2f, 0xcf,
+  0xaf, 0x33, 0xc5, 0x51, 0x39, 0xf9, 0x59, 0x42, 0x09, 0x7b, 0x33, 0x71,
+  0x9d, 0xa1, 0x28, 0xa7, 0x48, 0x43, 0xf2, 0xf2, 0x43, 0x7e, 0xb9, 0x56,
+  0x84, 0xd9, 0xda, 0x31, 0x6d, 0xb5, 0x76, 0x0b, 0x3e, 0x7b, 0x04, 0x5b,
+  0xaf, 0x37, 0x44, 0x98, 0x1d, 0xc2, 0x1b, 0x22, 0x28, 0xbc, 0x40, 0x4c,
+  0x10, 0x8a, 0xbc, 0x62, 0x06, 0x08, 0xb5, 0x40, 0x70, 0xe0, 0x9e, 0x46,
+  0xdd, 0x20, 0x5a, 0xe7, 0x76, 0x13, 0x04, 0x6c, 0x10, 0x0c, 0xa6, 0x93,
+  0x98, 0x20, 0x38, 0x09, 0x30, 0x35, 0x42, 0x3c, 0x23, 0x72, 0x83, 0x17,
+  0xdf, 0x47, 0x0e, 0x98, 0xf0, 0x8d, 0x08, 0x07, 0x6e, 0x44, 0xb0, 0x34,
+  0x4f, 0xf2, 0x58, 0x3f, 0x2d, 0x0c, 0x07, 0x5e, 0xcf, 0x20, 0x96, 0x8c,
+  0xf2, 0xd1, 0x8d, 0x98, 0x3c, 0xda, 0x1c, 0x15, 0x50, 0x5a, 0xd4, 0x30,
+  0xbb, 0x99, 0xf0, 0x9a, 0x46, 0x5a, 0x87, 0x39, 0xd7, 0x55, 0x90, 0x67,
+  0xc2, 0x94, 0xc8, 0x3e, 0x6c, 0x50, 0xb9, 0xc9, 0x7a, 0x3e, 0xc5, 0x7a,
+  0x9e, 0x04, 0xf1, 0xbd, 0x3f, 0x6e, 0x61, 0xaf, 0x3c, 0x81, 0x94, 0x55,
+  0x94, 0x80, 0x61, 0x71, 0x14, 0x64, 0x4a, 0xf5, 0x2e, 0xbb, 0xb2, 0x29,
+  0xdc, 0x1c, 0x18, 0xfd, 0xa0, 0x87, 0x32, 0x87, 0x15, 0x17, 0xd7, 0xb4,
+  0xad, 0x3c, 0xcd, 0xc7, 0x26, 0xc8, 0xaa, 0xed, 0x73, 0x05, 0xdd, 0x5b,
+  0x39, 0x5a, 0x5c, 0x80, 0x5c, 0xc4, 0xf9, 0x2c, 0x5c, 0x7e, 0x5a, 0xe2,
+  0x1e, 0xe1, 0x54, 0x39, 0xe3, 0x9c, 0xa8, 0x77, 0x94, 0xf2, 0xbe, 0x50,
+  0xcc, 0x32, 0x5a, 0x12, 0xa8, 0xb6, 0x16, 0xe7, 0xe4, 0xb2, 0xf7, 0x45,
+  0xa4, 0x2a, 0x22, 0x2b, 0x78, 0x06, 0xc2, 0x50, 0x28, 0x91, 0x8f, 0x32,
+  0x5d, 0xa0, 0xec, 0x69, 0xcd, 0xc7, 0xf9, 0xb9, 0x41, 0x5f, 0x5c, 0x75,
+  0x14, 0xec, 0x05, 0x73, 0x5e, 0x9f, 0x28, 0x40, 0xac, 0x44, 0xa1, 0xcb,
+  0x97, 0x6f, 0x7e, 0xe8, 0x98, 0x27, 0x92, 0x84, 0xcd, 0xe2, 0x9a, 0x34,
+  0x62, 0x14, 0x61, 0x22, 0x59, 0x58, 0x09, 0x45, 0x70, 0x08, 0x60, 0x6e,
+  0xac, 0x26, 0xc7, 0x17, 0xe4, 0xd2, 0xeb, 0x73, 0x9e, 0x88, 0x65, 0xc1,
+  0x84, 0x67, 0x49, 0xca, 0x7c, 0xc0, 0xde, 0x1e, 0x2a, 0x23, 0x8e, 0xfa,
+  0xe1, 0x14, 0x27, 0xda, 0xcf, 0x7e, 0x28, 0xc7, 0x3f, 0x4e, 0x8e, 0x9f,
+  0x9b, 0x13, 0xef, 0x2c, 0xb4, 0x37, 0x39, 0xa6, 0x40, 0xdb, 0x65, 0x6a,
+  0x95, 0xff, 0x41, 0x7b, 0xd5, 0xfc, 0xfc, 0xc6, 0x9b, 0xc3, 0x1f, 0xf7,
+  0x0e, 0x64, 0x60, 0xaf, 0xf2, 0x7e, 0x58, 0xb8, 0xac, 0x33, 0x2e, 0xfa,
+  0x81, 0xf5, 0x9d, 0x29, 0xad, 0x20, 0x8c, 0x9a, 0x8e, 0xd9, 0x60, 0x24,
+  0x08, 0xd4, 0x80, 0x37, 0x39, 0x1f, 0x08, 0x27, 0xe3, 0x72, 0xe0, 0x7d,
+  0xce, 0x72, 0x19, 0x70, 0x38, 0x24, 0xda, 0x4b, 0x0a, 0x2e, 0x69, 0x60,
+  0x79, 0x76, 0xf8, 0xe3, 0xc6, 0xee, 0x5f, 0x3b, 0xea, 0x25, 0x7e, 0xf7,
+  0xee, 0x5d, 0xea, 0x73, 0x84, 0x88, 0x5e, 0x15, 0xf3, 0xf3, 0x9d, 0xad,
+  0xad, 0x6c, 0x63, 0xa7, 0xb3, 0xc7, 0x5f, 0x9f, 0x8e, 0x87, 0x8b, 0xab,
+  0x4b, 0x41, 0xd8, 0x3d, 0x2b, 0xc6, 0xe1, 0x97, 0xf9, 0xf9, 0xff, 0x07,
+  0xce, 0x9d, 0x83, 0xdc, 0x10, 0x3e, 0x04, 0x00,
+};
+#define BUF_SIZE 0x10000
+static voidpf zalloc_func(voidpf opaque, unsigned int items, unsigned int size)
+{
+  (void)opaque;
+  /* not a typo, keep it calloc() */
+  return (voidpf) calloc(items, size);
+}
+static void zfree_func(voidpf opaque, voidpf ptr)
+{
+  (void)opaque;
+  free(ptr);
+}
+
+#define HEADERLEN 10
+
+/* Decompress and send to stdout a gzip-compressed buffer */
+void hugehelp(void)
+{
+  unsigned char *buf;
+  int status;
+  z_stream z;
+
+  /* Make sure no gzip options are set */
+  if(hugehelpgz[3] & 0xfe)
+    return;
+
+  memset(&z, 0, sizeof(z_stream));
+  z.zalloc = (alloc_func)zalloc_func;
+  z.zfree = (free_func)zfree_func;
+  z.avail_in = (uInt)(sizeof(hugehelpgz) - HEADERLEN);
+  z.next_in = (z_const Bytef *)hugehelpgz + HEADERLEN;
+
+  if(inflateInit2(&z, -MAX_WBITS) != Z_OK)
+    return;
+
+  buf = malloc(BUF_SIZE);
+  if(buf) {
+    while(1) {
+      z.avail_out = BUF_SIZE;
+      z.next_out = buf;
+      status = inflate(&z, Z_SYNC_FLUSH);
+      if(status == Z_OK || status == Z_STREAM_END) {
+        fwrite(buf, BUF_SIZE - z.avail_out, 1, stdout);
+        if(status == Z_STREAM_END)
+          break;
+      }
+      else
+        break;    /* error */
+    }
+    free(buf);
+  }
+  inflateEnd(&z);
+}
+/* Show the help text for the 'arg' curl argument on stdout */
+void showhelp(const char *trigger, const char *arg, const char *endarg)
+{
+  unsigned char *buf;
+  int status;
+  z_stream z;
+  struct scan_ctx ctx;
+  inithelpscan(&ctx, trigger, arg, endarg);
+
+  /* Make sure no gzip options are set */
+  if(hugehelpgz[3] & 0xfe)
+    return;
+
+  memset(&z, 0, sizeof(z_stream));
+  z.zalloc = (alloc_func)zalloc_func;
+  z.zfree = (free_func)zfree_func;
+  z.avail_in = (uInt)(sizeof(hugehelpgz) - HEADERLEN);
+  z.next_in = (z_const Bytef *)hugehelpgz + HEADERLEN;
+
+  if(inflateInit2(&z, -MAX_WBITS) != Z_OK)
+    return;
+
+  buf = malloc(BUF_SIZE);
+  if(buf) {
+    while(1) {
+      z.avail_out = BUF_SIZE;
+      z.next_out = buf;
+      status = inflate(&z, Z_SYNC_FLUSH);
+      if(status == Z_OK || status == Z_STREAM_END) {
+        size_t len = BUF_SIZE - z.avail_out;
+        if(!helpscan(buf, len, &ctx))
+          break;
+        if(status == Z_STREAM_END)
+          break;
+      }
+      else
+        break;    /* error */
+    }
+    free(buf);
+  }
+  inflateEnd(&z);
+}
+#endif /* USE_MANUAL */
+#endif /* HAVE_LIBZ */
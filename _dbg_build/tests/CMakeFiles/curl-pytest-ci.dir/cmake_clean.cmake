@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curl-pytest-ci"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/curl-pytest-ci.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
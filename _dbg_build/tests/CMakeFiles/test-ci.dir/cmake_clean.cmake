@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test-ci"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/test-ci.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
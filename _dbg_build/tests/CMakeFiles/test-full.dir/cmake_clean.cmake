@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test-full"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/test-full.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
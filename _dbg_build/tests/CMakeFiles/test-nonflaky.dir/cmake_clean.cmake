@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test-nonflaky"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/test-nonflaky.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,61 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_dbg_build/tests/certs/test-ca.crt" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  "/root/repo/_dbg_build/tests/certs/test-ca.key" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  "/root/repo/_dbg_build/tests/certs/test-client-cert.crl" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  "/root/repo/_dbg_build/tests/certs/test-client-cert.crt" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  "/root/repo/_dbg_build/tests/certs/test-client-cert.key" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  "/root/repo/_dbg_build/tests/certs/test-client-cert.pem" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  "/root/repo/_dbg_build/tests/certs/test-client-cert.pub.der" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  "/root/repo/_dbg_build/tests/certs/test-client-cert.pub.pem" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  "/root/repo/_dbg_build/tests/certs/test-localhost-san-first.crl" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  "/root/repo/_dbg_build/tests/certs/test-localhost-san-first.crt" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  "/root/repo/_dbg_build/tests/certs/test-localhost-san-first.key" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  "/root/repo/_dbg_build/tests/certs/test-localhost-san-first.pem" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  "/root/repo/_dbg_build/tests/certs/test-localhost-san-first.pub.der" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  "/root/repo/_dbg_build/tests/certs/test-localhost-san-first.pub.pem" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  "/root/repo/_dbg_build/tests/certs/test-localhost-san-last.crl" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  "/root/repo/_dbg_build/tests/certs/test-localhost-san-last.crt" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  "/root/repo/_dbg_build/tests/certs/test-localhost-san-last.key" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  "/root/repo/_dbg_build/tests/certs/test-localhost-san-last.pem" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  "/root/repo/_dbg_build/tests/certs/test-localhost-san-last.pub.der" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  "/root/repo/_dbg_build/tests/certs/test-localhost-san-last.pub.pem" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  "/root/repo/_dbg_build/tests/certs/test-localhost.crl" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  "/root/repo/_dbg_build/tests/certs/test-localhost.crt" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  "/root/repo/_dbg_build/tests/certs/test-localhost.key" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  "/root/repo/_dbg_build/tests/certs/test-localhost.nn.crl" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  "/root/repo/_dbg_build/tests/certs/test-localhost.nn.crt" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  "/root/repo/_dbg_build/tests/certs/test-localhost.nn.key" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  "/root/repo/_dbg_build/tests/certs/test-localhost.nn.pem" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  "/root/repo/_dbg_build/tests/certs/test-localhost.nn.pub.der" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  "/root/repo/_dbg_build/tests/certs/test-localhost.nn.pub.pem" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  "/root/repo/_dbg_build/tests/certs/test-localhost.pem" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  "/root/repo/_dbg_build/tests/certs/test-localhost.pub.der" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  "/root/repo/_dbg_build/tests/certs/test-localhost.pub.pem" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  "/root/repo/_dbg_build/tests/certs/test-localhost0h.crl" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  "/root/repo/_dbg_build/tests/certs/test-localhost0h.crt" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  "/root/repo/_dbg_build/tests/certs/test-localhost0h.key" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  "/root/repo/_dbg_build/tests/certs/test-localhost0h.pem" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  "/root/repo/_dbg_build/tests/certs/test-localhost0h.pub.der" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  "/root/repo/_dbg_build/tests/certs/test-localhost0h.pub.pem" "/root/repo/_dbg_build/tests/certs/test-ca.cacert"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
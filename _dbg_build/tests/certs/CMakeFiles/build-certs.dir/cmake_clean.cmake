@@ -0,0 +1,47 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/build-certs"
+  "test-ca.cacert"
+  "test-ca.crt"
+  "test-ca.key"
+  "test-client-cert.crl"
+  "test-client-cert.crt"
+  "test-client-cert.key"
+  "test-client-cert.pem"
+  "test-client-cert.pub.der"
+  "test-client-cert.pub.pem"
+  "test-localhost-san-first.crl"
+  "test-localhost-san-first.crt"
+  "test-localhost-san-first.key"
+  "test-localhost-san-first.pem"
+  "test-localhost-san-first.pub.der"
+  "test-localhost-san-first.pub.pem"
+  "test-localhost-san-last.crl"
+  "test-localhost-san-last.crt"
+  "test-localhost-san-last.key"
+  "test-localhost-san-last.pem"
+  "test-localhost-san-last.pub.der"
+  "test-localhost-san-last.pub.pem"
+  "test-localhost.crl"
+  "test-localhost.crt"
+  "test-localhost.key"
+  "test-localhost.nn.crl"
+  "test-localhost.nn.crt"
+  "test-localhost.nn.key"
+  "test-localhost.nn.pem"
+  "test-localhost.nn.pub.der"
+  "test-localhost.nn.pub.pem"
+  "test-localhost.pem"
+  "test-localhost.pub.der"
+  "test-localhost.pub.pem"
+  "test-localhost0h.crl"
+  "test-localhost0h.crt"
+  "test-localhost0h.key"
+  "test-localhost0h.pem"
+  "test-localhost0h.pub.der"
+  "test-localhost0h.pub.pem"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/build-certs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libtests.dir/libtests.c.o"
+  "CMakeFiles/libtests.dir/libtests.c.o.d"
+  "lib1521.c"
+  "libtests"
+  "libtests.c"
+  "libtests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libtests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
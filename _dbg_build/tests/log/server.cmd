@@ -0,0 +1 @@
+Testnum 3221
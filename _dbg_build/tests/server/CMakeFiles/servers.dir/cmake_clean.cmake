@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/servers.dir/servers.c.o"
+  "CMakeFiles/servers.dir/servers.c.o.d"
+  "servers"
+  "servers.c"
+  "servers.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/servers.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
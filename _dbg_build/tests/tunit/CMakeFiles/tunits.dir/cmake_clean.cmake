@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tunits.dir/tunits.c.o"
+  "CMakeFiles/tunits.dir/tunits.c.o.d"
+  "tunits"
+  "tunits.c"
+  "tunits.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tunits.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/units.dir/units.c.o"
+  "CMakeFiles/units.dir/units.c.o.d"
+  "units"
+  "units.c"
+  "units.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/units.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -960,6 +960,13 @@ typedef enum {
 /* If possible, send data using TLS 1.3 early data */
 #define CURLSSLOPT_EARLYDATA (1L<<6)
 
+/* If possible, let the kernel encrypt and decrypt TLS records (kTLS) */
+#define CURLSSLOPT_KTLS (1L<<7)
+
+/* Like CURLSSLOPT_EARLYDATA, but only for requests that are safe to replay,
+   like HTTP GET and HEAD */
+#define CURLSSLOPT_EARLYDATA_SAFE (1L<<8)
+
 /* The default connection attempt delay in milliseconds for happy eyeballs.
    CURLOPT_HAPPY_EYEBALLS_TIMEOUT_MS.3 and happy-eyeballs-timeout-ms.d document
    this value, keep them in sync. */
@@ -2258,6 +2265,32 @@ typedef enum {
   /* set TLS supported signature algorithms */
   CURLOPT(CURLOPT_SSL_SIGNATURE_ALGORITHMS, CURLOPTTYPE_STRINGPOINT, 328),
 
+  /* upload data from application owned buffers, an array of
+     'struct curl_iovec' */
+  CURLOPT(CURLOPT_UPLOAD_IOV, CURLOPTTYPE_OBJECTPOINT, 329),
+
+  /* seconds to keep failed name resolves in the DNS cache */
+  CURLOPT(CURLOPT_DNS_NEGATIVE_TIMEOUT, CURLOPTTYPE_LONG, 330),
+
+  /* file to load the DNS cache from and save it to */
+  CURLOPT(CURLOPT_DNS_CACHE_FILE, CURLOPTTYPE_STRINGPOINT, 331),
+
+  /* seconds an expired DNS cache entry is still used while it is
+     resolved again in the background */
+  CURLOPT(CURLOPT_DNS_STALE_TIMEOUT, CURLOPTTYPE_LONG, 332),
+
+  /* file to keep the parsed certificates of the CA bundle in */
+  CURLOPT(CURLOPT_CA_CACHE_FILE, CURLOPTTYPE_STRINGPOINT, 333),
+
+  /* largest size in bytes HTTP/2 stream windows are grown to */
+  CURLOPT(CURLOPT_HTTP2_WINDOW_MAX, CURLOPTTYPE_LONG, 334),
+
+  /* RFC 9218 urgency, 0 - 7, of the stream */
+  CURLOPT(CURLOPT_STREAM_URGENCY, CURLOPTTYPE_LONG, 335),
+
+  /* set to 1 to have the stream response delivered incrementally */
+  CURLOPT(CURLOPT_STREAM_INCREMENTAL, CURLOPTTYPE_LONG, 336),
+
   CURLOPT_LASTENTRY /* the last unused */
 } CURLoption;
 
@@ -3041,6 +3074,7 @@ typedef enum {
   CURL_LOCK_DATA_CONNECT,
   CURL_LOCK_DATA_PSL,
   CURL_LOCK_DATA_HSTS,
+  CURL_LOCK_DATA_CA,
   CURL_LOCK_DATA_LAST
 } curl_lock_data;
 
@@ -3079,6 +3113,12 @@ typedef enum {
   CURLSHOPT_UNLOCKFUNC, /* pass in a 'curl_unlock_function' pointer */
   CURLSHOPT_USERDATA,   /* pass in a user data pointer used in the lock/unlock
                            callback functions */
+  CURLSHOPT_DNS_SHARDS, /* number of independently locked parts of the
+                           shared DNS cache */
+  CURLSHOPT_CONNECT_SHARDS, /* number of independently locked parts of the
+                               shared connection pool */
+  CURLSHOPT_SSL_SESSION_SHARDS, /* number of independently locked parts of
+                                   the shared SSL session cache */
   CURLSHOPT_LAST  /* never use */
 } CURLSHoption;
 
@@ -3310,6 +3350,30 @@ CURL_EXTERN CURLcode curl_easy_ssls_export(CURL *handle,
                                            curl_ssls_export_cb *export_fn,
                                            void *userptr);
 
+/*
+ * NAME curl_share_ssls_export()
+ *
+ * DESCRIPTION
+ *
+ * The curl_share_ssls_export function stores all SSL sessions of the
+ * share in one newly allocated buffer, to be freed with curl_free().
+ */
+CURL_EXTERN CURLcode curl_share_ssls_export(CURLSH *share,
+                                            unsigned char **bufp,
+                                            size_t *lenp);
+
+/*
+ * NAME curl_share_ssls_import()
+ *
+ * DESCRIPTION
+ *
+ * The curl_share_ssls_import function adds all SSL sessions from a buffer
+ * made by curl_share_ssls_export() to the SSL session cache of the share.
+ */
+CURL_EXTERN CURLcode curl_share_ssls_import(CURLSH *share,
+                                            const unsigned char *buf,
+                                            size_t len);
+
 
 #ifdef __cplusplus
 } /* end of extern "C" */
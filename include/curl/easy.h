@@ -38,6 +38,13 @@ struct curl_blob {
                          left zeroes */
 };
 
+/* One upload buffer for CURLOPT_UPLOAD_IOV. An array of these ends with an
+   entry where 'base' is NULL. */
+struct curl_iovec {
+  const void *base;
+  size_t len;
+};
+
 CURL_EXTERN CURL *curl_easy_init(void);
 CURL_EXTERN CURLcode curl_easy_setopt(CURL *curl, CURLoption option, ...);
 CURL_EXTERN CURLcode curl_easy_perform(CURL *curl);
@@ -398,6 +398,21 @@ typedef enum {
   /* network has changed, adjust caches/connection reuse */
   CURLOPT(CURLMOPT_NETWORK_CHANGED, CURLOPTTYPE_LONG, 17),
 
+  /* set to 1 to have curl_multi_poll()/curl_multi_wait() use epoll() */
+  CURLOPT(CURLMOPT_EPOLL, CURLOPTTYPE_LONG, 18),
+
+  /* set to 1 to batch socket receives of all transfers using io_uring */
+  CURLOPT(CURLMOPT_IO_URING, CURLOPTTYPE_LONG, 19),
+
+  /* maximum number of threads resolving names, 0 for one per lookup */
+  CURLOPT(CURLMOPT_RESOLVE_THREADS, CURLOPTTYPE_LONG, 20),
+
+  /* maximum number of name resolves waiting for a thread, 0 for no limit */
+  CURLOPT(CURLMOPT_RESOLVE_QUEUE, CURLOPTTYPE_LONG, 21),
+
+  /* maximum number of threads verifying TLS certificates, 0 for none */
+  CURLOPT(CURLMOPT_VERIFY_THREADS, CURLOPTTYPE_LONG, 22),
+
   CURLMOPT_LASTENTRY /* the last unused */
 } CURLMoption;
 
@@ -464,7 +479,19 @@ typedef enum {
    * be read via `curl_multi_info_read()`. */
   CURLMINFO_XFERS_DONE = 4,
   /* The total number of easy handles added to the multi handle, ever. */
-  CURLMINFO_XFERS_ADDED = 5
+  CURLMINFO_XFERS_ADDED = 5,
+  /* The number of failed name resolves stored in the DNS cache, ever. */
+  CURLMINFO_DNS_NEGATIVE_ADDED = 6,
+  /* The number of name resolves that failed because of a failure stored
+   * in the DNS cache, ever. */
+  CURLMINFO_DNS_NEGATIVE_HITS = 7,
+  /* The number of name resolves answered by the DNS cache, ever. */
+  CURLMINFO_DNS_HITS = 8,
+  /* The number of name resolves answered by an expired DNS cache entry
+   * while it was resolved again, ever. */
+  CURLMINFO_DNS_STALE_HITS = 9,
+  /* The number of name resolves not in the DNS cache, ever. */
+  CURLMINFO_DNS_MISSES = 10
 } CURLMinfo_offt;
 
 /*
@@ -518,6 +545,20 @@ CURL_EXTERN CURLMcode curl_multi_waitfds(CURLM *multi,
                                          unsigned int size,
                                          unsigned int *fd_count);
 
+/*
+ * Name:    curl_multi_prewarm()
+ *
+ * Desc:    Keeps `num` idle connections open to where the easy handle's
+ *          URL and options take transfers, for transfers added later to
+ *          reuse. The multi handle keeps a copy of the easy handle. Pass
+ *          zero `num` to stop.
+ *
+ * Returns: CURLMcode type, general multi error code.
+ */
+CURL_EXTERN CURLMcode curl_multi_prewarm(CURLM *multi_handle,
+                                         CURL *easy_handle,
+                                         unsigned int num);
+
 #ifdef __cplusplus
 } /* end of extern "C" */
 #endif
@@ -148,6 +148,9 @@
           if((option) == CURLOPT_MIMEPOST)                              \
             if(!curlcheck_ptr((value), curl_mime))                      \
               _curl_easy_setopt_err_curl_mimepost();                    \
+          if((option) == CURLOPT_UPLOAD_IOV)                            \
+            if(!curlcheck_arr((value), struct curl_iovec))              \
+              _curl_easy_setopt_err_curl_iovec();                       \
           if(curlcheck_slist_option(option))                            \
             if(!curlcheck_arr((value), struct curl_slist))              \
               _curl_easy_setopt_err_curl_slist();                       \
@@ -355,6 +358,8 @@ CURLWARNING(_curl_easy_setopt_err_curl_httpost,
 CURLWARNING(_curl_easy_setopt_err_curl_mimepost,
             "curl_easy_setopt expects a 'curl_mime *' "
             "argument")
+CURLWARNING(_curl_easy_setopt_err_curl_iovec,
+            "curl_easy_setopt expects a 'struct curl_iovec *' argument")
 CURLWARNING(_curl_easy_setopt_err_curl_slist,
             "curl_easy_setopt expects a 'struct curl_slist *' argument")
 CURLWARNING(_curl_easy_setopt_err_CURLSH,
@@ -400,6 +405,7 @@ CURLWARNING(_curl_easy_getinfo_err_curl_off_t,
    (option) == CURLOPT_ALTSVC ||                                        \
    (option) == CURLOPT_CAINFO ||                                        \
    (option) == CURLOPT_CAPATH ||                                        \
+   (option) == CURLOPT_CA_CACHE_FILE ||                                 \
    (option) == CURLOPT_COOKIE ||                                        \
    (option) == CURLOPT_COOKIEFILE ||                                    \
    (option) == CURLOPT_COOKIEJAR ||                                     \
@@ -407,6 +413,7 @@ CURLWARNING(_curl_easy_getinfo_err_curl_off_t,
    (option) == CURLOPT_CRLFILE ||                                       \
    (option) == CURLOPT_CUSTOMREQUEST ||                                 \
    (option) == CURLOPT_DEFAULT_PROTOCOL ||                              \
+   (option) == CURLOPT_DNS_CACHE_FILE ||                                \
    (option) == CURLOPT_DNS_INTERFACE ||                                 \
    (option) == CURLOPT_DNS_LOCAL_IP4 ||                                 \
    (option) == CURLOPT_DNS_LOCAL_IP6 ||                                 \
@@ -63,8 +63,11 @@
 #include "url.h"
 #include "multiif.h"
 #include "curl_threads.h"
+#include "thrdpool.h"
 #include "select.h"
 #include "strdup.h"
+#include "strcase.h"
+#include "curlx/wait.h"
 
 #ifdef USE_ARES
 #include <ares.h>
@@ -348,6 +351,337 @@ static CURL_THREAD_RETURN_T CURL_STDCALL gethostbyname_thread(void *arg)
 
 #endif /* HAVE_GETADDRINFO */
 
+#ifdef USE_RESOLV_POOL
+/*
+ * The resolver pool of a multi handle. A limited number of worker threads
+ * take lookups from a queue. Transfers that want the same host, port and
+ * hints while a lookup is queued or running wait for that lookup instead of
+ * starting another one.
+ */
+
+/* longer host names are resolved in a thread of their own */
+#define THRDD_MAX_NAME_LEN 255
+
+/* One lookup and the transfers waiting for it */
+struct async_thrdd_job {
+  struct Curl_llist_node node;  /* in the pool's queue */
+  struct Curl_llist waiters;    /* of struct async_thrdd_addr_ctx */
+  char *hostname;
+  int port;
+#ifdef HAVE_GETADDRINFO
+  struct addrinfo hints;
+#endif
+  size_t idlen;
+  char id[1];                   /* key in the pool's `jobs` */
+};
+
+struct async_thrdd_pool {
+  struct Curl_thrdpool *tpool; /* the workers, its lock protects `jobs` */
+  struct Curl_hash jobs;   /* queued and running jobs, by id */
+  unsigned int max_threads;
+  size_t max_queue;        /* 0 for no limit */
+};
+
+static void async_thrdd_job_free(struct async_thrdd_job *job)
+{
+  free(job->hostname);
+  free(job);
+}
+
+/* Hand the result of `job` to all its waiters and free it. */
+static void async_thrdd_job_done(struct async_thrdd_job *job,
+                                 struct Curl_addrinfo *res, int sock_error)
+{
+  struct Curl_llist_node *e;
+
+  for(e = Curl_llist_head(&job->waiters); e;
+      e = Curl_llist_head(&job->waiters)) {
+    struct async_thrdd_addr_ctx *addr_ctx = Curl_node_elem(e);
+    bool do_abort;
+
+    Curl_node_remove(e);
+    Curl_mutex_acquire(&addr_ctx->mutx);
+    do_abort = addr_ctx->do_abort;
+    if(!do_abort) {
+      /* the last one waiting gets the original */
+      if(Curl_llist_head(&job->waiters) && res) {
+        addr_ctx->res = Curl_addrinfo_dup(res);
+        if(!addr_ctx->res)
+          addr_ctx->sock_error = RESOLVER_ENOMEM;
+      }
+      else {
+        addr_ctx->res = res;
+        addr_ctx->sock_error = sock_error;
+        res = NULL;
+      }
+    }
+    Curl_mutex_release(&addr_ctx->mutx);
+#ifndef CURL_DISABLE_SOCKETPAIR
+    if(!do_abort) {
+#ifdef USE_EVENTFD
+      const uint64_t buf[1] = { 1 };
+#else
+      const char buf[1] = { 1 };
+#endif
+      /* lookup is done, notify transfer */
+      if(wakeup_write(addr_ctx->sock_pair[1], buf, sizeof(buf)) < 0) {
+        /* update sock_error to errno */
+        addr_ctx->sock_error = SOCKERRNO;
+      }
+    }
+#endif
+    addr_ctx_unlink(&addr_ctx, NULL);
+  }
+  if(res)
+    Curl_freeaddrinfo(res);
+  async_thrdd_job_free(job);
+}
+
+/* TRUE when at least one transfer still waits for `job`.
+ * Called with the pool locked. */
+static bool async_thrdd_job_wanted(struct async_thrdd_job *job)
+{
+  struct Curl_llist_node *e;
+  bool wanted = FALSE;
+
+  for(e = Curl_llist_head(&job->waiters); e && !wanted;
+      e = Curl_node_next(e)) {
+    struct async_thrdd_addr_ctx *addr_ctx = Curl_node_elem(e);
+    Curl_mutex_acquire(&addr_ctx->mutx);
+    wanted = !addr_ctx->do_abort;
+    Curl_mutex_release(&addr_ctx->mutx);
+  }
+  return wanted;
+}
+
+/* Run the lookup of `job` in a worker of the pool */
+static void async_thrdd_job_run(struct Curl_thrdpool *tpool, void *elem)
+{
+  struct async_thrdd_pool *pool = Curl_thrdpool_user_data(tpool);
+  struct async_thrdd_job *job = elem;
+  struct Curl_addrinfo *res = NULL;
+  int sock_error = 0;
+  bool wanted;
+
+  Curl_thrdpool_lock(tpool);
+  wanted = async_thrdd_job_wanted(job);
+  Curl_thrdpool_unlock(tpool);
+
+  if(wanted) {
+#ifdef HAVE_GETADDRINFO
+    char service[12];
+    int rc;
+
+#ifdef DEBUGBUILD
+    Curl_resolve_test_delay();
+#endif
+    msnprintf(service, sizeof(service), "%d", job->port);
+    rc = Curl_getaddrinfo_ex(job->hostname, service, &job->hints, &res);
+    if(rc) {
+      sock_error = SOCKERRNO ? SOCKERRNO : rc;
+      if(sock_error == 0)
+        sock_error = RESOLVER_ENOMEM;
+    }
+    else {
+      Curl_addrinfo_set_port(res, job->port);
+    }
+#else
+#ifdef DEBUGBUILD
+    Curl_resolve_test_delay();
+#endif
+    res = Curl_ipv4_resolve_r(job->hostname, job->port);
+    if(!res) {
+      sock_error = SOCKERRNO;
+      if(sock_error == 0)
+        sock_error = RESOLVER_ENOMEM;
+    }
+#endif
+  }
+
+  /* no one joins the job once it is out of `jobs` */
+  Curl_thrdpool_lock(tpool);
+  Curl_hash_delete(&pool->jobs, job->id, job->idlen);
+  Curl_thrdpool_unlock(tpool);
+  async_thrdd_job_done(job, res, sock_error);
+}
+
+/* Fail the lookup of `job` no worker started */
+static void async_thrdd_job_drop(struct Curl_thrdpool *tpool, void *elem)
+{
+  struct async_thrdd_pool *pool = Curl_thrdpool_user_data(tpool);
+  struct async_thrdd_job *job = elem;
+
+  Curl_thrdpool_lock(tpool);
+  Curl_hash_delete(&pool->jobs, job->id, job->idlen);
+  Curl_thrdpool_unlock(tpool);
+  async_thrdd_job_done(job, NULL, 0);
+}
+
+static void async_thrdd_pool_free(void *user_data)
+{
+  struct async_thrdd_pool *pool = user_data;
+
+  Curl_hash_destroy(&pool->jobs);
+  free(pool);
+}
+
+static void async_thrdd_job_dtor(void *elem)
+{
+  (void)elem; /* jobs are freed by the worker running them */
+}
+
+CURLMcode Curl_async_thrdd_pool_set(struct Curl_multi *multi,
+                                    long max_threads, long max_queue)
+{
+  struct async_thrdd_pool *pool = multi->resolv_pool;
+
+  if((max_threads > INT_MAX) || (max_queue > INT_MAX))
+    return CURLM_BAD_FUNCTION_ARGUMENT;
+  if(!pool) {
+    if((max_threads <= 0) && (max_queue <= 0))
+      return CURLM_OK; /* stay with a thread per lookup */
+    pool = calloc(1, sizeof(*pool));
+    if(!pool)
+      return CURLM_OUT_OF_MEMORY;
+    Curl_hash_init(&pool->jobs, 31, Curl_hash_str, curlx_str_key_compare,
+                   async_thrdd_job_dtor);
+    pool->tpool = Curl_thrdpool_create(async_thrdd_job_run,
+                                       async_thrdd_job_drop,
+                                       async_thrdd_pool_free, pool);
+    if(!pool->tpool) {
+      async_thrdd_pool_free(pool);
+      return CURLM_OUT_OF_MEMORY;
+    }
+    multi->resolv_pool = pool;
+  }
+  Curl_thrdpool_lock(pool->tpool);
+  if(max_threads >= 0)
+    pool->max_threads = (unsigned int)max_threads;
+  if(max_queue >= 0)
+    pool->max_queue = (size_t)max_queue;
+  Curl_thrdpool_unlock(pool->tpool);
+  return CURLM_OK;
+}
+
+void Curl_async_thrdd_pool_destroy(struct Curl_multi *multi)
+{
+  struct async_thrdd_pool *pool = multi->resolv_pool;
+
+  if(!pool)
+    return;
+  multi->resolv_pool = NULL;
+  /* fails the lookups no worker started. Workers blocked in a lookup are
+   * not waited for, the last one frees the pool. */
+  Curl_thrdpool_destroy(pool->tpool);
+}
+
+/* Have the multi's resolver pool resolve `addr_ctx`'s host. Either by
+ * joining a lookup for the same host that is queued or running or by
+ * queueing a new one. On success, the pool holds a reference to
+ * `addr_ctx`. Returns CURLE_AGAIN when the pool is not in use and the
+ * lookup needs a thread of its own. */
+static CURLcode async_thrdd_pool_add(struct Curl_easy *data,
+                                     struct async_thrdd_pool *pool,
+                                     struct async_thrdd_addr_ctx *addr_ctx)
+{
+  struct async_thrdd_job *job;
+  char id[THRDD_MAX_NAME_LEN + 40];
+  size_t hlen = strlen(addr_ctx->hostname);
+  size_t idlen;
+  CURLcode result = CURLE_OUT_OF_MEMORY;
+
+  if(hlen > THRDD_MAX_NAME_LEN)
+    return CURLE_AGAIN;
+  /* lookups only ever coalesce with same hints */
+#ifdef HAVE_GETADDRINFO
+  idlen = msnprintf(id, sizeof(id), "%d:%d:%d:", addr_ctx->port,
+                    addr_ctx->hints.ai_family, addr_ctx->hints.ai_socktype);
+#else
+  idlen = msnprintf(id, sizeof(id), "%d:", addr_ctx->port);
+#endif
+  Curl_strntolower(&id[idlen], addr_ctx->hostname, hlen);
+  idlen += hlen;
+  id[idlen++] = 0;
+
+  Curl_thrdpool_lock(pool->tpool);
+  if(!pool->max_threads) {
+    result = CURLE_AGAIN;
+    goto out;
+  }
+  job = Curl_hash_pick(&pool->jobs, id, idlen);
+  if(job) {
+    CURL_TRC_DNS(data, "resolve of %s:%d joins a lookup in progress",
+                 addr_ctx->hostname, addr_ctx->port);
+    Curl_llist_append(&job->waiters, addr_ctx, &addr_ctx->job_node);
+    result = CURLE_OK;
+    goto out;
+  }
+
+  job = calloc(1, sizeof(*job) + idlen);
+  if(!job)
+    goto out;
+  job->hostname = strdup(addr_ctx->hostname);
+  if(!job->hostname) {
+    free(job);
+    goto out;
+  }
+  job->port = addr_ctx->port;
+#ifdef HAVE_GETADDRINFO
+  job->hints = addr_ctx->hints;
+#endif
+  memcpy(job->id, id, idlen);
+  job->idlen = idlen;
+  Curl_llist_init(&job->waiters, NULL);
+  if(!Curl_hash_add(&pool->jobs, job->id, job->idlen, job)) {
+    async_thrdd_job_free(job);
+    goto out;
+  }
+  result = Curl_thrdpool_add(pool->tpool, job, &job->node,
+                             pool->max_threads, pool->max_queue);
+  if(result) {
+    Curl_hash_delete(&pool->jobs, job->id, job->idlen);
+    async_thrdd_job_free(job);
+    if(result == CURLE_AGAIN) {
+      failf(data, "Too many name resolves waiting, %zu queued",
+            Curl_thrdpool_waiting(pool->tpool));
+      result = CURLE_COULDNT_RESOLVE_HOST;
+    }
+    else
+      result = CURLE_OUT_OF_MEMORY;
+    goto out;
+  }
+  Curl_llist_append(&job->waiters, addr_ctx, &addr_ctx->job_node);
+  CURL_TRC_DNS(data, "resolve of %s:%d queued, %zu waiting, %u/%u workers",
+               addr_ctx->hostname, addr_ctx->port,
+               Curl_thrdpool_waiting(pool->tpool),
+               Curl_thrdpool_threads(pool->tpool), pool->max_threads);
+
+out:
+  Curl_thrdpool_unlock(pool->tpool);
+  return result;
+}
+
+/* Wait for a lookup in the pool to finish. */
+static void async_thrdd_pool_wait(struct async_thrdd_addr_ctx *addr_ctx)
+{
+  bool done = FALSE;
+
+  for(;;) {
+    Curl_mutex_acquire(&addr_ctx->mutx);
+    done = addr_ctx->thrd_done;
+    Curl_mutex_release(&addr_ctx->mutx);
+    if(done)
+      break;
+#ifndef CURL_DISABLE_SOCKETPAIR
+    (void)SOCKET_READABLE(addr_ctx->sock_pair[0], 100);
+#else
+    curlx_wait_ms(10);
+#endif
+  }
+}
+
+#endif /* USE_RESOLV_POOL */
+
 /*
  * async_thrdd_destroy() cleans up async resolver data and thread handle.
  */
@@ -364,7 +698,7 @@ static void async_thrdd_destroy(struct Curl_easy *data)
   Curl_httpsrr_cleanup(&thrdd->rr.hinfo);
 #endif
 
-  if(thrdd->addr && (thrdd->addr->thread_hnd != curl_thread_t_null)) {
+  if(addr && (addr->pooled || (addr->thread_hnd != curl_thread_t_null))) {
     bool done;
 
     Curl_mutex_acquire(&addr->mutx);
@@ -376,7 +710,12 @@ static void async_thrdd_destroy(struct Curl_easy *data)
     done = addr->thrd_done;
     Curl_mutex_release(&addr->mutx);
 
-    if(done) {
+    if(addr->pooled) {
+      /* the pool's worker drops its reference when the lookup is done */
+      CURL_TRC_DNS(data, "async_thrdd_destroy, %s pooled resolve",
+                   done ? "finished" : "leaving");
+    }
+    else if(done) {
       Curl_thread_join(&addr->thread_hnd);
       CURL_TRC_DNS(data, "async_thrdd_destroy, thread joined");
     }
@@ -484,6 +823,24 @@ static bool async_thrdd_init(struct Curl_easy *data,
   addr_ctx->ref_count = 2;
   addr_ctx->start = curlx_now();
 
+#ifdef USE_RESOLV_POOL
+  if(data->multi && data->multi->resolv_pool) {
+    CURLcode result = async_thrdd_pool_add(data, data->multi->resolv_pool,
+                                           addr_ctx);
+    if(!result) {
+      addr_ctx->pooled = TRUE;
+      goto started;
+    }
+    if(result != CURLE_AGAIN) {
+      addr_ctx->ref_count = 1;
+      addr_ctx->thrd_done = TRUE;
+      if(result == CURLE_COULDNT_RESOLVE_HOST)
+        err = EAGAIN;
+      goto err_exit;
+    }
+  }
+#endif
+
 #ifdef HAVE_GETADDRINFO
   addr_ctx->thread_hnd = Curl_thread_create(getaddrinfo_thread, addr_ctx);
 #else
@@ -497,12 +854,15 @@ static bool async_thrdd_init(struct Curl_easy *data,
     err = errno;
     goto err_exit;
   }
+  CURL_TRC_DNS(data, "resolve thread started for of %s:%d", hostname, port);
 
+#ifdef USE_RESOLV_POOL
+started:
+#endif
 #ifdef USE_HTTPSRR_ARES
   if(async_rr_start(data))
     infof(data, "Failed HTTPS RR operation");
 #endif
-  CURL_TRC_DNS(data, "resolve thread started for of %s:%d", hostname, port);
   return TRUE;
 
 err_exit:
@@ -520,7 +880,7 @@ static void async_thrdd_shutdown(struct Curl_easy *data)
 
   if(!addr_ctx)
     return;
-  if(addr_ctx->thread_hnd == curl_thread_t_null)
+  if(!addr_ctx->pooled && (addr_ctx->thread_hnd == curl_thread_t_null))
     return;
 
   Curl_mutex_acquire(&addr_ctx->mutx);
@@ -532,7 +892,6 @@ static void async_thrdd_shutdown(struct Curl_easy *data)
   done = addr_ctx->thrd_done;
   Curl_mutex_release(&addr_ctx->mutx);
 
-  DEBUGASSERT(addr_ctx->thread_hnd != curl_thread_t_null);
   if(!done && (addr_ctx->thread_hnd != curl_thread_t_null)) {
     CURL_TRC_DNS(data, "cancelling resolve thread");
     (void)Curl_thread_cancel(&addr_ctx->thread_hnd);
@@ -561,6 +920,17 @@ static CURLcode asyn_thrdd_await(struct Curl_easy *data,
     if(entry)
       result = Curl_async_is_resolved(data, entry);
   }
+#ifdef USE_RESOLV_POOL
+  else if(addr_ctx->pooled) {
+    if(entry) {
+      CURL_TRC_DNS(data, "resolve, wait for pooled lookup to finish");
+      async_thrdd_pool_wait(addr_ctx);
+      result = Curl_async_is_resolved(data, entry);
+    }
+    else
+      async_thrdd_shutdown(data);
+  }
+#endif
 
   data->state.async.done = TRUE;
   if(entry)
@@ -756,6 +1126,136 @@ CURLcode Curl_async_pollset(struct Curl_easy *data, struct easy_pollset *ps)
   return result;
 }
 
+#ifdef HAVE_GETADDRINFO
+static void async_thrdd_hints(struct Curl_easy *data, int ip_version,
+                              struct addrinfo *hints)
+{
+  int pf = PF_INET;
+
+#ifdef CURLRES_IPV6
+  if((ip_version != CURL_IPRESOLVE_V4) && Curl_ipv6works(data)) {
+    /* The stack seems to be IPv6-enabled */
+    if(ip_version == CURL_IPRESOLVE_V6)
+      pf = PF_INET6;
+    else
+      pf = PF_UNSPEC;
+  }
+#else
+  (void)ip_version;
+#endif /* CURLRES_IPV6 */
+
+  memset(hints, 0, sizeof(*hints));
+  hints->ai_family = pf;
+  hints->ai_socktype =
+    (Curl_conn_get_transport(data, data->conn) == TRNSPRT_TCP) ?
+    SOCK_STREAM : SOCK_DGRAM;
+}
+#endif
+
+/*
+ * Curl_async_thrdd_refresh_start() starts a lookup of `hostname` that no
+ * transfer waits for, in the multi's resolver pool or in a thread of its
+ * own. Used to refresh DNS cache entries in the background.
+ */
+struct async_thrdd_addr_ctx *
+Curl_async_thrdd_refresh_start(struct Curl_easy *data,
+                               const char *hostname, int port,
+                               int ip_version)
+{
+  struct async_thrdd_addr_ctx *addr_ctx;
+#ifdef HAVE_GETADDRINFO
+  struct addrinfo hints;
+
+  async_thrdd_hints(data, ip_version, &hints);
+  addr_ctx = addr_ctx_create(data, hostname, port, &hints);
+#else
+  (void)ip_version;
+  addr_ctx = addr_ctx_create(data, hostname, port, NULL);
+#endif
+  if(!addr_ctx)
+    return NULL;
+
+  /* passing addr_ctx to the thread adds a reference */
+  addr_ctx->ref_count = 2;
+  addr_ctx->start = curlx_now();
+
+#ifdef USE_RESOLV_POOL
+  if(data->multi && data->multi->resolv_pool) {
+    CURLcode result = async_thrdd_pool_add(data, data->multi->resolv_pool,
+                                           addr_ctx);
+    if(!result) {
+      addr_ctx->pooled = TRUE;
+      return addr_ctx;
+    }
+    if(result != CURLE_AGAIN)
+      goto fail;
+  }
+#endif
+
+#ifdef HAVE_GETADDRINFO
+  addr_ctx->thread_hnd = Curl_thread_create(getaddrinfo_thread, addr_ctx);
+#else
+  addr_ctx->thread_hnd = Curl_thread_create(gethostbyname_thread, addr_ctx);
+#endif
+  if(addr_ctx->thread_hnd != curl_thread_t_null)
+    return addr_ctx;
+
+#ifdef USE_RESOLV_POOL
+fail:
+#endif
+  addr_ctx->ref_count = 1;
+  addr_ctx->thrd_done = TRUE;
+  addr_ctx_unlink(&addr_ctx, data);
+  return NULL;
+}
+
+/*
+ * Curl_async_thrdd_refresh_done() returns TRUE when the lookup is done and
+ * hands over the addresses it found in `*paddr`, which is NULL when it
+ * failed.
+ */
+bool Curl_async_thrdd_refresh_done(struct async_thrdd_addr_ctx *addr_ctx,
+                                   struct Curl_addrinfo **paddr)
+{
+  bool done;
+
+  Curl_mutex_acquire(&addr_ctx->mutx);
+  done = addr_ctx->thrd_done;
+  Curl_mutex_release(&addr_ctx->mutx);
+  if(done) {
+    *paddr = addr_ctx->res;
+    addr_ctx->res = NULL;
+  }
+  return done;
+}
+
+/*
+ * Curl_async_thrdd_refresh_free() gives up a lookup started with
+ * Curl_async_thrdd_refresh_start(), done or not.
+ */
+void Curl_async_thrdd_refresh_free(struct async_thrdd_addr_ctx **paddr_ctx)
+{
+  struct async_thrdd_addr_ctx *addr_ctx = *paddr_ctx;
+  bool done;
+
+  if(!addr_ctx)
+    return;
+  Curl_mutex_acquire(&addr_ctx->mutx);
+  addr_ctx->do_abort = TRUE;
+  done = addr_ctx->thrd_done;
+  Curl_mutex_release(&addr_ctx->mutx);
+
+  if(addr_ctx->thread_hnd != curl_thread_t_null) {
+    if(done)
+      Curl_thread_join(&addr_ctx->thread_hnd);
+    else
+      /* the thread frees it when it drops its reference */
+      Curl_thread_destroy(&addr_ctx->thread_hnd);
+  }
+  /* no transfer owns this lookup, unlink as the last one using it */
+  addr_ctx_unlink(paddr_ctx, NULL);
+}
+
 #ifndef HAVE_GETADDRINFO
 /*
  * Curl_async_getaddrinfo() - for platforms without getaddrinfo
@@ -792,27 +1292,10 @@ struct Curl_addrinfo *Curl_async_getaddrinfo(struct Curl_easy *data,
                                              int *waitp)
 {
   struct addrinfo hints;
-  int pf = PF_INET;
   *waitp = 0; /* default to synchronous response */
 
   CURL_TRC_DNS(data, "init threaded resolve of %s:%d", hostname, port);
-#ifdef CURLRES_IPV6
-  if((ip_version != CURL_IPRESOLVE_V4) && Curl_ipv6works(data)) {
-    /* The stack seems to be IPv6-enabled */
-    if(ip_version == CURL_IPRESOLVE_V6)
-      pf = PF_INET6;
-    else
-      pf = PF_UNSPEC;
-  }
-#else
-  (void)ip_version;
-#endif /* CURLRES_IPV6 */
-
-  memset(&hints, 0, sizeof(hints));
-  hints.ai_family = pf;
-  hints.ai_socktype =
-    (Curl_conn_get_transport(data, data->conn) == TRNSPRT_TCP) ?
-    SOCK_STREAM : SOCK_DGRAM;
+  async_thrdd_hints(data, ip_version, &hints);
 
   /* fire up a new resolver thread! */
   if(async_thrdd_init(data, hostname, port, ip_version, &hints)) {
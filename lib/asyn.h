@@ -27,6 +27,7 @@
 #include "curl_setup.h"
 
 struct Curl_easy;
+struct Curl_multi;
 struct Curl_dns_entry;
 
 #ifdef CURLRES_ASYNCH
@@ -173,6 +174,7 @@ CURLcode Curl_async_ares_set_dns_local_ip6(struct Curl_easy *data);
 #ifdef CURLRES_THREADED
 /* async resolving implementation using POSIX threads */
 #include "curl_threads.h"
+#include "llist.h"
 
 /* Context for threaded address resolver */
 struct async_thrdd_addr_ctx {
@@ -193,8 +195,12 @@ struct async_thrdd_addr_ctx {
   int port;
   int sock_error;
   int ref_count;
+#ifdef USE_THREADS_COND
+  struct Curl_llist_node job_node; /* waiting for a resolver pool job */
+#endif
   BIT(thrd_done);
   BIT(do_abort);
+  BIT(pooled); /* resolved by the multi's resolver pool */
 };
 
 /* Context for threaded resolver */
@@ -217,6 +223,29 @@ struct async_thrdd_ctx {
 void Curl_async_thrdd_shutdown(struct Curl_easy *data);
 void Curl_async_thrdd_destroy(struct Curl_easy *data);
 
+/* Lookups no transfer waits for, refreshing DNS cache entries */
+struct async_thrdd_addr_ctx *
+Curl_async_thrdd_refresh_start(struct Curl_easy *data,
+                               const char *hostname, int port,
+                               int ip_version);
+bool Curl_async_thrdd_refresh_done(struct async_thrdd_addr_ctx *addr_ctx,
+                                   struct Curl_addrinfo **paddr);
+void Curl_async_thrdd_refresh_free(struct async_thrdd_addr_ctx **paddr_ctx);
+
+#ifdef USE_THREADS_COND
+#define USE_RESOLV_POOL
+struct async_thrdd_pool;
+
+/* Set the maximum number of worker threads of the multi's resolver pool
+ * and/or the maximum number of lookups waiting for a worker, -1 leaves a
+ * value unchanged. Creates the pool on first use. */
+CURLMcode Curl_async_thrdd_pool_set(struct Curl_multi *multi,
+                                    long max_threads, long max_queue);
+/* Stop the workers of the multi's resolver pool and release it. Workers
+ * still in a lookup are not waited for. */
+void Curl_async_thrdd_pool_destroy(struct Curl_multi *multi);
+#endif
+
 #endif /* CURLRES_THREADED */
 
 #ifndef CURL_DISABLE_DOH
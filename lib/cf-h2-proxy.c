@@ -1584,6 +1584,7 @@ struct Curl_cftype Curl_cft_h2_proxy = {
   cf_h2_proxy_adjust_pollset,
   cf_h2_proxy_data_pending,
   cf_h2_proxy_send,
+  Curl_cf_emulate_sendv,
   cf_h2_proxy_recv,
   cf_h2_proxy_cntrl,
   cf_h2_proxy_is_alive,
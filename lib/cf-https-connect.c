@@ -571,6 +571,7 @@ struct Curl_cftype Curl_cft_http_connect = {
   cf_hc_adjust_pollset,
   cf_hc_data_pending,
   Curl_cf_def_send,
+  Curl_cf_def_sendv,
   Curl_cf_def_recv,
   cf_hc_cntrl,
   Curl_cf_def_conn_is_alive,
@@ -880,6 +880,7 @@ struct Curl_cftype Curl_cft_ip_happy = {
   cf_ip_happy_adjust_pollset,
   cf_ip_happy_data_pending,
   Curl_cf_def_send,
+  Curl_cf_def_sendv,
   Curl_cf_def_recv,
   Curl_cf_def_cntrl,
   Curl_cf_def_conn_is_alive,
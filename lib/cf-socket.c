@@ -84,6 +84,7 @@
 #include "system_win32.h"
 #include "curlx/version_win32.h"
 #include "curlx/strparse.h"
+#include "uring.h"
 
 /* The last 3 #include files should be in this order */
 #include "curl_printf.h"
@@ -932,12 +933,18 @@ struct cf_socket_ctx {
   int wpartial_percent;              /* percent of bytes written in send */
   int rblock_percent;                /* percent of reads doing EAGAIN */
   size_t recv_max;                  /* max enforced read size */
+#endif
+#ifdef USE_IO_URING
+  struct Curl_uring_recv urx;        /* receive batched by the multi */
 #endif
   BIT(got_first_byte);               /* if first byte was received */
   BIT(listening);                    /* socket is listening */
   BIT(accepted);                     /* socket was accepted, not connected */
   BIT(sock_connected);               /* socket is "connected", e.g. in UDP */
   BIT(active);
+#ifdef USE_IO_URING
+  BIT(urx_drained);                  /* batched receive emptied the socket */
+#endif
 };
 
 static CURLcode cf_socket_ctx_init(struct cf_socket_ctx *ctx,
@@ -999,6 +1006,10 @@ static void cf_socket_close(struct Curl_cfilter *cf, struct Curl_easy *data)
     ctx->active = FALSE;
     memset(&ctx->started_at, 0, sizeof(ctx->started_at));
     memset(&ctx->connected_at, 0, sizeof(ctx->connected_at));
+#ifdef USE_IO_URING
+    Curl_uring_recv_done(&ctx->urx);
+    ctx->urx_drained = FALSE;
+#endif
   }
 
   cf->connected = FALSE;
@@ -1032,6 +1043,9 @@ static void cf_socket_destroy(struct Curl_cfilter *cf, struct Curl_easy *data)
 
   cf_socket_close(cf, data);
   CURL_TRC_CF(data, cf, "destroy");
+#ifdef USE_IO_URING
+  Curl_uring_recv_done(&ctx->urx);
+#endif
   free(ctx);
   cf->ctx = NULL;
 }
@@ -1383,6 +1397,13 @@ static CURLcode cf_socket_adjust_pollset(struct Curl_cfilter *cf,
   struct cf_socket_ctx *ctx = cf->ctx;
   CURLcode result = CURLE_OK;
 
+#ifdef USE_IO_URING
+  /* waiting for socket events, a drained socket seen by the last
+   * batch is outdated */
+  ctx->urx_drained = FALSE;
+  if(ctx->urx.done && (ctx->urx.res == -EAGAIN))
+    Curl_uring_recv_done(&ctx->urx);
+#endif
   if(ctx->sock != CURL_SOCKET_BAD) {
     /* A listening socket filter needs to be connected before the accept
      * for some weird FTP interaction. This should be rewritten, so that
@@ -1434,18 +1455,49 @@ static void win_update_sndbuf_size(struct cf_socket_ctx *ctx)
 
 #endif /* USE_WINSOCK */
 
-static CURLcode cf_socket_send(struct Curl_cfilter *cf, struct Curl_easy *data,
-                               const void *buf, size_t len, bool eos,
-                               size_t *pnwritten)
+#if defined(HAVE_SENDMSG) && !defined(USE_WINSOCK)
+/* max number of buffers we pass to a single sendmsg() */
+#define CF_SOCK_IOV_MAX 16
+
+/* Send at most `*plen` bytes of the buffers in `iov` with one sendmsg().
+ * On return, `*plen` has the amount of bytes offered. */
+static ssize_t cf_socket_sendmsg(curl_socket_t sock,
+                                 const struct curl_iovec *iov,
+                                 size_t iovcnt, size_t *plen)
+{
+  struct iovec msg_iov[CF_SOCK_IOV_MAX];
+  struct msghdr msg;
+  size_t i, len = 0;
+
+  memset(&msg, 0, sizeof(msg));
+  for(i = 0; (i < iovcnt) && (i < CF_SOCK_IOV_MAX) && (len < *plen); ++i) {
+    msg_iov[i].iov_base = CURL_UNCONST(iov[i].base);
+    msg_iov[i].iov_len = CURLMIN(iov[i].len, *plen - len);
+    len += msg_iov[i].iov_len;
+  }
+  msg.msg_iov = msg_iov;
+  msg.msg_iovlen = i;
+  *plen = len;
+  return sendmsg(sock, &msg, SEND_4TH_ARG);
+}
+#endif
+
+static CURLcode cf_socket_sendv(struct Curl_cfilter *cf,
+                                struct Curl_easy *data,
+                                const struct curl_iovec *iov, size_t iovcnt,
+                                bool eos, size_t *pnwritten)
 {
   struct cf_socket_ctx *ctx = cf->ctx;
   curl_socket_t fdsave;
   ssize_t nwritten;
-  size_t orig_len = len;
+  size_t i, len = 0, orig_len;
   CURLcode result = CURLE_OK;
 
   (void)eos;
   *pnwritten = 0;
+  for(i = 0; i < iovcnt; ++i)
+    len += iov[i].len;
+  orig_len = len;
   fdsave = cf->conn->sock[cf->sockindex];
   cf->conn->sock[cf->sockindex] = ctx->sock;
 
@@ -1469,15 +1521,27 @@ static CURLcode cf_socket_send(struct Curl_cfilter *cf, struct Curl_easy *data,
   }
 #endif
 
+  DEBUGASSERT(iovcnt);
 #if defined(MSG_FASTOPEN) && !defined(TCP_FASTOPEN_CONNECT) /* Linux */
   if(cf->conn->bits.tcp_fastopen) {
-    nwritten = sendto(ctx->sock, buf, len, MSG_FASTOPEN,
+    len = CURLMIN(len, iov[0].len);
+    nwritten = sendto(ctx->sock, iov[0].base, len, MSG_FASTOPEN,
                       &ctx->addr.curl_sa_addr, ctx->addr.addrlen);
     cf->conn->bits.tcp_fastopen = FALSE;
   }
   else
 #endif
-    nwritten = swrite(ctx->sock, buf, len);
+#if defined(HAVE_SENDMSG) && !defined(USE_WINSOCK)
+  if(len > iov[0].len) {
+    /* more than the first buffer, hand them all over in one call */
+    nwritten = cf_socket_sendmsg(ctx->sock, iov, iovcnt, &len);
+  }
+  else
+#endif
+  {
+    len = CURLMIN(len, iov[0].len);
+    nwritten = swrite(ctx->sock, iov[0].base, len);
+  }
 
   if(nwritten < 0) {
     int sockerr = SOCKERRNO;
@@ -1514,12 +1578,98 @@ static CURLcode cf_socket_send(struct Curl_cfilter *cf, struct Curl_easy *data,
     win_update_sndbuf_size(ctx);
 #endif
 
-  CURL_TRC_CF(data, cf, "send(len=%zu) -> %d, %zu",
-              orig_len, result, *pnwritten);
+  CURL_TRC_CF(data, cf, "send(len=%zu, bufs=%zu) -> %d, %zu",
+              orig_len, iovcnt, result, *pnwritten);
   cf->conn->sock[cf->sockindex] = fdsave;
   return result;
 }
 
+static CURLcode cf_socket_send(struct Curl_cfilter *cf, struct Curl_easy *data,
+                               const void *buf, size_t len, bool eos,
+                               size_t *pnwritten)
+{
+  struct curl_iovec iov;
+
+  iov.base = buf;
+  iov.len = len;
+  return cf_socket_sendv(cf, data, &iov, 1, eos, pnwritten);
+}
+
+#ifdef USE_IO_URING
+/* Queue a receive on the multi handle's `ring`, which runs it together
+ * with the receives of all other connections. The socket stays
+ * non-blocking, a receive on a drained socket completes with EAGAIN. */
+static CURLcode cf_socket_batch_recv(struct Curl_cfilter *cf,
+                                     struct Curl_easy *data,
+                                     struct Curl_uring *ring)
+{
+  struct cf_socket_ctx *ctx = cf->ctx;
+
+  (void)data;
+  ctx->urx_drained = FALSE;
+  if((cf->cft != &Curl_cft_tcp) || !cf->connected ||
+     (ctx->sock == CURL_SOCKET_BAD))
+    return CURLE_OK;
+  /* already queued for another transfer or data not handed out yet */
+  if(ctx->urx.queued || ctx->urx.done)
+    return CURLE_OK;
+  return Curl_uring_recv(ring, ctx->sock, &ctx->urx);
+}
+
+/* Answer a receive from what the batched one got. */
+static CURLcode cf_socket_urx_recv(struct Curl_cfilter *cf,
+                                   struct Curl_easy *data,
+                                   char *buf, size_t len, size_t *pnread)
+{
+  struct cf_socket_ctx *ctx = cf->ctx;
+  struct Curl_uring_recv *op = &ctx->urx;
+  CURLcode result = CURLE_OK;
+
+  DEBUGASSERT(op->done);
+  if(op->res < 0) {
+    int sockerr = -op->res;
+
+    Curl_uring_recv_done(op);
+    if((EAGAIN == sockerr) || (SOCKEWOULDBLOCK == sockerr) ||
+       (SOCKEINTR == sockerr)) {
+      result = CURLE_AGAIN;
+    }
+    else {
+      char buffer[STRERROR_LEN];
+      failf(data, "Recv failure: %s",
+            Curl_strerror(sockerr, buffer, sizeof(buffer)));
+      data->state.os_errno = sockerr;
+      result = CURLE_RECV_ERROR;
+    }
+  }
+  else {
+    size_t avail = (size_t)op->res - op->offset;
+
+    *pnread = CURLMIN(len, avail);
+    if(*pnread)
+      memcpy(buf, op->buf + op->offset, *pnread);
+    op->offset += *pnread;
+    if(op->offset == (size_t)op->res) {
+      /* All handed out, the buffer goes back to the ring. If the ring did
+       * not fill it, the socket had nothing more and a caller wanting
+       * more is answered with CURLE_AGAIN next, without asking the
+       * socket again. */
+      ctx->urx_drained = (op->res > 0) && ((size_t)op->res < op->len) &&
+                         (*pnread < len);
+      Curl_uring_recv_done(op);
+    }
+  }
+
+  CURL_TRC_CF(data, cf, "recv(len=%zu) -> %d, %zu (batched)",
+              len, result, *pnread);
+  if(!result && !ctx->got_first_byte) {
+    ctx->first_byte_at = curlx_now();
+    ctx->got_first_byte = TRUE;
+  }
+  return result;
+}
+#endif /* USE_IO_URING */
+
 static CURLcode cf_socket_recv(struct Curl_cfilter *cf, struct Curl_easy *data,
                                char *buf, size_t len, size_t *pnread)
 {
@@ -1546,6 +1696,18 @@ static CURLcode cf_socket_recv(struct Curl_cfilter *cf, struct Curl_easy *data,
   }
 #endif
 
+#ifdef USE_IO_URING
+  /* the ring runs before transfers do and leaves nothing queued */
+  DEBUGASSERT(!ctx->urx.queued);
+  if(ctx->urx.done)
+    return cf_socket_urx_recv(cf, data, buf, len, pnread);
+  else if(ctx->urx_drained) {
+    ctx->urx_drained = FALSE;
+    CURL_TRC_CF(data, cf, "recv(len=%zu) -> AGAIN, drained in batch", len);
+    return CURLE_AGAIN;
+  }
+#endif
+
   nread = sread(ctx->sock, buf, len);
 
   if(nread < 0) {
@@ -1630,10 +1792,27 @@ static CURLcode cf_socket_cntrl(struct Curl_cfilter *cf,
   case CF_CTRL_FORGET_SOCKET:
     ctx->sock = CURL_SOCKET_BAD;
     break;
+#ifdef USE_IO_URING
+  case CF_CTRL_BATCH_RECV:
+    return cf_socket_batch_recv(cf, data, arg2);
+#endif
   }
   return CURLE_OK;
 }
 
+static bool cf_socket_data_pending(struct Curl_cfilter *cf,
+                                   const struct Curl_easy *data)
+{
+#ifdef USE_IO_URING
+  struct cf_socket_ctx *ctx = cf->ctx;
+
+  /* received in a batch, not handed out yet */
+  if(ctx->urx.done && (ctx->urx.res != -EAGAIN))
+    return TRUE;
+#endif
+  return Curl_cf_def_data_pending(cf, data);
+}
+
 static bool cf_socket_conn_is_alive(struct Curl_cfilter *cf,
                                     struct Curl_easy *data,
                                     bool *input_pending)
@@ -1647,6 +1826,14 @@ static bool cf_socket_conn_is_alive(struct Curl_cfilter *cf,
   if(!ctx || ctx->sock == CURL_SOCKET_BAD)
     return FALSE;
 
+#ifdef USE_IO_URING
+  if(ctx->urx.done && (ctx->urx.res != -EAGAIN)) {
+    /* a batched receive holds data, EOF or an error */
+    *input_pending = (ctx->urx.res > 0);
+    return *input_pending;
+  }
+#endif
+
   /* Check with 0 timeout if there are any events pending on the socket */
   pfd[0].fd = ctx->sock;
   pfd[0].events = POLLRDNORM|POLLIN|POLLRDBAND|POLLPRI;
@@ -1742,8 +1929,9 @@ struct Curl_cftype Curl_cft_tcp = {
   cf_socket_close,
   cf_socket_shutdown,
   cf_socket_adjust_pollset,
-  Curl_cf_def_data_pending,
+  cf_socket_data_pending,
   cf_socket_send,
+  cf_socket_sendv,
   cf_socket_recv,
   cf_socket_cntrl,
   cf_socket_conn_is_alive,
@@ -1898,6 +2086,7 @@ struct Curl_cftype Curl_cft_udp = {
   cf_socket_adjust_pollset,
   Curl_cf_def_data_pending,
   cf_socket_send,
+  cf_socket_sendv,
   cf_socket_recv,
   cf_socket_cntrl,
   cf_socket_conn_is_alive,
@@ -1952,6 +2141,7 @@ struct Curl_cftype Curl_cft_unix = {
   cf_socket_adjust_pollset,
   Curl_cf_def_data_pending,
   cf_socket_send,
+  cf_socket_sendv,
   cf_socket_recv,
   cf_socket_cntrl,
   cf_socket_conn_is_alive,
@@ -2172,6 +2362,7 @@ struct Curl_cftype Curl_cft_tcp_accept = {
   cf_socket_adjust_pollset,
   Curl_cf_def_data_pending,
   cf_socket_send,
+  cf_socket_sendv,
   cf_socket_recv,
   cf_socket_cntrl,
   cf_socket_conn_is_alive,
@@ -95,6 +95,42 @@ CURLcode Curl_cf_def_send(struct Curl_cfilter *cf, struct Curl_easy *data,
   return CURLE_RECV_ERROR;
 }
 
+CURLcode Curl_cf_def_sendv(struct Curl_cfilter *cf, struct Curl_easy *data,
+                           const struct curl_iovec *iov, size_t iovcnt,
+                           bool eos, size_t *pnwritten)
+{
+  if(cf->next)
+    return cf->next->cft->do_sendv(cf->next, data, iov, iovcnt, eos,
+                                   pnwritten);
+  *pnwritten = 0;
+  return CURLE_RECV_ERROR;
+}
+
+CURLcode Curl_cf_emulate_sendv(struct Curl_cfilter *cf,
+                               struct Curl_easy *data,
+                               const struct curl_iovec *iov, size_t iovcnt,
+                               bool eos, size_t *pnwritten)
+{
+  CURLcode result = CURLE_OK;
+  size_t i;
+
+  *pnwritten = 0;
+  for(i = 0; i < iovcnt; ++i) {
+    size_t n;
+    result = cf->cft->do_send(cf, data, iov[i].base, iov[i].len,
+                              eos && (i + 1 == iovcnt), &n);
+    if(result) {
+      if((result == CURLE_AGAIN) && *pnwritten)
+        result = CURLE_OK;
+      break;
+    }
+    *pnwritten += n;
+    if(n < iov[i].len)
+      break;
+  }
+  return result;
+}
+
 CURLcode Curl_cf_def_recv(struct Curl_cfilter *cf, struct Curl_easy *data,
                           char *buf, size_t len, size_t *pnread)
 {
@@ -266,6 +302,26 @@ CURLcode Curl_cf_send(struct Curl_easy *data, int num,
   return CURLE_FAILED_INIT;
 }
 
+CURLcode Curl_cf_sendv(struct Curl_easy *data, int num,
+                       const struct curl_iovec *iov, size_t iovcnt,
+                       bool eos, size_t *pnwritten)
+{
+  struct Curl_cfilter *cf;
+
+  DEBUGASSERT(data);
+  DEBUGASSERT(data->conn);
+  cf = data->conn->cfilter[num];
+  while(cf && !cf->connected)
+    cf = cf->next;
+  if(cf) {
+    return cf->cft->do_sendv(cf, data, iov, iovcnt, eos, pnwritten);
+  }
+  failf(data, "send: no filter connected");
+  DEBUGASSERT(0);
+  *pnwritten = 0;
+  return CURLE_FAILED_INIT;
+}
+
 struct cf_io_ctx {
   struct Curl_easy *data;
   struct Curl_cfilter *cf;
@@ -984,6 +1040,17 @@ CURLcode Curl_conn_flush(struct Curl_easy *data, int sockindex)
                             CF_CTRL_FLUSH, 0, NULL);
 }
 
+#ifdef USE_IO_URING
+CURLcode Curl_conn_batch_recv(struct Curl_easy *data, int sockindex,
+                              struct Curl_uring *ring)
+{
+  if(!CONN_SOCK_IDX_VALID(sockindex))
+    return CURLE_BAD_FUNCTION_ARGUMENT;
+  return Curl_conn_cf_cntrl(data->conn->cfilter[sockindex], data, FALSE,
+                            CF_CTRL_BATCH_RECV, 0, ring);
+}
+#endif
+
 /**
  * Notify connection filters that the transfer represented by `data`
  * is done with sending data (e.g. has uploaded everything).
@@ -1146,3 +1213,51 @@ CURLcode Curl_conn_send(struct Curl_easy *data, int sockindex,
   *pnwritten = 0;
   return CURLE_FAILED_INIT;
 }
+
+/* Send the buffers one after the other via Curl_conn_send() */
+static CURLcode conn_sendv_each(struct Curl_easy *data, int sockindex,
+                                const struct curl_iovec *iov, size_t iovcnt,
+                                bool eos, size_t *pnwritten)
+{
+  CURLcode result = CURLE_OK;
+  size_t i;
+
+  *pnwritten = 0;
+  for(i = 0; i < iovcnt; ++i) {
+    size_t n;
+    result = Curl_conn_send(data, sockindex, iov[i].base, iov[i].len,
+                            eos && (i + 1 == iovcnt), &n);
+    if(result) {
+      if((result == CURLE_AGAIN) && *pnwritten)
+        result = CURLE_OK;
+      break;
+    }
+    *pnwritten += n;
+    if(n < iov[i].len)
+      break;
+  }
+  return result;
+}
+
+CURLcode Curl_conn_sendv(struct Curl_easy *data, int sockindex,
+                         const struct curl_iovec *iov, size_t iovcnt,
+                         bool eos, size_t *pnwritten)
+{
+  DEBUGASSERT(data);
+  DEBUGASSERT(data->conn);
+  DEBUGASSERT(CONN_SOCK_IDX_VALID(sockindex));
+  if(!CONN_SOCK_IDX_VALID(sockindex))
+    return CURLE_BAD_FUNCTION_ARGUMENT;
+  if(iovcnt == 1)
+    return Curl_conn_send(data, sockindex, iov[0].base, iov[0].len, eos,
+                          pnwritten);
+#ifdef DEBUGBUILD
+  /* debug builds override the send length, see Curl_conn_send() */
+  if(getenv("CURL_SMALLSENDS"))
+    return conn_sendv_each(data, sockindex, iov, iovcnt, eos, pnwritten);
+#endif
+  /* a protocol's own send function gets the buffers one by one */
+  if(data->conn->send[sockindex] == Curl_cf_send)
+    return Curl_cf_sendv(data, sockindex, iov, iovcnt, eos, pnwritten);
+  return conn_sendv_each(data, sockindex, iov, iovcnt, eos, pnwritten);
+}
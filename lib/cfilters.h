@@ -94,6 +94,15 @@ typedef CURLcode Curl_cft_send(struct Curl_cfilter *cf,
                                bool eos,               /* last chunk */
                                size_t *pnwritten);     /* how much sent */
 
+/* Send the buffers in `iov` in this order, as if they were one. Stops
+ * at the first buffer not sent completely. */
+typedef CURLcode Curl_cft_sendv(struct Curl_cfilter *cf,
+                                struct Curl_easy *data, /* transfer */
+                                const struct curl_iovec *iov, /* buffers */
+                                size_t iovcnt,          /* number of iov */
+                                bool eos,               /* last chunk */
+                                size_t *pnwritten);     /* how much sent */
+
 typedef CURLcode Curl_cft_recv(struct Curl_cfilter *cf,
                                struct Curl_easy *data, /* transfer */
                                char *buf,              /* store data here */
@@ -126,6 +135,8 @@ typedef CURLcode Curl_cft_conn_keep_alive(struct Curl_cfilter *cf,
 #define CF_CTRL_CONN_INFO_UPDATE (256+0) /* 0          NULL     ignored */
 #define CF_CTRL_FORGET_SOCKET    (256+1) /* 0          NULL     ignored */
 #define CF_CTRL_FLUSH            (256+2) /* 0          NULL     first fail */
+/* queue a receive on the io_uring instance in arg2 */
+#define CF_CTRL_BATCH_RECV       (256+3) /* 0          ring     first fail */
 
 /**
  * Handle event/control for the filter.
@@ -220,6 +231,7 @@ struct Curl_cftype {
   Curl_cft_adjust_pollset *adjust_pollset; /* adjust transfer poll set */
   Curl_cft_data_pending *has_data_pending;/* conn has data pending */
   Curl_cft_send *do_send;                 /* send data */
+  Curl_cft_sendv *do_sendv;               /* send data from several bufs */
   Curl_cft_recv *do_recv;                 /* receive data */
   Curl_cft_cntrl *cntrl;                  /* events/control */
   Curl_cft_conn_is_alive *is_alive;       /* FALSE if conn is dead, Jim! */
@@ -252,6 +264,15 @@ bool     Curl_cf_def_data_pending(struct Curl_cfilter *cf,
 CURLcode Curl_cf_def_send(struct Curl_cfilter *cf, struct Curl_easy *data,
                           const void *buf, size_t len, bool eos,
                           size_t *pnwritten);
+CURLcode Curl_cf_def_sendv(struct Curl_cfilter *cf, struct Curl_easy *data,
+                           const struct curl_iovec *iov, size_t iovcnt,
+                           bool eos, size_t *pnwritten);
+/* For filters that do not pass data through: call the filter's
+ * `do_send()` for one buffer after the other. */
+CURLcode Curl_cf_emulate_sendv(struct Curl_cfilter *cf,
+                               struct Curl_easy *data,
+                               const struct curl_iovec *iov, size_t iovcnt,
+                               bool eos, size_t *pnwritten);
 CURLcode Curl_cf_def_recv(struct Curl_cfilter *cf, struct Curl_easy *data,
                           char *buf, size_t len, size_t *pnread);
 CURLcode Curl_cf_def_cntrl(struct Curl_cfilter *cf,
@@ -459,6 +480,16 @@ bool Curl_conn_needs_flush(struct Curl_easy *data, int sockindex);
  */
 CURLcode Curl_conn_flush(struct Curl_easy *data, int sockindex);
 
+#ifdef USE_IO_URING
+struct Curl_uring;
+/**
+ * Queue a receive for the connection filters at chain `sockindex`
+ * on `ring`. Filters that read the socket themselves refuse this.
+ */
+CURLcode Curl_conn_batch_recv(struct Curl_easy *data, int sockindex,
+                              struct Curl_uring *ring);
+#endif
+
 /**
  * Return the socket used on data's connection for FIRSTSOCKET,
  * querying filters if the whole chain has not connected yet.
@@ -515,6 +546,16 @@ CURLcode Curl_cf_send(struct Curl_easy *data, int sockindex,
                       const void *buf, size_t len, bool eos,
                       size_t *pnwritten);
 
+/**
+ * Send the `iovcnt` buffers in `iov`, in order, through the filter chain
+ * `sockindex` at connection `data->conn`. Filters that can, pass all
+ * buffers on in a single call, e.g. the socket filter with `sendmsg()`.
+ * Return the total number of bytes written in `*pnwritten` or on error.
+ */
+CURLcode Curl_cf_sendv(struct Curl_easy *data, int sockindex,
+                       const struct curl_iovec *iov, size_t iovcnt,
+                       bool eos, size_t *pnwritten);
+
 /**
  * Receive bytes from connection filter `cf` into `bufq`.
  * Convenience wrappter around `Curl_bufq_sipn()`,
@@ -632,6 +673,15 @@ CURLcode Curl_conn_send(struct Curl_easy *data, int sockindex,
                         const void *buf, size_t blen, bool eos,
                         size_t *pnwritten);
 
+/*
+ * Send the buffers in `iov`, in order, on the connection, using
+ * FIRSTSOCKET/SECONDARYSOCKET. Will return CURLE_AGAIN iff blocked
+ * on sending before anything was sent.
+ */
+CURLcode Curl_conn_sendv(struct Curl_easy *data, int sockindex,
+                         const struct curl_iovec *iov, size_t iovcnt,
+                         bool eos, size_t *pnwritten);
+
 
 /**
  * Types and macros used to keep the current easy handle in filter calls,
@@ -43,6 +43,7 @@
 #include "connect.h"
 #include "select.h"
 #include "curlx/strparse.h"
+#include "uint-hash.h"
 #include "uint-table.h"
 
 /* The last 3 #include files should be in this order */
@@ -51,43 +52,156 @@
 #include "memdebug.h"
 
 
-#define CPOOL_IS_LOCKED(c)    ((c) && (c)->locked)
+#define CPOOL_IS_LOCKED(c,d)  cpool_is_locked((c), (d))
+#define CPOOL_LOCK(c,d)       cpool_lock((c), (d))
+#define CPOOL_UNLOCK(c,d)     cpool_unlock((c), (d))
 
-#define CPOOL_LOCK(c,d)                                                 \
-  do {                                                                  \
-    if((c)) {                                                           \
-      if(CURL_SHARE_KEEP_CONNECT((c)->share))                           \
-        Curl_share_lock((d), CURL_LOCK_DATA_CONNECT,                    \
-                        CURL_LOCK_ACCESS_SINGLE);                       \
-      DEBUGASSERT(!(c)->locked);                                        \
-      (c)->locked = TRUE;                                               \
-    }                                                                   \
-  } while(0)
+/* The shards of a split pool, the pool itself if it is not split */
+#define CPOOL_PARTS(c)        ((c)->shards ? (c)->nshards : 1)
+#define CPOOL_PART(c,i)       ((c)->shards ? &(c)->shards[(i)] : (c))
 
-#define CPOOL_UNLOCK(c,d)                                                 \
-  do {                                                                  \
-    if((c)) {                                                           \
-      DEBUGASSERT((c)->locked);                                         \
-      (c)->locked = FALSE;                                              \
-      if(CURL_SHARE_KEEP_CONNECT((c)->share))                           \
-        Curl_share_unlock((d), CURL_LOCK_DATA_CONNECT);                 \
-    }                                                                   \
-  } while(0)
+static void cpool_lock(struct cpool *cpool, struct Curl_easy *data)
+{
+  if(!cpool)
+    return;
+#ifdef USE_CPOOL_LOCKS
+  if(cpool->mutex) {
+    /* recursive, taken again by a thread called back under it */
+    Curl_mutex_acquire(cpool->mutex);
+    cpool->lock_depth++;
+    return;
+  }
+#endif
+  if(CURL_SHARE_KEEP_CONNECT(cpool->share))
+    Curl_share_lock(data, CURL_LOCK_DATA_CONNECT, CURL_LOCK_ACCESS_SINGLE);
+  DEBUGASSERT(!cpool->locked);
+  cpool->locked = TRUE;
+}
+
+static void cpool_unlock(struct cpool *cpool, struct Curl_easy *data)
+{
+  if(!cpool)
+    return;
+#ifdef USE_CPOOL_LOCKS
+  if(cpool->mutex) {
+    DEBUGASSERT(cpool->lock_depth);
+    cpool->lock_depth--;
+    Curl_mutex_release(cpool->mutex);
+    return;
+  }
+#endif
+  DEBUGASSERT(cpool->locked);
+  cpool->locked = FALSE;
+  if(CURL_SHARE_KEEP_CONNECT(cpool->share))
+    Curl_share_unlock(data, CURL_LOCK_DATA_CONNECT);
+}
+
+static bool cpool_is_locked(struct cpool *cpool, struct Curl_easy *data)
+{
+  if(!cpool)
+    return FALSE;
+  (void)data;
+#ifdef USE_CPOOL_LOCKS
+  /* a built-in lock may be held by another thread, which is not ours to
+   * look at. It is recursive, so the caller always takes it. */
+  if(cpool->mutex)
+    return FALSE;
+#endif
+  return cpool->locked;
+}
+
+/* Return the shard of a split pool that connections to `destination` are
+ * kept in, or the pool itself. */
+static struct cpool *cpool_shard(struct cpool *cpool,
+                                 const char *destination)
+{
+  if(cpool && cpool->shards && destination) {
+    size_t i = Curl_hash_str(CURL_UNCONST(destination),
+                             strlen(destination) + 1, cpool->nshards);
+    return &cpool->shards[i];
+  }
+  return cpool;
+}
+
+/* Return the shard a connection with `conn_id` was added to. Each shard
+ * hands out the ids congruent to its index modulo `nshards`. */
+static struct cpool *cpool_shard_by_id(struct cpool *cpool,
+                                       curl_off_t conn_id)
+{
+  if(cpool && cpool->shards && (conn_id >= 0))
+    return &cpool->shards[conn_id % cpool->nshards];
+  return cpool;
+}
+
+/* Count a connection added to or removed from `cpool`. The caller holds
+ * the lock of `cpool`, a shard also updates the total of its split pool. */
+static void cpool_count_conn(struct cpool *cpool, bool added)
+{
+  if(added)
+    cpool->num_conn++;
+  else
+    cpool->num_conn--;
+#ifdef USE_CPOOL_LOCKS
+  if(cpool->parent) {
+    Curl_mutex_acquire(cpool->parent->mutex);
+    if(added)
+      cpool->parent->num_conn++;
+    else
+      cpool->parent->num_conn--;
+    Curl_mutex_release(cpool->parent->mutex);
+  }
+#endif
+}
+
+/* Return the number of connections in the pool `cpool` is part of. */
+static size_t cpool_total_conn(struct cpool *cpool)
+{
+#ifdef USE_CPOOL_LOCKS
+  if(cpool->parent) {
+    size_t n;
+    Curl_mutex_acquire(cpool->parent->mutex);
+    n = cpool->parent->num_conn;
+    Curl_mutex_release(cpool->parent->mutex);
+    return n;
+  }
+#endif
+  return cpool->num_conn;
+}
 
 
 /* A list of connections to the same destination. */
 struct cpool_bundle {
   struct Curl_llist conns; /* connections in the bundle */
+  struct uint_hash idle_sets; /* struct cpool_idle_set, by reuse_fp */
   size_t dest_len; /* total length of destination, including NUL */
   char *dest[1]; /* destination of bundle, allocated to keep dest_len bytes */
 };
 
+/* The idle connections of a bundle with the same `reuse_fp`, in the order
+ * they became idle. A connection that got used again is only removed
+ * when it is next come across. */
+struct cpool_idle_set {
+  struct Curl_llist conns;
+};
+
+/* A bundle's connections are mostly made with the same settings, a few
+ * slots are plenty */
+#define CPOOL_IDLE_SETS_SLOTS 7
+
 
 static void cpool_discard_conn(struct cpool *cpool,
                                struct Curl_easy *data,
                                struct connectdata *conn,
                                bool aborted);
 
+static void cpool_idle_set_dtor(unsigned int reuse_fp, void *value)
+{
+  struct cpool_idle_set *set = value;
+  (void)reuse_fp;
+  DEBUGASSERT(!Curl_llist_count(&set->conns));
+  free(set);
+}
+
 static struct cpool_bundle *cpool_bundle_create(const char *dest)
 {
   struct cpool_bundle *bundle;
@@ -97,6 +211,8 @@ static struct cpool_bundle *cpool_bundle_create(const char *dest)
   if(!bundle)
     return NULL;
   Curl_llist_init(&bundle->conns, NULL);
+  Curl_uint_hash_init(&bundle->idle_sets, CPOOL_IDLE_SETS_SLOTS,
+                      cpool_idle_set_dtor);
   bundle->dest_len = dest_len + 1;
   memcpy(bundle->dest, dest, bundle->dest_len);
   return bundle;
@@ -105,9 +221,54 @@ static struct cpool_bundle *cpool_bundle_create(const char *dest)
 static void cpool_bundle_destroy(struct cpool_bundle *bundle)
 {
   DEBUGASSERT(!Curl_llist_count(&bundle->conns));
+  DEBUGASSERT(!Curl_uint_hash_count(&bundle->idle_sets));
+  Curl_uint_hash_destroy(&bundle->idle_sets);
   free(bundle);
 }
 
+static struct cpool_idle_set *
+cpool_bundle_idle_set(struct cpool_bundle *bundle, unsigned int reuse_fp)
+{
+  return Curl_uint_hash_get(&bundle->idle_sets, reuse_fp);
+}
+
+/* Take a connection out of the idle index of its bundle */
+static void cpool_bundle_idle_remove(struct cpool_bundle *bundle,
+                                     struct connectdata *conn)
+{
+  struct cpool_idle_set *set;
+
+  if(!Curl_node_llist(&conn->cpool_idle_node))
+    return;
+  Curl_node_remove(&conn->cpool_idle_node);
+  set = cpool_bundle_idle_set(bundle, conn->reuse_fp);
+  DEBUGASSERT(set);
+  if(set && !Curl_llist_count(&set->conns))
+    Curl_uint_hash_remove(&bundle->idle_sets, conn->reuse_fp);
+}
+
+/* Add a connection that became idle to the idle index of its bundle.
+ * Without memory for it, the connection is only found the slow way. */
+static void cpool_bundle_idle_add(struct cpool_bundle *bundle,
+                                  struct connectdata *conn)
+{
+  struct cpool_idle_set *set;
+
+  cpool_bundle_idle_remove(bundle, conn);
+  set = cpool_bundle_idle_set(bundle, conn->reuse_fp);
+  if(!set) {
+    set = calloc(1, sizeof(*set));
+    if(!set)
+      return;
+    Curl_llist_init(&set->conns, NULL);
+    if(!Curl_uint_hash_set(&bundle->idle_sets, conn->reuse_fp, set)) {
+      free(set);
+      return;
+    }
+  }
+  Curl_llist_append(&set->conns, conn, &conn->cpool_idle_node);
+}
+
 /* Add a connection to a bundle */
 static void cpool_bundle_add(struct cpool_bundle *bundle,
                              struct connectdata *conn)
@@ -121,8 +282,8 @@ static void cpool_bundle_add(struct cpool_bundle *bundle,
 static void cpool_bundle_remove(struct cpool_bundle *bundle,
                                 struct connectdata *conn)
 {
-  (void)bundle;
   DEBUGASSERT(Curl_node_llist(&conn->cpool_node) == &bundle->conns);
+  cpool_bundle_idle_remove(bundle, conn);
   Curl_node_remove(&conn->cpool_node);
   conn->bits.in_cpool = FALSE;
 }
@@ -197,7 +358,7 @@ static void cpool_remove_conn(struct cpool *cpool,
       if(!Curl_llist_count(&bundle->conns))
         cpool_remove_bundle(cpool, bundle);
       conn->bits.in_cpool = FALSE;
-      cpool->num_conn--;
+      cpool_count_conn(cpool, FALSE);
     }
     else {
       /* Should have been in the bundle list */
@@ -206,8 +367,123 @@ static void cpool_remove_conn(struct cpool *cpool,
   }
 }
 
+#ifdef USE_CPOOL_LOCKS
+/* A split pool has the locks right behind its shards, its own last */
+#define cpool_locks(c) ((curl_mutex_t *)(void *)&(c)->shards[(c)->nshards])
+
+/* Init a built-in lock. Callbacks run under the lock of a shard may get
+ * back into the pool, with the transfer or the shard's internal handle,
+ * so a thread needs to be able to take it again. */
+static void cpool_mutex_init(curl_mutex_t *m)
+{
+#ifdef USE_THREADS_POSIX
+  pthread_mutexattr_t attr;
+  pthread_mutexattr_init(&attr);
+  pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+  pthread_mutex_init(m, &attr);
+  pthread_mutexattr_destroy(&attr);
+#else
+  /* critical sections are recursive */
+  Curl_mutex_init(m);
+#endif
+}
+
+static void cpool_shards_destroy(struct cpool *cpool)
+{
+  if(cpool->shards) {
+    curl_mutex_t *locks = cpool_locks(cpool);
+    unsigned int i;
+
+    for(i = 0; i < cpool->nshards; ++i) {
+      struct Curl_easy *idata = cpool->shards[i].idata;
+      Curl_cpool_destroy(&cpool->shards[i]);
+      Curl_close(&idata);
+      Curl_mutex_destroy(&locks[i]);
+    }
+    Curl_mutex_destroy(&locks[cpool->nshards]);
+    Curl_safefree(cpool->shards);
+    cpool->mutex = NULL;
+    cpool->nshards = 0;
+  }
+}
+
+/* Create the internal handle of a shard. Shards are used from several
+ * threads at once, each one gets its own for the connections it shuts
+ * down, used under the shard's lock only. */
+static struct Curl_easy *cpool_shard_idata(struct cpool *cpool)
+{
+  struct Curl_easy *idata = curl_easy_init();
+
+  if(idata) {
+    /* admin handles have mid 0 */
+    idata->mid = 0;
+    idata->state.internal = TRUE;
+    idata->set.verbose = cpool->idata->set.verbose;
+  }
+  return idata;
+}
+#endif
+
+CURLcode Curl_cpool_set_shards(struct cpool *cpool, unsigned int nshards)
+{
+#ifdef USE_CPOOL_LOCKS
+  struct cpool *shards;
+  curl_mutex_t *locks;
+  curl_off_t id_base;
+  unsigned int i;
+
+  if(nshards > CURL_CPOOL_MAX_SHARDS)
+    return CURLE_BAD_FUNCTION_ARGUMENT;
+  if(!cpool->initialised || cpool->num_conn)
+    return CURLE_FAILED_INIT;
+  if(nshards <= 1) {
+    cpool_shards_destroy(cpool);
+    return CURLE_OK;
+  }
+  shards = calloc(1, (nshards * sizeof(*shards)) +
+                  ((nshards + 1) * sizeof(*locks)));
+  if(!shards)
+    return CURLE_OUT_OF_MEMORY;
+  for(i = 0; i < nshards; ++i) {
+    shards[i].idata = cpool_shard_idata(cpool);
+    if(!shards[i].idata) {
+      while(i)
+        Curl_close(&shards[--i].idata);
+      free(shards);
+      return CURLE_OUT_OF_MEMORY;
+    }
+  }
+
+  cpool_shards_destroy(cpool);
+  cpool->shards = shards;
+  cpool->nshards = nshards;
+  locks = cpool_locks(cpool);
+  /* continue the connection ids the pool handed out so far, starting at a
+   * multiple of `nshards` so that an id tells its shard */
+  id_base = cpool->next_connection_id + nshards - 1;
+  id_base -= id_base % nshards;
+  for(i = 0; i < nshards; ++i) {
+    Curl_cpool_init(&shards[i], shards[i].idata, cpool->share, 23);
+    cpool_mutex_init(&locks[i]);
+    shards[i].mutex = &locks[i];
+    shards[i].parent = cpool;
+    shards[i].next_connection_id = id_base + i;
+  }
+  cpool_mutex_init(&locks[nshards]);
+  cpool->mutex = &locks[nshards];
+  return CURLE_OK;
+#else
+  (void)cpool;
+  return (nshards <= 1) ? CURLE_OK : CURLE_NOT_BUILT_IN;
+#endif
+}
+
 void Curl_cpool_destroy(struct cpool *cpool)
 {
+#ifdef USE_CPOOL_LOCKS
+  if(cpool)
+    cpool_shards_destroy(cpool);
+#endif
   if(cpool && cpool->initialised && cpool->idata) {
     struct connectdata *conn;
     SIGPIPE_VARIABLE(pipe_st);
@@ -337,7 +613,7 @@ static struct connectdata *cpool_get_oldest_idle(struct cpool *cpool)
       if(CONN_INUSE(conn) || conn->bits.close || conn->connect_only)
         continue;
       /* Set higher score for the age passed since the connection was used */
-      score = curlx_timediff(now, conn->lastused);
+      score = curlx_timediff_us(now, conn->lastused);
       if(score > highscore) {
         highscore = score;
         oldest_idle = conn;
@@ -351,7 +627,8 @@ static struct connectdata *cpool_get_oldest_idle(struct cpool *cpool)
 int Curl_cpool_check_limits(struct Curl_easy *data,
                             struct connectdata *conn)
 {
-  struct cpool *cpool = cpool_get_instance(data);
+  struct cpool *cpool = cpool_shard(cpool_get_instance(data),
+                                    conn->destination);
   struct cpool_bundle *bundle;
   size_t dest_limit = 0;
   size_t total_limit = 0;
@@ -411,8 +688,9 @@ int Curl_cpool_check_limits(struct Curl_easy *data,
   }
 
   if(total_limit) {
+    /* a split pool evicts from the shard of the new connection only */
     shutdowns = Curl_cshutdn_count(cpool->idata);
-    while((cpool->num_conn + shutdowns) >= total_limit) {
+    while((cpool_total_conn(cpool) + shutdowns) >= total_limit) {
       if(shutdowns) {
         /* close one connection in shutdown right away, if we can */
         if(!Curl_cshutdn_close_oldest(data, NULL))
@@ -426,12 +704,13 @@ int Curl_cpool_check_limits(struct Curl_easy *data,
         CURL_TRC_M(data, "Discarding connection #%"
                    FMT_OFF_T " from %zu to reach total "
                    "limit of %zu",
-                   oldest_idle->connection_id, cpool->num_conn, total_limit);
+                   oldest_idle->connection_id, cpool_total_conn(cpool),
+                   total_limit);
         Curl_conn_terminate(cpool->idata, oldest_idle, FALSE);
       }
       shutdowns = Curl_cshutdn_count(cpool->idata);
     }
-    if((cpool->num_conn + shutdowns) >= total_limit) {
+    if((cpool_total_conn(cpool) + shutdowns) >= total_limit) {
       result = CPOOL_LIMIT_TOTAL;
       goto out;
     }
@@ -454,6 +733,7 @@ CURLcode Curl_cpool_add(struct Curl_easy *data,
   if(!cpool)
     return CURLE_FAILED_INIT;
 
+  cpool = cpool_shard(cpool, conn->destination);
   CPOOL_LOCK(cpool, data);
   bundle = cpool_find_bundle(cpool, conn);
   if(!bundle) {
@@ -465,11 +745,12 @@ CURLcode Curl_cpool_add(struct Curl_easy *data,
   }
 
   cpool_bundle_add(bundle, conn);
-  conn->connection_id = cpool->next_connection_id++;
-  cpool->num_conn++;
+  conn->connection_id = cpool->next_connection_id;
+  cpool->next_connection_id += cpool->parent ? cpool->parent->nshards : 1;
+  cpool_count_conn(cpool, TRUE);
   CURL_TRC_M(data, "[CPOOL] added connection %" FMT_OFF_T ". "
              "The cache now contains %zu members",
-             conn->connection_id, cpool->num_conn);
+             conn->connection_id, cpool_total_conn(cpool));
 out:
   CPOOL_UNLOCK(cpool, data);
 
@@ -532,21 +813,29 @@ static bool cpool_foreach(struct Curl_easy *data,
 bool Curl_cpool_conn_now_idle(struct Curl_easy *data,
                               struct connectdata *conn)
 {
-  unsigned int maxconnects = !data->multi->maxconnects ?
-    (Curl_multi_xfers_running(data->multi) * 4) : data->multi->maxconnects;
+  unsigned int maxconnects = data->multi->maxconnects;
   struct connectdata *oldest_idle = NULL;
-  struct cpool *cpool = cpool_get_instance(data);
+  struct cpool *cpool = cpool_shard(cpool_get_instance(data),
+                                    conn->destination);
   bool kept = TRUE;
 
+  if(!maxconnects) {
+    maxconnects = Curl_multi_xfers_running(data->multi) * 4;
+    if(maxconnects) /* leave room for the connections kept warm */
+      maxconnects += data->multi->prewarm_conns;
+  }
+
   conn->lastused = curlx_now(); /* it was used up until now */
-  if(cpool && maxconnects) {
+  if(cpool) {
     /* may be called form a callback already under lock */
-    bool do_lock = !CPOOL_IS_LOCKED(cpool);
+    bool do_lock = !CPOOL_IS_LOCKED(cpool, data);
+    size_t num_conn;
     if(do_lock)
       CPOOL_LOCK(cpool, data);
-    if(cpool->num_conn > maxconnects) {
+    num_conn = cpool_total_conn(cpool);
+    if(maxconnects && (num_conn > maxconnects)) {
       infof(data, "Connection pool is full, closing the oldest of %zu/%u",
-            cpool->num_conn, maxconnects);
+            num_conn, maxconnects);
 
       oldest_idle = cpool_get_oldest_idle(cpool);
       kept = (oldest_idle != conn);
@@ -554,6 +843,11 @@ bool Curl_cpool_conn_now_idle(struct Curl_easy *data,
         Curl_conn_terminate(data, oldest_idle, FALSE);
       }
     }
+    if(kept && conn->bits.in_cpool && !conn->connect_only) {
+      struct cpool_bundle *bundle = cpool_find_bundle(cpool, conn);
+      if(bundle)
+        cpool_bundle_idle_add(bundle, conn);
+    }
     if(do_lock)
       CPOOL_UNLOCK(cpool, data);
   }
@@ -563,12 +857,14 @@ bool Curl_cpool_conn_now_idle(struct Curl_easy *data,
 
 bool Curl_cpool_find(struct Curl_easy *data,
                      const char *destination,
+                     unsigned int reuse_fp,
                      Curl_cpool_conn_match_cb *conn_cb,
                      Curl_cpool_done_match_cb *done_cb,
                      void *userdata)
 {
   struct cpool *cpool = cpool_get_instance(data);
   struct cpool_bundle *bundle;
+  size_t dest_len = strlen(destination) + 1;
   bool result = FALSE;
 
   DEBUGASSERT(cpool);
@@ -576,17 +872,45 @@ bool Curl_cpool_find(struct Curl_easy *data,
   if(!cpool)
     return FALSE;
 
+  cpool = cpool_shard(cpool, destination);
   CPOOL_LOCK(cpool, data);
   bundle = Curl_hash_pick(&cpool->dest2bundle,
-                          CURL_UNCONST(destination),
-                          strlen(destination) + 1);
+                          CURL_UNCONST(destination), dest_len);
+  if(bundle) {
+    /* Idle connections made with the same settings most likely match */
+    struct cpool_idle_set *set = cpool_bundle_idle_set(bundle, reuse_fp);
+    struct Curl_llist_node *curr = set ? Curl_llist_head(&set->conns) : NULL;
+    while(curr) {
+      struct connectdata *conn = Curl_node_elem(curr);
+      /* Get next node now. callback might discard current */
+      curr = Curl_node_next(curr);
+
+      if(CONN_INUSE(conn))
+        /* used again since it became idle */
+        cpool_bundle_idle_remove(bundle, conn);
+      else if(conn_cb(conn, userdata)) {
+        result = TRUE;
+        break;
+      }
+    }
+    if(!result)
+      /* the callback may have discarded the bundle's last connection */
+      bundle = Curl_hash_pick(&cpool->dest2bundle,
+                              CURL_UNCONST(destination), dest_len);
+    else
+      bundle = NULL;
+  }
   if(bundle) {
+    /* Then all others, for example in use ones to multiplex on */
     struct Curl_llist_node *curr = Curl_llist_head(&bundle->conns);
     while(curr) {
       struct connectdata *conn = Curl_node_elem(curr);
       /* Get next node now. callback might discard current */
       curr = Curl_node_next(curr);
 
+      if(Curl_node_llist(&conn->cpool_idle_node) &&
+         (conn->reuse_fp == reuse_fp))
+        continue; /* already checked */
       if(conn_cb(conn, userdata)) {
         result = TRUE;
         break;
@@ -670,7 +994,8 @@ void Curl_conn_terminate(struct Curl_easy *data,
 
   /* This method may be called while we are under lock, e.g. from a
    * user callback in find. */
-  do_lock = !CPOOL_IS_LOCKED(cpool);
+  cpool = cpool_shard(cpool, conn->destination);
+  do_lock = !CPOOL_IS_LOCKED(cpool, data);
   if(do_lock)
     CPOOL_LOCK(cpool, data);
 
@@ -718,6 +1043,34 @@ static int cpool_reap_dead_cb(struct Curl_easy *data,
   return 0; /* continue iteration */
 }
 
+unsigned int Curl_cpool_idle_count(struct Curl_easy *data,
+                                   const char *destination,
+                                   unsigned int reuse_fp)
+{
+  struct cpool *cpool = cpool_get_instance(data);
+  struct cpool_bundle *bundle;
+  unsigned int count = 0;
+
+  if(!cpool)
+    return 0;
+
+  cpool = cpool_shard(cpool, destination);
+  CPOOL_LOCK(cpool, data);
+  bundle = Curl_hash_pick(&cpool->dest2bundle, CURL_UNCONST(destination),
+                          strlen(destination) + 1);
+  if(bundle) {
+    struct cpool_idle_set *set = cpool_bundle_idle_set(bundle, reuse_fp);
+    struct Curl_llist_node *e = set ? Curl_llist_head(&set->conns) : NULL;
+    for(; e; e = Curl_node_next(e)) {
+      struct connectdata *conn = Curl_node_elem(e);
+      if(!CONN_INUSE(conn) && !conn->bits.close)
+        count++;
+    }
+  }
+  CPOOL_UNLOCK(cpool, data);
+  return count;
+}
+
 /*
  * This function scans the data's connection pool for half-open/dead
  * connections, closes and removes them.
@@ -729,21 +1082,22 @@ void Curl_cpool_prune_dead(struct Curl_easy *data)
 {
   struct cpool *cpool = cpool_get_instance(data);
   struct cpool_reaper_ctx rctx;
-  timediff_t elapsed;
+  unsigned int i;
 
   if(!cpool)
     return;
 
   rctx.now = curlx_now();
-  CPOOL_LOCK(cpool, data);
-  elapsed = curlx_timediff(rctx.now, cpool->last_cleanup);
-
-  if(elapsed >= 1000L) {
-    while(cpool_foreach(data, cpool, &rctx, cpool_reap_dead_cb))
-      ;
-    cpool->last_cleanup = rctx.now;
+  for(i = 0; i < CPOOL_PARTS(cpool); ++i) {
+    struct cpool *part = CPOOL_PART(cpool, i);
+    CPOOL_LOCK(part, data);
+    if(curlx_timediff(rctx.now, part->last_cleanup) >= 1000L) {
+      while(cpool_foreach(data, part, &rctx, cpool_reap_dead_cb))
+        ;
+      part->last_cleanup = rctx.now;
+    }
+    CPOOL_UNLOCK(part, data);
   }
-  CPOOL_UNLOCK(cpool, data);
 }
 
 static int conn_upkeep(struct Curl_easy *data,
@@ -759,13 +1113,17 @@ CURLcode Curl_cpool_upkeep(void *data)
 {
   struct cpool *cpool = cpool_get_instance(data);
   struct curltime now = curlx_now();
+  unsigned int i;
 
   if(!cpool)
     return CURLE_OK;
 
-  CPOOL_LOCK(cpool, data);
-  cpool_foreach(data, cpool, &now, conn_upkeep);
-  CPOOL_UNLOCK(cpool, data);
+  for(i = 0; i < CPOOL_PARTS(cpool); ++i) {
+    struct cpool *part = CPOOL_PART(cpool, i);
+    CPOOL_LOCK(part, data);
+    cpool_foreach(data, part, &now, conn_upkeep);
+    CPOOL_UNLOCK(part, data);
+  }
   return CURLE_OK;
 }
 
@@ -796,6 +1154,7 @@ struct connectdata *Curl_cpool_get_conn(struct Curl_easy *data,
     return NULL;
   fctx.id = conn_id;
   fctx.conn = NULL;
+  cpool = cpool_shard_by_id(cpool, conn_id);
   CPOOL_LOCK(cpool, data);
   cpool_foreach(data, cpool, &fctx, cpool_find_conn);
   CPOOL_UNLOCK(cpool, data);
@@ -831,6 +1190,7 @@ void Curl_cpool_do_by_id(struct Curl_easy *data, curl_off_t conn_id,
   dctx.id = conn_id;
   dctx.cb = cb;
   dctx.cbdata = cbdata;
+  cpool = cpool_shard_by_id(cpool, conn_id);
   CPOOL_LOCK(cpool, data);
   cpool_foreach(data, cpool, &dctx, cpool_do_conn);
   CPOOL_UNLOCK(cpool, data);
@@ -840,7 +1200,8 @@ void Curl_cpool_do_locked(struct Curl_easy *data,
                           struct connectdata *conn,
                           Curl_cpool_conn_do_cb *cb, void *cbdata)
 {
-  struct cpool *cpool = cpool_get_instance(data);
+  struct cpool *cpool = cpool_shard(cpool_get_instance(data),
+                                    conn->destination);
   if(cpool) {
     CPOOL_LOCK(cpool, data);
     cb(conn, data, cbdata);
@@ -874,13 +1235,17 @@ static int cpool_reap_no_reuse(struct Curl_easy *data,
 void Curl_cpool_nw_changed(struct Curl_easy *data)
 {
   struct cpool *cpool = cpool_get_instance(data);
+  unsigned int i;
 
   if(cpool) {
-    CPOOL_LOCK(cpool, data);
-    cpool_foreach(data, cpool, NULL, cpool_mark_stale);
-    while(cpool_foreach(data, cpool, NULL, cpool_reap_no_reuse))
-      ;
-    CPOOL_UNLOCK(cpool, data);
+    for(i = 0; i < CPOOL_PARTS(cpool); ++i) {
+      struct cpool *part = CPOOL_PART(cpool, i);
+      CPOOL_LOCK(part, data);
+      cpool_foreach(data, part, NULL, cpool_mark_stale);
+      while(cpool_foreach(data, part, NULL, cpool_reap_no_reuse))
+        ;
+      CPOOL_UNLOCK(part, data);
+    }
   }
 }
 
@@ -27,6 +27,7 @@
 
 #include <curl/curl.h>
 #include "curlx/timeval.h"
+#include "curl_threads.h"
 
 struct connectdata;
 struct Curl_easy;
@@ -48,15 +49,32 @@ void Curl_conn_terminate(struct Curl_easy *data,
                          struct connectdata *conn,
                          bool aborted);
 
+#if defined(USE_THREADS_POSIX) || defined(USE_THREADS_WIN32)
+#define USE_CPOOL_LOCKS
+#endif
+
+/* The most shards a connection pool can be split into */
+#define CURL_CPOOL_MAX_SHARDS 64
+
+/* A pool split into shards keeps its connections in `nshards` pools, a
+ * connection lives in the shard its destination hashes to. Each shard has a
+ * built-in lock, so does the split pool itself for its counters. */
 struct cpool {
    /* the pooled connections, bundled per destination */
   struct Curl_hash dest2bundle;
-  size_t num_conn;
+  size_t num_conn; /* of the pool, a split pool counts all shards */
   curl_off_t next_connection_id;
   curl_off_t next_easy_id;
   struct curltime last_cleanup;
   struct Curl_easy *idata; /* internal handle for maintenance */
   struct Curl_share *share; /* != NULL if pool belongs to share */
+  struct cpool *shards; /* != NULL if split into `nshards` pools */
+  struct cpool *parent; /* the split pool, if this is a shard */
+#ifdef USE_CPOOL_LOCKS
+  curl_mutex_t *mutex; /* built-in lock or NULL */
+  unsigned int lock_depth; /* times the built-in lock is held */
+#endif
+  unsigned int nshards;
   BIT(locked);
   BIT(initialised);
 };
@@ -72,6 +90,10 @@ void Curl_cpool_init(struct cpool *cpool,
 /* Destroy all connections and free all members */
 void Curl_cpool_destroy(struct cpool *connc);
 
+/* Split the (empty) pool into `nshards` shards that each use a built-in
+ * lock. `nshards` of 1 or less goes back to a single pool. */
+CURLcode Curl_cpool_set_shards(struct cpool *cpool, unsigned int nshards);
+
 /* Init the transfer to be used within its connection pool.
  * Assigns `data->id`. */
 void Curl_cpool_xfer_init(struct Curl_easy *data);
@@ -107,6 +129,8 @@ typedef bool Curl_cpool_done_match_cb(bool result, void *userdata);
  * All callbacks are invoked while the pool's lock is held.
  * @param data        current transfer
  * @param destination match against `conn->destination` in pool
+ * @param reuse_fp    idle connections with this `conn->reuse_fp` are
+ *                    offered to `conn_cb` first
  * @param conn_cb     must be present, called for each connection in the
  *                    bundle until it returns TRUE
  * @return combined result of last conn_db and result_cb or FALSE if no
@@ -114,6 +138,7 @@ typedef bool Curl_cpool_done_match_cb(bool result, void *userdata);
  */
 bool Curl_cpool_find(struct Curl_easy *data,
                      const char *destination,
+                     unsigned int reuse_fp,
                      Curl_cpool_conn_match_cb *conn_cb,
                      Curl_cpool_done_match_cb *done_cb,
                      void *userdata);
@@ -127,6 +152,14 @@ bool Curl_cpool_find(struct Curl_easy *data,
 bool Curl_cpool_conn_now_idle(struct Curl_easy *data,
                               struct connectdata *conn);
 
+/**
+ * Return the number of idle connections to `destination` in the
+ * data's pool that have the given `reuse_fp`.
+ */
+unsigned int Curl_cpool_idle_count(struct Curl_easy *data,
+                                   const char *destination,
+                                   unsigned int reuse_fp);
+
 /**
  * This function scans the data's connection pool for half-open/dead
  * connections, closes and removes them.
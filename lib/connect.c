@@ -508,6 +508,7 @@ struct Curl_cftype Curl_cft_setup = {
   Curl_cf_def_adjust_pollset,
   Curl_cf_def_data_pending,
   Curl_cf_def_send,
+  Curl_cf_def_sendv,
   Curl_cf_def_recv,
   Curl_cf_def_cntrl,
   Curl_cf_def_conn_is_alive,
@@ -87,6 +87,48 @@ Curl_freeaddrinfo(struct Curl_addrinfo *cahead)
   }
 }
 
+/*
+ * Curl_addrinfo_dup()
+ *
+ * Copies a linked list of Curl_addrinfo structs. Each element of the copy is
+ * a single allocation, like Curl_getaddrinfo_ex() creates them, so it can be
+ * freed with Curl_freeaddrinfo().
+ */
+struct Curl_addrinfo *
+Curl_addrinfo_dup(const struct Curl_addrinfo *cahead)
+{
+  const struct Curl_addrinfo *ai;
+  struct Curl_addrinfo *cafirst = NULL;
+  struct Curl_addrinfo *calast = NULL;
+  struct Curl_addrinfo *ca;
+
+  for(ai = cahead; ai; ai = ai->ai_next) {
+    size_t namelen = ai->ai_canonname ? strlen(ai->ai_canonname) + 1 : 0;
+
+    ca = malloc(sizeof(struct Curl_addrinfo) + ai->ai_addrlen + namelen);
+    if(!ca) {
+      Curl_freeaddrinfo(cafirst);
+      return NULL;
+    }
+    *ca = *ai;
+    ca->ai_next = NULL;
+    ca->ai_canonname = NULL;
+    ca->ai_addr = (void *)((char *)ca + sizeof(struct Curl_addrinfo));
+    memcpy(ca->ai_addr, ai->ai_addr, ai->ai_addrlen);
+    if(namelen) {
+      ca->ai_canonname = (void *)((char *)ca->ai_addr + ai->ai_addrlen);
+      memcpy(ca->ai_canonname, ai->ai_canonname, namelen);
+    }
+
+    if(!cafirst)
+      cafirst = ca;
+    if(calast)
+      calast->ai_next = ca;
+    calast = ca;
+  }
+  return cafirst;
+}
+
 
 #ifdef HAVE_GETADDRINFO
 /*
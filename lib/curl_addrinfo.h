@@ -63,6 +63,10 @@ struct Curl_addrinfo {
 void
 Curl_freeaddrinfo(struct Curl_addrinfo *cahead);
 
+/* Return an allocated copy of the list or NULL on out of memory */
+struct Curl_addrinfo *
+Curl_addrinfo_dup(const struct Curl_addrinfo *cahead);
+
 #ifdef HAVE_GETADDRINFO
 int
 Curl_getaddrinfo_ex(const char *nodename,
@@ -433,6 +433,9 @@
 /* Define to 1 if you have the `eventfd' function. */
 #cmakedefine HAVE_EVENTFD 1
 
+/* Define to 1 if you have the `epoll_create1' function. */
+#cmakedefine HAVE_EPOLL_CREATE1 1
+
 /* If you have poll */
 #cmakedefine HAVE_POLL 1
 
@@ -562,6 +565,9 @@
 /* Define to 1 if you have the timeval struct. */
 #cmakedefine HAVE_STRUCT_TIMEVAL 1
 
+/* Define to 1 if you have the <sys/epoll.h> header file. */
+#cmakedefine HAVE_SYS_EPOLL_H 1
+
 /* Define to 1 if you have the <sys/eventfd.h> header file. */
 #cmakedefine HAVE_SYS_EVENTFD_H 1
 
@@ -761,6 +767,9 @@ ${SIZEOF_TIME_T_CODE}
 /* if Unix domain sockets are enabled  */
 #cmakedefine USE_UNIX_SOCKETS 1
 
+/* if batched socket receives using io_uring are enabled */
+#cmakedefine USE_IO_URING 1
+
 /* Define to 1 if you are building a Windows target with large file support. */
 #cmakedefine USE_WIN32_LARGE_FILES 1
 
@@ -24,9 +24,6 @@
 
 #include "curl_setup.h"
 
-#if !defined(CURL_DISABLE_COOKIES) || !defined(CURL_DISABLE_ALTSVC) ||  \
-  !defined(CURL_DISABLE_HSTS) || !defined(CURL_DISABLE_NETRC)
-
 #include "curl_get_line.h"
 #include "curl_memory.h"
 /* The last #include file should be: */
@@ -90,5 +87,3 @@ int Curl_get_line(struct dynbuf *buf, FILE *input)
   }
   return 0;
 }
-
-#endif /* if not disabled */
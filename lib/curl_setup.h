@@ -462,6 +462,11 @@
 #define USE_EVENTFD
 #endif
 
+/* Whether to offer the epoll() based event backend for multi handles */
+#if defined(HAVE_EPOLL_CREATE1) && defined(HAVE_SYS_EPOLL_H)
+#define USE_EPOLL
+#endif
+
 #include <stdio.h>
 #include <assert.h>
 
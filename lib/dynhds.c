@@ -214,6 +214,38 @@ CURLcode Curl_dynhds_cadd(struct dynhds *dynhds,
   return Curl_dynhds_add(dynhds, name, strlen(name), value, strlen(value));
 }
 
+CURLcode Curl_dynhds_setn_value(struct dynhds *dynhds, size_t n,
+                                const char *value, size_t valuelen)
+{
+  struct dynhds_entry *e, *entry;
+
+  DEBUGASSERT(dynhds);
+  if(n >= dynhds->hds_len)
+    return CURLE_BAD_FUNCTION_ARGUMENT;
+  e = dynhds->hds[n];
+  if(dynhds->strs_len - e->valuelen + valuelen > dynhds->max_strs_size)
+    return CURLE_OUT_OF_MEMORY;
+  /* the name is already in shape, do not apply the options again */
+  entry = entry_new(e->name, e->namelen, value, valuelen, DYNHDS_OPT_NONE);
+  if(!entry)
+    return CURLE_OUT_OF_MEMORY;
+  dynhds->strs_len = dynhds->strs_len - e->valuelen + valuelen;
+  dynhds->hds[n] = entry;
+  entry_free(e);
+  return CURLE_OK;
+}
+
+void Curl_dynhds_truncate(struct dynhds *dynhds, size_t n)
+{
+  DEBUGASSERT(dynhds);
+  while(dynhds->hds_len > n) {
+    struct dynhds_entry *e = dynhds->hds[--dynhds->hds_len];
+    dynhds->strs_len -= e->namelen + e->valuelen;
+    entry_free(e);
+    dynhds->hds[dynhds->hds_len] = NULL;
+  }
+}
+
 CURLcode Curl_dynhds_h1_add_line(struct dynhds *dynhds,
                                  const char *line, size_t line_len)
 {
@@ -154,6 +154,18 @@ CURLcode Curl_dynhds_add(struct dynhds *dynhds,
 CURLcode Curl_dynhds_cadd(struct dynhds *dynhds,
                           const char *name, const char *value);
 
+/**
+ * Replace the value of the `n`-th header entry, keeping its name.
+ * Returns CURLE_BAD_FUNCTION_ARGUMENT when there is no such entry.
+ */
+CURLcode Curl_dynhds_setn_value(struct dynhds *dynhds, size_t n,
+                                const char *value, size_t valuelen);
+
+/**
+ * Remove the header entries from the `n`-th on.
+ */
+void Curl_dynhds_truncate(struct dynhds *dynhds, size_t n);
+
 /**
  * Add a single header from an HTTP/1.1 formatted line at the end. Line
  * may contain a delimiting CRLF or just LF. Any characters after
@@ -63,6 +63,11 @@
 #include "strcase.h"
 #include "easy_lock.h"
 #include "curlx/strparse.h"
+#include "curl_get_line.h"
+#include "fopen.h"
+#include "rename.h"
+#include "escape.h"
+#include "strdup.h"
 
 /* The last 3 #include files should be in this order */
 #include "curl_printf.h"
@@ -183,8 +188,48 @@ struct dnscache_prune_data {
   struct curltime now;
   timediff_t oldest_ms; /* oldest time in cache not pruned. */
   timediff_t max_age_ms;
+  timediff_t neg_max_age_ms; /* for negative entries */
 };
 
+/*
+ * The maximum age of negative entries in the DNS cache, -1 for forever.
+ */
+static timediff_t dnscache_neg_timeout_ms(struct Curl_easy *data)
+{
+  if(data->set.dns_negative_timeout_ms >= 0)
+    return data->set.dns_negative_timeout_ms;
+  if(data->set.dns_cache_timeout_ms == -1)
+    return -1;
+  /* by default, negative entries are kept half as long */
+  return data->set.dns_cache_timeout_ms / 2;
+}
+
+/*
+ * How long entries older than the DNS cache timeout are still used while
+ * they are resolved again.
+ */
+static timediff_t dnscache_stale_timeout_ms(struct Curl_easy *data)
+{
+  if(data->set.dns_cache_timeout_ms == -1)
+    return 0;
+  return data->set.dns_stale_timeout_ms;
+}
+
+/*
+ * The maximum age of positive entries in the DNS cache, -1 for forever.
+ */
+static timediff_t dnscache_max_age_ms(struct Curl_easy *data)
+{
+  timediff_t stale_ms;
+
+  if(data->set.dns_cache_timeout_ms == -1)
+    return -1;
+  stale_ms = dnscache_stale_timeout_ms(data);
+  if(stale_ms > TIMEDIFF_T_MAX - data->set.dns_cache_timeout_ms)
+    return TIMEDIFF_T_MAX;
+  return data->set.dns_cache_timeout_ms + stale_ms;
+}
+
 /*
  * This function is set as a callback to be called for every entry in the DNS
  * cache when we want to prune old unused entries.
@@ -202,9 +247,11 @@ dnscache_entry_is_stale(void *datap, void *hc)
   if(dns->timestamp.tv_sec || dns->timestamp.tv_usec) {
     /* get age in milliseconds */
     timediff_t age = curlx_timediff(prune->now, dns->timestamp);
-    if(!dns->addr)
-      age *= 2; /* negative entries age twice as fast */
-    if(age >= prune->max_age_ms)
+    timediff_t max_age_ms = dns->addr ?
+      prune->max_age_ms : prune->neg_max_age_ms;
+    if(max_age_ms == -1)
+      return FALSE; /* kept forever, does not count as oldest */
+    if(age >= max_age_ms)
       return TRUE;
     if(age > prune->oldest_ms)
       prune->oldest_ms = age;
@@ -218,11 +265,12 @@ dnscache_entry_is_stale(void *datap, void *hc)
  */
 static timediff_t
 dnscache_prune(struct Curl_hash *hostcache, timediff_t cache_timeout_ms,
-               struct curltime now)
+               timediff_t neg_timeout_ms, struct curltime now)
 {
   struct dnscache_prune_data user;
 
   user.max_age_ms = cache_timeout_ms;
+  user.neg_max_age_ms = neg_timeout_ms;
   user.now = now;
   user.oldest_ms = 0;
 
@@ -242,20 +290,206 @@ static struct Curl_dnscache *dnscache_get(struct Curl_easy *data)
   return NULL;
 }
 
+/* Return the shard the entry with the given id lives in. */
+static unsigned int
+dnscache_shard(struct Curl_dnscache *dnscache, const char *id, size_t idlen)
+{
+  if(dnscache->nshards > 1)
+    return (unsigned int)Curl_hash_str(CURL_UNCONST(id), idlen + 1,
+                                       dnscache->nshards);
+  return 0;
+}
+
+static unsigned int
+dnscache_entry_shard(struct Curl_dnscache *dnscache,
+                     struct Curl_dns_entry *dns)
+{
+  char id[MAX_HOSTCACHE_LEN];
+  size_t idlen;
+
+  if(dnscache->nshards <= 1)
+    return 0;
+  idlen = create_dnscache_id(dns->hostname, 0, dns->hostport, id, sizeof(id));
+  return dnscache_shard(dnscache, id, idlen);
+}
+
+#ifdef USE_DNSCACHE_LOCKS
+/* A cache with allocated shards has the locks right behind them */
+#define dnscache_locks(c)                                         \
+  (((c)->shards != &(c)->one) ?                                   \
+   (curl_mutex_t *)(void *)&(c)->shards[(c)->nshards] : NULL)
+#endif
+
 static void dnscache_lock(struct Curl_easy *data,
-                          struct Curl_dnscache *dnscache)
+                          struct Curl_dnscache *dnscache,
+                          unsigned int shard)
 {
+#ifdef USE_DNSCACHE_LOCKS
+  curl_mutex_t *locks = dnscache_locks(dnscache);
+  if(locks) {
+    Curl_mutex_acquire(&locks[shard]);
+    return;
+  }
+#else
+  (void)shard;
+#endif
   if(data->share && dnscache == &data->share->dnscache)
     Curl_share_lock(data, CURL_LOCK_DATA_DNS, CURL_LOCK_ACCESS_SINGLE);
 }
 
 static void dnscache_unlock(struct Curl_easy *data,
-                            struct Curl_dnscache *dnscache)
+                            struct Curl_dnscache *dnscache,
+                            unsigned int shard)
 {
+#ifdef USE_DNSCACHE_LOCKS
+  curl_mutex_t *locks = dnscache_locks(dnscache);
+  if(locks) {
+    Curl_mutex_release(&locks[shard]);
+    return;
+  }
+#else
+  (void)shard;
+#endif
   if(data->share && dnscache == &data->share->dnscache)
     Curl_share_unlock(data, CURL_LOCK_DATA_DNS);
 }
 
+#ifdef CURLRES_THREADED
+/* An expired entry being resolved again in the background */
+struct dnscache_refresh {
+  struct Curl_llist_node node; /* in the cache's `refreshes` */
+  struct async_thrdd_addr_ctx *addr_ctx;
+  struct Curl_addrinfo *addr; /* the result, once done */
+  int port;
+  char hostname[1];
+};
+
+static void dnscache_refresh_free(struct dnscache_refresh *refresh)
+{
+  Curl_async_thrdd_refresh_free(&refresh->addr_ctx);
+  Curl_freeaddrinfo(refresh->addr);
+  free(refresh);
+}
+
+/* Return the refresh of `hostname` and `port` that is going on, if any.
+ * Called with the cache locked. */
+static struct dnscache_refresh *
+dnscache_refresh_find(struct Curl_dnscache *dnscache,
+                      const char *hostname, int port)
+{
+  struct Curl_llist_node *e;
+
+  for(e = Curl_llist_head(&dnscache->refreshes); e; e = Curl_node_next(e)) {
+    struct dnscache_refresh *refresh = Curl_node_elem(e);
+    if((refresh->port == port) && curl_strequal(refresh->hostname, hostname))
+      return refresh;
+  }
+  return NULL;
+}
+
+/* Start resolving an expired entry again, unless that is already going
+ * on. Failing to start it only means the entry expires. */
+static void dnscache_refresh_start(struct Curl_easy *data,
+                                   struct Curl_dnscache *dnscache,
+                                   const char *hostname, int port,
+                                   int ip_version)
+{
+  struct dnscache_refresh *refresh;
+  size_t hlen = strlen(hostname);
+  bool running;
+
+  dnscache_lock(data, dnscache, 0);
+  running = !!dnscache_refresh_find(dnscache, hostname, port);
+  dnscache_unlock(data, dnscache, 0);
+  if(running)
+    return;
+
+  refresh = calloc(1, sizeof(*refresh) + hlen);
+  if(!refresh)
+    return;
+  refresh->port = port;
+  memcpy(refresh->hostname, hostname, hlen);
+  refresh->addr_ctx = Curl_async_thrdd_refresh_start(data, hostname, port,
+                                                     ip_version);
+  if(!refresh->addr_ctx) {
+    free(refresh);
+    return;
+  }
+  dnscache_lock(data, dnscache, 0);
+  /* another transfer may have started one in the meantime */
+  running = !!dnscache_refresh_find(dnscache, hostname, port);
+  if(!running)
+    Curl_llist_append(&dnscache->refreshes, refresh, &refresh->node);
+  dnscache_unlock(data, dnscache, 0);
+  if(running)
+    dnscache_refresh_free(refresh);
+  else
+    CURL_TRC_DNS(data, "refreshing %s:%d in the background", hostname, port);
+}
+
+/* Put the results of finished refreshes into the cache. */
+static void dnscache_refresh_collect(struct Curl_easy *data,
+                                     struct Curl_dnscache *dnscache)
+{
+  struct Curl_llist done;
+  struct Curl_llist_node *e, *n;
+
+  if(!dnscache_stale_timeout_ms(data))
+    return;
+
+  Curl_llist_init(&done, NULL);
+  dnscache_lock(data, dnscache, 0);
+  for(e = Curl_llist_head(&dnscache->refreshes); e; e = n) {
+    struct dnscache_refresh *refresh = Curl_node_elem(e);
+    n = Curl_node_next(e);
+    if(Curl_async_thrdd_refresh_done(refresh->addr_ctx, &refresh->addr)) {
+      Curl_node_remove(e);
+      Curl_llist_append(&done, refresh, &refresh->node);
+    }
+  }
+  dnscache_unlock(data, dnscache, 0);
+
+  for(e = Curl_llist_head(&done); e; e = Curl_llist_head(&done)) {
+    struct dnscache_refresh *refresh = Curl_node_elem(e);
+    Curl_node_remove(e);
+    if(refresh->addr) {
+      /* the new entry replaces the expired one */
+      struct Curl_dns_entry *dns =
+        Curl_dnscache_mk_entry(data, refresh->addr, refresh->hostname, 0,
+                               refresh->port, FALSE);
+      refresh->addr = NULL;
+      if(dns) {
+        if(!Curl_dnscache_add(data, dns))
+          CURL_TRC_DNS(data, "refreshed %s:%d", refresh->hostname,
+                       refresh->port);
+        Curl_resolv_unlink(data, &dns);
+      }
+    }
+    else
+      CURL_TRC_DNS(data, "refresh of %s:%d failed", refresh->hostname,
+                   refresh->port);
+    dnscache_refresh_free(refresh);
+  }
+}
+
+static void dnscache_refresh_clear(struct Curl_dnscache *dnscache)
+{
+  struct Curl_llist_node *e;
+
+  for(e = Curl_llist_head(&dnscache->refreshes); e;
+      e = Curl_llist_head(&dnscache->refreshes)) {
+    struct dnscache_refresh *refresh = Curl_node_elem(e);
+    Curl_node_remove(e);
+    dnscache_refresh_free(refresh);
+  }
+}
+#else
+/* without a resolver running in the background, entries do not go stale */
+#define dnscache_refresh_start(a,b,c,d,e) Curl_nop_stmt
+#define dnscache_refresh_collect(x,y) Curl_nop_stmt
+#define dnscache_refresh_clear(x) Curl_nop_stmt
+#endif /* CURLRES_THREADED */
+
 /*
  * Library-wide function for pruning the DNS cache. This function takes and
  * returns the appropriate locks.
@@ -263,46 +497,63 @@ static void dnscache_unlock(struct Curl_easy *data,
 void Curl_dnscache_prune(struct Curl_easy *data)
 {
   struct Curl_dnscache *dnscache = dnscache_get(data);
+  timediff_t neg_timeout_ms = dnscache_neg_timeout_ms(data);
   struct curltime now;
-  /* the timeout may be set -1 (forever) */
-  timediff_t timeout_ms = data->set.dns_cache_timeout_ms;
+  size_t max_entries;
+  unsigned int i;
 
-  if(!dnscache || (timeout_ms == -1))
+  /* the timeouts may be set -1 (forever) */
+  if(!dnscache ||
+     ((data->set.dns_cache_timeout_ms == -1) && (neg_timeout_ms == -1)))
     /* NULL hostcache means we cannot do it */
     return;
 
-  dnscache_lock(data, dnscache);
+  dnscache_refresh_collect(data, dnscache);
 
+  /* each shard keeps its part of the maximum */
+  max_entries = MAX_DNS_CACHE_SIZE / dnscache->nshards;
   now = curlx_now();
 
-  do {
-    /* Remove outdated and unused entries from the hostcache */
-    timediff_t oldest_ms = dnscache_prune(&dnscache->entries, timeout_ms, now);
+  for(i = 0; i < dnscache->nshards; ++i) {
+    struct Curl_hash *entries = &dnscache->shards[i];
+    timediff_t timeout_ms = dnscache_max_age_ms(data);
+    timediff_t neg_ms = neg_timeout_ms;
+    timediff_t age_ms;
 
-    if(Curl_hash_count(&dnscache->entries) > MAX_DNS_CACHE_SIZE) {
-      if(oldest_ms < INT_MAX)
-        /* prune the ones over half this age */
-        timeout_ms = (int)oldest_ms / 2;
-      else
-        timeout_ms = INT_MAX/2;
-    }
-    else
-      break;
+    dnscache_lock(data, dnscache, i);
+    do {
+      /* Remove outdated and unused entries from the hostcache */
+      timediff_t oldest_ms = dnscache_prune(entries, timeout_ms, neg_ms, now);
 
-    /* if the cache size is still too big, use the oldest age as new prune
-       limit */
-  } while(timeout_ms);
+      if(Curl_hash_count(entries) <= max_entries)
+        break;
 
-  dnscache_unlock(data, dnscache);
+      /* if the cache size is still too big, prune the entries over half the
+         age of the oldest one that may expire */
+      if(oldest_ms < INT_MAX)
+        age_ms = (int)oldest_ms / 2;
+      else
+        age_ms = INT_MAX/2;
+      /* positive entries kept forever stay, only negative ones age then */
+      if(timeout_ms != -1)
+        timeout_ms = age_ms;
+      if((neg_ms == -1) || (neg_ms > age_ms))
+        neg_ms = age_ms;
+    } while(age_ms);
+    dnscache_unlock(data, dnscache, i);
+  }
 }
 
 void Curl_dnscache_clear(struct Curl_easy *data)
 {
   struct Curl_dnscache *dnscache = dnscache_get(data);
   if(dnscache) {
-    dnscache_lock(data, dnscache);
-    Curl_hash_clean(&dnscache->entries);
-    dnscache_unlock(data, dnscache);
+    unsigned int i;
+    for(i = 0; i < dnscache->nshards; ++i) {
+      dnscache_lock(data, dnscache, i);
+      Curl_hash_clean(&dnscache->shards[i]);
+      dnscache_unlock(data, dnscache, i);
+    }
   }
 }
 
@@ -314,48 +565,45 @@ static sigjmp_buf curl_jmpenv;
 static curl_simple_lock curl_jmpenv_lock;
 #endif
 
-/* lookup address, returns entry if found and not stale */
-static struct Curl_dns_entry *fetch_addr(struct Curl_easy *data,
-                                         struct Curl_dnscache *dnscache,
-                                         const char *hostname,
-                                         int port,
-                                         int ip_version)
+/* lookup the entry with the given id, returns entry if found and not
+ * stale. Takes the lock of the shard and a reference on the entry. An
+ * expired entry that may still be used while it is resolved again sets
+ * `*pexpired`, when provided. */
+static struct Curl_dns_entry *fetch_id(struct Curl_easy *data,
+                                       struct Curl_dnscache *dnscache,
+                                       char *entry_id,
+                                       size_t entry_len,
+                                       int ip_version,
+                                       bool *pexpired)
 {
-  struct Curl_dns_entry *dns = NULL;
-  char entry_id[MAX_HOSTCACHE_LEN];
-  size_t entry_len;
-
-  if(!dnscache)
-    return NULL;
+  unsigned int shard;
+  struct Curl_dns_entry *dns;
 
-  /* Create an entry id, based upon the hostname and port */
-  entry_len = create_dnscache_id(hostname, 0, port,
-                                 entry_id, sizeof(entry_id));
+  shard = dnscache_shard(dnscache, entry_id, entry_len);
+  dnscache_lock(data, dnscache, shard);
 
   /* See if it is already in our dns cache */
-  dns = Curl_hash_pick(&dnscache->entries, entry_id, entry_len + 1);
+  dns = Curl_hash_pick(&dnscache->shards[shard], entry_id, entry_len + 1);
 
-  /* No entry found in cache, check if we might have a wildcard entry */
-  if(!dns && data->state.wildcard_resolve) {
-    entry_len = create_dnscache_id("*", 1, port, entry_id, sizeof(entry_id));
-
-    /* See if it is already in our dns cache */
-    dns = Curl_hash_pick(&dnscache->entries, entry_id, entry_len + 1);
-  }
-
-  if(dns && (data->set.dns_cache_timeout_ms != -1)) {
+  if(dns) {
     /* See whether the returned entry is stale. Done before we release lock */
     struct dnscache_prune_data user;
 
     user.now = curlx_now();
-    user.max_age_ms = data->set.dns_cache_timeout_ms;
+    user.max_age_ms = dnscache_max_age_ms(data);
+    user.neg_max_age_ms = dnscache_neg_timeout_ms(data);
     user.oldest_ms = 0;
 
     if(dnscache_entry_is_stale(&user, dns)) {
       infof(data, "Hostname in DNS cache was stale, zapped");
       dns = NULL; /* the memory deallocation is being handled by the hash */
-      Curl_hash_delete(&dnscache->entries, entry_id, entry_len + 1);
+      Curl_hash_delete(&dnscache->shards[shard], entry_id, entry_len + 1);
     }
+    else if(pexpired && dns->addr && dnscache_stale_timeout_ms(data) &&
+            (dns->timestamp.tv_sec || dns->timestamp.tv_usec) &&
+            (curlx_timediff(user.now, dns->timestamp) >=
+             data->set.dns_cache_timeout_ms))
+      *pexpired = TRUE;
   }
 
   /* See if the returned entry matches the required resolve mode */
@@ -380,9 +628,43 @@ static struct Curl_dns_entry *fetch_addr(struct Curl_easy *data,
     if(!found) {
       infof(data, "Hostname in DNS cache does not have needed family, zapped");
       dns = NULL; /* the memory deallocation is being handled by the hash */
-      Curl_hash_delete(&dnscache->entries, entry_id, entry_len + 1);
+      Curl_hash_delete(&dnscache->shards[shard], entry_id, entry_len + 1);
     }
   }
+  if(dns)
+    dns->refcount++; /* we use it! */
+
+  dnscache_unlock(data, dnscache, shard);
+  return dns;
+}
+
+/* lookup address, returns a reference to the entry if found and not
+ * stale */
+static struct Curl_dns_entry *fetch_addr(struct Curl_easy *data,
+                                         struct Curl_dnscache *dnscache,
+                                         const char *hostname,
+                                         int port,
+                                         int ip_version,
+                                         bool *pexpired)
+{
+  struct Curl_dns_entry *dns = NULL;
+  char entry_id[MAX_HOSTCACHE_LEN];
+  size_t entry_len;
+
+  if(!dnscache)
+    return NULL;
+
+  /* Create an entry id, based upon the hostname and port */
+  entry_len = create_dnscache_id(hostname, 0, port,
+                                 entry_id, sizeof(entry_id));
+  dns = fetch_id(data, dnscache, entry_id, entry_len, ip_version, pexpired);
+
+  /* No entry found in cache, check if we might have a wildcard entry */
+  if(!dns && data->state.wildcard_resolve) {
+    entry_len = create_dnscache_id("*", 1, port, entry_id, sizeof(entry_id));
+    dns = fetch_id(data, dnscache, entry_id, entry_len, ip_version,
+                   pexpired);
+  }
   return dns;
 }
 
@@ -406,18 +688,8 @@ Curl_dnscache_get(struct Curl_easy *data,
                   int port,
                   int ip_version)
 {
-  struct Curl_dnscache *dnscache = dnscache_get(data);
-  struct Curl_dns_entry *dns = NULL;
-
-  dnscache_lock(data, dnscache);
-
-  dns = fetch_addr(data, dnscache, hostname, port, ip_version);
-  if(dns)
-    dns->refcount++; /* we use it! */
-
-  dnscache_unlock(data, dnscache);
-
-  return dns;
+  return fetch_addr(data, dnscache_get(data), hostname, port, ip_version,
+                    NULL);
 }
 
 #ifndef CURL_DISABLE_SHUFFLE_DNS
@@ -550,17 +822,19 @@ Curl_dnscache_mk_entry(struct Curl_easy *data,
   return dns;
 }
 
+/* Add an entry for `hostname` to `entries`, the shard its `entry_id` hashes
+ * to. The caller holds the lock of that shard. */
 static struct Curl_dns_entry *
 dnscache_add_addr(struct Curl_easy *data,
-                  struct Curl_dnscache *dnscache,
+                  struct Curl_hash *entries,
+                  char *entry_id,
+                  size_t entry_len,
                   struct Curl_addrinfo *addr,
                   const char *hostname,
                   size_t hlen, /* length or zero */
                   int port,
                   bool permanent)
 {
-  char entry_id[MAX_HOSTCACHE_LEN];
-  size_t entry_len;
   struct Curl_dns_entry *dns;
   struct Curl_dns_entry *dns2;
 
@@ -568,13 +842,8 @@ dnscache_add_addr(struct Curl_easy *data,
   if(!dns)
     return NULL;
 
-  /* Create an entry id, based upon the hostname and port */
-  entry_len = create_dnscache_id(hostname, hlen, port,
-                                 entry_id, sizeof(entry_id));
-
   /* Store the resolved data in our DNS cache. */
-  dns2 = Curl_hash_add(&dnscache->entries, entry_id, entry_len + 1,
-                       (void *)dns);
+  dns2 = Curl_hash_add(entries, entry_id, entry_len + 1, (void *)dns);
   if(!dns2) {
     dnscache_entry_free(dns);
     return NULL;
@@ -589,6 +858,7 @@ CURLcode Curl_dnscache_add(struct Curl_easy *data,
                            struct Curl_dns_entry *entry)
 {
   struct Curl_dnscache *dnscache = dnscache_get(data);
+  unsigned int shard;
   char id[MAX_HOSTCACHE_LEN];
   size_t idlen;
 
@@ -597,15 +867,16 @@ CURLcode Curl_dnscache_add(struct Curl_easy *data,
   /* Create an entry id, based upon the hostname and port */
   idlen = create_dnscache_id(entry->hostname, 0, entry->hostport,
                              id, sizeof(id));
+  shard = dnscache_shard(dnscache, id, idlen);
 
   /* Store the resolved data in our DNS cache and up ref count */
-  dnscache_lock(data, dnscache);
-  if(!Curl_hash_add(&dnscache->entries, id, idlen + 1, (void *)entry)) {
-    dnscache_unlock(data, dnscache);
+  dnscache_lock(data, dnscache, shard);
+  if(!Curl_hash_add(&dnscache->shards[shard], id, idlen + 1, (void *)entry)) {
+    dnscache_unlock(data, dnscache, shard);
     return CURLE_OUT_OF_MEMORY;
   }
   entry->refcount++;
-  dnscache_unlock(data, dnscache);
+  dnscache_unlock(data, dnscache, shard);
   return CURLE_OK;
 }
 
@@ -805,18 +1076,32 @@ static CURLcode store_negative_resolve(struct Curl_easy *data,
                                        int port)
 {
   struct Curl_dnscache *dnscache = dnscache_get(data);
+  unsigned int shard;
   struct Curl_dns_entry *dns;
+  char entry_id[MAX_HOSTCACHE_LEN];
+  size_t entry_len;
   DEBUGASSERT(dnscache);
   if(!dnscache)
     return CURLE_FAILED_INIT;
+  if(!dnscache_neg_timeout_ms(data))
+    return CURLE_OK; /* failures are not cached */
+
+  entry_len = create_dnscache_id(host, 0, port, entry_id, sizeof(entry_id));
+  shard = dnscache_shard(dnscache, entry_id, entry_len);
 
   /* put this new host in the cache */
-  dns = dnscache_add_addr(data, dnscache, NULL, host, 0, port, FALSE);
-  if(dns) {
+  dnscache_lock(data, dnscache, shard);
+  dns = dnscache_add_addr(data, &dnscache->shards[shard], entry_id, entry_len,
+                          NULL, host, 0, port, FALSE);
+  if(dns)
     /* release the returned reference; the cache itself will keep the
      * entry alive: */
     dns->refcount--;
+  dnscache_unlock(data, dnscache, shard);
+  if(dns) {
     infof(data, "Store negative name resolve for %s:%d", host, port);
+    if(data->multi)
+      data->multi->dns_neg_added++;
     return CURLE_OK;
   }
   return CURLE_OUT_OF_MEMORY;
@@ -850,6 +1135,7 @@ CURLcode Curl_resolv(struct Curl_easy *data,
   struct Curl_addrinfo *addr = NULL;
   int respwait = 0;
   bool is_ipaddr;
+  bool expired = FALSE;
   size_t hostname_len;
 
 #ifndef CURL_DISABLE_DOH
@@ -870,13 +1156,21 @@ CURLcode Curl_resolv(struct Curl_easy *data,
   }
 
   /* Let's check our DNS cache first */
-  dnscache_lock(data, dnscache);
-  dns = fetch_addr(data, dnscache, hostname, port, ip_version);
-  if(dns)
-    dns->refcount++; /* we pass out the reference. */
-  dnscache_unlock(data, dnscache);
+  dnscache_refresh_collect(data, dnscache);
+  dns = fetch_addr(data, dnscache, hostname, port, ip_version, &expired);
   if(dns) {
-    infof(data, "Hostname %s was found in DNS cache", hostname);
+    if(expired) {
+      infof(data, "Hostname %s was found expired in DNS cache, "
+            "refreshing", hostname);
+      dnscache_refresh_start(data, dnscache, hostname, port, ip_version);
+      if(data->multi)
+        data->multi->dns_stale_hits++;
+    }
+    else {
+      infof(data, "Hostname %s was found in DNS cache", hostname);
+      if(data->multi && dns->addr)
+        data->multi->dns_hits++;
+    }
     goto out;
   }
 
@@ -908,6 +1202,8 @@ CURLcode Curl_resolv(struct Curl_easy *data,
 #endif
 
   /* Really need a resolver for hostname. */
+  if(data->multi)
+    data->multi->dns_misses++;
   if(ip_version == CURL_IPRESOLVE_V6 && !Curl_ipv6works(data))
     goto error;
 
@@ -943,6 +1239,8 @@ out:
   if(dns) {
     if(!dns->addr) {
       infof(data, "Negative DNS entry");
+      if(data->multi)
+        data->multi->dns_neg_hits++;
       dns->refcount--;
       return CURLE_COULDNT_RESOLVE_HOST;
     }
@@ -971,7 +1269,8 @@ error:
     Curl_resolv_unlink(data, &dns);
   *entry = NULL;
   Curl_async_shutdown(data);
-  store_negative_resolve(data, hostname, port);
+  if(!respwait) /* else Curl_resolv_check() already stored it */
+    store_negative_resolve(data, hostname, port);
   return CURLE_COULDNT_RESOLVE_HOST;
 }
 
@@ -1223,13 +1522,18 @@ void Curl_resolv_unlink(struct Curl_easy *data, struct Curl_dns_entry **pdns)
 {
   if(*pdns) {
     struct Curl_dnscache *dnscache = dnscache_get(data);
+    unsigned int shard = 0;
     struct Curl_dns_entry *dns = *pdns;
     *pdns = NULL;
-    dnscache_lock(data, dnscache);
+    if(dnscache) {
+      shard = dnscache_entry_shard(dnscache, dns);
+      dnscache_lock(data, dnscache, shard);
+    }
     dns->refcount--;
     if(dns->refcount == 0)
       dnscache_entry_free(dns);
-    dnscache_unlock(data, dnscache);
+    if(dnscache)
+      dnscache_unlock(data, dnscache, shard);
   }
 }
 
@@ -1247,18 +1551,77 @@ static void dnscache_entry_dtor(void *entry)
  */
 void Curl_dnscache_init(struct Curl_dnscache *dns, size_t size)
 {
-  Curl_hash_init(&dns->entries, size, Curl_hash_str, curlx_str_key_compare,
+  dns->shards = &dns->one;
+  dns->nshards = 1;
+  dns->filename = NULL;
+  Curl_llist_init(&dns->refreshes, NULL);
+  Curl_hash_init(&dns->one, size, Curl_hash_str, curlx_str_key_compare,
                  dnscache_entry_dtor);
 }
 
 void Curl_dnscache_destroy(struct Curl_dnscache *dns)
 {
-  Curl_hash_destroy(&dns->entries);
+#ifdef USE_DNSCACHE_LOCKS
+  curl_mutex_t *locks = dnscache_locks(dns);
+#endif
+  unsigned int i;
+
+  dnscache_refresh_clear(dns);
+  for(i = 0; i < dns->nshards; ++i) {
+    Curl_hash_destroy(&dns->shards[i]);
+#ifdef USE_DNSCACHE_LOCKS
+    if(locks)
+      Curl_mutex_destroy(&locks[i]);
+#endif
+  }
+  if(dns->shards != &dns->one)
+    free(dns->shards);
+  Curl_safefree(dns->filename);
+  /* leave it in a state that can be destroyed again */
+  dns->shards = &dns->one;
+  dns->nshards = 1;
+}
+
+CURLcode Curl_dnscache_set_shards(struct Curl_dnscache *dns, size_t size,
+                                  unsigned int nshards)
+{
+#ifdef USE_DNSCACHE_LOCKS
+  struct Curl_hash *shards;
+  curl_mutex_t *locks;
+  unsigned int i;
+#endif
+
+  if(nshards <= 1) {
+    Curl_dnscache_destroy(dns);
+    Curl_dnscache_init(dns, size);
+    return CURLE_OK;
+  }
+#ifdef USE_DNSCACHE_LOCKS
+  if(nshards > CURL_DNSCACHE_MAX_SHARDS)
+    return CURLE_BAD_FUNCTION_ARGUMENT;
+  shards = calloc(nshards, sizeof(*shards) + sizeof(*locks));
+  if(!shards)
+    return CURLE_OUT_OF_MEMORY;
+
+  Curl_dnscache_destroy(dns);
+  dns->shards = shards;
+  dns->nshards = nshards;
+  locks = dnscache_locks(dns);
+  for(i = 0; i < nshards; ++i) {
+    Curl_hash_init(&shards[i], size, Curl_hash_str, curlx_str_key_compare,
+                   dnscache_entry_dtor);
+    Curl_mutex_init(&locks[i]);
+  }
+  return CURLE_OK;
+#else
+  return CURLE_NOT_BUILT_IN;
+#endif
 }
 
 CURLcode Curl_loadhostpairs(struct Curl_easy *data)
 {
   struct Curl_dnscache *dnscache = dnscache_get(data);
+  unsigned int shard;
   struct curl_slist *hostp;
 
   if(!dnscache)
@@ -1295,10 +1658,11 @@ CURLcode Curl_loadhostpairs(struct Curl_easy *data)
         entry_len = create_dnscache_id(curlx_str(&source),
                                        curlx_strlen(&source), (int)num,
                                        entry_id, sizeof(entry_id));
-        dnscache_lock(data, dnscache);
+        shard = dnscache_shard(dnscache, entry_id, entry_len);
+        dnscache_lock(data, dnscache, shard);
         /* delete entry, ignore if it did not exist */
-        Curl_hash_delete(&dnscache->entries, entry_id, entry_len + 1);
-        dnscache_unlock(data, dnscache);
+        Curl_hash_delete(&dnscache->shards[shard], entry_id, entry_len + 1);
+        dnscache_unlock(data, dnscache, shard);
       }
     }
     else {
@@ -1403,10 +1767,11 @@ err:
                                      (int)port,
                                      entry_id, sizeof(entry_id));
 
-      dnscache_lock(data, dnscache);
+      shard = dnscache_shard(dnscache, entry_id, entry_len);
+      dnscache_lock(data, dnscache, shard);
 
       /* See if it is already in our dns cache */
-      dns = Curl_hash_pick(&dnscache->entries, entry_id, entry_len + 1);
+      dns = Curl_hash_pick(&dnscache->shards[shard], entry_id, entry_len + 1);
 
       if(dns) {
         infof(data, "RESOLVE %.*s:%" CURL_FORMAT_CURL_OFF_T
@@ -1423,19 +1788,21 @@ err:
          4. when adding a non-permanent entry, we want it to get a "fresh"
             timeout that starts _now_. */
 
-        Curl_hash_delete(&dnscache->entries, entry_id, entry_len + 1);
+        Curl_hash_delete(&dnscache->shards[shard], entry_id, entry_len + 1);
       }
 
       /* put this new host in the cache */
-      dns = dnscache_add_addr(data, dnscache, head, curlx_str(&source),
+      dns = dnscache_add_addr(data, &dnscache->shards[shard], entry_id,
+                              entry_len, head, curlx_str(&source),
                               curlx_strlen(&source), (int)port, permanent);
       if(dns) {
+        dns->from_resolve = TRUE;
         /* release the returned reference; the cache itself will keep the
          * entry alive: */
         dns->refcount--;
       }
 
-      dnscache_unlock(data, dnscache);
+      dnscache_unlock(data, dnscache, shard);
 
       if(!dns)
         return CURLE_OUT_OF_MEMORY;
@@ -1459,6 +1826,342 @@ err:
   return CURLE_OK;
 }
 
+#define MAX_DNSCACHE_FILE_LINE 4095
+#define MAX_DNSCACHE_FILE_ADDR 64 /* one printable address */
+
+#ifdef USE_HTTPSRR
+/* Decode the hex in `hex` into a new allocation. "-" is no data. */
+static CURLcode dnscache_unhex(struct Curl_str *hex, unsigned char **pbuf,
+                               size_t *plen)
+{
+  const char *p = curlx_str(hex);
+  size_t len = curlx_strlen(hex);
+  unsigned char *buf;
+  size_t i;
+
+  *pbuf = NULL;
+  *plen = 0;
+  if((len == 1) && (p[0] == '-'))
+    return CURLE_OK;
+  if(len % 2)
+    return CURLE_BAD_FUNCTION_ARGUMENT;
+  for(i = 0; i < len; i++) {
+    if(!ISXDIGIT(p[i]))
+      return CURLE_BAD_FUNCTION_ARGUMENT;
+  }
+  buf = malloc(len / 2);
+  if(!buf)
+    return CURLE_OUT_OF_MEMORY;
+  for(i = 0; i < len / 2; i++)
+    buf[i] = (unsigned char)((Curl_hexval(p[i * 2]) << 4) |
+                             Curl_hexval(p[i * 2 + 1]));
+  *pbuf = buf;
+  *plen = len / 2;
+  return CURLE_OK;
+}
+
+/* Parse the HTTPS RR part of a line, in the format written by
+ * dnscache_out_rr(). Returns NULL on bad input. */
+static struct Curl_https_rrinfo *dnscache_load_rr(const char *line)
+{
+  struct Curl_https_rrinfo *hinfo;
+  struct Curl_str target, alpns, ipv4, ech, ipv6;
+  curl_off_t prio, port, no_def_alpn;
+  unsigned char *alpnbuf = NULL;
+  size_t alpnlen = 0;
+
+  if(curlx_str_number(&line, &prio, 0xffff) ||
+     curlx_str_single(&line, ':') ||
+     curlx_str_number(&line, &port, 65536) ||
+     curlx_str_single(&line, ':') ||
+     curlx_str_number(&line, &no_def_alpn, 1) ||
+     curlx_str_single(&line, ':') ||
+     curlx_str_until(&line, &alpns, 2 * MAX_HTTPSRR_ALPNS, ':') ||
+     curlx_str_single(&line, ':') ||
+     curlx_str_until(&line, &target, CURL_MAXLEN_host_name, ':') ||
+     curlx_str_single(&line, ':') ||
+     curlx_str_until(&line, &ipv4, MAX_DNSCACHE_FILE_LINE, ':') ||
+     curlx_str_single(&line, ':') ||
+     curlx_str_until(&line, &ech, MAX_DNSCACHE_FILE_LINE, ':') ||
+     curlx_str_single(&line, ':') ||
+     curlx_str_cspn(&line, &ipv6, " \r\n"))
+    return NULL;
+
+  hinfo = calloc(1, sizeof(*hinfo));
+  if(!hinfo)
+    return NULL;
+  hinfo->priority = (uint16_t)prio;
+  /* 65536 is written for "not set" */
+  hinfo->port = (port > 65535) ? -1 : (int)port;
+  hinfo->no_def_alpn = !!no_def_alpn;
+  memset(hinfo->alpns, ALPN_none, sizeof(hinfo->alpns));
+  if(!curlx_str_cmp(&target, "-")) {
+    hinfo->target = Curl_memdup0(curlx_str(&target), curlx_strlen(&target));
+    if(!hinfo->target)
+      goto fail;
+  }
+  if(dnscache_unhex(&alpns, &alpnbuf, &alpnlen) ||
+     (alpnlen > MAX_HTTPSRR_ALPNS) ||
+     dnscache_unhex(&ipv4, &hinfo->ipv4hints, &hinfo->ipv4hints_len) ||
+     dnscache_unhex(&ech, &hinfo->echconfiglist, &hinfo->echconfiglist_len) ||
+     dnscache_unhex(&ipv6, &hinfo->ipv6hints, &hinfo->ipv6hints_len))
+    goto fail;
+  if(alpnlen)
+    memcpy(hinfo->alpns, alpnbuf, alpnlen);
+  free(alpnbuf);
+  return hinfo;
+
+fail:
+  free(alpnbuf);
+  Curl_httpsrr_cleanup(hinfo);
+  free(hinfo);
+  return NULL;
+}
+#endif /* USE_HTTPSRR */
+
+/* Add the entry of one line of a DNS cache file. Lines with bad syntax and
+ * entries older than the DNS cache timeout are ignored, as are entries for
+ * names that are in the cache already. Only returns serious errors.
+ *
+ * Example line, with optional HTTPS RR info after the addresses:
+ * example.com 443 1760620000 192.0.2.1,2001:db8::1
+ */
+static CURLcode dnscache_load_line(struct Curl_easy *data,
+                                   struct Curl_dnscache *dnscache,
+                                   const char *line, time_t now)
+{
+  struct Curl_str host;
+  struct Curl_str addrs;
+  curl_off_t port;
+  curl_off_t stamp;
+  struct Curl_addrinfo *head = NULL, *tail = NULL;
+  char entry_id[MAX_HOSTCACHE_LEN];
+  size_t entry_len;
+  unsigned int shard;
+  timediff_t age_ms;
+  CURLcode result = CURLE_OK;
+  const char *p;
+
+  if(curlx_str_word(&line, &host, MAX_HOSTCACHE_LEN - 7) ||
+     curlx_str_singlespace(&line) ||
+     curlx_str_number(&line, &port, 65535) ||
+     curlx_str_singlespace(&line) ||
+     curlx_str_number(&line, &stamp, CURL_OFF_T_MAX) ||
+     curlx_str_singlespace(&line) ||
+     curlx_str_cspn(&line, &addrs, " \r\n"))
+    return CURLE_OK;
+
+  age_ms = (stamp < (curl_off_t)now) ?
+    (timediff_t)((curl_off_t)now - stamp) * 1000 : 0;
+  if((data->set.dns_cache_timeout_ms != -1) &&
+     (age_ms >= dnscache_max_age_ms(data)))
+    return CURLE_OK; /* too old */
+
+  p = curlx_str(&addrs);
+  do {
+    struct Curl_str one;
+    char address[MAX_DNSCACHE_FILE_ADDR];
+    struct Curl_addrinfo *ai;
+
+    if(curlx_str_cspn(&p, &one, ", \r\n") ||
+       (curlx_strlen(&one) >= sizeof(address)))
+      break;
+    memcpy(address, curlx_str(&one), curlx_strlen(&one));
+    address[curlx_strlen(&one)] = 0;
+    ai = Curl_str2addr(address, (int)port);
+    if(ai) {
+      if(tail)
+        tail->ai_next = ai;
+      else
+        head = ai;
+      tail = ai;
+    }
+  } while(!curlx_str_single(&p, ','));
+  if(!head)
+    return CURLE_OK;
+
+  entry_len = create_dnscache_id(curlx_str(&host), curlx_strlen(&host),
+                                 (int)port, entry_id, sizeof(entry_id));
+  shard = dnscache_shard(dnscache, entry_id, entry_len);
+  dnscache_lock(data, dnscache, shard);
+  if(!Curl_hash_pick(&dnscache->shards[shard], entry_id, entry_len + 1)) {
+    /* the new entry owns the addresses, also on failure */
+    struct Curl_dns_entry *dns =
+      dnscache_add_addr(data, &dnscache->shards[shard], entry_id, entry_len,
+                        head, curlx_str(&host), curlx_strlen(&host),
+                        (int)port, FALSE);
+    head = NULL;
+    if(dns) {
+      /* it was resolved that long ago */
+      dns->timestamp.tv_sec -= (time_t)(age_ms / 1000);
+      if(!dns->timestamp.tv_sec && !dns->timestamp.tv_usec)
+        dns->timestamp.tv_usec = 1; /* zero is for permanent entries */
+#ifdef USE_HTTPSRR
+      if(!curlx_str_singlespace(&line))
+        dns->hinfo = dnscache_load_rr(line);
+#endif
+      dns->refcount--;
+    }
+    else
+      result = CURLE_OUT_OF_MEMORY;
+  }
+  dnscache_unlock(data, dnscache, shard);
+  Curl_freeaddrinfo(head);
+  return result;
+}
+
+/*
+ * Curl_dnscache_loadfile() loads the CURLOPT_DNS_CACHE_FILE into the DNS
+ * cache used by the transfer, unless that cache already got a file. The
+ * cache is saved to the file again when it is destroyed.
+ */
+CURLcode Curl_dnscache_loadfile(struct Curl_easy *data)
+{
+  struct Curl_dnscache *dnscache = dnscache_get(data);
+  const char *file = data->set.str[STRING_DNS_CACHE_FILE];
+  CURLcode result = CURLE_OK;
+  FILE *fp;
+
+  if(!dnscache || !file || !file[0])
+    return CURLE_OK;
+
+  /* the first shard's lock also protects the filename */
+  dnscache_lock(data, dnscache, 0);
+  if(dnscache->filename) {
+    dnscache_unlock(data, dnscache, 0);
+    return CURLE_OK;
+  }
+  dnscache->filename = strdup(file);
+  dnscache_unlock(data, dnscache, 0);
+  if(!dnscache->filename)
+    return CURLE_OUT_OF_MEMORY;
+
+  fp = fopen(file, FOPEN_READTEXT);
+  if(fp) {
+    struct dynbuf buf;
+    time_t now = time(NULL);
+    curlx_dyn_init(&buf, MAX_DNSCACHE_FILE_LINE);
+    while(!result && Curl_get_line(&buf, fp)) {
+      const char *lineptr = curlx_dyn_ptr(&buf);
+      curlx_str_passblanks(&lineptr);
+      if(curlx_str_single(&lineptr, '#'))
+        result = dnscache_load_line(data, dnscache, lineptr, now);
+    }
+    curlx_dyn_free(&buf);
+    fclose(fp);
+    infof(data, "DNS cache loaded from %s", file);
+  }
+  return result;
+}
+
+#ifdef USE_HTTPSRR
+static void dnscache_out_hex(const unsigned char *p, size_t len, FILE *fp)
+{
+  size_t i;
+
+  if(!len)
+    fputc('-', fp);
+  for(i = 0; i < len; i++) {
+    unsigned char hex[2];
+    Curl_hexbyte(hex, p[i]);
+    fputc(hex[0], fp);
+    fputc(hex[1], fp);
+  }
+}
+
+static void dnscache_out_rr(const struct Curl_https_rrinfo *hinfo, FILE *fp)
+{
+  size_t nalpns = 0;
+
+  while((nalpns < MAX_HTTPSRR_ALPNS) && (hinfo->alpns[nalpns] != ALPN_none))
+    nalpns++;
+  fprintf(fp, " %u:%d:%d:", hinfo->priority,
+          (hinfo->port < 0) ? 65536 : hinfo->port, hinfo->no_def_alpn);
+  dnscache_out_hex(hinfo->alpns, nalpns, fp);
+  fprintf(fp, ":%s:", hinfo->target ? hinfo->target : "-");
+  dnscache_out_hex(hinfo->ipv4hints, hinfo->ipv4hints_len, fp);
+  fputc(':', fp);
+  dnscache_out_hex(hinfo->echconfiglist, hinfo->echconfiglist_len, fp);
+  fputc(':', fp);
+  dnscache_out_hex(hinfo->ipv6hints, hinfo->ipv6hints_len, fp);
+}
+#endif
+
+/* Write a single DNS cache entry to a single output line */
+static void dnscache_out(struct Curl_dns_entry *dns, struct curltime now,
+                         time_t wallnow, FILE *fp)
+{
+  const struct Curl_addrinfo *ai;
+  timediff_t age_ms = curlx_timediff(now, dns->timestamp);
+  const char *sep = " ";
+
+  fprintf(fp, "%s %d %" CURL_FORMAT_CURL_OFF_T, dns->hostname,
+          dns->hostport, (curl_off_t)wallnow - (curl_off_t)(age_ms / 1000));
+  for(ai = dns->addr; ai; ai = ai->ai_next) {
+    char address[MAX_DNSCACHE_FILE_ADDR];
+    Curl_printable_address(ai, address, sizeof(address));
+    if(address[0]) {
+      fprintf(fp, "%s%s", sep, address);
+      sep = ",";
+    }
+  }
+#ifdef USE_HTTPSRR
+  if(dns->hinfo)
+    dnscache_out_rr(dns->hinfo, fp);
+#endif
+  fputc('\n', fp);
+}
+
+/*
+ * Curl_dnscache_save() writes the DNS cache to the file it was loaded
+ * from. Entries added with CURLOPT_RESOLVE and failed resolves are not
+ * saved.
+ */
+CURLcode Curl_dnscache_save(struct Curl_easy *data,
+                            struct Curl_dnscache *dnscache)
+{
+  CURLcode result;
+  FILE *out;
+  char *tempstore = NULL;
+  struct curltime now = curlx_now();
+  time_t wallnow = time(NULL);
+  unsigned int i;
+
+  if(!data || !dnscache->filename)
+    return CURLE_OK;
+
+  result = Curl_fopen(data, dnscache->filename, &out, &tempstore);
+  if(result)
+    return result;
+  fputs("# Your DNS cache.\n"
+        "# This file was generated by libcurl! Edit at your own risk.\n",
+        out);
+  for(i = 0; i < dnscache->nshards; ++i) {
+    struct Curl_hash_iterator iter;
+    struct Curl_hash_element *he;
+
+    dnscache_lock(data, dnscache, i);
+    Curl_hash_start_iterate(&dnscache->shards[i], &iter);
+    for(he = Curl_hash_next_element(&iter); he;
+        he = Curl_hash_next_element(&iter)) {
+      struct Curl_dns_entry *dns = he->ptr;
+      if(dns->addr && dns->hostname[0] && !dns->from_resolve &&
+         (dns->timestamp.tv_sec || dns->timestamp.tv_usec))
+        dnscache_out(dns, now, wallnow, out);
+    }
+    dnscache_unlock(data, dnscache, i);
+  }
+  if(ferror(out))
+    result = CURLE_WRITE_ERROR;
+  fclose(out);
+  if(!result && tempstore && Curl_rename(tempstore, dnscache->filename))
+    result = CURLE_WRITE_ERROR;
+  if(result && tempstore)
+    unlink(tempstore);
+  free(tempstore);
+  return result;
+}
+
 #ifndef CURL_DISABLE_VERBOSE_STRINGS
 static void show_resolve_info(struct Curl_easy *data,
                               struct Curl_dns_entry *dns)
@@ -1543,6 +2246,14 @@ CURLcode Curl_resolv_check(struct Curl_easy *data,
     infof(data, "Hostname '%s' was found in DNS cache",
           data->state.async.hostname);
     Curl_async_shutdown(data);
+    if(!(*dns)->addr) {
+      /* someone else failed to resolve it meanwhile */
+      infof(data, "Negative DNS entry");
+      if(data->multi)
+        data->multi->dns_neg_hits++;
+      Curl_resolv_unlink(data, dns);
+      return Curl_resolver_error(data, NULL);
+    }
     data->state.async.dns = *dns;
     data->state.async.done = TRUE;
     return CURLE_OK;
@@ -30,6 +30,7 @@
 #include "curlx/timeval.h" /* for timediff_t */
 #include "asyn.h"
 #include "httpsrr.h"
+#include "curl_threads.h"
 
 #include <setjmp.h>
 
@@ -71,12 +72,31 @@ struct Curl_dns_entry {
   size_t refcount;
   /* hostname port number that resolved to addr. */
   int hostport;
+  /* added with CURLOPT_RESOLVE, permanent or not */
+  BIT(from_resolve);
   /* hostname that resolved to addr. may be NULL (Unix domain sockets). */
   char hostname[1];
 };
 
+#if defined(USE_THREADS_POSIX) || defined(USE_THREADS_WIN32)
+#define USE_DNSCACHE_LOCKS
+#endif
+
+/* The most shards a DNS cache can be split into */
+#define CURL_DNSCACHE_MAX_SHARDS 64
+
+/* A DNS cache has one or more shards, each a hash of entries. An entry
+ * lives in the shard its host and port hash to. A cache with built-in locks
+ * takes the lock of the shard it operates on. Otherwise the cache of a share
+ * is protected by the share's CURL_LOCK_DATA_DNS callbacks. */
 struct Curl_dnscache {
-  struct Curl_hash entries;
+  struct Curl_hash *shards; /* `one` or an allocated array of `nshards`,
+                               followed by as many built-in locks */
+  struct Curl_hash one;
+  char *filename; /* CURLOPT_DNS_CACHE_FILE it was loaded from */
+  struct Curl_llist refreshes; /* expired entries being resolved again,
+                                  protected by the first shard's lock */
+  unsigned int nshards;
 };
 
 bool Curl_host_is_ipnum(const char *hostname);
@@ -124,6 +144,12 @@ void Curl_resolv_unlink(struct Curl_easy *data,
 /* init a new dns cache */
 void Curl_dnscache_init(struct Curl_dnscache *dns, size_t hashsize);
 
+/* Re-init the (empty) DNS cache with `nshards` shards that each use a
+ * built-in lock. `nshards` of 1 or less goes back to a single shard
+ * without a built-in lock. */
+CURLcode Curl_dnscache_set_shards(struct Curl_dnscache *dns, size_t hashsize,
+                                  unsigned int nshards);
+
 void Curl_dnscache_destroy(struct Curl_dnscache *dns);
 
 /* prune old entries from the DNS cache */
@@ -192,6 +218,18 @@ CURLcode Curl_dnscache_add(struct Curl_easy *data,
  */
 CURLcode Curl_loadhostpairs(struct Curl_easy *data);
 
+/*
+ * Load the CURLOPT_DNS_CACHE_FILE into the DNS cache used by the transfer,
+ * unless that cache already got one.
+ */
+CURLcode Curl_dnscache_loadfile(struct Curl_easy *data);
+
+/*
+ * Save the DNS cache to the file it got loaded from, if any.
+ */
+CURLcode Curl_dnscache_save(struct Curl_easy *data,
+                            struct Curl_dnscache *dnscache);
+
 #ifdef USE_CURL_ASYNC
 CURLcode Curl_resolv_check(struct Curl_easy *data,
                            struct Curl_dns_entry **dns);
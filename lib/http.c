@@ -4650,17 +4650,14 @@ static bool http_TE_has_token(const char *fvalue, const char *token)
   return FALSE;
 }
 
-CURLcode Curl_http_req_to_h2(struct dynhds *h2_headers,
-                             struct httpreq *req, struct Curl_easy *data)
+static CURLcode http_req_h2_pseudo(struct dynhds *h2_headers,
+                                   struct httpreq *req,
+                                   struct Curl_easy *data)
 {
   const char *scheme = NULL, *authority = NULL;
   struct dynhds_entry *e;
-  size_t i;
   CURLcode result;
 
-  DEBUGASSERT(req);
-  DEBUGASSERT(h2_headers);
-
   if(req->scheme) {
     scheme = req->scheme;
   }
@@ -4686,8 +4683,6 @@ CURLcode Curl_http_req_to_h2(struct dynhds *h2_headers,
       authority = e->value;
   }
 
-  Curl_dynhds_reset(h2_headers);
-  Curl_dynhds_set_opts(h2_headers, DYNHDS_OPT_LOWERCASE);
   result = Curl_dynhds_add(h2_headers, STRCONST(HTTP_PSEUDO_METHOD),
                            req->method, strlen(req->method));
   if(!result && scheme) {
@@ -4702,24 +4697,219 @@ CURLcode Curl_http_req_to_h2(struct dynhds *h2_headers,
     result = Curl_dynhds_add(h2_headers, STRCONST(HTTP_PSEUDO_PATH),
                              req->path, strlen(req->path));
   }
+  return result;
+}
+
+/* Add the HTTP/2 form of request header `e`, if it has one */
+static CURLcode http_req_h2_field(struct dynhds *h2_headers,
+                                  struct dynhds_entry *e)
+{
+  /* "TE" is special in that it is only permissible when it
+   * has only value "trailers". RFC 9113 ch. 8.2.2 */
+  if(e->namelen == 2 && curl_strequal("TE", e->name)) {
+    if(http_TE_has_token(e->value, "trailers"))
+      return Curl_dynhds_add(h2_headers, e->name, e->namelen,
+                             "trailers", sizeof("trailers") - 1);
+  }
+  else if(h2_permissible_field(e)) {
+    return Curl_dynhds_add(h2_headers, e->name, e->namelen,
+                           e->value, e->valuelen);
+  }
+  return CURLE_OK;
+}
+
+static CURLcode http_req_h2_fields(struct dynhds *h2_headers,
+                                   struct httpreq *req)
+{
+  size_t i;
+  CURLcode result = CURLE_OK;
+
+  for(i = 0; !result && i < Curl_dynhds_count(&req->headers); ++i)
+    result = http_req_h2_field(h2_headers, Curl_dynhds_getn(&req->headers, i));
+  return result;
+}
+
+CURLcode Curl_http_req_to_h2(struct dynhds *h2_headers,
+                             struct httpreq *req, struct Curl_easy *data)
+{
+  CURLcode result;
+
+  DEBUGASSERT(req);
+  DEBUGASSERT(h2_headers);
+
+  Curl_dynhds_reset(h2_headers);
+  Curl_dynhds_set_opts(h2_headers, DYNHDS_OPT_LOWERCASE);
+  result = http_req_h2_pseudo(h2_headers, req, data);
+  if(!result)
+    result = http_req_h2_fields(h2_headers, req);
+  return result;
+}
+
+void Curl_http_req_tmpl_init(struct http_req_tmpl *tmpl)
+{
+  /* the names and values of at most DYN_HTTP_REQUEST bytes of headers,
+   * each with a terminating 0 and a flag byte */
+  curlx_dyn_init(&tmpl->src, 3 * DYN_HTTP_REQUEST);
+  curlx_dyn_init(&tmpl->nsrc, 3 * DYN_HTTP_REQUEST);
+  Curl_dynhds_init(&tmpl->hds, 0, DYN_HTTP_REQUEST);
+  Curl_dynhds_set_opts(&tmpl->hds, DYNHDS_OPT_LOWERCASE);
+  tmpl->count = 0;
+  tmpl->converted = 0;
+  tmpl->valid = FALSE;
+}
+
+void Curl_http_req_tmpl_free(struct http_req_tmpl *tmpl)
+{
+  curlx_dyn_free(&tmpl->src);
+  curlx_dyn_free(&tmpl->nsrc);
+  Curl_dynhds_free(&tmpl->hds);
+  tmpl->count = 0;
+  tmpl->valid = FALSE;
+}
+
+/* TRUE when `headers` are the ones the template was made from */
+static bool http_req_tmpl_match(struct http_req_tmpl *tmpl,
+                                struct dynhds *headers)
+{
+  const char *p = curlx_dyn_ptr(&tmpl->src);
+  size_t left = curlx_dyn_len(&tmpl->src);
+  size_t i;
+
+  if(!tmpl->valid || (Curl_dynhds_count(headers) != tmpl->count))
+    return FALSE;
+  for(i = 0; i < tmpl->count; ++i) {
+    struct dynhds_entry *e = Curl_dynhds_getn(headers, i);
+    size_t elen = e->namelen + e->valuelen + 3;
+
+    /* compare name and value including their terminating 0 */
+    if((elen > left) || memcmp(p, e->name, e->namelen + 1) ||
+       memcmp(p + e->namelen + 1, e->value, e->valuelen + 1))
+      return FALSE;
+    p += elen;
+    left -= elen;
+  }
+  return !left;
+}
+
+/* Update the template to the headers of `req`. The HTTP/2 headers of a
+ * leading run of request headers with the same names as before are kept,
+ * only their values replaced where they changed. The ones after the first
+ * differing name are converted again. */
+static CURLcode http_req_tmpl_update(struct http_req_tmpl *tmpl,
+                                     struct httpreq *req)
+{
+  const char *p = tmpl->valid ? curlx_dyn_ptr(&tmpl->src) : NULL;
+  size_t left = tmpl->valid ? curlx_dyn_len(&tmpl->src) : 0;
+  size_t o = 0; /* HTTP/2 headers kept so far */
+  bool keep = TRUE;
+  size_t i;
+  CURLcode result = CURLE_OK;
+
+  tmpl->valid = FALSE;
+  curlx_dyn_reset(&tmpl->nsrc);
   for(i = 0; !result && i < Curl_dynhds_count(&req->headers); ++i) {
-    e = Curl_dynhds_getn(&req->headers, i);
-    /* "TE" is special in that it is only permissible when it
-     * has only value "trailers". RFC 9113 ch. 8.2.2 */
-    if(e->namelen == 2 && curl_strequal("TE", e->name)) {
-      if(http_TE_has_token(e->value, "trailers"))
-        result = Curl_dynhds_add(h2_headers, e->name, e->namelen,
-                                 "trailers", sizeof("trailers") - 1);
+    struct dynhds_entry *e = Curl_dynhds_getn(&req->headers, i);
+    char has_h2 = 0;
+
+    if(keep && left && (strlen(p) == e->namelen) &&
+       !memcmp(p, e->name, e->namelen)) {
+      const char *pvalue = p + e->namelen + 1;
+      size_t pvlen = strlen(pvalue);
+      bool same = (pvlen == e->valuelen) &&
+                  !memcmp(pvalue, e->value, pvlen);
+
+      has_h2 = pvalue[pvlen + 1];
+      p = pvalue + pvlen + 2;
+      left -= e->namelen + pvlen + 3;
+      /* whether "TE" has an HTTP/2 header depends on its value */
+      if(!same && e->namelen == 2 && curl_strequal("TE", e->name))
+        keep = FALSE;
+      else if(has_h2) {
+        if(!same) {
+          result = Curl_dynhds_setn_value(&tmpl->hds, o,
+                                          e->value, e->valuelen);
+          tmpl->converted++;
+        }
+        ++o;
+      }
     }
-    else if(h2_permissible_field(e)) {
-      result = Curl_dynhds_add(h2_headers, e->name, e->namelen,
-                               e->value, e->valuelen);
+    else
+      keep = FALSE;
+
+    if(!keep) {
+      size_t n;
+      if(o < Curl_dynhds_count(&tmpl->hds))
+        Curl_dynhds_truncate(&tmpl->hds, o);
+      n = Curl_dynhds_count(&tmpl->hds);
+      result = http_req_h2_field(&tmpl->hds, e);
+      o = Curl_dynhds_count(&tmpl->hds);
+      has_h2 = (o > n);
+      if(has_h2)
+        tmpl->converted++;
     }
+    if(!result)
+      result = curlx_dyn_addn(&tmpl->nsrc, e->name, e->namelen + 1);
+    if(!result)
+      result = curlx_dyn_addn(&tmpl->nsrc, e->value, e->valuelen + 1);
+    if(!result)
+      result = curlx_dyn_addn(&tmpl->nsrc, &has_h2, 1);
   }
+  if(!result) {
+    struct dynbuf tmp;
+    /* headers left over from the request before */
+    Curl_dynhds_truncate(&tmpl->hds, o);
+    tmp = tmpl->src;
+    tmpl->src = tmpl->nsrc;
+    tmpl->nsrc = tmp;
+    tmpl->count = Curl_dynhds_count(&req->headers);
+    tmpl->valid = TRUE;
+  }
+  return result;
+}
+
+CURLcode Curl_http_req_to_h2_tmpl(struct dynhds *h2_pseudo,
+                                  struct http_req_tmpl *tmpl,
+                                  struct httpreq *req,
+                                  struct Curl_easy *data)
+{
+  CURLcode result;
 
+  DEBUGASSERT(req);
+  DEBUGASSERT(h2_pseudo);
+  DEBUGASSERT(tmpl);
+
+  Curl_dynhds_reset(h2_pseudo);
+  Curl_dynhds_set_opts(h2_pseudo, DYNHDS_OPT_LOWERCASE);
+  result = http_req_h2_pseudo(h2_pseudo, req, data);
+  if(!result && !http_req_tmpl_match(tmpl, &req->headers))
+    result = http_req_tmpl_update(tmpl, req);
   return result;
 }
 
+#if defined(USE_HTTP2) || defined(USE_HTTP3)
+size_t Curl_http_prio_value(const struct Curl_data_priority *prio,
+                            char *buf, size_t blen)
+{
+  if((prio->urgency == CURL_PRIO_URGENCY_DEFAULT) && !prio->incremental)
+    return 0;
+  return (size_t)msnprintf(buf, blen, "u=%u%s", (unsigned int)prio->urgency,
+                           prio->incremental ? ", i" : "");
+}
+
+CURLcode Curl_http_req_add_prio(struct dynhds *h2_headers,
+                                struct dynhds *hds,
+                                struct Curl_easy *data)
+{
+  char value[16];
+  size_t vlen = Curl_http_prio_value(&data->set.priority,
+                                     value, sizeof(value));
+
+  if(!vlen || Curl_dynhds_get(hds, STRCONST("priority")))
+    return CURLE_OK;
+  return Curl_dynhds_add(h2_headers, STRCONST("priority"), value, vlen);
+}
+#endif /* USE_HTTP2 || USE_HTTP3 */
+
 CURLcode Curl_http_resp_make(struct http_resp **presp,
                              int status,
                              const char *description)
@@ -4780,22 +4970,22 @@ static void http_exp100_continue(struct Curl_easy *data,
   }
 }
 
-static CURLcode cr_exp100_read(struct Curl_easy *data,
-                               struct Curl_creader *reader,
-                               char *buf, size_t blen,
-                               size_t *nread, bool *eos)
+/* Check if upload data may pass, start waiting for the 100 response once
+ * the request has been sent. */
+static CURLcode cr_exp100_check(struct Curl_easy *data,
+                                struct Curl_creader *reader,
+                                bool *pgo)
 {
   struct cr_exp100_ctx *ctx = reader->ctx;
   timediff_t ms;
 
+  *pgo = FALSE;
   switch(ctx->state) {
   case EXP100_SENDING_REQUEST:
     if(!Curl_req_sendbuf_empty(data)) {
       /* The initial request data has not been fully sent yet. Do
        * not start the timer yet. */
       DEBUGF(infof(data, "cr_exp100_read, request not full sent yet"));
-      *nread = 0;
-      *eos = FALSE;
       return CURLE_OK;
     }
     /* We are now waiting for a reply from the server or
@@ -4807,13 +4997,9 @@ static CURLcode cr_exp100_read(struct Curl_easy *data,
     Curl_expire(data, data->set.expect_100_timeout, EXPIRE_100_TIMEOUT);
     data->req.keepon &= ~KEEP_SEND;
     data->req.keepon |= KEEP_SEND_TIMED;
-    *nread = 0;
-    *eos = FALSE;
     return CURLE_OK;
   case EXP100_FAILED:
     DEBUGF(infof(data, "cr_exp100_read, expectation failed, error"));
-    *nread = 0;
-    *eos = FALSE;
     return CURLE_READ_ERROR;
   case EXP100_AWAITING_CONTINUE:
     ms = curlx_timediff(curlx_now(), ctx->start);
@@ -4821,8 +5007,6 @@ static CURLcode cr_exp100_read(struct Curl_easy *data,
       DEBUGF(infof(data, "cr_exp100_read, AWAITING_CONTINUE, not expired"));
       data->req.keepon &= ~KEEP_SEND;
       data->req.keepon |= KEEP_SEND_TIMED;
-      *nread = 0;
-      *eos = FALSE;
       return CURLE_OK;
     }
     /* we have waited long enough, continue anyway */
@@ -4831,10 +5015,52 @@ static CURLcode cr_exp100_read(struct Curl_easy *data,
     FALLTHROUGH();
   default:
     DEBUGF(infof(data, "cr_exp100_read, pass through"));
-    return Curl_creader_read(data, reader->next, buf, blen, nread, eos);
+    *pgo = TRUE;
+    return CURLE_OK;
   }
 }
 
+static CURLcode cr_exp100_read(struct Curl_easy *data,
+                               struct Curl_creader *reader,
+                               char *buf, size_t blen,
+                               size_t *nread, bool *eos)
+{
+  CURLcode result;
+  bool go;
+
+  *nread = 0;
+  *eos = FALSE;
+  result = cr_exp100_check(data, reader, &go);
+  if(result || !go)
+    return result;
+  return Curl_creader_read(data, reader->next, buf, blen, nread, eos);
+}
+
+static CURLcode cr_exp100_peek(struct Curl_easy *data,
+                               struct Curl_creader *reader,
+                               const char **pbuf, size_t *pblen, bool *peos)
+{
+  CURLcode result;
+  bool go;
+
+  *pbuf = NULL;
+  *pblen = 0;
+  *peos = FALSE;
+  if(!reader->next)
+    return CURLE_READ_ERROR;
+  result = cr_exp100_check(data, reader, &go);
+  if(result || !go)
+    return result;
+  return reader->next->crt->peek(data, reader->next, pbuf, pblen, peos);
+}
+
+static void cr_exp100_skip(struct Curl_easy *data,
+                           struct Curl_creader *reader, size_t nread)
+{
+  if(reader->next)
+    reader->next->crt->skip(data, reader->next, nread);
+}
+
 static void cr_exp100_done(struct Curl_easy *data,
                            struct Curl_creader *reader, int premature)
 {
@@ -4855,6 +5081,8 @@ static const struct Curl_crtype cr_exp100 = {
   Curl_creader_def_cntrl,
   Curl_creader_def_is_paused,
   cr_exp100_done,
+  cr_exp100_peek,
+  cr_exp100_skip,
   sizeof(struct cr_exp100_ctx)
 };
 
@@ -69,6 +69,7 @@ extern const struct Curl_handler Curl_handler_https;
 #endif
 
 struct dynhds;
+struct Curl_data_priority;
 
 struct http_negotiation {
   unsigned char rcvd_min; /* minimum version seen in responses, 09, 10, 11 */
@@ -265,6 +266,60 @@ void Curl_http_req_free(struct httpreq *req);
 CURLcode Curl_http_req_to_h2(struct dynhds *h2_headers,
                              struct httpreq *req, struct Curl_easy *data);
 
+/**
+ * The HTTP/2 form of the headers of a request without its pseudo
+ * headers, as Curl_http_req_to_h2() makes them. Kept to be used again
+ * for the next requests that have the same headers, as a series of
+ * requests over one connection mostly do.
+ */
+struct http_req_tmpl {
+  struct dynbuf src;  /* names and values of the headers it was made from,
+                         each followed by a byte if it has an HTTP/2 one */
+  struct dynbuf nsrc; /* `src` of the next update */
+  struct dynhds hds;  /* the HTTP/2 headers */
+  size_t count;       /* number of headers it was made from */
+  size_t converted;   /* HTTP/2 headers added or changed, for tests */
+  BIT(valid);
+};
+
+void Curl_http_req_tmpl_init(struct http_req_tmpl *tmpl);
+void Curl_http_req_tmpl_free(struct http_req_tmpl *tmpl);
+
+/**
+ * Like Curl_http_req_to_h2(), but only the pseudo headers of `req` are
+ * added to `h2_pseudo`. The rest are the headers in `tmpl->hds`. When
+ * the headers of `req` differ from those of the request `tmpl` was last
+ * used for, only the ones that changed are converted again. The others
+ * are not allocated and lower-cased again.
+ *
+ * @param h2_pseudo will contain the HTTP/2 pseudo headers on success
+ * @param tmpl      the template to use and update
+ * @param req       the request to transform
+ * @param data      the handle to lookup defaults like ' :scheme' from
+ */
+CURLcode Curl_http_req_to_h2_tmpl(struct dynhds *h2_pseudo,
+                                  struct http_req_tmpl *tmpl,
+                                  struct httpreq *req,
+                                  struct Curl_easy *data);
+
+#if defined(USE_HTTP2) || defined(USE_HTTP3)
+/**
+ * Write the RFC 9218 Priority field value for `prio` into `buf`, like
+ * "u=1, i". Returns its length, or 0 when `prio` is the default that
+ * is not signaled.
+ */
+size_t Curl_http_prio_value(const struct Curl_data_priority *prio,
+                            char *buf, size_t blen);
+
+/**
+ * Add a "priority" header for the priority of `data` to `h2_headers`,
+ * unless it is the default or the request headers `hds` have one.
+ */
+CURLcode Curl_http_req_add_prio(struct dynhds *h2_headers,
+                                struct dynhds *hds,
+                                struct Curl_easy *data);
+#endif
+
 /**
  * All about a core HTTP response, excluding body and trailers
  */
@@ -33,6 +33,7 @@
 #include "http1.h"
 #include "http2.h"
 #include "http.h"
+#include "http_prio.h"
 #include "sendf.h"
 #include "select.h"
 #include "curlx/base64.h"
@@ -64,14 +65,23 @@
 #define NGHTTP2_HAS_SET_LOCAL_WINDOW_SIZE 1
 #endif
 
+/* RFC 9218 extensible priorities */
+#if (NGHTTP2_VERSION_NUM >= 0x013100)
+#define NGHTTP2_HAS_EXTPRI 1
+#endif
+
 
 /* buffer dimensioning:
  * use 16K as chunk size, as that fits H2 DATA frames well */
 #define H2_CHUNK_SIZE           (16 * 1024)
 /* connection window size */
 #define H2_CONN_WINDOW_SIZE     (10 * 1024 * 1024)
-/* on receiving from TLS, we prep for holding a full stream window */
-#define H2_NW_RECV_CHUNKS       (H2_CONN_WINDOW_SIZE / H2_CHUNK_SIZE)
+/* on receiving from TLS, we read into larger chunks. nghttp2 hands us
+ * DATA payload where it lies in these and a frame that spans two chunks
+ * reaches the transfer in two writes. */
+#define H2_NW_RECV_CHUNK_SIZE   (64 * 1024)
+/* we prep for holding a full stream window */
+#define H2_NW_RECV_CHUNKS       (H2_CONN_WINDOW_SIZE / H2_NW_RECV_CHUNK_SIZE)
 /* on send into TLS, we just want to accumulate small frames */
 #define H2_NW_SEND_CHUNKS       1
 /* this is how much we want "in flight" for a stream, unthrottled  */
@@ -95,12 +105,19 @@
  * is blocked from sending us any data. See #10988 for an issue with this. */
 #define HTTP2_HUGE_WINDOW_SIZE (100 * H2_STREAM_WINDOW_SIZE_MAX)
 
-#define H2_SETTINGS_IV_LEN  3
+/* Stream windows start at H2_STREAM_WINDOW_SIZE_MAX and are grown from the
+ * measured bandwidth-delay product (BDP) up to this, unless the transfer
+ * sets CURLOPT_HTTP2_WINDOW_MAX. */
+#define H2_STREAM_WINDOW_SIZE_AUTO  (128 * 1024 * 1024)
+
+#define H2_SETTINGS_IV_LEN  4
 #define H2_BINSETTINGS_LEN 80
 
 static size_t populate_settings(nghttp2_settings_entry *iv,
                                 struct Curl_easy *data)
 {
+  size_t n = 3;
+
   iv[0].settings_id = NGHTTP2_SETTINGS_MAX_CONCURRENT_STREAMS;
   iv[0].value = Curl_multi_max_concurrent_streams(data->multi);
 
@@ -110,7 +127,18 @@ static size_t populate_settings(nghttp2_settings_entry *iv,
   iv[2].settings_id = NGHTTP2_SETTINGS_ENABLE_PUSH;
   iv[2].value = data->multi->push_cb != NULL;
 
-  return 3;
+#ifdef NGHTTP2_HAS_EXTPRI
+  /* When the transfer opening the connection asks for an RFC 9218
+   * priority, tell the server we use those instead of RFC 7540 ones */
+  if(((data->set.priority.urgency != CURL_PRIO_URGENCY_DEFAULT) ||
+      data->set.priority.incremental) &&
+     !data->set.priority.weight && !data->set.priority.parent) {
+    iv[n].settings_id = NGHTTP2_SETTINGS_NO_RFC7540_PRIORITIES;
+    iv[n].value = 1;
+    n++;
+  }
+#endif
+  return n;
 }
 
 static ssize_t populate_binsettings(uint8_t *binsettings,
@@ -134,6 +162,9 @@ struct cf_h2_ctx {
   struct bufq outbufq;          /* network output */
   struct bufc_pool stream_bufcp; /* spares for stream buffers */
   struct dynbuf scratch;        /* scratch buffer for temp use */
+  struct http_req_tmpl req_tmpl; /* headers of the last request submitted */
+  nghttp2_nv *nva;              /* headers of the request to submit */
+  size_t nva_alloc;             /* number of entries allocated in `nva` */
 
   struct uint_hash streams; /* hash of `data->mid` to `h2_stream_ctx` */
   size_t drain_total; /* sum of all stream's UrlState drain */
@@ -141,6 +172,12 @@ struct cf_h2_ctx {
   uint32_t goaway_error;        /* goaway error code from server */
   int32_t remote_max_sid;       /* max id processed by server */
   int32_t local_max_sid;        /* max id processed by us */
+  struct curltime bdp_ping_sent; /* when the BDP PING was submitted */
+  curl_uint64_t bdp_bytes;      /* DATA bytes received since then */
+  curl_uint64_t bdp_bw;         /* highest bandwidth measured, bytes/s */
+  int32_t stream_win;           /* stream window size, grown from BDP */
+  int32_t stream_win_min;       /* stream window size to start with */
+  struct Curl_prio_sched prio;  /* DATA scheduling by urgency */
 #ifdef DEBUGBUILD
   int32_t stream_win_max;       /* max h2 stream window size */
 #endif
@@ -151,6 +188,8 @@ struct cf_h2_ctx {
   BIT(sent_goaway);
   BIT(enable_push);
   BIT(nw_out_blocked);
+  BIT(bdp_ping_pending);        /* BDP PING has not been ACKed yet */
+  BIT(flush_later);             /* the multi flushes `outbufq` later */
 };
 
 /* How to access `call_data` from a cf_h2 filter */
@@ -163,24 +202,34 @@ static void h2_stream_hash_free(unsigned int id, void *stream);
 static void cf_h2_ctx_init(struct cf_h2_ctx *ctx, bool via_h1_upgrade)
 {
   Curl_bufcp_init(&ctx->stream_bufcp, H2_CHUNK_SIZE, H2_STREAM_POOL_SPARES);
-  Curl_bufq_initp(&ctx->inbufq, &ctx->stream_bufcp, H2_NW_RECV_CHUNKS, 0);
+  Curl_bufq_init2(&ctx->inbufq, H2_NW_RECV_CHUNK_SIZE, H2_NW_RECV_CHUNKS,
+                  BUFQ_OPT_NONE);
   Curl_bufq_initp(&ctx->outbufq, &ctx->stream_bufcp, H2_NW_SEND_CHUNKS, 0);
   curlx_dyn_init(&ctx->scratch, CURL_MAX_HTTP_HEADER);
+  Curl_http_req_tmpl_init(&ctx->req_tmpl);
   Curl_uint_hash_init(&ctx->streams, 63, h2_stream_hash_free);
   ctx->remote_max_sid = 2147483647;
   ctx->via_h1_upgrade = via_h1_upgrade;
+  ctx->stream_win_min = H2_STREAM_WINDOW_SIZE_MAX;
 #ifdef DEBUGBUILD
   {
     const char *p = getenv("CURL_H2_STREAM_WIN_MAX");
 
-    ctx->stream_win_max = H2_STREAM_WINDOW_SIZE_MAX;
+    ctx->stream_win_max = 0;
     if(p) {
       curl_off_t l;
       if(!curlx_str_number(&p, &l, INT_MAX))
         ctx->stream_win_max = (int32_t)l;
     }
+    p = getenv("CURL_H2_STREAM_WIN_START");
+    if(p) {
+      curl_off_t l;
+      if(!curlx_str_number(&p, &l, INT_MAX) && l)
+        ctx->stream_win_min = (int32_t)l;
+    }
   }
 #endif
+  ctx->stream_win = ctx->stream_win_min;
   ctx->initialized = TRUE;
 }
 
@@ -191,6 +240,8 @@ static void cf_h2_ctx_free(struct cf_h2_ctx *ctx)
     Curl_bufq_free(&ctx->outbufq);
     Curl_bufcp_free(&ctx->stream_bufcp);
     curlx_dyn_free(&ctx->scratch);
+    Curl_http_req_tmpl_free(&ctx->req_tmpl);
+    free(ctx->nva);
     Curl_uint_hash_destroy(&ctx->streams);
     memset(ctx, 0, sizeof(*ctx));
   }
@@ -229,6 +280,7 @@ struct h2_stream_ctx {
   CURLcode xfer_result; /* Result of writing out response */
   int32_t local_window_size; /* the local recv window size */
   int32_t id; /* HTTP/2 protocol identifier for stream */
+  struct Curl_prio_stream prio; /* DATA scheduling by urgency */
   BIT(resp_hds_complete); /* we have a complete, final response */
   BIT(closed); /* TRUE on stream close */
   BIT(reset);  /* TRUE on stream reset */
@@ -264,6 +316,7 @@ static struct h2_stream_ctx *h2_stream_ctx_create(struct cf_h2_ctx *ctx)
   stream->error = NGHTTP2_NO_ERROR;
   stream->local_window_size = H2_STREAM_WINDOW_SIZE_INITIAL;
   stream->nrcvd_data = 0;
+  Curl_prio_stream_init(&stream->prio);
   return stream;
 }
 
@@ -292,11 +345,53 @@ static void h2_stream_hash_free(unsigned int id, void *stream)
   h2_stream_ctx_free((struct h2_stream_ctx *)stream);
 }
 
+/* Count `stream` as queued in its urgency while it has DATA queued and
+ * the stream window to send it, after the `sending` bytes about to go
+ * out. */
+static void h2_prio_queued(struct cf_h2_ctx *ctx,
+                           struct h2_stream_ctx *stream, size_t sending)
+{
+  Curl_prio_set_queued(&ctx->prio, &stream->prio,
+                       (stream->id > 0) && !stream->closed &&
+                       !Curl_bufq_is_empty(&stream->sendbuf) &&
+                       (nghttp2_session_get_stream_remote_window_size(
+                          ctx->h2, stream->id) > (int32_t)sending));
+}
+
+static bool h2_prio_resume_stream(unsigned int mid, void *val, void *userp)
+{
+  struct cf_h2_ctx *ctx = userp;
+  struct h2_stream_ctx *stream = val;
+
+  (void)mid;
+  if(stream->prio.deferred)
+    (void)nghttp2_session_resume_data(ctx->h2, stream->id);
+  return TRUE;
+}
+
+/* The largest stream window size for `data` */
+static int32_t cf_h2_get_max_local_win(struct Curl_cfilter *cf,
+                                       struct Curl_easy *data)
+{
+#ifdef DEBUGBUILD
+  struct cf_h2_ctx *ctx = cf->ctx;
+  if(ctx->stream_win_max)
+    return ctx->stream_win_max;
+#else
+  (void)cf;
+#endif
+  if(data->set.h2_window_max)
+    return CURLMIN(data->set.h2_window_max, HTTP2_HUGE_WINDOW_SIZE);
+  return H2_STREAM_WINDOW_SIZE_AUTO;
+}
+
 #ifdef NGHTTP2_HAS_SET_LOCAL_WINDOW_SIZE
 static int32_t cf_h2_get_desired_local_win(struct Curl_cfilter *cf,
                                            struct Curl_easy *data)
 {
-  (void)cf;
+  struct cf_h2_ctx *ctx = cf->ctx;
+  int32_t wmax;
+
   if(data->set.max_recv_speed && data->set.max_recv_speed < INT32_MAX) {
     /* The transfer should only receive `max_recv_speed` bytes per second.
      * We restrict the stream's local window size, so that the server cannot
@@ -304,15 +399,8 @@ static int32_t cf_h2_get_desired_local_win(struct Curl_cfilter *cf,
      * This gets less precise the higher the latency. */
     return (int32_t)data->set.max_recv_speed;
   }
-#ifdef DEBUGBUILD
-  else {
-    struct cf_h2_ctx *ctx = cf->ctx;
-    CURL_TRC_CF(data, cf, "stream_win_max=%d", ctx->stream_win_max);
-    return ctx->stream_win_max;
-  }
-#else
-  return H2_STREAM_WINDOW_SIZE_MAX;
-#endif
+  wmax = cf_h2_get_max_local_win(cf, data);
+  return CURLMIN(ctx->stream_win, wmax);
 }
 
 static CURLcode cf_h2_update_local_win(struct Curl_cfilter *cf,
@@ -344,8 +432,8 @@ static CURLcode cf_h2_update_local_win(struct Curl_cfilter *cf,
         return CURLE_HTTP2;
       }
       stream->local_window_size = dwsize;
-      CURL_TRC_CF(data, cf, "[%d] local window update by %d",
-                  stream->id, dwsize - wsize);
+      CURL_TRC_CF(data, cf, "[%d] local window update by %d to %d",
+                  stream->id, dwsize - wsize, dwsize);
     }
     else {
       rv = nghttp2_session_set_local_window_size(ctx->h2, NGHTTP2_FLAG_NONE,
@@ -376,6 +464,78 @@ static CURLcode cf_h2_update_local_win(struct Curl_cfilter *cf,
 }
 #endif /* !NGHTTP2_HAS_SET_LOCAL_WINDOW_SIZE */
 
+/* PING payload that tells our BDP measurements apart */
+static const uint8_t h2_bdp_ping_data[8] = {
+  'c', 'u', 'r', 'l', '-', 'b', 'd', 'p'
+};
+
+/* DATA of `len` bytes has been received for `data`. Unless a measurement
+ * is already running, send a PING and count the DATA bytes that arrive
+ * until its ACK. These are the bytes in flight for one round trip, the
+ * bandwidth-delay product. */
+static void cf_h2_bdp_on_data(struct Curl_cfilter *cf,
+                              struct Curl_easy *data, size_t len)
+{
+  struct cf_h2_ctx *ctx = cf->ctx;
+
+  ctx->bdp_bytes += len;
+  if(ctx->bdp_ping_pending || data->set.max_recv_speed ||
+     (ctx->stream_win >= cf_h2_get_max_local_win(cf, data)))
+    return;
+  if(!nghttp2_submit_ping(ctx->h2, NGHTTP2_FLAG_NONE, h2_bdp_ping_data)) {
+    ctx->bdp_ping_pending = TRUE;
+    ctx->bdp_ping_sent = curlx_now();
+    ctx->bdp_bytes = 0;
+  }
+}
+
+/* The ACK to our BDP PING arrived. When the bytes received in that round
+ * trip filled most of the stream window and the bandwidth still went up,
+ * the window is what limits the transfer: make it twice the BDP. Streams
+ * pick up the new size on their next window update. */
+static void cf_h2_bdp_on_ack(struct Curl_cfilter *cf,
+                             struct Curl_easy *data)
+{
+  struct cf_h2_ctx *ctx = cf->ctx;
+  timediff_t rtt_us = curlx_timediff_us(curlx_now(), ctx->bdp_ping_sent);
+  curl_uint64_t bw, win;
+
+  ctx->bdp_ping_pending = FALSE;
+  if(rtt_us <= 0)
+    rtt_us = 1;
+  bw = ctx->bdp_bytes * 1000000 / (curl_uint64_t)rtt_us;
+  if(bw <= ctx->bdp_bw)
+    return;
+  ctx->bdp_bw = bw;
+  if(ctx->bdp_bytes < ((curl_uint64_t)ctx->stream_win * 2 / 3))
+    return;
+  win = CURLMIN(ctx->bdp_bytes * 2,
+                (curl_uint64_t)cf_h2_get_max_local_win(cf, data));
+  if(win > (curl_uint64_t)ctx->stream_win) {
+    CURL_TRC_CF(data, cf, "[0] BDP %" FMT_PRIu64 " bytes in %" FMT_TIMEDIFF_T
+                "us, stream window %d -> %d", ctx->bdp_bytes, rtt_us,
+                ctx->stream_win, (int32_t)win);
+    ctx->stream_win = (int32_t)win;
+  }
+}
+
+/* A stream's output got paused, the application does not keep up and
+ * what the server sends meanwhile is buffered. Give back half of the
+ * window growth to hold less data in memory. */
+static void cf_h2_bdp_shrink(struct Curl_cfilter *cf,
+                             struct Curl_easy *data)
+{
+  struct cf_h2_ctx *ctx = cf->ctx;
+
+  if(ctx->stream_win > ctx->stream_win_min) {
+    int32_t win = CURLMAX(ctx->stream_win / 2, ctx->stream_win_min);
+    CURL_TRC_CF(data, cf, "[0] stream window %d -> %d on pause",
+                ctx->stream_win, win);
+    ctx->stream_win = win;
+    ctx->bdp_bw = 0;
+  }
+}
+
 
 static CURLcode http2_data_setup(struct Curl_cfilter *cf,
                                  struct Curl_easy *data,
@@ -411,6 +571,11 @@ static void http2_data_done(struct Curl_cfilter *cf, struct Curl_easy *data)
   struct h2_stream_ctx *stream = H2_STREAM_CTX(ctx, data);
 
   DEBUGASSERT(ctx);
+  if(ctx->flush_later) {
+    /* the multi handle might not find this connection via `data` */
+    ctx->flush_later = FALSE;
+    (void)nw_out_flush(cf, data);
+  }
   if(!stream || !ctx->initialized)
     return;
 
@@ -436,6 +601,9 @@ static void http2_data_done(struct Curl_cfilter *cf, struct Curl_easy *data)
     }
   }
 
+  Curl_prio_undefer(&ctx->prio, &stream->prio);
+  stream->closed = TRUE;
+  h2_prio_queued(ctx, stream, 0);
   Curl_uint_hash_remove(&ctx->streams, data->mid);
 }
 
@@ -554,6 +722,10 @@ static CURLcode cf_h2_ctx_open(struct Curl_cfilter *cf,
       goto out;
     DEBUGASSERT(stream);
     stream->id = 1;
+    /* the HTTP/1.1 request carried no priority, the server assumes the
+     * default one until we update it */
+    data->state.priority.urgency = CURL_PRIO_URGENCY_DEFAULT;
+    data->state.priority.incremental = FALSE;
     /* queue SETTINGS frame (again) */
     rc = nghttp2_session_upgrade2(ctx->h2, binsettings, (size_t)binlen,
                                   data->state.httpreq == HTTPREQ_HEAD,
@@ -1084,6 +1256,7 @@ static void h2_xfer_write_resp(struct Curl_cfilter *cf,
   else if(!stream->write_paused && Curl_xfer_write_is_paused(data)) {
     CURL_TRC_CF(data, cf, "[%d] stream output paused", stream->id);
     stream->write_paused = TRUE;
+    cf_h2_bdp_shrink(cf, data);
   }
   else if(stream->write_paused && !Curl_xfer_write_is_paused(data)) {
     CURL_TRC_CF(data, cf, "[%d] stream output unpaused", stream->id);
@@ -1173,9 +1346,11 @@ static CURLcode on_stream_frame(struct Curl_cfilter *cf,
     if(frame->rst_stream.error_code) {
       stream->reset = TRUE;
     }
+    h2_prio_queued(ctx, stream, 0);
     Curl_multi_mark_dirty(data);
     break;
   case NGHTTP2_WINDOW_UPDATE:
+    h2_prio_queued(ctx, stream, 0);
     if(CURL_WANT_SEND(data) && Curl_bufq_is_empty(&stream->sendbuf)) {
       /* need more data, force processing of transfer */
       Curl_multi_mark_dirty(data);
@@ -1358,6 +1533,12 @@ static int on_frame_recv(nghttp2_session *session, const nghttp2_frame *frame,
       }
       break;
     }
+    case NGHTTP2_PING:
+      if((frame->hd.flags & NGHTTP2_FLAG_ACK) && ctx->bdp_ping_pending &&
+         !memcmp(frame->ping.opaque_data, h2_bdp_ping_data,
+                 sizeof(h2_bdp_ping_data)))
+        cf_h2_bdp_on_ack(cf, data);
+      break;
     case NGHTTP2_GOAWAY:
       ctx->rcvd_goaway = TRUE;
       ctx->goaway_error = frame->goaway.error_code;
@@ -1446,6 +1627,7 @@ static int on_data_chunk_recv(nghttp2_session *session, uint8_t flags,
   if(!stream)
     return NGHTTP2_ERR_CALLBACK_FAILURE;
 
+  cf_h2_bdp_on_data(cf, data_s, len);
   h2_xfer_write_resp(cf, data_s, stream, (const char *)mem, len, FALSE);
 
   nghttp2_session_consume(ctx->h2, stream_id, len);
@@ -1493,6 +1675,8 @@ static int on_stream_close(nghttp2_session *session, int32_t stream_id,
   if(stream->error) {
     stream->reset = TRUE;
   }
+  Curl_prio_undefer(&ctx->prio, &stream->prio);
+  h2_prio_queued(ctx, stream, 0);
 
   if(stream->error)
     CURL_TRC_CF(data_s, cf, "[%d] RESET: %s (err %d)",
@@ -1760,6 +1944,16 @@ static ssize_t req_body_read_callback(nghttp2_session *session,
   if(!stream)
     return NGHTTP2_ERR_CALLBACK_FAILURE;
 
+  if(!Curl_bufq_is_empty(&stream->sendbuf) &&
+     Curl_prio_wait(&ctx->prio, &stream->prio)) {
+    Curl_prio_defer(&ctx->prio, &stream->prio);
+    CURL_TRC_CF(data_s, cf, "[%d] req_body_read, waiting for more urgent "
+                "streams", stream_id);
+    return NGHTTP2_ERR_DEFERRED;
+  }
+  if(Curl_prio_undefer(&ctx->prio, &stream->prio))
+    Curl_multi_mark_dirty(data_s);
+
   result = Curl_bufq_read(&stream->sendbuf, buf, length, &n);
   if(result) {
     if(result != CURLE_AGAIN)
@@ -1768,6 +1962,7 @@ static ssize_t req_body_read_callback(nghttp2_session *session,
   }
   else
     nread = (ssize_t)n;
+  h2_prio_queued(ctx, stream, (size_t)nread);
 
   CURL_TRC_CF(data_s, cf, "[%d] req_body_read(len=%zu) eos=%d -> %zd, %d",
               stream_id, length, stream->body_eos, nread, result);
@@ -1945,10 +2140,41 @@ static void h2_pri_spec(struct cf_h2_ctx *ctx,
   data->state.priority = *prio;
 }
 
+/*
+ * Take over a changed RFC 9218 urgency or incremental setting of `data`
+ * and send it to the peer in a PRIORITY_UPDATE frame.
+ */
+static int h2_prio_update(struct Curl_cfilter *cf,
+                          struct Curl_easy *data,
+                          struct h2_stream_ctx *stream)
+{
+  struct cf_h2_ctx *ctx = cf->ctx;
+  int rv = 0;
+
+  data->state.priority.urgency = data->set.priority.urgency;
+  data->state.priority.incremental = data->set.priority.incremental;
+  Curl_prio_set_urgency(&ctx->prio, &stream->prio,
+                        data->state.priority.urgency);
+#ifdef NGHTTP2_HAS_EXTPRI
+  {
+    char value[16];
+    /* an empty value sets the default priority */
+    size_t vlen = Curl_http_prio_value(&data->state.priority,
+                                       value, sizeof(value));
+    CURL_TRC_CF(data, cf, "[%d] Queuing PRIORITY_UPDATE", stream->id);
+    rv = nghttp2_submit_priority_update(ctx->h2, NGHTTP2_FLAG_NONE,
+                                        stream->id, (uint8_t *)value, vlen);
+  }
+#else
+  (void)ctx;
+#endif
+  return rv;
+}
+
 /*
  * Check if there is been an update in the priority /
- * dependency settings and if so it submits a PRIORITY frame with the updated
- * info.
+ * dependency settings and if so it submits a PRIORITY or PRIORITY_UPDATE
+ * frame with the updated info.
  * Flush any out data pending in the network buffer.
  */
 static CURLcode h2_progress_egress(struct Curl_cfilter *cf,
@@ -1958,6 +2184,15 @@ static CURLcode h2_progress_egress(struct Curl_cfilter *cf,
   struct h2_stream_ctx *stream = H2_STREAM_CTX(ctx, data);
   int rv = 0;
 
+  if(stream && stream->id > 0 &&
+     ((data->set.priority.urgency != data->state.priority.urgency) ||
+      (data->set.priority.incremental !=
+       data->state.priority.incremental))) {
+    rv = h2_prio_update(cf, data, stream);
+    if(rv)
+      goto out;
+  }
+
   if(stream && stream->id > 0 &&
      ((sweight_wanted(data) != sweight_in_effect(data)) ||
       (data->set.priority.exclusive != data->state.priority.exclusive) ||
@@ -1975,8 +2210,14 @@ static CURLcode h2_progress_egress(struct Curl_cfilter *cf,
   }
 
   ctx->nw_out_blocked = 0;
-  while(!rv && !ctx->nw_out_blocked && nghttp2_session_want_write(ctx->h2))
-    rv = nghttp2_session_send(ctx->h2);
+  do {
+    /* have streams waiting on more urgent ones check again */
+    if(ctx->prio.deferred)
+      Curl_uint_hash_visit(&ctx->streams, h2_prio_resume_stream, ctx);
+    ctx->prio.drained = FALSE;
+    while(!rv && !ctx->nw_out_blocked && nghttp2_session_want_write(ctx->h2))
+      rv = nghttp2_session_send(ctx->h2);
+  } while(!rv && !ctx->nw_out_blocked && ctx->prio.drained);
 
 out:
   if(nghttp2_is_fatal(rv)) {
@@ -1989,6 +2230,15 @@ out:
    * Unless we are 'connect_only' where the request will never come. */
   if(!cf->connected && !cf->conn->connect_only)
     return CURLE_OK;
+  /* When running transfers, the multi handle flushes the connection
+   * at the end. Frames of all streams then go out in full TLS records
+   * instead of a small write for each transfer. */
+  if(!ctx->nw_out_blocked && !Curl_bufq_is_empty(&ctx->outbufq) &&
+     (data->conn == cf->conn) && Curl_multi_flush_later(data)) {
+    ctx->flush_later = TRUE;
+    return CURLE_OK;
+  }
+  ctx->flush_later = FALSE;
   return nw_out_flush(cf, data);
 }
 
@@ -2024,6 +2274,41 @@ static CURLcode stream_recv(struct Curl_cfilter *cf, struct Curl_easy *data,
   return result;
 }
 
+/* Receive from the "lower" filters into the empty network input buffer.
+ * Keep on reading until its chunk is full or nothing more is there, so
+ * that nghttp2 sees many DATA frames in one piece and delivers each
+ * payload in a single write to the transfer, straight from the chunk. */
+static CURLcode h2_nw_recv(struct Curl_cfilter *cf,
+                           struct Curl_easy *data,
+                           size_t *pnread)
+{
+  struct cf_h2_ctx *ctx = cf->ctx;
+  CURLcode result = CURLE_OK;
+  size_t n;
+
+  DEBUGASSERT(Curl_bufq_is_empty(&ctx->inbufq));
+  *pnread = 0;
+  while(*pnread < H2_NW_RECV_CHUNK_SIZE) {
+    result = Curl_cf_recv_bufq(cf->next, data, &ctx->inbufq,
+                               H2_NW_RECV_CHUNK_SIZE - *pnread, &n);
+    if(result) {
+      if(*pnread && (result == CURLE_AGAIN))
+        result = CURLE_OK;
+      break;
+    }
+    else if(!n) {
+      if(*pnread) {
+        /* process what we have, the connection is closed after that */
+        CURL_TRC_CF(data, cf, "[0] ingress: connection closed");
+        ctx->conn_closed = TRUE;
+      }
+      break;
+    }
+    *pnread += n;
+  }
+  return result;
+}
+
 static CURLcode h2_progress_ingress(struct Curl_cfilter *cf,
                                     struct Curl_easy *data,
                                     size_t data_max_bytes)
@@ -2061,7 +2346,7 @@ static CURLcode h2_progress_ingress(struct Curl_cfilter *cf,
       break;
     }
 
-    result = Curl_cf_recv_bufq(cf->next, data, &ctx->inbufq, 0, &nread);
+    result = h2_nw_recv(cf, data, &nread);
     if(result) {
       if(result != CURLE_AGAIN) {
         failf(data, "Failed receiving HTTP2 data: %d(%s)", result,
@@ -2199,6 +2484,7 @@ static ssize_t cf_h2_body_send(struct Curl_cfilter *cf,
 
   if(eos && (blen == nwritten))
     stream->body_eos = TRUE;
+  h2_prio_queued(ctx, stream, 0);
 
   if(eos || !Curl_bufq_is_empty(&stream->sendbuf)) {
     /* resume the potentially suspended stream */
@@ -2211,6 +2497,37 @@ static ssize_t cf_h2_body_send(struct Curl_cfilter *cf,
   return (ssize_t)nwritten;
 }
 
+/* Make `ctx->nva` hold the pseudo headers of the request to submit,
+ * followed by the headers of the request template. */
+static CURLcode h2_tmpl_nva(struct cf_h2_ctx *ctx, struct dynhds *pseudo,
+                            size_t *pcount)
+{
+  size_t npseudo = Curl_dynhds_count(pseudo);
+  size_t n = npseudo + Curl_dynhds_count(&ctx->req_tmpl.hds);
+  size_t i;
+
+  *pcount = 0;
+  if(n > ctx->nva_alloc) {
+    nghttp2_nv *nva = realloc(ctx->nva, n * sizeof(nghttp2_nv));
+    if(!nva)
+      return CURLE_OUT_OF_MEMORY;
+    ctx->nva = nva;
+    ctx->nva_alloc = n;
+  }
+  for(i = 0; i < n; ++i) {
+    struct dynhds_entry *e = (i < npseudo) ?
+      Curl_dynhds_getn(pseudo, i) :
+      Curl_dynhds_getn(&ctx->req_tmpl.hds, i - npseudo);
+    ctx->nva[i].name = (unsigned char *)e->name;
+    ctx->nva[i].namelen = e->namelen;
+    ctx->nva[i].value = (unsigned char *)e->value;
+    ctx->nva[i].valuelen = e->valuelen;
+    ctx->nva[i].flags = NGHTTP2_NV_FLAG_NONE;
+  }
+  *pcount = n;
+  return CURLE_OK;
+}
+
 static CURLcode h2_submit(struct h2_stream_ctx **pstream,
                           struct Curl_cfilter *cf, struct Curl_easy *data,
                           const void *buf, size_t len,
@@ -2245,19 +2562,23 @@ static CURLcode h2_submit(struct h2_stream_ctx **pstream,
   }
   DEBUGASSERT(stream->h1.req);
 
-  result = Curl_http_req_to_h2(&h2_headers, stream->h1.req, data);
+  result = Curl_http_req_to_h2_tmpl(&h2_headers, &ctx->req_tmpl,
+                                    stream->h1.req, data);
+  if(!result)
+    result = Curl_http_req_add_prio(&h2_headers, &ctx->req_tmpl.hds, data);
   if(result)
     goto out;
   /* no longer needed */
   Curl_h1_req_parse_free(&stream->h1);
 
-  nva = Curl_dynhds_to_nva(&h2_headers, &nheader);
-  if(!nva) {
-    result = CURLE_OUT_OF_MEMORY;
+  result = h2_tmpl_nva(ctx, &h2_headers, &nheader);
+  if(result)
     goto out;
-  }
+  nva = ctx->nva;
 
   h2_pri_spec(ctx, data, &pri_spec);
+  Curl_prio_set_urgency(&ctx->prio, &stream->prio,
+                        data->state.priority.urgency);
   if(!nghttp2_session_check_request_allowed(ctx->h2))
     CURL_TRC_CF(data, cf, "send request NOT allowed (via nghttp2)");
 
@@ -2325,7 +2646,6 @@ static CURLcode h2_submit(struct h2_stream_ctx **pstream,
 out:
   CURL_TRC_CF(data, cf, "[%d] submit -> %d, %zu",
               stream ? stream->id : -1, result, *pnwritten);
-  Curl_safefree(nva);
   *pstream = stream;
   Curl_dynhds_free(&h2_headers);
   return result;
@@ -2488,12 +2808,13 @@ static CURLcode cf_h2_adjust_pollset(struct Curl_cfilter *cf,
     CF_DATA_SAVE(save, cf, data);
     c_exhaust = want_send && !nghttp2_session_get_remote_window_size(ctx->h2);
     s_exhaust = want_send && stream && stream->id >= 0 &&
-                !nghttp2_session_get_stream_remote_window_size(ctx->h2,
-                                                               stream->id);
+                (stream->prio.deferred ||
+                 !nghttp2_session_get_stream_remote_window_size(ctx->h2,
+                                                                stream->id));
     want_recv = (want_recv || c_exhaust || s_exhaust);
     want_send = (!s_exhaust && want_send) ||
                 (!c_exhaust && nghttp2_session_want_write(ctx->h2)) ||
-                !Curl_bufq_is_empty(&ctx->outbufq);
+                (!ctx->flush_later && !Curl_bufq_is_empty(&ctx->outbufq));
 
     result = Curl_pollset_set(data, ps, sock, want_recv, want_send);
     CF_DATA_RESTORE(cf, save);
@@ -2652,6 +2973,8 @@ static CURLcode http2_data_pause(struct Curl_cfilter *cf,
   if(ctx && ctx->h2 && stream) {
     CURLcode result;
 
+    if(pause && !stream->write_paused)
+      cf_h2_bdp_shrink(cf, data);
     stream->write_paused = pause;
     result = cf_h2_update_local_win(cf, data, stream);
     if(result)
@@ -2772,7 +3095,7 @@ static CURLcode cf_h2_query(struct Curl_cfilter *cf,
   }
   case CF_QUERY_NEED_FLUSH: {
     struct h2_stream_ctx *stream = H2_STREAM_CTX(ctx, data);
-    if(!Curl_bufq_is_empty(&ctx->outbufq) ||
+    if((!ctx->flush_later && !Curl_bufq_is_empty(&ctx->outbufq)) ||
        (stream && !Curl_bufq_is_empty(&stream->sendbuf))) {
       *pres1 = TRUE;
       return CURLE_OK;
@@ -2801,6 +3124,7 @@ struct Curl_cftype Curl_cft_nghttp2 = {
   cf_h2_adjust_pollset,
   cf_h2_data_pending,
   cf_h2_send,
+  Curl_cf_emulate_sendv,
   cf_h2_recv,
   cf_h2_cntrl,
   cf_h2_is_alive,
@@ -659,6 +659,8 @@ const struct Curl_crtype Curl_httpchunk_encoder = {
   Curl_creader_def_cntrl,
   Curl_creader_def_is_paused,
   Curl_creader_def_done,
+  Curl_creader_def_peek,
+  Curl_creader_def_skip,
   sizeof(struct chunked_reader)
 };
 
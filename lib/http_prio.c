@@ -0,0 +1,107 @@
+/***************************************************************************
+ *                                  _   _ ____  _
+ *  Project                     ___| | | |  _ \| |
+ *                             / __| | | | |_) | |
+ *                            | (__| |_| |  _ <| |___
+ *                             \___|\___/|_| \_\_____|
+ *
+ * Copyright (C) Daniel Stenberg, <daniel@haxx.se>, et al.
+ *
+ * This software is licensed as described in the file COPYING, which
+ * you should have received as part of this distribution. The terms
+ * are also available at https://curl.se/docs/copyright.html.
+ *
+ * You may opt to use, copy, modify, merge, publish, distribute and/or sell
+ * copies of the Software, and permit persons to whom the Software is
+ * furnished to do so, under the terms of the COPYING file.
+ *
+ * This software is distributed on an "AS IS" basis, WITHOUT WARRANTY OF ANY
+ * KIND, either express or implied.
+ *
+ * SPDX-License-Identifier: curl
+ *
+ ***************************************************************************/
+
+#include "curl_setup.h"
+
+#if defined(USE_HTTP2) || defined(USE_HTTP3)
+
+#include "http_prio.h"
+
+/* The last #include files should be: */
+#include "curl_memory.h"
+#include "memdebug.h"
+
+void Curl_prio_stream_init(struct Curl_prio_stream *ps)
+{
+  memset(ps, 0, sizeof(*ps));
+  ps->urgency = CURL_PRIO_URGENCY_DEFAULT;
+}
+
+void Curl_prio_set_queued(struct Curl_prio_sched *sched,
+                          struct Curl_prio_stream *ps, bool queued)
+{
+  if(queued == (bool)ps->queued)
+    return;
+  if(queued)
+    sched->queued[ps->urgency]++;
+  else {
+    DEBUGASSERT(sched->queued[ps->urgency]);
+    sched->queued[ps->urgency]--;
+    if(sched->deferred)
+      sched->drained = TRUE;
+  }
+  ps->queued = queued;
+}
+
+void Curl_prio_set_urgency(struct Curl_prio_sched *sched,
+                           struct Curl_prio_stream *ps,
+                           unsigned char urgency)
+{
+  DEBUGASSERT(urgency <= CURL_PRIO_URGENCY_MAX);
+  if(urgency == ps->urgency)
+    return;
+  if(ps->queued) {
+    /* count it in its new urgency */
+    DEBUGASSERT(sched->queued[ps->urgency]);
+    sched->queued[ps->urgency]--;
+    sched->queued[urgency]++;
+    if(sched->deferred)
+      sched->drained = TRUE;
+  }
+  ps->urgency = urgency;
+}
+
+bool Curl_prio_wait(const struct Curl_prio_sched *sched,
+                    const struct Curl_prio_stream *ps)
+{
+  unsigned char u;
+
+  for(u = 0; u < ps->urgency; ++u) {
+    if(sched->queued[u])
+      return TRUE;
+  }
+  return FALSE;
+}
+
+void Curl_prio_defer(struct Curl_prio_sched *sched,
+                     struct Curl_prio_stream *ps)
+{
+  if(!ps->deferred) {
+    ps->deferred = TRUE;
+    sched->deferred++;
+  }
+}
+
+bool Curl_prio_undefer(struct Curl_prio_sched *sched,
+                       struct Curl_prio_stream *ps)
+{
+  if(!ps->deferred)
+    return FALSE;
+  DEBUGASSERT(sched->deferred);
+  ps->deferred = FALSE;
+  sched->deferred--;
+  return TRUE;
+}
+
+#endif /* USE_HTTP2 || USE_HTTP3 */
@@ -0,0 +1,84 @@
+#ifndef HEADER_CURL_HTTP_PRIO_H
+#define HEADER_CURL_HTTP_PRIO_H
+/***************************************************************************
+ *                                  _   _ ____  _
+ *  Project                     ___| | | |  _ \| |
+ *                             / __| | | | |_) | |
+ *                            | (__| |_| |  _ <| |___
+ *                             \___|\___/|_| \_\_____|
+ *
+ * Copyright (C) Daniel Stenberg, <daniel@haxx.se>, et al.
+ *
+ * This software is licensed as described in the file COPYING, which
+ * you should have received as part of this distribution. The terms
+ * are also available at https://curl.se/docs/copyright.html.
+ *
+ * You may opt to use, copy, modify, merge, publish, distribute and/or sell
+ * copies of the Software, and permit persons to whom the Software is
+ * furnished to do so, under the terms of the COPYING file.
+ *
+ * This software is distributed on an "AS IS" basis, WITHOUT WARRANTY OF ANY
+ * KIND, either express or implied.
+ *
+ * SPDX-License-Identifier: curl
+ *
+ ***************************************************************************/
+#include "curl_setup.h"
+
+#if defined(USE_HTTP2) || defined(USE_HTTP3)
+
+#include "urldata.h"
+
+/*
+ * Scheduling of request bodies by RFC 9218 urgency, for the streams of
+ * one multiplexed connection.
+ *
+ * A stream with body data queued, that flow control lets it send, is
+ * counted in its urgency. A less urgent stream defers sending its body
+ * while a more urgent one is counted. This keeps bulk uploads from
+ * delaying the bodies of more urgent requests on the same connection.
+ *
+ * The HTTP/2 and HTTP/3 filters decide when a stream is queued and when
+ * to resume deferred streams, this only keeps the books.
+ */
+struct Curl_prio_sched {
+  uint32_t deferred;    /* streams waiting on more urgent ones */
+  /* streams with body data queued to send, by urgency */
+  uint32_t queued[CURL_PRIO_URGENCY_MAX + 1];
+  BIT(drained);         /* a queued stream went away while others wait */
+};
+
+/* The scheduling state of one stream */
+struct Curl_prio_stream {
+  unsigned char urgency; /* RFC 9218 urgency the stream is sent with */
+  BIT(deferred);         /* body held back for more urgent streams */
+  BIT(queued);           /* counted in the `queued` of its urgency */
+};
+
+void Curl_prio_stream_init(struct Curl_prio_stream *ps);
+
+/* Count `ps` as having body data queued or not. When it no longer is
+ * while streams are deferred, `drained` is set for them to check again. */
+void Curl_prio_set_queued(struct Curl_prio_sched *sched,
+                          struct Curl_prio_stream *ps, bool queued);
+
+/* Move `ps` to another urgency. */
+void Curl_prio_set_urgency(struct Curl_prio_sched *sched,
+                           struct Curl_prio_stream *ps,
+                           unsigned char urgency);
+
+/* TRUE when the body of `ps` has to wait for a more urgent stream that
+ * has body data queued. */
+bool Curl_prio_wait(const struct Curl_prio_sched *sched,
+                    const struct Curl_prio_stream *ps);
+
+/* `ps` waits on more urgent streams. */
+void Curl_prio_defer(struct Curl_prio_sched *sched,
+                     struct Curl_prio_stream *ps);
+
+/* `ps` no longer waits on more urgent streams. Returns TRUE when it did. */
+bool Curl_prio_undefer(struct Curl_prio_sched *sched,
+                       struct Curl_prio_stream *ps);
+
+#endif /* USE_HTTP2 || USE_HTTP3 */
+#endif /* HEADER_CURL_HTTP_PRIO_H */
@@ -2192,6 +2192,8 @@ static const struct Curl_crtype cr_mime = {
   cr_mime_cntrl,
   cr_mime_is_paused,
   Curl_creader_def_done,
+  Curl_creader_def_peek,
+  Curl_creader_def_skip,
   sizeof(struct cr_mime_ctx)
 };
 
@@ -79,10 +79,19 @@
 #define CURL_DNS_HASH_SIZE 71
 #endif
 
+/* after a failed attempt to warm a connection, wait this long before
+   trying again */
+#define CURL_PREWARM_RETRY_MS 1000
+
 #ifndef CURL_TLS_SESSION_SIZE
 #define CURL_TLS_SESSION_SIZE 25
 #endif
 
+#ifdef USE_IO_URING
+/* receives queued on the ring before it runs to make room */
+#define MULTI_URING_ENTRIES 256
+#endif
+
 #define CURL_MULTI_HANDLE 0x000bab1e
 
 #ifdef DEBUGBUILD
@@ -107,6 +116,17 @@ static CURLMcode multi_timeout(struct Curl_multi *multi,
                                long *timeout_ms);
 static void process_pending_handles(struct Curl_multi *multi);
 static void multi_xfer_bufs_free(struct Curl_multi *multi);
+static void multi_prewarm_done(struct Curl_multi *multi,
+                               struct Curl_easy *data,
+                               CURLcode result);
+static void multi_prewarm_upkeep(struct Curl_multi *multi);
+#ifdef USE_EPOLL
+static CURLMcode multi_socket(struct Curl_multi *multi,
+                              bool checkall,
+                              curl_socket_t s,
+                              int ev_bitmask,
+                              int *running_handles);
+#endif
 #ifdef DEBUGBUILD
 static void multi_xfer_tbl_dump(struct Curl_multi *multi);
 #endif
@@ -225,6 +245,7 @@ struct Curl_multi *Curl_multi_handle(unsigned int xfer_table_size,
                                      size_t sesssize)  /* TLS session cache */
 {
   struct Curl_multi *multi = calloc(1, sizeof(struct Curl_multi));
+  struct curltime now;
 
   if(!multi)
     return NULL;
@@ -238,18 +259,23 @@ struct Curl_multi *Curl_multi_handle(unsigned int xfer_table_size,
   Curl_uint_bset_init(&multi->dirty);
   Curl_uint_bset_init(&multi->pending);
   Curl_uint_bset_init(&multi->msgsent);
+  Curl_uint_bset_init(&multi->flush);
   Curl_hash_init(&multi->proto_hash, 23,
                  Curl_hash_str, curlx_str_key_compare, ph_freeentry);
   Curl_llist_init(&multi->msglist, NULL);
+  Curl_llist_init(&multi->prewarm, NULL);
 
   multi->multiplexing = TRUE;
   multi->max_concurrent_streams = 100;
   multi->last_timeout_ms = -1;
+  now = curlx_now();
 
-  if(Curl_uint_bset_resize(&multi->process, xfer_table_size) ||
+  if(Curl_twheel_init(&multi->timewheel, &now) ||
+     Curl_uint_bset_resize(&multi->process, xfer_table_size) ||
      Curl_uint_bset_resize(&multi->pending, xfer_table_size) ||
      Curl_uint_bset_resize(&multi->dirty, xfer_table_size) ||
      Curl_uint_bset_resize(&multi->msgsent, xfer_table_size) ||
+     Curl_uint_bset_resize(&multi->flush, xfer_table_size) ||
      Curl_uint_tbl_resize(&multi->xfers, xfer_table_size))
     goto error;
 
@@ -310,7 +336,9 @@ error:
   Curl_uint_bset_destroy(&multi->dirty);
   Curl_uint_bset_destroy(&multi->pending);
   Curl_uint_bset_destroy(&multi->msgsent);
+  Curl_uint_bset_destroy(&multi->flush);
   Curl_uint_tbl_destroy(&multi->xfers);
+  Curl_twheel_destroy(&multi->timewheel);
 
   free(multi);
   return NULL;
@@ -385,6 +413,7 @@ static CURLMcode multi_xfers_add(struct Curl_multi *multi,
        Curl_uint_bset_resize(&multi->dirty, new_size) ||
        Curl_uint_bset_resize(&multi->pending, new_size) ||
        Curl_uint_bset_resize(&multi->msgsent, new_size) ||
+       Curl_uint_bset_resize(&multi->flush, new_size) ||
        Curl_uint_tbl_resize(&multi->xfers, new_size))
       return CURLM_OUT_OF_MEMORY;
   }
@@ -478,7 +507,9 @@ CURLMcode curl_multi_add_handle(CURLM *m, CURL *d)
 
   /* add the easy handle to the process set */
   Curl_uint_bset_add(&multi->process, data->mid);
-  ++multi->xfers_alive;
+  /* transfers warming a connection do not count as running */
+  if(!data->state.prewarm)
+    ++multi->xfers_alive;
   ++multi->xfers_total_ever;
 
   Curl_cpool_xfer_init(data);
@@ -776,12 +807,13 @@ CURLMcode curl_multi_remove_handle(CURLM *m, CURL *d)
   }
 
   /* The timer must be shut down before data->multi is set to NULL, else the
-     timenode will remain in the splay tree after curl_easy_cleanup is
+     timenode will remain in the timer wheel after curl_easy_cleanup is
      called. Do it after multi_done() in case that sets another time! */
   removed_timer = Curl_expire_clear(data);
 
   /* If in `msgsent`, it was deducted from `multi->xfers_alive` already. */
-  if(!Curl_uint_bset_contains(&multi->msgsent, data->mid))
+  if(!Curl_uint_bset_contains(&multi->msgsent, data->mid) &&
+     !data->state.prewarm)
     --multi->xfers_alive;
 
   Curl_wildcard_dtor(&data->wildcard);
@@ -794,7 +826,7 @@ CURLMcode curl_multi_remove_handle(CURLM *m, CURL *d)
   /* Tell event handling that this transfer is definitely going away */
   Curl_multi_ev_xfer_done(multi, data);
 
-  if(data->set.connect_only && !data->multi_easy) {
+  if(data->set.connect_only && !data->multi_easy && !data->state.prewarm) {
     /* This removes a handle that was part the multi interface that used
        CONNECT_ONLY, that connection is now left alive but since this handle
        has bits.close set nothing can use that transfer anymore and it is
@@ -843,6 +875,7 @@ CURLMcode curl_multi_remove_handle(CURLM *m, CURL *d)
   Curl_uint_bset_remove(&multi->dirty, mid);
   Curl_uint_bset_remove(&multi->pending, mid);
   Curl_uint_bset_remove(&multi->msgsent, mid);
+  Curl_uint_bset_remove(&multi->flush, mid);
   data->multi = NULL;
   data->mid = UINT_MAX;
   data->master_mid = UINT_MAX;
@@ -1302,6 +1335,9 @@ static CURLMcode multi_wait(struct Curl_multi *multi,
   struct Curl_easy *data = NULL;
   CURLMcode result = CURLM_OK;
   unsigned int mid;
+#ifdef USE_EPOLL
+  bool use_epoll = Curl_multi_ev_epoll_active(multi);
+#endif
 
 #ifdef USE_WINSOCK
   WSANETWORKEVENTS wsa_events;
@@ -1323,6 +1359,17 @@ static CURLMcode multi_wait(struct Curl_multi *multi,
   Curl_pollset_init(&ps);
   Curl_pollfds_init(&cpfds, a_few_on_stack, NUM_POLLS_ON_STACK);
 
+#ifdef USE_EPOLL
+  if(use_epoll) {
+    /* The epoll set already tracks all transfer sockets. It becomes
+     * readable when any of them has events, wait on it instead. */
+    if(Curl_pollfds_add_sock(&cpfds, multi->ev.epfd, POLLIN)) {
+      result = CURLM_OUT_OF_MEMORY;
+      goto out;
+    }
+  }
+  else
+#endif
   /* Add the curl handles to our pollfds first */
   if(Curl_uint_bset_first(&multi->process, &mid)) {
     do {
@@ -1427,6 +1474,27 @@ static CURLMcode multi_wait(struct Curl_multi *multi,
 
     if(pollrc > 0) {
       retcode = pollrc;
+#ifdef USE_EPOLL
+      if(use_epoll && (cpfds.pfds[0].revents & POLLIN)) {
+        /* mark the transfers on ready sockets dirty, count those sockets
+           instead of the epoll descriptor itself */
+        int nready = Curl_multi_ev_epoll_dispatch(multi);
+        if(nready < 0) {
+          result = CURLM_UNRECOVERABLE_POLL;
+          goto out;
+        }
+        retcode += nready - 1;
+      }
+#endif
+#ifdef USE_IO_URING
+      if(multi->uring) {
+        /* remember the readable transfer sockets for batching */
+        for(i = 0; i < curl_nfds; i++) {
+          if(cpfds.pfds[i].revents & POLLIN)
+            Curl_multi_recv_ready(multi, cpfds.pfds[i].fd);
+        }
+      }
+#endif
 #ifdef USE_WINSOCK
     }
     else { /* now wait... if not ready during the pre-check (pollrc == 0) */
@@ -2692,7 +2760,10 @@ statemachine_end:
     }
 
     if(MSTATE_COMPLETED == data->mstate) {
-      if(data->master_mid != UINT_MAX) {
+      if(data->state.prewarm)
+        /* warmed a connection for other transfers, no message */
+        multi_prewarm_done(multi, data, result);
+      else if(data->master_mid != UINT_MAX) {
         /* A sub transfer, not for msgsent to application */
         struct Curl_easy *mdata;
 
@@ -2727,7 +2798,8 @@ statemachine_end:
       Curl_uint_bset_remove(&multi->dirty, data->mid);
       Curl_uint_bset_remove(&multi->pending, data->mid);
       Curl_uint_bset_add(&multi->msgsent, data->mid);
-      --multi->xfers_alive;
+      if(!data->state.prewarm)
+        --multi->xfers_alive;
       return CURLM_OK;
     }
   } while((rc == CURLM_CALL_MULTI_PERFORM) || multi_ischanged(multi, FALSE));
@@ -2736,11 +2808,80 @@ statemachine_end:
   return rc;
 }
 
+/* Send the output connections batched while running transfers. A
+ * connection that cannot take it all has its transfer assessed again
+ * so that it waits for the socket to become writable. */
+static void multi_flush_conns(struct Curl_multi *multi)
+{
+  curl_off_t last_conn_id = -1;
+  unsigned int mid;
+
+  multi->batch_egress = FALSE;
+  if(Curl_uint_bset_first(&multi->flush, &mid)) {
+    do {
+      struct Curl_easy *data = Curl_multi_get_easy(multi, mid);
+      Curl_uint_bset_remove(&multi->flush, mid);
+      /* transfers of a connection often come one after the other */
+      if(data && data->conn && (data->conn->connection_id != last_conn_id)) {
+        CURLcode result = Curl_conn_flush(data, FIRSTSOCKET);
+        last_conn_id = data->conn->connection_id;
+        CURL_TRC_M(data, "flush batched connection output -> %d", result);
+        if(result)
+          (void)Curl_multi_ev_assess_xfer(multi, data);
+      }
+    }
+    while(Curl_uint_bset_next(&multi->flush, mid, &mid));
+  }
+}
+
+#ifdef USE_IO_URING
+void Curl_multi_recv_ready(struct Curl_multi *multi, curl_socket_t s)
+{
+  if(multi->uring)
+    Curl_uring_set_ready(multi->uring, s);
+}
+
+/* Queue a receive for the connection of every transfer in `set` that is
+ * about to read response data from a socket known to be readable and
+ * run them all in one system call. The transfers then find their data in
+ * the socket filter without a system call of their own. Sockets not
+ * known to be readable are left alone, a receive on them is likely to
+ * find nothing. */
+static void multi_batch_recv(struct Curl_multi *multi, struct uint_bset *set)
+{
+  unsigned int mid;
+
+  if(!multi->uring)
+    return;
+  if(Curl_uint_bset_first(set, &mid)) {
+    do {
+      struct Curl_easy *data = Curl_multi_get_easy(multi, mid);
+      curl_socket_t s = (data && data->conn) ?
+                        data->conn->sock[FIRSTSOCKET] : CURL_SOCKET_BAD;
+      if((s != CURL_SOCKET_BAD) && (data != multi->admin) &&
+         Curl_uring_is_ready(multi->uring, s) &&
+         (data->mstate == MSTATE_PERFORMING) &&
+         ((data->req.keepon & (KEEP_RECV|KEEP_RECV_PAUSE)) == KEEP_RECV) &&
+         (data->conn->handler->protocol & PROTO_FAMILY_HTTP)) {
+        CURLcode result = Curl_conn_batch_recv(data, FIRSTSOCKET,
+                                               multi->uring);
+        if(result && (result != CURLE_AGAIN))
+          CURL_TRC_M(data, "batch recv -> %d", result);
+      }
+    }
+    while(Curl_uint_bset_next(set, mid, &mid));
+
+  }
+  /* without receives queued, this only forgets the readable sockets */
+  if(Curl_uring_run(multi->uring))
+    CURL_TRC_M(multi->admin, "running batched receives failed");
+}
+#endif
 
 CURLMcode curl_multi_perform(CURLM *m, int *running_handles)
 {
   CURLMcode returncode = CURLM_OK;
-  struct Curl_tree *t = NULL;
+  struct Curl_twnode *t = NULL;
   struct curltime now = curlx_now();
   struct Curl_multi *multi = m;
   unsigned int mid;
@@ -2752,7 +2893,24 @@ CURLMcode curl_multi_perform(CURLM *m, int *running_handles)
   if(multi->in_callback)
     return CURLM_RECURSIVE_API_CALL;
 
+#ifdef USE_EPOLL
+  if(Curl_multi_ev_epoll_active(multi)) {
+    /* The application may have waited by other means than
+       curl_multi_wait()/curl_multi_poll() or not at all. Collect what the
+       epoll set has ready without waiting, marking those transfers dirty,
+       then run them and the ones with expired timers like multi_socket() */
+    if(Curl_multi_ev_epoll_dispatch(multi) < 0)
+      return CURLM_UNRECOVERABLE_POLL;
+    return multi_socket(multi, FALSE, CURL_SOCKET_TIMEOUT, 0,
+                        running_handles);
+  }
+#endif
+
   sigpipe_init(&pipe_st);
+  multi->batch_egress = TRUE;
+#ifdef USE_IO_URING
+  multi_batch_recv(multi, &multi->process);
+#endif
   if(Curl_uint_bset_first(&multi->process, &mid)) {
     CURL_TRC_M(multi->admin, "multi_perform(running=%u)",
                Curl_multi_xfers_running(multi));
@@ -2775,18 +2933,20 @@ CURLMcode curl_multi_perform(CURLM *m, int *running_handles)
     }
     while(Curl_uint_bset_next(&multi->process, mid, &mid));
   }
+  multi_flush_conns(multi);
 
   sigpipe_apply(multi->admin, &pipe_st);
   Curl_cshutdn_perform(&multi->cshutdn, multi->admin, CURL_SOCKET_TIMEOUT);
+  multi_prewarm_upkeep(multi);
   sigpipe_restore(&pipe_st);
 
   if(multi_ischanged(m, TRUE))
     process_pending_handles(m);
 
   /*
-   * Simply remove all expired timers from the splay since handles are dealt
+   * Simply remove all expired timers from the wheel since handles are dealt
    * with unconditionally by this function and curl_multi_timeout() requires
-   * that already passed/handled expire times are removed from the splay.
+   * that already passed/handled expire times are removed from the wheel.
    *
    * It is important that the 'now' value is set at the entry of this function
    * and not for the current time as it may have ticked a little while since
@@ -2794,10 +2954,10 @@ CURLMcode curl_multi_perform(CURLM *m, int *running_handles)
    * been handled!
    */
   do {
-    multi->timetree = Curl_splaygetbest(now, multi->timetree, &t);
+    t = Curl_twheel_getbest(&multi->timewheel, now);
     if(t) {
       /* the removed may have another timeout in queue */
-      struct Curl_easy *data = Curl_splayget(t);
+      struct Curl_easy *data = Curl_twheel_get(t);
       (void)add_next_timeout(now, multi, data);
       if(data->mstate == MSTATE_PENDING) {
         bool stream_unused;
@@ -2821,10 +2981,225 @@ CURLMcode curl_multi_perform(CURLM *m, int *running_handles)
   return returncode;
 }
 
+/* A destination that `want` idle connections are kept warm for */
+struct multi_prewarm {
+  struct Curl_llist_node node;
+  struct Curl_easy *tmpl; /* copy of the application's easy handle */
+  char *destination; /* of the warm connections, once known */
+  struct uint_spbset xfers; /* transfers warming a connection */
+  struct curltime failed; /* when the last attempt failed */
+  unsigned int reuse_fp; /* of the warm connections, once known */
+  unsigned int want; /* number of idle connections to keep */
+};
+
+static void multi_prewarm_free(struct Curl_multi *multi,
+                               struct multi_prewarm *pw,
+                               bool close_xfers)
+{
+  unsigned int mid;
+
+  if(close_xfers && Curl_uint_spbset_first(&pw->xfers, &mid)) {
+    do {
+      struct Curl_easy *data = Curl_multi_get_easy(multi, mid);
+      if(data) {
+        (void)curl_multi_remove_handle(multi, data);
+        Curl_close(&data);
+      }
+    } while(Curl_uint_spbset_next(&pw->xfers, mid, &mid));
+  }
+  Curl_uint_spbset_destroy(&pw->xfers);
+  multi->prewarm_conns -= pw->want;
+  Curl_node_remove(&pw->node);
+  Curl_close(&pw->tmpl);
+  free(pw->destination);
+  free(pw);
+}
+
+static struct multi_prewarm *multi_prewarm_get(struct Curl_multi *multi,
+                                               unsigned int mid)
+{
+  struct Curl_llist_node *e;
+  for(e = Curl_llist_head(&multi->prewarm); e; e = Curl_node_next(e)) {
+    struct multi_prewarm *pw = Curl_node_elem(e);
+    if(Curl_uint_spbset_contains(&pw->xfers, mid))
+      return pw;
+  }
+  return NULL;
+}
+
+static void multi_prewarm_learn(struct connectdata *conn,
+                                struct Curl_easy *data,
+                                void *userdata)
+{
+  struct multi_prewarm *pw = userdata;
+  (void)data;
+  if(!pw->destination) {
+    pw->destination = strdup(conn->destination);
+    pw->reuse_fp = conn->reuse_fp;
+  }
+}
+
+/* A transfer warming a connection is done. The transfer itself is
+ * cleaned up by multi_prewarm_upkeep(). */
+static void multi_prewarm_done(struct Curl_multi *multi,
+                               struct Curl_easy *data,
+                               CURLcode result)
+{
+  struct multi_prewarm *pw = multi_prewarm_get(multi, data->mid);
+
+  if(!pw)
+    return;
+  if(result) {
+    infof(data, "Warming a connection failed: %d", result);
+    pw->failed = curlx_now();
+  }
+  else if(!pw->destination && (data->state.lastconnect_id != -1))
+    /* learn how to find the warm connections in the pool */
+    Curl_cpool_do_by_id(data, data->state.lastconnect_id,
+                        multi_prewarm_learn, pw);
+}
+
+static CURLMcode multi_prewarm_start(struct Curl_multi *multi,
+                                     struct multi_prewarm *pw)
+{
+  struct Curl_easy *data = curl_easy_duphandle(pw->tmpl);
+  CURLMcode rc;
+
+  if(!data)
+    return CURLM_OUT_OF_MEMORY;
+  /* connect, then leave the connection idle in the pool */
+  data->set.connect_only = TRUE;
+  data->set.connect_only_ws = FALSE;
+  data->state.internal = TRUE;
+  data->state.prewarm = TRUE;
+
+  rc = curl_multi_add_handle(multi, data);
+  if(rc) {
+    Curl_close(&data);
+    return rc;
+  }
+  if(!Curl_uint_spbset_add(&pw->xfers, data->mid)) {
+    (void)curl_multi_remove_handle(multi, data);
+    Curl_close(&data);
+    return CURLM_OUT_OF_MEMORY;
+  }
+  return CURLM_OK;
+}
+
+/* Clean up the transfers that are done warming a connection and start new
+ * ones for destinations that have fewer idle connections than wanted. */
+static void multi_prewarm_upkeep(struct Curl_multi *multi)
+{
+  struct Curl_llist_node *e;
+  struct curltime now;
+
+  if(!Curl_llist_count(&multi->prewarm))
+    return;
+
+  now = curlx_now();
+  for(e = Curl_llist_head(&multi->prewarm); e; e = Curl_node_next(e)) {
+    struct multi_prewarm *pw = Curl_node_elem(e);
+    unsigned int have, mid;
+
+    if(Curl_uint_spbset_first(&pw->xfers, &mid)) {
+      do {
+        struct Curl_easy *data = Curl_multi_get_easy(multi, mid);
+        if(!data || (data->mstate == MSTATE_MSGSENT)) {
+          Curl_uint_spbset_remove(&pw->xfers, mid);
+          if(data) {
+            (void)curl_multi_remove_handle(multi, data);
+            Curl_close(&data);
+          }
+        }
+      } while(Curl_uint_spbset_next(&pw->xfers, mid, &mid));
+    }
+
+    have = Curl_uint_spbset_count(&pw->xfers);
+    if(pw->destination)
+      have += Curl_cpool_idle_count(multi->admin, pw->destination,
+                                    pw->reuse_fp);
+    if((have >= pw->want) ||
+       (curlx_timediff(now, pw->failed) < CURL_PREWARM_RETRY_MS))
+      continue;
+
+    CURL_TRC_M(multi->admin, "prewarm %s: %u of %u connections, starting %u",
+               pw->tmpl->set.str[STRING_SET_URL], have, pw->want,
+               pw->want - have);
+    for(; have < pw->want; have++) {
+      if(multi_prewarm_start(multi, pw)) {
+        pw->failed = now;
+        break;
+      }
+    }
+  }
+}
+
+CURLMcode curl_multi_prewarm(CURLM *m, CURL *d, unsigned int num)
+{
+  struct Curl_multi *multi = m;
+  struct Curl_easy *data = d;
+  struct multi_prewarm *pw = NULL;
+  struct Curl_llist_node *e;
+  const char *url;
+
+  if(!GOOD_MULTI_HANDLE(multi))
+    return CURLM_BAD_HANDLE;
+
+  if(!GOOD_EASY_HANDLE(data))
+    return CURLM_BAD_EASY_HANDLE;
+
+  if(multi->in_callback)
+    return CURLM_RECURSIVE_API_CALL;
+
+  url = data->set.str[STRING_SET_URL];
+  if(!url)
+    return CURLM_BAD_FUNCTION_ARGUMENT;
+
+  for(e = Curl_llist_head(&multi->prewarm); e; e = Curl_node_next(e)) {
+    struct multi_prewarm *p = Curl_node_elem(e);
+    if(!strcmp(p->tmpl->set.str[STRING_SET_URL], url)) {
+      pw = p;
+      break;
+    }
+  }
+
+  if(!num) {
+    if(pw)
+      multi_prewarm_free(multi, pw, TRUE);
+    return CURLM_OK;
+  }
+
+  if(!pw) {
+    pw = calloc(1, sizeof(*pw));
+    if(!pw)
+      return CURLM_OUT_OF_MEMORY;
+    Curl_uint_spbset_init(&pw->xfers);
+    Curl_llist_append(&multi->prewarm, pw, &pw->node);
+  }
+  else {
+    /* the options may be different, find the connections anew */
+    Curl_close(&pw->tmpl);
+    Curl_safefree(pw->destination);
+  }
+  pw->tmpl = curl_easy_duphandle(data);
+  if(!pw->tmpl) {
+    multi_prewarm_free(multi, pw, TRUE);
+    return CURLM_OUT_OF_MEMORY;
+  }
+  multi->prewarm_conns -= pw->want;
+  pw->want = num;
+  multi->prewarm_conns += num;
+  memset(&pw->failed, 0, sizeof(pw->failed));
+
+  multi_prewarm_upkeep(multi);
+  return Curl_update_timer(multi);
+}
+
 CURLMcode curl_multi_cleanup(CURLM *m)
 {
   struct Curl_multi *multi = m;
   if(GOOD_MULTI_HANDLE(multi)) {
+    struct Curl_llist_node *e;
     void *entry;
     unsigned int mid;
     if(multi->in_callback)
@@ -2853,6 +3228,8 @@ CURLMcode curl_multi_cleanup(CURLM *m)
           /* if DONE was never called for this handle */
           (void)multi_done(data, CURLE_OK, TRUE);
 
+        /* the timer wheel goes away with the multi handle */
+        (void)Curl_expire_clear(data);
         data->multi = NULL; /* clear the association */
         Curl_uint_tbl_remove(&multi->xfers, mid);
         data->mid = UINT_MAX;
@@ -2867,9 +3244,15 @@ CURLMcode curl_multi_cleanup(CURLM *m)
       while(Curl_uint_tbl_next(&multi->xfers, mid, &mid, &entry));
     }
 
+    /* the transfers warming connections are closed already */
+    for(e = Curl_llist_head(&multi->prewarm); e;
+        e = Curl_llist_head(&multi->prewarm))
+      multi_prewarm_free(multi, Curl_node_elem(e), FALSE);
+
     Curl_cpool_destroy(&multi->cpool);
     Curl_cshutdn_destroy(&multi->cshutdn, multi->admin);
     if(multi->admin) {
+      (void)Curl_dnscache_save(multi->admin, &multi->dnscache);
       CURL_TRC_M(multi->admin, "multi_cleanup, closing admin handle, done");
       multi->admin->multi = NULL;
       Curl_uint_tbl_remove(&multi->xfers, multi->admin->mid);
@@ -2880,6 +3263,9 @@ CURLMcode curl_multi_cleanup(CURLM *m)
 
     Curl_multi_ev_cleanup(multi);
     Curl_hash_destroy(&multi->proto_hash);
+#ifdef USE_RESOLV_POOL
+    Curl_async_thrdd_pool_destroy(multi);
+#endif
     Curl_dnscache_destroy(&multi->dnscache);
     Curl_psl_destroy(&multi->psl);
 #ifdef USE_SSL
@@ -2898,6 +3284,9 @@ CURLMcode curl_multi_cleanup(CURLM *m)
 #endif
 
     multi_xfer_bufs_free(multi);
+#ifdef USE_IO_URING
+    Curl_uring_destroy(multi->uring);
+#endif
 #ifdef DEBUGBUILD
     if(Curl_uint_tbl_count(&multi->xfers)) {
       multi_xfer_tbl_dump(multi);
@@ -2908,7 +3297,9 @@ CURLMcode curl_multi_cleanup(CURLM *m)
     Curl_uint_bset_destroy(&multi->dirty);
     Curl_uint_bset_destroy(&multi->pending);
     Curl_uint_bset_destroy(&multi->msgsent);
+    Curl_uint_bset_destroy(&multi->flush);
     Curl_uint_tbl_destroy(&multi->xfers);
+    Curl_twheel_destroy(&multi->timewheel);
     free(multi);
 
     return CURLM_OK;
@@ -2970,13 +3361,13 @@ void Curl_multi_will_close(struct Curl_easy *data, curl_socket_t s)
  * add_next_timeout()
  *
  * Each Curl_easy has a list of timeouts. The add_next_timeout() is called
- * when it has just been removed from the splay tree because the timeout has
+ * when it has just been removed from the timer wheel because the timeout has
  * expired. This function is then to advance in the list to pick the next
  * timeout to use (skip the already expired ones) and add this node back to
- * the splay tree again.
+ * the timer wheel again.
  *
- * The splay tree only has each sessionhandle as a single node and the nearest
- * timeout is used to sort it on.
+ * The timer wheel only has each sessionhandle as a single node and the
+ * nearest timeout is used to place it.
  */
 static CURLMcode add_next_timeout(struct curltime now,
                                   struct Curl_multi *multi,
@@ -3004,7 +3395,7 @@ static CURLMcode add_next_timeout(struct curltime now,
   e = Curl_llist_head(list);
   if(!e) {
     /* clear the expire times within the handles that we remove from the
-       splay tree */
+       timer wheel */
     tv->tv_sec = 0;
     tv->tv_usec = 0;
   }
@@ -3013,10 +3404,9 @@ static CURLMcode add_next_timeout(struct curltime now,
     /* copy the first entry to 'tv' */
     memcpy(tv, &node->time, sizeof(*tv));
 
-    /* Insert this node again into the splay. Keep the timer in the list in
+    /* Insert this node again into the wheel. Keep the timer in the list in
        case we need to recompute future timers. */
-    multi->timetree = Curl_splayinsert(*tv, multi->timetree,
-                                       &d->state.timenode);
+    Curl_twheel_add(&multi->timewheel, *tv, &d->state.timenode);
   }
   return CURLM_OK;
 }
@@ -3033,21 +3423,21 @@ static void multi_mark_expired_as_dirty(struct multi_run_ctx *mrc)
 {
   struct Curl_multi *multi = mrc->multi;
   struct Curl_easy *data = NULL;
-  struct Curl_tree *t = NULL;
+  struct Curl_twnode *t = NULL;
 
   /*
    * The loop following here will go on as long as there are expire-times left
-   * to process (compared to mrc->now) in the splay and 'data' will be
+   * to process (compared to mrc->now) in the wheel and 'data' will be
    * re-assigned for every expired handle we deal with.
    */
   while(1) {
     /* Check if there is one (more) expired timer to deal with! This function
        extracts a matching node if there is one */
-    multi->timetree = Curl_splaygetbest(mrc->now, multi->timetree, &t);
+    t = Curl_twheel_getbest(&multi->timewheel, mrc->now);
     if(!t)
       return;
 
-    data = Curl_splayget(t); /* assign this for next loop */
+    data = Curl_twheel_get(t); /* assign this for next loop */
     if(!data)
       continue;
 
@@ -3062,6 +3452,9 @@ static CURLMcode multi_run_dirty(struct multi_run_ctx *mrc)
   CURLMcode result = CURLM_OK;
   unsigned int mid;
 
+#ifdef USE_IO_URING
+  multi_batch_recv(multi, &multi->dirty);
+#endif
   if(Curl_uint_bset_first(&multi->dirty, &mid)) {
     do {
       struct Curl_easy *data = Curl_multi_get_easy(multi, mid);
@@ -3133,6 +3526,10 @@ static CURLMcode multi_socket(struct Curl_multi *multi,
   if(s != CURL_SOCKET_TIMEOUT) {
     /* Mark all transfers of that socket as dirty */
     Curl_multi_ev_dirty_xfers(multi, s, &mrc.run_cpool);
+#ifdef USE_IO_URING
+    if(ev_bitmask & CURL_CSELECT_IN)
+      Curl_multi_recv_ready(multi, s);
+#endif
   }
   else {
     /* Asked to run due to time-out. Clear the 'last_expire_ts' variable to
@@ -3144,6 +3541,7 @@ static CURLMcode multi_socket(struct Curl_multi *multi,
     mrc.run_cpool = TRUE;
   }
 
+  multi->batch_egress = TRUE;
   multi_mark_expired_as_dirty(&mrc);
   result = multi_run_dirty(&mrc);
   if(result)
@@ -3161,9 +3559,11 @@ static CURLMcode multi_socket(struct Curl_multi *multi,
   }
 
 out:
+  multi_flush_conns(multi);
   if(mrc.run_cpool) {
     sigpipe_apply(multi->admin, &mrc.pipe_st);
     Curl_cshutdn_perform(&multi->cshutdn, multi->admin, s);
+    multi_prewarm_upkeep(multi);
   }
   sigpipe_restore(&mrc.pipe_st);
 
@@ -3198,9 +3598,18 @@ CURLMcode curl_multi_setopt(CURLM *m,
   va_start(param, option);
 
   switch(option) {
-  case CURLMOPT_SOCKETFUNCTION:
-    multi->socket_cb = va_arg(param, curl_socket_callback);
+  case CURLMOPT_SOCKETFUNCTION: {
+    curl_socket_callback cb = va_arg(param, curl_socket_callback);
+#ifdef USE_EPOLL
+    bool had_cb = !!multi->socket_cb;
+    multi->socket_cb = cb;
+    if(had_cb != !!cb)
+      res = Curl_multi_ev_epoll_switch(multi);
+#else
+    multi->socket_cb = cb;
+#endif
     break;
+  }
   case CURLMOPT_SOCKETDATA:
     multi->socket_userp = va_arg(param, void *);
     break;
@@ -3259,6 +3668,60 @@ CURLMcode curl_multi_setopt(CURLM *m,
     }
     break;
   }
+  case CURLMOPT_EPOLL: {
+    long val = va_arg(param, long);
+#ifdef USE_EPOLL
+    res = Curl_multi_ev_epoll_enable(multi, val ? TRUE : FALSE);
+#else
+    (void)val; /* not available, stay with poll() */
+#endif
+    break;
+  }
+  case CURLMOPT_IO_URING: {
+    long val = va_arg(param, long);
+#ifdef USE_IO_URING
+    if(val && !multi->uring) {
+      /* without io_uring in the running kernel, receive directly */
+      if(Curl_uring_create(&multi->uring, MULTI_URING_ENTRIES))
+        CURL_TRC_M(multi->admin, "io_uring not available");
+    }
+    else if(!val && multi->uring) {
+      Curl_uring_destroy(multi->uring);
+      multi->uring = NULL;
+    }
+#else
+    (void)val; /* not available, receive directly */
+#endif
+    break;
+  }
+  case CURLMOPT_RESOLVE_THREADS: {
+    long val = va_arg(param, long);
+    if(val < 0)
+      res = CURLM_BAD_FUNCTION_ARGUMENT;
+#ifdef USE_RESOLV_POOL
+    else
+      res = Curl_async_thrdd_pool_set(multi, val, -1);
+#endif
+    break;
+  }
+  case CURLMOPT_RESOLVE_QUEUE: {
+    long val = va_arg(param, long);
+    if(val < 0)
+      res = CURLM_BAD_FUNCTION_ARGUMENT;
+#ifdef USE_RESOLV_POOL
+    else
+      res = Curl_async_thrdd_pool_set(multi, -1, val);
+#endif
+    break;
+  }
+  case CURLMOPT_VERIFY_THREADS: {
+    long val = va_arg(param, long);
+    if((val < 0) || (val > INT_MAX))
+      res = CURLM_BAD_FUNCTION_ARGUMENT;
+    else
+      multi->verify_threads = (unsigned int)val;
+    break;
+  }
   default:
     res = CURLM_UNKNOWN_OPTION;
     break;
@@ -3323,6 +3786,7 @@ static CURLMcode multi_timeout(struct Curl_multi *multi,
                                long *timeout_ms)
 {
   static const struct curltime tv_zero = {0, 0};
+  struct Curl_twnode *t;
 
   if(multi->dead) {
     *timeout_ms = 0;
@@ -3334,31 +3798,22 @@ static CURLMcode multi_timeout(struct Curl_multi *multi,
     *timeout_ms = 0;
     return CURLM_OK;
   }
-  else if(multi->timetree) {
-    /* we have a tree of expire times */
-    struct curltime now = curlx_now();
 
-    /* splay the lowest to the bottom */
-    multi->timetree = Curl_splay(tv_zero, multi->timetree);
-    /* this will not return NULL from a non-empty tree, but some compilers
-     * are not convinced of that. Analyzers are hard. */
-    *expire_time = multi->timetree ? multi->timetree->key : tv_zero;
+  t = Curl_twheel_next(&multi->timewheel, expire_time);
+  if(t) {
+    /* we have a wheel of expire times */
+    struct curltime now = curlx_now();
 
-    /* 'multi->timetree' will be non-NULL here but the compilers sometimes
-       yell at us if we assume so */
-    if(multi->timetree &&
-       curlx_timediff_us(multi->timetree->key, now) > 0) {
+    if(curlx_timediff_us(*expire_time, now) > 0) {
       /* some time left before expiration */
-      timediff_t diff = curlx_timediff_ceil(multi->timetree->key, now);
+      timediff_t diff = curlx_timediff_ceil(*expire_time, now);
       /* this should be safe even on 32-bit archs, as we do not use that
          overly long timeouts */
       *timeout_ms = (long)diff;
     }
     else {
-      if(multi->timetree) {
-        struct Curl_easy *data = Curl_splayget(multi->timetree);
-        CURL_TRC_M(data, "multi_timeout() says this has expired");
-      }
+      struct Curl_easy *data = Curl_twheel_get(t);
+      CURL_TRC_M(data, "multi_timeout() says this has expired");
       /* 0 means immediately */
       *timeout_ms = 0;
     }
@@ -3556,32 +4011,27 @@ void Curl_expire_ex(struct Curl_easy *data,
   multi_addtimeout(data, &set, id);
 
   if(curr_expire->tv_sec || curr_expire->tv_usec) {
-    /* This means that the struct is added as a node in the splay tree.
+    /* This means that the struct is added as a node in the timer wheel.
        Compare if the new time is earlier, and only remove-old/add-new if it
        is. */
     timediff_t diff = curlx_timediff(set, *curr_expire);
-    int rc;
 
     if(diff > 0) {
-      /* The current splay tree entry is sooner than this new expiry time.
-         We do not need to update our splay tree entry. */
+      /* The current timer wheel entry is sooner than this new expiry time.
+         We do not need to update our timer wheel entry. */
       return;
     }
 
     /* Since this is an updated time, we must remove the previous entry from
-       the splay tree first and then re-add the new value */
-    rc = Curl_splayremove(multi->timetree, &data->state.timenode,
-                          &multi->timetree);
-    if(rc)
-      infof(data, "Internal error removing splay node = %d", rc);
+       the timer wheel first and then re-add the new value */
+    Curl_twheel_remove(&multi->timewheel, &data->state.timenode);
   }
 
-  /* Indicate that we are in the splay tree and insert the new timer expiry
+  /* Indicate that we are in the timer wheel and insert the new timer expiry
      value since it is our local minimum. */
   *curr_expire = set;
-  Curl_splayset(&data->state.timenode, data);
-  multi->timetree = Curl_splayinsert(*curr_expire, multi->timetree,
-                                     &data->state.timenode);
+  Curl_twheel_set(&data->state.timenode, data);
+  Curl_twheel_add(&multi->timewheel, *curr_expire, &data->state.timenode);
   if(data->id >= 0)
     CURL_TRC_M(data, "[TIMEOUT] set %s to expire in %" FMT_TIMEDIFF_T "ns",
                CURL_TIMER_NAME(id), curlx_timediff_us(set, *nowp));
@@ -3635,14 +4085,10 @@ bool Curl_expire_clear(struct Curl_easy *data)
 
   if(nowp->tv_sec || nowp->tv_usec) {
     /* Since this is an cleared time, we must remove the previous entry from
-       the splay tree */
+       the timer wheel */
     struct Curl_llist *list = &data->state.timeoutlist;
-    int rc;
 
-    rc = Curl_splayremove(multi->timetree, &data->state.timenode,
-                          &multi->timetree);
-    if(rc)
-      infof(data, "Internal error clearing splay node = %d", rc);
+    Curl_twheel_remove(&multi->timewheel, &data->state.timenode);
 
     /* clear the timeout list too */
     Curl_llist_destroy(list, NULL);
@@ -3782,6 +4228,21 @@ CURLMcode curl_multi_get_offt(CURLM *m,
   case CURLMINFO_XFERS_ADDED:
     *pvalue = multi->xfers_total_ever;
     return CURLM_OK;
+  case CURLMINFO_DNS_NEGATIVE_ADDED:
+    *pvalue = multi->dns_neg_added;
+    return CURLM_OK;
+  case CURLMINFO_DNS_NEGATIVE_HITS:
+    *pvalue = multi->dns_neg_hits;
+    return CURLM_OK;
+  case CURLMINFO_DNS_HITS:
+    *pvalue = multi->dns_hits;
+    return CURLM_OK;
+  case CURLMINFO_DNS_STALE_HITS:
+    *pvalue = multi->dns_stale_hits;
+    return CURLM_OK;
+  case CURLMINFO_DNS_MISSES:
+    *pvalue = multi->dns_misses;
+    return CURLM_OK;
   default:
     *pvalue = -1;
     return CURLM_UNKNOWN_OPTION;
@@ -3982,6 +4443,16 @@ void Curl_multi_clear_dirty(struct Curl_easy *data)
     Curl_uint_bset_remove(&data->multi->dirty, data->mid);
 }
 
+bool Curl_multi_flush_later(struct Curl_easy *data)
+{
+  struct Curl_multi *multi = data->multi;
+
+  if(!multi || !multi->batch_egress || (data->mid == UINT_MAX) ||
+     (data == multi->admin) || !data->conn)
+    return FALSE;
+  return Curl_uint_bset_add(&multi->flush, data->mid);
+}
+
 #ifdef DEBUGBUILD
 static void multi_xfer_dump(struct Curl_multi *multi, unsigned int mid,
                             void *entry)
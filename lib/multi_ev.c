@@ -40,6 +40,11 @@
 #include "curlx/warnless.h"
 #include "multihandle.h"
 #include "socks.h"
+
+#ifdef USE_EPOLL
+#include <sys/epoll.h>
+#endif
+
 /* The last 3 #include files should be in this order */
 #include "curl_printf.h"
 #include "curl_memory.h"
@@ -51,6 +56,11 @@ static void mev_in_callback(struct Curl_multi *multi, bool value)
   multi->in_callback = value;
 }
 
+/* TRUE when socket changes are passed on to the socket callback or
+ * to the internal epoll set */
+#define mev_is_tracking(m) \
+  ((m)->socket_cb || Curl_multi_ev_epoll_active(m))
+
 #define CURL_MEV_CONN_HASH_SIZE 3
 
 /* Information about a socket for which we inform the libcurl application
@@ -193,6 +203,45 @@ static bool mev_sh_entry_conn_remove(struct mev_sh_entry *e,
   return FALSE;
 }
 
+#ifdef USE_EPOLL
+/* Make the epoll set watch socket `s` for `action`, where an empty
+ * action removes the socket from the set. */
+static int mev_epoll_ctl(struct Curl_multi *multi,
+                         struct mev_sh_entry *entry,
+                         curl_socket_t s,
+                         unsigned int action)
+{
+  struct epoll_event ev;
+  int op, rc;
+
+  memset(&ev, 0, sizeof(ev));
+  ev.data.fd = s;
+  if(action & CURL_POLL_IN)
+    ev.events |= EPOLLIN;
+  if(action & CURL_POLL_OUT)
+    ev.events |= EPOLLOUT;
+
+  if(!action)
+    op = EPOLL_CTL_DEL;
+  else
+    op = entry->announced ? EPOLL_CTL_MOD : EPOLL_CTL_ADD;
+
+  rc = epoll_ctl(multi->ev.epfd, op, s, &ev);
+  if(rc) {
+    /* A socket that was closed drops out of the set by itself and its
+     * number may get reused before we learn about it. Be lenient. */
+    int err = SOCKERRNO;
+    if(op == EPOLL_CTL_ADD && err == EEXIST)
+      rc = epoll_ctl(multi->ev.epfd, EPOLL_CTL_MOD, s, &ev);
+    else if(op == EPOLL_CTL_MOD && err == ENOENT)
+      rc = epoll_ctl(multi->ev.epfd, EPOLL_CTL_ADD, s, &ev);
+    else if(op == EPOLL_CTL_DEL)
+      rc = 0;
+  }
+  return rc;
+}
+#endif /* USE_EPOLL */
+
 /* Purge any information about socket `s`.
  * Let the socket callback know as well when necessary */
 static CURLMcode mev_forget_socket(struct Curl_multi *multi,
@@ -216,6 +265,13 @@ static CURLMcode mev_forget_socket(struct Curl_multi *multi,
     mev_in_callback(multi, FALSE);
     entry->announced = FALSE;
   }
+#ifdef USE_EPOLL
+  else if(entry->announced && Curl_multi_ev_epoll_active(multi)) {
+    CURL_TRC_M(data, "ev %s, epoll remove fd=%" FMT_SOCKET_T, cause, s);
+    (void)mev_epoll_ctl(multi, entry, s, 0);
+    entry->announced = FALSE;
+  }
+#endif
 
   mev_sh_entry_kill(multi, s);
   if(rc == -1) {
@@ -234,9 +290,9 @@ static CURLMcode mev_sh_entry_update(struct Curl_multi *multi,
 {
   int rc, comboaction;
 
-  /* we should only be called when the callback exists */
-  DEBUGASSERT(multi->socket_cb);
-  if(!multi->socket_cb)
+  /* we should only be called when the callback or epoll set exists */
+  DEBUGASSERT(mev_is_tracking(multi));
+  if(!mev_is_tracking(multi))
     return CURLM_OK;
 
   /* Transfer `data` goes from `last_action` to `cur_action` on socket `s`
@@ -278,6 +334,22 @@ static CURLMcode mev_sh_entry_update(struct Curl_multi *multi,
   if(((int)entry->action == comboaction)) /* nothing for socket changed */
     return CURLM_OK;
 
+#ifdef USE_EPOLL
+  if(!multi->socket_cb) {
+    CURL_TRC_M(data, "ev update epoll(fd=%" FMT_SOCKET_T ", ev=%s%s)",
+               s, (comboaction & CURL_POLL_IN) ? "IN" : "",
+               (comboaction & CURL_POLL_OUT) ? "OUT" : "");
+    if(mev_epoll_ctl(multi, entry, s, (unsigned int)comboaction)) {
+      failf(data, "epoll_ctl() failed for fd=%" FMT_SOCKET_T ", errno %d",
+            s, SOCKERRNO);
+      return CURLM_UNRECOVERABLE_POLL;
+    }
+    entry->announced = TRUE;
+    entry->action = (unsigned int)comboaction;
+    return CURLM_OK;
+  }
+#endif
+
   CURL_TRC_M(data, "ev update call(fd=%" FMT_SOCKET_T ", ev=%s%s)",
              s, (comboaction & CURL_POLL_IN) ? "IN" : "",
              (comboaction & CURL_POLL_OUT) ? "OUT" : "");
@@ -497,7 +569,11 @@ static CURLMcode mev_assess(struct Curl_multi *multi,
   struct easy_pollset ps, *last_ps;
   CURLMcode res = CURLM_OK;
 
-  if(!multi || !multi->socket_cb)
+  if(!multi || !mev_is_tracking(multi))
+    return CURLM_OK;
+  /* connections in shutdown only get tracked for a socket callback,
+   * otherwise they are polled via Curl_cshutdn_add_pollfds() */
+  if(conn && !multi->socket_cb)
     return CURLM_OK;
 
   Curl_pollset_init(&ps);
@@ -552,7 +628,7 @@ CURLMcode Curl_multi_ev_assess_xfer_bset(struct Curl_multi *multi,
   unsigned int mid;
   CURLMcode result = CURLM_OK;
 
-  if(multi && multi->socket_cb && Curl_uint_bset_first(set, &mid)) {
+  if(multi && mev_is_tracking(multi) && Curl_uint_bset_first(set, &mid)) {
     do {
       struct Curl_easy *data = Curl_multi_get_easy(multi, mid);
       if(data)
@@ -642,9 +718,112 @@ void Curl_multi_ev_init(struct Curl_multi *multi, size_t hashsize)
 {
   Curl_hash_init(&multi->ev.sh_entries, hashsize, mev_sh_entry_hash,
                  mev_sh_entry_compare, mev_sh_entry_dtor);
+#ifdef USE_EPOLL
+  multi->ev.epfd = -1;
+#endif
 }
 
 void Curl_multi_ev_cleanup(struct Curl_multi *multi)
 {
   Curl_hash_destroy(&multi->ev.sh_entries);
+#ifdef USE_EPOLL
+  if(multi->ev.epfd != -1) {
+    close(multi->ev.epfd);
+    multi->ev.epfd = -1;
+  }
+#endif
 }
+
+#ifdef USE_EPOLL
+
+/* number of events collected on the stack, more sockets in the set
+ * need an allocated array */
+#define MEV_EPOLL_BATCH   128
+
+CURLMcode Curl_multi_ev_epoll_enable(struct Curl_multi *multi, bool enable)
+{
+  if(enable) {
+    if(multi->ev.epfd != -1)
+      return CURLM_OK;
+    multi->ev.epfd = epoll_create1(EPOLL_CLOEXEC);
+    if(multi->ev.epfd == -1) {
+      /* out of descriptors or not supported, stay with poll() */
+      CURL_TRC_M(multi->admin, "ev epoll_create1() failed, errno %d",
+                 SOCKERRNO);
+      return CURLM_OK;
+    }
+    CURL_TRC_M(multi->admin, "ev epoll backend enabled, epfd=%d",
+               multi->ev.epfd);
+    /* transfers already added need their sockets in the new set */
+    return Curl_multi_ev_assess_xfer_bset(multi, &multi->process);
+  }
+
+  if(multi->ev.epfd != -1) {
+    /* without a socket callback, all we know is in the epoll set */
+    if(!multi->socket_cb)
+      Curl_hash_clean(&multi->ev.sh_entries);
+    close(multi->ev.epfd);
+    multi->ev.epfd = -1;
+    CURL_TRC_M(multi->admin, "ev epoll backend disabled");
+  }
+  return CURLM_OK;
+}
+
+CURLMcode Curl_multi_ev_epoll_switch(struct Curl_multi *multi)
+{
+  if(multi->ev.epfd == -1)
+    return CURLM_OK;
+  /* The entries were announced to the epoll set or to the former socket
+   * callback. Start over with a fresh set and announce all anew. */
+  Curl_hash_clean(&multi->ev.sh_entries);
+  close(multi->ev.epfd);
+  multi->ev.epfd = epoll_create1(EPOLL_CLOEXEC);
+  if(multi->ev.epfd == -1)
+    CURL_TRC_M(multi->admin, "ev epoll_create1() failed, errno %d",
+               SOCKERRNO);
+  if(mev_is_tracking(multi))
+    return Curl_multi_ev_assess_xfer_bset(multi, &multi->process);
+  return CURLM_OK;
+}
+
+int Curl_multi_ev_epoll_dispatch(struct Curl_multi *multi)
+{
+  struct epoll_event a_few[MEV_EPOLL_BATCH];
+  struct epoll_event *events = a_few;
+  bool run_cpool = FALSE;
+  size_t max = Curl_hash_count(&multi->ev.sh_entries);
+  int i, n;
+
+  DEBUGASSERT(Curl_multi_ev_epoll_active(multi));
+  /* Collect all ready sockets in one go, so that the number returned
+   * counts each of them once. */
+  if(max > MEV_EPOLL_BATCH) {
+    if(max > INT_MAX)
+      max = INT_MAX;
+    events = malloc(max * sizeof(*events));
+    if(!events)
+      return -1;
+  }
+  else
+    max = MEV_EPOLL_BATCH;
+
+  do {
+    n = epoll_wait(multi->ev.epfd, events, (int)max, 0);
+  } while(n < 0 && SOCKERRNO == SOCKEINTR);
+
+  for(i = 0; i < n; i++) {
+    Curl_multi_ev_dirty_xfers(multi, (curl_socket_t)events[i].data.fd,
+                              &run_cpool);
+#ifdef USE_IO_URING
+    if(events[i].events & EPOLLIN)
+      Curl_multi_recv_ready(multi, (curl_socket_t)events[i].data.fd);
+#endif
+  }
+  /* connections are not in the epoll set, `run_cpool` has no meaning */
+  (void)run_cpool;
+  if(events != a_few)
+    free(events);
+  return (n < 0) ? -1 : n;
+}
+
+#endif /* USE_EPOLL */
@@ -36,6 +36,9 @@ struct uint_bset;
 
 struct curl_multi_ev {
   struct Curl_hash sh_entries;
+#ifdef USE_EPOLL
+  int epfd; /* epoll instance tracking all sockets or -1 */
+#endif
 };
 
 /* Setup/teardown of multi event book-keeping. */
@@ -79,4 +82,27 @@ void Curl_multi_ev_conn_done(struct Curl_multi *multi,
                              struct Curl_easy *data,
                              struct connectdata *conn);
 
+#ifdef USE_EPOLL
+/* Switch the internal epoll() backend on or off. When on and no socket
+ * callback is installed, all transfer sockets are kept in a persistent
+ * epoll set instead of being collected anew on every wait. */
+CURLMcode Curl_multi_ev_epoll_enable(struct Curl_multi *multi, bool enable);
+
+/* The socket callback was set or cleared. When the epoll backend is
+ * enabled, the sockets need to be announced again to whichever of the
+ * two tracks them now. */
+CURLMcode Curl_multi_ev_epoll_switch(struct Curl_multi *multi);
+
+/* TRUE when the epoll set is the one tracking the transfer sockets */
+#define Curl_multi_ev_epoll_active(m) \
+  (((m)->ev.epfd != -1) && !(m)->socket_cb)
+
+/* Collect the ready events from the epoll set without waiting and mark
+ * the transfers on those sockets as dirty. Returns the number of
+ * sockets that had events, or -1 on error. */
+int Curl_multi_ev_epoll_dispatch(struct Curl_multi *multi);
+#else
+#define Curl_multi_ev_epoll_active(m)   FALSE
+#endif
+
 #endif /* HEADER_CURL_MULTI_EV_H */
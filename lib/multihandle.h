@@ -32,9 +32,11 @@
 #include "multi_ev.h"
 #include "psl.h"
 #include "socketpair.h"
+#include "timewheel.h"
 #include "uint-bset.h"
 #include "uint-spbset.h"
 #include "uint-table.h"
+#include "uring.h"
 
 struct connectdata;
 struct Curl_easy;
@@ -90,12 +92,19 @@ struct Curl_multi {
   unsigned int xfers_alive; /* amount of added transfers that have
                                not yet reached COMPLETE state */
   curl_off_t xfers_total_ever; /* total of added transfers, ever. */
+  curl_off_t dns_neg_added; /* negative DNS cache entries added, ever */
+  curl_off_t dns_neg_hits; /* resolves failed by a negative entry, ever */
+  curl_off_t dns_hits; /* resolves answered by the DNS cache, ever */
+  curl_off_t dns_stale_hits; /* answered by an expired entry, ever */
+  curl_off_t dns_misses; /* resolves not in the DNS cache, ever */
   struct uint_tbl xfers; /* transfers added to this multi */
   /* Each transfer's mid may be present in at most one of these */
   struct uint_bset process; /* transfer being processed */
   struct uint_bset dirty; /* transfer to be run NOW, e.g. ASAP. */
   struct uint_bset pending; /* transfers in waiting (conn limit etc.) */
   struct uint_bset msgsent; /* transfers done with message for application */
+  /* transfers whose connection has output batched until the end of a run */
+  struct uint_bset flush;
 
   struct Curl_llist msglist; /* a list of messages from completed transfers */
 
@@ -111,6 +120,9 @@ struct Curl_multi {
   void *push_userp;
 
   struct Curl_dnscache dnscache; /* DNS cache */
+#ifdef USE_RESOLV_POOL
+  struct async_thrdd_pool *resolv_pool; /* threads for name resolves */
+#endif
   struct Curl_ssl_scache *ssl_scache; /* TLS session pool */
 
 #ifdef USE_LIBPSL
@@ -118,9 +130,9 @@ struct Curl_multi {
   struct PslCache psl;
 #endif
 
-  /* timetree points to the splay-tree of time nodes to figure out expire
-     times of all currently set timers */
-  struct Curl_tree *timetree;
+  /* timer wheel of time nodes to figure out expire times of all currently
+     set timers */
+  struct Curl_twheel timewheel;
 
   /* buffer used for transfer data, lazy initialized */
   char *xfer_buf; /* the actual buffer */
@@ -145,6 +157,7 @@ struct Curl_multi {
 
   struct cshutdn cshutdn; /* connection shutdown handling */
   struct cpool cpool;     /* connection pool (bundles) */
+  struct Curl_llist prewarm; /* destinations to keep connections warm for */
 
   long max_host_connections; /* if >0, a fixed limit of the maximum number
                                 of connections per host */
@@ -171,6 +184,11 @@ struct Curl_multi {
   unsigned int maxconnects; /* if >0, a fixed limit of the maximum number of
                                entries we are allowed to grow the connection
                                cache to */
+  unsigned int prewarm_conns; /* sum of the connections to keep warm */
+  unsigned int verify_threads; /* max threads verifying TLS certificates */
+#ifdef USE_IO_URING
+  struct Curl_uring *uring;    /* batches socket receives, when enabled */
+#endif
 #define IPV6_UNKNOWN 0
 #define IPV6_DEAD    1
 #define IPV6_WORKS   2
@@ -178,6 +196,8 @@ struct Curl_multi {
   BIT(multiplexing);           /* multiplexing wanted */
   BIT(recheckstate);           /* see Curl_multi_connchanged */
   BIT(in_callback);            /* true while executing a callback */
+  BIT(batch_egress);           /* true while running transfers, connections
+                                  may batch output until the run ends */
 #ifdef USE_OPENSSL
   BIT(ssl_seeded);
 #endif
@@ -165,4 +165,15 @@ void Curl_multi_mark_dirty(struct Curl_easy *data);
 /* Clear transfer from the dirty set. */
 void Curl_multi_clear_dirty(struct Curl_easy *data);
 
+/* Have the connection of transfer `data` flushed when the multi handle
+ * is done running transfers, so that output of several transfers goes
+ * out together. Returns FALSE when the multi handle is not running
+ * transfers and the caller needs to flush right away. */
+bool Curl_multi_flush_later(struct Curl_easy *data);
+
+#ifdef USE_IO_URING
+/* Socket `s` is known to be readable, have its receive batched. */
+void Curl_multi_recv_ready(struct Curl_multi *multi, curl_socket_t s);
+#endif
+
 #endif /* HEADER_CURL_MULTIIF_H */
@@ -26,9 +26,6 @@
 
 #include "curl_setup.h"
 
-#if (!defined(CURL_DISABLE_HTTP) || !defined(CURL_DISABLE_COOKIES)) || \
-  !defined(CURL_DISABLE_ALTSVC)
-
 #include "curlx/multibyte.h"
 #include "curlx/timeval.h"
 
@@ -69,5 +66,3 @@ int Curl_rename(const char *oldpath, const char *newpath)
 #endif
   return 0;
 }
-
-#endif
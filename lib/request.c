@@ -174,11 +174,17 @@ void Curl_req_free(struct SingleRequest *req, struct Curl_easy *data)
   Curl_client_cleanup(data);
 }
 
-static CURLcode xfer_send(struct Curl_easy *data,
-                          const char *buf, size_t blen,
-                          size_t hds_len, size_t *pnwritten)
+/* Send `blen` bytes at `buf`, starting with `hds_len` header bytes,
+ * followed by `mlen` more body bytes at `more`. Both go out together in
+ * one call to the connection. */
+static CURLcode xfer_send2(struct Curl_easy *data,
+                           const char *buf, size_t blen, size_t hds_len,
+                           const char *more, size_t mlen,
+                           bool last, size_t *pnwritten)
 {
   CURLcode result = CURLE_OK;
+  size_t full_len = blen + mlen;
+  size_t len = full_len;
   bool eos = FALSE;
 
   *pnwritten = 0;
@@ -187,13 +193,13 @@ static CURLcode xfer_send(struct Curl_easy *data,
   {
     /* Allow debug builds to override this logic to force short initial
        sends */
-    size_t body_len = blen - hds_len;
+    size_t body_len = len - hds_len;
     if(body_len) {
       const char *p = getenv("CURL_SMALLREQSEND");
       if(p) {
         curl_off_t body_small;
         if(!curlx_str_number(&p, &body_small, body_len))
-          blen = hds_len + (size_t)body_small;
+          len = hds_len + (size_t)body_small;
       }
     }
   }
@@ -201,28 +207,42 @@ static CURLcode xfer_send(struct Curl_easy *data,
   /* Make sure this does not send more body bytes than what the max send
      speed says. The headers do not count to the max speed. */
   if(data->set.max_send_speed) {
-    size_t body_bytes = blen - hds_len;
+    size_t body_bytes = len - hds_len;
     if((curl_off_t)body_bytes > data->set.max_send_speed)
-      blen = hds_len + (size_t)data->set.max_send_speed;
+      len = hds_len + (size_t)data->set.max_send_speed;
   }
 
-  if(data->req.eos_read &&
-    (Curl_bufq_is_empty(&data->req.sendbuf) ||
-     Curl_bufq_len(&data->req.sendbuf) == blen)) {
-    DEBUGF(infof(data, "sending last upload chunk of %zu bytes", blen));
+  /* `last` says that the buffers hold all there is left to send */
+  if(last && (len == full_len)) {
+    DEBUGF(infof(data, "sending last upload chunk of %zu bytes", len));
     eos = TRUE;
   }
-  result = Curl_xfer_send(data, buf, blen, eos, pnwritten);
+  if(!blen)
+    result = Curl_xfer_send(data, more, len, eos, pnwritten);
+  else if(len > blen) {
+    struct curl_iovec iov[2];
+    iov[0].base = buf;
+    iov[0].len = blen;
+    iov[1].base = more;
+    iov[1].len = len - blen;
+    result = Curl_xfer_sendv(data, iov, 2, eos, pnwritten);
+  }
+  else
+    result = Curl_xfer_send(data, buf, len, eos, pnwritten);
   if(!result) {
-    if(eos && (blen == *pnwritten))
+    size_t n = *pnwritten;
+    if(eos && (len == n))
       data->req.eos_sent = TRUE;
-    if(*pnwritten) {
+    if(n) {
       if(hds_len)
-        Curl_debug(data, CURLINFO_HEADER_OUT, buf,
-                   CURLMIN(hds_len, *pnwritten));
-      if(*pnwritten > hds_len) {
-        size_t body_len = *pnwritten - hds_len;
-        Curl_debug(data, CURLINFO_DATA_OUT, buf + hds_len, body_len);
+        Curl_debug(data, CURLINFO_HEADER_OUT, buf, CURLMIN(hds_len, n));
+      if(n > hds_len) {
+        size_t body_len = n - hds_len;
+        if(CURLMIN(n, blen) > hds_len)
+          Curl_debug(data, CURLINFO_DATA_OUT, buf + hds_len,
+                     CURLMIN(n, blen) - hds_len);
+        if(n > blen)
+          Curl_debug(data, CURLINFO_DATA_OUT, more, n - blen);
         data->req.writebytecount += body_len;
         Curl_pgrsSetUploadCounter(data, data->req.writebytecount);
       }
@@ -231,6 +251,13 @@ static CURLcode xfer_send(struct Curl_easy *data,
   return result;
 }
 
+static CURLcode xfer_send(struct Curl_easy *data,
+                          const char *buf, size_t blen,
+                          size_t hds_len, bool last, size_t *pnwritten)
+{
+  return xfer_send2(data, buf, blen, hds_len, NULL, 0, last, pnwritten);
+}
+
 static CURLcode req_send_buffer_flush(struct Curl_easy *data)
 {
   CURLcode result = CURLE_OK;
@@ -239,7 +266,10 @@ static CURLcode req_send_buffer_flush(struct Curl_easy *data)
 
   while(Curl_bufq_peek(&data->req.sendbuf, &buf, &blen)) {
     size_t nwritten, hds_len = CURLMIN(data->req.sendbuf_hds_len, blen);
-    result = xfer_send(data, (const char *)buf, blen, hds_len, &nwritten);
+    bool last = data->req.eos_read &&
+                (Curl_bufq_len(&data->req.sendbuf) == blen);
+    result = xfer_send(data, (const char *)buf, blen, hds_len, last,
+                       &nwritten);
     if(result)
       break;
 
@@ -310,7 +340,7 @@ static CURLcode req_flush(struct Curl_easy *data)
   if(data->req.eos_read && !data->req.eos_sent) {
     char tmp = 0;
     size_t nwritten;
-    result = xfer_send(data, &tmp, 0, 0, &nwritten);
+    result = xfer_send(data, &tmp, 0, 0, TRUE, &nwritten);
     if(result)
       return result;
     DEBUGASSERT(data->req.eos_sent);
@@ -389,7 +419,7 @@ CURLcode Curl_req_send(struct Curl_easy *data, struct dynbuf *req,
      !Curl_creader_total_length(data) &&
      (blen <= data->req.sendbuf.chunk_size)) {
     data->req.eos_read = TRUE;
-    result = xfer_send(data, buf, blen, blen, &nwritten);
+    result = xfer_send(data, buf, blen, blen, TRUE, &nwritten);
     if(result)
       return result;
     buf += nwritten;
@@ -431,19 +461,78 @@ bool Curl_req_done_sending(struct Curl_easy *data)
   return data->req.upload_done && !Curl_req_want_send(data);
 }
 
+/* Send client data directly from the memory its reader keeps, without
+ * copying it into our send buffer first. Data still in the send buffer,
+ * like the request headers, goes out together with it in a single
+ * vectored send. Returns CURLE_NOT_BUILT_IN when the installed readers
+ * cannot do that. */
+static CURLcode req_send_client_direct(struct Curl_easy *data)
+{
+  CURLcode result;
+
+  while(!data->req.eos_read) {
+    const unsigned char *pre = NULL;
+    const char *buf;
+    size_t prelen = 0, hds_len = 0, blen, nwritten;
+    bool eos;
+
+    result = Curl_client_peek(data, &buf, &blen, &eos);
+    if(result)
+      return result;
+    if(!blen) {
+      if(eos)
+        data->req.eos_read = TRUE;
+      break;
+    }
+    /* send no more than the buffered path would, so that a blocked
+     * send is retried with the same length */
+    if(blen > data->req.sendbuf.chunk_size) {
+      blen = data->req.sendbuf.chunk_size;
+      eos = FALSE;
+    }
+    if(Curl_bufq_peek(&data->req.sendbuf, &pre, &prelen)) {
+      if(prelen < Curl_bufq_len(&data->req.sendbuf))
+        break; /* more than one chunk buffered, flush that first */
+      hds_len = CURLMIN(data->req.sendbuf_hds_len, prelen);
+    }
+    result = xfer_send2(data, (const char *)pre, prelen, hds_len,
+                        buf, blen, eos, &nwritten);
+    if(result)
+      return result;
+    if(prelen) {
+      size_t n = CURLMIN(nwritten, prelen);
+      Curl_bufq_skip(&data->req.sendbuf, n);
+      data->req.sendbuf_hds_len -= CURLMIN(hds_len, n);
+      nwritten -= n;
+      if(n < prelen)
+        break; /* blocked or limited, try again later */
+    }
+    Curl_client_skip(data, nwritten);
+    if(nwritten < blen)
+      break; /* blocked or limited, try again later */
+    if(eos)
+      data->req.eos_read = TRUE;
+  }
+  return CURLE_OK;
+}
+
 CURLcode Curl_req_send_more(struct Curl_easy *data)
 {
   CURLcode result;
 
-  /* Fill our send buffer if more from client can be read. */
   if(!data->req.upload_aborted &&
      !data->req.eos_read &&
-     !Curl_xfer_send_is_paused(data) &&
-     !Curl_bufq_is_full(&data->req.sendbuf)) {
-    size_t nread;
-    result = Curl_bufq_sipn(&data->req.sendbuf, 0,
-                            add_from_client, data, &nread);
-    if(result && result != CURLE_AGAIN)
+     !Curl_xfer_send_is_paused(data)) {
+    /* Try sending the client data in place. If the readers cannot do
+     * that, fill our send buffer if more from client can be read. */
+    result = req_send_client_direct(data);
+    if((result == CURLE_NOT_BUILT_IN) &&
+       !Curl_bufq_is_full(&data->req.sendbuf)) {
+      size_t nread;
+      result = Curl_bufq_sipn(&data->req.sendbuf, 0,
+                              add_from_client, data, &nread);
+    }
+    if(result && (result != CURLE_AGAIN) && (result != CURLE_NOT_BUILT_IN))
       return result;
   }
 
@@ -633,6 +633,28 @@ void Curl_creader_def_done(struct Curl_easy *data,
   (void)premature;
 }
 
+CURLcode Curl_creader_def_peek(struct Curl_easy *data,
+                               struct Curl_creader *reader,
+                               const char **pbuf, size_t *pblen, bool *peos)
+{
+  (void)data;
+  (void)reader;
+  *pbuf = NULL;
+  *pblen = 0;
+  *peos = FALSE;
+  return CURLE_NOT_BUILT_IN;
+}
+
+void Curl_creader_def_skip(struct Curl_easy *data,
+                           struct Curl_creader *reader, size_t nread)
+{
+  (void)data;
+  (void)reader;
+  /* the default peek never hands out bytes, nothing to skip */
+  DEBUGASSERT(!nread);
+  (void)nread;
+}
+
 struct cr_in_ctx {
   struct Curl_creader super;
   curl_read_callback read_cb;
@@ -934,6 +956,8 @@ static const struct Curl_crtype cr_in = {
   cr_in_cntrl,
   cr_in_is_paused,
   Curl_creader_def_done,
+  Curl_creader_def_peek,
+  Curl_creader_def_skip,
   sizeof(struct cr_in_ctx)
 };
 
@@ -1094,6 +1118,8 @@ static const struct Curl_crtype cr_lc = {
   Curl_creader_def_cntrl,
   Curl_creader_def_is_paused,
   Curl_creader_def_done,
+  Curl_creader_def_peek,
+  Curl_creader_def_skip,
   sizeof(struct cr_lc_ctx)
 };
 
@@ -1146,6 +1172,9 @@ CURLcode Curl_creader_set_fread(struct Curl_easy *data, curl_off_t len)
   struct Curl_creader *r;
   struct cr_in_ctx *ctx;
 
+  if(data->set.upload_iov)
+    return Curl_creader_set_iov(data, len);
+
   result = Curl_creader_create(&r, data, &cr_in, CURL_CR_CLIENT);
   if(result)
     goto out;
@@ -1220,6 +1249,35 @@ CURLcode Curl_client_read(struct Curl_easy *data, char *buf, size_t blen,
   return result;
 }
 
+CURLcode Curl_client_peek(struct Curl_easy *data, const char **pbuf,
+                          size_t *pblen, bool *peos)
+{
+  struct Curl_creader *reader;
+  CURLcode result;
+
+  if(!data->req.reader_stack) {
+    result = Curl_creader_set_fread(data, data->state.infilesize);
+    if(result)
+      return result;
+    DEBUGASSERT(data->req.reader_stack);
+  }
+
+  reader = data->req.reader_stack;
+  result = reader->crt->peek(data, reader, pbuf, pblen, peos);
+  CURL_TRC_READ(data, "client_peek() -> %d, len=%zu, eos=%d",
+                result, *pblen, *peos);
+  return result;
+}
+
+void Curl_client_skip(struct Curl_easy *data, size_t nread)
+{
+  struct Curl_creader *reader = data->req.reader_stack;
+
+  DEBUGASSERT(reader);
+  if(reader)
+    reader->crt->skip(data, reader, nread);
+}
+
 bool Curl_creader_needs_rewind(struct Curl_easy *data)
 {
   struct Curl_creader *reader = data->req.reader_stack;
@@ -1267,6 +1325,8 @@ static const struct Curl_crtype cr_null = {
   Curl_creader_def_cntrl,
   Curl_creader_def_is_paused,
   Curl_creader_def_done,
+  Curl_creader_def_peek,
+  Curl_creader_def_skip,
   sizeof(struct Curl_creader)
 };
 
@@ -1371,6 +1431,27 @@ static CURLcode cr_buf_resume_from(struct Curl_easy *data,
   return CURLE_OK;
 }
 
+static CURLcode cr_buf_peek(struct Curl_easy *data,
+                            struct Curl_creader *reader,
+                            const char **pbuf, size_t *pblen, bool *peos)
+{
+  struct cr_buf_ctx *ctx = reader->ctx;
+  (void)data;
+  *pbuf = ctx->buf ? (ctx->buf + ctx->index) : NULL;
+  *pblen = ctx->buf ? (ctx->blen - ctx->index) : 0;
+  *peos = TRUE;
+  return CURLE_OK;
+}
+
+static void cr_buf_skip(struct Curl_easy *data,
+                        struct Curl_creader *reader, size_t nread)
+{
+  struct cr_buf_ctx *ctx = reader->ctx;
+  (void)data;
+  DEBUGASSERT(nread <= ctx->blen - ctx->index);
+  ctx->index += nread;
+}
+
 static const struct Curl_crtype cr_buf = {
   "cr-buf",
   Curl_creader_def_init,
@@ -1382,6 +1463,8 @@ static const struct Curl_crtype cr_buf = {
   cr_buf_cntrl,
   Curl_creader_def_is_paused,
   Curl_creader_def_done,
+  cr_buf_peek,
+  cr_buf_skip,
   sizeof(struct cr_buf_ctx)
 };
 
@@ -1407,6 +1490,236 @@ out:
   return result;
 }
 
+/* Client reader for CURLOPT_UPLOAD_IOV. The buffers are owned by the
+ * application and are handed out in place via peek(). */
+struct cr_iov_ctx {
+  struct Curl_creader super;
+  const struct curl_iovec *iov; /* the current entry */
+  size_t offset;                /* bytes of the current entry consumed */
+  curl_off_t total_len;         /* bytes to send or -1 when unknown */
+  curl_off_t read_len;          /* bytes consumed */
+  curl_off_t resume_len;        /* bytes skipped at the start */
+  curl_off_t skip_len;          /* bytes still to skip before reading */
+};
+
+/* Move to the next entry that has data, skipping `skip_len` bytes */
+static void cr_iov_advance(struct cr_iov_ctx *ctx)
+{
+  while(ctx->iov->base) {
+    size_t remain = ctx->iov->len - ctx->offset;
+    if(remain > (size_t)ctx->skip_len) {
+      ctx->offset += (size_t)ctx->skip_len;
+      ctx->skip_len = 0;
+      return;
+    }
+    ctx->skip_len -= remain;
+    ++ctx->iov;
+    ctx->offset = 0;
+  }
+}
+
+static CURLcode cr_iov_peek(struct Curl_easy *data,
+                            struct Curl_creader *reader,
+                            const char **pbuf, size_t *pblen, bool *peos)
+{
+  struct cr_iov_ctx *ctx = reader->ctx;
+  curl_off_t remain = -1;
+  size_t blen = 0;
+
+  cr_iov_advance(ctx);
+  if(ctx->total_len >= 0)
+    remain = ctx->total_len - ctx->read_len;
+  *pbuf = NULL;
+  if(ctx->iov->base && remain) {
+    blen = ctx->iov->len - ctx->offset;
+    if((remain > 0) && (remain < (curl_off_t)blen))
+      blen = (size_t)remain;
+    *pbuf = (const char *)ctx->iov->base + ctx->offset;
+  }
+  else if(remain > 0) {
+    failf(data, "CURLOPT_UPLOAD_IOV EOF fail, "
+          "only %"FMT_OFF_T"/%"FMT_OFF_T " of needed bytes",
+          ctx->read_len, ctx->total_len);
+    *pblen = 0;
+    *peos = FALSE;
+    return CURLE_READ_ERROR;
+  }
+  *pblen = blen;
+  if(remain >= 0)
+    *peos = (remain == (curl_off_t)blen);
+  else {
+    /* last bytes when no other entry has data */
+    const struct curl_iovec *next = ctx->iov->base ? ctx->iov + 1 : ctx->iov;
+    while(next->base && !next->len)
+      ++next;
+    *peos = !next->base;
+  }
+  return CURLE_OK;
+}
+
+static void cr_iov_skip(struct Curl_easy *data,
+                        struct Curl_creader *reader, size_t nread)
+{
+  struct cr_iov_ctx *ctx = reader->ctx;
+  (void)data;
+  DEBUGASSERT(!nread || (ctx->iov->base &&
+                         (nread <= ctx->iov->len - ctx->offset)));
+  ctx->offset += nread;
+  ctx->read_len += nread;
+}
+
+static CURLcode cr_iov_read(struct Curl_easy *data,
+                            struct Curl_creader *reader,
+                            char *buf, size_t blen,
+                            size_t *pnread, bool *peos)
+{
+  size_t nread = 0;
+  CURLcode result = CURLE_OK;
+
+  *peos = FALSE;
+  while((nread < blen) && !*peos) {
+    const char *src;
+    size_t slen;
+
+    result = cr_iov_peek(data, reader, &src, &slen, peos);
+    if(result)
+      break;
+    if(slen > (blen - nread)) {
+      slen = blen - nread;
+      *peos = FALSE;
+    }
+    if(slen) {
+      memcpy(buf + nread, src, slen);
+      cr_iov_skip(data, reader, slen);
+      nread += slen;
+    }
+  }
+  *pnread = result ? 0 : nread;
+  CURL_TRC_READ(data, "cr_iov_read(len=%zu) -> %d, nread=%zu, eos=%d",
+                blen, result, *pnread, *peos);
+  return result;
+}
+
+static CURLcode cr_iov_init(struct Curl_easy *data,
+                            struct Curl_creader *reader)
+{
+  struct cr_iov_ctx *ctx = reader->ctx;
+  ctx->iov = data->set.upload_iov;
+  ctx->total_len = -1;
+  return CURLE_OK;
+}
+
+static bool cr_iov_needs_rewind(struct Curl_easy *data,
+                                struct Curl_creader *reader)
+{
+  struct cr_iov_ctx *ctx = reader->ctx;
+  (void)data;
+  return ctx->read_len > 0;
+}
+
+static CURLcode cr_iov_cntrl(struct Curl_easy *data,
+                             struct Curl_creader *reader,
+                             Curl_creader_cntrl opcode)
+{
+  struct cr_iov_ctx *ctx = reader->ctx;
+  switch(opcode) {
+  case CURL_CRCNTRL_REWIND:
+    ctx->iov = data->set.upload_iov;
+    ctx->offset = 0;
+    ctx->skip_len = ctx->resume_len;
+    ctx->read_len = 0;
+    break;
+  default:
+    break;
+  }
+  return CURLE_OK;
+}
+
+static curl_off_t cr_iov_total_length(struct Curl_easy *data,
+                                      struct Curl_creader *reader)
+{
+  struct cr_iov_ctx *ctx = reader->ctx;
+  (void)data;
+  return ctx->total_len;
+}
+
+static CURLcode cr_iov_resume_from(struct Curl_easy *data,
+                                   struct Curl_creader *reader,
+                                   curl_off_t offset)
+{
+  struct cr_iov_ctx *ctx = reader->ctx;
+
+  /* already started reading? */
+  if(ctx->read_len)
+    return CURLE_READ_ERROR;
+  if(offset <= 0)
+    return CURLE_OK;
+  if(offset > Curl_creader_iov_len(data->set.upload_iov) - ctx->resume_len) {
+    failf(data, "Could only read %" FMT_OFF_T " bytes from the input",
+          Curl_creader_iov_len(data->set.upload_iov) - ctx->resume_len);
+    return CURLE_READ_ERROR;
+  }
+
+  ctx->resume_len += offset;
+  ctx->skip_len += offset;
+  /* now, decrease the size of the read */
+  if(ctx->total_len > 0) {
+    ctx->total_len -= offset;
+    if(ctx->total_len <= 0) {
+      failf(data, "File already completely uploaded");
+      return CURLE_PARTIAL_FILE;
+    }
+  }
+  return CURLE_OK;
+}
+
+static const struct Curl_crtype cr_iov = {
+  "cr-iov",
+  cr_iov_init,
+  cr_iov_read,
+  Curl_creader_def_close,
+  cr_iov_needs_rewind,
+  cr_iov_total_length,
+  cr_iov_resume_from,
+  cr_iov_cntrl,
+  Curl_creader_def_is_paused,
+  Curl_creader_def_done,
+  cr_iov_peek,
+  cr_iov_skip,
+  sizeof(struct cr_iov_ctx)
+};
+
+curl_off_t Curl_creader_iov_len(const struct curl_iovec *iov)
+{
+  curl_off_t len = 0;
+  if(iov) {
+    for(; iov->base; ++iov)
+      len += (curl_off_t)iov->len;
+  }
+  return len;
+}
+
+CURLcode Curl_creader_set_iov(struct Curl_easy *data, curl_off_t len)
+{
+  CURLcode result;
+  struct Curl_creader *r;
+  struct cr_iov_ctx *ctx;
+
+  DEBUGASSERT(data->set.upload_iov);
+  result = Curl_creader_create(&r, data, &cr_iov, CURL_CR_CLIENT);
+  if(result)
+    goto out;
+  ctx = r->ctx;
+  ctx->total_len = len;
+
+  cl_reset_reader(data);
+  result = do_init_reader_stack(data, r);
+out:
+  CURL_TRC_READ(data, "add iov reader, len=%"FMT_OFF_T " -> %d",
+                len, result);
+  return result;
+}
+
 curl_off_t Curl_creader_total_length(struct Curl_easy *data)
 {
   struct Curl_creader *r = data->req.reader_stack;
@@ -226,6 +226,12 @@ struct Curl_crtype {
   bool (*is_paused)(struct Curl_easy *data, struct Curl_creader *reader);
   void (*done)(struct Curl_easy *data,
                struct Curl_creader *reader, int premature);
+  /* Get the next bytes in memory the reader owns, without copying. */
+  CURLcode (*peek)(struct Curl_easy *data, struct Curl_creader *reader,
+                   const char **pbuf, size_t *pblen, bool *peos);
+  /* Consume `nread` bytes of the memory returned by `peek()` */
+  void (*skip)(struct Curl_easy *data, struct Curl_creader *reader,
+               size_t nread);
   size_t creader_size;  /* sizeof() allocated struct Curl_creader */
 };
 
@@ -277,6 +283,11 @@ bool Curl_creader_def_is_paused(struct Curl_easy *data,
                                 struct Curl_creader *reader);
 void Curl_creader_def_done(struct Curl_easy *data,
                            struct Curl_creader *reader, int premature);
+CURLcode Curl_creader_def_peek(struct Curl_easy *data,
+                               struct Curl_creader *reader,
+                               const char **pbuf, size_t *pblen, bool *peos);
+void Curl_creader_def_skip(struct Curl_easy *data,
+                           struct Curl_creader *reader, size_t nread);
 
 /**
  * Convenience method for calling `reader->do_read()` that
@@ -333,6 +344,25 @@ CURLcode Curl_creader_set(struct Curl_easy *data, struct Curl_creader *r);
 CURLcode Curl_client_read(struct Curl_easy *data, char *buf, size_t blen,
                           size_t *nread, bool *eos) WARN_UNUSED_RESULT;
 
+/**
+ * Get the next bytes of client data in place, without copying them.
+ * This works when all installed readers pass the data through unchanged
+ * and the client reader keeps it in memory, e.g. CURLOPT_UPLOAD_IOV.
+ * The memory stays valid until the next client reader call.
+ * @param pbuf    on return, the start of the data
+ * @param pblen   on return, the number of bytes at `pbuf`, may be 0
+ * @param peos    on return, TRUE iff these are the last bytes
+ * @return CURLE_OK on success, CURLE_NOT_BUILT_IN when the installed
+ *         readers do not support this, or another error
+ */
+CURLcode Curl_client_peek(struct Curl_easy *data, const char **pbuf,
+                          size_t *pblen, bool *peos) WARN_UNUSED_RESULT;
+
+/**
+ * Consume `nread` bytes of client data, returned by `Curl_client_peek()`.
+ */
+void Curl_client_skip(struct Curl_easy *data, size_t nread);
+
 /**
  * TRUE iff client reader needs rewing before it can be used for
  * a retry request.
@@ -414,6 +444,17 @@ CURLcode Curl_creader_set_null(struct Curl_easy *data);
  */
 CURLcode Curl_creader_set_fread(struct Curl_easy *data, curl_off_t len);
 
+/**
+ * Set the client reader that reads from CURLOPT_UPLOAD_IOV (NOT COPIED).
+ * A negative `len` makes the total length unknown to the transfer.
+ */
+CURLcode Curl_creader_set_iov(struct Curl_easy *data, curl_off_t len);
+
+/**
+ * Total number of bytes in a CURLOPT_UPLOAD_IOV array.
+ */
+curl_off_t Curl_creader_iov_len(const struct curl_iovec *iov);
+
 /**
  * Set the client reader the reads from the supplied buf (NOT COPIED).
  */
@@ -428,7 +428,7 @@ static void set_ssl_options(struct ssl_config_data *ssl,
                             struct ssl_primary_config *config,
                             long arg)
 {
-  config->ssl_options = (unsigned char)(arg & 0xff);
+  config->ssl_options = (unsigned short)(arg & 0xffff);
   ssl->enable_beast = !!(arg & CURLSSLOPT_ALLOW_BEAST);
   ssl->no_revoke = !!(arg & CURLSSLOPT_NO_REVOKE);
   ssl->no_partialchain = !!(arg & CURLSSLOPT_NO_PARTIALCHAIN);
@@ -436,6 +436,8 @@ static void set_ssl_options(struct ssl_config_data *ssl,
   ssl->native_ca_store = !!(arg & CURLSSLOPT_NATIVE_CA);
   ssl->auto_client_cert = !!(arg & CURLSSLOPT_AUTO_CLIENT_CERT);
   ssl->earlydata = !!(arg & CURLSSLOPT_EARLYDATA);
+  ssl->earlydata_safe = !!(arg & CURLSSLOPT_EARLYDATA_SAFE);
+  ssl->ktls = !!(arg & CURLSSLOPT_KTLS);
 }
 #endif
 
@@ -816,6 +818,13 @@ static CURLcode setopt_bool(struct Curl_easy *data, CURLoption option,
     s->tcp_fastopen = enabled;
 #else
     return CURLE_NOT_BUILT_IN;
+#endif
+    break;
+  case CURLOPT_STREAM_INCREMENTAL:
+#if defined(USE_HTTP2) || defined(USE_HTTP3)
+    s->priority.incremental = enabled;
+#else
+    return CURLE_NOT_BUILT_IN;
 #endif
     break;
   case CURLOPT_SSL_ENABLE_ALPN:
@@ -878,6 +887,17 @@ static CURLcode setopt_long(struct Curl_easy *data, CURLoption option,
   case CURLOPT_DNS_CACHE_TIMEOUT:
     return setopt_set_timeout_sec(&s->dns_cache_timeout_ms, arg);
 
+  case CURLOPT_DNS_NEGATIVE_TIMEOUT:
+    return setopt_set_timeout_sec(&s->dns_negative_timeout_ms, arg);
+
+  case CURLOPT_DNS_STALE_TIMEOUT:
+#ifdef CURLRES_THREADED
+    return setopt_set_timeout_sec(&s->dns_stale_timeout_ms, arg);
+#else
+    /* there is no resolving in the background */
+    return CURLE_NOT_BUILT_IN;
+#endif
+
   case CURLOPT_CA_CACHE_TIMEOUT:
     if(Curl_ssl_supports(data, SSLSUPP_CA_CACHE)) {
       result = value_range(&arg, -1, -1, INT_MAX);
@@ -1226,6 +1246,25 @@ static CURLcode setopt_long(struct Curl_easy *data, CURLoption option,
     break;
 #else
     return CURLE_NOT_BUILT_IN;
+#endif
+  case CURLOPT_STREAM_URGENCY:
+#if defined(USE_HTTP2) || defined(USE_HTTP3)
+    if((arg < 0) || (arg > CURL_PRIO_URGENCY_MAX))
+      return CURLE_BAD_FUNCTION_ARGUMENT;
+    s->priority.urgency = (unsigned char)arg;
+    break;
+#else
+    return CURLE_NOT_BUILT_IN;
+#endif
+  case CURLOPT_HTTP2_WINDOW_MAX:
+#ifdef USE_NGHTTP2
+    /* HTTP/2 flow control windows are at most 2^31-1 bytes */
+    if(uarg > INT32_MAX)
+      return CURLE_BAD_FUNCTION_ARGUMENT;
+    s->h2_window_max = (int32_t)uarg;
+    break;
+#else
+    return CURLE_NOT_BUILT_IN;
 #endif
   case CURLOPT_HAPPY_EYEBALLS_TIMEOUT_MS:
     return setopt_set_timeout_ms(&s->happy_eyeballs_timeout, arg);
@@ -1506,6 +1545,13 @@ static CURLcode setopt_pointers(struct Curl_easy *data, CURLoption option,
   }
   break;
 
+  case CURLOPT_UPLOAD_IOV:
+    /*
+     * Upload data from these application owned buffers.
+     */
+    s->upload_iov = va_arg(param, const struct curl_iovec *);
+    break;
+
 #ifdef USE_HTTP2
   case CURLOPT_STREAM_DEPENDS:
   case CURLOPT_STREAM_DEPENDS_E: {
@@ -2539,6 +2585,10 @@ static CURLcode setopt_cptr(struct Curl_easy *data, CURLoption option,
       (void)Curl_altsvc_load(data->asi, ptr);
     break;
 #endif /* ! CURL_DISABLE_ALTSVC */
+  case CURLOPT_DNS_CACHE_FILE:
+    return Curl_setstropt(&s->str[STRING_DNS_CACHE_FILE], ptr);
+  case CURLOPT_CA_CACHE_FILE:
+    return Curl_setstropt(&s->str[STRING_SSL_CA_CACHE_FILE], ptr);
 #ifdef USE_ECH
   case CURLOPT_ECH: {
     size_t plen = 0;
@@ -2934,6 +2984,7 @@ CURLcode Curl_vsetopt(struct Curl_easy *data, CURLoption option, va_list param)
     case CURLOPT_SHARE:            /* CURLSH * */
     case CURLOPT_STREAM_DEPENDS:   /* CURL * */
     case CURLOPT_STREAM_DEPENDS_E: /* CURL * */
+    case CURLOPT_UPLOAD_IOV:       /* struct curl_iovec * */
       return setopt_pointers(data, option, param);
     default:
       break;
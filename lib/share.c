@@ -39,6 +39,16 @@
 #include "curl_memory.h"
 #include "memdebug.h"
 
+#ifdef USE_SSL
+/* share->proto_hash destructor. Elements MUST be added with their own
+ * destructor, see multi's ph_freeentry() */
+static void share_ph_freeentry(void *p)
+{
+  (void)p;
+  DEBUGASSERT(p == NULL);
+}
+#endif
+
 CURLSH *
 curl_share_init(void)
 {
@@ -47,6 +57,10 @@ curl_share_init(void)
     share->magic = CURL_GOOD_SHARE;
     share->specifier |= (1 << CURL_LOCK_DATA_SHARE);
     Curl_dnscache_init(&share->dnscache, 23);
+#ifdef USE_SSL
+    Curl_hash_init(&share->proto_hash, 23,
+                   Curl_hash_str, curlx_str_key_compare, share_ph_freeentry);
+#endif
     share->admin = curl_easy_init();
     if(!share->admin) {
       free(share);
@@ -73,6 +87,7 @@ curl_share_setopt(CURLSH *sh, CURLSHoption option, ...)
   curl_lock_function lockfunc;
   curl_unlock_function unlockfunc;
   void *ptr;
+  long lval;
   CURLSHcode res = CURLSHE_OK;
   struct Curl_share *share = sh;
 
@@ -148,6 +163,12 @@ curl_share_setopt(CURLSH *sh, CURLSHoption option, ...)
 #endif
       break;
 
+    case CURL_LOCK_DATA_CA:
+#ifndef USE_OPENSSL
+      res = CURLSHE_NOT_BUILT_IN;
+#endif
+      break;
+
     default:
       res = CURLSHE_BAD_OPTION;
     }
@@ -198,6 +219,14 @@ curl_share_setopt(CURLSH *sh, CURLSHoption option, ...)
     case CURL_LOCK_DATA_CONNECT:
       break;
 
+    case CURL_LOCK_DATA_CA:
+#ifdef USE_OPENSSL
+      Curl_hash_clean(&share->proto_hash);
+#else
+      res = CURLSHE_NOT_BUILT_IN;
+#endif
+      break;
+
     default:
       res = CURLSHE_BAD_OPTION;
       break;
@@ -219,6 +248,83 @@ curl_share_setopt(CURLSH *sh, CURLSHoption option, ...)
     share->clientdata = ptr;
     break;
 
+  case CURLSHOPT_DNS_SHARDS:
+    lval = va_arg(param, long);
+    if((lval < 0) || (lval > CURL_DNSCACHE_MAX_SHARDS))
+      res = CURLSHE_BAD_OPTION;
+    else {
+      switch(Curl_dnscache_set_shards(&share->dnscache, 23,
+                                      (unsigned int)lval)) {
+      case CURLE_OK:
+        break;
+      case CURLE_OUT_OF_MEMORY:
+        res = CURLSHE_NOMEM;
+        break;
+      case CURLE_NOT_BUILT_IN:
+        res = CURLSHE_NOT_BUILT_IN;
+        break;
+      default:
+        res = CURLSHE_BAD_OPTION;
+        break;
+      }
+    }
+    break;
+
+  case CURLSHOPT_CONNECT_SHARDS:
+    lval = va_arg(param, long);
+    if((lval < 0) || (lval > CURL_CPOOL_MAX_SHARDS))
+      res = CURLSHE_BAD_OPTION;
+    else {
+      if(!share->cpool.initialised)
+        Curl_cpool_init(&share->cpool, share->admin, share, 103);
+      switch(Curl_cpool_set_shards(&share->cpool, (unsigned int)lval)) {
+      case CURLE_OK:
+        break;
+      case CURLE_OUT_OF_MEMORY:
+        res = CURLSHE_NOMEM;
+        break;
+      case CURLE_NOT_BUILT_IN:
+        res = CURLSHE_NOT_BUILT_IN;
+        break;
+      default: /* the pool has connections */
+        res = CURLSHE_IN_USE;
+        break;
+      }
+    }
+    break;
+
+  case CURLSHOPT_SSL_SESSION_SHARDS:
+    lval = va_arg(param, long);
+#ifdef USE_SSL
+    if((lval < 0) || (lval > CURL_SCACHE_MAX_SHARDS))
+      res = CURLSHE_BAD_OPTION;
+    else {
+      if(!share->ssl_scache &&
+         Curl_ssl_scache_create(25, 2, &share->ssl_scache)) {
+        res = CURLSHE_NOMEM;
+        break;
+      }
+      switch(Curl_ssl_scache_set_shards(share->ssl_scache,
+                                        (unsigned int)lval)) {
+      case CURLE_OK:
+        break;
+      case CURLE_OUT_OF_MEMORY:
+        res = CURLSHE_NOMEM;
+        break;
+      case CURLE_NOT_BUILT_IN:
+        res = CURLSHE_NOT_BUILT_IN;
+        break;
+      default: /* the cache has sessions */
+        res = CURLSHE_IN_USE;
+        break;
+      }
+    }
+#else
+    (void)lval;
+    res = CURLSHE_NOT_BUILT_IN;
+#endif
+    break;
+
   default:
     res = CURLSHE_BAD_OPTION;
     break;
@@ -250,6 +356,7 @@ curl_share_cleanup(CURLSH *sh)
     Curl_cpool_destroy(&share->cpool);
   }
 
+  (void)Curl_dnscache_save(share->admin, &share->dnscache);
   Curl_dnscache_destroy(&share->dnscache);
 
 #if !defined(CURL_DISABLE_HTTP) && !defined(CURL_DISABLE_COOKIES)
@@ -265,6 +372,7 @@ curl_share_cleanup(CURLSH *sh)
     Curl_ssl_scache_destroy(share->ssl_scache);
     share->ssl_scache = NULL;
   }
+  Curl_hash_destroy(&share->proto_hash);
 #endif
 
   Curl_psl_destroy(&share->psl);
@@ -279,6 +387,80 @@ curl_share_cleanup(CURLSH *sh)
 }
 
 
+#if defined(USE_SSL) && defined(USE_SSLS_EXPORT)
+/* Get an easy handle that uses the share, to go through the same locking
+ * as the transfers using it. */
+static CURLcode share_ssls_handle(struct Curl_share *share,
+                                  struct Curl_easy **pdata)
+{
+  struct Curl_easy *data;
+  CURLcode result;
+
+  *pdata = NULL;
+  if(!GOOD_SHARE_HANDLE(share) || !share->ssl_scache)
+    return CURLE_BAD_FUNCTION_ARGUMENT;
+  data = curl_easy_init();
+  if(!data)
+    return CURLE_OUT_OF_MEMORY;
+  data->state.internal = TRUE;
+  result = curl_easy_setopt(data, CURLOPT_SHARE, (CURLSH *)share);
+  if(result) {
+    Curl_close(&data);
+    return result;
+  }
+  *pdata = data;
+  return CURLE_OK;
+}
+#endif
+
+CURLcode curl_share_ssls_export(CURLSH *sh, unsigned char **bufp,
+                                size_t *lenp)
+{
+#if defined(USE_SSL) && defined(USE_SSLS_EXPORT)
+  struct Curl_easy *data;
+  CURLcode result;
+
+  if(!bufp || !lenp)
+    return CURLE_BAD_FUNCTION_ARGUMENT;
+  *bufp = NULL;
+  *lenp = 0;
+  result = share_ssls_handle(sh, &data);
+  if(!result) {
+    result = Curl_ssl_scache_export_all(data, bufp, lenp);
+    Curl_close(&data);
+  }
+  return result;
+#else
+  (void)sh;
+  (void)bufp;
+  (void)lenp;
+  return CURLE_NOT_BUILT_IN;
+#endif
+}
+
+CURLcode curl_share_ssls_import(CURLSH *sh, const unsigned char *buf,
+                                size_t len)
+{
+#if defined(USE_SSL) && defined(USE_SSLS_EXPORT)
+  struct Curl_easy *data;
+  CURLcode result;
+
+  if(!buf)
+    return CURLE_BAD_FUNCTION_ARGUMENT;
+  result = share_ssls_handle(sh, &data);
+  if(!result) {
+    result = Curl_ssl_scache_import_all(data, buf, len);
+    Curl_close(&data);
+  }
+  return result;
+#else
+  (void)sh;
+  (void)buf;
+  (void)len;
+  return CURLE_NOT_BUILT_IN;
+#endif
+}
+
 CURLSHcode
 Curl_share_lock(struct Curl_easy *data, curl_lock_data type,
                 curl_lock_access accesstype)
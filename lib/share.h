@@ -63,6 +63,10 @@ struct Curl_share {
 #endif
 #ifdef USE_SSL
   struct Curl_ssl_scache *ssl_scache;
+  /* key-value store for TLS backends, like `proto_hash` of a multi handle,
+   * holding the parsed CA certificates when CURL_LOCK_DATA_CA is shared.
+   * Elements need to be added with their own destructor. */
+  struct Curl_hash proto_hash;
 #endif
 };
 
@@ -75,4 +79,9 @@ CURLSHcode Curl_share_unlock(struct Curl_easy *, curl_lock_data);
                                     (data->share->specifier &           \
                                      (1<<CURL_LOCK_DATA_SSL_SESSION)))
 
+/* convenience macro to check if this handle is using shared CA certs */
+#define CURL_SHARE_ssl_ca(data) (data->share &&                         \
+                                 (data->share->specifier &              \
+                                  (1<<CURL_LOCK_DATA_CA)))
+
 #endif /* HEADER_CURL_SHARE_H */
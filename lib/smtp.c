@@ -2072,6 +2072,8 @@ static const struct Curl_crtype cr_eob = {
   Curl_creader_def_cntrl,
   Curl_creader_def_is_paused,
   Curl_creader_def_done,
+  Curl_creader_def_peek,
+  Curl_creader_def_skip,
   sizeof(struct cr_eob_ctx)
 };
 
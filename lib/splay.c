@@ -24,6 +24,10 @@
 
 #include "curl_setup.h"
 
+/* the multi handle keeps its timers in the timer wheel, the splay tree is
+   only built for the unit tests using it as a reference */
+#ifdef UNITTESTS
+
 #include "curlx/timeval.h"
 #include "splay.h"
 
@@ -293,3 +297,5 @@ void *Curl_splayget(struct Curl_tree *node)
   DEBUGASSERT(node);
   return node->ptr;
 }
+
+#endif /* UNITTESTS */
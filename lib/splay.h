@@ -24,6 +24,9 @@
  *
  ***************************************************************************/
 #include "curl_setup.h"
+
+#ifdef UNITTESTS
+
 #include "curlx/timeval.h"
 
 /* only use function calls to access this struct */
@@ -55,4 +58,6 @@ int Curl_splayremove(struct Curl_tree *t,
 void Curl_splayset(struct Curl_tree *node, void *payload);
 void *Curl_splayget(struct Curl_tree *node);
 
+#endif /* UNITTESTS */
+
 #endif /* HEADER_CURL_SPLAY_H */
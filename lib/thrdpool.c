@@ -0,0 +1,244 @@
+/***************************************************************************
+ *                                  _   _ ____  _
+ *  Project                     ___| | | |  _ \| |
+ *                             / __| | | | |_) | |
+ *                            | (__| |_| |  _ <| |___
+ *                             \___|\___/|_| \_\_____|
+ *
+ * Copyright (C) Daniel Stenberg, <daniel@haxx.se>, et al.
+ *
+ * This software is licensed as described in the file COPYING, which
+ * you should have received as part of this distribution. The terms
+ * are also available at https://curl.se/docs/copyright.html.
+ *
+ * You may opt to use, copy, modify, merge, publish, distribute and/or sell
+ * copies of the Software, and permit persons to whom the Software is
+ * furnished to do so, under the terms of the COPYING file.
+ *
+ * This software is distributed on an "AS IS" basis, WITHOUT WARRANTY OF ANY
+ * KIND, either express or implied.
+ *
+ * SPDX-License-Identifier: curl
+ *
+ ***************************************************************************/
+
+#include "curl_setup.h"
+
+#include "thrdpool.h"
+
+#ifdef USE_THRDPOOL
+
+#include "llist.h"
+#include "curl_memory.h"
+/* The last #include FILE should be: */
+#include "memdebug.h"
+
+struct Curl_thrdpool {
+  curl_mutex_t mutx;
+  curl_cond_t cond;        /* signaled when a job is queued or on shutdown */
+  struct Curl_llist queue; /* jobs waiting for a worker */
+  struct Curl_llist workers; /* of struct thrdpool_worker */
+  Curl_thrdpool_run_cb *run;
+  Curl_thrdpool_drop_cb *drop;
+  Curl_thrdpool_free_cb *user_free;
+  void *user_data;
+  unsigned int idle;       /* number of workers waiting for a job */
+  unsigned int refcount;   /* the pool's owner and each detached worker */
+  BIT(shutdown);
+};
+
+struct thrdpool_worker {
+  struct Curl_llist_node node; /* in the pool's `workers` */
+  struct Curl_thrdpool *tpool;
+  curl_thread_t th;
+  BIT(busy);     /* running a job */
+  BIT(detached); /* left running on destroy, frees itself */
+};
+
+/* Drop a reference to the pool, free it when it was the last one.
+ * Called with the pool locked, returns with it released. */
+static void thrdpool_unref(struct Curl_thrdpool *tpool)
+{
+  bool last = !--tpool->refcount;
+
+  Curl_mutex_release(&tpool->mutx);
+  if(!last)
+    return;
+  DEBUGASSERT(!Curl_llist_count(&tpool->queue));
+  DEBUGASSERT(!Curl_llist_count(&tpool->workers));
+  if(tpool->user_free)
+    tpool->user_free(tpool->user_data);
+  Curl_cond_destroy(&tpool->cond);
+  Curl_mutex_destroy(&tpool->mutx);
+  free(tpool);
+}
+
+static CURL_THREAD_RETURN_T CURL_STDCALL thrdpool_worker(void *arg)
+{
+  struct thrdpool_worker *w = arg;
+  struct Curl_thrdpool *tpool = w->tpool;
+
+  Curl_mutex_acquire(&tpool->mutx);
+  while(!tpool->shutdown) {
+    struct Curl_llist_node *e = Curl_llist_head(&tpool->queue);
+    void *job;
+
+    if(!e) {
+      tpool->idle++;
+      Curl_cond_wait(&tpool->cond, &tpool->mutx);
+      tpool->idle--;
+      continue;
+    }
+    job = Curl_node_elem(e);
+    Curl_node_remove(e);
+    w->busy = TRUE;
+    Curl_mutex_release(&tpool->mutx);
+    tpool->run(tpool, job);
+    Curl_mutex_acquire(&tpool->mutx);
+    w->busy = FALSE;
+  }
+  if(w->detached) {
+    /* the pool's owner is gone, nobody joins this thread */
+    Curl_node_remove(&w->node);
+    free(w);
+    thrdpool_unref(tpool);
+  }
+  else
+    Curl_mutex_release(&tpool->mutx);
+  return 0;
+}
+
+struct Curl_thrdpool *Curl_thrdpool_create(Curl_thrdpool_run_cb *run,
+                                           Curl_thrdpool_drop_cb *drop,
+                                           Curl_thrdpool_free_cb *user_free,
+                                           void *user_data)
+{
+  struct Curl_thrdpool *tpool = calloc(1, sizeof(*tpool));
+
+  if(!tpool)
+    return NULL;
+  Curl_mutex_init(&tpool->mutx);
+  Curl_cond_init(&tpool->cond);
+  Curl_llist_init(&tpool->queue, NULL);
+  Curl_llist_init(&tpool->workers, NULL);
+  tpool->run = run;
+  tpool->drop = drop;
+  tpool->user_free = user_free;
+  tpool->user_data = user_data;
+  tpool->refcount = 1;
+  return tpool;
+}
+
+void Curl_thrdpool_destroy(struct Curl_thrdpool *tpool)
+{
+  struct Curl_llist idle;
+  struct Curl_llist_node *e, *n;
+
+  if(!tpool)
+    return;
+  Curl_llist_init(&idle, NULL);
+  Curl_mutex_acquire(&tpool->mutx);
+  tpool->shutdown = TRUE;
+  Curl_cond_broadcast(&tpool->cond);
+  /* Workers waiting for a job exit right away and are joined. Workers
+   * running a job may be blocked in it for long, they are detached and
+   * free themselves when done. */
+  for(e = Curl_llist_head(&tpool->workers); e; e = n) {
+    struct thrdpool_worker *w = Curl_node_elem(e);
+    n = Curl_node_next(e);
+    if(w->busy) {
+      w->detached = TRUE;
+      Curl_thread_destroy(&w->th);
+      tpool->refcount++;
+    }
+    else {
+      Curl_node_remove(e);
+      Curl_llist_append(&idle, w, &w->node);
+    }
+  }
+  Curl_mutex_release(&tpool->mutx);
+
+  for(e = Curl_llist_head(&idle); e; e = Curl_llist_head(&idle)) {
+    struct thrdpool_worker *w = Curl_node_elem(e);
+    Curl_node_remove(e);
+    Curl_thread_join(&w->th);
+    free(w);
+  }
+
+  /* no worker takes a job any more, drop the queued ones */
+  for(e = Curl_llist_head(&tpool->queue); e;
+      e = Curl_llist_head(&tpool->queue)) {
+    void *job = Curl_node_elem(e);
+    Curl_node_remove(e);
+    tpool->drop(tpool, job);
+  }
+
+  Curl_mutex_acquire(&tpool->mutx);
+  thrdpool_unref(tpool);
+}
+
+void *Curl_thrdpool_user_data(struct Curl_thrdpool *tpool)
+{
+  return tpool->user_data;
+}
+
+void Curl_thrdpool_lock(struct Curl_thrdpool *tpool)
+{
+  Curl_mutex_acquire(&tpool->mutx);
+}
+
+void Curl_thrdpool_unlock(struct Curl_thrdpool *tpool)
+{
+  Curl_mutex_release(&tpool->mutx);
+}
+
+/* Start another worker. Called with the pool locked. */
+static bool thrdpool_grow(struct Curl_thrdpool *tpool)
+{
+  struct thrdpool_worker *w = calloc(1, sizeof(*w));
+
+  if(!w)
+    return FALSE;
+  w->tpool = tpool;
+  w->th = Curl_thread_create(thrdpool_worker, w);
+  if(w->th == curl_thread_t_null) {
+    free(w);
+    return FALSE;
+  }
+  Curl_llist_append(&tpool->workers, w, &w->node);
+  return TRUE;
+}
+
+CURLcode Curl_thrdpool_add(struct Curl_thrdpool *tpool, void *job,
+                           struct Curl_llist_node *node,
+                           unsigned int max_threads, size_t max_queue)
+{
+  size_t queued = Curl_llist_count(&tpool->queue);
+  size_t nthreads = Curl_llist_count(&tpool->workers);
+
+  DEBUGASSERT(!tpool->shutdown);
+  /* idle workers take queued jobs first, start another worker when
+   * none is left for this one */
+  if((queued >= tpool->idle) && (nthreads < max_threads))
+    (void)thrdpool_grow(tpool);
+  else if(max_queue && (queued >= tpool->idle) &&
+          (queued - tpool->idle >= max_queue))
+    return CURLE_AGAIN;
+  if(!Curl_llist_count(&tpool->workers))
+    return CURLE_FAILED_INIT;
+  Curl_llist_append(&tpool->queue, job, node);
+  Curl_cond_signal(&tpool->cond);
+  return CURLE_OK;
+}
+
+size_t Curl_thrdpool_waiting(struct Curl_thrdpool *tpool)
+{
+  return Curl_llist_count(&tpool->queue);
+}
+
+unsigned int Curl_thrdpool_threads(struct Curl_thrdpool *tpool)
+{
+  return (unsigned int)Curl_llist_count(&tpool->workers);
+}
+
+#endif /* USE_THRDPOOL */
@@ -0,0 +1,87 @@
+#ifndef HEADER_CURL_THRDPOOL_H
+#define HEADER_CURL_THRDPOOL_H
+/***************************************************************************
+ *                                  _   _ ____  _
+ *  Project                     ___| | | |  _ \| |
+ *                             / __| | | | |_) | |
+ *                            | (__| |_| |  _ <| |___
+ *                             \___|\___/|_| \_\_____|
+ *
+ * Copyright (C) Daniel Stenberg, <daniel@haxx.se>, et al.
+ *
+ * This software is licensed as described in the file COPYING, which
+ * you should have received as part of this distribution. The terms
+ * are also available at https://curl.se/docs/copyright.html.
+ *
+ * You may opt to use, copy, modify, merge, publish, distribute and/or sell
+ * copies of the Software, and permit persons to whom the Software is
+ * furnished to do so, under the terms of the COPYING file.
+ *
+ * This software is distributed on an "AS IS" basis, WITHOUT WARRANTY OF ANY
+ * KIND, either express or implied.
+ *
+ * SPDX-License-Identifier: curl
+ *
+ ***************************************************************************/
+#include "curl_setup.h"
+#include <curl/curl.h>
+#include "curl_threads.h"
+
+#ifdef USE_THREADS_COND
+#define USE_THRDPOOL
+
+struct Curl_llist_node;
+
+/* A pool of worker threads taking jobs from a queue.
+ *
+ * Workers are started on demand, up to a maximum given when adding a job,
+ * and wait for more jobs when the queue is empty. Destroying the pool
+ * joins the workers waiting for a job. Workers busy with a job are not
+ * waited for, they are detached and finish their job first. The last one
+ * to exit frees the pool and its `user_data`.
+ */
+struct Curl_thrdpool;
+
+/* Run `job` in a worker. Called without the pool locked. */
+typedef void Curl_thrdpool_run_cb(struct Curl_thrdpool *tpool, void *job);
+/* Dispose of a `job` no worker took when the pool is destroyed. Called
+ * without the pool locked. */
+typedef void Curl_thrdpool_drop_cb(struct Curl_thrdpool *tpool, void *job);
+/* Free the `user_data` of the pool. */
+typedef void Curl_thrdpool_free_cb(void *user_data);
+
+/* Create a pool with no workers. Returns NULL when out of memory. */
+struct Curl_thrdpool *Curl_thrdpool_create(Curl_thrdpool_run_cb *run,
+                                           Curl_thrdpool_drop_cb *drop,
+                                           Curl_thrdpool_free_cb *user_free,
+                                           void *user_data);
+
+/* Tell the workers to exit, drop all queued jobs and release the pool.
+ * Does not wait for workers busy with a job, see above. */
+void Curl_thrdpool_destroy(struct Curl_thrdpool *tpool);
+
+/* The `user_data` given at creation. */
+void *Curl_thrdpool_user_data(struct Curl_thrdpool *tpool);
+
+/* Lock the pool. Users may protect their own members with it. */
+void Curl_thrdpool_lock(struct Curl_thrdpool *tpool);
+void Curl_thrdpool_unlock(struct Curl_thrdpool *tpool);
+
+/* Queue `job` at `node`. Starts another worker when no idle one is left
+ * for it and less than `max_threads` are running. With a non-zero
+ * `max_queue`, fails with CURLE_AGAIN when that many jobs are already
+ * waiting for a worker and no more workers may start. Fails with
+ * CURLE_FAILED_INIT when there is no worker to run the job.
+ * Called with the pool locked. */
+CURLcode Curl_thrdpool_add(struct Curl_thrdpool *tpool, void *job,
+                           struct Curl_llist_node *node,
+                           unsigned int max_threads, size_t max_queue);
+
+/* Number of jobs waiting for a worker. Called with the pool locked. */
+size_t Curl_thrdpool_waiting(struct Curl_thrdpool *tpool);
+/* Number of started workers. Called with the pool locked. */
+unsigned int Curl_thrdpool_threads(struct Curl_thrdpool *tpool);
+
+#endif /* USE_THREADS_COND */
+
+#endif /* HEADER_CURL_THRDPOOL_H */
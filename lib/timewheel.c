@@ -0,0 +1,362 @@
+/***************************************************************************
+ *                                  _   _ ____  _
+ *  Project                     ___| | | |  _ \| |
+ *                             / __| | | | |_) | |
+ *                            | (__| |_| |  _ <| |___
+ *                             \___|\___/|_| \_\_____|
+ *
+ * Copyright (C) Daniel Stenberg, <daniel@haxx.se>, et al.
+ *
+ * This software is licensed as described in the file COPYING, which
+ * you should have received as part of this distribution. The terms
+ * are also available at https://curl.se/docs/copyright.html.
+ *
+ * You may opt to use, copy, modify, merge, publish, distribute and/or sell
+ * copies of the Software, and permit persons to whom the Software is
+ * furnished to do so, under the terms of the COPYING file.
+ *
+ * This software is distributed on an "AS IS" basis, WITHOUT WARRANTY OF ANY
+ * KIND, either express or implied.
+ *
+ * SPDX-License-Identifier: curl
+ *
+ ***************************************************************************/
+
+#include "curl_setup.h"
+
+#include "curlx/timeval.h"
+#include "uint-bset.h"
+#include "timewheel.h"
+
+/* The last 3 #include files should be in this order */
+#include "curl_printf.h"
+#include "curl_memory.h"
+#include "memdebug.h"
+
+#define TWHEEL_MASK   ((timediff_t)TWHEEL_SLOTS - 1)
+/* number of ticks all levels together cover */
+#define TWHEEL_RANGE  ((timediff_t)1 << (TWHEEL_BITS * TWHEEL_LEVELS))
+
+#define LEVEL_SHIFT(l)  (TWHEEL_BITS * (l))
+#define LEVEL_TICKS(l)  ((timediff_t)1 << LEVEL_SHIFT(l))
+#define SLOT(w, l, s)   (&(w)->slots[((l) * TWHEEL_SLOTS) + (s)])
+
+static timediff_t twheel_tick(const struct Curl_twheel *w,
+                              struct curltime t)
+{
+  timediff_t us = curlx_timediff_us(t, w->origin);
+  return (us > 0) ? (us / 1000) : 0;
+}
+
+static struct curltime twheel_time(const struct Curl_twheel *w,
+                                   timediff_t tick)
+{
+  struct curltime t = w->origin;
+  t.tv_sec += (time_t)(tick / 1000);
+  t.tv_usec += (int)(tick % 1000) * 1000;
+  if(t.tv_usec >= 1000000) {
+    t.tv_sec++;
+    t.tv_usec -= 1000000;
+  }
+  return t;
+}
+
+static void twlist_append(struct Curl_twlist *list, struct Curl_twnode *node)
+{
+  node->list = list;
+  node->next = NULL;
+  node->prev = list->tail;
+  if(list->tail)
+    list->tail->next = node;
+  else
+    list->head = node;
+  list->tail = node;
+}
+
+static void twlist_unlink(struct Curl_twnode *node)
+{
+  struct Curl_twlist *list = node->list;
+  if(node->prev)
+    node->prev->next = node->next;
+  else
+    list->head = node->next;
+  if(node->next)
+    node->next->prev = node->prev;
+  else
+    list->tail = node->prev;
+  node->next = node->prev = NULL;
+  node->list = NULL;
+}
+
+/* Hash `node` into the slot for its tick, relative to the current one.
+ * Nodes of ticks already passed go directly to the expired list. */
+static void twheel_link(struct Curl_twheel *w, struct Curl_twnode *node)
+{
+  timediff_t tick = node->tick;
+  timediff_t delta;
+  unsigned int level = 0;
+  unsigned int slot;
+
+  if(tick < w->now_tick) {
+    twlist_append(&w->expired, node);
+    return;
+  }
+  delta = tick - w->now_tick;
+  if(delta >= TWHEEL_RANGE) {
+    /* park it at the far end of the top level, it is cascaded
+     * again when that slot is reached */
+    delta = TWHEEL_RANGE - 1;
+    tick = w->now_tick + delta;
+  }
+  while(delta >= LEVEL_TICKS(level + 1))
+    ++level;
+  slot = (unsigned int)((tick >> LEVEL_SHIFT(level)) & TWHEEL_MASK);
+  twlist_append(SLOT(w, level, slot), node);
+  w->occupied[level] |= ((curl_uint64_t)1 << slot);
+}
+
+static void twheel_unlink(struct Curl_twheel *w, struct Curl_twnode *node)
+{
+  struct Curl_twlist *list = node->list;
+
+  twlist_unlink(node);
+  if(list != &w->expired && !list->head) {
+    size_t idx = (size_t)(list - w->slots);
+    w->occupied[idx / TWHEEL_SLOTS] &=
+      ~((curl_uint64_t)1 << (idx % TWHEEL_SLOTS));
+  }
+}
+
+/* Get the first tick at or after `now_tick` where the wheel has something
+ * to do for `level`. That is when a level 0 slot expires or when a slot
+ * of a higher level needs cascading. Returns -1 if the level is empty. */
+static timediff_t twheel_level_next(struct Curl_twheel *w,
+                                    unsigned int level,
+                                    unsigned int *pslot)
+{
+  curl_uint64_t bits = w->occupied[level];
+  timediff_t base;
+  unsigned int r, k;
+
+  if(!bits)
+    return -1;
+  /* the first slot boundary not passed yet */
+  base = (w->now_tick + LEVEL_TICKS(level) - 1) >> LEVEL_SHIFT(level);
+  r = (unsigned int)(base & TWHEEL_MASK);
+  if(r)
+    bits = (bits >> r) | (bits << (TWHEEL_SLOTS - r));
+  k = CURL_CTZ64(bits);
+  *pslot = (r + k) & (TWHEEL_SLOTS - 1);
+  return (base + k) << LEVEL_SHIFT(level);
+}
+
+static timediff_t twheel_next_tick(struct Curl_twheel *w)
+{
+  timediff_t next = -1;
+  unsigned int level, slot;
+
+  for(level = 0; level < TWHEEL_LEVELS; ++level) {
+    timediff_t tick = twheel_level_next(w, level, &slot);
+    if((tick >= 0) && ((next < 0) || (tick < next)))
+      next = tick;
+  }
+  return next;
+}
+
+/* Move the nodes of all higher level slots that start at `tick` down,
+ * top level first. */
+static void twheel_cascade(struct Curl_twheel *w, timediff_t tick)
+{
+  unsigned int level;
+
+  DEBUGASSERT(tick == w->now_tick);
+  for(level = TWHEEL_LEVELS - 1; level > 0; --level) {
+    unsigned int slot;
+    struct Curl_twlist list;
+    struct Curl_twnode *node;
+
+    if(tick & (LEVEL_TICKS(level) - 1))
+      continue; /* not at a slot boundary of this level */
+    slot = (unsigned int)((tick >> LEVEL_SHIFT(level)) & TWHEEL_MASK);
+    if(!(w->occupied[level] & ((curl_uint64_t)1 << slot)))
+      continue;
+    list = *SLOT(w, level, slot);
+    SLOT(w, level, slot)->head = SLOT(w, level, slot)->tail = NULL;
+    w->occupied[level] &= ~((curl_uint64_t)1 << slot);
+    for(node = list.head; node;) {
+      struct Curl_twnode *next = node->next;
+      twheel_link(w, node);
+      node = next;
+    }
+  }
+}
+
+/* Advance the wheel to the tick of `now`. All nodes of ticks before
+ * that end up in the expired list. */
+static void twheel_advance(struct Curl_twheel *w, struct curltime now)
+{
+  timediff_t target = twheel_tick(w, now);
+
+  while(w->now_tick < target) {
+    timediff_t tick = twheel_next_tick(w);
+    unsigned int slot;
+    struct Curl_twlist *list;
+
+    if((tick < 0) || (tick >= target)) {
+      /* nothing happens in between, jump */
+      w->now_tick = target;
+      break;
+    }
+    w->now_tick = tick;
+    twheel_cascade(w, tick);
+    slot = (unsigned int)(tick & TWHEEL_MASK);
+    list = SLOT(w, 0, slot);
+    while(list->head) {
+      struct Curl_twnode *node = list->head;
+      DEBUGASSERT(node->tick == tick);
+      twlist_unlink(node);
+      twlist_append(&w->expired, node);
+    }
+    w->occupied[0] &= ~((curl_uint64_t)1 << slot);
+    w->now_tick = tick + 1;
+  }
+  /* bring down what starts in the current tick */
+  twheel_cascade(w, w->now_tick);
+}
+
+CURLcode Curl_twheel_init(struct Curl_twheel *w,
+                          const struct curltime *origin)
+{
+  memset(w, 0, sizeof(*w));
+  w->origin = *origin;
+  w->slots = calloc(TWHEEL_LEVELS * TWHEEL_SLOTS, sizeof(*w->slots));
+  if(!w->slots)
+    return CURLE_OUT_OF_MEMORY;
+  return CURLE_OK;
+}
+
+void Curl_twheel_destroy(struct Curl_twheel *w)
+{
+  Curl_safefree(w->slots);
+  w->count = 0;
+}
+
+void Curl_twheel_add(struct Curl_twheel *w, struct curltime key,
+                     struct Curl_twnode *node)
+{
+  DEBUGASSERT(!node->list);
+  node->key = key;
+  node->tick = twheel_tick(w, key);
+  twheel_link(w, node);
+  w->count++;
+}
+
+void Curl_twheel_remove(struct Curl_twheel *w, struct Curl_twnode *node)
+{
+  if(node->list) {
+    twheel_unlink(w, node);
+    DEBUGASSERT(w->count);
+    w->count--;
+  }
+}
+
+static struct Curl_twnode *twheel_pop_expired(struct Curl_twheel *w,
+                                              struct curltime now)
+{
+  struct Curl_twnode *node;
+
+  for(node = w->expired.head; node; node = node->next) {
+    if(curlx_timediff_us(node->key, now) <= 0) {
+      twlist_unlink(node);
+      w->count--;
+      return node;
+    }
+  }
+  return NULL;
+}
+
+struct Curl_twnode *Curl_twheel_getbest(struct Curl_twheel *w,
+                                        struct curltime now)
+{
+  struct Curl_twnode *node;
+  struct Curl_twlist *list;
+
+  if(!w->count)
+    return NULL;
+
+  twheel_advance(w, now);
+  node = twheel_pop_expired(w, now);
+  if(node)
+    return node;
+
+  /* the current tick has not passed, collect what is due already */
+  list = SLOT(w, 0, (unsigned int)(w->now_tick & TWHEEL_MASK));
+  for(node = list->head; node;) {
+    struct Curl_twnode *next = node->next;
+    if(curlx_timediff_us(node->key, now) <= 0) {
+      twheel_unlink(w, node);
+      twlist_append(&w->expired, node);
+    }
+    node = next;
+  }
+  return twheel_pop_expired(w, now);
+}
+
+struct Curl_twnode *Curl_twheel_next(struct Curl_twheel *w,
+                                     struct curltime *pwhen)
+{
+  struct Curl_twnode *best = NULL;
+  timediff_t best_tick = -1;
+  unsigned int level, slot;
+
+  if(w->expired.head) {
+    *pwhen = w->expired.head->key;
+    return w->expired.head;
+  }
+
+  for(level = 0; level < TWHEEL_LEVELS; ++level) {
+    timediff_t tick = twheel_level_next(w, level, &slot);
+    if(tick < 0)
+      continue;
+    if(!level) {
+      /* level 0 slots hold a single tick, find the exact time */
+      struct Curl_twnode *node;
+      best = SLOT(w, 0, slot)->head;
+      for(node = best->next; node; node = node->next) {
+        if(curlx_timediff_us(node->key, best->key) < 0)
+          best = node;
+      }
+      best_tick = tick;
+      *pwhen = best->key;
+    }
+    else if((best_tick < 0) || (tick <= best_tick)) {
+      /* cascading is due before, the slot start is the earliest time */
+      best = SLOT(w, level, slot)->head;
+      best_tick = tick;
+      *pwhen = twheel_time(w, tick);
+    }
+  }
+  return best;
+}
+
+size_t Curl_twheel_count(struct Curl_twheel *w)
+{
+  return w->count;
+}
+
+bool Curl_twheel_contains(struct Curl_twnode *node)
+{
+  return node->list != NULL;
+}
+
+void Curl_twheel_set(struct Curl_twnode *node, void *payload)
+{
+  DEBUGASSERT(node);
+  node->ptr = payload;
+}
+
+void *Curl_twheel_get(struct Curl_twnode *node)
+{
+  DEBUGASSERT(node);
+  return node->ptr;
+}
@@ -0,0 +1,110 @@
+#ifndef HEADER_CURL_TIMEWHEEL_H
+#define HEADER_CURL_TIMEWHEEL_H
+/***************************************************************************
+ *                                  _   _ ____  _
+ *  Project                     ___| | | |  _ \| |
+ *                             / __| | | | |_) | |
+ *                            | (__| |_| |  _ <| |___
+ *                             \___|\___/|_| \_\_____|
+ *
+ * Copyright (C) Daniel Stenberg, <daniel@haxx.se>, et al.
+ *
+ * This software is licensed as described in the file COPYING, which
+ * you should have received as part of this distribution. The terms
+ * are also available at https://curl.se/docs/copyright.html.
+ *
+ * You may opt to use, copy, modify, merge, publish, distribute and/or sell
+ * copies of the Software, and permit persons to whom the Software is
+ * furnished to do so, under the terms of the COPYING file.
+ *
+ * This software is distributed on an "AS IS" basis, WITHOUT WARRANTY OF ANY
+ * KIND, either express or implied.
+ *
+ * SPDX-License-Identifier: curl
+ *
+ ***************************************************************************/
+#include "curl_setup.h"
+#include "curlx/timeval.h"
+
+/* A hashed hierarchical timer wheel.
+ *
+ * Nodes are hashed by their expire time, in millisecond ticks, into one
+ * of TWHEEL_SLOTS slots on TWHEEL_LEVELS levels. Each level covers
+ * TWHEEL_SLOTS times the range of the level below it. Nodes in a higher
+ * level slot are moved down ("cascaded") when the wheel reaches that
+ * slot. Adding and removing a node is O(1), no matter how many nodes
+ * are in the wheel.
+ *
+ * Expire times further out than the range of all levels are parked in
+ * the top level and cascaded again until they are in reach.
+ *
+ * Nodes are returned in the order of their expire tick, nodes expiring
+ * in the same millisecond are returned in no particular order.
+ */
+#define TWHEEL_BITS   6
+#define TWHEEL_SLOTS  (1 << TWHEEL_BITS)
+#define TWHEEL_LEVELS 5
+
+struct Curl_twlist {
+  struct Curl_twnode *head;
+  struct Curl_twnode *tail;
+};
+
+/* only use function calls to access this struct */
+struct Curl_twnode {
+  struct Curl_twnode *next;
+  struct Curl_twnode *prev;
+  struct Curl_twlist *list;  /* the list the node is in or NULL */
+  struct curltime key;       /* the expire time */
+  timediff_t tick;           /* the expire time in wheel ticks */
+  void *ptr;                 /* data the wheel code does not care about */
+};
+
+struct Curl_twheel {
+  struct Curl_twlist *slots;  /* TWHEEL_SLOTS per level, level 0 first */
+  curl_uint64_t occupied[TWHEEL_LEVELS]; /* bit per non-empty slot */
+  struct Curl_twlist expired; /* nodes of all ticks already passed */
+  struct curltime origin;     /* the time of tick 0 */
+  timediff_t now_tick;        /* the tick not yet passed */
+  size_t count;               /* number of nodes in the wheel */
+};
+
+/* Initialize the wheel, starting at time `origin`. */
+CURLcode Curl_twheel_init(struct Curl_twheel *w,
+                          const struct curltime *origin);
+
+/* Destroy the wheel, freeing all resources. Nodes still in it are
+ * forgotten. */
+void Curl_twheel_destroy(struct Curl_twheel *w);
+
+/* Add `node` to the wheel, expiring at `key`. The node must not be
+ * part of a wheel already. */
+void Curl_twheel_add(struct Curl_twheel *w, struct curltime key,
+                     struct Curl_twnode *node);
+
+/* Remove `node` from the wheel. Does nothing if the node is not in it. */
+void Curl_twheel_remove(struct Curl_twheel *w, struct Curl_twnode *node);
+
+/* Remove and return a node that expires at or before `now`.
+ * Returns NULL when there is none. */
+struct Curl_twnode *Curl_twheel_getbest(struct Curl_twheel *w,
+                                        struct curltime now);
+
+/* Get the earliest time the wheel needs attention. This is never later
+ * than the expire time of any node in the wheel and is exact when a node
+ * is about to expire. Returns the node the time applies to or NULL when
+ * the wheel is empty. */
+struct Curl_twnode *Curl_twheel_next(struct Curl_twheel *w,
+                                     struct curltime *pwhen);
+
+/* Number of nodes in the wheel */
+size_t Curl_twheel_count(struct Curl_twheel *w);
+
+/* TRUE if the node is part of a wheel */
+bool Curl_twheel_contains(struct Curl_twnode *node);
+
+/* set and get the custom payload for this node */
+void Curl_twheel_set(struct Curl_twnode *node, void *payload);
+void *Curl_twheel_get(struct Curl_twnode *node);
+
+#endif /* HEADER_CURL_TIMEWHEEL_H */
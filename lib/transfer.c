@@ -556,6 +556,9 @@ CURLcode Curl_pretransfer(struct Curl_easy *data)
   }
   else
     data->state.infilesize = 0;
+  if(data->set.upload_iov && (data->state.infilesize == -1) &&
+     !data->set.postfields)
+    data->state.infilesize = Curl_creader_iov_len(data->set.upload_iov);
 
   /* If there is a list of cookie files to read, do it now! */
   Curl_cookie_loadfiles(data);
@@ -567,6 +570,10 @@ CURLcode Curl_pretransfer(struct Curl_easy *data)
   /* If there is a list of hsts files to read */
   Curl_hsts_loadfiles(data);
 
+  /* If there is a DNS cache file to read */
+  if(!result)
+    result = Curl_dnscache_loadfile(data);
+
   if(!result) {
     /* Allow data->set.use_port to set which port to use. This needs to be
      * disabled for example when we follow Location: headers to URLs using
@@ -890,6 +897,29 @@ CURLcode Curl_xfer_send(struct Curl_easy *data,
   return result;
 }
 
+CURLcode Curl_xfer_sendv(struct Curl_easy *data,
+                         const struct curl_iovec *iov, size_t iovcnt,
+                         bool eos, size_t *pnwritten)
+{
+  CURLcode result;
+
+  DEBUGASSERT(data);
+  DEBUGASSERT(data->conn);
+
+  result = Curl_conn_sendv(data, data->conn->send_idx,
+                           iov, iovcnt, eos, pnwritten);
+  if(result == CURLE_AGAIN) {
+    result = CURLE_OK;
+    *pnwritten = 0;
+  }
+  else if(!result && *pnwritten)
+    data->info.request_size += *pnwritten;
+
+  DEBUGF(infof(data, "Curl_xfer_sendv(bufs=%zu, eos=%d) -> %d, %zu",
+               iovcnt, eos, result, *pnwritten));
+  return result;
+}
+
 CURLcode Curl_xfer_recv(struct Curl_easy *data,
                         char *buf, size_t blen,
                         size_t *pnrcvd)
@@ -118,6 +118,14 @@ CURLcode Curl_xfer_send(struct Curl_easy *data,
                         const void *buf, size_t blen, bool eos,
                         size_t *pnwritten);
 
+/**
+ * Send the buffers in `iov`, in order, like `Curl_xfer_send()`.
+ * Connections that can, send them in a single system call.
+ */
+CURLcode Curl_xfer_sendv(struct Curl_easy *data,
+                         const struct curl_iovec *iov, size_t iovcnt,
+                         bool eos, size_t *pnwritten);
+
 /**
  * Receive data on the socket/connection filter designated
  * for transfer's incoming data.
@@ -0,0 +1,504 @@
+/***************************************************************************
+ *                                  _   _ ____  _
+ *  Project                     ___| | | |  _ \| |
+ *                             / __| | | | |_) | |
+ *                            | (__| |_| |  _ <| |___
+ *                             \___|\___/|_| \_\_____|
+ *
+ * Copyright (C) Daniel Stenberg, <daniel@haxx.se>, et al.
+ *
+ * This software is licensed as described in the file COPYING, which
+ * you should have received as part of this distribution. The terms
+ * are also available at https://curl.se/docs/copyright.html.
+ *
+ * You may opt to use, copy, modify, merge, publish, distribute and/or sell
+ * copies of the Software, and permit persons to whom the Software is
+ * furnished to do so, under the terms of the COPYING file.
+ *
+ * This software is distributed on an "AS IS" basis, WITHOUT WARRANTY OF ANY
+ * KIND, either express or implied.
+ *
+ * SPDX-License-Identifier: curl
+ *
+ ***************************************************************************/
+
+#include "curl_setup.h"
+
+#include "uring.h"
+
+#ifdef USE_IO_URING
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+#include "uint-bset.h"
+#include "curl_memory.h"
+/* The last #include FILE should be: */
+#include "memdebug.h"
+
+/* We talk to the kernel directly, the ring is simple enough to not
+ * need liburing. Head and tail indexes are shared with the kernel
+ * and need ordered access. */
+#define URING_LOAD(p)     __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define URING_STORE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+
+/* The pool of buffers the kernel receives into. A buffer is only taken
+ * by a receive that gets data, sockets without data take none. When the
+ * pool runs dry, receives fail with ENOBUFS and their owners receive
+ * directly. */
+#define URING_NBUFS       64
+#define URING_BUF_SIZE    (16 * 1024)
+#define URING_BGID        1
+
+/* user_data of entries giving a buffer to the kernel, receives have their
+ * slot index */
+#define URING_UD_PROVIDE  ((__u64)1 << 32)
+
+/* times a busy kernel is asked again before giving up */
+#define URING_MAX_RETRY   3
+
+struct Curl_uring {
+  int fd;
+  void *sq_ring;                 /* mmapped submission ring */
+  size_t sq_ring_len;
+  void *cq_ring;                 /* mmapped completion ring, may be sq_ring */
+  size_t cq_ring_len;
+  struct io_uring_sqe *sqes;     /* mmapped submission entries */
+  size_t sqes_len;
+  unsigned int *sq_head;
+  unsigned int *sq_tail;
+  unsigned int *sq_array;
+  unsigned int sq_mask;
+  unsigned int sq_entries;
+  unsigned int *cq_head;
+  unsigned int *cq_tail;
+  unsigned int cq_mask;
+  struct io_uring_cqe *cqes;
+  char *pool;                    /* URING_NBUFS buffers */
+  struct Curl_uring_recv *holder[URING_NBUFS]; /* receive having a buffer */
+  unsigned int provide[URING_NBUFS]; /* buffers to give to the kernel */
+  unsigned int nprovide;
+  struct Curl_uring_recv **slots; /* queued receives, by slot */
+  unsigned int *free_slots;
+  unsigned int nfree_slots;
+  struct uint_bset ready;        /* sockets seen readable */
+  unsigned int nqueued;          /* entries queued, not submitted */
+  unsigned int ninflight;        /* entries submitted, not completed */
+  BIT(provide_failed);           /* kernel did not take a buffer */
+  BIT(broken);                   /* entries stuck in flight, do not use */
+};
+
+static bool uring_can_recv(int fd)
+{
+  struct io_uring_probe *probe;
+  size_t len = sizeof(*probe) + 256 * sizeof(struct io_uring_probe_op);
+  bool ok = FALSE;
+
+  probe = calloc(1, len);
+  if(!probe)
+    return FALSE;
+  if(!syscall(__NR_io_uring_register, fd, IORING_REGISTER_PROBE, probe, 256))
+    ok = (probe->last_op >= IORING_OP_RECV) &&
+         (probe->last_op >= IORING_OP_PROVIDE_BUFFERS) &&
+         (probe->ops[IORING_OP_RECV].flags & IO_URING_OP_SUPPORTED) &&
+         (probe->ops[IORING_OP_PROVIDE_BUFFERS].flags &
+          IO_URING_OP_SUPPORTED);
+  free(probe);
+  return ok;
+}
+
+static struct io_uring_sqe *uring_sqe(struct Curl_uring *ring, __u64 ud)
+{
+  /* we are the only one moving the tail */
+  unsigned int tail = *ring->sq_tail;
+  unsigned int idx = tail & ring->sq_mask;
+  struct io_uring_sqe *sqe = &ring->sqes[idx];
+
+  DEBUGASSERT(ring->nqueued < ring->sq_entries);
+  memset(sqe, 0, sizeof(*sqe));
+  sqe->user_data = ud;
+  ring->sq_array[idx] = idx;
+  URING_STORE(ring->sq_tail, tail + 1);
+  ring->nqueued++;
+  return sqe;
+}
+
+/* Queue giving `n` buffers starting at `bid` to the kernel. */
+static void uring_provide(struct Curl_uring *ring, unsigned int bid,
+                          unsigned int n)
+{
+  struct io_uring_sqe *sqe = uring_sqe(ring, URING_UD_PROVIDE | bid);
+
+  sqe->opcode = IORING_OP_PROVIDE_BUFFERS;
+  sqe->fd = (int)n;
+  sqe->addr = (__u64)(uintptr_t)(ring->pool + (size_t)bid * URING_BUF_SIZE);
+  sqe->len = URING_BUF_SIZE;
+  sqe->off = bid;
+  sqe->buf_group = URING_BGID;
+}
+
+/* Queue the buffers handed back, leaving room for `room` receives. */
+static void uring_provide_back(struct Curl_uring *ring, unsigned int room)
+{
+  while(ring->nprovide && (ring->nqueued + room < ring->sq_entries))
+    uring_provide(ring, ring->provide[--ring->nprovide], 1);
+}
+
+static void uring_give_back(struct Curl_uring *ring, unsigned int bid)
+{
+  DEBUGASSERT(ring->nprovide < URING_NBUFS);
+  ring->holder[bid] = NULL;
+  ring->provide[ring->nprovide++] = bid;
+}
+
+static void uring_reap(struct Curl_uring *ring)
+{
+  unsigned int head = *ring->cq_head;
+  unsigned int tail = URING_LOAD(ring->cq_tail);
+
+  while(head != tail) {
+    struct io_uring_cqe *cqe = &ring->cqes[head & ring->cq_mask];
+    bool has_buf = (cqe->flags & IORING_CQE_F_BUFFER) ? TRUE : FALSE;
+    unsigned int bid = cqe->flags >> IORING_CQE_BUFFER_SHIFT;
+
+    DEBUGASSERT(ring->ninflight);
+    ring->ninflight--;
+    head++;
+    if(cqe->user_data & URING_UD_PROVIDE) {
+      if(cqe->res < 0)
+        ring->provide_failed = TRUE;
+    }
+    else {
+      unsigned int slot = (unsigned int)cqe->user_data;
+      struct Curl_uring_recv *op = ring->slots[slot];
+
+      ring->slots[slot] = NULL;
+      ring->free_slots[ring->nfree_slots++] = slot;
+      if(has_buf && (!op || (cqe->res <= 0)))
+        uring_give_back(ring, bid);
+      if(!op)
+        continue; /* its owner is gone */
+      op->queued = FALSE;
+      if(cqe->res == -ENOBUFS)
+        continue; /* no buffer left, not done, its owner receives */
+      op->res = cqe->res;
+      op->offset = 0;
+      op->done = TRUE;
+      if(has_buf && (cqe->res > 0)) {
+        op->buf = ring->pool + (size_t)bid * URING_BUF_SIZE;
+        op->len = URING_BUF_SIZE;
+        op->id = bid;
+        ring->holder[bid] = op;
+      }
+    }
+  }
+  URING_STORE(ring->cq_head, head);
+}
+
+static CURLcode uring_run(struct Curl_uring *ring);
+
+CURLcode Curl_uring_create(struct Curl_uring **pring, unsigned int entries)
+{
+  struct Curl_uring *ring;
+  struct io_uring_params p;
+  char *sq, *cq;
+  unsigned int i;
+
+  *pring = NULL;
+  ring = calloc(1, sizeof(*ring));
+  if(!ring)
+    return CURLE_OUT_OF_MEMORY;
+  Curl_uint_bset_init(&ring->ready);
+
+  memset(&p, 0, sizeof(p));
+  ring->fd = (int)syscall(__NR_io_uring_setup, entries, &p);
+  if(ring->fd < 0 || !uring_can_recv(ring->fd))
+    goto fail;
+
+  ring->sq_ring_len = p.sq_off.array + p.sq_entries * sizeof(unsigned int);
+  ring->cq_ring_len = p.cq_off.cqes +
+                      p.cq_entries * sizeof(struct io_uring_cqe);
+  if((p.features & IORING_FEAT_SINGLE_MMAP) &&
+     (ring->cq_ring_len > ring->sq_ring_len))
+    ring->sq_ring_len = ring->cq_ring_len;
+
+  ring->sq_ring = mmap(NULL, ring->sq_ring_len, PROT_READ|PROT_WRITE,
+                       MAP_SHARED|MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+  if(ring->sq_ring == MAP_FAILED) {
+    ring->sq_ring = NULL;
+    goto fail;
+  }
+  if(p.features & IORING_FEAT_SINGLE_MMAP)
+    ring->cq_ring = ring->sq_ring;
+  else {
+    ring->cq_ring = mmap(NULL, ring->cq_ring_len, PROT_READ|PROT_WRITE,
+                         MAP_SHARED|MAP_POPULATE, ring->fd,
+                         IORING_OFF_CQ_RING);
+    if(ring->cq_ring == MAP_FAILED) {
+      ring->cq_ring = NULL;
+      goto fail;
+    }
+  }
+  ring->sqes_len = p.sq_entries * sizeof(struct io_uring_sqe);
+  ring->sqes = mmap(NULL, ring->sqes_len, PROT_READ|PROT_WRITE,
+                    MAP_SHARED|MAP_POPULATE, ring->fd, IORING_OFF_SQES);
+  if(ring->sqes == MAP_FAILED) {
+    ring->sqes = NULL;
+    goto fail;
+  }
+
+  sq = ring->sq_ring;
+  ring->sq_head = (unsigned int *)(void *)(sq + p.sq_off.head);
+  ring->sq_tail = (unsigned int *)(void *)(sq + p.sq_off.tail);
+  ring->sq_array = (unsigned int *)(void *)(sq + p.sq_off.array);
+  ring->sq_mask = *(unsigned int *)(void *)(sq + p.sq_off.ring_mask);
+  ring->sq_entries = p.sq_entries;
+  cq = ring->cq_ring;
+  ring->cq_head = (unsigned int *)(void *)(cq + p.cq_off.head);
+  ring->cq_tail = (unsigned int *)(void *)(cq + p.cq_off.tail);
+  ring->cq_mask = *(unsigned int *)(void *)(cq + p.cq_off.ring_mask);
+  ring->cqes = (struct io_uring_cqe *)(void *)(cq + p.cq_off.cqes);
+
+  ring->slots = calloc(ring->sq_entries, sizeof(*ring->slots));
+  ring->free_slots = malloc(ring->sq_entries * sizeof(*ring->free_slots));
+  ring->pool = malloc((size_t)URING_NBUFS * URING_BUF_SIZE);
+  if(!ring->slots || !ring->free_slots || !ring->pool)
+    goto fail;
+  for(i = 0; i < ring->sq_entries; i++)
+    ring->free_slots[i] = ring->sq_entries - i - 1;
+  ring->nfree_slots = ring->sq_entries;
+
+  /* give the whole pool to the kernel */
+  uring_provide(ring, 0, URING_NBUFS);
+  if(uring_run(ring) || ring->provide_failed)
+    goto fail;
+
+  *pring = ring;
+  return CURLE_OK;
+
+fail:
+  Curl_uring_destroy(ring);
+  return CURLE_FAILED_INIT;
+}
+
+/* The ring goes away, have `op` keep the data it did not hand out. */
+static void uring_recv_detach(struct Curl_uring_recv *op)
+{
+  size_t len = (size_t)op->res - op->offset;
+  char *copy = len ? malloc(len) : NULL;
+
+  if(len && !copy) {
+    op->res = -SOCKENOMEM;
+    op->buf = NULL;
+  }
+  else {
+    if(len)
+      memcpy(copy, op->buf + op->offset, len);
+    op->buf = copy;
+    op->own_buf = TRUE;
+    op->res = (int)len;
+    op->offset = 0;
+  }
+  op->ring = NULL;
+}
+
+void Curl_uring_destroy(struct Curl_uring *ring)
+{
+  unsigned int i;
+
+  if(!ring)
+    return;
+  for(i = 0; i < URING_NBUFS; i++) {
+    if(ring->holder[i])
+      uring_recv_detach(ring->holder[i]);
+  }
+  if(ring->sqes)
+    munmap(ring->sqes, ring->sqes_len);
+  if(ring->cq_ring && (ring->cq_ring != ring->sq_ring))
+    munmap(ring->cq_ring, ring->cq_ring_len);
+  if(ring->sq_ring)
+    munmap(ring->sq_ring, ring->sq_ring_len);
+  if(ring->fd >= 0)
+    close(ring->fd);
+  /* With receives stuck in flight, the kernel may still write into the
+   * pool after the close. Rather leak it than have it written to after
+   * being freed. */
+  if(!ring->ninflight)
+    free(ring->pool);
+  free(ring->slots);
+  free(ring->free_slots);
+  Curl_uint_bset_destroy(&ring->ready);
+  free(ring);
+}
+
+CURLcode Curl_uring_recv(struct Curl_uring *ring, curl_socket_t sock,
+                         struct Curl_uring_recv *op)
+{
+  struct io_uring_sqe *sqe;
+  unsigned int slot;
+
+  DEBUGASSERT(!op->queued && !op->done);
+  if(!ring->nfree_slots || (ring->nqueued >= ring->sq_entries)) {
+    CURLcode result = uring_run(ring);
+    if(result)
+      return result;
+  }
+  if(ring->broken || !ring->nfree_slots)
+    return CURLE_RECV_ERROR;
+
+  /* buffers handed back since the last run go first */
+  uring_provide_back(ring, 1);
+  slot = ring->free_slots[--ring->nfree_slots];
+  ring->slots[slot] = op;
+  sqe = uring_sqe(ring, slot);
+  sqe->opcode = IORING_OP_RECV;
+  sqe->fd = (int)sock;
+  sqe->len = URING_BUF_SIZE;
+  /* complete with -EAGAIN on a drained socket instead of waiting */
+  sqe->msg_flags = MSG_DONTWAIT;
+  sqe->flags = IOSQE_BUFFER_SELECT;
+  sqe->buf_group = URING_BGID;
+
+  op->ring = ring;
+  op->id = slot;
+  op->buf = NULL;
+  op->offset = 0;
+  op->res = 0;
+  op->queued = TRUE;
+  op->done = FALSE;
+  return CURLE_OK;
+}
+
+static CURLcode uring_run(struct Curl_uring *ring)
+{
+  CURLcode result = CURLE_OK;
+  int retries = 0;
+
+  if(ring->broken)
+    return CURLE_RECV_ERROR;
+  while(ring->nqueued || ring->ninflight) {
+    unsigned int flags = 0;
+    unsigned int min_complete = 0;
+    int rc;
+
+    if(!ring->nqueued) {
+      /* all submitted, some did not complete right away */
+      flags = IORING_ENTER_GETEVENTS;
+      min_complete = ring->ninflight;
+    }
+    rc = (int)syscall(__NR_io_uring_enter, ring->fd, ring->nqueued,
+                      min_complete, flags, NULL, 0);
+    if(rc < 0) {
+      int err = SOCKERRNO;
+      if(err == SOCKEINTR)
+        continue;
+      if(((err == EAGAIN) || (err == EBUSY)) &&
+         (++retries <= URING_MAX_RETRY)) {
+        /* out of resources or completions to reap, make room */
+        uring_reap(ring);
+        continue;
+      }
+      break;
+    }
+    if((unsigned int)rc > ring->nqueued)
+      break;
+    retries = 0;
+    ring->nqueued -= (unsigned int)rc;
+    ring->ninflight += (unsigned int)rc;
+    uring_reap(ring);
+    if(!rc && ring->nqueued)
+      break; /* the kernel takes no more */
+  }
+
+  if(ring->nqueued) {
+    /* Take back what the kernel did not submit. Those receives are not
+     * queued any more and never done, their owners receive directly. */
+    unsigned int head = URING_LOAD(ring->sq_head);
+    unsigned int tail = *ring->sq_tail;
+
+    for(; head != tail; head++) {
+      struct io_uring_sqe *sqe =
+        &ring->sqes[ring->sq_array[head & ring->sq_mask]];
+      if(sqe->user_data & URING_UD_PROVIDE) {
+        unsigned int bid = (unsigned int)sqe->user_data;
+        unsigned int n = (unsigned int)sqe->fd;
+        while(n--)
+          ring->provide[ring->nprovide++] = bid++;
+      }
+      else {
+        unsigned int slot = (unsigned int)sqe->user_data;
+        if(ring->slots[slot])
+          ring->slots[slot]->queued = FALSE;
+        ring->slots[slot] = NULL;
+        ring->free_slots[ring->nfree_slots++] = slot;
+      }
+    }
+    URING_STORE(ring->sq_tail, URING_LOAD(ring->sq_head));
+    ring->nqueued = 0;
+    result = CURLE_RECV_ERROR;
+  }
+
+  if(ring->ninflight) {
+    /* The kernel did not complete all it took and may still receive into
+     * the pool. Whatever it receives is lost to the connections, fail
+     * their receives and never use this ring again. */
+    unsigned int i;
+
+    ring->broken = TRUE;
+    for(i = 0; i < ring->sq_entries; i++) {
+      struct Curl_uring_recv *op = ring->slots[i];
+      if(op) {
+        ring->slots[i] = NULL;
+        op->ring = NULL;
+        op->queued = FALSE;
+        op->res = -EIO;
+        op->done = TRUE;
+      }
+    }
+    result = CURLE_RECV_ERROR;
+  }
+  return result;
+}
+
+CURLcode Curl_uring_run(struct Curl_uring *ring)
+{
+  /* the queued receives are the batch for the readable sockets */
+  Curl_uint_bset_clear(&ring->ready);
+  return uring_run(ring);
+}
+
+void Curl_uring_set_ready(struct Curl_uring *ring, curl_socket_t sock)
+{
+  if(sock == CURL_SOCKET_BAD)
+    return;
+  if(!Curl_uint_bset_add(&ring->ready, (unsigned int)sock) &&
+     !Curl_uint_bset_resize(&ring->ready, (unsigned int)sock + 1))
+    (void)Curl_uint_bset_add(&ring->ready, (unsigned int)sock);
+}
+
+bool Curl_uring_is_ready(struct Curl_uring *ring, curl_socket_t sock)
+{
+  return (sock != CURL_SOCKET_BAD) &&
+         Curl_uint_bset_contains(&ring->ready, (unsigned int)sock);
+}
+
+void Curl_uring_recv_done(struct Curl_uring_recv *op)
+{
+  struct Curl_uring *ring = op->ring;
+
+  if(ring) {
+    if(op->queued) {
+      /* only while the ring runs, the completion finds no owner */
+      DEBUGASSERT(ring->slots[op->id] == op);
+      ring->slots[op->id] = NULL;
+    }
+    else if(op->buf)
+      uring_give_back(ring, op->id);
+  }
+  else if(op->own_buf)
+    free(op->buf);
+  memset(op, 0, sizeof(*op));
+}
+
+#endif /* USE_IO_URING */
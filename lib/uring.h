@@ -0,0 +1,93 @@
+#ifndef HEADER_CURL_URING_H
+#define HEADER_CURL_URING_H
+/***************************************************************************
+ *                                  _   _ ____  _
+ *  Project                     ___| | | |  _ \| |
+ *                             / __| | | | |_) | |
+ *                            | (__| |_| |  _ <| |___
+ *                             \___|\___/|_| \_\_____|
+ *
+ * Copyright (C) Daniel Stenberg, <daniel@haxx.se>, et al.
+ *
+ * This software is licensed as described in the file COPYING, which
+ * you should have received as part of this distribution. The terms
+ * are also available at https://curl.se/docs/copyright.html.
+ *
+ * You may opt to use, copy, modify, merge, publish, distribute and/or sell
+ * copies of the Software, and permit persons to whom the Software is
+ * furnished to do so, under the terms of the COPYING file.
+ *
+ * This software is distributed on an "AS IS" basis, WITHOUT WARRANTY OF ANY
+ * KIND, either express or implied.
+ *
+ * SPDX-License-Identifier: curl
+ *
+ ***************************************************************************/
+#include "curl_setup.h"
+#include <curl/curl.h>
+
+#ifdef USE_IO_URING
+
+/* An io_uring instance used to batch socket receives.
+ *
+ * Receives are queued for many sockets and then submitted and completed
+ * together with a single io_uring_enter() system call in
+ * Curl_uring_run(). Receives never wait for data to arrive, a socket
+ * without data completes with -EAGAIN.
+ *
+ * The data lands in a pool of buffers owned by the ring and provided to
+ * the kernel, which picks one only for a socket that has data. The owner
+ * of a receive copies the data out of it and hands the buffer back with
+ * Curl_uring_recv_done(). This trades one copy for the system calls
+ * saved, but keeps the memory needed bounded by the pool size and not
+ * the number of connections.
+ *
+ * When Curl_uring_run() returns, no receive is in flight any more. */
+struct Curl_uring;
+
+/* A receive queued on a ring. All members are managed by the ring, the
+ * owner reads `buf`, `res`, `queued` and `done` and advances `offset`
+ * when handing out data. */
+struct Curl_uring_recv {
+  struct Curl_uring *ring; /* ring the receive is on or has a buffer of */
+  char *buf;         /* the received data, when done and res > 0 */
+  size_t len;        /* size of the buffer received into */
+  size_t offset;     /* amount of `buf` handed out by the owner */
+  int res;           /* bytes received, 0 on EOF or a negative errno */
+  unsigned int id;   /* slot or buffer index on the ring */
+  BIT(queued);       /* queued on the ring, waiting for it to run */
+  BIT(done);         /* the ring ran, `res` is valid */
+  BIT(own_buf);      /* `buf` is a copy made when the ring went away */
+};
+
+/* Create a ring with room for `entries` queued receives. */
+CURLcode Curl_uring_create(struct Curl_uring **pring, unsigned int entries);
+
+/* Destroy the ring. Receives still holding one of its buffers get a copy
+ * of the data they have not handed out yet. */
+void Curl_uring_destroy(struct Curl_uring *ring);
+
+/* Queue a receive from `sock`. When the ring is full, it runs first to
+ * make room. */
+CURLcode Curl_uring_recv(struct Curl_uring *ring, curl_socket_t sock,
+                         struct Curl_uring_recv *op);
+
+/* Submit all queued receives and collect their results, using a single
+ * system call in the common case. On return, every receive is either
+ * done, with data or an error, or, when it could not be submitted, not
+ * queued any more and its owner receives directly. */
+CURLcode Curl_uring_run(struct Curl_uring *ring);
+
+/* Remember that `sock` is readable. Only receives from readable sockets
+ * are worth queueing, the ring forgets them again when it runs. */
+void Curl_uring_set_ready(struct Curl_uring *ring, curl_socket_t sock);
+
+/* TRUE when `sock` was seen readable since the ring last ran. */
+bool Curl_uring_is_ready(struct Curl_uring *ring, curl_socket_t sock);
+
+/* The owner is done with `op`, give its buffer back to the ring. */
+void Curl_uring_recv_done(struct Curl_uring_recv *op);
+
+#endif /* USE_IO_URING */
+
+#endif /* HEADER_CURL_URING_H */
@@ -388,6 +388,7 @@ CURLcode Curl_init_userdefined(struct Curl_easy *data)
   set->ftp_skip_ip = TRUE;    /* skip PASV IP by default */
 #endif
   set->dns_cache_timeout_ms = 60000; /* Timeout every 60 seconds by default */
+  set->dns_negative_timeout_ms = -1; /* half of the above by default */
 
   /* Timeout every 24 hours by default */
   set->general_ssl.ca_cache_timeout = 24 * 60 * 60;
@@ -492,6 +493,7 @@ CURLcode Curl_init_userdefined(struct Curl_easy *data)
     ;
 #if defined(USE_HTTP2) || defined(USE_HTTP3)
   memset(&set->priority, 0, sizeof(set->priority));
+  set->priority.urgency = CURL_PRIO_URGENCY_DEFAULT;
 #endif
   set->quick_exit = 0L;
 #ifndef CURL_DISABLE_WEBSOCKETS
@@ -1030,7 +1032,9 @@ static bool url_match_proxy_use(struct connectdata *conn,
 static bool url_match_http_multiplex(struct connectdata *conn,
                                      struct url_conn_match *m)
 {
-  if(m->may_multiplex &&
+  /* An idle connection made ahead of time by curl_multi_prewarm() has not
+   * seen a response yet. The transfer negotiates on it. */
+  if(m->may_multiplex && (CONN_INUSE(conn) || !conn->bits.prewarmed) &&
      (m->data->state.http_neg.allowed & (CURL_HTTP_V2x|CURL_HTTP_V3x)) &&
      (m->needle->handler->protocol & CURLPROTO_HTTP) &&
      !conn->httpversion_seen) {
@@ -1333,6 +1337,86 @@ static bool url_match_result(bool result, void *userdata)
   return FALSE;
 }
 
+static unsigned int url_fp_add(unsigned int fp, const void *ptr, size_t len)
+{
+  const unsigned char *p = ptr;
+  size_t i;
+  /* FNV-1a */
+  for(i = 0; i < len; i++)
+    fp = (fp ^ p[i]) * 16777619U;
+  return fp;
+}
+
+static unsigned int url_fp_add_str(unsigned int fp, const char *s)
+{
+  /* the terminating null keeps "ab"+"c" apart from "a"+"bc" */
+  return s ? url_fp_add(fp, s, strlen(s) + 1) : url_fp_add(fp, "", 1);
+}
+
+/*
+ * Fingerprint the details, besides the destination, that a connection
+ * made for this transfer is matched on when looking for reuse. Connections
+ * with the same fingerprint very likely match each other and the pool
+ * offers those first. It is only a hint, ConnectionExists() still checks
+ * every detail.
+ */
+static unsigned int url_reuse_fp(struct Curl_easy *data,
+                                 struct connectdata *needle)
+{
+  unsigned int fp = 2166136261U;
+  unsigned char bits[4];
+
+  fp = url_fp_add(fp, &needle->handler->protocol,
+                  sizeof(needle->handler->protocol));
+  fp = url_fp_add(fp, &data->set.ipver, sizeof(data->set.ipver));
+  fp = url_fp_add(fp, &needle->localport, sizeof(needle->localport));
+  fp = url_fp_add(fp, &needle->localportrange,
+                  sizeof(needle->localportrange));
+  fp = url_fp_add_str(fp, needle->localdev);
+#ifdef USE_UNIX_SOCKETS
+  fp = url_fp_add_str(fp, needle->unix_domain_socket);
+#endif
+  bits[0] = (unsigned char)needle->bits.conn_to_host;
+  bits[1] = (unsigned char)needle->bits.conn_to_port;
+#ifndef CURL_DISABLE_PROXY
+  bits[2] = (unsigned char)needle->bits.httpproxy;
+  bits[3] = (unsigned char)needle->bits.socksproxy;
+  if(needle->bits.httpproxy) {
+    fp = url_fp_add_str(fp, needle->http_proxy.host.name);
+    fp = url_fp_add(fp, &needle->http_proxy.port,
+                    sizeof(needle->http_proxy.port));
+    fp = url_fp_add(fp, &needle->http_proxy.proxytype,
+                    sizeof(needle->http_proxy.proxytype));
+  }
+  if(needle->bits.socksproxy) {
+    fp = url_fp_add_str(fp, needle->socks_proxy.host.name);
+    fp = url_fp_add(fp, &needle->socks_proxy.port,
+                    sizeof(needle->socks_proxy.port));
+  }
+#else
+  bits[2] = bits[3] = 0;
+#endif
+  fp = url_fp_add(fp, bits, sizeof(bits));
+  if(!(needle->handler->flags & PROTOPT_CREDSPERREQUEST))
+    fp = url_fp_add_str(fp, needle->user);
+#ifdef USE_SSL
+  if(needle->handler->flags & PROTOPT_SSL) {
+    struct ssl_primary_config *ssl = &data->set.ssl.primary;
+    bits[0] = ssl->version;
+    bits[1] = (unsigned char)ssl->ssl_options;
+    bits[2] = (unsigned char)((ssl->verifypeer << 2) |
+                              (ssl->verifyhost << 1) | ssl->verifystatus);
+    bits[3] = (unsigned char)(ssl->ssl_options >> 8);
+    fp = url_fp_add(fp, bits, sizeof(bits));
+    fp = url_fp_add(fp, &ssl->version_max, sizeof(ssl->version_max));
+    fp = url_fp_add_str(fp, ssl->CAfile);
+    fp = url_fp_add_str(fp, ssl->clientcert);
+    fp = url_fp_add_str(fp, ssl->cipher_list);
+  }
+#endif
+  return fp;
+}
+
 /*
  * Given one filled in connection struct (named needle), this function should
  * detect if there already is one that has all the significant details
@@ -1372,7 +1456,7 @@ ConnectionExists(struct Curl_easy *data,
 
   /* Find a connection in the pool that matches what "data + needle"
    * requires. If a suitable candidate is found, it is attached to "data". */
-  result = Curl_cpool_find(data, needle->destination,
+  result = Curl_cpool_find(data, needle->destination, needle->reuse_fp,
                            url_match_conn, url_match_result, &match);
 
   /* wait_pipe is TRUE if we encounter a bundle that is undecided. There
@@ -1440,7 +1524,9 @@ static struct connectdata *allocate_conn(struct Curl_easy *data)
   conn->bits.ftp_use_eprt = data->set.ftp_use_eprt;
 #endif
   conn->ip_version = data->set.ipver;
-  conn->connect_only = data->set.connect_only;
+  /* a pre-warmed connection is for others to reuse */
+  conn->connect_only = data->state.prewarm ? 0 : data->set.connect_only;
+  conn->bits.prewarmed = data->state.prewarm;
   conn->transport_wanted = TRNSPRT_TCP; /* most of them are TCP streams */
 
   /* Initialize the attached xfers bitset */
@@ -3656,6 +3742,8 @@ static CURLcode create_conn(struct Curl_easy *data,
   DEBUGASSERT(conn->user);
   DEBUGASSERT(conn->passwd);
 
+  conn->reuse_fp = url_reuse_fp(data, conn);
+
   /* reuse_fresh is TRUE if we are told to use a new connection by force, but
      we only acknowledge this option if this is not a reused connection
      already (which happens due to follow-location or during an HTTP
@@ -152,7 +152,7 @@ typedef unsigned int curl_prot_t;
 #include "http_chunks.h" /* for the structs and enum stuff */
 #include "hostip.h"
 #include "hash.h"
-#include "splay.h"
+#include "timewheel.h"
 #include "curlx/dynbuf.h"
 #include "dynhds.h"
 #include "request.h"
@@ -276,7 +276,7 @@ struct ssl_primary_config {
 #endif
   char *curves;          /* list of curves to use */
   unsigned int version_max; /* max supported version the client wants to use */
-  unsigned char ssl_options;  /* the CURLOPT_SSL_OPTIONS bitmask */
+  unsigned short ssl_options; /* the CURLOPT_SSL_OPTIONS bitmask */
   unsigned char version;    /* what version the client wants to use */
   BIT(verifypeer);       /* set TRUE if this is desired */
   BIT(verifyhost);       /* set TRUE if CN/SAN must match hostname */
@@ -296,6 +296,8 @@ struct ssl_config_data {
   char *key_passwd; /* plain text private key password */
   BIT(certinfo);     /* gather lots of certificate info */
   BIT(earlydata);    /* use tls1.3 early data */
+  BIT(earlydata_safe); /* use tls1.3 early data for replay safe requests */
+  BIT(ktls);         /* try kernel TLS offload */
   BIT(enable_beast); /* allow this flaw for interoperability's sake */
   BIT(no_revoke);    /* disable SSL certificate revocation checks */
   BIT(no_partialchain); /* do not accept partial certificate chains */
@@ -410,6 +412,7 @@ struct ConnectBits {
                  connection */
   BIT(asks_multiplex); /* connection asks for multiplexing, but is not yet */
   BIT(multiplex); /* connection is multiplexed */
+  BIT(prewarmed); /* made ahead of time by curl_multi_prewarm() */
   BIT(tcp_fastopen); /* use TCP Fast Open */
   BIT(tls_enable_alpn); /* TLS ALPN extension? */
 #ifndef CURL_DISABLE_DOH
@@ -633,6 +636,7 @@ struct proxy_info {
  */
 struct connectdata {
   struct Curl_llist_node cpool_node; /* conncache lists */
+  struct Curl_llist_node cpool_idle_node; /* conncache idle index */
   struct Curl_llist_node cshutdn_node; /* cshutdn list */
 
   curl_closesocket_callback fclosesocket; /* function closing the socket(s) */
@@ -649,6 +653,7 @@ struct connectdata {
   curl_off_t connection_id; /* Contains a unique number to make it easier to
                                track the connections in the log output */
   char *destination; /* string carrying normalized hostname+port+scope */
+  unsigned int reuse_fp; /* fingerprint of the settings reuse depends on */
 
   /* `meta_hash` is a general key-value store for implementations
    * with the lifetime of the connection.
@@ -932,11 +937,18 @@ struct Curl_data_priority {
   struct Curl_data_prio_node *children;
 #endif
   int weight;
+  unsigned char urgency; /* RFC 9218 urgency, 0 - 7 */
 #ifdef USE_NGHTTP2
   BIT(exclusive);
 #endif
+  BIT(incremental); /* RFC 9218 incremental */
 };
 
+/* RFC 9218 urgency of requests that do not say otherwise */
+#define CURL_PRIO_URGENCY_DEFAULT  3
+/* the least urgent RFC 9218 urgency */
+#define CURL_PRIO_URGENCY_MAX      7
+
 /* Timers */
 typedef enum {
   EXPIRE_100_TIMEOUT,
@@ -1045,7 +1057,7 @@ struct UrlState {
   BIT(provider_loaded);
 #endif /* USE_OPENSSL */
   struct curltime expiretime; /* set this with Curl_expire() only */
-  struct Curl_tree timenode; /* for the splay stuff */
+  struct Curl_twnode timenode; /* for the multi timer wheel */
   struct Curl_llist timeoutlist; /* list of pending timeouts */
   struct time_node expires[EXPIRE_LAST]; /* nodes for each expire type */
 
@@ -1176,6 +1188,7 @@ struct UrlState {
   BIT(internal); /* internal: true if this easy handle was created for
                     internal use and the user does not have ownership of the
                     handle. */
+  BIT(prewarm); /* internal transfer that parks its connection in the pool */
   BIT(http_ignorecustom); /* ignore custom method from now */
 #ifndef CURL_DISABLE_HTTP
   BIT(http_hd_te); /* Added HTTP header TE: */
@@ -1303,6 +1316,8 @@ enum dupstring {
   STRING_HSTS,                  /* CURLOPT_HSTS */
 #endif
   STRING_SASL_AUTHZID,          /* CURLOPT_SASL_AUTHZID */
+  STRING_DNS_CACHE_FILE,        /* CURLOPT_DNS_CACHE_FILE */
+  STRING_SSL_CA_CACHE_FILE,     /* CURLOPT_CA_CACHE_FILE */
 #ifdef USE_ARES
   STRING_DNS_SERVERS,
   STRING_DNS_INTERFACE,
@@ -1356,6 +1371,7 @@ struct UserDefined {
   unsigned long httpauth;  /* kind of HTTP authentication to use (bitmask) */
   unsigned long proxyauth; /* kind of proxy authentication to use (bitmask) */
   void *postfields;  /* if POST, set the fields' values here */
+  const struct curl_iovec *upload_iov; /* CURLOPT_UPLOAD_IOV */
   curl_seek_callback seek_func;      /* function that seeks the input */
   curl_off_t postfieldsize; /* if POST, this might have a size to use instead
                                of strlen(), and then the data *may* be binary
@@ -1425,6 +1441,10 @@ struct UserDefined {
 #endif
   struct ssl_general_config general_ssl; /* general user defined SSL stuff */
   timediff_t dns_cache_timeout_ms; /* DNS cache timeout (milliseconds) */
+  timediff_t dns_negative_timeout_ms; /* for failed resolves, -1 for half
+                                         of dns_cache_timeout_ms */
+  timediff_t dns_stale_timeout_ms; /* use expired entries this long while
+                                      they are refreshed */
   unsigned int buffer_size;      /* size of receive buffer to use */
   unsigned int upload_buffer_size; /* size of upload buffer to use,
                                       keep it >= CURL_MAX_WRITE_SIZE */
@@ -1489,6 +1509,9 @@ struct UserDefined {
 
 #if defined(USE_HTTP2) || defined(USE_HTTP3)
   struct Curl_data_priority priority;
+#endif
+#ifdef USE_NGHTTP2
+  int32_t h2_window_max; /* largest HTTP/2 stream window, 0 for default */
 #endif
   curl_resolver_start_callback resolver_start; /* optional callback called
                                                   before resolver start */
@@ -60,6 +60,7 @@
 #include "../strerror.h"
 #include "../curlx/dynbuf.h"
 #include "../http1.h"
+#include "../http_prio.h"
 #include "../select.h"
 #include "../curlx/inet_pton.h"
 #include "../transfer.h"
@@ -142,6 +143,7 @@ struct cf_ngtcp2_ctx {
   struct curltime handshake_at;      /* time connect handshake finished */
   struct bufc_pool stream_bufcp;     /* chunk pool for streams */
   struct dynbuf scratch;             /* temp buffer for header construction */
+  struct http_req_tmpl req_tmpl;     /* headers of the last request opened */
   struct uint_hash streams;          /* hash `data->mid` to `h3_stream_ctx` */
   size_t max_stream_window;          /* max flow window for one stream */
   uint64_t used_bidi_streams;        /* bidi streams we have opened */
@@ -151,6 +153,7 @@ struct cf_ngtcp2_ctx {
   size_t earlydata_skip;            /* sending bytes to skip when earlydata
                                      * is accepted by peer */
   CURLcode tls_vrfy_result;          /* result of TLS peer verification */
+  struct Curl_prio_sched prio;       /* request body scheduling */
   int qlogfd;
   BIT(initialized);
   BIT(tls_handshake_complete);       /* TLS handshake is done */
@@ -175,6 +178,7 @@ static void cf_ngtcp2_ctx_init(struct cf_ngtcp2_ctx *ctx)
   Curl_bufcp_init(&ctx->stream_bufcp, H3_STREAM_CHUNK_SIZE,
                   H3_STREAM_POOL_SPARES);
   curlx_dyn_init(&ctx->scratch, CURL_MAX_HTTP_HEADER);
+  Curl_http_req_tmpl_init(&ctx->req_tmpl);
   Curl_uint_hash_init(&ctx->streams, 63, h3_stream_hash_free);
   ctx->initialized = TRUE;
 }
@@ -186,6 +190,7 @@ static void cf_ngtcp2_ctx_free(struct cf_ngtcp2_ctx *ctx)
     vquic_ctx_free(&ctx->q);
     Curl_bufcp_free(&ctx->stream_bufcp);
     curlx_dyn_free(&ctx->scratch);
+    Curl_http_req_tmpl_free(&ctx->req_tmpl);
     Curl_uint_hash_destroy(&ctx->streams);
     Curl_ssl_peer_cleanup(&ctx->peer);
   }
@@ -250,6 +255,7 @@ struct h3_stream_ctx {
   curl_off_t upload_left; /* number of request bytes left to upload */
   int status_code; /* HTTP status code */
   CURLcode xfer_result; /* result from xfer_resp_write(_hd) */
+  struct Curl_prio_stream prio; /* request body scheduling by urgency */
   BIT(resp_hds_complete); /* we have a complete, final response */
   BIT(closed); /* TRUE on stream close */
   BIT(reset);  /* TRUE on stream reset */
@@ -271,6 +277,30 @@ static void h3_stream_hash_free(unsigned int id, void *stream)
   h3_stream_ctx_free((struct h3_stream_ctx *)stream);
 }
 
+/* Count `stream` as queued in its urgency while it has request body data
+ * in `sendbuf` not passed to nghttp3 yet and QUIC flow control lets it
+ * send. */
+static void h3_prio_queued(struct cf_ngtcp2_ctx *ctx,
+                           struct h3_stream_ctx *stream)
+{
+  Curl_prio_set_queued(&ctx->prio, &stream->prio,
+                       (stream->id >= 0) && !stream->closed &&
+                       !stream->quic_flow_blocked &&
+                       (stream->sendbuf_len_in_flight <
+                        Curl_bufq_len(&stream->sendbuf)));
+}
+
+static bool h3_prio_resume_stream(unsigned int mid, void *val, void *userp)
+{
+  struct cf_ngtcp2_ctx *ctx = userp;
+  struct h3_stream_ctx *stream = val;
+
+  (void)mid;
+  if(stream->prio.deferred)
+    (void)nghttp3_conn_resume_stream(ctx->h3conn, stream->id);
+  return TRUE;
+}
+
 static CURLcode h3_data_setup(struct Curl_cfilter *cf,
                               struct Curl_easy *data)
 {
@@ -292,6 +322,7 @@ static CURLcode h3_data_setup(struct Curl_cfilter *cf,
   Curl_bufq_initp(&stream->sendbuf, &ctx->stream_bufcp,
                   H3_STREAM_SEND_CHUNKS, BUFQ_OPT_NONE);
   stream->sendbuf_len_in_flight = 0;
+  Curl_prio_stream_init(&stream->prio);
   Curl_h1_req_parse_init(&stream->h1, H1_PARSE_DEFAULT_MAX_LINE_LEN);
 
   if(!Curl_uint_hash_set(&ctx->streams, data->mid, stream)) {
@@ -336,6 +367,9 @@ static void h3_data_done(struct Curl_cfilter *cf, struct Curl_easy *data)
     CURL_TRC_CF(data, cf, "[%" FMT_PRId64 "] easy handle is done",
                 stream->id);
     cf_ngtcp2_stream_close(cf, data, stream);
+    Curl_prio_undefer(&ctx->prio, &stream->prio);
+    stream->closed = TRUE;
+    h3_prio_queued(ctx, stream);
     Curl_uint_hash_remove(&ctx->streams, data->mid);
     if(!Curl_uint_hash_count(&ctx->streams))
       cf_ngtcp2_setup_keep_alive(cf, data);
@@ -728,6 +762,7 @@ static int cb_extend_max_stream_data(ngtcp2_conn *tconn, int64_t stream_id,
     CURL_TRC_CF(s_data, cf, "[%" FMT_PRId64 "] unblock quic flow",
                 (curl_int64_t)stream_id);
     stream->quic_flow_blocked = FALSE;
+    h3_prio_queued(ctx, stream);
     Curl_multi_mark_dirty(s_data);
   }
   return 0;
@@ -922,7 +957,7 @@ static CURLcode cf_ngtcp2_adjust_pollset(struct Curl_cfilter *cf,
     c_exhaust = want_send && (!ngtcp2_conn_get_cwnd_left(ctx->qconn) ||
                 !ngtcp2_conn_get_max_data_left(ctx->qconn));
     s_exhaust = want_send && stream && stream->id >= 0 &&
-                stream->quic_flow_blocked;
+                (stream->quic_flow_blocked || stream->prio.deferred);
     want_recv = (want_recv || c_exhaust || s_exhaust);
     want_send = (!s_exhaust && want_send) ||
                  !Curl_bufq_is_empty(&ctx->q.sendbuf);
@@ -951,6 +986,8 @@ static int cb_h3_stream_close(nghttp3_conn *conn, int64_t sid,
 
   stream->closed = TRUE;
   stream->error3 = (curl_uint64_t)app_error_code;
+  Curl_prio_undefer(&ctx->prio, &stream->prio);
+  h3_prio_queued(ctx, stream);
   if(stream->error3 != NGHTTP3_H3_NO_ERROR) {
     stream->reset = TRUE;
     stream->send_closed = TRUE;
@@ -1368,6 +1405,7 @@ static int cb_h3_acked_req_body(nghttp3_conn *conn, int64_t stream_id,
     skiplen = (size_t)datalen;
   Curl_bufq_skip(&stream->sendbuf, skiplen);
   stream->sendbuf_len_in_flight -= skiplen;
+  h3_prio_queued(ctx, stream);
 
   /* Resume upload processing if we have more data to send */
   if(stream->sendbuf_len_in_flight < Curl_bufq_len(&stream->sendbuf)) {
@@ -1399,6 +1437,15 @@ cb_h3_read_req_body(nghttp3_conn *conn, int64_t stream_id,
 
   if(!stream)
     return NGHTTP3_ERR_CALLBACK_FAILURE;
+  if((stream->sendbuf_len_in_flight < Curl_bufq_len(&stream->sendbuf)) &&
+     Curl_prio_wait(&ctx->prio, &stream->prio)) {
+    Curl_prio_defer(&ctx->prio, &stream->prio);
+    CURL_TRC_CF(data, cf, "[%" FMT_PRId64 "] read req body, waiting for "
+                "more urgent streams", stream->id);
+    return NGHTTP3_ERR_WOULDBLOCK;
+  }
+  if(Curl_prio_undefer(&ctx->prio, &stream->prio))
+    Curl_multi_mark_dirty(data);
   /* nghttp3 keeps references to the sendbuf data until it is ACKed
    * by the server (see `cb_h3_acked_req_body()` for updates).
    * `sendbuf_len_in_flight` is the amount of bytes in `sendbuf`
@@ -1418,6 +1465,7 @@ cb_h3_read_req_body(nghttp3_conn *conn, int64_t stream_id,
       ++nvecs;
     }
     DEBUGASSERT(nvecs > 0); /* we SHOULD have been be able to peek */
+    h3_prio_queued(ctx, stream);
   }
 
   if(nwritten > 0 && stream->upload_left != -1)
@@ -1458,7 +1506,7 @@ static CURLcode h3_stream_open(struct Curl_cfilter *cf,
   struct h3_stream_ctx *stream = NULL;
   int64_t sid;
   struct dynhds h2_headers;
-  size_t nheader;
+  size_t nheader, npseudo;
   nghttp3_nv *nva = NULL;
   int rc = 0;
   unsigned int i;
@@ -1491,14 +1539,22 @@ static CURLcode h3_stream_open(struct Curl_cfilter *cf,
   }
   DEBUGASSERT(stream->h1.req);
 
-  result = Curl_http_req_to_h2(&h2_headers, stream->h1.req, data);
+  result = Curl_http_req_to_h2_tmpl(&h2_headers, &ctx->req_tmpl,
+                                    stream->h1.req, data);
+  if(!result)
+    result = Curl_http_req_add_prio(&h2_headers, &ctx->req_tmpl.hds, data);
   if(result)
     goto out;
 
   /* no longer needed */
   Curl_h1_req_parse_free(&stream->h1);
+  data->state.priority.urgency = data->set.priority.urgency;
+  data->state.priority.incremental = data->set.priority.incremental;
+  Curl_prio_set_urgency(&ctx->prio, &stream->prio,
+                        data->state.priority.urgency);
 
-  nheader = Curl_dynhds_count(&h2_headers);
+  npseudo = Curl_dynhds_count(&h2_headers);
+  nheader = npseudo + Curl_dynhds_count(&ctx->req_tmpl.hds);
   nva = malloc(sizeof(nghttp3_nv) * nheader);
   if(!nva) {
     result = CURLE_OUT_OF_MEMORY;
@@ -1506,7 +1562,9 @@ static CURLcode h3_stream_open(struct Curl_cfilter *cf,
   }
 
   for(i = 0; i < nheader; ++i) {
-    struct dynhds_entry *e = Curl_dynhds_getn(&h2_headers, i);
+    struct dynhds_entry *e = (i < npseudo) ?
+      Curl_dynhds_getn(&h2_headers, i) :
+      Curl_dynhds_getn(&ctx->req_tmpl.hds, i - npseudo);
     nva[i].name = (unsigned char *)e->name;
     nva[i].namelen = e->namelen;
     nva[i].value = (unsigned char *)e->value;
@@ -1655,6 +1713,7 @@ static CURLcode cf_ngtcp2_send(struct Curl_cfilter *cf, struct Curl_easy *data,
                 stream->id, len, result, *pnwritten);
     if(result)
       goto out;
+    h3_prio_queued(ctx, stream);
     (void)nghttp3_conn_resume_stream(ctx->h3conn, stream->id);
   }
 
@@ -1788,8 +1847,10 @@ static CURLcode read_pkt_to_send(void *userp,
         CURL_TRC_CF(x->data, x->cf, "[%" FMT_PRId64 "] block quic flow",
                     (curl_int64_t)stream_id);
         DEBUGASSERT(stream);
-        if(stream)
+        if(stream) {
           stream->quic_flow_blocked = TRUE;
+          h3_prio_queued(ctx, stream);
+        }
         n = 0;
         break;
       }
@@ -1831,6 +1892,38 @@ static CURLcode read_pkt_to_send(void *userp,
   }
 }
 
+/*
+ * Take over a changed RFC 9218 urgency or incremental setting of `data`
+ * and send it to the server in a PRIORITY_UPDATE frame.
+ */
+static void h3_prio_update(struct Curl_cfilter *cf, struct Curl_easy *data)
+{
+  struct cf_ngtcp2_ctx *ctx = cf->ctx;
+  struct h3_stream_ctx *stream = H3_STREAM_CTX(ctx, data);
+
+  if(stream && (stream->id >= 0) && !stream->closed && ctx->h3conn &&
+     ((data->set.priority.urgency != data->state.priority.urgency) ||
+      (data->set.priority.incremental !=
+       data->state.priority.incremental))) {
+    char value[16];
+    size_t vlen;
+    int rv;
+
+    data->state.priority.urgency = data->set.priority.urgency;
+    data->state.priority.incremental = data->set.priority.incremental;
+    Curl_prio_set_urgency(&ctx->prio, &stream->prio,
+                          data->state.priority.urgency);
+    /* an empty value sets the default priority */
+    vlen = Curl_http_prio_value(&data->state.priority, value, sizeof(value));
+    rv = nghttp3_conn_set_client_stream_priority(ctx->h3conn, stream->id,
+                                                 (const uint8_t *)value,
+                                                 vlen);
+    if(rv)
+      CURL_TRC_CF(data, cf, "[%" FMT_PRId64 "] PRIORITY_UPDATE failed: %s",
+                  stream->id, nghttp3_strerror(rv));
+  }
+}
+
 static CURLcode cf_progress_egress(struct Curl_cfilter *cf,
                                    struct Curl_easy *data,
                                    struct pkt_io_ctx *pktx)
@@ -1861,6 +1954,12 @@ static CURLcode cf_progress_egress(struct Curl_cfilter *cf,
     return curlcode;
   }
 
+  h3_prio_update(cf, data);
+  /* have streams waiting on more urgent ones check again */
+  if(ctx->prio.deferred && ctx->h3conn)
+    Curl_uint_hash_visit(&ctx->streams, h3_prio_resume_stream, ctx);
+  ctx->prio.drained = FALSE;
+
   /* In UDP, there is a maximum theoretical packet payload length and
    * a minimum payload length that is "guaranteed" to work.
    * To detect if this minimum payload can be increased, ngtcp2 sends
@@ -2736,6 +2835,7 @@ struct Curl_cftype Curl_cft_http3 = {
   cf_ngtcp2_adjust_pollset,
   Curl_cf_def_data_pending,
   cf_ngtcp2_send,
+  Curl_cf_emulate_sendv,
   cf_ngtcp2_recv,
   cf_ngtcp2_cntrl,
   cf_ngtcp2_conn_is_alive,
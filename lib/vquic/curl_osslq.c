@@ -286,6 +286,7 @@ struct cf_osslq_ctx {
   struct curltime handshake_at;      /* time connect handshake finished */
   struct curltime first_byte_at;     /* when first byte was recvd */
   struct bufc_pool stream_bufcp;     /* chunk pool for streams */
+  struct http_req_tmpl req_tmpl;     /* headers of the last request opened */
   struct uint_hash streams;          /* hash `data->mid` to `h3_stream_ctx` */
   size_t max_stream_window;          /* max flow window for one stream */
   uint64_t max_idle_ms;              /* max idle time for QUIC connection */
@@ -307,6 +308,7 @@ static void cf_osslq_ctx_init(struct cf_osslq_ctx *ctx)
   DEBUGASSERT(!ctx->initialized);
   Curl_bufcp_init(&ctx->stream_bufcp, H3_STREAM_CHUNK_SIZE,
                   H3_STREAM_POOL_SPARES);
+  Curl_http_req_tmpl_init(&ctx->req_tmpl);
   Curl_uint_hash_init(&ctx->streams, 63, h3_stream_hash_free);
   ctx->poll_items = NULL;
   ctx->curl_items = NULL;
@@ -318,6 +320,7 @@ static void cf_osslq_ctx_free(struct cf_osslq_ctx *ctx)
 {
   if(ctx && ctx->initialized) {
     Curl_bufcp_free(&ctx->stream_bufcp);
+    Curl_http_req_tmpl_free(&ctx->req_tmpl);
     Curl_uint_hash_destroy(&ctx->streams);
     Curl_ssl_peer_cleanup(&ctx->peer);
     free(ctx->poll_items);
@@ -1871,7 +1874,7 @@ static ssize_t h3_stream_open(struct Curl_cfilter *cf,
   struct cf_osslq_ctx *ctx = cf->ctx;
   struct h3_stream_ctx *stream = NULL;
   struct dynhds h2_headers;
-  size_t nheader;
+  size_t nheader, npseudo;
   nghttp3_nv *nva = NULL;
   int rc = 0;
   unsigned int i;
@@ -1900,7 +1903,8 @@ static ssize_t h3_stream_open(struct Curl_cfilter *cf,
   }
   DEBUGASSERT(stream->h1.req);
 
-  *err = Curl_http_req_to_h2(&h2_headers, stream->h1.req, data);
+  *err = Curl_http_req_to_h2_tmpl(&h2_headers, &ctx->req_tmpl,
+                                  stream->h1.req, data);
   if(*err) {
     nwritten = -1;
     goto out;
@@ -1908,7 +1912,8 @@ static ssize_t h3_stream_open(struct Curl_cfilter *cf,
   /* no longer needed */
   Curl_h1_req_parse_free(&stream->h1);
 
-  nheader = Curl_dynhds_count(&h2_headers);
+  npseudo = Curl_dynhds_count(&h2_headers);
+  nheader = npseudo + Curl_dynhds_count(&ctx->req_tmpl.hds);
   nva = malloc(sizeof(nghttp3_nv) * nheader);
   if(!nva) {
     *err = CURLE_OUT_OF_MEMORY;
@@ -1917,7 +1922,9 @@ static ssize_t h3_stream_open(struct Curl_cfilter *cf,
   }
 
   for(i = 0; i < nheader; ++i) {
-    struct dynhds_entry *e = Curl_dynhds_getn(&h2_headers, i);
+    struct dynhds_entry *e = (i < npseudo) ?
+      Curl_dynhds_getn(&h2_headers, i) :
+      Curl_dynhds_getn(&ctx->req_tmpl.hds, i - npseudo);
     nva[i].name = (unsigned char *)e->name;
     nva[i].namelen = e->namelen;
     nva[i].value = (unsigned char *)e->value;
@@ -2387,6 +2394,7 @@ struct Curl_cftype Curl_cft_http3 = {
   cf_osslq_adjust_pollset,
   cf_osslq_data_pending,
   cf_osslq_send,
+  Curl_cf_emulate_sendv,
   cf_osslq_recv,
   cf_osslq_cntrl,
   cf_osslq_conn_is_alive,
@@ -98,6 +98,7 @@ struct cf_quiche_ctx {
   struct curltime started_at;        /* time the current attempt started */
   struct curltime handshake_at;      /* time connect handshake finished */
   struct bufc_pool stream_bufcp;     /* chunk pool for streams */
+  struct http_req_tmpl req_tmpl;     /* headers of the last request sent */
   struct uint_hash streams;          /* hash `data->mid` to `stream_ctx` */
   curl_off_t data_recvd;
   BIT(initialized);
@@ -129,6 +130,7 @@ static void cf_quiche_ctx_init(struct cf_quiche_ctx *ctx)
 #endif
   Curl_bufcp_init(&ctx->stream_bufcp, H3_STREAM_CHUNK_SIZE,
                   H3_STREAM_POOL_SPARES);
+  Curl_http_req_tmpl_init(&ctx->req_tmpl);
   Curl_uint_hash_init(&ctx->streams, 63, h3_stream_hash_free);
   ctx->data_recvd = 0;
   ctx->initialized = TRUE;
@@ -143,6 +145,7 @@ static void cf_quiche_ctx_free(struct cf_quiche_ctx *ctx)
     Curl_ssl_peer_cleanup(&ctx->peer);
     vquic_ctx_free(&ctx->q);
     Curl_bufcp_free(&ctx->stream_bufcp);
+    Curl_http_req_tmpl_free(&ctx->req_tmpl);
     Curl_uint_hash_destroy(&ctx->streams);
   }
   free(ctx);
@@ -966,7 +969,7 @@ static CURLcode h3_open_stream(struct Curl_cfilter *cf,
 {
   struct cf_quiche_ctx *ctx = cf->ctx;
   struct h3_stream_ctx *stream = H3_STREAM_CTX(ctx, data);
-  size_t nheader, i;
+  size_t nheader, npseudo, i;
   curl_int64_t stream3_id;
   struct dynhds h2_headers;
   quiche_h3_header *nva = NULL;
@@ -994,14 +997,16 @@ static CURLcode h3_open_stream(struct Curl_cfilter *cf,
   }
   DEBUGASSERT(stream->h1.req);
 
-  result = Curl_http_req_to_h2(&h2_headers, stream->h1.req, data);
+  result = Curl_http_req_to_h2_tmpl(&h2_headers, &ctx->req_tmpl,
+                                    stream->h1.req, data);
   if(result)
     goto out;
 
   /* no longer needed */
   Curl_h1_req_parse_free(&stream->h1);
 
-  nheader = Curl_dynhds_count(&h2_headers);
+  npseudo = Curl_dynhds_count(&h2_headers);
+  nheader = npseudo + Curl_dynhds_count(&ctx->req_tmpl.hds);
   nva = malloc(sizeof(quiche_h3_header) * nheader);
   if(!nva) {
     result = CURLE_OUT_OF_MEMORY;
@@ -1009,7 +1014,9 @@ static CURLcode h3_open_stream(struct Curl_cfilter *cf,
   }
 
   for(i = 0; i < nheader; ++i) {
-    struct dynhds_entry *e = Curl_dynhds_getn(&h2_headers, i);
+    struct dynhds_entry *e = (i < npseudo) ?
+      Curl_dynhds_getn(&h2_headers, i) :
+      Curl_dynhds_getn(&ctx->req_tmpl.hds, i - npseudo);
     nva[i].name = (unsigned char *)e->name;
     nva[i].name_len = e->namelen;
     nva[i].value = (unsigned char *)e->value;
@@ -1625,6 +1632,7 @@ struct Curl_cftype Curl_cft_http3 = {
   cf_quiche_adjust_pollset,
   cf_quiche_data_pending,
   cf_quiche_send,
+  Curl_cf_emulate_sendv,
   cf_quiche_recv,
   cf_quiche_cntrl,
   cf_quiche_conn_is_alive,
@@ -63,9 +63,18 @@
 #include "hostcheck.h"
 #include "../transfer.h"
 #include "../multiif.h"
+#include "../cf-socket.h"
 #include "../curlx/strparse.h"
+#include "../curlx/base64.h"
+#include "../curl_get_line.h"
+#include "../fopen.h"
+#include "../rename.h"
+#include "../escape.h"
+#include "../share.h"
 #include "../strdup.h"
 #include "../strerror.h"
+#include "../curl_threads.h"
+#include "../socketpair.h"
 #include "../curl_printf.h"
 
 #include <openssl/ssl.h>
@@ -251,7 +260,19 @@ typedef unsigned long sslerr_t;
 #define HAVE_SSL_X509_STORE_SHARE
 #endif
 
+/*
+ * Whether the OpenSSL version has the API needed to keep a fully set up
+ * SSL_CTX for the connections of a multi handle. The API is:
+ * * `SSL_CTX_up_ref`          -- Introduced: OpenSSL 1.1.0.
+ */
+#if OPENSSL_VERSION_NUMBER >= 0x10100000L /* OpenSSL >= 1.1.0 */
+#define HAVE_SSL_CTX_SHARE
+#endif
+
 static CURLcode ossl_certchain(struct Curl_easy *data, SSL *ssl);
+static CURLcode ossl_setup_x509_store(struct Curl_cfilter *cf,
+                                      struct Curl_easy *data,
+                                      struct ossl_ctx *octx);
 
 static CURLcode push_certinfo(struct Curl_easy *data,
                               BIO *mem, const char *label, int num)
@@ -750,12 +771,11 @@ static int ossl_bio_cf_in_read(BIO *bio, char *buf, int blen)
   /* Before returning server replies to the SSL instance, we need
    * to have setup the x509 store or verification will fail. */
   if(!octx->x509_store_setup) {
-    r2 = Curl_ssl_setup_x509_store(cf, data, octx->ssl_ctx);
+    r2 = ossl_setup_x509_store(cf, data, octx);
     if(r2) {
       octx->io_result = r2;
       return -1;
     }
-    octx->x509_store_setup = TRUE;
   }
   return result ? -1 : (int)nread;
 }
@@ -2112,6 +2132,58 @@ static CURLcode ossl_set_provider(struct Curl_easy *data, const char *iname)
 }
 #endif
 
+#if defined(USE_OPENSSL_KTLS) && defined(USE_THREADS_POSIX)
+#include <signal.h>
+
+/* With kTLS, OpenSSL writes to the socket itself and a peer having closed
+ * the connection raises SIGPIPE, as it does not pass MSG_NOSIGNAL like our
+ * socket filter. libcurl ignores SIGPIPE around its calls already, unless
+ * CURLOPT_NOSIGNAL is set. In that case, block SIGPIPE in this thread for
+ * the write and discard any it raised, leaving other threads alone. */
+struct ossl_nosig {
+  sigset_t old_mask;
+  BIT(blocked);
+  BIT(was_pending);
+};
+
+#define OSSL_NOSIG_VARIABLE(x) struct ossl_nosig x
+
+static void ossl_nosig_start(struct Curl_easy *data, struct ossl_ctx *octx,
+                             struct ossl_nosig *ns)
+{
+  sigset_t pipe_set, pending;
+
+  ns->blocked = ns->was_pending = FALSE;
+  if(!octx->ktls || !data->set.no_signal)
+    return;
+  sigemptyset(&pipe_set);
+  sigaddset(&pipe_set, SIGPIPE);
+  /* a SIGPIPE already waiting is not ours to discard */
+  ns->was_pending = !sigpending(&pending) && sigismember(&pending, SIGPIPE);
+  ns->blocked = !pthread_sigmask(SIG_BLOCK, &pipe_set, &ns->old_mask);
+}
+
+static void ossl_nosig_end(struct ossl_nosig *ns)
+{
+  sigset_t pipe_set, pending;
+
+  if(!ns->blocked)
+    return;
+  sigemptyset(&pipe_set);
+  sigaddset(&pipe_set, SIGPIPE);
+  if(!ns->was_pending && !sigpending(&pending) &&
+     sigismember(&pending, SIGPIPE)) {
+    struct timespec ts = { 0, 0 };
+    while((sigtimedwait(&pipe_set, NULL, &ts) == -1) && (errno == SOCKEINTR))
+      ;
+  }
+  pthread_sigmask(SIG_SETMASK, &ns->old_mask, NULL);
+}
+#else
+#define OSSL_NOSIG_VARIABLE(x)
+#define ossl_nosig_start(x,y,z) Curl_nop_stmt
+#define ossl_nosig_end(x)       Curl_nop_stmt
+#endif /* USE_OPENSSL_KTLS && USE_THREADS_POSIX */
 
 static CURLcode ossl_shutdown(struct Curl_cfilter *cf,
                               struct Curl_easy *data,
@@ -2121,9 +2193,10 @@ static CURLcode ossl_shutdown(struct Curl_cfilter *cf,
   struct ossl_ctx *octx = (struct ossl_ctx *)connssl->backend;
   CURLcode result = CURLE_OK;
   char buf[1024];
-  int nread = -1, err;
+  int nread = -1, err, rc;
   unsigned long sslerr;
   size_t i;
+  OSSL_NOSIG_VARIABLE(nosig);
 
   DEBUGASSERT(octx);
   if(!octx->ssl || cf->shutdown) {
@@ -2169,7 +2242,10 @@ static CURLcode ossl_shutdown(struct Curl_cfilter *cf,
   if(send_shutdown && !(SSL_get_shutdown(octx->ssl) & SSL_SENT_SHUTDOWN)) {
     ERR_clear_error();
     CURL_TRC_CF(data, cf, "send SSL close notify");
-    if(SSL_shutdown(octx->ssl) == 1) {
+    ossl_nosig_start(data, octx, &nosig);
+    rc = SSL_shutdown(octx->ssl);
+    ossl_nosig_end(&nosig);
+    if(rc == 1) {
       CURL_TRC_CF(data, cf, "SSL shutdown finished");
       *done = TRUE;
       goto out;
@@ -2193,7 +2269,10 @@ static CURLcode ossl_shutdown(struct Curl_cfilter *cf,
   err = SSL_get_error(octx->ssl, nread);
   switch(err) {
   case SSL_ERROR_ZERO_RETURN: /* no more data */
-    if(SSL_shutdown(octx->ssl) == 1)
+    ossl_nosig_start(data, octx, &nosig);
+    rc = SSL_shutdown(octx->ssl);
+    ossl_nosig_end(&nosig);
+    if(rc == 1)
       CURL_TRC_CF(data, cf, "SSL shutdown finished");
     else
       CURL_TRC_CF(data, cf, "SSL shutdown not received, but closed");
@@ -2231,6 +2310,384 @@ out:
   return result;
 }
 
+#ifdef HAVE_OSSL_VERIFY_POOL
+/*
+ * The certificate verification pool of a multi handle. With
+ * CURLMOPT_VERIFY_THREADS set, the server's certificate chain is verified
+ * by one of a limited number of worker threads. The handshake is parked
+ * with SSL_set_retry_verify() until the worker is done and wakes up the
+ * transfer through a socketpair.
+ */
+
+/* key to use at `multi->proto_hash` */
+#define MPROTO_OSSL_VERIFY_KEY   "tls:ossl:verify:pool"
+
+/* One chain to verify. Referenced by the pool until a worker is done with
+ * it and by the connection until it has the result. */
+struct ossl_verify_job {
+  struct Curl_llist_node node;  /* in the pool's queue */
+  curl_mutex_t mutx;            /* protects the members below */
+  X509_STORE_CTX *store_ctx;    /* a copy of the handshake's */
+  X509_STORE *store;
+  X509 *cert;
+  STACK_OF(X509) *untrusted;
+  curl_socket_t sock_pair[2];   /* [1] is written to when done, [0] is
+                                   polled and closed by the connection */
+  int ref_count;
+  int verified;                 /* X509_verify_cert() result */
+  BIT(done);
+};
+
+struct ossl_verify_pool {
+  curl_mutex_t mutx;
+  curl_cond_t cond;        /* signaled when a job is queued or on shutdown */
+  struct Curl_llist queue; /* jobs waiting for a worker */
+  curl_thread_t *threads;  /* the started workers */
+  unsigned int nthreads;   /* number of started workers */
+  unsigned int idle;       /* number of workers waiting for a job */
+  BIT(shutdown);
+};
+
+/* Drop a reference to `job`, free it when it was the last one. The
+ * connection closes its end of the socketpair before, see
+ * ossl_verify_job_drop(). */
+static void ossl_verify_job_unref(struct ossl_verify_job *job)
+{
+  bool last;
+
+  Curl_mutex_acquire(&job->mutx);
+  last = !--job->ref_count;
+  Curl_mutex_release(&job->mutx);
+  if(!last)
+    return;
+  X509_STORE_CTX_free(job->store_ctx);
+  X509_STORE_free(job->store);
+  X509_free(job->cert);
+  if(job->untrusted)
+    sk_X509_pop_free(job->untrusted, X509_free);
+  if(job->sock_pair[0] != CURL_SOCKET_BAD)
+    wakeup_close(job->sock_pair[0]);
+  if(job->sock_pair[1] != CURL_SOCKET_BAD)
+    wakeup_close(job->sock_pair[1]);
+  Curl_mutex_destroy(&job->mutx);
+  free(job);
+}
+
+/* Verify the chain of `job` unless the connection is gone and tell the
+ * connection about the result. */
+static void ossl_verify_job_run(struct ossl_verify_job *job)
+{
+  bool wanted;
+  int verified = 0;
+
+  Curl_mutex_acquire(&job->mutx);
+  wanted = (job->ref_count > 1);
+  Curl_mutex_release(&job->mutx);
+
+  if(wanted) {
+    verified = X509_verify_cert(job->store_ctx);
+    ERR_clear_error();
+  }
+
+  Curl_mutex_acquire(&job->mutx);
+  job->verified = verified;
+  job->done = TRUE;
+  if(job->ref_count > 1) {
+#ifdef USE_EVENTFD
+    const uint64_t buf[1] = { 1 };
+#else
+    const char buf[1] = { 1 };
+#endif
+    /* the connection may not be woken up, it fails by its timeout then */
+    (void)wakeup_write(job->sock_pair[1], buf, sizeof(buf));
+  }
+  Curl_mutex_release(&job->mutx);
+  ossl_verify_job_unref(job);
+}
+
+static CURL_THREAD_RETURN_T CURL_STDCALL ossl_verify_worker(void *arg)
+{
+  struct ossl_verify_pool *pool = arg;
+
+  Curl_mutex_acquire(&pool->mutx);
+  while(!pool->shutdown) {
+    struct Curl_llist_node *e = Curl_llist_head(&pool->queue);
+    struct ossl_verify_job *job;
+
+    if(!e) {
+      pool->idle++;
+      Curl_cond_wait(&pool->cond, &pool->mutx);
+      pool->idle--;
+      continue;
+    }
+    job = Curl_node_elem(e);
+    Curl_node_remove(e);
+    Curl_mutex_release(&pool->mutx);
+    ossl_verify_job_run(job);
+    Curl_mutex_acquire(&pool->mutx);
+  }
+  Curl_mutex_release(&pool->mutx);
+  return 0;
+}
+
+static void ossl_verify_pool_free(void *key, size_t key_len, void *p)
+{
+  struct ossl_verify_pool *pool = p;
+  struct Curl_llist_node *e;
+  unsigned int i;
+
+  DEBUGASSERT(key_len == (sizeof(MPROTO_OSSL_VERIFY_KEY)-1));
+  DEBUGASSERT(!memcmp(MPROTO_OSSL_VERIFY_KEY, key, key_len));
+  (void)key;
+  (void)key_len;
+
+  Curl_mutex_acquire(&pool->mutx);
+  pool->shutdown = TRUE;
+  Curl_cond_broadcast(&pool->cond);
+  Curl_mutex_release(&pool->mutx);
+
+  /* workers finish the chain they are verifying */
+  for(i = 0; i < pool->nthreads; ++i)
+    Curl_thread_join(&pool->threads[i]);
+
+  /* connections are gone, drop the jobs no worker started */
+  for(e = Curl_llist_head(&pool->queue); e;
+      e = Curl_llist_head(&pool->queue)) {
+    struct ossl_verify_job *job = Curl_node_elem(e);
+    Curl_node_remove(e);
+    ossl_verify_job_unref(job);
+  }
+
+  Curl_cond_destroy(&pool->cond);
+  Curl_mutex_destroy(&pool->mutx);
+  free(pool->threads);
+  free(pool);
+}
+
+static struct ossl_verify_pool *ossl_verify_pool_get(struct Curl_easy *data)
+{
+  struct ossl_verify_pool *pool;
+
+  pool = Curl_hash_pick(&data->multi->proto_hash,
+                        CURL_UNCONST(MPROTO_OSSL_VERIFY_KEY),
+                        sizeof(MPROTO_OSSL_VERIFY_KEY)-1);
+  if(pool)
+    return pool;
+  pool = calloc(1, sizeof(*pool));
+  if(!pool)
+    return NULL;
+  Curl_mutex_init(&pool->mutx);
+  Curl_cond_init(&pool->cond);
+  Curl_llist_init(&pool->queue, NULL);
+  if(!Curl_hash_add2(&data->multi->proto_hash,
+                     CURL_UNCONST(MPROTO_OSSL_VERIFY_KEY),
+                     sizeof(MPROTO_OSSL_VERIFY_KEY)-1,
+                     pool, ossl_verify_pool_free)) {
+    Curl_cond_destroy(&pool->cond);
+    Curl_mutex_destroy(&pool->mutx);
+    free(pool);
+    return NULL;
+  }
+  return pool;
+}
+
+/* Start another worker. Called with the pool locked. */
+static bool ossl_verify_pool_grow(struct ossl_verify_pool *pool)
+{
+  curl_thread_t *threads;
+  curl_thread_t th;
+
+  threads = realloc(pool->threads, (pool->nthreads + 1) * sizeof(*threads));
+  if(!threads)
+    return FALSE;
+  pool->threads = threads;
+  th = Curl_thread_create(ossl_verify_worker, pool);
+  if(th == curl_thread_t_null)
+    return FALSE;
+  pool->threads[pool->nthreads++] = th;
+  return TRUE;
+}
+
+/* Have a worker verify the chain in `ctx` for the connection. Returns
+ * FALSE when that is not possible and the chain needs to be verified
+ * right away. */
+static bool ossl_verify_job_start(struct Curl_cfilter *cf,
+                                  struct Curl_easy *data,
+                                  struct ossl_ctx *octx,
+                                  X509_STORE_CTX *ctx)
+{
+  struct ossl_verify_pool *pool = ossl_verify_pool_get(data);
+  struct ossl_verify_job *job;
+  STACK_OF(X509) *untrusted = X509_STORE_CTX_get0_untrusted(ctx);
+  size_t queued;
+  bool queued_ok = FALSE;
+
+  if(!pool)
+    return FALSE;
+  job = calloc(1, sizeof(*job));
+  if(!job)
+    return FALSE;
+  Curl_mutex_init(&job->mutx);
+  job->ref_count = 1;
+  job->sock_pair[0] = job->sock_pair[1] = CURL_SOCKET_BAD;
+  if(wakeup_create(job->sock_pair, TRUE) < 0) {
+    job->sock_pair[0] = job->sock_pair[1] = CURL_SOCKET_BAD;
+    goto out;
+  }
+
+  /* the worker's own context with the handshake's store and parameters */
+  job->store = X509_STORE_CTX_get0_store(ctx);
+  if(job->store && !X509_STORE_up_ref(job->store))
+    job->store = NULL;
+  job->cert = X509_STORE_CTX_get0_cert(ctx);
+  if(job->cert && !X509_up_ref(job->cert))
+    job->cert = NULL;
+  if(untrusted) {
+    job->untrusted = X509_chain_up_ref(untrusted);
+    if(!job->untrusted)
+      goto out;
+  }
+  job->store_ctx = X509_STORE_CTX_new();
+  if(!job->store || !job->cert || !job->store_ctx ||
+     !X509_STORE_CTX_init(job->store_ctx, job->store, job->cert,
+                          job->untrusted) ||
+     !X509_VERIFY_PARAM_set1(X509_STORE_CTX_get0_param(job->store_ctx),
+                             X509_STORE_CTX_get0_param(ctx)))
+    goto out;
+
+  Curl_mutex_acquire(&pool->mutx);
+  /* idle workers take queued jobs first, start another worker when
+   * none is left for this one */
+  queued = Curl_llist_count(&pool->queue);
+  if((queued >= pool->idle) &&
+     (pool->nthreads < data->multi->verify_threads))
+    (void)ossl_verify_pool_grow(pool);
+  if(pool->nthreads) {
+    job->ref_count++;
+    Curl_llist_append(&pool->queue, job, &job->node);
+    Curl_cond_signal(&pool->cond);
+    CURL_TRC_CF(data, cf, "certificate verification queued, %zu waiting, "
+                "%u/%u workers", Curl_llist_count(&pool->queue),
+                pool->nthreads, data->multi->verify_threads);
+    queued_ok = TRUE;
+  }
+  Curl_mutex_release(&pool->mutx);
+
+out:
+  if(!queued_ok) {
+    ossl_verify_job_unref(job);
+    ERR_clear_error();
+    return FALSE;
+  }
+  octx->verify_job = job;
+  return TRUE;
+}
+
+/* The connection no longer waits for its job. It closes the end of the
+ * socketpair the transfer polls, after telling the multi handle, and
+ * leaves the other one to the last reference. */
+static void ossl_verify_job_drop(struct Curl_easy *data,
+                                 struct ossl_ctx *octx)
+{
+  struct ossl_verify_job *job = octx->verify_job;
+
+  octx->verify_job = NULL;
+  if(job->sock_pair[0] != CURL_SOCKET_BAD) {
+    Curl_multi_will_close(data, job->sock_pair[0]);
+    wakeup_close(job->sock_pair[0]);
+    job->sock_pair[0] = CURL_SOCKET_BAD;
+  }
+  ossl_verify_job_unref(job);
+}
+
+/* TRUE when the worker has the result for the connection's job */
+UNITTEST bool ossl_verify_job_done(struct ossl_verify_job *job)
+{
+  bool done;
+
+  Curl_mutex_acquire(&job->mutx);
+  done = job->done;
+  Curl_mutex_release(&job->mutx);
+  return done;
+}
+
+/* Hand the result of the connection's job to the handshake's `ctx` */
+static int ossl_verify_job_apply(struct Curl_easy *data,
+                                 struct ossl_ctx *octx, X509_STORE_CTX *ctx)
+{
+  struct ossl_verify_job *job = octx->verify_job;
+  X509_STORE_CTX *wctx = job->store_ctx;
+  STACK_OF(X509) *chain = X509_STORE_CTX_get1_chain(wctx);
+  int verified = job->verified;
+
+  X509_STORE_CTX_set_error(ctx, X509_STORE_CTX_get_error(wctx));
+  X509_STORE_CTX_set_error_depth(ctx, X509_STORE_CTX_get_error_depth(wctx));
+  /* SSL_get0_verified_chain() returns this */
+  if(chain)
+    X509_STORE_CTX_set0_verified_chain(ctx, chain);
+  ossl_verify_job_drop(data, octx);
+  return verified;
+}
+
+/* Installed with SSL_CTX_set_cert_verify_callback(). Connections using the
+ * pool get their chain verified by a worker, all others right away. */
+UNITTEST int ossl_verify_cb(X509_STORE_CTX *ctx, void *arg)
+{
+  SSL *ssl = X509_STORE_CTX_get_ex_data(ctx,
+                                        SSL_get_ex_data_X509_STORE_CTX_idx());
+  struct Curl_cfilter *cf = ssl ? SSL_get_app_data(ssl) : NULL;
+  struct ssl_connect_data *connssl = cf ? cf->ctx : NULL;
+  struct ossl_ctx *octx = connssl ? connssl->backend : NULL;
+  struct Curl_easy *data;
+
+  (void)arg;
+  if(!octx || !octx->verify_async)
+    return X509_verify_cert(ctx);
+
+  data = CF_DATA_CURRENT(cf);
+  if(!octx->verify_job) {
+    if(!data || !data->multi ||
+       !ossl_verify_job_start(cf, data, octx, ctx))
+      return X509_verify_cert(ctx);
+  }
+  else if(ossl_verify_job_done(octx->verify_job))
+    return ossl_verify_job_apply(data, octx, ctx);
+
+  /* come back when the worker is done */
+  if(SSL_set_retry_verify(ssl))
+    return 1;
+  ossl_verify_job_drop(data, octx);
+  return X509_verify_cert(ctx);
+}
+
+/* Make the connection verify the server's certificate chain in a worker of
+ * the multi handle's pool, when that is in use. */
+static void ossl_verify_setup(struct Curl_cfilter *cf,
+                              struct Curl_easy *data,
+                              struct ossl_ctx *octx)
+{
+  /* an application's callbacks or providers might not like threads */
+  if(!data->multi || !data->multi->verify_threads ||
+     !Curl_ssl_cf_get_primary_config(cf)->verifypeer ||
+     data->set.ssl.fsslctx
+#ifdef OPENSSL_HAS_PROVIDERS
+     || data->state.libctx
+#endif
+    )
+    return;
+  /* a shared SSL_CTX may have it installed already */
+  SSL_CTX_set_cert_verify_callback(octx->ssl_ctx, ossl_verify_cb, NULL);
+  octx->verify_async = TRUE;
+}
+
+static void ossl_verify_done(struct Curl_easy *data, struct ossl_ctx *octx)
+{
+  if(octx->verify_job)
+    ossl_verify_job_drop(data, octx);
+  octx->verify_async = FALSE;
+}
+#endif /* HAVE_OSSL_VERIFY_POOL */
+
 static void ossl_close(struct Curl_cfilter *cf, struct Curl_easy *data)
 {
   struct ssl_connect_data *connssl = cf->ctx;
@@ -2240,10 +2697,14 @@ static void ossl_close(struct Curl_cfilter *cf, struct Curl_easy *data)
   DEBUGASSERT(octx);
 
   connssl->input_pending = FALSE;
+#ifdef HAVE_OSSL_VERIFY_POOL
+  ossl_verify_done(data, octx);
+#endif
   if(octx->ssl) {
     SSL_free(octx->ssl);
     octx->ssl = NULL;
   }
+  octx->ktls = FALSE;
   if(octx->ssl_ctx) {
     SSL_CTX_free(octx->ssl_ctx);
     octx->ssl_ctx = NULL;
@@ -3311,6 +3772,200 @@ static CURLcode import_windows_cert_store(struct Curl_easy *data,
 }
 #endif
 
+#ifdef HAVE_SSL_X509_STORE_SHARE
+
+/* longest line in a CA cache file, a base64 encoded certificate */
+#define MAX_CA_CACHE_FILE_LINE (64 * 1024)
+
+/* Add the line telling which CA file, at which size, modification time and
+ * SHA-256 digest of its contents, the certificates in a CA cache file are
+ * from to `buf`. The digest catches a bundle replaced within the same
+ * second by one of the same size. */
+static CURLcode ossl_ca_cache_source(const char *cafile, struct dynbuf *buf)
+{
+  unsigned char md[EVP_MAX_MD_SIZE];
+  unsigned char hex[(2 * EVP_MAX_MD_SIZE) + 1];
+  unsigned char chunk[4096];
+  unsigned int mdlen = 0;
+  EVP_MD_CTX *mdctx;
+  struct_stat st;
+  size_t nread;
+  bool ok;
+  FILE *fp;
+
+  if(stat(cafile, &st))
+    return CURLE_READ_ERROR;
+  fp = fopen(cafile, "rb");
+  if(!fp)
+    return CURLE_READ_ERROR;
+  mdctx = EVP_MD_CTX_create();
+  ok = mdctx && EVP_DigestInit_ex(mdctx, EVP_sha256(), NULL);
+  while(ok && (nread = fread(chunk, 1, sizeof(chunk), fp)) > 0)
+    ok = !!EVP_DigestUpdate(mdctx, chunk, nread);
+  ok = ok && !ferror(fp) && EVP_DigestFinal_ex(mdctx, md, &mdlen);
+  if(mdctx)
+    EVP_MD_CTX_destroy(mdctx);
+  fclose(fp);
+  if(!ok)
+    return CURLE_READ_ERROR;
+  Curl_hexencode(md, mdlen, hex, sizeof(hex));
+  return curlx_dyn_addf(buf, "source %" FMT_OFF_T " %" FMT_OFF_T " %s %s",
+                        (curl_off_t)st.st_size, (curl_off_t)st.st_mtime,
+                        hex, cafile);
+}
+
+/* Add a base64 encoded DER certificate to `store` */
+static bool ossl_ca_cache_add(X509_STORE *store, const char *line)
+{
+  unsigned char *der;
+  const unsigned char *p;
+  size_t derlen;
+  X509 *x;
+  bool ok = FALSE;
+
+  if(curlx_base64_decode(line, &der, &derlen))
+    return FALSE;
+  p = der;
+  x = d2i_X509(NULL, &p, (long)derlen);
+  if(x) {
+    ok = (p == der + derlen) && (X509_STORE_add_cert(store, x) == 1);
+    X509_free(x);
+  }
+  free(der);
+  return ok;
+}
+
+/*
+ * ossl_ca_cache_load() adds the certificates kept in CURLOPT_CA_CACHE_FILE
+ * to `store`, when that file holds those of `cafile` as it is now. This
+ * skips parsing the PEM file. Returns TRUE when certificates were added.
+ */
+static bool ossl_ca_cache_load(struct Curl_cfilter *cf,
+                               struct Curl_easy *data,
+                               X509_STORE *store, const char *cafile)
+{
+  const char *file = data->set.str[STRING_SSL_CA_CACHE_FILE];
+  struct dynbuf source;
+  size_t ncerts = 0;
+  bool ok = TRUE;
+  FILE *fp;
+
+  if(!file || !file[0] || !cafile)
+    return FALSE;
+
+  curlx_dyn_init(&source, MAX_CA_CACHE_FILE_LINE);
+  fp = ossl_ca_cache_source(cafile, &source) ?
+    NULL : fopen(file, FOPEN_READTEXT);
+  if(fp) {
+    struct dynbuf buf;
+    bool matched = FALSE;
+
+    curlx_dyn_init(&buf, MAX_CA_CACHE_FILE_LINE);
+    while(ok && Curl_get_line(&buf, fp)) {
+      const char *line = curlx_dyn_ptr(&buf);
+      size_t len = curlx_dyn_len(&buf);
+
+      while(len && ISNEWLINE(line[len - 1]))
+        len--;
+      if(!len || (line[0] == '#'))
+        continue;
+      (void)curlx_dyn_setlen(&buf, len);
+      if(!matched)
+        /* the first line says which CA file the certificates are from */
+        ok = matched = !strcmp(line, curlx_dyn_ptr(&source));
+      else if(ossl_ca_cache_add(store, line))
+        ncerts++;
+      else
+        ok = FALSE;
+    }
+    curlx_dyn_free(&buf);
+    fclose(fp);
+  }
+  curlx_dyn_free(&source);
+
+  if(!ok || !ncerts)
+    return FALSE;
+  CURL_TRC_CF(data, cf, "loaded %zu CA certificates from %s", ncerts, file);
+  infof(data, "CA certificates loaded from %s", file);
+  return TRUE;
+}
+
+/*
+ * ossl_ca_cache_save() writes the certificates in `store`, just parsed
+ * from `cafile`, to CURLOPT_CA_CACHE_FILE. Nothing is written when the
+ * store holds other objects, like CRLs, that the file does not keep.
+ */
+static void ossl_ca_cache_save(struct Curl_cfilter *cf,
+                               struct Curl_easy *data,
+                               X509_STORE *store, const char *cafile)
+{
+  const char *file = data->set.str[STRING_SSL_CA_CACHE_FILE];
+  STACK_OF(X509_OBJECT) *objs;
+  struct dynbuf source;
+  char *tempstore = NULL;
+  CURLcode result;
+  FILE *out;
+  int i, n;
+
+  if(!file || !file[0] || !cafile)
+    return;
+  objs = X509_STORE_get0_objects(store);
+  n = objs ? sk_X509_OBJECT_num(objs) : 0;
+  if(n <= 0)
+    return;
+  for(i = 0; i < n; i++) {
+    if(X509_OBJECT_get_type(sk_X509_OBJECT_value(objs, i)) != X509_LU_X509)
+      return;
+  }
+
+  curlx_dyn_init(&source, MAX_CA_CACHE_FILE_LINE);
+  result = ossl_ca_cache_source(cafile, &source);
+  if(!result)
+    result = Curl_fopen(data, file, &out, &tempstore);
+  if(result) {
+    curlx_dyn_free(&source);
+    return;
+  }
+  fprintf(out, "# Your parsed CA certificates.\n"
+          "# This file was generated by libcurl! Edit at your own risk.\n"
+          "%s\n", curlx_dyn_ptr(&source));
+  for(i = 0; !result && (i < n); i++) {
+    X509 *x = X509_OBJECT_get0_X509(sk_X509_OBJECT_value(objs, i));
+    unsigned char *der = NULL;
+    char *b64;
+    size_t b64len;
+    int len = i2d_X509(x, &der);
+
+    if(len <= 0) {
+      result = CURLE_OUT_OF_MEMORY;
+      break;
+    }
+    result = curlx_base64_encode((const char *)der, (size_t)len,
+                                 &b64, &b64len);
+    OPENSSL_free(der);
+    if(!result) {
+      fprintf(out, "%s\n", b64);
+      free(b64);
+    }
+  }
+  if(!result && ferror(out))
+    result = CURLE_WRITE_ERROR;
+  fclose(out);
+  if(!result && tempstore && Curl_rename(tempstore, file))
+    result = CURLE_WRITE_ERROR;
+  if(result && tempstore)
+    unlink(tempstore);
+  free(tempstore);
+  curlx_dyn_free(&source);
+  if(!result)
+    CURL_TRC_CF(data, cf, "saved %d CA certificates to %s", n, file);
+}
+
+#else /* HAVE_SSL_X509_STORE_SHARE */
+#define ossl_ca_cache_load(a,b,c,d) FALSE
+#define ossl_ca_cache_save(a,b,c,d) Curl_nop_stmt
+#endif /* !HAVE_SSL_X509_STORE_SHARE */
+
 static CURLcode ossl_populate_x509_store(struct Curl_cfilter *cf,
                                          struct Curl_easy *data,
                                          X509_STORE *store)
@@ -3376,9 +4031,15 @@ static CURLcode ossl_populate_x509_store(struct Curl_cfilter *cf,
     }
 
     if(ssl_cafile || ssl_capath) {
+      /* with the certificates of the CA file taken from the cache file,
+         the CA file itself is not parsed */
+      const char *cafile =
+        ossl_ca_cache_load(cf, data, store, ssl_cafile) ? NULL : ssl_cafile;
+      /* the cache file can only keep what was loaded from the CA file */
+      const bool save_cafile = cafile && !imported_native_ca;
 #ifdef HAVE_OPENSSL3
       /* OpenSSL 3.0.0 has deprecated SSL_CTX_load_verify_locations */
-      if(ssl_cafile && !X509_STORE_load_file(store, ssl_cafile)) {
+      if(cafile && !X509_STORE_load_file(store, cafile)) {
         if(!imported_native_ca && !imported_ca_info_blob) {
           /* Fail if we insist on successfully verifying the server. */
           failf(data, "error setting certificate file: %s", ssl_cafile);
@@ -3387,6 +4048,8 @@ static CURLcode ossl_populate_x509_store(struct Curl_cfilter *cf,
         else
           infof(data, "error setting certificate file, continuing anyway");
       }
+      else if(save_cafile)
+        ossl_ca_cache_save(cf, data, store, cafile);
       if(ssl_capath && !X509_STORE_load_path(store, ssl_capath)) {
         if(!imported_native_ca && !imported_ca_info_blob) {
           /* Fail if we insist on successfully verifying the server. */
@@ -3399,7 +4062,8 @@ static CURLcode ossl_populate_x509_store(struct Curl_cfilter *cf,
 #else
       /* tell OpenSSL where to find CA certificates that are used to verify the
          server's certificate. */
-      if(!X509_STORE_load_locations(store, ssl_cafile, ssl_capath)) {
+      if((cafile || ssl_capath) &&
+         !X509_STORE_load_locations(store, cafile, ssl_capath)) {
         if(!imported_native_ca && !imported_ca_info_blob) {
           /* Fail if we insist on successfully verifying the server. */
           failf(data, "error setting certificate verify locations:"
@@ -3413,6 +4077,8 @@ static CURLcode ossl_populate_x509_store(struct Curl_cfilter *cf,
                 " continuing anyway");
         }
       }
+      else if(save_cafile)
+        ossl_ca_cache_save(cf, data, store, cafile);
 #endif
       infof(data, " CAfile: %s", ssl_cafile ? ssl_cafile : "none");
       infof(data, " CApath: %s", ssl_capath ? ssl_capath : "none");
@@ -3470,9 +4136,28 @@ static CURLcode ossl_populate_x509_store(struct Curl_cfilter *cf,
   return result;
 }
 
+#if defined(HAVE_SSL_X509_STORE_SHARE) || defined(HAVE_SSL_CTX_SHARE)
+/* Return TRUE when something loaded from the CA sources at `created` is
+ * too old to be used by `data` */
+static bool ossl_ca_cache_expired(const struct Curl_easy *data,
+                                  struct curltime created)
+{
+  const struct ssl_general_config *cfg = &data->set.general_ssl;
+  if(cfg->ca_cache_timeout < 0)
+    return FALSE;
+  else {
+    struct curltime now = curlx_now();
+    timediff_t elapsed_ms = curlx_timediff(now, created);
+    timediff_t timeout_ms = cfg->ca_cache_timeout * (timediff_t)1000;
+
+    return elapsed_ms >= timeout_ms;
+  }
+}
+#endif
+
 #ifdef HAVE_SSL_X509_STORE_SHARE
 
-/* key to use at `multi->proto_hash` */
+/* key to use at `multi->proto_hash` or `share->proto_hash` */
 #define MPROTO_OSSL_X509_KEY   "tls:ossl:x509:share"
 
 struct ossl_x509_share {
@@ -3499,16 +4184,7 @@ static bool
 ossl_cached_x509_store_expired(const struct Curl_easy *data,
                                const struct ossl_x509_share *mb)
 {
-  const struct ssl_general_config *cfg = &data->set.general_ssl;
-  if(cfg->ca_cache_timeout < 0)
-    return FALSE;
-  else {
-    struct curltime now = curlx_now();
-    timediff_t elapsed_ms = curlx_timediff(now, mb->time);
-    timediff_t timeout_ms = cfg->ca_cache_timeout * (timediff_t)1000;
-
-    return elapsed_ms >= timeout_ms;
-  }
+  return ossl_ca_cache_expired(data, mb->time);
 }
 
 static bool
@@ -3522,74 +4198,95 @@ ossl_cached_x509_store_different(struct Curl_cfilter *cf,
   return strcmp(mb->CAfile, conn_config->CAfile);
 }
 
+/* The hash the X509 store is cached in: the one of the share when it
+ * shares CA certificates, the one of the multi handle otherwise. */
+static struct Curl_hash *ossl_x509_share_hash(struct Curl_easy *data)
+{
+  if(CURL_SHARE_ssl_ca(data))
+    return &data->share->proto_hash;
+  DEBUGASSERT(data->multi);
+  return data->multi ? &data->multi->proto_hash : NULL;
+}
+
+/* Return the cached X509 store with a reference taken or NULL */
 static X509_STORE *ossl_get_cached_x509_store(struct Curl_cfilter *cf,
-                                              const struct Curl_easy *data)
+                                              struct Curl_easy *data)
 {
-  struct Curl_multi *multi = data->multi;
+  struct Curl_hash *hash = ossl_x509_share_hash(data);
   struct ossl_x509_share *share;
   X509_STORE *store = NULL;
 
-  DEBUGASSERT(multi);
-  share = multi ? Curl_hash_pick(&multi->proto_hash,
-                                 CURL_UNCONST(MPROTO_OSSL_X509_KEY),
-                                 sizeof(MPROTO_OSSL_X509_KEY)-1) : NULL;
+  if(!hash)
+    return NULL;
+  if(CURL_SHARE_ssl_ca(data))
+    Curl_share_lock(data, CURL_LOCK_DATA_CA, CURL_LOCK_ACCESS_SHARED);
+  share = Curl_hash_pick(hash, CURL_UNCONST(MPROTO_OSSL_X509_KEY),
+                         sizeof(MPROTO_OSSL_X509_KEY)-1);
   if(share && share->store &&
      !ossl_cached_x509_store_expired(data, share) &&
-     !ossl_cached_x509_store_different(cf, share)) {
+     !ossl_cached_x509_store_different(cf, share) &&
+     X509_STORE_up_ref(share->store)) {
     store = share->store;
   }
+  if(CURL_SHARE_ssl_ca(data))
+    Curl_share_unlock(data, CURL_LOCK_DATA_CA);
 
   return store;
 }
 
 static void ossl_set_cached_x509_store(struct Curl_cfilter *cf,
-                                       const struct Curl_easy *data,
+                                       struct Curl_easy *data,
                                        X509_STORE *store)
 {
   struct ssl_primary_config *conn_config = Curl_ssl_cf_get_primary_config(cf);
-  struct Curl_multi *multi = data->multi;
+  struct Curl_hash *hash = ossl_x509_share_hash(data);
   struct ossl_x509_share *share;
+  char *CAfile = NULL;
 
-  DEBUGASSERT(multi);
-  if(!multi)
+  if(!hash)
     return;
-  share = Curl_hash_pick(&multi->proto_hash,
-                         CURL_UNCONST(MPROTO_OSSL_X509_KEY),
-                         sizeof(MPROTO_OSSL_X509_KEY)-1);
+  if(conn_config->CAfile) {
+    CAfile = strdup(conn_config->CAfile);
+    if(!CAfile)
+      return;
+  }
+  if(!X509_STORE_up_ref(store)) {
+    free(CAfile);
+    return;
+  }
 
+  if(CURL_SHARE_ssl_ca(data))
+    Curl_share_lock(data, CURL_LOCK_DATA_CA, CURL_LOCK_ACCESS_SINGLE);
+  share = Curl_hash_pick(hash, CURL_UNCONST(MPROTO_OSSL_X509_KEY),
+                         sizeof(MPROTO_OSSL_X509_KEY)-1);
   if(!share) {
     share = calloc(1, sizeof(*share));
-    if(!share)
-      return;
-    if(!Curl_hash_add2(&multi->proto_hash,
-                       CURL_UNCONST(MPROTO_OSSL_X509_KEY),
+    if(share &&
+       !Curl_hash_add2(hash, CURL_UNCONST(MPROTO_OSSL_X509_KEY),
                        sizeof(MPROTO_OSSL_X509_KEY)-1,
                        share, oss_x509_share_free)) {
       free(share);
-      return;
+      share = NULL;
     }
   }
 
-  if(X509_STORE_up_ref(store)) {
-    char *CAfile = NULL;
-
-    if(conn_config->CAfile) {
-      CAfile = strdup(conn_config->CAfile);
-      if(!CAfile) {
-        X509_STORE_free(store);
-        return;
-      }
-    }
-
+  if(share) {
     if(share->store) {
       X509_STORE_free(share->store);
       free(share->CAfile);
     }
-
     share->time = curlx_now();
     share->store = store;
     share->CAfile = CAfile;
+    store = NULL;
+    CAfile = NULL;
   }
+  if(CURL_SHARE_ssl_ca(data))
+    Curl_share_unlock(data, CURL_LOCK_DATA_CA);
+
+  if(store)
+    X509_STORE_free(store);
+  free(CAfile);
 }
 
 CURLcode Curl_ssl_setup_x509_store(struct Curl_cfilter *cf,
@@ -3614,8 +4311,10 @@ CURLcode Curl_ssl_setup_x509_store(struct Curl_cfilter *cf,
 
   ERR_set_mark();
 
-  cached_store = ossl_get_cached_x509_store(cf, data);
-  if(cached_store && cache_criteria_met && X509_STORE_up_ref(cached_store)) {
+  cached_store = cache_criteria_met ?
+    ossl_get_cached_x509_store(cf, data) : NULL;
+  if(cached_store) {
+    /* takes over the reference */
     SSL_CTX_set_cert_store(ssl_ctx, cached_store);
   }
   else {
@@ -3650,6 +4349,174 @@ CURLcode Curl_ssl_setup_x509_store(struct Curl_cfilter *cf,
 }
 #endif /* HAVE_SSL_X509_STORE_SHARE */
 
+#ifdef HAVE_SSL_CTX_SHARE
+
+/* key to use at `multi->proto_hash` */
+#define MPROTO_OSSL_CTX_KEY   "tls:ossl:ctx:share"
+
+/* the most SSL_CTX a multi handle keeps */
+#define OSSL_CTX_SHARE_MAX    8
+
+/* An SSL_CTX, with the x509 store set up, for connections using `config` */
+struct ossl_ctx_entry {
+  struct Curl_llist_node node;
+  struct ssl_primary_config config;
+  SSL_CTX *ssl_ctx;
+  struct curltime time; /* when the x509 store was set up */
+};
+
+struct ossl_ctx_share {
+  struct Curl_llist entries; /* least recently used first */
+};
+
+static void ossl_ctx_entry_free(void *user, void *p)
+{
+  struct ossl_ctx_entry *entry = p;
+  (void)user;
+  SSL_CTX_free(entry->ssl_ctx);
+  Curl_ssl_primary_config_free(&entry->config);
+  free(entry);
+}
+
+static void oss_ctx_share_free(void *key, size_t key_len, void *p)
+{
+  struct ossl_ctx_share *share = p;
+  DEBUGASSERT(key_len == (sizeof(MPROTO_OSSL_CTX_KEY)-1));
+  DEBUGASSERT(!memcmp(MPROTO_OSSL_CTX_KEY, key, key_len));
+  (void)key;
+  (void)key_len;
+  Curl_llist_destroy(&share->entries, NULL);
+  free(share);
+}
+
+static struct ossl_ctx_share *ossl_ctx_share_get(const struct Curl_easy *data)
+{
+  return Curl_hash_pick(&data->multi->proto_hash,
+                        CURL_UNCONST(MPROTO_OSSL_CTX_KEY),
+                        sizeof(MPROTO_OSSL_CTX_KEY)-1);
+}
+
+/* Return TRUE if an SSL_CTX for the connection is made from its primary
+ * SSL config alone, so that other connections with the same may use it. */
+static bool ossl_ctx_shareable(struct Curl_cfilter *cf,
+                               struct Curl_easy *data,
+                               struct ssl_peer *peer,
+                               Curl_ossl_ctx_setup_cb *cb_setup,
+                               Curl_ossl_new_session_cb *cb_new_session)
+{
+  struct ssl_config_data *ssl_config = Curl_ssl_cf_get_config(cf, data);
+
+  if(!data->multi || cb_setup || (cb_new_session != ossl_new_session_cb) ||
+     (peer->transport != TRNSPRT_TCP) ||
+     !data->set.general_ssl.ca_cache_timeout || ssl_config->fsslctx)
+    return FALSE;
+  /* client certificates and keys may come with more than the config has */
+  if(ssl_config->primary.clientcert || ssl_config->primary.cert_blob ||
+     ssl_config->cert_type || ssl_config->key || ssl_config->key_blob)
+    return FALSE;
+#if defined(HAVE_OPENSSL_SRP) && defined(USE_TLS_SRP)
+  if(ssl_config->primary.username)
+    return FALSE;
+#endif
+#ifdef OPENSSL_HAS_PROVIDERS
+  if(data->state.libctx)
+    return FALSE;
+#endif
+  return TRUE;
+}
+
+/* Return a reference to a set up SSL_CTX for the connection or NULL */
+static SSL_CTX *ossl_ctx_share_take(struct Curl_cfilter *cf,
+                                    struct Curl_easy *data)
+{
+  struct ssl_primary_config *conn_config = Curl_ssl_cf_get_primary_config(cf);
+  struct ossl_ctx_share *share = ossl_ctx_share_get(data);
+  struct Curl_llist_node *e, *n;
+
+  if(!share)
+    return NULL;
+  for(e = Curl_llist_head(&share->entries); e; e = n) {
+    struct ossl_ctx_entry *entry = Curl_node_elem(e);
+    n = Curl_node_next(e);
+    if(ossl_ca_cache_expired(data, entry->time))
+      Curl_node_remove(e);
+    else if(Curl_ssl_primary_config_match(data, &entry->config,
+                                          conn_config) &&
+            SSL_CTX_up_ref(entry->ssl_ctx)) {
+      Curl_node_take_elem(e);
+      Curl_llist_append(&share->entries, entry, &entry->node);
+      return entry->ssl_ctx;
+    }
+  }
+  return NULL;
+}
+
+/* Keep the SSL_CTX, now with its x509 store, for the connections to come */
+static void ossl_ctx_share_add(struct Curl_cfilter *cf,
+                               struct Curl_easy *data,
+                               SSL_CTX *ssl_ctx)
+{
+  struct ssl_primary_config *conn_config = Curl_ssl_cf_get_primary_config(cf);
+  struct ossl_ctx_share *share = ossl_ctx_share_get(data);
+  struct ossl_ctx_entry *entry;
+  struct Curl_llist_node *e, *n;
+
+  if(!share) {
+    share = calloc(1, sizeof(*share));
+    if(!share)
+      return;
+    Curl_llist_init(&share->entries, ossl_ctx_entry_free);
+    if(!Curl_hash_add2(&data->multi->proto_hash,
+                       CURL_UNCONST(MPROTO_OSSL_CTX_KEY),
+                       sizeof(MPROTO_OSSL_CTX_KEY)-1,
+                       share, oss_ctx_share_free)) {
+      free(share);
+      return;
+    }
+  }
+
+  entry = calloc(1, sizeof(*entry));
+  if(!entry)
+    return;
+  if(!Curl_ssl_primary_config_clone(conn_config, &entry->config) ||
+     !SSL_CTX_up_ref(ssl_ctx)) {
+    Curl_ssl_primary_config_free(&entry->config);
+    free(entry);
+    return;
+  }
+  entry->ssl_ctx = ssl_ctx;
+  entry->time = curlx_now();
+
+  /* replace one made by a connection set up at the same time */
+  for(e = Curl_llist_head(&share->entries); e; e = n) {
+    struct ossl_ctx_entry *other = Curl_node_elem(e);
+    n = Curl_node_next(e);
+    if(Curl_ssl_primary_config_match(data, &other->config, conn_config))
+      Curl_node_remove(e);
+  }
+  Curl_llist_append(&share->entries, entry, &entry->node);
+  while(Curl_llist_count(&share->entries) > OSSL_CTX_SHARE_MAX)
+    Curl_node_remove(Curl_llist_head(&share->entries));
+}
+#endif /* HAVE_SSL_CTX_SHARE */
+
+static CURLcode ossl_setup_x509_store(struct Curl_cfilter *cf,
+                                      struct Curl_easy *data,
+                                      struct ossl_ctx *octx)
+{
+  CURLcode result = Curl_ssl_setup_x509_store(cf, data, octx->ssl_ctx);
+  if(!result) {
+    octx->x509_store_setup = TRUE;
+#ifdef HAVE_SSL_CTX_SHARE
+    if(octx->ssl_ctx_share) {
+      ossl_ctx_share_add(cf, data, octx->ssl_ctx);
+      octx->ssl_ctx_share = FALSE;
+    }
+#endif
+  }
+  return result;
+}
+
 
 static CURLcode
 ossl_init_session_and_alpns(struct ossl_ctx *octx,
@@ -3692,7 +4559,7 @@ ossl_init_session_and_alpns(struct ossl_ctx *octx,
                 scs->alpn ? scs->alpn : "-");
           octx->reused_session = TRUE;
 #ifdef HAVE_OPENSSL_EARLYDATA
-          if(ssl_config->earlydata && scs->alpn &&
+          if(Curl_ssl_cf_want_earlydata(cf, data) && scs->alpn &&
              SSL_SESSION_get_max_early_data(ssl_session) &&
              !cf->conn->connect_only &&
              (SSL_version(octx->ssl) == TLS1_3_VERSION)) {
@@ -4006,6 +4873,7 @@ CURLcode Curl_ossl_ctx_init(struct ossl_ctx *octx,
   const char * const ssl_cert_type = ssl_config->cert_type;
   const bool verifypeer = conn_config->verifypeer;
   unsigned int ssl_version_min;
+  bool ssl_ctx_share = FALSE;
   char error_buffer[256];
 
   /* Make funny stuff to get random input */
@@ -4021,6 +4889,21 @@ CURLcode Curl_ossl_ctx_init(struct ossl_ctx *octx,
   DEBUGASSERT(req_method);
 
   DEBUGASSERT(!octx->ssl_ctx);
+#ifdef HAVE_SSL_CTX_SHARE
+  ssl_ctx_share = ossl_ctx_shareable(cf, data, peer, cb_setup,
+                                     cb_new_session);
+  if(ssl_ctx_share) {
+    octx->ssl_ctx = ossl_ctx_share_take(cf, data);
+    if(octx->ssl_ctx) {
+      /* set up for a previous connection, store included */
+      CURL_TRC_CF(data, cf, "reusing SSL_CTX set up before");
+      octx->x509_store_setup = TRUE;
+      goto init_ssl;
+    }
+    /* keep it for others once its x509 store is set up */
+    octx->ssl_ctx_share = TRUE;
+  }
+#endif
   octx->ssl_ctx =
 #ifdef OPENSSL_HAS_PROVIDERS
     data->state.libctx ?
@@ -4040,7 +4923,7 @@ CURLcode Curl_ossl_ctx_init(struct ossl_ctx *octx,
       return result;
   }
 
-  if(data->set.fdebug && data->set.verbose) {
+  if(data->set.fdebug && data->set.verbose && !ssl_ctx_share) {
     /* the SSL trace callback is only used for verbose logging */
     SSL_CTX_set_msg_callback(octx->ssl_ctx, ossl_trace);
     SSL_CTX_set_msg_callback_arg(octx->ssl_ctx, cf);
@@ -4284,8 +5167,17 @@ CURLcode Curl_ossl_ctx_init(struct ossl_ctx *octx,
     }
   }
 
-  return ossl_init_ssl(octx, cf, data, peer, alpns_requested,
-                       ssl_user_data, sess_reuse_cb);
+#ifdef HAVE_SSL_CTX_SHARE
+init_ssl:
+#endif
+  result = ossl_init_ssl(octx, cf, data, peer, alpns_requested,
+                         ssl_user_data, sess_reuse_cb);
+  if(!result && ssl_ctx_share && data->set.fdebug && data->set.verbose) {
+    /* a shared SSL_CTX is used by other connections, trace on this one */
+    SSL_set_msg_callback(octx->ssl, ossl_trace);
+    SSL_set_msg_callback_arg(octx->ssl, cf);
+  }
+  return result;
 }
 
 static CURLcode ossl_on_session_reuse(struct Curl_cfilter *cf,
@@ -4342,6 +5234,12 @@ void Curl_ossl_report_handshake(struct Curl_easy *data,
           SSL_get_cipher(octx->ssl),
           negotiated_group_name ? negotiated_group_name : "[blank]",
           OBJ_nid2sn(psigtype_nid));
+#ifdef USE_OPENSSL_KTLS
+    if(octx->ktls)
+      infof(data, "SSL kernel offload: send %s, receive %s",
+            BIO_get_ktls_send(SSL_get_wbio(octx->ssl)) ? "on" : "off",
+            BIO_get_ktls_recv(SSL_get_rbio(octx->ssl)) ? "on" : "off");
+#endif
   }
 #else
   (void)data;
@@ -4350,23 +5248,70 @@ void Curl_ossl_report_handshake(struct Curl_easy *data,
 
 }
 
-static CURLcode ossl_connect_step1(struct Curl_cfilter *cf,
-                                   struct Curl_easy *data)
+#ifdef USE_OPENSSL_KTLS
+/* For kernel TLS, OpenSSL needs to operate on the TCP socket itself. This
+ * works when all filters between us and the socket pass data unchanged,
+ * e.g. happy eyeballs or an established HTTP/1 proxy tunnel. */
+static bool ossl_ktls_socket(struct Curl_cfilter *cf,
+                             struct Curl_easy *data,
+                             curl_socket_t *psock)
+{
+  struct Curl_cfilter *cf_sock = cf->next;
+
+  while(cf_sock && cf_sock->connected &&
+        (cf_sock->cft->do_send == Curl_cf_def_send) &&
+        (cf_sock->cft->do_recv == Curl_cf_def_recv))
+    cf_sock = cf_sock->next;
+
+  if(!cf_sock || !cf_sock->connected || (cf_sock->cft != &Curl_cft_tcp))
+    return FALSE;
+  return !Curl_cf_socket_peek(cf_sock, data, psock, NULL, NULL) &&
+         (*psock != CURL_SOCKET_BAD);
+}
+
+static CURLcode ossl_ktls_setup(struct Curl_cfilter *cf,
+                                struct Curl_easy *data,
+                                bool *pdone)
 {
   struct ssl_connect_data *connssl = cf->ctx;
   struct ossl_ctx *octx = (struct ossl_ctx *)connssl->backend;
-  BIO *bio;
+  struct ssl_config_data *ssl_config = Curl_ssl_cf_get_config(cf, data);
+  curl_socket_t sock;
   CURLcode result;
 
-  DEBUGASSERT(ssl_connect_1 == connssl->connecting_state);
-  DEBUGASSERT(octx);
+  *pdone = FALSE;
+  if(!ssl_config->ktls)
+    return CURLE_OK;
+  if(!ossl_ktls_socket(cf, data, &sock)) {
+    CURL_TRC_CF(data, cf, "kTLS not possible on this connection");
+    return CURLE_OK;
+  }
 
-  result = Curl_ossl_ctx_init(octx, cf, data, &connssl->peer,
-                              connssl->alpn, NULL, NULL,
-                              ossl_new_session_cb, cf,
-                              ossl_on_session_reuse);
-  if(result)
-    return result;
+  /* OpenSSL reads the socket directly, the store is needed upfront */
+  if(!octx->x509_store_setup) {
+    result = ossl_setup_x509_store(cf, data, octx);
+    if(result)
+      return result;
+  }
+
+  if(!SSL_set_fd(octx->ssl, (int)sock)) {
+    failf(data, "SSL: failed to set socket for kTLS");
+    return CURLE_SSL_CONNECT_ERROR;
+  }
+  SSL_set_options(octx->ssl, SSL_OP_ENABLE_KTLS);
+  octx->ktls = TRUE;
+  *pdone = TRUE;
+  CURL_TRC_CF(data, cf, "kTLS requested, SSL uses socket %" FMT_SOCKET_T,
+              sock);
+  return CURLE_OK;
+}
+#endif /* USE_OPENSSL_KTLS */
+
+static CURLcode ossl_set_cf_bio(struct Curl_cfilter *cf)
+{
+  struct ssl_connect_data *connssl = cf->ctx;
+  struct ossl_ctx *octx = (struct ossl_ctx *)connssl->backend;
+  BIO *bio;
 
   octx->bio_method = ossl_bio_cf_method_create();
   if(!octx->bio_method)
@@ -4388,6 +5333,40 @@ static CURLcode ossl_connect_step1(struct Curl_cfilter *cf,
 #else
   SSL_set_bio(octx->ssl, bio, bio);
 #endif
+  return CURLE_OK;
+}
+
+static CURLcode ossl_connect_step1(struct Curl_cfilter *cf,
+                                   struct Curl_easy *data)
+{
+  struct ssl_connect_data *connssl = cf->ctx;
+  struct ossl_ctx *octx = (struct ossl_ctx *)connssl->backend;
+  bool sock_io = FALSE;
+  CURLcode result;
+
+  DEBUGASSERT(ssl_connect_1 == connssl->connecting_state);
+  DEBUGASSERT(octx);
+
+  result = Curl_ossl_ctx_init(octx, cf, data, &connssl->peer,
+                              connssl->alpn, NULL, NULL,
+                              ossl_new_session_cb, cf,
+                              ossl_on_session_reuse);
+  if(result)
+    return result;
+#ifdef HAVE_OSSL_VERIFY_POOL
+  ossl_verify_setup(cf, data, octx);
+#endif
+
+#ifdef USE_OPENSSL_KTLS
+  result = ossl_ktls_setup(cf, data, &sock_io);
+  if(result)
+    return result;
+#endif
+  if(!sock_io) {
+    result = ossl_set_cf_bio(cf);
+    if(result)
+      return result;
+  }
 
 #ifdef HAS_ALPN_OPENSSL
   if(connssl->alpn && (connssl->state != ssl_connection_deferred)) {
@@ -4470,21 +5449,27 @@ static CURLcode ossl_connect_step2(struct Curl_cfilter *cf,
   struct ssl_connect_data *connssl = cf->ctx;
   struct ossl_ctx *octx = (struct ossl_ctx *)connssl->backend;
   struct ssl_config_data *ssl_config = Curl_ssl_cf_get_config(cf, data);
+  OSSL_NOSIG_VARIABLE(nosig);
   DEBUGASSERT(ssl_connect_2 == connssl->connecting_state);
   DEBUGASSERT(octx);
 
   connssl->io_need = CURL_SSL_IO_NEED_NONE;
+#ifdef HAVE_OSSL_VERIFY_POOL
+  if(octx->verify_job && !ossl_verify_job_done(octx->verify_job))
+    return CURLE_AGAIN; /* the worker is not done yet */
+#endif
   ERR_clear_error();
 
+  ossl_nosig_start(data, octx, &nosig);
   err = SSL_connect(octx->ssl);
+  ossl_nosig_end(&nosig);
 
   if(!octx->x509_store_setup) {
     /* After having send off the ClientHello, we prepare the x509
      * store to verify the coming certificate from the server */
-    CURLcode result = Curl_ssl_setup_x509_store(cf, data, octx->ssl_ctx);
+    CURLcode result = ossl_setup_x509_store(cf, data, octx);
     if(result)
       return result;
-    octx->x509_store_setup = TRUE;
   }
 
 #ifndef HAVE_KEYLOG_CALLBACK
@@ -4520,6 +5505,13 @@ static CURLcode ossl_connect_step2(struct Curl_cfilter *cf,
     }
 #endif
 #ifdef SSL_ERROR_WANT_RETRY_VERIFY
+#ifdef HAVE_OSSL_VERIFY_POOL
+    if((SSL_ERROR_WANT_RETRY_VERIFY == detail) && octx->verify_job) {
+      CURL_TRC_CF(data, cf, "SSL_connect() -> verifying certificate");
+      connssl->io_need = CURL_SSL_IO_NEED_NONE;
+      return CURLE_AGAIN;
+    }
+#endif
     if(SSL_ERROR_WANT_RETRY_VERIFY == detail) {
       CURL_TRC_CF(data, cf, "SSL_connect() -> want retry_verify");
       Curl_xfer_pause_recv(data, TRUE);
@@ -5073,12 +6065,15 @@ static CURLcode ossl_send_earlydata(struct Curl_cfilter *cf,
   const unsigned char *buf;
   size_t blen, nwritten;
   int rc;
+  OSSL_NOSIG_VARIABLE(nosig);
 
   DEBUGASSERT(connssl->earlydata_state == ssl_earlydata_sending);
   octx->io_result = CURLE_OK;
   while(Curl_bufq_peek(&connssl->earlydata, &buf, &blen)) {
     nwritten = 0;
+    ossl_nosig_start(data, octx, &nosig);
     rc = SSL_write_early_data(octx->ssl, buf, blen, &nwritten);
+    ossl_nosig_end(&nosig);
     CURL_TRC_CF(data, cf, "SSL_write_early_data(len=%zu) -> %d, %zu",
                 blen, rc, nwritten);
     if(rc <= 0) {
@@ -5224,6 +6219,14 @@ static bool ossl_data_pending(struct Curl_cfilter *cf,
 {
   struct ssl_connect_data *connssl = cf->ctx;
   (void)data;
+#ifdef USE_OPENSSL_KTLS
+  {
+    struct ossl_ctx *octx = (struct ossl_ctx *)connssl->backend;
+    /* no BIO of ours tells us about input, ask for decrypted data */
+    if(octx && octx->ktls && octx->ssl)
+      return SSL_pending(octx->ssl) > 0;
+  }
+#endif
   return connssl->input_pending;
 }
 
@@ -5243,6 +6246,7 @@ static CURLcode ossl_send(struct Curl_cfilter *cf,
   struct ossl_ctx *octx = (struct ossl_ctx *)connssl->backend;
   CURLcode result = CURLE_OK;
   int nwritten;
+  OSSL_NOSIG_VARIABLE(nosig);
 
   (void)data;
   DEBUGASSERT(octx);
@@ -5262,7 +6266,9 @@ static CURLcode ossl_send(struct Curl_cfilter *cf,
     memlen = octx->blocked_ssl_write_len;
   }
   octx->blocked_ssl_write_len = 0;
+  ossl_nosig_start(data, octx, &nosig);
   nwritten = SSL_write(octx->ssl, mem, memlen);
+  ossl_nosig_end(&nosig);
 
   if(nwritten > 0)
     *pnwritten = (size_t)nwritten;
@@ -5639,6 +6645,23 @@ static bool ossl_cert_status_request(void)
 #endif
 }
 
+#ifdef HAVE_OSSL_VERIFY_POOL
+static CURLcode ossl_adjust_pollset(struct Curl_cfilter *cf,
+                                    struct Curl_easy *data,
+                                    struct easy_pollset *ps)
+{
+  struct ssl_connect_data *connssl = cf->ctx;
+  struct ossl_ctx *octx = (struct ossl_ctx *)connssl->backend;
+
+  /* wait for the worker verifying the certificate, not the socket */
+  if(octx && octx->verify_job)
+    return Curl_pollset_add_in(data, ps, octx->verify_job->sock_pair[0]);
+  return Curl_ssl_adjust_pollset(cf, data, ps);
+}
+#else
+#define ossl_adjust_pollset Curl_ssl_adjust_pollset
+#endif
+
 static void *ossl_get_internals(struct ssl_connect_data *connssl,
                                 CURLINFO info)
 {
@@ -5680,7 +6703,7 @@ const struct Curl_ssl Curl_ssl_openssl = {
   ossl_random,              /* random */
   ossl_cert_status_request, /* cert_status_request */
   ossl_connect,             /* connect */
-  Curl_ssl_adjust_pollset,  /* adjust_pollset */
+  ossl_adjust_pollset,      /* adjust_pollset */
   ossl_get_internals,       /* get_internals */
   ossl_close,               /* close_one */
   ossl_close_all,           /* close_all */
@@ -62,11 +62,31 @@
 #define HAVE_OPENSSL_EARLYDATA
 #endif
 
+/* Kernel TLS offload, OpenSSL 3.0+ built with kTLS support */
+#if defined(HAVE_OPENSSL3) && defined(SSL_OP_ENABLE_KTLS) && \
+  !defined(OPENSSL_NO_KTLS)
+#define USE_OPENSSL_KTLS
+#endif
+
+/*
+ * Whether the OpenSSL version has the API needed to verify the server's
+ * certificate chain in a worker thread while the handshake waits. The API is:
+ * * `SSL_set_retry_verify`    -- Introduced: OpenSSL 3.0.
+ */
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L && \
+  defined(SSL_ERROR_WANT_RETRY_VERIFY) && \
+  (defined(USE_THREADS_POSIX) || defined(USE_THREADS_WIN32)) && \
+  !defined(CURL_DISABLE_SOCKETPAIR)
+#define HAVE_OSSL_VERIFY_POOL
+#endif
+
 struct alpn_spec;
 struct ssl_peer;
 struct Curl_ssl_session;
 
 /* Struct to hold a curl OpenSSL instance */
+struct ossl_verify_job;
+
 struct ossl_ctx {
   /* these ones requires specific SSL-types */
   SSL_CTX* ssl_ctx;
@@ -82,7 +102,11 @@ struct ossl_ctx {
   bool keylog_done;
 #endif
   BIT(x509_store_setup);            /* x509 store has been set up */
+  BIT(ssl_ctx_share);               /* share ssl_ctx once store is set up */
   BIT(reused_session);              /* session-ID was reused for this */
+  struct ossl_verify_job *verify_job; /* certificate check in a worker */
+  BIT(ktls);                        /* SSL does socket IO itself for kTLS */
+  BIT(verify_async);                /* check certificates in a worker */
 };
 
 size_t Curl_ossl_version(char *buffer, size_t size);
@@ -154,5 +178,10 @@ CURLcode Curl_ossl_check_peer_cert(struct Curl_cfilter *cf,
 void Curl_ossl_report_handshake(struct Curl_easy *data,
                                 struct ossl_ctx *octx);
 
+#if defined(UNITTESTS) && defined(HAVE_OSSL_VERIFY_POOL)
+UNITTEST bool ossl_verify_job_done(struct ossl_verify_job *job);
+UNITTEST int ossl_verify_cb(X509_STORE_CTX *ctx, void *arg);
+#endif
+
 #endif /* USE_OPENSSL */
 #endif /* HEADER_CURL_SSLUSE_H */
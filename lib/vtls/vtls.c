@@ -188,10 +188,9 @@ void Curl_ssl_easy_config_init(struct Curl_easy *data)
 #endif
 }
 
-static bool
-match_ssl_primary_config(struct Curl_easy *data,
-                         struct ssl_primary_config *c1,
-                         struct ssl_primary_config *c2)
+bool Curl_ssl_primary_config_match(struct Curl_easy *data,
+                                   struct ssl_primary_config *c1,
+                                   struct ssl_primary_config *c2)
 {
   (void)data;
   if((c1->version == c2->version) &&
@@ -228,17 +227,17 @@ bool Curl_ssl_conn_config_match(struct Curl_easy *data,
 {
 #ifndef CURL_DISABLE_PROXY
   if(proxy)
-    return match_ssl_primary_config(data, &data->set.proxy_ssl.primary,
-                                    &candidate->proxy_ssl_config);
+    return Curl_ssl_primary_config_match(data, &data->set.proxy_ssl.primary,
+                                         &candidate->proxy_ssl_config);
 #else
   (void)proxy;
 #endif
-  return match_ssl_primary_config(data, &data->set.ssl.primary,
-                                  &candidate->ssl_config);
+  return Curl_ssl_primary_config_match(data, &data->set.ssl.primary,
+                                       &candidate->ssl_config);
 }
 
-static bool clone_ssl_primary_config(struct ssl_primary_config *source,
-                                     struct ssl_primary_config *dest)
+bool Curl_ssl_primary_config_clone(struct ssl_primary_config *source,
+                                   struct ssl_primary_config *dest)
 {
   dest->version = source->version;
   dest->version_max = source->version_max;
@@ -269,7 +268,7 @@ static bool clone_ssl_primary_config(struct ssl_primary_config *source,
   return TRUE;
 }
 
-static void free_primary_ssl_config(struct ssl_primary_config *sslc)
+void Curl_ssl_primary_config_free(struct ssl_primary_config *sslc)
 {
   Curl_safefree(sslc->CApath);
   Curl_safefree(sslc->CAfile);
@@ -360,11 +359,12 @@ CURLcode Curl_ssl_conn_config_init(struct Curl_easy *data,
   /* Clone "primary" SSL configurations from the esay handle to
    * the connection. They are used for connection cache matching and
    * probably outlive the easy handle */
-  if(!clone_ssl_primary_config(&data->set.ssl.primary, &conn->ssl_config))
+  if(!Curl_ssl_primary_config_clone(&data->set.ssl.primary,
+                                    &conn->ssl_config))
     return CURLE_OUT_OF_MEMORY;
 #ifndef CURL_DISABLE_PROXY
-  if(!clone_ssl_primary_config(&data->set.proxy_ssl.primary,
-                               &conn->proxy_ssl_config))
+  if(!Curl_ssl_primary_config_clone(&data->set.proxy_ssl.primary,
+                                    &conn->proxy_ssl_config))
     return CURLE_OUT_OF_MEMORY;
 #endif
   return CURLE_OK;
@@ -372,9 +372,9 @@ CURLcode Curl_ssl_conn_config_init(struct Curl_easy *data,
 
 void Curl_ssl_conn_config_cleanup(struct connectdata *conn)
 {
-  free_primary_ssl_config(&conn->ssl_config);
+  Curl_ssl_primary_config_free(&conn->ssl_config);
 #ifndef CURL_DISABLE_PROXY
-  free_primary_ssl_config(&conn->proxy_ssl_config);
+  Curl_ssl_primary_config_free(&conn->proxy_ssl_config);
 #endif
 }
 
@@ -1625,6 +1625,15 @@ static CURLcode ssl_cf_cntrl(struct Curl_cfilter *cf,
         cf->conn->httpversion_seen = 30;
     }
     break;
+#if defined(USE_IO_URING) && defined(USE_OPENSSL_KTLS)
+  case CF_CTRL_BATCH_RECV:
+    /* With kTLS, OpenSSL reads the socket itself. Data received ahead
+     * in the socket filter would never reach it. */
+    if((connssl->ssl_impl == &Curl_ssl_openssl) && connssl->backend &&
+       ((struct ossl_ctx *)connssl->backend)->ktls)
+      return CURLE_AGAIN;
+    break;
+#endif
   }
   return CURLE_OK;
 }
@@ -1651,6 +1660,7 @@ struct Curl_cftype Curl_cft_ssl = {
   ssl_cf_adjust_pollset,
   ssl_cf_data_pending,
   ssl_cf_send,
+  Curl_cf_emulate_sendv,
   ssl_cf_recv,
   ssl_cf_cntrl,
   cf_ssl_is_alive,
@@ -1671,6 +1681,7 @@ struct Curl_cftype Curl_cft_ssl_proxy = {
   ssl_cf_adjust_pollset,
   ssl_cf_data_pending,
   ssl_cf_send,
+  Curl_cf_emulate_sendv,
   ssl_cf_recv,
   Curl_cf_def_cntrl,
   cf_ssl_is_alive,
@@ -1875,6 +1886,29 @@ bool Curl_ssl_cf_is_proxy(struct Curl_cfilter *cf)
   return (cf->cft->flags & CF_TYPE_SSL) && (cf->cft->flags & CF_TYPE_PROXY);
 }
 
+bool Curl_ssl_cf_want_earlydata(struct Curl_cfilter *cf,
+                                struct Curl_easy *data)
+{
+  struct ssl_config_data *ssl_config = Curl_ssl_cf_get_config(cf, data);
+
+  if(ssl_config->earlydata)
+    return TRUE;
+#ifndef CURL_DISABLE_HTTP
+  /* The server may process early data twice when an attacker replays it,
+   * RFC 8470. Only send requests that do no harm when seen again, and
+   * only to the origin, not the proxy. */
+  if(ssl_config->earlydata_safe && !Curl_ssl_cf_is_proxy(cf) &&
+     (cf->conn->handler->protocol & PROTO_FAMILY_HTTP) &&
+     ((data->state.httpreq == HTTPREQ_GET) ||
+      (data->state.httpreq == HTTPREQ_HEAD))) {
+    const char *method = data->set.str[STRING_CUSTOMREQUEST];
+    return !method || !strcmp(method, "GET") || !strcmp(method, "HEAD") ||
+           !strcmp(method, "OPTIONS");
+  }
+#endif
+  return FALSE;
+}
+
 struct ssl_config_data *
 Curl_ssl_cf_get_config(struct Curl_cfilter *cf, struct Curl_easy *data)
 {
@@ -137,6 +137,28 @@ bool Curl_ssl_conn_config_match(struct Curl_easy *data,
                                 struct connectdata *candidate,
                                 bool proxy);
 
+/**
+ * Return TRUE iff the SSL configurations `c1` and `c2` are functionally
+ * the same.
+ */
+bool Curl_ssl_primary_config_match(struct Curl_easy *data,
+                                   struct ssl_primary_config *c1,
+                                   struct ssl_primary_config *c2);
+
+/**
+ * Copy the SSL configuration `source` into `dest`, duplicating all
+ * strings and blobs. Returns FALSE on out of memory, in which case `dest`
+ * still needs to be freed.
+ */
+bool Curl_ssl_primary_config_clone(struct ssl_primary_config *source,
+                                   struct ssl_primary_config *dest);
+
+/**
+ * Free the strings and blobs of an SSL configuration made by
+ * Curl_ssl_primary_config_clone().
+ */
+void Curl_ssl_primary_config_free(struct ssl_primary_config *sslc);
+
 /* Update certain connection SSL config flags after they have
  * been changed on the easy handle. Will work for `verifypeer`,
  * `verifyhost` and `verifystatus`. */
@@ -199,6 +199,14 @@ CURLcode Curl_ssl_adjust_pollset(struct Curl_cfilter *cf,
  */
 bool Curl_ssl_cf_is_proxy(struct Curl_cfilter *cf);
 
+/**
+ * TRUE when the transfer wants to send TLS 1.3 early data on the
+ * connection the filter sets up. With CURLSSLOPT_EARLYDATA_SAFE, this is
+ * only the case for HTTP requests that a server may see twice.
+ */
+bool Curl_ssl_cf_want_earlydata(struct Curl_cfilter *cf,
+                                struct Curl_easy *data);
+
 #endif /* USE_SSL */
 
 #endif /* HEADER_CURL_VTLS_INT_H */
@@ -50,6 +50,7 @@
 #include "../rand.h"
 #include "../curlx/warnless.h"
 #include "../curl_printf.h"
+#include "../curl_threads.h"
 #include "../strdup.h"
 
 /* The last #include files should be: */
@@ -59,9 +60,18 @@
 
 static bool cf_ssl_peer_key_is_global(const char *peer_key);
 
+#if defined(USE_THREADS_POSIX) || defined(USE_THREADS_WIN32)
+#define USE_SCACHE_LOCKS
+#endif
+
+struct Curl_ssl_scache_shard;
+
 /* a peer+tls-config we cache sessions for */
 struct Curl_ssl_scache_peer {
   char *ssl_peer_key;      /* id for peer + relevant TLS configuration */
+  struct Curl_ssl_scache_shard *shard; /* the shard the peer lives in */
+  struct Curl_ssl_scache_peer *next; /* in the shard's index slot */
+  size_t islot;            /* the index slot, when `indexed` */
   char *clientcert;
   char *srp_username;
   char *srp_password;
@@ -74,20 +84,103 @@ struct Curl_ssl_scache_peer {
   long age;                /* just a number, the higher the more recent */
   BIT(hmac_set);           /* if key_salt and key_hmac are present */
   BIT(exportable);         /* sessions for this peer can be exported */
+  BIT(indexed);            /* if in the index of its shard */
+};
+
+/* The peers of a cache live in one or more shards. A peer with a known key
+ * lives in the shard its key hashes to and is found via the shard's index,
+ * slots of peers chained by the hash of their key. Peers only known by
+ * salt+hmac, as imported, live in the first shard until a lookup recovers
+ * their key. */
+struct Curl_ssl_scache_shard {
+  struct Curl_ssl_scache_peer *peers;
+  struct Curl_ssl_scache_peer **index; /* `peer_count` slots */
+  size_t peer_count;
+  long age;
 };
 
 #define CURL_SCACHE_MAGIC 0x000e1551
 
 #define GOOD_SCACHE(x) ((x) && (x)->magic == CURL_SCACHE_MAGIC)
 
+/* A cache with built-in locks takes the lock of the shard a peer key hashes
+ * to, and when it needs to look at peers without key, the lock of the first
+ * shard after that. Locking all shards goes from last to first. Otherwise,
+ * the cache of a share is protected by the share's CURL_LOCK_DATA_SSL_SESSION
+ * callbacks. */
 struct Curl_ssl_scache {
   unsigned int magic;
-  struct Curl_ssl_scache_peer *peers;
-  size_t peer_count;
+  struct Curl_ssl_scache_shard *shards; /* `one` or an allocated array of
+                                           `nshards`, followed by as many
+                                           built-in locks */
+  struct Curl_ssl_scache_shard one;
+  unsigned int nshards;
+  size_t max_sessions; /* per peer */
   int default_lifetime_secs;
-  long age;
+  BIT(unkeyed); /* peers without key were added, only set while all shards
+                   are locked */
 };
 
+#ifdef USE_SCACHE_LOCKS
+/* A cache with allocated shards has the locks right behind them */
+#define cf_scache_locks(c)                                         \
+  (((c)->shards != &(c)->one) ?                                    \
+   (curl_mutex_t *)(void *)&(c)->shards[(c)->nshards] : NULL)
+#endif
+
+/* Hash a peer key so that keys equal for curl_strequal() hash the same */
+static size_t cf_ssl_peer_key_hash(const char *ssl_peer_key)
+{
+  size_t h = 5381;
+  while(*ssl_peer_key) {
+    h += h << 5;
+    h ^= (unsigned char)Curl_raw_tolower(*ssl_peer_key++);
+  }
+  return h;
+}
+
+static struct Curl_ssl_scache_shard *
+cf_scache_shard(struct Curl_ssl_scache *scache, size_t key_hash)
+{
+  return &scache->shards[key_hash % scache->nshards];
+}
+
+static void cf_scache_lock_shard(struct Curl_easy *data,
+                                 struct Curl_ssl_scache *scache,
+                                 struct Curl_ssl_scache_shard *shard)
+{
+#ifdef USE_SCACHE_LOCKS
+  curl_mutex_t *locks = cf_scache_locks(scache);
+  if(locks) {
+    Curl_mutex_acquire(&locks[shard - scache->shards]);
+    return;
+  }
+#else
+  (void)scache;
+  (void)shard;
+#endif
+  if(CURL_SHARE_ssl_scache(data))
+    Curl_share_lock(data, CURL_LOCK_DATA_SSL_SESSION, CURL_LOCK_ACCESS_SINGLE);
+}
+
+static void cf_scache_unlock_shard(struct Curl_easy *data,
+                                   struct Curl_ssl_scache *scache,
+                                   struct Curl_ssl_scache_shard *shard)
+{
+#ifdef USE_SCACHE_LOCKS
+  curl_mutex_t *locks = cf_scache_locks(scache);
+  if(locks) {
+    Curl_mutex_release(&locks[shard - scache->shards]);
+    return;
+  }
+#else
+  (void)scache;
+  (void)shard;
+#endif
+  if(CURL_SHARE_ssl_scache(data))
+    Curl_share_unlock(data, CURL_LOCK_DATA_SSL_SESSION);
+}
+
 static struct Curl_ssl_scache *cf_ssl_scache_get(struct Curl_easy *data)
 {
   struct Curl_ssl_scache *scache = NULL;
@@ -178,8 +271,37 @@ void Curl_ssl_session_destroy(struct Curl_ssl_session *s)
   }
 }
 
+static void cf_ssl_scache_peer_unindex(struct Curl_ssl_scache_peer *peer)
+{
+  if(peer->indexed) {
+    struct Curl_ssl_scache_peer **pp = &peer->shard->index[peer->islot];
+    while(*pp != peer)
+      pp = &(*pp)->next;
+    *pp = peer->next;
+    peer->next = NULL;
+    peer->indexed = FALSE;
+  }
+}
+
+/* Add the peer with its key to the index of its shard */
+static void cf_ssl_scache_peer_index(struct Curl_ssl_scache *scache,
+                                     struct Curl_ssl_scache_peer *peer,
+                                     size_t key_hash)
+{
+  struct Curl_ssl_scache_shard *shard = peer->shard;
+
+  DEBUGASSERT(peer->ssl_peer_key);
+  DEBUGASSERT(shard == cf_scache_shard(scache, key_hash));
+  cf_ssl_scache_peer_unindex(peer);
+  peer->islot = (key_hash / scache->nshards) % shard->peer_count;
+  peer->next = shard->index[peer->islot];
+  shard->index[peer->islot] = peer;
+  peer->indexed = TRUE;
+}
+
 static void cf_ssl_scache_clear_peer(struct Curl_ssl_scache_peer *peer)
 {
+  cf_ssl_scache_peer_unindex(peer);
   Curl_llist_destroy(&peer->sessions, NULL);
   if(peer->sobj) {
     DEBUGASSERT(peer->sobj_free);
@@ -198,6 +320,33 @@ static void cf_ssl_scache_clear_peer(struct Curl_ssl_scache_peer *peer)
   peer->hmac_set = FALSE;
 }
 
+/* Move all that `src` holds to the free peer `dest` and clear `src` */
+static void cf_ssl_scache_peer_move(struct Curl_ssl_scache_peer *dest,
+                                    struct Curl_ssl_scache_peer *src)
+{
+  struct Curl_llist_node *n = Curl_llist_head(&src->sessions);
+
+  DEBUGASSERT(!dest->ssl_peer_key && !dest->hmac_set);
+  while(n) {
+    struct Curl_ssl_session *s = Curl_node_take_elem(n);
+    Curl_llist_append(&dest->sessions, s, &s->list);
+    n = Curl_llist_head(&src->sessions);
+  }
+  dest->sobj = src->sobj;
+  dest->sobj_free = src->sobj_free;
+  src->sobj = NULL;
+  src->sobj_free = NULL;
+  dest->clientcert = src->clientcert;
+  dest->srp_username = src->srp_username;
+  dest->srp_password = src->srp_password;
+  src->clientcert = src->srp_username = src->srp_password = NULL;
+  memcpy(dest->key_salt, src->key_salt, sizeof(dest->key_salt));
+  memcpy(dest->key_hmac, src->key_hmac, sizeof(dest->key_hmac));
+  dest->hmac_set = src->hmac_set;
+  dest->age = src->age;
+  cf_ssl_scache_clear_peer(src);
+}
+
 static void cf_ssl_scache_peer_set_obj(struct Curl_ssl_scache_peer *peer,
                                        void *sobj,
                                        Curl_ssl_scache_obj_dtor *sobj_free)
@@ -311,35 +460,85 @@ static void cf_scache_peer_remove_non13(struct Curl_ssl_scache_peer *peer)
   }
 }
 
+static CURLcode cf_scache_shard_init(struct Curl_ssl_scache_shard *shard,
+                                     size_t max_peers,
+                                     size_t max_sessions_per_peer)
+{
+  size_t i;
+
+  memset(shard, 0, sizeof(*shard));
+  if(max_peers) {
+    shard->peers = calloc(max_peers, sizeof(*shard->peers));
+    shard->index = calloc(max_peers, sizeof(*shard->index));
+    if(!shard->peers || !shard->index) {
+      Curl_safefree(shard->peers);
+      Curl_safefree(shard->index);
+      return CURLE_OUT_OF_MEMORY;
+    }
+  }
+  shard->peer_count = max_peers;
+  shard->age = 1;
+  for(i = 0; i < shard->peer_count; ++i) {
+    shard->peers[i].shard = shard;
+    shard->peers[i].max_sessions = max_sessions_per_peer;
+    Curl_llist_init(&shard->peers[i].sessions,
+                    cf_ssl_scache_session_ldestroy);
+  }
+  return CURLE_OK;
+}
+
+static void cf_scache_shard_destroy(struct Curl_ssl_scache_shard *shard)
+{
+  size_t i;
+  for(i = 0; i < shard->peer_count; ++i) {
+    cf_ssl_scache_clear_peer(&shard->peers[i]);
+  }
+  Curl_safefree(shard->peers);
+  Curl_safefree(shard->index);
+  shard->peer_count = 0;
+}
+
+static void cf_scache_shards_destroy(struct Curl_ssl_scache *scache)
+{
+#ifdef USE_SCACHE_LOCKS
+  curl_mutex_t *locks = cf_scache_locks(scache);
+#endif
+  unsigned int i;
+
+  for(i = 0; i < scache->nshards; ++i) {
+    cf_scache_shard_destroy(&scache->shards[i]);
+#ifdef USE_SCACHE_LOCKS
+    if(locks)
+      Curl_mutex_destroy(&locks[i]);
+#endif
+  }
+  if(scache->shards != &scache->one)
+    free(scache->shards);
+  scache->shards = &scache->one;
+  scache->nshards = 1;
+  scache->unkeyed = FALSE;
+}
+
 CURLcode Curl_ssl_scache_create(size_t max_peers,
                                 size_t max_sessions_per_peer,
                                 struct Curl_ssl_scache **pscache)
 {
   struct Curl_ssl_scache *scache;
-  struct Curl_ssl_scache_peer *peers;
-  size_t i;
 
   *pscache = NULL;
-  peers = calloc(max_peers, sizeof(*peers));
-  if(!peers)
+  scache = calloc(1, sizeof(*scache));
+  if(!scache)
     return CURLE_OUT_OF_MEMORY;
 
-  scache = calloc(1, sizeof(*scache));
-  if(!scache) {
-    free(peers);
+  if(cf_scache_shard_init(&scache->one, max_peers, max_sessions_per_peer)) {
+    free(scache);
     return CURLE_OUT_OF_MEMORY;
   }
-
   scache->magic = CURL_SCACHE_MAGIC;
   scache->default_lifetime_secs = (24*60*60); /* 1 day */
-  scache->peer_count = max_peers;
-  scache->peers = peers;
-  scache->age = 1;
-  for(i = 0; i < scache->peer_count; ++i) {
-    scache->peers[i].max_sessions = max_sessions_per_peer;
-    Curl_llist_init(&scache->peers[i].sessions,
-                    cf_ssl_scache_session_ldestroy);
-  }
+  scache->max_sessions = max_sessions_per_peer;
+  scache->shards = &scache->one;
+  scache->nshards = 1;
 
   *pscache = scache;
   return CURLE_OK;
@@ -348,19 +547,93 @@ CURLcode Curl_ssl_scache_create(size_t max_peers,
 void Curl_ssl_scache_destroy(struct Curl_ssl_scache *scache)
 {
   if(scache && GOOD_SCACHE(scache)) {
-    size_t i;
     scache->magic = 0;
-    for(i = 0; i < scache->peer_count; ++i) {
-      cf_ssl_scache_clear_peer(&scache->peers[i]);
-    }
-    free(scache->peers);
+    cf_scache_shards_destroy(scache);
     free(scache);
   }
 }
 
-/* Lock shared SSL session data */
+#ifdef USE_SCACHE_LOCKS
+static bool cf_scache_is_empty(struct Curl_ssl_scache *scache)
+{
+  unsigned int i;
+  size_t j;
+
+  for(i = 0; i < scache->nshards; ++i) {
+    struct Curl_ssl_scache_shard *shard = &scache->shards[i];
+    for(j = 0; j < shard->peer_count; ++j) {
+      if(shard->peers[j].ssl_peer_key || shard->peers[j].hmac_set)
+        return FALSE;
+    }
+  }
+  return TRUE;
+}
+#endif
+
+CURLcode Curl_ssl_scache_set_shards(struct Curl_ssl_scache *scache,
+                                    unsigned int nshards)
+{
+#ifdef USE_SCACHE_LOCKS
+  struct Curl_ssl_scache_shard *shards;
+  curl_mutex_t *locks;
+  size_t max_peers;
+  unsigned int i;
+
+  if(!GOOD_SCACHE(scache) || (nshards > CURL_SCACHE_MAX_SHARDS))
+    return CURLE_BAD_FUNCTION_ARGUMENT;
+  if(!cf_scache_is_empty(scache))
+    return CURLE_FAILED_INIT;
+  if(nshards <= 1)
+    nshards = 1;
+  if(nshards == scache->nshards)
+    return CURLE_OK;
+
+  /* every shard holds as many peers as the cache did */
+  max_peers = scache->shards[0].peer_count;
+  if(nshards == 1) {
+    cf_scache_shards_destroy(scache);
+    return cf_scache_shard_init(&scache->one, max_peers,
+                                scache->max_sessions);
+  }
+
+  shards = calloc(nshards, sizeof(*shards) + sizeof(*locks));
+  if(!shards)
+    return CURLE_OUT_OF_MEMORY;
+  for(i = 0; i < nshards; ++i) {
+    if(cf_scache_shard_init(&shards[i], max_peers, scache->max_sessions)) {
+      while(i)
+        cf_scache_shard_destroy(&shards[--i]);
+      free(shards);
+      return CURLE_OUT_OF_MEMORY;
+    }
+  }
+
+  cf_scache_shards_destroy(scache);
+  scache->shards = shards;
+  scache->nshards = nshards;
+  locks = cf_scache_locks(scache);
+  for(i = 0; i < nshards; ++i)
+    Curl_mutex_init(&locks[i]);
+  return CURLE_OK;
+#else
+  (void)scache;
+  return (nshards <= 1) ? CURLE_OK : CURLE_NOT_BUILT_IN;
+#endif
+}
+
+/* Lock shared SSL session data, all shards of it */
 void Curl_ssl_scache_lock(struct Curl_easy *data)
 {
+#ifdef USE_SCACHE_LOCKS
+  struct Curl_ssl_scache *scache = cf_ssl_scache_get(data);
+  curl_mutex_t *locks = scache ? cf_scache_locks(scache) : NULL;
+  if(locks) {
+    unsigned int i = scache->nshards;
+    while(i)
+      Curl_mutex_acquire(&locks[--i]);
+    return;
+  }
+#endif
   if(CURL_SHARE_ssl_scache(data))
     Curl_share_lock(data, CURL_LOCK_DATA_SSL_SESSION, CURL_LOCK_ACCESS_SINGLE);
 }
@@ -368,6 +641,16 @@ void Curl_ssl_scache_lock(struct Curl_easy *data)
 /* Unlock shared SSL session data */
 void Curl_ssl_scache_unlock(struct Curl_easy *data)
 {
+#ifdef USE_SCACHE_LOCKS
+  struct Curl_ssl_scache *scache = cf_ssl_scache_get(data);
+  curl_mutex_t *locks = scache ? cf_scache_locks(scache) : NULL;
+  if(locks) {
+    unsigned int i;
+    for(i = 0; i < scache->nshards; ++i)
+      Curl_mutex_release(&locks[i]);
+    return;
+  }
+#endif
   if(CURL_SHARE_ssl_scache(data))
     Curl_share_unlock(data, CURL_LOCK_DATA_SSL_SESSION);
 }
@@ -625,125 +908,179 @@ static bool cf_ssl_scache_match_auth(struct Curl_ssl_scache_peer *peer,
   return TRUE;
 }
 
-static CURLcode
-cf_ssl_find_peer_by_key(struct Curl_easy *data,
-                        struct Curl_ssl_scache *scache,
-                        const char *ssl_peer_key,
-                        struct ssl_primary_config *conn_config,
-                        struct Curl_ssl_scache_peer **ppeer)
+static struct Curl_ssl_scache_peer *
+cf_ssl_get_free_peer(struct Curl_ssl_scache_shard *shard)
 {
-  size_t i, peer_key_len = 0;
-  CURLcode result = CURLE_OK;
+  struct Curl_ssl_scache_peer *peer = NULL;
+  size_t i;
 
-  *ppeer = NULL;
-  if(!GOOD_SCACHE(scache)) {
-    return CURLE_BAD_FUNCTION_ARGUMENT;
+  /* find empty or oldest peer */
+  for(i = 0; i < shard->peer_count; ++i) {
+    /* free peer entry? */
+    if(!shard->peers[i].ssl_peer_key && !shard->peers[i].hmac_set) {
+      peer = &shard->peers[i];
+      break;
+    }
+    /* peer without sessions and obj */
+    if(!shard->peers[i].sobj &&
+       !Curl_llist_count(&shard->peers[i].sessions)) {
+      peer = &shard->peers[i];
+      break;
+    }
+    /* remember "oldest" peer */
+    if(!peer || (shard->peers[i].age < peer->age)) {
+      peer = &shard->peers[i];
+    }
   }
+  DEBUGASSERT(peer);
+  if(peer)
+    cf_ssl_scache_clear_peer(peer);
+  return peer;
+}
 
-  CURL_TRC_SSLS(data, "find peer slot for %s among %zu slots",
-                ssl_peer_key, scache->peer_count);
+/* Look for a peer without key in the first shard whose salt+hmac match the
+ * key. Make it the peer for the key, in `shard`. The first shard is
+ * locked. */
+static CURLcode
+cf_ssl_find_peer_unkeyed(struct Curl_easy *data,
+                         struct Curl_ssl_scache *scache,
+                         struct Curl_ssl_scache_shard *shard,
+                         const char *ssl_peer_key,
+                         size_t key_hash,
+                         struct ssl_primary_config *conn_config,
+                         struct Curl_ssl_scache_peer **ppeer)
+{
+  struct Curl_ssl_scache_shard *first = &scache->shards[0];
+  size_t i, peer_key_len = strlen(ssl_peer_key);
+  CURLcode result = CURLE_OK;
 
-  /* check for entries with known peer_key */
-  for(i = 0; scache && i < scache->peer_count; i++) {
-    if(scache->peers[i].ssl_peer_key &&
-       curl_strequal(ssl_peer_key, scache->peers[i].ssl_peer_key) &&
-       cf_ssl_scache_match_auth(&scache->peers[i], conn_config)) {
-      /* yes, we have a cached session for this! */
-      *ppeer = &scache->peers[i];
-      goto out;
-    }
-  }
-  /* check for entries with HMAC set but no known peer_key */
-  for(i = 0; scache && i < scache->peer_count; i++) {
-    if(!scache->peers[i].ssl_peer_key &&
-       scache->peers[i].hmac_set &&
-       cf_ssl_scache_match_auth(&scache->peers[i], conn_config)) {
+  for(i = 0; i < first->peer_count; i++) {
+    struct Curl_ssl_scache_peer *peer = &first->peers[i];
+    if(!peer->ssl_peer_key && peer->hmac_set &&
+       cf_ssl_scache_match_auth(peer, conn_config)) {
       /* possible entry with unknown peer_key, check hmac */
       unsigned char my_hmac[CURL_SHA256_DIGEST_LENGTH];
-      if(!peer_key_len) /* we are lazy */
-        peer_key_len = strlen(ssl_peer_key);
+      char *key;
       result = Curl_hmacit(&Curl_HMAC_SHA256,
-                           scache->peers[i].key_salt,
-                           sizeof(scache->peers[i].key_salt),
+                           peer->key_salt, sizeof(peer->key_salt),
                            (const unsigned char *)ssl_peer_key,
                            peer_key_len,
                            my_hmac);
       if(result)
         goto out;
-      if(!memcmp(scache->peers[i].key_hmac, my_hmac, sizeof(my_hmac))) {
-        /* remember peer_key for future lookups */
-        CURL_TRC_SSLS(data, "peer entry %zu key recovered: %s",
-                      i, ssl_peer_key);
-        scache->peers[i].ssl_peer_key = strdup(ssl_peer_key);
-        if(!scache->peers[i].ssl_peer_key) {
-          result = CURLE_OUT_OF_MEMORY;
+      if(memcmp(peer->key_hmac, my_hmac, sizeof(my_hmac)))
+        continue;
+      /* remember peer_key for future lookups */
+      CURL_TRC_SSLS(data, "peer entry %zu key recovered: %s",
+                    i, ssl_peer_key);
+      key = strdup(ssl_peer_key);
+      if(!key) {
+        result = CURLE_OUT_OF_MEMORY;
+        goto out;
+      }
+      if(shard != first) {
+        /* move it to the shard of its key */
+        struct Curl_ssl_scache_peer *dest = cf_ssl_get_free_peer(shard);
+        if(!dest) {
+          free(key);
           goto out;
         }
-        cf_ssl_cache_peer_update(&scache->peers[i]);
-        *ppeer = &scache->peers[i];
-        goto out;
+        cf_ssl_scache_peer_move(dest, peer);
+        peer = dest;
       }
+      peer->ssl_peer_key = key;
+      cf_ssl_cache_peer_update(peer);
+      cf_ssl_scache_peer_index(scache, peer, key_hash);
+      *ppeer = peer;
+      goto out;
     }
   }
-  CURL_TRC_SSLS(data, "peer not found for %s", ssl_peer_key);
 out:
   return result;
 }
 
-static struct Curl_ssl_scache_peer *
-cf_ssl_get_free_peer(struct Curl_ssl_scache *scache)
+/* Find the peer for the key in `shard`, the shard the key hashes to.
+ * `shard` is locked and, when `all_locked`, all others are, too. */
+static CURLcode
+cf_ssl_find_peer_by_key(struct Curl_easy *data,
+                        struct Curl_ssl_scache *scache,
+                        const char *ssl_peer_key,
+                        size_t key_hash,
+                        struct ssl_primary_config *conn_config,
+                        bool all_locked,
+                        struct Curl_ssl_scache_peer **ppeer)
 {
-  struct Curl_ssl_scache_peer *peer = NULL;
-  size_t i;
+  struct Curl_ssl_scache_shard *shard;
+  struct Curl_ssl_scache_peer *peer;
+  CURLcode result = CURLE_OK;
 
-  /* find empty or oldest peer */
-  for(i = 0; i < scache->peer_count; ++i) {
-    /* free peer entry? */
-    if(!scache->peers[i].ssl_peer_key && !scache->peers[i].hmac_set) {
-      peer = &scache->peers[i];
-      break;
-    }
-    /* peer without sessions and obj */
-    if(!scache->peers[i].sobj &&
-       !Curl_llist_count(&scache->peers[i].sessions)) {
-      peer = &scache->peers[i];
-      break;
-    }
-    /* remember "oldest" peer */
-    if(!peer || (scache->peers[i].age < peer->age)) {
-      peer = &scache->peers[i];
+  *ppeer = NULL;
+  if(!GOOD_SCACHE(scache)) {
+    return CURLE_BAD_FUNCTION_ARGUMENT;
+  }
+
+  shard = cf_scache_shard(scache, key_hash);
+  CURL_TRC_SSLS(data, "find peer for %s in shard %u/%u",
+                ssl_peer_key, (unsigned int)(shard - scache->shards),
+                scache->nshards);
+  if(!shard->peer_count)
+    goto out;
+
+  /* check the entries with known peer_key in its index slot */
+  peer = shard->index[(key_hash / scache->nshards) % shard->peer_count];
+  for(; peer; peer = peer->next) {
+    if(curl_strequal(ssl_peer_key, peer->ssl_peer_key) &&
+       cf_ssl_scache_match_auth(peer, conn_config)) {
+      /* yes, we have a cached session for this! */
+      *ppeer = peer;
+      goto out;
     }
   }
-  DEBUGASSERT(peer);
-  if(peer)
-    cf_ssl_scache_clear_peer(peer);
-  return peer;
+
+  /* check for entries with HMAC set but no known peer_key */
+  if(shard == scache->shards || all_locked)
+    result = cf_ssl_find_peer_unkeyed(data, scache, shard, ssl_peer_key,
+                                      key_hash, conn_config, ppeer);
+  else if(scache->unkeyed) {
+    cf_scache_lock_shard(data, scache, &scache->shards[0]);
+    result = cf_ssl_find_peer_unkeyed(data, scache, shard, ssl_peer_key,
+                                      key_hash, conn_config, ppeer);
+    cf_scache_unlock_shard(data, scache, &scache->shards[0]);
+  }
+  if(!result && !*ppeer)
+    CURL_TRC_SSLS(data, "peer not found for %s", ssl_peer_key);
+out:
+  return result;
 }
 
 static CURLcode
 cf_ssl_add_peer(struct Curl_easy *data,
                 struct Curl_ssl_scache *scache,
                 const char *ssl_peer_key,
+                size_t key_hash,
                 struct ssl_primary_config *conn_config,
+                bool all_locked,
                 struct Curl_ssl_scache_peer **ppeer)
 {
+  struct Curl_ssl_scache_shard *shard;
   struct Curl_ssl_scache_peer *peer = NULL;
   CURLcode result = CURLE_OK;
 
   *ppeer = NULL;
-  if(ssl_peer_key) {
-    result = cf_ssl_find_peer_by_key(data, scache, ssl_peer_key, conn_config,
-                                     &peer);
-    if(result || !scache->peer_count)
-      return result;
-  }
+  if(!ssl_peer_key)
+    return CURLE_BAD_FUNCTION_ARGUMENT;
+  result = cf_ssl_find_peer_by_key(data, scache, ssl_peer_key, key_hash,
+                                   conn_config, all_locked, &peer);
+  shard = cf_scache_shard(scache, key_hash);
+  if(result || !shard->peer_count)
+    return result;
 
   if(peer) {
     *ppeer = peer;
     return CURLE_OK;
   }
 
-  peer = cf_ssl_get_free_peer(scache);
+  peer = cf_ssl_get_free_peer(shard);
   if(peer) {
     const char *ccert = conn_config ? conn_config->clientcert : NULL;
     const char *username = NULL, *password = NULL;
@@ -755,6 +1092,7 @@ cf_ssl_add_peer(struct Curl_easy *data,
                                      username, password, NULL, NULL);
     if(result)
       goto out;
+    cf_ssl_scache_peer_index(scache, peer, key_hash);
     /* all ready */
     *ppeer = peer;
     result = CURLE_OK;
@@ -791,6 +1129,7 @@ static CURLcode cf_scache_add_session(struct Curl_cfilter *cf,
                                       struct Curl_easy *data,
                                       struct Curl_ssl_scache *scache,
                                       const char *ssl_peer_key,
+                                      size_t key_hash,
                                       struct Curl_ssl_session *s)
 {
   struct Curl_ssl_scache_peer *peer = NULL;
@@ -799,7 +1138,7 @@ static CURLcode cf_scache_add_session(struct Curl_cfilter *cf,
   curl_off_t now = (curl_off_t)time(NULL);
   curl_off_t max_lifetime;
 
-  if(!scache || !scache->peer_count) {
+  if(!scache || !cf_scache_shard(scache, key_hash)->peer_count) {
     Curl_ssl_session_destroy(s);
     return CURLE_OK;
   }
@@ -819,7 +1158,8 @@ static CURLcode cf_scache_add_session(struct Curl_cfilter *cf,
     return CURLE_OK;
   }
 
-  result = cf_ssl_add_peer(data, scache, ssl_peer_key, conn_config, &peer);
+  result = cf_ssl_add_peer(data, scache, ssl_peer_key, key_hash,
+                           conn_config, FALSE, &peer);
   if(result || !peer) {
     CURL_TRC_SSLS(data, "unable to add scache peer: %d", result);
     Curl_ssl_session_destroy(s);
@@ -850,6 +1190,8 @@ CURLcode Curl_ssl_scache_put(struct Curl_cfilter *cf,
 {
   struct Curl_ssl_scache *scache = cf_ssl_scache_get(data);
   struct ssl_config_data *ssl_config = Curl_ssl_cf_get_config(cf, data);
+  struct Curl_ssl_scache_shard *shard;
+  size_t key_hash;
   CURLcode result;
   DEBUGASSERT(ssl_config);
 
@@ -858,9 +1200,11 @@ CURLcode Curl_ssl_scache_put(struct Curl_cfilter *cf,
     return CURLE_OK;
   }
 
-  Curl_ssl_scache_lock(data);
-  result = cf_scache_add_session(cf, data, scache, ssl_peer_key, s);
-  Curl_ssl_scache_unlock(data);
+  key_hash = cf_ssl_peer_key_hash(ssl_peer_key);
+  shard = cf_scache_shard(scache, key_hash);
+  cf_scache_lock_shard(data, scache, shard);
+  result = cf_scache_add_session(cf, data, scache, ssl_peer_key, key_hash, s);
+  cf_scache_unlock_shard(data, scache, shard);
   return result;
 }
 
@@ -884,35 +1228,39 @@ CURLcode Curl_ssl_scache_take(struct Curl_cfilter *cf,
 {
   struct Curl_ssl_scache *scache = cf_ssl_scache_get(data);
   struct ssl_primary_config *conn_config = Curl_ssl_cf_get_primary_config(cf);
+  struct Curl_ssl_scache_shard *shard;
   struct Curl_ssl_scache_peer *peer = NULL;
   struct Curl_llist_node *n;
   struct Curl_ssl_session *s = NULL;
+  size_t key_hash, remain = 0;
   CURLcode result;
 
   *ps = NULL;
   if(!scache)
     return CURLE_OK;
 
-  Curl_ssl_scache_lock(data);
-  result = cf_ssl_find_peer_by_key(data, scache, ssl_peer_key, conn_config,
-                                   &peer);
+  key_hash = cf_ssl_peer_key_hash(ssl_peer_key);
+  shard = cf_scache_shard(scache, key_hash);
+  cf_scache_lock_shard(data, scache, shard);
+  result = cf_ssl_find_peer_by_key(data, scache, ssl_peer_key, key_hash,
+                                   conn_config, FALSE, &peer);
   if(!result && peer) {
     cf_scache_peer_remove_expired(peer, (curl_off_t)time(NULL));
     n = Curl_llist_head(&peer->sessions);
     if(n) {
       s = Curl_node_take_elem(n);
-      (scache->age)++;            /* increase general age */
-      peer->age = scache->age; /* set this as used in this age */
+      (shard->age)++;          /* increase general age */
+      peer->age = shard->age;  /* set this as used in this age */
     }
+    remain = Curl_llist_count(&peer->sessions);
   }
-  Curl_ssl_scache_unlock(data);
+  cf_scache_unlock_shard(data, scache, shard);
   if(s) {
     *ps = s;
     CURL_TRC_SSLS(data, "took session for %s [proto=0x%x, "
                   "alpn=%s, earlydata=%zu, quic_tp=%s], %zu sessions remain",
                   ssl_peer_key, s->ietf_tls_id, s->alpn,
-                  s->earlydata_max, s->quic_tp ? "yes" : "no",
-                  Curl_llist_count(&peer->sessions));
+                  s->earlydata_max, s->quic_tp ? "yes" : "no", remain);
   }
   else {
     CURL_TRC_SSLS(data, "no cached session for %s", ssl_peer_key);
@@ -939,7 +1287,10 @@ CURLcode Curl_ssl_scache_add_obj(struct Curl_cfilter *cf,
     goto out;
   }
 
-  result = cf_ssl_add_peer(data, scache, ssl_peer_key, conn_config, &peer);
+  /* the caller holds Curl_ssl_scache_lock(), all shards are locked */
+  result = cf_ssl_add_peer(data, scache, ssl_peer_key,
+                           cf_ssl_peer_key_hash(ssl_peer_key),
+                           conn_config, TRUE, &peer);
   if(result || !peer) {
     CURL_TRC_SSLS(data, "unable to add scache peer: %d", result);
     goto out;
@@ -967,8 +1318,10 @@ void *Curl_ssl_scache_get_obj(struct Curl_cfilter *cf,
   if(!scache)
     return NULL;
 
-  result = cf_ssl_find_peer_by_key(data, scache, ssl_peer_key, conn_config,
-                                   &peer);
+  /* the caller holds Curl_ssl_scache_lock(), all shards are locked */
+  result = cf_ssl_find_peer_by_key(data, scache, ssl_peer_key,
+                                   cf_ssl_peer_key_hash(ssl_peer_key),
+                                   conn_config, TRUE, &peer);
   if(result)
     return NULL;
 
@@ -985,19 +1338,23 @@ void Curl_ssl_scache_remove_all(struct Curl_cfilter *cf,
 {
   struct Curl_ssl_scache *scache = cf_ssl_scache_get(data);
   struct ssl_primary_config *conn_config = Curl_ssl_cf_get_primary_config(cf);
+  struct Curl_ssl_scache_shard *shard;
   struct Curl_ssl_scache_peer *peer = NULL;
+  size_t key_hash;
   CURLcode result;
 
   (void)cf;
   if(!scache)
     return;
 
-  Curl_ssl_scache_lock(data);
-  result = cf_ssl_find_peer_by_key(data, scache, ssl_peer_key, conn_config,
-                                   &peer);
+  key_hash = cf_ssl_peer_key_hash(ssl_peer_key);
+  shard = cf_scache_shard(scache, key_hash);
+  cf_scache_lock_shard(data, scache, shard);
+  result = cf_ssl_find_peer_by_key(data, scache, ssl_peer_key, key_hash,
+                                   conn_config, FALSE, &peer);
   if(!result && peer)
     cf_ssl_scache_clear_peer(peer);
-  Curl_ssl_scache_unlock(data);
+  cf_scache_unlock_shard(data, scache, shard);
 }
 
 #ifdef USE_SSLS_EXPORT
@@ -1026,55 +1383,73 @@ static CURLcode cf_ssl_scache_peer_set_hmac(struct Curl_ssl_scache_peer *peer)
   return result;
 }
 
+/* Check if the peer matches salt+hmac exactly or has a known ssl_peer_key
+ * which salt+hmac's to the same. */
+static CURLcode cf_ssl_peer_match_hmac(struct Curl_ssl_scache_peer *peer,
+                                       const unsigned char *salt,
+                                       const unsigned char *hmac,
+                                       bool *pmatch)
+{
+  *pmatch = FALSE;
+  if(!cf_ssl_scache_match_auth(peer, NULL))
+    return CURLE_OK;
+  if(peer->hmac_set &&
+     !memcmp(peer->key_salt, salt, sizeof(peer->key_salt)) &&
+     !memcmp(peer->key_hmac, hmac, sizeof(peer->key_hmac))) {
+    /* found exact match */
+    *pmatch = TRUE;
+  }
+  else if(peer->ssl_peer_key) {
+    unsigned char my_hmac[CURL_SHA256_DIGEST_LENGTH];
+    /* compute hmac for the passed salt */
+    CURLcode result = Curl_hmacit(&Curl_HMAC_SHA256,
+                                  salt, sizeof(peer->key_salt),
+                                  (const unsigned char *)peer->ssl_peer_key,
+                                  strlen(peer->ssl_peer_key),
+                                  my_hmac);
+    if(result)
+      return result;
+    if(!memcmp(my_hmac, hmac, sizeof(my_hmac))) {
+      /* cryptohash match, take over salt+hmac if no set */
+      if(!peer->hmac_set) {
+        memcpy(peer->key_salt, salt, sizeof(peer->key_salt));
+        memcpy(peer->key_hmac, hmac, sizeof(peer->key_hmac));
+        peer->hmac_set = TRUE;
+      }
+      *pmatch = TRUE;
+    }
+  }
+  return CURLE_OK;
+}
+
+/* Find the peer for salt+hmac in all shards, which are locked */
 static CURLcode
 cf_ssl_find_peer_by_hmac(struct Curl_ssl_scache *scache,
                          const unsigned char *salt,
                          const unsigned char *hmac,
                          struct Curl_ssl_scache_peer **ppeer)
 {
-  size_t i;
+  unsigned int i;
+  size_t j;
   CURLcode result = CURLE_OK;
 
   *ppeer = NULL;
   if(!GOOD_SCACHE(scache))
     return CURLE_BAD_FUNCTION_ARGUMENT;
 
-  /* look for an entry that matches salt+hmac exactly or has a known
-   * ssl_peer_key which salt+hmac's to the same. */
-  for(i = 0; scache && i < scache->peer_count; i++) {
-    struct Curl_ssl_scache_peer *peer = &scache->peers[i];
-    if(!cf_ssl_scache_match_auth(peer, NULL))
-      continue;
-    if(scache->peers[i].hmac_set &&
-       !memcmp(peer->key_salt, salt, sizeof(peer->key_salt)) &&
-       !memcmp(peer->key_hmac, hmac, sizeof(peer->key_hmac))) {
-      /* found exact match, return */
-      *ppeer = peer;
-      goto out;
-    }
-    else if(peer->ssl_peer_key) {
-      unsigned char my_hmac[CURL_SHA256_DIGEST_LENGTH];
-      /* compute hmac for the passed salt */
-      result = Curl_hmacit(&Curl_HMAC_SHA256,
-                           salt, sizeof(peer->key_salt),
-                           (const unsigned char *)peer->ssl_peer_key,
-                           strlen(peer->ssl_peer_key),
-                           my_hmac);
+  for(i = 0; i < scache->nshards; i++) {
+    struct Curl_ssl_scache_shard *shard = &scache->shards[i];
+    for(j = 0; j < shard->peer_count; j++) {
+      bool match;
+      result = cf_ssl_peer_match_hmac(&shard->peers[j], salt, hmac, &match);
       if(result)
-        goto out;
-      if(!memcmp(my_hmac, hmac, sizeof(my_hmac))) {
-        /* cryptohash match, take over salt+hmac if no set and return */
-        if(!peer->hmac_set) {
-          memcpy(peer->key_salt, salt, sizeof(peer->key_salt));
-          memcpy(peer->key_hmac, hmac, sizeof(peer->key_hmac));
-          peer->hmac_set = TRUE;
-        }
-        *ppeer = peer;
-        goto out;
+        return result;
+      if(match) {
+        *ppeer = &shard->peers[j];
+        return CURLE_OK;
       }
     }
   }
-out:
   return result;
 }
 
@@ -1084,6 +1459,7 @@ CURLcode Curl_ssl_session_import(struct Curl_easy *data,
                                  const void *sdata, size_t sdata_len)
 {
   struct Curl_ssl_scache *scache = cf_ssl_scache_get(data);
+  struct Curl_ssl_scache_shard *shard = NULL;
   struct Curl_ssl_scache_peer *peer = NULL;
   struct Curl_ssl_session *s = NULL;
   bool locked = FALSE;
@@ -1102,11 +1478,12 @@ CURLcode Curl_ssl_session_import(struct Curl_easy *data,
   if(r)
     goto out;
 
-  Curl_ssl_scache_lock(data);
-  locked = TRUE;
-
   if(ssl_peer_key) {
-    r = cf_ssl_add_peer(data, scache, ssl_peer_key, NULL, &peer);
+    size_t key_hash = cf_ssl_peer_key_hash(ssl_peer_key);
+    shard = cf_scache_shard(scache, key_hash);
+    cf_scache_lock_shard(data, scache, shard);
+    r = cf_ssl_add_peer(data, scache, ssl_peer_key, key_hash, NULL, FALSE,
+                        &peer);
     if(r)
       goto out;
   }
@@ -1120,16 +1497,21 @@ CURLcode Curl_ssl_session_import(struct Curl_easy *data,
     const unsigned char *salt = shmac;
     const unsigned char *hmac = shmac + sizeof(peer->key_salt);
 
+    /* the peer may be in any shard */
+    Curl_ssl_scache_lock(data);
+    locked = TRUE;
     r = cf_ssl_find_peer_by_hmac(scache, salt, hmac, &peer);
     if(r)
       goto out;
     if(!peer) {
-      peer = cf_ssl_get_free_peer(scache);
+      /* without key, it lives in the first shard */
+      peer = cf_ssl_get_free_peer(&scache->shards[0]);
       if(peer) {
         r = cf_ssl_scache_peer_init(peer, ssl_peer_key, NULL,
                                     NULL, NULL, salt, hmac);
         if(r)
           goto out;
+        scache->unkeyed = TRUE;
       }
     }
   }
@@ -1144,7 +1526,9 @@ CURLcode Curl_ssl_session_import(struct Curl_easy *data,
   }
 
 out:
-  if(locked)
+  if(shard)
+    cf_scache_unlock_shard(data, scache, shard);
+  else if(locked)
     Curl_ssl_scache_unlock(data);
   Curl_ssl_session_destroy(s);
   return r;
@@ -1158,7 +1542,7 @@ CURLcode Curl_ssl_session_export(struct Curl_easy *data,
   struct Curl_ssl_scache_peer *peer;
   struct dynbuf sbuf, hbuf;
   struct Curl_llist_node *n;
-  size_t i, npeers = 0, ntickets = 0;
+  size_t i, per_shard, npeers = 0, ntickets = 0;
   curl_off_t now = time(NULL);
   CURLcode r = CURLE_OK;
 
@@ -1172,8 +1556,10 @@ CURLcode Curl_ssl_session_export(struct Curl_easy *data,
   curlx_dyn_init(&hbuf, (CURL_SHA256_DIGEST_LENGTH * 2) + 1);
   curlx_dyn_init(&sbuf, CURL_SSL_TICKET_MAX);
 
-  for(i = 0; scache && i < scache->peer_count; i++) {
-    peer = &scache->peers[i];
+  /* all shards hold as many peers */
+  per_shard = scache->shards[0].peer_count;
+  for(i = 0; i < (scache->nshards * per_shard); i++) {
+    peer = &scache->shards[i / per_shard].peers[i % per_shard];
     if(!peer->ssl_peer_key && !peer->hmac_set)
       continue;  /* skip free entry */
     if(!peer->exportable)
@@ -1227,6 +1613,186 @@ out:
   return r;
 }
 
+/* All sessions exported into one buffer start with this, followed by a
+ * record for each session:
+ * - 2 bytes: length of the peer key, may be 0
+ * - the peer key
+ * - 1 byte: length of salt+hmac, may be 0
+ * - salt+hmac
+ * - 4 bytes: length of the packed session
+ * - the session as packed by Curl_ssl_session_pack()
+ * Lengths are in network byte order. */
+#define CURL_SSLS_BULK_MAGIC      "curl-ssls-1\n"
+#define CURL_SSLS_BULK_MAGIC_LEN  (sizeof(CURL_SSLS_BULK_MAGIC) - 1)
+#define CURL_SSLS_BULK_PEER_KEY_MAX  0xffff
+
+static CURLcode cf_ssl_bulk_add_len(struct dynbuf *buf, size_t len,
+                                    size_t nbytes)
+{
+  unsigned char b[4];
+  size_t i;
+
+  DEBUGASSERT(nbytes <= sizeof(b));
+  for(i = 0; i < nbytes; i++)
+    b[i] = (unsigned char)(len >> (8 * (nbytes - 1 - i)));
+  return curlx_dyn_addn(buf, b, nbytes);
+}
+
+static bool cf_ssl_bulk_get_len(const unsigned char **pbuf,
+                                const unsigned char *end,
+                                size_t nbytes, size_t *plen)
+{
+  const unsigned char *buf = *pbuf;
+  size_t i, len = 0;
+
+  if((size_t)(end - buf) < nbytes)
+    return FALSE;
+  for(i = 0; i < nbytes; i++)
+    len = (len << 8) | buf[i];
+  buf += nbytes;
+  if((size_t)(end - buf) < len)
+    return FALSE;
+  *pbuf = buf;
+  *plen = len;
+  return TRUE;
+}
+
+static CURLcode cf_ssl_bulk_export_cb(CURL *handle,
+                                      void *userptr,
+                                      const char *session_key,
+                                      const unsigned char *shmac,
+                                      size_t shmac_len,
+                                      const unsigned char *sdata,
+                                      size_t sdata_len,
+                                      curl_off_t valid_until,
+                                      int ietf_tls_id,
+                                      const char *alpn,
+                                      size_t earlydata_max)
+{
+  struct dynbuf *buf = userptr;
+  size_t klen = session_key ? strlen(session_key) : 0;
+  CURLcode r;
+
+  (void)handle;
+  (void)valid_until;
+  (void)ietf_tls_id;
+  (void)alpn;
+  (void)earlydata_max;
+  if((klen > CURL_SSLS_BULK_PEER_KEY_MAX) || (shmac_len > 0xff))
+    return CURLE_OK; /* cannot be imported again, skip */
+
+  r = cf_ssl_bulk_add_len(buf, klen, 2);
+  if(!r && klen)
+    r = curlx_dyn_addn(buf, session_key, klen);
+  if(!r)
+    r = cf_ssl_bulk_add_len(buf, shmac_len, 1);
+  if(!r && shmac_len)
+    r = curlx_dyn_addn(buf, shmac, shmac_len);
+  if(!r)
+    r = cf_ssl_bulk_add_len(buf, sdata_len, 4);
+  if(!r)
+    r = curlx_dyn_addn(buf, sdata, sdata_len);
+  return r;
+}
+
+CURLcode Curl_ssl_scache_export_all(struct Curl_easy *data,
+                                    unsigned char **pbuf, size_t *plen)
+{
+  struct Curl_ssl_scache *scache = cf_ssl_scache_get(data);
+  struct dynbuf buf;
+  size_t max_len = CURL_SSLS_BULK_MAGIC_LEN;
+  size_t i;
+  CURLcode r;
+
+  *pbuf = NULL;
+  *plen = 0;
+  if(!scache)
+    return CURLE_BAD_FUNCTION_ARGUMENT;
+
+  /* room for all sessions the cache may hold */
+  for(i = 0; i < scache->nshards; i++)
+    max_len += scache->shards[i].peer_count * scache->max_sessions *
+      (7 + CURL_SSLS_BULK_PEER_KEY_MAX + 0xff + CURL_SSL_TICKET_MAX);
+  curlx_dyn_init(&buf, max_len);
+
+  r = curlx_dyn_addn(&buf, CURL_SSLS_BULK_MAGIC, CURL_SSLS_BULK_MAGIC_LEN);
+  if(!r)
+    r = Curl_ssl_session_export(data, cf_ssl_bulk_export_cb, &buf);
+  if(r) {
+    curlx_dyn_free(&buf);
+    return r;
+  }
+  *plen = curlx_dyn_len(&buf);
+  *pbuf = curlx_dyn_uptr(&buf);
+  return CURLE_OK;
+}
+
+CURLcode Curl_ssl_scache_import_all(struct Curl_easy *data,
+                                    const unsigned char *buf, size_t len)
+{
+  const unsigned char *end = buf + len;
+  struct dynbuf key;
+  size_t nsessions = 0;
+  CURLcode r = CURLE_OK;
+
+  if(!cf_ssl_scache_get(data))
+    return CURLE_BAD_FUNCTION_ARGUMENT;
+  if((len < CURL_SSLS_BULK_MAGIC_LEN) ||
+     memcmp(buf, CURL_SSLS_BULK_MAGIC, CURL_SSLS_BULK_MAGIC_LEN)) {
+    failf(data, "SSL sessions in an unknown format");
+    return CURLE_BAD_FUNCTION_ARGUMENT;
+  }
+  buf += CURL_SSLS_BULK_MAGIC_LEN;
+
+  curlx_dyn_init(&key, CURL_SSLS_BULK_PEER_KEY_MAX + 1);
+  while(!r && (buf < end)) {
+    const unsigned char *kdata, *shmac, *sdata;
+    size_t klen, shmac_len, sdata_len;
+
+    if(!cf_ssl_bulk_get_len(&buf, end, 2, &klen)) {
+      r = CURLE_BAD_FUNCTION_ARGUMENT;
+      break;
+    }
+    kdata = buf;
+    buf += klen;
+    if(!cf_ssl_bulk_get_len(&buf, end, 1, &shmac_len)) {
+      r = CURLE_BAD_FUNCTION_ARGUMENT;
+      break;
+    }
+    shmac = buf;
+    buf += shmac_len;
+    if(!cf_ssl_bulk_get_len(&buf, end, 4, &sdata_len)) {
+      r = CURLE_BAD_FUNCTION_ARGUMENT;
+      break;
+    }
+    sdata = buf;
+    buf += sdata_len;
+
+    curlx_dyn_reset(&key);
+    if(klen) {
+      if(memchr(kdata, 0, klen)) {
+        r = CURLE_BAD_FUNCTION_ARGUMENT;
+        break;
+      }
+      r = curlx_dyn_addn(&key, kdata, klen);
+    }
+    if(!r)
+      r = Curl_ssl_session_import(data, klen ? curlx_dyn_ptr(&key) : NULL,
+                                  shmac_len ? shmac : NULL, shmac_len,
+                                  sdata, sdata_len);
+    if(!r)
+      nsessions++;
+  }
+  curlx_dyn_free(&key);
+
+  if(r)
+    failf(data, "importing SSL sessions failed after %zu sessions",
+          nsessions);
+  else
+    CURL_TRC_SSLS(data, "imported %zu SSL sessions", nsessions);
+  return r;
+}
+
 #endif /* USE_SSLS_EXPORT */
 
 #endif /* USE_SSL */
@@ -48,6 +48,15 @@ CURLcode Curl_ssl_scache_create(size_t max_peers,
 
 void Curl_ssl_scache_destroy(struct Curl_ssl_scache *scache);
 
+/* The most shards a session cache can be split into */
+#define CURL_SCACHE_MAX_SHARDS 64
+
+/* Split the (empty) session cache into `nshards` shards that each use a
+ * built-in lock and hold as many peers as the cache did. `nshards` of 1 or
+ * less goes back to a single shard without a built-in lock. */
+CURLcode Curl_ssl_scache_set_shards(struct Curl_ssl_scache *scache,
+                                    unsigned int nshards);
+
 /* Create a key from peer and TLS configuration information that is
  * unique for how the connection filter wants to establish a TLS
  * connection to the peer.
@@ -65,7 +74,7 @@ CURLcode Curl_ssl_peer_key_make(struct Curl_cfilter *cf,
                                 const char *tls_id,
                                 char **ppeer_key);
 
-/* Lock session cache mutex.
+/* Lock session cache mutex, all shards of a split cache.
  * Call this before calling other Curl_ssl_*session* functions
  * Caller should unlock this mutex as soon as possible, as it may block
  * other SSL connection from making progress.
@@ -205,6 +214,14 @@ CURLcode Curl_ssl_session_export(struct Curl_easy *data,
                                  curl_ssls_export_cb *export_fn,
                                  void *userptr);
 
+/* Export all sessions of the cache `data` uses into one allocated buffer,
+ * to be imported again with Curl_ssl_scache_import_all(). */
+CURLcode Curl_ssl_scache_export_all(struct Curl_easy *data,
+                                    unsigned char **pbuf, size_t *plen);
+
+CURLcode Curl_ssl_scache_import_all(struct Curl_easy *data,
+                                    const unsigned char *buf, size_t len);
+
 #endif /* USE_SSLS_EXPORT */
 #endif /* USE_SSL */
 
@@ -547,7 +547,6 @@ wssl_setup_session(struct Curl_cfilter *cf,
                    const char *ssl_peer_key,
                    Curl_wssl_init_session_reuse_cb *sess_reuse_cb)
 {
-  struct ssl_config_data *ssl_config = Curl_ssl_cf_get_config(cf, data);
   struct Curl_ssl_session *scs = NULL;
   CURLcode result;
 
@@ -569,7 +568,7 @@ wssl_setup_session(struct Curl_cfilter *cf,
       else {
         infof(data, "SSL reusing session with ALPN '%s'",
               scs->alpn ? scs->alpn : "-");
-        if(ssl_config->earlydata &&
+        if(Curl_ssl_cf_want_earlydata(cf, data) &&
            !cf->conn->connect_only &&
            !strcmp("TLSv1.3", wolfSSL_get_version(wss->ssl))) {
           bool do_early_data = FALSE;
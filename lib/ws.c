@@ -1205,6 +1205,8 @@ static const struct Curl_crtype ws_cr_encode = {
   Curl_creader_def_cntrl,
   Curl_creader_def_is_paused,
   Curl_creader_def_done,
+  Curl_creader_def_peek,
+  Curl_creader_def_skip,
   sizeof(struct cr_ws_ctx)
 };
 
@@ -1089,6 +1089,7 @@ curl_easy_setopt_ccsid(CURL *easy, CURLoption tag, ...)
   case CURLOPT_AWS_SIGV4:
   case CURLOPT_CAINFO:
   case CURLOPT_CAPATH:
+  case CURLOPT_CA_CACHE_FILE:
   case CURLOPT_COOKIE:
   case CURLOPT_COOKIEFILE:
   case CURLOPT_COOKIEJAR:
@@ -1096,6 +1097,7 @@ curl_easy_setopt_ccsid(CURL *easy, CURLoption tag, ...)
   case CURLOPT_CRLFILE:
   case CURLOPT_CUSTOMREQUEST:
   case CURLOPT_DEFAULT_PROTOCOL:
+  case CURLOPT_DNS_CACHE_FILE:
   case CURLOPT_DNS_INTERFACE:
   case CURLOPT_DNS_LOCAL_IP4:
   case CURLOPT_DNS_LOCAL_IP6:
@@ -123,6 +123,7 @@ my %api = (
     'curl_multi_socket_action' => 'API',
     'curl_multi_socket_all' => 'API',
     'curl_multi_poll' => 'API',
+    'curl_multi_prewarm' => 'API',
     'curl_multi_strerror' => 'API',
     'curl_multi_timeout' => 'API',
     'curl_multi_wait' => 'API',
@@ -138,6 +139,8 @@ my %api = (
     'curl_share_cleanup' => 'API',
     'curl_share_init' => 'API',
     'curl_share_setopt' => 'API',
+    'curl_share_ssls_export' => 'API',
+    'curl_share_ssls_import' => 'API',
     'curl_share_strerror' => 'API',
     'curl_slist_append' => 'API',
     'curl_slist_free_all' => 'API',
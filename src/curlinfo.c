@@ -227,6 +227,13 @@ static const char *disabled[]={
   "OFF"
 #else
   "ON"
+#endif
+  ,
+  "io-uring: "
+#ifdef USE_IO_URING
+  "ON"
+#else
+  "OFF"
 #endif
   ,
   "override-dns: "
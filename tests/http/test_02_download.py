@@ -792,3 +792,37 @@ class TestDownload:
                     # nghttpx destroys the connection with internal error
                     # ERR_QPACK_HEADER_TOO_LARGE
                     r.check_exit_code(56)
+
+    # h2 stream windows grow from the measured bandwidth-delay product and
+    # are halved again when the transfer pauses. Windows start small, so
+    # that they grow on a local connection.
+    @pytest.mark.skipif(condition=not Env.curl_is_debug(), reason="needs curl debug")
+    def test_02_37_h2_window_bdp(self, env: Env, httpd):
+        proto = 'h2'
+        count = 1
+        docname = 'data-10m'
+        url = f'https://localhost:{env.https_port}/{docname}'
+        run_env = os.environ.copy()
+        run_env['CURL_DEBUG'] = 'http/2'
+        run_env['CURL_H2_STREAM_WIN_START'] = f'{64*1024}'
+        client = LocalClient(name='cli_hx_download', env=env, run_env=run_env)
+        if not client.exists():
+            pytest.skip(f'example client not built: {client.name}')
+        r = client.run(args=[
+             '-n', f'{count}', '-P', f'{8*1024*1024}', '-V', proto, url
+        ])
+        r.check_exit_code(0)
+        srcfile = os.path.join(httpd.docs_dir, docname)
+        self.check_downloads(client, srcfile, count)
+        grown = shrunk = 0
+        for line in r.trace_lines:
+            m = re.match(r'.*stream window (\d+) -> (\d+)( on pause)?', line)
+            if m:
+                if m.group(3):
+                    assert int(m.group(2)) < int(m.group(1)), f'{line}'
+                    shrunk += 1
+                else:
+                    assert int(m.group(2)) > int(m.group(1)), f'{line}'
+                    grown += 1
+        assert grown > 0, 'stream window did not grow'
+        assert shrunk > 0, 'stream window did not shrink on pause'
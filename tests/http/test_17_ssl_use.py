@@ -574,3 +574,23 @@ class TestSSLUse:
         ])
         # expect NOT_IMPLEMENTED or OK
         assert r.exit_code in [0, 2], f'{r.dump_logs()}'
+
+    # connections of a multi handle with the same TLS config share a
+    # set up SSL_CTX
+    def test_17_21_ssl_ctx_reuse(self, env: Env, httpd):
+        proto = 'http/1.1'
+        if not env.curl_uses_lib('openssl') and \
+           not env.curl_uses_lib('libressl'):
+            pytest.skip('only OpenSSL keeps SSL_CTX for reuse')
+        count = 3
+        curl = CurlClient(env=env)
+        url = f'https://{env.authority_for(env.domain1, proto)}/curltest/sslinfo?id=[0-{count-1}]'
+        r = curl.http_download(urls=[url], alpn_proto=proto, extra_args=[
+            '--parallel', '--parallel-max', '1',
+            '--header', 'Connection: close',
+            '--trace-config', 'ssl',
+        ])
+        r.check_response(count=count, http_status=200)
+        reused = [line for line in r.trace_lines
+                  if re.search(r'reusing SSL_CTX set up before', line)]
+        assert len(reused) == count - 1, f'{r.dump_logs()}'
@@ -0,0 +1,73 @@
+/***************************************************************************
+ *                                  _   _ ____  _
+ *  Project                     ___| | | |  _ \| |
+ *                             / __| | | | |_) | |
+ *                            | (__| |_| |  _ <| |___
+ *                             \___|\___/|_| \_\_____|
+ *
+ * Copyright (C) Daniel Stenberg, <daniel@haxx.se>, et al.
+ *
+ * This software is licensed as described in the file COPYING, which
+ * you should have received as part of this distribution. The terms
+ * are also available at https://curl.se/docs/copyright.html.
+ *
+ * You may opt to use, copy, modify, merge, publish, distribute and/or sell
+ * copies of the Software, and permit persons to whom the Software is
+ * furnished to do so, under the terms of the COPYING file.
+ *
+ * This software is distributed on an "AS IS" basis, WITHOUT WARRANTY OF ANY
+ * KIND, either express or implied.
+ *
+ * SPDX-License-Identifier: curl
+ *
+ ***************************************************************************/
+#include "first.h"
+
+#include "memdebug.h"
+
+/* PUT from application owned buffers with CURLOPT_UPLOAD_IOV. The body is
+   larger than the upload buffer, so that most of it is sent in place. */
+static CURLcode test_lib3037(const char *URL)
+{
+  static const char head[] = "start-";
+  static const char tail[] = "-end";
+  CURLcode res = CURLE_OK;
+  CURL *curl = NULL;
+  struct curl_iovec iov[5];
+  char *body;
+  size_t blen = 20000;
+
+  body = malloc(blen);
+  if(!body)
+    return TEST_ERR_MAJOR_BAD;
+  memset(body, 'x', blen);
+
+  iov[0].base = head;
+  iov[0].len = sizeof(head) - 1;
+  iov[1].base = body;  /* an empty entry is skipped */
+  iov[1].len = 0;
+  iov[2].base = body;
+  iov[2].len = blen;
+  iov[3].base = tail;
+  iov[3].len = sizeof(tail) - 1;
+  iov[4].base = NULL;
+  iov[4].len = 0;
+
+  global_init(CURL_GLOBAL_ALL);
+
+  easy_init(curl);
+  easy_setopt(curl, CURLOPT_URL, URL);
+  easy_setopt(curl, CURLOPT_HEADER, 1L);
+  easy_setopt(curl, CURLOPT_UPLOAD, 1L);
+  easy_setopt(curl, CURLOPT_UPLOAD_BUFFERSIZE, 16384L);
+  easy_setopt(curl, CURLOPT_UPLOAD_IOV, iov);
+
+  res = curl_easy_perform(curl);
+
+test_cleanup:
+  curl_easy_cleanup(curl);
+  curl_global_cleanup();
+  free(body);
+
+  return res;
+}
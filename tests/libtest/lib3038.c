@@ -0,0 +1,232 @@
+/***************************************************************************
+ *                                  _   _ ____  _
+ *  Project                     ___| | | |  _ \| |
+ *                             / __| | | | |_) | |
+ *                            | (__| |_| |  _ <| |___
+ *                             \___|\___/|_| \_\_____|
+ *
+ * Copyright (C) Daniel Stenberg, <daniel@haxx.se>, et al.
+ *
+ * This software is licensed as described in the file COPYING, which
+ * you should have received as part of this distribution. The terms
+ * are also available at https://curl.se/docs/copyright.html.
+ *
+ * You may opt to use, copy, modify, merge, publish, distribute and/or sell
+ * copies of the Software, and permit persons to whom the Software is
+ * furnished to do so, under the terms of the COPYING file.
+ *
+ * This software is distributed on an "AS IS" basis, WITHOUT WARRANTY OF ANY
+ * KIND, either express or implied.
+ *
+ * SPDX-License-Identifier: curl
+ *
+ ***************************************************************************/
+#include "first.h"
+
+#include "memdebug.h"
+
+/* Many threads look up host names in the DNS cache of a share. Once with
+ * the cache protected by the application's lock callbacks and once with the
+ * cache split into shards that use built-in locks. Transfers fail right
+ * after the lookup as no socket is opened. The lookups per second for both
+ * runs are written to stderr. */
+
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+
+#define T3038_THREADS 16
+#define T3038_HOSTS   64
+#define T3038_LOOKUPS 500
+
+static pthread_mutex_t t3038_locks[CURL_LOCK_DATA_LAST];
+static int t3038_dns_locked;
+
+static void t3038_lock(CURL *handle, curl_lock_data data,
+                       curl_lock_access access, void *useptr)
+{
+  (void)handle;
+  (void)access;
+  (void)useptr;
+  pthread_mutex_lock(&t3038_locks[data]);
+  if(data == CURL_LOCK_DATA_DNS)
+    t3038_dns_locked++;
+}
+
+static void t3038_unlock(CURL *handle, curl_lock_data data, void *useptr)
+{
+  (void)handle;
+  (void)useptr;
+  pthread_mutex_unlock(&t3038_locks[data]);
+}
+
+static curl_socket_t t3038_opensocket(void *clientp,
+                                      curlsocktype purpose,
+                                      struct curl_sockaddr *address)
+{
+  (void)clientp;
+  (void)purpose;
+  (void)address;
+  return CURL_SOCKET_BAD;
+}
+
+struct t3038_thread {
+  CURLSH *share;
+  unsigned int num;
+  CURLcode result;
+};
+
+static CURLcode t3038_lookup(CURLSH *share, unsigned int host,
+                             struct curl_slist *resolve)
+{
+  CURLcode res = CURLE_OK;
+  CURL *curl = NULL;
+  char url[64];
+
+  curl_msnprintf(url, sizeof(url), "http://host%u.example:8080/", host);
+  easy_init(curl);
+  easy_setopt(curl, CURLOPT_URL, url);
+  easy_setopt(curl, CURLOPT_SHARE, share);
+  easy_setopt(curl, CURLOPT_OPENSOCKETFUNCTION, t3038_opensocket);
+  if(resolve)
+    easy_setopt(curl, CURLOPT_RESOLVE, resolve);
+
+  /* the name is in the cache, the connect is what fails */
+  res = curl_easy_perform(curl);
+  if(res == CURLE_COULDNT_CONNECT)
+    res = CURLE_OK;
+  else {
+    curl_mfprintf(stderr, "%s: returned %d\n", url, res);
+    res = TEST_ERR_FAILURE;
+  }
+
+test_cleanup:
+  curl_easy_cleanup(curl);
+  return res;
+}
+
+static void *t3038_run_thread(void *ptr)
+{
+  struct t3038_thread *t = ptr;
+  unsigned int i;
+
+  for(i = 0; i < T3038_LOOKUPS; i++) {
+    t->result = t3038_lookup(t->share, (t->num + i) % T3038_HOSTS, NULL);
+    if(t->result)
+      break;
+  }
+  return NULL;
+}
+
+static CURLcode t3038_run(long shards)
+{
+  struct t3038_thread threads[T3038_THREADS];
+  pthread_t tids[T3038_THREADS];
+  struct curl_slist *resolve = NULL;
+  struct curltime start;
+  timediff_t elapsed_ms;
+  CURLSH *share = NULL;
+  unsigned int tid_count = 0, i;
+  CURLcode res = CURLE_OK;
+
+  share = curl_share_init();
+  if(!share) {
+    curl_mfprintf(stderr, "curl_share_init() failed\n");
+    return TEST_ERR_MAJOR_BAD;
+  }
+  curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+  curl_share_setopt(share, CURLSHOPT_LOCKFUNC, t3038_lock);
+  curl_share_setopt(share, CURLSHOPT_UNLOCKFUNC, t3038_unlock);
+  if(curl_share_setopt(share, CURLSHOPT_DNS_SHARDS, shards)) {
+    curl_mfprintf(stderr, "CURLSHOPT_DNS_SHARDS %ld failed\n", shards);
+    res = TEST_ERR_FAILURE;
+    goto test_cleanup;
+  }
+
+  /* put all hosts into the shared cache */
+  for(i = 0; i < T3038_HOSTS; i++) {
+    char entry[64];
+    struct curl_slist *list;
+    curl_msnprintf(entry, sizeof(entry), "host%u.example:8080:127.0.0.1", i);
+    list = curl_slist_append(resolve, entry);
+    if(!list) {
+      res = TEST_ERR_MAJOR_BAD;
+      goto test_cleanup;
+    }
+    resolve = list;
+  }
+  res = t3038_lookup(share, 0, resolve);
+  if(res)
+    goto test_cleanup;
+
+  t3038_dns_locked = 0;
+  start = curlx_now();
+  for(i = 0; i < T3038_THREADS; i++) {
+    int rc;
+    threads[i].share = share;
+    threads[i].num = i;
+    threads[i].result = CURLE_OK;
+    rc = pthread_create(&tids[i], NULL, t3038_run_thread, &threads[i]);
+    if(rc) {
+      curl_mfprintf(stderr, "%s:%d Couldn't create thread, errno %d\n",
+                    __FILE__, __LINE__, rc);
+      res = TEST_ERR_MAJOR_BAD;
+      break;
+    }
+    tid_count++;
+  }
+  for(i = 0; i < tid_count; i++) {
+    pthread_join(tids[i], NULL);
+    if(threads[i].result)
+      res = threads[i].result;
+  }
+  elapsed_ms = curlx_timediff(curlx_now(), start);
+
+  if(!res) {
+    curl_mfprintf(stderr, "%ld shards: %d lookups in %" FMT_TIMEDIFF_T
+                  "ms, %" FMT_TIMEDIFF_T " lookups/sec\n", shards,
+                  T3038_THREADS * T3038_LOOKUPS, elapsed_ms,
+                  (timediff_t)T3038_THREADS * T3038_LOOKUPS * 1000 /
+                  (elapsed_ms ? elapsed_ms : 1));
+    /* with shards, the DNS cache does not call the application's lock */
+    if((shards > 1) == !!t3038_dns_locked) {
+      curl_mfprintf(stderr, "DNS lock callback called %d times\n",
+                    t3038_dns_locked);
+      res = TEST_ERR_FAILURE;
+    }
+  }
+
+test_cleanup:
+  curl_slist_free_all(resolve);
+  curl_share_cleanup(share);
+  return res;
+}
+
+static CURLcode test_lib3038(const char *URL)
+{
+  CURLcode res;
+  int i;
+  (void)URL;
+
+  for(i = 0; i < CURL_LOCK_DATA_LAST; i++)
+    pthread_mutex_init(&t3038_locks[i], NULL);
+
+  res = curl_global_init(CURL_GLOBAL_ALL);
+  if(!res) {
+    res = t3038_run(0);
+    if(!res)
+      res = t3038_run(16);
+    curl_global_cleanup();
+  }
+
+  for(i = 0; i < CURL_LOCK_DATA_LAST; i++)
+    pthread_mutex_destroy(&t3038_locks[i]);
+  return res;
+}
+
+#else /* without pthread, this test does not work */
+static CURLcode test_lib3038(const char *URL)
+{
+  (void)URL;
+  return CURLE_OK;
+}
+#endif
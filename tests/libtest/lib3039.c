@@ -0,0 +1,135 @@
+/***************************************************************************
+ *                                  _   _ ____  _
+ *  Project                     ___| | | |  _ \| |
+ *                             / __| | | | |_) | |
+ *                            | (__| |_| |  _ <| |___
+ *                             \___|\___/|_| \_\_____|
+ *
+ * Copyright (C) Daniel Stenberg, <daniel@haxx.se>, et al.
+ *
+ * This software is licensed as described in the file COPYING, which
+ * you should have received as part of this distribution. The terms
+ * are also available at https://curl.se/docs/copyright.html.
+ *
+ * You may opt to use, copy, modify, merge, publish, distribute and/or sell
+ * copies of the Software, and permit persons to whom the Software is
+ * furnished to do so, under the terms of the COPYING file.
+ *
+ * This software is distributed on an "AS IS" basis, WITHOUT WARRANTY OF ANY
+ * KIND, either express or implied.
+ *
+ * SPDX-License-Identifier: curl
+ *
+ ***************************************************************************/
+#include "first.h"
+
+#include "memdebug.h"
+
+/* Parallel transfers resolve names with a small pool of resolver threads.
+ * Half of them look up the same name, the others one name each. Whether the
+ * names resolve or not, no socket is opened and all transfers must end.
+ * Then all transfers are started again and the multi handle is cleaned up
+ * while they are still resolving. */
+
+#define T3039_HANDLES 12
+
+static curl_socket_t t3039_opensocket(void *clientp,
+                                      curlsocktype purpose,
+                                      struct curl_sockaddr *address)
+{
+  (void)clientp;
+  (void)purpose;
+  (void)address;
+  return CURL_SOCKET_BAD;
+}
+
+static CURLcode test_lib3039(const char *URL)
+{
+  CURLcode res = CURLE_OK;
+  CURL *curl[T3039_HANDLES] = {0};
+  CURLM *m = NULL;
+  CURLMsg *msg;
+  int running;
+  int msgs_left;
+  int done = 0;
+  size_t i;
+
+  (void)URL;
+  start_test_timing();
+
+  global_init(CURL_GLOBAL_ALL);
+
+  multi_init(m);
+
+  if(curl_multi_setopt(m, CURLMOPT_RESOLVE_THREADS, -1L) !=
+     CURLM_BAD_FUNCTION_ARGUMENT) {
+    curl_mfprintf(stderr, "negative CURLMOPT_RESOLVE_THREADS accepted\n");
+    res = TEST_ERR_FAILURE;
+    goto test_cleanup;
+  }
+  multi_setopt(m, CURLMOPT_RESOLVE_THREADS, 2L);
+  multi_setopt(m, CURLMOPT_RESOLVE_QUEUE, 0L);
+
+  for(i = 0; i < CURL_ARRAYSIZE(curl); i++) {
+    char url[64];
+    if(i % 2)
+      curl_msnprintf(url, sizeof(url), "http://same.invalid/");
+    else
+      curl_msnprintf(url, sizeof(url), "http://host%zu.invalid/", i);
+    easy_init(curl[i]);
+    easy_setopt(curl[i], CURLOPT_URL, url);
+    easy_setopt(curl[i], CURLOPT_OPENSOCKETFUNCTION, t3039_opensocket);
+    multi_add_handle(m, curl[i]);
+  }
+
+  for(;;) {
+    int num;
+
+    multi_perform(m, &running);
+
+    abort_on_test_timeout();
+
+    while((msg = curl_multi_info_read(m, &msgs_left))) {
+      if(msg->msg == CURLMSG_DONE) {
+        done++;
+        if((msg->data.result != CURLE_COULDNT_RESOLVE_HOST) &&
+           (msg->data.result != CURLE_COULDNT_CONNECT)) {
+          curl_mfprintf(stderr, "transfer failed with %d\n",
+                        (int)msg->data.result);
+          res = TEST_ERR_FAILURE;
+        }
+      }
+    }
+
+    if(!running)
+      break; /* done */
+
+    multi_poll(m, NULL, 0, TEST_HANG_TIMEOUT, &num);
+
+    abort_on_test_timeout();
+  }
+
+  if(!res && (done != T3039_HANDLES)) {
+    curl_mfprintf(stderr, "only %d of %d transfers finished\n",
+                  done, T3039_HANDLES);
+    res = TEST_ERR_FAILURE;
+  }
+  if(res)
+    goto test_cleanup;
+
+  /* start them all again and leave them resolving */
+  for(i = 0; i < CURL_ARRAYSIZE(curl); i++) {
+    curl_multi_remove_handle(m, curl[i]);
+    multi_add_handle(m, curl[i]);
+  }
+  multi_perform(m, &running);
+
+test_cleanup:
+
+  curl_multi_cleanup(m);
+  for(i = 0; i < CURL_ARRAYSIZE(curl); i++)
+    curl_easy_cleanup(curl[i]);
+  curl_global_cleanup();
+
+  return res;
+}
@@ -0,0 +1,116 @@
+/***************************************************************************
+ *                                  _   _ ____  _
+ *  Project                     ___| | | |  _ \| |
+ *                             / __| | | | |_) | |
+ *                            | (__| |_| |  _ <| |___
+ *                             \___|\___/|_| \_\_____|
+ *
+ * Copyright (C) Daniel Stenberg, <daniel@haxx.se>, et al.
+ *
+ * This software is licensed as described in the file COPYING, which
+ * you should have received as part of this distribution. The terms
+ * are also available at https://curl.se/docs/copyright.html.
+ *
+ * You may opt to use, copy, modify, merge, publish, distribute and/or sell
+ * copies of the Software, and permit persons to whom the Software is
+ * furnished to do so, under the terms of the COPYING file.
+ *
+ * This software is distributed on an "AS IS" basis, WITHOUT WARRANTY OF ANY
+ * KIND, either express or implied.
+ *
+ * SPDX-License-Identifier: curl
+ *
+ ***************************************************************************/
+#include "first.h"
+
+#include "memdebug.h"
+
+/* A name that does not resolve is looked up three times in a row. With
+ * failures cached, the first transfer stores the failure and the others
+ * use it. With CURLOPT_DNS_NEGATIVE_TIMEOUT set to 0, nothing is stored. */
+
+#define T3040_TRANSFERS 3
+
+static CURLcode t3040_run(long neg_timeout, curl_off_t exp_added,
+                          curl_off_t exp_hits)
+{
+  CURLcode res = CURLE_OK;
+  CURL *curl = NULL;
+  CURLM *m = NULL;
+  CURLMsg *msg;
+  curl_off_t added = -1, hits = -1;
+  int running;
+  int msgs_left;
+  int i;
+
+  multi_init(m);
+  easy_init(curl);
+  easy_setopt(curl, CURLOPT_URL, "http://negative.invalid/");
+  if(neg_timeout >= 0)
+    easy_setopt(curl, CURLOPT_DNS_NEGATIVE_TIMEOUT, neg_timeout);
+
+  for(i = 0; i < T3040_TRANSFERS; i++) {
+    multi_add_handle(m, curl);
+    for(;;) {
+      int num;
+
+      multi_perform(m, &running);
+
+      abort_on_test_timeout();
+
+      if(!running)
+        break; /* done */
+
+      multi_poll(m, NULL, 0, TEST_HANG_TIMEOUT, &num);
+
+      abort_on_test_timeout();
+    }
+    while((msg = curl_multi_info_read(m, &msgs_left))) {
+      if((msg->msg == CURLMSG_DONE) &&
+         (msg->data.result != CURLE_COULDNT_RESOLVE_HOST)) {
+        curl_mfprintf(stderr, "transfer returned %d\n",
+                      (int)msg->data.result);
+        res = TEST_ERR_FAILURE;
+      }
+    }
+    multi_remove_handle(m, curl);
+    if(res)
+      goto test_cleanup;
+  }
+
+  curl_multi_get_offt(m, CURLMINFO_DNS_NEGATIVE_ADDED, &added);
+  curl_multi_get_offt(m, CURLMINFO_DNS_NEGATIVE_HITS, &hits);
+  if((added != exp_added) || (hits != exp_hits)) {
+    curl_mfprintf(stderr, "timeout %ld: %" CURL_FORMAT_CURL_OFF_T
+                  " added, %" CURL_FORMAT_CURL_OFF_T " hits, expected %"
+                  CURL_FORMAT_CURL_OFF_T " and %" CURL_FORMAT_CURL_OFF_T "\n",
+                  neg_timeout, added, hits, exp_added, exp_hits);
+    res = TEST_ERR_FAILURE;
+  }
+
+test_cleanup:
+  curl_multi_remove_handle(m, curl);
+  curl_easy_cleanup(curl);
+  curl_multi_cleanup(m);
+  return res;
+}
+
+static CURLcode test_lib3040(const char *URL)
+{
+  CURLcode res = CURLE_OK;
+
+  (void)URL;
+  start_test_timing();
+
+  global_init(CURL_GLOBAL_ALL);
+
+  /* the default, half the DNS cache timeout */
+  res = t3040_run(-1, 1, T3040_TRANSFERS - 1);
+  if(!res)
+    res = t3040_run(300, 1, T3040_TRANSFERS - 1);
+  if(!res)
+    res = t3040_run(0, 0, 0);
+
+  curl_global_cleanup();
+  return res;
+}
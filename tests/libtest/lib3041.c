@@ -0,0 +1,134 @@
+/***************************************************************************
+ *                                  _   _ ____  _
+ *  Project                     ___| | | |  _ \| |
+ *                             / __| | | | |_) | |
+ *                            | (__| |_| |  _ <| |___
+ *                             \___|\___/|_| \_\_____|
+ *
+ * Copyright (C) Daniel Stenberg, <daniel@haxx.se>, et al.
+ *
+ * This software is licensed as described in the file COPYING, which
+ * you should have received as part of this distribution. The terms
+ * are also available at https://curl.se/docs/copyright.html.
+ *
+ * You may opt to use, copy, modify, merge, publish, distribute and/or sell
+ * copies of the Software, and permit persons to whom the Software is
+ * furnished to do so, under the terms of the COPYING file.
+ *
+ * This software is distributed on an "AS IS" basis, WITHOUT WARRANTY OF ANY
+ * KIND, either express or implied.
+ *
+ * SPDX-License-Identifier: curl
+ *
+ ***************************************************************************/
+#include "first.h"
+
+#include "memdebug.h"
+
+/* A DNS cache file with one fresh and one outdated entry is loaded. The
+ * fresh name is found in the cache, the outdated one is not. A third name
+ * is added with a non-permanent CURLOPT_RESOLVE entry. When the handle is
+ * cleaned up, the cache is written back to the file and the fresh entry
+ * is still in it, the one from CURLOPT_RESOLVE is not. */
+
+static curl_socket_t t3041_opensocket(void *clientp,
+                                      curlsocktype purpose,
+                                      struct curl_sockaddr *address)
+{
+  (void)clientp;
+  (void)purpose;
+  (void)address;
+  return CURL_SOCKET_BAD;
+}
+
+static CURLcode t3041_transfer(CURL *curl, const char *url,
+                               CURLcode expected)
+{
+  CURLcode res;
+
+  easy_setopt(curl, CURLOPT_URL, url);
+  res = curl_easy_perform(curl);
+  if(res != expected) {
+    curl_mfprintf(stderr, "%s: returned %d, expected %d\n", url, res,
+                  expected);
+    return TEST_ERR_FAILURE;
+  }
+  res = CURLE_OK;
+
+test_cleanup:
+  return res;
+}
+
+static CURLcode test_lib3041(const char *URL)
+{
+  CURLcode res = CURLE_OK;
+  CURL *curl = NULL;
+  struct curl_slist *resolve = NULL;
+  FILE *fp;
+  char line[256];
+  int fresh = 0, outdated = 0, resolved = 0;
+
+  fp = fopen(URL, FOPEN_WRITETEXT);
+  if(!fp) {
+    curl_mfprintf(stderr, "cannot write %s\n", URL);
+    return TEST_ERR_MAJOR_BAD;
+  }
+  curl_mfprintf(fp, "# DNS cache\n"
+                "fresh.invalid 80 %ld 127.0.0.1,::1\n"
+                "outdated.invalid 80 %ld 127.0.0.1\n",
+                (long)time(NULL), (long)time(NULL) - 3600);
+  fclose(fp);
+
+  global_init(CURL_GLOBAL_ALL);
+  resolve = curl_slist_append(NULL, "+resolved.invalid:80:127.0.0.1");
+  if(!resolve) {
+    res = TEST_ERR_MAJOR_BAD;
+    goto test_cleanup;
+  }
+  easy_init(curl);
+  easy_setopt(curl, CURLOPT_DNS_CACHE_FILE, URL);
+  easy_setopt(curl, CURLOPT_RESOLVE, resolve);
+  easy_setopt(curl, CURLOPT_OPENSOCKETFUNCTION, t3041_opensocket);
+
+  /* found in the cache, the connect is what fails */
+  res = t3041_transfer(curl, "http://fresh.invalid/", CURLE_COULDNT_CONNECT);
+  if(!res)
+    res = t3041_transfer(curl, "http://outdated.invalid/",
+                         CURLE_COULDNT_RESOLVE_HOST);
+  if(!res)
+    res = t3041_transfer(curl, "http://resolved.invalid/",
+                         CURLE_COULDNT_CONNECT);
+  if(res)
+    goto test_cleanup;
+
+  /* the cache is saved when the handle goes away */
+  curl_easy_cleanup(curl);
+  curl = NULL;
+
+  fp = fopen(URL, FOPEN_READTEXT);
+  if(!fp) {
+    curl_mfprintf(stderr, "cannot read %s\n", URL);
+    res = TEST_ERR_FAILURE;
+    goto test_cleanup;
+  }
+  while(fgets(line, sizeof(line), fp)) {
+    if(!strncmp(line, "fresh.invalid 80 ", 17))
+      fresh++;
+    else if(!strncmp(line, "outdated.invalid ", 17))
+      outdated++;
+    else if(!strncmp(line, "resolved.invalid ", 17))
+      resolved++;
+  }
+  fclose(fp);
+  if((fresh != 1) || outdated || resolved) {
+    curl_mfprintf(stderr, "saved file has %d fresh, %d outdated and %d "
+                  "CURLOPT_RESOLVE entries\n", fresh, outdated, resolved);
+    res = TEST_ERR_FAILURE;
+  }
+
+test_cleanup:
+  curl_easy_cleanup(curl);
+  curl_slist_free_all(resolve);
+  curl_global_cleanup();
+  return res;
+}
@@ -0,0 +1,149 @@
+/***************************************************************************
+ *                                  _   _ ____  _
+ *  Project                     ___| | | |  _ \| |
+ *                             / __| | | | |_) | |
+ *                            | (__| |_| |  _ <| |___
+ *                             \___|\___/|_| \_\_____|
+ *
+ * Copyright (C) Daniel Stenberg, <daniel@haxx.se>, et al.
+ *
+ * This software is licensed as described in the file COPYING, which
+ * you should have received as part of this distribution. The terms
+ * are also available at https://curl.se/docs/copyright.html.
+ *
+ * You may opt to use, copy, modify, merge, publish, distribute and/or sell
+ * copies of the Software, and permit persons to whom the Software is
+ * furnished to do so, under the terms of the COPYING file.
+ *
+ * This software is distributed on an "AS IS" basis, WITHOUT WARRANTY OF ANY
+ * KIND, either express or implied.
+ *
+ * SPDX-License-Identifier: curl
+ *
+ ***************************************************************************/
+#include "first.h"
+
+#include "memdebug.h"
+
+/* localhost is looked up with a DNS cache timeout of one second. Once the
+ * entry expired, it is still used while it is resolved again in the
+ * background, until the refreshed entry replaces it. Without
+ * CURLOPT_DNS_STALE_TIMEOUT, the expired entry is not used. */
+
+static curl_socket_t t3042_opensocket(void *clientp,
+                                      curlsocktype purpose,
+                                      struct curl_sockaddr *address)
+{
+  (void)clientp;
+  (void)purpose;
+  (void)address;
+  return CURL_SOCKET_BAD;
+}
+
+static CURLcode t3042_transfer(CURLM *m, CURL *curl)
+{
+  CURLcode res = CURLE_OK;
+  CURLMsg *msg;
+  int running;
+  int msgs_left;
+
+  multi_add_handle(m, curl);
+  for(;;) {
+    int num;
+
+    multi_perform(m, &running);
+
+    abort_on_test_timeout();
+
+    if(!running)
+      break; /* done */
+
+    multi_poll(m, NULL, 0, TEST_HANG_TIMEOUT, &num);
+
+    abort_on_test_timeout();
+  }
+  /* the name is found, the connect is what fails */
+  while((msg = curl_multi_info_read(m, &msgs_left))) {
+    if((msg->msg == CURLMSG_DONE) &&
+       (msg->data.result != CURLE_COULDNT_CONNECT)) {
+      curl_mfprintf(stderr, "transfer returned %d\n", (int)msg->data.result);
+      res = TEST_ERR_FAILURE;
+    }
+  }
+
+test_cleanup:
+  curl_multi_remove_handle(m, curl);
+  return res;
+}
+
+static CURLcode t3042_run(long stale_timeout)
+{
+  CURLcode res = CURLE_OK;
+  CURL *curl = NULL;
+  CURLM *m = NULL;
+  curl_off_t hits = 0, stale = 0, misses = 0;
+  int i;
+
+  multi_init(m);
+  easy_init(curl);
+  easy_setopt(curl, CURLOPT_URL, "http://localhost:3042/");
+  easy_setopt(curl, CURLOPT_OPENSOCKETFUNCTION, t3042_opensocket);
+  easy_setopt(curl, CURLOPT_DNS_CACHE_TIMEOUT, 1L);
+  easy_setopt(curl, CURLOPT_DNS_STALE_TIMEOUT, stale_timeout);
+
+  /* a miss and a hit */
+  res = t3042_transfer(m, curl);
+  if(!res)
+    res = t3042_transfer(m, curl);
+  if(res)
+    goto test_cleanup;
+
+  /* let the entry expire */
+  curlx_wait_ms(1100);
+
+  /* until the refreshed entry is used */
+  for(i = 0; !res && (i < 50); i++) {
+    res = t3042_transfer(m, curl);
+    curl_multi_get_offt(m, CURLMINFO_DNS_HITS, &hits);
+    if(hits > 1)
+      break;
+    curlx_wait_ms(100);
+  }
+  if(res)
+    goto test_cleanup;
+
+  curl_multi_get_offt(m, CURLMINFO_DNS_STALE_HITS, &stale);
+  curl_multi_get_offt(m, CURLMINFO_DNS_MISSES, &misses);
+  if(stale_timeout ?
+     ((hits != 2) || (stale < 1) || (misses != 1)) :
+     ((hits != 2) || stale || (misses != 2))) {
+    curl_mfprintf(stderr, "stale timeout %ld: %" CURL_FORMAT_CURL_OFF_T
+                  " hits, %" CURL_FORMAT_CURL_OFF_T " stale, %"
+                  CURL_FORMAT_CURL_OFF_T " misses\n",
+                  stale_timeout, hits, stale, misses);
+    res = TEST_ERR_FAILURE;
+  }
+
+test_cleanup:
+  curl_multi_remove_handle(m, curl);
+  curl_easy_cleanup(curl);
+  curl_multi_cleanup(m);
+  return res;
+}
+
+static CURLcode test_lib3042(const char *URL)
+{
+  CURLcode res = CURLE_OK;
+
+  (void)URL;
+  start_test_timing();
+
+  global_init(CURL_GLOBAL_ALL);
+
+  res = t3042_run(60);
+  if(!res)
+    res = t3042_run(0);
+
+  curl_global_cleanup();
+  return res;
+}
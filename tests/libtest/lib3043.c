@@ -0,0 +1,134 @@
+/***************************************************************************
+ *                                  _   _ ____  _
+ *  Project                     ___| | | |  _ \| |
+ *                             / __| | | | |_) | |
+ *                            | (__| |_| |  _ <| |___
+ *                             \___|\___/|_| \_\_____|
+ *
+ * Copyright (C) Daniel Stenberg, <daniel@haxx.se>, et al.
+ *
+ * This software is licensed as described in the file COPYING, which
+ * you should have received as part of this distribution. The terms
+ * are also available at https://curl.se/docs/copyright.html.
+ *
+ * You may opt to use, copy, modify, merge, publish, distribute and/or sell
+ * copies of the Software, and permit persons to whom the Software is
+ * furnished to do so, under the terms of the COPYING file.
+ *
+ * This software is distributed on an "AS IS" basis, WITHOUT WARRANTY OF ANY
+ * KIND, either express or implied.
+ *
+ * SPDX-License-Identifier: curl
+ *
+ ***************************************************************************/
+#include "first.h"
+
+#include "memdebug.h"
+
+/* Two connections to the server are made ahead of time with
+ * curl_multi_prewarm(). A transfer added later reuses one of them. */
+
+#define T3043_WARM 2
+
+static CURLcode test_lib3043(const char *URL)
+{
+  CURLcode res = CURLE_OK;
+  CURL *curl = NULL;
+  CURLM *m = NULL;
+  CURLMsg *msg;
+  CURLMcode mc;
+  curl_off_t added = 0;
+  long connects = -1;
+  int running;
+  int msgs_left;
+
+  start_test_timing();
+
+  global_init(CURL_GLOBAL_ALL);
+
+  multi_init(m);
+  easy_init(curl);
+
+  /* a handle without URL tells nothing to connect to */
+  mc = curl_multi_prewarm(m, curl, T3043_WARM);
+  if(mc != CURLM_BAD_FUNCTION_ARGUMENT) {
+    curl_mfprintf(stderr, "prewarm without URL returned %d\n", (int)mc);
+    res = TEST_ERR_FAILURE;
+    goto test_cleanup;
+  }
+
+  easy_setopt(curl, CURLOPT_URL, URL);
+  mc = curl_multi_prewarm(m, curl, T3043_WARM);
+  if(mc) {
+    curl_mfprintf(stderr, "curl_multi_prewarm() returned %d\n", (int)mc);
+    res = TEST_ERR_MULTI;
+    goto test_cleanup;
+  }
+
+  /* run until the connections are made, the transfers making them do not
+     count as running */
+  for(;;) {
+    curl_off_t busy = 0;
+    int num;
+
+    multi_perform(m, &running);
+
+    abort_on_test_timeout();
+
+    if(running) {
+      curl_mfprintf(stderr, "%d prewarm transfers running\n", running);
+      res = TEST_ERR_FAILURE;
+      goto test_cleanup;
+    }
+    curl_multi_get_offt(m, CURLMINFO_XFERS_RUNNING, &busy);
+    if(!busy)
+      break; /* done */
+
+    multi_poll(m, NULL, 0, TEST_HANG_TIMEOUT, &num);
+
+    abort_on_test_timeout();
+  }
+
+  /* no messages for the connections made internally */
+  if(curl_multi_info_read(m, &msgs_left)) {
+    curl_mfprintf(stderr, "unexpected message for prewarm transfer\n");
+    res = TEST_ERR_FAILURE;
+    goto test_cleanup;
+  }
+  curl_multi_get_offt(m, CURLMINFO_XFERS_ADDED, &added);
+
+  multi_add_handle(m, curl);
+  for(;;) {
+    int num;
+
+    multi_perform(m, &running);
+
+    abort_on_test_timeout();
+
+    if(!running)
+      break; /* done */
+
+    multi_poll(m, NULL, 0, TEST_HANG_TIMEOUT, &num);
+
+    abort_on_test_timeout();
+  }
+
+  while((msg = curl_multi_info_read(m, &msgs_left))) {
+    if(msg->msg == CURLMSG_DONE) {
+      res = msg->data.result;
+      curl_easy_getinfo(msg->easy_handle, CURLINFO_NUM_CONNECTS, &connects);
+    }
+  }
+  if(!res && (connects || (added != T3043_WARM))) {
+    curl_mfprintf(stderr, "%ld new connections, %" CURL_FORMAT_CURL_OFF_T
+                  " transfers added before\n", connects, added);
+    res = TEST_ERR_FAILURE;
+  }
+
+test_cleanup:
+  curl_multi_remove_handle(m, curl);
+  curl_easy_cleanup(curl);
+  curl_multi_cleanup(m);
+  curl_global_cleanup();
+  return res;
+}
@@ -0,0 +1,285 @@
+/***************************************************************************
+ *                                  _   _ ____  _
+ *  Project                     ___| | | |  _ \| |
+ *                             / __| | | | |_) | |
+ *                            | (__| |_| |  _ <| |___
+ *                             \___|\___/|_| \_\_____|
+ *
+ * Copyright (C) Daniel Stenberg, <daniel@haxx.se>, et al.
+ *
+ * This software is licensed as described in the file COPYING, which
+ * you should have received as part of this distribution. The terms
+ * are also available at https://curl.se/docs/copyright.html.
+ *
+ * You may opt to use, copy, modify, merge, publish, distribute and/or sell
+ * copies of the Software, and permit persons to whom the Software is
+ * furnished to do so, under the terms of the COPYING file.
+ *
+ * This software is distributed on an "AS IS" basis, WITHOUT WARRANTY OF ANY
+ * KIND, either express or implied.
+ *
+ * SPDX-License-Identifier: curl
+ *
+ ***************************************************************************/
+#include "first.h"
+
+#include "memdebug.h"
+
+/* Threads do transfers to a number of host names that all resolve to the
+ * test server, taking connections out of the pool of a share and putting
+ * them back. Once with the pool protected by the application's lock
+ * callbacks and once with the pool split into shards that use built-in
+ * locks, each for a growing number of threads. The checkouts per second of
+ * all runs are written to stderr. A last run has the threads go to more
+ * hosts than the pool has room for, so that they evict connections from
+ * all shards at the same time. */
+
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+
+#define T3044_MAX_THREADS 8
+#define T3044_HOSTS       8
+#define T3044_CHECKOUTS   40
+/* hosts and pool size of the run that evicts connections */
+#define T3044_EVICT_HOSTS 32
+#define T3044_EVICT_CONNS 2L
+
+static pthread_mutex_t t3044_locks[CURL_LOCK_DATA_LAST];
+static int t3044_connect_locked;
+
+static void t3044_lock(CURL *handle, curl_lock_data data,
+                       curl_lock_access access, void *useptr)
+{
+  (void)handle;
+  (void)access;
+  (void)useptr;
+  pthread_mutex_lock(&t3044_locks[data]);
+  if(data == CURL_LOCK_DATA_CONNECT)
+    t3044_connect_locked++;
+}
+
+static void t3044_unlock(CURL *handle, curl_lock_data data, void *useptr)
+{
+  (void)handle;
+  (void)useptr;
+  pthread_mutex_unlock(&t3044_locks[data]);
+}
+
+static size_t t3044_write_cb(char *ptr, size_t size, size_t nmemb,
+                             void *userp)
+{
+  (void)ptr;
+  (void)userp;
+  return size * nmemb;
+}
+
+struct t3044_thread {
+  CURLSH *share;
+  struct curl_slist *resolve;
+  const char *port;
+  const char *path;
+  unsigned int num;
+  unsigned int hosts;
+  long maxconnects;
+  unsigned int reused;
+  CURLcode result;
+};
+
+static CURLcode t3044_checkout(struct t3044_thread *t, unsigned int host)
+{
+  CURLcode res = CURLE_OK;
+  CURL *curl = NULL;
+  long connects = 0;
+  char url[256];
+
+  curl_msnprintf(url, sizeof(url), "http://host%u.example:%s%s",
+                 host, t->port, t->path);
+  easy_init(curl);
+  easy_setopt(curl, CURLOPT_URL, url);
+  easy_setopt(curl, CURLOPT_SHARE, t->share);
+  easy_setopt(curl, CURLOPT_RESOLVE, t->resolve);
+  easy_setopt(curl, CURLOPT_WRITEFUNCTION, t3044_write_cb);
+  easy_setopt(curl, CURLOPT_MAXCONNECTS, t->maxconnects);
+
+  res = curl_easy_perform(curl);
+  if(res) {
+    curl_mfprintf(stderr, "%s: returned %d\n", url, res);
+    goto test_cleanup;
+  }
+  res = curl_easy_getinfo(curl, CURLINFO_NUM_CONNECTS, &connects);
+  if(!res && !connects)
+    t->reused++;
+
+test_cleanup:
+  curl_easy_cleanup(curl);
+  return res;
+}
+
+static void *t3044_run_thread(void *ptr)
+{
+  struct t3044_thread *t = ptr;
+  unsigned int i;
+
+  for(i = 0; i < T3044_CHECKOUTS; i++) {
+    t->result = t3044_checkout(t, (t->num + i) % t->hosts);
+    if(t->result)
+      break;
+  }
+  return NULL;
+}
+
+static CURLcode t3044_run(long shards, unsigned int nthreads, bool evict,
+                          struct curl_slist *resolve,
+                          const char *port, const char *path)
+{
+  struct t3044_thread threads[T3044_MAX_THREADS];
+  pthread_t tids[T3044_MAX_THREADS];
+  struct curltime start;
+  timediff_t elapsed_ms;
+  CURLSH *share = NULL;
+  unsigned int tid_count = 0, reused = 0, i;
+  CURLcode res = CURLE_OK;
+
+  share = curl_share_init();
+  if(!share) {
+    curl_mfprintf(stderr, "curl_share_init() failed\n");
+    return TEST_ERR_MAJOR_BAD;
+  }
+  curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+  curl_share_setopt(share, CURLSHOPT_LOCKFUNC, t3044_lock);
+  curl_share_setopt(share, CURLSHOPT_UNLOCKFUNC, t3044_unlock);
+  if(curl_share_setopt(share, CURLSHOPT_CONNECT_SHARDS, shards)) {
+    curl_mfprintf(stderr, "CURLSHOPT_CONNECT_SHARDS %ld failed\n", shards);
+    res = TEST_ERR_FAILURE;
+    goto test_cleanup;
+  }
+
+  t3044_connect_locked = 0;
+  start = curlx_now();
+  for(i = 0; i < nthreads; i++) {
+    int rc;
+    threads[i].share = share;
+    threads[i].resolve = resolve;
+    threads[i].port = port;
+    threads[i].path = path;
+    threads[i].num = i;
+    if(evict) {
+      threads[i].hosts = T3044_EVICT_HOSTS;
+      threads[i].maxconnects = T3044_EVICT_CONNS;
+    }
+    else {
+      threads[i].hosts = T3044_HOSTS;
+      /* room for a connection to every host from every thread */
+      threads[i].maxconnects = (long)(T3044_HOSTS * T3044_MAX_THREADS);
+    }
+    threads[i].reused = 0;
+    threads[i].result = CURLE_OK;
+    rc = pthread_create(&tids[i], NULL, t3044_run_thread, &threads[i]);
+    if(rc) {
+      curl_mfprintf(stderr, "%s:%d Couldn't create thread, errno %d\n",
+                    __FILE__, __LINE__, rc);
+      res = TEST_ERR_MAJOR_BAD;
+      break;
+    }
+    tid_count++;
+  }
+  for(i = 0; i < tid_count; i++) {
+    pthread_join(tids[i], NULL);
+    if(threads[i].result)
+      res = threads[i].result;
+    reused += threads[i].reused;
+  }
+  elapsed_ms = curlx_timediff(curlx_now(), start);
+
+  if(!res) {
+    curl_mfprintf(stderr, "%ld shards, %u threads%s: %u checkouts "
+                  "(%u reused) in %" FMT_TIMEDIFF_T "ms, %" FMT_TIMEDIFF_T
+                  " checkouts/sec\n", shards, nthreads,
+                  evict ? ", evicting" : "",
+                  nthreads * T3044_CHECKOUTS, reused, elapsed_ms,
+                  (timediff_t)nthreads * T3044_CHECKOUTS * 1000 /
+                  (elapsed_ms ? elapsed_ms : 1));
+    /* with shards, the pool does not call the application's lock */
+    if((shards > 1) == !!t3044_connect_locked) {
+      curl_mfprintf(stderr, "CONNECT lock callback called %d times\n",
+                    t3044_connect_locked);
+      res = TEST_ERR_FAILURE;
+    }
+    else if(!evict && !reused) {
+      curl_mfprintf(stderr, "no connection was reused\n");
+      res = TEST_ERR_FAILURE;
+    }
+  }
+
+test_cleanup:
+  curl_share_cleanup(share);
+  return res;
+}
+
+static CURLcode test_lib3044(const char *URL)
+{
+  static const unsigned int nthreads[] = { 1, 4, T3044_MAX_THREADS };
+  static const long shards[] = { 0, 16 };
+  struct curl_slist *resolve = NULL;
+  char *host = NULL, *port = NULL, *path = NULL;
+  CURLU *u = NULL;
+  CURLcode res;
+  size_t i, j;
+  int k;
+
+  for(k = 0; k < CURL_LOCK_DATA_LAST; k++)
+    pthread_mutex_init(&t3044_locks[k], NULL);
+
+  res = curl_global_init(CURL_GLOBAL_ALL);
+  if(res)
+    goto test_cleanup;
+
+  u = curl_url();
+  if(!u || curl_url_set(u, CURLUPART_URL, URL, 0) ||
+     curl_url_get(u, CURLUPART_HOST, &host, 0) ||
+     curl_url_get(u, CURLUPART_PORT, &port, 0) ||
+     curl_url_get(u, CURLUPART_PATH, &path, 0)) {
+    res = TEST_ERR_MAJOR_BAD;
+    goto test_cleanup;
+  }
+
+  /* all host names go to the test server */
+  for(i = 0; i < T3044_EVICT_HOSTS; i++) {
+    char entry[128];
+    struct curl_slist *list;
+    curl_msnprintf(entry, sizeof(entry), "host%u.example:%s:%s",
+                   (unsigned int)i, port, host);
+    list = curl_slist_append(resolve, entry);
+    if(!list) {
+      res = TEST_ERR_MAJOR_BAD;
+      goto test_cleanup;
+    }
+    resolve = list;
+  }
+
+  for(i = 0; !res && (i < CURL_ARRAYSIZE(shards)); i++) {
+    for(j = 0; !res && (j < CURL_ARRAYSIZE(nthreads)); j++)
+      res = t3044_run(shards[i], nthreads[j], FALSE, resolve, port, path);
+  }
+  if(!res)
+    res = t3044_run(shards[1], T3044_MAX_THREADS, TRUE, resolve, port, path);
+
+test_cleanup:
+  curl_slist_free_all(resolve);
+  curl_free(host);
+  curl_free(port);
+  curl_free(path);
+  curl_url_cleanup(u);
+  curl_global_cleanup();
+  for(k = 0; k < CURL_LOCK_DATA_LAST; k++)
+    pthread_mutex_destroy(&t3044_locks[k]);
+  return res;
+}
+
+#else /* without pthread, this test does not work */
+static CURLcode test_lib3044(const char *URL)
+{
+  (void)URL;
+  return CURLE_OK;
+}
+#endif
@@ -0,0 +1,178 @@
+/***************************************************************************
+ *                                  _   _ ____  _
+ *  Project                     ___| | | |  _ \| |
+ *                             / __| | | | |_) | |
+ *                            | (__| |_| |  _ <| |___
+ *                             \___|\___/|_| \_\_____|
+ *
+ * Copyright (C) Daniel Stenberg, <daniel@haxx.se>, et al.
+ *
+ * This software is licensed as described in the file COPYING, which
+ * you should have received as part of this distribution. The terms
+ * are also available at https://curl.se/docs/copyright.html.
+ *
+ * You may opt to use, copy, modify, merge, publish, distribute and/or sell
+ * copies of the Software, and permit persons to whom the Software is
+ * furnished to do so, under the terms of the COPYING file.
+ *
+ * This software is distributed on an "AS IS" basis, WITHOUT WARRANTY OF ANY
+ * KIND, either express or implied.
+ *
+ * SPDX-License-Identifier: curl
+ *
+ ***************************************************************************/
+#include "first.h"
+
+#include "memdebug.h"
+
+/* TLS handshakes with a plain HTTP server do not succeed, but only after
+ * the CA bundle is loaded. The first transfer parses the bundle and saves
+ * it to the CURLOPT_CA_CACHE_FILE. Two more transfers then use a share with
+ * CURL_LOCK_DATA_CA: the first one loads the certificates from the cache
+ * file and the second one gets them from the share without loading. */
+
+static int t3045_cache_loads;
+static int t3045_ca_locked;
+
+static void t3045_lock(CURL *handle, curl_lock_data data,
+                       curl_lock_access access, void *useptr)
+{
+  (void)handle;
+  (void)access;
+  (void)useptr;
+  if(data == CURL_LOCK_DATA_CA)
+    t3045_ca_locked++;
+}
+
+static void t3045_unlock(CURL *handle, curl_lock_data data, void *useptr)
+{
+  (void)handle;
+  (void)data;
+  (void)useptr;
+}
+
+static int t3045_debug_cb(CURL *handle, curl_infotype type,
+                          char *data, size_t size, void *userp)
+{
+  static const char loaded[] = "CA certificates loaded from";
+  (void)handle;
+  (void)userp;
+  if((type == CURLINFO_TEXT) && (size >= sizeof(loaded) - 1) &&
+     !memcmp(data, loaded, sizeof(loaded) - 1))
+    t3045_cache_loads++;
+  return 0;
+}
+
+static CURLcode t3045_transfer(const char *URL, CURLSH *share)
+{
+  CURLcode res = CURLE_OK;
+  CURL *curl = NULL;
+
+  easy_init(curl);
+  easy_setopt(curl, CURLOPT_URL, URL);
+  easy_setopt(curl, CURLOPT_CAINFO, libtest_arg2);
+  /* a CA path makes the certificates not cacheable */
+  easy_setopt(curl, CURLOPT_CAPATH, NULL);
+  easy_setopt(curl, CURLOPT_CA_CACHE_FILE, libtest_arg3);
+  easy_setopt(curl, CURLOPT_DEBUGFUNCTION, t3045_debug_cb);
+  easy_setopt(curl, CURLOPT_VERBOSE, 1L);
+  /* the server waits for an HTTP request that never comes */
+  easy_setopt(curl, CURLOPT_TIMEOUT_MS, 1000L);
+  if(share)
+    easy_setopt(curl, CURLOPT_SHARE, share);
+
+  /* the handshake fails, but the CA bundle is loaded when libcurl first
+     tries to read the server's reply */
+  (void)curl_easy_perform(curl);
+
+test_cleanup:
+  curl_easy_cleanup(curl);
+  return res;
+}
+
+/* Check that the cache file has a source line and certificates */
+static CURLcode t3045_check_file(const char *file)
+{
+  char line[8192]; /* room for a base64 encoded certificate */
+  int sources = 0, certs = 0;
+  FILE *fp = fopen(file, FOPEN_READTEXT);
+
+  if(!fp) {
+    curl_mfprintf(stderr, "%s was not written\n", file);
+    return TEST_ERR_FAILURE;
+  }
+  while(fgets(line, sizeof(line), fp)) {
+    if(line[0] == '#')
+      continue;
+    else if(!strncmp(line, "source ", 7))
+      sources++;
+    else if(!sources)
+      break;
+    else
+      certs++;
+  }
+  fclose(fp);
+  if((sources != 1) || !certs) {
+    curl_mfprintf(stderr, "%s: %d source lines, %d certificates\n",
+                  file, sources, certs);
+    return TEST_ERR_FAILURE;
+  }
+  return CURLE_OK;
+}
+
+static CURLcode test_lib3045(const char *URL)
+{
+  CURLSH *share = NULL;
+  CURLcode res;
+
+  if(!libtest_arg2 || !libtest_arg3) {
+    curl_mfprintf(stderr, "Usage: lib3045 [url] [cafile] [cachefile]\n");
+    return TEST_ERR_USAGE;
+  }
+
+  res = curl_global_init(CURL_GLOBAL_ALL);
+  if(res)
+    return res;
+
+  res = t3045_transfer(URL, NULL);
+  if(res)
+    goto test_cleanup;
+  if(t3045_cache_loads) {
+    curl_mfprintf(stderr, "loaded from a cache file not written yet\n");
+    res = TEST_ERR_FAILURE;
+    goto test_cleanup;
+  }
+  res = t3045_check_file(libtest_arg3);
+  if(res)
+    goto test_cleanup;
+
+  share = curl_share_init();
+  if(!share) {
+    res = TEST_ERR_MAJOR_BAD;
+    goto test_cleanup;
+  }
+  curl_share_setopt(share, CURLSHOPT_LOCKFUNC, t3045_lock);
+  curl_share_setopt(share, CURLSHOPT_UNLOCKFUNC, t3045_unlock);
+  if(curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CA)) {
+    curl_mfprintf(stderr, "sharing CURL_LOCK_DATA_CA failed\n");
+    res = TEST_ERR_FAILURE;
+    goto test_cleanup;
+  }
+
+  res = t3045_transfer(URL, share);
+  if(!res)
+    res = t3045_transfer(URL, share);
+  if(res)
+    goto test_cleanup;
+  if((t3045_cache_loads != 1) || !t3045_ca_locked) {
+    curl_mfprintf(stderr, "loaded %d times from the cache file, "
+                  "CA lock taken %d times\n",
+                  t3045_cache_loads, t3045_ca_locked);
+    res = TEST_ERR_FAILURE;
+  }
+
+test_cleanup:
+  curl_share_cleanup(share);
+  curl_global_cleanup();
+  return res;
+}
@@ -0,0 +1,220 @@
+/***************************************************************************
+ *                                  _   _ ____  _
+ *  Project                     ___| | | |  _ \| |
+ *                             / __| | | | |_) | |
+ *                            | (__| |_| |  _ <| |___
+ *                             \___|\___/|_| \_\_____|
+ *
+ * Copyright (C) Daniel Stenberg, <daniel@haxx.se>, et al.
+ *
+ * This software is licensed as described in the file COPYING, which
+ * you should have received as part of this distribution. The terms
+ * are also available at https://curl.se/docs/copyright.html.
+ *
+ * You may opt to use, copy, modify, merge, publish, distribute and/or sell
+ * copies of the Software, and permit persons to whom the Software is
+ * furnished to do so, under the terms of the COPYING file.
+ *
+ * This software is distributed on an "AS IS" basis, WITHOUT WARRANTY OF ANY
+ * KIND, either express or implied.
+ *
+ * SPDX-License-Identifier: curl
+ *
+ ***************************************************************************/
+#include "first.h"
+
+#include "memdebug.h"
+
+/* SSL sessions for a number of peers are imported into a share, moved to a
+ * second share with curl_share_ssls_export() and curl_share_ssls_import(),
+ * and counted there. Broken buffers must fail to import. */
+
+#define T3046_PEERS 3
+
+struct t3046_count {
+  int sessions;
+  int peers_seen[T3046_PEERS];
+};
+
+static CURLcode t3046_export_cb(CURL *handle,
+                                void *userptr,
+                                const char *session_key,
+                                const unsigned char *shmac,
+                                size_t shmac_len,
+                                const unsigned char *sdata,
+                                size_t sdata_len,
+                                curl_off_t valid_until,
+                                int ietf_tls_id,
+                                const char *alpn,
+                                size_t earlydata_max)
+{
+  struct t3046_count *count = userptr;
+  int i;
+
+  (void)handle;
+  (void)shmac;
+  (void)shmac_len;
+  (void)sdata;
+  (void)sdata_len;
+  (void)valid_until;
+  (void)alpn;
+  (void)earlydata_max;
+  count->sessions++;
+  if(session_key && (ietf_tls_id == 0x0304)) {
+    for(i = 0; i < T3046_PEERS; i++) {
+      char key[64];
+      curl_msnprintf(key, sizeof(key), "peer%d.example:443:G", i);
+      if(!strcmp(session_key, key))
+        count->peers_seen[i]++;
+    }
+  }
+  return CURLE_OK;
+}
+
+/* A session as packed by libcurl: version, ticket, TLS version and the
+ * time it is valid until */
+static size_t t3046_session(unsigned char *buf, int num)
+{
+  curl_off_t valid_until = (curl_off_t)time(NULL) + 3600;
+  size_t len = 0;
+  int i;
+
+  buf[len++] = 0x01; /* version */
+  buf[len++] = 0x04; /* ticket */
+  buf[len++] = 0x00;
+  buf[len++] = 0x04;
+  buf[len++] = 't';
+  buf[len++] = 'k';
+  buf[len++] = 't';
+  buf[len++] = (unsigned char)('0' + num);
+  buf[len++] = 0x02; /* IETF TLS version id */
+  buf[len++] = 0x03;
+  buf[len++] = 0x04;
+  buf[len++] = 0x03; /* valid until */
+  for(i = 7; i >= 0; i--)
+    buf[len++] = (unsigned char)(valid_until >> (8 * i));
+  return len;
+}
+
+static CURLSH *t3046_share(void)
+{
+  CURLSH *share = curl_share_init();
+  if(share &&
+     curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION)) {
+    curl_share_cleanup(share);
+    share = NULL;
+  }
+  return share;
+}
+
+static CURLcode test_lib3046(const char *URL)
+{
+  CURLSH *share1 = NULL, *share2 = NULL, *noshare = NULL;
+  CURL *curl = NULL;
+  unsigned char *buf = NULL, *buf2 = NULL;
+  size_t len = 0, len2 = 0;
+  struct t3046_count count;
+  CURLcode res = CURLE_OK;
+  int i;
+
+  (void)URL;
+  global_init(CURL_GLOBAL_ALL);
+
+  share1 = t3046_share();
+  share2 = t3046_share();
+  noshare = curl_share_init();
+  if(!share1 || !share2 || !noshare) {
+    res = TEST_ERR_MAJOR_BAD;
+    goto test_cleanup;
+  }
+
+  easy_init(curl);
+  easy_setopt(curl, CURLOPT_SHARE, share1);
+  for(i = 0; i < T3046_PEERS; i++) {
+    unsigned char sdata[64];
+    size_t slen = t3046_session(sdata, i);
+    char key[64];
+    curl_msnprintf(key, sizeof(key), "peer%d.example:443:G", i);
+    res = curl_easy_ssls_import(curl, key, NULL, 0, sdata, slen);
+    if(res) {
+      curl_mfprintf(stderr, "curl_easy_ssls_import() returned %d\n", res);
+      goto test_cleanup;
+    }
+  }
+
+  res = curl_share_ssls_export(share1, &buf, &len);
+  if(res) {
+    curl_mfprintf(stderr, "curl_share_ssls_export() returned %d\n", res);
+    goto test_cleanup;
+  }
+  res = curl_share_ssls_import(share2, buf, len);
+  if(res) {
+    curl_mfprintf(stderr, "curl_share_ssls_import() returned %d\n", res);
+    goto test_cleanup;
+  }
+
+  /* count the sessions that arrived in the second share */
+  memset(&count, 0, sizeof(count));
+  easy_setopt(curl, CURLOPT_SHARE, share2);
+  res = curl_easy_ssls_export(curl, t3046_export_cb, &count);
+  if(res)
+    goto test_cleanup;
+  if(count.sessions != T3046_PEERS) {
+    curl_mfprintf(stderr, "%d sessions imported, expected %d\n",
+                  count.sessions, T3046_PEERS);
+    res = TEST_ERR_FAILURE;
+    goto test_cleanup;
+  }
+  for(i = 0; i < T3046_PEERS; i++) {
+    if(count.peers_seen[i] != 1) {
+      curl_mfprintf(stderr, "peer %d seen %d times\n", i,
+                    count.peers_seen[i]);
+      res = TEST_ERR_FAILURE;
+      goto test_cleanup;
+    }
+  }
+  easy_setopt(curl, CURLOPT_SHARE, (CURLSH *)NULL);
+
+  /* an export of the copy has the same size */
+  res = curl_share_ssls_export(share2, &buf2, &len2);
+  if(res || (len2 != len)) {
+    curl_mfprintf(stderr, "second export returned %d, %zu bytes, "
+                  "expected %zu\n", res, len2, len);
+    res = TEST_ERR_FAILURE;
+    goto test_cleanup;
+  }
+  curl_free(buf2);
+  buf2 = NULL;
+
+  /* broken buffers and a share without SSL sessions fail */
+  if(curl_share_ssls_import(share2, buf, len - 1) !=
+     CURLE_BAD_FUNCTION_ARGUMENT) {
+    curl_mfprintf(stderr, "truncated buffer imported\n");
+    res = TEST_ERR_FAILURE;
+    goto test_cleanup;
+  }
+  if(curl_share_ssls_import(share2, (const unsigned char *)"curl", 4) !=
+     CURLE_BAD_FUNCTION_ARGUMENT) {
+    curl_mfprintf(stderr, "unknown format imported\n");
+    res = TEST_ERR_FAILURE;
+    goto test_cleanup;
+  }
+  if((curl_share_ssls_import(noshare, buf, len) !=
+      CURLE_BAD_FUNCTION_ARGUMENT) ||
+     (curl_share_ssls_export(noshare, &buf2, &len2) !=
+      CURLE_BAD_FUNCTION_ARGUMENT)) {
+    curl_mfprintf(stderr, "share without SSL sessions accepted\n");
+    res = TEST_ERR_FAILURE;
+    goto test_cleanup;
+  }
+
+test_cleanup:
+  curl_free(buf);
+  curl_free(buf2);
+  curl_easy_cleanup(curl);
+  curl_share_cleanup(share1);
+  curl_share_cleanup(share2);
+  curl_share_cleanup(noshare);
+  curl_global_cleanup();
+  return res;
+}
@@ -0,0 +1,341 @@
+/***************************************************************************
+ *                                  _   _ ____  _
+ *  Project                     ___| | | |  _ \| |
+ *                             / __| | | | |_) | |
+ *                            | (__| |_| |  _ <| |___
+ *                             \___|\___/|_| \_\_____|
+ *
+ * Copyright (C) Daniel Stenberg, <daniel@haxx.se>, et al.
+ *
+ * This software is licensed as described in the file COPYING, which
+ * you should have received as part of this distribution. The terms
+ * are also available at https://curl.se/docs/copyright.html.
+ *
+ * You may opt to use, copy, modify, merge, publish, distribute and/or sell
+ * copies of the Software, and permit persons to whom the Software is
+ * furnished to do so, under the terms of the COPYING file.
+ *
+ * This software is distributed on an "AS IS" basis, WITHOUT WARRANTY OF ANY
+ * KIND, either express or implied.
+ *
+ * SPDX-License-Identifier: curl
+ *
+ ***************************************************************************/
+#include "first.h"
+
+#include "memdebug.h"
+
+/* Threads import SSL sessions for many peers into the session cache of a
+ * share. Once with the cache protected by the application's lock callbacks
+ * and once with the cache split into shards that use built-in locks. The
+ * imports per second of both runs are written to stderr. Sessions imported
+ * without their key into a split cache are found again by their key. */
+
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+
+#define T3047_THREADS   4
+#define T3047_PEERS     50 /* per thread */
+#define T3047_ROUNDS    200
+#define T3047_SHARDS    16L
+
+static pthread_mutex_t t3047_locks[CURL_LOCK_DATA_LAST];
+static int t3047_ssl_locked;
+
+static void t3047_lock(CURL *handle, curl_lock_data data,
+                       curl_lock_access access, void *useptr)
+{
+  (void)handle;
+  (void)access;
+  (void)useptr;
+  pthread_mutex_lock(&t3047_locks[data]);
+  if(data == CURL_LOCK_DATA_SSL_SESSION)
+    t3047_ssl_locked++;
+}
+
+static void t3047_unlock(CURL *handle, curl_lock_data data, void *useptr)
+{
+  (void)handle;
+  (void)useptr;
+  pthread_mutex_unlock(&t3047_locks[data]);
+}
+
+/* A TLSv1.3 session as packed by libcurl */
+static size_t t3047_session(unsigned char *buf, int num)
+{
+  curl_off_t valid_until = (curl_off_t)time(NULL) + 3600;
+  size_t len = 0;
+  int i;
+
+  buf[len++] = 0x01; /* version */
+  buf[len++] = 0x04; /* ticket */
+  buf[len++] = 0x00;
+  buf[len++] = 0x04;
+  buf[len++] = 't';
+  buf[len++] = 'k';
+  buf[len++] = (unsigned char)('0' + (num / 10) % 10);
+  buf[len++] = (unsigned char)('0' + num % 10);
+  buf[len++] = 0x02; /* IETF TLS version id */
+  buf[len++] = 0x03;
+  buf[len++] = 0x04;
+  buf[len++] = 0x03; /* valid until */
+  for(i = 7; i >= 0; i--)
+    buf[len++] = (unsigned char)(valid_until >> (8 * i));
+  return len;
+}
+
+struct t3047_thread {
+  CURLSH *share;
+  int num;
+  CURLcode result;
+};
+
+static void *t3047_run_thread(void *ptr)
+{
+  struct t3047_thread *t = ptr;
+  CURL *curl = curl_easy_init();
+  int i, j;
+
+  if(!curl) {
+    t->result = TEST_ERR_EASY_INIT;
+    return NULL;
+  }
+  curl_easy_setopt(curl, CURLOPT_SHARE, t->share);
+  for(i = 0; i < T3047_ROUNDS; i++) {
+    for(j = 0; j < T3047_PEERS; j++) {
+      unsigned char sdata[64];
+      size_t slen = t3047_session(sdata, i);
+      char key[64];
+      curl_msnprintf(key, sizeof(key), "t%d-peer%d.example:443:G",
+                     t->num, j);
+      t->result = curl_easy_ssls_import(curl, key, NULL, 0, sdata, slen);
+      if(t->result) {
+        curl_mfprintf(stderr, "import for %s returned %d\n", key,
+                      t->result);
+        goto out;
+      }
+    }
+  }
+out:
+  curl_easy_cleanup(curl);
+  return NULL;
+}
+
+/* The salt+hmac and session of the first sessions exported */
+struct t3047_export {
+  int sessions;
+  int keyless;
+  int saved;
+  char keys[3][64];
+  unsigned char shmac[3][64];
+  size_t shmac_len[3];
+  unsigned char sdata[3][64];
+  size_t sdata_len[3];
+};
+
+static CURLcode t3047_export_cb(CURL *handle,
+                                void *userptr,
+                                const char *session_key,
+                                const unsigned char *shmac,
+                                size_t shmac_len,
+                                const unsigned char *sdata,
+                                size_t sdata_len,
+                                curl_off_t valid_until,
+                                int ietf_tls_id,
+                                const char *alpn,
+                                size_t earlydata_max)
+{
+  struct t3047_export *x = userptr;
+  int i = x->saved;
+
+  (void)handle;
+  (void)valid_until;
+  (void)ietf_tls_id;
+  (void)alpn;
+  (void)earlydata_max;
+  x->sessions++;
+  if(!session_key)
+    x->keyless++;
+  else if((i < 3) && (shmac_len <= sizeof(x->shmac[i])) &&
+          (sdata_len <= sizeof(x->sdata[i])) &&
+          (strlen(session_key) < sizeof(x->keys[i])) &&
+          (!i || strcmp(session_key, x->keys[i - 1]))) {
+    strcpy(x->keys[i], session_key);
+    memcpy(x->shmac[i], shmac, shmac_len);
+    x->shmac_len[i] = shmac_len;
+    memcpy(x->sdata[i], sdata, sdata_len);
+    x->sdata_len[i] = sdata_len;
+    x->saved++;
+  }
+  return CURLE_OK;
+}
+
+static CURLSH *t3047_share(long shards)
+{
+  CURLSH *share = curl_share_init();
+  if(!share)
+    return NULL;
+  curl_share_setopt(share, CURLSHOPT_LOCKFUNC, t3047_lock);
+  curl_share_setopt(share, CURLSHOPT_UNLOCKFUNC, t3047_unlock);
+  if(curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION) ||
+     curl_share_setopt(share, CURLSHOPT_SSL_SESSION_SHARDS, shards)) {
+    curl_mfprintf(stderr, "CURLSHOPT_SSL_SESSION_SHARDS %ld failed\n",
+                  shards);
+    curl_share_cleanup(share);
+    return NULL;
+  }
+  return share;
+}
+
+/* Import sessions without their key into a split cache, then with their
+ * key. The first ones are found by the key and all are exported with it. */
+static CURLcode t3047_unkeyed(struct t3047_export *from)
+{
+  struct t3047_export x;
+  CURLSH *share = NULL;
+  CURL *curl = NULL;
+  CURLcode res = CURLE_OK;
+  int i;
+
+  share = t3047_share(T3047_SHARDS);
+  if(!share)
+    return TEST_ERR_MAJOR_BAD;
+  easy_init(curl);
+  easy_setopt(curl, CURLOPT_SHARE, share);
+  for(i = 0; i < from->saved; i++) {
+    res = curl_easy_ssls_import(curl, NULL, from->shmac[i],
+                                from->shmac_len[i], from->sdata[i],
+                                from->sdata_len[i]);
+    if(!res)
+      res = curl_easy_ssls_import(curl, from->keys[i], NULL, 0,
+                                  from->sdata[i], from->sdata_len[i]);
+    if(res) {
+      curl_mfprintf(stderr, "import for %s returned %d\n",
+                    from->keys[i], res);
+      goto test_cleanup;
+    }
+  }
+
+  memset(&x, 0, sizeof(x));
+  res = curl_easy_ssls_export(curl, t3047_export_cb, &x);
+  if(res)
+    goto test_cleanup;
+  if((x.sessions != 2 * from->saved) || x.keyless) {
+    curl_mfprintf(stderr, "%d sessions, %d without key, expected %d with "
+                  "key\n", x.sessions, x.keyless, 2 * from->saved);
+    res = TEST_ERR_FAILURE;
+  }
+
+test_cleanup:
+  curl_easy_cleanup(curl);
+  curl_share_cleanup(share);
+  return res;
+}
+
+static CURLcode t3047_run(long shards)
+{
+  struct t3047_thread threads[T3047_THREADS];
+  pthread_t tids[T3047_THREADS];
+  struct t3047_export x;
+  struct curltime start;
+  timediff_t elapsed_ms;
+  CURLSH *share = NULL;
+  CURL *curl = NULL;
+  int tid_count = 0, i;
+  CURLcode res = CURLE_OK;
+
+  share = t3047_share(shards);
+  if(!share)
+    return TEST_ERR_MAJOR_BAD;
+
+  t3047_ssl_locked = 0;
+  start = curlx_now();
+  for(i = 0; i < T3047_THREADS; i++) {
+    int rc;
+    threads[i].share = share;
+    threads[i].num = i;
+    threads[i].result = CURLE_OK;
+    rc = pthread_create(&tids[i], NULL, t3047_run_thread, &threads[i]);
+    if(rc) {
+      curl_mfprintf(stderr, "%s:%d Couldn't create thread, errno %d\n",
+                    __FILE__, __LINE__, rc);
+      res = TEST_ERR_MAJOR_BAD;
+      break;
+    }
+    tid_count++;
+  }
+  for(i = 0; i < tid_count; i++) {
+    pthread_join(tids[i], NULL);
+    if(threads[i].result)
+      res = threads[i].result;
+  }
+  elapsed_ms = curlx_timediff(curlx_now(), start);
+  if(res)
+    goto test_cleanup;
+
+  curl_mfprintf(stderr, "%ld shards, %d threads: %d imports in %"
+                FMT_TIMEDIFF_T "ms, %" FMT_TIMEDIFF_T " imports/sec\n",
+                shards, T3047_THREADS,
+                T3047_THREADS * T3047_PEERS * T3047_ROUNDS, elapsed_ms,
+                (timediff_t)T3047_THREADS * T3047_PEERS * T3047_ROUNDS *
+                1000 / (elapsed_ms ? elapsed_ms : 1));
+  /* with shards, the cache does not call the application's lock */
+  if((shards > 1) == !!t3047_ssl_locked) {
+    curl_mfprintf(stderr, "SSL_SESSION lock callback called %d times\n",
+                  t3047_ssl_locked);
+    res = TEST_ERR_FAILURE;
+    goto test_cleanup;
+  }
+
+  /* a split cache keeps sessions for more peers */
+  memset(&x, 0, sizeof(x));
+  easy_init(curl);
+  easy_setopt(curl, CURLOPT_SHARE, share);
+  res = curl_easy_ssls_export(curl, t3047_export_cb, &x);
+  if(res)
+    goto test_cleanup;
+  if(!x.sessions || x.keyless || (x.saved != 3) ||
+     ((shards > 1) != (x.sessions > 50))) {
+    curl_mfprintf(stderr, "%ld shards: %d sessions exported\n",
+                  shards, x.sessions);
+    res = TEST_ERR_FAILURE;
+    goto test_cleanup;
+  }
+  if(shards > 1)
+    res = t3047_unkeyed(&x);
+
+test_cleanup:
+  curl_easy_cleanup(curl);
+  curl_share_cleanup(share);
+  return res;
+}
+
+static CURLcode test_lib3047(const char *URL)
+{
+  CURLcode res;
+  int k;
+
+  (void)URL;
+  for(k = 0; k < CURL_LOCK_DATA_LAST; k++)
+    pthread_mutex_init(&t3047_locks[k], NULL);
+
+  res = curl_global_init(CURL_GLOBAL_ALL);
+  if(!res) {
+    res = t3047_run(0);
+    if(!res)
+      res = t3047_run(T3047_SHARDS);
+    curl_global_cleanup();
+  }
+
+  for(k = 0; k < CURL_LOCK_DATA_LAST; k++)
+    pthread_mutex_destroy(&t3047_locks[k]);
+  return res;
+}
+
+#else /* without pthread, this test does not work */
+static CURLcode test_lib3047(const char *URL)
+{
+  (void)URL;
+  return CURLE_OK;
+}
+#endif
@@ -0,0 +1,157 @@
+/***************************************************************************
+ *                                  _   _ ____  _
+ *  Project                     ___| | | |  _ \| |
+ *                             / __| | | | |_) | |
+ *                            | (__| |_| |  _ <| |___
+ *                             \___|\___/|_| \_\_____|
+ *
+ * Copyright (C) Daniel Stenberg, <daniel@haxx.se>, et al.
+ *
+ * This software is licensed as described in the file COPYING, which
+ * you should have received as part of this distribution. The terms
+ * are also available at https://curl.se/docs/copyright.html.
+ *
+ * You may opt to use, copy, modify, merge, publish, distribute and/or sell
+ * copies of the Software, and permit persons to whom the Software is
+ * furnished to do so, under the terms of the COPYING file.
+ *
+ * This software is distributed on an "AS IS" basis, WITHOUT WARRANTY OF ANY
+ * KIND, either express or implied.
+ *
+ * SPDX-License-Identifier: curl
+ *
+ ***************************************************************************/
+#include "first.h"
+
+#include "memdebug.h"
+
+/* Parallel HTTPS transfers have their server certificates verified by a
+ * pool of 2 threads. All but the last transfer trust the test CA and must
+ * succeed. The last one trusts another certificate and must fail the
+ * verification done by a worker. */
+
+#define T3048_HANDLES 6
+
+static int t3048_queued;
+
+static int t3048_debug_cb(CURL *handle, curl_infotype type,
+                          char *data, size_t size, void *userp)
+{
+  static const char queued[] = "certificate verification queued";
+  (void)handle;
+  (void)userp;
+  if((type == CURLINFO_TEXT) && (size < 256)) {
+    char line[256];
+    memcpy(line, data, size);
+    line[size] = 0;
+    if(strstr(line, queued))
+      t3048_queued++;
+  }
+  return 0;
+}
+
+static size_t t3048_write_cb(char *ptr, size_t size, size_t nmemb,
+                             void *userp)
+{
+  (void)ptr;
+  (void)userp;
+  return size * nmemb;
+}
+
+static CURLcode test_lib3048(const char *URL)
+{
+  CURLcode res = CURLE_OK;
+  CURL *curl[T3048_HANDLES] = {0};
+  CURLM *m = NULL;
+  CURLMsg *msg;
+  int running;
+  int msgs_left;
+  int done = 0;
+  size_t i;
+
+  if(!libtest_arg2 || !libtest_arg3) {
+    curl_mfprintf(stderr, "Usage: lib3048 [url] [cafile] [othercert]\n");
+    return TEST_ERR_USAGE;
+  }
+  start_test_timing();
+
+  global_init(CURL_GLOBAL_ALL);
+  curl_global_trace("ssl");
+
+  multi_init(m);
+
+  if(curl_multi_setopt(m, CURLMOPT_VERIFY_THREADS, -1L) !=
+     CURLM_BAD_FUNCTION_ARGUMENT) {
+    curl_mfprintf(stderr, "negative CURLMOPT_VERIFY_THREADS accepted\n");
+    res = TEST_ERR_FAILURE;
+    goto test_cleanup;
+  }
+  multi_setopt(m, CURLMOPT_VERIFY_THREADS, 2L);
+
+  for(i = 0; i < CURL_ARRAYSIZE(curl); i++) {
+    bool last = (i == CURL_ARRAYSIZE(curl) - 1);
+    easy_init(curl[i]);
+    easy_setopt(curl[i], CURLOPT_URL, URL);
+    easy_setopt(curl[i], CURLOPT_IPRESOLVE, CURL_IPRESOLVE_V4);
+    easy_setopt(curl[i], CURLOPT_CAINFO, last ? libtest_arg3 : libtest_arg2);
+    easy_setopt(curl[i], CURLOPT_CAPATH, NULL);
+    /* the other certificate must not be taken as the end of a chain */
+    easy_setopt(curl[i], CURLOPT_SSL_OPTIONS, CURLSSLOPT_NO_PARTIALCHAIN);
+    easy_setopt(curl[i], CURLOPT_FORBID_REUSE, 1L);
+    easy_setopt(curl[i], CURLOPT_WRITEFUNCTION, t3048_write_cb);
+    easy_setopt(curl[i], CURLOPT_DEBUGFUNCTION, t3048_debug_cb);
+    easy_setopt(curl[i], CURLOPT_VERBOSE, 1L);
+    multi_add_handle(m, curl[i]);
+  }
+
+  for(;;) {
+    int num;
+
+    multi_perform(m, &running);
+
+    abort_on_test_timeout();
+
+    while((msg = curl_multi_info_read(m, &msgs_left))) {
+      if(msg->msg == CURLMSG_DONE) {
+        CURLcode expected = CURLE_OK;
+        done++;
+        if(msg->easy_handle == curl[CURL_ARRAYSIZE(curl) - 1])
+          expected = CURLE_PEER_FAILED_VERIFICATION;
+        if(msg->data.result != expected) {
+          curl_mfprintf(stderr, "transfer returned %d, expected %d\n",
+                        (int)msg->data.result, (int)expected);
+          res = TEST_ERR_FAILURE;
+        }
+      }
+    }
+
+    if(!running)
+      break; /* done */
+
+    multi_poll(m, NULL, 0, TEST_HANG_TIMEOUT, &num);
+
+    abort_on_test_timeout();
+  }
+
+  if(!res && (done != T3048_HANDLES)) {
+    curl_mfprintf(stderr, "only %d of %d transfers finished\n",
+                  done, T3048_HANDLES);
+    res = TEST_ERR_FAILURE;
+  }
+  if(!res && (t3048_queued != T3048_HANDLES)) {
+    curl_mfprintf(stderr, "%d of %d verifications done by a worker\n",
+                  t3048_queued, T3048_HANDLES);
+    res = TEST_ERR_FAILURE;
+  }
+
+test_cleanup:
+
+  for(i = 0; i < CURL_ARRAYSIZE(curl); i++) {
+    curl_multi_remove_handle(m, curl[i]);
+    curl_easy_cleanup(curl[i]);
+  }
+  curl_multi_cleanup(m);
+  curl_global_cleanup();
+
+  return res;
+}
@@ -0,0 +1,177 @@
+/***************************************************************************
+ *                                  _   _ ____  _
+ *  Project                     ___| | | |  _ \| |
+ *                             / __| | | | |_) | |
+ *                            | (__| |_| |  _ <| |___
+ *                             \___|\___/|_| \_\_____|
+ *
+ * Copyright (C) Daniel Stenberg, <daniel@haxx.se>, et al.
+ *
+ * This software is licensed as described in the file COPYING, which
+ * you should have received as part of this distribution. The terms
+ * are also available at https://curl.se/docs/copyright.html.
+ *
+ * You may opt to use, copy, modify, merge, publish, distribute and/or sell
+ * copies of the Software, and permit persons to whom the Software is
+ * furnished to do so, under the terms of the COPYING file.
+ *
+ * This software is distributed on an "AS IS" basis, WITHOUT WARRANTY OF ANY
+ * KIND, either express or implied.
+ *
+ * SPDX-License-Identifier: curl
+ *
+ ***************************************************************************/
+#include "first.h"
+
+#include "memdebug.h"
+
+#define T3049_XFERS 20
+
+static int t3049_sends;
+
+static size_t t3049_write_cb(char *ptr, size_t size, size_t nmemb,
+                             void *userp)
+{
+  (void)ptr;
+  (void)userp;
+  return size * nmemb;
+}
+
+/* count the socket writes that sent data */
+static int t3049_debug_cb(CURL *handle, curl_infotype type,
+                          char *data, size_t size, void *userp)
+{
+  (void)handle;
+  (void)userp;
+  if(type == CURLINFO_TEXT) {
+    char line[256];
+    curl_msnprintf(line, sizeof(line), "%.*s", (int)size, data);
+    if(strstr(line, "] send(len=") && strstr(line, ") -> 0, "))
+      t3049_sends++;
+  }
+  return 0;
+}
+
+static CURLcode t3049_run(CURLM *m, int *pdone)
+{
+  CURLcode res = CURLE_OK;
+  CURLMsg *msg;
+  int running;
+  int msgs_left;
+
+  for(;;) {
+    int num;
+
+    multi_perform(m, &running);
+
+    abort_on_test_timeout();
+
+    while((msg = curl_multi_info_read(m, &msgs_left))) {
+      if(msg->msg == CURLMSG_DONE) {
+        (*pdone)++;
+        if(msg->data.result) {
+          curl_mfprintf(stderr, "transfer failed with %d\n",
+                        (int)msg->data.result);
+          res = msg->data.result;
+        }
+      }
+    }
+
+    if(!running)
+      break; /* done */
+
+    multi_poll(m, NULL, 0, TEST_HANG_TIMEOUT, &num);
+
+    abort_on_test_timeout();
+  }
+
+test_cleanup:
+  return res;
+}
+
+/* Many transfers started at once on an HTTP/2 connection have their
+ * requests written to the socket together at the end of a run, and do not
+ * stall when that write blocks. */
+static CURLcode test_lib3049(const char *URL)
+{
+  CURLcode res = CURLE_OK;
+  CURL *curl[T3049_XFERS + 1] = {0};
+  CURLM *m = NULL;
+  char target_url[256];
+  char dnsentry[256];
+  struct curl_slist *slist = NULL;
+  const char *port = libtest_arg3;
+  const char *address = libtest_arg2;
+  int done = 0;
+  size_t i;
+
+  (void)URL;
+
+  curl_msnprintf(dnsentry, sizeof(dnsentry), "localhost:%s:%s",
+                 port, address);
+  slist = curl_slist_append(slist, dnsentry);
+  if(!slist) {
+    curl_mfprintf(stderr, "curl_slist_append() failed\n");
+    goto test_cleanup;
+  }
+  curl_msnprintf(target_url, sizeof(target_url),
+                 "https://localhost:%s/3049", port);
+
+  start_test_timing();
+
+  global_init(CURL_GLOBAL_ALL);
+  curl_global_trace("tcp");
+
+  multi_init(m);
+
+  for(i = 0; i < CURL_ARRAYSIZE(curl); i++) {
+    easy_init(curl[i]);
+    easy_setopt(curl[i], CURLOPT_URL, target_url);
+    easy_setopt(curl[i], CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2_0);
+    easy_setopt(curl[i], CURLOPT_SSL_VERIFYPEER, 0L);
+    easy_setopt(curl[i], CURLOPT_SSL_VERIFYHOST, 0L);
+    easy_setopt(curl[i], CURLOPT_PIPEWAIT, 1L);
+    easy_setopt(curl[i], CURLOPT_RESOLVE, slist);
+    easy_setopt(curl[i], CURLOPT_WRITEFUNCTION, t3049_write_cb);
+    easy_setopt(curl[i], CURLOPT_VERBOSE, 1L);
+    easy_setopt(curl[i], CURLOPT_DEBUGFUNCTION, t3049_debug_cb);
+  }
+
+  /* the first transfer sets up the connection */
+  multi_add_handle(m, curl[0]);
+  res = t3049_run(m, &done);
+  if(res)
+    goto test_cleanup;
+
+  /* all the others start at once and share it */
+  t3049_sends = 0;
+  for(i = 1; i < CURL_ARRAYSIZE(curl); i++)
+    multi_add_handle(m, curl[i]);
+  res = t3049_run(m, &done);
+  if(res)
+    goto test_cleanup;
+
+  curl_mfprintf(stderr, "%d transfers made %d socket writes\n",
+                T3049_XFERS, t3049_sends);
+  if(done != T3049_XFERS + 1) {
+    curl_mfprintf(stderr, "only %d of %d transfers finished\n",
+                  done, T3049_XFERS + 1);
+    res = TEST_ERR_FAILURE;
+  }
+  else if(t3049_sends >= T3049_XFERS)
+    res = TEST_ERR_FAILURE;
+
+test_cleanup:
+
+  for(i = 0; i < CURL_ARRAYSIZE(curl); i++) {
+    curl_multi_remove_handle(m, curl[i]);
+    curl_easy_cleanup(curl[i]);
+  }
+
+  curl_slist_free_all(slist);
+
+  curl_multi_cleanup(m);
+  curl_global_cleanup();
+
+  return res;
+}
@@ -0,0 +1,163 @@
+/***************************************************************************
+ *                                  _   _ ____  _
+ *  Project                     ___| | | |  _ \| |
+ *                             / __| | | | |_) | |
+ *                            | (__| |_| |  _ <| |___
+ *                             \___|\___/|_| \_\_____|
+ *
+ * Copyright (C) Daniel Stenberg, <daniel@haxx.se>, et al.
+ *
+ * This software is licensed as described in the file COPYING, which
+ * you should have received as part of this distribution. The terms
+ * are also available at https://curl.se/docs/copyright.html.
+ *
+ * You may opt to use, copy, modify, merge, publish, distribute and/or sell
+ * copies of the Software, and permit persons to whom the Software is
+ * furnished to do so, under the terms of the COPYING file.
+ *
+ * This software is distributed on an "AS IS" basis, WITHOUT WARRANTY OF ANY
+ * KIND, either express or implied.
+ *
+ * SPDX-License-Identifier: curl
+ *
+ ***************************************************************************/
+#include "first.h"
+
+#include "memdebug.h"
+
+#define T3050_SMALL_WIN 100000L
+
+static char t3050_win[64];
+
+static size_t t3050_write_cb(char *ptr, size_t size, size_t nmemb,
+                             void *userp)
+{
+  (void)ptr;
+  (void)userp;
+  return size * nmemb;
+}
+
+/* remember the last stream window size set */
+static int t3050_debug_cb(CURL *handle, curl_infotype type,
+                          char *data, size_t size, void *userp)
+{
+  (void)handle;
+  (void)userp;
+  if(type == CURLINFO_TEXT) {
+    char line[256];
+    const char *p;
+    curl_msnprintf(line, sizeof(line), "%.*s", (int)size, data);
+    p = strstr(line, "local window size now ");
+    if(p)
+      p += strlen("local window size now ");
+    else {
+      p = strstr(line, "local window update by ");
+      if(p)
+        p = strstr(p, " to ");
+      if(p)
+        p += strlen(" to ");
+    }
+    if(p)
+      curl_msnprintf(t3050_win, sizeof(t3050_win), "%s", p);
+  }
+  return 0;
+}
+
+static CURLcode t3050_get(CURL *curl, long win_max, const char *expect)
+{
+  CURLcode res;
+  size_t len;
+
+  t3050_win[0] = 0;
+  res = curl_easy_setopt(curl, CURLOPT_HTTP2_WINDOW_MAX, win_max);
+  if(res) {
+    curl_mfprintf(stderr, "CURLOPT_HTTP2_WINDOW_MAX %ld returned %d\n",
+                  win_max, (int)res);
+    return res;
+  }
+  res = curl_easy_perform(curl);
+  if(res)
+    return res;
+  len = strlen(t3050_win);
+  while(len && ((t3050_win[len - 1] == '\n') || (t3050_win[len - 1] == '\r')))
+    t3050_win[--len] = 0;
+  if(strcmp(t3050_win, expect)) {
+    curl_mfprintf(stderr, "window max %ld: window set to '%s', "
+                  "expected '%s'\n", win_max, t3050_win, expect);
+    return TEST_ERR_FAILURE;
+  }
+  return CURLE_OK;
+}
+
+/* CURLOPT_HTTP2_WINDOW_MAX accepts the sizes an HTTP/2 window may have.
+ * A small one becomes the stream window, larger ones and the default let
+ * streams start with 10MB. */
+static CURLcode test_lib3050(const char *URL)
+{
+  CURLcode res = CURLE_OK;
+  CURL *curl = NULL;
+  char target_url[256];
+  char dnsentry[256];
+  struct curl_slist *slist = NULL;
+  const char *port = libtest_arg3;
+  const char *address = libtest_arg2;
+
+  (void)URL;
+
+  curl_msnprintf(dnsentry, sizeof(dnsentry), "localhost:%s:%s",
+                 port, address);
+  slist = curl_slist_append(slist, dnsentry);
+  if(!slist) {
+    curl_mfprintf(stderr, "curl_slist_append() failed\n");
+    goto test_cleanup;
+  }
+  curl_msnprintf(target_url, sizeof(target_url),
+                 "https://localhost:%s/3050", port);
+
+  global_init(CURL_GLOBAL_ALL);
+  curl_global_trace("http/2");
+
+  easy_init(curl);
+
+  if(curl_easy_setopt(curl, CURLOPT_HTTP2_WINDOW_MAX, -1L) !=
+     CURLE_BAD_FUNCTION_ARGUMENT) {
+    curl_mfprintf(stderr, "negative window accepted\n");
+    res = TEST_ERR_FAILURE;
+    goto test_cleanup;
+  }
+#if LONG_MAX > 0x7fffffffL
+  if(curl_easy_setopt(curl, CURLOPT_HTTP2_WINDOW_MAX, 0x80000000L) !=
+     CURLE_BAD_FUNCTION_ARGUMENT) {
+    curl_mfprintf(stderr, "window larger than HTTP/2 allows accepted\n");
+    res = TEST_ERR_FAILURE;
+    goto test_cleanup;
+  }
+#endif
+
+  easy_setopt(curl, CURLOPT_URL, target_url);
+  easy_setopt(curl, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2_0);
+  easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 0L);
+  easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, 0L);
+  easy_setopt(curl, CURLOPT_RESOLVE, slist);
+  easy_setopt(curl, CURLOPT_WRITEFUNCTION, t3050_write_cb);
+  easy_setopt(curl, CURLOPT_VERBOSE, 1L);
+  easy_setopt(curl, CURLOPT_DEBUGFUNCTION, t3050_debug_cb);
+
+  /* a window max below 10MB is the window */
+  res = t3050_get(curl, T3050_SMALL_WIN, "100000");
+  if(res)
+    goto test_cleanup;
+  /* with the largest possible and the default window max, streams start
+     with a window of 10MB */
+  res = t3050_get(curl, 0x7fffffffL, "10485760");
+  if(res)
+    goto test_cleanup;
+  res = t3050_get(curl, 0L, "10485760");
+
+test_cleanup:
+  curl_easy_cleanup(curl);
+  curl_slist_free_all(slist);
+  curl_global_cleanup();
+
+  return res;
+}
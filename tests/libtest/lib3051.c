@@ -0,0 +1,151 @@
+/***************************************************************************
+ *                                  _   _ ____  _
+ *  Project                     ___| | | |  _ \| |
+ *                             / __| | | | |_) | |
+ *                            | (__| |_| |  _ <| |___
+ *                             \___|\___/|_| \_\_____|
+ *
+ * Copyright (C) Daniel Stenberg, <daniel@haxx.se>, et al.
+ *
+ * This software is licensed as described in the file COPYING, which
+ * you should have received as part of this distribution. The terms
+ * are also available at https://curl.se/docs/copyright.html.
+ *
+ * You may opt to use, copy, modify, merge, publish, distribute and/or sell
+ * copies of the Software, and permit persons to whom the Software is
+ * furnished to do so, under the terms of the COPYING file.
+ *
+ * This software is distributed on an "AS IS" basis, WITHOUT WARRANTY OF ANY
+ * KIND, either express or implied.
+ *
+ * SPDX-License-Identifier: curl
+ *
+ ***************************************************************************/
+#include "first.h"
+
+#include "memdebug.h"
+
+static size_t t3051_write_cb(char *ptr, size_t size, size_t nmemb,
+                             void *userp)
+{
+  curl_off_t *received = userp;
+  (void)ptr;
+  *received += (curl_off_t)(size * nmemb);
+  return size * nmemb;
+}
+
+static int t3051_batched;
+
+/* count the receives answered from a batch */
+static int t3051_debug_cb(CURL *handle, curl_infotype type,
+                          char *data, size_t size, void *userp)
+{
+  (void)handle;
+  (void)userp;
+  if(type == CURLINFO_TEXT) {
+    char line[256];
+    curl_msnprintf(line, sizeof(line), "%.*s", (int)size, data);
+    if(strstr(line, "] recv(len=") && strstr(line, " (batched)"))
+      t3051_batched++;
+  }
+  return 0;
+}
+
+/* parallel transfers with their receives batched by CURLMOPT_IO_URING.
+ * A small buffer size has each transfer take the batched data in several
+ * pieces. The socket filter trace shows that the data came from batched
+ * receives. */
+static CURLcode test_lib3051(const char *URL)
+{
+  CURLcode res = CURLE_OK;
+  CURL *curl[NUM_HANDLES] = {0};
+  curl_off_t received[NUM_HANDLES] = {0};
+  CURLM *m = NULL;
+  CURLMsg *msg;
+  int running;
+  int msgs_left;
+  int done = 0;
+  size_t i;
+
+  start_test_timing();
+
+  global_init(CURL_GLOBAL_ALL);
+  curl_global_trace("tcp");
+
+  multi_init(m);
+
+  multi_setopt(m, CURLMOPT_IO_URING, 1L);
+
+  for(i = 0; i < CURL_ARRAYSIZE(curl); i++) {
+    easy_init(curl[i]);
+    easy_setopt(curl[i], CURLOPT_URL, URL);
+    easy_setopt(curl[i], CURLOPT_BUFFERSIZE, 1024L);
+    easy_setopt(curl[i], CURLOPT_WRITEFUNCTION, t3051_write_cb);
+    easy_setopt(curl[i], CURLOPT_WRITEDATA, &received[i]);
+    easy_setopt(curl[i], CURLOPT_VERBOSE, 1L);
+    easy_setopt(curl[i], CURLOPT_DEBUGFUNCTION, t3051_debug_cb);
+    /* do not reuse connections, have them all run in parallel */
+    easy_setopt(curl[i], CURLOPT_FORBID_REUSE, 1L);
+    multi_add_handle(m, curl[i]);
+  }
+
+  for(;;) {
+    int num;
+
+    multi_perform(m, &running);
+
+    abort_on_test_timeout();
+
+    while((msg = curl_multi_info_read(m, &msgs_left))) {
+      if(msg->msg == CURLMSG_DONE) {
+        done++;
+        if(msg->data.result) {
+          curl_mfprintf(stderr, "transfer failed with %d\n",
+                        (int)msg->data.result);
+          res = msg->data.result;
+        }
+      }
+    }
+
+    if(!running)
+      break; /* done */
+
+    multi_poll(m, NULL, 0, TEST_HANG_TIMEOUT, &num);
+
+    abort_on_test_timeout();
+  }
+
+  if(!res && (done != NUM_HANDLES)) {
+    curl_mfprintf(stderr, "only %d of %d transfers finished\n",
+                  done, NUM_HANDLES);
+    res = TEST_ERR_FAILURE;
+  }
+
+  for(i = 0; !res && (i < CURL_ARRAYSIZE(curl)); i++) {
+    curl_off_t clen = -1;
+
+    curl_easy_getinfo(curl[i], CURLINFO_CONTENT_LENGTH_DOWNLOAD_T, &clen);
+    if(received[i] != clen) {
+      curl_mfprintf(stderr, "transfer %zu got %" CURL_FORMAT_CURL_OFF_T
+                    " of %" CURL_FORMAT_CURL_OFF_T " bytes\n",
+                    i, received[i], clen);
+      res = TEST_ERR_FAILURE;
+    }
+  }
+
+  if(!res && !t3051_batched) {
+    curl_mfprintf(stderr, "no receive was batched\n");
+    res = TEST_ERR_FAILURE;
+  }
+
+test_cleanup:
+
+  for(i = 0; i < CURL_ARRAYSIZE(curl); i++) {
+    curl_multi_remove_handle(m, curl[i]);
+    curl_easy_cleanup(curl[i]);
+  }
+  curl_multi_cleanup(m);
+  curl_global_cleanup();
+
+  return res;
+}
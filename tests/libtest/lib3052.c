@@ -0,0 +1,113 @@
+/***************************************************************************
+ *                                  _   _ ____  _
+ *  Project                     ___| | | |  _ \| |
+ *                             / __| | | | |_) | |
+ *                            | (__| |_| |  _ <| |___
+ *                             \___|\___/|_| \_\_____|
+ *
+ * Copyright (C) Daniel Stenberg, <daniel@haxx.se>, et al.
+ *
+ * This software is licensed as described in the file COPYING, which
+ * you should have received as part of this distribution. The terms
+ * are also available at https://curl.se/docs/copyright.html.
+ *
+ * You may opt to use, copy, modify, merge, publish, distribute and/or sell
+ * copies of the Software, and permit persons to whom the Software is
+ * furnished to do so, under the terms of the COPYING file.
+ *
+ * This software is distributed on an "AS IS" basis, WITHOUT WARRANTY OF ANY
+ * KIND, either express or implied.
+ *
+ * SPDX-License-Identifier: curl
+ *
+ ***************************************************************************/
+#include "first.h"
+
+#include "memdebug.h"
+
+/* parallel transfers with CURLMOPT_EPOLL, waiting with select() on the
+ * sockets from curl_multi_fdset() instead of using curl_multi_poll().
+ * curl_multi_perform() needs to find the ready sockets by itself. */
+static CURLcode test_lib3052(const char *URL)
+{
+  CURLcode res = CURLE_OK;
+  CURL *curl[NUM_HANDLES] = {0};
+  CURLM *m = NULL;
+  CURLMsg *msg;
+  int running;
+  int msgs_left;
+  int done = 0;
+  size_t i;
+
+  start_test_timing();
+
+  global_init(CURL_GLOBAL_ALL);
+
+  multi_init(m);
+
+  multi_setopt(m, CURLMOPT_EPOLL, 1L);
+
+  for(i = 0; i < CURL_ARRAYSIZE(curl); i++) {
+    easy_init(curl[i]);
+    easy_setopt(curl[i], CURLOPT_URL, URL);
+    /* do not reuse connections, have them all run in parallel */
+    easy_setopt(curl[i], CURLOPT_FORBID_REUSE, 1L);
+    multi_add_handle(m, curl[i]);
+  }
+
+  for(;;) {
+    struct timeval timeout;
+    fd_set fdread, fdwrite, fdexcep;
+    int maxfd = -99;
+
+    timeout.tv_sec = 0;
+    timeout.tv_usec = 100000L; /* 100 ms */
+
+    multi_perform(m, &running);
+
+    abort_on_test_timeout();
+
+    while((msg = curl_multi_info_read(m, &msgs_left))) {
+      if(msg->msg == CURLMSG_DONE) {
+        done++;
+        if(msg->data.result) {
+          curl_mfprintf(stderr, "transfer failed with %d\n",
+                        (int)msg->data.result);
+          res = msg->data.result;
+        }
+      }
+    }
+
+    if(!running)
+      break; /* done */
+
+    FD_ZERO(&fdread);
+    FD_ZERO(&fdwrite);
+    FD_ZERO(&fdexcep);
+
+    multi_fdset(m, &fdread, &fdwrite, &fdexcep, &maxfd);
+
+    /* At this point, maxfd is guaranteed to be greater or equal than -1. */
+
+    select_test(maxfd + 1, &fdread, &fdwrite, &fdexcep, &timeout);
+
+    abort_on_test_timeout();
+  }
+
+  if(!res && (done != NUM_HANDLES)) {
+    curl_mfprintf(stderr, "only %d of %d transfers finished\n",
+                  done, NUM_HANDLES);
+    res = TEST_ERR_FAILURE;
+  }
+
+test_cleanup:
+
+  for(i = 0; i < CURL_ARRAYSIZE(curl); i++) {
+    curl_multi_remove_handle(m, curl[i]);
+    curl_easy_cleanup(curl[i]);
+  }
+  curl_multi_cleanup(m);
+  curl_global_cleanup();
+
+  return res;
+}
@@ -0,0 +1,149 @@
+/***************************************************************************
+ *                                  _   _ ____  _
+ *  Project                     ___| | | |  _ \| |
+ *                             / __| | | | |_) | |
+ *                            | (__| |_| |  _ <| |___
+ *                             \___|\___/|_| \_\_____|
+ *
+ * Copyright (C) Daniel Stenberg, <daniel@haxx.se>, et al.
+ *
+ * This software is licensed as described in the file COPYING, which
+ * you should have received as part of this distribution. The terms
+ * are also available at https://curl.se/docs/copyright.html.
+ *
+ * You may opt to use, copy, modify, merge, publish, distribute and/or sell
+ * copies of the Software, and permit persons to whom the Software is
+ * furnished to do so, under the terms of the COPYING file.
+ *
+ * This software is distributed on an "AS IS" basis, WITHOUT WARRANTY OF ANY
+ * KIND, either express or implied.
+ *
+ * SPDX-License-Identifier: curl
+ *
+ ***************************************************************************/
+#include "first.h"
+
+#include "memdebug.h"
+
+/* Sequential HTTPS transfers on a multi handle, each on a new connection,
+ * that may reuse an SSL_CTX set up before. A transfer that does not verify
+ * the server must not have its SSL_CTX reused by one that does, and the
+ * other way around. Transfers with the same settings reuse it. */
+
+static int t3053_reused;
+
+static int t3053_debug_cb(CURL *handle, curl_infotype type,
+                          char *data, size_t size, void *userp)
+{
+  static const char reused[] = "reusing SSL_CTX set up before";
+  (void)handle;
+  (void)userp;
+  if((type == CURLINFO_TEXT) && (size < 256)) {
+    char line[256];
+    memcpy(line, data, size);
+    line[size] = 0;
+    if(strstr(line, reused))
+      t3053_reused++;
+  }
+  return 0;
+}
+
+static size_t t3053_write_cb(char *ptr, size_t size, size_t nmemb,
+                             void *userp)
+{
+  (void)ptr;
+  (void)userp;
+  return size * nmemb;
+}
+
+/* run one transfer on `m` and check if it reused an SSL_CTX */
+static CURLcode t3053_run(CURLM *m, const char *URL, bool verify,
+                          bool reuse)
+{
+  CURLcode res = CURLE_OK;
+  CURL *curl = NULL;
+  CURLMsg *msg;
+  int running;
+  int msgs_left;
+
+  t3053_reused = 0;
+  easy_init(curl);
+  easy_setopt(curl, CURLOPT_URL, URL);
+  easy_setopt(curl, CURLOPT_IPRESOLVE, CURL_IPRESOLVE_V4);
+  easy_setopt(curl, CURLOPT_CAINFO, libtest_arg2);
+  easy_setopt(curl, CURLOPT_CAPATH, NULL);
+  easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, verify ? 1L : 0L);
+  easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, verify ? 2L : 0L);
+  easy_setopt(curl, CURLOPT_FORBID_REUSE, 1L);
+  easy_setopt(curl, CURLOPT_WRITEFUNCTION, t3053_write_cb);
+  easy_setopt(curl, CURLOPT_DEBUGFUNCTION, t3053_debug_cb);
+  easy_setopt(curl, CURLOPT_VERBOSE, 1L);
+  multi_add_handle(m, curl);
+
+  for(;;) {
+    int num;
+
+    multi_perform(m, &running);
+
+    abort_on_test_timeout();
+
+    while((msg = curl_multi_info_read(m, &msgs_left))) {
+      if((msg->msg == CURLMSG_DONE) && msg->data.result) {
+        curl_mfprintf(stderr, "transfer returned %d\n",
+                      (int)msg->data.result);
+        res = msg->data.result;
+      }
+    }
+
+    if(!running)
+      break; /* done */
+
+    multi_poll(m, NULL, 0, TEST_HANG_TIMEOUT, &num);
+
+    abort_on_test_timeout();
+  }
+
+  if(!res && ((t3053_reused > 0) != reuse)) {
+    curl_mfprintf(stderr, "%s transfer %s an SSL_CTX\n",
+                  verify ? "verifying" : "insecure",
+                  t3053_reused ? "reused" : "did not reuse");
+    res = TEST_ERR_FAILURE;
+  }
+
+test_cleanup:
+  curl_multi_remove_handle(m, curl);
+  curl_easy_cleanup(curl);
+  return res;
+}
+
+static CURLcode test_lib3053(const char *URL)
+{
+  CURLcode res = CURLE_OK;
+  CURLM *m = NULL;
+
+  if(!libtest_arg2) {
+    curl_mfprintf(stderr, "Usage: lib3053 [url] [cafile]\n");
+    return TEST_ERR_USAGE;
+  }
+  start_test_timing();
+
+  global_init(CURL_GLOBAL_ALL);
+  curl_global_trace("ssl");
+
+  multi_init(m);
+
+  res = t3053_run(m, URL, FALSE, FALSE);
+  if(!res) /* not the insecure one */
+    res = t3053_run(m, URL, TRUE, FALSE);
+  if(!res)
+    res = t3053_run(m, URL, TRUE, TRUE);
+  if(!res) /* not the verifying one */
+    res = t3053_run(m, URL, FALSE, TRUE);
+
+test_cleanup:
+
+  curl_multi_cleanup(m);
+  curl_global_cleanup();
+
+  return res;
+}
@@ -340,6 +340,7 @@ static CURLcode test_lib1521(const char *URL)
   struct curl_slist *slist = NULL;
   struct curl_httppost *httppost = NULL;
   curl_mime *mimepost = NULL;
+  struct curl_iovec iov[1] = {{NULL, 0}};
   FILE *stream = stderr;
   struct t1521_testdata object;
   CURLU *curlu = (CURLU *)&object;
@@ -507,6 +508,9 @@ MOO
             elsif($name eq "CURLOPT_MIMEPOST") {
               print $fh "${fpref} mimepost);\n$fcheck";
             }
+            elsif($name eq "CURLOPT_UPLOAD_IOV") {
+              print $fh "${fpref} iov);\n$fcheck";
+            }
             elsif($name eq "CURLOPT_STDERR") {
               print $fh "${fpref} stream);\n$fcheck";
             }
@@ -725,6 +725,8 @@ sub checksystemfeatures {
             # Thread-safe init
             $feature{"threadsafe"} = $feat =~ /threadsafe/i;
             $feature{"HTTPSRR"} = $feat =~ /HTTPSRR/;
+            # SSL session export and import
+            $feature{"SSLS-EXPORT"} = $feat =~ /SSLS-EXPORT/;
             $feature{"ECH"} = $feat =~ /ECH/;
         }
         #
@@ -111,7 +111,7 @@ static CURLcode test_unit1305(const char *arg)
     key_len = strlen(data_key);
 
     data_node->refcount = 1; /* hash will hold the reference */
-    nodep = Curl_hash_add(&hp.entries, data_key, key_len + 1, data_node);
+    nodep = Curl_hash_add(hp.shards, data_key, key_len + 1, data_node);
     abort_unless(nodep, "insertion into hash failed");
     /* Freeing will now be done by Curl_hash_destroy */
     data_node = NULL;
@@ -179,6 +179,7 @@ static CURLcode cf_test_create(struct Curl_cfilter **pcf,
     cf_test_adjust_pollset,
     Curl_cf_def_data_pending,
     Curl_cf_def_send,
+    Curl_cf_def_sendv,
     Curl_cf_def_recv,
     Curl_cf_def_cntrl,
     Curl_cf_def_conn_is_alive,
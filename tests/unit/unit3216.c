@@ -0,0 +1,260 @@
+/***************************************************************************
+ *                                  _   _ ____  _
+ *  Project                     ___| | | |  _ \| |
+ *                             / __| | | | |_) | |
+ *                            | (__| |_| |  _ <| |___
+ *                             \___|\___/|_| \_\_____|
+ *
+ * Copyright (C) Daniel Stenberg, <daniel@haxx.se>, et al.
+ *
+ * This software is licensed as described in the file COPYING, which
+ * you should have received as part of this distribution. The terms
+ * are also available at https://curl.se/docs/copyright.html.
+ *
+ * You may opt to use, copy, modify, merge, publish, distribute and/or sell
+ * copies of the Software, and permit persons to whom the Software is
+ * furnished to do so, under the terms of the COPYING file.
+ *
+ * This software is distributed on an "AS IS" basis, WITHOUT WARRANTY OF ANY
+ * KIND, either express or implied.
+ *
+ * SPDX-License-Identifier: curl
+ *
+ ***************************************************************************/
+#include "unitcheck.h"
+
+#include "splay.h"
+#include "timewheel.h"
+
+/* Run the timer wheel and the splay tree side by side through the same
+ * churn of adds, updates and expiries. Both must expire the very same
+ * nodes at every step. The time spent in each is reported. */
+
+#define TW_NODES  2000
+#define TW_ROUNDS 2000
+#define TW_CHURN  50
+
+struct tw_test_node {
+  struct Curl_tree snode;
+  struct Curl_twnode wnode;
+  struct curltime key;
+  int fired;
+};
+
+static unsigned int tw_rand_state = 42;
+
+static unsigned int tw_rand(void)
+{
+  tw_rand_state = tw_rand_state * 1103515245 + 12345;
+  return (tw_rand_state >> 8) & 0xffffff;
+}
+
+static struct curltime tw_add_ms(struct curltime t, timediff_t ms, int usec)
+{
+  t.tv_sec += (time_t)(ms / 1000);
+  t.tv_usec += (int)(ms % 1000) * 1000 + usec;
+  while(t.tv_usec >= 1000000) {
+    t.tv_sec++;
+    t.tv_usec -= 1000000;
+  }
+  return t;
+}
+
+/* a mix of short, medium and long timeouts like transfers set them */
+static struct curltime tw_rand_key(struct curltime now)
+{
+  unsigned int r = tw_rand();
+  timediff_t ms;
+
+  switch(r % 8) {
+  case 0:
+    ms = 0;
+    break;
+  case 1: case 2: case 3:
+    ms = r % 200;
+    break;
+  case 4: case 5:
+    ms = r % 5000;
+    break;
+  case 6:
+    ms = r % 300000;
+    break;
+  default:
+    ms = (timediff_t)(r % 40) * 24 * 3600 * 1000;
+    break;
+  }
+  return tw_add_ms(now, ms, (int)(tw_rand() % 1000));
+}
+
+static void tw_check_basic(void)
+{
+  struct Curl_twheel w;
+  struct tw_test_node nodes[6];
+  struct curltime origin = {1000, 500};
+  struct curltime when, now;
+  struct Curl_twnode *n;
+  int i;
+
+  memset(nodes, 0, sizeof(nodes));
+  fail_unless(!Curl_twheel_init(&w, &origin), "init failed");
+  fail_unless(!Curl_twheel_next(&w, &when), "empty wheel has a next");
+  fail_unless(!Curl_twheel_getbest(&w, origin), "empty wheel has a best");
+
+  Curl_twheel_add(&w, tw_add_ms(origin, 5, 700), &nodes[0].wnode);
+  Curl_twheel_add(&w, tw_add_ms(origin, 5, 100), &nodes[1].wnode);
+  Curl_twheel_add(&w, tw_add_ms(origin, 64 * 64 + 3, 0), &nodes[2].wnode);
+  /* further out than the wheel covers */
+  Curl_twheel_add(&w, tw_add_ms(origin, (timediff_t)20 * 24 * 3600 * 1000, 0),
+                  &nodes[3].wnode);
+  /* before the origin */
+  when = origin;
+  when.tv_sec--;
+  Curl_twheel_add(&w, when, &nodes[4].wnode);
+  Curl_twheel_add(&w, tw_add_ms(origin, 100, 0), &nodes[5].wnode);
+  for(i = 0; i < 6; ++i)
+    Curl_twheel_set(&nodes[i].wnode, &nodes[i]);
+  fail_unless(Curl_twheel_count(&w) == 6, "wrong count");
+  Curl_twheel_remove(&w, &nodes[5].wnode);
+  fail_unless(!Curl_twheel_contains(&nodes[5].wnode), "removed node found");
+  fail_unless(Curl_twheel_count(&w) == 5, "wrong count after remove");
+
+  n = Curl_twheel_getbest(&w, origin);
+  fail_unless(n == &nodes[4].wnode, "node before origin not expired");
+  fail_unless(Curl_twheel_get(n) == &nodes[4], "wrong payload");
+
+  n = Curl_twheel_next(&w, &when);
+  fail_unless(n == &nodes[1].wnode, "wrong next node");
+  fail_unless(!curlx_timediff_us(when, nodes[1].wnode.key), "wrong next time");
+
+  /* within the tick, only the one already due */
+  now = tw_add_ms(origin, 5, 500);
+  fail_unless(Curl_twheel_getbest(&w, now) == &nodes[1].wnode, "not due");
+  fail_unless(!Curl_twheel_getbest(&w, now), "expired too early");
+  now = tw_add_ms(origin, 6, 0);
+  fail_unless(Curl_twheel_getbest(&w, now) == &nodes[0].wnode, "not due");
+
+  /* the next time is never later than the node's */
+  n = Curl_twheel_next(&w, &when);
+  fail_unless(n == &nodes[2].wnode, "wrong next node");
+  fail_unless(curlx_timediff_us(when, nodes[2].wnode.key) <= 0,
+              "next time too late");
+  now = tw_add_ms(origin, 64 * 64 + 2, 999);
+  fail_unless(!Curl_twheel_getbest(&w, now), "expired too early");
+  now = tw_add_ms(origin, 64 * 64 + 3, 0);
+  fail_unless(Curl_twheel_getbest(&w, now) == &nodes[2].wnode, "not due");
+
+  now = tw_add_ms(origin, (timediff_t)20 * 24 * 3600 * 1000 - 1, 0);
+  fail_unless(!Curl_twheel_getbest(&w, now), "far node expired early");
+  now = tw_add_ms(origin, (timediff_t)20 * 24 * 3600 * 1000, 0);
+  fail_unless(Curl_twheel_getbest(&w, now) == &nodes[3].wnode, "far node");
+  fail_unless(Curl_twheel_count(&w) == 0, "wheel not empty");
+  Curl_twheel_destroy(&w);
+}
+
+static void tw_check_churn(void)
+{
+  static struct tw_test_node nodes[TW_NODES];
+  struct Curl_twheel w;
+  struct Curl_tree *root = NULL;
+  struct Curl_tree *removed;
+  struct Curl_twnode *n;
+  struct curltime now = {1000, 0};
+  struct curltime t0, when;
+  timediff_t us_splay = 0, us_wheel = 0;
+  size_t fired_splay = 0, fired_wheel = 0;
+  int i, round;
+
+  fail_unless(!Curl_twheel_init(&w, &now), "init failed");
+  for(i = 0; i < TW_NODES; ++i) {
+    nodes[i].key = tw_rand_key(now);
+    nodes[i].fired = -1;
+    Curl_splayset(&nodes[i].snode, &nodes[i]);
+    root = Curl_splayinsert(nodes[i].key, root, &nodes[i].snode);
+    Curl_twheel_set(&nodes[i].wnode, &nodes[i]);
+    Curl_twheel_add(&w, nodes[i].key, &nodes[i].wnode);
+  }
+
+  for(round = 0; round < TW_ROUNDS; ++round) {
+    now = tw_add_ms(now, tw_rand() % 20, (int)(tw_rand() % 1000));
+    if(!(round % 500))
+      now = tw_add_ms(now, (timediff_t)3 * 24 * 3600 * 1000, 0);
+
+    /* the wheel never reports a later time than the tree's earliest */
+    n = Curl_twheel_next(&w, &when);
+    fail_unless(n, "wheel has no next");
+    root = Curl_splay(now, root);
+    removed = root;
+    while(removed && removed->smaller)
+      removed = removed->smaller;
+    fail_unless(removed && curlx_timediff_us(when, removed->key) <= 0,
+                "wheel next is later than splay");
+
+    t0 = curlx_now();
+    do {
+      root = Curl_splaygetbest(now, root, &removed);
+      if(removed) {
+        struct tw_test_node *tn = Curl_splayget(removed);
+        tn->fired = round;
+        fired_splay++;
+      }
+    } while(removed);
+    us_splay += curlx_timediff_us(curlx_now(), t0);
+
+    t0 = curlx_now();
+    do {
+      n = Curl_twheel_getbest(&w, now);
+      if(n) {
+        struct tw_test_node *tn = Curl_twheel_get(n);
+        fail_unless(tn->fired == round, "wheel and splay disagree");
+        tn->fired = TW_ROUNDS + round;
+        fired_wheel++;
+      }
+    } while(n);
+    us_wheel += curlx_timediff_us(curlx_now(), t0);
+    fail_unless(fired_splay == fired_wheel, "different number expired");
+
+    /* re-add the expired ones, update some others */
+    for(i = 0; i < TW_NODES; ++i) {
+      fail_unless(nodes[i].fired != round, "wheel and splay disagree");
+      if(nodes[i].fired == TW_ROUNDS + round) {
+        nodes[i].fired = -1;
+        nodes[i].key = tw_rand_key(now);
+        t0 = curlx_now();
+        root = Curl_splayinsert(nodes[i].key, root, &nodes[i].snode);
+        us_splay += curlx_timediff_us(curlx_now(), t0);
+        t0 = curlx_now();
+        Curl_twheel_add(&w, nodes[i].key, &nodes[i].wnode);
+        us_wheel += curlx_timediff_us(curlx_now(), t0);
+      }
+    }
+    for(i = 0; i < TW_CHURN; ++i) {
+      struct tw_test_node *tn = &nodes[tw_rand() % TW_NODES];
+      tn->key = tw_rand_key(now);
+      t0 = curlx_now();
+      fail_unless(!Curl_splayremove(root, &tn->snode, &root), "remove");
+      root = Curl_splayinsert(tn->key, root, &tn->snode);
+      us_splay += curlx_timediff_us(curlx_now(), t0);
+      t0 = curlx_now();
+      Curl_twheel_remove(&w, &tn->wnode);
+      Curl_twheel_add(&w, tn->key, &tn->wnode);
+      us_wheel += curlx_timediff_us(curlx_now(), t0);
+    }
+    fail_unless(Curl_twheel_count(&w) == TW_NODES, "wheel lost nodes");
+  }
+
+  curl_mfprintf(stderr, "%d nodes, %d rounds, %zu expired\n",
+                TW_NODES, TW_ROUNDS, fired_wheel);
+  curl_mfprintf(stderr, "splay: %" FMT_TIMEDIFF_T "us, "
+                "wheel: %" FMT_TIMEDIFF_T "us\n", us_splay, us_wheel);
+  Curl_twheel_destroy(&w);
+}
+
+static CURLcode test_unit3216(const char *arg)
+{
+  UNITTEST_BEGIN_SIMPLE
+
+  tw_check_basic();
+  tw_check_churn();
+
+  UNITTEST_END_SIMPLE
+}
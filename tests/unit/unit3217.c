@@ -0,0 +1,180 @@
+/***************************************************************************
+ *                                  _   _ ____  _
+ *  Project                     ___| | | |  _ \| |
+ *                             / __| | | | |_) | |
+ *                            | (__| |_| |  _ <| |___
+ *                             \___|\___/|_| \_\_____|
+ *
+ * Copyright (C) Daniel Stenberg, <daniel@haxx.se>, et al.
+ *
+ * This software is licensed as described in the file COPYING, which
+ * you should have received as part of this distribution. The terms
+ * are also available at https://curl.se/docs/copyright.html.
+ *
+ * You may opt to use, copy, modify, merge, publish, distribute and/or sell
+ * copies of the Software, and permit persons to whom the Software is
+ * furnished to do so, under the terms of the COPYING file.
+ *
+ * This software is distributed on an "AS IS" basis, WITHOUT WARRANTY OF ANY
+ * KIND, either express or implied.
+ *
+ * SPDX-License-Identifier: curl
+ *
+ ***************************************************************************/
+#include "unitcheck.h"
+
+#include "urldata.h"
+#include "http.h"
+#include "http1.h"
+
+#ifndef CURL_DISABLE_HTTP
+static struct httpreq *t3217_parse(struct h1_req_parser *p, const char *s)
+{
+  CURLcode err;
+  ssize_t nread;
+
+  Curl_h1_req_parse_free(p);
+  Curl_h1_req_parse_init(p, 1024);
+  nread = Curl_h1_req_parse_read(p, s, strlen(s), "https", 0, &err);
+  if((nread < 0) || !p->done)
+    return NULL;
+  return p->req;
+}
+
+/* the headers made with the template are those of Curl_http_req_to_h2() */
+static bool t3217_same(struct dynhds *pseudo, struct http_req_tmpl *tmpl,
+                       struct httpreq *req)
+{
+  struct dynhds all;
+  size_t npseudo = Curl_dynhds_count(pseudo);
+  size_t i;
+  bool same = FALSE;
+
+  Curl_dynhds_init(&all, 0, DYN_HTTP_REQUEST);
+  if(Curl_http_req_to_h2(&all, req, NULL))
+    goto out;
+  if(Curl_dynhds_count(&all) != npseudo + Curl_dynhds_count(&tmpl->hds))
+    goto out;
+  for(i = 0; i < Curl_dynhds_count(&all); ++i) {
+    struct dynhds_entry *a = Curl_dynhds_getn(&all, i);
+    struct dynhds_entry *e = (i < npseudo) ?
+      Curl_dynhds_getn(pseudo, i) :
+      Curl_dynhds_getn(&tmpl->hds, i - npseudo);
+    if(strcmp(a->name, e->name) || strcmp(a->value, e->value))
+      goto out;
+  }
+  same = TRUE;
+out:
+  Curl_dynhds_free(&all);
+  return same;
+}
+#endif
+
+static CURLcode test_unit3217(const char *arg)
+{
+  UNITTEST_BEGIN_SIMPLE
+
+#ifndef CURL_DISABLE_HTTP
+  static const char req1[] =
+    "GET /one HTTP/1.1\r\nHost: test.curl.se\r\nUser-Agent: xxx\r\n"
+    "Accept: */*\r\nConnection: keep-alive\r\nTE: gzip, trailers\r\n\r\n";
+  static const char req2[] =
+    "GET /two HTTP/1.1\r\nHost: test.curl.se\r\nUser-Agent: xxx\r\n"
+    "Accept: */*\r\nConnection: keep-alive\r\nTE: gzip, trailers\r\n\r\n";
+  static const char req3[] =
+    "POST /two HTTP/1.1\r\nHost: test.curl.se\r\nUser-Agent: xxx\r\n"
+    "Accept: */*\r\nConnection: keep-alive\r\nTE: gzip, trailers\r\n"
+    "Content-Length: 5\r\n\r\n";
+  static const char req4[] =
+    "POST /two HTTP/1.1\r\nHost: test.curl.se\r\nUser-Agent: xxx\r\n"
+    "Accept: */*\r\nConnection: keep-alive\r\nTE: gzip, trailers\r\n"
+    "Content-Length: 6\r\n\r\n";
+  static const char req5[] =
+    "POST /two HTTP/1.1\r\nHost: test.curl.se\r\nUser-Agent: yyy\r\n"
+    "X-Test: 1\r\nConnection: keep-alive\r\nTE: gzip\r\n"
+    "Content-Length: 6\r\n\r\n";
+  struct h1_req_parser p;
+  struct http_req_tmpl tmpl;
+  struct dynhds pseudo;
+  struct httpreq *req;
+  size_t converted;
+  struct dynhds_entry *e;
+
+  Curl_h1_req_parse_init(&p, 1024);
+  Curl_http_req_tmpl_init(&tmpl);
+  Curl_dynhds_init(&pseudo, 0, DYN_HTTP_REQUEST);
+
+  req = t3217_parse(&p, req1);
+  fail_unless(req, "parse req1");
+  if(!req)
+    goto out;
+  fail_unless(!Curl_http_req_to_h2_tmpl(&pseudo, &tmpl, req, NULL),
+              "req1 to h2");
+  /* Host and Connection are not HTTP/2 fields */
+  fail_unless(Curl_dynhds_count(&tmpl.hds) == 3, "req1 header count");
+  fail_unless(t3217_same(&pseudo, &tmpl, req), "req1 headers");
+  e = Curl_dynhds_getn(&tmpl.hds, 0);
+  fail_unless(e && !strcmp(e->name, "user-agent"), "name lower-cased");
+  e = Curl_dynhds_getn(&tmpl.hds, 2);
+  fail_unless(e && !strcmp(e->value, "trailers"), "TE value");
+  fail_unless(tmpl.converted == 3, "req1 converted");
+  converted = tmpl.converted;
+
+  /* same headers, another path: the template is used as it is */
+  req = t3217_parse(&p, req2);
+  fail_unless(req, "parse req2");
+  if(!req)
+    goto out;
+  fail_unless(!Curl_http_req_to_h2_tmpl(&pseudo, &tmpl, req, NULL),
+              "req2 to h2");
+  fail_unless(tmpl.converted == converted, "req2 converted again");
+  fail_unless(t3217_same(&pseudo, &tmpl, req), "req2 headers");
+  e = Curl_dynhds_cget(&pseudo, ":path");
+  fail_unless(e && !strcmp(e->value, "/two"), "req2 path");
+
+  /* another header: only that one is converted */
+  req = t3217_parse(&p, req3);
+  fail_unless(req, "parse req3");
+  if(!req)
+    goto out;
+  fail_unless(!Curl_http_req_to_h2_tmpl(&pseudo, &tmpl, req, NULL),
+              "req3 to h2");
+  fail_unless(Curl_dynhds_count(&tmpl.hds) == 4, "req3 header count");
+  fail_unless(t3217_same(&pseudo, &tmpl, req), "req3 headers");
+  fail_unless(tmpl.converted == converted + 1, "req3 converted");
+  converted = tmpl.converted;
+
+  /* another header value: only that value is replaced */
+  req = t3217_parse(&p, req4);
+  fail_unless(req, "parse req4");
+  if(!req)
+    goto out;
+  fail_unless(!Curl_http_req_to_h2_tmpl(&pseudo, &tmpl, req, NULL),
+              "req4 to h2");
+  e = Curl_dynhds_cget(&tmpl.hds, "content-length");
+  fail_unless(e && !strcmp(e->value, "6"), "req4 content-length");
+  fail_unless(t3217_same(&pseudo, &tmpl, req), "req4 headers");
+  fail_unless(tmpl.converted == converted + 1, "req4 converted");
+  converted = tmpl.converted;
+
+  /* another value, another name and a TE without "trailers": the headers
+   * from the changed name on are converted again */
+  req = t3217_parse(&p, req5);
+  fail_unless(req, "parse req5");
+  if(!req)
+    goto out;
+  fail_unless(!Curl_http_req_to_h2_tmpl(&pseudo, &tmpl, req, NULL),
+              "req5 to h2");
+  fail_unless(Curl_dynhds_count(&tmpl.hds) == 3, "req5 header count");
+  fail_unless(t3217_same(&pseudo, &tmpl, req), "req5 headers");
+  fail_unless(!Curl_dynhds_cget(&tmpl.hds, "te"), "req5 TE");
+  fail_unless(tmpl.converted == converted + 3, "req5 converted");
+
+out:
+  Curl_dynhds_free(&pseudo);
+  Curl_http_req_tmpl_free(&tmpl);
+  Curl_h1_req_parse_free(&p);
+#endif
+
+  UNITTEST_END_SIMPLE
+}
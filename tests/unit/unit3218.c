@@ -0,0 +1,161 @@
+/***************************************************************************
+ *                                  _   _ ____  _
+ *  Project                     ___| | | |  _ \| |
+ *                             / __| | | | |_) | |
+ *                            | (__| |_| |  _ <| |___
+ *                             \___|\___/|_| \_\_____|
+ *
+ * Copyright (C) Daniel Stenberg, <daniel@haxx.se>, et al.
+ *
+ * This software is licensed as described in the file COPYING, which
+ * you should have received as part of this distribution. The terms
+ * are also available at https://curl.se/docs/copyright.html.
+ *
+ * You may opt to use, copy, modify, merge, publish, distribute and/or sell
+ * copies of the Software, and permit persons to whom the Software is
+ * furnished to do so, under the terms of the COPYING file.
+ *
+ * This software is distributed on an "AS IS" basis, WITHOUT WARRANTY OF ANY
+ * KIND, either express or implied.
+ *
+ * SPDX-License-Identifier: curl
+ *
+ ***************************************************************************/
+#include "unitcheck.h"
+
+#include "urldata.h"
+#include "http.h"
+#include "http_prio.h"
+#include "dynhds.h"
+
+#if defined(USE_HTTP2) || defined(USE_HTTP3)
+/* the "priority" header added for `data`, or NULL */
+static const char *t3218_prio(struct Curl_easy *data, struct dynhds *h2,
+                              struct dynhds *hds)
+{
+  struct dynhds_entry *e;
+
+  Curl_dynhds_reset(h2);
+  if(Curl_http_req_add_prio(h2, hds, data))
+    return "error";
+  e = Curl_dynhds_get(h2, STRCONST("priority"));
+  return e ? e->value : NULL;
+}
+
+/* request body scheduling of the streams on one connection */
+static void t3218_sched(void)
+{
+  struct Curl_prio_sched sched;
+  struct Curl_prio_stream bulk, urgent, other;
+
+  memset(&sched, 0, sizeof(sched));
+  Curl_prio_stream_init(&bulk);
+  Curl_prio_stream_init(&urgent);
+  Curl_prio_stream_init(&other);
+  fail_unless(bulk.urgency == 3, "default urgency");
+
+  Curl_prio_set_urgency(&sched, &bulk, 7);
+  Curl_prio_set_urgency(&sched, &urgent, 1);
+
+  /* nothing queued, nobody waits */
+  Curl_prio_set_queued(&sched, &bulk, TRUE);
+  fail_unless(!Curl_prio_wait(&sched, &bulk), "bulk waits alone");
+  fail_unless(!Curl_prio_wait(&sched, &urgent), "urgent waits on bulk");
+
+  /* a more urgent stream with data queued holds back the less urgent */
+  Curl_prio_set_queued(&sched, &urgent, TRUE);
+  Curl_prio_set_queued(&sched, &urgent, TRUE);
+  fail_unless(sched.queued[1] == 1, "queued twice");
+  fail_unless(Curl_prio_wait(&sched, &bulk), "bulk does not wait");
+  fail_unless(Curl_prio_wait(&sched, &other), "default does not wait");
+  fail_unless(!Curl_prio_wait(&sched, &urgent), "urgent waits");
+
+  Curl_prio_defer(&sched, &bulk);
+  Curl_prio_defer(&sched, &bulk);
+  fail_unless(sched.deferred == 1, "deferred twice");
+  fail_unless(!sched.drained, "drained early");
+
+  /* streams of the same urgency do not wait on each other */
+  Curl_prio_set_urgency(&sched, &other, 1);
+  fail_unless(!Curl_prio_wait(&sched, &other), "same urgency waits");
+
+  /* the urgent stream sent its data, the deferred ones check again */
+  Curl_prio_set_queued(&sched, &urgent, FALSE);
+  fail_unless(sched.drained, "not drained");
+  fail_unless(!Curl_prio_wait(&sched, &bulk), "bulk still waits");
+  fail_unless(Curl_prio_undefer(&sched, &bulk), "bulk was not deferred");
+  fail_unless(!Curl_prio_undefer(&sched, &bulk), "bulk undeferred twice");
+  fail_unless(!sched.deferred, "still deferred");
+
+  /* a queued stream moves its count along with its urgency */
+  sched.drained = FALSE;
+  Curl_prio_set_queued(&sched, &urgent, TRUE);
+  Curl_prio_defer(&sched, &bulk);
+  Curl_prio_set_urgency(&sched, &urgent, 7);
+  fail_unless(!sched.queued[1] && (sched.queued[7] == 2), "count moved");
+  fail_unless(sched.drained, "urgency change did not drain");
+  fail_unless(!Curl_prio_wait(&sched, &bulk), "bulk waits on its urgency");
+  Curl_prio_undefer(&sched, &bulk);
+
+  Curl_prio_set_queued(&sched, &urgent, FALSE);
+  Curl_prio_set_queued(&sched, &bulk, FALSE);
+  fail_unless(!sched.queued[7], "not all gone");
+}
+#endif
+
+static CURLcode test_unit3218(const char *arg)
+{
+  UNITTEST_BEGIN_SIMPLE
+
+#if defined(USE_HTTP2) || defined(USE_HTTP3)
+  CURL *easy;
+  struct Curl_easy *data;
+  struct dynhds h2, hds;
+  const char *value;
+  char buf[16];
+
+  Curl_dynhds_init(&h2, 0, DYN_HTTP_REQUEST);
+  Curl_dynhds_init(&hds, 0, DYN_HTTP_REQUEST);
+  easy = curl_easy_init();
+  abort_unless(easy, "curl_easy_init()");
+  data = easy;
+
+  /* the default priority is not signaled */
+  fail_unless(data->set.priority.urgency == 3, "default urgency");
+  fail_unless(!Curl_http_prio_value(&data->set.priority, buf, sizeof(buf)),
+              "default priority has a value");
+  fail_unless(!t3218_prio(data, &h2, &hds), "default priority added");
+
+  fail_unless(curl_easy_setopt(easy, CURLOPT_STREAM_URGENCY, 8L) ==
+              CURLE_BAD_FUNCTION_ARGUMENT, "urgency 8 accepted");
+  fail_unless(curl_easy_setopt(easy, CURLOPT_STREAM_URGENCY, -1L) ==
+              CURLE_BAD_FUNCTION_ARGUMENT, "urgency -1 accepted");
+  fail_unless(data->set.priority.urgency == 3, "bad urgency changed it");
+
+  curl_easy_setopt(easy, CURLOPT_STREAM_URGENCY, 0L);
+  value = t3218_prio(data, &h2, &hds);
+  fail_unless(value && !strcmp(value, "u=0"), "urgency 0");
+
+  curl_easy_setopt(easy, CURLOPT_STREAM_URGENCY, 7L);
+  curl_easy_setopt(easy, CURLOPT_STREAM_INCREMENTAL, 1L);
+  value = t3218_prio(data, &h2, &hds);
+  fail_unless(value && !strcmp(value, "u=7, i"), "urgency 7, incremental");
+
+  curl_easy_setopt(easy, CURLOPT_STREAM_URGENCY, 3L);
+  value = t3218_prio(data, &h2, &hds);
+  fail_unless(value && !strcmp(value, "u=3, i"), "default urgency, "
+              "incremental");
+
+  /* a priority header of the request is kept */
+  Curl_dynhds_add(&hds, STRCONST("priority"), STRCONST("u=5"));
+  fail_unless(!t3218_prio(data, &h2, &hds), "request header overridden");
+
+  curl_easy_cleanup(easy);
+  Curl_dynhds_free(&h2);
+  Curl_dynhds_free(&hds);
+
+  t3218_sched();
+#endif
+
+  UNITTEST_END_SIMPLE
+}
@@ -0,0 +1,177 @@
+/***************************************************************************
+ *                                  _   _ ____  _
+ *  Project                     ___| | | |  _ \| |
+ *                             / __| | | | |_) | |
+ *                            | (__| |_| |  _ <| |___
+ *                             \___|\___/|_| \_\_____|
+ *
+ * Copyright (C) Daniel Stenberg, <daniel@haxx.se>, et al.
+ *
+ * This software is licensed as described in the file COPYING, which
+ * you should have received as part of this distribution. The terms
+ * are also available at https://curl.se/docs/copyright.html.
+ *
+ * You may opt to use, copy, modify, merge, publish, distribute and/or sell
+ * copies of the Software, and permit persons to whom the Software is
+ * furnished to do so, under the terms of the COPYING file.
+ *
+ * This software is distributed on an "AS IS" basis, WITHOUT WARRANTY OF ANY
+ * KIND, either express or implied.
+ *
+ * SPDX-License-Identifier: curl
+ *
+ ***************************************************************************/
+#include "unitcheck.h"
+
+#include "urldata.h"
+#include "conncache.h"
+#include "multiif.h"
+
+#include "memdebug.h" /* LAST include file */
+
+/* Idle connections in the pool are indexed by their `reuse_fp`. Check that
+ * a connection is in its idle set after becoming idle, leaves it when used
+ * again or terminated, and that Curl_cpool_find() offers the idle ones with
+ * the asked for `reuse_fp` first. */
+
+#define T3219_DEST "https:example.com:443"
+
+struct t3219_offers {
+  struct connectdata *conns[8];
+  size_t n;
+};
+
+static void t3219_meta_dtor(void *p)
+{
+  (void)p;
+}
+
+static struct connectdata *t3219_conn(unsigned int reuse_fp)
+{
+  struct connectdata *conn = calloc(1, sizeof(*conn));
+  if(!conn)
+    return NULL;
+  conn->sock[FIRSTSOCKET] = CURL_SOCKET_BAD;
+  conn->sock[SECONDARYSOCKET] = CURL_SOCKET_BAD;
+  conn->connection_id = -1;
+  conn->reuse_fp = reuse_fp;
+  conn->created = conn->lastused = curlx_now();
+  Curl_uint_spbset_init(&conn->xfers_attached);
+  Curl_hash_init(&conn->meta_hash, 23, Curl_hash_str, curlx_str_key_compare,
+                 t3219_meta_dtor);
+  conn->destination = strdup(T3219_DEST);
+  if(!conn->destination) {
+    Curl_uint_spbset_destroy(&conn->xfers_attached);
+    Curl_hash_destroy(&conn->meta_hash);
+    free(conn);
+    return NULL;
+  }
+  return conn;
+}
+
+/* record the connections offered, match none */
+static bool t3219_offer_cb(struct connectdata *conn, void *userdata)
+{
+  struct t3219_offers *offers = userdata;
+  if(offers->n < CURL_ARRAYSIZE(offers->conns))
+    offers->conns[offers->n++] = conn;
+  return FALSE;
+}
+
+static size_t t3219_find(struct Curl_easy *data, unsigned int reuse_fp,
+                         struct t3219_offers *offers)
+{
+  memset(offers, 0, sizeof(*offers));
+  (void)Curl_cpool_find(data, T3219_DEST, reuse_fp, t3219_offer_cb, NULL,
+                        offers);
+  return offers->n;
+}
+
+static CURLcode t3219_setup(void)
+{
+  CURLcode res = CURLE_OK;
+  global_init(CURL_GLOBAL_ALL);
+  return res;
+}
+
+static CURLcode test_unit3219(const char *arg)
+{
+  UNITTEST_BEGIN(t3219_setup())
+
+  struct Curl_multi *multi = NULL;
+  struct Curl_easy *data = NULL;
+  struct connectdata *a = NULL, *b = NULL, *c = NULL;
+  struct t3219_offers offers;
+
+  multi = curl_multi_init();
+  data = curl_easy_init();
+  abort_unless(multi && data, "init failed");
+  curl_multi_setopt(multi, CURLMOPT_MAXCONNECTS, 10L);
+  abort_unless(!curl_multi_add_handle(multi, data), "add handle failed");
+
+  a = t3219_conn(1);
+  b = t3219_conn(2);
+  c = t3219_conn(1);
+  abort_unless(a && b && c, "out of memory");
+  abort_unless(!Curl_cpool_add(data, a), "add a");
+  abort_unless(!Curl_cpool_add(data, b), "add b");
+  abort_unless(!Curl_cpool_add(data, c), "add c");
+
+  /* added connections are not idle yet */
+  fail_unless(Curl_cpool_idle_count(data, T3219_DEST, 1) == 0, "idle fp 1");
+  fail_unless(t3219_find(data, 1, &offers) == 3, "offered");
+  fail_unless(offers.conns[0] == a && offers.conns[1] == b &&
+              offers.conns[2] == c, "pool order");
+
+  fail_unless(Curl_cpool_conn_now_idle(data, a), "a not kept");
+  fail_unless(Curl_cpool_conn_now_idle(data, b), "b not kept");
+  fail_unless(Curl_cpool_conn_now_idle(data, c), "c not kept");
+  fail_unless(Curl_cpool_idle_count(data, T3219_DEST, 1) == 2, "idle fp 1");
+  fail_unless(Curl_cpool_idle_count(data, T3219_DEST, 2) == 1, "idle fp 2");
+  fail_unless(Curl_cpool_idle_count(data, T3219_DEST, 3) == 0, "idle fp 3");
+
+  /* idle ones with the fingerprint first, in the order they became idle,
+   * each connection offered once */
+  fail_unless(t3219_find(data, 1, &offers) == 3, "offered");
+  fail_unless(offers.conns[0] == a && offers.conns[1] == c &&
+              offers.conns[2] == b, "fp 1 order");
+  fail_unless(t3219_find(data, 2, &offers) == 3, "offered");
+  fail_unless(offers.conns[0] == b && offers.conns[1] == a &&
+              offers.conns[2] == c, "fp 2 order");
+
+  /* a connection used again leaves its idle set */
+  Curl_attach_connection(data, a);
+  fail_unless(Curl_cpool_idle_count(data, T3219_DEST, 1) == 1, "a in use");
+  fail_unless(t3219_find(data, 1, &offers) == 3, "offered");
+  fail_unless(offers.conns[0] == c && offers.conns[1] == a &&
+              offers.conns[2] == b, "fp 1 order, a in use");
+  Curl_detach_connection(data);
+  fail_unless(Curl_cpool_idle_count(data, T3219_DEST, 1) == 1, "a not idle");
+
+  /* and is added at the end when idle again */
+  fail_unless(Curl_cpool_conn_now_idle(data, a), "a not kept");
+  fail_unless(Curl_cpool_idle_count(data, T3219_DEST, 1) == 2, "a idle");
+  fail_unless(t3219_find(data, 1, &offers) == 3, "offered");
+  fail_unless(offers.conns[0] == c && offers.conns[1] == a, "a idle again");
+
+  /* terminated connections leave the pool and their idle set */
+  Curl_conn_terminate(data, c, TRUE);
+  fail_unless(Curl_cpool_idle_count(data, T3219_DEST, 1) == 1, "c gone");
+  fail_unless(t3219_find(data, 1, &offers) == 2, "offered");
+  fail_unless(offers.conns[0] == a && offers.conns[1] == b, "without c");
+
+  Curl_conn_terminate(data, b, TRUE);
+  fail_unless(Curl_cpool_idle_count(data, T3219_DEST, 2) == 0, "b gone");
+  fail_unless(t3219_find(data, 2, &offers) == 1, "offered");
+  fail_unless(offers.conns[0] == a, "only a");
+
+  Curl_conn_terminate(data, a, TRUE);
+  fail_unless(Curl_cpool_idle_count(data, T3219_DEST, 1) == 0, "a gone");
+  fail_unless(t3219_find(data, 1, &offers) == 0, "pool not empty");
+
+  curl_multi_remove_handle(multi, data);
+  curl_easy_cleanup(data);
+  curl_multi_cleanup(multi);
+
+  UNITTEST_END(curl_global_cleanup())
+}
@@ -0,0 +1,110 @@
+/***************************************************************************
+ *                                  _   _ ____  _
+ *  Project                     ___| | | |  _ \| |
+ *                             / __| | | | |_) | |
+ *                            | (__| |_| |  _ <| |___
+ *                             \___|\___/|_| \_\_____|
+ *
+ * Copyright (C) Daniel Stenberg, <daniel@haxx.se>, et al.
+ *
+ * This software is licensed as described in the file COPYING, which
+ * you should have received as part of this distribution. The terms
+ * are also available at https://curl.se/docs/copyright.html.
+ *
+ * You may opt to use, copy, modify, merge, publish, distribute and/or sell
+ * copies of the Software, and permit persons to whom the Software is
+ * furnished to do so, under the terms of the COPYING file.
+ *
+ * This software is distributed on an "AS IS" basis, WITHOUT WARRANTY OF ANY
+ * KIND, either express or implied.
+ *
+ * SPDX-License-Identifier: curl
+ *
+ ***************************************************************************/
+#include "unitcheck.h"
+
+#include "urldata.h"
+#include "cfilters.h"
+#include "http.h"
+#include "vtls/vtls.h"
+#include "vtls/vtls_int.h"
+
+#include "memdebug.h" /* LAST include file */
+
+#if defined(USE_SSL) && !defined(CURL_DISABLE_HTTP)
+/* want early data for a request with `method`, optionally as `custom` */
+static bool t3220_want(struct Curl_cfilter *cf, struct Curl_easy *data,
+                       Curl_HttpReq method, const char *custom)
+{
+  data->state.httpreq = method;
+  curl_easy_setopt(data, CURLOPT_CUSTOMREQUEST, custom);
+  return Curl_ssl_cf_want_earlydata(cf, data);
+}
+#endif
+
+static CURLcode test_unit3220(const char *arg)
+{
+  UNITTEST_BEGIN_SIMPLE
+
+#if defined(USE_SSL) && !defined(CURL_DISABLE_HTTP)
+  struct Curl_easy *data;
+  struct connectdata conn;
+  struct Curl_handler ftps;
+  struct Curl_cftype cft_ssl, cft_proxy;
+  struct Curl_cfilter cf;
+
+  data = curl_easy_init();
+  abort_unless(data, "curl_easy_init()");
+
+  memset(&conn, 0, sizeof(conn));
+  conn.handler = &Curl_handler_https;
+  memset(&cft_ssl, 0, sizeof(cft_ssl));
+  cft_ssl.name = "SSL";
+  cft_ssl.flags = CF_TYPE_SSL;
+  cft_proxy = cft_ssl;
+  cft_proxy.name = "SSL-PROXY";
+  cft_proxy.flags = CF_TYPE_SSL|CF_TYPE_PROXY;
+  memset(&cf, 0, sizeof(cf));
+  cf.cft = &cft_ssl;
+  cf.conn = &conn;
+
+  /* not without being asked for */
+  fail_unless(!t3220_want(&cf, data, HTTPREQ_GET, NULL), "GET by default");
+
+  /* only requests that may be replayed */
+  curl_easy_setopt(data, CURLOPT_SSL_OPTIONS, CURLSSLOPT_EARLYDATA_SAFE);
+  fail_unless(t3220_want(&cf, data, HTTPREQ_GET, NULL), "GET");
+  fail_unless(t3220_want(&cf, data, HTTPREQ_HEAD, NULL), "HEAD");
+  fail_unless(t3220_want(&cf, data, HTTPREQ_GET, "OPTIONS"), "OPTIONS");
+  fail_unless(!t3220_want(&cf, data, HTTPREQ_POST, NULL), "POST");
+  fail_unless(!t3220_want(&cf, data, HTTPREQ_POST_FORM, NULL), "POST form");
+  fail_unless(!t3220_want(&cf, data, HTTPREQ_PUT, NULL), "PUT");
+  fail_unless(!t3220_want(&cf, data, HTTPREQ_GET, "DELETE"), "DELETE");
+  fail_unless(!t3220_want(&cf, data, HTTPREQ_GET, "get"), "custom get");
+
+  /* only for HTTP */
+  ftps = Curl_handler_https;
+  ftps.protocol = CURLPROTO_FTPS;
+  conn.handler = &ftps;
+  fail_unless(!t3220_want(&cf, data, HTTPREQ_GET, NULL), "not HTTP");
+  conn.handler = &Curl_handler_https;
+
+  /* never to a proxy */
+#ifndef CURL_DISABLE_PROXY
+  cf.cft = &cft_proxy;
+  curl_easy_setopt(data, CURLOPT_PROXY_SSL_OPTIONS,
+                   CURLSSLOPT_EARLYDATA_SAFE);
+  fail_unless(!t3220_want(&cf, data, HTTPREQ_GET, NULL), "GET to proxy");
+  cf.cft = &cft_ssl;
+#endif
+
+  /* CURLSSLOPT_EARLYDATA is for all requests */
+  curl_easy_setopt(data, CURLOPT_SSL_OPTIONS, CURLSSLOPT_EARLYDATA);
+  fail_unless(t3220_want(&cf, data, HTTPREQ_POST, NULL), "all, POST");
+  fail_unless(t3220_want(&cf, data, HTTPREQ_GET, "DELETE"), "all, DELETE");
+
+  curl_easy_cleanup(data);
+#endif
+
+  UNITTEST_END_SIMPLE
+}
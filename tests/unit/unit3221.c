@@ -0,0 +1,176 @@
+/***************************************************************************
+ *                                  _   _ ____  _
+ *  Project                     ___| | | |  _ \| |
+ *                             / __| | | | |_) | |
+ *                            | (__| |_| |  _ <| |___
+ *                             \___|\___/|_| \_\_____|
+ *
+ * Copyright (C) Daniel Stenberg, <daniel@haxx.se>, et al.
+ *
+ * This software is licensed as described in the file COPYING, which
+ * you should have received as part of this distribution. The terms
+ * are also available at https://curl.se/docs/copyright.html.
+ *
+ * You may opt to use, copy, modify, merge, publish, distribute and/or sell
+ * copies of the Software, and permit persons to whom the Software is
+ * furnished to do so, under the terms of the COPYING file.
+ *
+ * This software is distributed on an "AS IS" basis, WITHOUT WARRANTY OF ANY
+ * KIND, either express or implied.
+ *
+ * SPDX-License-Identifier: curl
+ *
+ ***************************************************************************/
+#include "unitcheck.h"
+
+#include "urldata.h"
+#include "cfilters.h"
+#include "vtls/vtls.h"
+#include "vtls/vtls_int.h"
+
+#ifdef USE_OPENSSL
+#include "vtls/openssl.h"
+#endif
+
+#include "memdebug.h" /* LAST include file */
+
+#if defined(USE_OPENSSL) && defined(HAVE_OSSL_VERIFY_POOL)
+/* Verify `cert` against `store` the way a handshake does, calling the
+ * verify callback until it has an answer. `*rounds` is the number of
+ * calls it took. */
+static int t3221_verify(struct Curl_cfilter *cf, SSL *ssl,
+                        X509_STORE *store, X509 *cert, int *perror,
+                        int *rounds)
+{
+  struct ssl_connect_data *connssl = cf->ctx;
+  struct ossl_ctx *octx = connssl->backend;
+  X509_STORE_CTX *ctx = X509_STORE_CTX_new();
+  int rc = -1;
+
+  *rounds = 0;
+  if(!ctx || !X509_STORE_CTX_init(ctx, store, cert, NULL) ||
+     !X509_STORE_CTX_set_ex_data(ctx, SSL_get_ex_data_X509_STORE_CTX_idx(),
+                                 ssl))
+    goto out;
+
+  for(;;) {
+    rc = ossl_verify_cb(ctx, NULL);
+    ++*rounds;
+    if(!octx->verify_job || *rounds > 2)
+      break;
+    /* the handshake waits until the worker is done */
+    while(!ossl_verify_job_done(octx->verify_job))
+      curlx_wait_ms(1);
+  }
+  *perror = X509_STORE_CTX_get_error(ctx);
+
+out:
+  X509_STORE_CTX_free(ctx);
+  return rc;
+}
+
+static X509 *t3221_load_cert(const char *file)
+{
+  X509 *cert = NULL;
+  BIO *bio = BIO_new_file(file, "r");
+
+  if(bio) {
+    cert = PEM_read_bio_X509(bio, NULL, NULL, NULL);
+    BIO_free(bio);
+  }
+  return cert;
+}
+#endif
+
+static CURLcode test_unit3221(const char *arg)
+{
+  UNITTEST_BEGIN_SIMPLE
+
+#if defined(USE_OPENSSL) && defined(HAVE_OSSL_VERIFY_POOL)
+  CURLM *multi = NULL;
+  struct Curl_easy *data = NULL;
+  SSL_CTX *ssl_ctx = NULL;
+  SSL *ssl = NULL;
+  X509_STORE *trusted = NULL;
+  X509_STORE *empty = NULL;
+  X509 *cert = NULL;
+  struct ossl_ctx octx;
+  struct ssl_connect_data connssl;
+  struct Curl_cftype cft;
+  struct Curl_cfilter cf;
+  int error = -1;
+  int rounds = 0;
+  int rc;
+
+  multi = curl_multi_init();
+  data = curl_easy_init();
+  abort_unless(multi && data, "init");
+  curl_multi_setopt(multi, CURLMOPT_VERIFY_THREADS, 1L);
+  curl_multi_add_handle(multi, data);
+
+  /* the CA in the store and the server certificate it signed */
+  trusted = X509_STORE_new();
+  empty = X509_STORE_new();
+  cert = t3221_load_cert(libtest_arg2);
+  ssl_ctx = SSL_CTX_new(TLS_client_method());
+  ssl = ssl_ctx ? SSL_new(ssl_ctx) : NULL;
+  if(!trusted || !empty || !cert || !ssl ||
+     !X509_STORE_load_file(trusted, arg)) {
+    unitfail++;
+    goto out;
+  }
+  SSL_set_connect_state(ssl);
+
+  /* a connection filter with the handshake in progress */
+  memset(&octx, 0, sizeof(octx));
+  octx.ssl_ctx = ssl_ctx;
+  octx.ssl = ssl;
+  memset(&connssl, 0, sizeof(connssl));
+  connssl.backend = &octx;
+  connssl.call_data.data = data;
+  memset(&cft, 0, sizeof(cft));
+  cft.name = "SSL";
+  cft.flags = CF_TYPE_SSL;
+  memset(&cf, 0, sizeof(cf));
+  cf.cft = &cft;
+  cf.ctx = &connssl;
+  cf.conn = data->conn;
+  SSL_set_app_data(ssl, &cf);
+
+  /* without the pool, the chain is verified right away */
+  rc = t3221_verify(&cf, ssl, trusted, cert, &error, &rounds);
+  fail_unless(rc == 1, "verified without the pool");
+  fail_unless(error == X509_V_OK, "no error without the pool");
+  fail_unless(rounds == 1, "one call without the pool");
+
+  /* with it, the first call queues a job and has the handshake retry,
+   * the second hands over what the worker found */
+  octx.verify_async = TRUE;
+  rc = t3221_verify(&cf, ssl, trusted, cert, &error, &rounds);
+  fail_unless(rc == 1, "verified by the worker");
+  fail_unless(error == X509_V_OK, "no error from the worker");
+  fail_unless(rounds == 2, "retried once for the worker");
+  fail_unless(!octx.verify_job, "job dropped when applied");
+
+  /* a chain the worker cannot verify fails the same */
+  rc = t3221_verify(&cf, ssl, empty, cert, &error, &rounds);
+  fail_unless(rc == 0, "not verified by the worker");
+  fail_unless(error == X509_V_ERR_UNABLE_TO_GET_ISSUER_CERT_LOCALLY,
+              "issuer error from the worker");
+  fail_unless(rounds == 2, "retried once for the failing worker");
+  fail_unless(!octx.verify_job, "failed job dropped when applied");
+
+out:
+  if(ssl)
+    SSL_free(ssl);
+  SSL_CTX_free(ssl_ctx);
+  X509_free(cert);
+  X509_STORE_free(empty);
+  X509_STORE_free(trusted);
+  curl_multi_remove_handle(multi, data);
+  curl_easy_cleanup(data);
+  curl_multi_cleanup(multi);
+#endif
+
+  UNITTEST_END_SIMPLE
+}